@@ -22,6 +22,9 @@ void FAbcImportSettingsCustomization::CustomizeDetails(IDetailLayoutBuilder& Lay
 	IDetailCategoryBuilder& StaticMeshBuilder = LayoutBuilder.EditCategory("StaticMesh");
 	StaticMeshBuilder.SetCategoryVisibility(EnumValue == (uint8)EAlembicImportType::StaticMesh);
 
+	IDetailCategoryBuilder& GeometryCacheBuilder = LayoutBuilder.EditCategory("GeometryCache");
+	GeometryCacheBuilder.SetCategoryVisibility(EnumValue == (uint8)EAlembicImportType::GeometryCache);
+
 	FSimpleDelegate OnImportTypeChangedDelegate = FSimpleDelegate::CreateSP(this, &FAbcImportSettingsCustomization::OnImportTypeChanged, &LayoutBuilder);
 	ImportType->SetOnPropertyValueChanged(OnImportTypeChangedDelegate);
 
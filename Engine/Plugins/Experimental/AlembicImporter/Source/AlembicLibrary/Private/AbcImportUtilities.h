@@ -16,6 +16,7 @@ THIRD_PARTY_INCLUDES_END
 
 #include "GeometryCache.h"
 #include "GeometryCacheTrackFlipbookAnimation.h"
+#include "GeometryCacheTrackStreamedAnimation.h"
 #include "GeometryCacheTrackTransformAnimation.h"
 #include "GeometryCacheMeshData.h"
 #include "GeometryCacheComponent.h"
@@ -942,6 +942,11 @@ UGeometryCache* FAbcImporter::ImportAsGeometryCache(UObject* InParent, EObjectFl
 					// TransformAnimation
 					Track = CreateTransformAnimationTrack(MeshObject->Name, MeshObject, GeometryCache, MaterialOffset);
 				}
+				else if (ImportData->ImportSettings->GeometryCacheSettings.bStreamVertexAnimation)
+				{
+					// StreamedAnimation
+					Track = CreateStreamedAnimationTrack(MeshObject->Name, MeshObject, GeometryCache, MaterialOffset, ImportData->ImportSettings->GeometryCacheSettings.KeyframeInterval);
+				}
 				else
 				{
 					// FlibookAnimation
@@ -1587,6 +1592,41 @@ UGeometryCacheTrack_FlipbookAnimation* FAbcImporter::CreateFlipbookAnimationTrac
 	return Track;
 }
 
+UGeometryCacheTrack_StreamedAnimation* FAbcImporter::CreateStreamedAnimationTrack(const FString& TrackName, TSharedPtr<FAbcPolyMeshObject>& InMeshObject, UGeometryCache* GeometryCacheParent, const uint32 MaterialOffset, const int32 KeyframeInterval)
+{
+	UGeometryCacheTrack_StreamedAnimation* Track = NewObject<UGeometryCacheTrack_StreamedAnimation>(GeometryCacheParent, FName(*TrackName), RF_Public);
+	Track->KeyframeInterval = FMath::Max(KeyframeInterval, 1);
+
+	FScopedSlowTask SlowTask(150, FText::FromString(FString(TEXT("Loading Tracks"))));
+	SlowTask.MakeDialog(true);
+
+	// Samples are encoded as they are added, so only one group of them is kept around uncompressed
+	const uint32 NumSamples = InMeshObject->NumSamples;
+	for (uint32 SampleIndex = 0; SampleIndex < NumSamples; ++SampleIndex)
+	{
+		FFormatNamedArguments Arguments;
+		Arguments.Add(TEXT("TrackName"), FText::FromString(TrackName));
+		Arguments.Add(TEXT("SampleIndex"), FText::AsNumber(SampleIndex + 1));
+		Arguments.Add(TEXT("NumSamples"), FText::AsNumber(NumSamples));
+
+		SlowTask.EnterProgressFrame(100.0f / (float)NumSamples, FText::Format(LOCTEXT("AbcImporter_CreateStreamedAnimationTrack", "Compressing Track: {TrackName} [Sample {SampleIndex} of {NumSamples}]"), Arguments));
+
+		FGeometryCacheMeshData MeshData;
+		GenerateGeometryCacheMeshDataForSample(MeshData, InMeshObject, SampleIndex, MaterialOffset);
+
+		const float SampleTime = InMeshObject->MeshSamples[SampleIndex]->SampleTime;
+		Track->AddMeshSample(MeshData, SampleTime);
+
+		if (GWarn->ReceivedUserCancel())
+		{
+			return nullptr;
+		}
+	}
+
+	Track->FinishAddingMeshSamples();
+	return Track;
+}
+
 UGeometryCacheTrack_TransformAnimation* FAbcImporter::CreateTransformAnimationTrack(const FString& TrackName, TSharedPtr<FAbcPolyMeshObject>& InMeshObject, UGeometryCache* GeometryCacheParent, const uint32 MaterialOffset)
 {
 	// Create the TransformAnimationTrack 
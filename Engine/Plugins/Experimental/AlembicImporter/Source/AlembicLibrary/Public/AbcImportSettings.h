@@ -172,6 +172,25 @@ struct FAbcMaterialSettings
 };
 
 
+USTRUCT()
+struct FAbcGeometryCacheSettings
+{
+	GENERATED_USTRUCT_BODY()
+
+	FAbcGeometryCacheSettings()
+		: bStreamVertexAnimation(false)
+		, KeyframeInterval(30)
+	{}
+
+	/** Whether or not to compress vertex animated objects and stream their frames during playback instead of keeping all frames in memory */
+	UPROPERTY(EditAnywhere, Category = GeometryCache)
+	bool bStreamVertexAnimation;
+
+	/** Number of frames stored relative to one keyframe when streaming, larger values compress better but decode more frames at a time */
+	UPROPERTY(EditAnywhere, Category = GeometryCache, meta = (EditCondition = "bStreamVertexAnimation", ClampMin = "1", UIMin = "1", UIMax = "120"))
+	int32 KeyframeInterval;
+};
+
 USTRUCT()
 struct FAbcStaticMeshSettings
 {
@@ -264,6 +283,9 @@ class ALEMBICLIBRARY_API UAbcImportSettings : public UObject
 	UPROPERTY(EditAnywhere, meta = (ShowOnlyInnerProperties), Category = StaticMesh)
 	FAbcStaticMeshSettings StaticMeshSettings;
 
+	UPROPERTY(EditAnywhere, meta = (ShowOnlyInnerProperties), Category = GeometryCache)
+	FAbcGeometryCacheSettings GeometryCacheSettings;
+
 	UPROPERTY(EditAnywhere, meta = (ShowOnlyInnerProperties), Category = Conversion)
 	FAbcConversionSettings ConversionSettings;
 
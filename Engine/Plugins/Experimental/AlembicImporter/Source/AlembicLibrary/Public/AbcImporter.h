@@ -21,6 +21,7 @@ class UStaticMesh;
 class USkeletalMesh;
 class UGeometryCache;
 class UGeometryCacheTrack_FlipbookAnimation;
+class UGeometryCacheTrack_StreamedAnimation;
 class UGeometryCacheTrack_TransformAnimation;
 class UAbcImportSettings;
 class FSkeletalMeshImportData;
@@ -154,6 +155,17 @@ private:
 	*/
 	UGeometryCacheTrack_FlipbookAnimation* CreateFlipbookAnimationTrack(const FString& TrackName, TSharedPtr<FAbcPolyMeshObject>& InMeshObject, UGeometryCache* GeometryCacheParent, const uint32 MaterialOffset);
 
+	/**
+	* CreateStreamedAnimationTrack
+	*
+	* @param Name - Alembic Object Name
+	* @param PolyMesh - Alembic PolyMeshSchema Object used for creation of the track
+	* @param GeometryCacheParent - Parent for the GeometryCacheTrack
+	* @param KeyframeInterval - Number of samples encoded relative to one keyframe
+	* @return UGeometryCacheTrack_StreamedAnimation*
+	*/
+	UGeometryCacheTrack_StreamedAnimation* CreateStreamedAnimationTrack(const FString& TrackName, TSharedPtr<FAbcPolyMeshObject>& InMeshObject, UGeometryCache* GeometryCacheParent, const uint32 MaterialOffset, const int32 KeyframeInterval);
+
 	/**
 	* CreateTransformAnimationTrack
 	*
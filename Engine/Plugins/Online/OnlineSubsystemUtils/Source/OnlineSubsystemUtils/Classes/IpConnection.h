@@ -33,4 +33,8 @@ class ONLINESUBSYSTEMUTILS_API UIpConnection : public UNetConnection
 	virtual int32 GetAddrPort(void) override;
 	virtual FString RemoteAddressToString() override;
 	//~ End NetConnection Interface
+
+protected:
+	/** Lets a threaded PacketHandler send the packets it processed straight to the socket, from the packet handler thread */
+	void InitThreadedSend();
 };
@@ -15,6 +15,9 @@ class Error;
 class FInternetAddr;
 class FNetworkNotify;
 class FSocket;
+class FSocketRecvBatch;
+class FSocketSendBatch;
+class UIpConnection;
 
 UCLASS(transient, config=Engine)
 class ONLINESUBSYSTEMUTILS_API UIpNetDriver : public UNetDriver
@@ -46,6 +49,7 @@ class ONLINESUBSYSTEMUTILS_API UIpNetDriver : public UNetDriver
 	virtual bool InitListen( FNetworkNotify* InNotify, FURL& LocalURL, bool bReuseAddressAndPort, FString& Error ) override;
 	virtual void ProcessRemoteFunction(class AActor* Actor, class UFunction* Function, void* Parameters, struct FOutParmRec* OutParms, struct FFrame* Stack, class UObject* SubObject = NULL) override;
 	virtual void TickDispatch( float DeltaTime ) override;
+	virtual void TickFlush(float DeltaSeconds) override;
 	virtual void LowLevelSend(FString Address, void* Data, int32 CountBits) override;
 	virtual FString LowLevelGetNetworkNumber() override;
 	virtual void LowLevelDestroy() override;
@@ -59,6 +63,19 @@ class ONLINESUBSYSTEMUTILS_API UIpNetDriver : public UNetDriver
 	//~ Begin UIpNetDriver Interface.
 	virtual FSocket * CreateSocket();
 
+	/**
+	 * Queues a packet of a connection, to be sent to the socket with the other packets sent while the driver flushes.
+	 *
+	 * @param Data The packet to send, copied into the send batch.
+	 * @param Count The size of the packet.
+	 * @param Destination The address to send to.
+	 * @return false if the driver isn't flushing or the packet doesn't fit the batch, in which case it must be sent right away.
+	 */
+	bool QueueBatchedSend(const uint8* Data, int32 Count, const TSharedRef<FInternetAddr>& Destination);
+
+	/** Sends the queued packets to the socket. */
+	void FlushBatchedSends();
+
 	/**
 	 * Returns the port number to use when a client is creating a socket.
 	 * Platforms that can't use the default of 0 (system-selected port) may override
@@ -81,6 +98,25 @@ class ONLINESUBSYSTEMUTILS_API UIpNetDriver : public UNetDriver
 	/** @return TCPIP connection to server */
 	class UIpConnection* GetServerConnection();
 
+protected:
+
+	/** @return The connection the address belongs to, or null if there is none */
+	UIpConnection* FindConnection(const FInternetAddr& FromAddr);
+
+	/** Hands a received packet to its connection, or to the connectionless handler of a new connection */
+	void ProcessReceivedPacket(uint8* Data, int32 BytesRead, const FInternetAddr& FromAddr);
+
+	/** Packets read from the socket by TickDispatch, the buffers are allocated once so receiving doesn't allocate per packet */
+	TSharedPtr<FSocketRecvBatch> RecvBatch;
+
+	/** Packets queued by the connections while the driver flushes */
+	TSharedPtr<FSocketSendBatch> SendBatch;
+
+	/** Whether the connections queue their packets into the send batch */
+	bool bIsBatchingSends;
+
+public:
+
 	// Callback for platform handling when networking is taking a long time in a single frame (by default over 1 second).
 	// It may get called multiple times in a single frame if additional processing after a previous alert exceeds the threshold again
 	DECLARE_MULTICAST_DELEGATE(FOnNetworkProcessingCausingSlowFrame);
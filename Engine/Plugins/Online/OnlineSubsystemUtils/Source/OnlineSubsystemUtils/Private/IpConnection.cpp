@@ -8,6 +8,7 @@ Notes:
 =============================================================================*/
 
 #include "IpConnection.h"
+#include "IpNetDriver.h"
 #include "SocketSubsystem.h"
 
 #include "IPAddress.h"
@@ -71,6 +72,8 @@ void UIpConnection::InitLocalConnection(UNetDriver* InDriver, class FSocket* InS
 
 	// Initialize our send bunch
 	InitSendBuffer();
+
+	InitThreadedSend();
 }
 
 void UIpConnection::InitRemoteConnection(UNetDriver* InDriver, class FSocket* InSocket, const FURL& InURL, const class FInternetAddr& InRemoteAddr, EConnectionState InState, int32 InMaxPacket, int32 InPacketOverhead)
@@ -92,11 +95,30 @@ void UIpConnection::InitRemoteConnection(UNetDriver* InDriver, class FSocket* In
 	// Initialize our send bunch
 	InitSendBuffer();
 
+	InitThreadedSend();
+
 	// This is for a client that needs to log in, setup ClientLoginState and ExpectedClientLoginMsgType to reflect that
 	SetClientLoginState( EClientLoginState::LoggingIn );
 	SetExpectedClientLoginMsgType( NMT_Hello );
 }
 
+void UIpConnection::InitThreadedSend()
+{
+	if (Handler.IsValid() && Socket != nullptr && RemoteAddr.IsValid())
+	{
+		// Both are kept alive until the net driver flushed the handler, before destroying the socket
+		FSocket* SendSocket = Socket;
+		FInternetAddr* SendAddr = RemoteAddr.Get();
+
+		Handler->SetThreadedSendFunction([SendSocket, SendAddr](const uint8* Data, int32 CountBits)
+			{
+				int32 BytesSent = 0;
+
+				SendSocket->SendTo(Data, FMath::DivideAndRoundUp(CountBits, 8), BytesSent, *SendAddr);
+			});
+	}
+}
+
 void UIpConnection::LowLevelSend(void* Data, int32 CountBytes, int32 CountBits)
 {
 	const uint8* DataToSend = reinterpret_cast<uint8*>(Data);
@@ -132,7 +154,17 @@ void UIpConnection::LowLevelSend(void* Data, int32 CountBytes, int32 CountBits)
 
 
 	// Process any packet modifiers
-	if (Handler.IsValid() && !Handler->GetRawSend())
+	if (Handler.IsValid() && Handler->IsThreaded())
+	{
+		// Processed and sent by the packet handler thread, which bypasses the batched sends of the driver
+		Handler->QueueOutgoing(DataToSend, CountBits);
+
+		NETWORK_PROFILER(GNetworkProfiler.FlushOutgoingBunches(this));
+		NETWORK_PROFILER(GNetworkProfiler.TrackSocketSendTo(Socket->GetDescription(),DataToSend,CountBytes,NumPacketIdBits,NumBunchBits,NumAckBits,NumPaddingBits,this));
+
+		return;
+	}
+	else if (Handler.IsValid() && !Handler->GetRawSend())
 	{
 		const ProcessedPacket ProcessedData = Handler->Outgoing(reinterpret_cast<uint8*>(Data), CountBits);
 
@@ -160,7 +192,16 @@ void UIpConnection::LowLevelSend(void* Data, int32 CountBytes, int32 CountBits)
 
 	if (CountBytes > 0)
 	{
-		Socket->SendTo(DataToSend, CountBytes, BytesSent, *RemoteAddr);
+		// While the driver flushes, packets are sent to the socket together with the packets of the other connections
+		UIpNetDriver* IpDriver = Cast<UIpNetDriver>(Driver);
+		if (IpDriver && IpDriver->Socket == Socket && IpDriver->QueueBatchedSend(DataToSend, CountBytes, RemoteAddr.ToSharedRef()))
+		{
+			BytesSent = CountBytes;
+		}
+		else
+		{
+			Socket->SendTo(DataToSend, CountBytes, BytesSent, *RemoteAddr);
+		}
 	}
 
 	UNCLOCK_CYCLES(Driver->SendCycles);
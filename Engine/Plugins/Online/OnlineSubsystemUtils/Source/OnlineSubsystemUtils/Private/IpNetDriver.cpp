@@ -21,6 +21,7 @@ Notes:
 
 #include "IPAddress.h"
 #include "Sockets.h"
+#include "SocketBatch.h"
 
 /*-----------------------------------------------------------------------------
 	Declarations.
@@ -47,8 +48,27 @@ FAutoConsoleVariableRef GIpNetDriverLongFramePrintoutThresholdSecsCVar(
 	TEXT("Time to spend processing networking data in a single frame before an output log warning is printed (in seconds)\n")
 	TEXT(" default: 10 s"));
 
+// Number of packets read from the socket at once
+int32 GIpNetDriverRecvBatchSize = 32;
+
+FAutoConsoleVariableRef GIpNetDriverRecvBatchSizeCVar(
+	TEXT("n.IpNetDriverRecvBatchSize"),
+	GIpNetDriverRecvBatchSize,
+	TEXT("Number of packets read from the socket at once, into buffers preallocated when the driver starts receiving\n")
+	TEXT(" default: 32"));
+
+// Number of packets sent to the socket at once
+int32 GIpNetDriverSendBatchSize = 32;
+
+FAutoConsoleVariableRef GIpNetDriverSendBatchSizeCVar(
+	TEXT("n.IpNetDriverSendBatchSize"),
+	GIpNetDriverSendBatchSize,
+	TEXT("Number of packets the connections queue while the driver flushes before they are sent to the socket at once, 0 sends every packet right away\n")
+	TEXT(" default: 32"));
+
 UIpNetDriver::UIpNetDriver(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
+	, bIsBatchingSends(false)
 {
 }
 
@@ -219,10 +239,12 @@ void UIpNetDriver::TickDispatch( float DeltaTime )
 	const double StartReceiveTime = FPlatformTime::Seconds();
 	double AlarmTime = StartReceiveTime + GIpNetDriverMaxDesiredTimeSliceBeforeAlarmSecs;
 
-	// Process all incoming packets.
-	uint8 Data[MAX_PACKET_SIZE];
-	uint8* DataRef = Data;
-	TSharedRef<FInternetAddr> FromAddr = SocketSubsystem->CreateInternetAddr();
+	// Process all incoming packets, received in batches into the preallocated buffers.
+	if (!RecvBatch.IsValid())
+	{
+		RecvBatch = MakeShareable(new FSocketRecvBatch(*SocketSubsystem, GIpNetDriverRecvBatchSize, MAX_PACKET_SIZE));
+	}
+	FSocketRecvBatch& Batch = *RecvBatch;
 
 	for( ; Socket != NULL; )
 	{
@@ -236,210 +258,279 @@ void UIpNetDriver::TickDispatch( float DeltaTime )
 			}
 		}
 
-		int32 BytesRead = 0;
-
 		// Get data, if any.
 		CLOCK_CYCLES(RecvCycles);
-		bool bOk = Socket->RecvFrom(Data, sizeof(Data), BytesRead, *FromAddr);
+		bool bOk = Socket->RecvFromMulti(Batch);
 		UNCLOCK_CYCLES(RecvCycles);
 
+		// The error code has to be read before the packets received ahead of it are processed
+		const ESocketErrors Error = bOk ? SE_NO_ERROR : SocketSubsystem->GetLastErrorCode();
+
+		for (int32 PacketIndex = 0; PacketIndex < Batch.Num(); PacketIndex++)
+		{
+			ProcessReceivedPacket(Batch.GetData(PacketIndex), Batch.GetSize(PacketIndex), Batch.GetSource(PacketIndex));
+		}
+
 		if (bOk)
 		{
-			// Immediately stop processing, for empty packets (usually a DDoS)
-			if (BytesRead == 0)
+			// A batch that isn't full means there is no more data, or an empty packet (usually a DDoS) stopped it, which immediately stops processing
+			if (Batch.Num() < Batch.Max())
 			{
 				break;
 			}
+			continue;
+		}
+
+		const FInternetAddr& FromAddr = Batch.GetSource(Batch.Num());
+
+		if(Error == SE_EWOULDBLOCK ||
+		   Error == SE_NO_ERROR)
+		{
+			// No data or no error?
+			break;
 		}
 		else
 		{
-			ESocketErrors Error = SocketSubsystem->GetLastErrorCode();
-			if(Error == SE_EWOULDBLOCK ||
-			   Error == SE_NO_ERROR)
+			// MalformedPacket: Client tried sending a packet that exceeded the maximum packet limit
+			// enforced by the server
+			if (Error == SE_EMSGSIZE)
 			{
-				// No data or no error?
-				break;
-			}
-			else
-			{
-				// MalformedPacket: Client tried sending a packet that exceeded the maximum packet limit
-				// enforced by the server
-				if (Error == SE_EMSGSIZE)
+				UIpConnection* Connection = nullptr;
+				if (GetServerConnection() && (*GetServerConnection()->RemoteAddr == FromAddr))
 				{
-					UIpConnection* Connection = nullptr;
-					if (GetServerConnection() && (*GetServerConnection()->RemoteAddr == *FromAddr))
-					{
-						Connection = GetServerConnection();
-					}
-
-					if (Connection != nullptr)
-					{
-						UE_SECURITY_LOG(Connection, ESecurityEvent::Malformed_Packet, TEXT("Received Packet with bytes > max MTU"));
-					}
+					Connection = GetServerConnection();
 				}
 
-				if( Error != SE_ECONNRESET && Error != SE_UDP_ERR_PORT_UNREACH )
+				if (Connection != nullptr)
 				{
-					UE_LOG(LogNet, Warning, TEXT("UDP recvfrom error: %i (%s) from %s"),
-						(int32)Error,
-						SocketSubsystem->GetSocketError(Error),
-						*FromAddr->ToString(true));
-					break;
+					UE_SECURITY_LOG(Connection, ESecurityEvent::Malformed_Packet, TEXT("Received Packet with bytes > max MTU"));
 				}
 			}
-		}
-		// Figure out which socket the received data came from.
-		UIpConnection* Connection = nullptr;
-		UIpConnection* MyServerConnection = GetServerConnection();
-		if (MyServerConnection)
-		{
-			if ((*MyServerConnection->RemoteAddr == *FromAddr))
-			{
-				Connection = MyServerConnection;
-			}
-			else
-			{
-				UE_LOG(LogNet, Warning, TEXT("Incoming ip address doesn't match expected server address: Actual: %s Expected: %s"),
-					*FromAddr->ToString(true),
-					MyServerConnection->RemoteAddr.IsValid() ? *MyServerConnection->RemoteAddr->ToString(true) : TEXT("Invalid"));
-			}
-		}
-		for( int32 i=0; i<ClientConnections.Num() && !Connection; i++ )
-		{
-			UIpConnection* TestConnection = (UIpConnection*)ClientConnections[i]; 
-            check(TestConnection);
-			if(*TestConnection->RemoteAddr == *FromAddr)
+
+			if( Error != SE_ECONNRESET && Error != SE_UDP_ERR_PORT_UNREACH )
 			{
-				Connection = TestConnection;
+				UE_LOG(LogNet, Warning, TEXT("UDP recvfrom error: %i (%s) from %s"),
+					(int32)Error,
+					SocketSubsystem->GetSocketError(Error),
+					*FromAddr.ToString(true));
+				break;
 			}
 		}
 
-		if( bOk == false )
+		// Figure out which socket the error came from.
+		UIpConnection* Connection = FindConnection(FromAddr);
+
+		if( Connection )
 		{
-			if( Connection )
+			if( Connection != GetServerConnection() )
 			{
-				if( Connection != GetServerConnection() )
+				// We received an ICMP port unreachable from the client, meaning the client is no longer running the game
+				// (or someone is trying to perform a DoS attack on the client)
+
+				// rcg08182002 Some buggy firewalls get occasional ICMP port
+				// unreachable messages from legitimate players. Still, this code
+				// will drop them unceremoniously, so there's an option in the .INI
+				// file for servers with such flakey connections to let these
+				// players slide...which means if the client's game crashes, they
+				// might get flooded to some degree with packets until they timeout.
+				// Either way, this should close up the usual DoS attacks.
+				if ((Connection->State != USOCK_Open) || (!AllowPlayerPortUnreach))
 				{
-					// We received an ICMP port unreachable from the client, meaning the client is no longer running the game
-					// (or someone is trying to perform a DoS attack on the client)
-
-					// rcg08182002 Some buggy firewalls get occasional ICMP port
-					// unreachable messages from legitimate players. Still, this code
-					// will drop them unceremoniously, so there's an option in the .INI
-					// file for servers with such flakey connections to let these
-					// players slide...which means if the client's game crashes, they
-					// might get flooded to some degree with packets until they timeout.
-					// Either way, this should close up the usual DoS attacks.
-					if ((Connection->State != USOCK_Open) || (!AllowPlayerPortUnreach))
+					if (LogPortUnreach)
 					{
-						if (LogPortUnreach)
-						{
-							UE_LOG(LogNet, Log, TEXT("Received ICMP port unreachable from client %s.  Disconnecting."),
-								*FromAddr->ToString(true));
-						}
-						Connection->CleanUp();
+						UE_LOG(LogNet, Log, TEXT("Received ICMP port unreachable from client %s.  Disconnecting."),
+							*FromAddr.ToString(true));
 					}
+					Connection->CleanUp();
 				}
 			}
-			else
+		}
+		else
+		{
+			if (LogPortUnreach)
 			{
-				if (LogPortUnreach)
-				{
-					UE_LOG(LogNet, Log, TEXT("Received ICMP port unreachable from %s.  No matching connection found."),
-						*FromAddr->ToString(true));
-				}
+				UE_LOG(LogNet, Log, TEXT("Received ICMP port unreachable from %s.  No matching connection found."),
+					*FromAddr.ToString(true));
 			}
 		}
+	}
+
+	// Pick up whatever the packet handler thread already finished with, the rest is processed next tick
+	ReceivedThreadedPackets();
+
+	const double EndReceiveTime = FPlatformTime::Seconds();
+	const float DeltaReceiveTime = EndReceiveTime - StartReceiveTime;
+
+	if (DeltaReceiveTime > GIpNetDriverLongFramePrintoutThresholdSecs)
+	{
+		UE_LOG( LogNet, Warning, TEXT( "UIpNetDriver::TickDispatch: Took too long to receive packets. Time: %2.2f %s" ), DeltaReceiveTime, *GetName() );
+	}
+}
+
+UIpConnection* UIpNetDriver::FindConnection(const FInternetAddr& FromAddr)
+{
+	UIpConnection* Connection = nullptr;
+	UIpConnection* MyServerConnection = GetServerConnection();
+	if (MyServerConnection)
+	{
+		if ((*MyServerConnection->RemoteAddr == FromAddr))
+		{
+			Connection = MyServerConnection;
+		}
 		else
 		{
-			bool bIgnorePacket = false;
+			UE_LOG(LogNet, Warning, TEXT("Incoming ip address doesn't match expected server address: Actual: %s Expected: %s"),
+				*FromAddr.ToString(true),
+				MyServerConnection->RemoteAddr.IsValid() ? *MyServerConnection->RemoteAddr->ToString(true) : TEXT("Invalid"));
+		}
+	}
+	for( int32 i=0; i<ClientConnections.Num() && !Connection; i++ )
+	{
+		UIpConnection* TestConnection = (UIpConnection*)ClientConnections[i]; 
+		check(TestConnection);
+		if(*TestConnection->RemoteAddr == FromAddr)
+		{
+			Connection = TestConnection;
+		}
+	}
+	return Connection;
+}
 
-			// If we didn't find a client connection, maybe create a new one.
-			if( !Connection )
-			{
-				// Determine if allowing for client/server connections
-				const bool bAcceptingConnection = Notify != nullptr && Notify->NotifyAcceptingConnection() == EAcceptConnection::Accept;
+void UIpNetDriver::ProcessReceivedPacket(uint8* Data, int32 BytesRead, const FInternetAddr& FromAddr)
+{
+	uint8* DataRef = Data;
 
-				if (bAcceptingConnection)
-				{
-					UE_LOG( LogNet, Log, TEXT( "NotifyAcceptingConnection accepted from: %s" ), *FromAddr->ToString( true ) );
+	// Figure out which socket the received data came from.
+	UIpConnection* Connection = FindConnection(FromAddr);
 
-					bool bPassedChallenge = false;
+	bool bIgnorePacket = false;
 
-					bIgnorePacket = true;
+	// If we didn't find a client connection, maybe create a new one.
+	if( !Connection )
+	{
+		// Determine if allowing for client/server connections
+		const bool bAcceptingConnection = Notify != nullptr && Notify->NotifyAcceptingConnection() == EAcceptConnection::Accept;
 
-					if (ConnectionlessHandler.IsValid() && StatelessConnectComponent.IsValid())
-					{
-						TSharedPtr<StatelessConnectHandlerComponent> StatelessConnect = StatelessConnectComponent.Pin();
-						FString IncomingAddress = FromAddr->ToString(true);
+		if (bAcceptingConnection)
+		{
+			UE_LOG( LogNet, Log, TEXT( "NotifyAcceptingConnection accepted from: %s" ), *FromAddr.ToString( true ) );
 
-						const ProcessedPacket UnProcessedPacket =
-												ConnectionlessHandler->IncomingConnectionless(IncomingAddress, DataRef, BytesRead);
+			bool bPassedChallenge = false;
 
-						bPassedChallenge = !UnProcessedPacket.bError && StatelessConnect->HasPassedChallenge(IncomingAddress);
+			bIgnorePacket = true;
 
-						if (bPassedChallenge)
-						{
-							BytesRead = FMath::DivideAndRoundUp(UnProcessedPacket.CountBits, 8);
+			if (ConnectionlessHandler.IsValid() && StatelessConnectComponent.IsValid())
+			{
+				TSharedPtr<StatelessConnectHandlerComponent> StatelessConnect = StatelessConnectComponent.Pin();
+				FString IncomingAddress = FromAddr.ToString(true);
 
-							if (BytesRead > 0)
-							{
-								DataRef = UnProcessedPacket.Data;
-								bIgnorePacket = false;
-							}
-						}
-					}
-#if !UE_BUILD_SHIPPING
-					else if (FParse::Param(FCommandLine::Get(), TEXT("NoPacketHandler")))
-					{
-						UE_LOG(LogNet, Log, TEXT("Accepting connection without handshake, due to '-NoPacketHandler'."))
+				const ProcessedPacket UnProcessedPacket =
+										ConnectionlessHandler->IncomingConnectionless(IncomingAddress, DataRef, BytesRead);
 
-						bIgnorePacket = false;
-						bPassedChallenge = true;
-					}
-#endif
-					else
-					{
-						UE_LOG(LogNet, Log,
-								TEXT("Invalid ConnectionlessHandler (%i) or StatelessConnectComponent (%i); can't accept connections."),
-								(int32)(ConnectionlessHandler.IsValid()), (int32)(StatelessConnectComponent.IsValid()));
-					}
+				bPassedChallenge = !UnProcessedPacket.bError && StatelessConnect->HasPassedChallenge(IncomingAddress);
 
-					if (bPassedChallenge)
-					{
-						UE_LOG(LogNet, Log, TEXT("Server accepting post-challenge connection from: %s"), *FromAddr->ToString(true));
+				if (bPassedChallenge)
+				{
+					BytesRead = FMath::DivideAndRoundUp(UnProcessedPacket.CountBits, 8);
 
-						Connection = NewObject<UIpConnection>(GetTransientPackage(), NetConnectionClass);
-						check(Connection);
-						Connection->InitRemoteConnection( this, Socket,  FURL(), *FromAddr, USOCK_Open);
-						Notify->NotifyAcceptedConnection( Connection );
-						AddClientConnection(Connection);
-					}
-					else
+					if (BytesRead > 0)
 					{
-						UE_LOG( LogNet, VeryVerbose, TEXT( "Server failed post-challenge connection from: %s" ), *FromAddr->ToString( true ) );
+						DataRef = UnProcessedPacket.Data;
+						bIgnorePacket = false;
 					}
 				}
-				else
-				{
-					UE_LOG( LogNet, VeryVerbose, TEXT( "NotifyAcceptingConnection denied from: %s" ), *FromAddr->ToString( true ) );
-				}
 			}
+#if !UE_BUILD_SHIPPING
+			else if (FParse::Param(FCommandLine::Get(), TEXT("NoPacketHandler")))
+			{
+				UE_LOG(LogNet, Log, TEXT("Accepting connection without handshake, due to '-NoPacketHandler'."))
+
+				bIgnorePacket = false;
+				bPassedChallenge = true;
+			}
+#endif
+			else
+			{
+				UE_LOG(LogNet, Log,
+						TEXT("Invalid ConnectionlessHandler (%i) or StatelessConnectComponent (%i); can't accept connections."),
+						(int32)(ConnectionlessHandler.IsValid()), (int32)(StatelessConnectComponent.IsValid()));
+			}
+
+			if (bPassedChallenge)
+			{
+				UE_LOG(LogNet, Log, TEXT("Server accepting post-challenge connection from: %s"), *FromAddr.ToString(true));
 
-			// Send the packet to the connection for processing.
-			if (Connection && !bIgnorePacket)
+				Connection = NewObject<UIpConnection>(GetTransientPackage(), NetConnectionClass);
+				check(Connection);
+				Connection->InitRemoteConnection( this, Socket,  FURL(), FromAddr, USOCK_Open);
+				Notify->NotifyAcceptedConnection( Connection );
+				AddClientConnection(Connection);
+			}
+			else
 			{
-				Connection->ReceivedRawPacket( DataRef, BytesRead );
+				UE_LOG( LogNet, VeryVerbose, TEXT( "Server failed post-challenge connection from: %s" ), *FromAddr.ToString( true ) );
 			}
 		}
+		else
+		{
+			UE_LOG( LogNet, VeryVerbose, TEXT( "NotifyAcceptingConnection denied from: %s" ), *FromAddr.ToString( true ) );
+		}
 	}
 
-	const double EndReceiveTime = FPlatformTime::Seconds();
-	const float DeltaReceiveTime = EndReceiveTime - StartReceiveTime;
+	// Send the packet to the connection for processing.
+	if (Connection && !bIgnorePacket)
+	{
+		Connection->ReceivedRawPacket( DataRef, BytesRead );
+	}
+}
 
-	if (DeltaReceiveTime > GIpNetDriverLongFramePrintoutThresholdSecs)
+void UIpNetDriver::TickFlush(float DeltaSeconds)
+{
+	// Connections queue their packets while they flush, so they can all be sent to the socket at once
+	if (GIpNetDriverSendBatchSize > 0 && Socket != NULL)
 	{
-		UE_LOG( LogNet, Warning, TEXT( "UIpNetDriver::TickDispatch: Took too long to receive packets. Time: %2.2f %s" ), DeltaReceiveTime, *GetName() );
+		if (!SendBatch.IsValid() || SendBatch->Max() != GIpNetDriverSendBatchSize)
+		{
+			FlushBatchedSends();
+			SendBatch = MakeShareable(new FSocketSendBatch(GIpNetDriverSendBatchSize, MAX_PACKET_SIZE));
+		}
+		bIsBatchingSends = true;
+	}
+
+	Super::TickFlush(DeltaSeconds);
+
+	bIsBatchingSends = false;
+	FlushBatchedSends();
+}
+
+bool UIpNetDriver::QueueBatchedSend(const uint8* Data, int32 Count, const TSharedRef<FInternetAddr>& Destination)
+{
+	if (!bIsBatchingSends)
+	{
+		return false;
+	}
+
+	if (SendBatch->IsFull())
+	{
+		FlushBatchedSends();
+	}
+
+	return SendBatch->Add(Data, Count, Destination);
+}
+
+void UIpNetDriver::FlushBatchedSends()
+{
+	if (SendBatch.IsValid() && SendBatch->Num() > 0)
+	{
+		if (Socket != NULL)
+		{
+			int32 NumSent = 0;
+			CLOCK_CYCLES(SendCycles);
+			Socket->SendToMulti(*SendBatch, NumSent);
+			UNCLOCK_CYCLES(SendCycles);
+		}
+
+		SendBatch->Reset();
 	}
 }
 
@@ -569,6 +660,23 @@ void UIpNetDriver::LowLevelDestroy()
 {
 	Super::LowLevelDestroy();
 
+	bIsBatchingSends = false;
+	FlushBatchedSends();
+
+	// Threaded PacketHandler's send straight to the socket, so their queued work has to finish before it's destroyed
+	if (ServerConnection != nullptr && ServerConnection->Handler.IsValid())
+	{
+		ServerConnection->Handler->FlushThreaded();
+	}
+
+	for (UNetConnection* Connection : ClientConnections)
+	{
+		if (Connection != nullptr && Connection->Handler.IsValid())
+		{
+			Connection->Handler->FlushThreaded();
+		}
+	}
+
 	// Close the socket.
 	if( Socket && !HasAnyFlags(RF_ClassDefaultObject) )
 	{
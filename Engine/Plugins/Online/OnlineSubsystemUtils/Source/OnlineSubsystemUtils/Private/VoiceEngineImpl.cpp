@@ -7,6 +7,8 @@
 
 #include "Sound/SoundWaveProcedural.h"
 #include "OnlineSubsystemUtils.h"
+#include "HAL/IConsoleManager.h"
+#include "Async/ParallelFor.h"
 
 /** Largest size preallocated for compressed data */
 #define MAX_COMPRESSED_VOICE_BUFFER_SIZE 8 * 1024
@@ -14,19 +16,56 @@
 #define MAX_UNCOMPRESSED_VOICE_BUFFER_SIZE 22 * 1024
 /** Largest size allowed to carry over into next buffer */
 #define MAX_VOICE_REMAINDER_SIZE 1 * 1024
+/** Bytes of decoded voice per second of playback */
+#define VOICE_BYTES_PER_SECOND (VOICE_SAMPLE_RATE * NUM_VOICE_CHANNELS * sizeof(int16))
+
+static TAutoConsoleVariable<float> CVarVoiceJitterBufferMinDelay(
+	TEXT("voice.JitterBufferMinDelay"),
+	0.04f,
+	TEXT("Seconds of remote voice buffered before playback starts when packets arrive evenly."));
+
+static TAutoConsoleVariable<float> CVarVoiceJitterBufferMaxDelay(
+	TEXT("voice.JitterBufferMaxDelay"),
+	0.3f,
+	TEXT("Upper bound in seconds of remote voice buffered before playback starts, however uneven packets arrive."));
+
+DECLARE_CYCLE_STAT(TEXT("VoiceDecodeTask"), STAT_Voice_DecodeTask, STATGROUP_Net);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Voice Playback Latency (ms)"), STAT_Voice_PlaybackLatency, STATGROUP_Net);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Voice Jitter (ms)"), STAT_Voice_Jitter, STATGROUP_Net);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Voice Packets Lost"), STAT_Voice_PacketsLost, STATGROUP_Net);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Voice Underruns"), STAT_Voice_Underruns, STATGROUP_Net);
+
+FRemoteTalkerDecodeState::FRemoteTalkerDecodeState() :
+	VoiceDecoder(nullptr)
+{
+	VoiceDecoder = FVoiceModule::Get().CreateVoiceDecoder();
+	check(VoiceDecoder.IsValid());
+}
 
 FRemoteTalkerDataImpl::FRemoteTalkerDataImpl() :
 	LastSeen(0.0),
 	AudioComponent(nullptr),
-	VoiceDecoder(nullptr)
+	DecodeState(MakeShareable(new FRemoteTalkerDecodeState())),
+	bHasCompressedPackets(false),
+	JitterBufferArrivalTime(0.0),
+	bIsPlaying(false),
+	AverageArrivalInterval(0.0),
+	ArrivalJitter(0.0),
+	PlaybackLatency(0.0),
+	NumUnderruns(0)
 {
-	VoiceDecoder = FVoiceModule::Get().CreateVoiceDecoder();
-	check(VoiceDecoder.IsValid());
 }
 
 FRemoteTalkerDataImpl::~FRemoteTalkerDataImpl()
 {
-	VoiceDecoder = nullptr;
+}
+
+double FRemoteTalkerDataImpl::GetJitterBufferDelay() const
+{
+	// Enough to ride out twice the typical deviation in packet arrival
+	const double MinDelay = CVarVoiceJitterBufferMinDelay.GetValueOnGameThread();
+	const double MaxDelay = FMath::Max<double>(MinDelay, CVarVoiceJitterBufferMaxDelay.GetValueOnGameThread());
+	return FMath::Clamp(MinDelay + 2.0 * ArrivalJitter, MinDelay, MaxDelay);
 }
 
 FVoiceEngineImpl::FVoiceEngineImpl(IOnlineSubsystem* InSubsystem) :
@@ -45,6 +84,12 @@ FVoiceEngineImpl::FVoiceEngineImpl(IOnlineSubsystem* InSubsystem) :
 
 FVoiceEngineImpl::~FVoiceEngineImpl()
 {
+	if (DecodeTask.IsValid())
+	{
+		FTaskGraphInterface::Get().WaitUntilTaskCompletes(DecodeTask);
+		DecodeTask = nullptr;
+	}
+
 	if (bIsCapturing)
 	{
 		VoiceCapture->Stop();
@@ -344,67 +389,183 @@ uint32 FVoiceEngineImpl::SubmitRemoteVoiceData(const FUniqueNetId& RemoteTalkerI
 	FRemoteTalkerDataImpl& QueuedData = RemoteTalkerBuffers.FindOrAdd(TalkerId);
 
 	// new voice packet.
-	QueuedData.LastSeen = FPlatformTime::Seconds();
-
-	uint32 BytesWritten = MAX_UNCOMPRESSED_VOICE_BUFFER_SIZE;
+	const double CurTime = FPlatformTime::Seconds();
+	const double ArrivalInterval = CurTime - QueuedData.LastSeen;
+	QueuedData.LastSeen = CurTime;
 
-	DecompressedVoiceBuffer.Empty(MAX_UNCOMPRESSED_VOICE_BUFFER_SIZE);
-	DecompressedVoiceBuffer.AddUninitialized(MAX_UNCOMPRESSED_VOICE_BUFFER_SIZE);
-	QueuedData.VoiceDecoder->Decode(Data, *Size, DecompressedVoiceBuffer.GetData(), BytesWritten);
+	// Track how unevenly packets arrive within a stretch of talking, smoothed like RTP interarrival jitter
+	if (ArrivalInterval < 1.0)
+	{
+		QueuedData.ArrivalJitter += (FMath::Abs(ArrivalInterval - QueuedData.AverageArrivalInterval) - QueuedData.ArrivalJitter) / 16.0;
+		QueuedData.AverageArrivalInterval += (ArrivalInterval - QueuedData.AverageArrivalInterval) / 16.0;
+	}
 
-	// If there is no data, return
-	if (BytesWritten <= 0)
+	if (*Size > 0)
 	{
-		*Size = 0;
-		return S_OK;
+		// Decoding happens on the decode task, playback in Tick once enough is buffered
+		FRemoteVoicePacket Packet;
+		Packet.Data.Append(Data, *Size);
+		Packet.ArrivalTime = CurTime;
+		QueuedData.DecodeState->CompressedPackets.Enqueue(MoveTemp(Packet));
+		QueuedData.bHasCompressedPackets = true;
+
+		StartDecodeTask();
 	}
 
-	bool bAudioComponentCreated = false;
-	// Generate a streaming wave audio component for voice playback
-	if (QueuedData.AudioComponent == nullptr || QueuedData.AudioComponent->IsPendingKill())
+	return S_OK;
+}
+
+void FVoiceEngineImpl::StartDecodeTask()
+{
+	if (DecodeTask.IsValid())
 	{
-		if (SerializeHelper == nullptr)
+		if (!DecodeTask->IsComplete())
 		{
-			SerializeHelper = new FVoiceSerializeHelper(this);
+			// The talkers' decoders may only be used by one task at a time, Tick picks up the packets once it finished
+			return;
 		}
 
-		QueuedData.AudioComponent = CreateVoiceAudioComponent(VOICE_SAMPLE_RATE);
-		if (QueuedData.AudioComponent)
+		DecodeTask = nullptr;
+	}
+
+	TArray<FRemoteTalkerDecodeStateRef> TalkersToDecode;
+	for (FRemoteTalkerData::TIterator It(RemoteTalkerBuffers); It; ++It)
+	{
+		FRemoteTalkerDataImpl& RemoteData = It.Value();
+		if (RemoteData.bHasCompressedPackets)
 		{
-			QueuedData.AudioComponent->OnAudioFinishedNative.AddRaw(this, &FVoiceEngineImpl::OnAudioFinished);
+			TalkersToDecode.Add(RemoteData.DecodeState);
+			RemoteData.bHasCompressedPackets = false;
 		}
 	}
-	
-	if (QueuedData.AudioComponent != nullptr)
+
+	if (TalkersToDecode.Num() > 0)
 	{
-		if (!QueuedData.AudioComponent->IsActive())
+		DecodeTask = FFunctionGraphTask::CreateAndDispatchWhenReady([TalkersToDecode]()
 		{
-			QueuedData.AudioComponent->Play();
+			DecodeRemoteVoicePackets(TalkersToDecode);
+		}, TStatId(), nullptr, ENamedThreads::AnyThread);
+	}
+}
+
+void FVoiceEngineImpl::DecodeRemoteVoicePackets(const TArray<FRemoteTalkerDecodeStateRef>& Talkers)
+{
+	SCOPE_CYCLE_COUNTER(STAT_Voice_DecodeTask);
+
+	// Talkers are independent of each other, only the packets of one talker have to be decoded in order
+	ParallelFor(Talkers.Num(), [&Talkers](int32 TalkerIndex)
+	{
+		FRemoteTalkerDecodeState& DecodeState = *Talkers[TalkerIndex];
+
+		FRemoteVoicePacket Packet;
+		while (DecodeState.CompressedPackets.Dequeue(Packet))
+		{
+			FRemoteVoicePacket DecodedPacket;
+			DecodedPacket.ArrivalTime = Packet.ArrivalTime;
+			DecodedPacket.Data.AddUninitialized(MAX_UNCOMPRESSED_VOICE_BUFFER_SIZE);
+
+			uint32 BytesWritten = MAX_UNCOMPRESSED_VOICE_BUFFER_SIZE;
+			DecodeState.VoiceDecoder->Decode(Packet.Data.GetData(), Packet.Data.Num(), DecodedPacket.Data.GetData(), BytesWritten);
+
+			// If there is no data, skip it
+			if (BytesWritten > 0)
+			{
+				DecodedPacket.Data.SetNum(BytesWritten, false);
+				DecodeState.DecodedPackets.Enqueue(MoveTemp(DecodedPacket));
+			}
 		}
 
-		USoundWaveProcedural* SoundStreaming = CastChecked<USoundWaveProcedural>(QueuedData.AudioComponent->Sound);
+		DecodeState.NumLostPackets.Set(DecodeState.VoiceDecoder->GetNumLostPackets());
+	}, Talkers.Num() < 2);
+}
 
-		if (0)
+void FVoiceEngineImpl::UpdateTalkerPlayback(FRemoteTalkerDataImpl& RemoteData, double CurTime)
+{
+	FRemoteVoicePacket DecodedPacket;
+	while (RemoteData.DecodeState->DecodedPackets.Dequeue(DecodedPacket))
+	{
+		if (RemoteData.JitterBuffer.Num() == 0)
 		{
-			if (!bAudioComponentCreated && SoundStreaming->GetAvailableAudioByteCount() == 0)
+			RemoteData.JitterBufferArrivalTime = DecodedPacket.ArrivalTime;
+		}
+		RemoteData.JitterBuffer.Append(DecodedPacket.Data);
+	}
+
+	USoundWaveProcedural* SoundStreaming = RemoteData.AudioComponent ? CastChecked<USoundWaveProcedural>(RemoteData.AudioComponent->Sound) : nullptr;
+	const double JitterBufferDelay = RemoteData.GetJitterBufferDelay();
+
+	if (RemoteData.JitterBuffer.Num() == 0)
+	{
+		// Buffer again before resuming if playback ran dry
+		if (RemoteData.bIsPlaying && (SoundStreaming == nullptr || SoundStreaming->GetAvailableAudioByteCount() == 0))
+		{
+			RemoteData.bIsPlaying = false;
+			if (CurTime - RemoteData.LastSeen < JitterBufferDelay)
 			{
-				UE_LOG(LogVoiceDecode, Log, TEXT("VOIP audio component was starved!"));
+				// Still talking, so the packets were late
+				RemoteData.NumUnderruns++;
+				UE_LOG(LogVoiceDecode, Verbose, TEXT("VOIP audio component was starved!"));
 			}
 		}
+		return;
+	}
 
-		SoundStreaming->QueueAudio(DecompressedVoiceBuffer.GetData(), BytesWritten);
+	// Start playback once enough is buffered, or when nothing more is coming
+	const double BufferedSeconds = (double)RemoteData.JitterBuffer.Num() / VOICE_BYTES_PER_SECOND;
+	if (!RemoteData.bIsPlaying && BufferedSeconds < JitterBufferDelay && CurTime - RemoteData.LastSeen < JitterBufferDelay)
+	{
+		return;
 	}
 
-	return S_OK;
+	// Generate a streaming wave audio component for voice playback
+	if (RemoteData.AudioComponent == nullptr || RemoteData.AudioComponent->IsPendingKill())
+	{
+		if (SerializeHelper == nullptr)
+		{
+			SerializeHelper = new FVoiceSerializeHelper(this);
+		}
+
+		RemoteData.AudioComponent = CreateVoiceAudioComponent(VOICE_SAMPLE_RATE);
+		if (RemoteData.AudioComponent)
+		{
+			RemoteData.AudioComponent->OnAudioFinishedNative.AddRaw(this, &FVoiceEngineImpl::OnAudioFinished);
+		}
+	}
+
+	if (RemoteData.AudioComponent != nullptr)
+	{
+		if (!RemoteData.AudioComponent->IsActive())
+		{
+			RemoteData.AudioComponent->Play();
+		}
+
+		SoundStreaming = CastChecked<USoundWaveProcedural>(RemoteData.AudioComponent->Sound);
+		SoundStreaming->QueueAudio(RemoteData.JitterBuffer.GetData(), RemoteData.JitterBuffer.Num());
+
+		// The newly queued audio is heard after everything queued before it
+		const double QueuedSeconds = (double)SoundStreaming->GetAvailableAudioByteCount() / VOICE_BYTES_PER_SECOND;
+		RemoteData.PlaybackLatency = (CurTime - RemoteData.JitterBufferArrivalTime) + QueuedSeconds - BufferedSeconds;
+		RemoteData.bIsPlaying = true;
+	}
+
+	RemoteData.JitterBuffer.Reset();
 }
 
 void FVoiceEngineImpl::TickTalkers(float DeltaTime)
 {
-	// Remove users that are done talking.
 	const double CurTime = FPlatformTime::Seconds();
+
+	double MaxPlaybackLatency = 0.0;
+	double MaxJitter = 0.0;
+	int32 NumPacketsLost = 0;
+	int32 NumUnderruns = 0;
+
 	for (FRemoteTalkerData::TIterator It(RemoteTalkerBuffers); It; ++It)
 	{
 		FRemoteTalkerDataImpl& RemoteData = It.Value();
+		UpdateTalkerPlayback(RemoteData, CurTime);
+
+		// Remove users that are done talking.
 		double TimeSince = CurTime - RemoteData.LastSeen;
 		if (TimeSince >= 1.0)
 		{
@@ -414,7 +575,20 @@ void FVoiceEngineImpl::TickTalkers(float DeltaTime)
 				RemoteData.AudioComponent->Stop();
 			}
 		}
+		else
+		{
+			MaxPlaybackLatency = FMath::Max(MaxPlaybackLatency, RemoteData.PlaybackLatency);
+			MaxJitter = FMath::Max(MaxJitter, RemoteData.ArrivalJitter);
+		}
+
+		NumPacketsLost += RemoteData.DecodeState->NumLostPackets.GetValue();
+		NumUnderruns += RemoteData.NumUnderruns;
 	}
+
+	SET_FLOAT_STAT(STAT_Voice_PlaybackLatency, MaxPlaybackLatency * 1000.0);
+	SET_FLOAT_STAT(STAT_Voice_Jitter, MaxJitter * 1000.0);
+	SET_DWORD_STAT(STAT_Voice_PacketsLost, NumPacketsLost);
+	SET_DWORD_STAT(STAT_Voice_Underruns, NumUnderruns);
 }
 
 void FVoiceEngineImpl::Tick(float DeltaTime)
@@ -422,6 +596,9 @@ void FVoiceEngineImpl::Tick(float DeltaTime)
 	// Check available voice once a frame, this value changes after calling GetVoiceData()
 	AvailableVoiceResult = VoiceCapture->GetCaptureState(UncompressedBytesAvailable);
 
+	// Pick up packets that arrived while the last decode task was running
+	StartDecodeTask();
+
 	TickTalkers(DeltaTime);
 }
 
@@ -430,10 +607,12 @@ void FVoiceEngineImpl::OnAudioFinished(UAudioComponent* AC)
 	for (FRemoteTalkerData::TIterator It(RemoteTalkerBuffers); It; ++It)
 	{
 		FRemoteTalkerDataImpl& RemoteData = It.Value();
-		if (RemoteData.AudioComponent->IsPendingKill() || AC == RemoteData.AudioComponent)
+		// Talkers still filling their jitter buffer don't have an audio component yet
+		if (AC == RemoteData.AudioComponent || (RemoteData.AudioComponent && RemoteData.AudioComponent->IsPendingKill()))
 		{
 			UE_LOG(LogVoiceDecode, Log, TEXT("Removing VOIP AudioComponent for Id: %s"), *It.Key().ToDebugString());
 			RemoteData.AudioComponent = nullptr;
+			RemoteData.bIsPlaying = false;
 			break;
 		}
 	}
@@ -457,6 +636,21 @@ FString FVoiceEngineImpl::GetVoiceDebugState() const
 		Output += FString::Printf(TEXT("Remainder[%d] %d\n"), Idx, PlayerVoiceData[Idx].VoiceRemainderSize);
 	}
 
+	// Add jitter buffer state of remote talkers
+	for (FRemoteTalkerData::TConstIterator It(RemoteTalkerBuffers); It; ++It)
+	{
+		const FRemoteTalkerDataImpl& RemoteData = It.Value();
+		Output += FString::Printf(TEXT("Talker %s: Playing: %d Buffered: %d Delay: %0.1fms Jitter: %0.1fms Latency: %0.1fms Lost: %d Underruns: %d\n"),
+			*It.Key().ToDebugString(),
+			RemoteData.bIsPlaying,
+			RemoteData.JitterBuffer.Num(),
+			RemoteData.GetJitterBufferDelay() * 1000.0,
+			RemoteData.ArrivalJitter * 1000.0,
+			RemoteData.PlaybackLatency * 1000.0,
+			RemoteData.DecodeState->NumLostPackets.GetValue(),
+			RemoteData.NumUnderruns);
+	}
+
 	return Output;
 }
 
@@ -4,6 +4,9 @@
 
 #include "CoreMinimal.h"
 #include "UObject/GCObject.h"
+#include "Containers/Queue.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Async/TaskGraphInterfaces.h"
 #include "OnlineSubsystemTypes.h"
 #include "Interfaces/VoiceInterface.h"
 #include "Net/VoiceDataCommon.h"
@@ -31,6 +34,41 @@ struct FLocalVoiceData
 	TArray<uint8> VoiceRemainder;
 };
 
+/**
+ * Voice packet of a remote talker, compressed when queued for decoding and raw PCM once decoded
+ */
+struct FRemoteVoicePacket
+{
+	FRemoteVoicePacket() :
+		ArrivalTime(0.0)
+	{
+	}
+
+	/** Voice data of the packet */
+	TArray<uint8> Data;
+	/** Receive side timestamp of the packet */
+	double ArrivalTime;
+};
+
+/**
+ * Decoding state of a remote talker, shared between the game thread and the voice decode task
+ */
+struct FRemoteTalkerDecodeState
+{
+	FRemoteTalkerDecodeState();
+
+	/** Per remote talker voice decoding state, only used by the decode task */
+	TSharedPtr<class IVoiceDecoder> VoiceDecoder;
+	/** Compressed packets queued by the game thread for the decode task */
+	TQueue<FRemoteVoicePacket, EQueueMode::Spsc> CompressedPackets;
+	/** Raw PCM decoded by the decode task for the game thread to play */
+	TQueue<FRemoteVoicePacket, EQueueMode::Spsc> DecodedPackets;
+	/** Packets the decoder found missing, updated by the decode task */
+	FThreadSafeCounter NumLostPackets;
+};
+
+typedef TSharedRef<FRemoteTalkerDecodeState, ESPMode::ThreadSafe> FRemoteTalkerDecodeStateRef;
+
 /** 
  * Remote voice data playing on a single client
  */
@@ -45,8 +83,30 @@ public:
 	double LastSeen;
 	/** Audio component playing this buffer (only valid on remote instances) */
 	class UAudioComponent* AudioComponent;
-	/** Per remote talker voice decoding state */
-	TSharedPtr<class IVoiceDecoder> VoiceDecoder;
+	/** Voice decoding state, kept alive by the decode task while it runs */
+	FRemoteTalkerDecodeStateRef DecodeState;
+	/** Whether packets were queued since the last decode task was started */
+	bool bHasCompressedPackets;
+
+	/** Decoded PCM held back until enough is buffered to start playback */
+	TArray<uint8> JitterBuffer;
+	/** Receive side timestamp of the oldest packet in JitterBuffer */
+	double JitterBufferArrivalTime;
+	/** Whether audio is being handed to the audio component as soon as it is decoded */
+	bool bIsPlaying;
+
+	/** Smoothed time between packets */
+	double AverageArrivalInterval;
+	/** Smoothed deviation of the time between packets from the average */
+	double ArrivalJitter;
+
+	/** Time from a packet being received to it being heard, as of the last audio queued for playback */
+	double PlaybackLatency;
+	/** Number of times playback ran dry while packets were still coming in */
+	int32 NumUnderruns;
+
+	/** @return how much audio to buffer before starting playback, in seconds */
+	double GetJitterBufferDelay() const;
 };
 
 /**
@@ -119,6 +179,8 @@ class FVoiceEngineImpl : public IVoiceEngine
 	TArray<uint8> DecompressedVoiceBuffer;
 	/** Serialization helper */
 	class FVoiceSerializeHelper* SerializeHelper;
+	/** Task decoding the packets of all remote talkers, see DecodeRemoteVoicePackets */
+	FGraphEventRef DecodeTask;
 
 	/**
 	 * Determines if the specified index is the owner or not
@@ -150,6 +212,15 @@ class FVoiceEngineImpl : public IVoiceEngine
 	/** @return is active recording occurring at the moment */
 	bool IsRecording() const { return bIsCapturing || bPendingFinalCapture; }
 
+	/** Starts a task decoding the packets queued for all remote talkers, unless the previous one is still running */
+	void StartDecodeTask();
+
+	/** Decodes the queued packets of the given talkers, runs on a task graph worker thread */
+	static void DecodeRemoteVoicePackets(const TArray<FRemoteTalkerDecodeStateRef>& Talkers);
+
+	/** Moves decoded audio of a remote talker through its jitter buffer to its audio component */
+	void UpdateTalkerPlayback(FRemoteTalkerDataImpl& RemoteData, double CurTime);
+
 PACKAGE_SCOPE:
 
 	/** Constructor */
@@ -8,17 +8,27 @@
 #include "Async/ParallelFor.h"
 #include "Engine/Console.h"
 #include "ConsoleSettings.h"
+#include "GameFramework/Actor.h"
+#include "Components/SkinnedMeshComponent.h"
+#include "Components/AudioComponent.h"
+#include "Particles/ParticleSystemComponent.h"
+#include "Sound/SoundBase.h"
 
 IMPLEMENT_MODULE( FSignificanceManagerModule, SignificanceManager );
 
 DECLARE_CYCLE_STAT(TEXT("Update Total"), STAT_SignificanceManager_Update, STATGROUP_SignificanceManager);
 DECLARE_CYCLE_STAT(TEXT("Significance Update"), STAT_SignificanceManager_SignificanceUpdate, STATGROUP_SignificanceManager);
 DECLARE_CYCLE_STAT(TEXT("Significance Sort"), STAT_SignificanceManager_SignificanceSort, STATGROUP_SignificanceManager);
+DECLARE_CYCLE_STAT(TEXT("Detail Level Update"), STAT_SignificanceManager_DetailLevelUpdate, STATGROUP_SignificanceManager);
 DECLARE_CYCLE_STAT(TEXT("Unregister Object"), STAT_SignificanceManager_UnregisterObject, STATGROUP_SignificanceManager);
 DECLARE_CYCLE_STAT(TEXT("Significance Check"), STAT_SignificanceManager_SignificanceCheck, STATGROUP_SignificanceManager);
 DECLARE_CYCLE_STAT(TEXT("Register Object"), STAT_SignificanceManager_RegisterObject, STATGROUP_SignificanceManager);
 DECLARE_CYCLE_STAT(TEXT("Initial Significance Update"), STAT_SignificanceManager_InitialSignificanceUpdate, STATGROUP_SignificanceManager);
+DECLARE_CYCLE_STAT(TEXT("Particle Budget Update"), STAT_SignificanceManager_ParticleBudgetUpdate, STATGROUP_SignificanceManager);
 DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Num Managed Objects"), STAT_SignificanceManager_NumObjects, STATGROUP_SignificanceManager);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Budgeted Particles"), STAT_SignificanceManager_BudgetedParticles, STATGROUP_SignificanceManager);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Reduced Particle Systems"), STAT_SignificanceManager_ReducedParticleSystems, STATGROUP_SignificanceManager);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Paused Particle Systems"), STAT_SignificanceManager_PausedParticleSystems, STATGROUP_SignificanceManager);
 
 bool CompareBySignificanceAscending(const USignificanceManager::FManagedObjectInfo& A, const USignificanceManager::FManagedObjectInfo& B) 
 { 
@@ -132,6 +142,7 @@ void USignificanceManager::BeginDestroy()
 	}
 	ManagedObjects.Reset();
 	ManagedObjectsByTag.Reset();
+	ParticleBudgetStates.Reset();
 }
 
 UWorld* USignificanceManager::GetWorld()const
@@ -219,6 +230,17 @@ void USignificanceManager::UnregisterObject(UObject* Object)
 		{
 			ObjectsWithTag.RemoveSingle(ObjectInfo);
 		}
+
+		// Don't leave the object throttled once it's not managed anymore
+		ObjectInfo->SetDetailLevel(0);
+		if (UParticleSystemComponent* ParticleSystemComponent = Cast<UParticleSystemComponent>(Object))
+		{
+			FParticleBudgetState State;
+			if (ParticleBudgetStates.RemoveAndCopyValue(ParticleSystemComponent, State))
+			{
+				SetParticleThrottle(ParticleSystemComponent, State, EParticleThrottle::None);
+			}
+		}
 		delete ObjectInfo;
 	}
 }
@@ -234,11 +256,146 @@ void USignificanceManager::UnregisterAll(FName Tag)
 			{
 				ManagedObj->PostSignificanceFunction(ManagedObj->GetObject(), ManagedObj->Significance, 1.0f, true);
 			}
+			const_cast<FManagedObjectInfo*>(ManagedObj)->SetDetailLevel(0);
+			if (UParticleSystemComponent* ParticleSystemComponent = Cast<UParticleSystemComponent>(ManagedObj->GetObject()))
+			{
+				FParticleBudgetState State;
+				if (ParticleBudgetStates.RemoveAndCopyValue(ParticleSystemComponent, State))
+				{
+					SetParticleThrottle(ParticleSystemComponent, State, EParticleThrottle::None);
+				}
+			}
 		}
 		ManagedObjectsByTag.Remove(Tag);
 	}
 }
 
+void USignificanceManager::SetDetailLevelFunction(UObject* Object, FDetailLevelFunction InDetailLevelFunction)
+{
+	if (FManagedObjectInfo** Info = ManagedObjects.Find(Object))
+	{
+		(*Info)->DetailLevelFunction = InDetailLevelFunction;
+	}
+}
+
+void USignificanceManager::RegisterActor(AActor* Actor, const FName Tag, FSignificanceFunction SignificanceFunction)
+{
+	RegisterObject(Actor, Tag, SignificanceFunction, nullptr);
+
+	TWeakObjectPtr<USignificanceManager> WeakThis(this);
+	SetDetailLevelFunction(Actor, [WeakThis](UObject* Object, int32 OldDetailLevel, int32 NewDetailLevel)
+	{
+		if (USignificanceManager* SignificanceManager = WeakThis.Get())
+		{
+			SignificanceManager->ApplyDetailLevel(CastChecked<AActor>(Object), NewDetailLevel);
+		}
+	});
+}
+
+void USignificanceManager::ApplyDetailLevel(AActor* Actor, const int32 DetailLevel) const
+{
+	if (Actor == nullptr || DetailLevels.Num() == 0)
+	{
+		return;
+	}
+
+	const FSignificanceDetailLevel& Settings = DetailLevels[FMath::Clamp(DetailLevel, 0, DetailLevels.Num() - 1)];
+
+	Actor->SetActorTickInterval(Settings.TickInterval);
+	for (UActorComponent* Component : Actor->GetComponents())
+	{
+		if (Component == nullptr)
+		{
+			continue;
+		}
+
+		Component->SetComponentTickInterval(Settings.TickInterval);
+
+		if (USkinnedMeshComponent* SkinnedMeshComponent = Cast<USkinnedMeshComponent>(Component))
+		{
+			SkinnedMeshComponent->bEnableUpdateRateOptimizations = Settings.bEnableUpdateRateOptimizations;
+		}
+		else if (UParticleSystemComponent* ParticleSystemComponent = Cast<UParticleSystemComponent>(Component))
+		{
+			ParticleSystemComponent->SetRequiredSignificance(Settings.RequiredParticleSignificance);
+		}
+		else if (UAudioComponent* AudioComponent = Cast<UAudioComponent>(Component))
+		{
+			// Only looping sounds, one shots would resume too late to make sense
+			if (AudioComponent->Sound && AudioComponent->Sound->IsLooping())
+			{
+				AudioComponent->SetPaused(Settings.bPauseLoopingAudio);
+			}
+		}
+	}
+}
+
+void USignificanceManager::RegisterParticleSystem(UParticleSystemComponent* Component, const FName Tag, const float GameplaySignificance, FSignificanceFunction SignificanceFunction)
+{
+	if (SignificanceFunction == nullptr)
+	{
+		// Screen size estimate, the bounds radius over the distance to the viewpoint
+		SignificanceFunction = [GameplaySignificance](UObject* Object, const FTransform& Viewpoint) -> float
+		{
+			const FBoxSphereBounds& Bounds = CastChecked<UParticleSystemComponent>(Object)->Bounds;
+			const float Distance = FMath::Max(FVector::Dist(Bounds.Origin, Viewpoint.GetLocation()), 1.f);
+			return GameplaySignificance * Bounds.SphereRadius / Distance;
+		};
+	}
+
+	RegisterObject(Component, Tag, SignificanceFunction, nullptr);
+	ParticleBudgetStates.Add(Component);
+}
+
+bool USignificanceManager::IsParticleSystemThrottled(const UParticleSystemComponent* Component) const
+{
+	const FParticleBudgetState* State = ParticleBudgetStates.Find(Component);
+	return State && State->Throttle != EParticleThrottle::None;
+}
+
+void USignificanceManager::SetParticleThrottle(UParticleSystemComponent* Component, FParticleBudgetState& State, const EParticleThrottle NewThrottle)
+{
+	if (State.Throttle == NewThrottle)
+	{
+		return;
+	}
+
+	// Lift the current throttle first so the restore values are always the component's own settings
+	if (State.Throttle == EParticleThrottle::Reduced)
+	{
+		Component->bSuppressSpawning = State.bRestoreSuppressSpawning;
+		Component->SetRequiredSignificance(State.RestoreRequiredSignificance);
+	}
+	else if (State.Throttle == EParticleThrottle::Paused)
+	{
+		Component->SetComponentTickEnabled(State.bRestoreTickEnabled);
+	}
+
+	if (NewThrottle == EParticleThrottle::Reduced)
+	{
+		State.bRestoreSuppressSpawning = Component->bSuppressSpawning;
+		State.RestoreRequiredSignificance = Component->RequiredSignificance;
+		Component->bSuppressSpawning = true;
+		Component->SetRequiredSignificance(EParticleSignificanceLevel::High);
+	}
+	else if (NewThrottle == EParticleThrottle::Paused)
+	{
+		State.bRestoreTickEnabled = Component->IsComponentTickEnabled();
+		Component->SetComponentTickEnabled(false);
+	}
+
+	State.Throttle = NewThrottle;
+}
+
+int32 USignificanceManager::GetDetailLevel(const UObject* Object) const
+{
+	if (FManagedObjectInfo* const* Info = ManagedObjects.Find(Object))
+	{
+		return (*Info)->GetDetailLevel();
+	}
+	return 0;
+}
+
 const TArray<const USignificanceManager::FManagedObjectInfo*>& USignificanceManager::GetManagedObjects(const FName Tag) const
 {
 	if (const TArray<const FManagedObjectInfo*>* ObjectsWithTag = ManagedObjectsByTag.Find(Tag))
@@ -340,6 +497,20 @@ void USignificanceManager::FManagedObjectInfo::UpdateSignificance(const TArray<F
 	}
 }
 
+void USignificanceManager::FManagedObjectInfo::SetDetailLevel(const int32 NewDetailLevel)
+{
+	if (DetailLevel != NewDetailLevel)
+	{
+		const int32 OldDetailLevel = DetailLevel;
+		DetailLevel = NewDetailLevel;
+
+		if (DetailLevelFunction != nullptr)
+		{
+			DetailLevelFunction(Object, OldDetailLevel, NewDetailLevel);
+		}
+	}
+}
+
 void USignificanceManager::Update(const TArray<FTransform>& InViewpoints)
 {
 	Viewpoints = InViewpoints;
@@ -370,6 +541,117 @@ void USignificanceManager::Update(const TArray<FTransform>& InViewpoints)
 			TagToObjectInfoArrayPair.Value.Sort(PickCompareBySignificance(bSortSignificanceAscending));
 		}
 	}
+
+	UpdateDetailLevels();
+	UpdateParticleBudget();
+}
+
+static TAutoConsoleVariable<float> CVarSignificanceManagerBudgetScale(
+	TEXT("SigMan.BudgetScale"),
+	1.0f,
+	TEXT("Scale of the number of objects allowed at each significance manager detail level. Lower values throttle more objects.\n"),
+	ECVF_Scalability
+	);
+
+void USignificanceManager::UpdateDetailLevels()
+{
+	if (DetailLevels.Num() == 0)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_SignificanceManager_DetailLevelUpdate);
+
+	const float BudgetScale = FMath::Max(CVarSignificanceManagerBudgetScale.GetValueOnGameThread(), 0.f);
+	TArray<int32, TInlineAllocator<8>> DetailLevelLimits;
+	for (const FSignificanceDetailLevel& Level : DetailLevels)
+	{
+		DetailLevelLimits.Add(Level.MaxObjects > 0 ? FMath::CeilToInt(Level.MaxObjects * BudgetScale) : MAX_int32);
+	}
+
+	for (TPair<FName, TArray<const FManagedObjectInfo*>>& TagToObjectInfoArrayPair : ManagedObjectsByTag)
+	{
+		// Lists are sorted most significant first, the budget of each level is filled in order
+		int32 DetailLevel = 0;
+		const TArray<const FManagedObjectInfo*>& ObjectInfos = TagToObjectInfoArrayPair.Value;
+		for (int32 Index = 0; Index < ObjectInfos.Num(); ++Index)
+		{
+			while (DetailLevel < DetailLevelLimits.Num() - 1 && Index >= DetailLevelLimits[DetailLevel])
+			{
+				++DetailLevel;
+			}
+
+			// Lists only hold const pointers to the infos owned by ManagedObjects
+			const_cast<FManagedObjectInfo*>(ObjectInfos[Index])->SetDetailLevel(DetailLevel);
+		}
+	}
+}
+
+void USignificanceManager::UpdateParticleBudget()
+{
+	if (ParticleBudgetStates.Num() == 0)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_SignificanceManager_ParticleBudgetUpdate);
+
+	const float BudgetScale = FMath::Max(CVarSignificanceManagerBudgetScale.GetValueOnGameThread(), 0.f);
+	const int32 MaxActiveParticles = ParticleBudget.MaxActiveParticles > 0 ? FMath::CeilToInt(ParticleBudget.MaxActiveParticles * BudgetScale) : MAX_int32;
+	const int32 MaxSpawningSystems = ParticleBudget.MaxSpawningSystems > 0 ? FMath::CeilToInt(ParticleBudget.MaxSpawningSystems * BudgetScale) : MAX_int32;
+	const float MaxSimulationTimeMS = ParticleBudget.MaxSimulationTimeMS > 0.f ? ParticleBudget.MaxSimulationTimeMS * BudgetScale : TNumericLimits<float>::Max();
+
+	TArray<const FManagedObjectInfo*> ObjectInfos;
+	ObjectInfos.Reserve(ParticleBudgetStates.Num());
+	for (const TPair<UParticleSystemComponent*, FParticleBudgetState>& ComponentToStatePair : ParticleBudgetStates)
+	{
+		ObjectInfos.Add(ManagedObjects.FindChecked(ComponentToStatePair.Key));
+	}
+	ObjectInfos.Sort(PickCompareBySignificance(bSortSignificanceAscending));
+
+	int32 ActiveParticles = 0;
+	int32 SpawningSystems = 0;
+	float SimulationTimeMS = 0.f;
+	for (const FManagedObjectInfo* ObjectInfo : ObjectInfos)
+	{
+		UParticleSystemComponent* Component = CastChecked<UParticleSystemComponent>(ObjectInfo->GetObject());
+		FParticleBudgetState& State = ParticleBudgetStates.FindChecked(Component);
+
+		if (!Component->IsActive())
+		{
+			SetParticleThrottle(Component, State, EParticleThrottle::None);
+			continue;
+		}
+
+		EParticleThrottle Throttle = EParticleThrottle::None;
+		if (SimulationTimeMS >= MaxSimulationTimeMS)
+		{
+			Throttle = EParticleThrottle::Paused;
+		}
+		else if (ActiveParticles >= MaxActiveParticles || SpawningSystems >= MaxSpawningSystems)
+		{
+			Throttle = EParticleThrottle::Reduced;
+		}
+		SetParticleThrottle(Component, State, Throttle);
+
+		// Paused systems keep their particles and the cost of their last tick, so they're only resumed once there's room for them
+		ActiveParticles += Component->GetLastTickActiveParticles();
+		SimulationTimeMS += Component->GetLastTickSimulationTimeMS();
+		if (Throttle == EParticleThrottle::None)
+		{
+			++SpawningSystems;
+		}
+		else if (Throttle == EParticleThrottle::Reduced)
+		{
+			INC_DWORD_STAT(STAT_SignificanceManager_ReducedParticleSystems);
+		}
+		else
+		{
+			INC_DWORD_STAT(STAT_SignificanceManager_PausedParticleSystems);
+		}
+	}
+
+	INC_DWORD_STAT_BY(STAT_SignificanceManager_BudgetedParticles, ActiveParticles);
 }
 
 static int32 GSignificanceManagerObjectsToShow = 15;
@@ -420,7 +702,18 @@ void USignificanceManager::OnShowDebugInfo(AHUD* HUD, UCanvas* Canvas, const FDe
 			for (int32 Index = 0; Index < NumObjectsToShow; ++Index)
 			{
 				const FManagedObjectInfo* ObjectInfo = ObjectsToShow[Index];
-				const FString Str = FString::Printf(TEXT("%6.3f - %s (%s)"), ObjectInfo->GetSignificance(), *ObjectInfo->GetObject()->GetName(), *ObjectInfo->GetTag().ToString());
+				FString Str = FString::Printf(TEXT("%6.3f - %s (%s) detail %d"), ObjectInfo->GetSignificance(), *ObjectInfo->GetObject()->GetName(), *ObjectInfo->GetTag().ToString(), ObjectInfo->GetDetailLevel());
+				if (const FParticleBudgetState* State = ParticleBudgetStates.Find(Cast<UParticleSystemComponent>(ObjectInfo->GetObject())))
+				{
+					if (State->Throttle == EParticleThrottle::Reduced)
+					{
+						Str += TEXT(" reduced");
+					}
+					else if (State->Throttle == EParticleThrottle::Paused)
+					{
+						Str += TEXT(" paused");
+					}
+				}
 				DisplayDebugManager.DrawString(Str);
 			}
 		}
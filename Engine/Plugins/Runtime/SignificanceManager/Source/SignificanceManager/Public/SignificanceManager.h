@@ -11,11 +11,14 @@
 #include "UObject/GCObject.h"
 #include "Misc/StringClassReference.h"
 #include "Engine/World.h"
+#include "ParticleHelper.h"
 #include "SignificanceManager.generated.h"
 
+class AActor;
 class AHUD;
 class FDebugDisplayInfo;
 class UCanvas;
+class UParticleSystemComponent;
 class USignificanceManager;
 struct FAutoCompleteCommand;
 
@@ -60,6 +63,68 @@ private:
 	static TSubclassOf<USignificanceManager>  SignificanceManagerClass;
 };
 
+/* Budget of a detail level and the settings applied to actors registered with RegisterActor while they are at that level */
+USTRUCT()
+struct SIGNIFICANCEMANAGER_API FSignificanceDetailLevel
+{
+	GENERATED_BODY()
+
+	// Most objects of one tag allowed at this or a more detailed level, scaled by SigMan.BudgetScale. 0 means no limit
+	UPROPERTY(EditAnywhere, Category=Budget)
+	int32 MaxObjects;
+
+	// Tick interval set on the actor and its components, 0 ticks every frame
+	UPROPERTY(EditAnywhere, Category=Budget)
+	float TickInterval;
+
+	// Whether skinned meshes of the actor use animation update rate optimizations
+	UPROPERTY(EditAnywhere, Category=Budget)
+	bool bEnableUpdateRateOptimizations;
+
+	// Lowest significance of emitters kept enabled in particle systems of the actor
+	UPROPERTY(EditAnywhere, Category=Budget)
+	EParticleSignificanceLevel RequiredParticleSignificance;
+
+	// Whether looping sounds of the actor are paused until it gets to a more detailed level
+	UPROPERTY(EditAnywhere, Category=Budget)
+	bool bPauseLoopingAudio;
+
+	FSignificanceDetailLevel()
+		: MaxObjects(0)
+		, TickInterval(0.f)
+		, bEnableUpdateRateOptimizations(false)
+		, RequiredParticleSignificance(EParticleSignificanceLevel::Low)
+		, bPauseLoopingAudio(false)
+	{
+	}
+};
+
+/* Global budget shared by all particle systems registered with RegisterParticleSystem, filled in significance order across tags */
+USTRUCT()
+struct SIGNIFICANCEMANAGER_API FParticleSystemBudget
+{
+	GENERATED_BODY()
+
+	// Most active particles of the more significant systems before less significant ones stop spawning and keep only high significance emitters. 0 means no limit
+	UPROPERTY(EditAnywhere, Category=Budget)
+	int32 MaxActiveParticles;
+
+	// Most systems allowed to spawn new particles, less significant ones are reduced the same way. 0 means no limit
+	UPROPERTY(EditAnywhere, Category=Budget)
+	int32 MaxSpawningSystems;
+
+	// Most time in ms spent simulating the more significant systems before less significant ones stop ticking. 0 means no limit
+	UPROPERTY(EditAnywhere, Category=Budget)
+	float MaxSimulationTimeMS;
+
+	FParticleSystemBudget()
+		: MaxActiveParticles(0)
+		, MaxSpawningSystems(0)
+		, MaxSimulationTimeMS(0.f)
+	{
+	}
+};
+
 /* The significance manager provides a framework for registering objects by tag to each have a significance
  * value calculated from which a game specific subclass and game logic can make decisions about what level
  * of detail objects should be at, tick frequency, whether to spawn effects, and other such functionality
@@ -78,12 +143,14 @@ class SIGNIFICANCEMANAGER_API USignificanceManager : public UObject
 public:
 	typedef TFunction<float(UObject*, const FTransform&)> FSignificanceFunction;
 	typedef TFunction<void(UObject*, float, float, bool)> FPostSignificanceFunction;
+	typedef TFunction<void(UObject*, int32, int32)> FDetailLevelFunction;
 
 	struct FManagedObjectInfo
 	{
 		FManagedObjectInfo()
 			: Object(nullptr)
 			, Significance(-1.0f)
+			, DetailLevel(0)
 		{
 		}
 
@@ -91,6 +158,7 @@ public:
 			: Object(InObject)
 			, Tag(InTag)
 			, Significance(1.0f)
+			, DetailLevel(0)
 			, SignificanceFunction(InSignificanceFunction)
 			, PostSignificanceFunction(InPostSignificanceFunction)
 		{
@@ -99,6 +167,7 @@ public:
 		UObject* GetObject() const { return Object; }
 		FName GetTag() const { return Tag; }
 		float GetSignificance() const { return Significance; }
+		int32 GetDetailLevel() const { return DetailLevel; }
 		FSignificanceFunction GetSignificanceFunction() const { return SignificanceFunction; }
 		FPostSignificanceFunction GetPostSignificanceNotifyDelegate() const { return PostSignificanceFunction; }
 
@@ -106,11 +175,16 @@ public:
 		UObject* Object;
 		FName Tag;
 		float Significance;
+		int32 DetailLevel;
 
 		FSignificanceFunction SignificanceFunction;
 
 		FPostSignificanceFunction PostSignificanceFunction;
 
+		FDetailLevelFunction DetailLevelFunction;
+
+		void SetDetailLevel(int32 NewDetailLevel);
+
 		void UpdateSignificance(const TArray<FTransform>& ViewPoints, const bool bSortSignificanceAscending);
 
 		// Allow SignificanceManager to call UpdateSignificance
@@ -136,6 +210,24 @@ public:
 	// Unregisters all objects with the specified tag.
 	void UnregisterAll(FName Tag);
 
+	// Sets the function called on the game thread when the object's detail level changes after the significance sort
+	void SetDetailLevelFunction(UObject* Object, FDetailLevelFunction InDetailLevelFunction);
+
+	// Registers an actor whose ticking, animation, particles and audio are throttled by its detail level using DetailLevels settings
+	void RegisterActor(AActor* Actor, FName Tag, FSignificanceFunction SignificanceFunction);
+
+	// Applies the settings of the detail level to the actor and its components
+	void ApplyDetailLevel(AActor* Actor, int32 DetailLevel) const;
+
+	// Registers a particle system throttled by ParticleBudget. Without a significance function, significance is its screen size scaled by GameplaySignificance
+	void RegisterParticleSystem(UParticleSystemComponent* Component, FName Tag, float GameplaySignificance = 1.f, FSignificanceFunction SignificanceFunction = nullptr);
+
+	// Returns whether a particle system registered with RegisterParticleSystem is currently reduced or paused by the budget
+	bool IsParticleSystemThrottled(const UParticleSystemComponent* Component) const;
+
+	// Returns the detail level of a given object, returns 0 if object is not managed
+	int32 GetDetailLevel(const UObject* Object) const;
+
 	// Returns objects of specified tag, Tag must be specified or else an empty array will be returned
 	const TArray<const FManagedObjectInfo*>& GetManagedObjects(FName Tag) const;
 
@@ -178,7 +270,40 @@ protected:
 	// Whether the significance sort should sort high values to the end of the list
 	uint32 bSortSignificanceAscending:1;
 
+	// Detail levels assigned to objects of each tag in significance order, per platform config sets the budget for that hardware
+	UPROPERTY(config, EditAnywhere, Category=Budget)
+	TArray<FSignificanceDetailLevel> DetailLevels;
+
+	// Budget of the particle systems registered with RegisterParticleSystem, per platform config sets the budget for that hardware
+	UPROPERTY(config, EditAnywhere, Category=Budget)
+	FParticleSystemBudget ParticleBudget;
+
 private:
+	enum class EParticleThrottle : uint8
+	{
+		None,
+		// Spawning suppressed and only high significance emitters enabled
+		Reduced,
+		// Ticking disabled, existing particles stay frozen
+		Paused,
+	};
+
+	// Throttle of a budgeted particle system and the component settings to restore when it's lifted
+	struct FParticleBudgetState
+	{
+		EParticleThrottle Throttle;
+		EParticleSignificanceLevel RestoreRequiredSignificance;
+		bool bRestoreSuppressSpawning;
+		bool bRestoreTickEnabled;
+
+		FParticleBudgetState()
+			: Throttle(EParticleThrottle::None)
+			, RestoreRequiredSignificance(EParticleSignificanceLevel::Low)
+			, bRestoreSuppressSpawning(false)
+			, bRestoreTickEnabled(true)
+		{
+		}
+	};
 
 	// The cached viewpoints for significance for calculating when a new object is registered
 	TArray<FTransform> Viewpoints;
@@ -189,10 +314,22 @@ private:
 	// Reverse lookup map to find the tag for a given object
 	TMap<UObject*, FManagedObjectInfo*> ManagedObjects;
 
+	// Particle systems registered with RegisterParticleSystem
+	TMap<UParticleSystemComponent*, FParticleBudgetState> ParticleBudgetStates;
+
 	// Game specific significance class to instantiate
 	UPROPERTY(globalconfig, noclear, EditAnywhere, Category=DefaultClasses, meta=(MetaClass="SignificanceManager", DisplayName="Significance Manager Class"))
 	FStringClassReference SignificanceManagerClassName;
 
+	// Assigns detail levels to objects of each tag from their position in the sorted list and the detail level budgets
+	void UpdateDetailLevels();
+
+	// Throttles registered particle systems exceeding ParticleBudget, walking them from most to least significant
+	void UpdateParticleBudget();
+
+	// Applies a throttle to the component, restoring the settings it had before when lifting one
+	static void SetParticleThrottle(UParticleSystemComponent* Component, FParticleBudgetState& State, EParticleThrottle NewThrottle);
+
 	// Callback function registered with HUD to supply debug info when ShowDebug SignificanceManager has been entered on the console
 	void OnShowDebugInfo(AHUD* HUD, UCanvas* Canvas, const FDebugDisplayInfo& DisplayInfo, float& YL, float& YPos);
 
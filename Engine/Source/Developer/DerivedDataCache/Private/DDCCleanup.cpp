@@ -127,6 +127,11 @@ bool FDDCCleanup::CleanupFilesystemDirectory( TSharedPtr< FFilesystemInfo > File
 		const FString DirectoryPath( FilesystemInfo->CachePath / FString::Printf(TEXT("%1d/%1d/%1d/"),(DirectoryIndex/100)%10,(DirectoryIndex/10)%10,DirectoryIndex%10) );
 
 		IFileManager::Get().FindFilesRecursive( FileNames, *DirectoryPath, TEXT("*.*"), true, false );
+
+		// Payloads of the content addressed layout are shared by several keys, they are touched whenever one of their keys is used
+		// so they only get old enough to be deleted once none of the keys pointing at them is in use anymore.
+		const FString ContentDirectoryPath( FilesystemInfo->CachePath / TEXT("Content") / FString::Printf(TEXT("%1d/%1d/%1d/"),(DirectoryIndex/100)%10,(DirectoryIndex/10)%10,DirectoryIndex%10) );
+		IFileManager::Get().FindFilesRecursive( FileNames, *ContentDirectoryPath, TEXT("*.*"), true, false, false );
 		if ( FilesystemInfo->CacheDirectories.Num() == 0 )
 		{
 			// Remove the filesystem and stop checking it
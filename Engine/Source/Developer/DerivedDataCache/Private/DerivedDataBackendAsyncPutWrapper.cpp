@@ -41,7 +41,7 @@ public:
 	/** Call the inner backend and when that completes, remove the memory cache */
 	void DoWork()
 	{
-		COOK_STAT(auto Timer = UsageStats.TimePut());
+		COOK_STAT(auto Timer = UsageStats.TimePut(*CacheKey));
 		bool bOk = true;
 		const bool bAlreadyExists = InnerBackend->CachedDataProbablyExists(*CacheKey);
 		if (!bAlreadyExists || bPutEvenIfExists)
@@ -112,7 +112,7 @@ bool FDerivedDataBackendAsyncPutWrapper::IsWritable()
  */
 bool FDerivedDataBackendAsyncPutWrapper::CachedDataProbablyExists(const TCHAR* CacheKey)
 {
-	COOK_STAT(auto Timer = UsageStats.TimeProbablyExists());
+	COOK_STAT(auto Timer = UsageStats.TimeProbablyExists(CacheKey));
 	bool Result = (InflightCache && InflightCache->CachedDataProbablyExists(CacheKey)) || InnerBackend->CachedDataProbablyExists(CacheKey);
 	COOK_STAT(if (Result) {	Timer.AddHit(0); });
 	return Result;
@@ -120,7 +120,7 @@ bool FDerivedDataBackendAsyncPutWrapper::CachedDataProbablyExists(const TCHAR* C
 
 bool FDerivedDataBackendAsyncPutWrapper::GetCachedData(const TCHAR* CacheKey, TArray<uint8>& OutData)
 {
-	COOK_STAT(auto Timer = UsageStats.TimeGet());
+	COOK_STAT(auto Timer = UsageStats.TimeGet(CacheKey));
 	if (InflightCache && InflightCache->GetCachedData(CacheKey, OutData))
 	{
 		COOK_STAT(Timer.AddHit(OutData.Num()));
@@ -134,9 +134,87 @@ bool FDerivedDataBackendAsyncPutWrapper::GetCachedData(const TCHAR* CacheKey, TA
 	return bSuccess;
 }
 
+TBitArray<> FDerivedDataBackendAsyncPutWrapper::CachedDataProbablyExistsBatch(const TArray<FString>& CacheKeys)
+{
+	COOK_STAT(auto Timer = UsageStats.TimeProbablyExists());
+	TBitArray<> Result(false, CacheKeys.Num());
+	TArray<FString> InnerKeys;
+	TArray<int32> InnerKeyIndices;
+	for (int32 KeyIndex = 0; KeyIndex < CacheKeys.Num(); ++KeyIndex)
+	{
+		if (InflightCache && InflightCache->CachedDataProbablyExists(*CacheKeys[KeyIndex]))
+		{
+			Result[KeyIndex] = true;
+		}
+		else
+		{
+			InnerKeys.Add(CacheKeys[KeyIndex]);
+			InnerKeyIndices.Add(KeyIndex);
+		}
+	}
+	if (InnerKeys.Num())
+	{
+		TBitArray<> InnerResult = InnerBackend->CachedDataProbablyExistsBatch(InnerKeys);
+		for (int32 InnerIndex = 0; InnerIndex < InnerKeys.Num(); ++InnerIndex)
+		{
+			Result[InnerKeyIndices[InnerIndex]] = InnerResult[InnerIndex];
+		}
+	}
+	COOK_STAT(if (Result.Find(true) != INDEX_NONE) { Timer.AddHit(0); });
+	return Result;
+}
+
+TBitArray<> FDerivedDataBackendAsyncPutWrapper::GetCachedDataBatch(const TArray<FString>& CacheKeys, TArray<TArray<uint8>>& OutData)
+{
+	COOK_STAT(auto Timer = UsageStats.TimeGet());
+	TBitArray<> Result(false, CacheKeys.Num());
+	OutData.Reset();
+	OutData.SetNum(CacheKeys.Num());
+	TArray<FString> InnerKeys;
+	TArray<int32> InnerKeyIndices;
+	for (int32 KeyIndex = 0; KeyIndex < CacheKeys.Num(); ++KeyIndex)
+	{
+		if (InflightCache && InflightCache->GetCachedData(*CacheKeys[KeyIndex], OutData[KeyIndex]))
+		{
+			Result[KeyIndex] = true;
+		}
+		else
+		{
+			InnerKeys.Add(CacheKeys[KeyIndex]);
+			InnerKeyIndices.Add(KeyIndex);
+		}
+	}
+	if (InnerKeys.Num())
+	{
+		TArray<TArray<uint8>> InnerData;
+		TBitArray<> InnerResult = InnerBackend->GetCachedDataBatch(InnerKeys, InnerData);
+		for (int32 InnerIndex = 0; InnerIndex < InnerKeys.Num(); ++InnerIndex)
+		{
+			if (InnerResult[InnerIndex])
+			{
+				Result[InnerKeyIndices[InnerIndex]] = true;
+				OutData[InnerKeyIndices[InnerIndex]] = MoveTemp(InnerData[InnerIndex]);
+			}
+		}
+	}
+	COOK_STAT(
+	{
+		int64 HitBytes = 0;
+		for (const TArray<uint8>& Data : OutData)
+		{
+			HitBytes += Data.Num();
+		}
+		if (Result.Find(true) != INDEX_NONE)
+		{
+			Timer.AddHit(HitBytes);
+		}
+	});
+	return Result;
+}
+
 void FDerivedDataBackendAsyncPutWrapper::PutCachedData(const TCHAR* CacheKey, TArray<uint8>& InData, bool bPutEvenIfExists)
 {
-	COOK_STAT(auto Timer = PutSyncUsageStats.TimePut());
+	COOK_STAT(auto Timer = PutSyncUsageStats.TimePut(CacheKey));
 	if (!InnerBackend->IsWritable())
 	{
 		return; // no point in continuing down the chain
@@ -156,7 +234,8 @@ void FDerivedDataBackendAsyncPutWrapper::PutCachedData(const TCHAR* CacheKey, TA
 		COOK_STAT(Timer.AddHit(InData.Num()));
 	}
 	FDerivedDataBackend::Get().AddToAsyncCompletionCounter(1);
-	(new FAutoDeleteAsyncTask<FCachePutAsyncWorker>(CacheKey, &InData, InnerBackend, bPutEvenIfExists, InflightCache.Get(), &FilesInFlight, UsageStats))->StartBackgroundTask();
+	// Puts only keep the cache warm, nothing waits for them, so they yield to any other pool work
+	(new FAutoDeleteAsyncTask<FCachePutAsyncWorker>(CacheKey, &InData, InnerBackend, bPutEvenIfExists, InflightCache.Get(), &FilesInFlight, UsageStats))->StartBackgroundTask(EQueuedWorkPriority::Low);
 }
 
 void FDerivedDataBackendAsyncPutWrapper::RemoveCachedData(const TCHAR* CacheKey, bool bTransient)
@@ -84,6 +84,10 @@ public:
 	 */
 	virtual bool GetCachedData(const TCHAR* CacheKey, TArray<uint8>& OutData) override;
 
+	/** Batched versions, the keys the in flight puts don't have go to the inner backend as one batch */
+	virtual TBitArray<> CachedDataProbablyExistsBatch(const TArray<FString>& CacheKeys) override;
+	virtual TBitArray<> GetCachedDataBatch(const TArray<FString>& CacheKeys, TArray<TArray<uint8>>& OutData) override;
+
 	/**
 	 * Asynchronous, fire-and-forget placement of a cache item
 	 *
@@ -95,7 +95,7 @@ public:
 	 */
 	virtual bool CachedDataProbablyExists(const TCHAR* CacheKey) override
 	{
-		COOK_STAT(auto Timer = UsageStats.TimeProbablyExists());
+		COOK_STAT(auto Timer = UsageStats.TimeProbablyExists(CacheKey));
 		bool Result = InnerBackend->CachedDataProbablyExists(CacheKey);
 		if (Result)
 		{
@@ -103,6 +103,11 @@ public:
 		}
 		return Result;
 	}
+	virtual TBitArray<> CachedDataProbablyExistsBatch(const TArray<FString>& CacheKeys) override
+	{
+		return InnerBackend->CachedDataProbablyExistsBatch(CacheKeys);
+	}
+
 	/**
 	 * Synchronous retrieve of a cache item
 	 *
@@ -112,37 +117,8 @@ public:
 	 */
 	virtual bool GetCachedData(const TCHAR* CacheKey, TArray<uint8>& OutData) override
 	{
-		COOK_STAT(auto Timer = UsageStats.TimeGet());
-		bool bOk = InnerBackend->GetCachedData(CacheKey, OutData);
-		if (bOk)
-		{
-			if (OutData.Num() < sizeof(FDerivedDataTrailer))
-			{
-				UE_LOG(LogDerivedDataCache, Warning, TEXT("FDerivedDataBackendCorruptionWrapper: Corrupted file (short), ignoring and deleting %s."),CacheKey);
-				bOk	= false;
-			}
-			else
-			{
-				FDerivedDataTrailer Trailer;
-				FMemory::Memcpy(&Trailer,&OutData[OutData.Num() - sizeof(FDerivedDataTrailer)], sizeof(FDerivedDataTrailer));
-				OutData.RemoveAt(OutData.Num() - sizeof(FDerivedDataTrailer),sizeof(FDerivedDataTrailer), false);
-				FDerivedDataTrailer RecomputedTrailer(OutData);
-				if (Trailer == RecomputedTrailer)
-				{
-					UE_LOG(LogDerivedDataCache, Verbose, TEXT("FDerivedDataBackendCorruptionWrapper: cache hit, footer is ok %s"),CacheKey);
-				}
-				else
-				{
-					UE_LOG(LogDerivedDataCache, Warning, TEXT("FDerivedDataBackendCorruptionWrapper: Corrupted file, ignoring and deleting %s."),CacheKey);
-					bOk	= false;
-				}
-			}
-			if (!bOk)
-			{
-				// _we_ detected corruption, so _we_ will force a flush of the corrupted data
-				InnerBackend->RemoveCachedData(CacheKey, /*bTransient=*/ false);
-			}
-		}
+		COOK_STAT(auto Timer = UsageStats.TimeGet(CacheKey));
+		bool bOk = InnerBackend->GetCachedData(CacheKey, OutData) && VerifyAndStripTrailer(CacheKey, OutData);
 		if (!bOk)
 		{
 			OutData.Empty();
@@ -153,6 +129,19 @@ public:
 		}
 		return bOk;
 	}
+	virtual TBitArray<> GetCachedDataBatch(const TArray<FString>& CacheKeys, TArray<TArray<uint8>>& OutData) override
+	{
+		TBitArray<> Result = InnerBackend->GetCachedDataBatch(CacheKeys, OutData);
+		for (int32 KeyIndex = 0; KeyIndex < CacheKeys.Num(); ++KeyIndex)
+		{
+			if (Result[KeyIndex] && !VerifyAndStripTrailer(*CacheKeys[KeyIndex], OutData[KeyIndex]))
+			{
+				Result[KeyIndex] = false;
+			}
+		}
+		return Result;
+	}
+
 	/**
 	 * Asynchronous, fire-and-forget placement of a cache item
 	 *
@@ -162,7 +151,7 @@ public:
 	 */
 	virtual void PutCachedData(const TCHAR* CacheKey, TArray<uint8>& InData, bool bPutEvenIfExists) override
 	{
-		COOK_STAT(auto Timer = UsageStats.TimePut());
+		COOK_STAT(auto Timer = UsageStats.TimePut(CacheKey));
 		if (!InnerBackend->IsWritable())
 		{
 			return; // no point in continuing down the chain
@@ -201,6 +190,46 @@ public:
 	}
 
 private:
+	/**
+	 * Checks the footer of data returned by the inner backend and removes it
+	 *
+	 * @param	CacheKey	Alphanumeric+underscore key of this cache item
+	 * @param	Data		Data including the footer, the payload on success and empty otherwise
+	 * @return				true if the footer matches the payload
+	 */
+	bool VerifyAndStripTrailer(const TCHAR* CacheKey, TArray<uint8>& Data)
+	{
+		bool bOk = true;
+		if (Data.Num() < sizeof(FDerivedDataTrailer))
+		{
+			UE_LOG(LogDerivedDataCache, Warning, TEXT("FDerivedDataBackendCorruptionWrapper: Corrupted file (short), ignoring and deleting %s."),CacheKey);
+			bOk	= false;
+		}
+		else
+		{
+			FDerivedDataTrailer Trailer;
+			FMemory::Memcpy(&Trailer,&Data[Data.Num() - sizeof(FDerivedDataTrailer)], sizeof(FDerivedDataTrailer));
+			Data.RemoveAt(Data.Num() - sizeof(FDerivedDataTrailer),sizeof(FDerivedDataTrailer), false);
+			FDerivedDataTrailer RecomputedTrailer(Data);
+			if (Trailer == RecomputedTrailer)
+			{
+				UE_LOG(LogDerivedDataCache, Verbose, TEXT("FDerivedDataBackendCorruptionWrapper: cache hit, footer is ok %s"),CacheKey);
+			}
+			else
+			{
+				UE_LOG(LogDerivedDataCache, Warning, TEXT("FDerivedDataBackendCorruptionWrapper: Corrupted file, ignoring and deleting %s."),CacheKey);
+				bOk	= false;
+			}
+		}
+		if (!bOk)
+		{
+			// _we_ detected corruption, so _we_ will force a flush of the corrupted data
+			InnerBackend->RemoveCachedData(CacheKey, /*bTransient=*/ false);
+			Data.Empty();
+		}
+		return bOk;
+	}
+
 	FDerivedDataCacheUsageStats UsageStats;
 
 	/** Backend to use for storage, my responsibilities are about corruption **/
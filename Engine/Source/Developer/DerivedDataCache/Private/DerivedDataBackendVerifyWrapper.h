@@ -39,7 +39,7 @@ public:
 
 	virtual bool CachedDataProbablyExists(const TCHAR* CacheKey) override
 	{
-		COOK_STAT(auto Timer = UsageStats.TimeProbablyExists());
+		COOK_STAT(auto Timer = UsageStats.TimeProbablyExists(CacheKey));
 		FScopeLock ScopeLock(&SynchronizationObject);
 		if (AlreadyTested.Contains(FString(CacheKey)))
 		{
@@ -50,7 +50,7 @@ public:
 	}
 	virtual bool GetCachedData(const TCHAR* CacheKey, TArray<uint8>& OutData) override
 	{
-		COOK_STAT(auto Timer = UsageStats.TimeGet());
+		COOK_STAT(auto Timer = UsageStats.TimeGet(CacheKey));
 		bool bAlreadyTested = false;
 		{
 			FScopeLock ScopeLock(&SynchronizationObject);
@@ -72,7 +72,7 @@ public:
 	}
 	virtual void PutCachedData(const TCHAR* CacheKey, TArray<uint8>& InData, bool bPutEvenIfExists) override
 	{
-		COOK_STAT(auto Timer = UsageStats.TimePut());
+		COOK_STAT(auto Timer = UsageStats.TimePut(CacheKey));
 		bool bAlreadyTested = false;
 		{
 			FScopeLock ScopeLock(&SynchronizationObject);
@@ -28,7 +28,8 @@ DEFINE_LOG_CATEGORY(LogDerivedDataCache);
 #define MAX_BACKEND_KEY_LENGTH (120)
 #define LOCTEXT_NAMESPACE "DerivedDataBackendGraph"
 
-FDerivedDataBackendInterface* CreateFileSystemDerivedDataBackend(const TCHAR* CacheDirectory, bool bForceReadOnly = false, bool bTouchFiles = false, bool bPurgeTransient = false, bool bDeleteOldFiles = false, int32 InDaysToDeleteUnusedFiles = 60, int32 InMaxNumFoldersToCheck = -1, int32 InMaxContinuousFileChecks = -1);
+FDerivedDataBackendInterface* CreateFileSystemDerivedDataBackend(const TCHAR* CacheDirectory, bool bForceReadOnly = false, bool bTouchFiles = false, bool bPurgeTransient = false, bool bDeleteOldFiles = false, int32 InDaysToDeleteUnusedFiles = 60, int32 InMaxNumFoldersToCheck = -1, int32 InMaxContinuousFileChecks = -1, bool bContentAddressed = false);
+FDerivedDataBackendInterface* CreateHttpDerivedDataBackend(const TCHAR* ServiceUrl, const TCHAR* Namespace, bool bForceReadOnly, int32 MaxConnections, int32 TimeoutSeconds);
 
 /**
   * This class is used to create a singleton that represents the derived data cache hierarchy and all of the wrappers necessary
@@ -55,6 +56,10 @@ public:
 		TEXT( "DDC.UnmountPak" ),
 		*LOCTEXT("CommandText_DDCUnmountPak", "Unmounts read-only pak file").ToString(),
 		FConsoleCommandWithArgsDelegate::CreateRaw( this, &FDerivedDataBackendGraph::UnmountPakCommandHandler ) )
+		, StatsCommand(
+		TEXT( "DDC.Stats" ),
+		*LOCTEXT("CommandText_DDCStats", "Logs hits, misses, bytes and latency of every DDC node per type of data").ToString(),
+		FConsoleCommandDelegate::CreateRaw( this, &FDerivedDataBackendGraph::StatsCommandHandler ) )
 	{
 		check(IsInGameThread()); // we pretty much need this to be initialized from the main thread...it uses GConfig, etc
 		check(GConfig && GConfig->IsReadyForUse());
@@ -146,6 +151,10 @@ public:
 				{
 					ParsedNode = ParseDataCache( NodeName, *Entry );
 				}
+				else if( NodeType == TEXT("Http") )
+				{
+					ParsedNode = ParseHttpCache( NodeName, *Entry );
+				}
 				else if( NodeType == TEXT("Boot") )
 				{
 					if( BootCache == NULL )
@@ -521,6 +530,8 @@ public:
 			const bool bFlush = GetParsedBool( Entry, TEXT("Flush=") );
 			const bool bTouch = GetParsedBool( Entry, TEXT("Touch=") );
 			const bool bPurgeTransient = GetParsedBool( Entry, TEXT("PurgeTransient=") );
+			// payloads are stored once per content hash, worth it for shared caches where many keys produce the same data
+			const bool bContentAddressed = GetParsedBool( Entry, TEXT("ContentAddressed=") );
 
 			bool bDeleteUnused = true; // On by default
 			FParse::Bool( Entry, TEXT("DeleteUnused="), bDeleteUnused );
@@ -545,7 +556,7 @@ public:
 			// Don't create the file system if shared data cache directory is not mounted
 			if( FCString::Strcmp(NodeName, TEXT("Shared")) != 0 || IFileManager::Get().DirectoryExists(*Path) )
 			{
-				InnerFileSystem = CreateFileSystemDerivedDataBackend( *Path, bReadOnly, bTouch, bPurgeTransient, bDeleteUnused, UnusedFileAge, MaxFoldersToClean, MaxFileChecksPerSec);
+				InnerFileSystem = CreateFileSystemDerivedDataBackend( *Path, bReadOnly, bTouch, bPurgeTransient, bDeleteUnused, UnusedFileAge, MaxFoldersToClean, MaxFileChecksPerSec, bContentAddressed);
 			}
 
 			if( InnerFileSystem )
@@ -563,6 +574,61 @@ public:
 		return DataCache;
 	}
 
+	/**
+	 * Creates Http data cache interface from ini settings, for example
+	 * Shared=(Type=Http, Host=http://ddc.mystudio.net:8080, Namespace=MyGame, ReadOnly=false, MaxConnections=8, Timeout=30, EnvHostOverride=UE-HttpSharedDataCache)
+	 *
+	 * @param NodeName Node name.
+	 * @param Entry Node definition.
+	 * @return Http data cache backend interface instance or NULL if unsuccessfull
+	 */
+	FDerivedDataBackendInterface* ParseHttpCache( const TCHAR* NodeName, const TCHAR* Entry )
+	{
+		FString Host;
+		FParse::Value( Entry, TEXT("Host="), Host );
+
+		// Same as the EnvPathOverride of filesystem caches, lets offsite workers point at a closer service.
+		FString EnvHostOverride;
+		if( FParse::Value( Entry, TEXT("EnvHostOverride="), EnvHostOverride ) )
+		{
+			TCHAR HostEnv[256];
+			FPlatformMisc::GetEnvironmentVariable( *EnvHostOverride, HostEnv, ARRAY_COUNT(HostEnv) );
+			if( HostEnv[0] )
+			{
+				Host = HostEnv;
+				UE_LOG( LogDerivedDataCache, Log, TEXT("Found environment variable %s=%s"), *EnvHostOverride, *Host );
+			}
+		}
+
+		if( !Host.Len() || Host == TEXT("None") )
+		{
+			UE_LOG( LogDerivedDataCache, Log, TEXT("%s http data cache host not set, will not use an %s cache."), NodeName, NodeName );
+			return NULL;
+		}
+
+		FString Namespace = FApp::GetGameName();
+		FParse::Value( Entry, TEXT("Namespace="), Namespace );
+		const bool bReadOnly = GetParsedBool( Entry, TEXT("ReadOnly=") );
+		int32 MaxConnections = 8;
+		FParse::Value( Entry, TEXT("MaxConnections="), MaxConnections );
+		int32 Timeout = 30;
+		FParse::Value( Entry, TEXT("Timeout="), Timeout );
+
+		FDerivedDataBackendInterface* DataCache = NULL;
+		FDerivedDataBackendInterface* InnerHttp = CreateHttpDerivedDataBackend( *Host, *Namespace, bReadOnly, MaxConnections, Timeout );
+		if( InnerHttp )
+		{
+			DataCache = new FDerivedDataBackendCorruptionWrapper( InnerHttp );
+			CreatedBackends.Add( InnerHttp );
+			UE_LOG( LogDerivedDataCache, Log, TEXT("Using %s http data cache %s/%s: %s"), NodeName, *Host, *Namespace, bReadOnly ? TEXT("ReadOnly") : TEXT("Writable") );
+		}
+		else
+		{
+			UE_LOG( LogDerivedDataCache, Warning, TEXT("%s http data cache %s was not usable, will not use it."), NodeName, *Host );
+		}
+		return DataCache;
+	}
+
 	/**
 	 * Creates Boot data cache interface from ini settings.
 	 *
@@ -736,6 +802,9 @@ public:
 					}
 				}
 			}
+
+			// the per type breakdown is too long for the summary printed with the cook stats, it goes to the log instead
+			LogTelemetry(*GLog);
 		}
 	}
 
@@ -829,6 +898,30 @@ private:
 		CreatedBackends.Empty();
 	}
 
+	/** Logs the per type telemetry of every node of the graph. */
+	void LogTelemetry(FOutputDevice& Ar)
+	{
+#if ENABLE_COOK_STATS
+		TMap<FString, FDerivedDataCacheUsageStats> UsageStats;
+		GatherUsageStats(UsageStats);
+		UsageStats.KeySort(TLess<FString>());
+
+		Ar.Logf(TEXT("Derived data cache telemetry of %s, latency buckets double from 1ms:"), *GraphName);
+		for (const TPair<FString, FDerivedDataCacheUsageStats>& Node : UsageStats)
+		{
+			Node.Value.Telemetry->Log(Ar, Node.Key);
+		}
+#else
+		Ar.Logf(TEXT("Derived data cache telemetry is only gathered in builds with cook stats."));
+#endif
+	}
+
+	/** Stats console command handler. */
+	void StatsCommandHandler()
+	{
+		LogTelemetry(*GLog);
+	}
+
 	/** MountPak console command handler. */
 	void UnmountPakCommandHandler(const TArray<FString>& Args)
 	{
@@ -879,6 +972,8 @@ private:
 	FAutoConsoleCommand MountPakCommand;
 	/** UnmountPak console command */
 	FAutoConsoleCommand UnountPakCommand;
+	/** Stats console command */
+	FAutoConsoleCommand StatsCommand;
 };
 
 FDerivedDataBackend& FDerivedDataBackend::Get()
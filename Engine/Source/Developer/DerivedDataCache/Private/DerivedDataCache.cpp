@@ -11,6 +11,9 @@
 #include "Serialization/MemoryReader.h"
 #include "Serialization/MemoryWriter.h"
 #include "Modules/ModuleManager.h"
+#include "Containers/Queue.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTLS.h"
 
 #include "DerivedDataCacheInterface.h"
 #include "DerivedDataBackendInterface.h"
@@ -28,6 +31,31 @@ DEFINE_STAT(STAT_DDC_PutTime);
 DEFINE_STAT(STAT_DDC_SyncBuildTime);
 DEFINE_STAT(STAT_DDC_ExistTime);
 
+int32 GDDCMaxPrefetchMB = 256;
+static FAutoConsoleVariableRef CVarDDCMaxPrefetchMB(
+	TEXT("DDC.MaxPrefetchMB"),
+	GDDCMaxPrefetchMB,
+	TEXT("Maximum size in MB of the data prefetched ahead of the gets that will ask for it, the oldest data is dropped beyond that.")
+	);
+
+/** Tls slot holding the set the keys requested by the thread are recorded into, see RecordRequestedKeys. */
+static uint32 GetRecordRequestedKeysTlsSlot()
+{
+	static uint32 TlsSlot = FPlatformTLS::AllocTlsSlot();
+	return TlsSlot;
+}
+
+static FORCEINLINE void RecordRequestedKey(const TCHAR* CacheKey)
+{
+	if (TSet<FString>* RequestedKeys = (TSet<FString>*)FPlatformTLS::GetTlsValue(GetRecordRequestedKeysTlsSlot()))
+	{
+		RequestedKeys->Add(CacheKey);
+	}
+}
+
+class FDerivedDataCache;
+FDerivedDataCache& InternalSingleton();
+
 #if ENABLE_COOK_STATS
 #include "DerivedDataCacheUsageStats.h"
 namespace DerivedDataCacheCookStats
@@ -137,7 +165,12 @@ class FDerivedDataCache : public FDerivedDataCacheInterface
 				STAT(double ThisTime = 0);
 				{
 					SCOPE_SECONDS_COUNTER(ThisTime);
-					bGetResult = FDerivedDataBackend::Get().GetRoot().GetCachedData(*CacheKey, Data);
+					bool bKnownMiss = false;
+					bGetResult = InternalSingleton().TakePrefetchedData(CacheKey, Data, bKnownMiss);
+					if (!bGetResult && !bKnownMiss)
+					{
+						bGetResult = FDerivedDataBackend::Get().GetRoot().GetCachedData(*CacheKey, Data);
+					}
 				}
 				INC_FLOAT_STAT_BY(STAT_DDC_SyncGetTime, bSynchronousForStats ? (float)ThisTime : 0.0f);
 			}
@@ -200,11 +233,40 @@ class FDerivedDataCache : public FDerivedDataCacheInterface
 		TArray<uint8>					Data;
 	};
 
+	/** 
+	 * Async worker that fetches a batch of keys before they are asked for and keeps the results in memory
+	**/
+	class FPrefetchAsyncWorker : public FNonAbandonableTask
+	{
+	public:
+		FPrefetchAsyncWorker(const TArray<FString>& InCacheKeys)
+			: CacheKeys(InCacheKeys)
+		{
+		}
+
+		void DoWork()
+		{
+			TArray<TArray<uint8>> Data;
+			TBitArray<> Hits = FDerivedDataBackend::Get().GetRoot().GetCachedDataBatch(CacheKeys, Data);
+			InternalSingleton().AddPrefetchedData(CacheKeys, Hits, Data);
+			FDerivedDataBackend::Get().AddToAsyncCompletionCounter(-1);
+		}
+
+		FORCEINLINE TStatId GetStatId() const
+		{
+			RETURN_QUICK_DECLARE_CYCLE_STAT(FPrefetchAsyncWorker, STATGROUP_ThreadPoolAsyncTasks);
+		}
+
+		/** Keys to fetch **/
+		TArray<FString>					CacheKeys;
+	};
+
 public:
 
 	/** Constructor, called once to cereate a singleton **/
 	FDerivedDataCache()
 		: CurrentHandle(19248) // we will skip some potential handles to catch errors
+		, PrefetchedBytes(0)
 	{
 		FDerivedDataBackend::Get(); // we need to make sure this starts before we all us to start
 	}
@@ -227,6 +289,7 @@ public:
 		check(DataDeriver);
 		FString CacheKey = FDerivedDataCache::BuildCacheKey(DataDeriver);
 		UE_LOG(LogDerivedDataCache, Verbose, TEXT("GetSynchronous %s"), *CacheKey);
+		RecordRequestedKey(*CacheKey);
 		FAsyncTask<FBuildAsyncWorker> PendingTask(DataDeriver, *CacheKey, true);
 		AddToAsyncCompletionCounter(1);
 		PendingTask.StartSynchronousTask();
@@ -245,6 +308,7 @@ public:
 		uint32 Handle = NextHandle();
 		FString CacheKey = FDerivedDataCache::BuildCacheKey(DataDeriver);
 		UE_LOG(LogDerivedDataCache, Verbose, TEXT("GetAsynchronous %s"), *CacheKey);
+		RecordRequestedKey(*CacheKey);
 		bool bSync = !DataDeriver->IsBuildThreadsafe();
 		FAsyncTask<FBuildAsyncWorker>* AsyncTask = new FAsyncTask<FBuildAsyncWorker>(DataDeriver, *CacheKey, bSync);
 		check(!PendingTasks.Contains(Handle));
@@ -330,6 +394,7 @@ public:
 	{
 		QUICK_SCOPE_CYCLE_COUNTER(STAT_DDC_GetSynchronous_Data);
 		UE_LOG(LogDerivedDataCache, Verbose, TEXT("GetSynchronous %s"), CacheKey);
+		RecordRequestedKey(CacheKey);
 		FAsyncTask<FBuildAsyncWorker> PendingTask((FDerivedDataPluginInterface*)NULL, CacheKey, true);
 		AddToAsyncCompletionCounter(1);
 		PendingTask.StartSynchronousTask();
@@ -343,6 +408,7 @@ public:
 		check(!Rollup); // this needs to be handled by someone else, if rollups are disabled, then it should be NULL
 		FScopeLock ScopeLock(&SynchronizationObject);
 		UE_LOG(LogDerivedDataCache, Verbose, TEXT("GetAsynchronous %s"), CacheKey);
+		RecordRequestedKey(CacheKey);
 		uint32 Handle = NextHandle();
 		FAsyncTask<FBuildAsyncWorker>* AsyncTask = new FAsyncTask<FBuildAsyncWorker>((FDerivedDataPluginInterface*)NULL, CacheKey, false);
 		check(!PendingTasks.Contains(Handle));
@@ -376,6 +442,7 @@ public:
 		STAT(double ThisTime = 0);
 		{
 			SCOPE_SECONDS_COUNTER(ThisTime);
+			ForgetPrefetchedData(CacheKey);
 			FDerivedDataBackend::Get().GetRoot().PutCachedData(CacheKey, Data, bPutEvenIfExists);
 		}
 		INC_FLOAT_STAT_BY(STAT_DDC_PutTime,(float)ThisTime);
@@ -384,23 +451,97 @@ public:
 
 	virtual void MarkTransient(const TCHAR* CacheKey) override
 	{
+		ForgetPrefetchedData(CacheKey);
 		FDerivedDataBackend::Get().GetRoot().RemoveCachedData(CacheKey, /*bTransient=*/ true);
 	}
 
 	virtual bool CachedDataProbablyExists(const TCHAR* CacheKey) override
 	{
 		QUICK_SCOPE_CYCLE_COUNTER(STAT_DDC_CachedDataProbablyExists);
+		RecordRequestedKey(CacheKey);
 		bool bResult;
 		INC_DWORD_STAT(STAT_DDC_NumExist);
 		STAT(double ThisTime = 0);
 		{
 			SCOPE_SECONDS_COUNTER(ThisTime);
-			bResult = FDerivedDataBackend::Get().GetRoot().CachedDataProbablyExists(CacheKey);
+			bool bKnownMiss = false;
+			bResult = HasPrefetchedData(CacheKey, bKnownMiss);
+			if (!bResult && !bKnownMiss)
+			{
+				bResult = FDerivedDataBackend::Get().GetRoot().CachedDataProbablyExists(CacheKey);
+			}
 		}
 		INC_FLOAT_STAT_BY(STAT_DDC_ExistTime, (float)ThisTime);
 		return bResult;
 	}
 
+	virtual TBitArray<> CachedDataProbablyExistsBatch(const TArray<FString>& CacheKeys) override
+	{
+		QUICK_SCOPE_CYCLE_COUNTER(STAT_DDC_CachedDataProbablyExistsBatch);
+		TBitArray<> Result(false, CacheKeys.Num());
+		INC_DWORD_STAT_BY(STAT_DDC_NumExist, CacheKeys.Num());
+		STAT(double ThisTime = 0);
+		{
+			SCOPE_SECONDS_COUNTER(ThisTime);
+
+			// only the keys nothing is known about yet go to the backends
+			TArray<FString> UnknownKeys;
+			TArray<int32> UnknownKeyIndices;
+			for (int32 KeyIndex = 0; KeyIndex < CacheKeys.Num(); ++KeyIndex)
+			{
+				RecordRequestedKey(*CacheKeys[KeyIndex]);
+				bool bKnownMiss = false;
+				if (HasPrefetchedData(*CacheKeys[KeyIndex], bKnownMiss))
+				{
+					Result[KeyIndex] = true;
+				}
+				else if (!bKnownMiss)
+				{
+					UnknownKeys.Add(CacheKeys[KeyIndex]);
+					UnknownKeyIndices.Add(KeyIndex);
+				}
+			}
+
+			if (UnknownKeys.Num())
+			{
+				TBitArray<> UnknownResult = FDerivedDataBackend::Get().GetRoot().CachedDataProbablyExistsBatch(UnknownKeys);
+				for (int32 UnknownIndex = 0; UnknownIndex < UnknownKeys.Num(); ++UnknownIndex)
+				{
+					Result[UnknownKeyIndices[UnknownIndex]] = UnknownResult[UnknownIndex];
+				}
+			}
+		}
+		INC_FLOAT_STAT_BY(STAT_DDC_ExistTime, (float)ThisTime);
+		return Result;
+	}
+
+	virtual void Prefetch(const TArray<FString>& CacheKeys) override
+	{
+		QUICK_SCOPE_CYCLE_COUNTER(STAT_DDC_Prefetch);
+		TArray<FString> KeysToFetch;
+		{
+			FScopeLock ScopeLock(&PrefetchCritical);
+			for (const FString& CacheKey : CacheKeys)
+			{
+				if (!PrefetchedData.Contains(CacheKey) && !PrefetchedMisses.Contains(CacheKey))
+				{
+					KeysToFetch.Add(CacheKey);
+				}
+			}
+		}
+		if (KeysToFetch.Num())
+		{
+			UE_LOG(LogDerivedDataCache, Verbose, TEXT("Prefetch %d keys"), KeysToFetch.Num());
+			AddToAsyncCompletionCounter(1);
+			(new FAutoDeleteAsyncTask<FPrefetchAsyncWorker>(KeysToFetch))->StartBackgroundTask();
+		}
+	}
+
+	virtual void RecordRequestedKeys(TSet<FString>* OutKeys) override
+	{
+		FPlatformTLS::SetTlsValue(GetRecordRequestedKeysTlsSlot(), OutKeys);
+	}
+
 	void NotifyBootComplete() override
 	{
 		QUICK_SCOPE_CYCLE_COUNTER(STAT_DDC_NotifyBootComplete);
@@ -440,6 +581,92 @@ protected:
 		return (uint32)CurrentHandle.Increment();
 	}
 
+	/** 
+	 * Hands prefetched data to the get that asked for it, the data is only kept until then.
+	 * @param	CacheKey	Key to identify the data
+	 * @param	OutData		Receives the prefetched data
+	 * @param	bOutKnownMiss	Set if the prefetch found that the key doesn't exist
+	 * @return	true if data was prefetched for the key
+	**/
+	bool TakePrefetchedData(const FString& CacheKey, TArray<uint8>& OutData, bool& bOutKnownMiss)
+	{
+		FScopeLock ScopeLock(&PrefetchCritical);
+		bOutKnownMiss = PrefetchedMisses.Contains(CacheKey);
+		if (TArray<uint8>* Data = PrefetchedData.Find(CacheKey))
+		{
+			PrefetchedBytes -= Data->Num();
+			OutData = MoveTemp(*Data);
+			PrefetchedData.Remove(CacheKey);
+			return true;
+		}
+		return false;
+	}
+
+	/** Same as TakePrefetchedData, but leaves the data for the get that usually follows. */
+	bool HasPrefetchedData(const TCHAR* CacheKey, bool& bOutKnownMiss)
+	{
+		FScopeLock ScopeLock(&PrefetchCritical);
+		bOutKnownMiss = PrefetchedMisses.Contains(CacheKey);
+		return PrefetchedData.Contains(CacheKey);
+	}
+
+	/** Drops what is known about a key once it is put or removed. */
+	void ForgetPrefetchedData(const TCHAR* CacheKey)
+	{
+		FScopeLock ScopeLock(&PrefetchCritical);
+		PrefetchedMisses.Remove(CacheKey);
+		if (TArray<uint8>* Data = PrefetchedData.Find(CacheKey))
+		{
+			PrefetchedBytes -= Data->Num();
+			PrefetchedData.Remove(CacheKey);
+		}
+	}
+
+	/** Called by the prefetch workers with the results of a batch. */
+	void AddPrefetchedData(const TArray<FString>& CacheKeys, const TBitArray<>& Hits, TArray<TArray<uint8>>& Data)
+	{
+		FScopeLock ScopeLock(&PrefetchCritical);
+		const int64 MaxPrefetchedBytes = int64(FMath::Max(GDDCMaxPrefetchMB, 0)) * 1024 * 1024;
+		for (int32 KeyIndex = 0; KeyIndex < CacheKeys.Num(); ++KeyIndex)
+		{
+			const FString& CacheKey = CacheKeys[KeyIndex];
+			if (!Hits[KeyIndex])
+			{
+				PrefetchedMisses.Add(CacheKey);
+				continue;
+			}
+			if (PrefetchedData.Contains(CacheKey))
+			{
+				continue;
+			}
+
+			// the oldest data is the least likely to still be asked for
+			FString OldestKey;
+			while (PrefetchedBytes + Data[KeyIndex].Num() > MaxPrefetchedBytes && PrefetchedOrder.Dequeue(OldestKey))
+			{
+				if (TArray<uint8>* OldestData = PrefetchedData.Find(OldestKey))
+				{
+					PrefetchedBytes -= OldestData->Num();
+					PrefetchedData.Remove(OldestKey);
+				}
+			}
+			if (PrefetchedBytes + Data[KeyIndex].Num() > MaxPrefetchedBytes)
+			{
+				continue;
+			}
+
+			PrefetchedBytes += Data[KeyIndex].Num();
+			PrefetchedData.Add(CacheKey, MoveTemp(Data[KeyIndex]));
+			PrefetchedOrder.Enqueue(CacheKey);
+		}
+
+		if (!PrefetchedData.Num())
+		{
+			// everything was handed out, don't let the keys of consumed data pile up
+			PrefetchedOrder.Empty();
+		}
+	}
+
 
 private:
 
@@ -461,10 +688,18 @@ private:
 	FCriticalSection			SynchronizationObject;
 	/** Map of handle to pending task **/
 	TMap<uint32,FAsyncTask<FBuildAsyncWorker>*>	PendingTasks;
-};
 
-//Forward reference
-FDerivedDataCache& InternalSingleton();
+	/** Object used to synchronize access to the prefetched data **/
+	FCriticalSection			PrefetchCritical;
+	/** Data fetched by Prefetch that no get asked for yet **/
+	TMap<FString, TArray<uint8>> PrefetchedData;
+	/** Keys of the prefetched data, oldest first. Can contain keys that were handed out already **/
+	TQueue<FString>				PrefetchedOrder;
+	/** Size of the prefetched data **/
+	int64						PrefetchedBytes;
+	/** Keys Prefetch found missing, existence checks for them don't need to go to the backends **/
+	TSet<FString>				PrefetchedMisses;
+};
 
 namespace EPhase
 {
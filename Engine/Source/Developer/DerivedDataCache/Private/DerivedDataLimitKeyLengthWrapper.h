@@ -41,7 +41,7 @@ public:
 	 */
 	virtual bool CachedDataProbablyExists(const TCHAR* CacheKey) override
 	{
-		COOK_STAT(auto Timer = UsageStats.TimeProbablyExists());
+		COOK_STAT(auto Timer = UsageStats.TimeProbablyExists(CacheKey));
 		FString NewKey;
 		ShortenKey(CacheKey, NewKey);
 		bool Result = InnerBackend->CachedDataProbablyExists(*NewKey);
@@ -60,72 +60,54 @@ public:
 	 */
 	virtual bool GetCachedData(const TCHAR* CacheKey, TArray<uint8>& OutData) override
 	{
-		COOK_STAT(auto Timer = UsageStats.TimeGet());
-		int64 InnerGetCycles = 0;
+		COOK_STAT(auto Timer = UsageStats.TimeGet(CacheKey));
 
 		FString NewKey;
-		bool bOk;
-		if (!ShortenKey(CacheKey, NewKey))
+		const bool bShortened = ShortenKey(CacheKey, NewKey);
+		bool bOk = InnerBackend->GetCachedData(*NewKey, OutData);
+		bOk = FixupInnerData(CacheKey, bShortened, NewKey, bOk, OutData);
+		if (bOk)
 		{
-			// no shortening needed
-			bOk = InnerBackend->GetCachedData(CacheKey, OutData);
-			// look for old bug
-			if (FString(CacheKey).StartsWith(TEXT("TEXTURE2D_0002")))
-			{
-				int32 KeyLen = FCString::Strlen(CacheKey) + 1;
-				if (OutData.Num() > KeyLen && OutData.Last() == 0)
-				{
-					int32 Compare = FCStringAnsi::Strcmp(TCHAR_TO_ANSI(CacheKey), (char*)&OutData[OutData.Num() - KeyLen]);
-					if (Compare == 0)
-					{
-						UE_LOG(LogDerivedDataCache, Warning, TEXT("FDerivedDataLimitKeyLengthWrapper: Fixed old bug %s."), CacheKey);
-						OutData.RemoveAt(OutData.Num() - KeyLen, KeyLen);
-					}
-				}
-			}
+			COOK_STAT(Timer.AddHit(OutData.Num()));
 		}
-		else
+		return bOk;
+	}
+
+	virtual TBitArray<> CachedDataProbablyExistsBatch(const TArray<FString>& CacheKeys) override
+	{
+		COOK_STAT(auto Timer = UsageStats.TimeProbablyExists());
+		TArray<FString> NewKeys;
+		NewKeys.SetNum(CacheKeys.Num());
+		for (int32 KeyIndex = 0; KeyIndex < CacheKeys.Num(); ++KeyIndex)
 		{
-			bOk = InnerBackend->GetCachedData(*NewKey, OutData);
-			if (bOk)
-			{
-				int32 KeyLen = FCString::Strlen(CacheKey) + 1;
-				if (OutData.Num() < KeyLen)
-				{
-					UE_LOG(LogDerivedDataCache, Warning, TEXT("FDerivedDataLimitKeyLengthWrapper: Short file or Hash Collision, ignoring and deleting %s."), CacheKey);
-					bOk	= false;
-				}
-				else
-				{
-					int32 Compare = FCStringAnsi::Strcmp(TCHAR_TO_ANSI(CacheKey), (char*)&OutData[OutData.Num() - KeyLen]);
-					OutData.RemoveAt(OutData.Num() - KeyLen, KeyLen);
-					if (Compare == 0)
-					{
-						UE_LOG(LogDerivedDataCache, Verbose, TEXT("FDerivedDataLimitKeyLengthWrapper: cache hit, key match is ok %s"), CacheKey);
-					}
-					else
-					{
-						UE_LOG(LogDerivedDataCache, Warning, TEXT("FDerivedDataLimitKeyLengthWrapper: HASH COLLISION, ignoring and deleting %s."), CacheKey);
-						bOk	= false;
-					}
-				}
-				if (!bOk)
-				{
-					// _we_ detected corruption, so _we_ will force a flush of the corrupted data
-					InnerBackend->RemoveCachedData(*NewKey, /*bTransient=*/ false);
-				}
-			}
+			ShortenKey(*CacheKeys[KeyIndex], NewKeys[KeyIndex]);
 		}
-		if (!bOk)
+		TBitArray<> Result = InnerBackend->CachedDataProbablyExistsBatch(NewKeys);
+		COOK_STAT(if (Result.Find(true) != INDEX_NONE) { Timer.AddHit(0); });
+		return Result;
+	}
+
+	virtual TBitArray<> GetCachedDataBatch(const TArray<FString>& CacheKeys, TArray<TArray<uint8>>& OutData) override
+	{
+		COOK_STAT(auto Timer = UsageStats.TimeGet());
+		TArray<FString> NewKeys;
+		TBitArray<> Shortened(false, CacheKeys.Num());
+		NewKeys.SetNum(CacheKeys.Num());
+		for (int32 KeyIndex = 0; KeyIndex < CacheKeys.Num(); ++KeyIndex)
 		{
-			OutData.Empty();
+			Shortened[KeyIndex] = ShortenKey(*CacheKeys[KeyIndex], NewKeys[KeyIndex]);
 		}
-		else
+		TBitArray<> Result = InnerBackend->GetCachedDataBatch(NewKeys, OutData);
+		int64 HitBytes = 0;
+		for (int32 KeyIndex = 0; KeyIndex < CacheKeys.Num(); ++KeyIndex)
 		{
-			COOK_STAT(Timer.AddHit(OutData.Num()));
+			Result[KeyIndex] = FixupInnerData(*CacheKeys[KeyIndex], Shortened[KeyIndex], NewKeys[KeyIndex], Result[KeyIndex], OutData[KeyIndex]);
+			HitBytes += OutData[KeyIndex].Num();
 		}
-		return bOk;
+		COOK_STAT(if (Result.Find(true) != INDEX_NONE) { Timer.AddHit(HitBytes); });
+		return Result;
 	}
+
 	/**
 	 * Asynchronous, fire-and-forget placement of a cache item
 	 *
@@ -135,7 +117,7 @@ public:
 	 */
 	virtual void PutCachedData(const TCHAR* CacheKey, TArray<uint8>& InData, bool bPutEvenIfExists) override
 	{
-		COOK_STAT(auto Timer = UsageStats.TimePut());
+		COOK_STAT(auto Timer = UsageStats.TimePut(CacheKey));
 		if (!InnerBackend->IsWritable())
 		{
 			return; // no point in continuing down the chain
@@ -213,6 +195,71 @@ private:
 		return true;
 	}
 
+	/**
+	 * Strips and verifies the full key stored with the data of a shortened key
+	 *
+	 * @param	CacheKey	Key the data was asked for with
+	 * @param	bShortened	Whether the inner backend was asked with a shortened key
+	 * @param	NewKey		Key the inner backend was asked with
+	 * @param	bInnerOk	Whether the inner backend found the data
+	 * @param	Data		Data returned by the inner backend, emptied if it can't be used
+	 * @return				true if the data can be used
+	 */
+	bool FixupInnerData(const TCHAR* CacheKey, bool bShortened, const FString& NewKey, bool bInnerOk, TArray<uint8>& Data)
+	{
+		bool bOk = bInnerOk;
+		if (!bShortened)
+		{
+			// look for old bug
+			if (bOk && FString(CacheKey).StartsWith(TEXT("TEXTURE2D_0002")))
+			{
+				int32 KeyLen = FCString::Strlen(CacheKey) + 1;
+				if (Data.Num() > KeyLen && Data.Last() == 0)
+				{
+					int32 Compare = FCStringAnsi::Strcmp(TCHAR_TO_ANSI(CacheKey), (char*)&Data[Data.Num() - KeyLen]);
+					if (Compare == 0)
+					{
+						UE_LOG(LogDerivedDataCache, Warning, TEXT("FDerivedDataLimitKeyLengthWrapper: Fixed old bug %s."), CacheKey);
+						Data.RemoveAt(Data.Num() - KeyLen, KeyLen);
+					}
+				}
+			}
+		}
+		else if (bOk)
+		{
+			int32 KeyLen = FCString::Strlen(CacheKey) + 1;
+			if (Data.Num() < KeyLen)
+			{
+				UE_LOG(LogDerivedDataCache, Warning, TEXT("FDerivedDataLimitKeyLengthWrapper: Short file or Hash Collision, ignoring and deleting %s."), CacheKey);
+				bOk	= false;
+			}
+			else
+			{
+				int32 Compare = FCStringAnsi::Strcmp(TCHAR_TO_ANSI(CacheKey), (char*)&Data[Data.Num() - KeyLen]);
+				Data.RemoveAt(Data.Num() - KeyLen, KeyLen);
+				if (Compare == 0)
+				{
+					UE_LOG(LogDerivedDataCache, Verbose, TEXT("FDerivedDataLimitKeyLengthWrapper: cache hit, key match is ok %s"), CacheKey);
+				}
+				else
+				{
+					UE_LOG(LogDerivedDataCache, Warning, TEXT("FDerivedDataLimitKeyLengthWrapper: HASH COLLISION, ignoring and deleting %s."), CacheKey);
+					bOk	= false;
+				}
+			}
+			if (!bOk)
+			{
+				// _we_ detected corruption, so _we_ will force a flush of the corrupted data
+				InnerBackend->RemoveCachedData(*NewKey, /*bTransient=*/ false);
+			}
+		}
+		if (!bOk)
+		{
+			Data.Empty();
+		}
+		return bOk;
+	}
+
 	/** Backend to use for storage, my responsibilities are about key length **/
 	FDerivedDataBackendInterface* InnerBackend;
 
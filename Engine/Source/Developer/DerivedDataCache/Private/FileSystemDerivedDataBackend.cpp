@@ -8,6 +8,10 @@
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "Misc/Guid.h"
+#include "Async/ParallelFor.h"
+#include "Misc/SecureHash.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
 
 #include "DerivedDataBackendInterface.h"
 #include "DDCCleanup.h"
@@ -24,6 +28,64 @@
 	#define MAX_CACHE_DIR_LEN (119)
 #endif // PLATFORM_LINUX
 #define MAX_CACHE_EXTENTION_LEN (4)
+/** Payloads smaller than this are stored in the key file even in the content addressed layout, a second file would cost more than it saves */
+#define MIN_CONTENT_ADDRESSED_PAYLOAD_SIZE (4096)
+
+/**
+ * Key file of the content addressed layout, points at the file holding the payload which is named after its hash
+ * and shared by all the keys that produced the same payload.
+ */
+struct FContentAddressedPointer
+{
+	enum
+	{
+		MagicConstant = 0x43444443, // 'CDDC'
+		CurrentVersion = 1,
+		/** Serialized size, a key file of this size is checked for the magic */
+		SerializedSize = 4 + 4 + FSHA1::DigestSize + 8,
+	};
+
+	uint32 Magic;
+	uint32 Version;
+	uint8 Hash[FSHA1::DigestSize];
+	int64 PayloadSize;
+
+	FContentAddressedPointer()
+		: Magic(0)
+		, Version(0)
+		, PayloadSize(0)
+	{
+		FMemory::Memzero(Hash);
+	}
+
+	explicit FContentAddressedPointer(const TArray<uint8>& Payload)
+		: Magic(MagicConstant)
+		, Version(CurrentVersion)
+		, PayloadSize(Payload.Num())
+	{
+		FSHA1::HashBuffer(Payload.GetData(), Payload.Num(), Hash);
+	}
+
+	friend FArchive& operator<<(FArchive& Ar, FContentAddressedPointer& Pointer)
+	{
+		Ar << Pointer.Magic << Pointer.Version;
+		Ar.Serialize(Pointer.Hash, sizeof(Pointer.Hash));
+		Ar << Pointer.PayloadSize;
+		return Ar;
+	}
+
+	/** @return true if the contents of a key file are a pointer rather than the payload itself */
+	static bool Parse(const TArray<uint8>& KeyFileData, FContentAddressedPointer& OutPointer)
+	{
+		if (KeyFileData.Num() != SerializedSize)
+		{
+			return false;
+		}
+		FMemoryReader Reader(KeyFileData);
+		Reader << OutPointer;
+		return OutPointer.Magic == MagicConstant && OutPointer.Version == CurrentVersion;
+	}
+};
 
 
 
@@ -40,12 +102,13 @@ public:
 	 * @param InCacheDirectory	directory to store the cache in
 	 * @param bForceReadOnly	if true, do not attempt to write to this cache
 	*/
-	FFileSystemDerivedDataBackend(const TCHAR* InCacheDirectory, bool bForceReadOnly, bool bTouchFiles, bool bPurgeTransientData, bool bDeleteOldFiles, int32 InDaysToDeleteUnusedFiles, int32 InMaxNumFoldersToCheck, int32 InMaxContinuousFileChecks)
+	FFileSystemDerivedDataBackend(const TCHAR* InCacheDirectory, bool bForceReadOnly, bool bTouchFiles, bool bPurgeTransientData, bool bDeleteOldFiles, int32 InDaysToDeleteUnusedFiles, int32 InMaxNumFoldersToCheck, int32 InMaxContinuousFileChecks, bool bInContentAddressed)
 		: CachePath(InCacheDirectory)
 		, bReadOnly(bForceReadOnly)
 		, bFailed(true)
 		, bTouch(bTouchFiles)
 		, bPurgeTransient(bPurgeTransientData)
+		, bContentAddressed(bInContentAddressed)
 		, DaysToDeleteUnusedFiles(InDaysToDeleteUnusedFiles)
 	{
 		// If we find a platform that has more stingent limits, this needs to be rethought.
@@ -112,6 +175,11 @@ public:
 			UE_LOG(LogDerivedDataCache, Display, TEXT("Files in %s will be touched."),*CachePath);
 		}
 
+		if (bContentAddressed && !bReadOnly)
+		{
+			UE_LOG(LogDerivedDataCache, Display, TEXT("Payloads put to %s will be stored once per content hash."),*CachePath);
+		}
+
 		if (!bFailed && AccessDuration > SlowInitDuration && !GIsBuildMachine)
 		{
 			UE_LOG(LogDerivedDataCache, Warning, TEXT("%s access is very slow (initialization took %.2lf seconds), consider disabling it."), *CachePath, AccessDuration);
@@ -142,7 +210,7 @@ public:
 	 */
 	virtual bool CachedDataProbablyExists(const TCHAR* CacheKey) override
 	{
-		COOK_STAT(auto Timer = UsageStats.TimeProbablyExists());
+		COOK_STAT(auto Timer = UsageStats.TimeProbablyExists(CacheKey));
 		check(!bFailed);
 		FString Filename = BuildFilename(CacheKey);
 		FDateTime TimeStamp = IFileManager::Get().GetTimeStamp(*Filename);
@@ -154,6 +222,7 @@ public:
 				 (!bReadOnly && (FDateTime::UtcNow() - TimeStamp).GetDays() > (DaysToDeleteUnusedFiles / 4)))
 			{
 				IFileManager::Get().SetTimeStamp(*Filename, FDateTime::UtcNow());
+				TouchContent(Filename);
 			}
 		}
 		if (bExists)
@@ -171,11 +240,11 @@ public:
 	 */
 	virtual bool GetCachedData(const TCHAR* CacheKey, TArray<uint8>& Data) override
 	{
-		COOK_STAT(auto Timer = UsageStats.TimeGet());
+		COOK_STAT(auto Timer = UsageStats.TimeGet(CacheKey));
 		check(!bFailed);
 		FString Filename = BuildFilename(CacheKey);
 		double StartTime = FPlatformTime::Seconds();
-		if (FFileHelper::LoadFileToArray(Data,*Filename,FILEREAD_Silent))
+		if (FFileHelper::LoadFileToArray(Data,*Filename,FILEREAD_Silent) && LoadContent(Filename, Data))
 		{
 			if(!GIsBuildMachine)
 			{
@@ -193,6 +262,43 @@ public:
 		Data.Empty();
 		return false;
 	}
+	/** Batched CachedDataProbablyExists, the file system round trips of the keys overlap which matters most on shared caches */
+	virtual TBitArray<> CachedDataProbablyExistsBatch(const TArray<FString>& CacheKeys) override
+	{
+		TArray<bool> Exists;
+		Exists.SetNumZeroed(CacheKeys.Num());
+		ParallelFor(CacheKeys.Num(), [this, &CacheKeys, &Exists](int32 KeyIndex)
+		{
+			Exists[KeyIndex] = CachedDataProbablyExists(*CacheKeys[KeyIndex]);
+		});
+
+		TBitArray<> Result(false, CacheKeys.Num());
+		for (int32 KeyIndex = 0; KeyIndex < CacheKeys.Num(); ++KeyIndex)
+		{
+			Result[KeyIndex] = Exists[KeyIndex];
+		}
+		return Result;
+	}
+
+	/** Batched GetCachedData, the files are read in parallel */
+	virtual TBitArray<> GetCachedDataBatch(const TArray<FString>& CacheKeys, TArray<TArray<uint8>>& OutData) override
+	{
+		TArray<bool> Found;
+		Found.SetNumZeroed(CacheKeys.Num());
+		OutData.Reset();
+		OutData.SetNum(CacheKeys.Num());
+		ParallelFor(CacheKeys.Num(), [this, &CacheKeys, &Found, &OutData](int32 KeyIndex)
+		{
+			Found[KeyIndex] = GetCachedData(*CacheKeys[KeyIndex], OutData[KeyIndex]);
+		});
+
+		TBitArray<> Result(false, CacheKeys.Num());
+		for (int32 KeyIndex = 0; KeyIndex < CacheKeys.Num(); ++KeyIndex)
+		{
+			Result[KeyIndex] = Found[KeyIndex];
+		}
+		return Result;
+	}
 	/**
 	 * Asynchronous, fire-and-forget placement of a cache item
 	 *
@@ -202,7 +308,7 @@ public:
 	 */
 	virtual void PutCachedData(const TCHAR* CacheKey, TArray<uint8>& Data, bool bPutEvenIfExists) override
 	{
-		COOK_STAT(auto Timer = UsageStats.TimePut());
+		COOK_STAT(auto Timer = UsageStats.TimePut(CacheKey));
 		check(!bFailed);
 		if (!bReadOnly)
 		{
@@ -210,17 +316,29 @@ public:
 			{
 				COOK_STAT(Timer.AddHit(Data.Num()));
 				check(Data.Num());
+
+				// in the content addressed layout the key file only points at the payload, which is stored once for all keys
+				TArray<uint8> PointerData;
+				if (bContentAddressed && Data.Num() >= MIN_CONTENT_ADDRESSED_PAYLOAD_SIZE)
+				{
+					if (!PutContent(Data, PointerData))
+					{
+						return;
+					}
+				}
+				const TArray<uint8>& FileData = PointerData.Num() ? PointerData : Data;
+
 				FString Filename = BuildFilename(CacheKey);
 				FString TempFilename(TEXT("temp.")); 
 				TempFilename += FGuid::NewGuid().ToString();
 				TempFilename = FPaths::GetPath(Filename) / TempFilename;
 				bool bResult;
 				{
-					bResult = FFileHelper::SaveArrayToFile(Data, *TempFilename);
+					bResult = FFileHelper::SaveArrayToFile(FileData, *TempFilename);
 				}
 				if (bResult)
 				{
-					if (IFileManager::Get().FileSize(*TempFilename) == Data.Num())
+					if (IFileManager::Get().FileSize(*TempFilename) == FileData.Num())
 					{
 						bool DoMove = !CachedDataProbablyExists(CacheKey);
 						if (bPutEvenIfExists && !DoMove)
@@ -299,6 +417,116 @@ private:
 		return CachePath / HashPath / Key + TEXT(".udd");
 	}
 
+	/**
+	 * Threadsafe method to compute the filename of a payload in the content addressed layout. The payloads are kept in a
+	 * separate tree of 1000 directories so the cleanup can tell them apart from key files.
+	 *
+	 * @param	Pointer		Pointer to the payload
+	 * @return				filename built from the hash of the payload
+	 */
+	FString BuildContentFilename(const FContentAddressedPointer& Pointer)
+	{
+		const uint32 Hash = *(const uint32*)Pointer.Hash;
+		FString HashPath = FString::Printf(TEXT("%1d/%1d/%1d/"),(Hash/100)%10,(Hash/10)%10,Hash%10);
+		return CachePath / TEXT("Content") / HashPath / BytesToHex(Pointer.Hash, FSHA1::DigestSize) + TEXT(".udd");
+	}
+
+	/**
+	 * Stores a payload under its hash unless it is there already.
+	 *
+	 * @param	Data			Payload to store
+	 * @param	OutPointerData	Receives the contents of the key file pointing at the payload
+	 * @return					true if the payload is stored
+	 */
+	bool PutContent(const TArray<uint8>& Data, TArray<uint8>& OutPointerData)
+	{
+		FContentAddressedPointer Pointer(Data);
+		const FString ContentFilename = BuildContentFilename(Pointer);
+
+		if (IFileManager::Get().FileSize(*ContentFilename) == Data.Num())
+		{
+			// another key produced the same payload, it is in use again so it must not be cleaned up
+			IFileManager::Get().SetTimeStamp(*ContentFilename, FDateTime::UtcNow());
+		}
+		else
+		{
+			FString TempFilename = FPaths::GetPath(ContentFilename) / TEXT("temp.") + FGuid::NewGuid().ToString();
+			const bool bSaved = FFileHelper::SaveArrayToFile(Data, *TempFilename) && IFileManager::Get().FileSize(*TempFilename) == Data.Num();
+			if (bSaved && !IFileManager::Get().Move(*ContentFilename, *TempFilename, true, true, false, true))
+			{
+				UE_LOG(LogDerivedDataCache, Log, TEXT("FFileSystemDerivedDataBackend: Move collision, attempt at redundant update, OK %s."),*ContentFilename);
+			}
+			if (FPaths::FileExists(TempFilename))
+			{
+				IFileManager::Get().Delete(*TempFilename, false, false, true);
+			}
+			if (IFileManager::Get().FileSize(*ContentFilename) != Data.Num())
+			{
+				UE_LOG(LogDerivedDataCache, Warning, TEXT("FFileSystemDerivedDataBackend: Could not write content file %s!"),*ContentFilename);
+				return false;
+			}
+		}
+
+		FMemoryWriter Writer(OutPointerData);
+		Writer << Pointer;
+		return true;
+	}
+
+	/**
+	 * Replaces the contents of a key file with the payload it points at, if it is a pointer. Key files of either layout
+	 * are read regardless of the ContentAddressed setting, so caches can be switched over without being flushed.
+	 *
+	 * @param	Filename	Key file the data was read from
+	 * @param	Data		Contents of the key file, receives the payload
+	 * @return				false if the key file points at a payload that is missing or damaged
+	 */
+	bool LoadContent(const FString& Filename, TArray<uint8>& Data)
+	{
+		FContentAddressedPointer Pointer;
+		if (!FContentAddressedPointer::Parse(Data, Pointer))
+		{
+			return true;
+		}
+
+		const FString ContentFilename = BuildContentFilename(Pointer);
+		if (!FFileHelper::LoadFileToArray(Data, *ContentFilename, FILEREAD_Silent) || Data.Num() != Pointer.PayloadSize)
+		{
+			UE_LOG(LogDerivedDataCache, Verbose, TEXT("FFileSystemDerivedDataBackend: %s points at missing content %s"),*Filename,*ContentFilename);
+			if (!bReadOnly)
+			{
+				// the payload was cleaned up, drop the dangling pointer so the data is put again
+				IFileManager::Get().Delete(*Filename, false, false, true);
+			}
+			Data.Empty();
+			return false;
+		}
+
+		if (bTouch || (!bReadOnly && (FDateTime::UtcNow() - IFileManager::Get().GetTimeStamp(*ContentFilename)).GetDays() > (DaysToDeleteUnusedFiles / 4)))
+		{
+			IFileManager::Get().SetTimeStamp(*ContentFilename, FDateTime::UtcNow());
+		}
+		return true;
+	}
+
+	/**
+	 * Touches the payload a key file points at, keeps it at least as recent as the keys using it for the cleanup.
+	 *
+	 * @param	Filename	Key file that was touched
+	 */
+	void TouchContent(const FString& Filename)
+	{
+		if (IFileManager::Get().FileSize(*Filename) != FContentAddressedPointer::SerializedSize)
+		{
+			return;
+		}
+		TArray<uint8> KeyFileData;
+		FContentAddressedPointer Pointer;
+		if (FFileHelper::LoadFileToArray(KeyFileData, *Filename, FILEREAD_Silent) && FContentAddressedPointer::Parse(KeyFileData, Pointer))
+		{
+			IFileManager::Get().SetTimeStamp(*BuildContentFilename(Pointer), FDateTime::UtcNow());
+		}
+	}
+
 	/** Base path we are storing the cache files in. **/
 	FString	CachePath;
 	/** If true, do not attempt to write to this cache **/
@@ -309,13 +537,15 @@ private:
 	bool		bTouch;
 	/** If true, allow transient data to be removed from the cache. */
 	bool		bPurgeTransient;
+	/** If true, payloads are put once per content hash and the key files point at them. */
+	bool		bContentAddressed;
 	/** Age of file when it should be deleted from DDC cache. */
 	int32		DaysToDeleteUnusedFiles;
 };
 
-FDerivedDataBackendInterface* CreateFileSystemDerivedDataBackend(const TCHAR* CacheDirectory, bool bForceReadOnly /*= false*/, bool bTouchFiles /*= false*/, bool bPurgeTransient /*= false*/, bool bDeleteOldFiles /*= false*/, int32 InDaysToDeleteUnusedFiles /*= 60*/, int32 InMaxNumFoldersToCheck /*= -1*/, int32 InMaxContinuousFileChecks /*= -1*/)
+FDerivedDataBackendInterface* CreateFileSystemDerivedDataBackend(const TCHAR* CacheDirectory, bool bForceReadOnly /*= false*/, bool bTouchFiles /*= false*/, bool bPurgeTransient /*= false*/, bool bDeleteOldFiles /*= false*/, int32 InDaysToDeleteUnusedFiles /*= 60*/, int32 InMaxNumFoldersToCheck /*= -1*/, int32 InMaxContinuousFileChecks /*= -1*/, bool bContentAddressed /*= false*/)
 {
-	FFileSystemDerivedDataBackend* FileDDB = new FFileSystemDerivedDataBackend(CacheDirectory, bForceReadOnly, bTouchFiles, bPurgeTransient, bDeleteOldFiles, InDaysToDeleteUnusedFiles, InMaxNumFoldersToCheck, InMaxContinuousFileChecks);
+	FFileSystemDerivedDataBackend* FileDDB = new FFileSystemDerivedDataBackend(CacheDirectory, bForceReadOnly, bTouchFiles, bPurgeTransient, bDeleteOldFiles, InDaysToDeleteUnusedFiles, InMaxNumFoldersToCheck, InMaxContinuousFileChecks, bContentAddressed);
 	if (!FileDDB->IsUsable())
 	{
 		delete FileDDB;
@@ -81,7 +81,7 @@ public:
 	 */
 	virtual bool CachedDataProbablyExists(const TCHAR* CacheKey) override
 	{
-		COOK_STAT(auto Timer = UsageStats.TimeProbablyExists());
+		COOK_STAT(auto Timer = UsageStats.TimeProbablyExists(CacheKey));
 		for (int32 CacheIndex = 0; CacheIndex < InnerBackends.Num(); CacheIndex++)
 		{
 			if (InnerBackends[CacheIndex]->CachedDataProbablyExists(CacheKey))
@@ -101,52 +101,90 @@ public:
 	 */
 	virtual bool GetCachedData(const TCHAR* CacheKey, TArray<uint8>& OutData) override
 	{
-		COOK_STAT(auto Timer = UsageStats.TimeGet());
+		COOK_STAT(auto Timer = UsageStats.TimeGet(CacheKey));
 		for (int32 CacheIndex = 0; CacheIndex < InnerBackends.Num(); CacheIndex++)
 		{
 			if (InnerBackends[CacheIndex]->CachedDataProbablyExists(CacheKey) && InnerBackends[CacheIndex]->GetCachedData(CacheKey, OutData))
 			{
-				if (bIsWritable)
-				{
-					// fill in the higher level caches
-					for (int32 PutCacheIndex = CacheIndex - 1; PutCacheIndex >= 0; PutCacheIndex--)
-					{
-						if (InnerBackends[PutCacheIndex]->IsWritable())
-						{
-							if (InnerBackends[PutCacheIndex]->BackfillLowerCacheLevels() &&
-								InnerBackends[PutCacheIndex]->CachedDataProbablyExists(CacheKey))
-							{
-								InnerBackends[PutCacheIndex]->RemoveCachedData(CacheKey, /*bTransient=*/ false); // it apparently failed, so lets delete what is there
-								AsyncPutInnerBackends[PutCacheIndex]->PutCachedData(CacheKey, OutData, true); // we force a put here because it must have failed
-							}
-							else
-							{
-								AsyncPutInnerBackends[PutCacheIndex]->PutCachedData(CacheKey, OutData, false); 
-							}
-						}
-					}
-					if (InnerBackends[CacheIndex]->BackfillLowerCacheLevels())
-					{
-						// fill in the lower level caches
-						for (int32 PutCacheIndex = CacheIndex + 1; PutCacheIndex < AsyncPutInnerBackends.Num(); PutCacheIndex++)
-						{
-							if (!InnerBackends[PutCacheIndex]->IsWritable() && !InnerBackends[PutCacheIndex]->BackfillLowerCacheLevels() && InnerBackends[PutCacheIndex]->CachedDataProbablyExists(CacheKey))
-							{
-								break; //do not write things that are already in the read only pak file
-							}
-							if (InnerBackends[PutCacheIndex]->IsWritable())
-							{
-								AsyncPutInnerBackends[PutCacheIndex]->PutCachedData(CacheKey, OutData, false); // we do not need to force a put here
-							}
-						}
-					}
-				}
+				PropagateHit(CacheIndex, CacheKey, OutData);
 				COOK_STAT(Timer.AddHit(OutData.Num()));
 				return true;
 			}
 		}
 		return false;
 	}
+
+	/** Batched CachedDataProbablyExists, each level is asked about all the keys it has to answer at once */
+	virtual TBitArray<> CachedDataProbablyExistsBatch(const TArray<FString>& CacheKeys) override
+	{
+		COOK_STAT(auto Timer = UsageStats.TimeProbablyExists());
+		COOK_STAT(const double StartTime = FPlatformTime::Seconds());
+		TBitArray<> Result(false, CacheKeys.Num());
+		TArray<FString> RemainingKeys(CacheKeys);
+		TArray<int32> RemainingKeyIndices;
+		for (int32 KeyIndex = 0; KeyIndex < CacheKeys.Num(); ++KeyIndex)
+		{
+			RemainingKeyIndices.Add(KeyIndex);
+		}
+
+		// every level is only asked about the keys the faster levels didn't have
+		for (int32 CacheIndex = 0; CacheIndex < InnerBackends.Num() && RemainingKeys.Num(); CacheIndex++)
+		{
+			TBitArray<> LevelResult = InnerBackends[CacheIndex]->CachedDataProbablyExistsBatch(RemainingKeys);
+			for (int32 RemainingIndex = RemainingKeys.Num() - 1; RemainingIndex >= 0; --RemainingIndex)
+			{
+				if (LevelResult[RemainingIndex])
+				{
+					Result[RemainingKeyIndices[RemainingIndex]] = true;
+					RemainingKeys.RemoveAt(RemainingIndex, 1, false);
+					RemainingKeyIndices.RemoveAt(RemainingIndex, 1, false);
+				}
+			}
+		}
+		COOK_STAT(if (RemainingKeys.Num() < CacheKeys.Num()) { Timer.AddHit(0); });
+		COOK_STAT(UsageStats.Telemetry->RecordBatch(FDerivedDataCacheTelemetry::ECall::Exists, CacheKeys, Result, nullptr, FPlatformTime::Seconds() - StartTime));
+		return Result;
+	}
+
+	/** Batched GetCachedData, hits are propagated to the other levels like single gets do */
+	virtual TBitArray<> GetCachedDataBatch(const TArray<FString>& CacheKeys, TArray<TArray<uint8>>& OutData) override
+	{
+		COOK_STAT(auto Timer = UsageStats.TimeGet());
+		COOK_STAT(const double StartTime = FPlatformTime::Seconds());
+		TBitArray<> Result(false, CacheKeys.Num());
+		OutData.Reset();
+		OutData.SetNum(CacheKeys.Num());
+		TArray<FString> RemainingKeys(CacheKeys);
+		TArray<int32> RemainingKeyIndices;
+		for (int32 KeyIndex = 0; KeyIndex < CacheKeys.Num(); ++KeyIndex)
+		{
+			RemainingKeyIndices.Add(KeyIndex);
+		}
+
+		int64 HitBytes = 0;
+		for (int32 CacheIndex = 0; CacheIndex < InnerBackends.Num() && RemainingKeys.Num(); CacheIndex++)
+		{
+			TArray<TArray<uint8>> LevelData;
+			TBitArray<> LevelResult = InnerBackends[CacheIndex]->GetCachedDataBatch(RemainingKeys, LevelData);
+			for (int32 RemainingIndex = RemainingKeys.Num() - 1; RemainingIndex >= 0; --RemainingIndex)
+			{
+				if (LevelResult[RemainingIndex])
+				{
+					const int32 KeyIndex = RemainingKeyIndices[RemainingIndex];
+					OutData[KeyIndex] = MoveTemp(LevelData[RemainingIndex]);
+					PropagateHit(CacheIndex, *RemainingKeys[RemainingIndex], OutData[KeyIndex]);
+					HitBytes += OutData[KeyIndex].Num();
+					Result[KeyIndex] = true;
+					RemainingKeys.RemoveAt(RemainingIndex, 1, false);
+					RemainingKeyIndices.RemoveAt(RemainingIndex, 1, false);
+				}
+			}
+		}
+		COOK_STAT(if (RemainingKeys.Num() < CacheKeys.Num()) { Timer.AddHit(HitBytes); });
+		COOK_STAT(UsageStats.Telemetry->RecordBatch(FDerivedDataCacheTelemetry::ECall::Get, CacheKeys, Result, &OutData, FPlatformTime::Seconds() - StartTime));
+		return Result;
+	}
+
 	/**
 	 * Asynchronous, fire-and-forget placement of a cache item
 	 *
@@ -156,7 +194,7 @@ public:
 	 */
 	virtual void PutCachedData(const TCHAR* CacheKey, TArray<uint8>& InData, bool bPutEvenIfExists) override
 	{
-		COOK_STAT(auto Timer = UsageStats.TimePut());
+		COOK_STAT(auto Timer = UsageStats.TimePut(CacheKey));
 		if (!bIsWritable)
 		{
 			return; // no point in continuing down the chain
@@ -222,6 +260,52 @@ public:
 	}
 
 private:
+	/**
+	 * Fills in the other cache levels after a hit
+	 *
+	 * @param	CacheIndex	Level the data was found in
+	 * @param	CacheKey	Alphanumeric+underscore key of this cache item
+	 * @param	Data		The data that was found
+	 */
+	void PropagateHit(int32 CacheIndex, const TCHAR* CacheKey, TArray<uint8>& Data)
+	{
+		if (bIsWritable)
+		{
+			// fill in the higher level caches
+			for (int32 PutCacheIndex = CacheIndex - 1; PutCacheIndex >= 0; PutCacheIndex--)
+			{
+				if (InnerBackends[PutCacheIndex]->IsWritable())
+				{
+					if (InnerBackends[PutCacheIndex]->BackfillLowerCacheLevels() &&
+						InnerBackends[PutCacheIndex]->CachedDataProbablyExists(CacheKey))
+					{
+						InnerBackends[PutCacheIndex]->RemoveCachedData(CacheKey, /*bTransient=*/ false); // it apparently failed, so lets delete what is there
+						AsyncPutInnerBackends[PutCacheIndex]->PutCachedData(CacheKey, Data, true); // we force a put here because it must have failed
+					}
+					else
+					{
+						AsyncPutInnerBackends[PutCacheIndex]->PutCachedData(CacheKey, Data, false); 
+					}
+				}
+			}
+			if (InnerBackends[CacheIndex]->BackfillLowerCacheLevels())
+			{
+				// fill in the lower level caches
+				for (int32 PutCacheIndex = CacheIndex + 1; PutCacheIndex < AsyncPutInnerBackends.Num(); PutCacheIndex++)
+				{
+					if (!InnerBackends[PutCacheIndex]->IsWritable() && !InnerBackends[PutCacheIndex]->BackfillLowerCacheLevels() && InnerBackends[PutCacheIndex]->CachedDataProbablyExists(CacheKey))
+					{
+						break; //do not write things that are already in the read only pak file
+					}
+					if (InnerBackends[PutCacheIndex]->IsWritable())
+					{
+						AsyncPutInnerBackends[PutCacheIndex]->PutCachedData(CacheKey, Data, false); // we do not need to force a put here
+					}
+				}
+			}
+		}
+	}
+
 	FDerivedDataCacheUsageStats UsageStats;
 
 	/** Array of backends forming the hierarchical cache...the first element is the fastest cache. **/
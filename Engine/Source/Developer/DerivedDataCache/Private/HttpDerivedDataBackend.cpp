@@ -0,0 +1,536 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/Compression.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Containers/ArrayView.h"
+
+#include "DerivedDataBackendInterface.h"
+
+#include "ProfilingDebugging/CookStats.h"
+#include "DerivedDataCacheUsageStats.h"
+
+#if WITH_LIBCURL
+
+#if PLATFORM_WINDOWS
+#include "WindowsHWrapper.h"
+#include "AllowWindowsPlatformTypes.h"
+#endif
+	#include "curl/curl.h"
+#if PLATFORM_WINDOWS
+#include "HideWindowsPlatformTypes.h"
+#endif
+
+/** Requests that failed to connect in a row before the backend stops talking to the service. */
+#define MAX_HTTP_DDC_CONNECTION_FAILURES (8)
+
+/**
+ * Cache server that talks to a shared cache service over HTTP.
+ *
+ * Every cache item is a resource under <ServiceUrl>/<Namespace>/<CacheKey> that is read with GET, probed with HEAD,
+ * written with PUT and removed with DELETE, so the service can be any web server or object store with a REST front end.
+ * Batched calls run all of their requests at once on a multi handle, so they share connections and are pipelined
+ * (or multiplexed over HTTP/2) instead of paying a round trip per key. Responses are accepted gzip or deflate encoded
+ * and uploads are sent deflate encoded when that makes them smaller.
+ *
+ * The entire API should be callable from any thread (except the singleton can be assumed to be called at least once before concurrent access).
+**/
+class FHttpDerivedDataBackend : public FDerivedDataBackendInterface
+{
+public:
+	/**
+	 * Constructor
+	 *
+	 * @param	InServiceUrl				Base url of the service, for example http://ddc.mystudio.net:8080
+	 * @param	InNamespace					Namespace of this project on the service, keeps unrelated projects apart
+	 * @param	bForceReadOnly				If true, do not attempt to write to this cache
+	 * @param	InMaxConnections			Maximum number of connections to the service a batch can open
+	 * @param	InTimeoutSeconds			Seconds a single request may take before it counts as a failure
+	 */
+	FHttpDerivedDataBackend(const TCHAR* InServiceUrl, const TCHAR* InNamespace, bool bForceReadOnly, int32 InMaxConnections, int32 InTimeoutSeconds)
+		: ServiceUrl(InServiceUrl)
+		, bReadOnly(bForceReadOnly)
+		, bFailed(true)
+		, MaxConnections(FMath::Max(InMaxConnections, 1))
+		, TimeoutSeconds(FMath::Max(InTimeoutSeconds, 1))
+	{
+		// reference counted by libcurl, the HTTP module may or may not have initialized it already
+		curl_global_init(CURL_GLOBAL_ALL);
+
+		ServiceUrl.RemoveFromEnd(TEXT("/"));
+		BaseUrl = FString::Printf(TEXT("%s/%s/"), *ServiceUrl, InNamespace);
+
+		// make sure the service answers before it is put in the graph, any status code will do
+		FRequest Probe(TEXT(""), nullptr);
+		Probe.Url = ServiceUrl + TEXT("/");
+		Probe.bHeadOnly = true;
+		const double StartTime = FPlatformTime::Seconds();
+		PerformRequests(MakeArrayView(&Probe, 1));
+		if (Probe.Result == CURLE_OK)
+		{
+			bFailed = false;
+			UE_CLOG(FPlatformTime::Seconds() - StartTime > 1.0, LogDerivedDataCache, Warning, TEXT("%s is slow to respond (%.2lf seconds), consider disabling it."), *ServiceUrl, FPlatformTime::Seconds() - StartTime);
+		}
+		else
+		{
+			UE_LOG(LogDerivedDataCache, Warning, TEXT("FHttpDerivedDataBackend: Unable to reach %s (%s)."), *ServiceUrl, ANSI_TO_TCHAR(curl_easy_strerror(Probe.Result)));
+		}
+	}
+
+	~FHttpDerivedDataBackend()
+	{
+		{
+			FScopeLock ScopeLock(&MultiHandlesCritical);
+			for (CURLM* MultiHandle : FreeMultiHandles)
+			{
+				curl_multi_cleanup(MultiHandle);
+			}
+			FreeMultiHandles.Empty();
+		}
+		curl_global_cleanup();
+	}
+
+	/** return true if the cache is usable **/
+	bool IsUsable()
+	{
+		return !bFailed;
+	}
+
+	/** return true if this cache is writable **/
+	virtual bool IsWritable() override
+	{
+		return !bReadOnly && IsReachable();
+	}
+
+	/**
+	 * Synchronous test for the existence of a cache item
+	 *
+	 * @param	CacheKey	Alphanumeric+underscore key of this cache item
+	 * @return				true if the data probably will be found, this can't be guaranteed because of concurrency in the backends, corruption, etc
+	 */
+	virtual bool CachedDataProbablyExists(const TCHAR* CacheKey) override
+	{
+		COOK_STAT(auto Timer = UsageStats.TimeProbablyExists(CacheKey));
+		if (!IsReachable())
+		{
+			return false;
+		}
+		FRequest Request(CacheKey, nullptr);
+		Request.bHeadOnly = true;
+		PerformRequests(MakeArrayView(&Request, 1));
+		const bool bExists = Request.IsSuccess();
+		if (bExists)
+		{
+			COOK_STAT(Timer.AddHit(0));
+		}
+		return bExists;
+	}
+
+	virtual TBitArray<> CachedDataProbablyExistsBatch(const TArray<FString>& CacheKeys) override
+	{
+		TBitArray<> Result(false, CacheKeys.Num());
+		if (!IsReachable() || !CacheKeys.Num())
+		{
+			return Result;
+		}
+
+		const double StartTime = FPlatformTime::Seconds();
+		TArray<FRequest> Requests;
+		Requests.Reserve(CacheKeys.Num());
+		for (const FString& CacheKey : CacheKeys)
+		{
+			FRequest& Request = Requests[Requests.Emplace(*CacheKey, nullptr)];
+			Request.bHeadOnly = true;
+		}
+		PerformRequests(Requests);
+
+		for (int32 KeyIndex = 0; KeyIndex < Requests.Num(); ++KeyIndex)
+		{
+			Result[KeyIndex] = Requests[KeyIndex].IsSuccess();
+		}
+		COOK_STAT(AccumulateBatchStats(UsageStats.ExistsStats, FDerivedDataCacheTelemetry::ECall::Exists, CacheKeys, Requests, StartTime));
+		return Result;
+	}
+
+	/**
+	 * Synchronous retrieve of a cache item
+	 *
+	 * @param	CacheKey	Alphanumeric+underscore key of this cache item
+	 * @param	OutData		Buffer to receive the results, if any were found
+	 * @return				true if any data was found, and in this case OutData is non-empty
+	 */
+	virtual bool GetCachedData(const TCHAR* CacheKey, TArray<uint8>& OutData) override
+	{
+		COOK_STAT(auto Timer = UsageStats.TimeGet(CacheKey));
+		OutData.Reset();
+		if (!IsReachable())
+		{
+			return false;
+		}
+		FRequest Request(CacheKey, &OutData);
+		PerformRequests(MakeArrayView(&Request, 1));
+		if (Request.IsSuccess() && OutData.Num())
+		{
+			UE_LOG(LogDerivedDataCache, Verbose, TEXT("HttpDerivedDataBackend: Cache hit on %s"), CacheKey);
+			COOK_STAT(Timer.AddHit(OutData.Num()));
+			return true;
+		}
+		UE_LOG(LogDerivedDataCache, Verbose, TEXT("HttpDerivedDataBackend: Cache miss on %s"), CacheKey);
+		OutData.Empty();
+		return false;
+	}
+
+	virtual TBitArray<> GetCachedDataBatch(const TArray<FString>& CacheKeys, TArray<TArray<uint8>>& OutData) override
+	{
+		TBitArray<> Result(false, CacheKeys.Num());
+		OutData.Reset();
+		OutData.SetNum(CacheKeys.Num());
+		if (!IsReachable() || !CacheKeys.Num())
+		{
+			return Result;
+		}
+
+		const double StartTime = FPlatformTime::Seconds();
+		TArray<FRequest> Requests;
+		Requests.Reserve(CacheKeys.Num());
+		for (int32 KeyIndex = 0; KeyIndex < CacheKeys.Num(); ++KeyIndex)
+		{
+			Requests.Emplace(*CacheKeys[KeyIndex], &OutData[KeyIndex]);
+		}
+		PerformRequests(Requests);
+
+		for (int32 KeyIndex = 0; KeyIndex < Requests.Num(); ++KeyIndex)
+		{
+			if (Requests[KeyIndex].IsSuccess() && OutData[KeyIndex].Num())
+			{
+				Result[KeyIndex] = true;
+			}
+			else
+			{
+				OutData[KeyIndex].Empty();
+			}
+		}
+		COOK_STAT(AccumulateBatchStats(UsageStats.GetStats, FDerivedDataCacheTelemetry::ECall::Get, CacheKeys, Requests, StartTime));
+		return Result;
+	}
+
+	/**
+	 * Asynchronous, fire-and-forget placement of a cache item
+	 *
+	 * @param	CacheKey			Alphanumeric+underscore key of this cache item
+	 * @param	InData				Buffer containing the data to cache, can be destroyed after the call returns, immediately
+	 * @param	bPutEvenIfExists	If true, then do not attempt skip the put even if CachedDataProbablyExists returns true
+	 */
+	virtual void PutCachedData(const TCHAR* CacheKey, TArray<uint8>& InData, bool bPutEvenIfExists) override
+	{
+		COOK_STAT(auto Timer = UsageStats.TimePut(CacheKey));
+		if (bReadOnly || !IsReachable())
+		{
+			return;
+		}
+		check(InData.Num());
+
+		FRequest Request(CacheKey, nullptr);
+		Request.Verb = "PUT";
+		// lets the service skip the upload instead of us paying for a HEAD first
+		Request.bIfNoneMatch = !bPutEvenIfExists;
+
+		int32 CompressedSize = FCompression::CompressMemoryBound(COMPRESS_ZLIB, InData.Num());
+		Request.UploadData.SetNumUninitialized(CompressedSize);
+		if (FCompression::CompressMemory(COMPRESS_ZLIB, Request.UploadData.GetData(), CompressedSize, InData.GetData(), InData.Num()) && CompressedSize < InData.Num())
+		{
+			Request.UploadData.SetNum(CompressedSize, false);
+			Request.bUploadDeflated = true;
+		}
+		else
+		{
+			Request.UploadData = InData;
+		}
+
+		PerformRequests(MakeArrayView(&Request, 1));
+		if (Request.IsSuccess())
+		{
+			UE_LOG(LogDerivedDataCache, Verbose, TEXT("HttpDerivedDataBackend: Successful cache put of %s (%d bytes on the wire)"), CacheKey, Request.UploadData.Num());
+			COOK_STAT(Timer.AddHit(InData.Num()));
+		}
+		else if (Request.ResponseCode != 412)
+		{
+			UE_LOG(LogDerivedDataCache, Warning, TEXT("HttpDerivedDataBackend: Could not put %s to %s (%s)."), CacheKey, *ServiceUrl, *Request.DescribeFailure());
+		}
+	}
+
+	virtual void RemoveCachedData(const TCHAR* CacheKey, bool bTransient) override
+	{
+		// transient data is left for the service to expire, it is shared with everybody else
+		if (bReadOnly || bTransient || !IsReachable())
+		{
+			return;
+		}
+		FRequest Request(CacheKey, nullptr);
+		Request.Verb = "DELETE";
+		PerformRequests(MakeArrayView(&Request, 1));
+	}
+
+	virtual void GatherUsageStats(TMap<FString, FDerivedDataCacheUsageStats>& UsageStatsMap, FString&& GraphPath) override
+	{
+		COOK_STAT(UsageStatsMap.Add(FString::Printf(TEXT("%s: %s.%s"), *GraphPath, TEXT("Http"), *BaseUrl), UsageStats));
+	}
+
+private:
+	/** One request to the service. */
+	struct FRequest
+	{
+		FString Url;
+		const ANSICHAR* Verb;
+		bool bHeadOnly;
+		bool bIfNoneMatch;
+		bool bUploadDeflated;
+		TArray<uint8> UploadData;
+		/** Receives the response body, the request doesn't want it if null */
+		TArray<uint8>* ResponseData;
+		CURLcode Result;
+		long ResponseCode;
+
+		FRequest(const TCHAR* CacheKey, TArray<uint8>* InResponseData)
+			: Url(CacheKey)
+			, Verb(nullptr)
+			, bHeadOnly(false)
+			, bIfNoneMatch(false)
+			, bUploadDeflated(false)
+			, ResponseData(InResponseData)
+			, Result(CURLE_FAILED_INIT)
+			, ResponseCode(0)
+		{
+		}
+
+		bool IsSuccess() const
+		{
+			return Result == CURLE_OK && ResponseCode >= 200 && ResponseCode < 300;
+		}
+
+		FString DescribeFailure() const
+		{
+			return Result != CURLE_OK ? FString(ANSI_TO_TCHAR(curl_easy_strerror(Result))) : FString::Printf(TEXT("HTTP %d"), (int32)ResponseCode);
+		}
+	};
+
+	static size_t WriteCallback(void* Ptr, size_t Size, size_t NumItems, void* UserData)
+	{
+		TArray<uint8>* ResponseData = (TArray<uint8>*)UserData;
+		const size_t NumBytes = Size * NumItems;
+		if (ResponseData)
+		{
+			ResponseData->Append((const uint8*)Ptr, NumBytes);
+		}
+		return NumBytes;
+	}
+
+	/** Takes a multi handle from the pool, they keep their connections alive between calls. */
+	CURLM* AcquireMultiHandle()
+	{
+		{
+			FScopeLock ScopeLock(&MultiHandlesCritical);
+			if (FreeMultiHandles.Num())
+			{
+				return FreeMultiHandles.Pop(false);
+			}
+		}
+		CURLM* MultiHandle = curl_multi_init();
+		curl_multi_setopt(MultiHandle, CURLMOPT_PIPELINING, (long)(CURLPIPE_HTTP1 | CURLPIPE_MULTIPLEX));
+		curl_multi_setopt(MultiHandle, CURLMOPT_MAX_HOST_CONNECTIONS, (long)MaxConnections);
+		return MultiHandle;
+	}
+
+	void ReleaseMultiHandle(CURLM* MultiHandle)
+	{
+		FScopeLock ScopeLock(&MultiHandlesCritical);
+		FreeMultiHandles.Add(MultiHandle);
+	}
+
+	/** Runs the requests concurrently and waits for all of them to finish. */
+	void PerformRequests(TArrayView<FRequest> Requests)
+	{
+		CURLM* MultiHandle = AcquireMultiHandle();
+		TArray<CURL*> EasyHandles;
+		TArray<curl_slist*> HeaderLists;
+		EasyHandles.AddZeroed(Requests.Num());
+		HeaderLists.AddZeroed(Requests.Num());
+
+		for (int32 RequestIndex = 0; RequestIndex < Requests.Num(); ++RequestIndex)
+		{
+			FRequest& Request = Requests[RequestIndex];
+			if (!Request.Url.StartsWith(TEXT("http")))
+			{
+				Request.Url = BaseUrl + Request.Url;
+			}
+
+			CURL* Easy = curl_easy_init();
+			EasyHandles[RequestIndex] = Easy;
+			curl_easy_setopt(Easy, CURLOPT_URL, TCHAR_TO_ANSI(*Request.Url));
+			curl_easy_setopt(Easy, CURLOPT_PRIVATE, (void*)(PTRINT)RequestIndex);
+			curl_easy_setopt(Easy, CURLOPT_NOSIGNAL, 1L);
+			curl_easy_setopt(Easy, CURLOPT_CONNECTTIMEOUT, (long)TimeoutSeconds);
+			curl_easy_setopt(Easy, CURLOPT_TIMEOUT, (long)TimeoutSeconds);
+			curl_easy_setopt(Easy, CURLOPT_PIPEWAIT, 1L);
+			// empty string accepts every encoding libcurl was built to decode
+			curl_easy_setopt(Easy, CURLOPT_ACCEPT_ENCODING, "");
+			curl_easy_setopt(Easy, CURLOPT_WRITEFUNCTION, &FHttpDerivedDataBackend::WriteCallback);
+			curl_easy_setopt(Easy, CURLOPT_WRITEDATA, (void*)Request.ResponseData);
+
+			curl_slist*& Headers = HeaderLists[RequestIndex];
+			if (Request.bHeadOnly)
+			{
+				curl_easy_setopt(Easy, CURLOPT_NOBODY, 1L);
+			}
+			else if (Request.Verb)
+			{
+				curl_easy_setopt(Easy, CURLOPT_CUSTOMREQUEST, Request.Verb);
+				if (Request.UploadData.Num())
+				{
+					curl_easy_setopt(Easy, CURLOPT_POSTFIELDS, (const char*)Request.UploadData.GetData());
+					curl_easy_setopt(Easy, CURLOPT_POSTFIELDSIZE_LARGE, (curl_off_t)Request.UploadData.Num());
+					Headers = curl_slist_append(Headers, "Content-Type: application/octet-stream");
+					if (Request.bUploadDeflated)
+					{
+						Headers = curl_slist_append(Headers, "Content-Encoding: deflate");
+					}
+				}
+				if (Request.bIfNoneMatch)
+				{
+					Headers = curl_slist_append(Headers, "If-None-Match: *");
+				}
+				// large uploads would otherwise wait for a 100 Continue on every request
+				Headers = curl_slist_append(Headers, "Expect:");
+			}
+			if (Headers)
+			{
+				curl_easy_setopt(Easy, CURLOPT_HTTPHEADER, Headers);
+			}
+
+			curl_multi_add_handle(MultiHandle, Easy);
+		}
+
+		int32 NumRunning = Requests.Num();
+		while (NumRunning > 0)
+		{
+			int Running = 0;
+			if (curl_multi_perform(MultiHandle, &Running) != CURLM_OK)
+			{
+				break;
+			}
+
+			int NumMessages = 0;
+			while (CURLMsg* Message = curl_multi_info_read(MultiHandle, &NumMessages))
+			{
+				if (Message->msg == CURLMSG_DONE)
+				{
+					void* Private = nullptr;
+					curl_easy_getinfo(Message->easy_handle, CURLINFO_PRIVATE, &Private);
+					FRequest& Request = Requests[(int32)(PTRINT)Private];
+					Request.Result = Message->data.result;
+					curl_easy_getinfo(Message->easy_handle, CURLINFO_RESPONSE_CODE, &Request.ResponseCode);
+					--NumRunning;
+				}
+			}
+
+			if (NumRunning > 0)
+			{
+				int NumFds = 0;
+				curl_multi_wait(MultiHandle, nullptr, 0, 100, &NumFds);
+			}
+		}
+
+		int32 NumConnectionFailures = 0;
+		for (int32 RequestIndex = 0; RequestIndex < Requests.Num(); ++RequestIndex)
+		{
+			curl_multi_remove_handle(MultiHandle, EasyHandles[RequestIndex]);
+			curl_easy_cleanup(EasyHandles[RequestIndex]);
+			curl_slist_free_all(HeaderLists[RequestIndex]);
+
+			const CURLcode Result = Requests[RequestIndex].Result;
+			if (Result == CURLE_COULDNT_RESOLVE_HOST || Result == CURLE_COULDNT_CONNECT || Result == CURLE_OPERATION_TIMEDOUT)
+			{
+				++NumConnectionFailures;
+			}
+			else if (Result == CURLE_OK)
+			{
+				ConnectionFailures.Reset();
+			}
+		}
+		ReleaseMultiHandle(MultiHandle);
+
+		if (NumConnectionFailures)
+		{
+			const int32 PreviousFailures = ConnectionFailures.Add(NumConnectionFailures);
+			UE_CLOG(!bFailed && PreviousFailures < MAX_HTTP_DDC_CONNECTION_FAILURES && PreviousFailures + NumConnectionFailures >= MAX_HTTP_DDC_CONNECTION_FAILURES,
+				LogDerivedDataCache, Warning, TEXT("FHttpDerivedDataBackend: %s stopped responding, it won't be used for the rest of this session."), *ServiceUrl);
+		}
+	}
+
+	/** return false once the service stopped answering, every call would otherwise wait for the timeout */
+	bool IsReachable() const
+	{
+		return !bFailed && ConnectionFailures.GetValue() < MAX_HTTP_DDC_CONNECTION_FAILURES;
+	}
+
+#if ENABLE_COOK_STATS
+	/** Batches count as one call per key, the time of the batch is spread over them. */
+	void AccumulateBatchStats(FCookStats::CallStats& Stats, FDerivedDataCacheTelemetry::ECall Call, const TArray<FString>& CacheKeys, const TArray<FRequest>& Requests, double StartTime)
+	{
+		const bool bIsInGameThread = IsInGameThread();
+		const double SecondsPerRequest = (FPlatformTime::Seconds() - StartTime) / FMath::Max(Requests.Num(), 1);
+		const int64 CyclesPerRequest = int64(SecondsPerRequest / FPlatformTime::GetSecondsPerCycle());
+		for (int32 RequestIndex = 0; RequestIndex < Requests.Num(); ++RequestIndex)
+		{
+			const FRequest& Request = Requests[RequestIndex];
+			const int64 Bytes = Request.ResponseData ? Request.ResponseData->Num() : 0;
+			const FCookStats::CallStats::EHitOrMiss HitOrMiss = Request.IsSuccess() ? FCookStats::CallStats::EHitOrMiss::Hit : FCookStats::CallStats::EHitOrMiss::Miss;
+			Stats.Accumulate(HitOrMiss, FCookStats::CallStats::EStatType::Counter, 1l, bIsInGameThread);
+			Stats.Accumulate(HitOrMiss, FCookStats::CallStats::EStatType::Cycles, CyclesPerRequest, bIsInGameThread);
+			Stats.Accumulate(HitOrMiss, FCookStats::CallStats::EStatType::Bytes, Bytes, bIsInGameThread);
+			// the requests of a batch overlap, so each is charged its share of the batch
+			UsageStats.Telemetry->Record(Call, *CacheKeys[RequestIndex], Request.IsSuccess(), Bytes, SecondsPerRequest);
+		}
+	}
+#endif
+
+	FDerivedDataCacheUsageStats UsageStats;
+
+	/** Base url of the service. **/
+	FString ServiceUrl;
+	/** Url cache keys are appended to, includes the namespace. **/
+	FString BaseUrl;
+	/** If true, do not attempt to write to this cache **/
+	bool bReadOnly;
+	/** If true, the service didn't answer when we started so we should not be used **/
+	bool bFailed;
+	/** Maximum number of connections a batch can open. **/
+	int32 MaxConnections;
+	/** Seconds a request may take. **/
+	int32 TimeoutSeconds;
+	/** Requests that failed to connect since the last one that went through. **/
+	FThreadSafeCounter ConnectionFailures;
+
+	/** Idle multi handles and the connections they keep open. **/
+	TArray<CURLM*> FreeMultiHandles;
+	FCriticalSection MultiHandlesCritical;
+};
+
+#endif // WITH_LIBCURL
+
+FDerivedDataBackendInterface* CreateHttpDerivedDataBackend(const TCHAR* ServiceUrl, const TCHAR* Namespace, bool bForceReadOnly, int32 MaxConnections, int32 TimeoutSeconds)
+{
+#if WITH_LIBCURL
+	FHttpDerivedDataBackend* HttpDDB = new FHttpDerivedDataBackend(ServiceUrl, Namespace, bForceReadOnly, MaxConnections, TimeoutSeconds);
+	if (!HttpDDB->IsUsable())
+	{
+		delete HttpDDB;
+		HttpDDB = NULL;
+	}
+	return HttpDDB;
+#else
+	UE_LOG(LogDerivedDataCache, Warning, TEXT("FHttpDerivedDataBackend: HTTP derived data caches are not supported on this platform."));
+	return NULL;
+#endif // WITH_LIBCURL
+}
@@ -24,7 +24,7 @@ bool FMemoryDerivedDataBackend::IsWritable()
 
 bool FMemoryDerivedDataBackend::CachedDataProbablyExists(const TCHAR* CacheKey)
 {
-	COOK_STAT(auto Timer = UsageStats.TimeProbablyExists());
+	COOK_STAT(auto Timer = UsageStats.TimeProbablyExists(CacheKey));
 	FScopeLock ScopeLock(&SynchronizationObject);
 	if (bDisabled)
 	{
@@ -47,7 +47,7 @@ bool FMemoryDerivedDataBackend::CachedDataProbablyExists(const TCHAR* CacheKey)
 
 bool FMemoryDerivedDataBackend::GetCachedData(const TCHAR* CacheKey, TArray<uint8>& OutData)
 {
-	COOK_STAT(auto Timer = UsageStats.TimeGet());
+	COOK_STAT(auto Timer = UsageStats.TimeGet(CacheKey));
 	FScopeLock ScopeLock(&SynchronizationObject);
 	if (!bDisabled)
 	{
@@ -67,7 +67,7 @@ bool FMemoryDerivedDataBackend::GetCachedData(const TCHAR* CacheKey, TArray<uint
 
 void FMemoryDerivedDataBackend::PutCachedData(const TCHAR* CacheKey, TArray<uint8>& InData, bool bPutEvenIfExists)
 {
-	COOK_STAT(auto Timer = UsageStats.TimePut());
+	COOK_STAT(auto Timer = UsageStats.TimePut(CacheKey));
 	FScopeLock ScopeLock(&SynchronizationObject);
 	
 	if (bDisabled || bMaxSizeExceeded)
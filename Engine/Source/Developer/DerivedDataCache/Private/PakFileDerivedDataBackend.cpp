@@ -75,7 +75,7 @@ bool FPakFileDerivedDataBackend::BackfillLowerCacheLevels()
 
 bool FPakFileDerivedDataBackend::CachedDataProbablyExists(const TCHAR* CacheKey)
 {
-	COOK_STAT(auto Timer = UsageStats.TimeProbablyExists());
+	COOK_STAT(auto Timer = UsageStats.TimeProbablyExists(CacheKey));
 	FScopeLock ScopeLock(&SynchronizationObject);
 	bool Result = CacheItems.Contains(FString(CacheKey));
 	if (Result)
@@ -87,7 +87,7 @@ bool FPakFileDerivedDataBackend::CachedDataProbablyExists(const TCHAR* CacheKey)
 
 bool FPakFileDerivedDataBackend::GetCachedData(const TCHAR* CacheKey, TArray<uint8>& OutData)
 {
-	COOK_STAT(auto Timer = UsageStats.TimeGet());
+	COOK_STAT(auto Timer = UsageStats.TimeGet(CacheKey));
 	if (bWriting || bClosed)
 	{
 		return false;
@@ -133,7 +133,7 @@ bool FPakFileDerivedDataBackend::GetCachedData(const TCHAR* CacheKey, TArray<uin
 
 void FPakFileDerivedDataBackend::PutCachedData(const TCHAR* CacheKey, TArray<uint8>& InData, bool bPutEvenIfExists)
 {
-	COOK_STAT(auto Timer = UsageStats.TimePut());
+	COOK_STAT(auto Timer = UsageStats.TimePut(CacheKey));
 	if (!bWriting || bClosed)
 	{
 		return;
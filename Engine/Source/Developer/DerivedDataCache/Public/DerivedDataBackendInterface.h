@@ -58,6 +58,41 @@ public:
 	 * @return				true if any data was found, and in this case OutData is non-empty
 	 */
 	virtual bool GetCachedData(const TCHAR* CacheKey, TArray<uint8>& OutData)=0;
+	/**
+	 * Synchronous test for the existence of several cache items. Backends that pay a round trip per request
+	 * should override this and ask for all of the keys at once.
+	 *
+	 * @param	CacheKeys	Alphanumeric+underscore keys of the cache items
+	 * @return				A bit per key, set if the data probably will be found
+	 */
+	virtual TBitArray<> CachedDataProbablyExistsBatch(const TArray<FString>& CacheKeys)
+	{
+		TBitArray<> Result(false, CacheKeys.Num());
+		for (int32 KeyIndex = 0; KeyIndex < CacheKeys.Num(); ++KeyIndex)
+		{
+			Result[KeyIndex] = CachedDataProbablyExists(*CacheKeys[KeyIndex]);
+		}
+		return Result;
+	}
+	/**
+	 * Synchronous retrieve of several cache items. Backends that pay a round trip per request
+	 * should override this and ask for all of the keys at once.
+	 *
+	 * @param	CacheKeys	Alphanumeric+underscore keys of the cache items
+	 * @param	OutData		Receives a buffer per key, empty for the keys that weren't found
+	 * @return				A bit per key, set if data was found and the buffer of the key is non-empty
+	 */
+	virtual TBitArray<> GetCachedDataBatch(const TArray<FString>& CacheKeys, TArray<TArray<uint8>>& OutData)
+	{
+		TBitArray<> Result(false, CacheKeys.Num());
+		OutData.Reset();
+		OutData.SetNum(CacheKeys.Num());
+		for (int32 KeyIndex = 0; KeyIndex < CacheKeys.Num(); ++KeyIndex)
+		{
+			Result[KeyIndex] = GetCachedData(*CacheKeys[KeyIndex], OutData[KeyIndex]);
+		}
+		return Result;
+	}
 	/**
 	 * Asynchronous, fire-and-forget placement of a cache item
 	 *
@@ -182,6 +182,28 @@ public:
 	 */
 	virtual bool CachedDataProbablyExists(const TCHAR* CacheKey) = 0;
 
+	/**
+	 * Returns which of several keys are likely to exist in the cache, with a single request to backends that support batches.
+	 * Even if a key is reported to exist, a get for it may still fail!
+	 * @param	CacheKeys	Keys to see if data probably exists.
+	 * @return	A bit per key, set if the data of the key probably exists.
+	 */
+	virtual TBitArray<> CachedDataProbablyExistsBatch(const TArray<FString>& CacheKeys) = 0;
+
+	/**
+	 * Starts fetching the data of several keys in the background with a single request to backends that support batches.
+	 * Gets and existence checks for those keys made afterwards are answered from memory instead of going to the backends again.
+	 * @param	CacheKeys	Keys that are about to be requested.
+	 */
+	virtual void Prefetch(const TArray<FString>& CacheKeys) = 0;
+
+	/**
+	 * Starts or stops recording the keys requested by gets and existence checks made from the calling thread.
+	 * Callers use this to learn which keys to prefetch the next time they do the same work.
+	 * @param	OutKeys		Set the keys are added to, or null to stop recording.
+	 */
+	virtual void RecordRequestedKeys(TSet<FString>* OutKeys) = 0;
+
 	//--------------------
 	// System Interface
 	//--------------------
@@ -3,6 +3,7 @@
 
 #include "CoreMinimal.h"
 #include "ProfilingDebugging/CookStats.h"
+#include "Misc/ScopeLock.h"
 
 /**
  * Usage stats for the derived data cache nodes. At the end of the app or commandlet, the DDC
@@ -26,19 +27,19 @@
  *   public:
  *       <override CachedDataProbablyExists>
  *       { 
- *           auto Timer = UsageStats.TimeExists();
+ *           auto Timer = UsageStats.TimeProbablyExists(CacheKey);
  *           ...
  *       }
  *       <override GetCachedData>
  *       {    
- *           auto Timer = UsageStats.TimeGet();
+ *           auto Timer = UsageStats.TimeGet(CacheKey);
  *           ...
  *           <if it's a cache hit> Timer.AddHit(DataSize);
  *           // Misses are automatically tracked
  *       }
  *       <override PutCachedData>
  *       {
- *           auto Timer = UsageStats.TimePut();
+ *           auto Timer = UsageStats.TimePut(CacheKey);
  *           ...
  *           <if the data will really be Put> Timer.AddHit(DataSize);
  *           // Misses are automatically tracked
@@ -50,10 +51,201 @@
  *       }
 *   }
  */
+/**
+ * Telemetry of a DDC node broken down by the type of data, so slow startups can be pinned on the node and the kind
+ * of data responsible. The type of a key is the part of it before the first underscore, eg TEXTURE2D or MATSM.
+ * Unlike the usage stats the calls of all threads are accumulated together, guarded by a lock since every call
+ * has to find the entry of its type anyway.
+ */
+class FDerivedDataCacheTelemetry
+{
+#if ENABLE_COOK_STATS
+public:
+	/** Calls that took less than 2^N milliseconds are counted in bucket N, the last bucket counts everything slower. */
+	static const int32 NumLatencyBuckets = 14;
+
+	enum class ECall : uint8
+	{
+		Get,
+		Put,
+		Exists,
+		MaxValue,
+	};
+
+	/** Accumulated stats of one kind of call for one type of data. */
+	struct FCallStats
+	{
+		int64 Hits = 0;
+		int64 Misses = 0;
+		int64 Bytes = 0;
+		double Seconds = 0.0;
+		int64 LatencyHistogram[NumLatencyBuckets] = {};
+	};
+
+	/** Records a finished call. */
+	void Record(ECall Call, const TCHAR* CacheKey, bool bHit, int64 Bytes, double Seconds)
+	{
+		int32 Bucket = 0;
+		for (double BucketLimitMs = 1.0; Bucket < NumLatencyBuckets - 1 && Seconds * 1000.0 >= BucketLimitMs; BucketLimitMs *= 2.0)
+		{
+			++Bucket;
+		}
+
+		FScopeLock ScopeLock(&CriticalSection);
+		FCallStats& Stats = FindOrAddType(CacheKey)[(uint8)Call];
+		(bHit ? Stats.Hits : Stats.Misses)++;
+		Stats.Bytes += Bytes;
+		Stats.Seconds += Seconds;
+		Stats.LatencyHistogram[Bucket]++;
+	}
+
+	/** Records a batch of calls, each key is charged its share of the time the batch took since the calls of a batch overlap. */
+	void RecordBatch(ECall Call, const TArray<FString>& CacheKeys, const TBitArray<>& Hits, const TArray<TArray<uint8>>* Data, double Seconds)
+	{
+		const double SecondsPerKey = Seconds / FMath::Max(CacheKeys.Num(), 1);
+		for (int32 KeyIndex = 0; KeyIndex < CacheKeys.Num(); ++KeyIndex)
+		{
+			Record(Call, *CacheKeys[KeyIndex], Hits[KeyIndex], Data ? (*Data)[KeyIndex].Num() : 0, SecondsPerKey);
+		}
+	}
+
+	/** Writes the stats of every type as a table. */
+	void Log(FOutputDevice& Ar, const FString& NodeName) const
+	{
+		static const TCHAR* CallNames[] = { TEXT("Get"), TEXT("Put"), TEXT("Exists") };
+
+		FScopeLock ScopeLock(&CriticalSection);
+		for (const TPair<FString, FTypeStats>& Type : StatsByType)
+		{
+			for (uint8 Call = 0; Call < (uint8)ECall::MaxValue; ++Call)
+			{
+				const FCallStats& Stats = Type.Value.Calls[Call];
+				const int64 NumCalls = Stats.Hits + Stats.Misses;
+				if (!NumCalls)
+				{
+					continue;
+				}
+
+				FString Histogram;
+				for (int32 Bucket = 0; Bucket < NumLatencyBuckets; ++Bucket)
+				{
+					Histogram += FString::Printf(TEXT(" %lld"), Stats.LatencyHistogram[Bucket]);
+				}
+				Ar.Logf(TEXT("%-40s %-24s %-6s %8lld hits %8lld misses %10.2f MB %8.2f s avg %7.2f ms, latency <1ms..<%dms,slower:%s"),
+					*NodeName, *Type.Key, CallNames[Call], Stats.Hits, Stats.Misses, Stats.Bytes / (1024.0 * 1024.0), Stats.Seconds,
+					Stats.Seconds * 1000.0 / NumCalls, 1 << (NumLatencyBuckets - 2), *Histogram);
+			}
+		}
+	}
+
+private:
+	/** Caps the number of types a node keeps track of, in case some deriver doesn't put a prefix in front of its keys. */
+	static const int32 MaxTypes = 128;
+
+	struct FTypeStats
+	{
+		FCallStats Calls[(uint8)ECall::MaxValue];
+	};
+
+	FCallStats* FindOrAddType(const TCHAR* CacheKey)
+	{
+		const TCHAR* Separator = FCString::Strchr(CacheKey, TEXT('_'));
+		FString Type = Separator ? FString(int32(Separator - CacheKey), CacheKey) : FString(CacheKey);
+		if (StatsByType.Num() >= MaxTypes && !StatsByType.Contains(Type))
+		{
+			Type = TEXT("Other");
+		}
+		return StatsByType.FindOrAdd(Type).Calls;
+	}
+
+	mutable FCriticalSection CriticalSection;
+	TMap<FString, FTypeStats> StatsByType;
+#endif
+};
+
 class FDerivedDataCacheUsageStats
 {
 #if ENABLE_COOK_STATS
 public:
+	/**
+	 * Times a call for both the usage stats and the per type telemetry, returned by the overloads of the timing routines that take the key.
+	 * Hits and misses are reported the same way as with FCookStats::FScopedStatsCounter.
+	 */
+	class FScopedKeyedStatsCounter
+	{
+	public:
+		FScopedKeyedStatsCounter(FCookStats::CallStats& InStats, FDerivedDataCacheTelemetry& InTelemetry, FDerivedDataCacheTelemetry::ECall InCall, const TCHAR* InCacheKey)
+			: Counter(InStats)
+			, Telemetry(InTelemetry)
+			, Call(InCall)
+			, CacheKey(InCacheKey)
+			, StartTime(FPlatformTime::Seconds())
+		{
+		}
+
+		~FScopedKeyedStatsCounter()
+		{
+			if (!bCanceled)
+			{
+				Telemetry.Record(Call, CacheKey, bHit, BytesProcessed, FPlatformTime::Seconds() - StartTime);
+			}
+		}
+
+		void AddHit(int64 InBytesProcessed)
+		{
+			Counter.AddHit(InBytesProcessed);
+			bHit = true;
+			BytesProcessed = InBytesProcessed;
+		}
+
+		void AddMiss(int64 InBytesProcessed = 0)
+		{
+			Counter.AddMiss(InBytesProcessed);
+			bHit = false;
+			BytesProcessed = InBytesProcessed;
+		}
+
+		void Cancel()
+		{
+			Counter.Cancel();
+			bCanceled = true;
+		}
+
+	private:
+		FCookStats::FScopedStatsCounter Counter;
+		FDerivedDataCacheTelemetry& Telemetry;
+		FDerivedDataCacheTelemetry::ECall Call;
+		/** The key has to outlive the counter, which is the case for the key arguments of the backend calls */
+		const TCHAR* CacheKey;
+		double StartTime;
+		int64 BytesProcessed = 0;
+		bool bHit = false;
+		bool bCanceled = false;
+	};
+
+	FDerivedDataCacheUsageStats()
+		: Telemetry(MakeShareable(new FDerivedDataCacheTelemetry))
+	{
+	}
+
+	/** Call this at the top of the CachedDataProbablyExists override. auto Timer = TimeProbablyExists(CacheKey); */
+	FScopedKeyedStatsCounter TimeProbablyExists(const TCHAR* CacheKey)
+	{
+		return FScopedKeyedStatsCounter(ExistsStats, *Telemetry, FDerivedDataCacheTelemetry::ECall::Exists, CacheKey);
+	}
+
+	/** Call this at the top of the GetCachedData override. auto Timer = TimeGet(CacheKey); Use AddHit on the returned type to track a cache hit. */
+	FScopedKeyedStatsCounter TimeGet(const TCHAR* CacheKey)
+	{
+		return FScopedKeyedStatsCounter(GetStats, *Telemetry, FDerivedDataCacheTelemetry::ECall::Get, CacheKey);
+	}
+
+	/** Call this at the top of the PutCachedData override. auto Timer = TimePut(CacheKey); Use AddHit on the returned type to track a cache hit. */
+	FScopedKeyedStatsCounter TimePut(const TCHAR* CacheKey)
+	{
+		return FScopedKeyedStatsCounter(PutStats, *Telemetry, FDerivedDataCacheTelemetry::ECall::Put, CacheKey);
+	}
+
 	/** Call this at the top of the CachedDataProbablyExists override. auto Timer = TimeProbablyExists(); */
 	FCookStats::FScopedStatsCounter TimeProbablyExists()
 	{
@@ -83,5 +275,8 @@ public:
 	FCookStats::CallStats GetStats;
 	FCookStats::CallStats PutStats;
 	FCookStats::CallStats ExistsStats;
+
+	/** Per type telemetry of the calls timed with a key. Shared by the copies handed out by GatherUsageStats */
+	TSharedRef<FDerivedDataCacheTelemetry, ESPMode::ThreadSafe> Telemetry;
 #endif
 };
@@ -25,6 +25,7 @@ public:
 
 	void				SetAttributeWeights( const float* weights );
 	void				SetBoundaryLocked();
+	void				SetVertLocked( uint32 VertIndex );
 
 	void				InitCosts();
 
@@ -244,6 +245,13 @@ void TMeshSimplifier<T, NumAttributes>::SetBoundaryLocked()
 	}
 }
 
+template< typename T, uint32 NumAttributes >
+void TMeshSimplifier<T, NumAttributes>::SetVertLocked( uint32 VertIndex )
+{
+	check( VertIndex < (uint32)numSVerts );
+	sVerts[ VertIndex ].EnableFlagsGroup( SIMP_LOCKED );
+}
+
 // locking functions for nesting safety
 template< typename T, uint32 NumAttributes >
 FORCEINLINE void TMeshSimplifier<T, NumAttributes>::LockVertFlags( uint32 f )
@@ -8,6 +8,8 @@
 #include "RawMesh.h"
 #include "MeshSimplify.h"
 #include "UniquePtr.h"
+#include "HAL/IConsoleManager.h"
+#include "Async/ParallelFor.h"
 
 class FQuadricSimplifierMeshReductionModule : public IMeshReductionModule
 {
@@ -28,6 +30,19 @@ public:
 DEFINE_LOG_CATEGORY_STATIC(LogQuadricSimplifier, Log, All);
 IMPLEMENT_MODULE(FQuadricSimplifierMeshReductionModule, QuadricMeshReduction);
 
+static TAutoConsoleVariable<int32> CVarQuadricParallelMinTriangles(
+	TEXT("r.QuadricMeshReduction.ParallelMinTriangles"),
+	0,
+	TEXT("Meshes with at least this many triangles are split into spatial partitions that are reduced in parallel,\n")
+	TEXT("followed by a pass over the whole mesh to reduce across the partition borders. 0 always reduces the whole mesh at once."),
+	ECVF_ReadOnly);
+
+static TAutoConsoleVariable<int32> CVarQuadricParallelPartitionTriangles(
+	TEXT("r.QuadricMeshReduction.ParallelPartitionTriangles"),
+	200000,
+	TEXT("Approximate number of triangles of each partition when reducing a mesh in parallel."),
+	ECVF_ReadOnly);
+
 template< uint32 NumTexCoords >
 class TVertSimp
 {
@@ -136,13 +151,237 @@ public:
 	}
 };
 
+/** Reduces the mesh in place and returns the largest squared error, LockedVerts keep their position. */
+template< uint32 NumTexCoords, uint32 NumAttributes >
+static float SimplifyVerts( TArray< TVertSimp< NumTexCoords > >& Verts, TArray< uint32 >& Indexes, const float* AttributeWeights, int32 MinTris, const TArray< uint32 >& LockedVerts )
+{
+	TMeshSimplifier< TVertSimp< NumTexCoords >, NumAttributes >* MeshSimp = new TMeshSimplifier< TVertSimp< NumTexCoords >, NumAttributes >( Verts.GetData(), Verts.Num(), Indexes.GetData(), Indexes.Num() );
+
+	MeshSimp->SetAttributeWeights( AttributeWeights );
+	//MeshSimp->SetBoundaryLocked();
+	for( uint32 VertIndex : LockedVerts )
+	{
+		MeshSimp->SetVertLocked( VertIndex );
+	}
+	MeshSimp->InitCosts();
+
+	const float MaxErrorSqr = MeshSimp->SimplifyMesh( MAX_FLT, MinTris );
+
+	const int32 NumVerts = MeshSimp->GetNumVerts();
+	const int32 NumIndexes = MeshSimp->GetNumTris() * 3;
+
+	MeshSimp->OutputMesh( Verts.GetData(), Indexes.GetData() );
+	delete MeshSimp;
+
+	Verts.SetNum( NumVerts, false );
+	Indexes.SetNum( NumIndexes, false );
+
+	return MaxErrorSqr;
+}
+
+/**
+ * Reduces a large mesh by splitting it at the median triangle centroid into NumPartitions spatial partitions, reducing those in parallel
+ * with the vertices on partition borders locked, and finishing with a pass over the welded result that also collapses the border edges.
+ */
+template< uint32 NumTexCoords, uint32 NumAttributes >
+static float SimplifyVertsPartitioned( TArray< TVertSimp< NumTexCoords > >& Verts, TArray< uint32 >& Indexes, const float* AttributeWeights, int32 MinTris, int32 NumPartitions )
+{
+	typedef TVertSimp< NumTexCoords > VertType;
+
+	const int32 NumTris = Indexes.Num() / 3;
+	const float TriRatio = (float)MinTris / (float)NumTris;
+
+	TArray< FVector > Centroids;
+	Centroids.AddUninitialized( NumTris );
+	TArray< int32 > TriOrder;
+	TriOrder.AddUninitialized( NumTris );
+	for( int32 TriIndex = 0; TriIndex < NumTris; TriIndex++ )
+	{
+		Centroids[ TriIndex ] = ( Verts[ Indexes[ 3 * TriIndex + 0 ] ].Position + Verts[ Indexes[ 3 * TriIndex + 1 ] ].Position + Verts[ Indexes[ 3 * TriIndex + 2 ] ].Position ) / 3.0f;
+		TriOrder[ TriIndex ] = TriIndex;
+	}
+
+	// Halve the largest partition along the longest axis of its centroids until there are enough
+	struct FPartition
+	{
+		int32 FirstTri;
+		int32 NumTris;
+	};
+	TArray< FPartition > Partitions;
+	Partitions.Add( { 0, NumTris } );
+	while( Partitions.Num() < NumPartitions )
+	{
+		int32 LargestIndex = 0;
+		for( int32 PartitionIndex = 1; PartitionIndex < Partitions.Num(); PartitionIndex++ )
+		{
+			if( Partitions[ PartitionIndex ].NumTris > Partitions[ LargestIndex ].NumTris )
+			{
+				LargestIndex = PartitionIndex;
+			}
+		}
+
+		const FPartition Partition = Partitions[ LargestIndex ];
+		if( Partition.NumTris < 2 )
+		{
+			break;
+		}
+
+		FBox Bounds( ForceInit );
+		for( int32 i = 0; i < Partition.NumTris; i++ )
+		{
+			Bounds += Centroids[ TriOrder[ Partition.FirstTri + i ] ];
+		}
+		const FVector Extent = Bounds.GetExtent();
+		const int32 Axis = ( Extent.X >= Extent.Y && Extent.X >= Extent.Z ) ? 0 : ( Extent.Y >= Extent.Z ? 1 : 2 );
+
+		Sort( TriOrder.GetData() + Partition.FirstTri, Partition.NumTris, [ &Centroids, Axis ]( int32 A, int32 B ) { return Centroids[A][ Axis ] < Centroids[B][ Axis ]; } );
+
+		const int32 NumLow = Partition.NumTris / 2;
+		Partitions[ LargestIndex ].NumTris = NumLow;
+		Partitions.Add( { Partition.FirstTri + NumLow, Partition.NumTris - NumLow } );
+	}
+
+	// Positions used by more than one partition are on a border, INDEX_NONE marks those
+	TMap< FVector, int32 > PositionPartitions;
+	PositionPartitions.Reserve( Verts.Num() );
+	for( int32 PartitionIndex = 0; PartitionIndex < Partitions.Num(); PartitionIndex++ )
+	{
+		const FPartition& Partition = Partitions[ PartitionIndex ];
+		for( int32 i = 0; i < Partition.NumTris; i++ )
+		{
+			const int32 TriIndex = TriOrder[ Partition.FirstTri + i ];
+			for( int32 Corner = 0; Corner < 3; Corner++ )
+			{
+				const FVector& Position = Verts[ Indexes[ 3 * TriIndex + Corner ] ].Position;
+				int32* Found = PositionPartitions.Find( Position );
+				if( Found == nullptr )
+				{
+					PositionPartitions.Add( Position, PartitionIndex );
+				}
+				else if( *Found != PartitionIndex )
+				{
+					*Found = INDEX_NONE;
+				}
+			}
+		}
+	}
+
+	TArray< TArray< VertType > > PartitionVerts;
+	TArray< TArray< uint32 > > PartitionIndexes;
+	TArray< float > PartitionErrors;
+	PartitionVerts.SetNum( Partitions.Num() );
+	PartitionIndexes.SetNum( Partitions.Num() );
+	PartitionErrors.SetNumZeroed( Partitions.Num() );
+
+	ParallelFor( Partitions.Num(), [&]( int32 PartitionIndex )
+	{
+		const FPartition& Partition = Partitions[ PartitionIndex ];
+		TArray< VertType >& LocalVerts = PartitionVerts[ PartitionIndex ];
+		TArray< uint32 >& LocalIndexes = PartitionIndexes[ PartitionIndex ];
+		TArray< uint32 > LockedVerts;
+
+		TMap< uint32, uint32 > VertRemap;
+		VertRemap.Reserve( Partition.NumTris );
+		LocalIndexes.Reserve( Partition.NumTris * 3 );
+		for( int32 i = 0; i < Partition.NumTris; i++ )
+		{
+			const int32 TriIndex = TriOrder[ Partition.FirstTri + i ];
+			for( int32 Corner = 0; Corner < 3; Corner++ )
+			{
+				const uint32 VertIndex = Indexes[ 3 * TriIndex + Corner ];
+				uint32* LocalIndex = VertRemap.Find( VertIndex );
+				if( LocalIndex == nullptr )
+				{
+					const uint32 NewIndex = LocalVerts.Add( Verts[ VertIndex ] );
+					LocalIndex = &VertRemap.Add( VertIndex, NewIndex );
+					if( PositionPartitions.FindChecked( Verts[ VertIndex ].Position ) == INDEX_NONE )
+					{
+						LockedVerts.Add( NewIndex );
+					}
+				}
+				LocalIndexes.Add( *LocalIndex );
+			}
+		}
+
+		const int32 LocalMinTris = FMath::Max( 1, FMath::CeilToInt( Partition.NumTris * TriRatio ) );
+		PartitionErrors[ PartitionIndex ] = SimplifyVerts< NumTexCoords, NumAttributes >( LocalVerts, LocalIndexes, AttributeWeights, LocalMinTris, LockedVerts );
+	});
+
+	// Weld the partitions back together, locked border vertices kept their position so identical copies can be merged
+	float MaxErrorSqr = 0.0f;
+	Verts.Reset();
+	Indexes.Reset();
+	TMultiMap< FVector, uint32 > BorderVerts;
+	TArray< uint32 > VertRemap;
+	for( int32 PartitionIndex = 0; PartitionIndex < Partitions.Num(); PartitionIndex++ )
+	{
+		MaxErrorSqr = FMath::Max( MaxErrorSqr, PartitionErrors[ PartitionIndex ] );
+
+		const TArray< VertType >& LocalVerts = PartitionVerts[ PartitionIndex ];
+		VertRemap.Reset();
+		for( const VertType& Vert : LocalVerts )
+		{
+			const int32* PositionPartition = PositionPartitions.Find( Vert.Position );
+			if( PositionPartition && *PositionPartition == INDEX_NONE )
+			{
+				uint32 WeldedIndex = MAX_uint32;
+				for( auto It = BorderVerts.CreateConstKeyIterator( Vert.Position ); It; ++It )
+				{
+					if( Verts[ It.Value() ] == Vert )
+					{
+						WeldedIndex = It.Value();
+						break;
+					}
+				}
+
+				if( WeldedIndex == MAX_uint32 )
+				{
+					WeldedIndex = Verts.Add( Vert );
+					BorderVerts.Add( Vert.Position, WeldedIndex );
+				}
+				VertRemap.Add( WeldedIndex );
+			}
+			else
+			{
+				VertRemap.Add( Verts.Add( Vert ) );
+			}
+		}
+
+		for( uint32 LocalIndex : PartitionIndexes[ PartitionIndex ] )
+		{
+			Indexes.Add( VertRemap[ LocalIndex ] );
+		}
+
+		PartitionVerts[ PartitionIndex ].Empty();
+		PartitionIndexes[ PartitionIndex ].Empty();
+	}
+
+	if( (int32)Indexes.Num() / 3 > MinTris )
+	{
+		const TArray< uint32 > NoLockedVerts;
+		MaxErrorSqr = FMath::Max( MaxErrorSqr, SimplifyVerts< NumTexCoords, NumAttributes >( Verts, Indexes, AttributeWeights, MinTris, NoLockedVerts ) );
+	}
+
+	return MaxErrorSqr;
+}
+
 class FQuadricSimplifierMeshReduction : public IMeshReduction
 {
 public:
+	FQuadricSimplifierMeshReduction()
+		: ParallelMinTriangles( FMath::Max( 0, CVarQuadricParallelMinTriangles.GetValueOnAnyThread() ) )
+		, ParallelPartitionTriangles( FMath::Max( 1, CVarQuadricParallelPartitionTriangles.GetValueOnAnyThread() ) )
+	{
+		VersionString = TEXT("1.0");
+		if( ParallelMinTriangles > 0 )
+		{
+			VersionString += FString::Printf( TEXT("_Parallel%d_%d"), ParallelMinTriangles, ParallelPartitionTriangles );
+		}
+	}
+
 	virtual const FString& GetVersionString() const override
 	{
-		static FString Version = TEXT("1.0");
-		return Version;
+		return VersionString;
 	}
 
 	virtual void Reduce(
@@ -332,20 +571,25 @@ public:
 			}
 		}
 		
-		TMeshSimplifier< TVertSimp< NumTexCoords >, NumAttributes >* MeshSimp = new TMeshSimplifier< TVertSimp< NumTexCoords >, NumAttributes >( Verts.GetData(), NumVerts, Indexes.GetData(), NumIndexes );
-
-		MeshSimp->SetAttributeWeights( AttributeWeights );
-		//MeshSimp->SetBoundaryLocked();
-		MeshSimp->InitCosts();
-
-		float MaxErrorSqr = MeshSimp->SimplifyMesh( MAX_FLT, NumTris * InSettings.PercentTriangles );
+		const int32 MinTris = NumTris * InSettings.PercentTriangles;
+		const int32 NumPartitions = ( ParallelMinTriangles > 0 && NumTris >= (uint32)ParallelMinTriangles ) ? FMath::DivideAndRoundUp( (int32)NumTris, ParallelPartitionTriangles ) : 1;
 
-		NumVerts = MeshSimp->GetNumVerts();
-		NumTris = MeshSimp->GetNumTris();
-		NumIndexes = NumTris * 3;
+		float MaxErrorSqr;
+		if( NumPartitions > 1 )
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			MaxErrorSqr = SimplifyVertsPartitioned< NumTexCoords, NumAttributes >( Verts, Indexes, AttributeWeights, MinTris, NumPartitions );
+			UE_LOG( LogQuadricSimplifier, Verbose, TEXT("Reduced %u triangles to %d in %d partitions in %.2fs"), NumTris, Indexes.Num() / 3, NumPartitions, FPlatformTime::Seconds() - StartTime );
+		}
+		else
+		{
+			const TArray< uint32 > NoLockedVerts;
+			MaxErrorSqr = SimplifyVerts< NumTexCoords, NumAttributes >( Verts, Indexes, AttributeWeights, MinTris, NoLockedVerts );
+		}
 
-		MeshSimp->OutputMesh( Verts.GetData(), Indexes.GetData() );
-		delete MeshSimp;
+		NumVerts = Verts.Num();
+		NumIndexes = Indexes.Num();
+		NumTris = NumIndexes / 3;
 
 		OutMaxDeviation = FMath::Sqrt( MaxErrorSqr ) / 8.0f;
 
@@ -447,6 +691,13 @@ public:
 	{
 		return new FQuadricSimplifierMeshReduction;
 	}
+
+private:
+	/** Cached values of r.QuadricMeshReduction.ParallelMinTriangles and ParallelPartitionTriangles, they change the reduced mesh so are part of the version */
+	int32 ParallelMinTriangles;
+	int32 ParallelPartitionTriangles;
+
+	FString VersionString;
 };
 TUniquePtr<FQuadricSimplifierMeshReduction> GQuadricSimplifierMeshReduction;
 
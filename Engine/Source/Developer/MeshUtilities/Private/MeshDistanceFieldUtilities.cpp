@@ -138,6 +138,7 @@ public:
 		TkDOPTree<const FMeshBuildDataProvider, uint32>* InkDopTree,
 		bool bInUseEmbree,
 		RTCScene InEmbreeScene,
+		const FEmbreeGeometry* InEmbreeGeometry,
 		const TArray<FVector4>* InSampleDirections,
 		FBox InVolumeBounds,
 		FIntVector InVolumeDimensions,
@@ -148,6 +149,7 @@ public:
 		kDopTree(InkDopTree),
 		bUseEmbree(bInUseEmbree),
 		EmbreeScene(InEmbreeScene),
+		EmbreeGeometry(InEmbreeGeometry),
 		SampleDirections(InSampleDirections),
 		VolumeBounds(InVolumeBounds),
 		VolumeDimensions(InVolumeDimensions),
@@ -171,10 +173,16 @@ public:
 
 private:
 
+#if USE_EMBREE
+	/** Traces all sample rays of a voxel through the Embree scene, four at a time */
+	void TraceEmbreeRays(const FVector& VoxelPosition, float& InOutMinDistance, int32& InOutHit, int32& InOutHitBack) const;
+#endif
+
 	// Readonly inputs
 	TkDOPTree<const FMeshBuildDataProvider, uint32>* kDopTree;
 	bool bUseEmbree;
 	RTCScene EmbreeScene;
+	const FEmbreeGeometry* EmbreeGeometry;
 	const TArray<FVector4>* SampleDirections;
 	FBox VolumeBounds;
 	FIntVector VolumeDimensions;
@@ -203,6 +211,13 @@ void FMeshDistanceFieldAsyncTask::DoWork()
 			int32 Hit = 0;
 			int32 HitBack = 0;
 
+#if USE_EMBREE
+			if (bUseEmbree)
+			{
+				TraceEmbreeRays(VoxelPosition, MinDistance, Hit, HitBack);
+			}
+			else
+#endif
 			for (int32 SampleIndex = 0; SampleIndex < SampleDirections->Num(); SampleIndex++)
 			{
 				const FVector UnitRayDirection = (*SampleDirections)[SampleIndex];
@@ -210,77 +225,35 @@ void FMeshDistanceFieldAsyncTask::DoWork()
 
 				if (FMath::LineBoxIntersection(VolumeBounds, VoxelPosition, EndPosition, UnitRayDirection))
 				{
-#if USE_EMBREE
-					if (bUseEmbree)
-					{
-						FEmbreeRay EmbreeRay;
-
-						FVector RayDirection = EndPosition - VoxelPosition;
-						EmbreeRay.org[0] = VoxelPosition.X;
-						EmbreeRay.org[1] = VoxelPosition.Y;
-						EmbreeRay.org[2] = VoxelPosition.Z;
-						EmbreeRay.dir[0] = RayDirection.X;
-						EmbreeRay.dir[1] = RayDirection.Y;
-						EmbreeRay.dir[2] = RayDirection.Z;
-						EmbreeRay.tnear = 0;
-						EmbreeRay.tfar = 1.0f;
-
-						rtcIntersect(EmbreeScene, EmbreeRay);
-
-						if (EmbreeRay.geomID != -1 && EmbreeRay.primID != -1)
-						{
-							Hit++;
-
-							const FVector HitNormal = FVector(EmbreeRay.Ng[0], EmbreeRay.Ng[1], EmbreeRay.Ng[2]).GetSafeNormal();
+					FkHitResult Result;
 
-							if (FVector::DotProduct(UnitRayDirection, HitNormal) > 0
-								// MaterialIndex on the build triangles was set to 1 if two-sided, or 0 if one-sided
-								&& EmbreeRay.ElementIndex == 0)
-							{
-								HitBack++;
-							}
+					TkDOPLineCollisionCheck<const FMeshBuildDataProvider, uint32> kDOPCheck(
+						VoxelPosition,
+						EndPosition,
+						true,
+						kDOPDataProvider,
+						&Result);
 
-							const float CurrentDistance = VolumeMaxDistance * EmbreeRay.tfar;
+					bool bHit = kDopTree->LineCheck(kDOPCheck);
 
-							if (CurrentDistance < MinDistance)
-							{
-								MinDistance = CurrentDistance;
-							}
-						}
-					}
-					else
-#endif
+					if (bHit)
 					{
-						FkHitResult Result;
-
-						TkDOPLineCollisionCheck<const FMeshBuildDataProvider, uint32> kDOPCheck(
-							VoxelPosition,
-							EndPosition,
-							true,
-							kDOPDataProvider,
-							&Result);
+						Hit++;
 
-						bool bHit = kDopTree->LineCheck(kDOPCheck);
+						const FVector HitNormal = kDOPCheck.GetHitNormal();
 
-						if (bHit)
+						if (FVector::DotProduct(UnitRayDirection, HitNormal) > 0
+							// MaterialIndex on the build triangles was set to 1 if two-sided, or 0 if one-sided
+							&& kDOPCheck.Result->Item == 0)
 						{
-							Hit++;
-
-							const FVector HitNormal = kDOPCheck.GetHitNormal();
-
-							if (FVector::DotProduct(UnitRayDirection, HitNormal) > 0
-								// MaterialIndex on the build triangles was set to 1 if two-sided, or 0 if one-sided
-								&& kDOPCheck.Result->Item == 0)
-							{
-								HitBack++;
-							}
+							HitBack++;
+						}
 
-							const float CurrentDistance = VolumeMaxDistance * Result.Time;
+						const float CurrentDistance = VolumeMaxDistance * Result.Time;
 
-							if (CurrentDistance < MinDistance)
-							{
-								MinDistance = CurrentDistance;
-							}
+						if (CurrentDistance < MinDistance)
+						{
+							MinDistance = CurrentDistance;
 						}
 					}
 				}
@@ -314,6 +287,92 @@ void FMeshDistanceFieldAsyncTask::DoWork()
 	}
 }
 
+#if USE_EMBREE
+void FMeshDistanceFieldAsyncTask::TraceEmbreeRays(const FVector& VoxelPosition, float& InOutMinDistance, int32& InOutHit, int32& InOutHitBack) const
+{
+	const int32 NumSamples = SampleDirections->Num();
+
+	for (int32 FirstSampleIndex = 0; FirstSampleIndex < NumSamples; FirstSampleIndex += 4)
+	{
+		RTCRay4 EmbreeRays;
+		MS_ALIGN(16) int32 ValidLanes[4] GCC_ALIGN(16);
+		bool bAnyValid = false;
+
+		for (int32 Lane = 0; Lane < 4; Lane++)
+		{
+			const int32 SampleIndex = FirstSampleIndex + Lane;
+			ValidLanes[Lane] = 0;
+
+			// Keep the values of inactive lanes defined, Embree reads whole packets
+			EmbreeRays.orgx[Lane] = EmbreeRays.orgy[Lane] = EmbreeRays.orgz[Lane] = 0;
+			EmbreeRays.dirx[Lane] = EmbreeRays.diry[Lane] = EmbreeRays.dirz[Lane] = 0;
+			EmbreeRays.tnear[Lane] = 0;
+			EmbreeRays.tfar[Lane] = 1.0f;
+			EmbreeRays.time[Lane] = 0;
+			EmbreeRays.mask[Lane] = 0xFFFFFFFF;
+			EmbreeRays.u[Lane] = EmbreeRays.v[Lane] = 0;
+			EmbreeRays.geomID[Lane] = -1;
+			EmbreeRays.instID[Lane] = -1;
+			EmbreeRays.primID[Lane] = -1;
+
+			if (SampleIndex < NumSamples)
+			{
+				const FVector UnitRayDirection = (*SampleDirections)[SampleIndex];
+				const FVector EndPosition = VoxelPosition + UnitRayDirection * VolumeMaxDistance;
+
+				if (FMath::LineBoxIntersection(VolumeBounds, VoxelPosition, EndPosition, UnitRayDirection))
+				{
+					const FVector RayDirection = EndPosition - VoxelPosition;
+					EmbreeRays.orgx[Lane] = VoxelPosition.X;
+					EmbreeRays.orgy[Lane] = VoxelPosition.Y;
+					EmbreeRays.orgz[Lane] = VoxelPosition.Z;
+					EmbreeRays.dirx[Lane] = RayDirection.X;
+					EmbreeRays.diry[Lane] = RayDirection.Y;
+					EmbreeRays.dirz[Lane] = RayDirection.Z;
+					ValidLanes[Lane] = -1;
+					bAnyValid = true;
+				}
+			}
+		}
+
+		if (!bAnyValid)
+		{
+			continue;
+		}
+
+		rtcIntersect4(ValidLanes, EmbreeScene, EmbreeRays);
+
+		for (int32 Lane = 0; Lane < 4; Lane++)
+		{
+			if (ValidLanes[Lane] == 0 || EmbreeRays.geomID[Lane] == -1 || EmbreeRays.primID[Lane] == -1)
+			{
+				continue;
+			}
+
+			InOutHit++;
+
+			const FVector UnitRayDirection = (*SampleDirections)[FirstSampleIndex + Lane];
+			const FVector HitNormal = FVector(EmbreeRays.Ngx[Lane], EmbreeRays.Ngy[Lane], EmbreeRays.Ngz[Lane]).GetSafeNormal();
+
+			// The filter function only runs for single rays, so look the two-sided flag up directly
+			if (FVector::DotProduct(UnitRayDirection, HitNormal) > 0
+				// MaterialIndex on the build triangles was set to 1 if two-sided, or 0 if one-sided
+				&& EmbreeGeometry->TriangleDescs[EmbreeRays.primID[Lane]].ElementIndex == 0)
+			{
+				InOutHitBack++;
+			}
+
+			const float CurrentDistance = VolumeMaxDistance * EmbreeRays.tfar[Lane];
+
+			if (CurrentDistance < InOutMinDistance)
+			{
+				InOutMinDistance = CurrentDistance;
+			}
+		}
+	}
+}
+#endif
+
 void FMeshUtilities::GenerateSignedDistanceFieldVolumeData(
 	FString MeshName,
 	const FStaticMeshLODResources& LODModel,
@@ -344,7 +403,7 @@ void FMeshUtilities::GenerateSignedDistanceFieldVolumeData(
 		{
 			EmbreeDevice = rtcNewDevice(NULL);
 			check(rtcDeviceGetError(EmbreeDevice) == RTC_NO_ERROR);
-			EmbreeScene = rtcDeviceNewScene(EmbreeDevice, RTC_SCENE_STATIC, RTC_INTERSECT1);
+			EmbreeScene = rtcDeviceNewScene(EmbreeDevice, RTC_SCENE_STATIC, RTC_INTERSECT1 | RTC_INTERSECT4);
 			check(rtcDeviceGetError(EmbreeDevice) == RTC_NO_ERROR);
 		}
 #endif
@@ -558,6 +617,7 @@ void FMeshUtilities::GenerateSignedDistanceFieldVolumeData(
 					&kDopTree,
 					bUseEmbree,
 					EmbreeScene,
+					&Geometry,
 					&SampleDirections,
 					DistanceFieldVolumeBounds,
 					VolumeDimensions,
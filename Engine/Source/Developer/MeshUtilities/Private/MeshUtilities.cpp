@@ -113,6 +113,13 @@ static TAutoConsoleVariable<int32> CVarTriangleOrderOptimization(
 	TEXT("2: No triangle order optimization. (least efficient, debugging purposes only)"),
 	ECVF_Default);
 
+static TAutoConsoleVariable<int32> CVarTriangleOrderOptimizationReduceOverdraw(
+	TEXT("r.TriangleOrderOptimization.ReduceOverdraw"),
+	0,
+	TEXT("If non-zero, clusters of the cache optimized triangle order of static meshes are sorted to reduce overdraw.\n")
+	TEXT("Triangles facing away from the mesh center then draw first, at a small cost in vertex reuse."),
+	ECVF_ReadOnly);
+
 static FAutoConsoleVariable CVarMeshReductionModule(
 	TEXT("r.MeshReductionModule"),
 	TEXT("QuadricMeshReduction"),
@@ -530,6 +537,118 @@ void FMeshUtilities::CacheOptimizeIndexBuffer(TArray<uint32>& Indices)
 	}
 }
 
+/*------------------------------------------------------------------------------
+Overdraw optimization of cache optimized index buffers.
+------------------------------------------------------------------------------*/
+
+namespace OverdrawOptimization
+{
+	/** Entries of the simulated FIFO post transform cache used to find cluster boundaries. */
+	static const uint32 CacheSize = 16;
+
+	/** Clusters are never split smaller than this, so reordering them doesn't cost much vertex reuse. */
+	static const int32 MinClusterTriangles = 32;
+
+	struct FCluster
+	{
+		int32 FirstTriangle;
+		int32 NumTriangles;
+		float SortKey;
+	};
+
+	/**
+	 * Reorders clusters of a cache optimized triangle list so that those facing away from the mesh center, which tend to occlude the rest, draw first.
+	 * Clusters end where the simulated cache misses all three vertices of a triangle, so the vertex reuse inside each cluster is kept.
+	 * See "Fast Triangle Reordering for Vertex Locality and Reduced Overdraw", Sander et al. 2007.
+	 */
+	void OptimizeOverdraw(TArray<uint32>& Indices, const TArray<FStaticMeshBuildVertex>& Vertices)
+	{
+		const int32 NumTriangles = Indices.Num() / 3;
+		if (NumTriangles < MinClusterTriangles * 2)
+		{
+			return;
+		}
+
+		TArray<uint32> CacheTimeStamps;
+		CacheTimeStamps.AddZeroed(Vertices.Num());
+		uint32 TimeStamp = CacheSize + 1;
+
+		TArray<FCluster> Clusters;
+		TArray<FVector> ClusterCentroids;
+		TArray<FVector> ClusterNormals;
+		FVector MeshCentroid = FVector::ZeroVector;
+		float MeshArea = 0.0f;
+
+		for (int32 TriangleIndex = 0; TriangleIndex < NumTriangles; ++TriangleIndex)
+		{
+			int32 NumMisses = 0;
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				const uint32 VertexIndex = Indices[TriangleIndex * 3 + Corner];
+				if (TimeStamp - CacheTimeStamps[VertexIndex] > CacheSize)
+				{
+					CacheTimeStamps[VertexIndex] = TimeStamp++;
+					++NumMisses;
+				}
+			}
+
+			if (Clusters.Num() == 0 || (NumMisses == 3 && Clusters.Last().NumTriangles >= MinClusterTriangles))
+			{
+				FCluster& Cluster = Clusters[Clusters.AddUninitialized()];
+				Cluster.FirstTriangle = TriangleIndex;
+				Cluster.NumTriangles = 0;
+				Cluster.SortKey = 0.0f;
+				ClusterCentroids.Add(FVector::ZeroVector);
+				ClusterNormals.Add(FVector::ZeroVector);
+			}
+			Clusters.Last().NumTriangles++;
+
+			const FVector& P0 = Vertices[Indices[TriangleIndex * 3 + 0]].Position;
+			const FVector& P1 = Vertices[Indices[TriangleIndex * 3 + 1]].Position;
+			const FVector& P2 = Vertices[Indices[TriangleIndex * 3 + 2]].Position;
+
+			// Twice the area weighted normal, so both centroids are weighted by area
+			const FVector Normal = (P1 - P2) ^ (P0 - P2);
+			const float Area = Normal.Size();
+			const FVector Centroid = (P0 + P1 + P2) / 3.0f;
+
+			ClusterCentroids.Last() += Centroid * Area;
+			ClusterNormals.Last() += Normal;
+			MeshCentroid += Centroid * Area;
+			MeshArea += Area;
+		}
+
+		if (Clusters.Num() < 2 || MeshArea <= 0.0f)
+		{
+			return;
+		}
+		MeshCentroid /= MeshArea;
+
+		for (int32 ClusterIndex = 0; ClusterIndex < Clusters.Num(); ++ClusterIndex)
+		{
+			const FVector& ClusterNormal = ClusterNormals[ClusterIndex];
+			const float ClusterArea = ClusterNormal.Size();
+			if (ClusterArea > 0.0f)
+			{
+				const FVector ClusterCentroid = ClusterCentroids[ClusterIndex] / ClusterArea;
+				Clusters[ClusterIndex].SortKey = FVector::DotProduct(ClusterCentroid - MeshCentroid, ClusterNormal / ClusterArea);
+			}
+		}
+
+		Clusters.StableSort([](const FCluster& A, const FCluster& B) { return A.SortKey > B.SortKey; });
+
+		const TArray<uint32> OriginalIndices = Indices;
+		int32 DestIndex = 0;
+		for (const FCluster& Cluster : Clusters)
+		{
+			const int32 NumIndices = Cluster.NumTriangles * 3;
+			FMemory::Memcpy(&Indices[DestIndex], &OriginalIndices[Cluster.FirstTriangle * 3], NumIndices * sizeof(uint32));
+			DestIndex += NumIndices;
+		}
+		check(DestIndex == NumTriangles * 3);
+	}
+}
+
 /*------------------------------------------------------------------------------
 NVTessLib for computing adjacency used for tessellation.
 ------------------------------------------------------------------------------*/
@@ -2775,6 +2894,126 @@ static void BuildDepthOnlyIndexBuffer(
 	}
 }
 
+/** Most vertices and triangles a meshlet references, matching common mesh shader limits. */
+static const int32 MaxMeshletVertices = 64;
+static const int32 MaxMeshletTriangles = 124;
+
+static void FinishMeshlet(FStaticMeshMeshlet& Meshlet, const TArray<FStaticMeshBuildVertex>& InVertices, const TArray<uint32>& InIndices)
+{
+	FBox Box(ForceInit);
+	FVector NormalSum = FVector::ZeroVector;
+	const uint32 LastIndex = Meshlet.FirstIndex + Meshlet.NumTriangles * 3;
+	for (uint32 Index = Meshlet.FirstIndex; Index < LastIndex; Index += 3)
+	{
+		const FVector& P0 = InVertices[InIndices[Index + 0]].Position;
+		const FVector& P1 = InVertices[InIndices[Index + 1]].Position;
+		const FVector& P2 = InVertices[InIndices[Index + 2]].Position;
+		Box += P0;
+		Box += P1;
+		Box += P2;
+		NormalSum += ((P1 - P2) ^ (P0 - P2)).GetSafeNormal();
+	}
+
+	Meshlet.BoundsCenter = Box.GetCenter();
+	Meshlet.BoundsRadius = 0.0f;
+	for (uint32 Index = Meshlet.FirstIndex; Index < LastIndex; ++Index)
+	{
+		Meshlet.BoundsRadius = FMath::Max(Meshlet.BoundsRadius, (InVertices[InIndices[Index]].Position - Meshlet.BoundsCenter).Size());
+	}
+
+	// The cone has to contain every triangle normal, degenerate triangles face nowhere and are skipped
+	const FVector Axis = NormalSum.GetSafeNormal();
+	float MinDot = Axis.IsZero() ? 0.0f : 1.0f;
+	for (uint32 Index = Meshlet.FirstIndex; Index < LastIndex && MinDot > 0.0f; Index += 3)
+	{
+		const FVector& P0 = InVertices[InIndices[Index + 0]].Position;
+		const FVector& P1 = InVertices[InIndices[Index + 1]].Position;
+		const FVector& P2 = InVertices[InIndices[Index + 2]].Position;
+		const FVector Normal = ((P1 - P2) ^ (P0 - P2)).GetSafeNormal();
+		if (!Normal.IsZero())
+		{
+			MinDot = FMath::Min(MinDot, FVector::DotProduct(Normal, Axis));
+		}
+	}
+
+	if (MinDot > 0.0f)
+	{
+		Meshlet.ConeAxis = Axis;
+		Meshlet.ConeCutoff = FMath::Sqrt(1.0f - MinDot * MinDot);
+	}
+	else
+	{
+		Meshlet.ConeAxis = FVector::ZeroVector;
+		Meshlet.ConeCutoff = 1.0f;
+	}
+}
+
+/**
+ * Splits each section into runs of consecutive triangles that reference at most MaxMeshletVertices vertices.
+ * Keeping the runs in index buffer order means the meshlets cost no extra index data and follow the cache optimized order.
+ */
+static void BuildMeshlets(
+	TArray<FStaticMeshMeshlet>& OutMeshlets,
+	const TArray<FStaticMeshBuildVertex>& InVertices,
+	const TArray<uint32>& InIndices,
+	const TArray<FStaticMeshSection>& InSections
+	)
+{
+	OutMeshlets.Empty();
+
+	// Meshlet number each vertex was last added to
+	TArray<int32> VertexMeshlet;
+	VertexMeshlet.Init(INDEX_NONE, InVertices.Num());
+
+	for (const FStaticMeshSection& Section : InSections)
+	{
+		FStaticMeshMeshlet* Meshlet = nullptr;
+		int32 MeshletNumber = INDEX_NONE;
+		int32 NumMeshletVertices = 0;
+
+		const uint32 LastIndex = Section.FirstIndex + Section.NumTriangles * 3;
+		for (uint32 Index = Section.FirstIndex; Index < LastIndex; Index += 3)
+		{
+			int32 NumNewVertices = 0;
+			if (Meshlet)
+			{
+				for (int32 Corner = 0; Corner < 3; ++Corner)
+				{
+					NumNewVertices += VertexMeshlet[InIndices[Index + Corner]] != MeshletNumber ? 1 : 0;
+				}
+			}
+
+			if (Meshlet == nullptr || NumMeshletVertices + NumNewVertices > MaxMeshletVertices || (int32)Meshlet->NumTriangles >= MaxMeshletTriangles)
+			{
+				if (Meshlet)
+				{
+					FinishMeshlet(*Meshlet, InVertices, InIndices);
+				}
+				MeshletNumber = OutMeshlets.AddDefaulted();
+				Meshlet = &OutMeshlets[MeshletNumber];
+				Meshlet->FirstIndex = Index;
+				NumMeshletVertices = 0;
+			}
+
+			for (int32 Corner = 0; Corner < 3; ++Corner)
+			{
+				int32& LastMeshlet = VertexMeshlet[InIndices[Index + Corner]];
+				if (LastMeshlet != MeshletNumber)
+				{
+					LastMeshlet = MeshletNumber;
+					++NumMeshletVertices;
+				}
+			}
+			Meshlet->NumTriangles++;
+		}
+
+		if (Meshlet)
+		{
+			FinishMeshlet(*Meshlet, InVertices, InIndices);
+		}
+	}
+}
+
 static float GetComparisonThreshold(FMeshBuildSettings const& BuildSettings)
 {
 	return BuildSettings.bRemoveDegenerates ? THRESH_POINTS_ARE_SAME : 0.0f;
@@ -2976,6 +3215,11 @@ void FMeshUtilities::CacheOptimizeVertexAndIndexBuffer(
 			// Optimize the index buffer for the post transform cache with.
 			CacheOptimizeIndexBuffer(Indices);
 
+			if (bReduceOverdraw)
+			{
+				OverdrawOptimization::OptimizeOverdraw(Indices, OriginalVertices);
+			}
+
 			// Copy the index buffer since we will be reordering it
 			TArray<uint32> OriginalIndices = Indices;
 
@@ -3290,6 +3534,12 @@ public:
 			}
 			LODModel.IndexBuffer.SetIndices(CombinedIndices, bNeeds32BitIndices ? EIndexBufferStride::Force32Bit : EIndexBufferStride::Force16Bit);
 
+			LODModel.Meshlets.Empty();
+			if (LODBuildSettings[LODIndex].bBuildMeshlets)
+			{
+				BuildMeshlets(LODModel.Meshlets, Vertices, CombinedIndices, LODModel.Sections);
+			}
+
 			// Build the reversed index buffer.
 			if (InOutModels[0].BuildSettings.bBuildReversedIndexBuffer)
 			{
@@ -7795,12 +8045,15 @@ void FMeshUtilities::StartupModule()
 
 	bUsingNvTriStrip = !bDisableTriangleOrderOptimization && (CVarTriangleOrderOptimization.GetValueOnGameThread() == 0);
 
+	bReduceOverdraw = !bDisableTriangleOrderOptimization && (CVarTriangleOrderOptimizationReduceOverdraw.GetValueOnGameThread() != 0);
+
 	// Construct and cache the version string for the mesh utilities module.
 	VersionString = FString::Printf(
-		TEXT("%s%s%s"),
+		TEXT("%s%s%s%s"),
 		MESH_UTILITIES_VER,
 		StaticMeshReduction ? *StaticMeshReduction->GetVersionString() : TEXT(""),
-		bUsingNvTriStrip ? TEXT("_NvTriStrip") : TEXT("")
+		bUsingNvTriStrip ? TEXT("_NvTriStrip") : TEXT(""),
+		bReduceOverdraw ? TEXT("_Overdraw") : TEXT("")
 		);
 	bUsingSimplygon = VersionString.Contains(TEXT("Simplygon"));
 
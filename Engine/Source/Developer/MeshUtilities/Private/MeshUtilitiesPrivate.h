@@ -47,6 +47,8 @@ private:
 	bool bUsingNvTriStrip;
 	/** True if we disable triangle order optimization.  For debugging purposes only */
 	bool bDisableTriangleOrderOptimization;
+	/** True if clusters of the optimized triangle order are sorted to reduce overdraw. */
+	bool bReduceOverdraw;
 
 	class FProxyGenerationProcessor* Processor;
 
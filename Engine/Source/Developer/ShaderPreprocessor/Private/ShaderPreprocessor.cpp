@@ -4,7 +4,10 @@
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "Misc/ScopeLock.h"
+#include "HAL/FileManager.h"
 #include "Modules/ModuleManager.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
 #include "PreprocessorPrivate.h"
 
 IMPLEMENT_MODULE(FDefaultModuleImpl, ShaderPreprocessor);
@@ -168,3 +171,93 @@ bool PreprocessShader(
 
 	return bSuccess;
 }
+
+/** Bump when the layout of the cached outputs changes */
+static const int32 PreprocessedOutputCacheVersion = 1;
+
+static FString GetPreprocessedOutputCacheFilename(const FSHAHash& Key)
+{
+	const FString KeyString = Key.ToString();
+	return FPaths::EngineIntermediateDir() / TEXT("ShaderOutputCache") / KeyString.Left(2) / KeyString + TEXT(".bin");
+}
+
+FSHAHash GetPreprocessedOutputCacheKey(const FString& PreprocessedShader, const FShaderCompilerInput& ShaderInput, const TArray<uint8>& FormatKey)
+{
+	// Everything that affects the compiled output and isn't already baked into the preprocessed source. The includes and the
+	// definitions are left out on purpose, that's what lets edits which don't change a permutation's source reuse its output.
+	TArray<uint8> InputKey;
+	FMemoryWriter Ar(InputKey);
+	FShaderCompilerInput& Input = const_cast<FShaderCompilerInput&>(ShaderInput);
+	FString ShaderFormatString = Input.ShaderFormat.ToString();
+	int32 Version = PreprocessedOutputCacheVersion;
+	Ar << Version;
+	Ar << Input.Target;
+	Ar << ShaderFormatString;
+	Ar << Input.EntryPointName;
+	Ar << Input.bCompilingForShaderPipeline;
+	Ar << Input.bIncludeUsedOutputs;
+	Ar << Input.UsedOutputs;
+	Ar << Input.Environment.CompilerFlags;
+	Ar << Input.Environment.RenderTargetOutputFormatsMap;
+	Ar << Input.Environment.ResourceTableMap;
+	Ar << Input.Environment.ResourceTableLayoutHashes;
+
+	FSHA1 HashState;
+	HashState.Update((const uint8*)*PreprocessedShader, PreprocessedShader.Len() * sizeof(TCHAR));
+	HashState.Update(InputKey.GetData(), InputKey.Num());
+	HashState.Update(FormatKey.GetData(), FormatKey.Num());
+	HashState.Final();
+
+	FSHAHash Key;
+	HashState.GetHash(&Key.Hash[0]);
+	return Key;
+}
+
+bool LoadPreprocessedOutputCache(const FSHAHash& Key, FShaderCompilerOutput& OutShaderOutput)
+{
+	TArray<uint8> FileContents;
+	if (!FFileHelper::LoadFileToArray(FileContents, *GetPreprocessedOutputCacheFilename(Key), FILEREAD_Silent))
+	{
+		return false;
+	}
+
+	FMemoryReader Ar(FileContents);
+	int32 Version = 0;
+	Ar << Version;
+	if (Version != PreprocessedOutputCacheVersion)
+	{
+		return false;
+	}
+
+	FShaderCompilerOutput CachedOutput;
+	Ar << CachedOutput;
+	if (Ar.IsError() || !CachedOutput.bSucceeded)
+	{
+		return false;
+	}
+
+	OutShaderOutput = CachedOutput;
+	return true;
+}
+
+void SavePreprocessedOutputCache(const FSHAHash& Key, const FShaderCompilerOutput& ShaderOutput)
+{
+	if (!ShaderOutput.bSucceeded)
+	{
+		return;
+	}
+
+	TArray<uint8> FileContents;
+	FMemoryWriter Ar(FileContents);
+	int32 Version = PreprocessedOutputCacheVersion;
+	Ar << Version;
+	Ar << const_cast<FShaderCompilerOutput&>(ShaderOutput);
+
+	// Several workers can compile the same permutation, so write to a file of our own and move it in place
+	const FString Filename = GetPreprocessedOutputCacheFilename(Key);
+	const FString TempFilename = FString::Printf(TEXT("%s.%u.tmp"), *Filename, FPlatformProcess::GetCurrentProcessId());
+	if (FFileHelper::SaveArrayToFile(FileContents, *TempFilename) && !IFileManager::Get().Move(*Filename, *TempFilename, true, true, false, true))
+	{
+		IFileManager::Get().Delete(*TempFilename, false, false, true);
+	}
+}
@@ -32,3 +32,27 @@ extern SHADERPREPROCESSOR_API bool PreprocessShaderFile(
 	TArray<FShaderCompilerError>& OutShaderErrors,
 	const FString& InShaderFile
 	);
+
+/**
+ * Returns the key of a compile in the output cache of the shader compile workers: the hash of the preprocessed source as given
+ * to the platform compiler, of the parts of the input that aren't baked into it, and of the format's own state (flags, profile...).
+ * Compiles with CFLAG_PreprocessedOutputCache look their output up there, so an edit to a common include only recompiles the
+ * permutations whose preprocessed source changed.
+ * @param PreprocessedShader - The final source given to the platform compiler.
+ * @param ShaderInput - The shader compiler input.
+ * @param FormatKey - Anything else the format's output depends on.
+ */
+extern SHADERPREPROCESSOR_API FSHAHash GetPreprocessedOutputCacheKey(
+	const FString& PreprocessedShader,
+	const FShaderCompilerInput& ShaderInput,
+	const TArray<uint8>& FormatKey
+	);
+
+/**
+ * Loads the output of an earlier successful compile from the output cache.
+ * @returns true if there was one.
+ */
+extern SHADERPREPROCESSOR_API bool LoadPreprocessedOutputCache(const FSHAHash& Key, FShaderCompilerOutput& OutShaderOutput);
+
+/** Stores the output of a successful compile in the output cache. */
+extern SHADERPREPROCESSOR_API void SavePreprocessedOutputCache(const FSHAHash& Key, const FShaderCompilerOutput& ShaderOutput);
@@ -5,6 +5,8 @@
 #include "Containers/IndirectArray.h"
 #include "Stats/Stats.h"
 #include "Async/AsyncWork.h"
+#include "Async/ParallelFor.h"
+#include "Async/TaskGraphInterfaces.h"
 #include "Modules/ModuleManager.h"
 #include "Engine/Texture.h"
 #include "Interfaces/ITargetPlatformManagerModule.h"
@@ -17,6 +19,19 @@
 
 DEFINE_LOG_CATEGORY_STATIC(LogTextureCompressor, Log, All);
 
+/** Texels each task processes when filtering an image in parallel. */
+static const int32 TexelsPerParallelTask = 64 * 1024;
+
+/** Returns the number of rows to process per task, or 0 if the image is too small to be worth splitting. */
+static int32 GetRowsPerParallelTask(int32 SizeX, int32 SizeY)
+{
+	if (!FTaskGraphInterface::IsRunning() || SizeX * SizeY < 2 * TexelsPerParallelTask)
+	{
+		return 0;
+	}
+	return FMath::Max(1, TexelsPerParallelTask / SizeX);
+}
+
 /*------------------------------------------------------------------------------
 	Mip-Map Generation
 ------------------------------------------------------------------------------*/
@@ -374,6 +389,26 @@ static FVector4 ComputeAlphaScale(const FVector4& Coverages, const FVector4& Alp
 }
 
 
+// Applies the kernel centered at SourceX, SourceY, accumulating all four channels at once
+template <EMipGenAddressMode AddressMode>
+static FORCEINLINE FLinearColor ApplyKernel(const FImageView2D& SourceImageData, const FImageKernel2D& Kernel, int32 SourceX, int32 SourceY, int32 KernelCenter)
+{
+	VectorRegister Sum = VectorZero();
+	for ( uint32 KernelY = 0; KernelY < Kernel.GetFilterTableSize();  ++KernelY )
+	{
+		for ( uint32 KernelX = 0; KernelX < Kernel.GetFilterTableSize();  ++KernelX )
+		{
+			const float Weight = Kernel.GetAt( KernelX, KernelY );
+			const FLinearColor Sample = LookupSourceMip<AddressMode>( SourceImageData, SourceX + KernelX - KernelCenter, SourceY + KernelY - KernelCenter );
+			Sum = VectorMultiplyAdd( VectorLoadFloat1( &Weight ), VectorLoad( &Sample.R ), Sum );
+		}
+	}
+
+	FLinearColor Result;
+	VectorStore( Sum, &Result.R );
+	return Result;
+}
+
 /**
 * Generates a mip-map for an 2D B8G8R8A8 image using a 4x4 filter with sharpening
 * @param SourceImageData - The source image's data.
@@ -408,91 +443,82 @@ static void GenerateSharpenedMipB8G8R8A8Templ(
 	{
 		AlphaScale = ComputeAlphaScale<AddressMode>(AlphaCoverages, AlphaThresholds, SourceImageData);
 	}
-	
-	for ( int32 DestY = 0;DestY < DestImageData.SizeY; DestY++ )
-	{
-		for ( int32 DestX = 0;DestX < DestImageData.SizeX; DestX++ )
-		{
-			const int32 SourceX = DestX * ScaleFactor;
-			const int32 SourceY = DestY * ScaleFactor;
 
-			FLinearColor FilteredColor(0, 0, 0, 0);
+	// Rows are filtered in parallel, except when dithering since the random stream has to be consumed in order to give the same result
+	const int32 RowsPerTask = bDitherMipMapAlpha ? 0 : GetRowsPerParallelTask(DestImageData.SizeX, DestImageData.SizeY);
+	const int32 NumTasks = RowsPerTask > 0 ? FMath::DivideAndRoundUp(DestImageData.SizeY, RowsPerTask) : 1;
 
-			if ( bSharpenWithoutColorShift )
+	ParallelFor(NumTasks, [&](int32 TaskIndex)
+	{
+		const int32 FirstRow = RowsPerTask > 0 ? TaskIndex * RowsPerTask : 0;
+		const int32 EndRow = RowsPerTask > 0 ? FMath::Min(FirstRow + RowsPerTask, DestImageData.SizeY) : DestImageData.SizeY;
+		for ( int32 DestY = FirstRow; DestY < EndRow; DestY++ )
+		{
+			for ( int32 DestX = 0;DestX < DestImageData.SizeX; DestX++ )
 			{
-				FLinearColor SharpenedColor(0, 0, 0, 0);
+				const int32 SourceX = DestX * ScaleFactor;
+				const int32 SourceY = DestY * ScaleFactor;
 
-				for ( uint32 KernelY = 0; KernelY < Kernel.GetFilterTableSize();  ++KernelY )
-				{
-					for ( uint32 KernelX = 0; KernelX < Kernel.GetFilterTableSize();  ++KernelX )
-					{
-						float Weight = Kernel.GetAt( KernelX, KernelY );
-						FLinearColor Sample = LookupSourceMip<AddressMode>( SourceImageData, SourceX + KernelX - KernelCenter, SourceY + KernelY - KernelCenter );
-						SharpenedColor += Weight * Sample;
-					}
-				}
+				FLinearColor FilteredColor(0, 0, 0, 0);
 
-				float NewLuminance = SharpenedColor.ComputeLuminance();
+				if ( bSharpenWithoutColorShift )
+				{
+					const FLinearColor SharpenedColor = ApplyKernel<AddressMode>( SourceImageData, Kernel, SourceX, SourceY, KernelCenter );
 
-				// simple 2x2 kernel to compute the color
-				FilteredColor =
-					( LookupSourceMip<AddressMode>( SourceImageData, SourceX + 0, SourceY + 0 )
-					+ LookupSourceMip<AddressMode>( SourceImageData, SourceX + 1, SourceY + 0 )
-					+ LookupSourceMip<AddressMode>( SourceImageData, SourceX + 0, SourceY + 1 )
-					+ LookupSourceMip<AddressMode>( SourceImageData, SourceX + 1, SourceY + 1 ) ) * 0.25f;
+					float NewLuminance = SharpenedColor.ComputeLuminance();
 
-				float OldLuminance = FilteredColor.ComputeLuminance();
+					// simple 2x2 kernel to compute the color
+					FilteredColor =
+						( LookupSourceMip<AddressMode>( SourceImageData, SourceX + 0, SourceY + 0 )
+						+ LookupSourceMip<AddressMode>( SourceImageData, SourceX + 1, SourceY + 0 )
+						+ LookupSourceMip<AddressMode>( SourceImageData, SourceX + 0, SourceY + 1 )
+						+ LookupSourceMip<AddressMode>( SourceImageData, SourceX + 1, SourceY + 1 ) ) * 0.25f;
 
-				if ( OldLuminance > 0.001f )
-				{
-					float Factor = NewLuminance / OldLuminance;
-					FilteredColor.R *= Factor;
-					FilteredColor.G *= Factor;
-					FilteredColor.B *= Factor;
-				}
+					float OldLuminance = FilteredColor.ComputeLuminance();
 
-				// We also want to sharpen the alpha channel (was missing before)
-				FilteredColor.A = SharpenedColor.A;
-			}
-			else
-			{
-				for ( uint32 KernelY = 0; KernelY < Kernel.GetFilterTableSize();  ++KernelY )
-				{
-					for ( uint32 KernelX = 0; KernelX < Kernel.GetFilterTableSize();  ++KernelX )
+					if ( OldLuminance > 0.001f )
 					{
-						float Weight = Kernel.GetAt( KernelX, KernelY );
-						FLinearColor Sample = LookupSourceMip<AddressMode>( SourceImageData, SourceX + KernelX - KernelCenter, SourceY + KernelY - KernelCenter );
-						FilteredColor += Weight	* Sample;
+						float Factor = NewLuminance / OldLuminance;
+						FilteredColor.R *= Factor;
+						FilteredColor.G *= Factor;
+						FilteredColor.B *= Factor;
 					}
-				}
-			}
 
-			// Apply computed alpha scales to each channel		
-			FilteredColor.R *= AlphaScale.X;
-			FilteredColor.G *= AlphaScale.Y;
-			FilteredColor.B *= AlphaScale.Z;
-			FilteredColor.A *= AlphaScale.W;
+					// We also want to sharpen the alpha channel (was missing before)
+					FilteredColor.A = SharpenedColor.A;
+				}
+				else
+				{
+					FilteredColor = ApplyKernel<AddressMode>( SourceImageData, Kernel, SourceX, SourceY, KernelCenter );
+				}
 
+				// Apply computed alpha scales to each channel		
+				FilteredColor.R *= AlphaScale.X;
+				FilteredColor.G *= AlphaScale.Y;
+				FilteredColor.B *= AlphaScale.Z;
+				FilteredColor.A *= AlphaScale.W;
 
-			if ( bDitherMipMapAlpha )
-			{
-				// Dither the alpha of any pixel which passes an alpha threshold test.
-				const int32 DitherAlphaThreshold = 5.0f / 255.0f;
-				const float MinRandomAlpha = 85.0f;
-				const float MaxRandomAlpha = 255.0f;
 
-				if ( FilteredColor.A > DitherAlphaThreshold)
+				if ( bDitherMipMapAlpha )
 				{
-					FilteredColor.A = FMath::TruncToInt( FMath::Lerp( MinRandomAlpha, MaxRandomAlpha, RandomStream.GetFraction() ) );
+					// Dither the alpha of any pixel which passes an alpha threshold test.
+					const int32 DitherAlphaThreshold = 5.0f / 255.0f;
+					const float MinRandomAlpha = 85.0f;
+					const float MaxRandomAlpha = 255.0f;
+
+					if ( FilteredColor.A > DitherAlphaThreshold)
+					{
+						FilteredColor.A = FMath::TruncToInt( FMath::Lerp( MinRandomAlpha, MaxRandomAlpha, RandomStream.GetFraction() ) );
+					}
 				}
-			}
 
-			// Set the destination pixel.
-			//FLinearColor& DestColor = *(DestImageData.AsRGBA32F() + DestX + DestY * DestImageData.SizeX);
-			FLinearColor& DestColor = DestImageData.Access(DestX, DestY);
-			DestColor = FilteredColor;
+				// Set the destination pixel.
+				//FLinearColor& DestColor = *(DestImageData.AsRGBA32F() + DestX + DestY * DestImageData.SizeX);
+				FLinearColor& DestColor = DestImageData.Access(DestX, DestY);
+				DestColor = FilteredColor;
+			}
 		}
-	}
+	}, NumTasks == 1);
 }
 
 // to switch conveniently between different texture wrapping modes for the mip map generation
@@ -1783,18 +1809,27 @@ static bool CompressMipChain(
 // only useful for normal maps, fixed bad input (denormalized normals) and improved quality (quantization artifacts)
 static void NormalizeMip(FImage& InOutMip)
 {
-	const uint32 NumPixels = InOutMip.SizeX * InOutMip.SizeY * InOutMip.NumSlices;
+	const int32 NumPixels = InOutMip.SizeX * InOutMip.SizeY * InOutMip.NumSlices;
 	FLinearColor* ImageColors = InOutMip.AsRGBA32F();
-	for(uint32 CurPixelIndex = 0; CurPixelIndex < NumPixels; ++CurPixelIndex)
+
+	const bool bParallel = FTaskGraphInterface::IsRunning() && NumPixels >= 2 * TexelsPerParallelTask;
+	const int32 PixelsPerTask = bParallel ? TexelsPerParallelTask : FMath::Max(1, NumPixels);
+	const int32 NumTasks = FMath::DivideAndRoundUp(NumPixels, PixelsPerTask);
+
+	ParallelFor(NumTasks, [ImageColors, NumPixels, PixelsPerTask](int32 TaskIndex)
 	{
-		FLinearColor& Color = ImageColors[CurPixelIndex];
+		const int32 EndPixelIndex = FMath::Min(NumPixels, (TaskIndex + 1) * PixelsPerTask);
+		for(int32 CurPixelIndex = TaskIndex * PixelsPerTask; CurPixelIndex < EndPixelIndex; ++CurPixelIndex)
+		{
+			FLinearColor& Color = ImageColors[CurPixelIndex];
 
-		FVector Normal = FVector(Color.R * 2.0f - 1.0f, Color.G * 2.0f - 1.0f, Color.B * 2.0f - 1.0f);
+			FVector Normal = FVector(Color.R * 2.0f - 1.0f, Color.G * 2.0f - 1.0f, Color.B * 2.0f - 1.0f);
 
-		Normal = Normal.GetSafeNormal();
+			Normal = Normal.GetSafeNormal();
 
-		Color = FLinearColor(Normal.X * 0.5f + 0.5f, Normal.Y * 0.5f + 0.5f, Normal.Z * 0.5f + 0.5f, Color.A);
-	}
+			Color = FLinearColor(Normal.X * 0.5f + 0.5f, Normal.Y * 0.5f + 0.5f, Normal.Z * 0.5f + 0.5f, Color.A);
+		}
+	}, NumTasks <= 1);
 }
 
 /**
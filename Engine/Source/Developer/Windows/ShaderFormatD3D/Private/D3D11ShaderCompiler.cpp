@@ -985,6 +985,28 @@ void CompileD3D11Shader(const FShaderCompilerInput& Input,FShaderCompilerOutput&
 		CompileFlags |= TranslateCompilerFlagD3D11((ECompilerFlags)Input.Environment.CompilerFlags[FlagIndex]);
 	}
 
+	// Outputs of earlier compiles are reused when the final source and everything else fed to the compiler match. Not
+	// when dumping debug info, as the files are written by the compile.
+	const bool bUseOutputCache = Input.Environment.CompilerFlags.Contains(CFLAG_PreprocessedOutputCache) && Input.DumpDebugInfoPath.Len() == 0;
+	FSHAHash OutputCacheKey;
+	if (bUseOutputCache)
+	{
+		TArray<uint8> FormatKey;
+		FMemoryWriter Ar(FormatKey);
+		FString ShaderProfileString(ShaderProfile);
+		Ar << CompileFlags;
+		Ar << EntryPointName;
+		Ar << ShaderProfileString;
+		Ar << CompilerPath;
+		Ar << GD3DCheckForDoubles;
+
+		OutputCacheKey = GetPreprocessedOutputCacheKey(PreprocessedShaderSource, Input, FormatKey);
+		if (LoadPreprocessedOutputCache(OutputCacheKey, Output))
+		{
+			return;
+		}
+	}
+
 	TArray<FString> FilteredErrors;
 	if (!CompileAndProcessD3DShader(PreprocessedShaderSource, CompilerPath, CompileFlags, Input, EntryPointName, ShaderProfile, false, FilteredErrors, Output))
 	{
@@ -1026,6 +1048,11 @@ void CompileD3D11Shader(const FShaderCompilerInput& Input,FShaderCompilerOutput&
 		}
 		Output.Errors.Add(NewError);
 	}
+
+	if (bUseOutputCache)
+	{
+		SavePreprocessedOutputCache(OutputCacheKey, Output);
+	}
 }
 
 void CompileShader_Windows_SM5(const FShaderCompilerInput& Input,FShaderCompilerOutput& Output,const FString& WorkingDirectory)
@@ -435,6 +435,22 @@ void FMeshBuildSettingsLayout::GenerateChildContent( IDetailChildrenBuilder& Chi
 		];
 	}
 
+	{
+		ChildrenBuilder.AddChildContent( LOCTEXT("BuildMeshlets", "Build Meshlets") )
+		.NameContent()
+		[
+			SNew(STextBlock)
+			.Font( IDetailLayoutBuilder::GetDetailFont() )
+			.Text(LOCTEXT("BuildMeshlets", "Build Meshlets"))
+		]
+		.ValueContent()
+		[
+			SNew(SCheckBox)
+			.IsChecked(this, &FMeshBuildSettingsLayout::ShouldBuildMeshlets)
+			.OnCheckStateChanged(this, &FMeshBuildSettingsLayout::OnBuildMeshletsChanged)
+		];
+	}
+
 	{
 		ChildrenBuilder.AddChildContent( LOCTEXT("GenerateLightmapUVs", "Generate Lightmap UVs") )
 		.NameContent()
@@ -661,6 +677,11 @@ ECheckBoxState FMeshBuildSettingsLayout::ShouldUseFullPrecisionUVs() const
 	return BuildSettings.bUseFullPrecisionUVs ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
 }
 
+ECheckBoxState FMeshBuildSettingsLayout::ShouldBuildMeshlets() const
+{
+	return BuildSettings.bBuildMeshlets ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
+
 ECheckBoxState FMeshBuildSettingsLayout::ShouldGenerateLightmapUVs() const
 {
 	return BuildSettings.bGenerateLightmapUVs ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
@@ -806,6 +827,19 @@ void FMeshBuildSettingsLayout::OnUseFullPrecisionUVsChanged(ECheckBoxState NewSt
 	}
 }
 
+void FMeshBuildSettingsLayout::OnBuildMeshletsChanged(ECheckBoxState NewState)
+{
+	const bool bBuildMeshlets = (NewState == ECheckBoxState::Checked) ? true : false;
+	if (BuildSettings.bBuildMeshlets != bBuildMeshlets)
+	{
+		if (FEngineAnalytics::IsAvailable())
+		{
+			FEngineAnalytics::GetProvider().RecordEvent(TEXT("Editor.Usage.StaticMesh.BuildSettings"), TEXT("bBuildMeshlets"), bBuildMeshlets ? TEXT("True") : TEXT("False"));
+		}
+		BuildSettings.bBuildMeshlets = bBuildMeshlets;
+	}
+}
+
 void FMeshBuildSettingsLayout::OnGenerateLightmapUVsChanged(ECheckBoxState NewState)
 {
 	const bool bGenerateLightmapUVs = (NewState == ECheckBoxState::Checked) ? true : false;
@@ -0,0 +1,24 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectMacros.h"
+#include "Commandlets/Commandlet.h"
+#include "CompressionBenchmarkCommandlet.generated.h"
+
+/**
+ * Compares the decompression throughput and compression ratio of zlib and every registered ICompressionFormat
+ * on the compressed blocks of a cooked pak file.
+ *
+ * Usage: UE4Editor-Cmd <Project> -run=CompressionBenchmark <PakFilename> [-CompressionModule=<Module>] [-MaxMB=<N>] [-Iterations=<N>]
+ */
+UCLASS()
+class UCompressionBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_UCLASS_BODY()
+
+	//~ Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~ End UCommandlet Interface
+};
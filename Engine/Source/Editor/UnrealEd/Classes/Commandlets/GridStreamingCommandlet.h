@@ -0,0 +1,30 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectMacros.h"
+#include "Commandlets/Commandlet.h"
+#include "GridStreamingCommandlet.generated.h"
+
+class AActor;
+
+/**
+ * Commandlet for splitting actors of a persistent level into grid cell streaming levels, based on actor placement.
+ * Cells are streamed in by distance through ULevelStreamingGridCell.
+ *
+ * Usage: GridStreaming -Map=/Game/Maps/MyMap [-CellSize=25600] [-LoadingRange=51200] [-BuildHLOD]
+ */
+UCLASS()
+class UGridStreamingCommandlet : public UCommandlet
+{
+	GENERATED_UCLASS_BODY()
+
+	//~ Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~ End UCommandlet Interface
+
+private:
+	/** Whether the actor can be moved from the persistent level to a grid cell */
+	static bool CanMoveToCell(const AActor* Actor);
+};
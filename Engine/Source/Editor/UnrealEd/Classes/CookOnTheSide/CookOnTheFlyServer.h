@@ -849,6 +849,10 @@ private:
 		TArray<FChildCooker> ChildCookers;
 		TArray<FName> TargetPlatformNames;
 		TArray<FName> StartupPackages;
+		/** Derived data keys requested by each package in previous cooks, prefetched before the package is loaded. Map from package filename to keys */
+		TMap<FName, TArray<FString>> DerivedDataKeyJournal;
+		/** Derived data keys requested by the packages cooked in this cook, replace their entries in the journal when the cook finishes */
+		TMap<FName, TSet<FString>> RecordedDerivedDataKeys;
 	};
 	FCookByTheBookOptions* CookByTheBookOptions;
 
@@ -1311,6 +1315,16 @@ private:
 	*/
 	void StartChildCookers(int32 NumChildCookersToSpawn, const TArray<FName>& TargetPlatformNames, const FString& ExtraCmdParams = FString());
 
+	/**
+	* Splits the packages into partitions of about the same size on disk, keeping packages which hard reference each other in the same partition
+	* where possible so that the cookers don't all have to load the same dependencies
+	*
+	* @param PackageNames long package names to distribute, in dependency order
+	* @param NumPartitions number of partitions to create
+	* @param OutPartitions the packages of each partition, in the same order as PackageNames
+	*/
+	void PartitionPackagesForCookers(const TArray<FName>& PackageNames, int32 NumPartitions, TArray<TArray<FName>>& OutPartitions) const;
+
 	/**
 	* TickChildCookers
 	* output the information form the child cookers to the main cooker output
@@ -1572,6 +1586,21 @@ private:
 	/** If true, the maximum file length of a package being saved will be reduced by 32 to compensate for compressed package intermediate files */
 	bool ShouldConsiderCompressedPackageFileLengthRequirements() const;
 
+	/** If true, packages cooked for platforms without editor only data store their properties in the unversioned format, see PKG_UnversionedProperties */
+	bool ShouldUseUnversionedPropertySerialization() const;
+
+	/** If true, the derived data a package requested in the previous cook is fetched as one batch before the package is loaded */
+	bool ShouldPrefetchDerivedData() const;
+
+	/** Filename of the journal of the derived data keys requested by each package, see FCookByTheBookOptions::DerivedDataKeyJournal */
+	FString GetDerivedDataKeyJournalFilename() const;
+
+	/** Loads the derived data key journal written by the previous cook */
+	void LoadDerivedDataKeyJournal();
+
+	/** Merges the keys recorded in this cook into the derived data key journal and saves it */
+	void SaveDerivedDataKeyJournal();
+
 	/**
 	*	Cook (save) the given package
 	*
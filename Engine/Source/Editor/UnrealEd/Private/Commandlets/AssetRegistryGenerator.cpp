@@ -25,6 +25,9 @@
 #include "Stats/StatsMisc.h"
 #include "UniquePtr.h"
 #include "Engine/AssetManager.h"
+#include "Serialization/LoadOrderManifest.h"
+#include "Serialization/CustomVersion.h"
+#include "UObject/Package.h"
 
 #include "JsonWriter.h"
 #include "JsonReader.h"
@@ -458,10 +461,33 @@ void FAssetRegistryGenerator::Initialize(const TArray<FName> &InStartupPackages)
 	UpdatePackageSourceHashes();
 }
 
+/** Hash of the serialization versions the cooker saves packages with, packages cooked with different versions have to be recooked */
+static FMD5Hash GetCookSchemaHash()
+{
+	FMD5 SchemaHash;
+	SchemaHash.Update((const uint8*)&GPackageFileUE4Version, sizeof(GPackageFileUE4Version));
+	SchemaHash.Update((const uint8*)&GPackageFileLicenseeUE4Version, sizeof(GPackageFileLicenseeUE4Version));
+
+	// Registration order depends on module load order, sort so the hash doesn't
+	TArray<FCustomVersion> CustomVersions = FCustomVersionContainer::GetRegistered().GetAllVersions().Array();
+	CustomVersions.Sort([](const FCustomVersion& A, const FCustomVersion& B) { return A.Key < B.Key; });
+	for (const FCustomVersion& CustomVersion : CustomVersions)
+	{
+		SchemaHash.Update((const uint8*)&CustomVersion.Key, sizeof(FGuid));
+		SchemaHash.Update((const uint8*)&CustomVersion.Version, sizeof(int32));
+	}
+
+	FMD5Hash Result;
+	Result.Set(SchemaHash);
+	return Result;
+}
+
 void FAssetRegistryGenerator::UpdatePackageSourceHashes()
 {
 	UAssetManager* AssetManager = bUseAssetManager ? &UAssetManager::Get() : nullptr;
 
+	const FMD5Hash CookSchemaHash = GetCookSchemaHash();
+
 	for (const TPair<FName, const FAssetPackageData*>& PackagePair : State.GetAssetPackageDataMap())
 	{
 		FName PackageName = PackagePair.Key;
@@ -469,9 +495,12 @@ void FAssetRegistryGenerator::UpdatePackageSourceHashes()
 
 		FMD5 PackageSourceHash;
 
-		// Include package guid
+		// Include package guid, it only changes when the package is saved so syncing content with new timestamps keeps the hash
 		PackageSourceHash.Update((uint8*)&PackageData->PackageGuid, sizeof(FGuid));
 
+		// Include the versions the package will be saved with
+		PackageSourceHash.Update(CookSchemaHash.GetBytes(), CookSchemaHash.GetSize());
+
 		if (AssetManager)
 		{
 			AssetManager->UpdatePackageSourceHash(PackageName, PackageSourceHash);
@@ -837,6 +866,236 @@ bool FAssetRegistryGenerator::WriteCookerOpenOrder()
 	return true;
 }
 
+void FAssetRegistryGenerator::AddPackageToLoadOrderRecursive(FName PackageName, TArray<FName>& OutLoadOrder, TSet<FName>& OutEncounteredNames) const
+{
+	bool bAlreadyEncountered = false;
+	OutEncounteredNames.Add(PackageName, &bAlreadyEncountered);
+	if (!bAlreadyEncountered)
+	{
+		TArray<FName> Dependencies;
+		AssetRegistry.GetDependencies(PackageName, Dependencies, EAssetRegistryDependencyType::Hard);
+
+		for (FName DependencyName : Dependencies)
+		{
+			// script packages and packages that weren't cooked have no files to load
+			if (AllCookedPackageSet.Contains(DependencyName))
+			{
+				AddPackageToLoadOrderRecursive(DependencyName, OutLoadOrder, OutEncounteredNames);
+			}
+		}
+
+		OutLoadOrder.Add(PackageName);
+	}
+}
+
+bool FAssetRegistryGenerator::WriteLoadOrderManifests()
+{
+	const FString PlatformName = TargetPlatform->PlatformName();
+	int32 NumManifests = 0;
+
+	for (const TPair<FName, FString>& CookedPackage : AllCookedPackageSet)
+	{
+		if (!ContainsMap(CookedPackage.Key))
+		{
+			continue;
+		}
+
+		TArray<FName> LoadOrder;
+		TSet<FName> EncounteredNames;
+		AddPackageToLoadOrderRecursive(CookedPackage.Key, LoadOrder, EncounteredNames);
+
+		FLoadOrderManifest Manifest;
+		TMap<FName, int32> PackageToIndex;
+		for (FName PackageName : LoadOrder)
+		{
+			const FString SandboxPath = AllCookedPackageSet.FindChecked(PackageName).Replace(TEXT("[Platform]"), *PlatformName);
+
+			FLoadOrderManifestPackage Package;
+			Package.PackageName = PackageName;
+			Package.bIsMap = ContainsMap(PackageName);
+			Package.HeaderSize = IFileManager::Get().FileSize(*(SandboxPath + (Package.bIsMap ? FPackageName::GetMapPackageExtension() : FPackageName::GetAssetPackageExtension())));
+			if (Package.HeaderSize <= 0)
+			{
+				// failed to cook
+				continue;
+			}
+			Package.ExportsSize = FMath::Max<int64>(IFileManager::Get().FileSize(*(SandboxPath + TEXT(".uexp"))), 0);
+
+			TArray<FName> Dependencies;
+			AssetRegistry.GetDependencies(PackageName, Dependencies, EAssetRegistryDependencyType::Hard);
+			for (FName DependencyName : Dependencies)
+			{
+				if (const int32* DependencyIndex = PackageToIndex.Find(DependencyName))
+				{
+					Package.Dependencies.AddUnique(*DependencyIndex);
+				}
+			}
+
+			PackageToIndex.Add(PackageName, Manifest.Packages.Add(Package));
+		}
+
+		const FString ManifestFilename = CookedPackage.Value.Replace(TEXT("[Platform]"), *PlatformName) + FLoadOrderManifest::GetManifestExtension();
+		if (!Manifest.Save(*ManifestFilename))
+		{
+			UE_LOG(LogAssetRegistryGenerator, Warning, TEXT("Failed to save load order manifest %s."), *ManifestFilename);
+			return false;
+		}
+		NumManifests++;
+	}
+
+	UE_LOG(LogAssetRegistryGenerator, Display, TEXT("Saved %d load order manifests."), NumManifests);
+	return true;
+}
+
+void FAssetRegistryGenerator::UpdateCookedPackageStats(FName PackageName, const FSavePackageResultStruct& SaveResult)
+{
+	FAssetPackageData* PackageData = GetAssetPackageData(PackageName);
+	PackageData->DiskSize = SaveResult.TotalFileSize;
+
+	FCookedPackageStats& Stats = CookedPackageStats.FindOrAdd(PackageName);
+	Stats.BulkDataSize = SaveResult.BulkDataSize;
+	Stats.ExportCount = SaveResult.ExportCount;
+	Stats.ImportCount = SaveResult.ImportCount;
+}
+
+bool FAssetRegistryGenerator::WriteCookedPackageReport()
+{
+	struct FPackageReportRow
+	{
+		FName PackageName;
+		int64 CookedSize;
+		int32 NumHardDependencies;
+		int32 NumHardReferencers;
+		int32 NumPackagesLoaded;
+		int64 LoadedSize;
+	};
+
+	TMap<FName, TArray<FName>> HardDependencies;
+	TMap<FName, int32> NumHardReferencers;
+	for (const TPair<FName, FString>& CookedPackage : AllCookedPackageSet)
+	{
+		TArray<FName> Dependencies;
+		AssetRegistry.GetDependencies(CookedPackage.Key, Dependencies, EAssetRegistryDependencyType::Hard);
+
+		TArray<FName>& CookedDependencies = HardDependencies.Add(CookedPackage.Key);
+		for (FName DependencyName : Dependencies)
+		{
+			// script packages and packages that weren't cooked have no files to load
+			if (DependencyName != CookedPackage.Key && AllCookedPackageSet.Contains(DependencyName))
+			{
+				CookedDependencies.AddUnique(DependencyName);
+			}
+		}
+		for (FName DependencyName : CookedDependencies)
+		{
+			NumHardReferencers.FindOrAdd(DependencyName)++;
+		}
+	}
+
+	// Breadth first from every map and startup package, so each package's chain is one of the shortest ways it gets pulled in
+	TMap<FName, FName> ReferencedBy;
+	TArray<FName> Queue;
+	for (const TPair<FName, FString>& CookedPackage : AllCookedPackageSet)
+	{
+		if (ContainsMap(CookedPackage.Key) || StartupPackages.Contains(CookedPackage.Key))
+		{
+			ReferencedBy.Add(CookedPackage.Key, NAME_None);
+			Queue.Add(CookedPackage.Key);
+		}
+	}
+	for (int32 QueueIndex = 0; QueueIndex < Queue.Num(); ++QueueIndex)
+	{
+		const FName PackageName = Queue[QueueIndex];
+		for (FName DependencyName : HardDependencies.FindChecked(PackageName))
+		{
+			if (!ReferencedBy.Contains(DependencyName))
+			{
+				ReferencedBy.Add(DependencyName, PackageName);
+				Queue.Add(DependencyName);
+			}
+		}
+	}
+
+	TArray<FPackageReportRow> Rows;
+	Rows.Reserve(AllCookedPackageSet.Num());
+	for (const TPair<FName, FString>& CookedPackage : AllCookedPackageSet)
+	{
+		const FAssetPackageData* PackageData = State.GetAssetPackageData(CookedPackage.Key);
+		if (!PackageData || PackageData->DiskSize < 0)
+		{
+			continue;
+		}
+
+		// Estimate the cost of loading the package by everything the runtime would have to load with it
+		TArray<FName> LoadOrder;
+		TSet<FName> EncounteredNames;
+		AddPackageToLoadOrderRecursive(CookedPackage.Key, LoadOrder, EncounteredNames);
+
+		FPackageReportRow& Row = Rows[Rows.AddUninitialized()];
+		Row.PackageName = CookedPackage.Key;
+		Row.CookedSize = PackageData->DiskSize;
+		Row.NumHardDependencies = HardDependencies.FindChecked(CookedPackage.Key).Num();
+		Row.NumHardReferencers = NumHardReferencers.FindRef(CookedPackage.Key);
+		Row.NumPackagesLoaded = LoadOrder.Num();
+		Row.LoadedSize = 0;
+		for (FName LoadedPackageName : LoadOrder)
+		{
+			const FAssetPackageData* LoadedPackageData = State.GetAssetPackageData(LoadedPackageName);
+			Row.LoadedSize += LoadedPackageData ? FMath::Max<int64>(LoadedPackageData->DiskSize, 0) : 0;
+		}
+	}
+
+	// Most expensive packages to load first
+	Rows.Sort([](const FPackageReportRow& A, const FPackageReportRow& B)
+	{
+		return A.LoadedSize > B.LoadedSize;
+	});
+
+	FString CSVString(TEXT("Package Name, Cooked Size, Bulk Data Size, Exports, Imports, Hard Dependencies, Hard Referencers, Packages Loaded, Loaded Size, Reference Chain\n"));
+	for (const FPackageReportRow& Row : Rows)
+	{
+		const FCookedPackageStats* Stats = CookedPackageStats.Find(Row.PackageName);
+
+		FString ReferenceChain;
+		const FName* Referencer = ReferencedBy.Find(Row.PackageName);
+		if (Referencer == nullptr)
+		{
+			ReferenceChain = TEXT("Not referenced by a map or startup package");
+		}
+		else
+		{
+			ReferenceChain = Row.PackageName.ToString();
+			while (!Referencer->IsNone())
+			{
+				ReferenceChain = Referencer->ToString() + TEXT(" > ") + ReferenceChain;
+				Referencer = ReferencedBy.Find(*Referencer);
+			}
+		}
+
+		CSVString += FString::Printf(TEXT("%s,%lld,%lld,%d,%d,%d,%d,%d,%lld,%s\n"),
+			*Row.PackageName.ToString(),
+			Row.CookedSize,
+			Stats ? Stats->BulkDataSize : (int64)0,
+			Stats ? Stats->ExportCount : 0,
+			Stats ? Stats->ImportCount : 0,
+			Row.NumHardDependencies,
+			Row.NumHardReferencers,
+			Row.NumPackagesLoaded,
+			Row.LoadedSize,
+			*ReferenceChain);
+	}
+
+	const FString ReportFilename = FPaths::Combine(*FPaths::GameLogDir(), TEXT("CookReport"), *TargetPlatform->PlatformName(), TEXT("CookedPackages.csv"));
+	if (!FFileHelper::SaveStringToFile(CSVString, *ReportFilename))
+	{
+		UE_LOG(LogAssetRegistryGenerator, Warning, TEXT("Failed to save cooked package report %s."), *ReportFilename);
+		return false;
+	}
+
+	UE_LOG(LogAssetRegistryGenerator, Display, TEXT("Saved cooked package report for %d packages to %s."), Rows.Num(), *ReportFilename);
+	return true;
+}
+
 /** Helper function which reroots a sandbox path to the staging area directory which UnrealPak expects */
 inline void ConvertFilenameToPakFormat(FString& InOutPath)
 {
@@ -0,0 +1,260 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	CompressionBenchmarkCommandlet.cpp: Commandlet comparing compression formats on a cooked pak.
+=============================================================================*/
+
+#include "Commandlets/CompressionBenchmarkCommandlet.h"
+#include "HAL/FileManager.h"
+#include "Misc/Compression.h"
+#include "Misc/ICompressionFormat.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/AES.h"
+#include "Features/IModularFeatures.h"
+#include "Modules/ModuleManager.h"
+#include "UniquePtr.h"
+#include "IPlatformFilePak.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogCompressionBenchmark, Log, All);
+
+namespace CompressionBenchmark
+{
+	/** Uncompressed contents of one pak compression block. */
+	struct FBlock
+	{
+		TArray<uint8> Data;
+	};
+
+	/** Results of one compression format. */
+	struct FResult
+	{
+		FString Name;
+		int64 CompressedBytes;
+		int64 UncompressedBytes;
+		double UncompressSeconds;
+		int32 NumFailures;
+
+		FResult()
+			: CompressedBytes(0)
+			, UncompressedBytes(0)
+			, UncompressSeconds(0.0)
+			, NumFailures(0)
+		{
+		}
+
+		void Log() const
+		{
+			const double Ratio = CompressedBytes > 0 ? double(UncompressedBytes) / double(CompressedBytes) : 0.0;
+			const double Throughput = UncompressSeconds > 0.0 ? double(UncompressedBytes) / (1024.0 * 1024.0) / UncompressSeconds : 0.0;
+			UE_LOG(LogCompressionBenchmark, Display, TEXT("%-24s %12lld -> %12lld bytes, ratio %5.2f, decompression %9.1f MB/s%s"),
+				*Name, UncompressedBytes, CompressedBytes, Ratio, Throughput, NumFailures ? *FString::Printf(TEXT(", %d failures"), NumFailures) : TEXT(""));
+		}
+	};
+
+	/**
+	 * Recompresses every block with a format and times decompressing all of them.
+	 */
+	static FResult Benchmark(const FString& Name, ECompressionFlags Flags, const TArray<FBlock>& Blocks, int32 Iterations)
+	{
+		FResult Result;
+		Result.Name = Name;
+
+		TArray<TArray<uint8>> CompressedBlocks;
+		CompressedBlocks.SetNum(Blocks.Num());
+		for (int32 BlockIndex = 0; BlockIndex < Blocks.Num(); ++BlockIndex)
+		{
+			const TArray<uint8>& Uncompressed = Blocks[BlockIndex].Data;
+			TArray<uint8>& Compressed = CompressedBlocks[BlockIndex];
+
+			int32 CompressedSize = FCompression::CompressMemoryBound(Flags, Uncompressed.Num());
+			Compressed.SetNumUninitialized(CompressedSize);
+			if (!FCompression::CompressMemory(Flags, Compressed.GetData(), CompressedSize, Uncompressed.GetData(), Uncompressed.Num()))
+			{
+				Compressed.Reset();
+				++Result.NumFailures;
+				continue;
+			}
+			Compressed.SetNum(CompressedSize, false);
+			Result.CompressedBytes += CompressedSize;
+			Result.UncompressedBytes += Uncompressed.Num();
+		}
+
+		TArray<uint8> Scratch;
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			for (int32 BlockIndex = 0; BlockIndex < Blocks.Num(); ++BlockIndex)
+			{
+				const TArray<uint8>& Compressed = CompressedBlocks[BlockIndex];
+				if (!Compressed.Num())
+				{
+					continue;
+				}
+
+				Scratch.SetNumUninitialized(Blocks[BlockIndex].Data.Num(), false);
+				const double StartTime = FPlatformTime::Seconds();
+				const bool bUncompressed = FCompression::UncompressMemory(Flags, Scratch.GetData(), Scratch.Num(), Compressed.GetData(), Compressed.Num());
+				Result.UncompressSeconds += FPlatformTime::Seconds() - StartTime;
+
+				if (Iteration == 0 && (!bUncompressed || FMemory::Memcmp(Scratch.GetData(), Blocks[BlockIndex].Data.GetData(), Scratch.Num()) != 0))
+				{
+					++Result.NumFailures;
+				}
+			}
+		}
+
+		// report per pass numbers so they can be compared with the original pak
+		Result.UncompressSeconds /= FMath::Max(Iterations, 1);
+		return Result;
+	}
+}
+
+UCompressionBenchmarkCommandlet::UCompressionBenchmarkCommandlet(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	LogToConsole = false;
+}
+
+int32 UCompressionBenchmarkCommandlet::Main(const FString& Params)
+{
+	using namespace CompressionBenchmark;
+
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	ParseCommandLine(*Params, Tokens, Switches);
+
+	if (Tokens.Num() < 1)
+	{
+		UE_LOG(LogCompressionBenchmark, Error, TEXT("Usage: -run=CompressionBenchmark <PakFilename> [-CompressionModule=<Module>] [-MaxMB=<N>] [-Iterations=<N>]"));
+		return 1;
+	}
+
+	FString CompressionModule;
+	if (FParse::Value(*Params, TEXT("CompressionModule="), CompressionModule) && !FModuleManager::Get().LoadModule(*CompressionModule).IsValid())
+	{
+		UE_LOG(LogCompressionBenchmark, Warning, TEXT("Unable to load compression module \"%s\"."), *CompressionModule);
+	}
+
+	int32 MaxMB = 256;
+	FParse::Value(*Params, TEXT("MaxMB="), MaxMB);
+	const int64 MaxBytes = int64(MaxMB) * 1024 * 1024;
+
+	int32 Iterations = 3;
+	FParse::Value(*Params, TEXT("Iterations="), Iterations);
+	Iterations = FMath::Max(Iterations, 1);
+
+	const FString& PakFilename = Tokens[0];
+	TUniquePtr<FArchive> PakReader(IFileManager::Get().CreateFileReader(*PakFilename));
+	if (!PakReader)
+	{
+		UE_LOG(LogCompressionBenchmark, Error, TEXT("Unable to open pak file \"%s\"."), *PakFilename);
+		return 1;
+	}
+
+	FPakFile PakFile(PakReader.Get());
+	if (!PakFile.IsValid())
+	{
+		UE_LOG(LogCompressionBenchmark, Error, TEXT("\"%s\" is not a valid pak file."), *PakFilename);
+		return 1;
+	}
+
+	const ANSICHAR* EncryptionKey = nullptr;
+	FCoreDelegates::FPakEncryptionKeyDelegate& KeyDelegate = FCoreDelegates::GetPakEncryptionKeyDelegate();
+	if (KeyDelegate.IsBound())
+	{
+		EncryptionKey = KeyDelegate.Execute();
+	}
+
+	// decompress the blocks as they are stored, this is the baseline the other formats are compared against
+	TArray<FBlock> Blocks;
+	TArray<uint8> CompressedBuffer;
+	FResult Original;
+	Original.Name = TEXT("Pak (as stored)");
+	int64 TotalBytes = 0;
+	int32 NumSkipped = 0;
+
+	for (FPakFile::FFileIterator It(PakFile); It && TotalBytes < MaxBytes; ++It)
+	{
+		const FPakEntry& Entry = It.Info();
+		if (Entry.CompressionMethod == COMPRESS_None)
+		{
+			continue;
+		}
+		if ((Entry.bEncrypted && !EncryptionKey) || ((Entry.CompressionMethod & COMPRESS_Custom) && !FCompression::GetCustomCompressionFormat((ECompressionFlags)Entry.CompressionMethod)))
+		{
+			++NumSkipped;
+			continue;
+		}
+
+		for (int32 BlockIndex = 0; BlockIndex < Entry.CompressionBlocks.Num(); ++BlockIndex)
+		{
+			const FPakCompressedBlock& CompressedBlock = Entry.CompressionBlocks[BlockIndex];
+			const int32 CompressedBlockSize = int32(CompressedBlock.CompressedEnd - CompressedBlock.CompressedStart);
+			const int32 UncompressedBlockSize = (int32)FMath::Min<int64>(Entry.UncompressedSize - int64(Entry.CompressionBlockSize) * BlockIndex, Entry.CompressionBlockSize);
+			const int32 SizeToRead = Entry.bEncrypted ? Align(CompressedBlockSize, FAES::AESBlockSize) : CompressedBlockSize;
+
+			CompressedBuffer.SetNumUninitialized(SizeToRead, false);
+			PakReader->Seek(CompressedBlock.CompressedStart);
+			PakReader->Serialize(CompressedBuffer.GetData(), SizeToRead);
+			if (Entry.bEncrypted)
+			{
+				FAES::DecryptData(CompressedBuffer.GetData(), SizeToRead, EncryptionKey);
+			}
+
+			FBlock& Block = Blocks[Blocks.AddDefaulted()];
+			Block.Data.SetNumUninitialized(UncompressedBlockSize);
+
+			const double StartTime = FPlatformTime::Seconds();
+			const bool bUncompressed = FCompression::UncompressMemory((ECompressionFlags)Entry.CompressionMethod, Block.Data.GetData(), UncompressedBlockSize, CompressedBuffer.GetData(), CompressedBlockSize, false, FPlatformMisc::GetPlatformCompression()->GetCompressionBitWindow());
+			Original.UncompressSeconds += FPlatformTime::Seconds() - StartTime;
+
+			if (!bUncompressed)
+			{
+				UE_LOG(LogCompressionBenchmark, Warning, TEXT("Failed to decompress block %d of \"%s\"."), BlockIndex, *It.Filename());
+				++Original.NumFailures;
+				Blocks.Pop(false);
+				continue;
+			}
+
+			Original.CompressedBytes += CompressedBlockSize;
+			Original.UncompressedBytes += UncompressedBlockSize;
+			TotalBytes += UncompressedBlockSize;
+		}
+	}
+
+	if (NumSkipped)
+	{
+		UE_LOG(LogCompressionBenchmark, Warning, TEXT("Skipped %d entries that are encrypted without a key or use a compression format that isn't registered."), NumSkipped);
+	}
+	if (!Blocks.Num())
+	{
+		UE_LOG(LogCompressionBenchmark, Error, TEXT("\"%s\" has no compressed blocks to benchmark."), *PakFilename);
+		return 1;
+	}
+
+	UE_LOG(LogCompressionBenchmark, Display, TEXT("Benchmarking %d blocks (%lld bytes) of \"%s\", %d iterations."), Blocks.Num(), TotalBytes, *PakFilename, Iterations);
+	Original.Log();
+
+	Benchmark(TEXT("Zlib"), COMPRESS_ZLIB, Blocks, Iterations).Log();
+	Benchmark(TEXT("Zlib (BiasSpeed)"), (ECompressionFlags)(COMPRESS_ZLIB | COMPRESS_BiasSpeed), Blocks, Iterations).Log();
+
+	IModularFeatures& ModularFeatures = IModularFeatures::Get();
+	const int32 NumFormats = ModularFeatures.GetModularFeatureImplementationCount(ICompressionFormat::GetModularFeatureName());
+	for (int32 FormatIndex = 0; FormatIndex < NumFormats; ++FormatIndex)
+	{
+		ICompressionFormat* Format = static_cast<ICompressionFormat*>(ModularFeatures.GetModularFeatureImplementation(ICompressionFormat::GetModularFeatureName(), FormatIndex));
+		ECompressionFlags Flags = COMPRESS_None;
+		if (FCompression::GetCustomCompressionFlags(Format->GetCompressionFormatName(), Flags))
+		{
+			const FString Name = Format->GetCompressionFormatName().ToString();
+			Benchmark(Name, Flags, Blocks, Iterations).Log();
+			Benchmark(Name + TEXT(" (BiasMemory)"), (ECompressionFlags)(Flags | COMPRESS_BiasMemory), Blocks, Iterations).Log();
+		}
+	}
+
+	if (!NumFormats)
+	{
+		UE_LOG(LogCompressionBenchmark, Display, TEXT("No compression formats are registered, use -CompressionModule=<Module> to load one."));
+	}
+
+	return 0;
+}
@@ -0,0 +1,184 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "Commandlets/GridStreamingCommandlet.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "Engine/World.h"
+#include "Engine/Level.h"
+#include "Engine/Brush.h"
+#include "GameFramework/Info.h"
+#include "GameFramework/WorldSettings.h"
+#include "Engine/LevelStreamingGridCell.h"
+#include "Engine/LevelScriptActor.h"
+#include "Editor.h"
+#include "EditorLevelUtils.h"
+#include "FileHelpers.h"
+#include "LevelUtils.h"
+#include "HierarchicalLOD.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogGridStreamingCommandlet, Log, All);
+
+UGridStreamingCommandlet::UGridStreamingCommandlet(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	LogToConsole = true;
+}
+
+bool UGridStreamingCommandlet::CanMoveToCell(const AActor* Actor)
+{
+	if (Actor == nullptr || Actor->IsPendingKill() || Actor->GetRootComponent() == nullptr)
+	{
+		return false;
+	}
+
+	// Level wide actors and replicated actors stay in the persistent level, streaming them would change gameplay and networking
+	if (Actor->IsA<AInfo>() || Actor->IsA<ABrush>() || Actor->IsA<ALevelScriptActor>() || Actor->bAlwaysRelevant || Actor->GetIsReplicated())
+	{
+		return false;
+	}
+
+	// Attached actors move with their parent
+	return Actor->GetAttachParentActor() == nullptr;
+}
+
+int32 UGridStreamingCommandlet::Main(const FString& Params)
+{
+	FString MapName;
+	if (!FParse::Value(*Params, TEXT("Map="), MapName))
+	{
+		UE_LOG(LogGridStreamingCommandlet, Error, TEXT("Syntax: GridStreaming -Map=/Game/Maps/MyMap [-CellSize=25600] [-LoadingRange=51200] [-BuildHLOD]"));
+		return 1;
+	}
+
+	float CellSize = 25600.0f;
+	FParse::Value(*Params, TEXT("CellSize="), CellSize);
+	float LoadingRange = CellSize * 2.0f;
+	FParse::Value(*Params, TEXT("LoadingRange="), LoadingRange);
+	const bool bBuildHLOD = FParse::Param(*Params, TEXT("BuildHLOD"));
+
+	if (CellSize <= 0.0f)
+	{
+		UE_LOG(LogGridStreamingCommandlet, Error, TEXT("CellSize must be positive"));
+		return 1;
+	}
+
+	UPackage* Package = LoadPackage(nullptr, *MapName, LOAD_None);
+	UWorld* World = Package ? UWorld::FindWorldInPackage(Package) : nullptr;
+	if (World == nullptr)
+	{
+		UE_LOG(LogGridStreamingCommandlet, Error, TEXT("Failed to load map %s"), *MapName);
+		return 2;
+	}
+
+	// Setup the world
+	World->WorldType = EWorldType::Editor;
+	World->AddToRoot();
+	if (!World->bIsWorldInitialized)
+	{
+		UWorld::InitializationValues IVS;
+		IVS.RequiresHitProxies(false);
+		IVS.ShouldSimulatePhysics(false);
+		IVS.EnableTraceCollision(false);
+		IVS.CreateNavigation(false);
+		IVS.CreateAISystem(false);
+		IVS.AllowAudioPlayback(false);
+		IVS.CreatePhysicsScene(true);
+
+		World->InitWorld(IVS);
+		World->PersistentLevel->UpdateModelComponents();
+		World->UpdateWorldComponents(true, false);
+	}
+
+	FWorldContext& WorldContext = GEditor->GetEditorWorldContext(true);
+	WorldContext.SetCurrentWorld(World);
+	GWorld = World;
+
+	// Bucket actors of the persistent level by the cell containing their location
+	TMap<FIntPoint, TArray<AActor*>> CellActors;
+	for (AActor* Actor : World->PersistentLevel->Actors)
+	{
+		if (CanMoveToCell(Actor))
+		{
+			const FVector Location = Actor->GetActorLocation();
+			const FIntPoint CellCoords(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize));
+			CellActors.FindOrAdd(CellCoords).Add(Actor);
+		}
+	}
+
+	const FString MapPackageName = Package->GetName();
+	TArray<ULevel*> CellLevels;
+
+	for (const TPair<FIntPoint, TArray<AActor*>>& Cell : CellActors)
+	{
+		const FString CellPackageName = FString::Printf(TEXT("%s_Cell_%d_%d"), *MapPackageName, Cell.Key.X, Cell.Key.Y);
+		if (FLevelUtils::FindStreamingLevel(World, *CellPackageName))
+		{
+			UE_LOG(LogGridStreamingCommandlet, Warning, TEXT("Skipping cell %s, it is already a streaming level of %s"), *CellPackageName, *MapName);
+			continue;
+		}
+
+		FBox CellBounds(ForceInit);
+		GEditor->SelectNone(false, true, false);
+		for (AActor* Actor : Cell.Value)
+		{
+			GEditor->SelectActor(Actor, true, false, true);
+			CellBounds += Actor->GetComponentsBoundingBox();
+
+			TArray<AActor*> AttachedActors;
+			Actor->GetAttachedActors(AttachedActors);
+			for (AActor* AttachedActor : AttachedActors)
+			{
+				GEditor->SelectActor(AttachedActor, true, false, true);
+				CellBounds += AttachedActor->GetComponentsBoundingBox();
+			}
+		}
+
+		const FString CellFilename = FPackageName::LongPackageNameToFilename(CellPackageName, FPackageName::GetMapPackageExtension());
+		ULevel* CellLevel = EditorLevelUtils::CreateNewLevel(World, true, ULevelStreamingGridCell::StaticClass(), CellFilename);
+		ULevelStreamingGridCell* GridCell = CellLevel ? Cast<ULevelStreamingGridCell>(FLevelUtils::FindStreamingLevel(CellLevel)) : nullptr;
+		if (GridCell == nullptr)
+		{
+			UE_LOG(LogGridStreamingCommandlet, Error, TEXT("Failed to create cell %s"), *CellPackageName);
+			continue;
+		}
+
+		GridCell->CellCoords = Cell.Key;
+		GridCell->CellBounds = CellBounds;
+		GridCell->LoadingRange = LoadingRange;
+		CellLevels.Add(CellLevel);
+
+		UE_LOG(LogGridStreamingCommandlet, Display, TEXT("Moved %d actors to cell %s"), Cell.Value.Num(), *CellPackageName);
+	}
+
+	GEditor->SelectNone(false, true, false);
+
+	if (bBuildHLOD && CellLevels.Num())
+	{
+		// Proxies are built in each level, so every cell gets its own merged meshes
+		for (ULevel* CellLevel : CellLevels)
+		{
+			if (AWorldSettings* CellSettings = CellLevel->GetWorldSettings())
+			{
+				CellSettings->bEnableHierarchicalLODSystem = World->GetWorldSettings()->bEnableHierarchicalLODSystem;
+				CellSettings->HierarchicalLODSetup = World->GetWorldSettings()->HierarchicalLODSetup;
+			}
+		}
+
+		FHierarchicalLODBuilder Builder(World);
+		Builder.Build();
+	}
+
+	// Cell levels were saved empty when they were created
+	bool bSaved = true;
+	for (ULevel* CellLevel : CellLevels)
+	{
+		bSaved &= FEditorFileUtils::SaveLevel(CellLevel);
+	}
+	bSaved &= FEditorFileUtils::SaveLevel(World->PersistentLevel);
+
+	World->RemoveFromRoot();
+	WorldContext.SetCurrentWorld(nullptr);
+	GWorld = nullptr;
+
+	return bSaved ? 0 : 3;
+}
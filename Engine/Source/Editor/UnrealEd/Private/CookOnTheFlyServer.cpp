@@ -1521,12 +1521,28 @@ uint32 UCookOnTheFlyServer::TickCookOnTheSide( const float TimeSlice, uint32 &Co
 			//  if the package is already loaded then try to avoid reloading it :)
 			if ( ( Package == NULL ) || ( Package->IsFullyLoaded() == false ) )
 			{
+				// fetch the derived data this package used last time while it loads, instead of one key at a time when it is asked for
+				const bool bRecordDerivedDataKeys = IsCookByTheBookMode() && ShouldPrefetchDerivedData();
+				if ( bRecordDerivedDataKeys )
+				{
+					if ( const TArray<FString>* JournaledKeys = CookByTheBookOptions->DerivedDataKeyJournal.Find( ToBuild.GetFilename() ) )
+					{
+						GetDerivedDataCacheRef().Prefetch( *JournaledKeys );
+					}
+					GetDerivedDataCacheRef().RecordRequestedKeys( &CookByTheBookOptions->RecordedDerivedDataKeys.FindOrAdd( ToBuild.GetFilename() ) );
+				}
+
 				GIsCookerLoadingPackage = true;
 				SCOPE_TIMER(LoadPackage);
 				Package = LoadPackage( NULL, *BuildFilename, LOAD_None );
 				INC_INT_STAT(LoadPackage, 1);
 
 				GIsCookerLoadingPackage = false;
+
+				if ( bRecordDerivedDataKeys )
+				{
+					GetDerivedDataCacheRef().RecordRequestedKeys( nullptr );
+				}
 			}
 #if DEBUG_COOKONTHEFLY
 			else
@@ -1611,6 +1627,23 @@ uint32 UCookOnTheFlyServer::TickCookOnTheSide( const float TimeSlice, uint32 &Co
 		}
 
 
+		// the keys requested while caching the cooked platform data of a package are prefetched the next time it is cooked
+		const bool bRecordDerivedDataKeys = IsCookByTheBookMode() && ShouldPrefetchDerivedData();
+		auto RecordDerivedDataKeys = [&]( UPackage* Package )
+		{
+			if ( bRecordDerivedDataKeys )
+			{
+				GetDerivedDataCacheRef().RecordRequestedKeys( &CookByTheBookOptions->RecordedDerivedDataKeys.FindOrAdd( GetCachedStandardPackageFileFName( Package ) ) );
+			}
+		};
+		auto StopRecordingDerivedDataKeys = [&]()
+		{
+			if ( bRecordDerivedDataKeys )
+			{
+				GetDerivedDataCacheRef().RecordRequestedKeys( nullptr );
+			}
+		};
+
 		auto BeginPackageCacheForCookedPlatformData = [&]( UPackage* Package )
 		{
 			COOK_STAT(FScopedDurationTimer DurationTimer(DetailedCookStats::TickCookOnTheSideBeginPackageCacheForCookedPlatformDataTimeSec));
@@ -1642,7 +1675,9 @@ uint32 UCookOnTheFlyServer::TickCookOnTheSide( const float TimeSlice, uint32 &Co
 							return false;
 						}
 					}
+					RecordDerivedDataKeys(Package);
 					Obj->BeginCacheForCookedPlatformData(TargetPlatform);
+					StopRecordingDerivedDataKeys();
 				}
 
 				if ( Timer.IsTimeUp() )
@@ -1691,7 +1726,9 @@ uint32 UCookOnTheFlyServer::TickCookOnTheSide( const float TimeSlice, uint32 &Co
 					// These begin cache calls should be quick 
 					// because they will just be checking that the data is already cached and kicking off new multithreaded requests if not
 					// all sync requests should have been caught in the first begincache call above
+					RecordDerivedDataKeys(Package);
 					Obj->BeginCacheForCookedPlatformData(TargetPlatform);
+					StopRecordingDerivedDataKeys();
 					// We want to measure inclusive time for this function, but not accumulate into the BeginXXX timer, so subtract these times out of the BeginTimer.
 					COOK_STAT(DetailedCookStats::TickCookOnTheSideBeginPackageCacheForCookedPlatformDataTimeSec = CookerStatSavedValue);
 					if (Obj->IsCachedCookedPlatformDataLoaded(TargetPlatform) == false)
@@ -2073,8 +2110,7 @@ uint32 UCookOnTheFlyServer::TickCookOnTheSide( const float TimeSlice, uint32 &Co
 								FAssetRegistryGenerator* Generator = RegistryGenerators.FindRef(AllTargetPlatformNames[PlatformIndex]);
 								if (Generator)
 								{
-									FAssetPackageData* PackageData = Generator->GetAssetPackageData(Package->GetFName());
-									PackageData->DiskSize = SavePackageResult.TotalFileSize;
+									Generator->UpdateCookedPackageStats(Package->GetFName(), SavePackageResult);
 								}
 							}
 
@@ -2807,6 +2843,104 @@ bool UCookOnTheFlyServer::ShouldConsiderCompressedPackageFileLengthRequirements(
 	return bConsiderCompressedPackageFileLengthRequirements;
 }
 
+bool UCookOnTheFlyServer::ShouldUseUnversionedPropertySerialization() const
+{
+	bool bUseUnversionedPropertySerialization = false;
+	GConfig->GetBool(TEXT("CookSettings"), TEXT("bUseUnversionedPropertySerialization"), bUseUnversionedPropertySerialization, GEditorIni);
+	return bUseUnversionedPropertySerialization;
+}
+
+bool UCookOnTheFlyServer::ShouldPrefetchDerivedData() const
+{
+	bool bPrefetchDerivedData = true;
+	GConfig->GetBool(TEXT("CookSettings"), TEXT("bPrefetchDerivedData"), bPrefetchDerivedData, GEditorIni);
+	return bPrefetchDerivedData;
+}
+
+namespace DerivedDataKeyJournal
+{
+	static const uint32 Magic = 0x44444B4A; // 'DDKJ'
+	static const int32 Version = 1;
+}
+
+FString UCookOnTheFlyServer::GetDerivedDataKeyJournalFilename() const
+{
+	return FPaths::GameIntermediateDir() / TEXT("Cook") / TEXT("DerivedDataKeys.bin");
+}
+
+void UCookOnTheFlyServer::LoadDerivedDataKeyJournal()
+{
+	CookByTheBookOptions->DerivedDataKeyJournal.Empty();
+	CookByTheBookOptions->RecordedDerivedDataKeys.Empty();
+	if (!ShouldPrefetchDerivedData() || IsChildCooker())
+	{
+		return;
+	}
+
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*GetDerivedDataKeyJournalFilename(), FILEREAD_Silent));
+	if (!Reader)
+	{
+		return;
+	}
+
+	uint32 Magic = 0;
+	int32 Version = 0;
+	*Reader << Magic << Version;
+	if (Magic != DerivedDataKeyJournal::Magic || Version != DerivedDataKeyJournal::Version)
+	{
+		UE_LOG(LogCook, Display, TEXT("Ignoring derived data key journal %s, it was written by a different version."), *GetDerivedDataKeyJournalFilename());
+		return;
+	}
+
+	int32 NumPackages = 0;
+	*Reader << NumPackages;
+	for (int32 PackageIndex = 0; PackageIndex < NumPackages && !Reader->IsError(); ++PackageIndex)
+	{
+		FString PackageFilename;
+		TArray<FString> Keys;
+		*Reader << PackageFilename << Keys;
+		CookByTheBookOptions->DerivedDataKeyJournal.Add(FName(*PackageFilename), MoveTemp(Keys));
+	}
+
+	if (Reader->IsError())
+	{
+		UE_LOG(LogCook, Warning, TEXT("Derived data key journal %s is corrupt, ignoring it."), *GetDerivedDataKeyJournalFilename());
+		CookByTheBookOptions->DerivedDataKeyJournal.Empty();
+	}
+}
+
+void UCookOnTheFlyServer::SaveDerivedDataKeyJournal()
+{
+	if (!ShouldPrefetchDerivedData() || IsChildCooker() || !CookByTheBookOptions->RecordedDerivedDataKeys.Num())
+	{
+		return;
+	}
+
+	// packages cooked this time replace what was recorded for them before, the others keep their old keys
+	for (TPair<FName, TSet<FString>>& Recorded : CookByTheBookOptions->RecordedDerivedDataKeys)
+	{
+		CookByTheBookOptions->DerivedDataKeyJournal.Add(Recorded.Key, Recorded.Value.Array());
+	}
+	CookByTheBookOptions->RecordedDerivedDataKeys.Empty();
+
+	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*GetDerivedDataKeyJournalFilename()));
+	if (!Writer)
+	{
+		UE_LOG(LogCook, Warning, TEXT("Unable to write derived data key journal %s."), *GetDerivedDataKeyJournalFilename());
+		return;
+	}
+
+	uint32 Magic = DerivedDataKeyJournal::Magic;
+	int32 Version = DerivedDataKeyJournal::Version;
+	int32 NumPackages = CookByTheBookOptions->DerivedDataKeyJournal.Num();
+	*Writer << Magic << Version << NumPackages;
+	for (TPair<FName, TArray<FString>>& Entry : CookByTheBookOptions->DerivedDataKeyJournal)
+	{
+		FString PackageFilename = Entry.Key.ToString();
+		*Writer << PackageFilename << Entry.Value;
+	}
+}
+
 bool UCookOnTheFlyServer::MakePackageFullyLoaded(UPackage* Package)
 {
 	if ( Package->IsFullyLoaded() )
@@ -2974,6 +3108,17 @@ void UCookOnTheFlyServer::SaveCookedPackage(UPackage* Package, uint32 SaveFlags,
 						Package->ClearPackageFlags(PKG_FilterEditorOnly);
 					}
 
+					// unversioned property data is only readable by builds compiled from the same structs, which cooked game builds are
+					static bool bUseUnversionedPropertySerialization = ShouldUseUnversionedPropertySerialization();
+					if (bUseUnversionedPropertySerialization && !Target->HasEditorOnlyData())
+					{
+						Package->SetPackageFlags(PKG_UnversionedProperties);
+					}
+					else
+					{
+						Package->ClearPackageFlags(PKG_UnversionedProperties);
+					}
+
 					if (World)
 					{
 						// Fixup legacy lightmaps before saving
@@ -6147,6 +6292,8 @@ void UCookOnTheFlyServer::CookByTheBookFinished()
 	UPackage::WaitForAsyncFileWrites();
 
 	GetDerivedDataCacheRef().WaitForQuiescence(true);
+
+	SaveDerivedDataKeyJournal();
 	
 	GRedirectCollector.LogTimers();
 	UCookerSettings const* CookerSettings = GetDefault<UCookerSettings>();
@@ -6325,6 +6472,18 @@ void UCookOnTheFlyServer::CookByTheBookFinished()
 						Generator.WriteCookerOpenOrder();
 					}
 
+					// the runtime only consumes manifests when exports are split into .uexp files
+					if (IsEventDrivenLoaderEnabledInCookedBuilds())
+					{
+						Generator.WriteLoadOrderManifests();
+					}
+
+					if (FParse::Param(FCommandLine::Get(), TEXT("CookReport")))
+					{
+						SCOPE_TIMER(WriteCookedPackageReport);
+						Generator.WriteCookedPackageReport();
+					}
+
 				}
 				// If asset registry iteration is enabled, but this is a full build, don't save the old json as it is slow and won't be used
 				if (!IsCookFlagSet(ECookInitializationFlags::IterateOnAssetRegistry) && !CookerSettings->bUseAssetRegistryForIteration)
@@ -6618,6 +6777,8 @@ void UCookOnTheFlyServer::StartCookByTheBook( const FCookByTheBookStartupOptions
 
 	GenerateAssetRegistry();
 
+	LoadDerivedDataKeyJournal();
+
 	const UProjectPackagingSettings* const PackagingSettings = GetDefault<UProjectPackagingSettings>();
 
 	NeverCookPackageList.Empty();
@@ -7098,14 +7259,18 @@ void UCookOnTheFlyServer::StartChildCookers(int32 NumCookersToSpawn, const TArra
 		TargetPlatformString += TargetPlatformName.ToString();
 	}
 
+	// count our selves as a cooker, the last partition is left to us
+	TArray<TArray<FName>> Partitions;
+	PartitionPackagesForCookers(DistributeStandardFilenames, NumCookersToSpawn + 1, Partitions);
+
 	// allocate the memory here, this can't change while we are running the child threads which are handling input because they have a ptr to the childcookers array
 	CookByTheBookOptions->ChildCookers.Empty(NumCookersToSpawn);
 
 	// start the child cookers and give them each some distribution candidates
 	for (int32 CookerCounter = 0; CookerCounter < NumCookersToSpawn; ++CookerCounter )
 	{
-		// count our selves as a cooker
-		int32 NumFilesForCooker = DistributeStandardFilenames.Num() / ((NumCookersToSpawn+1) - CookerCounter);
+		const TArray<FName>& CookerPackageNames = Partitions[CookerCounter];
+		int32 NumFilesForCooker = CookerPackageNames.Num();
 
 		// don't spawn a cooker unless it has a minimum amount of files to do
 		if (NumFilesForCooker < 5)
@@ -7125,7 +7290,7 @@ void UCookOnTheFlyServer::StartChildCookers(int32 NumCookersToSpawn, const TArra
 
 		for (int32 I = 0; I < NumFilesForCooker; ++I)
 		{
-			FName PackageFName = DistributeStandardFilenames[I];
+			FName PackageFName = CookerPackageNames[I];
 			FString PackageName = PackageFName.ToString();
 
 			ResponseFileText += FString::Printf(TEXT("%s%s"), *PackageName, LINE_TERMINATOR);
@@ -7147,7 +7312,6 @@ void UCookOnTheFlyServer::StartChildCookers(int32 NumCookersToSpawn, const TArra
 			}
 			CookedPackages.Add(FFilePlatformCookedPackage(StandardPackageName, TargetPlatformNames, MoveTemp(Succeeded)));
 		}
-		DistributeStandardFilenames.RemoveAt(0, NumFilesForCooker);
 
 		UE_LOG(LogCook, Display, TEXT("Child cooker %d working on %d files"), CookerCounter, NumFilesForCooker);
 
@@ -7212,6 +7376,129 @@ void UCookOnTheFlyServer::StartChildCookers(int32 NumCookersToSpawn, const TArra
 
 
 
+void UCookOnTheFlyServer::PartitionPackagesForCookers(const TArray<FName>& PackageNames, int32 NumPartitions, TArray<TArray<FName>>& OutPartitions) const
+{
+	check(NumPartitions > 0);
+
+	OutPartitions.Empty(NumPartitions);
+	OutPartitions.AddDefaulted(NumPartitions);
+
+	// loading and saving a package has a cost regardless of its size
+	const int64 MinPackageCost = 16 * 1024;
+
+	TMap<FName, int32> PackageIndices;
+	PackageIndices.Reserve(PackageNames.Num());
+	for (int32 Index = 0; Index < PackageNames.Num(); ++Index)
+	{
+		PackageIndices.Add(PackageNames[Index], Index);
+	}
+
+	TArray<int32> ClusterParents;
+	ClusterParents.SetNumUninitialized(PackageNames.Num());
+	for (int32 Index = 0; Index < PackageNames.Num(); ++Index)
+	{
+		ClusterParents[Index] = Index;
+	}
+
+	auto FindCluster = [&ClusterParents](int32 Index)
+	{
+		while (ClusterParents[Index] != Index)
+		{
+			ClusterParents[Index] = ClusterParents[ClusterParents[Index]];
+			Index = ClusterParents[Index];
+		}
+		return Index;
+	};
+
+	// group packages which hard reference each other, loading one of them loads the others anyway
+	TArray<int64> PackageCosts;
+	PackageCosts.SetNumUninitialized(PackageNames.Num());
+	int64 TotalCost = 0;
+	TArray<FName> Dependencies;
+	for (int32 Index = 0; Index < PackageNames.Num(); ++Index)
+	{
+		const FAssetPackageData* PackageData = AssetRegistry->GetAssetPackageData(PackageNames[Index]);
+		PackageCosts[Index] = FMath::Max<int64>(PackageData ? PackageData->DiskSize : 0, MinPackageCost);
+		TotalCost += PackageCosts[Index];
+
+		Dependencies.Reset();
+		AssetRegistry->GetDependencies(PackageNames[Index], Dependencies, EAssetRegistryDependencyType::Hard);
+		for (const FName& Dependency : Dependencies)
+		{
+			if (const int32* DependencyIndex = PackageIndices.Find(Dependency))
+			{
+				const int32 ClusterA = FindCluster(Index);
+				const int32 ClusterB = FindCluster(*DependencyIndex);
+				if (ClusterA != ClusterB)
+				{
+					ClusterParents[FMath::Max(ClusterA, ClusterB)] = FMath::Min(ClusterA, ClusterB);
+				}
+			}
+		}
+	}
+
+	// clusters bigger than a partition are split into pieces in dependency order so a large map can still be spread over the cookers
+	struct FPackagePiece
+	{
+		FPackagePiece() : Cost(0) { }
+
+		TArray<int32> Packages;
+		int64 Cost;
+	};
+	const int64 MaxPieceCost = FMath::Max<int64>(TotalCost / NumPartitions, 1);
+	TArray<FPackagePiece> Pieces;
+	TMap<int32, int32> ClusterPieces;
+	for (int32 Index = 0; Index < PackageNames.Num(); ++Index)
+	{
+		const int32 Cluster = FindCluster(Index);
+		int32* PieceIndex = ClusterPieces.Find(Cluster);
+		if (PieceIndex == nullptr || Pieces[*PieceIndex].Cost >= MaxPieceCost)
+		{
+			PieceIndex = &ClusterPieces.Add(Cluster, Pieces.AddDefaulted());
+		}
+		FPackagePiece& Piece = Pieces[*PieceIndex];
+		Piece.Packages.Add(Index);
+		Piece.Cost += PackageCosts[Index];
+	}
+
+	// hand out the largest pieces first, each to the partition with the least work so far
+	Pieces.StableSort([](const FPackagePiece& A, const FPackagePiece& B) { return A.Cost > B.Cost; });
+
+	TArray<int64> PartitionCosts;
+	PartitionCosts.AddZeroed(NumPartitions);
+	TArray<int32> PackagePartitions;
+	PackagePartitions.SetNumUninitialized(PackageNames.Num());
+	for (const FPackagePiece& Piece : Pieces)
+	{
+		int32 Partition = 0;
+		for (int32 Candidate = 1; Candidate < NumPartitions; ++Candidate)
+		{
+			if (PartitionCosts[Candidate] < PartitionCosts[Partition])
+			{
+				Partition = Candidate;
+			}
+		}
+
+		PartitionCosts[Partition] += Piece.Cost;
+		for (int32 PackageIndex : Piece.Packages)
+		{
+			PackagePartitions[PackageIndex] = Partition;
+		}
+	}
+
+	// keep the dependency order within each partition
+	for (int32 Index = 0; Index < PackageNames.Num(); ++Index)
+	{
+		OutPartitions[PackagePartitions[Index]].Add(PackageNames[Index]);
+	}
+
+	for (int32 Partition = 0; Partition < NumPartitions; ++Partition)
+	{
+		UE_LOG(LogCook, Display, TEXT("Cooker partition %d has %d packages, %lld KB on disk"), Partition, OutPartitions[Partition].Num(), PartitionCosts[Partition] / 1024);
+	}
+}
+
+
 /* UCookOnTheFlyServer callbacks
  *****************************************************************************/
 
@@ -28,12 +28,10 @@ bool FDataTableEditorUtils::RemoveRow(UDataTable* DataTable, FName Name)
 
 		BroadcastPreChange(DataTable, EDataTableChangeInfo::RowList);
 		DataTable->Modify();
-		uint8* RowData = NULL;
-		const bool bRemoved = DataTable->RowMap.RemoveAndCopyValue(Name, RowData);
-		if (bRemoved && RowData)
+		if (DataTable->RowMap.Contains(Name))
 		{
-			DataTable->RowStruct->DestroyStruct(RowData);
-			FMemory::Free(RowData);
+			// Rows loaded with the table share one allocation, let the table free them
+			DataTable->RemoveRow(Name);
 			bResult = true;
 
 			// Compact the map so that a subsequent add goes at the end of the table
@@ -5,6 +5,7 @@
 #include "Stats/StatsMisc.h"
 #include "Misc/ScopedSlowTask.h"
 #include "Misc/PackageName.h"
+#include "Async/ParallelFor.h"
 #include "Components/StaticMeshComponent.h"
 #include "Components/InstancedStaticMeshComponent.h"
 
@@ -226,23 +227,39 @@ void FHierarchicalLODBuilder::InitializeClusters(ULevel* InLevel, const int32 LO
 				}
 			}
 			
-			// Create clusters using actor pairs
-			for (int32 ActorId = 0; ActorId<ValidStaticMeshActorsInLevel.Num(); ++ActorId)
+			// Gather the bounds of every actor once, rather than once per pair
+			const int32 NumActors = ValidStaticMeshActorsInLevel.Num();
+			TArray<FSphere> ActorBounds;
+			ActorBounds.Reserve(NumActors);
+			for (AActor* Actor : ValidStaticMeshActorsInLevel)
 			{
-				AActor* Actor1 = ValidStaticMeshActorsInLevel[ActorId];
+				ActorBounds.Add(FLODCluster::GetActorBound(Actor));
+			}
 
-				for (int32 SubActorId = ActorId + 1; SubActorId<ValidStaticMeshActorsInLevel.Num(); ++SubActorId)
+			// Find the actor pairs cheap enough to be worth merging on all cores, the costs only depend on the bounds
+			TArray<TArray<int32>> PairedActorIds;
+			PairedActorIds.AddDefaulted(NumActors);
+			ParallelFor(NumActors, [&ActorBounds, &PairedActorIds, NumActors, CullCost](int32 ActorId)
+			{
+				for (int32 SubActorId = ActorId + 1; SubActorId < NumActors; ++SubActorId)
 				{
-					AActor* Actor2 = ValidStaticMeshActorsInLevel[SubActorId];
-
-					FLODCluster NewClusterCandidate = FLODCluster(Actor1, Actor2);
-					float NewClusterCost = NewClusterCandidate.GetCost();
-
-					if ( NewClusterCost <= CullCost)
+					if (FLODCluster::CalculatePairCost(ActorBounds[ActorId], ActorBounds[SubActorId]) <= CullCost)
 					{
-						Clusters.Add(NewClusterCandidate);
+						PairedActorIds[ActorId].Add(SubActorId);
 					}
 				}
+			});
+
+			// Create clusters using actor pairs, Clusters uses the mem stack of this thread so it's filled here in the same order as before
+			for (int32 ActorId = 0; ActorId < NumActors; ++ActorId)
+			{
+				AActor* Actor1 = ValidStaticMeshActorsInLevel[ActorId];
+
+				for (int32 SubActorId : PairedActorIds[ActorId])
+				{
+					AActor* Actor2 = ValidStaticMeshActorsInLevel[SubActorId];
+					Clusters.Add(FLODCluster(Actor1, ActorBounds[ActorId], Actor2, ActorBounds[SubActorId]));
+				}
 			}
 		}
 		else // at this point we only care for LODActors
@@ -255,6 +272,13 @@ void FHierarchicalLODBuilder::InitializeClusters(ULevel* InLevel, const int32 LO
 			Actors.Append(LODLevelLODActors[LODIdx - 1]);
 			Actors.Append(ValidStaticMeshActorsInLevel);
 
+			TArray<FSphere> ActorBounds;
+			ActorBounds.Reserve(Actors.Num());
+			for (AActor* Actor : Actors)
+			{
+				ActorBounds.Add(FLODCluster::GetActorBound(Actor));
+			}
+
 			// first we generate graph with 2 pair nodes
 			// this is very expensive when we have so many actors
 			// so we'll need to optimize later @todo
@@ -266,8 +290,7 @@ void FHierarchicalLODBuilder::InitializeClusters(ULevel* InLevel, const int32 LO
 					AActor* Actor2 = Actors[SubActorId];
 
 					// create new cluster
-					FLODCluster NewClusterCandidate = FLODCluster(Actor1, Actor2);
-					Clusters.Add(NewClusterCandidate);
+					Clusters.Add(FLODCluster(Actor1, ActorBounds[ActorId], Actor2, ActorBounds[SubActorId]));
 				}
 			}
 
@@ -126,6 +126,18 @@ FLODCluster::FLODCluster(AActor* Actor1, AActor* Actor2)
 	ClusterCost = ( Bound.W * Bound.W * Bound.W ) / FillingFactor;
 }
 
+FLODCluster::FLODCluster(AActor* Actor1, const FSphere& Actor1Bound, AActor* Actor2, const FSphere& Actor2Bound)
+: Bound(ForceInit)
+, bValid(true)
+{
+	AddActor(Actor1, Actor1Bound);
+	AddActor(Actor2, Actor2Bound);
+
+	// calculate new filling factor
+	FillingFactor = CalculateFillingFactor(Actor1Bound, 1.f, Actor2Bound, 1.f);
+	ClusterCost = ( Bound.W * Bound.W * Bound.W ) / FillingFactor;
+}
+
 FLODCluster::FLODCluster()
 : Bound(ForceInit)
 , bValid(false)
@@ -134,22 +146,42 @@ FLODCluster::FLODCluster()
 	ClusterCost = (Bound.W * Bound.W * Bound.W);
 }
 
-FSphere FLODCluster::AddActor(AActor* NewActor)
+FSphere FLODCluster::GetActorBound(AActor* Actor)
 {
-	bValid = true;
-	ensure (Actors.Contains(NewActor) == false);
-	Actors.Add(NewActor);
 	FVector Origin, Extent;
-
-	NewActor->GetActorBounds(false, Origin, Extent);
+	Actor->GetActorBounds(false, Origin, Extent);
 
 	// scale 0.01 (change to meter from centimeter)
-	FSphere NewBound = FSphere(Origin*CM_TO_METER, Extent.Size()*CM_TO_METER);
-	Bound += NewBound;
+	return FSphere(Origin*CM_TO_METER, Extent.Size()*CM_TO_METER);
+}
+
+float FLODCluster::CalculatePairCost(const FSphere& Actor1Bound, const FSphere& Actor2Bound)
+{
+	// Same as the cost of FLODCluster(Actor1, Actor2)
+	FSphere PairBound(ForceInit);
+	PairBound += Actor1Bound;
+	PairBound += Actor2Bound;
+
+	const float PairFillingFactor = CalculateFillingFactor(Actor1Bound, 1.f, Actor2Bound, 1.f);
+	return ( PairBound.W * PairBound.W * PairBound.W ) / PairFillingFactor;
+}
+
+FSphere FLODCluster::AddActor(AActor* NewActor)
+{
+	const FSphere NewBound = GetActorBound(NewActor);
+	AddActor(NewActor, NewBound);
 
 	return NewBound;
 }
 
+void FLODCluster::AddActor(AActor* NewActor, const FSphere& NewBound)
+{
+	bValid = true;
+	ensure (Actors.Contains(NewActor) == false);
+	Actors.Add(NewActor);
+	Bound += NewBound;
+}
+
 FLODCluster FLODCluster::operator+(const FLODCluster& Other) const
 {
 	FLODCluster UnionCluster(*this);
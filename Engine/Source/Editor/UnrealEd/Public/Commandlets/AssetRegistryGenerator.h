@@ -14,6 +14,7 @@ class IAssetRegistry;
 class ITargetPlatform;
 class UChunkDependencyInfo;
 struct FChunkDependencyTreeNode;
+struct FSavePackageResultStruct;
 
 /**
  * Helper class for generating streaming install manifests
@@ -119,6 +120,24 @@ public:
 	 */
 	bool WriteCookerOpenOrder();
 
+	/**
+	 * Writes a load order manifest next to every cooked map, listing the packages the map hard depends on in the
+	 * order the runtime would load them, see FLoadOrderManifest. Must be called after BuildChunkManifest.
+	 */
+	bool WriteLoadOrderManifests();
+
+	/**
+	 * Records the results of saving a cooked package, for the asset registry and the cooked package report.
+	 */
+	void UpdateCookedPackageStats(FName PackageName, const FSavePackageResultStruct& SaveResult);
+
+	/**
+	 * Writes CookReport/<Platform>/CookedPackages.csv to the log directory. For every cooked package it lists the cooked and
+	 * bulk data size, export and import counts, hard dependency fan-out and fan-in, the number and total size of the packages
+	 * loading it pulls in, and the shortest hard reference chain from a map or startup package. Must be called after BuildChunkManifest.
+	 */
+	bool WriteCookedPackageReport();
+
 	/**
 	 * Follows an assets dependency chain to build up a list of package names in the same order as the runtime would attempt to load them
 	 * 
@@ -140,6 +159,15 @@ public:
 
 private:
 
+	/**
+	 * Follows the hard dependencies of a cooked package, adding every cooked package to the load order after its dependencies
+	 *
+	 * @param PackageName - The package to add
+	 * @param OutLoadOrder - Output array which collects the package names
+	 * @param OutEncounteredNames - Packages that have been seen, updated BEFORE following dependencies so as to avoid circular references
+	 */
+	void AddPackageToLoadOrderRecursive(FName PackageName, TArray<FName>& OutLoadOrder, TSet<FName>& OutEncounteredNames) const;
+
 	/** State of the asset registry that is being built for this platform */
 	FAssetRegistryState State;
 
@@ -174,6 +202,14 @@ private:
 	FChunkPackageSet				UnassignedPackageSet;
 	/** Map of all cooked Packages */
 	FChunkPackageSet				AllCookedPackageSet;
+	/** What saving a cooked package produced besides its size, see UpdateCookedPackageStats */
+	struct FCookedPackageStats
+	{
+		int64 BulkDataSize;
+		int32 ExportCount;
+		int32 ImportCount;
+	};
+	TMap<FName, FCookedPackageStats> CookedPackageStats;
 	/** Array of Maps with chunks<->packages assignments. This version contains all dependent packages */
 	TArray<FChunkPackageSet*>		FinalChunkManifests;
 	/** Lookup table of used package names used when searching references. */
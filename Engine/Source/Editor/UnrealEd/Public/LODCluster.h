@@ -25,6 +25,8 @@ struct FLODCluster
 	FLODCluster(const FLODCluster& Other);
 	FLODCluster(AActor* Actor1);
 	FLODCluster(AActor* Actor1, AActor* Actor2);
+	/** Creates a two actor cluster from bounds retrieved with GetActorBound, to avoid gathering the bounds of the actors again */
+	FLODCluster(AActor* Actor1, const FSphere& Actor1Bound, AActor* Actor2, const FSphere& Actor2Bound);
 	FLODCluster();
 
 	/** Cluster operators */
@@ -46,6 +48,12 @@ struct FLODCluster
 		return ClusterCost;
 	}
 
+	/** Returns the bounds an actor adds to a cluster, in meters */
+	static FSphere GetActorBound(AActor* Actor);
+
+	/** Returns the cost a cluster of two actors with the given bounds would have, without creating the cluster. Safe to call from any thread. */
+	static float CalculatePairCost(const FSphere& Actor1Bound, const FSphere& Actor2Bound);
+
 	/** Compare clusters and returns true when this contains any of Other's actors */
 	bool Contains(FLODCluster& Other) const;
 	
@@ -106,6 +114,9 @@ private:
 	*/
 	FSphere AddActor(AActor* NewActor);
 
+	/** Adds a new actor with bounds retrieved with GetActorBound, the filling factor is NOT updated */
+	void AddActor(AActor* NewActor, const FSphere& NewBound);
+
 	/** Bool flag whether or not this cluster is valid */
 	bool bValid;
 };
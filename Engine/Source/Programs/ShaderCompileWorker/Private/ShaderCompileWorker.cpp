@@ -10,11 +10,13 @@
 #include "ExceptionHandling.h"
 #include "IShaderFormat.h"
 #include "IShaderFormatModule.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
 
 #define DEBUG_USING_CONSOLE	0
 
 // this is for the protocol, not the data, bump if FShaderCompilerInput or ProcessInputFromArchive changes (also search for the second one with the same name, todo: put into one header file)
-const int32 ShaderCompileWorkerInputVersion = 7;
+const int32 ShaderCompileWorkerInputVersion = 8;
 // this is for the protocol, not the data, bump if FShaderCompilerOutput or WriteToOutputArchive changes (also search for the second one with the same name, todo: put into one header file)
 const int32 ShaderCompileWorkerOutputVersion = 3;
 // this is for the protocol, not the data, bump if FShaderCompilerOutput or WriteToOutputArchive changes (also search for the second one with the same name, todo: put into one header file)
@@ -155,18 +157,31 @@ public:
 
 				UE_LOG(LogShaders, Log, TEXT("Processing shader"));
 
-				ProcessInputFromArchive(InputFilePtr, SingleJobResults, PipelineJobResults);
-
-				LastCompileTime = FPlatformTime::Seconds();
+				// Read the whole input with a single call and close the file before compiling
+				TArray<uint8> InputData;
+				InputData.AddUninitialized(InputFilePtr->TotalSize());
+				InputFilePtr->Serialize(InputData.GetData(), InputData.Num());
 
 				// Close the input file.
 				delete InputFilePtr;
+
+				FMemoryReader InputReader(InputData, true);
+				ProcessInputFromArchive(&InputReader, SingleJobResults, PipelineJobResults);
+
+				LastCompileTime = FPlatformTime::Seconds();
+			}
+
+			// Serialize the results in memory so the output file is written with a single call
+			TArray<uint8> OutputData;
+			{
+				FMemoryWriter OutputWriter(OutputData, true);
+				WriteToOutputArchive(&OutputWriter, SingleJobResults, PipelineJobResults);
 			}
 
 			// Prepare for output
 			FArchive* OutputFilePtr = CreateOutputArchive();
 			check(OutputFilePtr);
-			WriteToOutputArchive(OutputFilePtr, SingleJobResults, PipelineJobResults);
+			OutputFilePtr->Serialize(OutputData.GetData(), OutputData.Num());
 
 			// Close the output file.
 			delete OutputFilePtr;
@@ -260,6 +275,37 @@ private:
 
 		VerifyFormatVersions(ReceivedFormatVersionMap);
 
+		// Environments shared between the jobs, referenced by index
+		TArray<TRefCountPtr<FShaderCompilerEnvironment>> SharedEnvironments;
+		{
+			int32 NumSharedEnvironments = 0;
+			InputFile << NumSharedEnvironments;
+
+			SharedEnvironments.Reserve(NumSharedEnvironments);
+			for (int32 Index = 0; Index < NumSharedEnvironments; ++Index)
+			{
+				FShaderCompilerEnvironment* SharedEnvironment = new FShaderCompilerEnvironment();
+				InputFile << *SharedEnvironment;
+				SharedEnvironments.Add(SharedEnvironment);
+			}
+		}
+
+		auto ReadInput = [&InputFile, &SharedEnvironments](FShaderCompilerInput& CompilerInput)
+		{
+			CompilerInput.SerializeWithoutSharedEnvironment(InputFile);
+
+			int32 SharedEnvironmentIndex = INDEX_NONE;
+			InputFile << SharedEnvironmentIndex;
+
+			if (SharedEnvironmentIndex != INDEX_NONE)
+			{
+				CompilerInput.SharedEnvironment = SharedEnvironments[SharedEnvironmentIndex];
+
+				// Merge the shared environment into the per-shader environment before calling into the compile function
+				CompilerInput.Environment.Merge(*CompilerInput.SharedEnvironment);
+			}
+		};
+
 		// Individual jobs
 		{
 			int32 SingleJobHeader = ShaderCompileWorkerSingleJobHeader;
@@ -280,13 +326,7 @@ private:
 			{
 				// Deserialize the job's inputs.
 				FShaderCompilerInput CompilerInput;
-				InputFile << CompilerInput;
-
-				if (IsValidRef(CompilerInput.SharedEnvironment))
-				{
-					// Merge the shared environment into the per-shader environment before calling into the compile function
-					CompilerInput.Environment.Merge(*CompilerInput.SharedEnvironment);
-				}
+				ReadInput(CompilerInput);
 
 				// Process the job.
 				FShaderCompilerOutput CompilerOutput;
@@ -325,13 +365,7 @@ private:
 				for (int32 StageIndex = 0; StageIndex < NumStages; ++StageIndex)
 				{
 					// Deserialize the job's inputs.
-					InputFile << CompilerInputs[StageIndex];
-
-					if (IsValidRef(CompilerInputs[StageIndex].SharedEnvironment))
-					{
-						// Merge the shared environment into the per-shader environment before calling into the compile function
-						CompilerInputs[StageIndex].Environment.Merge(*CompilerInputs[StageIndex].SharedEnvironment);
-					}
+					ReadInput(CompilerInputs[StageIndex]);
 				}
 
 				ProcessShaderPipelineCompilationJob(PipelineJob, CompilerInputs);
@@ -0,0 +1,301 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "StatsChromeTraceCommand.h"
+#include "Misc/CommandLine.h"
+#include "HAL/FileManager.h"
+#include "UniquePtr.h"
+#include "StatsData.h"
+#include "StatsFile.h"
+#include "ProfilingDebugging/ChromeTraceWriter.h"
+
+/** Returns the seconds per cycle of the platform the capture was made on, if the messages contain it. */
+template<typename ArrayType>
+static bool FindSecondsPerCycle( const ArrayType& Messages, double& OutSecondsPerCycle )
+{
+	for (int32 Index = 0; Index < Messages.Num(); ++Index)
+	{
+		const FStatMessage& Message = Messages[Index];
+		if (Message.NameAndInfo.GetRawName() == FStatConstants::RAW_SecondsPerCycle && Message.NameAndInfo.GetField<EStatDataType>() == EStatDataType::ST_double)
+		{
+			OutSecondsPerCycle = Message.GetValue_double();
+			return OutSecondsPerCycle > 0.0;
+		}
+	}
+	return false;
+}
+
+/** Writes the cycle scopes of a raw stats capture with their real timestamps. */
+class FRawStatsChromeTraceWriter : public FStatsReadFile
+{
+	friend struct FStatsReader<FRawStatsChromeTraceWriter>;
+	typedef FStatsReadFile Super;
+
+protected:
+
+	/** Initialization constructor. */
+	FRawStatsChromeTraceWriter( const TCHAR* InFilename )
+		: FStatsReadFile( InFilename, true )
+		, Writer( nullptr )
+		, MicrosecondsPerCycle( FPlatformTime::GetSecondsPerCycle() * 1000000.0 )
+		, bHasLastCycles( false )
+		, LastCycles( 0 )
+		, UnwrappedCycles( 0 )
+	{}
+
+	/** Finds the cycle duration the capture was made with. */
+	virtual void PreProcessStats() override;
+
+	virtual void ProcessCycleScopeStartOperation( const FStatMessage& Message, const FStackState& StackState ) override
+	{
+		Writer->WriteBeginEvent( Message.NameAndInfo.GetShortName().ToString(), GetThreadId( StackState ), GetTimestamp( Message ) );
+	}
+
+	virtual void ProcessCycleScopeEndOperation( const FStatMessage& Message, const FStackState& StackState ) override
+	{
+		Writer->WriteEndEvent( GetThreadId( StackState ), GetTimestamp( Message ) );
+	}
+
+	/** Returns the id of the thread the stack belongs to, naming the thread in the trace on first use. */
+	uint32 GetThreadId( const FStackState& StackState );
+
+	/** Returns the timestamp of a cycle scope message in microseconds since the first one. */
+	double GetTimestamp( const FStatMessage& Message );
+
+public:
+
+	/** Sets the writer the events are written to. */
+	void Initialize( FChromeTraceWriter* InWriter )
+	{
+		Writer = InWriter;
+	}
+
+protected:
+	FChromeTraceWriter* Writer;
+
+	double MicrosecondsPerCycle;
+
+	/** Thread stack names to thread ids, for threads that have been named in the trace. */
+	TMap<FName, uint32> ThreadIds;
+
+	/** Cycle scopes store 32 bit cycles, these unwrap them into a continuous timeline. */
+	bool bHasLastCycles;
+	uint32 LastCycles;
+	int64 UnwrappedCycles;
+};
+
+void FRawStatsChromeTraceWriter::PreProcessStats()
+{
+	Super::PreProcessStats();
+
+	for (const int32 Frame : Frames)
+	{
+		for (const FStatPacket* Packet : CombinedHistory.FindChecked( Frame ).Packets)
+		{
+			double SecondsPerCycle = 0.0;
+			if (FindSecondsPerCycle( Packet->StatMessages, SecondsPerCycle ))
+			{
+				MicrosecondsPerCycle = SecondsPerCycle * 1000000.0;
+				return;
+			}
+		}
+	}
+
+	UE_LOG( LogStats, Warning, TEXT( "Capture doesn't contain STAT_SecondsPerCycle, using the cycle duration of this platform" ) );
+}
+
+uint32 FRawStatsChromeTraceWriter::GetThreadId( const FStackState& StackState )
+{
+	const FName ThreadFName = StackState.Stack[0];
+
+	const uint32* ThreadId = ThreadIds.Find( ThreadFName );
+	if (ThreadId)
+	{
+		return *ThreadId;
+	}
+
+	uint32 NewThreadId = ThreadIds.Num() + 1;
+	for (const TPair<uint32, FName>& Thread : State.Threads)
+	{
+		if (Thread.Value == ThreadFName)
+		{
+			NewThreadId = Thread.Key;
+			break;
+		}
+	}
+
+	ThreadIds.Add( ThreadFName, NewThreadId );
+	Writer->WriteThreadName( NewThreadId, FStatNameAndInfo::GetShortNameFrom( ThreadFName ).ToString() );
+	return NewThreadId;
+}
+
+double FRawStatsChromeTraceWriter::GetTimestamp( const FStatMessage& Message )
+{
+	const uint32 Cycles = uint32( Message.GetValue_int64() );
+	if (bHasLastCycles)
+	{
+		// Packets of different threads aren't ordered by time, so the difference can be negative
+		UnwrappedCycles += int32( Cycles - LastCycles );
+	}
+	bHasLastCycles = true;
+	LastCycles = Cycles;
+
+	return double( UnwrappedCycles ) * MicrosecondsPerCycle;
+}
+
+/**
+ * Writes regular stats captures, which only keep the inclusive time of each scope per frame.
+ * Scopes are laid out back to back under their parent, frames one after another, so durations are right but start times are approximate.
+ */
+class FStatsChromeTraceWriter : public FStatsReadFile
+{
+	friend struct FStatsReader<FStatsChromeTraceWriter>;
+	typedef FStatsReadFile Super;
+
+protected:
+
+	/** Initialization constructor. */
+	FStatsChromeTraceWriter( const TCHAR* InFilename )
+		: FStatsReadFile( InFilename, false )
+		, Writer( nullptr )
+		, MicrosecondsPerCycle( FPlatformTime::GetSecondsPerCycle() * 1000000.0 )
+		, FrameStartTime( 0.0 )
+	{
+		// Frames are written as they are read, keep only the last one.
+		SetHistoryFrames( 1 );
+	}
+
+	/** Called every each frame has been read from the file. */
+	virtual void ReadStatsFrame( const TArray<FStatMessage>& CondensedMessages, const int64 Frame ) override;
+
+	/** Writes the node and its children starting at StartTime, returns the duration of the node. */
+	double WriteNode( const FRawStatStackNode& Node, uint32 ThreadId, double StartTime );
+
+public:
+
+	/** Sets the writer the events are written to. */
+	void Initialize( FChromeTraceWriter* InWriter )
+	{
+		Writer = InWriter;
+	}
+
+protected:
+	FChromeTraceWriter* Writer;
+
+	double MicrosecondsPerCycle;
+
+	/** Start of the frame being written, in microseconds. */
+	double FrameStartTime;
+
+	/** Thread names to the ids used in the trace. */
+	TMap<FName, uint32> ThreadIds;
+};
+
+void FStatsChromeTraceWriter::ReadStatsFrame( const TArray<FStatMessage>& CondensedMessages, const int64 Frame )
+{
+	FRawStatStackNode Root;
+	TArray<FStatMessage> NonStackStats;
+	State.UncondenseStackStats( CondensedMessages, Root, nullptr, &NonStackStats );
+
+	// SecondsPerCycle may vary over time, so we update it every frame
+	double SecondsPerCycle = 0.0;
+	if (FindSecondsPerCycle( NonStackStats, SecondsPerCycle ))
+	{
+		MicrosecondsPerCycle = SecondsPerCycle * 1000000.0;
+	}
+
+	double FrameDuration = 0.0;
+	for (const TPair<FName, FRawStatStackNode*>& Thread : Root.Children)
+	{
+		uint32* ThreadId = ThreadIds.Find( Thread.Key );
+		if (!ThreadId)
+		{
+			ThreadId = &ThreadIds.Add( Thread.Key, ThreadIds.Num() + 1 );
+			Writer->WriteThreadName( *ThreadId, Thread.Value->Meta.NameAndInfo.GetShortName().ToString() );
+		}
+
+		FrameDuration = FMath::Max( FrameDuration, WriteNode( *Thread.Value, *ThreadId, FrameStartTime ) );
+	}
+
+	Writer->WriteInstantEvent( FString::Printf( TEXT( "Frame %lld" ), Frame ), 1, FrameStartTime );
+	FrameStartTime += FrameDuration;
+}
+
+double FStatsChromeTraceWriter::WriteNode( const FRawStatStackNode& Node, uint32 ThreadId, double StartTime )
+{
+	const double Duration = MicrosecondsPerCycle * FromPackedCallCountDuration_Duration( Node.Meta.GetValue_int64() );
+	Writer->WriteCompleteEvent( Node.Meta.NameAndInfo.GetShortName().ToString(), ThreadId, StartTime, Duration );
+
+	double ChildStartTime = StartTime;
+	for (const TPair<FName, FRawStatStackNode*>& Child : Node.Children)
+	{
+		if (Child.Value->Meta.NameAndInfo.GetFlag( EStatMetaFlags::IsPackedCCAndDuration ))
+		{
+			ChildStartTime += WriteNode( *Child.Value, ThreadId, ChildStartTime );
+		}
+	}
+
+	return Duration;
+}
+
+/** Reads and processes the whole capture, logging the progress. */
+template<typename T>
+static bool ConvertStatsFile( const FString& InFile, FChromeTraceWriter& Writer )
+{
+	TUniquePtr<T> Instance( FStatsReader<T>::Create( *InFile ) );
+	if (!Instance)
+	{
+		return false;
+	}
+
+	Instance->Initialize( &Writer );
+	Instance->ReadAndProcessSynchronously();
+
+	while (Instance->IsBusy())
+	{
+		FPlatformProcess::Sleep( 2.0f );
+		UE_LOG( LogStats, Log, TEXT( "FStatsChromeTraceCommand: Stage: %s / %3i%%" ), *Instance->GetProcessingStageAsString(), Instance->GetStageProgress() );
+	}
+
+	return Instance->GetProcessingStage() == EStatsProcessingStage::SPS_Finished;
+}
+
+bool FStatsChromeTraceCommand::InternalRun()
+{
+	FString InFile;
+	FParse::Value( FCommandLine::Get(), TEXT( "-INFILE=" ), InFile );
+
+	FString OutFile;
+	FParse::Value( FCommandLine::Get(), TEXT( "-OUTFILE=" ), OutFile );
+
+	// Only peek at the header, the readers log errors when opening the wrong kind of capture.
+	bool bRawStatsFile = false;
+	{
+		TUniquePtr<FArchive> FileReader( IFileManager::Get().CreateFileReader( *InFile ) );
+		FStatsReadStream Stream;
+		if (!FileReader || !Stream.ReadHeader( *FileReader ))
+		{
+			UE_LOG( LogStats, Error, TEXT( "Could not read stats capture: %s" ), *InFile );
+			return false;
+		}
+		bRawStatsFile = Stream.Header.bRawStatsFile;
+	}
+
+	TUniquePtr<FArchive> FileWriter( IFileManager::Get().CreateFileWriter( *OutFile ) );
+	if (!FileWriter)
+	{
+		UE_LOG( LogStats, Error, TEXT( "Could not open output file: %s" ), *OutFile );
+		return false;
+	}
+
+	FChromeTraceWriter Writer( *FileWriter );
+	const bool bConverted = bRawStatsFile
+		? ConvertStatsFile<FRawStatsChromeTraceWriter>( InFile, Writer )
+		: ConvertStatsFile<FStatsChromeTraceWriter>( InFile, Writer );
+	Writer.Close();
+
+	if (bConverted)
+	{
+		UE_LOG( LogStats, Display, TEXT( "Wrote %lld trace events to %s" ), Writer.GetNumEvents(), *OutFile );
+	}
+	return bConverted && FileWriter->Close();
+}
@@ -0,0 +1,26 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Converts a ue4stats or ue4statsraw capture into Chrome trace event json, for chrome://tracing or ui.perfetto.dev.
+ * Usage: -RUN=CHROMETRACE -INFILE=<capture> -OUTFILE=<json>
+ */
+class FStatsChromeTraceCommand
+{
+public:
+
+	/** Executes the command. */
+	static bool Run()
+	{
+		FStatsChromeTraceCommand Instance;
+		return Instance.InternalRun();
+	}
+
+protected:
+
+	bool InternalRun();
+
+};
@@ -7,6 +7,7 @@
 #include "LaunchCommand.h"
 #include "PackageCommand.h"
 #include "StatsConvertCommand.h"
+#include "StatsChromeTraceCommand.h"
 #include "StatsDumpMemoryCommand.h"
 #include "UserInterfaceCommand.h"
 #include "LaunchFromProfileCommand.h"
@@ -89,6 +90,10 @@ int32 UnrealFrontendMain( const TCHAR* CommandLine )
 		{
 			FStatsConvertCommand::Run();
 		}
+		else if (Command.Equals(TEXT("CHROMETRACE"), ESearchCase::IgnoreCase))
+		{
+			Succeeded = FStatsChromeTraceCommand::Run();
+		}
 		else if( Command.Equals( TEXT("MEMORYDUMP"), ESearchCase::IgnoreCase ) )
 		{
 			FStatsMemoryDumpCommand::Run();
@@ -51,6 +51,7 @@
 #include "UHTMakefile/UHTMakefile.h"
 #include "Algo/Sort.h"
 #include "Algo/Reverse.h"
+#include "Async/ParallelFor.h"
 
 #include "FileLineException.h"
 
@@ -4906,8 +4907,21 @@ ECompilationResult::Type PreparseModules(FUHTMakefile& UHTMakefile, const FStrin
 
 			NumHeadersPreparsed += UObjectHeaders.Num();
 
-			for (const FString& RawFilename : UObjectHeaders)
+			// Loading the headers doesn't touch any UObjects so it can happen in parallel, parsing them creates the classes and stays serial
+			TArray<FString> HeaderFiles;
+			TArray<bool> HeaderFilesLoaded;
+			HeaderFiles.SetNum(UObjectHeaders.Num());
+			HeaderFilesLoaded.SetNumZeroed(UObjectHeaders.Num());
+			ParallelFor(UObjectHeaders.Num(), [&UObjectHeaders, &ModuleInfoPath, &HeaderFiles, &HeaderFilesLoaded](int32 HeaderIndex)
 			{
+				const FString FullFilename = FPaths::ConvertRelativePathToFull(ModuleInfoPath, UObjectHeaders[HeaderIndex]);
+				HeaderFilesLoaded[HeaderIndex] = FFileHelper::LoadFileToString(HeaderFiles[HeaderIndex], *FullFilename);
+			}, !FTaskGraphInterface::IsRunning());
+
+			for (int32 HeaderIndex = 0; HeaderIndex < UObjectHeaders.Num(); ++HeaderIndex)
+			{
+				const FString& RawFilename = UObjectHeaders[HeaderIndex];
+
 			#if !PLATFORM_EXCEPTIONS_DISABLED
 				try
 			#endif
@@ -4915,12 +4929,14 @@ ECompilationResult::Type PreparseModules(FUHTMakefile& UHTMakefile, const FStrin
 					// Import class.
 					const FString FullFilename = FPaths::ConvertRelativePathToFull(ModuleInfoPath, RawFilename);
 
-					FString HeaderFile;
-					if (!FFileHelper::LoadFileToString(HeaderFile, *FullFilename))
+					if (!HeaderFilesLoaded[HeaderIndex])
 					{
 						FError::Throwf(TEXT("UnrealHeaderTool was unable to load source file '%s'"), *FullFilename);
 					}
 
+					// The source file keeps its own copy of the contents
+					const FString HeaderFile = MoveTemp(HeaderFiles[HeaderIndex]);
+
 					TSharedRef<FUnrealSourceFile> UnrealSourceFile = PerformInitialParseOnHeader(Package, *RawFilename, RF_Public | RF_Standalone, *HeaderFile, UHTMakefile);
 					FUnrealSourceFile* UnrealSourceFilePtr = &UnrealSourceFile.Get();
 					TArray<UClass*> DefinedClasses = UnrealSourceFile->GetDefinedClasses();
@@ -35,6 +35,21 @@ FStaticLightingAggregateMesh::FStaticLightingAggregateMesh(const FScene& InScene
 {
 }
 
+void FStaticLightingAggregateMesh::IntersectLightRays(
+	const FLightRay* LightRays,
+	int32 NumRays,
+	bool bFindClosestIntersection,
+	bool bCalculateTransmission,
+	bool bDirectShadowingRay,
+	FCoherentRayCache& CoherentRayCache,
+	FLightRayIntersection* OutIntersections) const
+{
+	for (int32 RayIndex = 0; RayIndex < NumRays; RayIndex++)
+	{
+		IntersectLightRay(LightRays[RayIndex], bFindClosestIntersection, bCalculateTransmission, bDirectShadowingRay, CoherentRayCache, OutIntersections[RayIndex]);
+	}
+}
+
 FBox FStaticLightingAggregateMesh::GetBounds() const
 {
 	// Expand the bounds slightly to avoid having to handle geometry that is exactly on the bounding box,
@@ -173,6 +173,22 @@ public:
 		class FCoherentRayCache& CoherentRayCache,
 		FLightRayIntersection& Intersection) const = 0;
 
+	/**
+	 * Checks a batch of independent light rays for intersection with the shadow mesh, see IntersectLightRay.
+	 * Rays with similar origins and directions should be batched together, implementations may trace them as packets.
+	 * @param LightRays - The line segments to check for intersection.
+	 * @param NumRays - Number of rays in LightRays and OutIntersections.
+	 * @param [out] OutIntersections - The intersection of each light ray.
+	 */
+	virtual void IntersectLightRays(
+		const FLightRay* LightRays,
+		int32 NumRays,
+		bool bFindClosestIntersection,
+		bool bCalculateTransmission,
+		bool bDirectShadowingRay,
+		class FCoherentRayCache& CoherentRayCache,
+		FLightRayIntersection* OutIntersections) const;
+
 	FBox GetBounds() const;
 
 	/** The total surface area of everything in the aggregate mesh */
@@ -351,6 +351,46 @@ void EmbreeFilterFunc(void* UserPtr, RTCRay& InRay)
 	Proc.UpdateRay();
 }
 
+void EmbreeFilterFunc4(const void* Valid, void* UserPtr, RTCRay4& InRay)
+{
+	FEmbreeRay4& Packet = (FEmbreeRay4&)InRay;
+	const int32* ValidLanes = (const int32*)Valid;
+
+	for (int32 Lane = 0; Lane < 4; Lane++)
+	{
+		if (ValidLanes[Lane] == 0)
+		{
+			continue;
+		}
+
+		// Run the single ray filter on the lane's hit
+		FEmbreeRay& Ray = *Packet.Lanes[Lane];
+		Ray.org[0] = Packet.orgx[Lane];
+		Ray.org[1] = Packet.orgy[Lane];
+		Ray.org[2] = Packet.orgz[Lane];
+		Ray.dir[0] = Packet.dirx[Lane];
+		Ray.dir[1] = Packet.diry[Lane];
+		Ray.dir[2] = Packet.dirz[Lane];
+		Ray.tnear = Packet.tnear[Lane];
+		Ray.tfar = Packet.tfar[Lane];
+		Ray.Ng[0] = Packet.Ngx[Lane];
+		Ray.Ng[1] = Packet.Ngy[Lane];
+		Ray.Ng[2] = Packet.Ngz[Lane];
+		Ray.u = Packet.u[Lane];
+		Ray.v = Packet.v[Lane];
+		Ray.geomID = Packet.geomID[Lane];
+		Ray.primID = Packet.primID[Lane];
+		Ray.instID = Packet.instID[Lane];
+
+		EmbreeFilterFunc(UserPtr, Ray);
+
+		if (Ray.geomID == -1)
+		{
+			Packet.geomID[Lane] = RTC_INVALID_GEOMETRY_ID;
+		}
+	}
+}
+
 FEmbreeGeometry::FEmbreeGeometry(
 	RTCDevice EmbreeDevice, 
 	RTCScene EmbreeScene, 
@@ -460,7 +500,7 @@ FEmbreeAggregateMesh::FEmbreeAggregateMesh(const FScene& InScene):
 	rtcDeviceSetMemoryMonitorFunction(InScene.EmbreeDevice, EmbreeMemoryMonitor);
 
 	EmbreeDevice = InScene.EmbreeDevice;
-	EmbreeScene = rtcDeviceNewScene(InScene.EmbreeDevice, RTC_SCENE_STATIC, RTC_INTERSECT1);
+	EmbreeScene = rtcDeviceNewScene(InScene.EmbreeDevice, RTC_SCENE_STATIC, RTC_INTERSECT1 | RTC_INTERSECT4);
 	check(rtcDeviceGetError(EmbreeDevice) == RTC_NO_ERROR);
 }
 
@@ -490,6 +530,8 @@ void FEmbreeAggregateMesh::AddMesh(const FStaticLightingMesh* Mesh, const FStati
 		rtcSetUserData(EmbreeScene, Geo->GeomID, Geo);
 		rtcSetIntersectionFilterFunction(EmbreeScene, Geo->GeomID, EmbreeFilterFunc);
 		rtcSetOcclusionFilterFunction(EmbreeScene, Geo->GeomID, EmbreeFilterFunc);
+		rtcSetIntersectionFilterFunction4(EmbreeScene, Geo->GeomID, EmbreeFilterFunc4);
+		rtcSetOcclusionFilterFunction4(EmbreeScene, Geo->GeomID, EmbreeFilterFunc4);
 
 		bHasShadowCastingPrimitives |= Geo->bHasShadowCastingPrimitives;
 
@@ -572,6 +614,108 @@ bool FEmbreeAggregateMesh::IntersectLightRay(
 		rtcOccluded(EmbreeScene, EmbreeRay);
 	}
 
+	ResolveIntersection(LightRay, EmbreeRay, ClosestIntersection);
+
+	return ClosestIntersection.bIntersects;
+}
+
+void FEmbreeAggregateMesh::IntersectLightRays(
+	const FLightRay* LightRays,
+	int32 NumRays,
+	bool bFindClosestIntersection,
+	bool bCalculateTransmission,
+	bool bDirectShadowingRay,
+	FCoherentRayCache& CoherentRayCache,
+	FLightRayIntersection* OutIntersections) const
+{
+	LIGHTINGSTAT(FScopedRDTSCTimer RayTraceTimer(bFindClosestIntersection ? CoherentRayCache.FirstHitRayTraceTime : CoherentRayCache.BooleanRayTraceTime);)
+	if (bFindClosestIntersection)
+	{
+		CoherentRayCache.NumFirstHitRaysTraced += NumRays;
+	}
+	else
+	{
+		CoherentRayCache.NumBooleanRaysTraced += NumRays;
+	}
+	checkSlow(!bCalculateTransmission || bFindClosestIntersection);
+
+	for (int32 FirstRayIndex = 0; FirstRayIndex < NumRays; FirstRayIndex += 4)
+	{
+		const int32 NumLanes = FMath::Min(NumRays - FirstRayIndex, 4);
+
+		TArray<FEmbreeRay, TInlineAllocator<4> > LaneRays;
+		FEmbreeRay4 Packet;
+		MS_ALIGN(16) int32 ValidLanes[4] GCC_ALIGN(16);
+
+		for (int32 Lane = 0; Lane < 4; Lane++)
+		{
+			ValidLanes[Lane] = 0;
+			Packet.Lanes[Lane] = nullptr;
+
+			// Keep the values of inactive lanes defined, Embree reads whole packets
+			Packet.orgx[Lane] = Packet.orgy[Lane] = Packet.orgz[Lane] = 0;
+			Packet.dirx[Lane] = Packet.diry[Lane] = Packet.dirz[Lane] = 0;
+			Packet.tnear[Lane] = 0;
+			Packet.tfar[Lane] = 0;
+			Packet.time[Lane] = 0;
+			Packet.mask[Lane] = 0xFFFFFFFF;
+			Packet.u[Lane] = Packet.v[Lane] = 0;
+			Packet.geomID[Lane] = -1;
+			Packet.instID[Lane] = -1;
+			Packet.primID[Lane] = -1;
+
+			if (Lane < NumLanes)
+			{
+				const FLightRay& LightRay = LightRays[FirstRayIndex + Lane];
+				new(LaneRays) FEmbreeRay(LightRay.Mesh, LightRay.Mapping ? LightRay.Mapping->Mesh : NULL, LightRay.TraceFlags, bFindClosestIntersection, bCalculateTransmission, bDirectShadowingRay);
+
+				Packet.orgx[Lane] = LightRay.Start.X;
+				Packet.orgy[Lane] = LightRay.Start.Y;
+				Packet.orgz[Lane] = LightRay.Start.Z;
+				Packet.dirx[Lane] = LightRay.Direction.X;
+				Packet.diry[Lane] = LightRay.Direction.Y;
+				Packet.dirz[Lane] = LightRay.Direction.Z;
+				Packet.tfar[Lane] = LightRay.Length;
+				ValidLanes[Lane] = -1;
+			}
+		}
+
+		// LaneRays doesn't grow past its inline allocation, the pointers stay valid
+		for (int32 Lane = 0; Lane < NumLanes; Lane++)
+		{
+			Packet.Lanes[Lane] = &LaneRays[Lane];
+		}
+
+		if (bFindClosestIntersection)
+		{
+			rtcIntersect4(ValidLanes, EmbreeScene, Packet);
+		}
+		else
+		{
+			rtcOccluded4(ValidLanes, EmbreeScene, Packet);
+		}
+
+		for (int32 Lane = 0; Lane < NumLanes; Lane++)
+		{
+			FEmbreeRay& EmbreeRay = LaneRays[Lane];
+			EmbreeRay.tfar = Packet.tfar[Lane];
+			EmbreeRay.Ng[0] = Packet.Ngx[Lane];
+			EmbreeRay.Ng[1] = Packet.Ngy[Lane];
+			EmbreeRay.Ng[2] = Packet.Ngz[Lane];
+			EmbreeRay.u = Packet.u[Lane];
+			EmbreeRay.v = Packet.v[Lane];
+			EmbreeRay.geomID = Packet.geomID[Lane];
+			EmbreeRay.primID = Packet.primID[Lane];
+
+			FLightRayIntersection& Intersection = OutIntersections[FirstRayIndex + Lane];
+			Intersection.bIntersects = false;
+			ResolveIntersection(LightRays[FirstRayIndex + Lane], EmbreeRay, Intersection);
+		}
+	}
+}
+
+void FEmbreeAggregateMesh::ResolveIntersection(const FLightRay& LightRay, FEmbreeRay& EmbreeRay, FLightRayIntersection& Intersection) const
+{
 	if (EmbreeRay.geomID != -1 && EmbreeRay.primID != -1)
 	{
 		const FEmbreeGeometry& Geo = *(FEmbreeGeometry*)rtcGetUserData(EmbreeScene, EmbreeRay.geomID);
@@ -583,16 +727,14 @@ bool FEmbreeAggregateMesh::IntersectLightRay(
 		EmbreeVertex.TextureCoordinates[0] = EmbreeRay.TextureCoordinates;
 		EmbreeVertex.TextureCoordinates[1] = EmbreeRay.LightmapCoordinates;
 
-		ClosestIntersection = FLightRayIntersection(true, EmbreeVertex, Geo.Mesh, Geo.Mapping, EmbreeRay.RelativeVertexIndex, EmbreeRay.ElementIndex);
+		Intersection = FLightRayIntersection(true, EmbreeVertex, Geo.Mesh, Geo.Mapping, EmbreeRay.RelativeVertexIndex, EmbreeRay.ElementIndex);
 
-		EmbreeRay.TransmissionAcc.Resolve(ClosestIntersection.Transmission, EmbreeRay.tfar);
+		EmbreeRay.TransmissionAcc.Resolve(Intersection.Transmission, EmbreeRay.tfar);
 	}
 	else
 	{
-		EmbreeRay.TransmissionAcc.Resolve(ClosestIntersection.Transmission);
+		EmbreeRay.TransmissionAcc.Resolve(Intersection.Transmission);
 	}
-
-	return ClosestIntersection.bIntersects;
 }
 
 FEmbreeVerifyAggregateMesh::FEmbreeVerifyAggregateMesh(const FScene& InScene) :
@@ -12,6 +12,7 @@ namespace Lightmass
 	class FStaticLightingMesh;
 
 	void EmbreeFilterFunc(void* UserPtr, RTCRay& InRay);
+	void EmbreeFilterFunc4(const void* Valid, void* UserPtr, RTCRay4& InRay);
 
 	// Accumulates transmission color, and store the distance.
 	// This is required since Embree test collision in any order, 
@@ -58,6 +59,12 @@ namespace Lightmass
 		FEmbreeTransmissionAccumulator TransmissionAcc;
 	};
 
+	// Packet of four rays, the filter function runs the single ray filter on the lanes' FEmbreeRay
+	struct FEmbreeRay4 : public RTCRay4
+	{
+		FEmbreeRay* Lanes[4];
+	};
+
 
 	struct FEmbreeTriangleDesc
 	{
@@ -122,8 +129,21 @@ namespace Lightmass
 			class FCoherentRayCache& CoherentRayCache,
 			FLightRayIntersection& Intersection) const override;
 
+		/** Traces the rays in packets of four */
+		virtual void IntersectLightRays(
+			const FLightRay* LightRays,
+			int32 NumRays,
+			bool bFindClosestIntersection,
+			bool bCalculateTransmission,
+			bool bDirectShadowingRay,
+			class FCoherentRayCache& CoherentRayCache,
+			FLightRayIntersection* OutIntersections) const override;
+
 	private:
 
+		/** Fills out the intersection from a traced ray */
+		void ResolveIntersection(const FLightRay& LightRay, FEmbreeRay& EmbreeRay, FLightRayIntersection& Intersection) const;
+
 		/** Information about the meshes used in the kDOP tree. */
 		TArray<const FEmbreeGeometry*> MeshInfos;
 
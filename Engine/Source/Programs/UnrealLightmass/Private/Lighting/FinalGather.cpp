@@ -1442,8 +1442,14 @@ SampleType FStaticLightingSystem::IncomingRadianceUniform(
 	float NumSamplesOccluded = 0;
 	FVector CombinedSkyUnoccludedDirection(0);
 
-	// Estimate the indirect part of the light transport equation using uniform sampled monte carlo integration
-	//@todo - use cosine sampling if possible to match the indirect integrand, the irradiance caching algorithm assumes uniform sampling
+	// The first bounce rays are independent of each other, trace them all up front so the aggregate mesh can trace them in packets
+	TArray<FVector4> WorldPathDirections;
+	TArray<FVector4> TangentPathDirections;
+	TArray<FLightRay> PathRays;
+	WorldPathDirections.Empty(UniformHemisphereSamples.Num());
+	TangentPathDirections.Empty(UniformHemisphereSamples.Num());
+	PathRays.Empty(UniformHemisphereSamples.Num());
+
 	for (int32 SampleIndex = 0; SampleIndex < UniformHemisphereSamples.Num(); SampleIndex++)
 	{
 		const FVector4 TriangleTangentPathDirection = UniformHemisphereSamples[SampleIndex];
@@ -1468,7 +1474,9 @@ SampleType FStaticLightingSystem::IncomingRadianceUniform(
 				+ Vertex.WorldTangentY * TangentPathDirection.Y * SampleRadius * SceneConstants.VisibilityTangentOffsetSampleRadiusScale;
 		}
 
-		const FLightRay PathRay(
+		WorldPathDirections.Add(WorldPathDirection);
+		TangentPathDirections.Add(TangentPathDirection);
+		new(PathRays) FLightRay(
 			// Apply various offsets to the start of the ray.
 			// The offset along the ray direction is to avoid incorrect self-intersection due to floating point precision.
 			// The offset along the normal is to push self-intersection patterns (like triangle shape) on highly curved surfaces onto the backfaces.
@@ -1480,12 +1488,25 @@ SampleType FStaticLightingSystem::IncomingRadianceUniform(
 			Mapping,
 			NULL
 			);
+	}
 
-		MappingContext.Stats.NumFirstBounceRaysTraced++;
+	TArray<FLightRayIntersection> RayIntersections;
+	RayIntersections.AddDefaulted(PathRays.Num());
+	{
+		MappingContext.Stats.NumFirstBounceRaysTraced += PathRays.Num();
 		const float LastRayTraceTime = MappingContext.RayCache.FirstHitRayTraceTime;
-		FLightRayIntersection RayIntersection;
-		AggregateMesh->IntersectLightRay(PathRay, true, false, false, MappingContext.RayCache, RayIntersection);
+		AggregateMesh->IntersectLightRays(PathRays.GetData(), PathRays.Num(), true, false, false, MappingContext.RayCache, RayIntersections.GetData());
 		MappingContext.Stats.FirstBounceRayTraceTime += MappingContext.RayCache.FirstHitRayTraceTime - LastRayTraceTime;
+	}
+
+	// Estimate the indirect part of the light transport equation using uniform sampled monte carlo integration
+	//@todo - use cosine sampling if possible to match the indirect integrand, the irradiance caching algorithm assumes uniform sampling
+	for (int32 SampleIndex = 0; SampleIndex < UniformHemisphereSamples.Num(); SampleIndex++)
+	{
+		const FVector4 WorldPathDirection = WorldPathDirections[SampleIndex];
+		const FVector4 TangentPathDirection = TangentPathDirections[SampleIndex];
+		const FLightRay& PathRay = PathRays[SampleIndex];
+		const FLightRayIntersection& RayIntersection = RayIntersections[SampleIndex];
 
 		float PhotonImportanceSampledPDF = 0.0f;
 		{
@@ -2216,6 +2216,10 @@ int32 FStaticLightingSystem::CalculatePointAreaShadowing(
 		const bool bIsTwoSided = Mapping->Mesh->IsTwoSided(ElementIndex);
 		int32 UnShadowedRays = 0;
 
+		// The rays all go from the vertex to the same light, gather them so they can be traced together
+		TArray<FLightRay, TInlineAllocator<64> > LightRays;
+		LightRays.Empty(LightPositionSamples.Num());
+
 		// Integrate over the surface of the light using monte carlo integration
 		// Note that we are making the approximation that the BRDF and the Light's emission are equal in all of these directions and therefore are not in the integrand
 		for(int32 RayIndex = 0; RayIndex < LightPositionSamples.Num(); RayIndex++)
@@ -2245,7 +2249,7 @@ int32 FStaticLightingSystem::CalculatePointAreaShadowing(
 				NormalForOffset = -NormalForOffset;
 			}
 			
-			const FLightRay LightRay(
+			new(LightRays) FLightRay(
 				// Offset the start of the ray by some fraction along the direction of the ray and some fraction along the vertex normal.
 				Vertex.WorldPosition 
 					+ LightVector.GetSafeNormal() * SceneConstants.VisibilityRayOffsetDistance 
@@ -2255,11 +2259,17 @@ int32 FStaticLightingSystem::CalculatePointAreaShadowing(
 				Mapping,
 				Light
 				);
+		}
 
-			// Check the line segment for intersection with the static lighting meshes.
-			FLightRayIntersection Intersection;
-			//@todo - change this back to request boolean visibility once transmission is supported with boolean visibility ray intersections
-			AggregateMesh->IntersectLightRay(LightRay, true, true, true, MappingContext.RayCache, Intersection);
+		// Check the line segments for intersection with the static lighting meshes.
+		TArray<FLightRayIntersection, TInlineAllocator<64> > Intersections;
+		Intersections.AddDefaulted(LightRays.Num());
+		//@todo - change this back to request boolean visibility once transmission is supported with boolean visibility ray intersections
+		AggregateMesh->IntersectLightRays(LightRays.GetData(), LightRays.Num(), true, true, true, MappingContext.RayCache, Intersections.GetData());
+
+		for (int32 RayIndex = 0; RayIndex < LightRays.Num(); RayIndex++)
+		{
+			const FLightRayIntersection& Intersection = Intersections[RayIndex];
 
 			if (!Intersection.bIntersects)
 			{
@@ -2270,7 +2280,7 @@ int32 FStaticLightingSystem::CalculatePointAreaShadowing(
 #if ALLOW_LIGHTMAP_SAMPLE_DEBUGGING
 			if (bDebugThisSample)
 			{
-				FDebugStaticLightingRay DebugRay(LightRay.Start, LightRay.End, Intersection.bIntersects);
+				FDebugStaticLightingRay DebugRay(LightRays[RayIndex].Start, LightRays[RayIndex].End, Intersection.bIntersects);
 				if (Intersection.bIntersects)
 				{
 					DebugRay.End = Intersection.IntersectionVertex.WorldPosition;
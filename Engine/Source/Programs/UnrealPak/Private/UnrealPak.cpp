@@ -10,6 +10,7 @@
 #include "AES.h"
 #include "UniquePtr.h"
 #include "Serialization/BufferWriter.h"
+#include "Modules/ModuleManager.h"
 
 IMPLEMENT_APPLICATION(UnrealPak, "UnrealPak");
 
@@ -18,20 +19,24 @@ struct FPakCommandLineParameters
 	FPakCommandLineParameters()
 		: CompressionBlockSize(64*1024)
 		, CompressionBitWindow(DEFAULT_ZLIB_BIT_WINDOW)
+		, CompressionMethod(COMPRESS_Default)
 		, FileSystemBlockSize(0)
 		, PatchFilePadAlign(0)
 		, GeneratePatch(false)
 		, EncryptIndex(false)
+		, PathHashIndex(false)
 	{}
 
 	int32  CompressionBlockSize;
 	int32  CompressionBitWindow;
+	ECompressionFlags CompressionMethod;
 	int64  FileSystemBlockSize;
 	int64  PatchFilePadAlign;
 	bool   GeneratePatch;
 	FString SourcePatchPakFilename;
 	FString SourcePatchDiffDirectory;
 	bool EncryptIndex;
+	bool PathHashIndex;
 };
 
 struct FPakEntryPair
@@ -470,6 +475,20 @@ void ProcessCommandLine(int32 ArgC, TCHAR* ArgV[], TArray<FPakInputPair>& Entrie
 		CmdLineParameters.CompressionBitWindow = DEFAULT_ZLIB_BIT_WINDOW;
 	}
 
+	CmdLineParameters.CompressionMethod = COMPRESS_Default;
+	FString CompressionFormat;
+	if (FParse::Value(FCommandLine::Get(), TEXT("-compressionformat="), CompressionFormat) && CompressionFormat != TEXT("Zlib"))
+	{
+		if (FCompression::GetCustomCompressionFlags(FName(*CompressionFormat), CmdLineParameters.CompressionMethod))
+		{
+			UE_LOG(LogPakFile, Display, TEXT("Compressing with %s."), *CompressionFormat);
+		}
+		else
+		{
+			UE_LOG(LogPakFile, Warning, TEXT("Compression format \"%s\" is not registered, compressing with zlib."), *CompressionFormat);
+		}
+	}
+
 	if (!FParse::Value(FCommandLine::Get(), TEXT("-patchpaddingalign="), CmdLineParameters.PatchFilePadAlign))
 	{
 		CmdLineParameters.PatchFilePadAlign = 0;
@@ -480,6 +499,11 @@ void ProcessCommandLine(int32 ArgC, TCHAR* ArgV[], TArray<FPakInputPair>& Entrie
 		CmdLineParameters.EncryptIndex = true;
 	}
 
+	if (FParse::Param(FCommandLine::Get(), TEXT("pathhashindex")))
+	{
+		CmdLineParameters.PathHashIndex = true;
+	}
+
 	if (FParse::Value(FCommandLine::Get(), TEXT("-create="), ResponseFile))
 	{
 		TArray<FString> Lines;
@@ -949,6 +973,8 @@ bool CreatePakFile(const TCHAR* Filename, TArray<FPakInputPair>& FilesToAdd, con
 
 	FPakInfo Info;
 	Info.bEncryptedIndex = (AESKeyIsValid() && CmdLineParameters.EncryptIndex);
+	// only paks that ask for the path hash index need a runtime that understands it
+	Info.Version = CmdLineParameters.PathHashIndex ? FPakInfo::PakFile_Version_PathHashIndex : FPakInfo::PakFile_Version_IndexEncryption;
 
 	TArray<FPakEntryPair> Index;
 	FString MountPoint = GetCommonRootPath(FilesToAdd);
@@ -1014,7 +1040,7 @@ bool CreatePakFile(const TCHAR* Filename, TArray<FPakInputPair>& FilesToAdd, con
 		//check if this file requested to be compression
 		int64 OriginalFileSize = IFileManager::Get().FileSize(*FilesToAdd[FileIndex].Source);
 		int64 RealFileSize = OriginalFileSize + NewEntry.Info.GetSerializedSize(FPakInfo::PakFile_Version_Latest);
-		CompressionMethod = (FilesToAdd[FileIndex].bNeedsCompression && OriginalFileSize > 0) ? COMPRESS_Default : COMPRESS_None;
+		CompressionMethod = (FilesToAdd[FileIndex].bNeedsCompression && OriginalFileSize > 0) ? CmdLineParameters.CompressionMethod : COMPRESS_None;
 
 		if (CompressionMethod != COMPRESS_None)
 		{
@@ -1226,11 +1252,38 @@ bool CreatePakFile(const TCHAR* Filename, TArray<FPakInputPair>& FilesToAdd, con
 	int32 NumEntries = Index.Num();
 	IndexWriter << MountPoint;
 	IndexWriter << NumEntries;
+	if (Info.Version >= FPakInfo::PakFile_Version_PathHashIndex)
+	{
+		// entries and their path hashes first, the paths go last so the runtime can leave them serialized
+		TArray<FString> Filenames;
+		Filenames.Reserve(Index.Num());
+		for (FPakEntryPair& Entry : Index)
+		{
+			Entry.Info.Serialize(IndexWriter, Info.Version);
+			Filenames.Add(Entry.Filename);
+		}
+
+		FPakPathHashIndex PathHashIndex;
+		if (!PathHashIndex.Build(Filenames))
+		{
+			UE_LOG(LogPakFile, Error, TEXT("Unable to build the path hash index of \"%s\", it contains duplicate paths."), Filename);
+			return false;
+		}
+		IndexWriter << PathHashIndex;
+
+		for (FString& EntryFilename : Filenames)
+		{
+			IndexWriter << EntryFilename;
+		}
+	}
 	for (int32 EntryIndex = 0; EntryIndex < Index.Num(); EntryIndex++)
 	{
 		FPakEntryPair& Entry = Index[EntryIndex];
-		IndexWriter << Entry.Filename;
-		Entry.Info.Serialize(IndexWriter, Info.Version);
+		if (Info.Version < FPakInfo::PakFile_Version_PathHashIndex)
+		{
+			IndexWriter << Entry.Filename;
+			Entry.Info.Serialize(IndexWriter, Info.Version);
+		}
 
 		if (RequiredPatchPadding > 0)
 		{
@@ -1360,6 +1413,193 @@ bool ListFilesInPak(const TCHAR * InPakFilename, int64 SizeFilter = 0)
 	}
 }
 
+/**
+ * Merges pak read order captures recorded with -RecordPakReadOrder into an order file for this pak.
+ * Files are ordered by their average first read position across the captures, and the seeks each capture
+ * would need with the current and the new layout are reported.
+ */
+bool MergeReadOrderCaptures(const TCHAR* InPakFilename, const FString& InCaptures, const FString& InOutputOrderFile)
+{
+	FPakFile PakFile(InPakFilename, FParse::Param(FCommandLine::Get(), TEXT("signed")));
+	if (!PakFile.IsValid())
+	{
+		UE_LOG(LogPakFile, Error, TEXT("Unable to open pak file \"%s\"."), InPakFilename);
+		return false;
+	}
+
+	// entries in their current layout order, offsets in the captures identify them
+	TArray<FPakFile::FFileIterator> Records;
+	for (FPakFile::FFileIterator It(PakFile); It; ++It)
+	{
+		Records.Add(It);
+	}
+	Records.Sort([](const FPakFile::FFileIterator& A, const FPakFile::FFileIterator& B) { return A.Info().Offset < B.Info().Offset; });
+
+	TMap<int64, int32> RecordIndexByOffset;
+	for (int32 RecordIndex = 0; RecordIndex < Records.Num(); ++RecordIndex)
+	{
+		RecordIndexByOffset.Add(Records[RecordIndex].Info().Offset, RecordIndex);
+	}
+
+	struct FCapturedRead
+	{
+		int32 RecordIndex;
+		int64 OffsetInEntry;
+		int64 Size;
+	};
+
+	const FString PakName = FPaths::GetCleanFilename(InPakFilename);
+	TArray<FString> CaptureFilenames;
+	InCaptures.ParseIntoArray(CaptureFilenames, TEXT("+"), true);
+
+	TArray<TArray<FCapturedRead>> Captures;
+	TArray<double> RankSum;
+	TArray<int32> RankCount;
+	RankSum.AddZeroed(Records.Num());
+	RankCount.AddZeroed(Records.Num());
+
+	for (const FString& CaptureFilename : CaptureFilenames)
+	{
+		TArray<FString> Lines;
+		if (!FFileHelper::LoadANSITextFileToStrings(*CaptureFilename, &IFileManager::Get(), Lines))
+		{
+			UE_LOG(LogPakFile, Warning, TEXT("Unable to load pak read order capture \"%s\"."), *CaptureFilename);
+			continue;
+		}
+
+		TArray<FCapturedRead>& Reads = Captures[Captures.AddDefaulted()];
+		TArray<int32> FirstTouched;
+		TBitArray<> Touched(false, Records.Num());
+		int32 NumUnknownReads = 0;
+		for (const FString& Line : Lines)
+		{
+			TArray<FString> Fields;
+			if (Line.StartsWith(TEXT("#")) || Line.ParseIntoArray(Fields, TEXT(","), false) != 4 || Fields[0] != PakName)
+			{
+				continue;
+			}
+
+			const int32* RecordIndex = RecordIndexByOffset.Find(FCString::Atoi64(*Fields[1]));
+			if (!RecordIndex)
+			{
+				// the capture was made against a different build of the pak
+				++NumUnknownReads;
+				continue;
+			}
+
+			FCapturedRead& Read = Reads[Reads.AddUninitialized()];
+			Read.RecordIndex = *RecordIndex;
+			Read.OffsetInEntry = FCString::Atoi64(*Fields[2]);
+			Read.Size = FCString::Atoi64(*Fields[3]);
+
+			if (!Touched[*RecordIndex])
+			{
+				Touched[*RecordIndex] = true;
+				FirstTouched.Add(*RecordIndex);
+			}
+		}
+
+		UE_CLOG(NumUnknownReads > 0, LogPakFile, Warning, TEXT("%d reads in \"%s\" don't match any file in \"%s\"."), NumUnknownReads, *CaptureFilename, InPakFilename);
+		UE_LOG(LogPakFile, Display, TEXT("Capture \"%s\": %d reads of %d files."), *CaptureFilename, Reads.Num(), FirstTouched.Num());
+
+		// ranks are normalized so short and long sessions weigh the same
+		for (int32 Rank = 0; Rank < FirstTouched.Num(); ++Rank)
+		{
+			RankSum[FirstTouched[Rank]] += double(Rank) / double(FirstTouched.Num());
+			RankCount[FirstTouched[Rank]]++;
+		}
+	}
+
+	TArray<int32> NewOrder;
+	for (int32 RecordIndex = 0; RecordIndex < Records.Num(); ++RecordIndex)
+	{
+		if (RankCount[RecordIndex])
+		{
+			NewOrder.Add(RecordIndex);
+		}
+	}
+	if (!NewOrder.Num())
+	{
+		UE_LOG(LogPakFile, Error, TEXT("No reads of \"%s\" were found in the captures."), *PakName);
+		return false;
+	}
+	NewOrder.StableSort([&RankSum, &RankCount](int32 A, int32 B)
+	{
+		return RankSum[A] / RankCount[A] < RankSum[B] / RankCount[B];
+	});
+
+	// write the order file the same way -order expects it, files that weren't read keep their current relative order after these
+	FString OrderText;
+	for (int32 OrderIndex = 0; OrderIndex < NewOrder.Num(); ++OrderIndex)
+	{
+		OrderText += FString::Printf(TEXT("\"%s%s\" %d\r\n"), *PakFile.GetMountPoint(), *Records[NewOrder[OrderIndex]].Filename(), OrderIndex + 1);
+	}
+	if (!FFileHelper::SaveStringToFile(OrderText, *InOutputOrderFile))
+	{
+		UE_LOG(LogPakFile, Error, TEXT("Unable to write order file \"%s\"."), *InOutputOrderFile);
+		return false;
+	}
+	UE_LOG(LogPakFile, Display, TEXT("Wrote %d ordered files to \"%s\"."), NewOrder.Num(), *InOutputOrderFile);
+
+	// simulate the captures against both layouts, reads more than a chunk away from where the last one ended need a seek
+	TArray<int64> CurrentLayout;
+	TArray<int64> NewLayout;
+	CurrentLayout.AddUninitialized(Records.Num());
+	NewLayout.AddUninitialized(Records.Num());
+	TBitArray<> Placed(false, Records.Num());
+	int64 LayoutOffset = 0;
+	for (int32 RecordIndex : NewOrder)
+	{
+		NewLayout[RecordIndex] = LayoutOffset;
+		LayoutOffset += Records[RecordIndex].Info().Size;
+		Placed[RecordIndex] = true;
+	}
+	for (int32 RecordIndex = 0; RecordIndex < Records.Num(); ++RecordIndex)
+	{
+		CurrentLayout[RecordIndex] = Records[RecordIndex].Info().Offset;
+		if (!Placed[RecordIndex])
+		{
+			NewLayout[RecordIndex] = LayoutOffset;
+			LayoutOffset += Records[RecordIndex].Info().Size;
+		}
+	}
+
+	auto CountSeeks = [&Records](const TArray<FCapturedRead>& Reads, const TArray<int64>& Layout, int64& OutSeekDistance)
+	{
+		const int64 SeekThreshold = FPakInfo::MaxChunkDataSize;
+		int64 LastEnd = -1;
+		int32 NumSeeks = 0;
+		OutSeekDistance = 0;
+		for (const FCapturedRead& Read : Reads)
+		{
+			// reads are in uncompressed space, scale them to where they land in the stored data
+			const FPakEntry& Entry = Records[Read.RecordIndex].Info();
+			const double Scale = (Entry.CompressionMethod != COMPRESS_None && Entry.UncompressedSize > 0) ? double(Entry.Size) / double(Entry.UncompressedSize) : 1.0;
+			const int64 Start = Layout[Read.RecordIndex] + int64(Read.OffsetInEntry * Scale);
+			const int64 End = Start + FMath::Max<int64>(int64(Read.Size * Scale), 1);
+			if (LastEnd < 0 || FMath::Abs(Start - LastEnd) > SeekThreshold)
+			{
+				++NumSeeks;
+				OutSeekDistance += LastEnd < 0 ? 0 : FMath::Abs(Start - LastEnd);
+			}
+			LastEnd = End;
+		}
+		return NumSeeks;
+	};
+
+	for (int32 CaptureIndex = 0; CaptureIndex < Captures.Num(); ++CaptureIndex)
+	{
+		int64 CurrentDistance = 0;
+		int64 NewDistance = 0;
+		const int32 CurrentSeeks = CountSeeks(Captures[CaptureIndex], CurrentLayout, CurrentDistance);
+		const int32 NewSeeks = CountSeeks(Captures[CaptureIndex], NewLayout, NewDistance);
+		UE_LOG(LogPakFile, Display, TEXT("Capture %d: %d seeks (%lld MB travelled) with the current layout, %d seeks (%lld MB travelled) with the new order, %.1f%% fewer seeks."),
+			CaptureIndex, CurrentSeeks, CurrentDistance / (1024 * 1024), NewSeeks, NewDistance / (1024 * 1024), CurrentSeeks ? 100.0 * (CurrentSeeks - NewSeeks) / CurrentSeeks : 0.0);
+	}
+
+	return true;
+}
+
 bool ExtractFilesFromPak(const TCHAR* InPakFilename, const TCHAR* InDestPath, bool bUseMountPoint = false)
 {
 	FPakFile PakFile(InPakFilename, FParse::Param(FCommandLine::Get(), TEXT("signed")));
@@ -1818,6 +2058,16 @@ INT32_MAIN_INT32_ARGC_TCHAR_ARGV()
 	// start up the main loop
 	GEngineLoop.PreInit(ArgC, ArgV);
 
+	// formats other than zlib are provided by modules registering an ICompressionFormat, needed to both create and read paks using them
+	FString CompressionModule;
+	if (FParse::Value(FCommandLine::Get(), TEXT("-compressionmodule="), CompressionModule))
+	{
+		if (!FModuleManager::Get().LoadModule(*CompressionModule).IsValid())
+		{
+			UE_LOG(LogPakFile, Warning, TEXT("Unable to load compression module \"%s\"."), *CompressionModule);
+		}
+	}
+
 	if (ArgC < 2)
 	{
 		UE_LOG(LogPakFile, Error, TEXT("No pak file name specified. Usage:"));
@@ -1829,11 +2079,14 @@ INT32_MAIN_INT32_ARGC_TCHAR_ARGV()
 		UE_LOG(LogPakFile, Error, TEXT("  UnrealPak GenerateKeys=<KeyFilename>"));
 		UE_LOG(LogPakFile, Error, TEXT("  UnrealPak GeneratePrimeTable=<KeyFilename> [-TableMax=<N>]"));
 		UE_LOG(LogPakFile, Error, TEXT("  UnrealPak <PakFilename1> <PakFilename2> -diff"));
+		UE_LOG(LogPakFile, Error, TEXT("  UnrealPak <PakFilename> -MergeReadOrder=<Capture1>+<Capture2>... [-OutputOrder=<OrderingFile>] (captures are written at runtime with -RecordPakReadOrder=<Capture>)"));
 		UE_LOG(LogPakFile, Error, TEXT("  UnrealPak -TestEncryption"));
 		UE_LOG(LogPakFile, Error, TEXT("  Options:"));
 		UE_LOG(LogPakFile, Error, TEXT("    -blocksize=<BlockSize>"));
 		UE_LOG(LogPakFile, Error, TEXT("    -bitwindow=<BitWindow>"));
 		UE_LOG(LogPakFile, Error, TEXT("    -compress"));
+		UE_LOG(LogPakFile, Error, TEXT("    -compressionformat=<FormatName> (compress with a registered compression format instead of zlib)"));
+		UE_LOG(LogPakFile, Error, TEXT("    -compressionmodule=<ModuleName> (load a module that registers compression formats)"));
 		UE_LOG(LogPakFile, Error, TEXT("    -encrypt"));
 		UE_LOG(LogPakFile, Error, TEXT("    -order=<OrderingFile>"));
 		UE_LOG(LogPakFile, Error, TEXT("    -diff (requires 2 filenames first)"));
@@ -1841,6 +2094,7 @@ INT32_MAIN_INT32_ARGC_TCHAR_ARGV()
 		UE_LOG(LogPakFile, Error, TEXT("    -projectdir (specify project dir for when using ini encryption configs)"));
 		UE_LOG(LogPakFile, Error, TEXT("    -encryptionini (specify ini base name to gather encryption settings from)"));
 		UE_LOG(LogPakFile, Error, TEXT("    -encryptindex (encrypt the pak file index, making it unusable in unrealpak without supplying the key)"));
+		UE_LOG(LogPakFile, Error, TEXT("    -pathhashindex (write an index that finds files by path hash, paks can then only be mounted by engines supporting pak version %d)"), (int32)FPakInfo::PakFile_Version_PathHashIndex);
 		return 1;
 	}
 
@@ -1867,6 +2121,7 @@ INT32_MAIN_INT32_ARGC_TCHAR_ARGV()
 	}
 	else 
 	{
+		FString ReadOrderCaptures;
 		if (FParse::Param(FCommandLine::Get(), TEXT("Test")))
 		{
 			FString PakFilename = GetPakPath(ArgV[1], false);
@@ -1880,6 +2135,16 @@ INT32_MAIN_INT32_ARGC_TCHAR_ARGV()
 			FString PakFilename = GetPakPath(ArgV[1], false);
 			Result = ListFilesInPak(*PakFilename, SizeFilter) ? 0 : 1;
 		}
+		else if (FParse::Value(FCommandLine::Get(), TEXT("MergeReadOrder="), ReadOrderCaptures))
+		{
+			FString PakFilename = GetPakPath(ArgV[1], false);
+			FString OutputOrderFile;
+			if (!FParse::Value(FCommandLine::Get(), TEXT("OutputOrder="), OutputOrderFile))
+			{
+				OutputOrderFile = FPaths::ChangeExtension(PakFilename, TEXT("order.txt"));
+			}
+			Result = MergeReadOrderCaptures(*PakFilename, ReadOrderCaptures, OutputOrderFile) ? 0 : 1;
+		}
 		else if (FParse::Param(FCommandLine::Get(), TEXT("Diff")))
 		{
 			FString PakFilename1 = GetPakPath(ArgV[1], false);
@@ -38,9 +38,19 @@ class AIMODULE_API UBehaviorTreeManager : public UObject
 	UPROPERTY(config)
 	int32 MaxDebuggerSteps;
 
+	/** limit of released instance memory blocks kept for reuse, per behavior tree asset */
+	UPROPERTY(config)
+	int32 MaxPooledInstanceMemoryBlocks;
+
 	/** get behavior tree template for given blueprint */
 	bool LoadTree(UBehaviorTree& Asset, UBTCompositeNode*& Root, uint16& InstanceMemorySize);
 
+	/** get empty memory block for instance of given tree, reusing allocation of released one when possible */
+	void AcquireInstanceMemory(const UBehaviorTree& Asset, TArray<uint8>& Memory);
+
+	/** return memory block of given tree's instance for reuse, Memory will be empty afterwards */
+	void ReleaseInstanceMemory(const UBehaviorTree& Asset, TArray<uint8>& Memory);
+
 	/** get aligned memory size */
 	static int32 GetAlignedDataSize(int32 Size);
 
@@ -69,4 +79,7 @@ protected:
 
 	UPROPERTY()
 	TArray<UBehaviorTreeComponent*> ActiveComponents;
+
+	/** released instance memory blocks, assets are referenced by LoadedTemplates */
+	TMap<const UBehaviorTree*, TArray<TArray<uint8> > > InstanceMemoryPool;
 };
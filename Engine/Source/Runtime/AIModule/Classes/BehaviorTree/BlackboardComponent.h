@@ -244,8 +244,8 @@ protected:
 	TArray<UBlackboardKeyType*> KeyInstances;
 
 protected:
-	/** observers registered for blackboard keys */
-	mutable TMultiMap<uint8, FOnBlackboardChangeNotification> Observers;
+	/** observers registered for blackboard keys, indexed by key ID */
+	mutable TArray<TArray<FOnBlackboardChangeNotification> > Observers;
 	
 	/** observers registered from owner objects */
 	TMultiMap<UObject*, FDelegateHandle> ObserverHandles;
@@ -253,6 +253,9 @@ protected:
 	/** queued key change notification, will be processed on ResumeUpdates call */
 	mutable TArray<uint8> QueuedUpdates;
 
+	/** depth of NotifyObservers calls, observers are only unbound while it's running and removed later */
+	mutable int32 NotifyObserversDepth;
+
 	/** set when observation notifies are paused and shouldn't be passed to observers */
 	uint32 bPausedNotifies : 1;
 
@@ -262,6 +265,9 @@ protected:
 	/** notifies behavior tree decorators about change in blackboard */
 	void NotifyObservers(FBlackboard::FKey KeyID) const;
 
+	/** removes observer of key without touching ObserverHandles, returns false if it wasn't found */
+	bool RemoveObserver(FBlackboard::FKey KeyID, FDelegateHandle ObserverHandle);
+
 	/** initializes parent chain in asset */
 	void InitializeParentChain(UBlackboardData* NewAsset);
 
@@ -33,6 +33,11 @@ class AIMODULE_API UEnvQueryGenerator : public UEnvQueryNode
 	UPROPERTY(EditDefaultsOnly, Category = Option, AdvancedDisplay)
 	uint32 bAutoSortTests : 1;
 
+	/** if set, items will be reused by other queries running this generator on the same context values and query params in the same frame.
+	 *  Enable only when generated items don't depend on anything else, e.g. querier's navigation data */
+	UPROPERTY(EditDefaultsOnly, Category = Option, AdvancedDisplay)
+	uint32 bShareGeneratedItems : 1;
+
 	virtual void GenerateItems(FEnvQueryInstance& QueryInstance) const { checkNoEntry(); }
 
 	virtual void PostLoad() override;
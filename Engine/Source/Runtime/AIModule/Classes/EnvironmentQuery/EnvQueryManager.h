@@ -16,6 +16,7 @@
 
 class UEnvQuery;
 class UEnvQueryManager;
+class UEnvQueryGenerator;
 class UEnvQueryOption;
 class UEnvQueryTest;
 
@@ -92,6 +93,19 @@ struct FEnvQueryInstanceCache
 	FName AssetName;
 };
 
+/** items created by generator with bShareGeneratedItems, reused by other queries running on the same contexts in the same frame */
+struct FEnvQuerySharedItems
+{
+	/** contexts read by generator and their values */
+	TArray<TPair<UClass*, FEnvQueryContextData>> Contexts;
+
+	/** named params of query that created items */
+	TMap<FName, float> NamedParams;
+
+	TArray<FEnvQueryItem> Items;
+	TArray<uint8> RawData;
+};
+
 #if USE_EQS_DEBUGGER
 struct AIMODULE_API FEQSDebugger
 {
@@ -220,6 +234,12 @@ class AIMODULE_API UEnvQueryManager : public UObject, public FTickableGameObject
 	/** clear information about query instance run independently */
 	void UnregisterExternalQuery(const TSharedPtr<FEnvQueryInstance>& QueryInstance);
 
+	/** copy items created this frame by Generator for the same contexts and params, returns false if there aren't any */
+	bool CopySharedGeneratedItems(const UEnvQueryGenerator* Generator, FEnvQueryInstance& QueryInstance);
+
+	/** store items just created by Generator, to be reused by other queries during this frame */
+	void StoreSharedGeneratedItems(const UEnvQueryGenerator* Generator, const FEnvQueryInstance& QueryInstance);
+
 	/** list of all known item types */
 	static TArray<TSubclassOf<UEnvQueryItemType> > RegisteredItemTypes;
 
@@ -278,6 +298,12 @@ protected:
 	/** local contexts mapped by class names */
 	TMap<FName, UEnvQueryContext*> LocalContextMap;
 
+	/** items of generators with bShareGeneratedItems, valid only during SharedGeneratedItemsFrame */
+	TMultiMap<const UEnvQueryGenerator*, FEnvQuerySharedItems> SharedGeneratedItems;
+
+	/** frame of SharedGeneratedItems */
+	uint64 SharedGeneratedItemsFrame;
+
 	/** next ID for running query */
 	int32 NextQueryID;
 
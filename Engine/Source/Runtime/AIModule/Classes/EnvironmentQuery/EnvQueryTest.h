@@ -201,6 +201,10 @@ public:
 		return GetItemActor(QueryInstance, Iterator.GetIndex());
 	}
 
+	/** helper: collect indices of items left for this test, in the same order as ItemIterator goes through them
+	 *  @return false if per item work shouldn't be spread over worker threads: not enough items or looking for a single result */
+	bool GetItemsForParallelTest(FEnvQueryInstance& QueryInstance, TArray<int32>& ItemIndices) const;
+
 	/** normalize scores in range */
 	void NormalizeItemScores(FEnvQueryInstance& QueryInstance);
 
@@ -308,6 +308,9 @@ protected:
 	/** debug data */
 	dtCrowdAgentDebugInfo* DetourAgentDebug;
 	dtObstacleAvoidanceDebugData* DetourAvoidanceDebug;
+
+	/** obstacle avoidance queries for batches of agents simulated in parallel, one per batch */
+	TArray<dtObstacleAvoidanceQuery*> BatchObstacleQueries;
 #endif
 
 #if WITH_EDITOR
@@ -346,6 +349,9 @@ protected:
 	void CreateCrowdManager();
 	void DestroyCrowdManager();
 
+	/** make sure there's an obstacle avoidance query for every batch of agents simulated in parallel */
+	bool InitBatchObstacleQueries(int32 NumBatches);
+
 #if ENABLE_DRAW_DEBUG
 	void DrawDebugCorners(const dtCrowdAgent* CrowdAgent) const;
 	void DrawDebugCollisionSegments(const dtCrowdAgent* CrowdAgent) const;
@@ -1722,16 +1722,24 @@ bool UBehaviorTreeComponent::PushInstance(UBehaviorTree& TreeAsset)
 		const bool bFirstTime = (InstanceInfo.InstanceMemory.Num() != InstanceMemorySize);
 		if (bFirstTime)
 		{
+			if (InstanceInfo.InstanceMemory.Num() == 0)
+			{
+				BTManager->AcquireInstanceMemory(TreeAsset, InstanceInfo.InstanceMemory);
+			}
+
 			InstanceInfo.InstanceMemory.AddZeroed(InstanceMemorySize);
 			InstanceInfo.RootNode = RootNode;
 		}
 
-		NewInstance.InstanceMemory = InstanceInfo.InstanceMemory;
+		BTManager->AcquireInstanceMemory(TreeAsset, NewInstance.InstanceMemory);
+		NewInstance.InstanceMemory.Append(InstanceInfo.InstanceMemory);
 		NewInstance.Initialize(*this, *RootNode, NodeInstanceIndex, bFirstTime ? EBTMemoryInit::Initialize : EBTMemoryInit::RestoreSubtree);
 
 		INC_DWORD_STAT(STAT_AI_BehaviorTree_NumInstances);
-		InstanceStack.Push(NewInstance);
-		ActiveInstanceIdx = InstanceStack.Num() - 1;
+
+		// swap instead of copy, don't reallocate memory block that was just acquired
+		ActiveInstanceIdx = InstanceStack.AddDefaulted();
+		Swap(InstanceStack[ActiveInstanceIdx], NewInstance);
 
 		// start root level services now (they won't be removed on looping tree anyway)
 		for (int32 ServiceIndex = 0; ServiceIndex < RootNode->Services.Num(); ServiceIndex++)
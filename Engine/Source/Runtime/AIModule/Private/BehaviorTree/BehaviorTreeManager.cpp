@@ -31,6 +31,7 @@ DEFINE_STAT(STAT_AI_BehaviorTree_InstanceMemory);
 UBehaviorTreeManager::UBehaviorTreeManager(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
 	MaxDebuggerSteps = 100;
+	MaxPooledInstanceMemoryBlocks = 32;
 }
 
 void UBehaviorTreeManager::FinishDestroy()
@@ -46,6 +47,7 @@ void UBehaviorTreeManager::FinishDestroy()
 	}
 
 	ActiveComponents.Reset();
+	InstanceMemoryPool.Empty();
 	Super::FinishDestroy();
 }
 
@@ -332,6 +334,37 @@ bool UBehaviorTreeManager::LoadTree(UBehaviorTree& Asset, UBTCompositeNode*& Roo
 	return false;
 }
 
+void UBehaviorTreeManager::AcquireInstanceMemory(const UBehaviorTree& Asset, TArray<uint8>& Memory)
+{
+	TArray<TArray<uint8> >* Pool = InstanceMemoryPool.Find(&Asset);
+	if (Pool && Pool->Num())
+	{
+		Memory = MoveTemp(Pool->Last());
+		Pool->Pop(false);
+	}
+	else
+	{
+		Memory.Reset();
+	}
+}
+
+void UBehaviorTreeManager::ReleaseInstanceMemory(const UBehaviorTree& Asset, TArray<uint8>& Memory)
+{
+	if (Memory.Max() == 0)
+	{
+		return;
+	}
+
+	TArray<TArray<uint8> >& Pool = InstanceMemoryPool.FindOrAdd(&Asset);
+	if (Pool.Num() < MaxPooledInstanceMemoryBlocks)
+	{
+		Memory.Reset();
+		Pool.Add(MoveTemp(Memory));
+	}
+
+	Memory.Empty();
+}
+
 void UBehaviorTreeManager::InitializeMemoryHelper(const TArray<UBTDecorator*>& Nodes, TArray<uint16>& MemoryOffsets, int32& MemorySize, bool bForceInstancing)
 {
 	TArray<FNodeInitializationData> InitList;
@@ -19,6 +19,7 @@
 #include "BehaviorTree/Blackboard/BlackboardKeyType_String.h"
 #include "BehaviorTree/BTTaskNode.h"
 #include "BehaviorTree/BTCompositeNode.h"
+#include "BehaviorTree/BehaviorTreeManager.h"
 
 //----------------------------------------------------------------------//
 // FBehaviorTreeInstance
@@ -99,14 +100,28 @@ void FBehaviorTreeInstance::Cleanup(UBehaviorTreeComponent& OwnerComp, EBTMemory
 	CleanupNodes(OwnerComp, *RootNode, CleanupType);
 
 	// remove memory when instance is destroyed - it will need full initialize anyway
+	UBehaviorTreeManager* BTManager = Info.TreeAsset ? UBehaviorTreeManager::GetCurrent(OwnerComp.GetWorld()) : nullptr;
 	if (CleanupType == EBTMemoryClear::Destroy)
 	{
-		Info.InstanceMemory.Empty();
+		if (BTManager)
+		{
+			BTManager->ReleaseInstanceMemory(*Info.TreeAsset, Info.InstanceMemory);
+		}
+		else
+		{
+			Info.InstanceMemory.Empty();
+		}
 	}
 	else
 	{
 		Info.InstanceMemory = InstanceMemory;
 	}
+
+	// instance is removed from stack right after cleanup, pass its memory block for reuse
+	if (BTManager)
+	{
+		BTManager->ReleaseInstanceMemory(*Info.TreeAsset, InstanceMemory);
+	}
 }
 
 void FBehaviorTreeInstance::CleanupNodes(UBehaviorTreeComponent& OwnerComp, UBTCompositeNode& Node, EBTMemoryClear::Type CleanupType)
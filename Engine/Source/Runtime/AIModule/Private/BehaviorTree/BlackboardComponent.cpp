@@ -20,6 +20,7 @@ UBlackboardComponent::UBlackboardComponent(const FObjectInitializer& ObjectIniti
 {
 	PrimaryComponentTick.bCanEverTick = false;
 	bWantsInitializeComponent = true;
+	NotifyObserversDepth = 0;
 	bPausedNotifies = false;
 	bSynchronizedKeyPopulated = false;
 }
@@ -294,38 +295,64 @@ int32 UBlackboardComponent::GetNumKeys() const
 
 FDelegateHandle UBlackboardComponent::RegisterObserver(FBlackboard::FKey KeyID, UObject* NotifyOwner, FOnBlackboardChangeNotification ObserverDelegate)
 {
-	for (auto It = Observers.CreateConstKeyIterator(KeyID); It; ++It)
+	if (!Observers.IsValidIndex(KeyID))
 	{
-		// If the pair's value matches, return a pointer to it.
-		if (It.Value().GetHandle() == ObserverDelegate.GetHandle())
+		Observers.SetNum(KeyID + 1);
+	}
+
+	TArray<FOnBlackboardChangeNotification>& KeyObservers = Observers[KeyID];
+	for (const FOnBlackboardChangeNotification& Observer : KeyObservers)
+	{
+		if (Observer.GetHandle() == ObserverDelegate.GetHandle())
 		{
-			return It.Value().GetHandle();
+			return Observer.GetHandle();
 		}
 	}
 
-	FDelegateHandle Handle = Observers.Add(KeyID, ObserverDelegate).GetHandle();
+	FDelegateHandle Handle = KeyObservers[KeyObservers.Add(ObserverDelegate)].GetHandle();
 	ObserverHandles.Add(NotifyOwner, Handle);
 
 	return Handle;
 }
 
-void UBlackboardComponent::UnregisterObserver(FBlackboard::FKey KeyID, FDelegateHandle ObserverHandle)
+bool UBlackboardComponent::RemoveObserver(FBlackboard::FKey KeyID, FDelegateHandle ObserverHandle)
 {
-	for (auto It = Observers.CreateKeyIterator(KeyID); It; ++It)
+	if (Observers.IsValidIndex(KeyID))
 	{
-		if (It.Value().GetHandle() == ObserverHandle)
+		TArray<FOnBlackboardChangeNotification>& KeyObservers = Observers[KeyID];
+		for (int32 Index = 0; Index < KeyObservers.Num(); Index++)
 		{
-			for (auto HandleIt = ObserverHandles.CreateIterator(); HandleIt; ++HandleIt)
+			if (KeyObservers[Index].GetHandle() == ObserverHandle)
 			{
-				if (HandleIt.Value() == ObserverHandle)
+				// don't modify array while NotifyObservers is iterating over it, unbound observers are removed there
+				if (NotifyObserversDepth > 0)
 				{
-					HandleIt.RemoveCurrent();
-					break;
+					KeyObservers[Index].Unbind();
 				}
+				else
+				{
+					KeyObservers.RemoveAt(Index, 1, false);
+				}
+
+				return true;
 			}
+		}
+	}
 
-			It.RemoveCurrent();
-			break;
+	return false;
+}
+
+void UBlackboardComponent::UnregisterObserver(FBlackboard::FKey KeyID, FDelegateHandle ObserverHandle)
+{
+	if (RemoveObserver(KeyID, ObserverHandle))
+	{
+		for (auto HandleIt = ObserverHandles.CreateIterator(); HandleIt; ++HandleIt)
+		{
+			if (HandleIt.Value() == ObserverHandle)
+			{
+				HandleIt.RemoveCurrent();
+				break;
+			}
 		}
 	}
 }
@@ -334,11 +361,10 @@ void UBlackboardComponent::UnregisterObserversFrom(UObject* NotifyOwner)
 {
 	for (auto It = ObserverHandles.CreateKeyIterator(NotifyOwner); It; ++It)
 	{
-		for (auto ObsIt = Observers.CreateIterator(); ObsIt; ++ObsIt)
+		for (int32 KeyID = 0; KeyID < Observers.Num(); KeyID++)
 		{
-			if (ObsIt.Value().GetHandle() == It.Value())
+			if (RemoveObserver(KeyID, It.Value()))
 			{
-				ObsIt.RemoveCurrent();
 				break;
 			}
 		}
@@ -388,12 +414,10 @@ void UBlackboardComponent::ResumeUpdates()
 
 void UBlackboardComponent::NotifyObservers(FBlackboard::FKey KeyID) const
 {
-	TMultiMap<uint8, FOnBlackboardChangeNotification>::TKeyIterator KeyIt(Observers, KeyID);
-
 	// checking it here mostly to avoid storing this update in QueuedUpdates while
 	// at this point no one observes it, and there can be someone added before QueuedUpdates
 	// gets processed 
-	if (KeyIt)
+	if (Observers.IsValidIndex(KeyID) && Observers[KeyID].Num())
 	{
 		if (bPausedNotifies)
 		{
@@ -401,16 +425,24 @@ void UBlackboardComponent::NotifyObservers(FBlackboard::FKey KeyID) const
 		}
 		else
 		{
-			for (; KeyIt; ++KeyIt)
+			// observers can be added during notify, don't hold references to array
+			NotifyObserversDepth++;
+			for (int32 Index = 0; Index < Observers[KeyID].Num(); Index++)
 			{
-				const FOnBlackboardChangeNotification& ObserverDelegate = KeyIt.Value();
+				const FOnBlackboardChangeNotification& ObserverDelegate = Observers[KeyID][Index];
 				const bool bWantsToContinueObserving = ObserverDelegate.IsBound() && (ObserverDelegate.Execute(*this, KeyID) == EBlackboardNotificationResult::ContinueObserving);
 
 				if (bWantsToContinueObserving == false)
 				{
-					KeyIt.RemoveCurrent();
+					Observers[KeyID][Index].Unbind();
 				}
 			}
+			NotifyObserversDepth--;
+
+			if (NotifyObserversDepth == 0)
+			{
+				Observers[KeyID].RemoveAll([](const FOnBlackboardChangeNotification& Observer) { return !Observer.IsBound(); });
+			}
 		}
 	}
 }
@@ -469,19 +501,18 @@ FString UBlackboardComponent::GetDebugInfoString(EBlackboardDescription::Type Mo
 	{
 		DebugString += TEXT("Observed Keys:\n");
 
-		TArray<uint8> ObserversKeys;
-		if (Observers.Num() > 0)
+		bool bHasObservers = false;
+		for (int32 KeyID = 0; KeyID < Observers.Num(); ++KeyID)
 		{
-			Observers.GetKeys(ObserversKeys);
-
-			for (int32 KeyIndex = 0; KeyIndex < ObserversKeys.Num(); ++KeyIndex)
+			if (Observers[KeyID].Num())
 			{
-				const FBlackboard::FKey KeyID = ObserversKeys[KeyIndex];
 				//@todo shouldn't be using a localized value?; GetKeyName() [10/11/2013 justin.sargent]
 				DebugString += FString::Printf(TEXT("  %s:\n"), *BlackboardAsset->GetKeyName(KeyID).ToString());
+				bHasObservers = true;
 			}
 		}
-		else
+
+		if (!bHasObservers)
 		{
 			DebugString += TEXT("  NONE\n");
 		}
@@ -5,6 +5,7 @@
 UEnvQueryGenerator::UEnvQueryGenerator(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
 	bAutoSortTests = true;
+	bShareGeneratedItems = false;
 }
 
 void UEnvQueryGenerator::UpdateNodeVersion()
@@ -354,8 +354,21 @@ void FEnvQueryInstance::ExecuteOneStep(float TimeLimit)
 
 		if (bRunGenerator)
 		{
-			FScopeCycleCounterUObject GeneratorScope(OptionItem.Generator);
-			OptionItem.Generator->GenerateItems(*this);
+			// generated items can be shared only when it's known which contexts were used to create them
+			UEnvQueryManager* QueryManager = (OptionItem.Generator->bShareGeneratedItems && ContextCache.Num() == 0) ? UEnvQueryManager::GetCurrent(World) : nullptr;
+			if (QueryManager == nullptr || !QueryManager->CopySharedGeneratedItems(OptionItem.Generator, *this))
+			{
+				const bool bCanStoreItems = QueryManager && ContextCache.Num() == 0;
+				{
+					FScopeCycleCounterUObject GeneratorScope(OptionItem.Generator);
+					OptionItem.Generator->GenerateItems(*this);
+				}
+
+				if (bCanStoreItems)
+				{
+					QueryManager->StoreSharedGeneratedItems(OptionItem.Generator, *this);
+				}
+			}
 		}
 
 		FinalizeGeneration();
@@ -107,6 +107,7 @@ UEnvQueryManager::UEnvQueryManager(const FObjectInitializer& ObjectInitializer)
 	MaxAllowedTestingTime = 0.01f;
 	bTestQueriesUsingBreadth = true;
 	NumRunningQueriesAbortedSinceLastUpdate = 0;
+	SharedGeneratedItemsFrame = 0;
 
 	QueryCountWarningThreshold = 0;
 	QueryCountWarningInterval = 30.0;
@@ -526,6 +527,7 @@ void UEnvQueryManager::OnWorldCleanup()
 	}
 
 	GCShieldedWrappers.Reset();
+	SharedGeneratedItems.Reset();
 }
 
 void UEnvQueryManager::RegisterExternalQuery(const TSharedPtr<FEnvQueryInstance>& QueryInstance)
@@ -544,6 +546,81 @@ void UEnvQueryManager::UnregisterExternalQuery(const TSharedPtr<FEnvQueryInstanc
 	}
 }
 
+bool UEnvQueryManager::CopySharedGeneratedItems(const UEnvQueryGenerator* Generator, FEnvQueryInstance& QueryInstance)
+{
+	if (SharedGeneratedItemsFrame != GFrameCounter)
+	{
+		SharedGeneratedItems.Reset();
+		SharedGeneratedItemsFrame = GFrameCounter;
+		return false;
+	}
+
+	TArray<const FEnvQuerySharedItems*> CandidateItems;
+	SharedGeneratedItems.MultiFindPointer(Generator, CandidateItems);
+
+	for (const FEnvQuerySharedItems* SharedItems : CandidateItems)
+	{
+		if (!SharedItems->NamedParams.OrderIndependentCompareEqual(QueryInstance.NamedParams))
+		{
+			continue;
+		}
+
+		bool bContextsMatch = true;
+		for (const TPair<UClass*, FEnvQueryContextData>& SharedContext : SharedItems->Contexts)
+		{
+			FEnvQueryContextData ContextData;
+			if (!QueryInstance.PrepareContext(SharedContext.Key, ContextData) ||
+				ContextData.ValueType != SharedContext.Value.ValueType ||
+				ContextData.NumValues != SharedContext.Value.NumValues ||
+				ContextData.RawData != SharedContext.Value.RawData)
+			{
+				bContextsMatch = false;
+				break;
+			}
+		}
+
+		if (bContextsMatch)
+		{
+			QueryInstance.Items = SharedItems->Items;
+			QueryInstance.RawData = SharedItems->RawData;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void UEnvQueryManager::StoreSharedGeneratedItems(const UEnvQueryGenerator* Generator, const FEnvQueryInstance& QueryInstance)
+{
+	if (SharedGeneratedItemsFrame != GFrameCounter)
+	{
+		SharedGeneratedItems.Reset();
+		SharedGeneratedItemsFrame = GFrameCounter;
+	}
+
+	if (QueryInstance.Items.Num() == 0)
+	{
+		return;
+	}
+
+	FEnvQuerySharedItems SharedItems;
+	for (const TPair<UClass*, FEnvQueryContextData>& ContextPair : QueryInstance.ContextCache)
+	{
+		if (ContextPair.Value.NumValues == 0)
+		{
+			// can't be validated without logging missing context on every query, not worth it
+			return;
+		}
+
+		SharedItems.Contexts.Add(ContextPair);
+	}
+
+	SharedItems.NamedParams = QueryInstance.NamedParams;
+	SharedItems.Items = QueryInstance.Items;
+	SharedItems.RawData = QueryInstance.RawData;
+	SharedGeneratedItems.Add(Generator, MoveTemp(SharedItems));
+}
+
 namespace EnvQueryTestSort
 {
 	struct FAllMatching
@@ -6,6 +6,11 @@
 
 #define LOCTEXT_NAMESPACE "EnvQueryGenerator"
 
+static TAutoConsoleVariable<int32> CVarEQSParallelTestMinItems(
+	TEXT("ai.eqs.ParallelTestMinItems"),
+	64,
+	TEXT("Minimum number of items for tests supporting it (distance, trace) to process them on worker threads. 0 disables parallel tests."));
+
 UEnvQueryTest::UEnvQueryTest(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
 	TestPurpose = EEnvTestPurpose::FilterAndScore;
@@ -175,6 +180,23 @@ FVector UEnvQueryTest::GetItemLocation(FEnvQueryInstance& QueryInstance, int32 I
 		FVector::ZeroVector;
 }
 
+bool UEnvQueryTest::GetItemsForParallelTest(FEnvQueryInstance& QueryInstance, TArray<int32>& ItemIndices) const
+{
+	const int32 MinItems = CVarEQSParallelTestMinItems.GetValueOnGameThread();
+	if (MinItems <= 0 || !QueryInstance.CanBatchTest() || (QueryInstance.Items.Num() - QueryInstance.CurrentTestStartingItem) < MinItems)
+	{
+		return false;
+	}
+
+	ItemIndices.Reset(QueryInstance.Items.Num() - QueryInstance.CurrentTestStartingItem);
+	for (FEnvQueryInstance::FConstItemIterator It(QueryInstance); It; ++It)
+	{
+		ItemIndices.Add(It.GetIndex());
+	}
+
+	return ItemIndices.Num() >= MinItems;
+}
+
 FRotator UEnvQueryTest::GetItemRotation(FEnvQueryInstance& QueryInstance, int32 ItemIndex) const
 {
 	return QueryInstance.ItemTypeVectorCDO ?
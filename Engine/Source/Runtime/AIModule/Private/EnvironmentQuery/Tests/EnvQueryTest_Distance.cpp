@@ -3,6 +3,7 @@
 #include "EnvironmentQuery/Tests/EnvQueryTest_Distance.h"
 #include "EnvironmentQuery/Items/EnvQueryItemType_VectorBase.h"
 #include "EnvironmentQuery/Contexts/EnvQueryContext_Querier.h"
+#include "Async/ParallelFor.h"
 
 namespace
 {
@@ -55,60 +56,71 @@ void UEnvQueryTest_Distance::RunTest(FEnvQueryInstance& QueryInstance) const
 		return;
 	}
 
+	float (*CalcDistance)(const FVector&, const FVector&) = nullptr;
 	switch (TestMode)
 	{
-		case EEnvTestDistance::Distance3D:	
-			for (FEnvQueryInstance::ItemIterator It(this, QueryInstance); It; ++It)
-			{
-				const FVector ItemLocation = GetItemLocation(QueryInstance, It.GetIndex());
-				for (int32 ContextIndex = 0; ContextIndex < ContextLocations.Num(); ContextIndex++)
-				{
-					const float Distance = CalcDistance3D(ItemLocation, ContextLocations[ContextIndex]);
-					It.SetScore(TestPurpose, FilterType, Distance, MinThresholdValue, MaxThresholdValue);
-				}
-			}
+		case EEnvTestDistance::Distance3D:
+			CalcDistance = CalcDistance3D;
 			break;
 
-		case EEnvTestDistance::Distance2D:	
-			for (FEnvQueryInstance::ItemIterator It(this, QueryInstance); It; ++It)
-			{
-				const FVector ItemLocation = GetItemLocation(QueryInstance, It.GetIndex());
-				for (int32 ContextIndex = 0; ContextIndex < ContextLocations.Num(); ContextIndex++)
-				{
-					const float Distance = CalcDistance2D(ItemLocation, ContextLocations[ContextIndex]);
-					It.SetScore(TestPurpose, FilterType, Distance, MinThresholdValue, MaxThresholdValue);
-				}
-			}
+		case EEnvTestDistance::Distance2D:
+			CalcDistance = CalcDistance2D;
 			break;
 
-		case EEnvTestDistance::DistanceZ:	
-			for (FEnvQueryInstance::ItemIterator It(this, QueryInstance); It; ++It)
-			{
-				const FVector ItemLocation = GetItemLocation(QueryInstance, It.GetIndex());
-				for (int32 ContextIndex = 0; ContextIndex < ContextLocations.Num(); ContextIndex++)
-				{
-					const float Distance = CalcDistanceZ(ItemLocation, ContextLocations[ContextIndex]);
-					It.SetScore(TestPurpose, FilterType, Distance, MinThresholdValue, MaxThresholdValue);
-				}
-			}
+		case EEnvTestDistance::DistanceZ:
+			CalcDistance = CalcDistanceZ;
 			break;
 
 		case EEnvTestDistance::DistanceAbsoluteZ:
-			for (FEnvQueryInstance::ItemIterator It(this, QueryInstance); It; ++It)
-			{
-				const FVector ItemLocation = GetItemLocation(QueryInstance, It.GetIndex());
-				for (int32 ContextIndex = 0; ContextIndex < ContextLocations.Num(); ContextIndex++)
-				{
-					const float Distance = CalcDistanceAbsoluteZ(ItemLocation, ContextLocations[ContextIndex]);
-					It.SetScore(TestPurpose, FilterType, Distance, MinThresholdValue, MaxThresholdValue);
-				}
-			}
+			CalcDistance = CalcDistanceAbsoluteZ;
 			break;
 
 		default:
 			checkNoEntry();
 			return;
 	}
+
+	const int32 NumContexts = ContextLocations.Num();
+
+	TArray<int32> ItemIndices;
+	if (GetItemsForParallelTest(QueryInstance, ItemIndices))
+	{
+		// calculate all distances on worker threads, scoring can't be spread since it modifies query state
+		TArray<float> Distances;
+		Distances.AddUninitialized(ItemIndices.Num() * NumContexts);
+
+		ParallelFor(ItemIndices.Num(), [&](int32 Idx)
+		{
+			const FVector ItemLocation = GetItemLocation(QueryInstance, ItemIndices[Idx]);
+			for (int32 ContextIndex = 0; ContextIndex < NumContexts; ContextIndex++)
+			{
+				Distances[Idx * NumContexts + ContextIndex] = CalcDistance(ItemLocation, ContextLocations[ContextIndex]);
+			}
+		});
+
+		// all work is already done, don't let time slicing waste it
+		int32 DistanceIndex = 0;
+		FEnvQueryInstance::ItemIterator It(this, QueryInstance);
+		for (It.IgnoreTimeLimit(); It; ++It)
+		{
+			for (int32 ContextIndex = 0; ContextIndex < NumContexts; ContextIndex++)
+			{
+				It.SetScore(TestPurpose, FilterType, Distances[DistanceIndex++], MinThresholdValue, MaxThresholdValue);
+			}
+		}
+	}
+	else
+	{
+		for (FEnvQueryInstance::ItemIterator It(this, QueryInstance); It; ++It)
+		{
+			const FVector ItemLocation = GetItemLocation(QueryInstance, It.GetIndex());
+			for (int32 ContextIndex = 0; ContextIndex < NumContexts; ContextIndex++)
+			{
+				const float Distance = CalcDistance(ItemLocation, ContextLocations[ContextIndex]);
+				It.SetScore(TestPurpose, FilterType, Distance, MinThresholdValue, MaxThresholdValue);
+			}
+		}
+	}
 }
 
 FText UEnvQueryTest_Distance::GetDescriptionTitle() const
@@ -7,6 +7,7 @@
 #include "Engine/World.h"
 #include "EnvironmentQuery/Items/EnvQueryItemType_VectorBase.h"
 #include "EnvironmentQuery/Contexts/EnvQueryContext_Querier.h"
+#include "Async/ParallelFor.h"
 
 #define LOCTEXT_NAMESPACE "EnvQueryGenerator"
 
@@ -78,15 +79,57 @@ void UEnvQueryTest_Trace::RunTest(FEnvQueryInstance& QueryInstance) const
 		ContextLocations[ContextIndex].Z += ContextZ;
 	}
 
-	for (FEnvQueryInstance::ItemIterator It(this, QueryInstance); It; ++It)
+	const int32 NumContexts = ContextLocations.Num();
+
+	TArray<int32> ItemIndices;
+	if (GetItemsForParallelTest(QueryInstance, ItemIndices))
 	{
-		const FVector ItemLocation = GetItemLocation(QueryInstance, It.GetIndex()) + FVector(0, 0, ItemZ);
-		AActor* ItemActor = GetItemActor(QueryInstance, It.GetIndex());
+		// item data is read on game thread, only scene queries are issued from worker threads
+		TArray<FVector> ItemLocations;
+		TArray<AActor*> ItemActors;
+		ItemLocations.AddUninitialized(ItemIndices.Num());
+		ItemActors.AddUninitialized(ItemIndices.Num());
+		for (int32 Idx = 0; Idx < ItemIndices.Num(); Idx++)
+		{
+			ItemLocations[Idx] = GetItemLocation(QueryInstance, ItemIndices[Idx]) + FVector(0, 0, ItemZ);
+			ItemActors[Idx] = GetItemActor(QueryInstance, ItemIndices[Idx]);
+		}
 
-		for (int32 ContextIndex = 0; ContextIndex < ContextLocations.Num(); ContextIndex++)
+		TArray<bool> Hits;
+		Hits.AddUninitialized(ItemIndices.Num() * NumContexts);
+
+		UWorld* World = QueryInstance.World;
+		ParallelFor(ItemIndices.Num(), [&](int32 Idx)
+		{
+			for (int32 ContextIndex = 0; ContextIndex < NumContexts; ContextIndex++)
+			{
+				Hits[Idx * NumContexts + ContextIndex] = TraceFunc.Execute(ItemLocations[Idx], ContextLocations[ContextIndex], ItemActors[Idx], World, TraceCollisionChannel, TraceParams, TraceExtent);
+			}
+		});
+
+		// all traces are already done, don't let time slicing waste them
+		int32 HitIndex = 0;
+		FEnvQueryInstance::ItemIterator It(this, QueryInstance);
+		for (It.IgnoreTimeLimit(); It; ++It)
+		{
+			for (int32 ContextIndex = 0; ContextIndex < NumContexts; ContextIndex++)
+			{
+				It.SetScore(TestPurpose, FilterType, Hits[HitIndex++], bWantsHit);
+			}
+		}
+	}
+	else
+	{
+		for (FEnvQueryInstance::ItemIterator It(this, QueryInstance); It; ++It)
 		{
-			const bool bHit = TraceFunc.Execute(ItemLocation, ContextLocations[ContextIndex], ItemActor, QueryInstance.World, TraceCollisionChannel, TraceParams, TraceExtent);
-			It.SetScore(TestPurpose, FilterType, bHit, bWantsHit);
+			const FVector ItemLocation = GetItemLocation(QueryInstance, It.GetIndex()) + FVector(0, 0, ItemZ);
+			AActor* ItemActor = GetItemActor(QueryInstance, It.GetIndex());
+
+			for (int32 ContextIndex = 0; ContextIndex < NumContexts; ContextIndex++)
+			{
+				const bool bHit = TraceFunc.Execute(ItemLocation, ContextLocations[ContextIndex], ItemActor, QueryInstance.World, TraceCollisionChannel, TraceParams, TraceExtent);
+				It.SetScore(TestPurpose, FilterType, bHit, bWantsHit);
+			}
 		}
 	}
 }
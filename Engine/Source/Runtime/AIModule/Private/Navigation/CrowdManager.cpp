@@ -17,6 +17,7 @@
 #endif
 
 #include "Navigation/CrowdFollowingComponent.h"
+#include "Async/ParallelFor.h"
 
 DECLARE_STATS_GROUP(TEXT("Crowd"), STATGROUP_AICrowd, STATCAT_Advanced);
 
@@ -34,6 +35,12 @@ DECLARE_CYCLE_STAT(TEXT("Step: movement"), STAT_AI_Crowd_StepMovementTime, STATG
 DECLARE_CYCLE_STAT(TEXT("Agent Update Time"), STAT_AI_Crowd_AgentUpdateTime, STATGROUP_AICrowd);
 DECLARE_DWORD_COUNTER_STAT(TEXT("Num Agents"), STAT_AI_Crowd_NumAgents, STATGROUP_AICrowd);
 
+static TAutoConsoleVariable<int32> CVarCrowdParallelBatchSize(
+	TEXT("ai.crowd.ParallelBatchSize"),
+	32,
+	TEXT("Number of crowd agents processed by one task in parallel neighbour, steering and avoidance steps.\n")
+	TEXT("Crowds with fewer agents are simulated on game thread. 0 disables parallel simulation."));
+
 namespace CrowdDebugDrawing
 {
 	/** if set, debug information will be displayed for agent selected in editor */
@@ -230,9 +237,25 @@ void UCrowdManager::Tick(float DeltaTime)
 				SCOPE_CYCLE_COUNTER(STAT_AI_Crowd_StepPathsTime);
 				DetourCrowd->updateStepPaths(DeltaTime, DetourAgentDebug);
 			}
+			// per agent parts of proximity, steering and avoidance steps can run in parallel for big crowds
+			const int32 BatchSize = CVarCrowdParallelBatchSize.GetValueOnGameThread();
+			const int32 NumBatches = BatchSize > 0 ? FMath::DivideAndRoundUp(NumActive, BatchSize) : 1;
+			const bool bParallelSteps = (NumBatches > 1) && InitBatchObstacleQueries(NumBatches);
+
 			{
 				SCOPE_CYCLE_COUNTER(STAT_AI_Crowd_StepProximityTime);
-				DetourCrowd->updateStepProximityData(DeltaTime, DetourAgentDebug);
+				if (bParallelSteps)
+				{
+					DetourCrowd->updateStepProximityBoundaries(DeltaTime, DetourAgentDebug);
+					ParallelFor(NumActive, [this](int32 AgentIdx)
+					{
+						DetourCrowd->updateStepNeighboursAgent(AgentIdx);
+					});
+				}
+				else
+				{
+					DetourCrowd->updateStepProximityData(DeltaTime, DetourAgentDebug);
+				}
 				PostProximityUpdate();
 			}
 			{
@@ -242,11 +265,37 @@ void UCrowdManager::Tick(float DeltaTime)
 			}
 			{
 				SCOPE_CYCLE_COUNTER(STAT_AI_Crowd_StepSteeringTime);
-				DetourCrowd->updateStepSteering(DeltaTime, DetourAgentDebug);
+				if (bParallelSteps)
+				{
+					ParallelFor(NumActive, [this](int32 AgentIdx)
+					{
+						DetourCrowd->updateStepSteeringAgent(AgentIdx);
+					});
+				}
+				else
+				{
+					DetourCrowd->updateStepSteering(DeltaTime, DetourAgentDebug);
+				}
 			}
 			{
 				SCOPE_CYCLE_COUNTER(STAT_AI_Crowd_StepAvoidanceTime);
-				DetourCrowd->updateStepAvoidance(DeltaTime, DetourAgentDebug);
+				if (bParallelSteps)
+				{
+					// obstacle queries are not thread safe, every batch uses its own
+					ParallelFor(NumBatches, [this, NumActive, BatchSize](int32 BatchIdx)
+					{
+						dtObstacleAvoidanceQuery* ObstacleQuery = BatchObstacleQueries[BatchIdx];
+						const int32 LastAgentIdx = FMath::Min((BatchIdx + 1) * BatchSize, NumActive);
+						for (int32 AgentIdx = BatchIdx * BatchSize; AgentIdx < LastAgentIdx; AgentIdx++)
+						{
+							DetourCrowd->updateStepAvoidanceAgent(AgentIdx, ObstacleQuery, DetourAgentDebug);
+						}
+					});
+				}
+				else
+				{
+					DetourCrowd->updateStepAvoidance(DeltaTime, DetourAgentDebug);
+				}
 			}
 			if (bResolveCollisions)
 			{
@@ -901,11 +950,35 @@ void UCrowdManager::CreateCrowdManager()
 
 void UCrowdManager::DestroyCrowdManager()
 {
+	// queries are set up from DetourCrowd's own and need to be recreated with it
+	for (int32 Idx = 0; Idx < BatchObstacleQueries.Num(); Idx++)
+	{
+		dtFreeObstacleAvoidanceQuery(BatchObstacleQueries[Idx]);
+	}
+	BatchObstacleQueries.Reset();
+
 	// freeing DetourCrowd with dtFreeCrowd 
 	dtFreeCrowd(DetourCrowd);
 	DetourCrowd = NULL;
 }
 
+bool UCrowdManager::InitBatchObstacleQueries(int32 NumBatches)
+{
+	while (BatchObstacleQueries.Num() < NumBatches)
+	{
+		dtObstacleAvoidanceQuery* ObstacleQuery = dtAllocObstacleAvoidanceQuery();
+		if (!DetourCrowd->initObstacleAvoidanceQuery(ObstacleQuery))
+		{
+			dtFreeObstacleAvoidanceQuery(ObstacleQuery);
+			return false;
+		}
+
+		BatchObstacleQueries.Add(ObstacleQuery);
+	}
+
+	return true;
+}
+
 #if ENABLE_DRAW_DEBUG
 void UCrowdManager::DrawDebugCorners(const dtCrowdAgent* CrowdAgent) const
 {
@@ -10,15 +10,22 @@
 #include "NameTableArchive.h"
 #include "PackageReader.h"
 #include "AssetRegistry.h"
+#include "HAL/IConsoleManager.h"
+#include "Async/ParallelFor.h"
 
 namespace AssetDataGathererConstants
 {
-	static const int32 CacheSerializationVersion = 9;
+	static const int32 CacheSerializationVersion = 10;
 	static const int32 MaxFilesToDiscoverBeforeFlush = 2500;
 	static const int32 MaxFilesToGatherBeforeFlush = 250;
 	static const int32 MaxFilesToProcessBeforeCacheWrite = 50000;
 }
 
+static TAutoConsoleVariable<int32> CVarAssetRegistryParallelGather(
+	TEXT("AssetRegistry.ParallelGather"),
+	1,
+	TEXT("Whether the asset data gatherer reads the headers of uncached packages on several task graph threads."));
+
 
 namespace
 {
@@ -167,11 +174,11 @@ uint32 FAssetDataDiscovery::Run()
 
 				if (IsPriorityFile(PackageFilenameStr))
 				{
-					LocalPriorityFilesToSearch.Add(FDiscoveredPackageFile(PackageFilenameStr, InPackageStatData.ModificationTime));
+					LocalPriorityFilesToSearch.Add(FDiscoveredPackageFile(PackageFilenameStr, InPackageStatData.ModificationTime, InPackageStatData.FileSize));
 				}
 				else
 				{
-					LocalNonPriorityFilesToSearch.Add(FDiscoveredPackageFile(PackageFilenameStr, InPackageStatData.ModificationTime));
+					LocalNonPriorityFilesToSearch.Add(FDiscoveredPackageFile(PackageFilenameStr, InPackageStatData.ModificationTime, InPackageStatData.FileSize));
 				}
 
 				LocalDiscoveredPathsSet.Add(FPackageName::GetLongPackagePath(LongPackageNameStr));
@@ -533,6 +540,19 @@ uint32 FAssetDataGatherer::Run()
 
 		if (LocalFilesToSearch.Num() > 0)
 		{
+			// Files that aren't in the cache (or have changed on disk since) and need their header read
+			struct FUncachedFile
+			{
+				const FDiscoveredPackageFile* AssetFileData;
+				FName PackageName;
+				TArray<FAssetData*> AssetDataFromFile;
+				FPackageDependencyData DependencyData;
+				TArray<FString> CookedPackageNamesWithoutAssetData;
+				bool bCanAttemptAssetRetry;
+				bool bRead;
+			};
+			TArray<FUncachedFile> UncachedFiles;
+
 			for (const FDiscoveredPackageFile& AssetFileData : LocalFilesToSearch)
 			{
 				if (StopTaskCounter.GetValue() != 0)
@@ -549,8 +569,8 @@ uint32 FAssetDataGatherer::Run()
 					FDiskCachedAssetData* DiskCachedAssetData = DiskCachedAssetDataMap.Find(PackageName);
 					if (DiskCachedAssetData)
 					{
-						const FDateTime& CachedTimestamp = DiskCachedAssetData->Timestamp;
-						if (AssetFileData.PackageTimestamp != CachedTimestamp)
+						// Saving a package within the timestamp resolution of the file system doesn't change its timestamp, the size catches most of those
+						if (AssetFileData.PackageTimestamp != DiskCachedAssetData->Timestamp || AssetFileData.PackageFileSize != DiskCachedAssetData->FileSize)
 						{
 							DiskCachedAssetData = nullptr;
 						}
@@ -588,57 +608,80 @@ uint32 FAssetDataGatherer::Run()
 
 				if (!bLoadedFromCache)
 				{
-					TArray<FAssetData*> AssetDataFromFile;
-					FPackageDependencyData DependencyData;
-					TArray<FString> CookedPackageNamesWithoutAssetData;
-					bool bCanAttemptAssetRetry = false;
-					if (ReadAssetFile(AssetFileData.PackageFilename, AssetDataFromFile, DependencyData, CookedPackageNamesWithoutAssetData, bCanAttemptAssetRetry))
-					{
-						++NumUncachedFiles;
+					FUncachedFile& UncachedFile = UncachedFiles[UncachedFiles.AddDefaulted()];
+					UncachedFile.AssetFileData = &AssetFileData;
+					UncachedFile.PackageName = PackageName;
+					UncachedFile.bCanAttemptAssetRetry = false;
+					UncachedFile.bRead = false;
+				}
+			}
 
-						LocalAssetResults.Append(AssetDataFromFile);
-						if (bGatherDependsData)
-						{
-							LocalDependencyResults.Add(DependencyData);
-						}
-						LocalCookedPackageNamesWithoutAssetDataResults.Append(CookedPackageNamesWithoutAssetData);
+			// Reading the package headers is mostly waiting on the disk, so read the uncached files of the batch in parallel.
+			// ReadAssetFile doesn't touch any state of the gatherer, the results are merged in order below.
+			const bool bReadInParallel = CVarAssetRegistryParallelGather.GetValueOnAnyThread() != 0 && UncachedFiles.Num() > 1 && FTaskGraphInterface::IsRunning();
+			ParallelFor(UncachedFiles.Num(), [this, &UncachedFiles](int32 Index)
+			{
+				if (StopTaskCounter.GetValue() != 0)
+				{
+					return;
+				}
+
+				FUncachedFile& UncachedFile = UncachedFiles[Index];
+				UncachedFile.bRead = ReadAssetFile(UncachedFile.AssetFileData->PackageFilename, UncachedFile.AssetDataFromFile, UncachedFile.DependencyData, UncachedFile.CookedPackageNamesWithoutAssetData, UncachedFile.bCanAttemptAssetRetry);
+			}, !bReadInParallel);
+
+			for (FUncachedFile& UncachedFile : UncachedFiles)
+			{
+				const FDiscoveredPackageFile& AssetFileData = *UncachedFile.AssetFileData;
+				const TArray<FAssetData*>& AssetDataFromFile = UncachedFile.AssetDataFromFile;
+				const FPackageDependencyData& DependencyData = UncachedFile.DependencyData;
+
+				if (UncachedFile.bRead)
+				{
+					++NumUncachedFiles;
 
+					LocalAssetResults.Append(AssetDataFromFile);
+					if (bGatherDependsData)
+					{
+						LocalDependencyResults.Add(DependencyData);
+					}
+					LocalCookedPackageNamesWithoutAssetDataResults.Append(UncachedFile.CookedPackageNamesWithoutAssetData);
+
+					// Don't store info on cooked packages
+					bool bCachePackage = bLoadAndSaveCache && LocalCookedPackageNamesWithoutAssetDataResults.Num() == 0;
+					if (bCachePackage)
+					{
 						// Don't store info on cooked packages
-						bool bCachePackage = bLoadAndSaveCache && LocalCookedPackageNamesWithoutAssetDataResults.Num() == 0;
-						if (bCachePackage)
+						for (const auto& AssetData : AssetDataFromFile)
 						{
-							// Don't store info on cooked packages
-							for (const auto& AssetData : AssetDataFromFile)
+							if (!!(AssetData->PackageFlags & PKG_FilterEditorOnly))
 							{
-								if (!!(AssetData->PackageFlags & PKG_FilterEditorOnly))
-								{
-									bCachePackage = false;
-									break;
-								}
+								bCachePackage = false;
+								break;
 							}
 						}
+					}
 
-						if (bCachePackage)
-						{
-							++NumFilesProcessedSinceLastCacheSave;
-
-							// Update the cache
-							FDiskCachedAssetData* NewData = new FDiskCachedAssetData(AssetFileData.PackageTimestamp);
-							NewData->AssetDataList.Reserve(AssetDataFromFile.Num());
-							for (const FAssetData* BackgroundAssetData : AssetDataFromFile)
-							{
-								NewData->AssetDataList.Add(*BackgroundAssetData);
-							}
-							NewData->DependencyData = DependencyData;
+					if (bCachePackage)
+					{
+						++NumFilesProcessedSinceLastCacheSave;
 
-							NewCachedAssetData.Add(NewData);
-							NewCachedAssetDataMap.Add(PackageName, NewData);
+						// Update the cache
+						FDiskCachedAssetData* NewData = new FDiskCachedAssetData(AssetFileData.PackageTimestamp, AssetFileData.PackageFileSize);
+						NewData->AssetDataList.Reserve(AssetDataFromFile.Num());
+						for (const FAssetData* BackgroundAssetData : AssetDataFromFile)
+						{
+							NewData->AssetDataList.Add(*BackgroundAssetData);
 						}
+						NewData->DependencyData = DependencyData;
+
+						NewCachedAssetData.Add(NewData);
+						NewCachedAssetDataMap.Add(UncachedFile.PackageName, NewData);
 					}
-					else if (bCanAttemptAssetRetry)
-					{
-						LocalFilesToRetry.Add(AssetFileData);
-					}
+				}
+				else if (UncachedFile.bCanAttemptAssetRetry)
+				{
+					LocalFilesToRetry.Add(AssetFileData);
 				}
 			}
 
@@ -17,24 +17,28 @@ struct FDiscoveredPackageFile
 	explicit FDiscoveredPackageFile(FString InPackageFilename)
 		: PackageFilename(MoveTemp(InPackageFilename))
 		, PackageTimestamp(IFileManager::Get().GetTimeStamp(*PackageFilename))
+		, PackageFileSize(IFileManager::Get().FileSize(*PackageFilename))
 	{
 	}
 
-	FDiscoveredPackageFile(FString InPackageFilename, FDateTime InPackageTimestamp)
+	FDiscoveredPackageFile(FString InPackageFilename, FDateTime InPackageTimestamp, int64 InPackageFileSize)
 		: PackageFilename(MoveTemp(InPackageFilename))
 		, PackageTimestamp(MoveTemp(InPackageTimestamp))
+		, PackageFileSize(InPackageFileSize)
 	{
 	}
 
 	FDiscoveredPackageFile(const FDiscoveredPackageFile& Other)
 		: PackageFilename(Other.PackageFilename)
 		, PackageTimestamp(Other.PackageTimestamp)
+		, PackageFileSize(Other.PackageFileSize)
 	{
 	}
 
 	FDiscoveredPackageFile(FDiscoveredPackageFile&& Other)
 		: PackageFilename(MoveTemp(Other.PackageFilename))
 		, PackageTimestamp(MoveTemp(Other.PackageTimestamp))
+		, PackageFileSize(Other.PackageFileSize)
 	{
 	}
 
@@ -44,6 +48,7 @@ struct FDiscoveredPackageFile
 		{
 			PackageFilename = Other.PackageFilename;
 			PackageTimestamp = Other.PackageTimestamp;
+			PackageFileSize = Other.PackageFileSize;
 		}
 		return *this;
 	}
@@ -54,6 +59,7 @@ struct FDiscoveredPackageFile
 		{
 			PackageFilename = MoveTemp(Other.PackageFilename);
 			PackageTimestamp = MoveTemp(Other.PackageTimestamp);
+			PackageFileSize = Other.PackageFileSize;
 		}
 		return *this;
 	}
@@ -63,6 +69,9 @@ struct FDiscoveredPackageFile
 
 	/** The modification timestamp of the package file (when it was discovered) */
 	FDateTime PackageTimestamp;
+
+	/** The size of the package file in bytes (when it was discovered) */
+	int64 PackageFileSize;
 };
 
 
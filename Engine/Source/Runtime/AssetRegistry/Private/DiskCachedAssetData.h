@@ -10,20 +10,24 @@ class FDiskCachedAssetData
 {
 public:
 	FDateTime Timestamp;
+	int64 FileSize;
 	TArray<FAssetData> AssetDataList;
 	FPackageDependencyData DependencyData;
 
 	FDiskCachedAssetData()
+		: FileSize(-1)
 	{}
 
-	FDiskCachedAssetData(const FDateTime& InTimestamp)
+	FDiskCachedAssetData(const FDateTime& InTimestamp, int64 InFileSize)
 		: Timestamp(InTimestamp)
+		, FileSize(InFileSize)
 	{}
 
 	/** Operator for serialization */
 	friend FArchive& operator<<(FArchive& Ar, FDiskCachedAssetData& DiskCachedAssetData)
 	{
 		Ar << DiskCachedAssetData.Timestamp;
+		Ar << DiskCachedAssetData.FileSize;
 		if (Ar.IsError())
 		{
 			return Ar;
@@ -47,7 +47,8 @@ namespace Audio
 		{
 			case EBufferType::PCM:
 			{
-				if (Data)
+				// Data of cached decoded sounds is owned by the cache
+				if (Data && !DecodedSound.IsValid())
 				{
 					FMemory::Free((void*)Data);
 				}
@@ -242,7 +243,18 @@ namespace Audio
 
 			case DTYPE_RealTime:
 			{
-				// Always create a new buffer for real-time buffers
+				// Short sounds decoded on an earlier play are played from the decoded sound cache instead of being decoded again
+				FDecodedSoundCache& DecodedSoundCache = Mixer->GetDecodedSoundCache();
+				if (!bForceRealtime && DecodedSoundCache.CanCache(InWave))
+				{
+					if (FDecodedSoundPtr DecodedSound = DecodedSoundCache.FindOrRequestDecode(InWave))
+					{
+						Buffer = FMixerBuffer::CreateDecodedSoundBuffer(Mixer, InWave, DecodedSound);
+						break;
+					}
+				}
+
+				// Otherwise always create a new buffer for real-time buffers
 				Buffer = FMixerBuffer::CreateRealTimeBuffer(Mixer, InWave);
 			}
 			break;
@@ -391,6 +403,21 @@ namespace Audio
 		return Buffer;
 	}
 
+	FMixerBuffer* FMixerBuffer::CreateDecodedSoundBuffer(FMixerDevice* InMixer, USoundWave* InWave, FDecodedSoundPtr InDecodedSound)
+	{
+		check(InDecodedSound.IsValid());
+
+		FMixerBuffer* Buffer = new FMixerBuffer(InMixer, InWave, EBufferType::PCM);
+
+		// The buffer isn't tracked, it only lives as long as the source playing it
+		Buffer->ResourceID = 0;
+		Buffer->DecodedSound = InDecodedSound;
+		Buffer->Data = InDecodedSound->PCMData.GetData();
+		Buffer->DataSize = InDecodedSound->PCMData.Num();
+
+		return Buffer;
+	}
+
 	EBufferType::Type FMixerBuffer::GetType() const
 	{
 		return BufferType;
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "AudioMixerSourceDecode.h"
+#include "AudioMixerDecodedSoundCache.h"
 #include "AudioMixer.h"
 
 namespace Audio
@@ -48,11 +49,15 @@ namespace Audio
 		static FMixerBuffer* CreateNativeBuffer(FMixerDevice* InMixer, USoundWave* InWave);
 		static FMixerBuffer* CreateStreamingBuffer(FMixerDevice* InMixer, USoundWave* InWave);
 		static FMixerBuffer* CreateRealTimeBuffer(FMixerDevice* InMixer, USoundWave* InWave);
+		static FMixerBuffer* CreateDecodedSoundBuffer(FMixerDevice* InMixer, USoundWave* InWave, FDecodedSoundPtr InDecodedSound);
 
 		/** Returns the buffer's format */
 		EBufferType::Type GetType() const;
 		bool IsRealTimeBuffer() const;
 
+		/** Whether the PCM data is shared from the decoded sound cache. These buffers aren't tracked and belong to the source playing them. */
+		bool IsDecodedSoundBuffer() const { return DecodedSound.IsValid(); }
+
 		/** Returns the contained raw PCM data and data size */
 		void GetPCMData(uint8** OutData, uint32* OutDataSize);
 
@@ -89,6 +94,9 @@ namespace Audio
 
 		/** Set to true when the PCM data should be freed when the buffer is destroyed */
 		bool bIsDynamicResource;
+
+		/** Decoded sound from the decoded sound cache owning the PCM data, if any */
+		FDecodedSoundPtr DecodedSound;
 	};
 }
 
@@ -0,0 +1,171 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "AudioMixerDecodedSoundCache.h"
+#include "AudioMixer.h"
+#include "AudioMixerDevice.h"
+#include "AudioDecompress.h"
+#include "Async/Async.h"
+#include "Sound/SoundWave.h"
+
+static int32 DecodedSoundCacheSizeKBCvar = 8192;
+FAutoConsoleVariableRef CVarDecodedSoundCacheSizeKB(
+	TEXT("au.DecodedSoundCacheSizeKB"),
+	DecodedSoundCacheSizeKBCvar,
+	TEXT("Memory budget in KB of decoded PCM kept for short real-time decoded sounds so they aren't decoded again on every play.\n")
+	TEXT("0: Disabled"),
+	ECVF_Default);
+
+static float DecodedSoundCacheMaxDurationCvar = 5.0f;
+FAutoConsoleVariableRef CVarDecodedSoundCacheMaxDuration(
+	TEXT("au.DecodedSoundCacheMaxDuration"),
+	DecodedSoundCacheMaxDurationCvar,
+	TEXT("Longest sound in seconds kept in the decoded sound cache."),
+	ECVF_Default);
+
+DECLARE_MEMORY_STAT(TEXT("Decoded Sound Cache"), STAT_AudioMixerDecodedSoundCacheMemory, STATGROUP_AudioMixer);
+
+namespace Audio
+{
+	FDecodedSoundCache::FDecodedSoundCache(FMixerDevice* InMixerDevice)
+		: MixerDevice(InMixerDevice)
+		, NumCachedBytes(0)
+	{
+	}
+
+	FDecodedSoundCache::~FDecodedSoundCache()
+	{
+		Flush();
+	}
+
+	bool FDecodedSoundCache::CanCache(const USoundWave* SoundWave) const
+	{
+		// Reimported sounds keep their object, don't risk playing stale data in the editor
+		if (GIsEditor || DecodedSoundCacheSizeKBCvar <= 0)
+		{
+			return false;
+		}
+
+		return SoundWave->DecompressionType == DTYPE_RealTime
+			&& !SoundWave->bProcedural
+			&& SoundWave->Duration <= DecodedSoundCacheMaxDurationCvar
+			&& SoundWave->RawPCMDataSize > 0
+			&& SoundWave->RawPCMDataSize <= DecodedSoundCacheSizeKBCvar * 1024;
+	}
+
+	FDecodedSoundPtr FDecodedSoundCache::FindOrRequestDecode(USoundWave* SoundWave)
+	{
+		AUDIO_MIXER_CHECK_GAME_THREAD(MixerDevice);
+
+		const FObjectKey SoundWaveKey(SoundWave);
+		if (FDecodedSoundPtr* DecodedSound = DecodedSounds.Find(SoundWaveKey))
+		{
+			UsageOrder.RemoveSingle(SoundWaveKey);
+			UsageOrder.Add(SoundWaveKey);
+			return *DecodedSound;
+		}
+
+		for (const FPendingDecode& PendingDecode : PendingDecodes)
+		{
+			if (PendingDecode.SoundWaveKey == SoundWaveKey)
+			{
+				return nullptr;
+			}
+		}
+
+		if (SoundWave->ResourceData == nullptr)
+		{
+			return nullptr;
+		}
+
+		ICompressedAudioInfo* AudioInfo = MixerDevice->CreateCompressedAudioInfo(SoundWave);
+		if (AudioInfo == nullptr)
+		{
+			return nullptr;
+		}
+
+		// The wave can be unloaded while the decode runs, so it works on its own copy of the compressed data
+		TArray<uint8> CompressedData;
+		CompressedData.Append(SoundWave->ResourceData, SoundWave->ResourceSize);
+
+		FPendingDecode& PendingDecode = PendingDecodes[PendingDecodes.AddDefaulted()];
+		PendingDecode.SoundWaveKey = SoundWaveKey;
+		PendingDecode.DecodedSound = MakeShareable(new FDecodedSound());
+
+		FDecodedSoundPtr DecodedSound = PendingDecode.DecodedSound;
+		PendingDecode.Result = Async<bool>(EAsyncExecution::ThreadPool, [AudioInfo, DecodedSound, CompressedData]()
+		{
+			bool bDecoded = false;
+			FSoundQualityInfo QualityInfo = { 0 };
+			if (AudioInfo->ReadCompressedInfo(CompressedData.GetData(), CompressedData.Num(), &QualityInfo) && QualityInfo.SampleDataSize > 0)
+			{
+				DecodedSound->PCMData.AddUninitialized(QualityInfo.SampleDataSize);
+				AudioInfo->ExpandFile(DecodedSound->PCMData.GetData(), &QualityInfo);
+				bDecoded = true;
+			}
+			delete AudioInfo;
+			return bDecoded;
+		});
+
+		return nullptr;
+	}
+
+	void FDecodedSoundCache::Update()
+	{
+		const int32 BudgetBytes = FMath::Max(DecodedSoundCacheSizeKBCvar, 0) * 1024;
+
+		for (int32 Index = PendingDecodes.Num() - 1; Index >= 0; --Index)
+		{
+			FPendingDecode& PendingDecode = PendingDecodes[Index];
+			if (!PendingDecode.Result.IsReady())
+			{
+				continue;
+			}
+
+			const int32 NumBytes = PendingDecode.DecodedSound->PCMData.Num();
+			if (PendingDecode.Result.Get() && NumBytes <= BudgetBytes)
+			{
+				// Make room first so the new sound isn't the one evicted
+				EvictOverBudget(BudgetBytes - NumBytes);
+
+				DecodedSounds.Add(PendingDecode.SoundWaveKey, PendingDecode.DecodedSound);
+				UsageOrder.Add(PendingDecode.SoundWaveKey);
+				NumCachedBytes += NumBytes;
+			}
+
+			PendingDecodes.RemoveAtSwap(Index, 1, false);
+		}
+
+		// The budget can have been lowered since the last update
+		EvictOverBudget(BudgetBytes);
+
+		SET_MEMORY_STAT(STAT_AudioMixerDecodedSoundCacheMemory, NumCachedBytes);
+	}
+
+	void FDecodedSoundCache::EvictOverBudget(const int32 BudgetBytes)
+	{
+		while (NumCachedBytes > BudgetBytes && UsageOrder.Num() > 0)
+		{
+			FDecodedSoundPtr DecodedSound;
+			if (DecodedSounds.RemoveAndCopyValue(UsageOrder[0], DecodedSound))
+			{
+				NumCachedBytes -= DecodedSound->PCMData.Num();
+			}
+			UsageOrder.RemoveAt(0, 1, false);
+		}
+	}
+
+	void FDecodedSoundCache::Flush()
+	{
+		for (FPendingDecode& PendingDecode : PendingDecodes)
+		{
+			PendingDecode.Result.Wait();
+		}
+		PendingDecodes.Reset();
+
+		DecodedSounds.Reset();
+		UsageOrder.Reset();
+		NumCachedBytes = 0;
+
+		SET_MEMORY_STAT(STAT_AudioMixerDecodedSoundCacheMemory, 0);
+	}
+}
@@ -0,0 +1,67 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "Async/Future.h"
+
+class USoundWave;
+
+namespace Audio
+{
+	class FMixerDevice;
+
+	// Fully decoded PCM of a sound wave, shared by the buffers playing it
+	struct FDecodedSound
+	{
+		TArray<uint8> PCMData;
+	};
+
+	typedef TSharedPtr<FDecodedSound, ESPMode::ThreadSafe> FDecodedSoundPtr;
+
+	// Least recently used cache of decoded PCM for short sounds which would otherwise be decoded in real time on every play.
+	// A sound is decoded on a worker thread the first time it is played and played from the cache after that.
+	// Sounds evicted while a buffer still uses them stay alive until that buffer is freed.
+	class FDecodedSoundCache
+	{
+	public:
+		FDecodedSoundCache(FMixerDevice* InMixerDevice);
+		~FDecodedSoundCache();
+
+		// Whether the sound wave is short enough to be kept decoded
+		bool CanCache(const USoundWave* SoundWave) const;
+
+		// Returns the decoded sound and marks it most recently used, or starts decoding it for the next play and returns nullptr
+		FDecodedSoundPtr FindOrRequestDecode(USoundWave* SoundWave);
+
+		// Moves finished decodes into the cache and evicts the least recently used sounds over the memory budget
+		void Update();
+
+		// Waits for pending decodes and frees all decoded sounds
+		void Flush();
+
+	private:
+		struct FPendingDecode
+		{
+			FObjectKey SoundWaveKey;
+			FDecodedSoundPtr DecodedSound;
+			TFuture<bool> Result;
+		};
+
+		void EvictOverBudget(const int32 BudgetBytes);
+
+		FMixerDevice* MixerDevice;
+
+		// Decoded sounds by sound wave
+		TMap<FObjectKey, FDecodedSoundPtr> DecodedSounds;
+
+		// Keys of DecodedSounds, least recently used first
+		TArray<FObjectKey> UsageOrder;
+
+		TArray<FPendingDecode> PendingDecodes;
+
+		// Total size of the PCM data in DecodedSounds
+		int32 NumCachedBytes;
+	};
+}
@@ -29,6 +29,7 @@ namespace Audio
 		, AudioClockDelta(0.0)
 		, AudioClock(0.0)
 		, SourceManager(this)
+		, DecodedSoundCache(this)
 		, GameOrAudioThreadId(INDEX_NONE)
 		, AudioPlatformThreadId(INDEX_NONE)
 		, bDebugOutputEnabled(false)
@@ -200,6 +201,7 @@ namespace Audio
 		if (AudioMixerPlatform)
 		{
 			SourceManager.Update();
+			DecodedSoundCache.Flush();
 
 			AudioMixerPlatform->UnRegisterDeviceChangedListener();
 			AudioMixerPlatform->StopAudioStream();
@@ -211,6 +213,7 @@ namespace Audio
 	void FMixerDevice::UpdateHardware()
 	{
 		SourceManager.Update();
+		DecodedSoundCache.Update();
 
 		if (AudioMixerPlatform->CheckAudioDeviceChange())
 		{
@@ -475,6 +475,11 @@ namespace Audio
 		SourceVoiceBuffers[0]->LoopCount = (WaveInstance->LoopingMode != LOOP_Never) ? Audio::LOOP_FOREVER : 0;
 
 		MixerSourceVoice->SubmitBuffer(SourceVoiceBuffers[0], false);
+
+		if (MixerBuffer->IsDecodedSoundBuffer())
+		{
+			bResourcesNeedFreeing = true;
+		}
 	}
 
 	void FMixerSource::SubmitPCMRTBuffers()
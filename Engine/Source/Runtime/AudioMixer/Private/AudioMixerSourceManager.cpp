@@ -6,6 +6,7 @@
 #include "AudioMixerSourceVoice.h"
 #include "AudioMixerSubmix.h"
 #include "IAudioExtensionPlugin.h"
+#include "DSP/BufferVectorOperations.h"
 
 DEFINE_STAT(STAT_AudioMixerHRTF);
 
@@ -145,6 +146,7 @@ namespace Audio
 		AUDIO_MIXER_CHECK(MixerDevice->GetSampleRate() > 0);
 
 		NumTotalSources = InitParams.NumSources;
+		NumSourceWorkers = FMath::Clamp(InitParams.NumSourceWorkers, 0, NumTotalSources);
 
 		MixerSources.Init(nullptr, NumTotalSources);
 
@@ -230,19 +232,11 @@ namespace Audio
 
 		// Setup the source workers
 		SourceWorkers.Reset();
-		if (NumSourceWorkers > 0)
+		// Ranges are assigned before each block from the sources that are playing
+		for (int32 WorkerIndex = 0; WorkerIndex < NumSourceWorkers; ++WorkerIndex)
 		{
-			const int32 NumSourcesPerWorker = NumTotalSources / NumSourceWorkers;
-			int32 StartId = 0;
-			int32 EndId = 0;
-			while (EndId < NumTotalSources)
-			{
-				EndId = FMath::Min(StartId + NumSourcesPerWorker, NumTotalSources);
-				SourceWorkers.Add(new FAsyncTask<FAudioMixerSourceWorker>(this, StartId, EndId));
-				StartId = EndId;
-			}
+			SourceWorkers.Add(new FAsyncTask<FAudioMixerSourceWorker>(this, 0, 0));
 		}
-		AUDIO_MIXER_CHECK(SourceWorkers.Num() == NumSourceWorkers);
 
 		bInitialized = true;
 		bPumpQueue = false;
@@ -1285,6 +1279,47 @@ namespace Audio
 		}
 	}
 
+	bool FMixerSourceManager::IsSourceProcessing(const int32 SourceId) const
+	{
+		const FSourceInfo& SourceInfo = SourceInfos[SourceId];
+		return SourceInfo.bIsBusy && SourceInfo.bIsPlaying && !SourceInfo.bIsPaused;
+	}
+
+	void FMixerSourceManager::UpdateSourceWorkerRanges()
+	{
+		// Free source ids are handed out lowest first, so fixed id ranges would leave most of the work to the first worker.
+		// Instead give each worker a range of ids holding the same number of playing sources.
+		int32 NumProcessingSources = 0;
+		for (int32 SourceId = 0; SourceId < NumTotalSources; ++SourceId)
+		{
+			if (IsSourceProcessing(SourceId))
+			{
+				++NumProcessingSources;
+			}
+		}
+
+		const int32 NumSourcesPerWorker = FMath::Max(FMath::DivideAndRoundUp(NumProcessingSources, NumSourceWorkers), 1);
+		int32 WorkerIndex = 0;
+		int32 StartId = 0;
+		int32 NumSourcesInRange = 0;
+		for (int32 SourceId = 0; SourceId < NumTotalSources && WorkerIndex < NumSourceWorkers - 1; ++SourceId)
+		{
+			if (IsSourceProcessing(SourceId) && ++NumSourcesInRange == NumSourcesPerWorker)
+			{
+				SourceWorkers[WorkerIndex++]->GetTask().SetSourceIdRange(StartId, SourceId + 1);
+				StartId = SourceId + 1;
+				NumSourcesInRange = 0;
+			}
+		}
+
+		// The last worker with sources takes the remaining ids, any after it get an empty range
+		for (; WorkerIndex < NumSourceWorkers; ++WorkerIndex)
+		{
+			SourceWorkers[WorkerIndex]->GetTask().SetSourceIdRange(StartId, NumTotalSources);
+			StartId = NumTotalSources;
+		}
+	}
+
 	void FMixerSourceManager::MixOutputBuffers(const int32 SourceId, TArray<float>& OutWetBuffer, const float SendLevel) const
 	{
 		AUDIO_MIXER_CHECK_AUDIO_PLAT_THREAD(MixerDevice);
@@ -1295,10 +1330,7 @@ namespace Audio
 			const FSourceInfo& SourceInfo = SourceInfos[SourceId];
 			const TArray<float>& SourceOutputBuffer = SourceInfo.OutputBuffer;
 
-			for (int32 SampleIndex = 0; SampleIndex < OutWetBuffer.Num(); ++SampleIndex)
-			{
-				OutWetBuffer[SampleIndex] += SourceOutputBuffer[SampleIndex] * SendLevel;
-			}
+			MixInBufferFast(SourceOutputBuffer.GetData(), OutWetBuffer.GetData(), OutWetBuffer.Num(), SendLevel);
 		}
 	}
 
@@ -1416,12 +1448,20 @@ namespace Audio
 		if (NumSourceWorkers > 0 && !DisableParallelSourceProcessingCvar)
 		{
 			AUDIO_MIXER_CHECK(SourceWorkers.Num() == NumSourceWorkers);
-			for (int32 i = 0; i < SourceWorkers.Num(); ++i)
+			UpdateSourceWorkerRanges();
+
+			// The first range is processed on this thread rather than waiting idle for the workers
+			for (int32 i = 1; i < SourceWorkers.Num(); ++i)
 			{
-				SourceWorkers[i]->StartBackgroundTask();
+				if (SourceWorkers[i]->GetTask().HasSources())
+				{
+					SourceWorkers[i]->StartBackgroundTask();
+				}
 			}
 
-			for (int32 i = 0; i < SourceWorkers.Num(); ++i)
+			SourceWorkers[0]->StartSynchronousTask();
+
+			for (int32 i = 1; i < SourceWorkers.Num(); ++i)
 			{
 				SourceWorkers[i]->EnsureCompletion();
 			}
@@ -255,6 +255,8 @@ namespace Audio
 		void ComputeSourceBuffersForIdRange(const int32 SourceIdStart, const int32 SourceIdEnd);
 		void ComputePostSourceEffectBufferForIdRange(const int32 SourceIdStart, const int32 SourceIdEnd);
 		void ComputeOutputBuffersForIdRange(const int32 SourceIdStart, const int32 SourceIdEnd);
+		void UpdateSourceWorkerRanges();
+		bool IsSourceProcessing(const int32 SourceId) const;
 
 		void AudioMixerThreadCommand(TFunction<void()> InFunction);
 		void PumpCommandQueue();
@@ -276,6 +278,17 @@ namespace Audio
 			{
 			}
 
+			void SetSourceIdRange(const int32 InStartSourceId, const int32 InEndSourceId)
+			{
+				StartSourceId = InStartSourceId;
+				EndSourceId = InEndSourceId;
+			}
+
+			bool HasSources() const
+			{
+				return StartSourceId < EndSourceId;
+			}
+
 			void DoWork()
 			{
 				// Get the next block of frames from the source buffers
@@ -89,6 +89,9 @@ namespace Audio
 		// Returns the submix that owns this source voice.
 		TMap<uint32, FMixerSourceSubmixSend>& GetSubmixSends() { return SubmixSends; }
 
+		// Returns the id of the source manager source used by this voice.
+		int32 GetSourceId() const { return SourceId; }
+
 	private:
 
 		friend class FMixerSourceManager;
@@ -3,6 +3,7 @@
 #include "AudioMixerSubmix.h"
 #include "AudioMixerDevice.h"
 #include "AudioMixerSourceVoice.h"
+#include "DSP/BufferVectorOperations.h"
 #include "Sound/SoundSubmix.h"
 #include "Sound/SoundEffectSubmix.h"
 
@@ -15,6 +16,7 @@ namespace Audio
 		: Id(GSubmixMixerIDs++)
 		, ParentSubmix(nullptr)
 		, MixerDevice(InMixerDevice)
+		, bSortSourceVoices(false)
 	{
 	}
 
@@ -89,7 +91,15 @@ namespace Audio
 	{
 		AUDIO_MIXER_CHECK_AUDIO_PLAT_THREAD(MixerDevice);
 
-		MixerSourceVoices.Add(InSourceVoice, InSendLevel);
+		if (float* SendLevel = MixerSourceVoices.Find(InSourceVoice))
+		{
+			*SendLevel = InSendLevel;
+		}
+		else
+		{
+			MixerSourceVoices.Add(InSourceVoice, InSendLevel);
+			bSortSourceVoices = true;
+		}
 	}
 
 	void FMixerSubmix::RemoveSourceVoice(FMixerSourceVoice* InSourceVoice)
@@ -194,16 +204,23 @@ namespace Audio
 				ChildSubmix->ProcessAudio(ScratchBuffer);
 
 				// Mix the output of the submix into the output buffer
-				for (int32 i = 0; i < NumSamples; ++i)
-				{
-					OutAudioBuffer[i] += ScratchBuffer[i];
-				}
+				MixInBufferFast(ScratchBuffer.GetData(), OutAudioBuffer.GetData(), NumSamples);
 			}
 		}
 
 		{
 			SCOPE_CYCLE_COUNTER(STAT_AudioMixerSubmixSource);
 
+			// Sources are mixed in source id order so the sum doesn't depend on the order voices were added and removed in
+			if (bSortSourceVoices)
+			{
+				bSortSourceVoices = false;
+				MixerSourceVoices.KeySort([](const FMixerSourceVoice& A, const FMixerSourceVoice& B)
+				{
+					return A.GetSourceId() < B.GetSourceId();
+				});
+			}
+
 			// Loop through this submix's sound sources
 			for (const auto MixerSourceVoiceIter : MixerSourceVoices)
 			{
@@ -259,10 +276,7 @@ namespace Audio
 					SubmixEffect->ProcessAudio(InputData, OutputData);
 				}
 
-				for (int32 i = 0; i < OutAudioBuffer.Num(); ++i)
-				{
-					OutAudioBuffer[i] = ScratchBuffer[i];
-				}
+				FMemory::Memcpy(OutAudioBuffer.GetData(), ScratchBuffer.GetData(), OutAudioBuffer.Num() * sizeof(float));
 			}
 		}
 	}
@@ -0,0 +1,127 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "DSP/BufferVectorOperations.h"
+
+namespace Audio
+{
+	void MultiplyBufferByConstantInPlace(float* RESTRICT InOutBuffer, const int32 NumSamples, const float Gain)
+	{
+		const int32 NumVectorSamples = NumSamples & ~3;
+		const VectorRegister GainVector = VectorSetFloat1(Gain);
+
+		for (int32 SampleIndex = 0; SampleIndex < NumVectorSamples; SampleIndex += 4)
+		{
+			const VectorRegister Samples = VectorLoad(&InOutBuffer[SampleIndex]);
+			VectorStore(VectorMultiply(Samples, GainVector), &InOutBuffer[SampleIndex]);
+		}
+
+		for (int32 SampleIndex = NumVectorSamples; SampleIndex < NumSamples; ++SampleIndex)
+		{
+			InOutBuffer[SampleIndex] *= Gain;
+		}
+	}
+
+	void FadeBufferFast(float* RESTRICT InOutBuffer, const int32 NumSamples, const float StartGain, const float EndGain)
+	{
+		if (NumSamples <= 0)
+		{
+			return;
+		}
+
+		if (StartGain == EndGain)
+		{
+			MultiplyBufferByConstantInPlace(InOutBuffer, NumSamples, StartGain);
+			return;
+		}
+
+		const float GainDelta = (EndGain - StartGain) / NumSamples;
+		const int32 NumVectorSamples = NumSamples & ~3;
+
+		// Gains of the next four samples, stepped by four deltas each iteration
+		VectorRegister Gains = MakeVectorRegister(StartGain, StartGain + GainDelta, StartGain + 2.0f * GainDelta, StartGain + 3.0f * GainDelta);
+		const VectorRegister GainStep = VectorSetFloat1(4.0f * GainDelta);
+
+		for (int32 SampleIndex = 0; SampleIndex < NumVectorSamples; SampleIndex += 4)
+		{
+			const VectorRegister Samples = VectorLoad(&InOutBuffer[SampleIndex]);
+			VectorStore(VectorMultiply(Samples, Gains), &InOutBuffer[SampleIndex]);
+			Gains = VectorAdd(Gains, GainStep);
+		}
+
+		for (int32 SampleIndex = NumVectorSamples; SampleIndex < NumSamples; ++SampleIndex)
+		{
+			InOutBuffer[SampleIndex] *= StartGain + SampleIndex * GainDelta;
+		}
+	}
+
+	void MixInBufferFast(const float* RESTRICT InBuffer, float* RESTRICT BufferToSumTo, const int32 NumSamples, const float Gain)
+	{
+		const int32 NumVectorSamples = NumSamples & ~3;
+		const VectorRegister GainVector = VectorSetFloat1(Gain);
+
+		for (int32 SampleIndex = 0; SampleIndex < NumVectorSamples; SampleIndex += 4)
+		{
+			const VectorRegister Input = VectorLoad(&InBuffer[SampleIndex]);
+			const VectorRegister Output = VectorLoad(&BufferToSumTo[SampleIndex]);
+			VectorStore(VectorMultiplyAdd(Input, GainVector, Output), &BufferToSumTo[SampleIndex]);
+		}
+
+		for (int32 SampleIndex = NumVectorSamples; SampleIndex < NumSamples; ++SampleIndex)
+		{
+			BufferToSumTo[SampleIndex] += InBuffer[SampleIndex] * Gain;
+		}
+	}
+
+	void MixInBufferFast(const float* RESTRICT InBuffer, float* RESTRICT BufferToSumTo, const int32 NumSamples, const float StartGain, const float EndGain)
+	{
+		if (NumSamples <= 0)
+		{
+			return;
+		}
+
+		if (StartGain == EndGain)
+		{
+			MixInBufferFast(InBuffer, BufferToSumTo, NumSamples, StartGain);
+			return;
+		}
+
+		const float GainDelta = (EndGain - StartGain) / NumSamples;
+		const int32 NumVectorSamples = NumSamples & ~3;
+
+		VectorRegister Gains = MakeVectorRegister(StartGain, StartGain + GainDelta, StartGain + 2.0f * GainDelta, StartGain + 3.0f * GainDelta);
+		const VectorRegister GainStep = VectorSetFloat1(4.0f * GainDelta);
+
+		for (int32 SampleIndex = 0; SampleIndex < NumVectorSamples; SampleIndex += 4)
+		{
+			const VectorRegister Input = VectorLoad(&InBuffer[SampleIndex]);
+			const VectorRegister Output = VectorLoad(&BufferToSumTo[SampleIndex]);
+			VectorStore(VectorMultiplyAdd(Input, Gains, Output), &BufferToSumTo[SampleIndex]);
+			Gains = VectorAdd(Gains, GainStep);
+		}
+
+		for (int32 SampleIndex = NumVectorSamples; SampleIndex < NumSamples; ++SampleIndex)
+		{
+			BufferToSumTo[SampleIndex] += InBuffer[SampleIndex] * (StartGain + SampleIndex * GainDelta);
+		}
+	}
+
+	// The shuffles needed to interleave in registers don't behave the same on every platform's vector implementation,
+	// these are left as plain loops the compiler can unroll since they are bound by memory bandwidth anyway.
+	void BufferInterleave2ChannelFast(const float* RESTRICT InLeftBuffer, const float* RESTRICT InRightBuffer, float* RESTRICT OutBuffer, const int32 NumFrames)
+	{
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			OutBuffer[2 * Frame] = InLeftBuffer[Frame];
+			OutBuffer[2 * Frame + 1] = InRightBuffer[Frame];
+		}
+	}
+
+	void BufferDeinterleave2ChannelFast(const float* RESTRICT InBuffer, float* RESTRICT OutLeftBuffer, float* RESTRICT OutRightBuffer, const int32 NumFrames)
+	{
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			OutLeftBuffer[Frame] = InBuffer[2 * Frame];
+			OutRightBuffer[Frame] = InBuffer[2 * Frame + 1];
+		}
+	}
+}
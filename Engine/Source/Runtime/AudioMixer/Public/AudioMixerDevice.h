@@ -4,6 +4,7 @@
 
 #include "AudioMixer.h"
 #include "AudioMixerSourceManager.h"
+#include "AudioMixerDecodedSoundCache.h"
 #include "AudioDevice.h"
 
 class IAudioMixerPlatformInterface;
@@ -116,6 +117,8 @@ namespace Audio
 
 		FMixerSourceManager* GetSourceManager();
 
+		FDecodedSoundCache& GetDecodedSoundCache() { return DecodedSoundCache; }
+
 		FMixerSubmixPtr GetMasterSubmix(); 
 		FMixerSubmixPtr GetMasterReverbSubmix();
 		FMixerSubmixPtr GetMasterReverbPluginSubmix();
@@ -201,6 +204,9 @@ namespace Audio
 		/** The mixer source manager. */
 		FMixerSourceManager SourceManager;
 
+		/** Decoded PCM of short real-time decoded sounds. */
+		FDecodedSoundCache DecodedSoundCache;
+
 		/** ThreadId for the game thread (or if audio is running a seperate thread, that ID) */
 		int32 GameOrAudioThreadId;
 
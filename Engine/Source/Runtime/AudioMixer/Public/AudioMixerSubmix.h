@@ -114,6 +114,9 @@ namespace Audio
 		// Map of mixer source voices with a given send level for this submix
 		TMap<FMixerSourceVoice*, float> MixerSourceVoices;
 
+		// Whether a source voice was added since MixerSourceVoices was last sorted by source id
+		bool bSortSourceVoices;
+
 		TArray<float> ScratchBuffer;
 		TArray<float> DownmixedBuffer;
 
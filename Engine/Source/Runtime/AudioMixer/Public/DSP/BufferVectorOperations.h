@@ -0,0 +1,28 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Buffer operations used by the mixer's hot loops, processing four samples at a time with the platform vector intrinsics.
+// Buffers don't need to be aligned or a multiple of four samples long.
+namespace Audio
+{
+	// Multiplies every sample of the buffer by Gain
+	AUDIOMIXER_API void MultiplyBufferByConstantInPlace(float* RESTRICT InOutBuffer, const int32 NumSamples, const float Gain);
+
+	// Multiplies the buffer by a gain ramping linearly from StartGain at the first sample towards EndGain at the last
+	AUDIOMIXER_API void FadeBufferFast(float* RESTRICT InOutBuffer, const int32 NumSamples, const float StartGain, const float EndGain);
+
+	// Adds InBuffer scaled by Gain to BufferToSumTo
+	AUDIOMIXER_API void MixInBufferFast(const float* RESTRICT InBuffer, float* RESTRICT BufferToSumTo, const int32 NumSamples, const float Gain = 1.0f);
+
+	// Adds InBuffer scaled by a gain ramping linearly from StartGain at the first sample towards EndGain at the last to BufferToSumTo
+	AUDIOMIXER_API void MixInBufferFast(const float* RESTRICT InBuffer, float* RESTRICT BufferToSumTo, const int32 NumSamples, const float StartGain, const float EndGain);
+
+	// Interleaves two mono buffers of NumFrames samples into a stereo buffer
+	AUDIOMIXER_API void BufferInterleave2ChannelFast(const float* RESTRICT InLeftBuffer, const float* RESTRICT InRightBuffer, float* RESTRICT OutBuffer, const int32 NumFrames);
+
+	// Splits a stereo buffer of NumFrames frames into two mono buffers
+	AUDIOMIXER_API void BufferDeinterleave2ChannelFast(const float* RESTRICT InBuffer, float* RESTRICT OutLeftBuffer, float* RESTRICT OutRightBuffer, const int32 NumFrames);
+}
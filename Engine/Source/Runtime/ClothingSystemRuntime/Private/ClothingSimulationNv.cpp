@@ -16,6 +16,8 @@
 
 #include "DrawDebugHelpers.h"
 #include "ModuleManager.h"
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
 
 #include "Components/SkeletalMeshComponent.h"
 
@@ -28,6 +30,12 @@ DECLARE_CYCLE_STAT(TEXT("Compute Clothing Normals"), STAT_NvClothComputeNormals,
 DECLARE_CYCLE_STAT(TEXT("Internal Solve"), STAT_NvClothInternalSolve, STATGROUP_Physics);
 DECLARE_CYCLE_STAT(TEXT("Update Collisions"), STAT_NvClothUpdateCollisions, STATGROUP_Physics);
 DECLARE_CYCLE_STAT(TEXT("Fill Context"), STAT_NvClothFillContext, STATGROUP_Physics);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Simulated Cloth Particles"), STAT_NvClothSimulatedParticles, STATGROUP_Physics);
+
+static TAutoConsoleVariable<int32> CVarClothParallelChunks(
+	TEXT("p.ClothParallelChunks"),
+	1,
+	TEXT("If 1, the solver chunks of a clothing simulation are simulated in parallel when there is more than one."));
 
 FClothingSimulationNv::FClothingSimulationNv()
 {
@@ -496,13 +504,23 @@ void FClothingSimulationNv::Simulate(IClothingSimulationContext* InContext)
 		
 		if(Solver->beginSimulation(NvContext->DeltaSeconds))
 		{
-			// In scenes this would be large, and likely should be distributed over threads,
-			// we tend to only simulated per-actor rather than per-scene so this should always be low
+			// We tend to only simulate per-actor rather than per-scene so this is usually low, but
+			// meshes with many clothing assets can have several chunks which are independent of each other
 			const int32 ChunkCount = Solver->getSimulationChunkCount();
 
-			for(int32 ChunkIdx = 0; ChunkIdx < ChunkCount; ++ChunkIdx)
+			if(ChunkCount > 1 && CVarClothParallelChunks.GetValueOnAnyThread() != 0)
+			{
+				ParallelFor(ChunkCount, [this](int32 ChunkIdx)
+				{
+					Solver->simulateChunk(ChunkIdx);
+				});
+			}
+			else
 			{
-				Solver->simulateChunk(ChunkIdx);
+				for(int32 ChunkIdx = 0; ChunkIdx < ChunkCount; ++ChunkIdx)
+				{
+					Solver->simulateChunk(ChunkIdx);
+				}
 			}
 
 			Solver->endSimulation();
@@ -517,6 +535,8 @@ void FClothingSimulationNv::Simulate(IClothingSimulationContext* InContext)
 			continue;
 		}
 
+		INC_DWORD_STAT_BY(STAT_NvClothSimulatedParticles, Actor.LodData[Actor.CurrentLodIndex].Cloth->getNumParticles());
+
 		// Need to compute mesh normals given new positions
 		ComputePhysicalMeshNormals(Actor);
 
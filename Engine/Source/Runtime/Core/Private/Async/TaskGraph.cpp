@@ -23,7 +23,11 @@
 #include "Math/RandomStream.h"
 #include "HAL/IConsoleManager.h"
 #include "Misc/App.h"
+#include "Misc/Parse.h"
+#include "Misc/CommandLine.h"
 #include "Containers/LockFreeFixedSizeAllocator.h"
+#include "Misc/MemStack.h"
+#include "Misc/ScopedArena.h"
 #include "Async/TaskGraphInterfaces.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogTaskGraph, Log, All);
@@ -33,6 +37,13 @@ DEFINE_STAT(STAT_FTriggerEventGraphTask);
 DEFINE_STAT(STAT_ParallelFor);
 DEFINE_STAT(STAT_ParallelForTask);
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("TaskGraph Worker Stalls"), STAT_TaskGraph_WorkerStalls, STATGROUP_Threading);
+DECLARE_DWORD_COUNTER_STAT(TEXT("TaskGraph Local Queue Pushes"), STAT_TaskGraph_LocalQueuePushes, STATGROUP_Threading);
+DECLARE_DWORD_COUNTER_STAT(TEXT("TaskGraph Steals"), STAT_TaskGraph_Steals, STATGROUP_Threading);
+DECLARE_DWORD_COUNTER_STAT(TEXT("TaskGraph Failed Steal Attempts"), STAT_TaskGraph_FailedSteals, STATGROUP_Threading);
+DECLARE_DWORD_COUNTER_STAT(TEXT("TaskGraph Fiber Suspends"), STAT_TaskGraph_FiberSuspends, STATGROUP_Threading);
+DECLARE_DWORD_COUNTER_STAT(TEXT("TaskGraph Fibers Created"), STAT_TaskGraph_FibersCreated, STATGROUP_Threading);
+
 #if PLATFORM_XBOXONE || PLATFORM_PS4
 #define CREATE_HIPRI_TASK_THREADS (1)
 #define CREATE_BACKGROUND_TASK_THREADS (1)
@@ -70,6 +81,43 @@ static FAutoConsoleVariableRef CVarFastScheduler(
 	ECVF_Cheat
 	);
 
+static int32 GTaskGraphWorkStealing = 0;
+static FAutoConsoleVariableRef CVarTaskGraphWorkStealing(
+	TEXT("TaskGraph.WorkStealing"),
+	GTaskGraphWorkStealing,
+	TEXT("If > 0, anythread tasks queued from a worker thread go to that worker's local queue and idle workers steal from the other workers of the same priority set. ")
+	TEXT("Latched when the task graph starts; can also be enabled with -TaskGraphWorkStealing. Not supported with TaskGraph.FastScheduler."),
+	ECVF_ReadOnly
+	);
+
+static int32 GTaskGraphFiberWaits = 0;
+static FAutoConsoleVariableRef CVarTaskGraphFiberWaits(
+	TEXT("TaskGraph.FiberWaits"),
+	GTaskGraphFiberWaits,
+	TEXT("If > 0, a task running on a worker thread that waits for other tasks is suspended on its own fiber and the worker keeps processing tasks on another fiber instead of blocking. ")
+	TEXT("Latched when the task graph starts; can also be enabled with -TaskGraphFiberWaits. Only on platforms that support fibers."),
+	ECVF_ReadOnly
+	);
+
+/** Latched value of TaskGraph.FiberWaits. */
+static bool GTaskGraphFiberWaitsLatched = false;
+
+static int32 GTaskGraphFiberStackSize = 256 * 1024;
+static FAutoConsoleVariableRef CVarTaskGraphFiberStackSize(
+	TEXT("TaskGraph.FiberStackSize"),
+	GTaskGraphFiberStackSize,
+	TEXT("Stack size in bytes of the fibers worker threads process tasks on when TaskGraph.FiberWaits is enabled."),
+	ECVF_ReadOnly
+	);
+
+static int32 GTaskGraphIdleThreadCacheTrimMs = 1000;
+static FAutoConsoleVariableRef CVarTaskGraphIdleThreadCacheTrimMs(
+	TEXT("TaskGraph.IdleThreadCacheTrimMs"),
+	GTaskGraphIdleThreadCacheTrimMs,
+	TEXT("A worker thread that has been stalled for this many milliseconds returns the small block cache of the allocator to the shared pools. 0 disables trimming."),
+	ECVF_Default
+	);
+
 // move to platform abstraction
 #if PLATFORM_XBOXONE || PLATFORM_PS4
 #define PLATFORM_OK_TO_BURN_CPU (1)
@@ -1153,6 +1201,10 @@ class FTaskThreadAnyThread : public FTaskThreadBase
 public:
 	FTaskThreadAnyThread(int32 InPriorityIndex)
 		: PriorityIndex(InPriorityIndex)
+		, ThreadFiber(nullptr)
+		, CurrentFiber(nullptr)
+		, FiberToRecycle(nullptr)
+		, NumSuspendedFibers(0)
 	{
 	}
 	/** Used for named threads to start processing tasks until the thread is idle and RequestQuit has been called. **/
@@ -1164,6 +1216,11 @@ public:
 		}
 		check(!QueueIndex);
 		Queue.QuitWhenIdle.Reset();
+		if (GTaskGraphFiberWaitsLatched && FPlatformProcess::SupportsMultithreading())
+		{
+			ProcessTasksOnFibersUntilQuit();
+			return;
+		}
 		while (Queue.QuitWhenIdle.GetValue() == 0)
 		{
 			ProcessTasks();
@@ -1222,8 +1279,108 @@ public:
 		return !!Queue.RecursionGuard;
 	}
 
+	/**
+	 *	Suspends the task that is running on this thread until Tasks have completed. The thread keeps processing other tasks
+	 *	on another fiber meanwhile and switches back to the task once it has been resumed. Called from this thread.
+	 *	@param Tasks; Tasks to wait for.
+	 *	@return false if the task can't be suspended, in which case the caller has to block.
+	 **/
+	bool SuspendUntilTasksComplete(const FGraphEventArray& Tasks);
+
+	/**
+	 *	Hands a suspended fiber back to this thread, it is switched to the next time the thread is between tasks. Called from any thread.
+	 *	@param Fiber; Fiber passed to the resume task by SuspendUntilTasksComplete.
+	 **/
+	void ResumeFiber(void* Fiber)
+	{
+		{
+			FScopeLock Lock(&ReadyFibersLock);
+			ReadyFibers.Add(Fiber);
+		}
+		NumReadyFibers.Increment();
+		WakeUp();
+	}
+
 private:
 
+	/** Entry point of the fibers this thread processes tasks on. */
+	static void FiberMain(void* Param)
+	{
+		((FTaskThreadAnyThread*)Param)->FiberLoop();
+	}
+
+	/** Runs the processing loop on fibers until quit is requested, then returns on the original thread fiber. */
+	void ProcessTasksOnFibersUntilQuit()
+	{
+		ThreadFiber = FPlatformProcess::ConvertThreadToFiber();
+		CurrentFiber = AcquireFiber();
+		FPlatformProcess::SwitchToFiber(CurrentFiber);
+
+		// back on the thread fiber, nobody is running on the pooled fibers anymore
+		RecycleFiber();
+		if (NumSuspendedFibers)
+		{
+			UE_LOG(LogTaskGraph, Warning, TEXT("Task thread %d quit with %d suspended tasks, their fibers are leaked."), (int32)ThreadId, NumSuspendedFibers);
+		}
+		for (void* Fiber : FreeFibers)
+		{
+			FPlatformProcess::DeleteFiber(Fiber);
+		}
+		FreeFibers.Empty();
+		CurrentFiber = nullptr;
+		FPlatformProcess::ConvertFiberToThread(ThreadFiber);
+		ThreadFiber = nullptr;
+	}
+
+	/** Loop of a pooled fiber. Processes tasks until a suspended fiber is ready or quit is requested, then switches to it. */
+	void FiberLoop()
+	{
+		while (1)
+		{
+			RecycleFiber();
+			while (Queue.QuitWhenIdle.GetValue() == 0 && !NumReadyFibers.GetValue())
+			{
+				ProcessTasks();
+			}
+
+			void* NextFiber = ThreadFiber;
+			if (NumReadyFibers.GetValue())
+			{
+				FScopeLock Lock(&ReadyFibersLock);
+				NextFiber = ReadyFibers.Pop(false);
+				NumReadyFibers.Decrement();
+			}
+
+			// we are done with this fiber, whoever runs next puts it back in the pool once we are off its stack
+			FiberToRecycle = CurrentFiber;
+			CurrentFiber = NextFiber;
+			FPlatformProcess::SwitchToFiber(NextFiber);
+		}
+	}
+
+	/** @return a fiber to process tasks on, from the pool if possible. */
+	void* AcquireFiber()
+	{
+		if (FreeFibers.Num())
+		{
+			return FreeFibers.Pop(false);
+		}
+		INC_DWORD_STAT(STAT_TaskGraph_FibersCreated);
+		void* Fiber = FPlatformProcess::CreateFiber(GTaskGraphFiberStackSize, &FiberMain, this);
+		checkf(Fiber, TEXT("Failed to create a task graph fiber."));
+		return Fiber;
+	}
+
+	/** Puts the fiber we switched away from back in the pool. */
+	void RecycleFiber()
+	{
+		if (FiberToRecycle)
+		{
+			FreeFibers.Add(FiberToRecycle);
+			FiberToRecycle = nullptr;
+		}
+	}
+
 	/** 
 	 *	Process tasks until idle. May block if bAllowStall is true
 	 *	@param QueueIndex, Queue to process tasks from
@@ -1248,6 +1405,18 @@ private:
 		verify(++Queue.RecursionGuard == 1);
 		while (1)
 		{
+			if (NumReadyFibers.GetValue())
+			{
+				// a suspended task can continue, return to the fiber loop so it can switch to it
+#if STATS
+				if (bTasksOpen)
+				{
+					ProcessingTasks.Stop();
+					bTasksOpen = false;
+				}
+#endif
+				break;
+			}
 			FBaseGraphTask* Task = FindWork();
 			if (!Task)
 			{
@@ -1322,11 +1491,27 @@ private:
 
 				FScopeCycleCounter Scope( StallStatId );
 
-				NotifyStalling();
-				TestRandomizedThreads();
-				Queue.StallRestartEvent->Wait(MAX_uint32, bCountAsStall);
-				TestRandomizedThreads();
-				Queue.StallRestartEvent->Reset();
+				if (NotifyStalling())
+				{
+					INC_DWORD_STAT(STAT_TaskGraph_WorkerStalls);
+					TestRandomizedThreads();
+					bool bWokenUp = false;
+					if (GTaskGraphIdleThreadCacheTrimMs > 0)
+					{
+						bWokenUp = Queue.StallRestartEvent->Wait(GTaskGraphIdleThreadCacheTrimMs, bCountAsStall);
+						if (!bWokenUp)
+						{
+							// we are idle, don't sit on cached memory other threads could use
+							FMemory::TrimCurrentThreadCache();
+						}
+					}
+					if (!bWokenUp)
+					{
+						Queue.StallRestartEvent->Wait(MAX_uint32, bCountAsStall);
+					}
+					TestRandomizedThreads();
+					Queue.StallRestartEvent->Reset();
+				}
 			}
 		}
 	}
@@ -1339,15 +1524,104 @@ private:
 
 	/**
 	 *	Internal function to notify the that system that I am stalling. This is a hint to give me a job asap.
+	 *	@return false if work showed up while registering the stall and the thread should look for work again instead of blocking.
 	 */
-	void NotifyStalling();
+	bool NotifyStalling();
 
 	/** Array of queues, only the first one is used for unnamed threads. **/
 	FThreadTaskQueue Queue;
 
 	int32 PriorityIndex;
+
+	/** The fiber the OS thread was converted to, only set when tasks are processed on fibers. **/
+	void* ThreadFiber;
+	/** The fiber that is running on this thread. **/
+	void* CurrentFiber;
+	/** A fiber that was switched away from and goes back to FreeFibers once the next fiber runs. **/
+	void* FiberToRecycle;
+	/** Fibers that are not running a processing loop or a suspended task, only used by this thread. **/
+	TArray<void*> FreeFibers;
+	/** Fibers of suspended tasks whose prerequisites have completed, filled from any thread. **/
+	TArray<void*> ReadyFibers;
+	/** Guards ReadyFibers. **/
+	FCriticalSection ReadyFibersLock;
+	/** Number of entries in ReadyFibers, checked between tasks without taking the lock. **/
+	FThreadSafeCounter NumReadyFibers;
+	/** Number of tasks suspended on this thread, only used by this thread. **/
+	int32 NumSuspendedFibers;
 };
 
+/** Task that hands a suspended fiber back to the worker thread it was suspended on. **/
+class FResumeFiberGraphTask
+{
+public:
+	FResumeFiberGraphTask(FTaskThreadAnyThread* InOwner, void* InFiber)
+		: Owner(InOwner)
+		, Fiber(InFiber)
+	{
+	}
+
+	FORCEINLINE TStatId GetStatId() const
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(FResumeFiberGraphTask, STATGROUP_TaskGraphTasks);
+	}
+
+	ENamedThreads::Type GetDesiredThread()
+	{
+		return ENamedThreads::AnyHiPriThreadHiPriTask;
+	}
+
+	static ESubsequentsMode::Type GetSubsequentsMode() { return ESubsequentsMode::FireAndForget; }
+
+	void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+	{
+		Owner->ResumeFiber(Fiber);
+	}
+
+private:
+	FTaskThreadAnyThread* Owner;
+	void* Fiber;
+};
+
+bool FTaskThreadAnyThread::SuspendUntilTasksComplete(const FGraphEventArray& Tasks)
+{
+	// only tasks run directly by the processing loop of a fiber can be suspended
+	if (!CurrentFiber || Queue.RecursionGuard != 1)
+	{
+		return false;
+	}
+	// thread local scopes have to nest, another task could open and close its own while this one is suspended
+	if (FMemStack::Get().GetNumMarks() || FScopedArena::GetCurrent())
+	{
+		return false;
+	}
+#if STATS
+	if (FThreadStats::IsCollectingData())
+	{
+		return false;
+	}
+#endif
+
+	void* WaitingFiber = CurrentFiber;
+	TGraphTask<FResumeFiberGraphTask>::CreateTask(&Tasks, ENamedThreads::AnyThread).ConstructAndDispatchWhenReady(this, WaitingFiber);
+
+	INC_DWORD_STAT(STAT_TaskGraph_FiberSuspends);
+	++NumSuspendedFibers;
+
+	// the processing loop below this task continues on another fiber; the resume task may already have run,
+	// that's fine since only this thread switches back to WaitingFiber and it can't do so before we switched away
+	--Queue.RecursionGuard;
+	CurrentFiber = AcquireFiber();
+	FPlatformProcess::SwitchToFiber(CurrentFiber);
+
+	// resumed by FiberLoop
+	check(CurrentFiber == WaitingFiber);
+	RecycleFiber();
+	--NumSuspendedFibers;
+	verify(++Queue.RecursionGuard == 1);
+	return true;
+}
+
 /** 
  *	FTaskGraphImplementation
  *	Implementation of the centralized part of the task graph system.
@@ -1440,7 +1714,33 @@ public:
 		NumTaskThreadsPerSet = (NumThreads - NumNamedThreads) / NumTaskThreadSets;
 		check((NumThreads - NumNamedThreads) % NumTaskThreadSets == 0); // should be equal numbers of threads per priority set
 
-		UE_LOG(LogTaskGraph, Log, TEXT("Started task graph with %d named threads and %d total threads with %d sets of task threads."), NumNamedThreads, NumThreads, NumTaskThreadSets);
+		bWorkStealing = false;
+		if (GTaskGraphWorkStealing > 0 || FParse::Param(FCommandLine::Get(), TEXT("TaskGraphWorkStealing")))
+		{
+#if USE_NEW_LOCK_FREE_LISTS
+			UE_LOG(LogTaskGraph, Warning, TEXT("TaskGraph.WorkStealing is not supported on this platform, ignoring."));
+#else
+			bWorkStealing = FPlatformProcess::SupportsMultithreading();
+			// the work stealing mode replaces the fast scheduler; the two cannot be mixed
+			GFastScheduler = 0;
+			GFastSchedulerLatched = 0;
+#endif
+		}
+
+		GTaskGraphFiberWaitsLatched = false;
+		if (GTaskGraphFiberWaits > 0 || FParse::Param(FCommandLine::Get(), TEXT("TaskGraphFiberWaits")))
+		{
+			if (FPlatformProcess::SupportsFibers())
+			{
+				GTaskGraphFiberWaitsLatched = FPlatformProcess::SupportsMultithreading();
+			}
+			else
+			{
+				UE_LOG(LogTaskGraph, Warning, TEXT("TaskGraph.FiberWaits is not supported on this platform, ignoring."));
+			}
+		}
+
+		UE_LOG(LogTaskGraph, Log, TEXT("Started task graph with %d named threads and %d total threads with %d sets of task threads%s%s."), NumNamedThreads, NumThreads, NumTaskThreadSets, bWorkStealing ? TEXT(", work stealing enabled") : TEXT(""), GTaskGraphFiberWaitsLatched ? TEXT(", fiber waits enabled") : TEXT(""));
 		check(NumThreads - NumNamedThreads >= 1);  // need at least one pure worker thread
 		check(NumThreads <= MAX_THREADS);
 		check(!ReentrancyCheck.GetValue()); // reentrant?
@@ -1549,7 +1849,7 @@ public:
 
 		TestRandomizedThreads();
 		checkThreadGraph(NumTaskThreadsPerSet);
-		if (GFastSchedulerLatched != GFastScheduler && IsInGameThread())
+		if (!bWorkStealing && GFastSchedulerLatched != GFastScheduler && IsInGameThread())
 		{
 #if USE_NEW_LOCK_FREE_LISTS
 			GFastScheduler = !!FApp::ShouldUseThreadingForPerformance();
@@ -1615,6 +1915,19 @@ public:
 				}
 				check(Priority >= 0 && Priority < MAX_THREAD_PRIORITIES);
 
+				if (bWorkStealing && !TaskPriority)
+				{
+					// tasks queued from a worker (typically subsequents being dispatched) stay on that worker's own queue, other workers steal them when idle
+					int32 CurrentThreadIndex = ENamedThreads::GetThreadIndex(ENamedThreads::GetThreadIndex(InCurrentThreadIfKnown) == ENamedThreads::AnyThread ? GetCurrentThread() : InCurrentThreadIfKnown);
+					if (CurrentThreadIndex != ENamedThreads::AnyThread && CurrentThreadIndex >= NumNamedThreads && ThreadIndexToPriorityIndex(CurrentThreadIndex) == Priority)
+					{
+						LocalAnyThreadTasks[CurrentThreadIndex].Tasks.Push(Task);
+						INC_DWORD_STAT(STAT_TaskGraph_LocalQueuePushes);
+						WakeStalledThreadToSteal(Priority, CurrentThreadIndex);
+						return;
+					}
+				}
+
 				{
 					TASKGRAPH_SCOPE_CYCLE_COUNTER(4, STAT_TaskGraph_QueueTask_IncomingAnyThreadTasks_Push);
 					if (TaskPriority)
@@ -1808,6 +2121,27 @@ public:
 		}
 		else
 		{
+			if (GTaskGraphFiberWaitsLatched && CurrentThreadIfKnown >= NumNamedThreads && CurrentThreadIfKnown < NumThreads)
+			{
+				bool bAnyPending = false;
+				for (int32 Index = 0; Index < Tasks.Num(); Index++)
+				{
+					if (!Tasks[Index]->IsComplete())
+					{
+						bAnyPending = true;
+						break;
+					}
+				}
+				if (!bAnyPending)
+				{
+					return;
+				}
+				// suspend the waiting task so this worker can keep processing tasks while we wait
+				if (static_cast<FTaskThreadAnyThread&>(Thread(CurrentThreadIfKnown)).SuspendUntilTasksComplete(Tasks))
+				{
+					return;
+				}
+			}
 			// We will just stall this thread on an event while we wait
 			FScopedEvent Event;
 			TriggerEventWhenTasksComplete(Event.Get(), Tasks, CurrentThreadIfKnown);
@@ -2071,6 +2405,87 @@ public:
 	 *	@return Task that was stolen if any was found.
 	**/
 	FBaseGraphTask* FindWork(ENamedThreads::Type ThreadInNeed)
+	{
+		if (bWorkStealing)
+		{
+			FBaseGraphTask* Task = LocalAnyThreadTasks[ThreadInNeed].Tasks.Pop();
+			if (!Task)
+			{
+				Task = FindWorkInSharedQueues(ThreadInNeed);
+			}
+			if (!Task)
+			{
+				Task = StealWork(ThreadInNeed);
+			}
+			return Task;
+		}
+		return FindWorkInSharedQueues(ThreadInNeed);
+	}
+
+	/** 
+	 *	Tries to take a task from another worker's local queue in the same priority set. Only used in work stealing mode.
+	 *	@param	ThreadInNeed; Id of the thread requesting work.
+	 *	@return Task that was stolen if any was found.
+	**/
+	FBaseGraphTask* StealWork(ENamedThreads::Type ThreadInNeed)
+	{
+		const int32 FirstThreadInSet = ThreadIndexToPriorityIndex(ThreadInNeed) * NumTaskThreadsPerSet + NumNamedThreads;
+		const int32 MyIndex = ThreadInNeed - FirstThreadInSet;
+		// start with our neighbor so that thieves spread out over the victims instead of all hammering the first queue
+		for (int32 Offset = 1; Offset < NumTaskThreadsPerSet; Offset++)
+		{
+			FBaseGraphTask* Task = LocalAnyThreadTasks[FirstThreadInSet + (MyIndex + Offset) % NumTaskThreadsPerSet].Tasks.Pop();
+			if (Task)
+			{
+				INC_DWORD_STAT(STAT_TaskGraph_Steals);
+				return Task;
+			}
+		}
+		INC_DWORD_STAT(STAT_TaskGraph_FailedSteals);
+		return nullptr;
+	}
+
+	/** 
+	 *	@return true if any worker of the given priority set has tasks sitting in its local queue. This is only a guess, other threads can change the queues concurrently.
+	**/
+	bool HasStealableWork(int32 Priority)
+	{
+		const int32 FirstThreadInSet = Priority * NumTaskThreadsPerSet + NumNamedThreads;
+		for (int32 ThreadIndex = FirstThreadInSet; ThreadIndex < FirstThreadInSet + NumTaskThreadsPerSet; ThreadIndex++)
+		{
+			if (!LocalAnyThreadTasks[ThreadIndex].Tasks.IsEmpty())
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/** 
+	 *	Wakes one stalled worker of the priority set so it can steal from a queue that just got a new task. If nobody is stalled, every worker is busy and will find the task on its own.
+	 *	@param	Priority; priority set of the queue that received the task.
+	 *	@param	CurrentThreadIndex; the thread that queued the task, never woken.
+	**/
+	void WakeStalledThreadToSteal(int32 Priority, int32 CurrentThreadIndex)
+	{
+		TASKGRAPH_SCOPE_CYCLE_COUNTER(5, STAT_TaskGraph_QueueTask_StalledUnnamedThreads_Pop);
+		while (FTaskThreadBase* TempTarget = StalledUnnamedThreads[Priority].Pop())
+		{
+			if (TempTarget->GetThreadId() != CurrentThreadIndex)
+			{
+				TempTarget->WakeUp();
+				return;
+			}
+			// a stale hint for ourselves, we are obviously not stalled
+		}
+	}
+
+	/** 
+	 *	Finds work in the incoming and sorted anythread queues that are shared by all workers of a priority set.
+	 *	@param	ThreadInNeed; Id of the thread requesting work.
+	 *	@return Task that was found if any.
+	**/
+	FBaseGraphTask* FindWorkInSharedQueues(ENamedThreads::Type ThreadInNeed)
 	{
 		int32 LocalNumWorkingThread = GetNumWorkerThreads();
 		uint32 MyIndex = (uint32(ThreadInNeed) - NumNamedThreads) % NumTaskThreadsPerSet;
@@ -2180,8 +2595,9 @@ public:
 	/** 
 	 *	Hint from a worker thread that it is stalling.
 	 *	@param	StallingThread; Id of the thread that is stalling.
+	 *	@return false if the thread should not block because work was queued while it registered itself as stalled.
 	**/
-	void NotifyStalling(ENamedThreads::Type StallingThread)
+	bool NotifyStalling(ENamedThreads::Type StallingThread)
 	{
 		if (StallingThread >= NumNamedThreads && !GFastSchedulerLatched)
 		{
@@ -2194,7 +2610,13 @@ public:
 				(ENamedThreads::bHasBackgroundThreads || (Priority << ENamedThreads::ThreadPriorityShift) != ENamedThreads::BackgroundThreadPriority)
 				);
 			StalledUnnamedThreads[Priority].Push(&Thread(StallingThread));
+			// a task pushed to a local queue before we were on the stalled list would not wake anyone, so check again now that we are visible
+			if (bWorkStealing && HasStealableWork(Priority))
+			{
+				return false;
+			}
 		}
+		return true;
 	}
 
 	void SetTaskThreadPriorities(EThreadPriority Pri)
@@ -2280,6 +2702,8 @@ private:
 	int32				NumTaskThreadsPerSet;
 	bool				bCreatedHiPriorityThreads;
 	bool				bCreatedBackgroundPriorityThreads;
+	/** If true, anythread tasks queued from worker threads go to per worker queues that other workers steal from. Latched at startup. **/
+	bool				bWorkStealing;
 	/**
 	 * "External Threads" are not created, the thread is created elsewhere and makes an explicit call to run 
 	 * Here all of the named threads are external but that need not be the case.
@@ -2297,6 +2721,16 @@ private:
 	/** Array of callbacks to call before shutdown. **/
 	TArray<TFunction<void()> > ShutdownCallbacks;
 
+	/** Per worker queue used in work stealing mode, padded so that owners and thieves of neighboring queues don't share a cache line. **/
+	struct FLocalTaskQueue
+	{
+		uint8 Pad1[PLATFORM_CACHE_LINE_SIZE];
+		TLockFreePointerListLIFO<FBaseGraphTask> Tasks;
+		uint8 Pad2[PLATFORM_CACHE_LINE_SIZE];
+	};
+	/** Local queues, indexed by thread index. Only the entries of unnamed threads are used. **/
+	FLocalTaskQueue		LocalAnyThreadTasks[MAX_THREADS];
+
 #if USE_NEW_LOCK_FREE_LISTS
 #if USE_INTRUSIVE_TASKQUEUES
 	FLockFreePointerListFIFOIntrusive<FBaseGraphTask, PLATFORM_CACHE_LINE_SIZE>		IncomingAnyThreadTasks[MAX_THREAD_PRIORITIES];
@@ -2426,7 +2860,7 @@ FBaseGraphTask* FTaskThreadAnyThread::FindWork()
 	return FTaskGraphImplementation::Get().FindWork(ThreadId);
 }
 
-void FTaskThreadAnyThread::NotifyStalling()
+bool FTaskThreadAnyThread::NotifyStalling()
 {
 	return FTaskGraphImplementation::Get().NotifyStalling(ThreadId);
 }
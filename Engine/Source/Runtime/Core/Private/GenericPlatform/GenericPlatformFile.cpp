@@ -11,6 +11,7 @@
 #include "ScopeLock.h"
 
 #include "AsyncFileHandle.h"
+#include "Async/MappedFileHandle.h"
 
 class FGenericBaseRequest;
 class FGenericAsyncReadFileHandle;
@@ -441,6 +442,10 @@ DEFINE_STAT(STAT_AsyncFileMemory);
 DEFINE_STAT(STAT_AsyncFileHandles);
 DEFINE_STAT(STAT_AsyncFileRequests);
 
+DEFINE_STAT(STAT_MappedFileMemory);
+DEFINE_STAT(STAT_MappedFileHandles);
+DEFINE_STAT(STAT_MappedFileRegions);
+
 int64 IFileHandle::Size()
 {
 	int64 Current = Tell();
@@ -0,0 +1,337 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "HAL/LowLevelMemTracker.h"
+#include "HAL/MemoryBase.h"
+#include "HAL/UnrealMemory.h"
+#include "HAL/PlatformAtomics.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/Paths.h"
+#include "Misc/DateTime.h"
+#include "Misc/Parse.h"
+#include "Misc/CommandLine.h"
+#include "CoreGlobals.h"
+#include "Templates/UniquePtr.h"
+#include "Containers/StringConv.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogLLM, Log, All);
+
+bool FLowLevelMemTracker::bEnabled = false;
+uint32 FLowLevelMemTracker::TlsSlot = 0;
+volatile int64 FLowLevelMemTracker::TagAmounts[(uint32)ELLMTag::Count] = {};
+
+static int32 GLLMCsv = 0;
+static FAutoConsoleVariableRef CVarLLMCsv(
+	TEXT("llm.Csv"),
+	GLLMCsv,
+	TEXT("Writes the low level memory tracker amounts of every tag to Saved/Profiling/LLM once per frame. Can also be enabled with -llmcsv.\n")
+	TEXT("Needs a build with ENABLE_LOW_LEVEL_MEM_TRACKER."));
+
+/**
+ * Prepends every allocation with a header holding its size and tag, so frees and reallocs can be attributed without a lookup.
+ * Has to wrap the allocator before the first allocation, headerless allocations can't be freed through it.
+ */
+class FMallocLLMProxy : public FMalloc
+{
+private:
+	/** Stored right before the pointer handed out */
+	struct FHeader
+	{
+		SIZE_T Size;
+		/** Distance from the start of the underlying allocation to the pointer handed out */
+		uint32 Offset;
+		ELLMTag Tag;
+	};
+
+	/** Malloc we're based on, aka using under the hood */
+	FMalloc* UsedMalloc;
+
+	static FORCEINLINE uint32 GetAlignment(uint32 Alignment)
+	{
+		return FMath::Max<uint32>(Alignment, 16);
+	}
+
+	/** Offset of the pointer handed out, keeps the header in front of it and the pointer aligned */
+	static FORCEINLINE uint32 GetOffset(uint32 Alignment)
+	{
+		return Align((uint32)sizeof(FHeader), Alignment);
+	}
+
+	static FORCEINLINE FHeader* GetHeader(void* Ptr)
+	{
+		return (FHeader*)Ptr - 1;
+	}
+
+	static FORCEINLINE void Track(ELLMTag Tag, int64 Amount)
+	{
+		FPlatformAtomics::InterlockedAdd(&FLowLevelMemTracker::TagAmounts[(uint32)Tag], Amount);
+	}
+
+	FORCEINLINE void* Track(void* Base, SIZE_T Size, uint32 Offset, ELLMTag Tag)
+	{
+		if (Base == nullptr)
+		{
+			return nullptr;
+		}
+
+		void* Result = (uint8*)Base + Offset;
+		FHeader* Header = GetHeader(Result);
+		Header->Size = Size;
+		Header->Offset = Offset;
+		Header->Tag = Tag;
+
+		Track(Tag, Size);
+		return Result;
+	}
+
+public:
+	// FMalloc interface begin
+	explicit FMallocLLMProxy(FMalloc* InMalloc)
+		: UsedMalloc(InMalloc)
+	{
+		checkf(UsedMalloc, TEXT("FMallocLLMProxy is used without a valid malloc!"));
+	}
+
+	virtual void InitializeStatsMetadata() override
+	{
+		UsedMalloc->InitializeStatsMetadata();
+	}
+
+	virtual void* Malloc(SIZE_T Size, uint32 Alignment) override
+	{
+		IncrementTotalMallocCalls();
+		Alignment = GetAlignment(Alignment);
+		const uint32 Offset = GetOffset(Alignment);
+		return Track(UsedMalloc->Malloc(Size + Offset, Alignment), Size, Offset, FLowLevelMemTracker::GetCurrentTag());
+	}
+
+	virtual void* Realloc(void* Ptr, SIZE_T NewSize, uint32 Alignment) override
+	{
+		IncrementTotalReallocCalls();
+		if (Ptr == nullptr)
+		{
+			return Malloc(NewSize, Alignment);
+		}
+		if (NewSize == 0)
+		{
+			Free(Ptr);
+			return nullptr;
+		}
+
+		Alignment = GetAlignment(Alignment);
+		const uint32 Offset = GetOffset(Alignment);
+		const FHeader OldHeader = *GetHeader(Ptr);
+
+		// Growing containers stay attributed to the subsystem that allocated them
+		if (OldHeader.Offset == Offset)
+		{
+			void* Result = UsedMalloc->Realloc((uint8*)Ptr - Offset, NewSize + Offset, Alignment);
+			if (Result)
+			{
+				Track(OldHeader.Tag, -(int64)OldHeader.Size);
+				Result = Track(Result, NewSize, Offset, OldHeader.Tag);
+			}
+			return Result;
+		}
+
+		// The header wouldn't end up in front of the new alignment, move the allocation
+		void* Result = Track(UsedMalloc->Malloc(NewSize + Offset, Alignment), NewSize, Offset, OldHeader.Tag);
+		if (Result)
+		{
+			FMemory::Memcpy(Result, Ptr, FMath::Min(NewSize, OldHeader.Size));
+			Free(Ptr);
+		}
+		return Result;
+	}
+
+	virtual void Free(void* Ptr) override
+	{
+		if (LIKELY(Ptr))
+		{
+			IncrementTotalFreeCalls();
+			const FHeader* Header = GetHeader(Ptr);
+			Track(Header->Tag, -(int64)Header->Size);
+			UsedMalloc->Free((uint8*)Ptr - Header->Offset);
+		}
+	}
+
+	virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override
+	{
+		Alignment = GetAlignment(Alignment);
+		const uint32 Offset = GetOffset(Alignment);
+		return UsedMalloc->QuantizeSize(Count + Offset, Alignment) - Offset;
+	}
+
+	virtual bool GetAllocationSize(void *Original, SIZE_T &SizeOut) override
+	{
+		SizeOut = GetHeader(Original)->Size;
+		return true;
+	}
+
+	virtual void GetAllocatorStats( FGenericMemoryStats& out_Stats ) override
+	{
+		UsedMalloc->GetAllocatorStats( out_Stats );
+	}
+
+	virtual void DumpAllocatorStats( class FOutputDevice& Ar ) override
+	{
+		UsedMalloc->DumpAllocatorStats( Ar );
+	}
+
+	virtual bool ValidateHeap() override
+	{
+		return UsedMalloc->ValidateHeap();
+	}
+
+	virtual bool Exec( UWorld* InWorld, const TCHAR* Cmd, FOutputDevice& Ar ) override
+	{
+		return UsedMalloc->Exec(InWorld, Cmd, Ar);
+	}
+
+	virtual bool IsInternallyThreadSafe() const override
+	{
+		return UsedMalloc->IsInternallyThreadSafe();
+	}
+
+	virtual void SetupTLSCachesOnCurrentThread() override
+	{
+		UsedMalloc->SetupTLSCachesOnCurrentThread();
+	}
+
+	virtual void ClearAndDisableTLSCachesOnCurrentThread() override
+	{
+		UsedMalloc->ClearAndDisableTLSCachesOnCurrentThread();
+	}
+
+	virtual const TCHAR* GetDescriptiveName() override
+	{ 
+		return UsedMalloc->GetDescriptiveName(); 
+	}
+
+	virtual void Trim() override
+	{
+		UsedMalloc->Trim();
+	}
+	// FMalloc interface end
+};
+
+FMalloc* FLowLevelMemTracker::CreateMallocProxy(FMalloc* InMalloc)
+{
+	check(!bEnabled);
+
+	TlsSlot = FPlatformTLS::AllocTlsSlot();
+	bEnabled = true;
+	return new FMallocLLMProxy(InMalloc);
+}
+
+const TCHAR* FLowLevelMemTracker::GetTagName(ELLMTag Tag)
+{
+#define LLM_ENUM_TAG_NAME(Enum, Name) TEXT(Name),
+	static const TCHAR* TagNames[] = { LLM_ENUM_TAGS(LLM_ENUM_TAG_NAME) };
+#undef LLM_ENUM_TAG_NAME
+
+	return (uint32)Tag < ARRAY_COUNT(TagNames) ? TagNames[(uint32)Tag] : TEXT("Unknown");
+}
+
+/** Writes the csv rows while llm.Csv is enabled, opening a new file every time it gets enabled */
+struct FLLMCsvWriter
+{
+	FLLMCsvWriter()
+		: FirstFrame(0)
+	{}
+
+	TUniquePtr<FArchive> Writer;
+	uint64 FirstFrame;
+
+	void WriteLine(const FString& Line)
+	{
+		FTCHARToUTF8 Converted(*Line);
+		Writer->Serialize((void*)Converted.Get(), Converted.Length());
+	}
+
+	void Tick()
+	{
+		if (!GLLMCsv)
+		{
+			Writer.Reset();
+			return;
+		}
+
+		if (!Writer)
+		{
+			const FString Filename = FPaths::ProfilingDir() / TEXT("LLM") / FString::Printf(TEXT("LLM-%s.csv"), *FDateTime::Now().ToString());
+			Writer.Reset(IFileManager::Get().CreateFileWriter(*Filename));
+			if (!Writer)
+			{
+				UE_LOG(LogLLM, Warning, TEXT("Failed to open %s, disabling llm.Csv"), *Filename);
+				GLLMCsv = 0;
+				return;
+			}
+
+			UE_LOG(LogLLM, Display, TEXT("Writing low level memory tracker amounts to %s"), *Filename);
+			FirstFrame = GFrameCounter;
+
+			FString Header = TEXT("Frame,TotalMB");
+			for (uint32 TagIndex = 0; TagIndex < (uint32)ELLMTag::Count; ++TagIndex)
+			{
+				Header += TEXT(",");
+				Header += FLowLevelMemTracker::GetTagName((ELLMTag)TagIndex);
+			}
+			WriteLine(Header + LINE_TERMINATOR);
+		}
+
+		FString Row;
+		int64 Total = 0;
+		for (uint32 TagIndex = 0; TagIndex < (uint32)ELLMTag::Count; ++TagIndex)
+		{
+			const int64 Amount = FLowLevelMemTracker::GetTagAmount((ELLMTag)TagIndex);
+			Row += FString::Printf(TEXT(",%.3f"), Amount / 1024.0 / 1024.0);
+			Total += Amount;
+		}
+		WriteLine(FString::Printf(TEXT("%llu,%.3f"), GFrameCounter - FirstFrame, Total / 1024.0 / 1024.0) + Row + LINE_TERMINATOR);
+	}
+};
+
+void FLowLevelMemTracker::EndFrame()
+{
+	if (!bEnabled)
+	{
+		return;
+	}
+
+	static bool bCheckedCommandLine = false;
+	if (!bCheckedCommandLine)
+	{
+		bCheckedCommandLine = true;
+		if (FParse::Param(FCommandLine::Get(), TEXT("llmcsv")))
+		{
+			GLLMCsv = 1;
+		}
+	}
+
+	static FLLMCsvWriter CsvWriter;
+	CsvWriter.Tick();
+}
+
+static void HandleLLMDumpCommand()
+{
+	if (!FLowLevelMemTracker::IsEnabled())
+	{
+		UE_LOG(LogLLM, Display, TEXT("The low level memory tracker is only available in builds with ENABLE_LOW_LEVEL_MEM_TRACKER"));
+		return;
+	}
+
+	int64 Total = 0;
+	for (uint32 TagIndex = 0; TagIndex < (uint32)ELLMTag::Count; ++TagIndex)
+	{
+		const int64 Amount = FLowLevelMemTracker::GetTagAmount((ELLMTag)TagIndex);
+		UE_LOG(LogLLM, Display, TEXT("%16s: %10.3f MB"), FLowLevelMemTracker::GetTagName((ELLMTag)TagIndex), Amount / 1024.0 / 1024.0);
+		Total += Amount;
+	}
+	UE_LOG(LogLLM, Display, TEXT("%16s: %10.3f MB"), TEXT("Total"), Total / 1024.0 / 1024.0);
+}
+
+static FAutoConsoleCommand LLMDumpCommand(
+	TEXT("llm.Dump"),
+	TEXT("Logs the bytes currently allocated per low level memory tracker tag."),
+	FConsoleCommandDelegate::CreateStatic(&HandleLLMDumpCommand));
@@ -11,6 +11,11 @@
 #include "GenericPlatform/GenericPlatformProcess.h"
 #include "Stats/Stats.h"
 #include "HAL/IConsoleManager.h"
+#include "Misc/OutputDevice.h"
+
+DECLARE_MEMORY_STAT(TEXT("Binned2 Thread Cached Memory"), STAT_Binned2_ThreadCachedMemory, STATGROUP_Memory);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Binned2 Threads With Caches"), STAT_Binned2_NumThreadCaches, STATGROUP_Memory);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Binned2 Thread Cache Trims"), STAT_Binned2_NumThreadCacheTrims, STATGROUP_Memory);
 
 
 #if BINNED2_ALLOW_RUNTIME_TWEAKING
@@ -264,6 +269,38 @@ struct FMallocBinned2::PoolHashBucket
 
 struct FMallocBinned2::Private
 {
+	/** Lock protecting the list of registered thread caches. A function static so that it is usable before static init of this file is done. */
+	static FCriticalSection& GetThreadCacheRegistryLock()
+	{
+		static FCriticalSection RegistryLock;
+		return RegistryLock;
+	}
+	/** Head of the list of all thread caches, protected by GetThreadCacheRegistryLock() */
+	static FPerThreadFreeBlockLists* RegisteredThreadCaches;
+
+	/** Snapshot of a single thread cache, gathered under the registry lock so that logging can happen outside of it */
+	struct FThreadCacheStats
+	{
+		uint32 ThreadId;
+		uint32 NumTrims;
+		uint32 NumCachedBlocks[BINNED2_SMALL_POOL_COUNT];
+	};
+
+	static void GatherThreadCacheStats(TArray<FThreadCacheStats>& OutStats)
+	{
+		FScopeLock Lock(&GetThreadCacheRegistryLock());
+		for (FPerThreadFreeBlockLists* Lists = RegisteredThreadCaches; Lists; Lists = Lists->NextRegistered)
+		{
+			FThreadCacheStats& Stats = OutStats[OutStats.AddUninitialized()];
+			Stats.ThreadId = Lists->ThreadId;
+			Stats.NumTrims = Lists->NumTrims;
+			for (uint32 PoolIndex = 0; PoolIndex < BINNED2_SMALL_POOL_COUNT; PoolIndex++)
+			{
+				Stats.NumCachedBlocks[PoolIndex] = Lists->NumCachedBlocks(PoolIndex);
+			}
+		}
+	}
+
 	// Implementation. 
 	static CA_NO_RETURN void OutOfMemory(uint64 Size, uint32 Alignment=0)
 	{
@@ -809,6 +846,133 @@ void FMallocBinned2::FreeExternal(void* Ptr)
 	}
 }
 
+void FMallocBinned2::MallocBulk(void** OutPtrs, int32 NumPtrs, SIZE_T Size, uint32 Alignment)
+{
+	if (!((Size <= BINNED2_MAX_SMALL_POOL_SIZE) & (Alignment <= BINNED2_MINIMUM_ALIGNMENT))) // one branch, not two
+	{
+		// OS allocations are one page run each, there is nothing to batch
+		for (int32 Index = 0; Index < NumPtrs; Index++)
+		{
+			OutPtrs[Index] = MallocExternal(Size, Alignment);
+		}
+		return;
+	}
+
+	uint32 PoolIndex = BoundSizeToPoolIndex(Size);
+	int32 NumAllocated = 0;
+
+	// Drain the thread cache first, refilling it with whole bundles from the global recycler
+	FPerThreadFreeBlockLists* Lists = GMallocBinned2PerThreadCaches ? FPerThreadFreeBlockLists::Get() : nullptr;
+	if (Lists)
+	{
+		do
+		{
+			while (NumAllocated < NumPtrs)
+			{
+				void* Result = Lists->Malloc(PoolIndex);
+				if (!Result)
+				{
+					break;
+				}
+				OutPtrs[NumAllocated++] = Result;
+			}
+		}
+		while (NumAllocated < NumPtrs && Lists->ObtainRecycledPartial(PoolIndex));
+	}
+
+	if (NumAllocated == NumPtrs)
+	{
+		return;
+	}
+
+	// Take the rest straight from the pools, under a single lock
+	FScopeLock Lock(&Mutex);
+	FPoolTable& Table = SmallPoolTables[PoolIndex];
+	while (NumAllocated < NumPtrs)
+	{
+		FPoolInfo* Pool;
+		if (!Table.ActivePools.IsEmpty())
+		{
+			Pool = &Table.ActivePools.GetFrontPool();
+		}
+		else
+		{
+			Pool = &Table.ActivePools.PushNewPoolToFront(*this, Table.BlockSize, PoolIndex);
+		}
+
+		while (NumAllocated < NumPtrs && Pool->HasFreeRegularBlock())
+		{
+			OutPtrs[NumAllocated++] = Pool->AllocateRegularBlock();
+		}
+		if (!Pool->HasFreeRegularBlock())
+		{
+			Table.ExhaustedPools.LinkToFront(Pool);
+		}
+	}
+}
+
+void FMallocBinned2::FreeBulk(void** Ptrs, int32 NumPtrs)
+{
+	// Bundles per pool that didn't fit into the thread cache, freed under a single lock at the end
+	FBundleNode* BundlesToFree[BINNED2_SMALL_POOL_COUNT] = {};
+	bool bHasBundlesToFree = false;
+
+	FPerThreadFreeBlockLists* Lists = GMallocBinned2PerThreadCaches ? FPerThreadFreeBlockLists::Get() : nullptr;
+	for (int32 Index = 0; Index < NumPtrs; Index++)
+	{
+		void* Ptr = Ptrs[Index];
+		if (IsOSAllocation(Ptr))
+		{
+			if (Ptr)
+			{
+				FreeExternal(Ptr);
+			}
+			continue;
+		}
+
+		FFreeBlock* BasePtr = GetPoolHeaderFromPointer(Ptr);
+		BasePtr->CanaryTest();
+		uint32 BlockSize = BasePtr->BlockSize;
+		uint32 PoolIndex = BasePtr->PoolIndex;
+
+		FBundleNode* Bundle = nullptr;
+		if (Lists)
+		{
+			if (Lists->Free(Ptr, PoolIndex, BlockSize))
+			{
+				continue;
+			}
+			Bundle = Lists->RecycleFullBundle(PoolIndex);
+			bool bPushed = Lists->Free(Ptr, PoolIndex, BlockSize);
+			check(bPushed);
+		}
+		else
+		{
+			Bundle = (FBundleNode*)Ptr;
+			Bundle->NextNodeInCurrentBundle = nullptr;
+		}
+
+		if (Bundle)
+		{
+			Bundle->NextBundle = BundlesToFree[PoolIndex];
+			BundlesToFree[PoolIndex] = Bundle;
+			bHasBundlesToFree = true;
+		}
+	}
+
+	if (bHasBundlesToFree)
+	{
+		FScopeLock Lock(&Mutex);
+		for (uint32 PoolIndex = 0; PoolIndex < BINNED2_SMALL_POOL_COUNT; PoolIndex++)
+		{
+			if (BundlesToFree[PoolIndex])
+			{
+				Private::FreeBundles(*this, BundlesToFree[PoolIndex], SmallPoolTables[PoolIndex].BlockSize, PoolIndex);
+			}
+		}
+	}
+}
+
 bool FMallocBinned2::GetAllocationSizeExternal(void* Ptr, SIZE_T& SizeOut)
 {
 	if (!IsOSAllocation(Ptr))
@@ -879,6 +1043,97 @@ const TCHAR* FMallocBinned2::GetDescriptiveName()
 	return TEXT("binned2");
 }
 
+FMallocBinned2::FPerThreadFreeBlockLists* FMallocBinned2::Private::RegisteredThreadCaches = nullptr;
+
+static void DumpBinned2ThreadCaches(FOutputDevice& Ar)
+{
+	if (FMallocBinned2::MallocBinned2)
+	{
+		FMallocBinned2::MallocBinned2->DumpAllocatorStats(Ar);
+	}
+	else
+	{
+		Ar.Logf(TEXT("FMallocBinned2 is not the active allocator."));
+	}
+}
+
+static FAutoConsoleCommandWithOutputDevice GMallocBinned2DumpThreadCachesCommand(
+	TEXT("MallocBinned2.DumpThreadCaches"),
+	TEXT("Lists the small blocks held by the per-thread caches of FMallocBinned2, per thread and per bin"),
+	FConsoleCommandWithOutputDeviceDelegate::CreateStatic(&DumpBinned2ThreadCaches)
+	);
+
+void FMallocBinned2::InitializeStatsMetadata()
+{
+	FMalloc::InitializeStatsMetadata();
+
+	// Initialize stats metadata here instead of UpdateStats, to avoid a dead-lock when the stats malloc profiler is enabled.
+	GET_STATFNAME(STAT_Binned2_ThreadCachedMemory);
+	GET_STATFNAME(STAT_Binned2_NumThreadCaches);
+	GET_STATFNAME(STAT_Binned2_NumThreadCacheTrims);
+}
+
+void FMallocBinned2::UpdateStats()
+{
+	FMalloc::UpdateStats();
+#if STATS
+	TArray<Private::FThreadCacheStats> ThreadCaches;
+	Private::GatherThreadCacheStats(ThreadCaches);
+
+	SIZE_T CachedMemory = 0;
+	uint32 NumTrims = 0;
+	for (const Private::FThreadCacheStats& ThreadCache : ThreadCaches)
+	{
+		for (uint32 PoolIndex = 0; PoolIndex < BINNED2_SMALL_POOL_COUNT; PoolIndex++)
+		{
+			CachedMemory += SIZE_T(ThreadCache.NumCachedBlocks[PoolIndex]) * PoolIndexToBlockSize(PoolIndex);
+		}
+		NumTrims += ThreadCache.NumTrims;
+	}
+	SET_MEMORY_STAT(STAT_Binned2_ThreadCachedMemory, CachedMemory);
+	SET_DWORD_STAT(STAT_Binned2_NumThreadCaches, ThreadCaches.Num());
+	SET_DWORD_STAT(STAT_Binned2_NumThreadCacheTrims, NumTrims);
+#endif
+}
+
+void FMallocBinned2::DumpAllocatorStats(class FOutputDevice& Ar)
+{
+	TArray<Private::FThreadCacheStats> ThreadCaches;
+	Private::GatherThreadCacheStats(ThreadCaches);
+
+	uint64 TotalPerBin[BINNED2_SMALL_POOL_COUNT] = { 0 };
+	uint64 TotalCachedMemory = 0;
+	Ar.Logf(TEXT("FMallocBinned2 thread caches: %d threads"), ThreadCaches.Num());
+	for (const Private::FThreadCacheStats& ThreadCache : ThreadCaches)
+	{
+		uint64 ThreadCachedMemory = 0;
+		for (uint32 PoolIndex = 0; PoolIndex < BINNED2_SMALL_POOL_COUNT; PoolIndex++)
+		{
+			uint64 BinMemory = uint64(ThreadCache.NumCachedBlocks[PoolIndex]) * PoolIndexToBlockSize(PoolIndex);
+			ThreadCachedMemory += BinMemory;
+			TotalPerBin[PoolIndex] += BinMemory;
+		}
+		TotalCachedMemory += ThreadCachedMemory;
+		Ar.Logf(TEXT("  Thread %6u: %8.1f KB cached, %u trims"), ThreadCache.ThreadId, double(ThreadCachedMemory) / 1024.0, ThreadCache.NumTrims);
+		for (uint32 PoolIndex = 0; PoolIndex < BINNED2_SMALL_POOL_COUNT; PoolIndex++)
+		{
+			if (ThreadCache.NumCachedBlocks[PoolIndex])
+			{
+				Ar.Logf(TEXT("      Bin %5u bytes: %6u blocks"), PoolIndexToBlockSize(PoolIndex), ThreadCache.NumCachedBlocks[PoolIndex]);
+			}
+		}
+	}
+	Ar.Logf(TEXT("  Per bin totals:"));
+	for (uint32 PoolIndex = 0; PoolIndex < BINNED2_SMALL_POOL_COUNT; PoolIndex++)
+	{
+		if (TotalPerBin[PoolIndex])
+		{
+			Ar.Logf(TEXT("      Bin %5u bytes: %8.1f KB"), PoolIndexToBlockSize(PoolIndex), double(TotalPerBin[PoolIndex]) / 1024.0);
+		}
+	}
+	Ar.Logf(TEXT("  Total cached: %.1f KB"), double(TotalCachedMemory) / 1024.0);
+}
+
 void FMallocBinned2::FlushCurrentThreadCache()
 {
 	FPerThreadFreeBlockLists* Lists = FPerThreadFreeBlockLists::Get();
@@ -942,6 +1197,16 @@ void FMallocBinned2::ClearAndDisableTLSCachesOnCurrentThread()
 	FPerThreadFreeBlockLists::ClearTLS();
 }
 
+void FMallocBinned2::TrimCurrentThreadCache()
+{
+	FPerThreadFreeBlockLists* Lists = FPerThreadFreeBlockLists::Get();
+	if (Lists)
+	{
+		FlushCurrentThreadCache();
+		Lists->NumTrims++;
+	}
+}
+
 
 bool FMallocBinned2::FFreeBlockList::ObtainPartial(uint32 InPoolIndex)
 {
@@ -1013,13 +1278,35 @@ void FMallocBinned2::FPerThreadFreeBlockLists::SetTLS()
 	{
 		ThreadSingleton = new (FPlatformMemory::BinnedAllocFromOS(Align(sizeof(FPerThreadFreeBlockLists), FMallocBinned2::OsAllocationGranularity))) FPerThreadFreeBlockLists();
 		FPlatformTLS::SetTlsValue(FMallocBinned2::Binned2TlsSlot, ThreadSingleton);
+
+		FScopeLock Lock(&FMallocBinned2::Private::GetThreadCacheRegistryLock());
+		ThreadSingleton->NextRegistered = FMallocBinned2::Private::RegisteredThreadCaches;
+		FMallocBinned2::Private::RegisteredThreadCaches = ThreadSingleton;
 	}
 }
 
 void FMallocBinned2::FPerThreadFreeBlockLists::ClearTLS()
 {
 	check(FMallocBinned2::Binned2TlsSlot);
+	FPerThreadFreeBlockLists* ThreadSingleton = (FPerThreadFreeBlockLists*)FPlatformTLS::GetTlsValue(FMallocBinned2::Binned2TlsSlot);
 	FPlatformTLS::SetTlsValue(FMallocBinned2::Binned2TlsSlot, nullptr);
+	if (ThreadSingleton)
+	{
+		{
+			FScopeLock Lock(&FMallocBinned2::Private::GetThreadCacheRegistryLock());
+			for (FPerThreadFreeBlockLists** Link = &FMallocBinned2::Private::RegisteredThreadCaches; *Link; Link = &(*Link)->NextRegistered)
+			{
+				if (*Link == ThreadSingleton)
+				{
+					*Link = ThreadSingleton->NextRegistered;
+					break;
+				}
+			}
+		}
+		// the caller flushed the cache already, nothing else can reach this now
+		ThreadSingleton->~FPerThreadFreeBlockLists();
+		FPlatformMemory::BinnedFreeToOS(ThreadSingleton, Align(sizeof(FPerThreadFreeBlockLists), FMallocBinned2::OsAllocationGranularity));
+	}
 }
 
 void FMallocBinned2::FFreeBlock::CanaryFail() const
@@ -129,6 +129,10 @@ public:
 	{
 		return UsedMalloc->ClearAndDisableTLSCachesOnCurrentThread();
 	}
+	virtual void TrimCurrentThreadCache() override
+	{
+		return UsedMalloc->TrimCurrentThreadCache();
+	}
 
 	virtual const TCHAR* GetDescriptiveName() override
 	{ 
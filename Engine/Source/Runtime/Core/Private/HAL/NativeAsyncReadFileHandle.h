@@ -0,0 +1,335 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	NativeAsyncReadFileHandle.h: Async read file handles serviced by the platform's native asynchronous file I/O.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Async/AsyncFileHandle.h"
+#include "Containers/Array.h"
+#include "Containers/UnrealString.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "Misc/ScopeLock.h"
+
+class FNativeAsyncReadFileHandle;
+
+/** Largest single read handed to the OS, bigger requests are issued as several consecutive reads */
+#define NATIVE_ASYNC_READ_MAX_CHUNK_SIZE (1024 * 1024 * 1024)
+
+/**
+ * @return false if -NoNativeAsyncIO is on the command line, in which case async reads use the generic thread pool implementation
+ */
+inline bool UseNativeAsyncReadFileHandles()
+{
+	static const bool bUseNative = !FParse::Param(FCommandLine::Get(), TEXT("NoNativeAsyncIO"));
+	return bUseNative;
+}
+
+/** Size request of a native handle, the size is known once the file is open so it completes right away. */
+class FNativeAsyncSizeRequest final : public IAsyncReadRequest
+{
+public:
+	FNativeAsyncSizeRequest(int64 FileSize, FAsyncFileCallBack* CompleteCallback)
+		: IAsyncReadRequest(CompleteCallback, true, nullptr)
+	{
+		Size = FileSize;
+		SetComplete();
+	}
+
+protected:
+	virtual void WaitCompletionImpl(float TimeLimitSeconds) override
+	{
+	}
+	virtual void CancelImpl() override
+	{
+	}
+};
+
+/**
+ * Read request of a native handle. The OS reads straight into the destination memory and the platform's completion
+ * thread reports back with OnReadComplete, there is no worker thread blocked on the read.
+ */
+class FNativeAsyncReadRequest final : public IAsyncReadRequest
+{
+	FNativeAsyncReadFileHandle* Owner;
+	int64 Offset;
+	int64 BytesToRead;
+	int64 BytesRead;
+	EAsyncIOPriority Priority;
+	/** Triggered once the request is complete and the callback was called */
+	FEvent* DoneEvent;
+	/** Guards PendingOperation, cancels come in from other threads than completions */
+	FCriticalSection PendingCritical;
+	/** Platform data of the read in flight, nullptr if there is none */
+	void* PendingOperation;
+
+public:
+	FNativeAsyncReadRequest(FNativeAsyncReadFileHandle* InOwner, FAsyncFileCallBack* CompleteCallback, uint8* UserSuppliedMemory, int64 InOffset, int64 InBytesToRead, EAsyncIOPriority InPriority)
+		: IAsyncReadRequest(CompleteCallback, false, UserSuppliedMemory)
+		, Owner(InOwner)
+		, Offset(InOffset)
+		, BytesToRead(InBytesToRead)
+		, BytesRead(0)
+		, Priority(InPriority)
+		, DoneEvent(FPlatformProcess::GetSynchEventFromPool(true))
+		, PendingOperation(nullptr)
+	{
+		check(Offset >= 0 && BytesToRead > 0);
+	}
+
+	virtual ~FNativeAsyncReadRequest();
+
+	/** Checks for precached data and otherwise issues the first read. */
+	void Start();
+
+	/**
+	 * Called by the platform's completion thread when a read issued for this request finished.
+	 * @param InBytesRead	Number of bytes the read returned
+	 * @param bSucceeded	false if the read failed or was canceled
+	 */
+	void OnReadComplete(int64 InBytesRead, bool bSucceeded);
+
+	/** @return a copy of the requested block if it is contained in this completed request, nullptr otherwise */
+	uint8* GetContainedSubblock(uint8* UserSuppliedMemory, int64 InOffset, int64 InBytesToRead)
+	{
+		if (InOffset >= Offset && InOffset + InBytesToRead <= Offset + BytesToRead &&
+			this->PollCompletion() && Memory)
+		{
+			if (!UserSuppliedMemory)
+			{
+				UserSuppliedMemory = (uint8*)FMemory::Malloc(InBytesToRead);
+				INC_MEMORY_STAT_BY(STAT_AsyncFileMemory, InBytesToRead);
+			}
+			FMemory::Memcpy(UserSuppliedMemory, Memory + InOffset - Offset, InBytesToRead);
+			return UserSuppliedMemory;
+		}
+		return nullptr;
+	}
+
+	EAsyncIOPriority GetPriority() const
+	{
+		return Priority;
+	}
+
+protected:
+	virtual void WaitCompletionImpl(float TimeLimitSeconds) override
+	{
+		if (TimeLimitSeconds <= 0.0f)
+		{
+			DoneEvent->Wait();
+		}
+		else
+		{
+			DoneEvent->Wait(FMath::Max<uint32>(uint32(TimeLimitSeconds * 1000.0f), 1));
+		}
+	}
+
+	virtual void CancelImpl() override;
+
+private:
+	void IssueNextRead();
+	void Finish(bool bSucceeded);
+};
+
+/**
+ * Base of the platform async read handles. Platforms open the file, provide its size and issue and cancel single reads,
+ * the request bookkeeping and the reuse of precached blocks matches FGenericAsyncReadFileHandle.
+ */
+class FNativeAsyncReadFileHandle : public IAsyncReadFileHandle
+{
+protected:
+	FString Filename;
+	int64 FileSize;
+
+	FCriticalSection LiveRequestsCritical;
+	/** Precache requests, later reads copy from them when they are contained */
+	TArray<FNativeAsyncReadRequest*> LiveRequests;
+
+public:
+	FNativeAsyncReadFileHandle(const TCHAR* InFilename, int64 InFileSize)
+		: Filename(InFilename)
+		, FileSize(InFileSize)
+	{
+	}
+
+	virtual ~FNativeAsyncReadFileHandle()
+	{
+		FScopeLock Lock(&LiveRequestsCritical);
+		check(!LiveRequests.Num()); // must delete all requests before you delete the handle
+	}
+
+	int64 GetFileSize() const
+	{
+		return FileSize;
+	}
+
+	/**
+	 * Queues a read, the platform calls Request->OnReadComplete from its completion thread when it is done.
+	 * @return the platform's data for the operation, or nullptr if it could not be queued and OnReadComplete will not be called
+	 */
+	virtual void* IssueRead(FNativeAsyncReadRequest* Request, uint8* Dest, int64 Offset, int64 Size) = 0;
+
+	/** Asks the OS to abort a queued read, it still completes through OnReadComplete. */
+	virtual void CancelRead(void* Operation) = 0;
+
+	virtual IAsyncReadRequest* SizeRequest(FAsyncFileCallBack* CompleteCallback = nullptr) override
+	{
+		return new FNativeAsyncSizeRequest(FileSize, CompleteCallback);
+	}
+
+	virtual IAsyncReadRequest* ReadRequest(int64 Offset, int64 BytesToRead, EAsyncIOPriority Priority = AIOP_Normal, FAsyncFileCallBack* CompleteCallback = nullptr, uint8* UserSuppliedMemory = nullptr) override
+	{
+		FNativeAsyncReadRequest* Result = new FNativeAsyncReadRequest(this, CompleteCallback, UserSuppliedMemory, Offset, BytesToRead, Priority);
+		if (Priority == AIOP_Precache) // only precache requests are tracked for possible reuse
+		{
+			FScopeLock Lock(&LiveRequestsCritical);
+			LiveRequests.Add(Result);
+		}
+		Result->Start();
+		return Result;
+	}
+
+	void RemoveRequest(FNativeAsyncReadRequest* Req)
+	{
+		FScopeLock Lock(&LiveRequestsCritical);
+		verify(LiveRequests.Remove(Req) == 1);
+	}
+
+	uint8* GetPrecachedBlock(uint8* UserSuppliedMemory, int64 InOffset, int64 InBytesToRead)
+	{
+		FScopeLock Lock(&LiveRequestsCritical);
+		uint8* Result = nullptr;
+		for (FNativeAsyncReadRequest* Req : LiveRequests)
+		{
+			Result = Req->GetContainedSubblock(UserSuppliedMemory, InOffset, InBytesToRead);
+			if (Result)
+			{
+				break;
+			}
+		}
+		return Result;
+	}
+};
+
+inline FNativeAsyncReadRequest::~FNativeAsyncReadRequest()
+{
+	// the completion thread triggers the event last, after that it doesn't touch the request anymore
+	DoneEvent->Wait();
+	FPlatformProcess::ReturnSynchEventToPool(DoneEvent);
+	DoneEvent = nullptr;
+
+	if (Memory)
+	{
+		// this can happen with a race on cancel, it is ok, they didn't take the memory, free it now
+		if (!bUserSuppliedMemory)
+		{
+			DEC_MEMORY_STAT_BY(STAT_AsyncFileMemory, BytesToRead);
+			FMemory::Free(Memory);
+		}
+		Memory = nullptr;
+	}
+	if (Priority == AIOP_Precache)
+	{
+		Owner->RemoveRequest(this);
+	}
+	Owner = nullptr;
+}
+
+inline void FNativeAsyncReadRequest::Start()
+{
+	if (Priority > AIOP_Precache) // only requests at higher than precache priority check for existing blocks to copy from
+	{
+		uint8* Result = Owner->GetPrecachedBlock(Memory, Offset, BytesToRead);
+		if (Result)
+		{
+			check(!bUserSuppliedMemory || Memory == Result);
+			Memory = Result;
+			Finish(true);
+			return;
+		}
+	}
+
+	if (BytesToRead == MAX_int64)
+	{
+		BytesToRead = Owner->GetFileSize() - Offset;
+	}
+	if (BytesToRead <= 0 || Offset + BytesToRead > Owner->GetFileSize())
+	{
+		Finish(false);
+		return;
+	}
+
+	if (!bUserSuppliedMemory)
+	{
+		check(!Memory);
+		Memory = (uint8*)FMemory::Malloc(BytesToRead);
+		INC_MEMORY_STAT_BY(STAT_AsyncFileMemory, BytesToRead);
+	}
+	IssueNextRead();
+}
+
+inline void FNativeAsyncReadRequest::IssueNextRead()
+{
+	bool bIssued = false;
+	if (!bCanceled)
+	{
+		// a fast completion blocks on the lock until the operation is recorded
+		FScopeLock Lock(&PendingCritical);
+		const int64 ChunkSize = FMath::Min<int64>(BytesToRead - BytesRead, NATIVE_ASYNC_READ_MAX_CHUNK_SIZE);
+		PendingOperation = Owner->IssueRead(this, Memory + BytesRead, Offset + BytesRead, ChunkSize);
+		bIssued = PendingOperation != nullptr;
+	}
+	if (!bIssued)
+	{
+		Finish(false);
+	}
+}
+
+inline void FNativeAsyncReadRequest::OnReadComplete(int64 InBytesRead, bool bSucceeded)
+{
+	{
+		FScopeLock Lock(&PendingCritical);
+		PendingOperation = nullptr;
+	}
+	if (bSucceeded && InBytesRead > 0)
+	{
+		BytesRead += InBytesRead;
+		if (BytesRead < BytesToRead)
+		{
+			// short read or a request bigger than a single OS read
+			IssueNextRead();
+			return;
+		}
+	}
+	Finish(bSucceeded && BytesRead == BytesToRead);
+}
+
+inline void FNativeAsyncReadRequest::CancelImpl()
+{
+	FScopeLock Lock(&PendingCritical);
+	if (PendingOperation)
+	{
+		Owner->CancelRead(PendingOperation);
+	}
+}
+
+inline void FNativeAsyncReadRequest::Finish(bool bSucceeded)
+{
+	if (!bSucceeded && Memory)
+	{
+		// failed reads return no data, same as the generic handle when the file can't be read
+		if (!bUserSuppliedMemory)
+		{
+			DEC_MEMORY_STAT_BY(STAT_AsyncFileMemory, BytesToRead);
+			FMemory::Free(Memory);
+		}
+		Memory = nullptr;
+	}
+	SetComplete();
+	DoneEvent->Trigger();
+}
@@ -12,11 +12,42 @@
 #include "Misc/ConfigCacheIni.h"
 #include "Misc/CommandLine.h"
 #include "HAL/ExceptionHandling.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "ProfilingDebugging/FrameTrace.h"
 
 #ifndef UE_ASSERT_ON_HANG
 #define UE_ASSERT_ON_HANG 0
 #endif
 
+static float GHitchDetectionThresholdMS = 0.0f;
+static FAutoConsoleVariableRef CVarHitchDetectionThresholdMS(
+	TEXT("t.HitchDetection.ThresholdMS"),
+	GHitchDetectionThresholdMS,
+	TEXT("Game thread frames taking longer than this many milliseconds get their game and render thread stacks sampled and written to Saved/Profiling/Hitches.\n")
+	TEXT("0 disables hitch detection (default). Can also be set with -hitchdetection=<ms>."));
+
+static float GHitchDetectionSampleIntervalMS = 10.0f;
+static FAutoConsoleVariableRef CVarHitchDetectionSampleIntervalMS(
+	TEXT("t.HitchDetection.SampleIntervalMS"),
+	GHitchDetectionSampleIntervalMS,
+	TEXT("Milliseconds between two stack samples of a hitching frame."));
+
+static int32 GHitchDetectionMaxSamples = 100;
+static FAutoConsoleVariableRef CVarHitchDetectionMaxSamples(
+	TEXT("t.HitchDetection.MaxSamples"),
+	GHitchDetectionMaxSamples,
+	TEXT("Maximum number of stack samples taken per hitch. The capture is written once the frame ends or all samples are taken."));
+
+static float GHitchDetectionCooldown = 10.0f;
+static FAutoConsoleVariableRef CVarHitchDetectionCooldown(
+	TEXT("t.HitchDetection.Cooldown"),
+	GHitchDetectionCooldown,
+	TEXT("Minimum number of seconds between two hitch captures."));
+
 FThreadHeartBeat::FThreadHeartBeat()
 	: Thread(nullptr)
 	, bReadyToCheckHeartbeat(false)
@@ -278,3 +309,291 @@ bool FThreadHeartBeat::IsBeating()
 
 	return false;
 }
+
+
+FGameThreadHitchHeartBeat::FGameThreadHitchHeartBeat()
+	: Thread(nullptr)
+	, FrameStartTime(0.0)
+	, FrameCounter(0)
+	, LastCaptureTime(0.0)
+{
+	float ThresholdMS = 0.0f;
+	if (FParse::Value(FCommandLine::Get(), TEXT("hitchdetection="), ThresholdMS))
+	{
+		GHitchDetectionThresholdMS = ThresholdMS;
+	}
+
+	// Same as the hang detection, programs don't get the extra thread
+#if !IS_PROGRAM
+	if (FPlatformProcess::SupportsMultithreading())
+	{
+		// Above normal so the stacks still get sampled while the hitch keeps all cores busy
+		Thread = FRunnableThread::Create(this, TEXT("FGameThreadHitchHeartBeatThread"), 0, TPri_AboveNormal);
+	}
+#endif
+}
+
+FGameThreadHitchHeartBeat::~FGameThreadHitchHeartBeat()
+{
+	delete Thread;
+	Thread = nullptr;
+}
+
+FGameThreadHitchHeartBeat* FGameThreadHitchHeartBeat::Singleton = nullptr;
+
+FGameThreadHitchHeartBeat& FGameThreadHitchHeartBeat::Get()
+{
+	struct FInitHelper
+	{
+		FGameThreadHitchHeartBeat* Instance;
+
+		FInitHelper()
+		{
+			check(!Singleton);
+			Instance = new FGameThreadHitchHeartBeat();
+			Singleton = Instance;
+		}
+
+		~FInitHelper()
+		{
+			Singleton = nullptr;
+
+			delete Instance;
+			Instance = nullptr;
+		}
+	};
+
+	static FInitHelper Helper;
+	return *Helper.Instance;
+}
+
+FGameThreadHitchHeartBeat* FGameThreadHitchHeartBeat::GetNoInit()
+{
+	return Singleton;
+}
+
+double FGameThreadHitchHeartBeat::GetHitchThreshold() const
+{
+	return Thread ? FMath::Max(GHitchDetectionThresholdMS, 0.0f) / 1000.0 : 0.0;
+}
+
+void FGameThreadHitchHeartBeat::FrameStart(bool bSkipThisFrame)
+{
+	check(IsInGameThread());
+
+	FScopeLock FrameLock(&FrameCritical);
+	FrameStartTime = bSkipThisFrame ? 0.0 : FPlatformTime::Seconds();
+	++FrameCounter;
+}
+
+bool FGameThreadHitchHeartBeat::Init()
+{
+	return true;
+}
+
+uint32 FGameThreadHitchHeartBeat::Run()
+{
+	while (StopTaskCounter.GetValue() == 0)
+	{
+		const double HitchThreshold = GetHitchThreshold();
+		if (HitchThreshold > 0.0)
+		{
+			double StartTime;
+			uint32 HitchFrameCounter;
+			{
+				FScopeLock FrameLock(&FrameCritical);
+				StartTime = FrameStartTime;
+				HitchFrameCounter = FrameCounter;
+			}
+
+			const double CurrentTime = FPlatformTime::Seconds();
+			const bool bCoolingDown = LastCaptureTime > 0.0 && CurrentTime - LastCaptureTime < GHitchDetectionCooldown;
+
+			if (StartTime > 0.0
+				&& CurrentTime - StartTime > HitchThreshold
+				&& !bCoolingDown
+				&& !GIsRequestingExit
+				&& !FPlatformMisc::IsDebuggerPresent())
+			{
+				CaptureHitch(StartTime, HitchFrameCounter);
+				LastCaptureTime = FPlatformTime::Seconds();
+			}
+		}
+
+		// Check a few times per threshold so the first sample is taken close to when the frame crosses it
+		FPlatformProcess::SleepNoStats(HitchThreshold > 0.0 ? FMath::Clamp(HitchThreshold * 0.25, 0.001, 0.1) : 0.5);
+	}
+
+	return 0;
+}
+
+void FGameThreadHitchHeartBeat::Stop()
+{
+	StopTaskCounter.Increment();
+}
+
+void FGameThreadHitchHeartBeat::SampleThread(uint32 ThreadId, TArray<FStackSample>& Samples, ANSICHAR* StackTrace, SIZE_T StackTraceSize)
+{
+	StackTrace[0] = 0;
+	FPlatformStackWalk::ThreadStackWalkAndDump(StackTrace, StackTraceSize, 0, ThreadId);
+
+	const uint32 CallstackCRC = FCrc::StrCrc32(StackTrace);
+	for (FStackSample& Sample : Samples)
+	{
+		if (Sample.CRC == CallstackCRC)
+		{
+			++Sample.Count;
+			return;
+		}
+	}
+
+	FStackSample& Sample = Samples[Samples.AddDefaulted()];
+	Sample.CRC = CallstackCRC;
+	Sample.Stack = FString(StackTrace);
+	Sample.Count = 1;
+}
+
+/** Returns the frame trace scopes that are still open at the end of the thread's events, outermost first */
+static FString GetOpenFrameTraceScopes(const TArray<FFrameTraceThreadEvents>& ThreadEvents, uint32 ThreadId)
+{
+	TArray<uint32> OpenScopes;
+	for (const FFrameTraceThreadEvents& Thread : ThreadEvents)
+	{
+		if (Thread.ThreadId != ThreadId)
+		{
+			continue;
+		}
+
+		for (const FFrameTraceEvent& Event : Thread.Events)
+		{
+			if (Event.Type == EFrameTraceEventType::BeginScope)
+			{
+				OpenScopes.Push(Event.ScopeId);
+			}
+			else if (Event.Type == EFrameTraceEventType::EndScope && OpenScopes.Num())
+			{
+				// Scopes that began before the gathered window end without a matching begin
+				OpenScopes.Pop(false);
+			}
+		}
+	}
+
+	FString Result;
+	for (uint32 ScopeId : OpenScopes)
+	{
+		Result += FString::Printf(TEXT("  %s%s"), FFrameTrace::GetScopeName(ScopeId), LINE_TERMINATOR);
+	}
+	return Result;
+}
+
+void FGameThreadHitchHeartBeat::AppendThreadToReport(FString& Report, const TCHAR* ThreadName, const FString& OpenScopes, const TArray<FStackSample>& Samples, int32 NumSamples)
+{
+	Report += LINE_TERMINATOR;
+	if (OpenScopes.Len())
+	{
+		Report += FString::Printf(TEXT("Open trace scopes on %s when the hitch was detected:%s"), ThreadName, LINE_TERMINATOR);
+		Report += OpenScopes;
+	}
+
+	Report += FString::Printf(TEXT("%d distinct callstacks of %s in %d samples:%s"), Samples.Num(), ThreadName, NumSamples, LINE_TERMINATOR);
+	for (const FStackSample& Sample : Samples)
+	{
+		TArray<FString> StackLines;
+		Sample.Stack.ParseIntoArrayLines(StackLines);
+
+		Report += FString::Printf(TEXT("  %d samples:%s"), Sample.Count, LINE_TERMINATOR);
+		for (const FString& StackLine : StackLines)
+		{
+			Report += FString::Printf(TEXT("    %s%s"), *StackLine, LINE_TERMINATOR);
+		}
+	}
+}
+
+void FGameThreadHitchHeartBeat::CaptureHitch(double StartTime, uint32 HitchFrameCounter)
+{
+	const uint32 GameThreadId = GGameThreadId;
+	const uint32 RenderThreadId = (GRenderThreadId != 0 && GRenderThreadId != GGameThreadId) ? GRenderThreadId : 0;
+
+	// The scopes that are open right now, only recorded while trace.Enabled is set
+	TArray<FFrameTraceThreadEvents> ThreadEvents;
+	if (FFrameTrace::IsEnabled())
+	{
+		// Render thread scopes may have started before the game thread frame did
+		FFrameTrace::GatherEvents(FPlatformTime::Seconds() - StartTime + 1.0, ThreadEvents);
+	}
+	const FString GameThreadScopes = GetOpenFrameTraceScopes(ThreadEvents, GameThreadId);
+	const FString RenderThreadScopes = RenderThreadId ? GetOpenFrameTraceScopes(ThreadEvents, RenderThreadId) : FString();
+
+	const SIZE_T StackTraceSize = 65535;
+	ANSICHAR* StackTrace = (ANSICHAR*)GMalloc->Malloc(StackTraceSize);
+
+	TArray<FStackSample> GameThreadSamples;
+	TArray<FStackSample> RenderThreadSamples;
+	const int32 MaxSamples = FMath::Max(GHitchDetectionMaxSamples, 1);
+	const float SampleInterval = FMath::Max(GHitchDetectionSampleIntervalMS, 1.0f) / 1000.0f;
+
+	int32 NumSamples = 0;
+	bool bFrameEnded = false;
+	double EndTime = 0.0;
+
+	while (NumSamples < MaxSamples && StopTaskCounter.GetValue() == 0)
+	{
+		{
+			FScopeLock FrameLock(&FrameCritical);
+			if (FrameCounter != HitchFrameCounter)
+			{
+				bFrameEnded = true;
+				EndTime = FrameStartTime;
+			}
+		}
+
+		if (bFrameEnded)
+		{
+			break;
+		}
+
+		SampleThread(GameThreadId, GameThreadSamples, StackTrace, StackTraceSize);
+		if (RenderThreadId)
+		{
+			SampleThread(RenderThreadId, RenderThreadSamples, StackTrace, StackTraceSize);
+		}
+		++NumSamples;
+
+		FPlatformProcess::SleepNoStats(SampleInterval);
+	}
+
+	GMalloc->Free(StackTrace);
+
+	// Skipped frames don't have a start time, and frames still running after the last sample only have a lower bound
+	if (!bFrameEnded || EndTime == 0.0)
+	{
+		EndTime = FPlatformTime::Seconds();
+	}
+
+	const double HitchMS = (EndTime - StartTime) * 1000.0;
+	const double ThresholdMS = GetHitchThreshold() * 1000.0;
+
+	GameThreadSamples.Sort([](const FStackSample& A, const FStackSample& B) { return A.Count > B.Count; });
+	RenderThreadSamples.Sort([](const FStackSample& A, const FStackSample& B) { return A.Count > B.Count; });
+
+	FString Report = FString::Printf(TEXT("Hitch of %s%.1f ms on the game thread (threshold %.1f ms), %d samples every %.1f ms, frame %u%s"),
+		bFrameEnded ? TEXT("") : TEXT("at least "), HitchMS, ThresholdMS, NumSamples, SampleInterval * 1000.0f, HitchFrameCounter, LINE_TERMINATOR);
+
+	AppendThreadToReport(Report, TEXT("GameThread"), GameThreadScopes, GameThreadSamples, NumSamples);
+	if (RenderThreadId)
+	{
+		AppendThreadToReport(Report, TEXT("RenderThread"), RenderThreadScopes, RenderThreadSamples, NumSamples);
+	}
+
+	const FString Filename = FPaths::ProfilingDir() / TEXT("Hitches") / FString::Printf(TEXT("Hitch-%s.txt"), *FDateTime::Now().ToString());
+	if (FFileHelper::SaveStringToFile(Report, *Filename))
+	{
+		UE_LOG(LogCore, Warning, TEXT("Hitch of %s%.1f ms detected on the game thread, wrote %d stack samples to %s"), bFrameEnded ? TEXT("") : TEXT("at least "), HitchMS, NumSamples, *Filename);
+	}
+	else
+	{
+		UE_LOG(LogCore, Warning, TEXT("Hitch of %s%.1f ms detected on the game thread, failed to write %s"), bFrameEnded ? TEXT("") : TEXT("at least "), HitchMS, *Filename);
+	}
+
+	OnHitchCaptured.Broadcast(Filename, Report);
+}
@@ -6,6 +6,8 @@
 #include "Stats/Stats.h"
 #include "Misc/CoreStats.h"
 #include "Misc/EventPool.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/OutputDevice.h"
 
 DEFINE_STAT( STAT_EventWaitWithId );
 DEFINE_STAT( STAT_EventTriggerWithId );
@@ -525,6 +527,15 @@ public:
 };
 
 
+/** Number of times in a row a non-empty queue can be passed over for higher priority work before it gets a job started. */
+static int32 GThreadPoolStarvationLimit = 16;
+static FAutoConsoleVariableRef CVarThreadPoolStarvationLimit(
+	TEXT("ThreadPool.StarvationLimit"),
+	GThreadPoolStarvationLimit,
+	TEXT("Number of jobs a thread pool starts from higher priority queues while a lower priority queue is waiting, before it starts one job from the lower priority queue.\n")
+	TEXT("0 means strict priorities, lower priority work only runs when all higher priority queues are empty.")
+	);
+
 /**
  * Implementation of a queued thread pool.
  */
@@ -532,15 +543,48 @@ class FQueuedThreadPoolBase : public FQueuedThreadPool
 {
 protected:
 
-	/** The work queue to pull from. */
-	TArray<IQueuedWork*> QueuedWork;
-	
+	/** Work waiting in one of the queues. */
+	struct FQueuedWorkEntry
+	{
+		/** The work to do. */
+		IQueuedWork* Work;
+
+		/** FPlatformTime::Seconds() when the work was queued. */
+		double QueuedTime;
+
+		FQueuedWorkEntry(IQueuedWork* InWork, double InQueuedTime)
+			: Work(InWork)
+			, QueuedTime(InQueuedTime)
+		{ }
+	};
+
+	/** The work queues to pull from, one per priority, oldest work first. */
+	TArray<FQueuedWorkEntry> QueuedWork[(int32)EQueuedWorkPriority::Count];
+
+	/** Number of jobs started from higher priority queues since each queue last got a job started, while it had work waiting. */
+	int32 NumTimesPassedOver[(int32)EQueuedWorkPriority::Count];
+
+	/** Counters of each queue. */
+	FQueuedThreadPoolQueueStats QueueStats[(int32)EQueuedWorkPriority::Count];
+
 	/** The thread pool to dole work out to. */
 	TArray<FQueuedThread*> QueuedThreads;
 
-	/** All threads in the pool. */
+	/** Threads that left the pool because it was shrunk while they were busy. They are idle and are reused or killed on the next resize. */
+	TArray<FQueuedThread*> RetiredThreads;
+
+	/** All threads in the pool, including the retired ones. */
 	TArray<FQueuedThread*> AllThreads;
 
+	/** The number of threads the pool should have. */
+	int32 DesiredNumThreads;
+
+	/** Stack size new threads are created with. */
+	uint32 ThreadStackSize;
+
+	/** Priority new threads are created with. */
+	EThreadPriority ThreadPriority;
+
 	/** The synchronization object used to protect access to the queued work. */
 	FCriticalSection* SynchQueue;
 
@@ -551,9 +595,14 @@ public:
 
 	/** Default constructor. */
 	FQueuedThreadPoolBase()
-		: SynchQueue(nullptr)
+		: DesiredNumThreads(0)
+		, ThreadStackSize(0)
+		, ThreadPriority(TPri_Normal)
+		, SynchQueue(nullptr)
 		, TimeToDie(0)
-	{ }
+	{
+		FMemory::Memzero(NumTimesPassedOver);
+	}
 
 	/** Virtual destructor (cleans up the synchronization objects). */
 	virtual ~FQueuedThreadPoolBase()
@@ -561,7 +610,7 @@ public:
 		Destroy();
 	}
 
-	virtual bool Create(uint32 InNumQueuedThreads,uint32 StackSize = (32 * 1024),EThreadPriority ThreadPriority=TPri_Normal) override
+	virtual bool Create(uint32 InNumQueuedThreads,uint32 StackSize = (32 * 1024),EThreadPriority InThreadPriority=TPri_Normal) override
 	{
 		// Make sure we have synch objects
 		bool bWasSuccessful = true;
@@ -578,23 +627,15 @@ public:
 			StackSize = OverrideStackSize;
 		}
 
+		// Remember how threads are created, so the pool can grow later
+		ThreadStackSize = StackSize;
+		ThreadPriority = InThreadPriority;
+		DesiredNumThreads = (int32)InNumQueuedThreads;
+
 		// Now create each thread and add it to the array
 		for (uint32 Count = 0; Count < InNumQueuedThreads && bWasSuccessful == true; Count++)
 		{
-			// Create a new queued thread
-			FQueuedThread* pThread = new FQueuedThread();
-			// Now create the thread and add it if ok
-			if (pThread->Create(this,StackSize,ThreadPriority) == true)
-			{
-				QueuedThreads.Add(pThread);
-				AllThreads.Add(pThread);
-			}
-			else
-			{
-				// Failed to fully create so clean up
-				bWasSuccessful = false;
-				delete pThread;
-			}
+			bWasSuccessful = CreateThread() != nullptr;
 		}
 		// Destroy any created threads if the full set was not successful
 		if (bWasSuccessful == false)
@@ -613,19 +654,23 @@ public:
 				TimeToDie = 1;
 				FPlatformMisc::MemoryBarrier();
 				// Clean up all queued objects
-				for (int32 Index = 0; Index < QueuedWork.Num(); Index++)
+				for (int32 PriorityIndex = 0; PriorityIndex < (int32)EQueuedWorkPriority::Count; PriorityIndex++)
 				{
-					QueuedWork[Index]->Abandon();
+					for (int32 Index = 0; Index < QueuedWork[PriorityIndex].Num(); Index++)
+					{
+						QueuedWork[PriorityIndex][Index].Work->Abandon();
+					}
+					// Empty out the invalid pointers
+					QueuedWork[PriorityIndex].Empty();
+					QueueStats[PriorityIndex].NumQueued = 0;
 				}
-				// Empty out the invalid pointers
-				QueuedWork.Empty();
 			}
 			// wait for all threads to finish up
 			while (1)
 			{
 				{
 					FScopeLock Lock(SynchQueue);
-					if (AllThreads.Num() == QueuedThreads.Num())
+					if (AllThreads.Num() == QueuedThreads.Num() + RetiredThreads.Num())
 					{
 						break;
 					}
@@ -642,6 +687,7 @@ public:
 					delete AllThreads[Index];
 				}
 				QueuedThreads.Empty();
+				RetiredThreads.Empty();
 				AllThreads.Empty();
 			}
 			delete SynchQueue;
@@ -653,13 +699,18 @@ public:
 	{
 		// this is a estimate of the number of queued jobs. 
 		// no need for thread safe lock as the queuedWork array isn't moved around in memory so unless this class is being destroyed then we don't need to wrory about it
-		return QueuedWork.Num();
+		int32 NumQueuedJobs = 0;
+		for (int32 PriorityIndex = 0; PriorityIndex < (int32)EQueuedWorkPriority::Count; PriorityIndex++)
+		{
+			NumQueuedJobs += QueuedWork[PriorityIndex].Num();
+		}
+		return NumQueuedJobs;
 	}
 	virtual int32 GetNumThreads() const 
 	{
-		return AllThreads.Num();
+		return AllThreads.Num() - RetiredThreads.Num();
 	}
-	void AddQueuedWork(IQueuedWork* InQueuedWork) override
+	void AddQueuedWork(IQueuedWork* InQueuedWork, EQueuedWorkPriority InPriority = EQueuedWorkPriority::Normal) override
 	{
 		if (TimeToDie)
 		{
@@ -667,11 +718,13 @@ public:
 			return;
 		}
 		check(InQueuedWork != nullptr);
+		check(InPriority < EQueuedWorkPriority::Count);
 		FQueuedThread* Thread = nullptr;
 		// Check to see if a thread is available. Make sure no other threads
 		// can manipulate the thread pool while we do this.
 		check(SynchQueue);
 		FScopeLock sl(SynchQueue);
+		FQueuedThreadPoolQueueStats& Stats = QueueStats[(int32)InPriority];
 		if (QueuedThreads.Num() > 0)
 		{
 			// Cycle through all available threads to make sure that stats are up to date.
@@ -685,13 +738,16 @@ public:
 		if (Thread != nullptr)
 		{
 			// We have a thread, so tell it to do the work
+			Stats.NumStarted++;
 			Thread->DoWork(InQueuedWork);
 		}
 		else
 		{
 			// There were no threads available, queue the work to be done
 			// as soon as one does become available
-			QueuedWork.Add(InQueuedWork);
+			QueuedWork[(int32)InPriority].Add(FQueuedWorkEntry(InQueuedWork, FPlatformTime::Seconds()));
+			Stats.NumQueued = QueuedWork[(int32)InPriority].Num();
+			Stats.PeakQueued = FMath::Max(Stats.PeakQueued, Stats.NumQueued);
 		}
 	}
 
@@ -704,7 +760,17 @@ public:
 		check(InQueuedWork != nullptr);
 		check(SynchQueue);
 		FScopeLock sl(SynchQueue);
-		return !!QueuedWork.RemoveSingle(InQueuedWork);
+		for (int32 PriorityIndex = 0; PriorityIndex < (int32)EQueuedWorkPriority::Count; PriorityIndex++)
+		{
+			const int32 Index = QueuedWork[PriorityIndex].IndexOfByPredicate([InQueuedWork](const FQueuedWorkEntry& Entry) { return Entry.Work == InQueuedWork; });
+			if (Index != INDEX_NONE)
+			{
+				QueuedWork[PriorityIndex].RemoveAt(Index);
+				QueueStats[PriorityIndex].NumQueued = QueuedWork[PriorityIndex].Num();
+				return true;
+			}
+		}
+		return false;
 	}
 
 	virtual IQueuedWork* ReturnToPoolOrGetNextJob(FQueuedThread* InQueuedThread) override
@@ -715,17 +781,15 @@ public:
 		FScopeLock sl(SynchQueue);
 		if (TimeToDie)
 		{
-			check(!QueuedWork.Num());  // we better not have anything if we are dying
+			check(!GetNumQueuedJobs());  // we better not have anything if we are dying
 		}
-		if (QueuedWork.Num() > 0)
+		if (GetNumThreads() > DesiredNumThreads)
 		{
-			// Grab the oldest work in the queue. This is slower than
-			// getting the most recent but prevents work from being
-			// queued and never done
-			Work = QueuedWork[0];
-			// Remove it from the list so no one else grabs it
-			QueuedWork.RemoveAt(0);
+			// The pool was shrunk while this thread was busy, park it instead of giving it more work
+			RetiredThreads.Add(InQueuedThread);
+			return nullptr;
 		}
+		Work = DequeueWork();
 		if (!Work)
 		{
 			// There was no work to be done, so add the thread to the pool
@@ -733,6 +797,159 @@ public:
 		}
 		return Work;
 	}
+
+	virtual bool SetNumThreads(uint32 InNumQueuedThreads) override
+	{
+		check(InNumQueuedThreads > 0);
+		check(SynchQueue);
+
+		TArray<FQueuedThread*> ThreadsToKill;
+		{
+			FScopeLock Lock(SynchQueue);
+			if (TimeToDie)
+			{
+				return false;
+			}
+			DesiredNumThreads = (int32)InNumQueuedThreads;
+
+			// Bring back retired threads first, they are already running
+			while (GetNumThreads() < DesiredNumThreads && RetiredThreads.Num() > 0)
+			{
+				StartOrPoolThread(RetiredThreads.Pop(false));
+			}
+			while (GetNumThreads() < DesiredNumThreads)
+			{
+				FQueuedThread* Thread = CreateThread();
+				if (!Thread)
+				{
+					return false;
+				}
+				QueuedThreads.Remove(Thread);
+				StartOrPoolThread(Thread);
+			}
+
+			// Remove idle threads, busy threads retire themselves when they are done
+			ThreadsToKill = MoveTemp(RetiredThreads);
+			while (GetNumThreads() > DesiredNumThreads && QueuedThreads.Num() > 0)
+			{
+				ThreadsToKill.Add(QueuedThreads.Pop(false));
+			}
+			for (FQueuedThread* Thread : ThreadsToKill)
+			{
+				AllThreads.Remove(Thread);
+			}
+		}
+
+		// Threads are waited for outside of the lock, they only ever wait for their work event now
+		for (FQueuedThread* Thread : ThreadsToKill)
+		{
+			Thread->KillThread();
+			delete Thread;
+		}
+		return true;
+	}
+
+	virtual FQueuedThreadPoolQueueStats GetQueueStats(EQueuedWorkPriority InPriority) const override
+	{
+		check(InPriority < EQueuedWorkPriority::Count);
+		check(SynchQueue);
+		FScopeLock sl(SynchQueue);
+		return QueueStats[(int32)InPriority];
+	}
+
+protected:
+
+	/**
+	 * Creates a thread and adds it to the idle threads. The lock must be held.
+	 *
+	 * @return The new thread, or nullptr if it could not be created
+	 */
+	FQueuedThread* CreateThread()
+	{
+		// Create a new queued thread
+		FQueuedThread* pThread = new FQueuedThread();
+		// Now create the thread and add it if ok
+		if (pThread->Create(this,ThreadStackSize,ThreadPriority) == true)
+		{
+			QueuedThreads.Add(pThread);
+			AllThreads.Add(pThread);
+			return pThread;
+		}
+		// Failed to fully create so clean up
+		delete pThread;
+		return nullptr;
+	}
+
+	/** Gives an idle thread that is not in QueuedThreads the next job, or puts it in QueuedThreads if there is none. The lock must be held. */
+	void StartOrPoolThread(FQueuedThread* Thread)
+	{
+		if (IQueuedWork* Work = DequeueWork())
+		{
+			Thread->DoWork(Work);
+		}
+		else
+		{
+			QueuedThreads.Add(Thread);
+		}
+	}
+
+	/**
+	 * Takes the next job to start off the queues. The lock must be held.
+	 *
+	 * Normally this is the oldest job of the highest priority queue that has any. A lower priority queue that
+	 * has been passed over GThreadPoolStarvationLimit times in a row gets its oldest job started instead.
+	 *
+	 * @return The job, or nullptr if all queues are empty
+	 */
+	IQueuedWork* DequeueWork()
+	{
+		int32 PickedPriority = INDEX_NONE;
+		bool bPromoted = false;
+		for (int32 PriorityIndex = 0; PriorityIndex < (int32)EQueuedWorkPriority::Count; PriorityIndex++)
+		{
+			if (QueuedWork[PriorityIndex].Num() == 0)
+			{
+				continue;
+			}
+			if (PickedPriority == INDEX_NONE)
+			{
+				PickedPriority = PriorityIndex;
+			}
+			else if (GThreadPoolStarvationLimit > 0 && NumTimesPassedOver[PriorityIndex] >= GThreadPoolStarvationLimit)
+			{
+				PickedPriority = PriorityIndex;
+				bPromoted = true;
+				break;
+			}
+		}
+		if (PickedPriority == INDEX_NONE)
+		{
+			return nullptr;
+		}
+
+		// Every queue behind the picked one that still has work waiting was passed over once more
+		NumTimesPassedOver[PickedPriority] = 0;
+		for (int32 PriorityIndex = PickedPriority + 1; PriorityIndex < (int32)EQueuedWorkPriority::Count; PriorityIndex++)
+		{
+			NumTimesPassedOver[PriorityIndex] = QueuedWork[PriorityIndex].Num() > 0 ? NumTimesPassedOver[PriorityIndex] + 1 : 0;
+		}
+
+		// Grab the oldest work in the queue. This is slower than
+		// getting the most recent but prevents work from being
+		// queued and never done
+		const FQueuedWorkEntry Entry = QueuedWork[PickedPriority][0];
+		// Remove it from the list so no one else grabs it
+		QueuedWork[PickedPriority].RemoveAt(0);
+
+		const double WaitTime = FPlatformTime::Seconds() - Entry.QueuedTime;
+		FQueuedThreadPoolQueueStats& Stats = QueueStats[PickedPriority];
+		Stats.NumQueued = QueuedWork[PickedPriority].Num();
+		Stats.NumStarted++;
+		Stats.NumPromoted += bPromoted ? 1 : 0;
+		Stats.TotalWaitTime += WaitTime;
+		Stats.MaxWaitTime = FMath::Max(Stats.MaxWaitTime, WaitTime);
+		return Entry.Work;
+	}
 };
 
 uint32 FQueuedThreadPool::OverrideStackSize = 0;
@@ -742,6 +959,47 @@ FQueuedThreadPool* FQueuedThreadPool::Allocate()
 	return new FQueuedThreadPoolBase;
 }
 
+/** Logs the queue counters of a pool. */
+static void DumpThreadPoolQueueStats(const TCHAR* PoolName, FQueuedThreadPool* Pool, FOutputDevice& Ar)
+{
+	if (!Pool)
+	{
+		return;
+	}
+
+	static const TCHAR* PriorityNames[] = { TEXT("Highest"), TEXT("High"), TEXT("Normal"), TEXT("Low"), TEXT("Lowest") };
+	static_assert(ARRAY_COUNT(PriorityNames) == (int32)EQueuedWorkPriority::Count, "PriorityNames must match EQueuedWorkPriority");
+
+	Ar.Logf(TEXT("%s: %d threads"), PoolName, Pool->GetNumThreads());
+	for (int32 PriorityIndex = 0; PriorityIndex < (int32)EQueuedWorkPriority::Count; PriorityIndex++)
+	{
+		const FQueuedThreadPoolQueueStats Stats = Pool->GetQueueStats((EQueuedWorkPriority)PriorityIndex);
+		Ar.Logf(TEXT("  %-8s %6d queued, %6d peak, %10llu started, %8llu promoted, %8.3f ms average wait, %8.3f ms max wait"),
+			PriorityNames[PriorityIndex],
+			Stats.NumQueued,
+			Stats.PeakQueued,
+			Stats.NumStarted,
+			Stats.NumPromoted,
+			Stats.NumStarted ? Stats.TotalWaitTime * 1000.0 / Stats.NumStarted : 0.0,
+			Stats.MaxWaitTime * 1000.0);
+	}
+}
+
+static void DumpThreadPoolStats(FOutputDevice& Ar)
+{
+	DumpThreadPoolQueueStats(TEXT("GThreadPool"), GThreadPool, Ar);
+	DumpThreadPoolQueueStats(TEXT("GIOThreadPool"), GIOThreadPool, Ar);
+#if WITH_EDITOR
+	DumpThreadPoolQueueStats(TEXT("GLargeThreadPool"), GLargeThreadPool, Ar);
+#endif
+}
+
+static FAutoConsoleCommandWithOutputDevice GDumpThreadPoolStatsCmd(
+	TEXT("ThreadPool.DumpStats"),
+	TEXT("Logs the number of threads and the counters of each priority queue of the global thread pools."),
+	FConsoleCommandWithOutputDeviceDelegate::CreateStatic(&DumpThreadPoolStats)
+	);
+
 
 /*-----------------------------------------------------------------------------
 	FThreadSingletonInitializer
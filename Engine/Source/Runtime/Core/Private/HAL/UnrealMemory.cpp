@@ -23,6 +23,7 @@
 #include "HAL/MallocLeakDetection.h"
 #include "HAL/PlatformMallocCrash.h"
 #include "HAL/MallocPoisonProxy.h"
+#include "HAL/LowLevelMemTracker.h"
 
 #if MALLOC_GT_HOOKS
 
@@ -208,6 +209,10 @@ public:
 	{
 		return UsedMalloc->ClearAndDisableTLSCachesOnCurrentThread();
 	}
+	virtual void TrimCurrentThreadCache() override
+	{
+		return UsedMalloc->TrimCurrentThreadCache();
+	}
 	virtual const TCHAR* GetDescriptiveName() override
 	{
 		return UsedMalloc->GetDescriptiveName();
@@ -342,6 +347,11 @@ void FMemory::GCreateMalloc()
 		GMalloc = new FMallocThreadSafeProxy( GMalloc );
 	}
 
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+	// Attribute allocations to LLM_SCOPE tags, has to see every allocation from the start
+	GMalloc = FLowLevelMemTracker::CreateMallocProxy( GMalloc );
+#endif
+
 #if MALLOC_VERIFY
 	// Add the verifier
 	GMalloc = new FMallocVerifyProxy( GMalloc );
@@ -465,6 +475,27 @@ SIZE_T FMemory::QuantizeSizeExternal(SIZE_T Count, uint32 Alignment)
 	return GMalloc->QuantizeSize(Count, Alignment);
 }	
 
+void FMemory::MallocBulk(void** OutPtrs, int32 NumPtrs, SIZE_T Count, uint32 Alignment)
+{
+	if (!GMalloc)
+	{
+		GCreateMalloc();
+		CA_ASSUME(GMalloc != NULL);	// Don't want to assert, but suppress static analysis warnings about potentially NULL GMalloc
+	}
+	FScopedMallocTimer Timer(0);
+	GMalloc->MallocBulk(OutPtrs, NumPtrs, Count, Alignment);
+}
+
+void FMemory::FreeBulk(void** Ptrs, int32 NumPtrs)
+{
+	if (!GMalloc)
+	{
+		GCreateMalloc();
+		CA_ASSUME(GMalloc != NULL);	// Don't want to assert, but suppress static analysis warnings about potentially NULL GMalloc
+	}
+	FScopedMallocTimer Timer(2);
+	GMalloc->FreeBulk(Ptrs, NumPtrs);
+}
 
 void FMemory::Trim()
 {
@@ -495,6 +526,14 @@ void FMemory::ClearAndDisableTLSCachesOnCurrentThread()
 	}
 }
 
+void FMemory::TrimCurrentThreadCache()
+{
+	if (GMalloc)
+	{
+		GMalloc->TrimCurrentThreadCache();
+	}
+}
+
 void* FMemory::GPUMalloc(SIZE_T Count, uint32 Alignment /* = DEFAULT_ALIGNMENT */)
 {
 	return FPlatformMemory::GPUMalloc(Count, Alignment);
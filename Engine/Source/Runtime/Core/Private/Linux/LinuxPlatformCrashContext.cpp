@@ -552,6 +552,10 @@ void DefaultCrashHandler(const FLinuxCrashContext & Context)
 
 	// Stop the heartbeat thread so that it doesn't interfere with crashreporting
 	FThreadHeartBeat::Get().Stop();
+	if (FGameThreadHitchHeartBeat* HitchHeartBeat = FGameThreadHitchHeartBeat::GetNoInit())
+	{
+		HitchHeartBeat->Stop();
+	}
 
 	// at this point we should already be using malloc crash handler (see PlatformCrashHandler)
 
@@ -583,6 +587,10 @@ void PlatformCrashHandler(int32 Signal, siginfo_t* Info, void* Context)
 
 	// Stop the heartbeat thread
 	FThreadHeartBeat::Get().Stop();
+	if (FGameThreadHitchHeartBeat* HitchHeartBeat = FGameThreadHitchHeartBeat::GetNoInit())
+	{
+		HitchHeartBeat->Stop();
+	}
 
 	// Switch to malloc crash.
 	FPlatformMallocCrash::Get().SetAsGMalloc();
@@ -6,7 +6,15 @@
 #include "Containers/StringConv.h"
 #include "Logging/LogMacros.h"
 #include "Misc/Paths.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/NativeAsyncReadFileHandle.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/ThreadSafeCounter.h"
 #include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
 
 #include "PlatformFileCommon.h"
 
@@ -744,6 +752,396 @@ IFileHandle* FLinuxPlatformFile::OpenRead(const TCHAR* Filename, bool bAllowWrit
 	return GFileRegistry.InitialOpenFile(*NormalizeFilename(Filename));
 }
 
+/**
+ * Linux mapping of a part of a file
+ */
+class FMappedFileRegionLinux final : public IMappedFileRegion
+{
+	/** Start of the mapping, mmap needs page aligned offsets */
+	void* MappingBase;
+	size_t MappingSize;
+	FThreadSafeCounter& NumOutstandingRegions;
+
+public:
+	FMappedFileRegionLinux(void* InMappingBase, size_t InMappingSize, const uint8* InMappedPtr, int64 InMappedSize, const FString& InDebugFilename, int64 InDebugOffsetRelativeToFile, FThreadSafeCounter& InNumOutstandingRegions)
+		: IMappedFileRegion(InMappedPtr, InMappedSize, InDebugFilename, InDebugOffsetRelativeToFile)
+		, MappingBase(InMappingBase)
+		, MappingSize(InMappingSize)
+		, NumOutstandingRegions(InNumOutstandingRegions)
+	{
+		NumOutstandingRegions.Increment();
+	}
+
+	virtual ~FMappedFileRegionLinux()
+	{
+		munmap(MappingBase, MappingSize);
+		NumOutstandingRegions.Decrement();
+	}
+};
+
+/**
+ * Linux read-only file mapping
+ */
+class FMappedFileHandleLinux final : public IMappedFileHandle
+{
+	int32 FileHandle;
+	FString Filename;
+
+public:
+	FMappedFileHandleLinux(int32 InFileHandle, int64 InFileSize, const FString& InFilename)
+		: IMappedFileHandle(InFileSize)
+		, FileHandle(InFileHandle)
+		, Filename(InFilename)
+	{
+	}
+
+	virtual ~FMappedFileHandleLinux()
+	{
+		close(FileHandle);
+	}
+
+	virtual IMappedFileRegion* MapRegion(int64 Offset, int64 BytesToMap, bool bPreloadHint) override
+	{
+		check(Offset >= 0 && Offset <= GetFileSize());
+		BytesToMap = FMath::Min<int64>(BytesToMap, GetFileSize() - Offset);
+		if (BytesToMap <= 0)
+		{
+			return nullptr;
+		}
+
+		const int64 PageSize = sysconf(_SC_PAGESIZE);
+		const int64 AlignedOffset = Offset - (Offset % PageSize);
+		const size_t AlignedSize = size_t(BytesToMap + (Offset - AlignedOffset));
+
+		void* MappingBase = mmap(nullptr, AlignedSize, PROT_READ, MAP_PRIVATE, FileHandle, AlignedOffset);
+		if (MappingBase == MAP_FAILED)
+		{
+			int ErrNo = errno;
+			UE_LOG(LogLinuxPlatformFile, Warning, TEXT("mmap() failed for '%s' at offset %lld: errno=%d (%s)"), *Filename, Offset, ErrNo, UTF8_TO_TCHAR(strerror(ErrNo)));
+			return nullptr;
+		}
+		if (bPreloadHint)
+		{
+			madvise(MappingBase, AlignedSize, MADV_WILLNEED);
+		}
+		return new FMappedFileRegionLinux(MappingBase, AlignedSize, (const uint8*)MappingBase + (Offset - AlignedOffset), BytesToMap, Filename, Offset, NumOutstandingRegions);
+	}
+};
+
+IMappedFileHandle* FLinuxPlatformFile::OpenMapped(const TCHAR* Filename)
+{
+	FString MappedToFilename;
+	int32 Handle = GCaseInsensMapper.OpenCaseInsensitiveRead(NormalizeFilename(Filename), MappedToFilename);
+	if (Handle == -1)
+	{
+		return nullptr;
+	}
+
+	struct stat FileInfo;
+	if (fstat(Handle, &FileInfo) == -1 || !S_ISREG(FileInfo.st_mode) || FileInfo.st_size == 0)
+	{
+		close(Handle);
+		return nullptr;
+	}
+	return new FMappedFileHandleLinux(Handle, FileInfo.st_size, MappedToFilename);
+}
+
+/**
+ * Minimal io_uring interface. The definitions mirror linux/io_uring.h, which the toolchain's sysroot predates, and the
+ * ring is set up with raw syscalls so the engine still runs on kernels without io_uring.
+ */
+#ifndef __NR_io_uring_setup
+#define __NR_io_uring_setup 425
+#endif
+#ifndef __NR_io_uring_enter
+#define __NR_io_uring_enter 426
+#endif
+
+namespace LinuxIoUring
+{
+	enum
+	{
+		OpReadV = 1,
+		OpAsyncCancel = 14,
+		EnterGetEvents = 1,
+	};
+
+	static const uint64 OffSqRing = 0;
+	static const uint64 OffCqRing = 0x8000000ULL;
+	static const uint64 OffSqes = 0x10000000ULL;
+
+	struct FSqRingOffsets
+	{
+		uint32 Head, Tail, RingMask, RingEntries, Flags, Dropped, Array, Resv1;
+		uint64 Resv2;
+	};
+
+	struct FCqRingOffsets
+	{
+		uint32 Head, Tail, RingMask, RingEntries, Overflow, Cqes, Flags, Resv1;
+		uint64 Resv2;
+	};
+
+	struct FParams
+	{
+		uint32 SqEntries, CqEntries, Flags, SqThreadCpu, SqThreadIdle, Features, WqFd, Resv[3];
+		FSqRingOffsets SqOff;
+		FCqRingOffsets CqOff;
+	};
+
+	struct FSqe
+	{
+		uint8 Opcode;
+		uint8 Flags;
+		uint16 IoPrio;
+		int32 Fd;
+		uint64 Off;
+		uint64 Addr;
+		uint32 Len;
+		uint32 RwFlags;
+		uint64 UserData;
+		uint64 Pad[3];
+	};
+	static_assert(sizeof(FSqe) == 64, "io_uring submission entries are 64 bytes");
+
+	struct FCqe
+	{
+		uint64 UserData;
+		int32 Res;
+		uint32 Flags;
+	};
+	static_assert(sizeof(FCqe) == 16, "io_uring completion entries are 16 bytes");
+}
+
+/**
+ * io_uring shared by the native async read handles. Reads are submitted from the requesting threads and a single
+ * thread reaps the completions and finishes the requests.
+ */
+class FLinuxAsyncIORing : public FRunnable
+{
+public:
+	enum { NUM_ENTRIES = 1024 };
+
+	/** Read in flight, its address is the user data of the submission */
+	struct FOperation
+	{
+		struct iovec Buffer;
+		FNativeAsyncReadRequest* Request;
+	};
+
+	/** @return the ring, or nullptr if io_uring isn't available */
+	static FLinuxAsyncIORing* Get()
+	{
+		// never destroyed, the completion thread runs until the process exits
+		static FLinuxAsyncIORing* Singleton = new FLinuxAsyncIORing();
+		return Singleton->Thread ? Singleton : nullptr;
+	}
+
+	void SubmitRead(int32 FileHandle, FOperation* Operation, int64 Offset)
+	{
+		Submit(LinuxIoUring::OpReadV, FileHandle, (UPTRINT)&Operation->Buffer, 1, Offset, (UPTRINT)Operation, true);
+	}
+
+	void SubmitCancel(FOperation* Operation)
+	{
+		// the cancel completes with user data 0, which the completion thread ignores
+		Submit(LinuxIoUring::OpAsyncCancel, -1, (UPTRINT)Operation, 0, 0, 0, false);
+	}
+
+	virtual uint32 Run() override
+	{
+		CompletionThreadId = FPlatformTLS::GetCurrentThreadId();
+		for (;;)
+		{
+			uint32 Head = *CqHead;
+			const uint32 Tail = __atomic_load_n(CqTail, __ATOMIC_ACQUIRE);
+			if (Head == Tail)
+			{
+				// errors, like being interrupted by a signal, just go around again
+				syscall(__NR_io_uring_enter, RingFd, 0, 1, LinuxIoUring::EnterGetEvents, nullptr, 0);
+				continue;
+			}
+			for (; Head != Tail; ++Head)
+			{
+				const LinuxIoUring::FCqe& Cqe = Cqes[Head & CqMask];
+				FOperation* Operation = (FOperation*)(UPTRINT)Cqe.UserData;
+				const int32 Result = Cqe.Res;
+				__atomic_store_n(CqHead, Head + 1, __ATOMIC_RELEASE);
+				NumInFlight.Decrement();
+
+				if (Operation)
+				{
+					// negative results are errnos, -ECANCELED for canceled reads
+					Operation->Request->OnReadComplete(Result > 0 ? Result : 0, Result >= 0);
+					delete Operation;
+				}
+			}
+		}
+		return 0;
+	}
+
+private:
+	FLinuxAsyncIORing()
+		: RingFd(-1)
+		, Thread(nullptr)
+		, CompletionThreadId(0)
+	{
+		LinuxIoUring::FParams Params;
+		FMemory::Memzero(&Params, sizeof(Params));
+		RingFd = syscall(__NR_io_uring_setup, (uint32)NUM_ENTRIES, &Params);
+		if (RingFd < 0)
+		{
+			UE_LOG(LogLinuxPlatformFile, Log, TEXT("io_uring is not available (errno=%d), async reads use the generic implementation."), errno);
+			return;
+		}
+
+		const SIZE_T SqRingSize = Params.SqOff.Array + Params.SqEntries * sizeof(uint32);
+		const SIZE_T CqRingSize = Params.CqOff.Cqes + Params.CqEntries * sizeof(LinuxIoUring::FCqe);
+		uint8* SqRing = (uint8*)mmap(nullptr, SqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, RingFd, LinuxIoUring::OffSqRing);
+		uint8* CqRing = (uint8*)mmap(nullptr, CqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, RingFd, LinuxIoUring::OffCqRing);
+		void* SqeMemory = mmap(nullptr, Params.SqEntries * sizeof(LinuxIoUring::FSqe), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, RingFd, LinuxIoUring::OffSqes);
+		if (SqRing == MAP_FAILED || CqRing == MAP_FAILED || SqeMemory == MAP_FAILED)
+		{
+			UE_LOG(LogLinuxPlatformFile, Warning, TEXT("Unable to map the io_uring rings (errno=%d), async reads use the generic implementation."), errno);
+			// the mappings go away with the ring
+			close(RingFd);
+			RingFd = -1;
+			return;
+		}
+
+		SqTail = (uint32*)(SqRing + Params.SqOff.Tail);
+		SqMask = *(uint32*)(SqRing + Params.SqOff.RingMask);
+		SqArray = (uint32*)(SqRing + Params.SqOff.Array);
+		Sqes = (LinuxIoUring::FSqe*)SqeMemory;
+		CqHead = (uint32*)(CqRing + Params.CqOff.Head);
+		CqTail = (uint32*)(CqRing + Params.CqOff.Tail);
+		CqMask = *(uint32*)(CqRing + Params.CqOff.RingMask);
+		Cqes = (LinuxIoUring::FCqe*)(CqRing + Params.CqOff.Cqes);
+		MaxInFlight = Params.SqEntries;
+
+		Thread = FRunnableThread::Create(this, TEXT("AsyncIORingThread"), 0, TPri_AboveNormal);
+	}
+
+	void Submit(uint8 Opcode, int32 Fd, uint64 Addr, uint32 Len, uint64 Offset, uint64 UserData, bool bWaitForSlot)
+	{
+		// keeping the reads in flight below the submission ring size means the completion ring, which is twice as big,
+		// can't overflow. The completion thread and cancels never wait, they only ever add a few entries over the limit.
+		if (bWaitForSlot && FPlatformTLS::GetCurrentThreadId() != CompletionThreadId)
+		{
+			while (NumInFlight.GetValue() >= MaxInFlight)
+			{
+				FPlatformProcess::Sleep(0.0f);
+			}
+		}
+		NumInFlight.Increment();
+
+		FScopeLock Lock(&SubmitCritical);
+		const uint32 Tail = *SqTail;
+		const uint32 Index = Tail & SqMask;
+		LinuxIoUring::FSqe& Sqe = Sqes[Index];
+		FMemory::Memzero(&Sqe, sizeof(Sqe));
+		Sqe.Opcode = Opcode;
+		Sqe.Fd = Fd;
+		Sqe.Off = Offset;
+		Sqe.Addr = Addr;
+		Sqe.Len = Len;
+		Sqe.UserData = UserData;
+		SqArray[Index] = Index;
+		__atomic_store_n(SqTail, Tail + 1, __ATOMIC_RELEASE);
+
+		// every entry is submitted right away, so the submission ring never has more than one entry queued
+		for (;;)
+		{
+			const long Result = syscall(__NR_io_uring_enter, RingFd, 1, 0, 0, nullptr, 0);
+			if (Result >= 1)
+			{
+				break;
+			}
+			if (Result < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY)
+			{
+				UE_LOG(LogLinuxPlatformFile, Fatal, TEXT("io_uring_enter failed submitting a read (errno=%d)."), errno);
+			}
+			FPlatformProcess::Sleep(0.0f);
+		}
+	}
+
+	int32 RingFd;
+	FRunnableThread* Thread;
+	uint32 CompletionThreadId;
+
+	FCriticalSection SubmitCritical;
+	FThreadSafeCounter NumInFlight;
+	int32 MaxInFlight;
+
+	uint32* SqTail;
+	uint32 SqMask;
+	uint32* SqArray;
+	LinuxIoUring::FSqe* Sqes;
+
+	uint32* CqHead;
+	uint32* CqTail;
+	uint32 CqMask;
+	LinuxIoUring::FCqe* Cqes;
+};
+
+/**
+ * Async read handle submitting its reads to the shared io_uring. Reads go straight into the request's memory.
+ */
+class FLinuxAsyncReadFileHandle final : public FNativeAsyncReadFileHandle
+{
+	int32 FileHandle;
+	FLinuxAsyncIORing& Ring;
+
+public:
+	FLinuxAsyncReadFileHandle(int32 InFileHandle, const TCHAR* InFilename, int64 InFileSize, FLinuxAsyncIORing& InRing)
+		: FNativeAsyncReadFileHandle(InFilename, InFileSize)
+		, FileHandle(InFileHandle)
+		, Ring(InRing)
+	{
+	}
+
+	virtual ~FLinuxAsyncReadFileHandle()
+	{
+		close(FileHandle);
+	}
+
+	virtual void* IssueRead(FNativeAsyncReadRequest* Request, uint8* Dest, int64 Offset, int64 Size) override
+	{
+		FLinuxAsyncIORing::FOperation* Operation = new FLinuxAsyncIORing::FOperation;
+		Operation->Buffer.iov_base = Dest;
+		Operation->Buffer.iov_len = Size;
+		Operation->Request = Request;
+		Ring.SubmitRead(FileHandle, Operation, Offset);
+		return Operation;
+	}
+
+	virtual void CancelRead(void* Operation) override
+	{
+		Ring.SubmitCancel((FLinuxAsyncIORing::FOperation*)Operation);
+	}
+};
+
+IAsyncReadFileHandle* FLinuxPlatformFile::OpenAsyncRead(const TCHAR* Filename)
+{
+	FLinuxAsyncIORing* Ring = UseNativeAsyncReadFileHandles() ? FLinuxAsyncIORing::Get() : nullptr;
+	if (Ring)
+	{
+		FString MappedToFilename;
+		int32 Handle = GCaseInsensMapper.OpenCaseInsensitiveRead(NormalizeFilename(Filename), MappedToFilename);
+		if (Handle != -1)
+		{
+			struct stat FileInfo;
+			if (fstat(Handle, &FileInfo) != -1 && S_ISREG(FileInfo.st_mode))
+			{
+				return new FLinuxAsyncReadFileHandle(Handle, Filename, FileInfo.st_size, *Ring);
+			}
+			close(Handle);
+		}
+	}
+	// missing files and kernels without io_uring are left to the generic implementation
+	return IPhysicalPlatformFile::OpenAsyncRead(Filename);
+}
+
 IFileHandle* FLinuxPlatformFile::OpenWrite(const TCHAR* Filename, bool bAppend, bool bAllowRead)
 {
 	int Flags = O_CREAT | O_CLOEXEC;	// prevent children from inheriting this
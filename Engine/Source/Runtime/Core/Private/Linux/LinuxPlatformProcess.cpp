@@ -18,6 +18,7 @@
 #include <sys/ioctl.h>
 #include <sys/file.h>
 #include <asm/ioctls.h>
+#include <ucontext.h>
 #include "Linux/LinuxApplication.h"
 
 namespace PlatformProcessLimits
@@ -1216,6 +1217,85 @@ bool FLinuxPlatformProcess::Daemonize()
 	return true;
 }
 
+/** A ucontext based fiber. The thread fiber has no stack of its own. */
+struct FLinuxFiber
+{
+	ucontext_t Context;
+	void* Stack;
+	FLinuxPlatformProcess::FFiberEntryPoint EntryPoint;
+	void* Param;
+};
+
+/** The fiber running on this thread, swapcontext needs to know where to save the current context. */
+static __thread FLinuxFiber* GCurrentLinuxFiber = nullptr;
+
+/** makecontext only passes int arguments, so the fiber pointer is split in two. */
+static void LinuxFiberMain(uint32 FiberLow, uint32 FiberHigh)
+{
+	FLinuxFiber* Fiber = (FLinuxFiber*)(((uint64)FiberHigh << 32) | (uint64)FiberLow);
+	Fiber->EntryPoint(Fiber->Param);
+	checkf(0, TEXT("Fiber entry points must not return"));
+}
+
+void* FLinuxPlatformProcess::ConvertThreadToFiber()
+{
+	check(GCurrentLinuxFiber == nullptr);
+	FLinuxFiber* Fiber = new FLinuxFiber;
+	FMemory::Memzero(Fiber->Context);
+	Fiber->Stack = nullptr;
+	Fiber->EntryPoint = nullptr;
+	Fiber->Param = nullptr;
+	GCurrentLinuxFiber = Fiber;
+	return Fiber;
+}
+
+void FLinuxPlatformProcess::ConvertFiberToThread(void* ThreadFiber)
+{
+	check(GCurrentLinuxFiber == ThreadFiber);
+	GCurrentLinuxFiber = nullptr;
+	delete (FLinuxFiber*)ThreadFiber;
+}
+
+void* FLinuxPlatformProcess::CreateFiber(uint32 StackSize, FFiberEntryPoint EntryPoint, void* Param)
+{
+	const SIZE_T ActualStackSize = StackSize ? Align(StackSize, 16) : 256 * 1024;
+
+	FLinuxFiber* Fiber = new FLinuxFiber;
+	if (getcontext(&Fiber->Context) != 0)
+	{
+		int ErrNo = errno;
+		UE_LOG(LogHAL, Warning, TEXT("getcontext() failed with errno = %d (%s)"), ErrNo, StringCast< TCHAR >(strerror(ErrNo)).Get());
+		delete Fiber;
+		return nullptr;
+	}
+
+	Fiber->Stack = FMemory::Malloc(ActualStackSize, 16);
+	Fiber->EntryPoint = EntryPoint;
+	Fiber->Param = Param;
+	Fiber->Context.uc_stack.ss_sp = Fiber->Stack;
+	Fiber->Context.uc_stack.ss_size = ActualStackSize;
+	Fiber->Context.uc_link = nullptr;
+
+	const uint64 FiberBits = (uint64)Fiber;
+	makecontext(&Fiber->Context, (void (*)())&LinuxFiberMain, 2, (uint32)(FiberBits & 0xffffffff), (uint32)(FiberBits >> 32));
+	return Fiber;
+}
+
+void FLinuxPlatformProcess::DeleteFiber(void* Fiber)
+{
+	check(GCurrentLinuxFiber != Fiber);
+	FMemory::Free(((FLinuxFiber*)Fiber)->Stack);
+	delete (FLinuxFiber*)Fiber;
+}
+
+void FLinuxPlatformProcess::SwitchToFiber(void* Fiber)
+{
+	checkf(GCurrentLinuxFiber, TEXT("ConvertThreadToFiber must be called before switching fibers"));
+	FLinuxFiber* PreviousFiber = GCurrentLinuxFiber;
+	GCurrentLinuxFiber = (FLinuxFiber*)Fiber;
+	verify(swapcontext(&PreviousFiber->Context, &GCurrentLinuxFiber->Context) == 0);
+}
+
 bool FLinuxPlatformProcess::IsApplicationRunning( uint32 ProcessId )
 {
 	errno = 0;
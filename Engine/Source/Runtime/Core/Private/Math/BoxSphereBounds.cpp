@@ -8,6 +8,7 @@
 #include "Math/VectorRegister.h"
 #include "Math/Matrix.h"
 #include "Math/Transform.h"
+#include "Containers/ArrayView.h"
 
 
 /* FBoxSphereBounds interface
@@ -65,3 +66,62 @@ FBoxSphereBounds FBoxSphereBounds::TransformBy(const FTransform& M) const
 	FBoxSphereBounds Result = TransformBy(Mat);
 	return Result;
 }
+
+void FBoxSphereBounds::TransformBy(const FMatrix& M, TArrayView<const FBoxSphereBounds> InBounds, TArrayView<FBoxSphereBounds> OutBounds)
+{
+	check(InBounds.Num() == OutBounds.Num());
+
+#if ENABLE_NAN_DIAGNOSTIC
+	if (M.ContainsNaN())
+	{
+		logOrEnsureNanError(TEXT("Input Matrix contains NaN/Inf! %s"), *M.ToString());
+		(const_cast<FMatrix*>(&M))->SetIdentity();
+	}
+#endif
+
+	const VectorRegister m0 = VectorLoadAligned(M.M[0]);
+	const VectorRegister m1 = VectorLoadAligned(M.M[1]);
+	const VectorRegister m2 = VectorLoadAligned(M.M[2]);
+	const VectorRegister m3 = VectorLoadAligned(M.M[3]);
+
+	// The radius scale only depends on the matrix
+	VectorRegister MaxRadius = VectorMultiply(m0, m0);
+	MaxRadius = VectorMultiplyAdd(m1, m1, MaxRadius);
+	MaxRadius = VectorMultiplyAdd(m2, m2, MaxRadius);
+	MaxRadius = VectorMax(VectorMax(MaxRadius, VectorReplicate(MaxRadius, 1)), VectorReplicate(MaxRadius, 2));
+	const float RadiusScale = FMath::Sqrt(VectorGetComponent(MaxRadius, 0));
+
+	for (int32 Index = 0; Index < InBounds.Num(); ++Index)
+	{
+		const FBoxSphereBounds& Bounds = InBounds[Index];
+		const VectorRegister VecOrigin = VectorLoadFloat3(&Bounds.Origin);
+		const VectorRegister VecExtent = VectorLoadFloat3(&Bounds.BoxExtent);
+		const float BoundsRadius = Bounds.SphereRadius;
+
+		VectorRegister NewOrigin = VectorMultiply(VectorReplicate(VecOrigin, 0), m0);
+		NewOrigin = VectorMultiplyAdd(VectorReplicate(VecOrigin, 1), m1, NewOrigin);
+		NewOrigin = VectorMultiplyAdd(VectorReplicate(VecOrigin, 2), m2, NewOrigin);
+		NewOrigin = VectorAdd(NewOrigin, m3);
+
+		VectorRegister NewExtent = VectorAbs(VectorMultiply(VectorReplicate(VecExtent, 0), m0));
+		NewExtent = VectorAdd(NewExtent, VectorAbs(VectorMultiply(VectorReplicate(VecExtent, 1), m1)));
+		NewExtent = VectorAdd(NewExtent, VectorAbs(VectorMultiply(VectorReplicate(VecExtent, 2), m2)));
+
+		// Bounds were read into registers above, so writing in place is fine
+		FBoxSphereBounds& Result = OutBounds[Index];
+		VectorStoreFloat3(NewExtent, &Result.BoxExtent);
+		VectorStoreFloat3(NewOrigin, &Result.Origin);
+		Result.SphereRadius = RadiusScale * BoundsRadius;
+
+		Result.DiagnosticCheckNaN();
+	}
+}
+
+void FBoxSphereBounds::TransformBy(const FTransform& M, TArrayView<const FBoxSphereBounds> InBounds, TArrayView<FBoxSphereBounds> OutBounds)
+{
+#if ENABLE_NAN_DIAGNOSTIC
+	M.DiagnosticCheckNaN_All();
+#endif
+
+	TransformBy(M.ToMatrixWithScale(), InBounds, OutBounds);
+}
@@ -5,6 +5,7 @@
 =============================================================================*/
 
 #include "Math/Transform.h"
+#include "Containers/ArrayView.h"
 
 #if !ENABLE_VECTORIZED_TRANSFORM
 
@@ -229,4 +230,15 @@ bool FTransform::DebugEqualMatrix(const FMatrix& Matrix) const
 	return true;
 }
 
+void FTransform::TransformPositions(TArrayView<const FVector> InPositions, TArrayView<FVector> OutPositions) const
+{
+	check(InPositions.Num() == OutPositions.Num());
+	DiagnosticCheckNaN_All();
+
+	for (int32 Index = 0; Index < InPositions.Num(); ++Index)
+	{
+		OutPositions[Index] = Rotation.RotateVector(Scale3D * InPositions[Index]) + Translation;
+	}
+}
+
 #endif // #if !ENABLE_VECTORIZED_TRANSFORM
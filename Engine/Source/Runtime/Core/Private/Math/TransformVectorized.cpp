@@ -16,6 +16,7 @@
 #include "Math/Matrix.h"
 #include "Math/Quat.h"
 #include "Math/Transform.h"
+#include "Containers/ArrayView.h"
 
 #if ENABLE_VECTORIZED_TRANSFORM
 
@@ -283,4 +284,27 @@ bool FTransform::DebugEqualMatrix(const FMatrix& Matrix) const
 	return true;
 }
 
+void FTransform::TransformPositions(TArrayView<const FVector> InPositions, TArrayView<FVector> OutPositions) const
+{
+	check(InPositions.Num() == OutPositions.Num());
+	DiagnosticCheckNaN_All();
+
+	const VectorRegister VecRotation = Rotation;
+	const VectorRegister VecTranslation = Translation;
+	const VectorRegister VecScale3D = Scale3D;
+
+	const FVector* InData = InPositions.GetData();
+	FVector* OutData = OutPositions.GetData();
+	const int32 NumPositions = InPositions.Num();
+
+	for (int32 Index = 0; Index < NumPositions; ++Index)
+	{
+		// Same as TransformPosition, QST(P) = Q.Rotate(S*P) + T
+		const VectorRegister InputVectorW0 = VectorLoadFloat3_W0(&InData[Index]);
+		const VectorRegister ScaledVec = VectorMultiply(VecScale3D, InputVectorW0);
+		const VectorRegister RotatedVec = VectorQuaternionRotateVector(VecRotation, ScaledVec);
+		VectorStoreFloat3(VectorAdd(RotatedVec, VecTranslation), &OutData[Index]);
+	}
+}
+
 #endif // ENABLE_VECTORIZED_TRANSFORM
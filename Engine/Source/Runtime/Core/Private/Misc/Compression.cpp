@@ -10,6 +10,9 @@
 #include "Misc/ConfigCacheIni.h"
 #include "Misc/CompressedGrowableBuffer.h"
 #include "GenericPlatform/GenericPlatformCompression.h"
+#include "Misc/ICompressionFormat.h"
+#include "Features/IModularFeatures.h"
+#include "Misc/ScopeLock.h"
 // #include "TargetPlatformBase.h"
 THIRD_PARTY_INCLUDES_START
 #include "ThirdParty/zlib/zlib-1.2.5/Inc/zlib.h"
@@ -223,6 +226,52 @@ static ECompressionFlags CheckGlobalCompressionFlags(ECompressionFlags Flags)
 	return Flags;
 }
 
+/** Guards walking the registered compression formats, they can be looked up from any thread. */
+static FCriticalSection GCompressionFormatsCritical;
+
+bool FCompression::GetCustomCompressionFlags(FName FormatName, ECompressionFlags& OutFlags)
+{
+	FScopeLock Lock(&GCompressionFormatsCritical);
+
+	IModularFeatures& ModularFeatures = IModularFeatures::Get();
+	const int32 NumFormats = ModularFeatures.GetModularFeatureImplementationCount(ICompressionFormat::GetModularFeatureName());
+	for (int32 FormatIndex = 0; FormatIndex < NumFormats; ++FormatIndex)
+	{
+		ICompressionFormat* Format = static_cast<ICompressionFormat*>(ModularFeatures.GetModularFeatureImplementation(ICompressionFormat::GetModularFeatureName(), FormatIndex));
+		if (Format->GetCompressionFormatName() == FormatName)
+		{
+			checkf(Format->GetCompressionFormatId() != 0, TEXT("Compression format %s must have a non zero id."), *FormatName.ToString());
+			OutFlags = (ECompressionFlags)(COMPRESS_Custom | ((int32)Format->GetCompressionFormatId() << COMPRESSION_FLAGS_CUSTOM_FORMAT_SHIFT));
+			return true;
+		}
+	}
+	return false;
+}
+
+ICompressionFormat* FCompression::GetCustomCompressionFormat(ECompressionFlags Flags)
+{
+	if (!(Flags & COMPRESS_Custom))
+	{
+		return nullptr;
+	}
+
+	const uint8 FormatId = (uint8)((Flags & COMPRESSION_FLAGS_CUSTOM_FORMAT_MASK) >> COMPRESSION_FLAGS_CUSTOM_FORMAT_SHIFT);
+
+	FScopeLock Lock(&GCompressionFormatsCritical);
+
+	IModularFeatures& ModularFeatures = IModularFeatures::Get();
+	const int32 NumFormats = ModularFeatures.GetModularFeatureImplementationCount(ICompressionFormat::GetModularFeatureName());
+	for (int32 FormatIndex = 0; FormatIndex < NumFormats; ++FormatIndex)
+	{
+		ICompressionFormat* Format = static_cast<ICompressionFormat*>(ModularFeatures.GetModularFeatureImplementation(ICompressionFormat::GetModularFeatureName(), FormatIndex));
+		if (Format->GetCompressionFormatId() == FormatId)
+		{
+			return Format;
+		}
+	}
+	return nullptr;
+}
+
 /**
 * Thread-safe abstract compression routine to query memory requirements for a compression operation.
 *
@@ -235,7 +284,15 @@ int32 FCompression::CompressMemoryBound( ECompressionFlags Flags, int32 Uncompre
 {
 	int32 CompressionBound = UncompressedSize;
 	// make sure a valid compression scheme was provided
-	check(Flags & COMPRESS_ZLIB);
+	check(Flags & (COMPRESS_ZLIB | COMPRESS_Custom));
+
+	if (Flags & COMPRESS_Custom)
+	{
+		// custom formats aren't known to the platform compression, so only their own bounds apply
+		ICompressionFormat* Format = GetCustomCompressionFormat(Flags);
+		checkf(Format, TEXT("Compression format %d is not registered."), (Flags & COMPRESSION_FLAGS_CUSTOM_FORMAT_MASK) >> COMPRESSION_FLAGS_CUSTOM_FORMAT_SHIFT);
+		return Format->GetCompressedBufferSize(UncompressedSize);
+	}
 
 	Flags = CheckGlobalCompressionFlags(Flags);
 
@@ -293,12 +350,33 @@ bool FCompression::CompressMemory( ECompressionFlags Flags, void* CompressedBuff
 	double CompressorStartTime = FPlatformTime::Seconds();
 
 	// make sure a valid compression scheme was provided
-	check(Flags & COMPRESS_ZLIB || Flags & COMPRESS_GZIP);
+	check(Flags & COMPRESS_ZLIB || Flags & COMPRESS_GZIP || Flags & COMPRESS_Custom);
 
 	bool bCompressSucceeded = false;
 
 	Flags = CheckGlobalCompressionFlags(Flags);
 
+	if (Flags & COMPRESS_Custom)
+	{
+		ICompressionFormat* Format = GetCustomCompressionFormat(Flags);
+		if (Format)
+		{
+			bCompressSucceeded = Format->Compress(CompressedBuffer, CompressedSize, UncompressedBuffer, UncompressedSize, (Flags & COMPRESS_BiasMemory) != 0);
+		}
+		else
+		{
+			UE_LOG(LogCompression, Warning, TEXT("appCompressMemory - Compression format %d is not registered"), (Flags & COMPRESSION_FLAGS_CUSTOM_FORMAT_MASK) >> COMPRESSION_FLAGS_CUSTOM_FORMAT_SHIFT);
+		}
+
+		CompressorTime += FPlatformTime::Seconds() - CompressorStartTime;
+		if (bCompressSucceeded)
+		{
+			CompressorSrcBytes += UncompressedSize;
+			CompressorDstBytes += CompressedSize;
+		}
+		return bCompressSucceeded;
+	}
+
 #if !WITH_EDITOR
 	IPlatformCompression* PlatformCompression = FPlatformMisc::GetPlatformCompression();
 	if (PlatformCompression != nullptr)
@@ -363,10 +441,35 @@ bool FCompression::UncompressMemory( ECompressionFlags Flags, void* Uncompressed
 	STAT(double UncompressorStartTime = FPlatformTime::Seconds();)
 	
 	// make sure a valid compression scheme was provided
-	check(Flags & COMPRESS_ZLIB);
+	check(Flags & (COMPRESS_ZLIB | COMPRESS_Custom));
 
 	bool bUncompressSucceeded = false;
 
+	if (Flags & COMPRESS_Custom)
+	{
+		ICompressionFormat* Format = GetCustomCompressionFormat(Flags);
+		if (Format)
+		{
+			bUncompressSucceeded = Format->Uncompress(UncompressedBuffer, UncompressedSize, CompressedBuffer, CompressedSize);
+			if (!bUncompressSucceeded)
+			{
+				UE_LOG(LogCompression, Error, TEXT("FCompression::UncompressMemory - Failed to uncompress memory (%d/%d) with %s, this may indicate the asset is corrupt!"), CompressedSize, UncompressedSize, *Format->GetCompressionFormatName().ToString());
+			}
+		}
+		else
+		{
+			UE_LOG(LogCompression, Error, TEXT("FCompression::UncompressMemory - Compression format %d is not registered"), (Flags & COMPRESSION_FLAGS_CUSTOM_FORMAT_MASK) >> COMPRESSION_FLAGS_CUSTOM_FORMAT_SHIFT);
+		}
+
+#if	STATS
+		if (FThreadStats::IsThreadingReady())
+		{
+			INC_FLOAT_STAT_BY(STAT_UncompressorTime, (float)(FPlatformTime::Seconds() - UncompressorStartTime))
+		}
+#endif // STATS
+		return bUncompressSucceeded;
+	}
+
 	// try to use a platform specific decompression routine if available
 	IPlatformCompression* PlatformCompression = FPlatformMisc::GetPlatformCompression();
 	if (PlatformCompression != nullptr)
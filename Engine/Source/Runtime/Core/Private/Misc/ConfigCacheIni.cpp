@@ -14,6 +14,9 @@
 #include "Misc/RemoteConfigIni.h"
 #include "Misc/DefaultValueHelper.h"
 #include "Misc/ConfigManifest.h"
+#include "Misc/Crc.h"
+#include "Serialization/NameAsStringProxyArchive.h"
+#include "Templates/UniquePtr.h"
 
 #if WITH_EDITOR
 	#define INI_CACHE 1
@@ -54,6 +57,19 @@ namespace
 #endif
 }
 
+/**
+ * Terminates the string after its last non whitespace character.
+ * @return The new length of the string
+ */
+static FORCEINLINE int32 StripTrailingWhitespace(TCHAR* Str, int32 Len)
+{
+	while (Len > 0 && FChar::IsWhitespace(Str[Len - 1]))
+	{
+		Str[--Len] = 0;
+	}
+	return Len;
+}
+
 /*-----------------------------------------------------------------------------
 FConfigValue
 -----------------------------------------------------------------------------*/
@@ -411,17 +427,14 @@ void FConfigFile::CombineFromBuffer(const FString& Buffer)
 		TCHAR* Start = const_cast<TCHAR*>(*TheLine);
 
 		// Strip trailing spaces from the current line
-		while( *Start && FChar::IsWhitespace(Start[FCString::Strlen(Start)-1]) )
-		{
-			Start[FCString::Strlen(Start)-1] = 0;
-		}
+		TCHAR* const LineEnd = Start + StripTrailingWhitespace(Start, TheLine.Len());
 
 		// If the first character in the line is [ and last char is ], this line indicates a section name
-		if( *Start=='[' && Start[FCString::Strlen(Start)-1]==']' )
+		if( *Start=='[' && LineEnd[-1]==']' )
 		{
 			// Remove the brackets
 			Start++;
-			Start[FCString::Strlen(Start)-1] = 0;
+			LineEnd[-1] = 0;
 
 			// If we don't have an existing section by this name, add one
 			CurrentSection = FindOrAddSection( Start );
@@ -471,11 +484,8 @@ void FConfigFile::CombineFromBuffer(const FString& Buffer)
 					Cmd=' ';
 				}
 
-				// Strip trailing spaces from the property name.
-				while( *Start && FChar::IsWhitespace(Start[FCString::Strlen(Start)-1]) )
-				{
-					Start[FCString::Strlen(Start)-1] = 0;
-				}
+				// Strip trailing spaces from the property name, it ends where the = was
+				StripTrailingWhitespace(Start, (Value - 1) - Start);
 
 				FString ProcessedValue;
 
@@ -486,14 +496,12 @@ void FConfigFile::CombineFromBuffer(const FString& Buffer)
 				}
 
 				// strip trailing whitespace from the property value
-				while( *Value && FChar::IsWhitespace(Value[FCString::Strlen(Value)-1]) )
-				{
-					Value[FCString::Strlen(Value)-1] = 0;
-				}
+				const int32 ValueLen = StripTrailingWhitespace(Value, LineEnd - Value);
 
 				// If this line is delimited by quotes
 				if( *Value=='\"' )
 				{
+					ProcessedValue.Reserve(ValueLen);
 					Value++;
 					//epic moelfke: fixed handling of escaped characters in quoted string
 					while (*Value && *Value != '\"')
@@ -620,17 +628,14 @@ void FConfigFile::ProcessInputFileContents(const FString& Contents)
 		TCHAR* Start = const_cast<TCHAR*>(*TheLine);
 
 		// Strip trailing spaces from the current line
-		while( *Start && FChar::IsWhitespace(Start[FCString::Strlen(Start)-1]) )
-		{
-			Start[FCString::Strlen(Start)-1] = 0;
-		}
+		TCHAR* const LineEnd = Start + StripTrailingWhitespace(Start, TheLine.Len());
 
 		// If the first character in the line is [ and last char is ], this line indicates a section name
-		if( *Start=='[' && Start[FCString::Strlen(Start)-1]==']' )
+		if( *Start=='[' && LineEnd[-1]==']' )
 		{
 			// Remove the brackets
 			Start++;
-			Start[FCString::Strlen(Start)-1] = 0;
+			LineEnd[-1] = 0;
 
 			// If we don't have an existing section by this name, add one
 			CurrentSection = FindOrAddSection( Start );
@@ -657,17 +662,15 @@ void FConfigFile::ProcessInputFileContents(const FString& Contents)
 				while ( *Start && FChar::IsWhitespace(*Start) )
 					Start++;
 
-				// Strip trailing spaces from the property name.
-				while( *Start && FChar::IsWhitespace(Start[FCString::Strlen(Start)-1]) )
-					Start[FCString::Strlen(Start)-1] = 0;
+				// Strip trailing spaces from the property name, it ends where the = was
+				StripTrailingWhitespace(Start, (Value - 1) - Start);
 
 				// Strip leading whitespace from the property value
 				while ( *Value && FChar::IsWhitespace(*Value) )
 					Value++;
 
 				// strip trailing whitespace from the property value
-				while( *Value && FChar::IsWhitespace(Value[FCString::Strlen(Value)-1]) )
-					Value[FCString::Strlen(Value)-1] = 0;
+				StripTrailingWhitespace(Value, LineEnd - Value);
 
 				// If this line is delimited by quotes
 				if( *Value=='\"' )
@@ -886,6 +889,126 @@ static void OverrideFromCommandline(FConfigFile* File, const FString& Filename)
 #endif
 
 
+/*-----------------------------------------------------------------------------
+	Binary config cache.
+
+	Merging a hierarchy parses every ini in it as text, which adds up with many plugins. The merged result is saved
+	in binary form to Saved/Config/BinaryCache, along with a hash of each source ini it was merged from, and loaded
+	instead of parsing as long as none of the sources changed. Enabled by default for cooked builds,
+	-BinaryConfigCache enables it for uncooked ones and -NoBinaryConfigCache disables it.
+-----------------------------------------------------------------------------*/
+
+namespace BinaryConfigCache
+{
+	/** Bump when the format of the cache files changes */
+	static const int32 Version = 1;
+
+	/** Source ini a cached hierarchy was merged from */
+	struct FSourceIni
+	{
+		FString Filename;
+		uint32 Hash;
+		bool bExists;
+
+		bool operator==(const FSourceIni& Other) const
+		{
+			return bExists == Other.bExists && Hash == Other.Hash && Filename == Other.Filename;
+		}
+
+		friend FArchive& operator<<(FArchive& Ar, FSourceIni& SourceIni)
+		{
+			return Ar << SourceIni.Filename << SourceIni.Hash << SourceIni.bExists;
+		}
+	};
+
+	static bool IsEnabled()
+	{
+		static const bool bEnabled = !FParse::Param(FCommandLine::Get(), TEXT("NoBinaryConfigCache")) &&
+			(FPlatformProperties::RequiresCookedData() || FParse::Param(FCommandLine::Get(), TEXT("BinaryConfigCache")));
+		return bEnabled;
+	}
+
+	/**
+	 * Hashes the contents of all inis of the hierarchy.
+	 * @return false if the hierarchy can't be cached, because it has remote or missing required inis
+	 */
+	static bool HashHierarchy(const FConfigFileHierarchy& Hierarchy, TArray<FSourceIni>& OutSourceInis, FString& OutCacheFilename)
+	{
+		uint32 FilenamesHash = 0;
+		TArray<uint8> Contents;
+		for (const auto& HierarchyIt : Hierarchy)
+		{
+			const FIniFilename& Ini = HierarchyIt.Value;
+			if (!IsUsingLocalIniFile(*Ini.Filename, nullptr))
+			{
+				return false;
+			}
+
+			FSourceIni& SourceIni = OutSourceInis[OutSourceInis.AddDefaulted()];
+			SourceIni.Filename = Ini.Filename;
+			SourceIni.bExists = FFileHelper::LoadFileToArray(Contents, *Ini.Filename, FILEREAD_Silent);
+			SourceIni.Hash = SourceIni.bExists ? FCrc::MemCrc32(Contents.GetData(), Contents.Num()) : 0;
+			if (!SourceIni.bExists && Ini.bRequired)
+			{
+				return false;
+			}
+
+			FilenamesHash = FCrc::StrCrc32(*Ini.Filename, FilenamesHash);
+		}
+
+		OutCacheFilename = FPaths::GeneratedConfigDir() / TEXT("BinaryCache") / FString::Printf(TEXT("%08X.bin"), FilenamesHash);
+		return true;
+	}
+
+	static bool Load(const FString& CacheFilename, const TArray<FSourceIni>& SourceInis, FConfigFile& ConfigFile)
+	{
+		TUniquePtr<FArchive> FileReader(IFileManager::Get().CreateFileReader(*CacheFilename, FILEREAD_Silent));
+		if (!FileReader)
+		{
+			return false;
+		}
+
+		FNameAsStringProxyArchive Ar(*FileReader);
+
+		int32 CacheVersion = 0;
+		Ar << CacheVersion;
+		if (CacheVersion != Version)
+		{
+			return false;
+		}
+
+		TArray<FSourceIni> CachedSourceInis;
+		Ar << CachedSourceInis;
+		if (Ar.IsError() || CachedSourceInis != SourceInis)
+		{
+			return false;
+		}
+
+		ConfigFile.SerializeSections(Ar);
+		if (Ar.IsError())
+		{
+			UE_LOG(LogConfig, Warning, TEXT("Binary config cache %s is corrupt, merging the hierarchy again"), *CacheFilename);
+			ConfigFile.Empty();
+			return false;
+		}
+		return true;
+	}
+
+	static void Save(const FString& CacheFilename, TArray<FSourceIni>& SourceInis, FConfigFile& ConfigFile)
+	{
+		TUniquePtr<FArchive> FileWriter(IFileManager::Get().CreateFileWriter(*CacheFilename, FILEWRITE_Silent));
+		if (FileWriter)
+		{
+			FNameAsStringProxyArchive Ar(*FileWriter);
+
+			int32 CacheVersion = Version;
+			Ar << CacheVersion;
+			Ar << SourceInis;
+			ConfigFile.SerializeSections(Ar);
+		}
+	}
+}
+
 /**
  * This will completely load .ini file hierarchy into the passed in FConfigFile. The passed in FConfigFile will then
  * have the data after combining all of those .ini 
@@ -937,6 +1060,17 @@ static bool LoadIniFileHierarchy(const FConfigFileHierarchy& HierarchyToLoad, FC
 	}
 #endif
 
+	// Nothing in memory, try the merged hierarchy from a previous run
+	TArray<BinaryConfigCache::FSourceIni> SourceInis;
+	FString BinaryCacheFilename;
+	const bool bUseBinaryCache = FirstCacheIndex == EConfigFileHierarchy::AbsoluteBase && BinaryConfigCache::IsEnabled() &&
+		BinaryConfigCache::HashHierarchy(HierarchyToLoad, SourceInis, BinaryCacheFilename);
+	if (bUseBinaryCache && BinaryConfigCache::Load(BinaryCacheFilename, SourceInis, ConfigFile))
+	{
+		ConfigFile.SourceIniHierarchy = HierarchyToLoad;
+		return true;
+	}
+
 	TArray<FDateTime> TimestampsOfInis;
 
 	// Traverse ini list back to front, merging along the way.
@@ -1005,6 +1139,11 @@ static bool LoadIniFileHierarchy(const FConfigFileHierarchy& HierarchyToLoad, FC
 	// Set this configs files source ini hierarchy to show where it was loaded from.
 	ConfigFile.SourceIniHierarchy = HierarchyToLoad;
 
+	if (bUseBinaryCache)
+	{
+		BinaryConfigCache::Save(BinaryCacheFilename, SourceInis, ConfigFile);
+	}
+
 	return true;
 }
 
@@ -1284,6 +1423,38 @@ void FConfigFile::AddMissingProperties( const FConfigFile& InSourceFile )
 
 
 
+void FConfigFile::SerializeSections(FArchive& Ar)
+{
+	int32 NumSections = Num();
+	Ar << NumSections;
+
+	if (Ar.IsLoading())
+	{
+		Empty(NumSections);
+		for (int32 SectionIndex = 0; SectionIndex < NumSections && !Ar.IsError(); SectionIndex++)
+		{
+			FString SectionName;
+			Ar << SectionName;
+
+			FConfigSection& Section = Add(SectionName, FConfigSection());
+			Ar << static_cast<FConfigSectionMap&>(Section);
+			Ar << Section.ArrayOfStructKeys;
+		}
+	}
+	else
+	{
+		for (TPair<FString, FConfigSection>& Pair : *this)
+		{
+			Ar << Pair.Key;
+			Ar << static_cast<FConfigSectionMap&>(Pair.Value);
+			Ar << Pair.Value.ArrayOfStructKeys;
+		}
+	}
+
+	Ar << PerObjectConfigArrayOfStructKeys;
+	Ar << Dirty;
+}
+
 void FConfigFile::Dump(FOutputDevice& Ar)
 {
 	Ar.Logf( TEXT("FConfigFile::Dump") );
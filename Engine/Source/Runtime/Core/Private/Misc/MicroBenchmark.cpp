@@ -0,0 +1,47 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/MicroBenchmark.h"
+#include "Math/UnrealMathUtility.h"
+#include "HAL/IConsoleManager.h"
+#include "ProfilingDebugging/PerformanceBaseline.h"
+
+static int32 MicroBenchmarkSamples = 30;
+static FAutoConsoleVariableRef CVarMicroBenchmarkSamples(
+	TEXT("perf.MicroBenchmarkSamples"),
+	MicroBenchmarkSamples,
+	TEXT("Number of timed samples each micro benchmark takes."));
+
+volatile uint8 FMicroBenchmark::ResultSink = 0;
+
+int32 FMicroBenchmark::GetNumSamples()
+{
+	return FMath::Max(MicroBenchmarkSamples, 2);
+}
+
+bool FMicroBenchmark::ReportSamples(const TArray<double>& Samples)
+{
+	const FString Metric = GetBeautifiedTestName();
+	const FPerformanceMetricStats Stats = FPerformanceMetricStats::FromSamples(Samples);
+
+	// All micro benchmarks share one baseline file
+	FPerformanceBaseline Baseline(TEXT("MicroBenchmarks"));
+	const FPerformanceMetricStats* BaselineStats = Baseline.FindMetric(Metric);
+	const EPerformanceComparison Comparison = Baseline.Compare(Metric, Stats);
+
+	AddInfo(FString::Printf(TEXT("%s: %.4f us per iteration (median %.4f, std dev %.4f), baseline %.4f us, %s"),
+		*Metric, Stats.Mean, Stats.Median, Stats.StdDev, BaselineStats ? BaselineStats->Mean : 0.0, LexToString(Comparison)));
+	AddAnalyticsItem(FString::Printf(TEXT("%s=%f"), *Metric, Stats.Mean));
+
+	if (FPerformanceBaseline::ShouldUpdateBaselines())
+	{
+		Baseline.SetMetric(Metric, Stats);
+		Baseline.Save();
+	}
+	else if (Comparison == EPerformanceComparison::Regressed)
+	{
+		AddError(FString::Printf(TEXT("%s regressed from %.4f to %.4f us per iteration"), *Metric, BaselineStats->Mean, Stats.Mean));
+		return false;
+	}
+
+	return true;
+}
@@ -271,6 +271,11 @@ public:
 	//~ End FRunnable Interface
 };
 
+FArchive* CreateAsyncWriter(FArchive& InAr)
+{
+	return new FAsyncWriter(InAr);
+}
+
 /** 
  * Constructor, initializing member variables.
  *
@@ -4,6 +4,165 @@
 #include "Misc/ScopeLock.h"
 #include "Stats/Stats.h"
 #include "Misc/CoreStats.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Containers/LockFreeList.h"
+
+/*-----------------------------------------------------------------------------
+	FAsyncLogThread.
+-----------------------------------------------------------------------------*/
+
+/** A line waiting for the async log thread. Lines are preallocated, so logging doesn't allocate. */
+struct FAsyncLogLine
+{
+	/** Longer lines are written synchronously */
+	static const int32 MaxLength = 512;
+
+	TCHAR Data[MaxLength];
+	FName Category;
+	double Time;
+	ELogVerbosity::Type Verbosity;
+};
+
+/** Writes the lines logged by all threads to the output devices of the redirector */
+class FAsyncLogThread : public FRunnable
+{
+public:
+	FAsyncLogThread(FOutputDeviceRedirector& InRedirector, int32 MaxPendingLines)
+		: Redirector(InRedirector)
+		, WakeUpEvent(FPlatformProcess::GetSynchEventFromPool(false))
+		, Thread(nullptr)
+		, WakeUpThreshold(FMath::Max(MaxPendingLines / 2, 1))
+		, bAcceptingLines(true)
+	{
+		Lines.SetNumUninitialized(MaxPendingLines);
+		for (FAsyncLogLine& Line : Lines)
+		{
+			new(&Line.Category) FName();
+			FreeLines.Push(&Line);
+		}
+
+		Thread = FRunnableThread::Create(this, TEXT("LogThread"), 0, TPri_BelowNormal);
+	}
+
+	/** Result of trying to queue a line */
+	enum class EEnqueueResult
+	{
+		Queued,
+		/** All lines are in use */
+		Full,
+		/** The line is too long or the thread has been shut down */
+		Rejected,
+	};
+
+	/** Copies the line and queues it for the log thread, callable from any thread */
+	EEnqueueResult Enqueue(const TCHAR* Data, ELogVerbosity::Type Verbosity, const FName& Category, double Time)
+	{
+		const int32 Length = FCString::Strlen(Data);
+		if (!bAcceptingLines || Length >= FAsyncLogLine::MaxLength)
+		{
+			return EEnqueueResult::Rejected;
+		}
+
+		FAsyncLogLine* Line = FreeLines.Pop();
+		if (!Line)
+		{
+			DroppedLines.Increment();
+			WakeUpEvent->Trigger();
+			return EEnqueueResult::Full;
+		}
+
+		FMemory::Memcpy(Line->Data, Data, (Length + 1) * sizeof(TCHAR));
+		Line->Category = Category;
+		Line->Verbosity = Verbosity;
+		Line->Time = Time;
+		QueuedLines.Push(Line);
+
+		// Only wake up the thread when the queue fills up, otherwise it picks up lines on its own at a fixed interval
+		if (NumQueuedLines.Increment() == WakeUpThreshold)
+		{
+			WakeUpEvent->Trigger();
+		}
+		return EEnqueueResult::Queued;
+	}
+
+	/** Returns the oldest queued line, which must be passed to ReleaseLine once it has been written */
+	FAsyncLogLine* PopLine()
+	{
+		return QueuedLines.Pop();
+	}
+
+	void ReleaseLine(FAsyncLogLine* Line)
+	{
+		NumQueuedLines.Decrement();
+		FreeLines.Push(Line);
+	}
+
+	/** Returns the number of lines dropped since the last call */
+	int32 ResetDroppedLines()
+	{
+		return DroppedLines.Reset();
+	}
+
+	/** Stops the thread, lines logged afterwards are written synchronously. Called on the master thread. */
+	void Shutdown()
+	{
+		bAcceptingLines = false;
+		if (Thread)
+		{
+			Thread->Kill(true);
+			delete Thread;
+			Thread = nullptr;
+		}
+	}
+
+	//~ Begin FRunnable Interface
+	virtual uint32 Run() override
+	{
+		while (StopTaskCounter.GetValue() == 0)
+		{
+			WakeUpEvent->Wait(5);
+
+			FScopeLock ScopeLock(&Redirector.SynchronizationObject);
+			Redirector.UnsynchronizedFlushAsyncLines(false);
+		}
+		return 0;
+	}
+
+	virtual void Stop() override
+	{
+		StopTaskCounter.Increment();
+		WakeUpEvent->Trigger();
+	}
+	//~ End FRunnable Interface
+
+private:
+	FOutputDeviceRedirector& Redirector;
+
+	/** Storage of all lines */
+	TArray<FAsyncLogLine> Lines;
+
+	/** Lines that aren't in use */
+	TLockFreePointerListUnordered<FAsyncLogLine, PLATFORM_CACHE_LINE_SIZE> FreeLines;
+
+	/** Lines waiting to be written, oldest first */
+	TLockFreePointerListFIFO<FAsyncLogLine, PLATFORM_CACHE_LINE_SIZE> QueuedLines;
+
+	FThreadSafeCounter NumQueuedLines;
+	FThreadSafeCounter DroppedLines;
+	FThreadSafeCounter StopTaskCounter;
+
+	FEvent* WakeUpEvent;
+	FRunnableThread* Thread;
+
+	/** Number of queued lines after which the thread is woken up early */
+	const int32 WakeUpThreshold;
+
+	volatile bool bAcceptingLines;
+};
 
 /*-----------------------------------------------------------------------------
 	FOutputDeviceRedirector.
@@ -11,11 +170,25 @@
 
 /** Initialization constructor. */
 FOutputDeviceRedirector::FOutputDeviceRedirector()
-:	MasterThreadID(FPlatformTLS::GetCurrentThreadId())
+:	AsyncLogThread(nullptr)
+,	MasterThreadID(FPlatformTLS::GetCurrentThreadId())
 ,	bEnableBacklog(false)
 {
 }
 
+void FOutputDeviceRedirector::StartAsyncLogThread(int32 MaxPendingLines)
+{
+	check(FPlatformTLS::GetCurrentThreadId() == MasterThreadID);
+
+	if (AsyncLogThread == nullptr && FPlatformProcess::SupportsMultithreading())
+	{
+		FAsyncLogThread* NewThread = new FAsyncLogThread(*this, MaxPendingLines);
+
+		FScopeLock ScopeLock(&SynchronizationObject);
+		AsyncLogThread = NewThread;
+	}
+}
+
 FOutputDeviceRedirector* FOutputDeviceRedirector::Get()
 {
 	static FOutputDeviceRedirector Singleton;
@@ -67,6 +240,8 @@ bool FOutputDeviceRedirector::IsRedirectingTo( FOutputDevice* OutputDevice )
  */
 void FOutputDeviceRedirector::UnsynchronizedFlushThreadedLogs( bool bUseAllDevices )
 {
+	UnsynchronizedFlushAsyncLines( bUseAllDevices );
+
 	for(int32 LineIndex = 0;LineIndex < BufferedLines.Num();LineIndex++)
 	{
 		FBufferedLine BufferedLine = BufferedLines[LineIndex];
@@ -84,6 +259,65 @@ void FOutputDeviceRedirector::UnsynchronizedFlushThreadedLogs( bool bUseAllDevic
 	BufferedLines.Empty();
 }
 
+void FOutputDeviceRedirector::UnsynchronizedFlushAsyncLines( bool bUseAllDevices )
+{
+	if( bUseAllDevices )
+	{
+		// These already went to the devices that can be used on any thread
+		for( const FBufferedLine& Line : MasterThreadLines )
+		{
+			for( FOutputDevice* OutputDevice : OutputDevices )
+			{
+				if( !OutputDevice->CanBeUsedOnAnyThread() )
+				{
+					OutputDevice->Serialize( *Line.Data, Line.Verbosity, Line.Category, Line.Time );
+				}
+			}
+		}
+		MasterThreadLines.Empty();
+	}
+
+	if( AsyncLogThread == nullptr )
+	{
+		return;
+	}
+
+	auto SerializeLine = [this, bUseAllDevices]( const TCHAR* Data, ELogVerbosity::Type Verbosity, const FName& Category, double Time )
+	{
+		bool bNeedsMasterThread = false;
+		for( FOutputDevice* OutputDevice : OutputDevices )
+		{
+			if( OutputDevice->CanBeUsedOnAnyThread() || bUseAllDevices )
+			{
+				OutputDevice->Serialize( Data, Verbosity, Category, Time );
+			}
+			else
+			{
+				bNeedsMasterThread = true;
+			}
+		}
+
+		if( bNeedsMasterThread )
+		{
+			new(MasterThreadLines)FBufferedLine( Data, Category, Verbosity, Time );
+		}
+	};
+
+	while( FAsyncLogLine* Line = AsyncLogThread->PopLine() )
+	{
+		SerializeLine( Line->Data, Line->Verbosity, Line->Category, Line->Time );
+		AsyncLogThread->ReleaseLine( Line );
+	}
+
+	const int32 NumDroppedLines = AsyncLogThread->ResetDroppedLines();
+	if( NumDroppedLines > 0 )
+	{
+		static const FName NAME_LogOutputDevice( TEXT("LogOutputDevice") );
+		const FString Message = FString::Printf( TEXT("Dropped %d log lines, the async log thread couldn't keep up"), NumDroppedLines );
+		SerializeLine( *Message, ELogVerbosity::Warning, NAME_LogOutputDevice, FPlatformTime::Seconds() - GStartTime );
+	}
+}
+
 /**
  * Flushes lines buffered by secondary threads.
  */
@@ -167,6 +401,18 @@ void FOutputDeviceRedirector::Serialize( const TCHAR* Data, ELogVerbosity::Type
 {
 	const double RealTime = Time == -1.0f ? FPlatformTime::Seconds() - GStartTime : Time;
 
+	// Fatal errors and the backlog need the line written before returning
+	if( AsyncLogThread && Verbosity != ELogVerbosity::Fatal && !bEnableBacklog )
+	{
+		const FAsyncLogThread::EEnqueueResult Result = AsyncLogThread->Enqueue( Data, Verbosity, Category, RealTime );
+		if( Result == FAsyncLogThread::EEnqueueResult::Queued ||
+			( Result == FAsyncLogThread::EEnqueueResult::Full && Verbosity > ELogVerbosity::Warning ) )
+		{
+			// Dropped lines are reported by the log thread
+			return;
+		}
+	}
+
 	FScopeLock ScopeLock( &SynchronizationObject );
 
 #if PLATFORM_DESKTOP
@@ -240,6 +486,12 @@ void FOutputDeviceRedirector::TearDown()
 {
 	check(FPlatformTLS::GetCurrentThreadId() == MasterThreadID);
 
+	// The log thread takes the lock, stop it before
+	if( AsyncLogThread )
+	{
+		AsyncLogThread->Shutdown();
+	}
+
 	FScopeLock ScopeLock( &SynchronizationObject );
 
 	// Flush previously buffered lines from secondary threads.
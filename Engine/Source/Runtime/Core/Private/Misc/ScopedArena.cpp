@@ -0,0 +1,162 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "Misc/ScopedArena.h"
+#include "HAL/PlatformTLS.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/MemStack.h"
+#include "Misc/OutputDevice.h"
+#include "Stats/Stats.h"
+
+DECLARE_MEMORY_STAT(TEXT("ScopedArena Large Block"), STAT_ScopedArenaLargeBlock, STATGROUP_Memory);
+
+/** TLS slot holding the innermost arena of each thread. */
+static uint32 GetScopedArenaTlsSlot()
+{
+	static uint32 TlsSlot = FPlatformTLS::AllocTlsSlot();
+	return TlsSlot;
+}
+
+FScopedArena::FScopedArena(const TCHAR* InName)
+	: Top(nullptr)
+	, End(nullptr)
+	, LastAllocation(nullptr)
+	, TopChunk(nullptr)
+	, UsedBytes(0)
+	, PeakUsedBytes(0)
+	, ReservedBytes(0)
+	, Name(InName)
+	, Outer(GetCurrent())
+{
+	FPlatformTLS::SetTlsValue(GetScopedArenaTlsSlot(), this);
+}
+
+FScopedArena::~FScopedArena()
+{
+	checkf(GetCurrent() == this, TEXT("Arena '%s' destroyed out of order or on the wrong thread"), Name);
+	FPlatformTLS::SetTlsValue(GetScopedArenaTlsSlot(), Outer);
+
+	FreeChunks(nullptr);
+}
+
+FScopedArena* FScopedArena::GetCurrent()
+{
+	return (FScopedArena*)FPlatformTLS::GetTlsValue(GetScopedArenaTlsSlot());
+}
+
+void* FScopedArena::Realloc(void* Ptr, SIZE_T OldSize, SIZE_T NewSize, uint32 Alignment)
+{
+	if (!Ptr)
+	{
+		return Alloc(NewSize, Alignment);
+	}
+
+	// The most recent allocation can simply move the top, as long as it stays inside the chunk
+	if ((uint8*)Ptr == LastAllocation && (uint8*)Ptr + NewSize <= End)
+	{
+		Top = (uint8*)Ptr + NewSize;
+		UsedBytes = UsedBytes - OldSize + NewSize;
+		PeakUsedBytes = FMath::Max(PeakUsedBytes, UsedBytes);
+		return Ptr;
+	}
+
+	void* Result = Alloc(NewSize, Alignment);
+	FMemory::Memcpy(Result, Ptr, FMath::Min(OldSize, NewSize));
+	UsedBytes -= OldSize;
+	return Result;
+}
+
+void FScopedArena::Free(void* Ptr, SIZE_T Size)
+{
+	if (Ptr)
+	{
+		if ((uint8*)Ptr == LastAllocation)
+		{
+			Top = LastAllocation;
+			LastAllocation = nullptr;
+		}
+		UsedBytes -= Size;
+	}
+}
+
+void FScopedArena::Reset()
+{
+	if (TopChunk)
+	{
+		FChunk* FirstChunk = TopChunk;
+		while (FirstChunk->Next)
+		{
+			FirstChunk = FirstChunk->Next;
+		}
+		FreeChunks(FirstChunk);
+	}
+
+	LastAllocation = nullptr;
+	UsedBytes = 0;
+}
+
+void FScopedArena::AllocateNewChunk(SIZE_T MinSize)
+{
+	const SIZE_T TotalSize = MinSize + sizeof(FChunk);
+	const SIZE_T AllocSize = Align(TotalSize, (SIZE_T)FPageAllocator::PageSize);
+
+	FChunk* Chunk;
+	if (AllocSize == FPageAllocator::PageSize)
+	{
+		Chunk = (FChunk*)FPageAllocator::Alloc();
+	}
+	else
+	{
+		Chunk = (FChunk*)FMemory::Malloc(AllocSize);
+		INC_MEMORY_STAT_BY(STAT_ScopedArenaLargeBlock, AllocSize);
+	}
+	Chunk->DataSize = AllocSize - sizeof(FChunk);
+	ReservedBytes += AllocSize;
+
+	Chunk->Next = TopChunk;
+	TopChunk    = Chunk;
+	Top         = Chunk->Data();
+	End         = Top + Chunk->DataSize;
+}
+
+void FScopedArena::FreeChunks(FChunk* LastChunk)
+{
+	while (TopChunk != LastChunk)
+	{
+		FChunk* RemoveChunk = TopChunk;
+		TopChunk = TopChunk->Next;
+
+		const SIZE_T ChunkSize = RemoveChunk->DataSize + sizeof(FChunk);
+		if (ChunkSize == FPageAllocator::PageSize)
+		{
+			FPageAllocator::Free(RemoveChunk);
+		}
+		else
+		{
+			DEC_MEMORY_STAT_BY(STAT_ScopedArenaLargeBlock, ChunkSize);
+			FMemory::Free(RemoveChunk);
+		}
+		ReservedBytes -= ChunkSize;
+	}
+
+	Top = nullptr;
+	End = nullptr;
+	if (TopChunk)
+	{
+		Top = TopChunk->Data();
+		End = Top + TopChunk->DataSize;
+	}
+}
+
+void FScopedArena::DumpStats(FOutputDevice& Ar)
+{
+	for (FScopedArena* Arena = GetCurrent(); Arena; Arena = Arena->Outer)
+	{
+		Ar.Logf(TEXT("Arena '%s': %llu bytes used, %llu bytes peak, %llu bytes reserved"), Arena->Name, (uint64)Arena->UsedBytes, (uint64)Arena->PeakUsedBytes, (uint64)Arena->ReservedBytes);
+	}
+}
+
+static FAutoConsoleCommandWithOutputDevice GDumpScopedArenasCmd(
+	TEXT("ScopedArena.Dump"),
+	TEXT("Logs the usage and high-water mark of the arenas alive on the game thread."),
+	FConsoleCommandWithOutputDeviceDelegate::CreateStatic(&FScopedArena::DumpStats)
+	);
@@ -10,6 +10,9 @@
 #include "Misc/ScopeExit.h"
 #include "Modules/ModuleVersion.h"
 #include "Misc/ScopeLock.h"
+#include "Misc/FileHelper.h"
+#include "Misc/CommandLine.h"
+#include "Async/ParallelFor.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogModuleManager, Log, All);
 
@@ -376,11 +379,45 @@ TSharedPtr<IModuleInterface> FModuleManager::LoadModuleWithFailureReason(const F
 
 	if (ModuleInfo->Module.IsValid())
 	{
+		// Whoever loads a module deferred for parallel startup depends on it, so it has to be started up now
+		if (PendingParallelStartups.Remove(InModuleName) > 0)
+		{
+			ModuleInfo->Module->StartupModule();
+			OnModuleStartedUp(InModuleName, *ModuleInfo);
+		}
+
 		// Assign the already loaded module into the return value, otherwise the return value gives the impression the module failed load!
 		LoadedModule = ModuleInfo->Module;
 	}
 	else
 	{
+		// Record the load timing, excluding time spent loading other modules from within this one
+		const double LoadStartTime = FPlatformTime::Seconds();
+		double StartupStartTime = 0.0;
+		double DependencyTime = 0.0;
+		double DependencyTimeBeforeStartup = 0.0;
+		double* const OuterDependencyTime = CurrentDependencyTime;
+		CurrentDependencyTime = &DependencyTime;
+		ON_SCOPE_EXIT
+		{
+			CurrentDependencyTime = OuterDependencyTime;
+
+			const double LoadEndTime = FPlatformTime::Seconds();
+			if (OuterDependencyTime)
+			{
+				*OuterDependencyTime += LoadEndTime - LoadStartTime;
+			}
+
+			if (LoadedModule.IsValid() && StartupStartTime > 0.0)
+			{
+				FModuleLoadTiming& Timing = ModuleLoadTimings[ModuleLoadTimings.AddUninitialized()];
+				Timing.ModuleName = InModuleName;
+				Timing.LoadTime = StartupStartTime - LoadStartTime - DependencyTimeBeforeStartup;
+				Timing.StartupTime = LoadEndTime - StartupStartTime - (DependencyTime - DependencyTimeBeforeStartup);
+				Timing.DependencyTime = DependencyTime;
+				Timing.bParallelStartup = false;
+			}
+		};
 		// Make sure this isn't a module that we had previously loaded, and then unloaded at shutdown time.
 		//
 		// If this assert goes off, your trying to load a module during the shutdown phase that was already
@@ -396,17 +433,14 @@ TSharedPtr<IModuleInterface> FModuleManager::LoadModuleWithFailureReason(const F
 			const FInitializeStaticallyLinkedModule& ModuleInitializer(*ModuleInitializerPtr);
 
 			// Initialize the module!
+			StartupStartTime = FPlatformTime::Seconds();
+			DependencyTimeBeforeStartup = DependencyTime;
 			ModuleInfo->Module = MakeShareable(ModuleInitializer.Execute());
 
 			if (ModuleInfo->Module.IsValid())
 			{
 				// Startup the module
-				ModuleInfo->Module->StartupModule();
-				// The module might try to load other dependent modules in StartupModule. In this case, we want those modules shut down AFTER this one because we may still depend on the module at shutdown.
-				ModuleInfo->LoadOrder = FModuleInfo::CurrentLoadOrder++;
-
-				// Module was started successfully!  Fire callbacks.
-				ModulesChangedEvent.Broadcast(InModuleName, EModuleChangeReason::ModuleLoaded);
+				StartupModule(InModuleName, *ModuleInfo);
 
 				// Set the return parameter
 				LoadedModule = ModuleInfo->Module;
@@ -487,17 +521,14 @@ TSharedPtr<IModuleInterface> FModuleManager::LoadModuleWithFailureReason(const F
 							else
 							{
 								// Initialize the module!
+								StartupStartTime = FPlatformTime::Seconds();
+								DependencyTimeBeforeStartup = DependencyTime;
 								ModuleInfo->Module = MakeShareable(InitializeModuleFunctionPtr());
 
 								if ( ModuleInfo->Module.IsValid() )
 								{
 									// Startup the module
-									ModuleInfo->Module->StartupModule();
-									// The module might try to load other dependent modules in StartupModule. In this case, we want those modules shut down AFTER this one because we may still depend on the module at shutdown.
-									ModuleInfo->LoadOrder = FModuleInfo::CurrentLoadOrder++;
-
-									// Module was started successfully!  Fire callbacks.
-									ModulesChangedEvent.Broadcast(InModuleName, EModuleChangeReason::ModuleLoaded);
+									StartupModule(InModuleName, *ModuleInfo);
 
 									// Set the return parameter
 									LoadedModule = ModuleInfo->Module;
@@ -546,6 +577,117 @@ TSharedPtr<IModuleInterface> FModuleManager::LoadModuleWithFailureReason(const F
 }
 
 
+void FModuleManager::StartupModule(const FName InModuleName, FModuleInfo& ModuleInfo)
+{
+	if (ParallelStartupDepth > 0 && ModuleInfo.Module->SupportsParallelStartup())
+	{
+		PendingParallelStartups.Add(InModuleName);
+		return;
+	}
+
+	ModuleInfo.Module->StartupModule();
+	OnModuleStartedUp(InModuleName, ModuleInfo);
+}
+
+
+void FModuleManager::OnModuleStartedUp(const FName InModuleName, FModuleInfo& ModuleInfo)
+{
+	// The module might try to load other dependent modules in StartupModule. In this case, we want those modules shut down AFTER this one because we may still depend on the module at shutdown.
+	ModuleInfo.LoadOrder = FModuleInfo::CurrentLoadOrder++;
+
+	// Module was started successfully!  Fire callbacks.
+	ModulesChangedEvent.Broadcast(InModuleName, EModuleChangeReason::ModuleLoaded);
+}
+
+
+void FModuleManager::BeginParallelStartup()
+{
+	check(IsInGameThread());
+
+	static const bool bAllowParallelStartup = !FParse::Param(FCommandLine::Get(), TEXT("NoParallelModuleStartup"));
+	if (bAllowParallelStartup)
+	{
+		ParallelStartupDepth++;
+	}
+}
+
+
+void FModuleManager::EndParallelStartup()
+{
+	check(IsInGameThread());
+
+	// Nested loading phases leave it to the outermost one
+	if (ParallelStartupDepth == 0 || --ParallelStartupDepth > 0 || PendingParallelStartups.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<FName> ModuleNames = MoveTemp(PendingParallelStartups);
+	PendingParallelStartups.Reset();
+
+	TArray<ModuleInfoPtr> ModuleInfos;
+	for (const FName ModuleName : ModuleNames)
+	{
+		ModuleInfos.Add(FindModule(ModuleName));
+	}
+
+	TArray<double> StartupTimes;
+	StartupTimes.AddZeroed(ModuleInfos.Num());
+
+	UE_LOG(LogModuleManager, Verbose, TEXT("ModuleManager: Starting up %d modules in parallel"), ModuleInfos.Num());
+
+	ParallelFor(ModuleInfos.Num(), [&ModuleInfos, &StartupTimes](int32 Index)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		ModuleInfos[Index]->Module->StartupModule();
+		StartupTimes[Index] = FPlatformTime::Seconds() - StartTime;
+	}, !FTaskGraphInterface::IsRunning());
+
+	for (int32 Index = 0; Index < ModuleInfos.Num(); Index++)
+	{
+		OnModuleStartedUp(ModuleNames[Index], *ModuleInfos[Index]);
+
+		for (int32 TimingIndex = ModuleLoadTimings.Num() - 1; TimingIndex >= 0; TimingIndex--)
+		{
+			FModuleLoadTiming& Timing = ModuleLoadTimings[TimingIndex];
+			if (Timing.ModuleName == ModuleNames[Index])
+			{
+				Timing.StartupTime += StartupTimes[Index];
+				Timing.bParallelStartup = true;
+				break;
+			}
+		}
+	}
+}
+
+
+bool FModuleManager::WriteModuleStartupReport(const FString& Filename) const
+{
+	TArray<FModuleLoadTiming> SortedTimings = ModuleLoadTimings;
+	SortedTimings.Sort([](const FModuleLoadTiming& A, const FModuleLoadTiming& B)
+	{
+		return A.LoadTime + A.StartupTime > B.LoadTime + B.StartupTime;
+	});
+
+	double TotalTime = 0.0;
+	FString Report = TEXT("Module,LoadMS,StartupMS,DependencyMS,ParallelStartup\n");
+	for (const FModuleLoadTiming& Timing : SortedTimings)
+	{
+		Report += FString::Printf(TEXT("%s,%.2f,%.2f,%.2f,%d\n"), *Timing.ModuleName.ToString(), Timing.LoadTime * 1000.0, Timing.StartupTime * 1000.0, Timing.DependencyTime * 1000.0, Timing.bParallelStartup ? 1 : 0);
+		TotalTime += Timing.LoadTime + Timing.StartupTime;
+	}
+
+	if (!FFileHelper::SaveStringToFile(Report, *Filename))
+	{
+		UE_LOG(LogModuleManager, Warning, TEXT("ModuleManager: Failed to write the module startup report to %s"), *Filename);
+		return false;
+	}
+
+	UE_LOG(LogModuleManager, Display, TEXT("ModuleManager: Wrote load timings of %d modules (%.2f ms) to %s"), SortedTimings.Num(), TotalTime * 1000.0, *Filename);
+	return true;
+}
+
+
 bool FModuleManager::UnloadModule( const FName InModuleName, bool bIsShutdown )
 {
 	// Do we even know about this module?
@@ -713,8 +855,32 @@ bool FModuleManager::Exec( UWorld* Inworld, const TCHAR* Cmd, FOutputDevice& Ar
 #if !UE_BUILD_SHIPPING
 	if ( FParse::Command( &Cmd, TEXT( "Module" ) ) )
 	{
+		// Timings [Count]
+		if( FParse::Command( &Cmd, TEXT( "Timings" ) ) )
+		{
+			TArray<FModuleLoadTiming> SortedTimings = ModuleLoadTimings;
+			SortedTimings.Sort([](const FModuleLoadTiming& A, const FModuleLoadTiming& B)
+			{
+				return A.LoadTime + A.StartupTime > B.LoadTime + B.StartupTime;
+			});
+
+			const FString CountStr = FParse::Token( Cmd, 0 );
+			const int32 Count = CountStr.IsEmpty() ? 20 : FCString::Atoi( *CountStr );
+
+			Ar.Logf( TEXT( "Slowest of %i loaded modules:" ), SortedTimings.Num() );
+			for( int32 Index = 0; Index < FMath::Min( Count, SortedTimings.Num() ); Index++ )
+			{
+				const FModuleLoadTiming& Timing = SortedTimings[Index];
+				Ar.Logf( TEXT( "    %s [Load: %.2f ms] [Startup: %.2f ms] [Dependencies: %.2f ms]%s" ),
+					*Timing.ModuleName.ToString(), Timing.LoadTime * 1000.0, Timing.StartupTime * 1000.0, Timing.DependencyTime * 1000.0,
+					Timing.bParallelStartup ? TEXT( " [Parallel]" ) : TEXT( "" ) );
+			}
+
+			return true;
+		}
+
 		// List
-		if( FParse::Command( &Cmd, TEXT( "List" ) ) )
+		else if( FParse::Command( &Cmd, TEXT( "List" ) ) )
 		{
 			if( Modules.Num() > 0 )
 			{
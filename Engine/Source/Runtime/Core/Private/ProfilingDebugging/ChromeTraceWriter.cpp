@@ -0,0 +1,114 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "ProfilingDebugging/ChromeTraceWriter.h"
+#include "Serialization/Archive.h"
+#include "Containers/StringConv.h"
+
+namespace ChromeTraceWriter
+{
+	/** Size at which the buffered text is written to the archive */
+	static const int32 FlushSize = 64 * 1024;
+}
+
+FChromeTraceWriter::FChromeTraceWriter(FArchive& InAr)
+	: Ar(InAr)
+	, NumEvents(0)
+	, bClosed(false)
+{
+	Buffer.Reserve(ChromeTraceWriter::FlushSize + 1024);
+	Append(TEXT("{\"traceEvents\":["));
+}
+
+FChromeTraceWriter::~FChromeTraceWriter()
+{
+	Close();
+}
+
+void FChromeTraceWriter::WriteThreadName(uint32 ThreadId, const FString& Name)
+{
+	AppendEvent(FString::Printf(TEXT("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}}"), ThreadId, *EscapeString(Name)));
+}
+
+void FChromeTraceWriter::WriteBeginEvent(const FString& Name, uint32 ThreadId, double Timestamp)
+{
+	AppendEvent(FString::Printf(TEXT("{\"name\":\"%s\",\"ph\":\"B\",\"pid\":1,\"tid\":%u,\"ts\":%.3f}"), *EscapeString(Name), ThreadId, Timestamp));
+}
+
+void FChromeTraceWriter::WriteEndEvent(uint32 ThreadId, double Timestamp)
+{
+	AppendEvent(FString::Printf(TEXT("{\"ph\":\"E\",\"pid\":1,\"tid\":%u,\"ts\":%.3f}"), ThreadId, Timestamp));
+}
+
+void FChromeTraceWriter::WriteCompleteEvent(const FString& Name, uint32 ThreadId, double Timestamp, double Duration)
+{
+	AppendEvent(FString::Printf(TEXT("{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}"), *EscapeString(Name), ThreadId, Timestamp, Duration));
+}
+
+void FChromeTraceWriter::WriteInstantEvent(const FString& Name, uint32 ThreadId, double Timestamp)
+{
+	AppendEvent(FString::Printf(TEXT("{\"name\":\"%s\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":%u,\"ts\":%.3f}"), *EscapeString(Name), ThreadId, Timestamp));
+}
+
+void FChromeTraceWriter::Close()
+{
+	if (!bClosed)
+	{
+		Append(TEXT("\n]}\n"));
+		FlushBuffer();
+		bClosed = true;
+	}
+}
+
+void FChromeTraceWriter::AppendEvent(const FString& Event)
+{
+	check(!bClosed);
+
+	Append(NumEvents ? TEXT(",\n") : TEXT("\n"));
+	Append(Event);
+	++NumEvents;
+
+	if (Buffer.Num() >= ChromeTraceWriter::FlushSize)
+	{
+		FlushBuffer();
+	}
+}
+
+void FChromeTraceWriter::Append(const FString& Text)
+{
+	FTCHARToUTF8 Converted(*Text);
+	Buffer.Append((const ANSICHAR*)Converted.Get(), Converted.Length());
+}
+
+void FChromeTraceWriter::FlushBuffer()
+{
+	if (Buffer.Num())
+	{
+		Ar.Serialize(Buffer.GetData(), Buffer.Num());
+		Buffer.Reset();
+	}
+}
+
+FString FChromeTraceWriter::EscapeString(const FString& Name)
+{
+	FString Result;
+	Result.Reserve(Name.Len());
+
+	for (const TCHAR Char : Name)
+	{
+		if (Char == TEXT('"') || Char == TEXT('\\'))
+		{
+			Result += TEXT('\\');
+			Result += Char;
+		}
+		else if (Char < 0x20)
+		{
+			Result += FString::Printf(TEXT("\\u%04x"), (uint32)Char);
+		}
+		else
+		{
+			Result += Char;
+		}
+	}
+
+	return Result;
+}
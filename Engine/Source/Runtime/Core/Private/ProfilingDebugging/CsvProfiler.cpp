@@ -0,0 +1,300 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "HAL/PlatformAtomics.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/Paths.h"
+#include "Misc/DateTime.h"
+#include "Misc/Parse.h"
+#include "Misc/CommandLine.h"
+#include "Misc/OutputDeviceFile.h"
+#include "Containers/StringConv.h"
+#include "Templates/UniquePtr.h"
+#include "CoreGlobals.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogCsvProfiler, Log, All);
+
+volatile int32 FCsvProfiler::bCapturing = 0;
+
+namespace CsvProfiler
+{
+	static FORCEINLINE double ToDouble(int64 Bits)
+	{
+		double Value;
+		FMemory::Memcpy(&Value, &Bits, sizeof(Value));
+		return Value;
+	}
+
+	static FORCEINLINE int64 ToBits(double Value)
+	{
+		int64 Bits;
+		FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+		return Bits;
+	}
+
+	struct FState
+	{
+		FState()
+			: CaptureFrame(0)
+			, FramesToCapture(0)
+		{}
+
+		/** Registered stats, only ever added to */
+		TArray<FCsvStat*> Stats;
+		FCriticalSection StatsCritical;
+
+		/** Events of the current frame */
+		TArray<FString> Events;
+		FCriticalSection EventsCritical;
+
+		/** [GAME THREAD] Capture state */
+		TUniquePtr<FArchive> FileArchive;
+		TUniquePtr<FArchive> AsyncWriter;
+		int32 CaptureFrame;
+		int32 FramesToCapture;
+
+		/** [GAME THREAD] Formatted rows of the frame, kept around to reuse the allocation */
+		FString Rows;
+	};
+
+	static FState& GetState()
+	{
+		static FState State;
+		return State;
+	}
+
+	static void Write(FState& State, const FString& Text)
+	{
+		FTCHARToUTF8 Converted(*Text);
+		State.AsyncWriter->Serialize((void*)Converted.Get(), Converted.Length());
+	}
+}
+
+FCsvStat::FCsvStat(const TCHAR* InName, ECsvStatType InType)
+	: Name(InName)
+	, Type(InType)
+	, Cycles(0)
+	, ValueBits(NoValue)
+{
+}
+
+void FCsvStat::RecordValue(double Value, ECsvCustomStatOp Op)
+{
+	if (!FCsvProfiler::IsCapturing())
+	{
+		return;
+	}
+
+	for (;;)
+	{
+		const int64 OldBits = ValueBits;
+
+		double NewValue = Value;
+		if (OldBits != NoValue)
+		{
+			const double OldValue = CsvProfiler::ToDouble(OldBits);
+			switch (Op)
+			{
+			case ECsvCustomStatOp::Min:			NewValue = FMath::Min(OldValue, Value); break;
+			case ECsvCustomStatOp::Max:			NewValue = FMath::Max(OldValue, Value); break;
+			case ECsvCustomStatOp::Accumulate:	NewValue = OldValue + Value; break;
+			default: break;
+			}
+		}
+
+		if (FPlatformAtomics::InterlockedCompareExchange(&ValueBits, CsvProfiler::ToBits(NewValue), OldBits) == OldBits)
+		{
+			break;
+		}
+	}
+}
+
+FCsvStat& FCsvProfiler::GetStat(const TCHAR* Name, ECsvStatType Type)
+{
+	CsvProfiler::FState& State = CsvProfiler::GetState();
+	FScopeLock Lock(&State.StatsCritical);
+
+	for (FCsvStat* Stat : State.Stats)
+	{
+		if (Stat->Type == Type && FCString::Strcmp(Stat->Name, Name) == 0)
+		{
+			return *Stat;
+		}
+	}
+
+	FCsvStat* Stat = new FCsvStat(Name, Type);
+	State.Stats.Add(Stat);
+	return *Stat;
+}
+
+void FCsvProfiler::BeginCapture(int32 NumFrames)
+{
+	check(IsInGameThread());
+
+	if (IsCapturing())
+	{
+		UE_LOG(LogCsvProfiler, Warning, TEXT("A csv capture is already running"));
+		return;
+	}
+
+	CsvProfiler::FState& State = CsvProfiler::GetState();
+
+	const FString Filename = FPaths::ProfilingDir() / TEXT("CSV") / FString::Printf(TEXT("Profile-%s.csv"), *FDateTime::Now().ToString());
+	State.FileArchive.Reset(IFileManager::Get().CreateFileWriter(*Filename));
+	if (!State.FileArchive)
+	{
+		UE_LOG(LogCsvProfiler, Warning, TEXT("Failed to open %s"), *Filename);
+		return;
+	}
+
+	State.AsyncWriter.Reset(CreateAsyncWriter(*State.FileArchive));
+	State.CaptureFrame = 0;
+	State.FramesToCapture = FMath::Max(NumFrames, 0);
+
+	CsvProfiler::Write(State, TEXT("Frame,Name,Value\n"));
+
+	// Drop whatever was recorded before the capture started
+	{
+		FScopeLock Lock(&State.StatsCritical);
+		for (FCsvStat* Stat : State.Stats)
+		{
+			FPlatformAtomics::InterlockedExchange(&Stat->Cycles, 0);
+			FPlatformAtomics::InterlockedExchange(&Stat->ValueBits, FCsvStat::NoValue);
+		}
+	}
+	{
+		FScopeLock Lock(&State.EventsCritical);
+		State.Events.Reset();
+	}
+
+	FPlatformAtomics::InterlockedExchange(&bCapturing, 1);
+
+	UE_LOG(LogCsvProfiler, Display, TEXT("Started csv capture %s"), *Filename);
+}
+
+void FCsvProfiler::EndCapture()
+{
+	check(IsInGameThread());
+
+	if (!IsCapturing())
+	{
+		return;
+	}
+
+	FPlatformAtomics::InterlockedExchange(&bCapturing, 0);
+
+	CsvProfiler::FState& State = CsvProfiler::GetState();
+	const FString Filename = State.FileArchive->GetArchiveName();
+
+	// The writer flushes everything on destruction, it has to go before the file
+	State.AsyncWriter.Reset();
+	State.FileArchive->Close();
+	State.FileArchive.Reset();
+
+	UE_LOG(LogCsvProfiler, Display, TEXT("Wrote %d frames to csv capture %s"), State.CaptureFrame, *Filename);
+}
+
+void FCsvProfiler::RecordEvent(const FString& Event)
+{
+	if (IsCapturing())
+	{
+		CsvProfiler::FState& State = CsvProfiler::GetState();
+		FScopeLock Lock(&State.EventsCritical);
+		State.Events.Add(Event);
+	}
+}
+
+void FCsvProfiler::EndFrame()
+{
+	check(IsInGameThread());
+
+	static bool bCheckedCommandLine = false;
+	if (!bCheckedCommandLine)
+	{
+		bCheckedCommandLine = true;
+
+		FString Frames;
+		if (FParse::Value(FCommandLine::Get(), TEXT("csvprofile="), Frames))
+		{
+			BeginCapture(FCString::Atoi(*Frames));
+		}
+		else if (FParse::Param(FCommandLine::Get(), TEXT("csvprofile")))
+		{
+			BeginCapture();
+		}
+	}
+
+	if (!IsCapturing())
+	{
+		return;
+	}
+
+	CsvProfiler::FState& State = CsvProfiler::GetState();
+	const int32 Frame = State.CaptureFrame++;
+	const double MillisecondsPerCycle = FPlatformTime::GetSecondsPerCycle64() * 1000.0;
+
+	State.Rows.Reset();
+	{
+		FScopeLock Lock(&State.StatsCritical);
+		for (FCsvStat* Stat : State.Stats)
+		{
+			if (Stat->Type == ECsvStatType::Timing)
+			{
+				const int64 Cycles = FPlatformAtomics::InterlockedExchange(&Stat->Cycles, 0);
+				State.Rows += FString::Printf(TEXT("%d,%s,%.3f\n"), Frame, Stat->Name, Cycles * MillisecondsPerCycle);
+			}
+			else
+			{
+				const int64 Bits = FPlatformAtomics::InterlockedExchange(&Stat->ValueBits, FCsvStat::NoValue);
+				if (Bits != FCsvStat::NoValue)
+				{
+					const double Value = CsvProfiler::ToDouble(Bits);
+					State.Rows += (Value == FMath::FloorToDouble(Value) && FMath::Abs(Value) < 1e15)
+						? FString::Printf(TEXT("%d,%s,%lld\n"), Frame, Stat->Name, (int64)Value)
+						: FString::Printf(TEXT("%d,%s,%.3f\n"), Frame, Stat->Name, Value);
+				}
+			}
+		}
+	}
+
+	TArray<FString> Events;
+	{
+		FScopeLock Lock(&State.EventsCritical);
+		Exchange(Events, State.Events);
+	}
+	for (const FString& Event : Events)
+	{
+		State.Rows += FString::Printf(TEXT("%d,Event,\"%s\"\n"), Frame, *Event.Replace(TEXT("\""), TEXT("\"\"")));
+	}
+
+	CsvProfiler::Write(State, State.Rows);
+
+	if (State.FramesToCapture > 0 && State.CaptureFrame >= State.FramesToCapture)
+	{
+		EndCapture();
+	}
+}
+
+static void HandleCsvProfileCommand(const TArray<FString>& Args)
+{
+	if (Args.Num() > 0 && Args[0] == TEXT("Start"))
+	{
+		FCsvProfiler::BeginCapture(Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 0);
+	}
+	else if (Args.Num() > 0 && Args[0] == TEXT("Stop"))
+	{
+		FCsvProfiler::EndCapture();
+	}
+	else
+	{
+		UE_LOG(LogCsvProfiler, Display, TEXT("Usage: CsvProfile Start [Frames] | CsvProfile Stop"));
+	}
+}
+
+static FAutoConsoleCommand CsvProfileCommand(
+	TEXT("CsvProfile"),
+	TEXT("Start [Frames]: starts writing per frame stats to Saved/Profiling/CSV, optionally stopping after Frames frames.\n")
+	TEXT("Stop: stops the capture."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&HandleCsvProfileCommand));
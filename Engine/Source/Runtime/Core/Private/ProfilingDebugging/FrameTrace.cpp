@@ -0,0 +1,400 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "ProfilingDebugging/FrameTrace.h"
+#include "ProfilingDebugging/ChromeTraceWriter.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTLS.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/PlatformMisc.h"
+#include "HAL/ThreadManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/Paths.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/QueuedThreadPool.h"
+#include "CoreGlobals.h"
+#include "Templates/SharedPointer.h"
+#include "Templates/UniquePtr.h"
+#include "Async/Async.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogFrameTrace, Log, All);
+
+int32 GFrameTraceEnabled = 0;
+static FAutoConsoleVariableRef CVarFrameTraceEnabled(
+	TEXT("trace.Enabled"),
+	GFrameTraceEnabled,
+	TEXT("Records frame trace scopes into per thread ring buffers, see trace.Snapshot.\n")
+	TEXT("0: Disabled (default), 1: Enabled"));
+
+static int32 FrameTraceBufferEvents = 16384;
+static FAutoConsoleVariableRef CVarFrameTraceBufferEvents(
+	TEXT("trace.BufferEvents"),
+	FrameTraceBufferEvents,
+	TEXT("Number of events kept per thread, rounded up to a power of two. Only affects threads that haven't recorded anything yet. Each event takes 16 bytes."));
+
+static float FrameTraceSnapshotSeconds = 5.0f;
+static FAutoConsoleVariableRef CVarFrameTraceSnapshotSeconds(
+	TEXT("trace.SnapshotSeconds"),
+	FrameTraceSnapshotSeconds,
+	TEXT("How many seconds of events trace.Snapshot and hitch snapshots write out by default."));
+
+static int32 FrameTraceSnapshotFormat = 0;
+static FAutoConsoleVariableRef CVarFrameTraceSnapshotFormat(
+	TEXT("trace.SnapshotFormat"),
+	FrameTraceSnapshotFormat,
+	TEXT("File format of trace snapshots.\n")
+	TEXT("0: csv (default), 1: Chrome trace event json, for chrome://tracing or ui.perfetto.dev"));
+
+static float FrameTraceHitchSnapshotMS = 0.0f;
+static FAutoConsoleVariableRef CVarFrameTraceHitchSnapshotMS(
+	TEXT("trace.HitchSnapshotMS"),
+	FrameTraceHitchSnapshotMS,
+	TEXT("When tracing is enabled, automatically writes a snapshot whenever a game thread frame takes longer than this many milliseconds. 0 disables hitch snapshots."));
+
+static float FrameTraceHitchSnapshotCooldown = 60.0f;
+static FAutoConsoleVariableRef CVarFrameTraceHitchSnapshotCooldown(
+	TEXT("trace.HitchSnapshotCooldown"),
+	FrameTraceHitchSnapshotCooldown,
+	TEXT("Minimum number of seconds between two automatic hitch snapshots."));
+
+namespace FrameTrace
+{
+	/** Ring buffer of one thread. Only the owning thread writes to it, readers detect events overwritten while they were copying. */
+	struct FThreadBuffer
+	{
+		FThreadBuffer(uint32 InThreadId, uint32 Capacity)
+			: ThreadId(InThreadId)
+			, Mask(Capacity - 1)
+			, WriteIndex(0)
+		{
+			Events.SetNumUninitialized(Capacity);
+		}
+
+		uint32 ThreadId;
+		uint32 Mask;
+
+		/** Total number of events ever written, the next event goes to WriteIndex & Mask */
+		volatile int64 WriteIndex;
+
+		TArray<FFrameTraceEvent> Events;
+	};
+
+	/** Id reserved for the frame markers, registered before anything else */
+	static const uint32 FrameScopeId = 0;
+
+	struct FState
+	{
+		FState()
+			: TlsSlot(FPlatformTLS::AllocTlsSlot())
+		{
+			ScopeNames.Add(TEXT("Frame"));
+		}
+
+		uint32 TlsSlot;
+
+		/** Buffers of all threads that recorded events, never freed so late readers stay safe */
+		TArray<FThreadBuffer*> Buffers;
+		FCriticalSection BuffersCritical;
+
+		TArray<const TCHAR*> ScopeNames;
+		FCriticalSection ScopeNamesCritical;
+	};
+
+	static FState& GetState()
+	{
+		static FState State;
+		return State;
+	}
+
+	static FThreadBuffer& GetThreadBuffer()
+	{
+		FState& State = GetState();
+
+		FThreadBuffer* Buffer = (FThreadBuffer*)FPlatformTLS::GetTlsValue(State.TlsSlot);
+		if (Buffer == nullptr)
+		{
+			const uint32 Capacity = FMath::RoundUpToPowerOfTwo(FMath::Max(FrameTraceBufferEvents, 16));
+			Buffer = new FThreadBuffer(FPlatformTLS::GetCurrentThreadId(), Capacity);
+
+			{
+				FScopeLock Lock(&State.BuffersCritical);
+				State.Buffers.Add(Buffer);
+			}
+
+			FPlatformTLS::SetTlsValue(State.TlsSlot, Buffer);
+		}
+
+		return *Buffer;
+	}
+
+	/** Writes the events as Chrome trace event json, scopes that began before the snapshot are dropped */
+	static bool WriteChromeTraceFile(const FString& Filename, const TArray<FFrameTraceThreadEvents>& ThreadEvents, const TArray<FString>& ThreadNames, const TArray<const TCHAR*>& ScopeNames, uint64 FirstCycles)
+	{
+		TUniquePtr<FArchive> FileWriter(IFileManager::Get().CreateFileWriter(*Filename));
+		if (!FileWriter)
+		{
+			return false;
+		}
+
+		FChromeTraceWriter Writer(*FileWriter);
+		for (int32 ThreadIndex = 0; ThreadIndex < ThreadEvents.Num(); ++ThreadIndex)
+		{
+			const FFrameTraceThreadEvents& Thread = ThreadEvents[ThreadIndex];
+			Writer.WriteThreadName(Thread.ThreadId, ThreadNames[ThreadIndex]);
+
+			int32 Depth = 0;
+			for (const FFrameTraceEvent& Event : Thread.Events)
+			{
+				const double Timestamp = FPlatformTime::ToMilliseconds64(Event.Cycles - FirstCycles) * 1000.0;
+				if (Event.Type == EFrameTraceEventType::BeginScope)
+				{
+					Writer.WriteBeginEvent(ScopeNames.IsValidIndex(Event.ScopeId) ? ScopeNames[Event.ScopeId] : TEXT("Unknown"), Thread.ThreadId, Timestamp);
+					++Depth;
+				}
+				else if (Event.Type == EFrameTraceEventType::EndScope)
+				{
+					if (Depth > 0)
+					{
+						Writer.WriteEndEvent(Thread.ThreadId, Timestamp);
+						--Depth;
+					}
+				}
+				else
+				{
+					Writer.WriteInstantEvent(ScopeNames[FrameScopeId], Thread.ThreadId, Timestamp);
+				}
+			}
+		}
+		Writer.Close();
+
+		return FileWriter->Close();
+	}
+
+	static void WriteSnapshotFile(const FString& Filename, const TArray<FFrameTraceThreadEvents>& ThreadEvents, const TArray<FString>& ThreadNames, bool bChromeTrace)
+	{
+		uint64 FirstCycles = MAX_uint64;
+		int32 NumEvents = 0;
+		for (const FFrameTraceThreadEvents& Thread : ThreadEvents)
+		{
+			if (Thread.Events.Num())
+			{
+				FirstCycles = FMath::Min(FirstCycles, Thread.Events[0].Cycles);
+				NumEvents += Thread.Events.Num();
+			}
+		}
+
+		static const TCHAR* EventTypeNames[] = { TEXT("Begin"), TEXT("End"), TEXT("Frame") };
+
+		TArray<const TCHAR*> ScopeNames;
+		{
+			FState& State = GetState();
+			FScopeLock Lock(&State.ScopeNamesCritical);
+			ScopeNames = State.ScopeNames;
+		}
+
+		if (bChromeTrace)
+		{
+			if (WriteChromeTraceFile(Filename, ThreadEvents, ThreadNames, ScopeNames, FirstCycles))
+			{
+				UE_LOG(LogFrameTrace, Display, TEXT("Wrote %d trace events to %s"), NumEvents, *Filename);
+			}
+			else
+			{
+				UE_LOG(LogFrameTrace, Warning, TEXT("Failed to write trace snapshot %s"), *Filename);
+			}
+			return;
+		}
+
+		FString Output;
+		Output.Reserve(NumEvents * 48);
+		Output += TEXT("Thread,ThreadId,Scope,Event,TimeMS\n");
+
+		for (int32 ThreadIndex = 0; ThreadIndex < ThreadEvents.Num(); ++ThreadIndex)
+		{
+			const FFrameTraceThreadEvents& Thread = ThreadEvents[ThreadIndex];
+			for (const FFrameTraceEvent& Event : Thread.Events)
+			{
+				Output += FString::Printf(TEXT("%s,%u,%s,%s,%.3f\n"),
+					*ThreadNames[ThreadIndex],
+					Thread.ThreadId,
+					ScopeNames.IsValidIndex(Event.ScopeId) ? ScopeNames[Event.ScopeId] : TEXT("Unknown"),
+					EventTypeNames[(uint32)Event.Type],
+					FPlatformTime::ToMilliseconds64(Event.Cycles - FirstCycles));
+			}
+		}
+
+		if (FFileHelper::SaveStringToFile(Output, *Filename))
+		{
+			UE_LOG(LogFrameTrace, Display, TEXT("Wrote %d trace events to %s"), NumEvents, *Filename);
+		}
+		else
+		{
+			UE_LOG(LogFrameTrace, Warning, TEXT("Failed to write trace snapshot %s"), *Filename);
+		}
+	}
+}
+
+uint32 FFrameTrace::RegisterScope(const TCHAR* Name)
+{
+	FrameTrace::FState& State = FrameTrace::GetState();
+	FScopeLock Lock(&State.ScopeNamesCritical);
+	return State.ScopeNames.Add(Name);
+}
+
+const TCHAR* FFrameTrace::GetScopeName(uint32 ScopeId)
+{
+	FrameTrace::FState& State = FrameTrace::GetState();
+	FScopeLock Lock(&State.ScopeNamesCritical);
+	return State.ScopeNames.IsValidIndex(ScopeId) ? State.ScopeNames[ScopeId] : TEXT("Unknown");
+}
+
+void FFrameTrace::RecordEvent(uint32 ScopeId, EFrameTraceEventType Type)
+{
+	FrameTrace::FThreadBuffer& Buffer = FrameTrace::GetThreadBuffer();
+
+	const int64 Index = Buffer.WriteIndex;
+	FFrameTraceEvent& Event = Buffer.Events.GetData()[Index & Buffer.Mask];
+	Event.Cycles = FPlatformTime::Cycles64();
+	Event.ScopeId = ScopeId;
+	Event.Type = Type;
+
+	// Publish the event only once it is fully written
+	FPlatformMisc::MemoryBarrier();
+	Buffer.WriteIndex = Index + 1;
+}
+
+void FFrameTrace::EndFrame()
+{
+	static uint64 LastFrameCycles = 0;
+	static double LastHitchSnapshotTime = 0.0;
+
+	if (!IsEnabled())
+	{
+		LastFrameCycles = 0;
+		return;
+	}
+
+	RecordEvent(FrameTrace::FrameScopeId, EFrameTraceEventType::Frame);
+
+	const uint64 FrameCycles = FPlatformTime::Cycles64();
+	if (LastFrameCycles != 0 && FrameTraceHitchSnapshotMS > 0.0f)
+	{
+		const double FrameMS = FPlatformTime::ToMilliseconds64(FrameCycles - LastFrameCycles);
+		const double CurrentTime = FPlatformTime::Seconds();
+
+		if (FrameMS > FrameTraceHitchSnapshotMS && (LastHitchSnapshotTime == 0.0 || CurrentTime - LastHitchSnapshotTime > FrameTraceHitchSnapshotCooldown))
+		{
+			UE_LOG(LogFrameTrace, Warning, TEXT("Hitch of %.1f ms detected, writing trace snapshot"), FrameMS);
+
+			LastHitchSnapshotTime = CurrentTime;
+			WriteSnapshot(FrameTraceSnapshotSeconds);
+		}
+	}
+
+	LastFrameCycles = FrameCycles;
+}
+
+void FFrameTrace::GatherEvents(double Seconds, TArray<FFrameTraceThreadEvents>& OutThreadEvents)
+{
+	OutThreadEvents.Reset();
+
+	const uint64 NowCycles = FPlatformTime::Cycles64();
+	const uint64 WindowCycles = (uint64)(FMath::Max(Seconds, 0.0) / FPlatformTime::GetSecondsPerCycle64());
+	const uint64 MinCycles = NowCycles > WindowCycles ? NowCycles - WindowCycles : 0;
+
+	FrameTrace::FState& State = FrameTrace::GetState();
+	FScopeLock Lock(&State.BuffersCritical);
+
+	for (FrameTrace::FThreadBuffer* Buffer : State.Buffers)
+	{
+		const int64 Capacity = (int64)Buffer->Mask + 1;
+
+		const int64 EndIndex = Buffer->WriteIndex;
+		FPlatformMisc::MemoryBarrier();
+
+		const int64 StartIndex = FMath::Max<int64>(EndIndex - Capacity, 0);
+
+		TArray<FFrameTraceEvent> Events;
+		Events.Reserve((int32)(EndIndex - StartIndex));
+		for (int64 Index = StartIndex; Index < EndIndex; ++Index)
+		{
+			Events.Add(Buffer->Events.GetData()[Index & Buffer->Mask]);
+		}
+
+		FPlatformMisc::MemoryBarrier();
+		const int64 WriteIndexAfterCopy = Buffer->WriteIndex;
+
+		// The owning thread kept recording during the copy, anything it may have lapped can't be trusted
+		const int64 FirstValidIndex = FMath::Max(StartIndex, WriteIndexAfterCopy - Capacity);
+
+		FFrameTraceThreadEvents* ThreadEvents = nullptr;
+		for (int64 Index = FirstValidIndex; Index < EndIndex; ++Index)
+		{
+			const FFrameTraceEvent& Event = Events[(int32)(Index - StartIndex)];
+			if (Event.Cycles >= MinCycles)
+			{
+				if (ThreadEvents == nullptr)
+				{
+					ThreadEvents = &OutThreadEvents[OutThreadEvents.AddDefaulted()];
+					ThreadEvents->ThreadId = Buffer->ThreadId;
+					ThreadEvents->Events.Reserve((int32)(EndIndex - Index));
+				}
+				ThreadEvents->Events.Add(Event);
+			}
+		}
+	}
+}
+
+FString FFrameTrace::WriteSnapshot(double Seconds)
+{
+	TSharedRef<TArray<FFrameTraceThreadEvents>, ESPMode::ThreadSafe> ThreadEvents = MakeShareable(new TArray<FFrameTraceThreadEvents>());
+	GatherEvents(Seconds, *ThreadEvents);
+
+	if (ThreadEvents->Num() == 0)
+	{
+		UE_LOG(LogFrameTrace, Display, TEXT("No trace events recorded in the last %.1f seconds%s"), Seconds, IsEnabled() ? TEXT("") : TEXT(", trace.Enabled is off"));
+		return FString();
+	}
+
+	// Thread names are looked up here since threads may be gone by the time the file is written
+	TSharedRef<TArray<FString>, ESPMode::ThreadSafe> ThreadNames = MakeShareable(new TArray<FString>());
+	for (const FFrameTraceThreadEvents& Thread : *ThreadEvents)
+	{
+		FString ThreadName = FThreadManager::Get().GetThreadName(Thread.ThreadId);
+		if (Thread.ThreadId == GGameThreadId)
+		{
+			ThreadName = TEXT("GameThread");
+		}
+		ThreadNames->Add(ThreadName.IsEmpty() ? TEXT("Unnamed") : ThreadName);
+	}
+
+	const bool bChromeTrace = FrameTraceSnapshotFormat == 1;
+	const FString Filename = FPaths::ProfilingDir() / TEXT("Traces") / FString::Printf(TEXT("Trace-%s.%s"), *FDateTime::Now().ToString(), bChromeTrace ? TEXT("json") : TEXT("csv"));
+
+	if (GThreadPool != nullptr && !GIsRequestingExit)
+	{
+		Async<void>(EAsyncExecution::ThreadPool, [Filename, ThreadEvents, ThreadNames, bChromeTrace]()
+		{
+			FrameTrace::WriteSnapshotFile(Filename, *ThreadEvents, *ThreadNames, bChromeTrace);
+		});
+	}
+	else
+	{
+		FrameTrace::WriteSnapshotFile(Filename, *ThreadEvents, *ThreadNames, bChromeTrace);
+	}
+
+	return Filename;
+}
+
+static void HandleFrameTraceSnapshotCommand(const TArray<FString>& Args)
+{
+	const double Seconds = Args.Num() > 0 ? FCString::Atod(*Args[0]) : FrameTraceSnapshotSeconds;
+	FFrameTrace::WriteSnapshot(Seconds);
+}
+
+static FAutoConsoleCommand FrameTraceSnapshotCommand(
+	TEXT("trace.Snapshot"),
+	TEXT("Writes the frame trace events of the last trace.SnapshotSeconds seconds to Saved/Profiling/Traces.\n")
+	TEXT("An optional argument overrides the number of seconds."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&HandleFrameTraceSnapshotCommand));
@@ -0,0 +1,185 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "ProfilingDebugging/PerformanceBaseline.h"
+#include "Math/UnrealMathUtility.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProperties.h"
+#include "Misc/Paths.h"
+#include "Misc/Parse.h"
+#include "Misc/FileHelper.h"
+#include "Misc/CommandLine.h"
+#include "CoreGlobals.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogPerformanceBaseline, Log, All);
+
+static float RegressionThresholdPercent = 5.0f;
+static FAutoConsoleVariableRef CVarRegressionThresholdPercent(
+	TEXT("perf.RegressionThresholdPercent"),
+	RegressionThresholdPercent,
+	TEXT("How much in percent a benchmark metric has to get worse compared to its baseline to be reported as a regression."));
+
+static float RegressionStdErrors = 3.0f;
+static FAutoConsoleVariableRef CVarRegressionStdErrors(
+	TEXT("perf.RegressionStdErrors"),
+	RegressionStdErrors,
+	TEXT("How many standard errors a benchmark metric has to get worse compared to its baseline to be reported as a regression.\n")
+	TEXT("Keeps noisy metrics from being reported when only the percentage threshold is exceeded."));
+
+/** FParse::Value has no double overload */
+static bool ParseDouble(const TCHAR* Stream, const TCHAR* Match, double& OutValue)
+{
+	FString Value;
+	if (FParse::Value(Stream, Match, Value))
+	{
+		OutValue = FCString::Atod(*Value);
+		return true;
+	}
+	return false;
+}
+
+FPerformanceMetricStats FPerformanceMetricStats::FromSamples(const TArray<double>& Samples)
+{
+	FPerformanceMetricStats Stats;
+	Stats.NumSamples = Samples.Num();
+	if (Samples.Num() == 0)
+	{
+		return Stats;
+	}
+
+	double Sum = 0.0;
+	for (double Sample : Samples)
+	{
+		Sum += Sample;
+	}
+	Stats.Mean = Sum / Samples.Num();
+
+	double SquaredDeviations = 0.0;
+	for (double Sample : Samples)
+	{
+		SquaredDeviations += FMath::Square(Sample - Stats.Mean);
+	}
+	Stats.StdDev = Samples.Num() > 1 ? FMath::Sqrt(SquaredDeviations / (Samples.Num() - 1)) : 0.0;
+
+	TArray<double> Sorted = Samples;
+	Sorted.Sort();
+	const int32 Middle = Sorted.Num() / 2;
+	Stats.Median = (Sorted.Num() % 2) ? Sorted[Middle] : 0.5 * (Sorted[Middle - 1] + Sorted[Middle]);
+	Stats.Max = Sorted.Last();
+
+	return Stats;
+}
+
+FPerformanceBaseline::FPerformanceBaseline(const FString& InName)
+	: Filename(FPaths::GameDir() / TEXT("Build/PerformanceBaselines") / ANSI_TO_TCHAR(FPlatformProperties::IniPlatformName()) / InName + TEXT(".txt"))
+{
+	TArray<FString> Lines;
+	if (!FFileHelper::LoadFileToStringArray(Lines, *Filename))
+	{
+		return;
+	}
+
+	// One metric per line, e.g. "FrameTime Mean=16.6 StdDev=0.4 Median=16.5 Max=21.0 NumSamples=900"
+	for (const FString& Line : Lines)
+	{
+		FString Metric;
+		const TCHAR* Stream = *Line;
+		if (!FParse::Token(Stream, Metric, false))
+		{
+			continue;
+		}
+
+		FPerformanceMetricStats Stats;
+		if (ParseDouble(Stream, TEXT("Mean="), Stats.Mean) && FParse::Value(Stream, TEXT("NumSamples="), Stats.NumSamples))
+		{
+			ParseDouble(Stream, TEXT("StdDev="), Stats.StdDev);
+			ParseDouble(Stream, TEXT("Median="), Stats.Median);
+			ParseDouble(Stream, TEXT("Max="), Stats.Max);
+			Metrics.Add(Metric, Stats);
+		}
+		else
+		{
+			UE_LOG(LogPerformanceBaseline, Warning, TEXT("Ignoring malformed line '%s' in %s"), *Line, *Filename);
+		}
+	}
+}
+
+const FPerformanceMetricStats* FPerformanceBaseline::FindMetric(const FString& Metric) const
+{
+	return Metrics.Find(Metric);
+}
+
+void FPerformanceBaseline::SetMetric(const FString& Metric, const FPerformanceMetricStats& Stats)
+{
+	Metrics.Add(Metric, Stats);
+}
+
+EPerformanceComparison FPerformanceBaseline::Compare(const FString& Metric, const FPerformanceMetricStats& Current) const
+{
+	const FPerformanceMetricStats* Baseline = FindMetric(Metric);
+	return Baseline ? Compare(*Baseline, Current) : EPerformanceComparison::NoBaseline;
+}
+
+EPerformanceComparison FPerformanceBaseline::Compare(const FPerformanceMetricStats& Baseline, const FPerformanceMetricStats& Current)
+{
+	if (Baseline.NumSamples == 0 || Current.NumSamples == 0)
+	{
+		return EPerformanceComparison::NoBaseline;
+	}
+
+	const double Difference = Current.Mean - Baseline.Mean;
+	const double StdError = FMath::Sqrt(FMath::Square(Baseline.StdDev) / Baseline.NumSamples + FMath::Square(Current.StdDev) / Current.NumSamples);
+	const double Threshold = FMath::Max(FMath::Abs(Baseline.Mean) * RegressionThresholdPercent / 100.0, StdError * RegressionStdErrors);
+
+	if (Difference > Threshold)
+	{
+		return EPerformanceComparison::Regressed;
+	}
+	else if (Difference < -Threshold)
+	{
+		return EPerformanceComparison::Improved;
+	}
+	return EPerformanceComparison::Unchanged;
+}
+
+bool FPerformanceBaseline::Save() const
+{
+	FString Text;
+	TArray<FString> MetricNames;
+	Metrics.GetKeys(MetricNames);
+	MetricNames.Sort();
+	for (const FString& Metric : MetricNames)
+	{
+		const FPerformanceMetricStats& Stats = Metrics.FindChecked(Metric);
+		Text += FString::Printf(TEXT("%s Mean=%f StdDev=%f Median=%f Max=%f NumSamples=%d") LINE_TERMINATOR,
+			*Metric, Stats.Mean, Stats.StdDev, Stats.Median, Stats.Max, Stats.NumSamples);
+	}
+
+	if (!FFileHelper::SaveStringToFile(Text, *Filename))
+	{
+		UE_LOG(LogPerformanceBaseline, Error, TEXT("Failed to write performance baseline %s"), *Filename);
+		return false;
+	}
+
+	UE_LOG(LogPerformanceBaseline, Display, TEXT("Updated performance baseline %s"), *Filename);
+	return true;
+}
+
+bool FPerformanceBaseline::ShouldUpdateBaselines()
+{
+	return FParse::Param(FCommandLine::Get(), TEXT("UpdatePerformanceBaselines"));
+}
+
+const TCHAR* LexToString(EPerformanceComparison Comparison)
+{
+	switch (Comparison)
+	{
+	case EPerformanceComparison::Unchanged:
+		return TEXT("unchanged");
+	case EPerformanceComparison::Regressed:
+		return TEXT("regressed");
+	case EPerformanceComparison::Improved:
+		return TEXT("improved");
+	default:
+		return TEXT("no baseline");
+	}
+}
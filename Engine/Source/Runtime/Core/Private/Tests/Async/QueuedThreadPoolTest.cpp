@@ -0,0 +1,214 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "CoreTypes.h"
+#include "Containers/Array.h"
+#include "HAL/Event.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/IQueuedWork.h"
+#include "Misc/QueuedThreadPool.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FQueuedThreadPoolPriorityTest, "System.Core.Async.QueuedThreadPool.Priorities", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FQueuedThreadPoolResizeTest, "System.Core.Async.QueuedThreadPool.Resize", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+
+/** Helper types used in the test cases. */
+namespace QueuedThreadPoolTestUtils
+{
+	/** Work that optionally waits for a gate to open, then records that it ran. Order must only be passed when the pool has a single thread. */
+	class FRecordingWork
+		: public IQueuedWork
+	{
+	public:
+
+		FRecordingWork(int32 InId, TArray<int32>* InOrder, FThreadSafeCounter& InNumDone, FEvent* InGate = nullptr)
+			: Id(InId)
+			, Order(InOrder)
+			, NumDone(InNumDone)
+			, Gate(InGate)
+		{ }
+
+		virtual void DoThreadedWork() override
+		{
+			if (Gate)
+			{
+				Gate->Wait();
+			}
+			if (Order)
+			{
+				Order->Add(Id);
+			}
+			FPlatformMisc::MemoryBarrier();
+			NumDone.Increment();
+		}
+
+		virtual void Abandon() override
+		{
+			NumDone.Increment();
+		}
+
+	private:
+
+		int32 Id;
+		TArray<int32>* Order;
+		FThreadSafeCounter& NumDone;
+		FEvent* Gate;
+	};
+
+	/** Waits up to 10 seconds for a number of jobs to finish. */
+	bool WaitForJobs(FThreadSafeCounter& NumDone, int32 NumJobs)
+	{
+		for (int32 Iteration = 0; Iteration < 10000 && NumDone.GetValue() < NumJobs; ++Iteration)
+		{
+			FPlatformProcess::Sleep(0.001f);
+		}
+		return NumDone.GetValue() == NumJobs;
+	}
+}
+
+
+/** Test that queued work starts in priority order and that starved queues get promoted. */
+bool FQueuedThreadPoolPriorityTest::RunTest(const FString& Parameters)
+{
+	using namespace QueuedThreadPoolTestUtils;
+
+	FQueuedThreadPool* Pool = FQueuedThreadPool::Allocate();
+	Pool->Create(1);
+
+	// strict priorities
+	{
+		TArray<int32> Order;
+		FThreadSafeCounter NumDone;
+		FEvent* Gate = FPlatformProcess::GetSynchEventFromPool(true);
+
+		TArray<FRecordingWork> Jobs;
+		Jobs.Reserve(6);
+		Jobs.Emplace(-1, &Order, NumDone, Gate);
+		for (int32 Id = 0; Id < 5; ++Id)
+		{
+			Jobs.Emplace(Id, &Order, NumDone);
+		}
+
+		// the gate occupies the only thread, everything else has to wait in the queues
+		Pool->AddQueuedWork(&Jobs[0]);
+		Pool->AddQueuedWork(&Jobs[1], EQueuedWorkPriority::Low);
+		Pool->AddQueuedWork(&Jobs[2], EQueuedWorkPriority::Normal);
+		Pool->AddQueuedWork(&Jobs[3], EQueuedWorkPriority::High);
+		Pool->AddQueuedWork(&Jobs[4], EQueuedWorkPriority::Lowest);
+		Pool->AddQueuedWork(&Jobs[5], EQueuedWorkPriority::Highest);
+
+		TestEqual(TEXT("Waiting work must be counted per queue"), Pool->GetQueueStats(EQueuedWorkPriority::High).NumQueued, 1);
+
+		Gate->Trigger();
+		TestTrue(TEXT("All jobs must finish"), WaitForJobs(NumDone, 6));
+		FPlatformProcess::ReturnSynchEventToPool(Gate);
+
+		const TArray<int32> ExpectedOrder = { -1, 4, 2, 1, 0, 3 };
+		TestTrue(TEXT("Jobs must start in priority order"), Order == ExpectedOrder);
+		TestEqual(TEXT("Started queues must be empty"), Pool->GetQueueStats(EQueuedWorkPriority::High).NumQueued, 0);
+	}
+
+	// starvation limit
+	IConsoleVariable* StarvationLimitCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("ThreadPool.StarvationLimit"));
+	TestNotNull(TEXT("The starvation limit must be a console variable"), StarvationLimitCVar);
+	if (StarvationLimitCVar)
+	{
+		const int32 OldStarvationLimit = StarvationLimitCVar->GetInt();
+		StarvationLimitCVar->Set(4);
+
+		TArray<int32> Order;
+		FThreadSafeCounter NumDone;
+		FEvent* Gate = FPlatformProcess::GetSynchEventFromPool(true);
+
+		TArray<FRecordingWork> Jobs;
+		Jobs.Reserve(12);
+		Jobs.Emplace(-1, &Order, NumDone, Gate);
+		Jobs.Emplace(100, &Order, NumDone);
+		for (int32 Id = 0; Id < 10; ++Id)
+		{
+			Jobs.Emplace(Id, &Order, NumDone);
+		}
+
+		Pool->AddQueuedWork(&Jobs[0]);
+		Pool->AddQueuedWork(&Jobs[1], EQueuedWorkPriority::Low);
+		for (int32 Index = 2; Index < Jobs.Num(); ++Index)
+		{
+			Pool->AddQueuedWork(&Jobs[Index], EQueuedWorkPriority::High);
+		}
+
+		Gate->Trigger();
+		TestTrue(TEXT("All jobs must finish"), WaitForJobs(NumDone, Jobs.Num()));
+		FPlatformProcess::ReturnSynchEventToPool(Gate);
+
+		TestTrue(TEXT("A starved queue must get a job started once it hits the limit"), Order.Num() == Jobs.Num() && Order[5] == 100);
+		TestEqual(TEXT("Promotions must be counted"), Pool->GetQueueStats(EQueuedWorkPriority::Low).NumPromoted, (uint64)1);
+
+		StarvationLimitCVar->Set(OldStarvationLimit);
+	}
+
+	Pool->Destroy();
+	delete Pool;
+
+	return true;
+}
+
+
+/** Test that pools can grow and shrink while they are busy. */
+bool FQueuedThreadPoolResizeTest::RunTest(const FString& Parameters)
+{
+	using namespace QueuedThreadPoolTestUtils;
+
+	FQueuedThreadPool* Pool = FQueuedThreadPool::Allocate();
+	Pool->Create(1);
+
+	TestTrue(TEXT("Pools must grow"), Pool->SetNumThreads(3) && Pool->GetNumThreads() == 3);
+
+	FThreadSafeCounter NumDone;
+	FEvent* Gate = FPlatformProcess::GetSynchEventFromPool(true);
+
+	TArray<FRecordingWork> Jobs;
+	Jobs.Reserve(6);
+	for (int32 Id = 0; Id < 3; ++Id)
+	{
+		Jobs.Emplace(Id, nullptr, NumDone, Gate);
+	}
+	for (int32 Id = 3; Id < 6; ++Id)
+	{
+		Jobs.Emplace(Id, nullptr, NumDone);
+	}
+
+	// keep every thread busy, then shrink, busy threads must only leave once they are done
+	for (int32 Index = 0; Index < 3; ++Index)
+	{
+		Pool->AddQueuedWork(&Jobs[Index]);
+	}
+	TestTrue(TEXT("Pools must shrink while busy"), Pool->SetNumThreads(1));
+
+	Gate->Trigger();
+	TestTrue(TEXT("Busy jobs must finish"), WaitForJobs(NumDone, 3));
+	FPlatformProcess::ReturnSynchEventToPool(Gate);
+
+	for (int32 Index = 3; Index < 6; ++Index)
+	{
+		Pool->AddQueuedWork(&Jobs[Index]);
+	}
+	TestTrue(TEXT("Shrunk pools must keep running work"), WaitForJobs(NumDone, 6));
+
+	// the last threads to finish may still be on their way back to the pool
+	for (int32 Iteration = 0; Iteration < 10000 && Pool->GetNumThreads() != 1; ++Iteration)
+	{
+		FPlatformProcess::Sleep(0.001f);
+	}
+	TestEqual(TEXT("Busy threads must leave the pool when they are done"), Pool->GetNumThreads(), 1);
+
+	Pool->Destroy();
+	delete Pool;
+
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
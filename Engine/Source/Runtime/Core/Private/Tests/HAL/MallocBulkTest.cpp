@@ -0,0 +1,57 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "CoreTypes.h"
+#include "HAL/UnrealMemory.h"
+#include "Containers/Set.h"
+#include "Templates/AlignmentTemplates.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMallocBulkTest, "System.Core.HAL.MallocBulk", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+
+bool FMallocBulkTest::RunTest(const FString& Parameters)
+{
+	// small blocks come from the pools, large ones from the OS
+	const SIZE_T Sizes[] = { 16, 48, 1000, 100 * 1024 };
+
+	for (SIZE_T Size : Sizes)
+	{
+		void* Blocks[200];
+		const int32 NumBlocks = Size > 1024 ? 3 : ARRAY_COUNT(Blocks);
+		FMemory::MallocBulk(Blocks, NumBlocks, Size);
+
+		TSet<void*> UniqueBlocks;
+		bool bBlocksValid = true;
+		for (int32 Index = 0; Index < NumBlocks; ++Index)
+		{
+			bBlocksValid &= Blocks[Index] != nullptr && IsAligned(Blocks[Index], DEFAULT_ALIGNMENT);
+			if (Blocks[Index])
+			{
+				FMemory::Memset(Blocks[Index], 0xcd, Size);
+				UniqueBlocks.Add(Blocks[Index]);
+			}
+		}
+		TestTrue(FString::Printf(TEXT("Bulk allocated blocks of %d bytes must be valid and aligned"), (int32)Size), bBlocksValid);
+		TestEqual(FString::Printf(TEXT("Bulk allocated blocks of %d bytes must not overlap"), (int32)Size), UniqueBlocks.Num(), NumBlocks);
+
+		// free every other block and the rest with a gap of null pointers
+		for (int32 Index = 0; Index < NumBlocks; Index += 2)
+		{
+			FMemory::Free(Blocks[Index]);
+			Blocks[Index] = nullptr;
+		}
+		FMemory::FreeBulk(Blocks, NumBlocks);
+	}
+
+	// mixed sizes can be freed together
+	{
+		void* Blocks[4] = { FMemory::Malloc(16), FMemory::Malloc(500), FMemory::Malloc(100 * 1024), nullptr };
+		FMemory::FreeBulk(Blocks, ARRAY_COUNT(Blocks));
+	}
+
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
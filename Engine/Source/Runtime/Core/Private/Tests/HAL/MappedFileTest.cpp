@@ -0,0 +1,64 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "CoreTypes.h"
+#include "Containers/Array.h"
+#include "HAL/PlatformFilemanager.h"
+#include "Async/MappedFileHandle.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMappedFileTest, "System.Core.HAL.MappedFile", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+
+bool FMappedFileTest::RunTest(const FString& Parameters)
+{
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+	// spans several pages so regions have to deal with unaligned offsets
+	TArray<uint8> Contents;
+	Contents.AddUninitialized(200 * 1024 + 17);
+	for (int32 Index = 0; Index < Contents.Num(); ++Index)
+	{
+		Contents[Index] = uint8(Index * 7 + Index / 256);
+	}
+
+	const FString Filename = FPaths::AutomationTransientDir() / TEXT("MappedFileTest.bin");
+	TestTrue(TEXT("The test file must be written"), FFileHelper::SaveArrayToFile(Contents, *Filename));
+
+	IMappedFileHandle* Handle = PlatformFile.OpenMapped(*Filename);
+	if (!Handle)
+	{
+		// mapping is optional, nothing else to test on platforms without it
+		AddInfo(TEXT("Memory mapped files are not supported by the current platform file."));
+	}
+	else
+	{
+		TestEqual(TEXT("Mapped files must know their size"), Handle->GetFileSize(), (int64)Contents.Num());
+
+		IMappedFileRegion* WholeFile = Handle->MapRegion();
+		TestTrue(TEXT("Whole files must map"), WholeFile && WholeFile->GetMappedSize() == Contents.Num() && FMemory::Memcmp(WholeFile->GetMappedPtr(), Contents.GetData(), Contents.Num()) == 0);
+
+		const int64 Offset = 70000 + 3;
+		IMappedFileRegion* Region = Handle->MapRegion(Offset, 1000, true);
+		TestTrue(TEXT("Regions at unaligned offsets must map the requested bytes"), Region && Region->GetMappedSize() == 1000 && FMemory::Memcmp(Region->GetMappedPtr(), Contents.GetData() + Offset, 1000) == 0);
+
+		IMappedFileRegion* Tail = Handle->MapRegion(Contents.Num() - 10);
+		TestTrue(TEXT("Regions must be clamped to the end of the file"), Tail && Tail->GetMappedSize() == 10);
+
+		delete Tail;
+		delete Region;
+		delete WholeFile;
+		delete Handle;
+	}
+
+	TestNull(TEXT("Missing files must not map"), PlatformFile.OpenMapped(*(FPaths::AutomationTransientDir() / TEXT("MappedFileTestMissing.bin"))));
+
+	PlatformFile.DeleteFile(*Filename);
+
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
@@ -16,6 +16,9 @@
 #include "Math/RotationMatrix.h"
 #include "Math/Quat.h"
 #include "Math/QuatRotationTranslationMatrix.h"
+#include "Math/Transform.h"
+#include "Math/BoxSphereBounds.h"
+#include "Containers/ArrayView.h"
 #include "Misc/AutomationTest.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
@@ -1114,6 +1117,49 @@ bool FVectorRegisterAbstractionTest::RunTest(const FString& Parameters)
 	V2 = TestVectorTransformVector(V0, &M1);
 	LogTest( TEXT("VectorTransformVector"), TestVectorsEqual( V1, V2 ) );
 
+	// Batch transforms should match transforming one by one
+	{
+		const FTransform BatchTransform(FRotator(30.0f, -45.0f, 60.0f), FVector(100.0f, -200.0f, 300.0f), FVector(2.0f, 0.5f, -1.5f));
+
+		TArray<FVector> Positions;
+		TArray<FBoxSphereBounds> Bounds;
+		for (int32 Index = 0; Index < 13; ++Index)
+		{
+			const FVector Position(Index * 10.0f - 50.0f, Index * -3.0f, Index * Index * 0.5f);
+			Positions.Add(Position);
+			Bounds.Add(FBoxSphereBounds(Position, FVector(Index + 1.0f, 2.0f, Index * 0.25f), Index + 3.0f));
+		}
+
+		TArray<FVector> TransformedPositions;
+		TransformedPositions.AddUninitialized(Positions.Num());
+		BatchTransform.TransformPositions(Positions, TransformedPositions);
+
+		bool bPositionsEqual = true;
+		for (int32 Index = 0; Index < Positions.Num(); ++Index)
+		{
+			bPositionsEqual &= TestFVector3Equal(TransformedPositions[Index], BatchTransform.TransformPosition(Positions[Index]), KINDA_SMALL_NUMBER);
+		}
+		LogTest( TEXT("FTransform::TransformPositions"), bPositionsEqual );
+
+		// In place
+		BatchTransform.TransformPositions(Positions, Positions);
+		LogTest( TEXT("FTransform::TransformPositions in place"), Positions == TransformedPositions );
+
+		TArray<FBoxSphereBounds> TransformedBounds;
+		TransformedBounds.AddUninitialized(Bounds.Num());
+		FBoxSphereBounds::TransformBy(BatchTransform, Bounds, TransformedBounds);
+
+		bool bBoundsEqual = true;
+		for (int32 Index = 0; Index < Bounds.Num(); ++Index)
+		{
+			const FBoxSphereBounds Expected = Bounds[Index].TransformBy(BatchTransform);
+			bBoundsEqual &= TestFVector3Equal(TransformedBounds[Index].Origin, Expected.Origin);
+			bBoundsEqual &= TestFVector3Equal(TransformedBounds[Index].BoxExtent, Expected.BoxExtent);
+			bBoundsEqual &= TransformedBounds[Index].SphereRadius == Expected.SphereRadius;
+		}
+		LogTest( TEXT("FBoxSphereBounds::TransformBy array"), bBoundsEqual );
+	}
+
 
 	// NaN / Inf tests
 	const float NaN = sqrtf(-1.0f);
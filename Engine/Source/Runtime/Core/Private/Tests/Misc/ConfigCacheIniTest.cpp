@@ -0,0 +1,57 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "CoreTypes.h"
+#include "Containers/UnrealString.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Serialization/BufferArchive.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/NameAsStringProxyArchive.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FConfigCacheIniTest, "System.Core.Misc.ConfigCacheIni", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+bool FConfigCacheIniTest::RunTest( const FString& Parameters )
+{
+	FConfigFile ConfigFile;
+	ConfigFile.CombineFromBuffer(TEXT("[Section]  \r\n  Key  =  Value  \r\n+Array=First\r\n+Array=Second\r\nQuoted=\"  Spaces \\\"kept\\\"  \"\r\n@Structs=Name\r\n"));
+	ConfigFile.CombineFromBuffer(TEXT("[Section]\n-Array=First\n+Array=Third   \n"));
+
+	FString Value;
+	TestTrue(TEXT("Whitespace around keys and values must be stripped"), ConfigFile.GetString(TEXT("Section"), TEXT("Key"), Value) && Value == TEXT("Value"));
+	TestTrue(TEXT("Whitespace inside quotes must be kept"), ConfigFile.GetString(TEXT("Section"), TEXT("Quoted"), Value) && Value == TEXT("  Spaces \"kept\"  "));
+
+	TArray<FString> Array;
+	ConfigFile.GetArray(TEXT("Section"), TEXT("Array"), Array);
+	TestEqual(TEXT("Array commands must be merged"), Array.Num(), 2);
+	TestTrue(TEXT("Array commands must be merged in order"), Array.Num() == 2 && Array[0] == TEXT("Second") && Array[1] == TEXT("Third"));
+
+	// Binary round trip, as used by the binary config cache
+	FBufferArchive Writer;
+	{
+		FNameAsStringProxyArchive Ar(Writer);
+		ConfigFile.SerializeSections(Ar);
+	}
+
+	FConfigFile LoadedFile;
+	{
+		FMemoryReader Reader(Writer);
+		FNameAsStringProxyArchive Ar(Reader);
+		LoadedFile.SerializeSections(Ar);
+		TestFalse(TEXT("Loading serialized sections must not fail"), Ar.IsError());
+	}
+
+	TestTrue(TEXT("Serialized sections must load identically"), LoadedFile == ConfigFile);
+
+	const FConfigSection* LoadedSection = LoadedFile.Find(TEXT("Section"));
+	TestTrue(TEXT("Array of struct keys must be serialized"), LoadedSection && LoadedSection->ArrayOfStructKeys.FindRef(TEXT("Structs")) == TEXT("Name"));
+
+	Array.Reset();
+	LoadedFile.GetArray(TEXT("Section"), TEXT("Array"), Array);
+	TestTrue(TEXT("Serialized arrays must keep their order"), Array.Num() == 2 && Array[0] == TEXT("Second") && Array[1] == TEXT("Third"));
+
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
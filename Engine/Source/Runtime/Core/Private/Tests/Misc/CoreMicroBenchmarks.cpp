@@ -0,0 +1,127 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "CoreTypes.h"
+#include "Containers/Array.h"
+#include "Containers/Map.h"
+#include "Containers/UnrealString.h"
+#include "Math/RandomStream.h"
+#include "Math/Vector.h"
+#include "Math/Matrix.h"
+#include "Math/RotationTranslationMatrix.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "Misc/MicroBenchmark.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_MICRO_BENCHMARK(FArrayAddBenchmark, "System.Core.Benchmarks.Containers.ArrayAdd")
+
+bool FArrayAddBenchmark::RunTest(const FString& Parameters)
+{
+	return Benchmark(100, []()
+	{
+		TArray<int32> Array;
+		for (int32 Index = 0; Index < 1024; ++Index)
+		{
+			Array.Add(Index);
+		}
+		KeepResult(Array.GetData()[Array.Num() - 1]);
+	});
+}
+
+IMPLEMENT_MICRO_BENCHMARK(FMapFindBenchmark, "System.Core.Benchmarks.Containers.MapFind")
+
+bool FMapFindBenchmark::RunTest(const FString& Parameters)
+{
+	TMap<int32, int32> Map;
+	FRandomStream RandomStream(0x1234);
+	for (int32 Index = 0; Index < 4096; ++Index)
+	{
+		Map.Add(RandomStream.GetUnsignedInt(), Index);
+	}
+
+	TArray<int32> Keys;
+	Map.GetKeys(Keys);
+
+	return Benchmark(100, [&Map, &Keys]()
+	{
+		int32 Sum = 0;
+		for (int32 Key : Keys)
+		{
+			Sum += Map.FindChecked(Key);
+		}
+		KeepResult(Sum);
+	});
+}
+
+IMPLEMENT_MICRO_BENCHMARK(FStringPrintfBenchmark, "System.Core.Benchmarks.Containers.StringPrintf")
+
+bool FStringPrintfBenchmark::RunTest(const FString& Parameters)
+{
+	return Benchmark(1000, []()
+	{
+		const FString String = FString::Printf(TEXT("%s_%d_%f"), TEXT("Benchmark"), 42, 3.14f);
+		KeepResult(String.Len());
+	});
+}
+
+IMPLEMENT_MICRO_BENCHMARK(FMatrixMultiplyBenchmark, "System.Core.Benchmarks.Math.MatrixMultiply")
+
+bool FMatrixMultiplyBenchmark::RunTest(const FString& Parameters)
+{
+	const FMatrix A = FRotationTranslationMatrix(FRotator(10.f, 20.f, 30.f), FVector(1.f, 2.f, 3.f));
+	FMatrix Result = FMatrix::Identity;
+
+	return Benchmark(10000, [&A, &Result]()
+	{
+		Result = Result * A;
+		KeepResult(Result);
+	});
+}
+
+IMPLEMENT_MICRO_BENCHMARK(FVectorNormalizeBenchmark, "System.Core.Benchmarks.Math.VectorNormalize")
+
+bool FVectorNormalizeBenchmark::RunTest(const FString& Parameters)
+{
+	TArray<FVector> Vectors;
+	FRandomStream RandomStream(0x1234);
+	for (int32 Index = 0; Index < 1024; ++Index)
+	{
+		Vectors.Add(RandomStream.GetUnitVector() * RandomStream.FRandRange(1.f, 100.f));
+	}
+
+	return Benchmark(100, [&Vectors]()
+	{
+		FVector Sum = FVector::ZeroVector;
+		for (const FVector& Vector : Vectors)
+		{
+			Sum += Vector.GetSafeNormal();
+		}
+		KeepResult(Sum);
+	});
+}
+
+IMPLEMENT_MICRO_BENCHMARK(FArraySerializeBenchmark, "System.Core.Benchmarks.Serialization.ArraySerialize")
+
+bool FArraySerializeBenchmark::RunTest(const FString& Parameters)
+{
+	TArray<FVector> Vectors;
+	Vectors.Init(FVector(1.f, 2.f, 3.f), 4096);
+
+	TArray<uint8> Bytes;
+	Bytes.Reserve(Vectors.Num() * sizeof(FVector) + 16);
+
+	return Benchmark(10, [&Vectors, &Bytes]()
+	{
+		Bytes.Reset();
+		FMemoryWriter Writer(Bytes);
+		Writer << Vectors;
+
+		TArray<FVector> ReadVectors;
+		FMemoryReader Reader(Bytes);
+		Reader << ReadVectors;
+		KeepResult(ReadVectors.GetData()[ReadVectors.Num() - 1]);
+	});
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
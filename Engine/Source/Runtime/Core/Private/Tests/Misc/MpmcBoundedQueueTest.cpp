@@ -0,0 +1,295 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "CoreTypes.h"
+#include "Containers/MpmcBoundedQueue.h"
+#include "Containers/Queue.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "HAL/ThreadSafeCounter64.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/AutomationTest.h"
+#include "Async/Async.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMpmcBoundedQueueTest, "System.Core.Misc.MpmcBoundedQueue", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMpmcBoundedQueueThreadedTest, "System.Core.Misc.MpmcBoundedQueue (Threaded)", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMpmcBoundedQueueBenchmark, "System.Core.Misc.MpmcBoundedQueue (Benchmark)", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+
+bool FMpmcBoundedQueueTest::RunTest(const FString& Parameters)
+{
+	const uint32 QueueSize = 8;
+
+	// empty queue
+	{
+		TMpmcBoundedQueue<int32> Queue(QueueSize);
+		int32 Value = 0;
+
+		TestEqual(TEXT("Capacity must be rounded up to a power of two"), TMpmcBoundedQueue<int32>(5).Capacity(), 8u);
+		TestEqual(TEXT("Newly created queues must have zero elements"), Queue.Count(), 0u);
+		TestTrue(TEXT("Newly created queues must be empty"), Queue.IsEmpty());
+		TestFalse(TEXT("Removing from an empty queue must fail"), Queue.Dequeue(Value));
+	}
+
+	// full queue
+	{
+		TMpmcBoundedQueue<int32> Queue(QueueSize);
+
+		for (uint32 Index = 0; Index < QueueSize; ++Index)
+		{
+			TestTrue(TEXT("Adding to non-full queue must succeed"), Queue.Enqueue((int32)Index));
+		}
+
+		TestEqual(TEXT("All slots of the queue must be usable"), Queue.Count(), QueueSize);
+		TestFalse(TEXT("Adding to full queue must fail"), Queue.Enqueue(666));
+
+		int32 Value = 0;
+
+		for (uint32 Index = 0; Index < QueueSize; ++Index)
+		{
+			TestTrue(TEXT("Removing from a non-empty queue must succeed"), Queue.Dequeue(Value));
+			TestEqual(TEXT("The removed value must be correct"), Value, (int32)Index);
+		}
+
+		TestTrue(TEXT("A queue that had all items removed must be empty"), Queue.IsEmpty());
+	}
+
+	// wrap around
+	{
+		TMpmcBoundedQueue<int32> Queue(QueueSize);
+		int32 Value = 0;
+
+		for (int32 Index = 0; Index < 100; ++Index)
+		{
+			Queue.Enqueue(Index);
+			Queue.Enqueue(Index + 1000);
+			TestTrue(TEXT("Removing from a non-empty queue must succeed"), Queue.Dequeue(Value) && Value == Index && Queue.Dequeue(Value) && Value == Index + 1000);
+		}
+	}
+
+	// batches
+	{
+		TMpmcBoundedQueue<int32> Queue(QueueSize);
+		int32 Input[QueueSize] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+		int32 Output[QueueSize] = { 0 };
+
+		TestEqual(TEXT("Batches must be enqueued completely if there is room"), Queue.EnqueueBatch(Input, 3), 3u);
+		TestEqual(TEXT("Batches must be enqueued completely if there is room"), Queue.EnqueueBatch(Input + 3, QueueSize - 3), QueueSize - 3);
+		TestEqual(TEXT("Adding a batch to a full queue must fail"), Queue.EnqueueBatch(Input, 1), 0u);
+		TestEqual(TEXT("Removing a batch must return all elements"), Queue.DequeueBatch(Output, QueueSize), QueueSize);
+
+		for (uint32 Index = 0; Index < QueueSize; ++Index)
+		{
+			TestEqual(TEXT("Batches must preserve the order of elements"), Output[Index], (int32)Index);
+		}
+
+		TestTrue(TEXT("A queue that had all batches removed must be empty"), Queue.IsEmpty());
+	}
+
+	// partial batches
+	{
+		TMpmcBoundedQueue<int32> Queue(QueueSize);
+		int32 Input[QueueSize] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+		int32 Output[QueueSize] = { 0 };
+
+		Queue.EnqueueBatch(Input, 3);
+
+		const uint32 NumEnqueued = Queue.EnqueueBatch(Input + 3, QueueSize);
+		TestTrue(TEXT("Batches larger than the free space must be enqueued partially"), NumEnqueued > 0 && NumEnqueued <= QueueSize - 3);
+
+		uint32 NumDequeued = 0;
+
+		while (NumDequeued < 3 + NumEnqueued)
+		{
+			const uint32 NumInBatch = Queue.DequeueBatch(Output + NumDequeued, QueueSize);
+			TestTrue(TEXT("Batches larger than the number of elements must be removed partially"), NumInBatch > 0);
+
+			if (NumInBatch == 0)
+			{
+				break;
+			}
+			NumDequeued += NumInBatch;
+		}
+
+		for (uint32 Index = 0; Index < NumDequeued; ++Index)
+		{
+			TestEqual(TEXT("Partial batches must preserve the order of elements"), Output[Index], (int32)Index);
+		}
+
+		TestEqual(TEXT("Removing a batch from an empty queue must return nothing"), Queue.DequeueBatch(Output, QueueSize), 0u);
+	}
+
+	// non trivial elements
+	{
+		TMpmcBoundedQueue<FString> Queue(QueueSize);
+		FString Value;
+
+		Queue.Enqueue(FString(TEXT("Left in the queue")));
+		Queue.Enqueue(TEXT("Moved"));
+		TestTrue(TEXT("Strings must survive the queue"), Queue.Dequeue(Value) && Value == TEXT("Left in the queue"));
+	}
+
+	return true;
+}
+
+
+namespace MpmcBoundedQueueTestUtils
+{
+	/** Runs producers that push the values 1..NumPerProducer and consumers that pop everything, returns the sum of all popped values. */
+	template<typename PushType, typename PopType>
+	uint64 RunProducersAndConsumers(int32 NumProducers, int32 NumConsumers, int32 NumPerProducer, PushType Push, PopType Pop)
+	{
+		FThreadSafeCounter NumPopped;
+		FThreadSafeCounter64 Sum;
+		TArray<TFuture<void>> Futures;
+		const int32 Total = NumProducers * NumPerProducer;
+
+		for (int32 Producer = 0; Producer < NumProducers; ++Producer)
+		{
+			Futures.Add(Async<void>(EAsyncExecution::Thread, [&Push, NumPerProducer]()
+			{
+				for (int32 Value = 1; Value <= NumPerProducer; ++Value)
+				{
+					while (!Push(Value))
+					{
+						FPlatformProcess::Yield();
+					}
+				}
+			}));
+		}
+
+		for (int32 Consumer = 0; Consumer < NumConsumers; ++Consumer)
+		{
+			Futures.Add(Async<void>(EAsyncExecution::Thread, [&Pop, &NumPopped, &Sum, Total]()
+			{
+				int32 Value = 0;
+
+				while (NumPopped.GetValue() < Total)
+				{
+					if (Pop(Value))
+					{
+						Sum.Add(Value);
+						NumPopped.Increment();
+					}
+					else
+					{
+						FPlatformProcess::Yield();
+					}
+				}
+			}));
+		}
+
+		for (TFuture<void>& Future : Futures)
+		{
+			Future.Wait();
+		}
+
+		return (uint64)Sum.GetValue();
+	}
+}
+
+
+bool FMpmcBoundedQueueThreadedTest::RunTest(const FString& Parameters)
+{
+	const int32 NumProducers = 4;
+	const int32 NumConsumers = 4;
+	const int32 NumPerProducer = 100000;
+	const uint64 ExpectedSum = uint64(NumProducers) * NumPerProducer * (NumPerProducer + 1) / 2;
+
+	// single element operations
+	{
+		TMpmcBoundedQueue<int32> Queue(1024);
+
+		uint64 Sum = MpmcBoundedQueueTestUtils::RunProducersAndConsumers(NumProducers, NumConsumers, NumPerProducer,
+			[&Queue](int32 Value) { return Queue.Enqueue(Value); },
+			[&Queue](int32& OutValue) { return Queue.Dequeue(OutValue); });
+
+		TestEqual(TEXT("Every enqueued element must be dequeued exactly once"), Sum, ExpectedSum);
+		TestTrue(TEXT("The queue must be empty after the test"), Queue.IsEmpty());
+	}
+
+	// batched consumers
+	{
+		TMpmcBoundedQueue<int32> Queue(1024);
+		int32 Batch[32];
+		uint32 BatchNum = 0;
+		uint32 BatchIndex = 0;
+
+		// a single consumer, so the batch is only ever touched by one thread
+		uint64 Sum = MpmcBoundedQueueTestUtils::RunProducersAndConsumers(NumProducers, 1, NumPerProducer,
+			[&Queue](int32 Value) { return Queue.Enqueue(Value); },
+			[&Queue, &Batch, &BatchNum, &BatchIndex](int32& OutValue)
+			{
+				if (BatchIndex == BatchNum)
+				{
+					BatchNum = Queue.DequeueBatch(Batch, ARRAY_COUNT(Batch));
+					BatchIndex = 0;
+				}
+				if (BatchIndex < BatchNum)
+				{
+					OutValue = Batch[BatchIndex++];
+					return true;
+				}
+
+				return false;
+			});
+
+		TestEqual(TEXT("Every element must be dequeued exactly once with batched dequeues"), Sum, ExpectedSum);
+	}
+
+	return true;
+}
+
+
+bool FMpmcBoundedQueueBenchmark::RunTest(const FString& Parameters)
+{
+	const int32 NumProducers = 4;
+	const int32 NumPerProducer = 250000;
+
+	// TQueue only supports a single consumer, so compare both in the many producers, one consumer case it handles
+	{
+		TMpmcBoundedQueue<int32> Queue(4096);
+
+		const double StartTime = FPlatformTime::Seconds();
+		MpmcBoundedQueueTestUtils::RunProducersAndConsumers(NumProducers, 1, NumPerProducer,
+			[&Queue](int32 Value) { return Queue.Enqueue(Value); },
+			[&Queue](int32& OutValue) { return Queue.Dequeue(OutValue); });
+		AddInfo(FString::Printf(TEXT("TMpmcBoundedQueue, %d producers, 1 consumer: %.2f ms"), NumProducers, (FPlatformTime::Seconds() - StartTime) * 1000.0));
+	}
+	{
+		TQueue<int32, EQueueMode::Mpsc> Queue;
+
+		const double StartTime = FPlatformTime::Seconds();
+		MpmcBoundedQueueTestUtils::RunProducersAndConsumers(NumProducers, 1, NumPerProducer,
+			[&Queue](int32 Value) { return Queue.Enqueue(Value); },
+			[&Queue](int32& OutValue) { return Queue.Dequeue(OutValue); });
+		AddInfo(FString::Printf(TEXT("TQueue<Mpsc>, %d producers, 1 consumer: %.2f ms"), NumProducers, (FPlatformTime::Seconds() - StartTime) * 1000.0));
+	}
+
+	// the many consumers case, against the TQueue plus critical section pattern it is meant to replace
+	{
+		TMpmcBoundedQueue<int32> Queue(4096);
+
+		const double StartTime = FPlatformTime::Seconds();
+		MpmcBoundedQueueTestUtils::RunProducersAndConsumers(NumProducers, NumProducers, NumPerProducer,
+			[&Queue](int32 Value) { return Queue.Enqueue(Value); },
+			[&Queue](int32& OutValue) { return Queue.Dequeue(OutValue); });
+		AddInfo(FString::Printf(TEXT("TMpmcBoundedQueue, %d producers, %d consumers: %.2f ms"), NumProducers, NumProducers, (FPlatformTime::Seconds() - StartTime) * 1000.0));
+	}
+	{
+		TQueue<int32, EQueueMode::Mpsc> Queue;
+		FCriticalSection DequeueLock;
+
+		const double StartTime = FPlatformTime::Seconds();
+		MpmcBoundedQueueTestUtils::RunProducersAndConsumers(NumProducers, NumProducers, NumPerProducer,
+			[&Queue](int32 Value) { return Queue.Enqueue(Value); },
+			[&Queue, &DequeueLock](int32& OutValue) { FScopeLock Lock(&DequeueLock); return Queue.Dequeue(OutValue); });
+		AddInfo(FString::Printf(TEXT("TQueue<Mpsc> with a locked dequeue, %d producers, %d consumers: %.2f ms"), NumProducers, NumProducers, (FPlatformTime::Seconds() - StartTime) * 1000.0));
+	}
+
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
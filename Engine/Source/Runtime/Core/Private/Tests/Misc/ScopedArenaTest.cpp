@@ -0,0 +1,96 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "CoreTypes.h"
+#include "Misc/ScopedArena.h"
+#include "Containers/Array.h"
+#include "Containers/Set.h"
+#include "Containers/Map.h"
+#include "Containers/UnrealString.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FScopedArenaTest, "System.Core.Misc.ScopedArena", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+
+bool FScopedArenaTest::RunTest(const FString& Parameters)
+{
+	TestNull(TEXT("There must be no current arena outside of a scope"), FScopedArena::GetCurrent());
+
+	// nesting
+	{
+		FScopedArena OuterArena(TEXT("Outer"));
+		TestEqual(TEXT("A new arena must become the current arena"), FScopedArena::GetCurrent(), &OuterArena);
+
+		{
+			FScopedArena InnerArena(TEXT("Inner"));
+			TestEqual(TEXT("Nested arenas must become the current arena"), FScopedArena::GetCurrent(), &InnerArena);
+		}
+
+		TestEqual(TEXT("Destroying a nested arena must restore the outer arena"), FScopedArena::GetCurrent(), &OuterArena);
+	}
+
+	TestNull(TEXT("Destroying the last arena must clear the current arena"), FScopedArena::GetCurrent());
+
+	// raw allocations
+	{
+		FScopedArena Arena;
+
+		void* First = Arena.Alloc(100, 16);
+		TestTrue(TEXT("Allocations must be aligned"), IsAligned(First, 16));
+		TestEqual(TEXT("Used bytes must track allocations"), Arena.GetUsedBytes(), (SIZE_T)100);
+
+		void* Grown = Arena.Realloc(First, 100, 200, 16);
+		TestEqual(TEXT("The most recent allocation must grow in place"), Grown, First);
+
+		void* Second = Arena.Alloc(64 * 1024 * 4, 16);
+		TestTrue(TEXT("Large allocations must succeed"), Second != nullptr && IsAligned(Second, 16));
+		Arena.Free(Second, 64 * 1024 * 4);
+
+		TestEqual(TEXT("Freed bytes must not count as used"), Arena.GetUsedBytes(), (SIZE_T)200);
+		TestEqual(TEXT("The peak must remember the largest usage"), Arena.GetPeakUsedBytes(), (SIZE_T)(200 + 64 * 1024 * 4));
+
+		Arena.Reset();
+		TestEqual(TEXT("Reset arenas must have nothing in use"), Arena.GetUsedBytes(), (SIZE_T)0);
+		TestTrue(TEXT("Reset arenas must keep a chunk"), Arena.GetReservedBytes() > 0);
+		TestEqual(TEXT("Reset must not forget the peak"), Arena.GetPeakUsedBytes(), (SIZE_T)(200 + 64 * 1024 * 4));
+	}
+
+	// containers
+	{
+		FScopedArena Arena(TEXT("Containers"));
+
+		TArray<int32, TArenaAllocator<>> Array;
+		for (int32 Index = 0; Index < 1000; ++Index)
+		{
+			Array.Add(Index);
+		}
+
+		bool bArrayValid = true;
+		for (int32 Index = 0; Index < 1000; ++Index)
+		{
+			bArrayValid &= (Array[Index] == Index);
+		}
+		TestTrue(TEXT("Arrays growing in an arena must keep their elements"), bArrayValid);
+
+		TArray<int32, TArenaAllocator<>> MovedArray = MoveTemp(Array);
+		TestEqual(TEXT("Moving an arena array must transfer its elements"), MovedArray.Num(), 1000);
+		TestEqual(TEXT("Moving an arena array must leave the source empty"), Array.Num(), 0);
+
+		TSet<int32, DefaultKeyFuncs<int32>, TArenaSetAllocator> Set;
+		TMap<int32, FString, TArenaSetAllocator> Map;
+		for (int32 Index = 0; Index < 100; ++Index)
+		{
+			Set.Add(Index * 3);
+			Map.Add(Index, FString::FromInt(Index));
+		}
+		TestTrue(TEXT("Sets in an arena must find their elements"), Set.Num() == 100 && Set.Contains(297) && !Set.Contains(298));
+		TestTrue(TEXT("Maps in an arena must find their elements"), Map.Num() == 100 && Map.FindRef(42) == TEXT("42"));
+
+		TestTrue(TEXT("Containers must allocate from the arena"), Arena.GetUsedBytes() > 0);
+	}
+
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,98 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "CoreTypes.h"
+#include "Containers/SoAArray.h"
+#include "Math/Vector.h"
+#include "Math/VectorRegister.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSoAArrayTest, "System.Core.Misc.SoAArray", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+
+bool FSoAArrayTest::RunTest(const FString& Parameters)
+{
+	// empty array
+	{
+		TSoAArray<FVector, float, uint8> Array;
+
+		TestEqual(TEXT("Newly created arrays must have zero elements"), Array.Num(), 0);
+		TestTrue(TEXT("Newly created arrays must be empty"), Array.IsEmpty());
+		TestEqual(TEXT("Newly created arrays must not allocate"), Array.GetAllocatedSize(), (SIZE_T)0);
+	}
+
+	// adding, alignment and padding
+	{
+		TSoAArray<FVector, float, uint8> Array;
+
+		for (int32 Index = 0; Index < 37; ++Index)
+		{
+			TestEqual(TEXT("Add must return the index of the new element"), Array.Add(FVector((float)Index), (float)Index, (uint8)Index), Index);
+		}
+
+		TestEqual(TEXT("All elements must be added"), Array.Num(), 37);
+		TestEqual(TEXT("The padded count must be rounded up to the column padding"), Array.GetNumPadded(), 40);
+		TestTrue(TEXT("The capacity must be a multiple of the column padding"), Array.Max() % 4 == 0 && Array.Max() >= 37);
+		TestTrue(TEXT("Columns must be aligned"), IsAligned(Array.GetColumn<0>().GetData(), 16) && IsAligned(Array.GetColumn<1>().GetData(), 16) && IsAligned(Array.GetColumn<2>().GetData(), 16));
+
+		bool bValuesValid = true;
+		for (int32 Index = 0; Index < Array.Num(); ++Index)
+		{
+			bValuesValid &= Array.Get<0>(Index) == FVector((float)Index) && Array.Get<1>(Index) == (float)Index && Array.Get<2>(Index) == (uint8)Index;
+		}
+		TestTrue(TEXT("Values must survive growing the columns"), bValuesValid);
+	}
+
+	// removing
+	{
+		TSoAArray<int32, float> Array;
+
+		for (int32 Index = 0; Index < 8; ++Index)
+		{
+			Array.Add(Index, Index * 0.5f);
+		}
+
+		Array.RemoveAtSwap(2);
+		TestEqual(TEXT("Removing must reduce the number of elements"), Array.Num(), 7);
+		TestTrue(TEXT("Removing must move the last element in its place in every column"), Array.Get<0>(2) == 7 && Array.Get<1>(2) == 3.5f);
+
+		Array.RemoveAtSwap(6);
+		TestTrue(TEXT("Removing the last element must not move anything"), Array.Num() == 6 && Array.Get<0>(5) == 5);
+
+		TSoAArray<int32, float> Copy = Array;
+		Array.Empty();
+		TestTrue(TEXT("Empty must release the allocation"), Array.Num() == 0 && Array.GetAllocatedSize() == 0);
+		TestTrue(TEXT("Copies must be independent"), Copy.Num() == 6 && Copy.Get<0>(2) == 7);
+
+		TSoAArray<int32, float> Moved = MoveTemp(Copy);
+		TestTrue(TEXT("Moving must transfer the elements"), Moved.Num() == 6 && Copy.Num() == 0 && Moved.Get<1>(2) == 3.5f);
+	}
+
+	// vectorized iteration over a column
+	{
+		TSoAArray<FVector, float> Spheres;
+
+		for (int32 Index = 0; Index < 10; ++Index)
+		{
+			Spheres.Add(FVector::ZeroVector, (float)Index);
+		}
+
+		const float* Radii = Spheres.GetColumn<1>().GetData();
+		float Sum = 0.0f;
+		for (int32 Index = 0; Index < Spheres.GetNumPadded(); Index += 4)
+		{
+			MS_ALIGN(16) float Lanes[4] GCC_ALIGN(16);
+			VectorStoreAligned(VectorLoadAligned(Radii + Index), Lanes);
+			for (int32 Lane = 0; Lane < 4 && Index + Lane < Spheres.Num(); ++Lane)
+			{
+				Sum += Lanes[Lane];
+			}
+		}
+		TestEqual(TEXT("Aligned vector loads must see the column values"), Sum, 45.0f);
+	}
+
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,120 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "CoreTypes.h"
+#include "ProfilingDebugging/FrameTrace.h"
+#include "HAL/PlatformTLS.h"
+#include "Misc/AutomationTest.h"
+#include "Async/Async.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFrameTraceTest, "System.Core.ProfilingDebugging.FrameTrace", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+/** Returns the events gathered for the given thread, or nullptr if it has none */
+static const FFrameTraceThreadEvents* FindThreadEvents(const TArray<FFrameTraceThreadEvents>& ThreadEvents, uint32 ThreadId)
+{
+	return ThreadEvents.FindByPredicate([ThreadId](const FFrameTraceThreadEvents& Thread) { return Thread.ThreadId == ThreadId; });
+}
+
+bool FFrameTraceTest::RunTest(const FString& Parameters)
+{
+	const int32 WasEnabled = GFrameTraceEnabled;
+
+	static const uint32 OuterScopeId = FFrameTrace::RegisterScope(TEXT("FrameTraceTest Outer"));
+	static const uint32 InnerScopeId = FFrameTrace::RegisterScope(TEXT("FrameTraceTest Inner"));
+
+	TestNotEqual(TEXT("Scopes must get distinct ids"), OuterScopeId, InnerScopeId);
+	TestEqual(TEXT("Scope names must be kept"), FString(FFrameTrace::GetScopeName(InnerScopeId)), FString(TEXT("FrameTraceTest Inner")));
+
+	// nothing is recorded while disabled
+	{
+		GFrameTraceEnabled = 0;
+
+		TArray<FFrameTraceThreadEvents> Before;
+		FFrameTrace::GatherEvents(60.0, Before);
+		const FFrameTraceThreadEvents* ThreadBefore = FindThreadEvents(Before, FPlatformTLS::GetCurrentThreadId());
+		const int32 NumBefore = ThreadBefore ? ThreadBefore->Events.Num() : 0;
+
+		{
+			FFrameTraceScope Scope(OuterScopeId);
+		}
+
+		TArray<FFrameTraceThreadEvents> After;
+		FFrameTrace::GatherEvents(60.0, After);
+		const FFrameTraceThreadEvents* ThreadAfter = FindThreadEvents(After, FPlatformTLS::GetCurrentThreadId());
+		TestEqual(TEXT("Scopes must not be recorded while tracing is disabled"), ThreadAfter ? ThreadAfter->Events.Num() : 0, NumBefore);
+	}
+
+	GFrameTraceEnabled = 1;
+
+	// nested scopes are recorded in order on the calling thread
+	{
+		{
+			FFrameTraceScope Outer(OuterScopeId);
+			FFrameTraceScope Inner(InnerScopeId);
+		}
+
+		TArray<FFrameTraceThreadEvents> ThreadEvents;
+		FFrameTrace::GatherEvents(60.0, ThreadEvents);
+
+		const FFrameTraceThreadEvents* Thread = FindThreadEvents(ThreadEvents, FPlatformTLS::GetCurrentThreadId());
+		if (TestNotNull(TEXT("Events of the calling thread must be gathered"), Thread) && TestTrue(TEXT("Both scopes must be recorded"), Thread->Events.Num() >= 4))
+		{
+			const FFrameTraceEvent* Last = &Thread->Events.Last() - 3;
+			TestTrue(TEXT("Outer scope must begin first"), Last[0].ScopeId == OuterScopeId && Last[0].Type == EFrameTraceEventType::BeginScope);
+			TestTrue(TEXT("Inner scope must begin second"), Last[1].ScopeId == InnerScopeId && Last[1].Type == EFrameTraceEventType::BeginScope);
+			TestTrue(TEXT("Inner scope must end first"), Last[2].ScopeId == InnerScopeId && Last[2].Type == EFrameTraceEventType::EndScope);
+			TestTrue(TEXT("Outer scope must end last"), Last[3].ScopeId == OuterScopeId && Last[3].Type == EFrameTraceEventType::EndScope);
+			TestTrue(TEXT("Timestamps must not go backwards"), Last[0].Cycles <= Last[1].Cycles && Last[1].Cycles <= Last[2].Cycles && Last[2].Cycles <= Last[3].Cycles);
+		}
+	}
+
+	// other threads get their own buffer
+	{
+		uint32 OtherThreadId = 0;
+		Async<void>(EAsyncExecution::Thread, [&OtherThreadId]()
+		{
+			OtherThreadId = FPlatformTLS::GetCurrentThreadId();
+			FFrameTraceScope Scope(InnerScopeId);
+		}).Wait();
+
+		TArray<FFrameTraceThreadEvents> ThreadEvents;
+		FFrameTrace::GatherEvents(60.0, ThreadEvents);
+
+		const FFrameTraceThreadEvents* Thread = FindThreadEvents(ThreadEvents, OtherThreadId);
+		if (TestNotNull(TEXT("Events of other threads must be gathered"), Thread))
+		{
+			TestEqual(TEXT("Other threads must only contain their own events"), Thread->Events.Num(), 2);
+		}
+	}
+
+	// the ring buffer keeps the newest events once it wraps around
+	{
+		TArray<FFrameTraceThreadEvents> ThreadEvents;
+		FFrameTrace::GatherEvents(60.0, ThreadEvents);
+		const FFrameTraceThreadEvents* Thread = FindThreadEvents(ThreadEvents, FPlatformTLS::GetCurrentThreadId());
+		const int32 NumBefore = Thread ? Thread->Events.Num() : 0;
+
+		// Enough events to wrap any reasonable buffer size
+		const int32 NumEvents = FMath::Max(NumBefore, 1 << 20) + 1;
+		for (int32 Index = 0; Index < NumEvents - 1; ++Index)
+		{
+			FFrameTrace::RecordEvent(OuterScopeId, EFrameTraceEventType::BeginScope);
+		}
+		FFrameTrace::RecordEvent(InnerScopeId, EFrameTraceEventType::EndScope);
+
+		FFrameTrace::GatherEvents(60.0, ThreadEvents);
+		Thread = FindThreadEvents(ThreadEvents, FPlatformTLS::GetCurrentThreadId());
+		if (TestNotNull(TEXT("Events must be gathered after wrapping"), Thread))
+		{
+			TestTrue(TEXT("The buffer must not hold more events than were recorded"), Thread->Events.Num() < NumEvents);
+			TestTrue(TEXT("The newest event must be kept"), Thread->Events.Last().ScopeId == InnerScopeId && Thread->Events.Last().Type == EFrameTraceEventType::EndScope);
+		}
+	}
+
+	GFrameTraceEnabled = WasEnabled;
+
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,63 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "CoreTypes.h"
+#include "Containers/Array.h"
+#include "ProfilingDebugging/PerformanceBaseline.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPerformanceBaselineTest, "System.Core.ProfilingDebugging.PerformanceBaseline", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+bool FPerformanceBaselineTest::RunTest(const FString& Parameters)
+{
+	// summarizing samples
+	{
+		TArray<double> Samples;
+		Samples.Add(4.0);
+		Samples.Add(1.0);
+		Samples.Add(3.0);
+		Samples.Add(2.0);
+
+		const FPerformanceMetricStats Stats = FPerformanceMetricStats::FromSamples(Samples);
+		TestEqual(TEXT("All samples must be counted"), Stats.NumSamples, 4);
+		TestEqual(TEXT("The mean must be the average of the samples"), Stats.Mean, 2.5);
+		TestEqual(TEXT("The median of an even number of samples must average the middle two"), Stats.Median, 2.5);
+		TestEqual(TEXT("The max must be the largest sample"), Stats.Max, 4.0);
+		TestTrue(TEXT("The standard deviation must be the sample standard deviation"), FMath::IsNearlyEqual((float)Stats.StdDev, 1.2909944f));
+
+		const FPerformanceMetricStats EmptyStats = FPerformanceMetricStats::FromSamples(TArray<double>());
+		TestEqual(TEXT("No samples must give empty stats"), EmptyStats.NumSamples, 0);
+	}
+
+	// comparing against a baseline
+	{
+		FPerformanceMetricStats Baseline;
+		Baseline.Mean = 10.0;
+		Baseline.StdDev = 0.1;
+		Baseline.NumSamples = 100;
+
+		FPerformanceMetricStats Current = Baseline;
+		TestEqual(TEXT("Identical results must be unchanged"), FPerformanceBaseline::Compare(Baseline, Current), EPerformanceComparison::Unchanged);
+
+		Current.Mean = 10.2;
+		TestEqual(TEXT("Differences below the percentage threshold must be unchanged"), FPerformanceBaseline::Compare(Baseline, Current), EPerformanceComparison::Unchanged);
+
+		Current.Mean = 12.0;
+		TestEqual(TEXT("Significantly slower results must regress"), FPerformanceBaseline::Compare(Baseline, Current), EPerformanceComparison::Regressed);
+
+		Current.Mean = 8.0;
+		TestEqual(TEXT("Significantly faster results must improve"), FPerformanceBaseline::Compare(Baseline, Current), EPerformanceComparison::Improved);
+
+		Current.Mean = 12.0;
+		Current.StdDev = 20.0;
+		Current.NumSamples = 4;
+		TestEqual(TEXT("Differences within the noise must be unchanged"), FPerformanceBaseline::Compare(Baseline, Current), EPerformanceComparison::Unchanged);
+
+		TestEqual(TEXT("Missing baselines must be reported"), FPerformanceBaseline::Compare(FPerformanceMetricStats(), Current), EPerformanceComparison::NoBaseline);
+	}
+
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
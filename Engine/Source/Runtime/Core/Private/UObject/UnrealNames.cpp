@@ -280,6 +280,21 @@ FCriticalSection* FName::GetCriticalSection()
 	return CriticalSection;
 }
 
+FCriticalSection* FName::GetHashShardCriticalSection(uint32 HashIndex)
+{
+	static_assert((FNameDefs::NameHashShardCount & (FNameDefs::NameHashShardCount - 1)) == 0, "NameHashShardCount must be a power of two");
+	static_assert(FNameDefs::NameHashShardCount <= FNameDefs::NameHashBucketCount, "NameHashShardCount must not exceed NameHashBucketCount");
+
+	// Adjacent buckets go to different shards so that similar hashes spread over the locks
+	static FCriticalSection* ShardCriticalSections = nullptr;
+	if (ShardCriticalSections == nullptr)
+	{
+		check(IsInGameThread());
+		ShardCriticalSections = new FCriticalSection[FNameDefs::NameHashShardCount];
+	}
+	return &ShardCriticalSections[HashIndex & (FNameDefs::NameHashShardCount - 1)];
+}
+
 FString FName::NameToDisplayString( const FString& InDisplayName, const bool bIsBool )
 {
 	// Copy the characters out so that we can modify the string in place
@@ -660,11 +675,11 @@ void FName::InitInternal(const TCharType* InName, int32 InNumber, const EFindNam
 template <typename TCharType> void IncrementNameCount();
 template <> void IncrementNameCount<ANSICHAR>()
 {
-	FName::NumAnsiNames++;
+	FPlatformAtomics::InterlockedIncrement(&FName::NumAnsiNames);
 }
 template <> void IncrementNameCount<WIDECHAR>()
 {
-	FName::NumWideNames++;
+	FPlatformAtomics::InterlockedIncrement(&FName::NumWideNames);
 }
 
 template <typename TCharType>
@@ -822,8 +837,8 @@ bool FName::InitInternal_FindOrAddNameEntry(const TCharType* InName, const EFind
 			return false;
 		}
 	}
-	// acquire the lock
-	FScopeLock ScopeLock(GetCriticalSection());
+	// acquire the lock of the shard owning this bucket, it serializes all additions to the bucket's chain
+	FScopeLock ShardLock(GetHashShardCriticalSection(iHash));
 	if (OutIndex < 0)
 	{
 		// Try to find the name in the hash. AGAIN...we might have been adding from a different thread and we just missed it
@@ -841,6 +856,7 @@ bool FName::InitInternal_FindOrAddNameEntry(const TCharType* InName, const EFind
 	}
 	FNameEntry* OldHashHead=NameHashHead[iHash];
 	FNameEntry* OldHashTail=NameHashTail[iHash];
+	// the entry array and the entry allocator are shared by all shards, both reserve their space with atomics so no other lock is needed
 	TNameEntryArray& Names = GetNames();
 	if (OutIndex < 0)
 	{
@@ -864,7 +880,7 @@ bool FName::InitInternal_FindOrAddNameEntry(const TCharType* InName, const EFind
 		{
 			check(0); // someone changed this while we were changing it
 		}
-		NameHashTail[iHash] = NewEntry; // We can non-atomically assign the tail since it's only ever read while locked
+		NameHashTail[iHash] = NewEntry; // We can non-atomically assign the tail since it's only ever read while the shard is locked
 	}
 	else
 	{
@@ -875,7 +891,7 @@ bool FName::InitInternal_FindOrAddNameEntry(const TCharType* InName, const EFind
 		{
 			check(0); // someone changed this while we were changing it
 		}
-		NameHashTail[iHash] = NewEntry; // We can non-atomically assign the tail since it's only ever read while locked
+		NameHashTail[iHash] = NewEntry; // We can non-atomically assign the tail since it's only ever read while the shard is locked
 	}
 	check(OutIndex >= 0);
 	return true;
@@ -945,6 +961,9 @@ void FName::StaticInit()
 		NameHashTail[HashIndex] = nullptr;
 	}
 
+	// Create the shard locks while we are still single threaded
+	GetHashShardCriticalSection(0);
+
 	{
 		FScopeLock ScopeLock(GetCriticalSection());
 
@@ -1253,17 +1272,27 @@ FArchive& operator<<(FArchive& Ar, FNameEntrySerialized& E)
  * never go away. It simply uses 64K chunks and allocates new ones as space runs out. This reduces
  * allocation overhead significantly (only minor waste on 64k boundaries) and also greatly helps
  * with fragmentation as 50-100k allocations turn into tens of allocations.
+ *
+ * Allocation is thread safe. Space is taken from the current pool with an atomic add, the name table
+ * lock is only held while a new pool is allocated.
  */
 class FNameEntryPoolAllocator
 {
+	/** A pool and the number of bytes that have been taken from it. */
+	struct FPool
+	{
+		/** Beginning of the pool's memory. */
+		uint8* Start;
+		/** Number of bytes handed out, may exceed PoolSize() once the pool is exhausted. */
+		volatile int32 Used;
+	};
+
 public:
 	/** Initializes all member variables. */
 	FNameEntryPoolAllocator()
 	{
 		TotalAllocatedPages	= 0;
-		CurrentPoolStart	= NULL;
-		CurrentPoolEnd		= NULL;
-		check(ThreadGuard.GetValue() == 0);
+		CurrentPool			= NULL;
 	}
 
 	/**
@@ -1274,23 +1303,31 @@ public:
 	 */
 	FNameEntry* Allocate( int32 Size )
 	{
-		check(ThreadGuard.Increment() == 1);
 		// Some platforms need all of the name entries to be aligned to 4 bytes, so by
 		// aligning the size here the next allocation will be aligned to 4
 		Size = Align( Size, ALIGNOF(FNameEntry) );
+		check( Size <= PoolSize() );
 
-		// Allocate a new pool if current one is exhausted. We don't worry about a little bit
-		// of waste at the end given the relative size of pool to average and max allocation.
-		if( CurrentPoolEnd - CurrentPoolStart < Size )
+		while (true)
 		{
-			AllocateNewPool();
+			FPool* Pool = CurrentPool;
+			if (Pool)
+			{
+				const int32 Offset = FPlatformAtomics::InterlockedAdd(&Pool->Used, Size);
+				if (Offset + Size <= PoolSize())
+				{
+					return (FNameEntry*)(Pool->Start + Offset);
+				}
+			}
+
+			// Allocate a new pool if current one is exhausted. We don't worry about a little bit
+			// of waste at the end given the relative size of pool to average and max allocation.
+			FScopeLock ScopeLock(FName::GetCriticalSection());
+			if (CurrentPool == Pool)
+			{
+				AllocateNewPool();
+			}
 		}
-		check( CurrentPoolEnd - CurrentPoolStart >= Size );
-		// Return current pool start as allocation and increment by size.
-		FNameEntry* NameEntry = (FNameEntry*) CurrentPoolStart;
-		CurrentPoolStart += Size;
-		check(ThreadGuard.Decrement() == 0);
-		return NameEntry;
 	}
 
 	/**
@@ -1315,22 +1352,20 @@ public:
 	}
 
 private:
-	/** Allocates a new pool. */
+	/** Allocates a new pool and makes it the current one, needs to be called with the name table lock held. */
 	void AllocateNewPool()
 	{
 		TotalAllocatedPages++;
-		CurrentPoolStart = (uint8*) FMemory::Malloc(PoolSize());
-		CurrentPoolEnd = CurrentPoolStart + PoolSize();
+		FPool* NewPool = new FPool;
+		NewPool->Start = (uint8*) FMemory::Malloc(PoolSize());
+		NewPool->Used = 0;
+		FPlatformAtomics::InterlockedExchangePtr((void**)&CurrentPool, NewPool);
 	}
 
-	/** Beginning of pool. Allocated by AllocateNewPool, incremented by Allocate.	*/
-	uint8* CurrentPoolStart;
-	/** End of current pool. Set by AllocateNewPool and checked by Allocate.		*/
-	uint8* CurrentPoolEnd;
-	/** Total number of pages that have been allocated.								*/
+	/** Pool allocations are taken from. Replaced by AllocateNewPool, the old pools are never freed.	*/
+	FPool* volatile CurrentPool;
+	/** Total number of pages that have been allocated.												*/
 	int32 TotalAllocatedPages;
-	/** Threadsafe counter to test for unwanted concurrency							*/
-	FThreadSafeCounter ThreadGuard;
 };
 
 /** Global allocator for name entries. */
@@ -1342,7 +1377,7 @@ FNameEntry* AllocateNameEntry(const TCharType* Name, NAME_INDEX Index)
 	const SIZE_T NameLen  = TCString<TCharType>::Strlen(Name);
 	int32 NameEntrySize	  = FNameInitHelper<TCharType>::GetSize( NameLen );
 	FNameEntry* NameEntry = GNameEntryPoolAllocator.Allocate( NameEntrySize );
-	FName::NameEntryMemorySize += NameEntrySize;
+	FPlatformAtomics::InterlockedAdd(&FName::NameEntryMemorySize, NameEntrySize);
 	NameEntry->Index      = (Index << NAME_INDEX_SHIFT) | (FNameInitHelper<TCharType>::GetIndexShiftValue());
 	NameEntry->HashNext   = nullptr;
 	FNameInitHelper<TCharType>::SetNameString(NameEntry, Name, NameLen);
@@ -484,6 +484,10 @@ private:
 	{
 		// Stop the heartbeat thread so that it doesn't interfere with crashreporting
 		FThreadHeartBeat::Get().Stop();
+		if (FGameThreadHitchHeartBeat* HitchHeartBeat = FGameThreadHitchHeartBeat::GetNoInit())
+		{
+			HitchHeartBeat->Stop();
+		}
 
 		GLog->PanicFlushThreadedLogs();
 
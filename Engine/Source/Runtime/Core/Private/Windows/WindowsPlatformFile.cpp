@@ -12,6 +12,10 @@
 #include "Templates/Function.h"
 #include "Misc/Paths.h"
 #include "CoreGlobals.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/NativeAsyncReadFileHandle.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
 #include "Windows/WindowsHWrapper.h"
 #include <sys/utime.h>
 
@@ -508,6 +512,186 @@ public:
 	}
 };
 
+/**
+ * Windows view of a file mapping
+**/
+class FMappedFileRegionWindows final : public IMappedFileRegion
+{
+	/** Start of the view, MapViewOfFile needs offsets aligned to the allocation granularity */
+	const void* ViewBase;
+	FThreadSafeCounter& NumOutstandingRegions;
+
+public:
+	FMappedFileRegionWindows(const void* InViewBase, const uint8* InMappedPtr, int64 InMappedSize, const FString& InDebugFilename, int64 InDebugOffsetRelativeToFile, FThreadSafeCounter& InNumOutstandingRegions)
+		: IMappedFileRegion(InMappedPtr, InMappedSize, InDebugFilename, InDebugOffsetRelativeToFile)
+		, ViewBase(InViewBase)
+		, NumOutstandingRegions(InNumOutstandingRegions)
+	{
+		NumOutstandingRegions.Increment();
+	}
+	virtual ~FMappedFileRegionWindows()
+	{
+		UnmapViewOfFile(ViewBase);
+		NumOutstandingRegions.Decrement();
+	}
+};
+
+/**
+ * Windows read-only file mapping
+**/
+class FMappedFileHandleWindows final : public IMappedFileHandle
+{
+	HANDLE FileHandle;
+	HANDLE MappingHandle;
+	FString Filename;
+
+public:
+	FMappedFileHandleWindows(HANDLE InFileHandle, HANDLE InMappingHandle, int64 InFileSize, const TCHAR* InFilename)
+		: IMappedFileHandle(InFileSize)
+		, FileHandle(InFileHandle)
+		, MappingHandle(InMappingHandle)
+		, Filename(InFilename)
+	{
+	}
+	virtual ~FMappedFileHandleWindows()
+	{
+		CloseHandle(MappingHandle);
+		CloseHandle(FileHandle);
+	}
+	virtual IMappedFileRegion* MapRegion(int64 Offset, int64 BytesToMap, bool bPreloadHint) override
+	{
+		check(Offset >= 0 && Offset <= GetFileSize());
+		BytesToMap = FMath::Min<int64>(BytesToMap, GetFileSize() - Offset);
+		if (BytesToMap <= 0)
+		{
+			return nullptr;
+		}
+
+		SYSTEM_INFO SystemInfo;
+		GetSystemInfo(&SystemInfo);
+		const int64 AlignedOffset = Offset - (Offset % SystemInfo.dwAllocationGranularity);
+		const int64 AlignedSize = BytesToMap + (Offset - AlignedOffset);
+
+		LARGE_INTEGER li;
+		li.QuadPart = AlignedOffset;
+		const uint8* ViewBase = (const uint8*)MapViewOfFile(MappingHandle, FILE_MAP_READ, li.HighPart, li.LowPart, SIZE_T(AlignedSize));
+		if (!ViewBase)
+		{
+			return nullptr;
+		}
+		// bPreloadHint is ignored, PrefetchVirtualMemory isn't available on every supported version of Windows
+		return new FMappedFileRegionWindows(ViewBase, ViewBase + (Offset - AlignedOffset), BytesToMap, Filename, Offset, NumOutstandingRegions);
+	}
+};
+
+/**
+ * Completion port shared by the native async read handles. A single thread services it and finishes the requests,
+ * so the number of reads in flight is limited by the device rather than by the size of a thread pool.
+ */
+class FWindowsAsyncIOCompletionPort : public FRunnable
+{
+public:
+	/** Overlapped read in flight, the OVERLAPPED must come first so completions can be mapped back to it */
+	struct FOperation
+	{
+		OVERLAPPED Overlapped;
+		FNativeAsyncReadRequest* Request;
+	};
+
+	/** @return the completion port, or nullptr if it couldn't be created */
+	static FWindowsAsyncIOCompletionPort* Get()
+	{
+		// never destroyed, the completion thread runs until the process exits
+		static FWindowsAsyncIOCompletionPort* Singleton = new FWindowsAsyncIOCompletionPort();
+		return Singleton->Thread ? Singleton : nullptr;
+	}
+
+	bool Associate(HANDLE FileHandle)
+	{
+		return CreateIoCompletionPort(FileHandle, Port, 0, 0) == Port;
+	}
+
+	virtual uint32 Run() override
+	{
+		for (;;)
+		{
+			DWORD BytesTransferred = 0;
+			ULONG_PTR CompletionKey = 0;
+			OVERLAPPED* Overlapped = nullptr;
+			const BOOL bSucceeded = GetQueuedCompletionStatus(Port, &BytesTransferred, &CompletionKey, &Overlapped, INFINITE);
+			if (!Overlapped)
+			{
+				// the port itself failed, nothing can complete anymore
+				break;
+			}
+			// failed and aborted reads are dequeued with a FALSE result
+			FOperation* Operation = (FOperation*)Overlapped;
+			Operation->Request->OnReadComplete(BytesTransferred, !!bSucceeded);
+			delete Operation;
+		}
+		return 0;
+	}
+
+private:
+	FWindowsAsyncIOCompletionPort()
+		: Port(CreateIoCompletionPort(INVALID_HANDLE_VALUE, NULL, 0, 1))
+		, Thread(nullptr)
+	{
+		if (Port)
+		{
+			Thread = FRunnableThread::Create(this, TEXT("AsyncIOCompletionThread"), 0, TPri_AboveNormal);
+		}
+	}
+
+	HANDLE Port;
+	FRunnableThread* Thread;
+};
+
+/**
+ * Async read handle using overlapped reads on a handle associated with the completion port. Reads go
+ * straight into the request's memory.
+ */
+class FWindowsAsyncReadFileHandle final : public FNativeAsyncReadFileHandle
+{
+	HANDLE Handle;
+
+public:
+	FWindowsAsyncReadFileHandle(HANDLE InHandle, const TCHAR* InFilename, int64 InFileSize)
+		: FNativeAsyncReadFileHandle(InFilename, InFileSize)
+		, Handle(InHandle)
+	{
+	}
+
+	virtual ~FWindowsAsyncReadFileHandle()
+	{
+		CloseHandle(Handle);
+	}
+
+	virtual void* IssueRead(FNativeAsyncReadRequest* Request, uint8* Dest, int64 Offset, int64 Size) override
+	{
+		FWindowsAsyncIOCompletionPort::FOperation* Operation = new FWindowsAsyncIOCompletionPort::FOperation;
+		FMemory::Memzero(&Operation->Overlapped, sizeof(OVERLAPPED));
+		ULARGE_INTEGER LI;
+		LI.QuadPart = Offset;
+		Operation->Overlapped.Offset = LI.LowPart;
+		Operation->Overlapped.OffsetHigh = LI.HighPart;
+		Operation->Request = Request;
+
+		// reads that finish right away still post their completion to the port
+		if (!ReadFile(Handle, Dest, (DWORD)Size, NULL, &Operation->Overlapped) && GetLastError() != ERROR_IO_PENDING)
+		{
+			delete Operation;
+			return nullptr;
+		}
+		return Operation;
+	}
+
+	virtual void CancelRead(void* Operation) override
+	{
+		CancelIoEx(Handle, &((FWindowsAsyncIOCompletionPort::FOperation*)Operation)->Overlapped);
+	}
+};
+
 /**
  * Windows File I/O implementation
 **/
@@ -678,6 +862,26 @@ public:
 		return NULL;
 	}
 
+	virtual IAsyncReadFileHandle* OpenAsyncRead(const TCHAR* Filename) override
+	{
+		FWindowsAsyncIOCompletionPort* Port = UseNativeAsyncReadFileHandles() ? FWindowsAsyncIOCompletionPort::Get() : nullptr;
+		if (Port)
+		{
+			HANDLE Handle = CreateFileW(*NormalizeFilename(Filename), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_OVERLAPPED, NULL);
+			if (Handle != INVALID_HANDLE_VALUE)
+			{
+				LARGE_INTEGER LI;
+				if (GetFileSizeEx(Handle, &LI) && Port->Associate(Handle))
+				{
+					return new FWindowsAsyncReadFileHandle(Handle, Filename, LI.QuadPart);
+				}
+				CloseHandle(Handle);
+			}
+		}
+		// missing files and failures to set up the native handle are left to the generic implementation
+		return IPhysicalPlatformFile::OpenAsyncRead(Filename);
+	}
+
 	virtual IFileHandle* OpenReadNoBuffering(const TCHAR* Filename, bool bAllowWrite = false) override
 	{
 		uint32  Access = GENERIC_READ;
@@ -691,6 +895,28 @@ public:
 		return NULL;
 	}
 
+	virtual IMappedFileHandle* OpenMapped(const TCHAR* Filename) override
+	{
+		HANDLE Handle = CreateFileW(*NormalizeFilename(Filename), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+		if (Handle == INVALID_HANDLE_VALUE)
+		{
+			return nullptr;
+		}
+		LARGE_INTEGER li;
+		if (!GetFileSizeEx(Handle, &li) || li.QuadPart == 0)
+		{
+			CloseHandle(Handle);
+			return nullptr;
+		}
+		HANDLE MappingHandle = CreateFileMappingW(Handle, NULL, PAGE_READONLY, 0, 0, NULL);
+		if (!MappingHandle)
+		{
+			CloseHandle(Handle);
+			return nullptr;
+		}
+		return new FMappedFileHandleWindows(Handle, MappingHandle, li.QuadPart, Filename);
+	}
+
 	virtual IFileHandle* OpenWrite(const TCHAR* Filename, bool bAppend = false, bool bAllowRead = false) override
 	{
 		uint32  Access    = GENERIC_WRITE;
@@ -1390,6 +1390,63 @@ bool FWindowsPlatformProcess::Daemonize()
 	return true;
 }
 
+/** A Windows fiber plus the entry point it was created with, CreateFiber only passes a single parameter. */
+struct FWindowsFiber
+{
+	LPVOID Handle;
+	FWindowsPlatformProcess::FFiberEntryPoint EntryPoint;
+	void* Param;
+};
+
+static VOID WINAPI WindowsFiberMain(LPVOID Param)
+{
+	FWindowsFiber* Fiber = (FWindowsFiber*)Param;
+	Fiber->EntryPoint(Fiber->Param);
+	checkf(0, TEXT("Fiber entry points must not return"));
+}
+
+void* FWindowsPlatformProcess::ConvertThreadToFiber()
+{
+	FWindowsFiber* Fiber = new FWindowsFiber;
+	Fiber->Handle = ::ConvertThreadToFiber(nullptr);
+	Fiber->EntryPoint = nullptr;
+	Fiber->Param = nullptr;
+	checkf(Fiber->Handle, TEXT("ConvertThreadToFiber failed with LastError = %d"), GetLastError());
+	return Fiber;
+}
+
+void FWindowsPlatformProcess::ConvertFiberToThread(void* ThreadFiber)
+{
+	verify(::ConvertFiberToThread());
+	delete (FWindowsFiber*)ThreadFiber;
+}
+
+void* FWindowsPlatformProcess::CreateFiber(uint32 StackSize, FFiberEntryPoint EntryPoint, void* Param)
+{
+	FWindowsFiber* Fiber = new FWindowsFiber;
+	Fiber->EntryPoint = EntryPoint;
+	Fiber->Param = Param;
+	Fiber->Handle = ::CreateFiber(StackSize, &WindowsFiberMain, Fiber);
+	if (!Fiber->Handle)
+	{
+		UE_LOG(LogHAL, Warning, TEXT("CreateFiber failed with LastError = %d"), GetLastError());
+		delete Fiber;
+		return nullptr;
+	}
+	return Fiber;
+}
+
+void FWindowsPlatformProcess::DeleteFiber(void* Fiber)
+{
+	::DeleteFiber(((FWindowsFiber*)Fiber)->Handle);
+	delete (FWindowsFiber*)Fiber;
+}
+
+void FWindowsPlatformProcess::SwitchToFiber(void* Fiber)
+{
+	::SwitchToFiber(((FWindowsFiber*)Fiber)->Handle);
+}
+
 void *FWindowsPlatformProcess::LoadLibraryWithSearchPaths(const FString& FileName, const TArray<FString>& SearchPaths)
 {
 	// Make sure the initial module exists. If we can't find it from the path we're given, it's probably a system dll.
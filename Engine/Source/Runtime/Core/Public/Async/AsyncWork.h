@@ -64,8 +64,9 @@ class FAutoDeleteAsyncTask
 
 	/* Generic start function, not called directly
 		* @param bForceSynchronous if true, this job will be started synchronously, now, on this thread
+		* @param InPriority priority of the job in the thread pool
 	**/
-	void Start(bool bForceSynchronous)
+	void Start(bool bForceSynchronous, EQueuedWorkPriority InPriority = EQueuedWorkPriority::Normal)
 	{
 		FPlatformMisc::MemoryBarrier();
 		FQueuedThreadPool* QueuedPool = GThreadPool;
@@ -75,7 +76,7 @@ class FAutoDeleteAsyncTask
 		}
 		if (QueuedPool)
 		{
-			QueuedPool->AddQueuedWork(this);
+			QueuedPool->AddQueuedWork(this, InPriority);
 		}
 		else
 		{
@@ -137,10 +138,11 @@ public:
 
 	/** 
 	* Run this task on the lo priority thread pool. It is not safe to use this object after this call.
+	* @param InPriority priority of the job in the thread pool, work at lower priorities waits while there is higher priority work
 	**/
-	void StartBackgroundTask()
+	void StartBackgroundTask(EQueuedWorkPriority InPriority = EQueuedWorkPriority::Normal)
 	{
-		Start(false);
+		Start(false, InPriority);
 	}
 
 };
@@ -222,8 +224,9 @@ class FAsyncTask
 
 	/* Generic start function, not called directly
 		* @param bForceSynchronous if true, this job will be started synchronously, now, on this thread
+		* @param InPriority priority of the job in the thread pool
 	**/
-	void Start(bool bForceSynchronous, FQueuedThreadPool* InQueuedPool)
+	void Start(bool bForceSynchronous, FQueuedThreadPool* InQueuedPool, EQueuedWorkPriority InPriority = EQueuedWorkPriority::Normal)
 	{
 		FScopeCycleCounter Scope( Task.GetStatId(), true );
 		DECLARE_SCOPE_CYCLE_COUNTER( TEXT( "FAsyncTask::Start" ), STAT_FAsyncTask_Start, STATGROUP_ThreadPoolAsyncTasks );
@@ -243,7 +246,7 @@ class FAsyncTask
 				DoneEvent = FPlatformProcess::GetSynchEventFromPool(true);
 			}
 			DoneEvent->Reset();
-			QueuedPool->AddQueuedWork(this);
+			QueuedPool->AddQueuedWork(this, InPriority);
 		}
 		else 
 		{
@@ -398,10 +401,12 @@ public:
 
 	/** 
 	* Queue this task for processing by the background thread pool
+	* @param InQueuedPool the pool to run the task in
+	* @param InPriority priority of the job in the pool, work at lower priorities waits while there is higher priority work
 	**/
-	void StartBackgroundTask(FQueuedThreadPool* InQueuedPool = GThreadPool)
+	void StartBackgroundTask(FQueuedThreadPool* InQueuedPool = GThreadPool, EQueuedWorkPriority InPriority = EQueuedWorkPriority::Normal)
 	{
-		Start(false, InQueuedPool);
+		Start(false, InQueuedPool, InPriority);
 	}
 
 	/** 
@@ -0,0 +1,115 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Misc/AssertionMacros.h"
+#include "Containers/UnrealString.h"
+#include "Math/NumericLimits.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Stats/Stats.h"
+
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Mapped File Region Memory"), STAT_MappedFileMemory, STATGROUP_Memory, CORE_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Num Mapped File Handles"), STAT_MappedFileHandles, STATGROUP_Memory, CORE_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Num Mapped File Regions"), STAT_MappedFileRegions, STATGROUP_Memory, CORE_API);
+
+// Note on threading. Like the rest of the filesystem platform abstraction, these methods are threadsafe, but it is expected you are not concurrently _using_ these data structures.
+
+/**
+ * A read-only view of part of a memory mapped file. The memory stays valid until the region is deleted.
+ */
+class CORE_API IMappedFileRegion
+{
+	const uint8* MappedPtr;
+	int64 MappedSize;
+	FString DebugFilename;
+	int64 DebugOffsetRelativeToFile;
+
+public:
+
+	IMappedFileRegion(const uint8* InMappedPtr, int64 InMappedSize, const FString& InDebugFilename, int64 InDebugOffsetRelativeToFile)
+		: MappedPtr(InMappedPtr)
+		, MappedSize(InMappedSize)
+		, DebugFilename(InDebugFilename)
+		, DebugOffsetRelativeToFile(InDebugOffsetRelativeToFile)
+	{
+		INC_DWORD_STAT(STAT_MappedFileRegions);
+		INC_MEMORY_STAT_BY(STAT_MappedFileMemory, MappedSize);
+	}
+
+	/** Unmaps the region. */
+	virtual ~IMappedFileRegion()
+	{
+		DEC_MEMORY_STAT_BY(STAT_MappedFileMemory, MappedSize);
+		DEC_DWORD_STAT(STAT_MappedFileRegions);
+	}
+
+	/** @return the first mapped byte, this memory must not be written to. */
+	FORCEINLINE const uint8* GetMappedPtr() const
+	{
+		return MappedPtr;
+	}
+
+	/** @return the number of bytes that can be read from GetMappedPtr(). */
+	FORCEINLINE int64 GetMappedSize() const
+	{
+		return MappedSize;
+	}
+
+	/** @return the file this region was mapped from, for logging. */
+	FORCEINLINE const FString& GetDebugFilename() const
+	{
+		return DebugFilename;
+	}
+
+	/** @return the offset of GetMappedPtr() in the file, for logging. */
+	FORCEINLINE int64 GetDebugOffsetRelativeToFile() const
+	{
+		return DebugOffsetRelativeToFile;
+	}
+};
+
+/**
+ * A file opened for memory mapping. Regions of it are mapped with MapRegion.
+ * All regions must be deleted before the handle is deleted.
+ */
+class CORE_API IMappedFileHandle
+{
+	int64 MappedFileSize;
+
+protected:
+
+	/** Number of regions of this handle that haven't been deleted yet. */
+	FThreadSafeCounter NumOutstandingRegions;
+
+public:
+
+	IMappedFileHandle(int64 InFileSize)
+		: MappedFileSize(InFileSize)
+	{
+		INC_DWORD_STAT(STAT_MappedFileHandles);
+	}
+
+	/** Closes the file, all regions must already be deleted. */
+	virtual ~IMappedFileHandle()
+	{
+		checkf(NumOutstandingRegions.GetValue() == 0, TEXT("Mapped file handle deleted with %d regions still mapped."), NumOutstandingRegions.GetValue());
+		DEC_DWORD_STAT(STAT_MappedFileHandles);
+	}
+
+	/** @return the size of the mapped file. */
+	FORCEINLINE int64 GetFileSize() const
+	{
+		return MappedFileSize;
+	}
+
+	/**
+	 * Maps a region of the file. Doesn't read anything, pages are brought in when they are touched.
+	 *
+	 * @param Offset			Offset of the first byte to map.
+	 * @param BytesToMap		Number of bytes to map, clamped to the end of the file.
+	 * @param bPreloadHint		If true, the platform is asked to start reading the region right away.
+	 * @return The region, close it by delete'ing it. nullptr if the region could not be mapped.
+	 */
+	virtual IMappedFileRegion* MapRegion(int64 Offset = 0, int64 BytesToMap = MAX_int64, bool bPreloadHint = false) = 0;
+};
@@ -245,3 +245,194 @@ inline void ParallelForWithPreWork(int32 Num, TFunctionRef<void(int32)> Body, TF
 	// Data must live on until all of the tasks are cleared which might be long after this function exits
 }
 
+/** Flags controlling the behavior of ParallelForRange. */
+namespace EParallelForFlags
+{
+	enum Type
+	{
+		None = 0,
+		/** Mostly used for testing, run single threaded instead. */
+		ForceSingleThread = 1,
+		/** Hand out equally sized batches instead of shrinking them as the range drains. Cheaper when every index costs about the same. */
+		Balanced = 2,
+		/** Affinity hint: run the helper tasks on background priority threads. The calling thread still helps. */
+		BackgroundPriority = 4,
+	};
+}
+
+// struct to hold the working data for ParallelForRange; like FParallelForData it outlives the call and is owned by a shared pointer
+struct FParallelForRangeData
+{
+	int32 Num;
+	int32 MinBatchSize;
+	int32 NumThreads;
+	int32 FixedBatchSize;
+	TFunctionRef<void(int32, int32)> Body;
+	FEvent* Event;
+	ENamedThreads::Type DesiredThread;
+	/** First index not handed out yet; may overshoot Num */
+	volatile int32 NextIndex;
+	FThreadSafeCounter NumCompleted;
+	bool bExited;
+	bool bTriggered;
+	FParallelForRangeData(int32 InNum, int32 InMinBatchSize, int32 InNumThreads, uint32 Flags, TFunctionRef<void(int32, int32)> InBody)
+		: Num(InNum)
+		, MinBatchSize(InMinBatchSize)
+		, NumThreads(InNumThreads)
+		, FixedBatchSize(0)
+		, Body(InBody)
+		, Event(FPlatformProcess::GetSynchEventFromPool(false))
+		, DesiredThread((Flags & EParallelForFlags::BackgroundPriority) ? ENamedThreads::AnyBackgroundThreadNormalTask : ENamedThreads::AnyHiPriThreadHiPriTask)
+		, NextIndex(0)
+		, bExited(false)
+		, bTriggered(false)
+	{
+		check(Num > 0 && MinBatchSize > 0 && NumThreads > 1);
+		if (Flags & EParallelForFlags::Balanced)
+		{
+			// same granularity as ParallelFor: about three batches per thread
+			FixedBatchSize = FMath::Max<int32>(MinBatchSize, Num / (NumThreads * 3));
+		}
+	}
+	~FParallelForRangeData()
+	{
+		check(NextIndex >= Num);
+		check(NumCompleted.GetValue() == Num);
+		check(bExited);
+		FPlatformProcess::ReturnSynchEventToPool(Event);
+	}
+	/**
+	 *	Claims the next batch of the range. Unless the batch size is fixed, batches start large and shrink as the range drains (guided scheduling),
+	 *	so a few expensive indices near the end cannot leave the other threads idle.
+	 *	@return false if the whole range has been handed out.
+	 */
+	bool ClaimBatch(int32& OutStart, int32& OutEnd)
+	{
+		if (FixedBatchSize)
+		{
+			OutStart = FPlatformAtomics::InterlockedAdd(&NextIndex, FixedBatchSize);
+			OutEnd = FMath::Min<int32>(OutStart + FixedBatchSize, Num);
+			return OutStart < Num;
+		}
+		while (true)
+		{
+			int32 Start = NextIndex;
+			if (Start >= Num)
+			{
+				return false;
+			}
+			int32 Remaining = Num - Start;
+			int32 BatchSize = FMath::Min<int32>(Remaining, FMath::Max<int32>(MinBatchSize, Remaining / (NumThreads * 2)));
+			if (FPlatformAtomics::InterlockedCompareExchange(&NextIndex, Start + BatchSize, Start) == Start)
+			{
+				OutStart = Start;
+				OutEnd = Start + BatchSize;
+				return true;
+			}
+		}
+	}
+	bool Process(int32 TasksToSpawn, TSharedRef<FParallelForRangeData, ESPMode::ThreadSafe>& Data);
+};
+
+class FParallelForRangeTask
+{
+	TSharedRef<FParallelForRangeData, ESPMode::ThreadSafe> Data;
+	int32 TasksToSpawn;
+public:
+	FParallelForRangeTask(TSharedRef<FParallelForRangeData, ESPMode::ThreadSafe>& InData, int32 InTasksToSpawn = 0)
+		: Data(InData)
+		, TasksToSpawn(InTasksToSpawn)
+	{
+	}
+	static FORCEINLINE TStatId GetStatId()
+	{
+		return GET_STATID(STAT_ParallelForTask);
+	}
+	FORCEINLINE ENamedThreads::Type GetDesiredThread()
+	{
+		return Data->DesiredThread;
+	}
+	static FORCEINLINE ESubsequentsMode::Type GetSubsequentsMode()
+	{
+		return ESubsequentsMode::FireAndForget;
+	}
+	void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+	{
+		if (Data->Process(TasksToSpawn, Data))
+		{
+			checkSlow(!Data->bTriggered);
+			Data->bTriggered = true;
+			Data->Event->Trigger();
+		}
+	}
+};
+
+/** @return true if the caller completed the last item of the range. */
+inline bool FParallelForRangeData::Process(int32 TasksToSpawn, TSharedRef<FParallelForRangeData, ESPMode::ThreadSafe>& Data)
+{
+	if (TasksToSpawn && NextIndex < Num)
+	{
+		// fan out the task creation instead of having the caller pay for all of it
+		TGraphTask<FParallelForRangeTask>::CreateTask().ConstructAndDispatchWhenReady(Data, TasksToSpawn - 1);
+	}
+	TFunctionRef<void(int32, int32)> LocalBody(Body);
+	int32 Start, End;
+	while (ClaimBatch(Start, End))
+	{
+		LocalBody(Start, End);
+		checkSlow(!bExited);
+		int32 BatchNum = End - Start;
+		int32 LocalNumCompleted = NumCompleted.Add(BatchNum) + BatchNum;
+		if (LocalNumCompleted == Num)
+		{
+			return true;
+		}
+		checkSlow(LocalNumCompleted < Num);
+	}
+	return false;
+}
+
+/** 
+	*	Parallel for over contiguous ranges of indices; the body is called with [Start, End) ranges instead of once per index.
+	*	@param Num; number of indices to process; the ranges passed to Body cover 0...Num - 1 exactly once
+	*	@param MinBatchSize; smallest range handed to a thread, except for the tail of the range. Use this to amortize the scheduling cost of tiny bodies.
+	*	@param Body; Function to call from multiple threads with (Start, End)
+	*	@param Flags; combination of EParallelForFlags
+	*	Notes: Please add stats around to calls to parallel for and within your lambda as appropriate. Do not clog the task graph with long running tasks or tasks that block.
+**/
+inline void ParallelForRange(int32 Num, int32 MinBatchSize, TFunctionRef<void(int32, int32)> Body, uint32 Flags = EParallelForFlags::None)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ParallelFor);
+	check(Num >= 0);
+	MinBatchSize = FMath::Max<int32>(MinBatchSize, 1);
+
+	int32 AnyThreadTasks = 0;
+	if (Num > MinBatchSize && !(Flags & EParallelForFlags::ForceSingleThread) && FApp::ShouldUseThreadingForPerformance())
+	{
+		AnyThreadTasks = FMath::Min<int32>(FTaskGraphInterface::Get().GetNumWorkerThreads(), FMath::DivideAndRoundUp(Num, MinBatchSize) - 1);
+	}
+	if (!AnyThreadTasks)
+	{
+		// no threads, just do it and return
+		if (Num)
+		{
+			Body(0, Num);
+		}
+		return;
+	}
+	TSharedRef<FParallelForRangeData, ESPMode::ThreadSafe> Data = MakeShareable(new FParallelForRangeData(Num, MinBatchSize, AnyThreadTasks + 1, Flags, Body));
+	TGraphTask<FParallelForRangeTask>::CreateTask().ConstructAndDispatchWhenReady(Data, AnyThreadTasks - 1);
+	// this thread can help too and this is important to prevent deadlock on recursion 
+	if (!Data->Process(0, Data))
+	{
+		Data->Event->Wait();
+		check(Data->bTriggered);
+	}
+	else
+	{
+		check(!Data->bTriggered);
+	}
+	check(Data->NumCompleted.GetValue() == Data->Num);
+	Data->bExited = true;
+	// Data must live on until all of the tasks are cleared which might be long after this function exits
+}
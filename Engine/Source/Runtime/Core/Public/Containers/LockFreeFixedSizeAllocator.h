@@ -26,17 +26,29 @@ class TLockFreeFixedSizeAllocator
 		FFakeType* LockFreePointerQueueNext;
 	};
 
+	/** Number of blocks to get from the allocator at once when the free list runs dry. */
+	enum { NumBlocksPerRefill = SIZE > 1024 ? 4 : 16 };
+
 public:
 
-	/** Destructor, returns all memory via FMemory::Free **/
+	/** Destructor, returns all memory via FMemory::FreeBulk **/
 	~TLockFreeFixedSizeAllocator()
 	{
 		check(!NumUsed.GetValue());
+		void* Blocks[NumBlocksPerRefill];
+		int32 NumBlocks = 0;
 		while (void* Mem = FreeList.Pop())
 		{
-			FMemory::Free(Mem);
-			NumFree.Decrement();
+			Blocks[NumBlocks++] = Mem;
+			if (NumBlocks == NumBlocksPerRefill)
+			{
+				FMemory::FreeBulk(Blocks, NumBlocks);
+				NumFree.Add(-NumBlocks);
+				NumBlocks = 0;
+			}
 		}
+		FMemory::FreeBulk(Blocks, NumBlocks);
+		NumFree.Add(-NumBlocks);
 		check(!NumFree.GetValue());
 	}
 
@@ -57,7 +69,15 @@ public:
 		}
 		else
 		{
-			Memory = FMemory::Malloc(SIZE);
+			// Refill with one batch, keep the first block and put the others on the free list
+			void* Blocks[NumBlocksPerRefill];
+			FMemory::MallocBulk(Blocks, NumBlocksPerRefill, SIZE);
+			Memory = Blocks[0];
+			for (int32 Index = 1; Index < NumBlocksPerRefill; Index++)
+			{
+				FreeList.Push((FFakeType*)Blocks[Index]);
+			}
+			NumFree.Add(NumBlocksPerRefill - 1);
 		}
 		return Memory;
 	}
@@ -118,17 +138,29 @@ private:
 template<int32 SIZE, int TPaddingForCacheContention, typename TTrackingCounter = FNoopCounter>
 class TLockFreeFixedSizeAllocator
 {
+	/** Number of blocks to get from the allocator at once when the free list runs dry. */
+	enum { NumBlocksPerRefill = SIZE > 1024 ? 4 : 16 };
+
 public:
 
-	/** Destructor, returns all memory via FMemory::Free **/
+	/** Destructor, returns all memory via FMemory::FreeBulk **/
 	~TLockFreeFixedSizeAllocator()
 	{
 		check(!NumUsed.GetValue());
+		void* Blocks[NumBlocksPerRefill];
+		int32 NumBlocks = 0;
 		while (void* Mem = FreeList.Pop())
 		{
-			FMemory::Free(Mem);
-			NumFree.Decrement();
+			Blocks[NumBlocks++] = Mem;
+			if (NumBlocks == NumBlocksPerRefill)
+			{
+				FMemory::FreeBulk(Blocks, NumBlocks);
+				NumFree.Add(-NumBlocks);
+				NumBlocks = 0;
+			}
 		}
+		FMemory::FreeBulk(Blocks, NumBlocks);
+		NumFree.Add(-NumBlocks);
 		check(!NumFree.GetValue());
 	}
 
@@ -148,7 +180,15 @@ public:
 		}
 		else
 		{
-			Memory = FMemory::Malloc(SIZE);
+			// Refill with one batch, keep the first block and put the others on the free list
+			void* Blocks[NumBlocksPerRefill];
+			FMemory::MallocBulk(Blocks, NumBlocksPerRefill, SIZE);
+			Memory = Blocks[0];
+			for (int32 Index = 1; Index < NumBlocksPerRefill; Index++)
+			{
+				FreeList.Push(Blocks[Index]);
+			}
+			NumFree.Add(NumBlocksPerRefill - 1);
 		}
 		return Memory;
 	}
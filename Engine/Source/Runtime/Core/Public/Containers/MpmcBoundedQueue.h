@@ -0,0 +1,358 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Misc/AssertionMacros.h"
+#include "HAL/UnrealMemory.h"
+#include "HAL/PlatformAtomics.h"
+#include "HAL/PlatformMisc.h"
+#include "Math/UnrealMathUtility.h"
+#include "Templates/TypeCompatibleBytes.h"
+#include "Templates/UnrealTemplate.h"
+
+/**
+ * Implements a bounded multi-producer/multi-consumer first-in first-out queue of values.
+ *
+ * Any number of threads may enqueue and dequeue concurrently. The queue never allocates
+ * after construction and never blocks: Enqueue fails when the queue is full and Dequeue
+ * fails when it is empty.
+ *
+ * Every slot of the ring carries a sequence number that tells producers and consumers
+ * whether the slot is free or holds an element for the current lap, so the only shared
+ * writes are one compare-exchange on the head or tail per operation (or per batch).
+ * Head and tail live on their own cache lines to keep producers and consumers from
+ * invalidating each other.
+ *
+ * The batched operations claim a whole range at once and may spin briefly on slots that
+ * another thread claimed but has not finished reading or writing yet.
+ *
+ * Unlike TCircularQueue all slots are usable, the capacity is rounded up to a power of 2.
+ *
+ * @param ElementType The type of elements held in the queue.
+ */
+template<typename ElementType>
+class TMpmcBoundedQueue
+	: public FNoncopyable
+{
+public:
+
+	/**
+	 * Creates and initializes a new queue.
+	 *
+	 * @param InCapacity The number of elements that the queue can hold (will be rounded up to the next power of 2).
+	 */
+	explicit TMpmcBoundedQueue(uint32 InCapacity)
+		: Cells(nullptr)
+		, IndexMask(FMath::RoundUpToPowerOfTwo(FMath::Max<uint32>(InCapacity, 2)) - 1)
+		, EnqueuePos(0)
+		, DequeuePos(0)
+	{
+		Cells = (FCell*)FMemory::Malloc(sizeof(FCell) * (IndexMask + 1), PLATFORM_CACHE_LINE_SIZE);
+
+		for (uint32 Index = 0; Index <= IndexMask; ++Index)
+		{
+			Cells[Index].Sequence = Index;
+		}
+	}
+
+	/** Destructor. Destroys the elements that are still in the queue; no other thread may be using it. */
+	~TMpmcBoundedQueue()
+	{
+		for (uint32 Pos = (uint32)DequeuePos; Pos != (uint32)EnqueuePos; ++Pos)
+		{
+			((ElementType*)&Cells[Pos & IndexMask].Storage)->~ElementType();
+		}
+
+		FMemory::Free(Cells);
+	}
+
+public:
+
+	/**
+	 * Gets the maximum number of elements the queue can hold.
+	 *
+	 * @return Queue capacity.
+	 */
+	FORCEINLINE uint32 Capacity() const
+	{
+		return IndexMask + 1;
+	}
+
+	/**
+	 * Gets the number of elements in the queue.
+	 *
+	 * This is only a guess while other threads are using the queue.
+	 *
+	 * @return Number of queued elements.
+	 */
+	uint32 Count() const
+	{
+		int32 Count = int32(uint32(EnqueuePos) - uint32(DequeuePos));
+
+		return (uint32)FMath::Clamp<int32>(Count, 0, (int32)Capacity());
+	}
+
+	/**
+	 * Checks whether the queue is empty.
+	 *
+	 * This is only a guess while other threads are using the queue.
+	 *
+	 * @return true if the queue is empty, false otherwise.
+	 */
+	FORCEINLINE bool IsEmpty() const
+	{
+		return (Count() == 0);
+	}
+
+	/**
+	 * Adds an item to the end of the queue.
+	 *
+	 * @param Element The element to add.
+	 * @return true if the item was added, false if the queue was full.
+	 */
+	FORCEINLINE bool Enqueue(const ElementType& Element)
+	{
+		return EmplaceInternal(Element);
+	}
+
+	/**
+	 * Adds an item to the end of the queue.
+	 *
+	 * @param Element The element to add.
+	 * @return true if the item was added, false if the queue was full.
+	 */
+	FORCEINLINE bool Enqueue(ElementType&& Element)
+	{
+		return EmplaceInternal(MoveTemp(Element));
+	}
+
+	/**
+	 * Adds a batch of items to the end of the queue with a single claim on the tail.
+	 *
+	 * The items are enqueued in order and stay contiguous with respect to other producers.
+	 * If there is not enough room for all of them, a smaller leading part of the batch is enqueued.
+	 *
+	 * @param Elements The elements to add.
+	 * @param Num The number of elements to add.
+	 * @return The number of elements that were added, starting with Elements[0].
+	 */
+	uint32 EnqueueBatch(const ElementType* Elements, uint32 Num)
+	{
+		uint32 Pos;
+		uint32 Claimed = ClaimRange(EnqueuePos, Num, 0, Pos);
+
+		for (uint32 Index = 0; Index < Claimed; ++Index)
+		{
+			FCell& Cell = Cells[(Pos + Index) & IndexMask];
+
+			// the slot is known to be free, but a consumer of the previous lap may not have released it yet
+			WaitForSequence(Cell, Pos + Index);
+			new (&Cell.Storage) ElementType(Elements[Index]);
+			FPlatformMisc::MemoryBarrier();
+			Cell.Sequence = Pos + Index + 1;
+		}
+
+		return Claimed;
+	}
+
+	/**
+	 * Removes an item from the front of the queue.
+	 *
+	 * @param OutElement Will contain the element if the queue is not empty.
+	 * @return true if an element has been returned, false if the queue was empty.
+	 */
+	bool Dequeue(ElementType& OutElement)
+	{
+		FCell* Cell;
+		uint32 Pos = (uint32)DequeuePos;
+
+		while (true)
+		{
+			Cell = &Cells[Pos & IndexMask];
+
+			const uint32 Sequence = Cell->Sequence;
+			const int32 Difference = int32(Sequence - (Pos + 1));
+
+			if (Difference == 0)
+			{
+				const uint32 PrevPos = (uint32)FPlatformAtomics::InterlockedCompareExchange(&DequeuePos, int32(Pos + 1), int32(Pos));
+
+				if (PrevPos == Pos)
+				{
+					break;
+				}
+
+				Pos = PrevPos;
+			}
+			else if (Difference < 0)
+			{
+				return false;
+			}
+			else
+			{
+				Pos = (uint32)DequeuePos;
+			}
+		}
+
+		FPlatformMisc::MemoryBarrier();
+		ReleaseCell(*Cell, Pos, OutElement);
+
+		return true;
+	}
+
+	/**
+	 * Removes a batch of items from the front of the queue with a single claim on the head.
+	 *
+	 * @param OutElements Will contain the removed elements, in queue order. Must have room for Num elements.
+	 * @param Num The maximum number of elements to remove.
+	 * @return The number of elements that were removed.
+	 */
+	uint32 DequeueBatch(ElementType* OutElements, uint32 Num)
+	{
+		uint32 Pos;
+		uint32 Claimed = ClaimRange(DequeuePos, Num, 1, Pos);
+
+		for (uint32 Index = 0; Index < Claimed; ++Index)
+		{
+			FCell& Cell = Cells[(Pos + Index) & IndexMask];
+
+			// the slot is known to be claimed by a producer, but it may still be writing the element
+			WaitForSequence(Cell, Pos + Index + 1);
+			FPlatformMisc::MemoryBarrier();
+			ReleaseCell(Cell, Pos + Index, OutElements[Index]);
+		}
+
+		return Claimed;
+	}
+
+private:
+
+	/** A slot of the ring. Sequence == position for a free slot, position + 1 for a slot holding an element. */
+	struct FCell
+	{
+		volatile uint32 Sequence;
+		TTypeCompatibleBytes<ElementType> Storage;
+	};
+
+	template <typename ArgType>
+	bool EmplaceInternal(ArgType&& Arg)
+	{
+		FCell* Cell;
+		uint32 Pos = (uint32)EnqueuePos;
+
+		while (true)
+		{
+			Cell = &Cells[Pos & IndexMask];
+
+			const uint32 Sequence = Cell->Sequence;
+			const int32 Difference = int32(Sequence - Pos);
+
+			if (Difference == 0)
+			{
+				const uint32 PrevPos = (uint32)FPlatformAtomics::InterlockedCompareExchange(&EnqueuePos, int32(Pos + 1), int32(Pos));
+
+				if (PrevPos == Pos)
+				{
+					break;
+				}
+
+				Pos = PrevPos;
+			}
+			else if (Difference < 0)
+			{
+				return false;
+			}
+			else
+			{
+				Pos = (uint32)EnqueuePos;
+			}
+		}
+
+		new (&Cell->Storage) ElementType(Forward<ArgType>(Arg));
+		FPlatformMisc::MemoryBarrier();
+		Cell->Sequence = Pos + 1;
+
+		return true;
+	}
+
+	/**
+	 * Claims up to Num consecutive positions of the head or tail. Because positions are claimed in order,
+	 * the last slot of a range being ready means every slot before it is ready or about to be.
+	 *
+	 * @param Position EnqueuePos or DequeuePos.
+	 * @param Num The number of positions wanted.
+	 * @param ReadyOffset Sequence offset of a slot ready for this operation (0 for enqueue, 1 for dequeue).
+	 * @param OutPos Will contain the first claimed position.
+	 * @return The number of claimed positions, may be zero.
+	 */
+	uint32 ClaimRange(volatile int32& Position, uint32 Num, uint32 ReadyOffset, uint32& OutPos)
+	{
+		uint32 Pos = (uint32)Position;
+		uint32 Wanted = FMath::Min<uint32>(Num, Capacity());
+
+		while (Wanted > 0)
+		{
+			const uint32 Last = Pos + Wanted - 1;
+			const int32 Difference = int32(Cells[Last & IndexMask].Sequence - (Last + ReadyOffset));
+
+			if (Difference == 0)
+			{
+				const uint32 PrevPos = (uint32)FPlatformAtomics::InterlockedCompareExchange(&Position, int32(Pos + Wanted), int32(Pos));
+
+				if (PrevPos == Pos)
+				{
+					OutPos = Pos;
+					return Wanted;
+				}
+
+				Pos = PrevPos;
+			}
+			else if (Difference < 0)
+			{
+				// not enough room or elements for the whole range, try with a smaller one
+				Wanted /= 2;
+			}
+			else
+			{
+				Pos = (uint32)Position;
+			}
+		}
+
+		OutPos = Pos;
+		return 0;
+	}
+
+	/** Spins until another thread has finished with a slot that was already claimed. */
+	FORCEINLINE void WaitForSequence(const FCell& Cell, uint32 Sequence)
+	{
+		while (Cell.Sequence != Sequence)
+		{
+			FPlatformMisc::MemoryBarrier();
+		}
+	}
+
+	/** Moves the element out of a slot and hands the slot to the producers of the next lap. */
+	FORCEINLINE void ReleaseCell(FCell& Cell, uint32 Pos, ElementType& OutElement)
+	{
+		ElementType* Element = (ElementType*)&Cell.Storage;
+		OutElement = MoveTemp(*Element);
+		Element->~ElementType();
+		FPlatformMisc::MemoryBarrier();
+		Cell.Sequence = Pos + IndexMask + 1;
+	}
+
+private:
+
+	/** Holds the ring of slots. */
+	FCell* Cells;
+
+	/** Holds the capacity minus one. */
+	const uint32 IndexMask;
+
+	/** Holds the position of the next element to write. */
+	MS_ALIGN(PLATFORM_CACHE_LINE_SIZE) volatile int32 EnqueuePos GCC_ALIGN(PLATFORM_CACHE_LINE_SIZE);
+
+	/** Holds the position of the next element to read. */
+	MS_ALIGN(PLATFORM_CACHE_LINE_SIZE) volatile int32 DequeuePos GCC_ALIGN(PLATFORM_CACHE_LINE_SIZE);
+};
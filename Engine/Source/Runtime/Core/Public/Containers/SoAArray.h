@@ -0,0 +1,367 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Misc/AssertionMacros.h"
+#include "HAL/UnrealMemory.h"
+#include "Templates/AndOrNot.h"
+#include "Templates/AlignmentTemplates.h"
+#include "Templates/IsTriviallyDestructible.h"
+#include "Templates/IsTriviallyCopyConstructible.h"
+#include "Templates/Tuple.h"
+#include "Containers/ArrayView.h"
+#include "Math/UnrealMathUtility.h"
+
+
+/**
+ * Dynamic array that stores each field of its elements in a separate column (structure of arrays).
+ *
+ * Passes that only touch one or two fields of many elements then stream through tightly packed memory
+ * instead of skipping over the fields they don't need. Every column starts on a 16 byte boundary and
+ * the capacity is always a multiple of ColumnPadding elements, so float columns can be walked with
+ * aligned VectorRegister loads up to GetNumPadded(). Lanes past Num() hold stale values and must be
+ * masked out by the caller.
+ *
+ *	TSoAArray<FVector, float> Spheres;
+ *	Spheres.Add(Origin, Radius);
+ *	const float* Radii = Spheres.GetColumn<1>().GetData();
+ *	for (int32 Index = 0; Index < Spheres.GetNumPadded(); Index += 4)
+ *	{
+ *		VectorRegister Radius4 = VectorLoadAligned(Radii + Index);
+ *		...
+ *	}
+ *
+ * Only trivially copyable and destructible field types are supported, columns are moved around with memcpy.
+ *
+ * @param FieldTypes The types of the columns.
+ */
+template<typename... FieldTypes>
+class TSoAArray
+{
+	static_assert(sizeof...(FieldTypes) > 0, "TSoAArray needs at least one column");
+	static_assert(TAnd<TIsTriviallyDestructible<FieldTypes>...>::Value, "TSoAArray columns must be trivially destructible");
+	static_assert(TAnd<TIsTriviallyCopyConstructible<FieldTypes>...>::Value, "TSoAArray columns must be trivially copyable");
+
+public:
+
+	enum
+	{
+		/** Number of columns. */
+		NumColumns = sizeof...(FieldTypes),
+		/** Alignment of each column. */
+		ColumnAlignment = 16,
+		/** The capacity is always a multiple of this, so every column can be read in whole vector registers. */
+		ColumnPadding = 4,
+	};
+
+	/** The type of a column. */
+	template<int32 ColumnIndex>
+	struct TColumnType
+	{
+		typedef typename UE4Tuple_Private::TNthTypeFromParameterPack<ColumnIndex, FieldTypes...>::Type Type;
+	};
+
+	/** Default constructor. */
+	TSoAArray()
+		: Data(nullptr)
+		, ArrayNum(0)
+		, ArrayMax(0)
+	{
+		FMemory::Memzero(Columns);
+	}
+
+	/** Copy constructor. */
+	TSoAArray(const TSoAArray& Other)
+		: TSoAArray()
+	{
+		*this = Other;
+	}
+
+	/** Move constructor. */
+	TSoAArray(TSoAArray&& Other)
+		: TSoAArray()
+	{
+		*this = MoveTemp(Other);
+	}
+
+	/** Destructor. */
+	~TSoAArray()
+	{
+		FMemory::Free(Data);
+	}
+
+	/** Copy assignment. */
+	TSoAArray& operator=(const TSoAArray& Other)
+	{
+		if (this != &Other)
+		{
+			Empty(Other.ArrayNum);
+			ArrayNum = Other.ArrayNum;
+			for (int32 ColumnIndex = 0; ColumnIndex < NumColumns && ArrayNum; ++ColumnIndex)
+			{
+				FMemory::Memcpy(Columns[ColumnIndex], Other.Columns[ColumnIndex], ArrayNum * GetColumnElementSize(ColumnIndex));
+			}
+		}
+		return *this;
+	}
+
+	/** Move assignment. */
+	TSoAArray& operator=(TSoAArray&& Other)
+	{
+		if (this != &Other)
+		{
+			FMemory::Free(Data);
+			Data = Other.Data;
+			ArrayNum = Other.ArrayNum;
+			ArrayMax = Other.ArrayMax;
+			FMemory::Memcpy(Columns, Other.Columns, sizeof(Columns));
+
+			Other.Data = nullptr;
+			Other.ArrayNum = 0;
+			Other.ArrayMax = 0;
+			FMemory::Memzero(Other.Columns);
+		}
+		return *this;
+	}
+
+public:
+
+	/** @return the number of elements. */
+	FORCEINLINE int32 Num() const
+	{
+		return ArrayNum;
+	}
+
+	/** @return the number of elements rounded up to ColumnPadding, all of which can be read from every column. */
+	FORCEINLINE int32 GetNumPadded() const
+	{
+		return Align(ArrayNum, (int32)ColumnPadding);
+	}
+
+	/** @return the number of elements that fit without reallocating. */
+	FORCEINLINE int32 Max() const
+	{
+		return ArrayMax;
+	}
+
+	/** @return true if the array has no elements. */
+	FORCEINLINE bool IsEmpty() const
+	{
+		return ArrayNum == 0;
+	}
+
+	/** @return true if Index refers to an element. */
+	FORCEINLINE bool IsValidIndex(int32 Index) const
+	{
+		return Index >= 0 && Index < ArrayNum;
+	}
+
+	/** @return the amount of memory allocated by the array. */
+	SIZE_T GetAllocatedSize() const
+	{
+		return Data ? CalculateAllocationSize(ArrayMax) : 0;
+	}
+
+	/**
+	 * Gets a view of a whole column.
+	 *
+	 * @return View of the first Num() values of the column, the data is aligned to ColumnAlignment.
+	 */
+	template<int32 ColumnIndex>
+	FORCEINLINE TArrayView<typename TColumnType<ColumnIndex>::Type> GetColumn()
+	{
+		return TArrayView<typename TColumnType<ColumnIndex>::Type>(GetColumnData<ColumnIndex>(), ArrayNum);
+	}
+
+	template<int32 ColumnIndex>
+	FORCEINLINE TArrayView<const typename TColumnType<ColumnIndex>::Type> GetColumn() const
+	{
+		return TArrayView<const typename TColumnType<ColumnIndex>::Type>(GetColumnData<ColumnIndex>(), ArrayNum);
+	}
+
+	/**
+	 * Gets one field of an element.
+	 *
+	 * @param Index The element.
+	 * @return Reference to the field in the column.
+	 */
+	template<int32 ColumnIndex>
+	FORCEINLINE typename TColumnType<ColumnIndex>::Type& Get(int32 Index)
+	{
+		RangeCheck(Index);
+		return GetColumnData<ColumnIndex>()[Index];
+	}
+
+	template<int32 ColumnIndex>
+	FORCEINLINE const typename TColumnType<ColumnIndex>::Type& Get(int32 Index) const
+	{
+		RangeCheck(Index);
+		return GetColumnData<ColumnIndex>()[Index];
+	}
+
+	/**
+	 * Adds an element to the end of the array.
+	 *
+	 * @param Values One value per column, taken by value so they may come from this array.
+	 * @return Index of the new element.
+	 */
+	int32 Add(FieldTypes... Values)
+	{
+		const int32 Index = AddUninitialized(1);
+		int32 ColumnIndex = 0;
+		int32 Dummy[] = { 0, (new ((FieldTypes*)Columns[ColumnIndex++] + Index) FieldTypes(Values), 0)... };
+		(void)Dummy;
+		return Index;
+	}
+
+	/**
+	 * Adds uninitialized elements, every column must be filled in by the caller.
+	 *
+	 * @param Count Number of elements to add.
+	 * @return Index of the first new element.
+	 */
+	int32 AddUninitialized(int32 Count = 1)
+	{
+		check(Count >= 0);
+
+		const int32 OldNum = ArrayNum;
+		if (OldNum + Count > ArrayMax)
+		{
+			ResizeTo(FMath::Max(OldNum + Count, ArrayMax + ArrayMax / 2));
+		}
+		ArrayNum += Count;
+		return OldNum;
+	}
+
+	/**
+	 * Removes an element by moving the last element into its place. Doesn't preserve order.
+	 *
+	 * @param Index The element to remove.
+	 */
+	void RemoveAtSwap(int32 Index)
+	{
+		RangeCheck(Index);
+
+		const int32 LastIndex = ArrayNum - 1;
+		if (Index != LastIndex)
+		{
+			for (int32 ColumnIndex = 0; ColumnIndex < NumColumns; ++ColumnIndex)
+			{
+				const SIZE_T ElementSize = GetColumnElementSize(ColumnIndex);
+				uint8* Column = (uint8*)Columns[ColumnIndex];
+				FMemory::Memcpy(Column + Index * ElementSize, Column + LastIndex * ElementSize, ElementSize);
+			}
+		}
+		--ArrayNum;
+	}
+
+	/**
+	 * Makes sure there is room for a number of elements without reallocating.
+	 *
+	 * @param Number The number of elements.
+	 */
+	void Reserve(int32 Number)
+	{
+		if (Number > ArrayMax)
+		{
+			ResizeTo(Number);
+		}
+	}
+
+	/**
+	 * Removes all elements.
+	 *
+	 * @param Slack The number of elements to keep room for, the allocation is released when zero.
+	 */
+	void Empty(int32 Slack = 0)
+	{
+		ArrayNum = 0;
+		if (Slack == 0 || Slack > ArrayMax)
+		{
+			ResizeTo(Slack);
+		}
+	}
+
+	/** Removes all elements but keeps the allocation. */
+	FORCEINLINE void Reset()
+	{
+		ArrayNum = 0;
+	}
+
+private:
+
+	/** @return the start of a column, cast to its type. */
+	template<int32 ColumnIndex>
+	FORCEINLINE typename TColumnType<ColumnIndex>::Type* GetColumnData() const
+	{
+		static_assert(ColumnIndex >= 0 && ColumnIndex < NumColumns, "Column index out of range");
+		return (typename TColumnType<ColumnIndex>::Type*)Columns[ColumnIndex];
+	}
+
+	/** @return the size of one value in a column. */
+	static FORCEINLINE SIZE_T GetColumnElementSize(int32 ColumnIndex)
+	{
+		static const SIZE_T ElementSizes[] = { sizeof(FieldTypes)... };
+		return ElementSizes[ColumnIndex];
+	}
+
+	/** @return the size of a single allocation holding every column for a capacity, including alignment padding. */
+	static SIZE_T CalculateAllocationSize(int32 Capacity)
+	{
+		SIZE_T Size = 0;
+		for (int32 ColumnIndex = 0; ColumnIndex < NumColumns; ++ColumnIndex)
+		{
+			Size = Align(Size, (SIZE_T)ColumnAlignment) + Capacity * GetColumnElementSize(ColumnIndex);
+		}
+		return Size;
+	}
+
+	/** Reallocates all columns into one block with room for at least NewMax elements, keeping the existing values. */
+	void ResizeTo(int32 NewMax)
+	{
+		NewMax = Align(NewMax, (int32)ColumnPadding);
+		check(NewMax >= ArrayNum);
+
+		uint8* NewData = nullptr;
+		void* NewColumns[NumColumns] = {};
+		if (NewMax > 0)
+		{
+			NewData = (uint8*)FMemory::Malloc(CalculateAllocationSize(NewMax), ColumnAlignment);
+
+			SIZE_T Offset = 0;
+			for (int32 ColumnIndex = 0; ColumnIndex < NumColumns; ++ColumnIndex)
+			{
+				Offset = Align(Offset, (SIZE_T)ColumnAlignment);
+				NewColumns[ColumnIndex] = NewData + Offset;
+				if (ArrayNum)
+				{
+					FMemory::Memcpy(NewColumns[ColumnIndex], Columns[ColumnIndex], ArrayNum * GetColumnElementSize(ColumnIndex));
+				}
+				Offset += NewMax * GetColumnElementSize(ColumnIndex);
+			}
+		}
+
+		FMemory::Free(Data);
+		Data = NewData;
+		ArrayMax = NewMax;
+		FMemory::Memcpy(Columns, NewColumns, sizeof(Columns));
+	}
+
+	FORCEINLINE void RangeCheck(int32 Index) const
+	{
+		checkf((Index >= 0) & (Index < ArrayNum), TEXT("Array index out of bounds: %i from an array of size %i"), Index, ArrayNum);
+	}
+
+	/** The single allocation holding all columns. */
+	uint8* Data;
+
+	/** Start of each column inside Data. */
+	void* Columns[NumColumns];
+
+	/** Number of elements. */
+	int32 ArrayNum;
+
+	/** Capacity of every column. */
+	int32 ArrayMax;
+};
@@ -13,6 +13,7 @@
 #include "Misc/EnumClassFlags.h"
 
 class IAsyncReadFileHandle;
+class IMappedFileHandle;
 
 /**
 * Enum for async IO priorities.
@@ -341,6 +342,16 @@ public:
 	*/
 	virtual IAsyncReadFileHandle* OpenAsyncRead(const TCHAR* Filename);
 
+	/** Open a file for memory mapping. Only supported by some platforms and platform file layers.
+	*
+	* @param Filename file to be opened
+	* @return Close the file by delete'ing the handle, after all of its regions have been deleted. nullptr if the file can't be mapped.
+	*/
+	virtual IMappedFileHandle* OpenMapped(const TCHAR* Filename)
+	{
+		return nullptr;
+	}
+
 	virtual void GetTimeStampPair(const TCHAR* PathA, const TCHAR* PathB, FDateTime& OutTimeStampA, FDateTime& OutTimeStampB);
 
 	/** Return the modification time of a file in the local time of the calling code (GetTimeStamp returns UTC). Returns FDateTime::MinValue() on failure **/
@@ -543,6 +543,56 @@ struct CORE_API FGenericPlatformProcess
 	 * @return true if the platform can use multiple threads, false otherwise.
 	 */
 	static bool SupportsMultithreading();
+
+	/** Entry point of a fiber created by CreateFiber. It must never return, a fiber ends by switching away and being deleted. */
+	typedef void (*FFiberEntryPoint)(void* Param);
+
+	/**
+	 * Gets whether this platform implements the fiber functions below.
+	 *
+	 * @return true if fibers can be used, false otherwise.
+	 */
+	static bool SupportsFibers() { return false; }
+
+	/**
+	 * Turns the calling thread into a fiber so it can switch to other fibers. Must be called before any
+	 * other fiber function on a thread.
+	 *
+	 * @return The fiber that represents the calling thread, or nullptr if fibers are not supported.
+	 * @see ConvertFiberToThread
+	 */
+	static void* ConvertThreadToFiber() { return nullptr; }
+
+	/**
+	 * Turns the calling thread back into a plain thread. Must be called from the fiber ConvertThreadToFiber returned.
+	 *
+	 * @param ThreadFiber The fiber returned by ConvertThreadToFiber, it is freed by this call.
+	 */
+	static void ConvertFiberToThread(void* ThreadFiber) { }
+
+	/**
+	 * Creates a fiber that starts running EntryPoint the first time it is switched to.
+	 *
+	 * @param StackSize Size of the fiber's stack in bytes, 0 for the platform default.
+	 * @param EntryPoint Function the fiber runs.
+	 * @param Param Passed to EntryPoint.
+	 * @return The new fiber, or nullptr if fibers are not supported.
+	 */
+	static void* CreateFiber(uint32 StackSize, FFiberEntryPoint EntryPoint, void* Param) { return nullptr; }
+
+	/**
+	 * Deletes a fiber created by CreateFiber. The fiber must not be running on any thread.
+	 *
+	 * @param Fiber The fiber to delete.
+	 */
+	static void DeleteFiber(void* Fiber) { }
+
+	/**
+	 * Suspends the calling fiber and resumes another one on the calling thread.
+	 *
+	 * @param Fiber The fiber to run, created by CreateFiber or ConvertThreadToFiber on this thread.
+	 */
+	static void SwitchToFiber(void* Fiber) { }
 	
 	/** Enables Real Time Mode on the current thread. */
 	static void SetRealTimeMode() { }
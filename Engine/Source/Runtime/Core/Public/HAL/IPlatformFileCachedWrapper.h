@@ -400,4 +400,8 @@ public:
 	{
 		return LowerLevel->OpenAsyncRead(Filename);
 	}
+	virtual IMappedFileHandle* OpenMapped(const TCHAR* Filename) override
+	{
+		return LowerLevel->OpenMapped(Filename);
+	}
 };
@@ -458,4 +458,13 @@ public:
 		//@todo no wrapped logging for async file handles (yet)
 		return Result;
 	}
+	virtual IMappedFileHandle* OpenMapped(const TCHAR* Filename) override
+	{
+		FILE_LOG(LogPlatformFile, Log, TEXT("OpenMapped %s"), Filename);
+		double StartTime = FPlatformTime::Seconds();
+		IMappedFileHandle* Result = LowerLevel->OpenMapped(Filename);
+		float ThisTime = (FPlatformTime::Seconds() - StartTime) / 1000.0;
+		FILE_LOG(LogPlatformFile, Log, TEXT("OpenMapped return %llx [%fms]"), uint64(Result), ThisTime);
+		return Result;
+	}
 };
@@ -252,6 +252,16 @@ public:
 		// we must not record the "open" here...what matters is when we start reading the file!
 		return new FLoggingAsyncReadFileHandle(this, Filename, LowerLevel->OpenAsyncRead(Filename));
 	}
+	virtual IMappedFileHandle* OpenMapped(const TCHAR* Filename) override
+	{
+		IMappedFileHandle* Result = LowerLevel->OpenMapped(Filename);
+		if (Result)
+		{
+			// there are no reads to watch, the file is as good as read once it is mapped
+			AddToOpenLog(Filename);
+		}
+		return Result;
+	}
 
 	void AddToOpenLog(const TCHAR* Filename)
 	{
@@ -492,6 +492,11 @@ public:
 		return LowerLevel->OpenAsyncRead(Filename);
 	}
 
+	virtual IMappedFileHandle* OpenMapped(const TCHAR* Filename) override
+	{
+		return LowerLevel->OpenMapped(Filename);
+	}
+
 	//static void CreateProfileVisualizer
 };
 
@@ -702,6 +707,10 @@ public:
 		//@todo no wrapped async handles (yet)
 		return LowerLevel->OpenAsyncRead(Filename);
 	}
+	virtual IMappedFileHandle* OpenMapped(const TCHAR* Filename) override
+	{
+		return LowerLevel->OpenMapped(Filename);
+	}
 };
 
 
@@ -0,0 +1,124 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "HAL/PlatformTLS.h"
+
+class FMalloc;
+
+/**
+ * Governs whether every allocation is attributed to the innermost LLM_SCOPE of the allocating thread.
+ * Costs 16 bytes per allocation and an atomic add per allocation and free, meant for test builds checking memory budgets.
+ */
+#ifndef ENABLE_LOW_LEVEL_MEM_TRACKER
+	#define ENABLE_LOW_LEVEL_MEM_TRACKER 0
+#endif
+
+#if ENABLE_LOW_LEVEL_MEM_TRACKER && PLATFORM_USES_FIXED_GMalloc_CLASS
+	#error "Turn off PLATFORM_USES_FIXED_GMalloc_CLASS in order to use the low level memory tracker"
+#endif
+
+/** Subsystems allocations can be attributed to, add new tags before Count */
+#define LLM_ENUM_TAGS(macro) \
+	macro(Untagged,			"Untagged") \
+	macro(UObject,			"UObject") \
+	macro(AsyncLoading,		"AsyncLoading") \
+	macro(Textures,			"Textures") \
+	macro(Meshes,			"Meshes") \
+	macro(Shaders,			"Shaders") \
+	macro(RenderTargets,	"RenderTargets") \
+	macro(Physics,			"Physics") \
+	macro(Animation,		"Animation") \
+	macro(Audio,			"Audio") \
+	macro(Networking,		"Networking") \
+	macro(UI,				"UI")
+
+#define LLM_ENUM_TAG_VALUE(Enum, Name) Enum,
+
+enum class ELLMTag : uint8
+{
+	LLM_ENUM_TAGS(LLM_ENUM_TAG_VALUE)
+	Count
+};
+
+#undef LLM_ENUM_TAG_VALUE
+
+/**
+ * Per subsystem memory counters fed by a malloc proxy, see LLM_SCOPE.
+ * llm.Dump logs the current amounts, llm.Csv (or -llmcsv) writes them to Saved/Profiling/LLM once per frame.
+ */
+class CORE_API FLowLevelMemTracker
+{
+public:
+	/** Whether allocations are being tracked, false unless the proxy was installed when GMalloc got created */
+	static bool IsEnabled()
+	{
+		return bEnabled;
+	}
+
+	/** Wraps the allocator so its allocations are tracked, called once by FMemory::GCreateMalloc */
+	static FMalloc* CreateMallocProxy(FMalloc* InMalloc);
+
+	/** Tag new allocations of the calling thread are attributed to */
+	static FORCEINLINE ELLMTag GetCurrentTag()
+	{
+		return bEnabled ? (ELLMTag)(UPTRINT)FPlatformTLS::GetTlsValue(TlsSlot) : ELLMTag::Untagged;
+	}
+
+	static FORCEINLINE void SetCurrentTag(ELLMTag Tag)
+	{
+		// The tls slot only exists once the proxy is installed
+		if (bEnabled)
+		{
+			FPlatformTLS::SetTlsValue(TlsSlot, (void*)(UPTRINT)Tag);
+		}
+	}
+
+	/** Bytes requested by live allocations of the tag, not including allocator overhead */
+	static int64 GetTagAmount(ELLMTag Tag)
+	{
+		return TagAmounts[(uint32)Tag];
+	}
+
+	static const TCHAR* GetTagName(ELLMTag Tag);
+
+	/** Called by the game thread once per frame, writes the csv row if llm.Csv is enabled */
+	static void EndFrame();
+
+private:
+	friend class FMallocLLMProxy;
+
+	static bool bEnabled;
+
+	/** Holds the current tag of each thread, allocated before the first tracked allocation */
+	static uint32 TlsSlot;
+
+	static volatile int64 TagAmounts[(uint32)ELLMTag::Count];
+};
+
+/** Attributes allocations of the calling thread to a tag for the lifetime of the scope */
+class FLLMScope
+{
+public:
+	FORCEINLINE FLLMScope(ELLMTag Tag)
+		: PreviousTag(FLowLevelMemTracker::GetCurrentTag())
+	{
+		FLowLevelMemTracker::SetCurrentTag(Tag);
+	}
+
+	FORCEINLINE ~FLLMScope()
+	{
+		FLowLevelMemTracker::SetCurrentTag(PreviousTag);
+	}
+
+private:
+	ELLMTag PreviousTag;
+};
+
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+	/** Attributes allocations made by the calling thread in the rest of the enclosing C++ scope to the tag */
+	#define LLM_SCOPE(Tag) FLLMScope PREPROCESSOR_JOIN(LLMScope, __LINE__)(Tag);
+#else
+	#define LLM_SCOPE(Tag)
+#endif
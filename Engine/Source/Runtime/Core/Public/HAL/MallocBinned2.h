@@ -304,6 +304,12 @@ class CORE_API FMallocBinned2 final : public FMalloc
 			return PartialBundle.Head ? PartialBundle.PopHead() : nullptr;
 		}
 
+		// number of blocks held by this list; only exact when called from the owning thread
+		FORCEINLINE uint32 NumCachedBlocks() const
+		{
+			return PartialBundle.Count + FullBundle.Count;
+		}
+
 		// tries to recycle the full bundle, if that fails, it is returned for freeing
 		FBundleNode* RecyleFull(uint32 InPoolIndex);
 		bool ObtainPartial(uint32 InPoolIndex);
@@ -350,6 +356,25 @@ class CORE_API FMallocBinned2 final : public FMalloc
 		{
 			return FreeLists[InPoolIndex].PopBundles(InPoolIndex);
 		}
+		// number of blocks cached for a pool; read by other threads for stats, so only a guess unless called from the owning thread
+		uint32 NumCachedBlocks(uint32 InPoolIndex) const
+		{
+			return FreeLists[InPoolIndex].NumCachedBlocks();
+		}
+
+		FPerThreadFreeBlockLists()
+			: NextRegistered(nullptr)
+			, ThreadId(FPlatformTLS::GetCurrentThreadId())
+			, NumTrims(0)
+		{
+		}
+
+		/** Next entry in the list of all thread caches, used to gather stats. Protected by the registry lock. */
+		FPerThreadFreeBlockLists* NextRegistered;
+		/** Id of the owning thread */
+		uint32 ThreadId;
+		/** Number of times the owning thread returned its cache to the shared pools */
+		uint32 NumTrims;
 	private:
 		FFreeBlockList FreeLists[BINNED2_SMALL_POOL_COUNT];
 	};
@@ -449,6 +474,9 @@ public:
 		FreeExternal(Ptr);
 	}
 
+	virtual void MallocBulk(void** OutPtrs, int32 NumPtrs, SIZE_T Size, uint32 Alignment) override;
+	virtual void FreeBulk(void** Ptrs, int32 NumPtrs) override;
+
 	FORCEINLINE virtual bool GetAllocationSize(void *Ptr, SIZE_T &SizeOut) override
 	{
 		if (!IsOSAllocation(Ptr))
@@ -486,7 +514,11 @@ public:
 	virtual void Trim() override;
 	virtual void SetupTLSCachesOnCurrentThread() override;
 	virtual void ClearAndDisableTLSCachesOnCurrentThread() override;
+	virtual void TrimCurrentThreadCache() override;
 	virtual const TCHAR* GetDescriptiveName() override;
+	virtual void InitializeStatsMetadata() override;
+	virtual void UpdateStats() override;
+	virtual void DumpAllocatorStats(class FOutputDevice& Ar) override;
 	// End FMalloc interface.
 
 	void FlushCurrentThreadCache();
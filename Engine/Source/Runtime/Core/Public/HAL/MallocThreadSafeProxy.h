@@ -67,6 +67,20 @@ public:
 		}
 	}
 
+	virtual void MallocBulk( void** OutPtrs, int32 NumPtrs, SIZE_T Size, uint32 Alignment ) override
+	{
+		IncrementTotalMallocCalls();
+		FScopeLock ScopeLock( &SynchronizationObject );
+		UsedMalloc->MallocBulk( OutPtrs, NumPtrs, Size, Alignment );
+	}
+
+	virtual void FreeBulk( void** Ptrs, int32 NumPtrs ) override
+	{
+		IncrementTotalFreeCalls();
+		FScopeLock ScopeLock( &SynchronizationObject );
+		UsedMalloc->FreeBulk( Ptrs, NumPtrs );
+	}
+
 	/** Writes allocator stats from the last update into the specified destination. */
 	virtual void GetAllocatorStats( FGenericMemoryStats& out_Stats ) override
 	{
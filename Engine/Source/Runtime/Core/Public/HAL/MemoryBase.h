@@ -89,6 +89,40 @@ public:
 	 * Free
 	 */
 	virtual void Free( void* Original ) = 0;
+
+	/**
+	 * Allocates a number of blocks of the same size and alignment in one call. Allocators that keep
+	 * free blocks in per-size lists hand them out in batches, the default just calls Malloc for each.
+	 *
+	 * @param OutPtrs Receives NumPtrs pointers to the new blocks
+	 * @param NumPtrs Number of blocks to allocate
+	 * @param Count Size of each block
+	 * @param Alignment Alignment of each block
+	 */
+	virtual void MallocBulk( void** OutPtrs, int32 NumPtrs, SIZE_T Count, uint32 Alignment=DEFAULT_ALIGNMENT )
+	{
+		for (int32 Index = 0; Index < NumPtrs; Index++)
+		{
+			OutPtrs[Index] = Malloc( Count, Alignment );
+		}
+	}
+
+	/**
+	 * Frees a number of blocks in one call. The blocks don't need to have the same size, null pointers are skipped.
+	 *
+	 * @param Ptrs The blocks to free
+	 * @param NumPtrs Number of blocks in Ptrs
+	 */
+	virtual void FreeBulk( void** Ptrs, int32 NumPtrs )
+	{
+		for (int32 Index = 0; Index < NumPtrs; Index++)
+		{
+			if (Ptrs[Index])
+			{
+				Free( Ptrs[Index] );
+			}
+		}
+	}
 		
 	/** 
 	* For some allocators this will return the actual size that should be requested to eliminate
@@ -134,6 +168,14 @@ public:
 	{
 	}
 
+	/**
+	* Returns the blocks cached by the current thread to the shared pools, the cache stays enabled.
+	* Meant to be called by threads that are about to go idle so their caches don't pin memory.
+	*/
+	virtual void TrimCurrentThreadCache()
+	{
+	}
+
 	/**
 	*	Initializes stats metadata. We need to do this as soon as possible, but cannot be done in the constructor
 	*	due to the FName::StaticInit
@@ -265,6 +265,9 @@
 #ifndef PLATFORM_HAS_BSD_SOCKET_FEATURE_CLOSE_ON_EXEC
 	#define PLATFORM_HAS_BSD_SOCKET_FEATURE_CLOSE_ON_EXEC	0
 #endif
+#ifndef PLATFORM_HAS_BSD_SOCKET_FEATURE_MMSG
+	#define PLATFORM_HAS_BSD_SOCKET_FEATURE_MMSG	0
+#endif
 #ifndef PLATFORM_HAS_NO_EPROCLIM
 	#define PLATFORM_HAS_NO_EPROCLIM			0
 #endif
@@ -7,6 +7,7 @@
 #include "HAL/ThreadSafeCounter.h"
 #include "HAL/Runnable.h"
 #include "HAL/ThreadSafeBool.h"
+#include "Delegates/Delegate.h"
 
 /**
  * Thread heartbeat check class.
@@ -91,6 +92,81 @@ public:
 	//~ End FRunnable Interface
 };
 
+/**
+ * Called on the hitch detection thread after a hitch capture has been written.
+ * @param Filename	The file the capture was written to.
+ * @param Report	Contents of the capture, e.g. to send it to a collection endpoint.
+ */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnHitchCaptured, const FString& /*Filename*/, const FString& /*Report*/);
+
+/**
+ * Game thread hitch detector.
+ * When a game thread frame takes longer than t.HitchDetection.ThresholdMS, a sampling thread walks the game and
+ * render thread stacks until the frame ends and writes the folded stacks, together with the frame trace scopes
+ * that were open on those threads, to Saved/Profiling/Hitches.
+ */
+class CORE_API FGameThreadHitchHeartBeat : public FRunnable
+{
+	static FGameThreadHitchHeartBeat* Singleton;
+
+	/** A distinct callstack of a sampled thread */
+	struct FStackSample
+	{
+		uint32 CRC;
+		FString Stack;
+		int32 Count;
+	};
+
+	/** Thread to run the worker FRunnable on */
+	FRunnableThread* Thread;
+	/** Stops this thread */
+	FThreadSafeCounter StopTaskCounter;
+	/** Synch object for the frame start */
+	FCriticalSection FrameCritical;
+	/** Time the current game thread frame started, 0 if the frame shouldn't be measured */
+	double FrameStartTime;
+	/** Incremented by every FrameStart, so the sampling thread can tell when the hitching frame is over */
+	uint32 FrameCounter;
+	/** Time the last capture was written */
+	double LastCaptureTime;
+
+	FGameThreadHitchHeartBeat();
+	virtual ~FGameThreadHitchHeartBeat();
+
+	/** Threshold in seconds, 0 if hitch detection is disabled */
+	double GetHitchThreshold() const;
+
+	/** Samples the stacks of the game and render thread until the hitching frame ends and writes the capture */
+	void CaptureHitch(double StartTime, uint32 HitchFrameCounter);
+
+	/** Adds the current callstack of a thread to its samples */
+	static void SampleThread(uint32 ThreadId, TArray<FStackSample>& Samples, ANSICHAR* StackTrace, SIZE_T StackTraceSize);
+
+	/** Appends the open scopes and folded stack samples of one thread to a hitch report */
+	static void AppendThreadToReport(FString& Report, const TCHAR* ThreadName, const FString& OpenScopes, const TArray<FStackSample>& Samples, int32 NumSamples);
+
+public:
+
+	/** Gets the hitch detector singleton */
+	static FGameThreadHitchHeartBeat& Get();
+	static FGameThreadHitchHeartBeat* GetNoInit();
+
+	/**
+	 * Called by the game thread at the start of every frame.
+	 * @param bSkipThisFrame	Don't measure this frame, e.g. because it is expected to take long.
+	 */
+	void FrameStart(bool bSkipThisFrame = false);
+
+	/** Broadcast on the hitch detection thread, bind it before the first frame */
+	FOnHitchCaptured OnHitchCaptured;
+
+	//~ Begin FRunnable Interface.
+	virtual bool Init();
+	virtual uint32 Run();
+	virtual void Stop();
+	//~ End FRunnable Interface
+};
+
 /** Suspends heartbeat measuring for the current thread in the current scope */
 struct FSlowHeartBeatScope
 {
@@ -191,6 +191,17 @@ struct CORE_API FMemory
 	static void* Realloc(void* Original, SIZE_T Count, uint32 Alignment = DEFAULT_ALIGNMENT);
 	static void Free(void* Original);
 	static SIZE_T GetAllocSize(void* Original);
+
+	/**
+	* Allocates NumPtrs blocks of the same size and alignment in one call, which is cheaper than calling Malloc for each with allocators that support it.
+	*/
+	static void MallocBulk(void** OutPtrs, int32 NumPtrs, SIZE_T Count, uint32 Alignment = DEFAULT_ALIGNMENT);
+
+	/**
+	* Frees NumPtrs blocks in one call. Null pointers are skipped.
+	*/
+	static void FreeBulk(void** Ptrs, int32 NumPtrs);
+
 	/**
 	* For some allocators this will return the actual size that should be requested to eliminate
 	* internal fragmentation. The return value will always be >= Count. This can be used to grow
@@ -214,6 +225,11 @@ struct CORE_API FMemory
 	*/
 	static void ClearAndDisableTLSCachesOnCurrentThread();
 
+	/**
+	* Returns the blocks cached by the current thread to the shared pools. Called by threads that are going idle.
+	*/
+	static void TrimCurrentThreadCache();
+
 	//
 	// Malloc for GPU mapped memory on UMA systems (XB1/PS4/etc)
 	// It is expected that the RHI on platforms that use these knows what to 
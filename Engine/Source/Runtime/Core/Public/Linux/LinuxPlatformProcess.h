@@ -280,6 +280,12 @@ struct CORE_API FLinuxPlatformProcess : public FGenericPlatformProcess
 	static uint32 GetCurrentProcessId();
 	static bool GetProcReturnCode( FProcHandle & ProcHandle, int32* ReturnCode );
 	static bool Daemonize();
+	static bool SupportsFibers() { return true; }
+	static void* ConvertThreadToFiber();
+	static void ConvertFiberToThread(void* ThreadFiber);
+	static void* CreateFiber(uint32 StackSize, FFiberEntryPoint EntryPoint, void* Param);
+	static void DeleteFiber(void* Fiber);
+	static void SwitchToFiber(void* Fiber);
 	static bool IsApplicationRunning( uint32 ProcessId );
 	static bool IsApplicationRunning( const TCHAR* ProcName );
 	static bool IsThisApplicationForeground();
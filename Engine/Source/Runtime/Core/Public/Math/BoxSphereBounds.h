@@ -10,6 +10,8 @@
 #include "Math/Sphere.h"
 #include "Math/Box.h"
 
+template<typename InElementType> class TArrayView;
+
 /**
  * Structure for a combined axis aligned bounding box and bounding sphere with the same origin. (28 bytes).
  */
@@ -239,6 +241,24 @@ public:
 	 */
 	CORE_API FBoxSphereBounds TransformBy( const FTransform& M ) const;
 
+	/**
+	 * Transforms an array of bounding volumes by the same matrix, loading the matrix only once.
+	 *
+	 * @param M The matrix.
+	 * @param InBounds The volumes to transform.
+	 * @param OutBounds Receives the transformed volumes, must have as many elements as InBounds and may be the same array.
+	 */
+	static CORE_API void TransformBy( const FMatrix& M, TArrayView<const FBoxSphereBounds> InBounds, TArrayView<FBoxSphereBounds> OutBounds );
+
+	/**
+	 * Transforms an array of bounding volumes by the same FTransform object, converting it to a matrix only once.
+	 *
+	 * @param M The FTransform object.
+	 * @param InBounds The volumes to transform.
+	 * @param OutBounds Receives the transformed volumes, must have as many elements as InBounds and may be the same array.
+	 */
+	static CORE_API void TransformBy( const FTransform& M, TArrayView<const FBoxSphereBounds> InBounds, TArrayView<FBoxSphereBounds> OutBounds );
+
 	/**
 	 * Get a textual representation of this bounding box.
 	 *
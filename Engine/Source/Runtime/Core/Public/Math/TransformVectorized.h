@@ -17,6 +17,8 @@
 
 #if ENABLE_VECTORIZED_TRANSFORM
 
+template<typename InElementType> class TArrayView;
+
 /**
  * Transform composed of Scale, Rotation (as a quaternion), and Translation.
  *
@@ -559,6 +561,12 @@ public:
 	FORCEINLINE FVector		TransformPosition(const FVector& V) const;
 	FORCEINLINE FVector		TransformPositionNoScale(const FVector& V) const;
 
+	/**
+	 * Transforms an array of positions, equivalent to calling TransformPosition on each of them but without reloading the transform for every position.
+	 * InPositions and OutPositions must have the same number of elements, and may be the same array to transform in place.
+	 */
+	CORE_API void			TransformPositions(TArrayView<const FVector> InPositions, TArrayView<FVector> OutPositions) const;
+
 
 	/** Inverts the matrix and then transforms V - correctly handles scaling in this matrix. */
 	FORCEINLINE FVector		InverseTransformPosition(const FVector &V) const;
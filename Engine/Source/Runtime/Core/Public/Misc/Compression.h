@@ -4,6 +4,9 @@
 
 #include "CoreTypes.h"
 
+class FName;
+struct ICompressionFormat;
+
 /**
  * Flags controlling [de]compression
  */
@@ -15,6 +18,8 @@ enum ECompressionFlags
 	COMPRESS_ZLIB 					= 0x01,
 	/** Compress with GZIP															*/
 	COMPRESS_GZIP					= 0x02,
+	/** Compress with a registered ICompressionFormat, the format id is stored in COMPRESSION_FLAGS_CUSTOM_FORMAT_MASK	*/
+	COMPRESS_Custom					= 0x04,
 	/** Prefer compression that compresses smaller (ONLY VALID FOR COMPRESSION)		*/
 	COMPRESS_BiasMemory 			= 0x10,
 	/** Prefer compression that compresses faster (ONLY VALID FOR COMPRESSION)		*/
@@ -32,6 +37,12 @@ enum ECompressionFlags
 /** mask out compression type */
 #define COMPRESSION_FLAGS_OPTIONS_MASK	0xF0
 
+/** mask out the ICompressionFormat id used with COMPRESS_Custom */
+#define COMPRESSION_FLAGS_CUSTOM_FORMAT_MASK	0xFF00
+
+/** shift of the ICompressionFormat id used with COMPRESS_Custom */
+#define COMPRESSION_FLAGS_CUSTOM_FORMAT_SHIFT	8
+
 /** Default compressor bit window for Zlib */
 #define DEFAULT_ZLIB_BIT_WINDOW		15
 
@@ -90,6 +101,23 @@ struct FCompression
 	 * @return true if compression succeeds, false if it fails because CompressedBuffer was too small or other reasons
 	 */
 	CORE_API static bool UncompressMemory( ECompressionFlags Flags, void* UncompressedBuffer, int32 UncompressedSize, const void* CompressedBuffer, int32 CompressedSize, bool bIsSourcePadded = false, int32 BitWindow = DEFAULT_ZLIB_BIT_WINDOW );
+
+	/**
+	 * Gets the flags that select a registered ICompressionFormat.
+	 *
+	 * @param	FormatName					Name of the format, as returned by ICompressionFormat::GetCompressionFormatName
+	 * @param	OutFlags					The flags to compress with, only set if the format is registered
+	 * @return true if a format with that name is registered
+	 */
+	CORE_API static bool GetCustomCompressionFlags( FName FormatName, ECompressionFlags& OutFlags );
+
+	/**
+	 * Finds the registered ICompressionFormat selected by a set of flags.
+	 *
+	 * @param	Flags						Flags that include COMPRESS_Custom
+	 * @return the format, nullptr if the flags don't select a custom format or it isn't registered
+	 */
+	CORE_API static ICompressionFormat* GetCustomCompressionFormat( ECompressionFlags Flags );
 };
 
 
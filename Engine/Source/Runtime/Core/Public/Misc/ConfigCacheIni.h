@@ -320,6 +320,12 @@ public:
 	CORE_API bool Write( const FString& Filename, bool bDoRemoteWrite=true, const FString& InitialText=FString() );
 	CORE_API void Dump(FOutputDevice& Ar);
 
+	/**
+	 * Serializes the sections and array of struct keys of this file, used to cache merged ini hierarchies in binary form.
+	 * The archive has to serialize FNames as strings.
+	 */
+	CORE_API void SerializeSections(FArchive& Ar);
+
 	CORE_API bool GetString( const TCHAR* Section, const TCHAR* Key, FString& Value ) const;
 	CORE_API bool GetText( const TCHAR* Section, const TCHAR* Key, FText& Value ) const;
 	CORE_API bool GetInt(const TCHAR* Section, const TCHAR* Key, int& Value) const;
@@ -0,0 +1,65 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "UObject/NameTypes.h"
+#include "Features/IModularFeature.h"
+
+/**
+ * A compression codec that FCompression can use besides the built in zlib and gzip support.
+ *
+ * Codecs are registered as modular features by the module that implements them and are selected with the
+ * flags returned by FCompression::GetCustomCompressionFlags. Those flags are stored with compressed data, for
+ * example in FPakEntry::CompressionMethod, so the format id of a codec must never change once data has shipped with it.
+ */
+struct ICompressionFormat : public IModularFeature
+{
+	virtual ~ICompressionFormat()
+	{
+	}
+
+	/** Name of the modular feature all compression formats are registered under. */
+	static FName GetModularFeatureName()
+	{
+		static FName FeatureName(TEXT("CompressionFormat"));
+		return FeatureName;
+	}
+
+	/** @return the name used to select the format, for example on the UnrealPak command line. */
+	virtual FName GetCompressionFormatName() const = 0;
+
+	/** @return the id stored in compressed data to identify the format, between 1 and 255 and unique among the registered formats. */
+	virtual uint8 GetCompressionFormatId() const = 0;
+
+	/**
+	 * Thread-safe query of the memory requirements for a compression operation.
+	 *
+	 * @param	UncompressedSize	Size of uncompressed data in bytes
+	 * @return The maximum possible bytes needed to compress a buffer of size UncompressedSize
+	 */
+	virtual int32 GetCompressedBufferSize(int32 UncompressedSize) const = 0;
+
+	/**
+	 * Thread-safe compression routine.
+	 *
+	 * @param	CompressedBuffer			Buffer compressed data is going to be written to
+	 * @param	CompressedSize	[in/out]	Size of CompressedBuffer, at exit will be size of compressed data
+	 * @param	UncompressedBuffer			Buffer containing uncompressed data
+	 * @param	UncompressedSize			Size of uncompressed data in bytes
+	 * @param	bBiasMemory					Prefer smaller output over compression speed
+	 * @return true if compression succeeds, false if it fails because CompressedBuffer was too small or other reasons
+	 */
+	virtual bool Compress(void* CompressedBuffer, int32& CompressedSize, const void* UncompressedBuffer, int32 UncompressedSize, bool bBiasMemory) const = 0;
+
+	/**
+	 * Thread-safe decompression routine.
+	 *
+	 * @param	UncompressedBuffer			Buffer uncompressed data is going to be written to
+	 * @param	UncompressedSize			Exact size of the data after decompression
+	 * @param	CompressedBuffer			Buffer compressed data is going to be read from
+	 * @param	CompressedSize				Size of CompressedBuffer data in bytes
+	 * @return true if decompression succeeds and produced exactly UncompressedSize bytes
+	 */
+	virtual bool Uncompress(void* UncompressedBuffer, int32 UncompressedSize, const void* CompressedBuffer, int32 CompressedSize) const = 0;
+};
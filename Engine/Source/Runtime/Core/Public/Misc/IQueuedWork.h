@@ -4,6 +4,23 @@
 
 #include "CoreTypes.h"
 
+/**
+ * Priorities of the queues in a thread pool.
+ *
+ * Idle threads always pick up the oldest work of the highest priority queue that has any, except that a queue
+ * which was passed over too many times in a row gets one job through (see ThreadPool.StarvationLimit).
+ */
+enum class EQueuedWorkPriority : uint8
+{
+	Highest,
+	High,
+	Normal,
+	Low,
+	Lowest,
+
+	Count
+};
+
 /**
  * Interface for queued work objects.
  *
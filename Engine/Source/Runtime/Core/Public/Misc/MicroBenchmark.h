@@ -0,0 +1,84 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Containers/Array.h"
+#include "Containers/UnrealString.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+
+/**
+ * Base of the automation tests declared with IMPLEMENT_MICRO_BENCHMARK.
+ * RunTest calls Benchmark with the code to measure, which times it over a number of samples, reports the time per
+ * iteration and fails the test if it regressed compared to the platform baseline (see FPerformanceBaseline).
+ */
+class CORE_API FMicroBenchmark : public FAutomationTestBase
+{
+public:
+	FMicroBenchmark(const FString& InName, const bool bInComplexTask)
+		: FAutomationTestBase(InName, bInComplexTask)
+	{
+	}
+
+	/** Makes the compiler assume Value is used, so computing it isn't optimized away */
+	template <typename T>
+	static FORCEINLINE void KeepResult(const T& Value)
+	{
+		// Reading the value back through a volatile pointer forces it to be computed and stored
+		ResultSink += *reinterpret_cast<const volatile uint8*>(&Value);
+	}
+
+protected:
+	/**
+	 * Times Function over perf.MicroBenchmarkSamples samples after a warm up sample.
+	 * @param IterationsPerSample	How many times Function is called per sample, enough for a sample to take well over a microsecond.
+	 * @param Function				The code to measure, takes no parameters.
+	 * @return false if the benchmark regressed.
+	 */
+	template <typename FunctionType>
+	bool Benchmark(int32 IterationsPerSample, FunctionType Function)
+	{
+		const int32 NumSamples = GetNumSamples();
+
+		TArray<double> Samples;
+		Samples.Reserve(NumSamples);
+		for (int32 SampleIndex = -1; SampleIndex < NumSamples; ++SampleIndex)
+		{
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			for (int32 Iteration = 0; Iteration < IterationsPerSample; ++Iteration)
+			{
+				Function();
+			}
+			const uint64 EndCycles = FPlatformTime::Cycles64();
+
+			// The first sample warms up caches and allocators
+			if (SampleIndex >= 0)
+			{
+				Samples.Add(FPlatformTime::ToMilliseconds64(EndCycles - StartCycles) * 1000.0 / IterationsPerSample);
+			}
+		}
+
+		return ReportSamples(Samples);
+	}
+
+private:
+	static int32 GetNumSamples();
+
+	/** Logs the microseconds per iteration and compares them against the baseline */
+	bool ReportSamples(const TArray<double>& Samples);
+
+	static volatile uint8 ResultSink;
+};
+
+/**
+ * Declares a micro benchmark, which is a performance automation test. Implement RunTest by returning the result of Benchmark:
+ *
+ * IMPLEMENT_MICRO_BENCHMARK(FArrayAddBenchmark, "System.Core.Benchmarks.Containers.ArrayAdd")
+ * bool FArrayAddBenchmark::RunTest(const FString& Parameters)
+ * {
+ *     return Benchmark(100, []() { ... });
+ * }
+ */
+#define IMPLEMENT_MICRO_BENCHMARK(TClass, PrettyName) \
+	IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(TClass, FMicroBenchmark, PrettyName, EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
@@ -8,11 +8,18 @@
 /** string added to the filename of timestamped backup log files */
 #define BACKUP_LOG_FILENAME_POSTFIX TEXT("-backup-")
 
+class FArchive;
 class FAsyncWriter;
 
 /** Used by FOutputDeviceFile to write to a file on a separate thread */
 class FAsyncWriter;
 
+/**
+ * Creates an archive that copies everything serialized to it into a ring buffer and writes it to InAr on a separate thread,
+ * the same way FOutputDeviceFile writes log files. InAr must outlive the returned archive, deleting it flushes all data.
+ */
+CORE_API FArchive* CreateAsyncWriter(FArchive& InAr);
+
 enum class EByteOrderMark : int8
 {
 	UTF8,
@@ -29,15 +29,25 @@ struct FBufferedLine
 	{}
 };
 
+class FAsyncLogThread;
+
 /**
 * Class used for output redirection to allow logs to show
 */
 class CORE_API FOutputDeviceRedirector : public FOutputDevice
 {
+	friend class FAsyncLogThread;
+
 private:
 	/** A FIFO of lines logged by non-master threads. */
 	TArray<FBufferedLine> BufferedLines;
 
+	/** A FIFO of lines the async log thread already sent to devices that can be used on any thread, waiting for the master thread to send them to the others. */
+	TArray<FBufferedLine> MasterThreadLines;
+
+	/** Thread writing to the output devices, if StartAsyncLogThread was called. Never deleted since other threads may still be logging through it. */
+	FAsyncLogThread* AsyncLogThread;
+
 	/** A FIFO backlog of messages logged before the editor had a chance to intercept them. */
 	TArray<FBufferedLine> BacklogLines;
 
@@ -60,6 +70,13 @@ private:
 	*/
 	void UnsynchronizedFlushThreadedLogs(bool bUseAllDevices);
 
+	/**
+	* Sends the lines queued for the async log thread to the output devices.
+	* Assumes that the caller holds a lock on SynchronizationObject.
+	* @param bUseAllDevices - if true this method will use all output devices, otherwise lines are kept in MasterThreadLines for the devices that can't be used on any thread
+	*/
+	void UnsynchronizedFlushAsyncLines(bool bUseAllDevices);
+
 public:
 
 	/** Initialization constructor. */
@@ -113,6 +130,14 @@ public:
 	*/
 	virtual void EnableBacklog(bool bEnable);
 
+	/**
+	* Starts a thread that writes to the output devices, so logging only copies the line into a preallocated slot and queues it without locking.
+	* Output devices that can't be used on any thread receive the lines when the master thread flushes.
+	* If all slots are in use, lines less severe than warnings are dropped and counted, more severe lines are written synchronously.
+	* @param MaxPendingLines	- Number of lines that can be waiting for the log thread, the memory for them is allocated up front
+	*/
+	void StartAsyncLogThread(int32 MaxPendingLines = 4096);
+
 	/**
 	* Sets the current thread to be the master thread that prints directly
 	* (isn't queued up)
@@ -4,8 +4,38 @@
 
 #include "CoreTypes.h"
 #include "GenericPlatform/GenericPlatformAffinity.h"
+#include "Misc/IQueuedWork.h"
 
-class IQueuedWork;
+/** Counters of one priority queue of a thread pool. */
+struct FQueuedThreadPoolQueueStats
+{
+	/** Number of jobs waiting in the queue right now. */
+	int32 NumQueued;
+
+	/** Largest number of jobs that were waiting in the queue at once. */
+	int32 PeakQueued;
+
+	/** Number of jobs that were started from this queue, including the ones handed to an idle thread right away. */
+	uint64 NumStarted;
+
+	/** Number of jobs the fairness policy started ahead of higher priority work. */
+	uint64 NumPromoted;
+
+	/** Total time in seconds the started jobs spent waiting in the queue. */
+	double TotalWaitTime;
+
+	/** Longest time in seconds a started job spent waiting in the queue. */
+	double MaxWaitTime;
+
+	FQueuedThreadPoolQueueStats()
+		: NumQueued(0)
+		, PeakQueued(0)
+		, NumStarted(0)
+		, NumPromoted(0)
+		, TotalWaitTime(0.0)
+		, MaxWaitTime(0.0)
+	{ }
+};
 
 /**
  * Interface for queued thread pools.
@@ -35,9 +65,10 @@ public:
 	 * it queues the work for later. Otherwise it is immediately dispatched.
 	 *
 	 * @param InQueuedWork The work that needs to be done asynchronously
+	 * @param InPriority The queue to put the work in if no thread is available
 	 * @see RetractQueuedWork
 	 */
-	virtual void AddQueuedWork( IQueuedWork* InQueuedWork ) = 0;
+	virtual void AddQueuedWork( IQueuedWork* InQueuedWork, EQueuedWorkPriority InPriority = EQueuedWorkPriority::Normal ) = 0;
 
 	/**
 	 * Attempts to retract a previously queued task.
@@ -61,6 +92,23 @@ public:
 	 */
 	virtual int32 GetNumThreads() const = 0;
 
+	/**
+	 * Grows or shrinks the pool. New threads are created with the stack size and priority passed to Create.
+	 * Idle threads are removed right away, busy ones leave the pool when they finish their current job.
+	 *
+	 * @param InNumQueuedThreads The number of threads the pool should have, at least one
+	 * @return Whether the pool could be resized
+	 */
+	virtual bool SetNumThreads( uint32 InNumQueuedThreads ) = 0;
+
+	/**
+	 * Gets the counters of one of the priority queues.
+	 *
+	 * @param InPriority The queue to get the counters of
+	 * @return A snapshot of the counters
+	 */
+	virtual FQueuedThreadPoolQueueStats GetQueueStats( EQueuedWorkPriority InPriority ) const = 0;
+
 public:
 
 	/** Virtual destructor. */
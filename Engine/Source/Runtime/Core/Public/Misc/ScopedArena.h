@@ -0,0 +1,310 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Misc/AssertionMacros.h"
+#include "HAL/UnrealMemory.h"
+#include "Templates/AlignOf.h"
+#include "Templates/AlignmentTemplates.h"
+#include "Containers/ContainerAllocationPolicies.h"
+#include "Math/UnrealMathUtility.h"
+
+
+/**
+ * Linear allocator that owns all memory allocated while it is in scope and releases it at once when it goes away.
+ *
+ * Constructing an arena makes it the current arena of the calling thread until it is destroyed, which is what
+ * TArenaAllocator allocates from. Arenas nest and must be destroyed in the reverse order of construction on the
+ * thread that created them. Containers using TArenaAllocator must not outlive the arena they allocated from.
+ *
+ * Chunks come from FPageAllocator, so steady state per-frame use does not touch the global allocator. An arena
+ * can also be kept alive across frames and Reset(), which keeps its first chunk around for the next frame.
+ *
+ *	{
+ *		FScopedArena Arena(TEXT("ConsiderList"));
+ *		TArray<FNetworkObjectInfo*, TArenaAllocator<>> ConsiderList;
+ *		...
+ *	}
+ */
+class CORE_API FScopedArena
+{
+public:
+
+	/**
+	 * Creates an empty arena and makes it the current arena of this thread.
+	 *
+	 * @param InName Name reported by DumpStats, must outlive the arena.
+	 */
+	explicit FScopedArena(const TCHAR* InName = TEXT("Unnamed"));
+
+	/** Destructor. Frees all chunks and restores the arena that was current before this one. */
+	~FScopedArena();
+
+	/**
+	 * Allocates uninitialized memory from the arena.
+	 *
+	 * @param Size Number of bytes to allocate.
+	 * @param Alignment Alignment of the allocation, must be a power of 2.
+	 * @return Pointer to the allocation, never nullptr.
+	 */
+	FORCEINLINE void* Alloc(SIZE_T Size, uint32 Alignment)
+	{
+		checkSlow((Alignment & (Alignment - 1)) == 0);
+
+		uint8* Result = Align(Top, Alignment);
+		if (Result + Size > End || Top == nullptr)
+		{
+			AllocateNewChunk(Size + Alignment);
+			Result = Align(Top, Alignment);
+		}
+		Top = Result + Size;
+		LastAllocation = Result;
+
+		UsedBytes += Size;
+		PeakUsedBytes = FMath::Max(PeakUsedBytes, UsedBytes);
+		return Result;
+	}
+
+	/**
+	 * Grows or shrinks an allocation. The most recent allocation is resized in place when there is room,
+	 * otherwise a new block is allocated and the old contents are copied. The old block is not reclaimed.
+	 *
+	 * @param Ptr Allocation to resize, may be nullptr.
+	 * @param OldSize Size in bytes of the old allocation.
+	 * @param NewSize Size in bytes of the new allocation.
+	 * @param Alignment Alignment of the allocation, must be the same as the one it was allocated with.
+	 * @return Pointer to the resized allocation.
+	 */
+	void* Realloc(void* Ptr, SIZE_T OldSize, SIZE_T NewSize, uint32 Alignment);
+
+	/**
+	 * Releases an allocation. Only the most recent allocation gives its memory back, anything else is reclaimed when the arena goes away.
+	 *
+	 * @param Ptr Allocation to free, may be nullptr.
+	 * @param Size Size in bytes of the allocation.
+	 */
+	void Free(void* Ptr, SIZE_T Size);
+
+	/** Frees everything allocated from this arena but keeps the first chunk for reuse. No container may still be using the arena. */
+	void Reset();
+
+	/** @return the number of bytes currently allocated from this arena, not counting alignment padding. */
+	FORCEINLINE SIZE_T GetUsedBytes() const
+	{
+		return UsedBytes;
+	}
+
+	/** @return the largest number of bytes that were allocated from this arena at once since it was created. */
+	FORCEINLINE SIZE_T GetPeakUsedBytes() const
+	{
+		return PeakUsedBytes;
+	}
+
+	/** @return the number of bytes this arena got from the page allocator or the heap for its chunks. */
+	FORCEINLINE SIZE_T GetReservedBytes() const
+	{
+		return ReservedBytes;
+	}
+
+	/** @return the name the arena was created with. */
+	FORCEINLINE const TCHAR* GetName() const
+	{
+		return Name;
+	}
+
+	/**
+	 * Gets the current arena of the calling thread.
+	 *
+	 * @return The innermost arena alive on this thread, or nullptr if there is none.
+	 */
+	static FScopedArena* GetCurrent();
+
+	/** Logs the usage and high-water mark of every arena alive on the calling thread. */
+	static void DumpStats(class FOutputDevice& Ar);
+
+private:
+
+	/** Header of each chunk, the data follows it. */
+	struct FChunk
+	{
+		FChunk* Next;
+		SIZE_T DataSize;
+
+		uint8* Data()
+		{
+			return ((uint8*)this) + sizeof(FChunk);
+		}
+	};
+
+	/** Allocates a new chunk of at least MinSize bytes and makes it the current one. */
+	void AllocateNewChunk(SIZE_T MinSize);
+
+	/** Frees the chunks above LastChunk. */
+	void FreeChunks(FChunk* LastChunk);
+
+	/** Top of the current chunk. */
+	uint8* Top;
+
+	/** End of the current chunk. */
+	uint8* End;
+
+	/** Start of the most recent allocation, the only one that can be resized or freed in place. */
+	uint8* LastAllocation;
+
+	/** The most recently allocated chunk. */
+	FChunk* TopChunk;
+
+	/** Bytes currently allocated. */
+	SIZE_T UsedBytes;
+
+	/** High-water mark of UsedBytes. */
+	SIZE_T PeakUsedBytes;
+
+	/** Bytes in all chunks. */
+	SIZE_T ReservedBytes;
+
+	/** Name used for reporting. */
+	const TCHAR* Name;
+
+	/** The arena that was current when this one was created. */
+	FScopedArena* Outer;
+
+	/** Non-copyable. */
+	FScopedArena(const FScopedArena&);
+	FScopedArena& operator=(const FScopedArena&);
+};
+
+
+/**
+ * A container allocator that allocates from the arena that is current on the calling thread when the
+ * container first allocates, and keeps using that arena afterwards. Works with TArray directly and with
+ * TSet and TMap through TArenaSetAllocator.
+ */
+template<uint32 Alignment = DEFAULT_ALIGNMENT>
+class TArenaAllocator
+{
+public:
+
+	enum { NeedsElementType = true };
+	enum { RequireRangeCheck = true };
+
+	template<typename ElementType>
+	class ForElementType
+	{
+	public:
+
+		/** Default constructor. */
+		ForElementType()
+			: Data(nullptr)
+			, Arena(nullptr)
+			, AllocatedBytes(0)
+		{}
+
+		/** Destructor. Gives the memory back when it is the most recent allocation of the arena. */
+		~ForElementType()
+		{
+			if (Data)
+			{
+				Arena->Free(Data, AllocatedBytes);
+			}
+		}
+
+		/**
+		 * Moves the state of another allocator into this one.
+		 * Assumes that the allocator is currently empty, i.e. memory may be allocated but any existing elements have already been destructed (if necessary).
+		 * @param Other - The allocator to move the state from.  This allocator should be left in a valid empty state.
+		 */
+		FORCEINLINE void MoveToEmpty(ForElementType& Other)
+		{
+			checkSlow(this != &Other);
+
+			if (Data)
+			{
+				Arena->Free(Data, AllocatedBytes);
+			}
+
+			Data                 = Other.Data;
+			Arena                = Other.Arena;
+			AllocatedBytes       = Other.AllocatedBytes;
+			Other.Data           = nullptr;
+			Other.Arena          = nullptr;
+			Other.AllocatedBytes = 0;
+		}
+
+		// FContainerAllocatorInterface
+		FORCEINLINE ElementType* GetAllocation() const
+		{
+			return Data;
+		}
+		void ResizeAllocation(int32 PreviousNumElements, int32 NumElements, SIZE_T NumBytesPerElement)
+		{
+			if (!Arena)
+			{
+				Arena = FScopedArena::GetCurrent();
+				checkf(Arena, TEXT("TArenaAllocator used without an FScopedArena in scope"));
+			}
+
+			const SIZE_T NewBytes = NumElements * NumBytesPerElement;
+			const uint32 ActualAlignment = FMath::Max(Alignment, (uint32)ALIGNOF(ElementType));
+
+			if (NumElements)
+			{
+				Data = (ElementType*)Arena->Realloc(Data, AllocatedBytes, NewBytes, ActualAlignment);
+				AllocatedBytes = NewBytes;
+			}
+			else if (Data)
+			{
+				Arena->Free(Data, AllocatedBytes);
+				Data = nullptr;
+				AllocatedBytes = 0;
+			}
+		}
+		FORCEINLINE int32 CalculateSlackReserve(int32 NumElements, SIZE_T NumBytesPerElement) const
+		{
+			return DefaultCalculateSlackReserve(NumElements, NumBytesPerElement, false, Alignment);
+		}
+		FORCEINLINE int32 CalculateSlackShrink(int32 NumElements, int32 NumAllocatedElements, SIZE_T NumBytesPerElement) const
+		{
+			return DefaultCalculateSlackShrink(NumElements, NumAllocatedElements, NumBytesPerElement, false, Alignment);
+		}
+		FORCEINLINE int32 CalculateSlackGrow(int32 NumElements, int32 NumAllocatedElements, SIZE_T NumBytesPerElement) const
+		{
+			return DefaultCalculateSlackGrow(NumElements, NumAllocatedElements, NumBytesPerElement, false, Alignment);
+		}
+
+		FORCEINLINE SIZE_T GetAllocatedSize(int32 NumAllocatedElements, SIZE_T NumBytesPerElement) const
+		{
+			return NumAllocatedElements * NumBytesPerElement;
+		}
+
+		bool HasAllocation()
+		{
+			return !!Data;
+		}
+
+	private:
+		ForElementType(const ForElementType&);
+		ForElementType& operator=(const ForElementType&);
+
+		/** A pointer to the container's elements. */
+		ElementType* Data;
+
+		/** The arena the elements were allocated from. */
+		FScopedArena* Arena;
+
+		/** Size of the allocation in bytes. */
+		SIZE_T AllocatedBytes;
+	};
+
+	typedef ForElementType<FScriptContainerElement> ForAnyElementType;
+};
+
+template <uint32 Alignment>
+struct TAllocatorTraits<TArenaAllocator<Alignment>> : TAllocatorTraitsBase<TArenaAllocator<Alignment>>
+{
+	enum { SupportsMove = true };
+};
+
+/** Set and map allocator that puts the elements, the free list bits and the hash of a TSet or TMap in the current arena. */
+typedef TSetAllocator<TSparseArrayAllocator<TArenaAllocator<>, TArenaAllocator<>>, TArenaAllocator<>> TArenaSetAllocator;
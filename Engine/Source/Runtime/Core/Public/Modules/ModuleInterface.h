@@ -76,6 +76,17 @@ public:
 		return true;
 	}
 
+	/**
+	 * Override this to let StartupModule run on a worker thread, at the same time as other modules of the same loading phase.
+	 * StartupModule must then be thread safe, must not load other modules and must not rely on modules of the same loading phase.
+	 *
+	 * @return	Whether StartupModule can run in parallel with other modules
+	 */
+	virtual bool SupportsParallelStartup() const
+	{
+		return false;
+	}
+
 	/**
 	 * Returns true if this module hosts gameplay code
 	 *
@@ -234,6 +234,48 @@ public:
 	 */
 	void AbandonModuleWithCallback( const FName InModuleName );
 
+	/**
+	 * Starts deferring StartupModule of modules that support parallel startup, used while loading the modules of a loading phase.
+	 * Deferred modules count as loaded, loading one of them through LoadModule starts it up right away.
+	 * @see EndParallelStartup, IModuleInterface::SupportsParallelStartup
+	 */
+	void BeginParallelStartup();
+
+	/** Calls StartupModule of all modules deferred since BeginParallelStartup in parallel, then fires their loaded events in load order. */
+	void EndParallelStartup();
+
+	/** Time spent loading a module, recorded for every module loaded */
+	struct FModuleLoadTiming
+	{
+		FName ModuleName;
+
+		/** Seconds spent loading the module binary and processing its newly loaded UObjects */
+		double LoadTime;
+
+		/** Seconds spent creating the module and in its StartupModule */
+		double StartupTime;
+
+		/** Seconds spent loading other modules from within the load or startup of this one, not included in the times above */
+		double DependencyTime;
+
+		/** Whether StartupModule ran in parallel with other modules */
+		bool bParallelStartup;
+	};
+
+	/** Gets the load timings of all modules loaded so far, in the order they finished loading. */
+	const TArray<FModuleLoadTiming>& GetModuleLoadTimings() const
+	{
+		return ModuleLoadTimings;
+	}
+
+	/**
+	 * Writes the load timings of all modules loaded so far to a csv file, slowest module first.
+	 *
+	 * @param Filename The file to write.
+	 * @return true if the file was written.
+	 */
+	bool WriteModuleStartupReport(const FString& Filename) const;
+
 	/** Delegate that's used by the module manager to find all the valid modules in a directory matching a pattern */
 	typedef TMap<FString, FString> FModuleNamesMap;
 	DECLARE_DELEGATE_ThreeParams( FQueryModulesDelegate, const FString&, bool, FModuleNamesMap& );
@@ -493,6 +535,8 @@ protected:
 	 */
 	FModuleManager( )
 		: bCanProcessNewlyLoadedObjects(false)
+		, ParallelStartupDepth(0)
+		, CurrentDependencyTime(nullptr)
 	{ }
 
 private:
@@ -593,6 +637,12 @@ private:
 	/** Gets module with given name from Modules or creates a new one. Doesn't modify Modules. */
 	ModuleInfoRef GetOrCreateModule(FName InModuleName);
 
+	/** Calls StartupModule of a newly created module and fires the loaded event, or defers it if parallel startup is active */
+	void StartupModule(const FName InModuleName, FModuleInfo& ModuleInfo);
+
+	/** Fires the loaded event of a module that finished StartupModule */
+	void OnModuleStartedUp(const FName InModuleName, FModuleInfo& ModuleInfo);
+
 	/** Map of all modules.  Maps the case-insensitive module name to information about that module, loaded or not. */
 	FModuleMap Modules;
 
@@ -625,6 +675,18 @@ private:
 
 	/** Critical section object controlling R/W access to Modules. */
 	mutable FCriticalSection ModulesCriticalSection;
+
+	/** Number of BeginParallelStartup calls not yet matched by EndParallelStartup */
+	int32 ParallelStartupDepth;
+
+	/** Modules created while parallel startup was active, waiting for EndParallelStartup to call StartupModule */
+	TArray<FName> PendingParallelStartups;
+
+	/** Load timings of all modules loaded so far */
+	TArray<FModuleLoadTiming> ModuleLoadTimings;
+
+	/** Dependency time of the module currently being loaded, nested loads add their time to it */
+	double* CurrentDependencyTime;
 };
 
 /**
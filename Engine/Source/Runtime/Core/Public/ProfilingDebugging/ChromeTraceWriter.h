@@ -0,0 +1,70 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Containers/Array.h"
+#include "Containers/UnrealString.h"
+
+class FArchive;
+
+/**
+ * Streams events in the Chrome trace event json format (chrome://tracing, ui.perfetto.dev) to an archive.
+ * Events are written as they come in through a small fixed size buffer, so traces of any length can be written with bounded memory.
+ * Timestamps and durations are in microseconds, all events are written for a single process.
+ */
+class CORE_API FChromeTraceWriter
+{
+public:
+	/** Starts the trace. The archive must outlive the writer. */
+	explicit FChromeTraceWriter(FArchive& InAr);
+
+	/** Closes the trace if Close hasn't been called yet */
+	~FChromeTraceWriter();
+
+	/** Names the thread in trace viewers */
+	void WriteThreadName(uint32 ThreadId, const FString& Name);
+
+	/** Opens a scope on the thread, closed by the next WriteEndEvent of the same thread */
+	void WriteBeginEvent(const FString& Name, uint32 ThreadId, double Timestamp);
+
+	/** Closes the innermost open scope of the thread */
+	void WriteEndEvent(uint32 ThreadId, double Timestamp);
+
+	/** Writes a scope whose duration is already known */
+	void WriteCompleteEvent(const FString& Name, uint32 ThreadId, double Timestamp, double Duration);
+
+	/** Writes a marker without duration, e.g. a frame boundary */
+	void WriteInstantEvent(const FString& Name, uint32 ThreadId, double Timestamp);
+
+	/** Terminates the json and flushes everything to the archive, no more events can be written afterwards */
+	void Close();
+
+	/** Number of events written so far */
+	int64 GetNumEvents() const
+	{
+		return NumEvents;
+	}
+
+private:
+	/** Appends an event, Event is one json object without separators */
+	void AppendEvent(const FString& Event);
+
+	/** Appends Text encoded as utf-8 */
+	void Append(const FString& Text);
+
+	/** Writes the buffered text to the archive */
+	void FlushBuffer();
+
+	/** Returns Name as the contents of a json string, without the quotes */
+	static FString EscapeString(const FString& Name);
+
+	FArchive& Ar;
+
+	/** Encoded text not written to the archive yet */
+	TArray<ANSICHAR> Buffer;
+
+	int64 NumEvents;
+
+	bool bClosed;
+};
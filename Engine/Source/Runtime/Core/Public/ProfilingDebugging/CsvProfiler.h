@@ -0,0 +1,148 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+/**
+ * Per frame metrics written to a csv file, for automated performance runs that need a few key numbers over long captures.
+ */
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Containers/UnrealString.h"
+#include "HAL/PlatformTime.h"
+
+#ifndef CSV_PROFILER
+	#define CSV_PROFILER (!UE_BUILD_SHIPPING)
+#endif
+
+/** How values recorded with CSV_CUSTOM_STAT within one frame are combined */
+enum class ECsvCustomStatOp : uint8
+{
+	Set,
+	Min,
+	Max,
+	Accumulate,
+};
+
+enum class ECsvStatType : uint8
+{
+	/** Milliseconds spent in CSV_SCOPED_TIMING_STAT scopes, summed over all threads */
+	Timing,
+	/** Values recorded with CSV_CUSTOM_STAT */
+	Custom,
+};
+
+/** One column of the capture. Stats are registered once and live until shutdown, all stats with the same name share one instance. */
+class CORE_API FCsvStat
+{
+public:
+	FCsvStat(const TCHAR* InName, ECsvStatType InType);
+
+	/** Adds the duration of a timing scope, callable from any thread */
+	FORCEINLINE void AddCycles(uint64 InCycles)
+	{
+		FPlatformAtomics::InterlockedAdd(&Cycles, (int64)InCycles);
+	}
+
+	/** Combines a custom value into this frame's value, callable from any thread */
+	void RecordValue(double Value, ECsvCustomStatOp Op);
+
+private:
+	friend class FCsvProfiler;
+
+	/** Marks a custom stat that hasn't been recorded this frame */
+	static const int64 NoValue = MAX_int64;
+
+	const TCHAR* Name;
+	ECsvStatType Type;
+
+	volatile int64 Cycles;
+
+	/** Bits of the double recorded this frame, or NoValue */
+	volatile int64 ValueBits;
+};
+
+/**
+ * Writes one row per stat and frame in the same Frame,Name,Value layout as the stats converter to Saved/Profiling/CSV.
+ * The file is written on a separate thread. Captures are started with "CsvProfile Start [Frames]" or -csvprofile[=Frames] and stopped with "CsvProfile Stop".
+ */
+class CORE_API FCsvProfiler
+{
+public:
+	/** Whether a capture is running, stats are only recorded while it is */
+	static FORCEINLINE bool IsCapturing()
+	{
+		return bCapturing != 0;
+	}
+
+	/** Returns the stat for the name, registering it on first use. Name must stay valid for the lifetime of the process */
+	static FCsvStat& GetStat(const TCHAR* Name, ECsvStatType Type);
+
+	/**
+	 * Starts writing a new capture
+	 * @param NumFrames		Stop automatically after this many frames, 0 to capture until EndCapture.
+	 */
+	static void BeginCapture(int32 NumFrames = 0);
+
+	static void EndCapture();
+
+	/** Adds an event marker to the current frame, callable from any thread */
+	static void RecordEvent(const FString& Event);
+
+	/** Called by the game thread once per frame, writes the frame's values */
+	static void EndFrame();
+
+private:
+	static volatile int32 bCapturing;
+};
+
+/** Adds the lifetime of the scope to a timing stat */
+class FCsvScopedTiming
+{
+public:
+	FORCEINLINE FCsvScopedTiming(FCsvStat& InStat)
+		: Stat(InStat)
+		, StartCycles(FCsvProfiler::IsCapturing() ? FPlatformTime::Cycles64() : 0)
+	{
+	}
+
+	FORCEINLINE ~FCsvScopedTiming()
+	{
+		if (StartCycles)
+		{
+			Stat.AddCycles(FPlatformTime::Cycles64() - StartCycles);
+		}
+	}
+
+private:
+	FCsvStat& Stat;
+	uint64 StartCycles;
+};
+
+#if CSV_PROFILER
+
+/** Adds the time spent in the rest of the enclosing C++ scope to the StatName column */
+#define CSV_SCOPED_TIMING_STAT(StatName) \
+	static FCsvStat& PREPROCESSOR_JOIN(CsvStat_, StatName) = FCsvProfiler::GetStat(TEXT(#StatName), ECsvStatType::Timing); \
+	FCsvScopedTiming PREPROCESSOR_JOIN(CsvScope_, StatName)(PREPROCESSOR_JOIN(CsvStat_, StatName));
+
+/** Records Value into the StatName column, combined with other values of the same frame by Op (an ECsvCustomStatOp) */
+#define CSV_CUSTOM_STAT(StatName, Value, Op) \
+	{ \
+		static FCsvStat& CsvStat = FCsvProfiler::GetStat(TEXT(#StatName), ECsvStatType::Custom); \
+		CsvStat.RecordValue((double)(Value), Op); \
+	}
+
+/** Adds a printf formatted event marker to the current frame */
+#define CSV_EVENT(Format, ...) \
+	if (FCsvProfiler::IsCapturing()) \
+	{ \
+		FCsvProfiler::RecordEvent(FString::Printf(Format, ##__VA_ARGS__)); \
+	}
+
+#else
+
+#define CSV_SCOPED_TIMING_STAT(StatName)
+#define CSV_CUSTOM_STAT(StatName, Value, Op)
+#define CSV_EVENT(Format, ...)
+
+#endif
@@ -0,0 +1,137 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+/**
+ * Lightweight always-on tracing of named scopes into per thread ring buffers, so the last few seconds
+ * before a hitch can be written out after the fact with trace.Snapshot.
+ */
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Containers/Array.h"
+#include "Containers/UnrealString.h"
+
+#ifndef WITH_FRAME_TRACE
+	#define WITH_FRAME_TRACE 1
+#endif
+
+/** Value of trace.Enabled, use FFrameTrace::IsEnabled */
+extern CORE_API int32 GFrameTraceEnabled;
+
+/** What an FFrameTraceEvent marks */
+enum class EFrameTraceEventType : uint32
+{
+	BeginScope,
+	EndScope,
+	/** End of a game thread frame, the scope id is unused */
+	Frame,
+};
+
+/** A single event as it is stored in the ring buffers, kept small so recording it is a couple of stores */
+struct FFrameTraceEvent
+{
+	/** FPlatformTime::Cycles64 when the event was recorded */
+	uint64 Cycles;
+
+	/** Id returned by FFrameTrace::RegisterScope */
+	uint32 ScopeId;
+
+	EFrameTraceEventType Type;
+};
+
+/** Events recorded by one thread, oldest first */
+struct FFrameTraceThreadEvents
+{
+	uint32 ThreadId;
+	TArray<FFrameTraceEvent> Events;
+};
+
+/**
+ * Records begin and end events of named scopes into a ring buffer per thread while trace.Enabled is set.
+ * Recording doesn't lock or allocate once a thread's buffer exists, old events are simply overwritten.
+ * Unlike the stats system nothing is sent anywhere until a snapshot is requested, either with trace.Snapshot
+ * or automatically when a game thread frame takes longer than trace.HitchSnapshotMS.
+ */
+class CORE_API FFrameTrace
+{
+public:
+	/** Whether events are currently being recorded */
+	static FORCEINLINE bool IsEnabled()
+	{
+		return GFrameTraceEnabled != 0;
+	}
+
+	/**
+	 * Returns the id to record a scope with, registering the name on first use.
+	 * @param Name	Name of the scope, must stay valid for the lifetime of the process (e.g. a string literal).
+	 */
+	static uint32 RegisterScope(const TCHAR* Name);
+
+	/** Returns the name a scope was registered with */
+	static const TCHAR* GetScopeName(uint32 ScopeId);
+
+	/** Records an event to the calling thread's ring buffer */
+	static void RecordEvent(uint32 ScopeId, EFrameTraceEventType Type);
+
+	/**
+	 * Marks the end of a game thread frame. Writes a snapshot if the frame took longer than trace.HitchSnapshotMS.
+	 */
+	static void EndFrame();
+
+	/**
+	 * Copies the events of all threads recorded in the last Seconds.
+	 * Safe to call while other threads keep recording, events overwritten during the copy are dropped.
+	 */
+	static void GatherEvents(double Seconds, TArray<FFrameTraceThreadEvents>& OutThreadEvents);
+
+	/**
+	 * Writes the events of the last Seconds to a csv or Chrome trace json file (trace.SnapshotFormat) in the profiling directory.
+	 * Events are gathered on the calling thread, formatting and writing the file happens on the thread pool.
+	 * @return The file being written, or an empty string if there was nothing to write.
+	 */
+	static FString WriteSnapshot(double Seconds);
+};
+
+/** Records a scope to the frame trace if tracing is enabled when the scope is entered */
+class FFrameTraceScope
+{
+public:
+	FORCEINLINE FFrameTraceScope(uint32 InScopeId)
+		: ScopeId(InScopeId)
+		, bRecorded(FFrameTrace::IsEnabled())
+	{
+		if (bRecorded)
+		{
+			FFrameTrace::RecordEvent(ScopeId, EFrameTraceEventType::BeginScope);
+		}
+	}
+
+	FORCEINLINE ~FFrameTraceScope()
+	{
+		// Always close a scope that was opened, even if tracing got disabled in the meantime
+		if (bRecorded)
+		{
+			FFrameTrace::RecordEvent(ScopeId, EFrameTraceEventType::EndScope);
+		}
+	}
+
+private:
+	uint32 ScopeId;
+	bool bRecorded;
+};
+
+#if WITH_FRAME_TRACE
+
+/** Records the rest of the enclosing C++ scope to the frame trace, Name must be a string literal */
+#define FRAME_TRACE_SCOPE(Name) \
+	static const uint32 PREPROCESSOR_JOIN(FrameTraceScopeId, __LINE__) = FFrameTrace::RegisterScope(TEXT(Name)); \
+	FFrameTraceScope PREPROCESSOR_JOIN(FrameTraceScope, __LINE__)(PREPROCESSOR_JOIN(FrameTraceScopeId, __LINE__));
+
+#define FRAME_TRACE_END_FRAME() FFrameTrace::EndFrame()
+
+#else
+
+#define FRAME_TRACE_SCOPE(Name)
+#define FRAME_TRACE_END_FRAME()
+
+#endif
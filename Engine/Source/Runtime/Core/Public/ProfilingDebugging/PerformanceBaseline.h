@@ -0,0 +1,90 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+/**
+ * Stored per platform results of performance benchmarks, and detection of regressions against them.
+ */
+
+#pragma once
+
+#include "CoreTypes.h"
+#include "Containers/Array.h"
+#include "Containers/Map.h"
+#include "Containers/UnrealString.h"
+
+/** Summary of the samples of one metric. Lower values are better for all metrics. */
+struct CORE_API FPerformanceMetricStats
+{
+	double Mean;
+	double StdDev;
+	double Median;
+	double Max;
+	int32 NumSamples;
+
+	FPerformanceMetricStats()
+		: Mean(0.0)
+		, StdDev(0.0)
+		, Median(0.0)
+		, Max(0.0)
+		, NumSamples(0)
+	{
+	}
+
+	/** Computes the summary of a set of samples */
+	static FPerformanceMetricStats FromSamples(const TArray<double>& Samples);
+};
+
+/** How a metric compares against its baseline */
+enum class EPerformanceComparison : uint8
+{
+	/** The baseline doesn't have the metric yet */
+	NoBaseline,
+	/** The difference is within the noise or the threshold */
+	Unchanged,
+	Regressed,
+	Improved,
+};
+
+/**
+ * Results of one benchmark on the running platform, stored in <Game>/Build/PerformanceBaselines/<Platform>/<Name>.txt
+ * so they can be checked in with the content they were measured on.
+ * Run with -UpdatePerformanceBaselines to overwrite the stored results with the new ones.
+ */
+class CORE_API FPerformanceBaseline
+{
+public:
+	/** Loads the baseline of the given benchmark if one was stored */
+	explicit FPerformanceBaseline(const FString& InName);
+
+	/** Returns the stored results of a metric, or nullptr if there are none */
+	const FPerformanceMetricStats* FindMetric(const FString& Metric) const;
+
+	/** Replaces the stored results of a metric, call Save to write them out */
+	void SetMetric(const FString& Metric, const FPerformanceMetricStats& Stats);
+
+	/** Compares new results of a metric against the stored ones */
+	EPerformanceComparison Compare(const FString& Metric, const FPerformanceMetricStats& Current) const;
+
+	/**
+	 * A metric regressed when its mean went up by more than perf.RegressionThresholdPercent of the baseline mean,
+	 * and by more than perf.RegressionStdErrors standard errors of the difference so noisy metrics don't fail at random.
+	 */
+	static EPerformanceComparison Compare(const FPerformanceMetricStats& Baseline, const FPerformanceMetricStats& Current);
+
+	/** Writes the baseline to disk */
+	bool Save() const;
+
+	/** Whether the results of this run should be saved as the new baselines */
+	static bool ShouldUpdateBaselines();
+
+	const FString& GetFilename() const
+	{
+		return Filename;
+	}
+
+private:
+	FString Filename;
+	TMap<FString, FPerformanceMetricStats> Metrics;
+};
+
+/** Returns a short description of a comparison result, e.g. for logging */
+CORE_API const TCHAR* LexToString(EPerformanceComparison Comparison);
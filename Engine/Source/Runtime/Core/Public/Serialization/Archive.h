@@ -1152,6 +1152,26 @@ public:
 		ArIsFilterEditorOnly = InFilterEditorOnly;
 	}
 
+	/**
+	 * Indicates whether tagged property serialization is replaced by the unversioned, schema based format used by cooked packages.
+	 *
+	 * @return true if property data is serialized against the compiled schema of its struct, false if it is tagged.
+	 */
+	FORCEINLINE bool UseUnversionedPropertySerialization() const
+	{
+		return ArUseUnversionedPropertySerialization;
+	}
+
+	/**
+	 * Sets a flag indicating that property data is serialized in the unversioned format, see UseUnversionedPropertySerialization.
+	 *
+	 * @param bInUseUnversioned Whether to use unversioned property serialization.
+	 */
+	void SetUseUnversionedPropertySerialization(bool bInUseUnversioned)
+	{
+		ArUseUnversionedPropertySerialization = bInUseUnversioned;
+	}
+
 	/**
 	 * Indicates whether this archive is saving or loading game state
 	 *
@@ -1420,6 +1440,9 @@ public:
 	/** Whether this archive is saving/loading game state */
 	uint8 ArIsSaveGame : 1;
 
+	/** Whether property data is serialized against compiled struct schemas instead of property tags. */
+	uint8 ArUseUnversionedPropertySerialization : 1;
+
 	/** Set TRUE to use the custom property list attribute for serialization. */
 	uint8 ArUseCustomPropertyList : 1;
 
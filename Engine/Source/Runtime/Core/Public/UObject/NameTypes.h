@@ -84,6 +84,10 @@ namespace FNameDefs
 	// use of FNames to store asset path and content tags
 	static const uint32 NameHashBucketCount = 65536;
 #endif
+
+	// Buckets are split into this many shards, each guarded by its own lock, so threads adding
+	// names that hash to different shards don't serialize on a single table lock
+	static const uint32 NameHashShardCount = 64;
 }
 
 
@@ -313,47 +317,52 @@ class TStaticIndirectArrayThreadSafeRead
 	int32 NumChunks;
 
 	/**
-	 * Expands the array so that Element[Index] is allocated. New pointers are all zero.
-	 * @param Index The Index of an element we want to be sure is allocated
+	 * Expands the array so that all elements from FirstIndex to LastIndex are allocated. New pointers are all zero.
+	 * Thread safe, chunks are published with an atomic compare exchange and the loser of a race frees its copy.
+	 * @param FirstIndex The Index of the first element we want to be sure is allocated
+	 * @param LastIndex The Index of the last element we want to be sure is allocated
 	 **/
-	void ExpandChunksToIndex(int32 Index)
+	void ExpandChunksToIndex(int32 FirstIndex, int32 LastIndex)
 	{
-		check(Index >= 0 && Index < MaxTotalElements);
-		int32 ChunkIndex = Index / ElementsPerChunk;
-		while (1)
+		check(FirstIndex >= 0 && FirstIndex <= LastIndex && LastIndex < MaxTotalElements);
+		for (int32 ChunkIndex = FirstIndex / ElementsPerChunk; ChunkIndex <= LastIndex / ElementsPerChunk; ++ChunkIndex)
 		{
-			if (ChunkIndex < NumChunks)
+			if (Chunks[ChunkIndex])
 			{
-				break;
+				continue;
 			}
-			// add a chunk, and make sure nobody else tries
 			ElementType*** Chunk = &Chunks[ChunkIndex];
 			ElementType** NewChunk = (ElementType**)FMemory::Malloc(sizeof(ElementType*) * ElementsPerChunk);
 			FMemory::Memzero(NewChunk, sizeof(ElementType*) * ElementsPerChunk);
 			if (FPlatformAtomics::InterlockedCompareExchangePointer((void**)Chunk, NewChunk, nullptr))
 			{
-				// someone else beat us to the add, we don't support multiple concurrent adds
-				check(0)
+				// someone else beat us to the add, theirs is as good as ours
+				FMemory::Free(NewChunk);
 			}
 			else
 			{
-				NumChunks++;
+				FPlatformAtomics::InterlockedIncrement(&NumChunks);
 			}
+			check(Chunks[ChunkIndex]); // should have a valid pointer now
 		}
-		check(ChunkIndex < NumChunks && Chunks[ChunkIndex]); // should have a valid pointer now
 	}
 
 	/**
 	 * Return a pointer to the pointer to a given element
+	 * Elements whose chunk is still being allocated by the thread that added them read as nullptr.
 	 * @param Index The Index of an element we want to retrieve the pointer-to-pointer for
 	 **/
 	FORCEINLINE_DEBUGGABLE ElementType const* const* GetItemPtr(int32 Index) const
 	{
+		static ElementType const* const NullItem = nullptr;
 		int32 ChunkIndex = Index / ElementsPerChunk;
 		int32 WithinChunkIndex = Index % ElementsPerChunk;
-		check(IsValidIndex(Index) && ChunkIndex < NumChunks && Index < MaxTotalElements);
+		check(IsValidIndex(Index) && Index < MaxTotalElements);
 		ElementType** Chunk = Chunks[ChunkIndex];
-		check(Chunk);
+		if (!Chunk)
+		{
+			return &NullItem;
+		}
 		return Chunk + WithinChunkIndex;
 	}
 
@@ -400,16 +409,15 @@ public:
 	 * Add more elements to the array
 	 * @param	NumToAdd	Number of elements to add
 	 * @return	the number of elements in the container before we did the add. In other words, the add index.
-	 * Not thread safe. This should only be called by one thread, but the other methods can be called while this is going on.
+	 * Thread safe. The range is reserved with an atomic add, so concurrent adds never share an index. Until the chunks of
+	 * the new range have been allocated other threads may read its elements as nullptr.
 	**/
 	int32 AddZeroed(int32 NumToAdd)
 	{
-		int32 Result = NumElements;
-		check(NumElements + NumToAdd <= MaxTotalElements);
-		ExpandChunksToIndex(NumElements + NumToAdd - 1);
-		check(Result == NumElements);
-		NumElements += NumToAdd;
-		FPlatformMisc::MemoryBarrier();
+		check(NumToAdd > 0);
+		const int32 Result = FPlatformAtomics::InterlockedAdd(&NumElements, NumToAdd);
+		check(Result + NumToAdd <= MaxTotalElements);
+		ExpandChunksToIndex(Result, Result + NumToAdd - 1);
 		return Result;
 	}
 	/** 
@@ -436,9 +444,9 @@ public:
 					ElementType** NewChunk = (ElementType**)FMemory::Malloc(sizeof(ElementType*) * ElementsPerChunk);
 					FMemory::Memzero(NewChunk, sizeof(ElementType*) * ElementsPerChunk);
 					Chunks[ChunkIndex] = NewChunk;
+					NumChunks++;
 				}
 			}
-			NumChunks = MaxChunks;
 		}
 	}
 };
@@ -1112,9 +1120,12 @@ private:
 #endif
 	}
 
-	/** Singleton to retrieve the critical section. */
+	/** Singleton to retrieve the critical section. Guards the name entry array and the entry allocator. */
 	static FCriticalSection* GetCriticalSection();
 
+	/** Retrieves the critical section that guards adding entries to the hash chain of a bucket. */
+	static FCriticalSection* GetHashShardCriticalSection(uint32 HashIndex);
+
 };
 
 template<> struct TIsZeroConstructType<class FName> { enum { Value = true }; };
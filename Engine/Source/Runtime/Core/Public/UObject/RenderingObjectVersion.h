@@ -49,6 +49,9 @@ struct CORE_API FRenderingObjectVersion
 
 		ShaderResourceCodeSharing,
 
+		// Cooked instanced static mesh components may store their instances quantized
+		CompactInstancedStaticMeshData,
+
 		// -----<new versions can be added above this line>-------------------------------------------------
 		VersionPlusOne,
 		LatestVersion = VersionPlusOne - 1
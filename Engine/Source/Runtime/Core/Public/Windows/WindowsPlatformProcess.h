@@ -181,6 +181,12 @@ public:
 	static FSemaphore* NewInterprocessSynchObject(const FString& Name, bool bCreate, uint32 MaxLocks = 1);
 	static bool DeleteInterprocessSynchObject(FSemaphore * Object);
 	static bool Daemonize();
+	static bool SupportsFibers() { return true; }
+	static void* ConvertThreadToFiber();
+	static void ConvertFiberToThread(void* ThreadFiber);
+	static void* CreateFiber(uint32 StackSize, FFiberEntryPoint EntryPoint, void* Param);
+	static void DeleteFiber(void* Fiber);
+	static void SwitchToFiber(void* Fiber);
 protected:
 
 	/**
@@ -5,6 +5,7 @@
 =============================================================================*/
 
 #include "Serialization/AsyncLoading.h"
+#include "HAL/LowLevelMemTracker.h"
 #include "HAL/PlatformFilemanager.h"
 #include "HAL/FileManager.h"
 #include "HAL/Event.h"
@@ -37,6 +38,8 @@
 #include "UniquePtr.h"
 #include "Serialization/BufferReader.h"
 #include "TaskGraphInterfaces.h"
+#include "Async/ParallelFor.h"
+#include "Serialization/LoadOrderManifest.h"
 
 #define FIND_MEMORY_STOMPS (1 && (PLATFORM_WINDOWS || PLATFORM_LINUX) && !WITH_EDITORONLY_DATA)
 
@@ -71,6 +74,11 @@ DECLARE_CYCLE_STAT(TEXT("ProcessAsyncLoading AsyncLoadingThread"), STAT_FAsyncLo
 DECLARE_CYCLE_STAT(TEXT("Async Loading Time"),STAT_AsyncLoadingTime,STATGROUP_AsyncLoad);
 DECLARE_CYCLE_STAT(TEXT("Async Loading Time Detailed"), STAT_AsyncLoadingTimeDetailed, STATGROUP_AsyncLoad);
 
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Prefetch Reads In Flight"), STAT_AsyncLoadingPrefetch_ReadsInFlight, STATGROUP_AsyncLoad);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Prefetch Reads Pending"), STAT_AsyncLoadingPrefetch_ReadsPending, STATGROUP_AsyncLoad);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Prefetch Bandwidth (MB/s)"), STAT_AsyncLoadingPrefetch_Bandwidth, STATGROUP_AsyncLoad);
+DECLARE_MEMORY_STAT(TEXT("Async Loading Prefetch Held"), STAT_AsyncLoadingPrefetch_BytesHeld, STATGROUP_Memory);
+
 DECLARE_STATS_GROUP(TEXT("Async Load Game Thread"), STATGROUP_AsyncLoadGameThread, STATCAT_Advanced);
 
 DECLARE_CYCLE_STAT(TEXT("PostLoadObjects GT"), STAT_FAsyncPackage_PostLoadObjectsGameThread, STATGROUP_AsyncLoadGameThread);
@@ -150,6 +158,62 @@ static FAutoConsoleVariableRef CVarEventDrivenLoaderEnabled(
 	ECVF_Default
 );
 
+static int32 GAsyncLoadingPrefetch = 0;
+static FAutoConsoleVariableRef CVarAsyncLoadingPrefetch(
+	TEXT("s.AsyncLoadingPrefetch"),
+	GAsyncLoadingPrefetch,
+	TEXT("[EDL] If enabled, export data of all packages being loaded is precached ahead of time in large reads sorted by file offset. Only used when loading from pak files."),
+	ECVF_Default
+);
+
+static int32 GAsyncLoadingPrefetchMaxReadSizeKB = 1024;
+static FAutoConsoleVariableRef CVarAsyncLoadingPrefetchMaxReadSizeKB(
+	TEXT("s.AsyncLoadingPrefetchMaxReadSizeKB"),
+	GAsyncLoadingPrefetchMaxReadSizeKB,
+	TEXT("[EDL] Export ranges of a package are coalesced into prefetch reads of up to this size."),
+	ECVF_Default
+);
+
+static int32 GAsyncLoadingPrefetchMaxGapKB = 64;
+static FAutoConsoleVariableRef CVarAsyncLoadingPrefetchMaxGapKB(
+	TEXT("s.AsyncLoadingPrefetchMaxGapKB"),
+	GAsyncLoadingPrefetchMaxGapKB,
+	TEXT("[EDL] Maximum number of unneeded bytes between two export ranges that still get coalesced into a single prefetch read."),
+	ECVF_Default
+);
+
+static int32 GAsyncLoadingPrefetchBudgetMB = 32;
+static FAutoConsoleVariableRef CVarAsyncLoadingPrefetchBudgetMB(
+	TEXT("s.AsyncLoadingPrefetchBudgetMB"),
+	GAsyncLoadingPrefetchBudgetMB,
+	TEXT("[EDL] Maximum amount of prefetched data that is held in the pak cache for packages that haven't read it yet."),
+	ECVF_Default
+);
+
+static int32 GAsyncLoadingUseLoadOrderManifests = 1;
+static FAutoConsoleVariableRef CVarAsyncLoadingUseLoadOrderManifests(
+	TEXT("s.AsyncLoadingUseLoadOrderManifests"),
+	GAsyncLoadingUseLoadOrderManifests,
+	TEXT("[EDL] If enabled together with s.AsyncLoadingPrefetch, the cooked load order manifest of a requested map is used to prefetch all of its packages right away."),
+	ECVF_Default
+);
+
+static int32 GParallelExportSerialization = 0;
+static FAutoConsoleVariableRef CVarParallelExportSerialization(
+	TEXT("s.ParallelExportSerialization"),
+	GParallelExportSerialization,
+	TEXT("[EDL] If enabled, exports of a package that are ready to be serialized at the same time and whose Serialize is thread safe (UObject::IsSerializeThreadSafe) are serialized on worker threads."),
+	ECVF_Default
+);
+
+static int32 GParallelExportSerializationMinExports = 4;
+static FAutoConsoleVariableRef CVarParallelExportSerializationMinExports(
+	TEXT("s.ParallelExportSerializationMinExports"),
+	GParallelExportSerializationMinExports,
+	TEXT("[EDL] Minimum number of thread safe exports that need to be ready before they are serialized on worker threads."),
+	ECVF_Default
+);
+
 int32 GMaxReadyRequestsToStallMB = 30;
 static FAutoConsoleVariableRef CVar_MaxReadyRequestsToStallMB(
 	TEXT("s.MaxReadyRequestsToStallMB"),
@@ -330,6 +394,7 @@ void FAsyncLoadingThread::CancelAsyncLoadingInternal()
 			delete AsyncPackage;
 		}
 		AsyncPackageNameLookup.Reset();
+		PrefetchPlanner.Reset();
 	}
 
 	{
@@ -483,6 +548,11 @@ void FAsyncLoadingThread::ProcessAsyncPackageRequest(FAsyncPackageDesc* InReques
 		// Add to queue according to priority.
 		InsertPackage(Package, false, EAsyncPackageInsertMode::InsertAfterMatchingPriorities);
 
+		if (GEventDrivenLoaderEnabled && !InRootPackage)
+		{
+			PrefetchPlanner.PlanManifest(InRequest->NameToLoad);
+		}
+
 		// For all other cases this is handled in FindExistingPackageAndAddCompletionCallback
 		const int32 QueuedPackagesCount = QueuedPackagesCounter.Decrement();
 		check(QueuedPackagesCount >= 0);
@@ -3362,6 +3432,226 @@ void FAsyncPackage::EventDrivenSerializeExport(int32 LocalExportIndex)
 	}
 }
 
+/**
+ * [EDL] Reads a single export from the precached block of its package so that several exports can be serialized on worker threads at the same time.
+ * Names and object references are resolved through the linker the same way FLinkerLoad does it for the event driven loader, but the linker's
+ * own loader is never read from or seeked.
+ */
+class FAsyncExportReader final : public FArchiveUObject
+{
+public:
+	FAsyncExportReader(FLinkerLoad& InLinker, FAsyncPackage& InPackage, UObject* InTemplate, const uint8* InData, int64 InOffset, int64 InSize, int64 InTotalSize)
+		: Linker(InLinker)
+		, Package(InPackage)
+		, Template(InTemplate)
+		, Data(InData)
+		, Offset(InOffset)
+		, Size(InSize)
+		, Pos(0)
+		, FileSize(InTotalSize)
+	{
+		FArchive::operator=(InLinker);
+		ArIsFilterEditorOnly = InLinker.IsFilterEditorOnly();
+	}
+
+	virtual void Serialize(void* V, int64 Length) override
+	{
+		if (Pos + Length > Size)
+		{
+			// the export is corrupt, the serial size check in FAsyncPackage::EventDrivenSerializeExportsInParallel reports it
+			FMemory::Memzero(V, Length);
+			ArIsError = true;
+			return;
+		}
+		FMemory::Memcpy(V, Data + Pos, Length);
+		Pos += Length;
+	}
+	virtual int64 Tell() override
+	{
+		return Offset + Pos;
+	}
+	virtual int64 TotalSize() override
+	{
+		return FileSize;
+	}
+	virtual void Seek(int64 InPos) override
+	{
+		checkf(InPos >= Offset && InPos <= Offset + Size, TEXT("Seeked outside of export in %s (%lld / %lld - %lld)"), *Linker.Filename, InPos, Offset, Offset + Size);
+		Pos = InPos - Offset;
+	}
+
+	using FArchiveUObject::operator<<; // For visibility of the overloads we don't override
+	virtual FArchive& operator<<(UObject*& Object) override
+	{
+		FPackageIndex Index;
+		*this << Index;
+		Object = Package.EventDrivenIndexToObject(Index, false);
+		return *this;
+	}
+	virtual FArchive& operator<<(FLazyObjectPtr& LazyObjectPtr) override
+	{
+		FUniqueObjectGuid ID;
+		*this << ID;
+		LazyObjectPtr = ID;
+		return *this;
+	}
+	virtual FArchive& operator<<(FAssetPtr& AssetPtr) override
+	{
+		FStringAssetReference ID;
+		ID.Serialize(*this);
+		AssetPtr = ID;
+		return *this;
+	}
+	virtual FArchive& operator<<(FName& Name) override
+	{
+		Name = NAME_None;
+		NAME_INDEX NameIndex;
+		*this << NameIndex;
+		int32 Number;
+		*this << Number;
+
+		if (!Linker.NameMap.IsValidIndex(NameIndex))
+		{
+			UE_LOG(LogStreaming, Error, TEXT("Bad name index %i/%i in %s"), NameIndex, Linker.NameMap.Num(), *Linker.Filename);
+			ArIsError = true;
+			ArIsCriticalError = true;
+		}
+		else if (!Linker.NameMap[NameIndex].IsNone())
+		{
+			Name = FName(Linker.NameMap[NameIndex], Number);
+		}
+		return *this;
+	}
+
+	virtual UObject* GetArchetypeFromLoader(const UObject* Obj) override
+	{
+		return Template;
+	}
+	virtual FLinker* GetLinker() override
+	{
+		return &Linker;
+	}
+	virtual FString GetArchiveName() const override
+	{
+		return TEXT("FAsyncExportReader");
+	}
+
+private:
+	FLinkerLoad& Linker;
+	FAsyncPackage& Package;
+	/** Archetype of the export, piped to GetArchetypeFromLoader */
+	UObject* Template;
+	/** Precached data of the export */
+	const uint8* Data;
+	/** File offset of the export */
+	int64 Offset;
+	/** Serial size of the export */
+	int64 Size;
+	/** Current position relative to Offset */
+	int64 Pos;
+	int64 FileSize;
+};
+
+bool FAsyncPackage::CanSerializeExportInParallel(int32 LocalExportIndex)
+{
+	const FObjectExport& Export = Linker->ExportMap[LocalExportIndex];
+	UObject* Object = Export.Object;
+	// structs need to bind to their super struct and CDOs are serialized through their class, both stay on this thread
+	return Object
+		&& Object->HasAnyFlags(RF_NeedLoad)
+		&& !Object->HasAnyFlags(RF_ClassDefaultObject)
+		&& !dynamic_cast<UStruct*>(Object)
+		&& !Object->GetClass()->HasAnyClassFlags(CLASS_Deprecated)
+		&& Object->IsSerializeThreadSafe()
+		&& ExportsInThisBlock.Contains(LocalExportIndex)
+		&& Linker->GetFArchiveAsync2Loader()->GetPrecachedRange(Export.SerialOffset, Export.SerialSize);
+}
+
+bool FAsyncPackage::EventDrivenSerializeExportsInParallel()
+{
+	if (!GParallelExportSerialization || Linker->bDynamicClassLinker)
+	{
+		return false;
+	}
+
+	// Exports that can be serialized at the same time don't depend on each other, otherwise only one of them would have its prerequisites met
+	TArray<int32, TInlineAllocator<64>> ParallelExports;
+	for (int32 LocalExportIndex : ExportsThatCanBeSerialized)
+	{
+		if (CanSerializeExportInParallel(LocalExportIndex))
+		{
+			ParallelExports.Add(LocalExportIndex);
+		}
+	}
+	if (ParallelExports.Num() < FMath::Max(2, GParallelExportSerializationMinExports))
+	{
+		return false;
+	}
+
+	SCOPED_LOADTIMER(Package_PreLoadObjects);
+	FGCScopeGuard GCGuard;
+
+	for (int32 LocalExportIndex : ParallelExports)
+	{
+		ExportsThatCanBeSerialized.RemoveSingleSwap(LocalExportIndex, false);
+	}
+	ExportsThatCanBeSerialized.Heapify();
+	ParallelExports.Sort();
+
+	FArchiveAsync2* FAA2 = Linker->GetFArchiveAsync2Loader();
+	const int64 FileSize = FAA2->TotalSize();
+	TArray<UObject*, TInlineAllocator<64>> Templates;
+	for (int32 LocalExportIndex : ParallelExports)
+	{
+		FObjectExport& Export = Linker->ExportMap[LocalExportIndex];
+		FAA2->LogItem(TEXT("EventDrivenSerializeExportsInParallel"), Export.SerialOffset, Export.SerialSize);
+		verify(ExportsInThisBlock.Remove(LocalExportIndex) == 1);
+
+		check(Export.Object->GetLinker() == Linker);
+		check(Export.Object->GetLinkerIndex() == LocalExportIndex);
+		check(!Export.TemplateIndex.IsNull());
+		UObject* Template = EventDrivenIndexToObject(Export.TemplateIndex, true, FPackageIndex::FromExport(LocalExportIndex));
+		check(Template);
+		Templates.Add(Template);
+
+		Export.Object->ClearFlags(RF_NeedLoad);
+	}
+
+	LastTypeOfWorkPerformed = TEXT("EventDrivenSerializeExportsInParallel");
+	LastObjectWorkWasPerformedOn = nullptr;
+
+	TArray<int64, TInlineAllocator<64>> SerializedSizes;
+	SerializedSizes.AddZeroed(ParallelExports.Num());
+	ParallelFor(ParallelExports.Num(), [this, &ParallelExports, &Templates, &SerializedSizes, FAA2, FileSize](int32 Index)
+	{
+		const FObjectExport& Export = Linker->ExportMap[ParallelExports[Index]];
+		const uint8* Data = FAA2->GetPrecachedRange(Export.SerialOffset, Export.SerialSize);
+		FAsyncExportReader Reader(*Linker, *this, Templates[Index], Data, Export.SerialOffset, Export.SerialSize, FileSize);
+
+		FUObjectThreadContext& ThreadContext = FUObjectThreadContext::Get();
+		UObject* PrevSerializedObject = ThreadContext.SerializedObject;
+		ThreadContext.SerializedObject = Export.Object;
+		Export.Object->Serialize(Reader);
+		ThreadContext.SerializedObject = PrevSerializedObject;
+
+		SerializedSizes[Index] = Reader.IsError() ? -1 : Reader.Tell() - Export.SerialOffset;
+	});
+
+	// Finish up in export order as if the exports had been serialized one after another
+	for (int32 Index = 0; Index < ParallelExports.Num(); ++Index)
+	{
+		const int32 LocalExportIndex = ParallelExports[Index];
+		FObjectExport& Export = Linker->ExportMap[LocalExportIndex];
+		Export.Object->SetFlags(RF_LoadCompleted);
+		if (SerializedSizes[Index] != Export.SerialSize)
+		{
+			UE_LOG(LogStreaming, Fatal, TEXT("%s"), *FString::Printf(TEXT("%s: Serial size mismatch: Got %d, Expected %d"), *Export.Object->GetFullName(), (int32)SerializedSizes[Index], Export.SerialSize));
+		}
+		RemoveNode(EEventLoadNode::ImportOrExport_Serialize, FPackageIndex::FromExport(LocalExportIndex));
+	}
+	return true;
+}
+
 #define MAX_EXPORT_PRECACHE_BLOCK (1024*1024)
 #define MAX_EXPORT_COUNT_PRECACHE (20)
 #define MAX_EXPORT_ALLOWED_SKIP (48*1024)
@@ -3635,7 +3925,11 @@ EAsyncPackageState::Type FAsyncPackage::ProcessImportsAndExports_Event()
 		{
 			continue; // check time limit, and lets do the creates and new IO requests before the serialize checks
 		}
-		if (ExportsThatCanBeSerialized.Num())
+		if (ExportsThatCanBeSerialized.Num() > 1 && EventDrivenSerializeExportsInParallel())
+		{
+			bDidSomething = true;
+		}
+		else if (ExportsThatCanBeSerialized.Num())
 		{
 			bDidSomething = true;
 			int32 LocalExportIndex = -1;
@@ -4126,6 +4420,329 @@ struct FScopedRecursionNotAllowed
 };
 #endif
 
+/** Precache requests only keep their data around in the pak cache, loose files would be read twice */
+static bool IsAsyncLoadingPrefetchEnabled()
+{
+	return GAsyncLoadingPrefetch && GEventDrivenLoaderEnabled && FPlatformFileManager::Get().FindPlatformFile(TEXT("PakFile"));
+}
+
+FAsyncLoadingPrefetchPlanner::FAsyncLoadingPrefetchPlanner()
+	: bPendingReadsNeedSort(false)
+	, NextOrder(0)
+	, NumReadsInFlight(0)
+	, BytesHeld(0)
+	, BurstBytes(0)
+	, BurstTime(0.0)
+	, LastUpdateTime(0.0)
+{
+}
+
+FAsyncLoadingPrefetchPlanner::~FAsyncLoadingPrefetchPlanner()
+{
+	Reset();
+}
+
+void FAsyncLoadingPrefetchPlanner::Update(const TArray<FAsyncPackage*>& AsyncPackages)
+{
+	if (!IsAsyncLoadingPrefetchEnabled())
+	{
+		Reset();
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	if (NumReadsInFlight)
+	{
+		BurstTime += Now - LastUpdateTime;
+	}
+	LastUpdateTime = Now;
+
+	// Packages that have read their header but haven't serialized all of their exports yet need their export data
+	TSet<FName> PackagesReadingExports;
+	bool bPlannedPackages = false;
+	for (FAsyncPackage* Package : AsyncPackages)
+	{
+		FLinkerLoad* Linker = Package->GetLinker();
+		if (Linker && Linker->ExportMap.Num() &&
+			Package->AsyncPackageLoadingState >= EAsyncPackageLoadingState::StartImportPackages &&
+			Package->AsyncPackageLoadingState <= EAsyncPackageLoadingState::ProcessNewImportsAndExports &&
+			!Package->bAllExportsSerialized)
+		{
+			PackagesReadingExports.Add(Package->GetPackageName());
+			if (!Prefetches.Contains(Package->GetPackageName()))
+			{
+				PlanPackage(Package->GetPackageName(), Linker);
+				bPlannedPackages = true;
+			}
+		}
+	}
+	// packages discovered in the same update are read in file order
+	if (bPlannedPackages)
+	{
+		NextOrder++;
+	}
+
+	for (TMap<FName, FPackagePrefetch>::TIterator It(Prefetches); It; ++It)
+	{
+		if (PackagesReadingExports.Contains(It.Key()))
+		{
+			It.Value().bSeenLoading = true;
+		}
+		// packages from a manifest that never got loaded are dropped once loading is idle
+		else if (It.Value().bSeenLoading || !AsyncPackages.Num())
+		{
+			ReleasePackage(It.Key(), It.Value());
+			It.RemoveCurrent();
+			continue;
+		}
+		for (FPrefetchRead& Read : It.Value().Reads)
+		{
+			if (Read.Request && !Read.bComplete && Read.Request->PollCompletion())
+			{
+				Read.bComplete = true;
+				NumReadsInFlight--;
+				BurstBytes += Read.Size;
+			}
+		}
+	}
+
+	IssueReads();
+
+	if (!NumReadsInFlight && BurstBytes)
+	{
+		const double BurstMB = BurstBytes / (1024.0 * 1024.0);
+		UE_LOG(LogStreaming, Verbose, TEXT("Prefetched %.2f MB in %.3f s (%.2f MB/s)."), BurstMB, BurstTime, BurstTime > 0.0 ? BurstMB / BurstTime : 0.0);
+		BurstBytes = 0;
+		BurstTime = 0.0;
+	}
+
+	SET_DWORD_STAT(STAT_AsyncLoadingPrefetch_ReadsInFlight, NumReadsInFlight);
+	SET_DWORD_STAT(STAT_AsyncLoadingPrefetch_ReadsPending, PendingReads.Num());
+	SET_MEMORY_STAT(STAT_AsyncLoadingPrefetch_BytesHeld, BytesHeld);
+	if (BurstTime > 0.0)
+	{
+		SET_FLOAT_STAT(STAT_AsyncLoadingPrefetch_Bandwidth, BurstBytes / (1024.0 * 1024.0) / BurstTime);
+	}
+}
+
+void FAsyncLoadingPrefetchPlanner::Reset()
+{
+	for (TPair<FName, FPackagePrefetch>& Prefetch : Prefetches)
+	{
+		ReleasePackage(Prefetch.Key, Prefetch.Value);
+	}
+	Prefetches.Empty();
+	check(!PendingReads.Num() && !NumReadsInFlight && !BytesHeld);
+	NextOrder = 0;
+	BurstBytes = 0;
+	BurstTime = 0.0;
+}
+
+void FAsyncLoadingPrefetchPlanner::AddPackage(const FName& PackageName, const FString& Filename, const FString& HeaderFilename, int64 HeaderSize, TArray<TPair<int64, int64>>& Ranges)
+{
+	Ranges.Sort([](const TPair<int64, int64>& A, const TPair<int64, int64>& B)
+	{
+		return A.Key < B.Key;
+	});
+
+	FPackagePrefetch& Prefetch = Prefetches.Add(PackageName);
+	Prefetch.Filename = Filename;
+	Prefetch.Handle = nullptr;
+	Prefetch.HeaderFilename = HeaderFilename;
+	Prefetch.HeaderHandle = nullptr;
+	Prefetch.Order = NextOrder;
+	Prefetch.bSeenLoading = false;
+
+	const int64 MaxReadSize = FMath::Max(GAsyncLoadingPrefetchMaxReadSizeKB, 1) * 1024ll;
+	const int64 MaxGap = FMath::Max(GAsyncLoadingPrefetchMaxGapKB, 0) * 1024ll;
+
+	// the header is read in one go by the loader, so it is prefetched as a whole
+	if (HeaderSize > 0)
+	{
+		FPrefetchRead& Read = Prefetch.Reads[Prefetch.Reads.AddUninitialized()];
+		Read.Request = nullptr;
+		Read.Offset = 0;
+		Read.Size = HeaderSize;
+		Read.bComplete = false;
+		Read.bHeader = true;
+	}
+
+	const int32 FirstExportRead = Prefetch.Reads.Num();
+	for (const TPair<int64, int64>& Range : Ranges)
+	{
+		// split ranges that are larger than a single read
+		for (int64 RangeOffset = Range.Key; RangeOffset < Range.Key + Range.Value; )
+		{
+			const int64 RangeSize = FMath::Min(Range.Key + Range.Value - RangeOffset, MaxReadSize);
+			FPrefetchRead* LastRead = Prefetch.Reads.Num() > FirstExportRead ? &Prefetch.Reads.Last() : nullptr;
+			const int64 LastReadEnd = LastRead ? LastRead->Offset + LastRead->Size : 0;
+			if (LastRead && RangeOffset - LastReadEnd <= MaxGap && RangeOffset + RangeSize - LastRead->Offset <= MaxReadSize)
+			{
+				LastRead->Size = FMath::Max(LastReadEnd, RangeOffset + RangeSize) - LastRead->Offset;
+			}
+			else
+			{
+				FPrefetchRead& Read = Prefetch.Reads[Prefetch.Reads.AddUninitialized()];
+				Read.Request = nullptr;
+				Read.Offset = RangeOffset;
+				Read.Size = RangeSize;
+				Read.bComplete = false;
+				Read.bHeader = false;
+			}
+			RangeOffset += RangeSize;
+		}
+	}
+
+	for (int32 ReadIndex = 0; ReadIndex < Prefetch.Reads.Num(); ++ReadIndex)
+	{
+		PendingReads.Emplace(PackageName, ReadIndex);
+	}
+	bPendingReadsNeedSort = true;
+}
+
+void FAsyncLoadingPrefetchPlanner::PlanPackage(const FName& PackageName, FLinkerLoad* Linker)
+{
+	// Event driven loading reads exports from the split export file, see FArchiveAsync2::MakeEventDrivenPrecacheRequest
+	const int64 HeaderSize = Linker->Summary.TotalHeaderSize;
+
+	TArray<TPair<int64, int64>> Ranges;
+	Ranges.Reserve(Linker->ExportMap.Num());
+	for (const FObjectExport& Export : Linker->ExportMap)
+	{
+		if (Export.SerialSize > 0 && Export.SerialOffset >= HeaderSize)
+		{
+			Ranges.Emplace(Export.SerialOffset - HeaderSize, Export.SerialSize);
+		}
+	}
+
+	// the header has already been read
+	AddPackage(PackageName, FPaths::GetBaseFilename(Linker->Filename, false) + TEXT(".uexp"), FString(), 0, Ranges);
+}
+
+void FAsyncLoadingPrefetchPlanner::PlanManifest(const FName& PackageName)
+{
+	if (!GAsyncLoadingUseLoadOrderManifests || !IsAsyncLoadingPrefetchEnabled())
+	{
+		return;
+	}
+
+	FString ManifestFilename;
+	if (!FLoadOrderManifest::TryGetManifestFilename(PackageName.ToString(), ManifestFilename) || !IFileManager::Get().FileExists(*ManifestFilename))
+	{
+		return;
+	}
+
+	FLoadOrderManifest Manifest;
+	if (!Manifest.Load(*ManifestFilename))
+	{
+		return;
+	}
+
+	int32 NumPlanned = 0;
+	for (const FLoadOrderManifestPackage& Package : Manifest.Packages)
+	{
+		FString HeaderFilename;
+		FString ExportsFilename;
+		if (!Prefetches.Contains(Package.PackageName) && Package.GetFilenames(HeaderFilename, ExportsFilename))
+		{
+			TArray<TPair<int64, int64>> Ranges;
+			if (Package.ExportsSize > 0)
+			{
+				Ranges.Emplace(0, Package.ExportsSize);
+			}
+			AddPackage(Package.PackageName, ExportsFilename, HeaderFilename, Package.HeaderSize, Ranges);
+			NumPlanned++;
+		}
+	}
+	NextOrder++;
+
+	UE_LOG(LogStreaming, Verbose, TEXT("Planned prefetch of %d packages from load order manifest %s."), NumPlanned, *ManifestFilename);
+	IssueReads();
+}
+
+void FAsyncLoadingPrefetchPlanner::ReleasePackage(const FName& PackageName, FPackagePrefetch& Prefetch)
+{
+	for (FPrefetchRead& Read : Prefetch.Reads)
+	{
+		if (Read.Request)
+		{
+			if (!Read.bComplete)
+			{
+				Read.Request->Cancel();
+				NumReadsInFlight--;
+			}
+			Read.Request->WaitCompletion();
+			if (uint8* Memory = Read.Request->GetReadResults())
+			{
+				FMemory::Free(Memory);
+			}
+			delete Read.Request;
+			Read.Request = nullptr;
+			BytesHeld -= Read.Size;
+		}
+	}
+	delete Prefetch.Handle;
+	Prefetch.Handle = nullptr;
+	delete Prefetch.HeaderHandle;
+	Prefetch.HeaderHandle = nullptr;
+
+	PendingReads.RemoveAll([&PackageName](const TPair<FName, int32>& PendingRead)
+	{
+		return PendingRead.Key == PackageName;
+	});
+}
+
+void FAsyncLoadingPrefetchPlanner::IssueReads()
+{
+	if (bPendingReadsNeedSort)
+	{
+		// Issued in reverse, so the reads of the earliest package and at the start of a file are at the end of the array
+		PendingReads.Sort([this](const TPair<FName, int32>& A, const TPair<FName, int32>& B)
+		{
+			const FPackagePrefetch& PrefetchA = Prefetches.FindChecked(A.Key);
+			const FPackagePrefetch& PrefetchB = Prefetches.FindChecked(B.Key);
+			if (PrefetchA.Order != PrefetchB.Order)
+			{
+				return PrefetchA.Order > PrefetchB.Order;
+			}
+			if (A.Key == B.Key && PrefetchA.Reads[A.Value].bHeader != PrefetchB.Reads[B.Value].bHeader)
+			{
+				return PrefetchB.Reads[B.Value].bHeader;
+			}
+			const int32 Compare = PrefetchA.Filename.Compare(PrefetchB.Filename);
+			if (Compare != 0)
+			{
+				return Compare > 0;
+			}
+			return PrefetchA.Reads[A.Value].Offset > PrefetchB.Reads[B.Value].Offset;
+		});
+		bPendingReadsNeedSort = false;
+	}
+
+	const int64 Budget = FMath::Max(GAsyncLoadingPrefetchBudgetMB, 1) * 1024ll * 1024ll;
+	while (PendingReads.Num())
+	{
+		const TPair<FName, int32> PendingRead = PendingReads.Last();
+		FPackagePrefetch& Prefetch = Prefetches.FindChecked(PendingRead.Key);
+		FPrefetchRead& Read = Prefetch.Reads[PendingRead.Value];
+		if (BytesHeld && BytesHeld + Read.Size > Budget)
+		{
+			break;
+		}
+		PendingReads.Pop(false);
+
+		IAsyncReadFileHandle*& Handle = Read.bHeader ? Prefetch.HeaderHandle : Prefetch.Handle;
+		if (!Handle)
+		{
+			Handle = FPlatformFileManager::Get().GetPlatformFile().OpenAsyncRead(Read.bHeader ? *Prefetch.HeaderFilename : *Prefetch.Filename);
+			check(Handle); // this generally cannot fail because it is async
+		}
+		Read.Request = Handle->ReadRequest(Read.Offset, Read.Size, AIOP_Precache);
+		NumReadsInFlight++;
+		BytesHeld += Read.Size;
+	}
+}
+
 EAsyncPackageState::Type FAsyncLoadingThread::ProcessAsyncLoading(int32& OutPackagesProcessed, bool bUseTimeLimit /*= false*/, bool bUseFullTimeLimit /*= false*/, float TimeLimit /*= 0.0f*/, FFlushTree* FlushTree)
 {
 	SCOPE_CYCLE_COUNTER(STAT_FAsyncLoadingThread_ProcessAsyncLoading);
@@ -4148,6 +4765,8 @@ EAsyncPackageState::Type FAsyncLoadingThread::ProcessAsyncLoading(int32& OutPack
 		FAsyncLoadingTickScope InAsyncLoadingTick;
 		uint32 LoopIterations = 0;
 
+		PrefetchPlanner.Update(AsyncPackages);
+
 		while (true)
 		{
 			if (bNeedsHeartbeatTick && (++LoopIterations) % 32 == 31)
@@ -4524,6 +5143,7 @@ EAsyncPackageState::Type FAsyncLoadingThread::ProcessLoadedPackages(bool bUseTim
 
 EAsyncPackageState::Type FAsyncLoadingThread::TickAsyncLoading(bool bUseTimeLimit, bool bUseFullTimeLimit, float TimeLimit, FFlushTree* FlushTree)
 {
+	LLM_SCOPE(ELLMTag::AsyncLoading);
 	check(IsInGameThread());
 	
 	const bool bLoadingSuspended = IsAsyncLoadingSuspended();
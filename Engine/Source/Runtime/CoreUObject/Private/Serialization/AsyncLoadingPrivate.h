@@ -58,6 +58,16 @@ public:
 
 	void LogItem(const TCHAR* Item, int64 Offset = 0, int64 Size = 0, double StartTime = 0.0);
 
+	/** @return pointer to the precached data of a range of the file, nullptr if the range isn't completely precached */
+	FORCEINLINE const uint8* GetPrecachedRange(int64 Offset, int64 Size) const
+	{
+		if (PrecacheBuffer && Offset >= PrecacheStartPos && Offset + Size <= PrecacheEndPos)
+		{
+			return PrecacheBuffer + (Offset - PrecacheStartPos);
+		}
+		return nullptr;
+	}
+
 private:
 #if DEVIRTUALIZE_FLinkerLoad_Serialize
 	/**
@@ -130,6 +130,83 @@ struct FFlushTree
 	}
 };
 
+class IAsyncReadFileHandle;
+
+/**
+ * [EDL] Looks ahead at the export ranges of all packages that are being loaded and issues them as large precache requests
+ * sorted by file and offset. The pak file layer orders the blocks it reads by pak offset and keeps precached blocks around
+ * while they are referenced, so by the time a package starts its own export reads they are served from memory instead of
+ * seeking back and forth between packages. Requests of a package are released once it is done serializing its exports.
+ *
+ * When a cooked load order manifest exists for a requested package, the headers and exports of all of the packages it lists
+ * are planned right away in manifest order, before the loader has discovered any of them through import tables.
+ */
+class FAsyncLoadingPrefetchPlanner
+{
+public:
+	FAsyncLoadingPrefetchPlanner();
+	~FAsyncLoadingPrefetchPlanner();
+
+	/** [ASYNC THREAD] Plans reads for newly started packages, issues them within the memory budget and releases reads of finished packages */
+	void Update(const TArray<FAsyncPackage*>& AsyncPackages);
+
+	/** [ASYNC THREAD] Plans reads for every package in the load order manifest of a newly requested package, if it has one */
+	void PlanManifest(const FName& PackageName);
+
+	/** [ASYNC THREAD] Cancels and releases all reads */
+	void Reset();
+
+private:
+	struct FPrefetchRead
+	{
+		IAsyncReadRequest* Request;
+		int64 Offset;
+		int64 Size;
+		bool bComplete;
+		/** True if this reads the package header instead of the exports */
+		bool bHeader;
+	};
+
+	struct FPackagePrefetch
+	{
+		/** File the exports are read from */
+		FString Filename;
+		IAsyncReadFileHandle* Handle;
+		/** File the header is read from, only used by packages planned from a manifest */
+		FString HeaderFilename;
+		IAsyncReadFileHandle* HeaderHandle;
+		/** Coalesced reads sorted by offset */
+		TArray<FPrefetchRead> Reads;
+		/** Reads of packages planned earlier are issued first */
+		int32 Order;
+		/** True once the loader started serializing the package, packages from a manifest are kept around until then */
+		bool bSeenLoading;
+	};
+
+	/** Adds a package and coalesces its ranges into reads */
+	void AddPackage(const FName& PackageName, const FString& Filename, const FString& HeaderFilename, int64 HeaderSize, TArray<TPair<int64, int64>>& Ranges);
+	/** Coalesces the export ranges of a package into reads */
+	void PlanPackage(const FName& PackageName, FLinkerLoad* Linker);
+	/** Waits for and deletes the requests and handle of a package */
+	void ReleasePackage(const FName& PackageName, FPackagePrefetch& Prefetch);
+	/** Issues pending reads in file and offset order until the memory budget is used up */
+	void IssueReads();
+
+	TMap<FName, FPackagePrefetch> Prefetches;
+	/** Reads that haven't been issued yet, sorted by order, file and offset */
+	TArray<TPair<FName, int32>> PendingReads;
+	bool bPendingReadsNeedSort;
+	/** Order of the next package that gets planned */
+	int32 NextOrder;
+
+	int32 NumReadsInFlight;
+	int64 BytesHeld;
+	/** Bytes and time spent with reads in flight since the last time all reads completed, used for the bandwidth stat */
+	int64 BurstBytes;
+	double BurstTime;
+	double LastUpdateTime;
+};
+
 /**
  * Async loading thread. Preloads/serializes packages on async loading thread. Postloads objects on the game thread.
  */
@@ -182,6 +259,8 @@ class FAsyncLoadingThread : public FRunnable
 	/** [ASYNC THREAD] Array of packages that are being preloaded */
 	TArray<FAsyncPackage*> AsyncPackages;
 	TMap<FName, FAsyncPackage*> AsyncPackageNameLookup;
+	/** [EDL] [ASYNC THREAD] Prefetches export data of AsyncPackages ahead of time */
+	FAsyncLoadingPrefetchPlanner PrefetchPlanner;
 public:
 	/** [EDL] Async Packages that are ready for tick */
 	TArray<FAsyncPackage*> AsyncPackagesReadyForTick;
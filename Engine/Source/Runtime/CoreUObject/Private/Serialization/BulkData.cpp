@@ -3,6 +3,8 @@
 
 #include "Serialization/BulkData.h"
 #include "HAL/FileManager.h"
+#include "HAL/PlatformFilemanager.h"
+#include "Async/MappedFileHandle.h"
 #include "Misc/ScopeLock.h"
 #include "Misc/Paths.h"
 #include "Serialization/MemoryWriter.h"
@@ -140,6 +142,7 @@ FUntypedBulkData::~FUntypedBulkData()
 	// Free memory.
 	BulkData     .Deallocate();
 	BulkDataAsync.Deallocate();
+	UnmapBulkData();
 	
 #if WITH_EDITOR
 	// Detach from archive.
@@ -346,7 +349,7 @@ ECompressionFlags FUntypedBulkData::GetDecompressionFlags() const
  */
 bool FUntypedBulkData::IsBulkDataLoaded() const
 {
-	return !!BulkData;
+	return !!BulkData || MappedRegion;
 }
 
 bool FUntypedBulkData::IsAsyncLoadingComplete()
@@ -390,8 +393,22 @@ void FUntypedBulkData::GetCopy( void** Dest, bool bDiscardInternalCopy )
 	// Make sure any async loads have completed and moved the data into BulkData
 	FlushAsyncLoading();
 
+	// A mapped payload is copied straight out of the mapping.
+	if( MappedRegion )
+	{
+		const int32 BulkDataSize = GetBulkDataSize();
+		if( !*Dest )
+		{
+			*Dest = FMemory::Malloc( BulkDataSize, BulkDataAlignment );
+		}
+		FMemory::Memcpy( *Dest, MappedRegion->GetMappedPtr(), BulkDataSize );
+		if( bDiscardInternalCopy && (CanLoadFromDisk() || (BulkDataFlags & BULKDATA_SingleUse)) )
+		{
+			UnmapBulkData();
+		}
+	}
 	// Passed in memory is going to be used.
-	if( *Dest )
+	else if( *Dest )
 	{
 		// The data is already loaded so we can simply use a mempcy.
 		if( BulkData )
@@ -471,6 +488,13 @@ void FUntypedBulkData::GetCopy( void** Dest, bool bDiscardInternalCopy )
 void* FUntypedBulkData::Lock( uint32 LockFlags )
 {
 	check( LockStatus == LOCKSTATUS_Unlocked );
+
+	// Read-only locks can use a memory mapping of the payload instead of loading it.
+	if( (LockFlags & LOCK_READ_ONLY) && MakeSureBulkDataIsMapped() )
+	{
+		LockStatus = LOCKSTATUS_ReadOnlyLock;
+		return const_cast<uint8*>(MappedRegion->GetMappedPtr());
+	}
 	
 	// Make sure bulk data is loaded.
 	MakeSureBulkDataIsLoaded();
@@ -510,6 +534,13 @@ const void* FUntypedBulkData::LockReadOnly() const
 	
 	FUntypedBulkData* mutable_this = const_cast<FUntypedBulkData*>(this);
 
+	// Only read operations are allowed on returned memory.
+	if (mutable_this->MakeSureBulkDataIsMapped())
+	{
+		mutable_this->LockStatus = LOCKSTATUS_ReadOnlyLock;
+		return MappedRegion->GetMappedPtr();
+	}
+
 	// Make sure bulk data is loaded.
 	mutable_this->MakeSureBulkDataIsLoaded();
 
@@ -553,6 +584,7 @@ void FUntypedBulkData::Unlock() const
 	if (BulkDataFlags & BULKDATA_SingleUse)
 	{
 		mutable_this->BulkData.Deallocate();
+		mutable_this->UnmapBulkData();
 	}
 }
 
@@ -577,6 +609,7 @@ void FUntypedBulkData::RemoveBulkData()
 	// Resize to 0 elements.
 	ElementCount	= 0;
 	BulkData.Deallocate();
+	UnmapBulkData();
 }
 
 /**
@@ -794,6 +827,7 @@ void FUntypedBulkData::Serialize( FArchive& Ar, UObject* Owner, int32 Idx )
 		// We're loading from the persistent archive.
 		if( Ar.IsLoading() )
 		{
+			UnmapBulkData();
 			Filename = TEXT("");
 			
 			// @todo when Landscape (and others?) only Lock/Unlock once, we can enable this
@@ -1117,11 +1151,12 @@ void FUntypedBulkData::Copy( const FUntypedBulkData& Other )
 	if( Other.GetElementCount() )
 	{
 		// Make sure src is loaded without calling Lock as the object is const.
-		check(Other.BulkData);
+		check(Other.BulkData || Other.MappedRegion);
 		check(BulkData);
 		check(ElementCount == Other.GetElementCount() );
 		// Copy from src to dest.
-		FMemory::Memcpy( BulkData.Get(), Other.BulkData.Get(), Other.GetBulkDataSize() );
+		const void* OtherData = Other.MappedRegion ? Other.MappedRegion->GetMappedPtr() : Other.BulkData.Get();
+		FMemory::Memcpy( BulkData.Get(), OtherData, Other.GetBulkDataSize() );
 	}
 }
 
@@ -1136,6 +1171,8 @@ void FUntypedBulkData::InitializeMemberVariables()
 	BulkDataSizeOnDisk = INDEX_NONE;
 	BulkDataAlignment = DEFAULT_ALIGNMENT;
 	LockStatus = LOCKSTATUS_Unlocked;
+	MappedHandle = nullptr;
+	MappedRegion = nullptr;
 #if WITH_EDITOR
 	Linker = nullptr;
 	AttachedAr = nullptr;
@@ -1261,8 +1298,15 @@ void FUntypedBulkData::MakeSureBulkDataIsLoaded()
 	// Nothing to do if data is already loaded.
 	if( !BulkData )
 	{
+		// Copy a mapped payload so it can be written to
+		if (MappedRegion)
+		{
+			BulkData.Reallocate(GetBulkDataSize(), BulkDataAlignment);
+			FMemory::Memcpy(BulkData.Get(), MappedRegion->GetMappedPtr(), GetBulkDataSize());
+			UnmapBulkData();
+		}
 		// Look for async request first
-		if (SerializeFuture.IsValid())
+		else if (SerializeFuture.IsValid())
 		{
 			WaitForAsyncLoading();
 			BulkData = MoveTemp(BulkDataAsync);
@@ -1284,6 +1328,62 @@ void FUntypedBulkData::MakeSureBulkDataIsLoaded()
 	}
 }
 
+int32 GMemoryMapBulkData = 1;
+static FAutoConsoleVariableRef CVarMemoryMapBulkData(
+	TEXT("s.MemoryMapBulkData"),
+	GMemoryMapBulkData,
+	TEXT("If enabled, read-only locks of uncompressed bulk data stored in a separate file memory map the payload instead of loading a copy of it, on platforms and pak files that support mapping."),
+	ECVF_Default
+	);
+
+bool FUntypedBulkData::CanMapBulkData() const
+{
+	const uint32 UnmappableFlags = BULKDATA_SerializeCompressed | BULKDATA_ForceSingleElementSerialization | BULKDATA_Unused;
+	return GMemoryMapBulkData && FPlatformProperties::RequiresCookedData() &&
+		(BulkDataFlags & BULKDATA_PayloadAtEndOfFile) && (BulkDataFlags & BULKDATA_PayloadInSeperateFile) && !(BulkDataFlags & UnmappableFlags) &&
+		!SerializeFuture.IsValid() && GetBulkDataSize() > 0 && BulkDataSizeOnDisk == GetBulkDataSize() &&
+		Filename.EndsWith(TEXT(".ubulk"));
+}
+
+bool FUntypedBulkData::MakeSureBulkDataIsMapped()
+{
+	if (MappedRegion)
+	{
+		return true;
+	}
+	if (BulkData || !CanMapBulkData())
+	{
+		return false;
+	}
+
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("FUntypedBulkData::MakeSureBulkDataIsMapped"), STAT_UBD_MakeSureBulkDataIsMapped, STATGROUP_Memory);
+
+	IMappedFileHandle* Handle = FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*Filename);
+	if (!Handle)
+	{
+		return false;
+	}
+	IMappedFileRegion* Region = Handle->MapRegion(BulkDataOffsetInFile, GetBulkDataSize());
+	// fall back to loading if the payload doesn't fit the mapping or the required alignment
+	if (!Region || Region->GetMappedSize() != GetBulkDataSize() || !IsAligned(Region->GetMappedPtr(), BulkDataAlignment))
+	{
+		delete Region;
+		delete Handle;
+		return false;
+	}
+	MappedHandle = Handle;
+	MappedRegion = Region;
+	return true;
+}
+
+void FUntypedBulkData::UnmapBulkData()
+{
+	delete MappedRegion;
+	MappedRegion = nullptr;
+	delete MappedHandle;
+	MappedHandle = nullptr;
+}
+
 void FUntypedBulkData::WaitForAsyncLoading()
 {
 	check(SerializeFuture.IsValid());
@@ -1495,7 +1595,7 @@ void FFloatBulkData::SerializeElement( FArchive& Ar, void* Data, int32 ElementIn
 	Ar << FloatData;
 }
 
-void FFormatContainer::Serialize(FArchive& Ar, UObject* Owner, const TArray<FName>* FormatsToSave, bool bSingleUse, uint32 InAlignment)
+void FFormatContainer::Serialize(FArchive& Ar, UObject* Owner, const TArray<FName>* FormatsToSave, bool bSingleUse, uint32 InAlignment, bool bForceInline)
 {
 	if (Ar.IsLoading())
 	{
@@ -1532,9 +1632,10 @@ void FFormatContainer::Serialize(FArchive& Ar, UObject* Owner, const TArray<FNam
 				Ar << Name;
 				FByteBulkData* Bulk = It.Value();
 				check(Bulk);
-				// Force this kind of bulk data (physics, etc) to be stored inline for streaming
+				// Force this kind of bulk data (physics, etc) to be stored inline for streaming, unless the caller wants it mappable
 				const uint32 OldBulkDataFlags = Bulk->GetBulkDataFlags();
-				Bulk->SetBulkDataFlags(bSingleUse ? (BULKDATA_ForceInlinePayload | BULKDATA_SingleUse) : BULKDATA_ForceInlinePayload);				
+				const uint32 InlineFlags = bForceInline ? BULKDATA_ForceInlinePayload : BULKDATA_Force_NOT_InlinePayload;
+				Bulk->SetBulkDataFlags(bSingleUse ? (InlineFlags | BULKDATA_SingleUse) : InlineFlags);
 				Bulk->Serialize(Ar, Owner);
 				Bulk->ClearBulkDataFlags(0xFFFFFFFF);
 				Bulk->SetBulkDataFlags(OldBulkDataFlags);
@@ -0,0 +1,96 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "Serialization/LoadOrderManifest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Serialization/ArrayReader.h"
+#include "Serialization/ArrayWriter.h"
+
+namespace LoadOrderManifest
+{
+	/** Identifies load order manifest files. */
+	static const uint32 FileTag = 0x4C4F4D31;
+
+	/** Bump when the format changes, out of date manifests are ignored. */
+	static const int32 FileVersion = 1;
+}
+
+bool FLoadOrderManifestPackage::GetFilenames(FString& OutHeaderFilename, FString& OutExportsFilename) const
+{
+	FString BaseFilename;
+	if (!FPackageName::TryConvertLongPackageNameToFilename(PackageName.ToString(), BaseFilename))
+	{
+		return false;
+	}
+	OutHeaderFilename = BaseFilename + (bIsMap ? FPackageName::GetMapPackageExtension() : FPackageName::GetAssetPackageExtension());
+	OutExportsFilename = BaseFilename + TEXT(".uexp");
+	return true;
+}
+
+FArchive& operator<<(FArchive& Ar, FLoadOrderManifestPackage& Package)
+{
+	Ar << Package.PackageName;
+	Ar << Package.bIsMap;
+	Ar << Package.HeaderSize;
+	Ar << Package.ExportsSize;
+	Ar << Package.Dependencies;
+	return Ar;
+}
+
+const TCHAR* FLoadOrderManifest::GetManifestExtension()
+{
+	return TEXT(".uloadorder");
+}
+
+bool FLoadOrderManifest::TryGetManifestFilename(const FString& MapPackageName, FString& OutFilename)
+{
+	return FPackageName::TryConvertLongPackageNameToFilename(MapPackageName, OutFilename, GetManifestExtension());
+}
+
+bool FLoadOrderManifest::Load(const TCHAR* Filename)
+{
+	Packages.Reset();
+
+	FArrayReader Reader;
+	if (!FFileHelper::LoadFileToArray(Reader, Filename, FILEREAD_Silent))
+	{
+		return false;
+	}
+
+	uint32 Tag = 0;
+	int32 Version = 0;
+	Reader << Tag;
+	Reader << Version;
+	if (Tag != LoadOrderManifest::FileTag || Version != LoadOrderManifest::FileVersion)
+	{
+		UE_LOG(LogStreaming, Warning, TEXT("Ignoring out of date load order manifest %s."), Filename);
+		return false;
+	}
+
+	Reader << *this;
+	if (Reader.IsError())
+	{
+		UE_LOG(LogStreaming, Warning, TEXT("Failed to read load order manifest %s."), Filename);
+		Packages.Reset();
+		return false;
+	}
+	return true;
+}
+
+bool FLoadOrderManifest::Save(const TCHAR* Filename)
+{
+	FArrayWriter Writer;
+	uint32 Tag = LoadOrderManifest::FileTag;
+	int32 Version = LoadOrderManifest::FileVersion;
+	Writer << Tag;
+	Writer << Version;
+	Writer << *this;
+	return FFileHelper::SaveArrayToFile(Writer, Filename);
+}
+
+FArchive& operator<<(FArchive& Ar, FLoadOrderManifest& Manifest)
+{
+	Ar << Manifest.Packages;
+	return Ar;
+}
@@ -490,6 +490,7 @@ UStruct::UStruct( EStaticConstructor, int32 InSize, EObjectFlags InFlags )
 ,	RefLink			( NULL )
 ,	DestructorLink	( NULL )
 , PostConstructLink( NULL )
+, UnversionedSchema( nullptr )
 {
 }
 
@@ -503,6 +504,7 @@ UStruct::UStruct(UStruct* InSuperStruct, SIZE_T ParamsSize, SIZE_T Alignment)
 	, RefLink(NULL)
 	, DestructorLink(NULL)
 	, PostConstructLink(NULL)
+	, UnversionedSchema(nullptr)
 {
 }
 
@@ -516,6 +518,7 @@ UStruct::UStruct(const FObjectInitializer& ObjectInitializer, UStruct* InSuperSt
 ,	RefLink			( NULL )
 ,	DestructorLink	( NULL )
 , PostConstructLink( NULL )
+, UnversionedSchema( nullptr )
 {
 }
 
@@ -556,6 +559,9 @@ void UStruct::GetPreloadDependencies(TArray<UObject*>& OutDeps)
 
 void UStruct::Link(FArchive& Ar, bool bRelinkExistingProperties)
 {
+	// the property layout is about to change
+	DestroyUnversionedSchema();
+
 	if (bRelinkExistingProperties)
 	{
 		// Preload everything before we calculate size, as the preload may end up recursively linking things
@@ -876,6 +882,11 @@ void UStruct::SerializeTaggedProperties(FArchive& Ar, uint8* Data, UStruct* Defa
 {
 	//SCOPED_LOADTIMER(SerializeTaggedPropertiesTime);
 
+	if (Ar.UseUnversionedPropertySerialization() && SerializeUnversionedProperties(Ar, Data, DefaultsStruct, Defaults, BreakRecursionIfFullyLoad))
+	{
+		return;
+	}
+
 	// Determine if this struct supports optional property guid's (UBlueprintGeneratedClasses Only)
 	const bool bArePropertyGuidsAvailable = (Ar.UE4Ver() >= VER_UE4_PROPERTY_GUID_IN_PROPERTY_TAG) && !FPlatformProperties::RequiresCookedData() && ArePropertyGuidsAvailable();
 
@@ -1177,6 +1188,7 @@ void UStruct::SerializeTaggedProperties(FArchive& Ar, uint8* Data, UStruct* Defa
 }
 void UStruct::FinishDestroy()
 {
+	DestroyUnversionedSchema();
 	Script.Empty();
 	Super::FinishDestroy();
 }
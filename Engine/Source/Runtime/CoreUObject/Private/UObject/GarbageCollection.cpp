@@ -21,6 +21,8 @@
 #include "UObject/GCScopeLock.h"
 #include "HAL/ExceptionHandling.h"
 #include "UObject/UObjectClusters.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
 
 /*-----------------------------------------------------------------------------
    Garbage collection.
@@ -212,21 +214,7 @@ static FAutoConsoleVariableRef CVarMinDesiredObjectsPerSubTask(
 	ECVF_Default
 	);
 
-#if PERF_DETAILED_PER_CLASS_GC_STATS
-/** Map from a UClass' FName to the number of objects that were purged during the last purge phase of this class.	*/
-static TMap<const FName,uint32> GClassToPurgeCountMap;
-/** Map from a UClass' FName to the number of "Disregard For GC" object references followed for all instances.		*/
-static TMap<const FName,uint32> GClassToDisregardedObjectRefsMap;
-/** Map from a UClass' FName to the number of regular object references followed for all instances.					*/
-static TMap<const FName,uint32> GClassToRegularObjectRefsMap;
-/** Map from a UClass' FName to the number of cycles spent with GC.													*/
-static TMap<const FName,uint32> GClassToCyclesMap;
-
-/** Number of disregarded object refs for current object.															*/
-static uint32 GCurrentObjectDisregardedObjectRefs;
-/** Number of regulard object refs for current object.																*/
-static uint32 GCurrentObjectRegularObjectRefs;
-
+#if PERF_DETAILED_PER_CLASS_GC_STATS || ENABLE_GC_COST_BY_CLASS_PROFILING
 /**
  * Helper structure used for sorting class to count map.
  */
@@ -292,6 +280,165 @@ static void LogClassCountInfo( const TCHAR* LogText, TMap<const FName,uint32>& C
 };
 #endif
 
+#if PERF_DETAILED_PER_CLASS_GC_STATS
+/** Map from a UClass' FName to the number of objects that were purged during the last purge phase of this class.	*/
+static TMap<const FName,uint32> GClassToPurgeCountMap;
+/** Map from a UClass' FName to the number of "Disregard For GC" object references followed for all instances.		*/
+static TMap<const FName,uint32> GClassToDisregardedObjectRefsMap;
+/** Map from a UClass' FName to the number of regular object references followed for all instances.					*/
+static TMap<const FName,uint32> GClassToRegularObjectRefsMap;
+/** Map from a UClass' FName to the number of cycles spent with GC.													*/
+static TMap<const FName,uint32> GClassToCyclesMap;
+
+/** Number of disregarded object refs for current object.															*/
+static uint32 GCurrentObjectDisregardedObjectRefs;
+/** Number of regulard object refs for current object.																*/
+static uint32 GCurrentObjectRegularObjectRefs;
+#endif
+
+#if ENABLE_GC_COST_BY_CLASS_PROFILING
+static int32 GProfileCostByClass = 0;
+static FAutoConsoleVariableRef CVarProfileCostByClass(
+	TEXT("gc.ProfileCostByClass"),
+	GProfileCostByClass,
+	TEXT("If enabled, reachability analysis records objects visited, reference tokens processed and time spent per class. Use gc.DumpCostByClass to see the results."),
+	ECVF_Default
+	);
+
+static void DumpGCCostByClass(FOutputDevice& Ar)
+{
+	FGCCostByClassProfiler& Profiler = FGCCostByClassProfiler::Get();
+	Profiler.DumpCsv(Ar);
+	Profiler.LogSummary(20);
+
+	const FString CsvFilename = FPaths::ProfilingDir() / FString::Printf(TEXT("GCCostByClass-%s.csv"), *FDateTime::Now().ToString());
+	FStringOutputDevice CsvOutput;
+	Profiler.DumpCsv(CsvOutput);
+	if (FFileHelper::SaveStringToFile(CsvOutput, *CsvFilename))
+	{
+		Ar.Logf(TEXT("Saved GC cost by class to %s"), *FPaths::ConvertRelativePathToFull(CsvFilename));
+	}
+}
+
+static FAutoConsoleCommandWithOutputDevice DumpGCCostByClassCommand(
+	TEXT("gc.DumpCostByClass"),
+	TEXT("Dumps the reachability analysis cost per class recorded with gc.ProfileCostByClass as CSV to the console and the profiling folder, and logs the most expensive classes."),
+	FConsoleCommandWithOutputDeviceDelegate::CreateStatic(&DumpGCCostByClass)
+	);
+
+static FAutoConsoleCommand ResetGCCostByClassCommand(
+	TEXT("gc.ResetCostByClass"),
+	TEXT("Discards the reachability analysis cost per class recorded with gc.ProfileCostByClass."),
+	FConsoleCommandDelegate::CreateLambda([]() { FGCCostByClassProfiler::Get().Reset(); })
+	);
+#endif
+
+FGCCostByClassProfiler* FGCCostByClassProfiler::GetIfEnabled()
+{
+#if ENABLE_GC_COST_BY_CLASS_PROFILING
+	if (GProfileCostByClass)
+	{
+		return &Get();
+	}
+#endif
+	return nullptr;
+}
+
+FGCCostByClassProfiler& FGCCostByClassProfiler::Get()
+{
+	static FGCCostByClassProfiler Singleton;
+	return Singleton;
+}
+
+void FGCCostByClassProfiler::NotifyCollection()
+{
+	FScopeLock CostsLock(&CostsCritical);
+	NumCollections++;
+}
+
+void FGCCostByClassProfiler::Merge(const TMap<UClass*, FGCClassCost>& ClassCosts)
+{
+	FScopeLock CostsLock(&CostsCritical);
+	for (const TPair<UClass*, FGCClassCost>& ClassCost : ClassCosts)
+	{
+		FGCClassCost& TotalCost = CostByClass.FindOrAdd(ClassCost.Key->GetFName());
+		TotalCost.NumObjects += ClassCost.Value.NumObjects;
+		TotalCost.NumTokens += ClassCost.Value.NumTokens;
+		TotalCost.Cycles += ClassCost.Value.Cycles;
+	}
+}
+
+void FGCCostByClassProfiler::GetSortedCosts(TArray<TPair<FName, FGCClassCost>>& OutCosts, int32& OutNumCollections)
+{
+	{
+		FScopeLock CostsLock(&CostsCritical);
+		OutCosts.Empty(CostByClass.Num());
+		for (const TPair<FName, FGCClassCost>& ClassCost : CostByClass)
+		{
+			OutCosts.Add(ClassCost);
+		}
+		OutNumCollections = NumCollections;
+	}
+	OutCosts.Sort([](const TPair<FName, FGCClassCost>& A, const TPair<FName, FGCClassCost>& B)
+	{
+		return A.Value.Cycles > B.Value.Cycles;
+	});
+}
+
+void FGCCostByClassProfiler::DumpCsv(FOutputDevice& Ar)
+{
+	TArray<TPair<FName, FGCClassCost>> SortedCosts;
+	int32 NumProfiledCollections = 0;
+	GetSortedCosts(SortedCosts, NumProfiledCollections);
+
+	Ar.Logf(TEXT("Class,Objects,Tokens,TimeMs,ObjectsPerCollection,TimeMsPerCollection"));
+	const int32 Divisor = FMath::Max(1, NumProfiledCollections);
+	for (const TPair<FName, FGCClassCost>& ClassCost : SortedCosts)
+	{
+		const double TimeMs = FPlatformTime::GetSecondsPerCycle() * 1000.0 * ClassCost.Value.Cycles;
+		Ar.Logf(TEXT("%s,%llu,%llu,%.3f,%.1f,%.4f"),
+			*ClassCost.Key.ToString(),
+			ClassCost.Value.NumObjects,
+			ClassCost.Value.NumTokens,
+			TimeMs,
+			(double)ClassCost.Value.NumObjects / Divisor,
+			TimeMs / Divisor);
+	}
+}
+
+void FGCCostByClassProfiler::LogSummary(int32 NumClassesToLog)
+{
+#if ENABLE_GC_COST_BY_CLASS_PROFILING
+	TArray<TPair<FName, FGCClassCost>> SortedCosts;
+	int32 NumProfiledCollections = 0;
+	GetSortedCosts(SortedCosts, NumProfiledCollections);
+
+	TMap<const FName,uint32> ClassToObjectsMap;
+	TMap<const FName,uint32> ClassToTokensMap;
+	TMap<const FName,uint32> ClassToMicrosecondsMap;
+	uint64 TotalCycles = 0;
+	for (const TPair<FName, FGCClassCost>& ClassCost : SortedCosts)
+	{
+		ClassToObjectsMap.Add(ClassCost.Key, (uint32)FMath::Min<uint64>(ClassCost.Value.NumObjects, MAX_uint32));
+		ClassToTokensMap.Add(ClassCost.Key, (uint32)FMath::Min<uint64>(ClassCost.Value.NumTokens, MAX_uint32));
+		ClassToMicrosecondsMap.Add(ClassCost.Key, (uint32)FMath::Min<double>(FPlatformTime::GetSecondsPerCycle() * 1000000.0 * ClassCost.Value.Cycles, MAX_uint32));
+		TotalCycles += ClassCost.Value.Cycles;
+	}
+
+	UE_LOG(LogGarbage, Log, TEXT("GC cost by class over %d collections, %.2f ms total:"), NumProfiledCollections, FPlatformTime::GetSecondsPerCycle() * 1000.0 * TotalCycles);
+	LogClassCountInfo(TEXT("us for"), ClassToMicrosecondsMap, NumClassesToLog, 0);
+	LogClassCountInfo(TEXT("tokens for"), ClassToTokensMap, NumClassesToLog, 0);
+	LogClassCountInfo(TEXT("objects of"), ClassToObjectsMap, NumClassesToLog, 0);
+#endif
+}
+
+void FGCCostByClassProfiler::Reset()
+{
+	FScopeLock CostsLock(&CostsCritical);
+	CostByClass.Empty();
+	NumCollections = 0;
+}
+
 /**
 * Handles UObject references found by TFastReferenceCollector
 */
@@ -678,17 +825,17 @@ typedef FGCReferenceProcessor<false> FGCReferenceProcessorSinglethreaded;
 /**
 * Specialized FReferenceCollector that uses FGCReferenceProcessor to mark objects as reachable.
 */
-template <bool bParallel>
+template <typename ReferenceProcessorType>
 class FGCCollector : public FReferenceCollector
 {
-	FGCReferenceProcessor<bParallel>& ReferenceProcessor;
+	ReferenceProcessorType& ReferenceProcessor;
 	TArray<UObject*>& ObjectArray;
 	bool bAllowEliminatingReferences;
 	bool bShouldHandleAsWeakRef;
 
 public:
 
-	FGCCollector(FGCReferenceProcessor<bParallel>& InProcessor, TArray<UObject*>& InObjectArray)
+	FGCCollector(ReferenceProcessorType& InProcessor, TArray<UObject*>& InObjectArray)
 		: ReferenceProcessor(InProcessor)
 		, ObjectArray(InObjectArray)
 		, bAllowEliminatingReferences(true)
@@ -742,8 +889,8 @@ public:
 	}
 };
 
-typedef FGCCollector<true> FGCCollectorMultithreaded;
-typedef FGCCollector<false> FGCCollectorSinglethreaded;
+typedef FGCCollector<FGCReferenceProcessorMultithreaded> FGCCollectorMultithreaded;
+typedef FGCCollector<FGCReferenceProcessorSinglethreaded> FGCCollectorSinglethreaded;
 
 /*----------------------------------------------------------------------------
 	FReferenceFinder.
@@ -808,6 +955,171 @@ void FReferenceFinder::HandleObjectReference( UObject*& InObject, const UObject*
 	}
 }
 
+/** Allows periodic garbage collection to leave objects alone that have survived a number of collections. */
+static int32 GGenerationalGC = 0;
+static FAutoConsoleVariableRef CVarGenerationalGC(
+	TEXT("gc.GenerationalGC"),
+	GGenerationalGC,
+	TEXT("If enabled, periodic garbage collections are minor collections that only collect objects which haven't survived gc.GenerationalPromotionAge collections yet. Old objects are still scanned for references to young ones."),
+	ECVF_Default
+	);
+
+/** Number of collections an object needs to survive to be promoted to the old generation. */
+static int32 GGenerationalPromotionAge = 3;
+static FAutoConsoleVariableRef CVarGenerationalPromotionAge(
+	TEXT("gc.GenerationalPromotionAge"),
+	GGenerationalPromotionAge,
+	TEXT("Number of garbage collections an object needs to survive to be skipped by minor collections."),
+	ECVF_Default
+	);
+
+/** Number of minor collections between full collections. */
+static int32 GGenerationalFullCollectionInterval = 8;
+static FAutoConsoleVariableRef CVarGenerationalFullCollectionInterval(
+	TEXT("gc.GenerationalFullCollectionInterval"),
+	GGenerationalFullCollectionInterval,
+	TEXT("Number of minor garbage collections performed before the next periodic collection considers all objects again."),
+	ECVF_Default
+	);
+
+/**
+ * Keeps track of the generation of each object for generational garbage collection.
+ *
+ * Every object starts in the young generation and becomes old once it has survived GGenerationalPromotionAge collections.
+ * Minor collections never mark old objects as unreachable, so they are neither unhashed nor purged. Native code stores
+ * object references without going through any barrier, so there is no way to tell which old objects reference young
+ * ones. Minor collections therefore process the references of every old object like those of the root set. Full
+ * collections are performed periodically to collect old garbage.
+ */
+class FGenerationalGCTracker : public FUObjectArray::FUObjectCreateListener
+{
+	enum
+	{
+		/** Highest number of survived collections an object's generation byte can hold. */
+		MaxAge = 0xff,
+	};
+
+public:
+
+	/** Default constructor, initializing all members. */
+	FGenerationalGCTracker()
+		: bTracking(false)
+		, bHadFullCollection(false)
+		, NumMinorCollectionsSinceFullCollection(0)
+		, PromotionAge(0)
+	{
+	}
+
+	/** @return true if object generations are currently being tracked. */
+	FORCEINLINE bool IsTracking() const
+	{
+		return bTracking;
+	}
+
+	/**
+	 * Picks the kind of collection that's about to run, starting or stopping generation tracking as gc.GenerationalGC demands.
+	 *
+	 * @param bAllowMinorCollection	Whether the caller is fine with only collecting young objects
+	 * @return true if this should be a minor collection
+	 */
+	bool BeginCollection(bool bAllowMinorCollection)
+	{
+		SetTracking(GGenerationalGC != 0);
+		PromotionAge = FMath::Clamp(GGenerationalPromotionAge, 1, (int32)MaxAge);
+
+		// The first collection after starting to track is a full one, none of the existing objects have aged yet
+		if (bTracking && bAllowMinorCollection && bHadFullCollection && NumMinorCollectionsSinceFullCollection < GGenerationalFullCollectionInterval)
+		{
+			NumMinorCollectionsSinceFullCollection++;
+			return true;
+		}
+		bHadFullCollection = bTracking;
+		NumMinorCollectionsSinceFullCollection = 0;
+		return false;
+	}
+
+	/** @return true if minor collections keep the object regardless of it being referenced or not. */
+	FORCEINLINE bool IsOld(int32 ObjectIndex) const
+	{
+		return ObjectIndex < ObjectGenerations.Num() && ObjectGenerations[ObjectIndex] >= PromotionAge;
+	}
+
+	/** Counts one more survived collection for all objects that haven't been found unreachable, promoting the ones that are old enough. */
+	void AgeSurvivors()
+	{
+		if (!bTracking)
+		{
+			return;
+		}
+
+		FScopeLock GenerationsLock(&ObjectGenerationsCritical);
+		ObjectGenerations.SetNumZeroed(FMath::Max(ObjectGenerations.Num(), GUObjectArray.GetObjectArrayNum()), false);
+		for (FRawObjectIterator It(true); It; ++It)
+		{
+			FUObjectItem* ObjectItem = *It;
+			uint8& Generation = ObjectGenerations[It.GetIndex()];
+			if (!ObjectItem->IsUnreachable() && Generation < PromotionAge)
+			{
+				Generation++;
+			}
+		}
+	}
+
+	//~ Begin FUObjectArray::FUObjectCreateListener Interface
+	virtual void NotifyUObjectCreated(const UObjectBase* Object, int32 Index) override
+	{
+		// Object indices are reused, so the slot may still hold the generation of a purged object
+		FScopeLock GenerationsLock(&ObjectGenerationsCritical);
+		if (Index >= ObjectGenerations.Num())
+		{
+			ObjectGenerations.AddZeroed(Index + 1 - ObjectGenerations.Num());
+		}
+		ObjectGenerations[Index] = 0;
+	}
+	//~ End FUObjectArray::FUObjectCreateListener Interface
+
+private:
+
+	/** Starts or stops tracking object generations. */
+	void SetTracking(bool bShouldTrack)
+	{
+		if (bShouldTrack != bTracking)
+		{
+			FScopeLock GenerationsLock(&ObjectGenerationsCritical);
+			if (bShouldTrack)
+			{
+				ObjectGenerations.Reset();
+				ObjectGenerations.AddZeroed(GUObjectArray.GetObjectArrayNum());
+				GUObjectArray.AddUObjectCreateListener(this);
+			}
+			else
+			{
+				GUObjectArray.RemoveUObjectCreateListener(this);
+				ObjectGenerations.Empty();
+			}
+			bTracking = bShouldTrack;
+			bHadFullCollection = false;
+			NumMinorCollectionsSinceFullCollection = 0;
+		}
+	}
+
+	/** Whether object generations are being tracked. */
+	bool bTracking;
+	/** Whether there has been a full collection since tracking started. */
+	bool bHadFullCollection;
+	/** Number of minor collections since the last full collection. */
+	int32 NumMinorCollectionsSinceFullCollection;
+	/** GGenerationalPromotionAge at the start of the current collection. */
+	int32 PromotionAge;
+	/** Number of survived collections of each object, indexed by object index. */
+	TArray<uint8> ObjectGenerations;
+	/** Guards ObjectGenerations, which may be added to from any thread. */
+	FCriticalSection ObjectGenerationsCritical;
+};
+
+/** Object generations for generational garbage collection. */
+static FGenerationalGCTracker GGenerationalGC;
+
 /**
  * Implementation of parallel realtime garbage collector using recursive subdivision
  *
@@ -828,7 +1140,9 @@ public:
 	/** 
 	 * Marks all objects that don't have KeepFlags and EInternalObjectFlags::GarbageCollectionKeepFlags as unreachable
 	 * This function is a template to speed up the case where we don't need to assemble the token stream (saves about 6ms on PS4)
+	 * Minor collections never mark old objects as unreachable, they are processed like the root set instead.
 	 */
+	template <bool bMinorCollection>
 	void MarkObjectsAsUnreachable(TArray<UObject*>& ObjectsToSerialize, const EObjectFlags KeepFlags)
 	{
 		const EInternalObjectFlags FastKeepFlags = EInternalObjectFlags::GarbageCollectionKeepFlags;
@@ -868,7 +1182,12 @@ public:
 			else if (ObjectItem->GetOwnerIndex() <= 0)
 			{
 				bool bMarkAsUnreachable = true;
-				if (!ObjectItem->IsPendingKill())
+				if (bMinorCollection && GGenerationalGC.IsOld(It.GetIndex()))
+				{
+					// Old objects and clusters are kept by minor collections, their references keep young objects alive
+					bMarkAsUnreachable = false;
+				}
+				else if (!ObjectItem->IsPendingKill())
 				{
 					// Internal flags are super fast to check
 					if (ObjectItem->HasAnyFlags(FastKeepFlags))
@@ -942,8 +1261,10 @@ public:
 	 * Performs reachability analysis.
 	 *
 	 * @param KeepFlags		Objects with these flags will be kept regardless of being referenced or not
+	 * @param bForceSingleThreaded	Collect references on a single thread
+	 * @param bMinorCollection	Only collect young objects, see FGenerationalGCTracker
 	 */
-	void PerformReachabilityAnalysis(EObjectFlags KeepFlags, bool bForceSingleThreaded = false)
+	void PerformReachabilityAnalysis(EObjectFlags KeepFlags, bool bForceSingleThreaded = false, bool bMinorCollection = false)
 	{		
 		DECLARE_SCOPE_CYCLE_COUNTER(TEXT("FRealtimeGC::PerformReachabilityAnalysis"), STAT_FArchiveRealtimeGC_PerformReachabilityAnalysis, STATGROUP_GC);
 
@@ -961,18 +1282,31 @@ public:
 			ObjectsToSerialize.Add(FGCObject::GGCObjectReferencer);
 		}
 
-		MarkObjectsAsUnreachable(ObjectsToSerialize, KeepFlags);
+		if (bMinorCollection)
+		{
+			MarkObjectsAsUnreachable<true>(ObjectsToSerialize, KeepFlags);
+		}
+		else
+		{
+			MarkObjectsAsUnreachable<false>(ObjectsToSerialize, KeepFlags);
+		}
+
+		FGCCostByClassProfiler* CostProfiler = FGCCostByClassProfiler::GetIfEnabled();
+		if (CostProfiler)
+		{
+			CostProfiler->NotifyCollection();
+		}
 
 		if (!bForceSingleThreaded)
 		{
 			FGCReferenceProcessorMultithreaded ReferenceProcessor;
-			TFastReferenceCollector<true, FGCReferenceProcessorMultithreaded, FGCCollectorMultithreaded, FGCArrayPool> ReferenceCollector(ReferenceProcessor, FGCArrayPool::Get());
+			TFastReferenceCollector<true, FGCReferenceProcessorMultithreaded, FGCCollectorMultithreaded, FGCArrayPool> ReferenceCollector(ReferenceProcessor, FGCArrayPool::Get(), CostProfiler);
 			ReferenceCollector.CollectReferences(ObjectsToSerialize);
 		}
 		else
 		{
 			FGCReferenceProcessorSinglethreaded ReferenceProcessor;
-			TFastReferenceCollector<false, FGCReferenceProcessorSinglethreaded, FGCCollectorSinglethreaded, FGCArrayPool> ReferenceCollector(ReferenceProcessor, FGCArrayPool::Get());
+			TFastReferenceCollector<false, FGCReferenceProcessorSinglethreaded, FGCCollectorSinglethreaded, FGCArrayPool> ReferenceCollector(ReferenceProcessor, FGCArrayPool::Get(), CostProfiler);
 			ReferenceCollector.CollectReferences(ObjectsToSerialize);
 		}
 		FGCArrayPool::Get().ReturnToPool(&ObjectsToSerialize);
@@ -983,6 +1317,493 @@ public:
 	}
 };
 
+/** Allows TryCollectGarbageIncrementally to spread reachability analysis over several calls. */
+static int32 GAllowIncrementalReachability = 0;
+static FAutoConsoleVariableRef CVarAllowIncrementalReachability(
+	TEXT("gc.AllowIncrementalReachability"),
+	GAllowIncrementalReachability,
+	TEXT("If enabled, reachability analysis started by TryCollectGarbageIncrementally is spread over several frames. The final step processes all reachable objects again before anything is marked unreachable."),
+	ECVF_Default
+	);
+
+/** Number of objects processed between time limit checks of incremental reachability analysis. */
+static int32 GIncrementalReachabilityObjectsPerTimeCheck = 256;
+static FAutoConsoleVariableRef CVarIncrementalReachabilityObjectsPerTimeCheck(
+	TEXT("gc.IncrementalReachabilityObjectsPerTimeCheck"),
+	GIncrementalReachabilityObjectsPerTimeCheck,
+	TEXT("Number of objects processed by incremental reachability analysis between checking the time limit."),
+	ECVF_Default
+	);
+
+class FIncrementalRealtimeGC;
+
+/**
+ * Handles UObject references found by TFastReferenceCollector for FIncrementalRealtimeGC.
+ * Newly reachable objects are queued in FIncrementalRealtimeGC instead of the collector's array so that each call to
+ * CollectReferences only processes the objects it was given.
+ */
+class FIncrementalGCReferenceProcessor
+{
+public:
+
+	FIncrementalGCReferenceProcessor(FIncrementalRealtimeGC& InOwner)
+		: Owner(InOwner)
+	{
+	}
+
+	FORCEINLINE int32 GetMinDesiredObjectsPerSubTask() const
+	{
+		return GMinDesiredObjectsPerSubTask;
+	}
+
+	FORCEINLINE void UpdateDetailedStats(UObject* CurrentObject, uint32 DeltaCycles)
+	{
+	}
+
+	FORCEINLINE void LogDetailedStatsSummary()
+	{
+	}
+
+	FORCEINLINE void HandleObjectReference(TArray<UObject*>& ObjectsToSerialize, const UObject * const ReferencingObject, UObject*& Object, const bool bAllowReferenceElimination, const bool bStrongReference = true);
+
+	FORCEINLINE void HandleTokenStreamObjectReference(TArray<UObject*>& ObjectsToSerialize, UObject* ReferencingObject, UObject*& Object, const int32 TokenIndex, bool bAllowReferenceElimination)
+	{
+		HandleObjectReference(ObjectsToSerialize, ReferencingObject, Object, bAllowReferenceElimination);
+	}
+
+private:
+
+	FIncrementalRealtimeGC& Owner;
+};
+
+typedef FGCCollector<FIncrementalGCReferenceProcessor> FIncrementalGCCollector;
+
+/**
+ * Reachability analysis that can be spread over several calls.
+ *
+ * Unlike FRealtimeGC it doesn't touch any object flags until it is finished. Reachable objects are tracked in ObjectMarks
+ * instead so weak pointers and object lookups keep working between steps. Native code stores object references without
+ * telling the analysis, so references stored in objects that have already been processed would be missed. Finish therefore
+ * marks new roots and all objects created while the analysis was pending, then processes every reachable object again
+ * in one go before it sets the same EInternalObjectFlags FRealtimeGC::PerformReachabilityAnalysis would have set.
+ *
+ * Clusters that need to be dissolved because they reference pending kill objects can't be handled incrementally,
+ * the analysis falls back to FRealtimeGC when it runs into one.
+ */
+class FIncrementalRealtimeGC : public FUObjectArray::FUObjectCreateListener
+{
+	/** Bits stored per object in ObjectMarks. */
+	enum EObjectMark : uint8
+	{
+		/** The object has been found reachable. */
+		OM_Reachable = 1,
+		/** The object is referenced by at least one strong reference. */
+		OM_StrongReference = 2,
+	};
+
+public:
+
+	/** Default constructor, initializing all members. */
+	FIncrementalRealtimeGC()
+		: KeepFlags(RF_NoFlags)
+		, bInProgress(false)
+		, bNeedsFullReachabilityAnalysis(false)
+		, NumCreatedObjectsMarked(0)
+	{
+	}
+
+	/** @return true if reachability analysis has been started and not finished or canceled yet. */
+	FORCEINLINE bool IsInProgress() const
+	{
+		return bInProgress;
+	}
+
+	/** @return the flags objects are kept by in the pending analysis. */
+	FORCEINLINE EObjectFlags GetKeepFlags() const
+	{
+		return KeepFlags;
+	}
+
+	/**
+	 * Starts incremental reachability analysis by marking the root set and objects with keep flags.
+	 *
+	 * @param InKeepFlags	Objects with these flags will be kept regardless of being referenced or not
+	 */
+	void Start(EObjectFlags InKeepFlags)
+	{
+		check(!bInProgress);
+
+		bInProgress = true;
+		KeepFlags = InKeepFlags;
+		bNeedsFullReachabilityAnalysis = false;
+
+		if (FGCCostByClassProfiler* CostProfiler = FGCCostByClassProfiler::GetIfEnabled())
+		{
+			CostProfiler->NotifyCollection();
+		}
+
+		ObjectMarks.Reset();
+		ObjectMarks.AddZeroed(GUObjectArray.GetObjectArrayNum());
+		ObjectsToProcess.Reset();
+		CreatedObjectIndices.Reset();
+		NumCreatedObjectsMarked = 0;
+
+		GUObjectArray.AddUObjectCreateListener(this);
+
+		// Make sure GC referencer object is checked for references to other objects even if it resides in permanent object pool
+		if (FPlatformProperties::RequiresCookedData() && FGCObject::GGCObjectReferencer && GUObjectArray.IsDisregardForGC(FGCObject::GGCObjectReferencer))
+		{
+			ObjectsToProcess.Add(FGCObject::GGCObjectReferencer);
+		}
+		MarkRoots();
+	}
+
+	/**
+	 * Processes reachable objects until there are none left or the time limit is hit.
+	 *
+	 * @param TimeLimit	Soft time limit in seconds, zero or less processes all objects
+	 * @return true if all reachable objects have been processed and the analysis can be finished
+	 */
+	bool Step(double TimeLimit)
+	{
+		DECLARE_SCOPE_CYCLE_COUNTER(TEXT("FIncrementalRealtimeGC::Step"), STAT_FIncrementalRealtimeGC_Step, STATGROUP_GC);
+		check(bInProgress);
+
+		const double StartTime = FPlatformTime::Seconds();
+		MarkIncomingObjects();
+
+		FIncrementalGCReferenceProcessor ReferenceProcessor(*this);
+		TFastReferenceCollector<false, FIncrementalGCReferenceProcessor, FIncrementalGCCollector, FGCArrayPool> ReferenceCollector(ReferenceProcessor, FGCArrayPool::Get(), FGCCostByClassProfiler::GetIfEnabled());
+		TArray<UObject*>& ObjectsThisBatch = *FGCArrayPool::Get().GetArrayFromPool();
+
+		const int32 ObjectsPerTimeCheck = FMath::Max(1, GIncrementalReachabilityObjectsPerTimeCheck);
+		while (ObjectsToProcess.Num() && !bNeedsFullReachabilityAnalysis && (TimeLimit <= 0.0 || FPlatformTime::Seconds() - StartTime < TimeLimit))
+		{
+			// Take objects from the end so that the queue doesn't need to be shifted
+			const int32 NumThisBatch = FMath::Min(ObjectsPerTimeCheck, ObjectsToProcess.Num());
+			const int32 FirstIndex = ObjectsToProcess.Num() - NumThisBatch;
+			ObjectsThisBatch.Reset();
+			ObjectsThisBatch.Append(ObjectsToProcess.GetData() + FirstIndex, NumThisBatch);
+			ObjectsToProcess.SetNum(FirstIndex, false);
+
+			ReferenceCollector.CollectReferences(ObjectsThisBatch);
+		}
+		FGCArrayPool::Get().ReturnToPool(&ObjectsThisBatch);
+
+		return ObjectsToProcess.Num() == 0 || bNeedsFullReachabilityAnalysis;
+	}
+
+	/**
+	 * Finishes the analysis by processing all remaining objects, then marks all objects that haven't been found reachable
+	 * with EInternalObjectFlags::Unreachable. The analysis is no longer in progress afterwards, even if it fails.
+	 *
+	 * @param InKeepFlags	Keep flags of the garbage collection that is finishing the analysis
+	 * @return false if the analysis couldn't be finished and has to be redone with FRealtimeGC
+	 */
+	bool Finish(EObjectFlags InKeepFlags)
+	{
+		DECLARE_SCOPE_CYCLE_COUNTER(TEXT("FIncrementalRealtimeGC::Finish"), STAT_FIncrementalRealtimeGC_Finish, STATGROUP_GC);
+		check(bInProgress);
+
+		if (InKeepFlags == KeepFlags)
+		{
+			// Everything below has to happen without other code running in between, references stored after the remark would be missed
+			MarkIncomingObjects();
+			MarkRoots();
+			ProcessReachableObjectsAgain();
+			if (FGCObject::GGCObjectReferencer)
+			{
+				ObjectsToProcess.Add(FGCObject::GGCObjectReferencer);
+			}
+			Step(0.0);
+		}
+		else
+		{
+			bNeedsFullReachabilityAnalysis = true;
+		}
+
+		const bool bSucceeded = !bNeedsFullReachabilityAnalysis;
+		if (bSucceeded)
+		{
+			MarkObjectsAsUnreachable();
+		}
+		Cancel();
+
+		return bSucceeded;
+	}
+
+	/** Stops the pending analysis without changing any object flags. */
+	void Cancel()
+	{
+		if (bInProgress)
+		{
+			GUObjectArray.RemoveUObjectCreateListener(this);
+
+			bInProgress = false;
+			ObjectMarks.Empty();
+			ObjectsToProcess.Empty();
+			CreatedObjectIndices.Empty();
+			NumCreatedObjectsMarked = 0;
+		}
+	}
+
+	//~ Begin FUObjectArray::FUObjectCreateListener Interface
+	virtual void NotifyUObjectCreated(const UObjectBase* Object, int32 Index) override
+	{
+		// Objects may be created on any thread, they are marked by the next step
+		FScopeLock IncomingObjectsLock(&IncomingObjectsCritical);
+		CreatedObjectIndices.Add(Index);
+	}
+	//~ End FUObjectArray::FUObjectCreateListener Interface
+
+	/**
+	 * Handles a reference found while processing an object, potentially NULL'ing it.
+	 *
+	 * @param Object						Object pointer passed by reference
+	 * @param bAllowReferenceElimination	Whether to allow NULL'ing the reference if the object is pending kill
+	 * @param bStrongReference				Whether the reference keeps the object from being marked pending kill by GC
+	 */
+	FORCEINLINE void HandleObjectReference(UObject*& Object, const bool bAllowReferenceElimination, const bool bStrongReference)
+	{
+		if (Object == nullptr || GUObjectAllocator.ResidesInPermanentPool(Object))
+		{
+			return;
+		}
+
+		const int32 ObjectIndex = GUObjectArray.ObjectToIndex(Object);
+		FUObjectItem* ObjectItem = GUObjectArray.IndexToObjectUnsafeForGC(ObjectIndex);
+		// Remove references to pending kill objects if we're allowed to do so.
+		if (ObjectItem->IsPendingKill() && bAllowReferenceElimination)
+		{
+			checkSlow(ObjectItem->GetOwnerIndex() <= 0);
+			Object = nullptr;
+		}
+		else
+		{
+			MarkObject(ObjectIndex, bStrongReference);
+		}
+	}
+
+private:
+
+	/** Marks the root set and all objects kept alive by keep flags. */
+	void MarkRoots()
+	{
+		const EInternalObjectFlags FastKeepFlags = EInternalObjectFlags::GarbageCollectionKeepFlags;
+
+		for (FRawObjectIterator It(true); It; ++It)
+		{
+			FUObjectItem* ObjectItem = *It;
+			checkSlow(ObjectItem);
+
+			if (ObjectItem->IsRootSet())
+			{
+				MarkObject(It.GetIndex(), true);
+			}
+			else if (ObjectItem->GetOwnerIndex() <= 0)
+			{
+				if (!ObjectItem->IsPendingKill())
+				{
+					// If KeepFlags is non zero this is going to be very slow due to cache misses
+					if (ObjectItem->HasAnyFlags(FastKeepFlags) || (KeepFlags != RF_NoFlags && static_cast<UObject*>(ObjectItem->Object)->HasAnyFlags(KeepFlags)))
+					{
+						MarkObject(It.GetIndex(), true);
+					}
+				}
+				else if (ObjectItem->HasAnyFlags(EInternalObjectFlags::ClusterRoot))
+				{
+					// Pending kill clusters need to be dissolved
+					bNeedsFullReachabilityAnalysis = true;
+				}
+			}
+		}
+	}
+
+	/** Marks objects that have been created since the last step. */
+	void MarkIncomingObjects()
+	{
+		FScopeLock IncomingObjectsLock(&IncomingObjectsCritical);
+
+		for (; NumCreatedObjectsMarked < CreatedObjectIndices.Num(); ++NumCreatedObjectsMarked)
+		{
+			MarkObject(CreatedObjectIndices[NumCreatedObjectsMarked], true);
+		}
+	}
+
+	/**
+	 * Sets the marks of an object.
+	 *
+	 * @return true if the object hasn't been found reachable before
+	 */
+	FORCEINLINE bool SetMarks(int32 ObjectIndex, bool bStrongReference)
+	{
+		if (ObjectIndex >= ObjectMarks.Num())
+		{
+			ObjectMarks.AddZeroed(ObjectIndex + 1 - ObjectMarks.Num());
+		}
+		uint8& Marks = ObjectMarks[ObjectIndex];
+		const bool bNewlyReachable = !(Marks & OM_Reachable);
+		Marks |= OM_Reachable | (bStrongReference ? OM_StrongReference : 0);
+		return bNewlyReachable;
+	}
+
+	/** Marks an object as reachable and queues it to have its references processed if it hasn't been found before. */
+	void MarkObject(int32 ObjectIndex, bool bStrongReference)
+	{
+		FUObjectItem* ObjectItem = GUObjectArray.IndexToObjectUnsafeForGC(ObjectIndex);
+		const int32 OwnerIndex = ObjectItem->GetOwnerIndex();
+		if (OwnerIndex > 0)
+		{
+			// Clustered objects are kept alive by their cluster root
+			SetMarks(ObjectIndex, bStrongReference);
+			ObjectIndex = OwnerIndex;
+			ObjectItem = GUObjectArray.IndexToObjectUnsafeForGC(OwnerIndex);
+			checkSlow(ObjectItem->HasAnyFlags(EInternalObjectFlags::ClusterRoot));
+		}
+
+		if (SetMarks(ObjectIndex, bStrongReference))
+		{
+			if (ObjectItem->HasAnyFlags(EInternalObjectFlags::ClusterRoot))
+			{
+				MarkCluster(ObjectItem->GetClusterIndex());
+			}
+			else
+			{
+				ObjectsToProcess.Add(static_cast<UObject*>(ObjectItem->Object));
+			}
+		}
+	}
+
+	/** Marks everything a cluster references from outside of it, see FGCReferenceProcessor::MarkReferencedClustersAsReachable. */
+	void MarkCluster(int32 ClusterIndex)
+	{
+		FUObjectCluster& Cluster = GUObjectClusters[ClusterIndex];
+		for (int32 ReferencedClusterIndex : Cluster.ReferencedClusters)
+		{
+			if (ReferencedClusterIndex >= 0)
+			{
+				if (GUObjectArray.IndexToObjectUnsafeForGC(ReferencedClusterIndex)->IsPendingKill())
+				{
+					bNeedsFullReachabilityAnalysis = true;
+				}
+				else
+				{
+					SetMarks(ReferencedClusterIndex, true);
+				}
+			}
+		}
+		for (int32 ReferencedMutableObjectIndex : Cluster.MutableObjects)
+		{
+			if (ReferencedMutableObjectIndex >= 0)
+			{
+				if (GUObjectArray.IndexToObjectUnsafeForGC(ReferencedMutableObjectIndex)->IsPendingKill())
+				{
+					bNeedsFullReachabilityAnalysis = true;
+				}
+				else
+				{
+					MarkObject(ReferencedMutableObjectIndex, true);
+				}
+			}
+		}
+	}
+
+	/** Processes the references of an object again, even if they have already been processed. */
+	void ProcessObjectAgain(int32 ObjectIndex)
+	{
+		MarkObject(ObjectIndex, true);
+
+		FUObjectItem* ObjectItem = GUObjectArray.IndexToObjectUnsafeForGC(ObjectIndex);
+		if (ObjectItem->HasAnyFlags(EInternalObjectFlags::ClusterRoot))
+		{
+			// The object may have become a cluster root after it has been processed
+			MarkCluster(ObjectItem->GetClusterIndex());
+		}
+		else if (ObjectItem->GetOwnerIndex() <= 0)
+		{
+			ObjectsToProcess.Add(static_cast<UObject*>(ObjectItem->Object));
+		}
+	}
+
+	/** Queues all objects found reachable so far, including the ones created while the analysis was pending, to have their references processed again. */
+	void ProcessReachableObjectsAgain()
+	{
+		for (FRawObjectIterator It(true); It; ++It)
+		{
+			const int32 ObjectIndex = It.GetIndex();
+			if (ObjectIndex < ObjectMarks.Num() && (ObjectMarks[ObjectIndex] & OM_Reachable))
+			{
+				ProcessObjectAgain(ObjectIndex);
+			}
+		}
+	}
+
+	/** Sets the flags FRealtimeGC::MarkObjectsAsUnreachable and reference processing would have left on each object. */
+	void MarkObjectsAsUnreachable()
+	{
+		GObjectCountDuringLastMarkPhase = 0;
+
+		for (FRawObjectIterator It(true); It; ++It)
+		{
+			FUObjectItem* ObjectItem = *It;
+			const int32 ObjectIndex = It.GetIndex();
+			const uint8 Marks = ObjectIndex < ObjectMarks.Num() ? ObjectMarks[ObjectIndex] : 0;
+
+			// We can't collect garbage during an async load operation and by now all unreachable objects should've been purged.
+			checkf(!ObjectItem->IsUnreachable(), TEXT("%s"), *static_cast<UObject*>(ObjectItem->Object)->GetFullName());
+
+			GObjectCountDuringLastMarkPhase++;
+			ObjectItem->ClearFlags(EInternalObjectFlags::ReachableInCluster);
+			if (ObjectItem->GetOwnerIndex() > 0)
+			{
+				// Objects that are part of a GC cluster are never unreachable, they go away with their cluster root
+				if (Marks & OM_Reachable)
+				{
+					ObjectItem->SetFlags(EInternalObjectFlags::ReachableInCluster);
+				}
+			}
+			else if (!(Marks & OM_Reachable))
+			{
+				ObjectItem->SetFlags(EInternalObjectFlags::Unreachable | EInternalObjectFlags::NoStrongReference);
+			}
+			else if (!(Marks & OM_StrongReference))
+			{
+				ObjectItem->SetFlags(EInternalObjectFlags::NoStrongReference);
+			}
+		}
+	}
+
+	/** Keep flags of the pending analysis. */
+	EObjectFlags KeepFlags;
+	/** Whether an analysis has been started and not finished yet. */
+	bool bInProgress;
+	/** Set when the analysis ran into something it can't handle incrementally. */
+	bool bNeedsFullReachabilityAnalysis;
+	/** EObjectMark bits for each object, indexed by object index. */
+	TArray<uint8> ObjectMarks;
+	/** Reachable objects whose references haven't been processed yet. */
+	TArray<UObject*> ObjectsToProcess;
+	/** Guards CreatedObjectIndices which may be added to from any thread. */
+	FCriticalSection IncomingObjectsCritical;
+	/** Indices of all objects created since the analysis has been started. */
+	TArray<int32> CreatedObjectIndices;
+	/** Number of objects in CreatedObjectIndices that have already been marked. */
+	int32 NumCreatedObjectsMarked;
+};
+
+/** The pending incremental reachability analysis. */
+static FIncrementalRealtimeGC GIncrementalRealtimeGC;
+
+FORCEINLINE void FIncrementalGCReferenceProcessor::HandleObjectReference(TArray<UObject*>& ObjectsToSerialize, const UObject * const ReferencingObject, UObject*& Object, const bool bAllowReferenceElimination, const bool bStrongReference)
+{
+	Owner.HandleObjectReference(Object, bAllowReferenceElimination, bStrongReference);
+}
+
+bool IsIncrementalReachabilityAnalysisPending()
+{
+	return GIncrementalRealtimeGC.IsInProgress();
+}
+
 /**
  * Incrementally purge garbage by deleting all unreferenced objects after routing Destroy.
  *
@@ -1396,10 +2217,11 @@ struct FScopedCBDProfile
 /** 
  * Deletes all unreferenced objects, keeping objects that have any of the passed in KeepFlags set
  *
- * @param	KeepFlags			objects with those flags will be kept regardless of being referenced or not
- * @param	bPerformFullPurge	if true, perform a full purge after the mark pass
+ * @param	KeepFlags				objects with those flags will be kept regardless of being referenced or not
+ * @param	bPerformFullPurge		if true, perform a full purge after the mark pass
+ * @param	bAllowMinorCollection	if true, only young objects may be collected if gc.GenerationalGC is enabled
  */
-void CollectGarbageInternal(EObjectFlags KeepFlags, bool bPerformFullPurge)
+void CollectGarbageInternal(EObjectFlags KeepFlags, bool bPerformFullPurge, bool bAllowMinorCollection = false)
 {
 	SCOPE_TIME_GUARD(TEXT("Collect Garbage"));
 
@@ -1514,12 +2336,19 @@ void CollectGarbageInternal(EObjectFlags KeepFlags, bool bPerformFullPurge)
 			true;
 #endif	//PLATFORM_SUPPORTS_MULTITHREADED_GC
 
+		// Incremental reachability analysis always looks at all objects
+		const bool bMinorCollection = GGenerationalGC.BeginCollection(bAllowMinorCollection && !GIncrementalRealtimeGC.IsInProgress());
+
 		// Perform reachability analysis.
 		{
 			const double StartTime = FPlatformTime::Seconds();
-			FRealtimeGC TagUsedRealtimeGC;
-			TagUsedRealtimeGC.PerformReachabilityAnalysis(KeepFlags, bForceSingleThreadedGC);
-			UE_LOG(LogGarbage, Log, TEXT("%f ms for GC"), (FPlatformTime::Seconds() - StartTime) * 1000);
+			// Finish the analysis TryCollectGarbageIncrementally has started, or redo it if that's not possible
+			if (!GIncrementalRealtimeGC.IsInProgress() || !GIncrementalRealtimeGC.Finish(KeepFlags))
+			{
+				FRealtimeGC TagUsedRealtimeGC;
+				TagUsedRealtimeGC.PerformReachabilityAnalysis(KeepFlags, bForceSingleThreadedGC, bMinorCollection);
+			}
+			UE_LOG(LogGarbage, Log, TEXT("%f ms for %s"), (FPlatformTime::Seconds() - StartTime) * 1000, bMinorCollection ? TEXT("minor GC") : TEXT("GC"));
 		}
 
 		// Reconstruct clusters if needed
@@ -1618,6 +2447,9 @@ void CollectGarbageInternal(EObjectFlags KeepFlags, bool bPerformFullPurge)
 			UE_LOG(LogGarbage, Log, TEXT("%f ms for unhashing unreachable objects. Clusters removed: %d.   Items %d Cluster Items %d"), (FPlatformTime::Seconds() - StartTime) * 1000, ClustersRemoved, Items, ClusterItems);
 			FCoreUObjectDelegates::PostGarbageCollectConditionalBeginDestroy.Broadcast();
 		}
+
+		// Objects that survived get older
+		GGenerationalGC.AgeSurvivors();
 		FScopedCBDProfile::DumpProfile();
 		// Set flag to indicate that we are relying on a purge to be performed.
 		GObjPurgeIsRequired = true;
@@ -1654,7 +2486,8 @@ void CollectGarbage(EObjectFlags KeepFlags, bool bPerformFullPurge)
 	GGarbageCollectionGuardCritical.GCUnlock();
 }
 
-bool TryCollectGarbage(EObjectFlags KeepFlags, bool bPerformFullPurge)
+/** Performs garbage collection only if no other thread holds a lock on GC, optionally only collecting young objects. */
+static bool TryCollectGarbageInternal(EObjectFlags KeepFlags, bool bPerformFullPurge, bool bAllowMinorCollection)
 {
 	// No other thread may be performing UOBject operations while we're running
 	bool bCanRunGC = GGarbageCollectionGuardCritical.TryGCLock();
@@ -1670,7 +2503,7 @@ bool TryCollectGarbage(EObjectFlags KeepFlags, bool bPerformFullPurge)
 	if (bCanRunGC)
 	{
 		// Perform actual garbage collection
-		CollectGarbageInternal(KeepFlags, bPerformFullPurge);
+		CollectGarbageInternal(KeepFlags, bPerformFullPurge, bAllowMinorCollection);
 
 		// Other threads are free to use UObjects
 		GGarbageCollectionGuardCritical.GCUnlock();
@@ -1683,6 +2516,61 @@ bool TryCollectGarbage(EObjectFlags KeepFlags, bool bPerformFullPurge)
 	return bCanRunGC;
 }
 
+bool TryCollectGarbage(EObjectFlags KeepFlags, bool bPerformFullPurge)
+{
+	return TryCollectGarbageInternal(KeepFlags, bPerformFullPurge, false);
+}
+
+bool TryCollectGarbageIncrementally(EObjectFlags KeepFlags, float TimeLimit, bool bPerformFullPurge)
+{
+	if (!GAllowIncrementalReachability && !GIncrementalRealtimeGC.IsInProgress())
+	{
+		return TryCollectGarbageInternal(KeepFlags, bPerformFullPurge, true);
+	}
+
+	// No other thread may be performing UObject operations while we're marking
+	if (!GGarbageCollectionGuardCritical.TryGCLock())
+	{
+		GNumAttemptsSinceLastGC++;
+		return false;
+	}
+
+	bool bReachabilityAnalysisDone = false;
+	{
+		FGCScopeLock GCLock;
+
+		if (GIncrementalRealtimeGC.IsInProgress() && GIncrementalRealtimeGC.GetKeepFlags() != KeepFlags)
+		{
+			GIncrementalRealtimeGC.Cancel();
+		}
+		if (!GIncrementalRealtimeGC.IsInProgress())
+		{
+			// Objects can't be marked while a purge still needs the unreachable flags
+			if (GObjIncrementalPurgeIsInProgress || GObjPurgeIsRequired)
+			{
+				IncrementalPurgeGarbage(false);
+				FMemory::Trim();
+			}
+			GIncrementalRealtimeGC.Start(KeepFlags);
+		}
+
+		const double StartTime = FPlatformTime::Seconds();
+		bReachabilityAnalysisDone = GIncrementalRealtimeGC.Step(TimeLimit);
+		UE_LOG(LogGarbage, Verbose, TEXT("%f ms for incremental GC step"), (FPlatformTime::Seconds() - StartTime) * 1000);
+	}
+
+	// Unhash and purge unreachable objects like regular garbage collection does
+	if (bReachabilityAnalysisDone)
+	{
+		CollectGarbageInternal(KeepFlags, bPerformFullPurge);
+	}
+
+	// Other threads are free to use UObjects
+	GGarbageCollectionGuardCritical.GCUnlock();
+
+	return bReachabilityAnalysisDone;
+}
+
 
 /**
  * Helper function to add referenced objects via serialization
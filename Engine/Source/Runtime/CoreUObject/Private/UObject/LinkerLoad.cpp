@@ -1219,6 +1219,9 @@ FLinkerLoad::ELinkerStatus FLinkerLoad::SerializePackageFileSummary()
 #endif
 		}
 		
+		// Property data of unversioned packages can only be read through the schemas of their structs
+		SetUseUnversionedPropertySerialization(!!(Summary.PackageFlags & PKG_UnversionedProperties));
+
 		// Propagate fact that package cannot use lazy loading to archive (aka this).
 		if( (Summary.PackageFlags & PKG_DisallowLazyLoading) )
 		{
@@ -3349,6 +3349,9 @@ FSavePackageResultStruct UPackage::Save(UPackage* InOuter, UObject* Base, EObjec
 
 		uint32 Time = 0; CLOCK_CYCLES(Time);
 		int64 TotalPackageSizeUncompressed = 0;
+		int64 TotalBulkDataSize = 0;
+		int32 SavedExportCount = 0;
+		int32 SavedImportCount = 0;
 		
 		// Make sure package is fully loaded before saving. 
 		if (!Base && !InOuter->IsFullyLoaded())
@@ -3610,6 +3613,7 @@ FSavePackageResultStruct UPackage::Save(UPackage* InOuter, UObject* Base, EObjec
 
 				Linker->SetPortFlags(ComparisonFlags);
 				Linker->SetFilterEditorOnly( FilterEditorOnly );
+				Linker->SetUseUnversionedPropertySerialization(InOuter->HasAnyPackageFlags(PKG_UnversionedProperties));
 				Linker->SetCookingTarget(TargetPlatform);
 
 				// Make sure the package has the same version as the linker
@@ -4176,6 +4180,7 @@ FSavePackageResultStruct UPackage::Save(UPackage* InOuter, UObject* Base, EObjec
 				FObjectImportSortHelper ImportSortHelper;
 				ImportSortHelper.SortImports( Linker, Conform );
 				Linker->Summary.ImportCount = Linker->ImportMap.Num();
+				SavedImportCount = Linker->Summary.ImportCount;
 
 				if ( EndSavingIfCancelled( Linker, TempFilename ) ) 
 				{ 
@@ -4232,6 +4237,7 @@ FSavePackageResultStruct UPackage::Save(UPackage* InOuter, UObject* Base, EObjec
 				}
 
 				Linker->Summary.ExportCount = Linker->ExportMap.Num();
+				SavedExportCount = Linker->Summary.ExportCount;
 
 				if ( EndSavingIfCancelled( Linker, TempFilename ) ) 
 				{ 
@@ -5014,7 +5020,7 @@ FSavePackageResultStruct UPackage::Save(UPackage* InOuter, UObject* Base, EObjec
 						ExtraBulkDataFlags = BULKDATA_PayloadInSeperateFile;
 						if ( bSaveAsync )
 						{
-							TargetArchive = BulkArchive = new FBufferArchive(true);
+							TargetArchive = BulkArchive = new FLargeMemoryWriter(0, true);
 						}
 						else
 						{
@@ -5063,22 +5069,19 @@ FSavePackageResultStruct UPackage::Save(UPackage* InOuter, UObject* Base, EObjec
 					if (BulkArchive)
 					{
 						TotalPackageSizeUncompressed += BulkArchive->TotalSize();
+						TotalBulkDataSize += BulkArchive->TotalSize();
 						BulkArchive->Close();
 						if ( bSaveAsync )
 						{
-							FBufferArchive* BulkBuffer = (FBufferArchive*)(BulkArchive);
+							FLargeMemoryWriter* BulkWriter = (FLargeMemoryWriter*)(BulkArchive);
 
-							int64 DataSize = BulkBuffer->TotalSize();
-
-							// TODO - update the BulkBuffer code to write into a FLargeMemoryWriter so we can 
-							// take ownership of the data
-							uint8* Data = new uint8[DataSize];
-							FMemory::Memcpy(Data, BulkBuffer->GetData(), DataSize);							
-
-							FLargeMemoryPtr DataPtr = FLargeMemoryPtr(Data);
-		
-							if ( BulkBuffer->Num() > 0 )
+							int64 DataSize = BulkWriter->TotalSize();
+							if ( DataSize > 0 )
 							{
+								// Hand the written data to the write task instead of copying it
+								FLargeMemoryPtr DataPtr(BulkWriter->GetData());
+								BulkWriter->ReleaseOwnership();
+
 								AsyncWriteFile(MoveTemp(DataPtr), DataSize, *BulkFilename, FDateTime::MinValue(), false);
 							}
 						}
@@ -5371,11 +5374,11 @@ FSavePackageResultStruct UPackage::Save(UPackage* InOuter, UObject* Base, EObjec
 		{
 			if (bRequestStub)
 			{
-				return FSavePackageResultStruct(ESavePackageResult::GenerateStub, TotalPackageSizeUncompressed);
+				return FSavePackageResultStruct(ESavePackageResult::GenerateStub, TotalPackageSizeUncompressed, TotalBulkDataSize, SavedExportCount, SavedImportCount);
 			}
 			else
 			{
-				return FSavePackageResultStruct(ESavePackageResult::Success, TotalPackageSizeUncompressed);
+				return FSavePackageResultStruct(ESavePackageResult::Success, TotalPackageSizeUncompressed, TotalBulkDataSize, SavedExportCount, SavedImportCount);
 			}
 		}
 		else
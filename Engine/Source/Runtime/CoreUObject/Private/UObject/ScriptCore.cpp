@@ -28,6 +28,7 @@
 #include "UObject/ScriptMacros.h"
 #include "Misc/HotReloadInterface.h"
 #include "UObject/UObjectThreadContext.h"
+#include "HAL/IConsoleManager.h"
 
 DEFINE_LOG_CATEGORY(LogScriptFrame);
 DEFINE_LOG_CATEGORY_STATIC(LogScriptCore, Log, All);
@@ -56,6 +57,26 @@ COREUOBJECT_API int32 GCastDuplicate=0;
 
 COREUOBJECT_API int32 GMaximumScriptLoopIterations = 1000000;
 
+static int32 GScriptSkipLocalOnlyCallspace = 0;
+static FAutoConsoleVariableRef CVarScriptSkipLocalOnlyCallspace(
+	TEXT("bp.SkipLocalOnlyCallspace"),
+	GScriptSkipLocalOnlyCallspace,
+	TEXT("When set, functions that aren't replicated, authority only or cosmetic are called locally without asking the object for their callspace. Only enable this if no class overrides GetFunctionCallspace to route or absorb such functions."),
+	ECVF_Default);
+
+/** Without any of these flags the engine's GetFunctionCallspace implementations answer Local, game code may still override it to do otherwise */
+static const uint32 CallspaceFunctionFlags = FUNC_Net | FUNC_NetRequest | FUNC_NetResponse | FUNC_BlueprintAuthorityOnly | FUNC_BlueprintCosmetic;
+
+/** Resolves the callspace of a function, skipping the virtual call for the common local only case */
+static FORCEINLINE int32 GetScriptFunctionCallspace(UObject* Object, UFunction* Function, void* Parameters, FFrame* Stack)
+{
+	if (GScriptSkipLocalOnlyCallspace && (Function->FunctionFlags & CallspaceFunctionFlags) == 0)
+	{
+		return FunctionCallspace::Local;
+	}
+	return Object->GetFunctionCallspace(Function, Parameters, Stack);
+}
+
 #if !PLATFORM_DESKTOP
 	#define RECURSE_LIMIT 120
 #else
@@ -673,7 +694,7 @@ void UObject::CallFunction( FFrame& Stack, RESULT_DECL, UFunction* Function )
 	if (Function->FunctionFlags & FUNC_Native)
 	{
 		uint8* Buffer = (uint8*)FMemory_Alloca(Function->ParmsSize);
-		int32 FunctionCallspace = GetFunctionCallspace( Function, Buffer, &Stack );
+		int32 FunctionCallspace = GetScriptFunctionCallspace( this, Function, Buffer, &Stack );
 		uint8* SavedCode = NULL;
 		if (FunctionCallspace & FunctionCallspace::Remote)
 		{
@@ -743,7 +764,8 @@ void UObject::CallFunction( FFrame& Stack, RESULT_DECL, UFunction* Function )
 		UProperty* Property;
 
   		// Check to see if we need to handle a return value for this function.  We need to handle this first, because order of return parameters isn't always first.
- 		if( Function->HasAnyFunctionFlags(FUNC_HasOutParms) )
+		// ReturnValueOffset is only set when the function has a return value, so don't walk the parameters looking for one otherwise
+ 		if( Function->HasAnyFunctionFlags(FUNC_HasOutParms) && Function->ReturnValueOffset != MAX_uint16 )
  		{
  			// Iterate over the function parameters, searching for the ReturnValue
  			for( TFieldIterator<UProperty> ParmIt(Function); ParmIt; ++ParmIt )
@@ -897,7 +919,7 @@ void UObject::ProcessInternal( FFrame& Stack, RESULT_DECL )
 	FScopeCycleCounterUObject ContextScope(bShouldTrackObject ? this : nullptr);
 #endif
 
-	int32 FunctionCallspace = GetFunctionCallspace(Function, Stack.Locals, NULL);
+	int32 FunctionCallspace = GetScriptFunctionCallspace(this, Function, Stack.Locals, NULL);
 	if (FunctionCallspace & FunctionCallspace::Remote)
 	{
 		CallRemoteFunction(Function, Stack.Locals, Stack.OutParms, NULL);
@@ -1160,7 +1182,7 @@ void UObject::ProcessEvent( UFunction* Function, void* Parms )
 
 	if ((Function->FunctionFlags & FUNC_Native) != 0)
 	{
-		int32 FunctionCallspace = GetFunctionCallspace(Function, Parms, NULL);
+		int32 FunctionCallspace = GetScriptFunctionCallspace(this, Function, Parms, NULL);
 		if (FunctionCallspace & FunctionCallspace::Remote)
 		{
 			CallRemoteFunction(Function, Parms, NULL, NULL);
@@ -1240,15 +1262,27 @@ void UObject::ProcessEvent( UFunction* Function, void* Parms )
 		Frame = GetClass()->GetPersistentUberGraphFrame(this, Function);
 #endif
 		const bool bUsePersistentFrame = (NULL != Frame);
-		if (!bUsePersistentFrame)
+
+		// Native functions without out parameters or locals only ever read their parameters, so let them read straight from the caller's buffer
+		// instead of copying the parameters into a frame and the constructed ones back out again
+		const bool bUseCallerParms = !bUsePersistentFrame && Function->HasAnyFunctionFlags(FUNC_Native) && !Function->HasAnyFunctionFlags(FUNC_HasOutParms) && Function->PropertiesSize == Function->ParmsSize;
+		const bool bUseTemporaryFrame = !bUsePersistentFrame && !bUseCallerParms;
+		if (bUseCallerParms)
 		{
-			Frame = (uint8*)FMemory_Alloca(Function->PropertiesSize);
-			// zero the local property memory
-			FMemory::Memzero(Frame + Function->ParmsSize, Function->PropertiesSize - Function->ParmsSize);
+			Frame = (uint8*)Parms;
 		}
+		else
+		{
+			if (bUseTemporaryFrame)
+			{
+				Frame = (uint8*)FMemory_Alloca(Function->PropertiesSize);
+				// zero the local property memory
+				FMemory::Memzero(Frame + Function->ParmsSize, Function->PropertiesSize - Function->ParmsSize);
+			}
 
-		// initialize the parameter properties
-		FMemory::Memcpy(Frame, Parms, Function->ParmsSize);
+			// initialize the parameter properties
+			FMemory::Memcpy(Frame, Parms, Function->ParmsSize);
+		}
 
 		// Create a new local execution stack.
 		FFrame NewStack(this, Function, Frame, NULL, Function->Children);
@@ -1297,7 +1331,7 @@ void UObject::ProcessEvent( UFunction* Function, void* Parms )
 #endif
 		}
 
-		if (!bUsePersistentFrame)
+		if (bUseTemporaryFrame)
 		{
 			for (UProperty* LocalProp = Function->FirstPropertyToInit; LocalProp != NULL; LocalProp = (UProperty*)LocalProp->Next)
 			{
@@ -1310,7 +1344,7 @@ void UObject::ProcessEvent( UFunction* Function, void* Parms )
 		uint8* ReturnValueAddress = bHasReturnParam ? ((uint8*)Parms + Function->ReturnValueOffset) : nullptr;
 		Function->Invoke(this, NewStack, ReturnValueAddress);
 
-		if (!bUsePersistentFrame)
+		if (bUseTemporaryFrame)
 		{
 			// Destroy local variables except function parameters.!! see also UObject::CallFunctionByNameWithArguments
 			// also copy back constructed value parms here so the correct copy is destroyed when the event function returns
@@ -160,12 +160,11 @@ void FUObjectArray::AllocateUObjectIndex(UObjectBase* Object, bool bMergingThrea
 		{
 			// Make sure ObjFirstGCIndex is valid, otherwise we didn't close the disregard for GC set
 			check(ObjFirstGCIndex >= 0);
-#if THREADSAFE_UOBJECTS
-			FScopeLock ObjObjectsLock(&ObjObjectsCritical);
-#else
+#if !THREADSAFE_UOBJECTS
 			check(IsInGameThread());
 #endif
-			Index = ObjObjects.AddSingle();			
+			// No lock needed, the object table is preallocated and grows with an atomic increment
+			Index = ObjObjects.AddSingle();
 		}
 		check(Index >= ObjFirstGCIndex && Index > ObjLastNonGCIndex);
 	}
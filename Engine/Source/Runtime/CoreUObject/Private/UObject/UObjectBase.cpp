@@ -230,6 +230,11 @@ void UObjectBase::LowLevelRename(FName NewName,UObject *NewOuter)
 	STAT(StatID = TStatId();) // reset the stat id since this thing now has a different name
 	UnhashObject(this);
 	check(InternalIndex >= 0);
+	// renaming to None is part of destruction, which the path cache detects by itself
+	if (NewName != NAME_None)
+	{
+		InvalidateObjectPathCache();
+	}
 	NamePrivate = NewName;
 	if (NewOuter)
 	{
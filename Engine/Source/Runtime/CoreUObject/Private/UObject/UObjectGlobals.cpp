@@ -5,6 +5,7 @@
 =============================================================================*/
 
 #include "UObject/UObjectGlobals.h"
+#include "HAL/LowLevelMemTracker.h"
 #include "HAL/PlatformFilemanager.h"
 #include "HAL/FileManager.h"
 #include "Misc/ITransaction.h"
@@ -297,6 +298,17 @@ UObject* StaticFindObject( UClass* ObjectClass, UObject* InObjectPackage, const
 	}
 #endif	//#if !WITH_EDITOR
 
+	// Full paths are looked up in the path cache, resolving them means finding every outer along the way
+	const bool bFullPath = !ObjectPackage && !bAnyPackage;
+	if (bFullPath)
+	{
+		MatchingObject = FindObjectInPathCache(OrigInName, ObjectClass, ExactClass);
+		if (MatchingObject)
+		{
+			return MatchingObject;
+		}
+	}
+
 	FName ObjectName;
 
 	// Don't resolve the name if we're searching in any package
@@ -314,7 +326,12 @@ UObject* StaticFindObject( UClass* ObjectClass, UObject* InObjectPackage, const
 		ObjectName = FName(OrigInName, FNAME_Add);
 	}
 
-	return StaticFindObjectFast(ObjectClass, ObjectPackage, ObjectName, ExactClass, bAnyPackage);
+	MatchingObject = StaticFindObjectFast(ObjectClass, ObjectPackage, ObjectName, ExactClass, bAnyPackage);
+	if (bFullPath && MatchingObject)
+	{
+		AddObjectToPathCache(OrigInName, MatchingObject);
+	}
+	return MatchingObject;
 }
 
 //
@@ -2202,6 +2219,7 @@ UObject* StaticAllocateObject
 	bool* bOutRecycledSubobject
 )
 {
+	LLM_SCOPE(ELLMTag::UObject);
 	SCOPE_CYCLE_COUNTER(STAT_AllocateObject);
 	checkSlow(InOuter != INVALID_OBJECT); // not legal
 	check(!InClass || (InClass->ClassWithin && InClass->ClassConstructor));
@@ -8,6 +8,9 @@
 #include "UObject/Class.h"
 #include "UObject/Package.h"
 #include "Misc/PackageName.h"
+#include "Misc/ScopeLock.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/WeakObjectPtr.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogUObjectHash, Log, All);
 
@@ -18,6 +21,16 @@ DECLARE_CYCLE_STAT( TEXT( "FindObjectWithOuter" ), STAT_Hash_FindObjectWithOuter
 DECLARE_CYCLE_STAT( TEXT( "GetObjectsOfClass" ), STAT_Hash_GetObjectsOfClass, STATGROUP_UObjectHash );
 DECLARE_CYCLE_STAT( TEXT( "HashObject" ), STAT_Hash_HashObject, STATGROUP_UObjectHash );
 DECLARE_CYCLE_STAT( TEXT( "UnhashObject" ), STAT_Hash_UnhashObject, STATGROUP_UObjectHash );
+DECLARE_DWORD_COUNTER_STAT( TEXT( "PathCacheHits" ), STAT_Hash_PathCacheHits, STATGROUP_UObjectHash );
+DECLARE_DWORD_COUNTER_STAT( TEXT( "PathCacheMisses" ), STAT_Hash_PathCacheMisses, STATGROUP_UObjectHash );
+
+static int32 GObjectPathCacheSize = 16384;
+static FAutoConsoleVariableRef CVarObjectPathCacheSize(
+	TEXT("s.ObjectPathCacheSize"),
+	GObjectPathCacheSize,
+	TEXT("Maximum number of full object paths StaticFindObject remembers, the cache is emptied when it is full. 0 disables the cache."),
+	ECVF_Default
+	);
 
 #if UE_GC_TRACK_OBJ_AVAILABLE
 DEFINE_STAT( STAT_Hash_NumObjects );
@@ -238,25 +251,20 @@ struct FHashBucketIterator
 	}
 };
 
-class FUObjectHashTables
+/**
+ * Part of the name hash tables. Objects are spread over the shards by name hash so that finding and hashing
+ * objects with unrelated names from several threads doesn't contend on a single lock.
+ */
+class FUObjectHashShard
 {
 	FCriticalSection CriticalSection;
 
 public:
 
-	/** Hash sets */
+	/** Hash sets, each only contains the hashes that map to this shard */
 	TMap<int32, FHashBucket> Hash;
 	TMultiMap<int32, class UObjectBase*> HashOuter;
 
-	/** Map of object to their outers, used to avoid an object iterator to find such things. **/
-	TMap<UObjectBase*, FHashBucket> ObjectOuterMap;
-	TMap<UClass*, TSet<UObjectBase*> > ClassToObjectListMap;
-	TMap<UClass*, TSet<UClass*> > ClassToChildListMap;
-
-	FUObjectHashTables()
-	{
-	}
-
 	/** Checks if the Hash/Object pair exists in the FName hash table */
 	FORCEINLINE bool PairExistsInHash(int32 InHash, UObjectBase* Object)
 	{
@@ -299,6 +307,63 @@ public:
 	{
 		CriticalSection.Unlock();
 	}
+};
+
+class FUObjectHashTables
+{
+	FCriticalSection CriticalSection;
+
+public:
+
+	/** Number of name hash shards, must be a power of two */
+	enum { NumShards = 32 };
+
+	/** Name hash tables. Locking a shard doesn't lock the other tables, only LockUObjectHashTables locks everything */
+	FUObjectHashShard Shards[NumShards];
+
+	/** Map of object to their outers, used to avoid an object iterator to find such things. **/
+	TMap<UObjectBase*, FHashBucket> ObjectOuterMap;
+	TMap<UClass*, TSet<UObjectBase*> > ClassToObjectListMap;
+	TMap<UClass*, TSet<UClass*> > ClassToChildListMap;
+
+	FUObjectHashTables()
+	{
+	}
+
+	/** @return the shard holding the given name or name and outer hash */
+	FORCEINLINE FUObjectHashShard& GetShard(int32 InHash)
+	{
+		return Shards[InHash & (NumShards - 1)];
+	}
+
+	FORCEINLINE void Lock()
+	{
+		CriticalSection.Lock();
+	}
+
+	FORCEINLINE void Unlock()
+	{
+		CriticalSection.Unlock();
+	}
+
+	/** Locks the outer and class maps and every shard, shards are always locked after the maps and in order */
+	void LockAll()
+	{
+		Lock();
+		for (FUObjectHashShard& Shard : Shards)
+		{
+			Shard.Lock();
+		}
+	}
+
+	void UnlockAll()
+	{
+		for (int32 ShardIndex = NumShards - 1; ShardIndex >= 0; --ShardIndex)
+		{
+			Shards[ShardIndex].Unlock();
+		}
+		Unlock();
+	}
 
 	static FUObjectHashTables& Get()
 	{
@@ -307,13 +372,18 @@ public:
 	}
 };
 
-class FHashTableLock
+/**
+ * Scoped lock for either the outer and class maps (FUObjectHashTables) or a single name hash shard (FUObjectHashShard).
+ * A thread holding a shard lock must not lock anything else.
+ */
+template <typename TableType>
+class THashTableLock
 {
 #if THREADSAFE_UOBJECTS
-	FUObjectHashTables* Tables;
+	TableType* Tables;
 #endif
 public:
-	FORCEINLINE FHashTableLock(FUObjectHashTables& InTables)
+	FORCEINLINE THashTableLock(TableType& InTables)
 	{
 #if THREADSAFE_UOBJECTS
 		if (!(IsGarbageCollecting() && IsInGameThread()))
@@ -329,7 +399,7 @@ public:
 		check(IsInGameThread());
 #endif
 	}
-	FORCEINLINE ~FHashTableLock()
+	FORCEINLINE ~THashTableLock()
 	{
 #if THREADSAFE_UOBJECTS
 		if (Tables)
@@ -339,6 +409,8 @@ public:
 #endif
 	}
 };
+typedef THashTableLock<FUObjectHashTables> FHashTableLock;
+typedef THashTableLock<FUObjectHashShard> FHashShardLock;
 
 /**
  * Calculates the object's hash just using the object's name index
@@ -368,8 +440,9 @@ UObject* StaticFindObjectFastExplicitThreadSafe(FUObjectHashTables& ThreadHash,
 {
 	// Find an object with the specified name and (optional) class, in any package; if bAnyPackage is false, only matches top-level packages
 	int32 Hash = GetObjectHash(ObjectName);
-	FHashTableLock HashLock(ThreadHash);
-	FHashBucket* Bucket = ThreadHash.Hash.Find(Hash);
+	FUObjectHashShard& Shard = ThreadHash.GetShard(Hash);
+	FHashShardLock HashLock(Shard);
+	FHashBucket* Bucket = Shard.Hash.Find(Hash);
 	if (Bucket)
 	{
 		for (FHashBucketIterator It(*Bucket); It; ++It)
@@ -430,8 +503,9 @@ UObject* StaticFindObjectFastInternalThreadSafe(FUObjectHashTables& ThreadHash,
 	if (ObjectPackage != nullptr)
 	{
 		int32 Hash = GetObjectOuterHash(ObjectName, (PTRINT)ObjectPackage);
-		FHashTableLock HashLock(ThreadHash);
-		for (TMultiMap<int32, class UObjectBase*>::TConstKeyIterator HashIt(ThreadHash.HashOuter, Hash); HashIt; ++HashIt)
+		FUObjectHashShard& Shard = ThreadHash.GetShard(Hash);
+		FHashShardLock HashLock(Shard);
+		for (TMultiMap<int32, class UObjectBase*>::TConstKeyIterator HashIt(Shard.HashOuter, Hash); HashIt; ++HashIt)
 		{
 			UObject *Object = (UObject *)HashIt.Value();
 			if
@@ -477,9 +551,10 @@ UObject* StaticFindObjectFastInternalThreadSafe(FUObjectHashTables& ThreadHash,
 			ActualObjectName = FName(*ObjectNameString.Mid(DotIndex + 1));
 		}
 		const int32 Hash = GetObjectHash(ActualObjectName);
-		FHashTableLock HashLock(ThreadHash);
+		FUObjectHashShard& Shard = ThreadHash.GetShard(Hash);
+		FHashShardLock HashLock(Shard);
 
-		FHashBucket* Bucket = ThreadHash.Hash.Find(Hash);
+		FHashBucket* Bucket = Shard.Hash.Find(Hash);
 		if (Bucket)
 		{
 			for (FHashBucketIterator It(*Bucket); It; ++It)
@@ -893,16 +968,25 @@ void HashObject(UObjectBase* Object)
 		int32 Hash = 0;
 
 		auto& ThreadHash = FUObjectHashTables::Get();
-		FHashTableLock HashLock(ThreadHash);
 
-		Hash = GetObjectHash(Name);				
-		checkSlow(!ThreadHash.PairExistsInHash(Hash, Object));  // if it already exists, something is wrong with the external code
-		ThreadHash.AddToHash(Hash, Object);
+		// each table is locked on its own, never hold more than one of these locks at a time
+		Hash = GetObjectHash(Name);
+		{
+			FUObjectHashShard& Shard = ThreadHash.GetShard(Hash);
+			FHashShardLock ShardLock(Shard);
+			checkSlow(!Shard.PairExistsInHash(Hash, Object));  // if it already exists, something is wrong with the external code
+			Shard.AddToHash(Hash, Object);
+		}
 
 		Hash = GetObjectOuterHash( Name, (PTRINT)Object->GetOuter() );
-		checkSlow( !ThreadHash.HashOuter.FindPair( Hash, Object ) );  // if it already exists, something is wrong with the external code
-		ThreadHash.HashOuter.Add( Hash, Object );
+		{
+			FUObjectHashShard& Shard = ThreadHash.GetShard(Hash);
+			FHashShardLock ShardLock(Shard);
+			checkSlow( !Shard.HashOuter.FindPair( Hash, Object ) );  // if it already exists, something is wrong with the external code
+			Shard.HashOuter.Add( Hash, Object );
+		}
 
+		FHashTableLock HashLock(ThreadHash);
 		AddToOuterMap( ThreadHash, Object );
 		AddToClassMap( ThreadHash, Object );
 	}
@@ -924,16 +1008,24 @@ void UnhashObject(UObjectBase* Object)
 		int32 NumRemoved = 0;
 
 		auto& ThreadHash = FUObjectHashTables::Get();
-		FHashTableLock LockHash(ThreadHash);
 
 		Hash = GetObjectHash(Name);
-		NumRemoved = ThreadHash.RemoveFromHash(Hash, Object);
-		check(NumRemoved == 1); // must have existed, else something is wrong with the external code
+		{
+			FUObjectHashShard& Shard = ThreadHash.GetShard(Hash);
+			FHashShardLock ShardLock(Shard);
+			NumRemoved = Shard.RemoveFromHash(Hash, Object);
+			check(NumRemoved == 1); // must have existed, else something is wrong with the external code
+		}
 
 		Hash = GetObjectOuterHash( Name, (PTRINT)Object->GetOuter() );
-		NumRemoved = ThreadHash.HashOuter.RemoveSingle( Hash, Object );
-		check( NumRemoved == 1 ); // must have existed, else something is wrong with the external code
+		{
+			FUObjectHashShard& Shard = ThreadHash.GetShard(Hash);
+			FHashShardLock ShardLock(Shard);
+			NumRemoved = Shard.HashOuter.RemoveSingle( Hash, Object );
+			check( NumRemoved == 1 ); // must have existed, else something is wrong with the external code
+		}
 
+		FHashTableLock LockHash(ThreadHash);
 		RemoveFromOuterMap( ThreadHash, Object );
 		RemoveFromClassMap( ThreadHash, Object );
 	}
@@ -945,7 +1037,7 @@ void UnhashObject(UObjectBase* Object)
 void LockUObjectHashTables()
 {
 #if THREADSAFE_UOBJECTS
-	FUObjectHashTables::Get().Lock();
+	FUObjectHashTables::Get().LockAll();
 #else
 	check(IsInGameThread());
 #endif
@@ -957,58 +1049,182 @@ void LockUObjectHashTables()
 void UnlockUObjectHashTables()
 {
 #if THREADSAFE_UOBJECTS
-	FUObjectHashTables::Get().Unlock();
+	FUObjectHashTables::Get().UnlockAll();
 #else
 	check(IsInGameThread());
 #endif
 }
 
-void LogHashStatisticsInternal(TMultiMap<int32, UObjectBase*>& Hash, FOutputDevice& Ar, const bool bShowHashBucketCollisionInfo)
+/**
+ * Bounded cache of full object paths to the objects they resolved to. Entries hold weak pointers so destroyed objects
+ * never come back, and are tagged with the rename generation since a rename changes the paths of every inner.
+ * Entries are keyed by the case insensitive hash of the path, a path whose hash collides with another one simply misses.
+ */
+class FObjectPathCache
 {
-	TArray<int32> HashBuckets;
-	// Get the set of keys in use, which is the number of hash buckets
-	int32 SlotsInUse = Hash.GetKeys(HashBuckets);
+	struct FEntry
+	{
+		FString Path;
+		FWeakObjectPtr Object;
+		int32 Generation;
+	};
 
-	int32 TotalCollisions = 0;
-	int32 MinCollisions = MAX_int32;
-	int32 MaxCollisions = 0;
-	int32 MaxBin = 0;
+	FCriticalSection CriticalSection;
+	TMap<uint32, FEntry> Entries;
+	FThreadSafeCounter Generation;
 
-	// Dump how many slots are in use
-	Ar.Logf(TEXT("Slots in use %d"), SlotsInUse);
+public:
+
+	FThreadSafeCounter NumHits;
+	FThreadSafeCounter NumMisses;
+
+	/** Only canonical long package paths are cached, other forms like ini: or Class'Path' references are left to ResolveName */
+	static bool IsCacheablePath(const TCHAR* Path)
+	{
+		return Path[0] == TEXT('/') && FCString::Strchr(Path, TEXT('\'')) == nullptr;
+	}
 
-	// Work through each slot and figure out how many collisions
-	for (auto HashBucket : HashBuckets)
+	UObject* Find(const TCHAR* Path, UClass* ObjectClass, bool bExactClass)
 	{
-		int32 Collisions = 0;
+		UObject* Object = nullptr;
+		{
+			FScopeLock Lock(&CriticalSection);
+			const FEntry* Entry = Entries.Find(FCrc::Strihash_DEPRECATED(Path));
+			if (Entry && Entry->Generation == Generation.GetValue() && FCString::Stricmp(*Entry->Path, Path) == 0)
+			{
+				Object = Entry->Object.Get(true);
+			}
+		}
 
-		for (TMultiMap<int32, UObjectBase*>::TConstKeyIterator HashIt(Hash, HashBucket); HashIt; ++HashIt)
+		// same filtering as StaticFindObjectFast, objects that are being destroyed have already lost their name
+		EInternalObjectFlags ExclusionInternalFlags = EInternalObjectFlags::Unreachable;
+		if (!IsInAsyncLoadingThread())
 		{
-			// There's one collision per object in a given bucket
-			Collisions++;
+			ExclusionInternalFlags |= EInternalObjectFlags::AsyncLoading;
 		}
+		if (Object &&
+			!Object->HasAnyFlags(RF_NewerVersionExists | RF_BeginDestroyed) &&
+			!Object->HasAnyInternalFlags(ExclusionInternalFlags) &&
+			(ObjectClass == nullptr || (bExactClass ? Object->GetClass() == ObjectClass : Object->IsA(ObjectClass))))
+		{
+			NumHits.Increment();
+			INC_DWORD_STAT(STAT_Hash_PathCacheHits);
+			return Object;
+		}
+
+		NumMisses.Increment();
+		INC_DWORD_STAT(STAT_Hash_PathCacheMisses);
+		return nullptr;
+	}
 
-		// Keep the global stats
-		TotalCollisions += Collisions;
-		if (Collisions > MaxCollisions)
+	void Add(const TCHAR* Path, UObject* Object)
+	{
+		if (GObjectPathCacheSize <= 0)
 		{
-			MaxBin = HashBucket;
+			return;
 		}
-		MaxCollisions = FMath::Max<int32>(Collisions, MaxCollisions);
-		MinCollisions = FMath::Min<int32>(Collisions, MinCollisions);
 
-		if (bShowHashBucketCollisionInfo)
+		FScopeLock Lock(&CriticalSection);
+		if (Entries.Num() >= GObjectPathCacheSize)
 		{
-			// Now log the output
-			Ar.Logf(TEXT("\tSlot %d has %d collisions"), HashBucket, Collisions);
+			Entries.Reset();
 		}
+		FEntry& Entry = Entries.FindOrAdd(FCrc::Strihash_DEPRECATED(Path));
+		Entry.Path = Path;
+		Entry.Object = Object;
+		Entry.Generation = Generation.GetValue();
+	}
+
+	void Invalidate()
+	{
+		Generation.Increment();
+	}
+
+	int32 Num()
+	{
+		FScopeLock Lock(&CriticalSection);
+		return Entries.Num();
+	}
+
+	static FObjectPathCache& Get()
+	{
+		static FObjectPathCache Singleton;
+		return Singleton;
 	}
+};
+
+UObject* FindObjectInPathCache(const TCHAR* Path, UClass* ObjectClass, bool bExactClass)
+{
+	return GObjectPathCacheSize > 0 && FObjectPathCache::IsCacheablePath(Path) ? FObjectPathCache::Get().Find(Path, ObjectClass, bExactClass) : nullptr;
+}
+
+void AddObjectToPathCache(const TCHAR* Path, UObject* Object)
+{
+	if (FObjectPathCache::IsCacheablePath(Path))
+	{
+		FObjectPathCache::Get().Add(Path, Object);
+	}
+}
+
+void InvalidateObjectPathCache()
+{
+	FObjectPathCache::Get().Invalidate();
+}
+
+void LogHashOuterStatisticsInternal(FUObjectHashTables& Tables, FOutputDevice& Ar, const bool bShowHashBucketCollisionInfo)
+{
+	int32 SlotsInUse = 0;
+	int32 TotalCollisions = 0;
+	int32 MinCollisions = MAX_int32;
+	int32 MaxCollisions = 0;
+	int32 MaxBin = 0;
+	uint32 HashtableAllocatedSize = 0;
+
+	for (FUObjectHashShard& Shard : Tables.Shards)
+	{
+		TArray<int32> HashBuckets;
+		// Get the set of keys in use, which is the number of hash buckets
+		SlotsInUse += Shard.HashOuter.GetKeys(HashBuckets);
+
+		// Work through each slot and figure out how many collisions
+		for (auto HashBucket : HashBuckets)
+		{
+			int32 Collisions = 0;
+
+			for (TMultiMap<int32, UObjectBase*>::TConstKeyIterator HashIt(Shard.HashOuter, HashBucket); HashIt; ++HashIt)
+			{
+				// There's one collision per object in a given bucket
+				Collisions++;
+			}
+
+			// Keep the global stats
+			TotalCollisions += Collisions;
+			if (Collisions > MaxCollisions)
+			{
+				MaxBin = HashBucket;
+			}
+			MaxCollisions = FMath::Max<int32>(Collisions, MaxCollisions);
+			MinCollisions = FMath::Min<int32>(Collisions, MinCollisions);
+
+			if (bShowHashBucketCollisionInfo)
+			{
+				// Now log the output
+				Ar.Logf(TEXT("\tSlot %d has %d collisions"), HashBucket, Collisions);
+			}
+		}
+
+		// Calculate Hashtable size
+		HashtableAllocatedSize += Shard.HashOuter.GetAllocatedSize();
+	}
+
+	// Dump how many slots are in use
+	Ar.Logf(TEXT("Slots in use %d"), SlotsInUse);
 	Ar.Logf(TEXT(""));
 
 	// Dump the first 30 objects in the worst bin for inspection
 	Ar.Logf(TEXT("Worst hash bucket contains:"));
 	int32 Count = 0;
-	for (TMultiMap<int32, UObjectBase*>::TConstKeyIterator HashIt(Hash, MaxBin); HashIt && Count < 30; ++HashIt)
+	for (TMultiMap<int32, UObjectBase*>::TConstKeyIterator HashIt(Tables.GetShard(MaxBin).HashOuter, MaxBin); HashIt && Count < 30; ++HashIt)
 	{
 		UObject* Object = (UObject*)HashIt.Value();
 		Ar.Logf(TEXT("\tObject is %s (%s)"), *Object->GetName(), *Object->GetFullName());
@@ -1022,62 +1238,72 @@ void LogHashStatisticsInternal(TMultiMap<int32, UObjectBase*>& Hash, FOutputDevi
 		FMath::FloorToInt(((float)TotalCollisions / (float)SlotsInUse)),
 		MaxCollisions);
 
-	// Calculate Hashtable size
-	const uint32 HashtableAllocatedSize = Hash.GetAllocatedSize();
 	Ar.Logf(TEXT("Total memory allocated for Object Outer Hash: %u bytes."), HashtableAllocatedSize);
 }
 
-void LogHashStatisticsInternal(TMap<int32, FHashBucket>& Hash, FOutputDevice& Ar, const bool bShowHashBucketCollisionInfo)
+void LogHashStatisticsInternal(FUObjectHashTables& Tables, FOutputDevice& Ar, const bool bShowHashBucketCollisionInfo)
 {
-	TArray<int32> HashBuckets;
-	// Get the set of keys in use, which is the number of hash buckets
-	int32 SlotsInUse = Hash.Num();
-
+	int32 SlotsInUse = 0;
 	int32 TotalCollisions = 0;
 	int32 MinCollisions = MAX_int32;
 	int32 MaxCollisions = 0;
 	int32 MaxBin = 0;
 	int32 NumBucketsWithMoreThanOneItem = 0;
+	uint32 HashtableAllocatedSize = 0;
 
-	// Dump how many slots are in use
-	Ar.Logf(TEXT("Slots in use %d"), SlotsInUse);
-
-	// Work through each slot and figure out how many collisions
-	for (auto& HashPair : Hash)
+	for (FUObjectHashShard& Shard : Tables.Shards)
 	{
-		int32 Collisions = HashPair.Value.Num();
-		check(Collisions >= 0);
-		if (Collisions > 1)
-		{
-			NumBucketsWithMoreThanOneItem++;
-		}
+		// The number of keys in use is the number of hash buckets
+		SlotsInUse += Shard.Hash.Num();
 
-		// Keep the global stats
-		TotalCollisions += Collisions;
-		if (Collisions > MaxCollisions)
+		// Work through each slot and figure out how many collisions
+		for (auto& HashPair : Shard.Hash)
 		{
-			MaxBin = HashPair.Key;
-		}
-		MaxCollisions = FMath::Max<int32>(Collisions, MaxCollisions);
-		MinCollisions = FMath::Min<int32>(Collisions, MinCollisions);
+			int32 Collisions = HashPair.Value.Num();
+			check(Collisions >= 0);
+			if (Collisions > 1)
+			{
+				NumBucketsWithMoreThanOneItem++;
+			}
 
-		if (bShowHashBucketCollisionInfo)
-		{
-			// Now log the output
-			Ar.Logf(TEXT("\tSlot %d has %d collisions"), HashPair.Key, Collisions);
+			// Keep the global stats
+			TotalCollisions += Collisions;
+			if (Collisions > MaxCollisions)
+			{
+				MaxBin = HashPair.Key;
+			}
+			MaxCollisions = FMath::Max<int32>(Collisions, MaxCollisions);
+			MinCollisions = FMath::Min<int32>(Collisions, MinCollisions);
+
+			if (bShowHashBucketCollisionInfo)
+			{
+				// Now log the output
+				Ar.Logf(TEXT("\tSlot %d has %d collisions"), HashPair.Key, Collisions);
+			}
+
+			// Calculate the size of a all Allocations inside of the buckets (TSet Items)
+			HashtableAllocatedSize += HashPair.Value.GetItemsSize();
 		}
+
+		// Calculate Hashtable size
+		HashtableAllocatedSize += Shard.Hash.GetAllocatedSize();
 	}
+
+	// Dump how many slots are in use
+	Ar.Logf(TEXT("Slots in use %d"), SlotsInUse);
 	Ar.Logf(TEXT(""));
 
 	// Dump the first 30 objects in the worst bin for inspection
 	Ar.Logf(TEXT("Worst hash bucket contains:"));
 	int32 Count = 0;
-	FHashBucket& WorstBucket = Hash.FindChecked(MaxBin);
-	for (FHashBucketIterator It(WorstBucket); It; ++It)
+	if (FHashBucket* WorstBucket = Tables.GetShard(MaxBin).Hash.Find(MaxBin))
 	{
-		UObject* Object = (UObject*)*It;
-		Ar.Logf(TEXT("\tObject is %s (%s)"), *Object->GetName(), *Object->GetFullName());
-		Count++;
+		for (FHashBucketIterator It(*WorstBucket); It; ++It)
+		{
+			UObject* Object = (UObject*)*It;
+			Ar.Logf(TEXT("\tObject is %s (%s)"), *Object->GetName(), *Object->GetFullName());
+			Count++;
+		}
 	}
 	Ar.Logf(TEXT(""));
 
@@ -1089,14 +1315,16 @@ void LogHashStatisticsInternal(TMap<int32, FHashBucket>& Hash, FOutputDevice& Ar
 		NumBucketsWithMoreThanOneItem,
 		SlotsInUse);
 
-	// Calculate Hashtable size
-	uint32 HashtableAllocatedSize = Hash.GetAllocatedSize();
-	// Calculate the size of a all Allocations inside of the buckets (TSet Items)
-	for (auto& Pair : Hash)
-	{
-		HashtableAllocatedSize += Pair.Value.GetItemsSize();
-	}
 	Ar.Logf(TEXT("Total memory allocated for and by Object Hash: %u bytes."), HashtableAllocatedSize);
+	Ar.Logf(TEXT("Objects are spread over %d shards."), (int32)FUObjectHashTables::NumShards);
+
+	FObjectPathCache& PathCache = FObjectPathCache::Get();
+	const int32 NumPathLookups = PathCache.NumHits.GetValue() + PathCache.NumMisses.GetValue();
+	Ar.Logf(TEXT("Path cache: %d paths, %d hits, %d misses (%.1f%% hit rate)."),
+		PathCache.Num(),
+		PathCache.NumHits.GetValue(),
+		PathCache.NumMisses.GetValue(),
+		NumPathLookups ? 100.0f * PathCache.NumHits.GetValue() / NumPathLookups : 0.0f);
 }
 
 void LogHashStatistics(FOutputDevice& Ar, const bool bShowHashBucketCollisionInfo)
@@ -1104,8 +1332,9 @@ void LogHashStatistics(FOutputDevice& Ar, const bool bShowHashBucketCollisionInf
 	Ar.Logf(TEXT("Hash efficiency statistics for the Object Hash"));
 	Ar.Logf(TEXT("-------------------------------------------------"));
 	Ar.Logf(TEXT(""));
-	FHashTableLock HashLock(FUObjectHashTables::Get());
-	LogHashStatisticsInternal(FUObjectHashTables::Get().Hash, Ar, bShowHashBucketCollisionInfo);
+	LockUObjectHashTables();
+	LogHashStatisticsInternal(FUObjectHashTables::Get(), Ar, bShowHashBucketCollisionInfo);
+	UnlockUObjectHashTables();
 	Ar.Logf(TEXT(""));
 }
 
@@ -1114,8 +1343,8 @@ void LogHashOuterStatistics(FOutputDevice& Ar, const bool bShowHashBucketCollisi
 	Ar.Logf(TEXT("Hash efficiency statistics for the Outer Object Hash"));
 	Ar.Logf(TEXT("-------------------------------------------------"));
 	Ar.Logf(TEXT(""));
-	FHashTableLock HashLock(FUObjectHashTables::Get());
-	LogHashStatisticsInternal(FUObjectHashTables::Get().HashOuter, Ar, bShowHashBucketCollisionInfo);
+	LockUObjectHashTables();
+	LogHashOuterStatisticsInternal(FUObjectHashTables::Get(), Ar, bShowHashBucketCollisionInfo);
+	UnlockUObjectHashTables();
 	Ar.Logf(TEXT(""));
 }
-
@@ -0,0 +1,250 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	UnversionedPropertySerialization.cpp: Schema based property serialization for cooked packages.
+=============================================================================*/
+
+#include "CoreMinimal.h"
+#include "Misc/Crc.h"
+#include "UObject/Class.h"
+#include "UObject/UnrealType.h"
+#include "Serialization/SerializedPropertyScope.h"
+
+/**
+ * Compiled layout of a struct for unversioned property serialization. Every property element that exists in cooked builds
+ * gets a slot, and instances store a bitmask over the slots followed by the values of the slots that are set.
+ *
+ * Data is laid out as:
+ *	uint32	Schema hash, 0 if the tagged format follows instead
+ *	int32	Size of the mask and values, so data saved against a different schema can be skipped
+ *	uint8[]	Bitmask of the slots that are stored, (NumSlots + 7) / 8 bytes
+ *	...		Values of the stored slots, in slot order
+ */
+struct FUnversionedStructSchema
+{
+	struct FSlot
+	{
+		UProperty* Property;
+		int32 ArrayIndex;
+		/** Numeric values are stored as their raw bytes and can be copied straight into place */
+		bool bCanMemcpy;
+	};
+
+	TArray<FSlot> Slots;
+
+	/** Hash of the names, types and dimensions of the slots, never 0 */
+	uint32 Hash;
+
+	explicit FUnversionedStructSchema(const UStruct* Struct)
+		: Hash(0)
+	{
+		for (UProperty* Property = Struct->PropertyLink; Property; Property = Property->PropertyLinkNext)
+		{
+			// editor only properties don't exist in cooked builds so they can't be part of a schema shared with them,
+			// everything else is kept and whether it is stored is decided per instance like the tagged format does
+			if (Property->IsEditorOnlyProperty())
+			{
+				continue;
+			}
+
+			const UNumericProperty* NumericProperty = dynamic_cast<const UNumericProperty*>(Property);
+			const bool bCanMemcpy = NumericProperty && !NumericProperty->IsEnum();
+
+			Hash = FCrc::StrCrc32(*Property->GetName(), Hash);
+			Hash = FCrc::StrCrc32(*Property->GetID().ToString(), Hash);
+			Hash = FCrc::MemCrc32(&Property->ArrayDim, sizeof(Property->ArrayDim), Hash);
+			if (bCanMemcpy)
+			{
+				Hash = FCrc::MemCrc32(&Property->ElementSize, sizeof(Property->ElementSize), Hash);
+			}
+
+			for (int32 ArrayIndex = 0; ArrayIndex < Property->ArrayDim; ++ArrayIndex)
+			{
+				FSlot& Slot = Slots[Slots.AddUninitialized()];
+				Slot.Property = Property;
+				Slot.ArrayIndex = ArrayIndex;
+				Slot.bCanMemcpy = bCanMemcpy;
+			}
+		}
+
+		if (!Hash)
+		{
+			Hash = 1;
+		}
+	}
+};
+
+const FUnversionedStructSchema& UStruct::GetUnversionedSchema() const
+{
+	if (!UnversionedSchema)
+	{
+		// loading and saving can happen on several threads at once, the first schema to be published wins
+		FUnversionedStructSchema* NewSchema = new FUnversionedStructSchema(this);
+		if (FPlatformAtomics::InterlockedCompareExchangePointer((void**)&UnversionedSchema, NewSchema, nullptr) != nullptr)
+		{
+			delete NewSchema;
+		}
+	}
+	return *UnversionedSchema;
+}
+
+void UStruct::DestroyUnversionedSchema()
+{
+	delete UnversionedSchema;
+	UnversionedSchema = nullptr;
+}
+
+bool UStruct::SerializeUnversionedProperties(FArchive& Ar, uint8* Data, UStruct* DefaultsStruct, uint8* Defaults, const UObject* BreakRecursionIfFullyLoad) const
+{
+	if (!Ar.IsLoading() && !Ar.IsSaving())
+	{
+		return false;
+	}
+
+	const FUnversionedStructSchema& Schema = GetUnversionedSchema();
+	const int32 NumMaskBytes = (Schema.Slots.Num() + 7) / 8;
+	TArray<uint8, TInlineAllocator<64>> Mask;
+
+	if (Ar.IsLoading())
+	{
+		uint32 SchemaHash = 0;
+		Ar << SchemaHash;
+		if (!SchemaHash)
+		{
+			return false;
+		}
+
+		int32 PayloadSize = 0;
+		Ar << PayloadSize;
+		const int64 PayloadEnd = Ar.Tell() + PayloadSize;
+
+		if (SchemaHash != Schema.Hash)
+		{
+			// without tags there is no way to match the values up with the current properties
+			UE_LOG(LogClass, Warning, TEXT("Skipping unversioned properties of %s, the struct changed since %s was cooked. (Maybe recook?)"), *GetName(), *Ar.GetArchiveName());
+			Ar.Seek(PayloadEnd);
+			return true;
+		}
+
+#if WITH_EDITOR
+		if (BreakRecursionIfFullyLoad && BreakRecursionIfFullyLoad->HasAllFlags(RF_LoadCompleted))
+		{
+			Ar.Seek(PayloadEnd);
+			return true;
+		}
+#endif // WITH_EDITOR
+
+		Mask.AddUninitialized(NumMaskBytes);
+		Ar.Serialize(Mask.GetData(), NumMaskBytes);
+
+		const bool bCanMemcpy = !Ar.IsByteSwapping();
+		for (int32 SlotIndex = 0; SlotIndex < Schema.Slots.Num() && !Ar.IsError(); ++SlotIndex)
+		{
+			if (!(Mask[SlotIndex >> 3] & (1 << (SlotIndex & 7))))
+			{
+				continue;
+			}
+
+			const FUnversionedStructSchema::FSlot& Slot = Schema.Slots[SlotIndex];
+			uint8* DestAddress = Slot.Property->ContainerPtrToValuePtr<uint8>(Data, Slot.ArrayIndex);
+			if (Slot.bCanMemcpy && bCanMemcpy)
+			{
+				Ar.Serialize(DestAddress, Slot.Property->ElementSize);
+			}
+			else
+			{
+				uint8* DefaultsFromParent = Slot.Property->ContainerPtrToValuePtrForDefaults<uint8>(DefaultsStruct, Defaults, Slot.ArrayIndex);
+				FSerializedPropertyScope SerializedProperty(Ar, Slot.Property);
+				Slot.Property->SerializeItem(Ar, DestAddress, DefaultsFromParent);
+			}
+		}
+
+		if (Ar.Tell() != PayloadEnd)
+		{
+			UE_LOG(LogClass, Warning, TEXT("Unversioned properties of %s read %lld bytes instead of %d in %s."), *GetName(), Ar.Tell() - (PayloadEnd - PayloadSize), PayloadSize, *Ar.GetArchiveName());
+			Ar.Seek(PayloadEnd);
+		}
+	}
+	else
+	{
+		// custom property lists pick what to save per call, so they can't be expressed with the schema
+		uint32 SchemaHash = Ar.ArUseCustomPropertyList ? 0 : Schema.Hash;
+		Ar << SchemaHash;
+		if (!SchemaHash)
+		{
+			return false;
+		}
+
+		UScriptStruct* DefaultsScriptStruct = dynamic_cast<UScriptStruct*>(DefaultsStruct);
+		const bool bUseAtomicSerialization = DefaultsScriptStruct && DefaultsScriptStruct->ShouldSerializeAtomically(Ar);
+		const bool bSaveAll = !Ar.DoDelta() || Ar.IsTransacting() || (!Defaults && !dynamic_cast<const UClass*>(this));
+
+		// same filtering as the tagged format
+		Mask.AddZeroed(NumMaskBytes);
+		bool bAnyStored = false;
+		for (int32 SlotIndex = 0; SlotIndex < Schema.Slots.Num(); ++SlotIndex)
+		{
+			const FUnversionedStructSchema::FSlot& Slot = Schema.Slots[SlotIndex];
+			if (Slot.Property->ShouldSerializeValue(Ar))
+			{
+				const uint8* DataPtr = Slot.Property->ContainerPtrToValuePtr<uint8>(Data, Slot.ArrayIndex);
+				const uint8* DefaultValue = Slot.Property->ContainerPtrToValuePtrForDefaults<uint8>(DefaultsStruct, Defaults, Slot.ArrayIndex);
+				if (bSaveAll || !Slot.Property->Identical(DataPtr, DefaultValue, Ar.GetPortFlags()))
+				{
+					Mask[SlotIndex >> 3] |= 1 << (SlotIndex & 7);
+					bAnyStored = true;
+				}
+			}
+		}
+
+		// atomic structs store every property as soon as one of them differs
+		if (bUseAtomicSerialization && bAnyStored)
+		{
+			for (int32 SlotIndex = 0; SlotIndex < Schema.Slots.Num(); ++SlotIndex)
+			{
+				if (Schema.Slots[SlotIndex].Property->ShouldSerializeValue(Ar))
+				{
+					Mask[SlotIndex >> 3] |= 1 << (SlotIndex & 7);
+				}
+			}
+		}
+
+		// drop a zero here, will seek back and write the size once it is known
+		int32 PayloadSize = 0;
+		const int64 PayloadSizeOffset = Ar.Tell();
+		Ar << PayloadSize;
+		const int64 PayloadStart = Ar.Tell();
+
+		Ar.Serialize(Mask.GetData(), NumMaskBytes);
+
+		const bool bCanMemcpy = !Ar.IsByteSwapping();
+		for (int32 SlotIndex = 0; SlotIndex < Schema.Slots.Num(); ++SlotIndex)
+		{
+			if (!(Mask[SlotIndex >> 3] & (1 << (SlotIndex & 7))))
+			{
+				continue;
+			}
+
+			const FUnversionedStructSchema::FSlot& Slot = Schema.Slots[SlotIndex];
+			uint8* DataPtr = Slot.Property->ContainerPtrToValuePtr<uint8>(Data, Slot.ArrayIndex);
+			if (Slot.bCanMemcpy && bCanMemcpy)
+			{
+				Ar.Serialize(DataPtr, Slot.Property->ElementSize);
+			}
+			else
+			{
+				uint8* DefaultValue = bUseAtomicSerialization ? nullptr : Slot.Property->ContainerPtrToValuePtrForDefaults<uint8>(DefaultsStruct, Defaults, Slot.ArrayIndex);
+				FSerializedPropertyScope SerializedProperty(Ar, Slot.Property);
+				Slot.Property->SerializeItem(Ar, DataPtr, DefaultValue);
+			}
+		}
+
+		const int64 PayloadEnd = Ar.Tell();
+		PayloadSize = PayloadEnd - PayloadStart;
+		Ar.Seek(PayloadSizeOffset);
+		Ar << PayloadSize;
+		Ar.Seek(PayloadEnd);
+	}
+
+	return true;
+}
@@ -412,6 +412,11 @@ struct FAsyncPackage : FGCObject
 		return LinkerRoot;
 	}
 
+	FORCEINLINE FLinkerLoad* GetLinker() const
+	{
+		return Linker;
+	}
+
 	/** Returns true if the package has finished loading. */
 	FORCEINLINE bool HasFinishedLoading() const
 	{
@@ -659,6 +664,8 @@ public:
 	void EventDrivenCreateExport(int32 LocalExportIndex);
 	void StartPrecacheRequest();
 	void EventDrivenSerializeExport(int32 LocalExportIndex);
+	bool CanSerializeExportInParallel(int32 LocalExportIndex);
+	bool EventDrivenSerializeExportsInParallel();
 	int64 PrecacheRequestReady(IAsyncReadRequest * Req);
 	void MakeNextPrecacheRequestCurrent();
 	void FlushPrecacheBuffer();
@@ -6,6 +6,9 @@
 #include "UObject/WeakObjectPtr.h"
 #include "Async/Future.h"
 
+class IMappedFileHandle;
+class IMappedFileRegion;
+
 /**
  * Flags serialized with the bulk data.
  */
@@ -248,10 +251,18 @@ public:
 	/**
 	 * Returns whether the bulk data is currently loaded and resident in memory.
 	 *
-	 * @return true if bulk data is loaded, false otherwise
+	 * @return true if bulk data is loaded or memory mapped, false otherwise
 	 */
 	bool IsBulkDataLoaded() const;
 
+	/**
+	 * Returns whether read-only locks currently point straight into a memory mapping of the file
+	 * instead of an allocated copy of the payload.
+	 *
+	 * @return true if the payload is memory mapped, false otherwise
+	 */
+	bool IsBulkDataMemoryMapped() const { return MappedRegion != nullptr; }
+
 	/**
 	* Returns whether the bulk data asynchronous load has completed.
 	*
@@ -322,13 +333,16 @@ public:
 	/**
 	 * Locks the bulk data and returns a pointer to it.
 	 *
+	 * Uncompressed payloads stored in a separate file may be memory mapped by read-only locks instead of being
+	 * loaded, see s.MemoryMapBulkData. Memory returned by a read-only lock must never be written to.
+	 *
 	 * @param	LockFlags	Flags determining lock behavior
 	 */
 	void* Lock( uint32 LockFlags );
 
 	/**
 	 * Locks the bulk data and returns a read-only pointer to it.
-	 * This variant can be called on a const bulkdata
+	 * This variant can be called on a const bulkdata and may memory map the payload like Lock(LOCK_READ_ONLY).
 	 */
 	const void* LockReadOnly() const;
 
@@ -476,6 +490,15 @@ private:
 	/** Returns true if bulk data should be loaded asynchronously */
 	bool ShouldStreamBulkData();
 
+	/** Returns true if the payload can be memory mapped instead of being loaded */
+	bool CanMapBulkData() const;
+
+	/** Memory maps the payload if it isn't loaded yet and can be mapped, returns true if the payload is mapped */
+	bool MakeSureBulkDataIsMapped();
+
+	/** Releases the memory mapping of the payload, if any */
+	void UnmapBulkData();
+
 	/*-----------------------------------------------------------------------------
 		Member variables.
 	-----------------------------------------------------------------------------*/
@@ -499,6 +522,10 @@ private:
 	uint32				LockStatus;
 	/** Async helper for loading bulk data on a separate thread */
 	TFuture<bool> SerializeFuture;
+	/** Mapping of the file the payload is stored in, only set while the payload is memory mapped						*/
+	IMappedFileHandle*	MappedHandle;
+	/** Memory mapped payload, read-only locks point into this instead of BulkData										*/
+	IMappedFileRegion*	MappedRegion;
 
 protected:
 	/** name of the package file containing the bulkdata */
@@ -638,6 +665,10 @@ public:
 		}
 		Formats.Empty();
 	}
-	COREUOBJECT_API void Serialize(FArchive& Ar, UObject* Owner, const TArray<FName>* FormatsToSave = NULL, bool bSingleUse = true, uint32 InAlignment = DEFAULT_ALIGNMENT);
+	/**
+	 * @param bForceInline	When cooking, whether the payloads are stored inline with the export. Payloads stored out of line
+	 *						end up in the separate bulk data file, where read-only locks can memory map them instead of loading a copy.
+	 */
+	COREUOBJECT_API void Serialize(FArchive& Ar, UObject* Owner, const TArray<FName>* FormatsToSave = NULL, bool bSingleUse = true, uint32 InAlignment = DEFAULT_ALIGNMENT, bool bForceInline = true);
 };
 
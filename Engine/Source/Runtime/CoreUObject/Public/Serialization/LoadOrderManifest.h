@@ -0,0 +1,81 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * A package listed in a load order manifest.
+ */
+struct FLoadOrderManifestPackage
+{
+	/** Long package name. */
+	FName PackageName;
+	/** True if the package is stored as a map (.umap) instead of an asset (.uasset). */
+	bool bIsMap;
+	/** Size of the cooked package header file. */
+	int64 HeaderSize;
+	/** Size of the cooked export file (.uexp), 0 if the package doesn't have one. */
+	int64 ExportsSize;
+	/** Indices of the packages this package imports, they always come earlier in the manifest. */
+	TArray<int32> Dependencies;
+
+	FLoadOrderManifestPackage()
+		: bIsMap(false)
+		, HeaderSize(0)
+		, ExportsSize(0)
+	{
+	}
+
+	/**
+	 * Gets the files the package is stored in.
+	 *
+	 * @param OutHeaderFilename		The package header file.
+	 * @param OutExportsFilename	The export file.
+	 * @return false if the package name doesn't map to any root.
+	 */
+	COREUOBJECT_API bool GetFilenames(FString& OutHeaderFilename, FString& OutExportsFilename) const;
+
+	friend COREUOBJECT_API FArchive& operator<<(FArchive& Ar, FLoadOrderManifestPackage& Package);
+};
+
+/**
+ * Cooked list of every package a map hard depends on, in the order the loader would discover them.
+ * Written by the cooker next to each cooked map, so the async loading thread can start reading the whole
+ * set of packages before it has read any of their summaries or import tables.
+ */
+struct FLoadOrderManifest
+{
+	/** Packages in load order, dependencies come before the packages that import them and the map comes last. */
+	TArray<FLoadOrderManifestPackage> Packages;
+
+	/** Extension of load order manifest files. */
+	static COREUOBJECT_API const TCHAR* GetManifestExtension();
+
+	/**
+	 * Gets the filename of the manifest of a map.
+	 *
+	 * @param MapPackageName	Long package name of the map.
+	 * @param OutFilename		The filename of the manifest.
+	 * @return false if the package name doesn't map to any root.
+	 */
+	static COREUOBJECT_API bool TryGetManifestFilename(const FString& MapPackageName, FString& OutFilename);
+
+	/**
+	 * Loads a manifest.
+	 *
+	 * @param Filename	The manifest file.
+	 * @return true if the manifest was loaded, false if it doesn't exist or is out of date.
+	 */
+	COREUOBJECT_API bool Load(const TCHAR* Filename);
+
+	/**
+	 * Saves the manifest.
+	 *
+	 * @param Filename	The manifest file.
+	 * @return true if the manifest was saved.
+	 */
+	COREUOBJECT_API bool Save(const TCHAR* Filename);
+
+	friend COREUOBJECT_API FArchive& operator<<(FArchive& Ar, FLoadOrderManifest& Manifest);
+};
@@ -24,6 +24,7 @@ struct FFrame;
 struct FNetDeltaSerializeInfo;
 struct FObjectInstancingGraph;
 struct FPropertyTag;
+struct FUnversionedStructSchema;
 
 /*-----------------------------------------------------------------------------
 	Mirrors of mirror structures in Object.h. These are used by generated code 
@@ -282,6 +283,10 @@ public:
 	/** Array of object references embedded in script code. Mirrored for easy access by realtime garbage collection code */
 	TArray<UObject*> ScriptObjectReferences;
 
+private:
+	/** In memory only: Compiled layout used by unversioned property serialization, built on first use **/
+	mutable FUnversionedStructSchema* UnversionedSchema;
+
 public:
 	// Constructors.
 	UStruct( EStaticConstructor, int32 InSize, EObjectFlags InFlags );
@@ -334,6 +339,23 @@ public:
 
 	virtual void SerializeTaggedProperties( FArchive& Ar, uint8* Data, UStruct* DefaultsStruct, uint8* Defaults, const UObject* BreakRecursionIfFullyLoad=NULL) const;
 
+private:
+	/**
+	 * Serializes the properties in Data against the compiled schema of this struct, used by archives with FArchive::UseUnversionedPropertySerialization.
+	 * Only properties that differ from Defaults are stored, behind a bitmask over the schema.
+	 *
+	 * @return false if the data was saved in the tagged format instead and has to be serialized with tags
+	 */
+	bool SerializeUnversionedProperties(FArchive& Ar, uint8* Data, UStruct* DefaultsStruct, uint8* Defaults, const UObject* BreakRecursionIfFullyLoad) const;
+
+	/** @return the compiled schema used by unversioned property serialization */
+	const FUnversionedStructSchema& GetUnversionedSchema() const;
+
+	/** Frees the compiled schema, it is rebuilt the next time it is needed */
+	void DestroyUnversionedSchema();
+
+public:
+
 	/**
 	 * Initialize a struct over uninitialized memory. This may be done by calling the native constructor or individually initializing properties
 	 *
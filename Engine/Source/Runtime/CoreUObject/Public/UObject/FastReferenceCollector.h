@@ -266,6 +266,9 @@ private:
 
 	FCollectorTaskQueue TaskQueue;
 
+	/** Receives per class cost when set, see gc.ProfileCostByClass */
+	FGCCostByClassProfiler* CostProfiler;
+
 	/** Helper struct for stack based approach */
 	struct FStackEntry
 	{
@@ -283,10 +286,11 @@ private:
 
 public:
 	/** Default constructor, initializing all members. */
-	TFastReferenceCollector(ReferenceProcessorType& InReferenceProcessor, ArrayPoolType& InArrayPool)
+	TFastReferenceCollector(ReferenceProcessorType& InReferenceProcessor, ArrayPoolType& InArrayPool, FGCCostByClassProfiler* InCostProfiler = nullptr)
 		: ReferenceProcessor(InReferenceProcessor)
 		, ArrayPool(InArrayPool)
 		, TaskQueue(this, InArrayPool)
+		, CostProfiler(InCostProfiler)
 	{}
 
 	/**
@@ -378,6 +382,12 @@ private:
 		// it is necessary to have at least one extra item in the array memory block for the iffy prefetch code, below
 		ObjectsToSerialize.Reserve(ObjectsToSerialize.Num() + 1);
 
+#if ENABLE_GC_COST_BY_CLASS_PROFILING
+		// Cost is gathered per task and merged once at the end to keep the profiler lock out of the loop
+		const bool bProfileCostByClass = CostProfiler != nullptr;
+		TMap<UClass*, FGCClassCost> ClassCosts;
+#endif
+
 		// Keep serializing objects till we reach the end of the growing array at which point
 		// we are done.
 		int32 CurrentIndex = 0;
@@ -435,6 +445,11 @@ private:
 				// Keep track of token return count in separate integer as arrays need to fiddle with it.
 				int32 TokenReturnCount = 0;
 
+#if ENABLE_GC_COST_BY_CLASS_PROFILING
+				uint32 NumTokensProcessed = 0;
+				const uint32 ProfileStartCycles = bProfileCostByClass ? FPlatformTime::Cycles() : 0;
+#endif
+
 				// Parse the token stream.
 				while (true)
 				{
@@ -469,6 +484,9 @@ private:
 
 					TokenStreamIndex++;
 					FGCReferenceInfo ReferenceInfo = TokenStream->AccessReferenceInfo(ReferenceTokenStreamIndex);
+#if ENABLE_GC_COST_BY_CLASS_PROFILING
+					NumTokensProcessed++;
+#endif
 
 					switch(ReferenceInfo.Type)
 					{
@@ -597,6 +615,16 @@ private:
 EndLoop:
 				check(StackEntry == Stack.GetData());
 
+#if ENABLE_GC_COST_BY_CLASS_PROFILING
+				if (bProfileCostByClass)
+				{
+					FGCClassCost& ClassCost = ClassCosts.FindOrAdd(CurrentObject->GetClass());
+					ClassCost.NumObjects++;
+					ClassCost.NumTokens += NumTokensProcessed;
+					ClassCost.Cycles += FPlatformTime::Cycles() - ProfileStartCycles;
+				}
+#endif
+
 				if (bParallel && NewObjectsToSerialize.Num() >= MinDesiredObjectsPerSubTask)
 				{
 					// This will start queueing task with objects from the end of array until there's less objects than worth to queue
@@ -662,6 +690,13 @@ EndLoop:
 		ReferenceProcessor.LogDetailedStatsSummary();
 #endif
 
+#if ENABLE_GC_COST_BY_CLASS_PROFILING
+		if (bProfileCostByClass && ClassCosts.Num())
+		{
+			CostProfiler->Merge(ClassCosts);
+		}
+#endif
+
 		ArrayPool.ReturnToPool(&NewObjectsToSerializeArray);
 	}
 };
@@ -16,6 +16,8 @@
 
 #define	ENABLE_GC_DEBUG_OUTPUT					1
 #define PERF_DETAILED_PER_CLASS_GC_STATS				(LOOKING_FOR_PERF_ISSUES || 0) 
+/** Whether reachability analysis cost can be profiled per class at runtime with gc.ProfileCostByClass */
+#define ENABLE_GC_COST_BY_CLASS_PROFILING		!(UE_BUILD_SHIPPING || UE_BUILD_TEST)
 
 COREUOBJECT_API DECLARE_LOG_CATEGORY_EXTERN(LogGarbage, Warning, All);
 DECLARE_STATS_GROUP(TEXT("Garbage Collection"), STATGROUP_GC, STATCAT_Advanced);
@@ -489,6 +491,67 @@ protected:
 };
 
 /** Prevent GC from running in the current scope */
+/** Reachability analysis cost of all instances of a class */
+struct FGCClassCost
+{
+	FGCClassCost()
+		: NumObjects(0)
+		, NumTokens(0)
+		, Cycles(0)
+	{}
+
+	/** Number of instances visited */
+	uint64 NumObjects;
+	/** Number of reference tokens processed, tokens inside arrays of structs count once per element */
+	uint64 NumTokens;
+	/** Cycles spent processing the token streams of all instances */
+	uint64 Cycles;
+};
+
+/**
+ * Accumulates reachability analysis cost per class while gc.ProfileCostByClass is enabled.
+ * Results add up over collections until they are dumped with gc.DumpCostByClass.
+ */
+class COREUOBJECT_API FGCCostByClassProfiler
+{
+public:
+	FGCCostByClassProfiler()
+		: NumCollections(0)
+	{}
+
+	/** @return the profiler if gc.ProfileCostByClass is enabled, nullptr otherwise */
+	static FGCCostByClassProfiler* GetIfEnabled();
+
+	static FGCCostByClassProfiler& Get();
+
+	/** Counts a profiled reachability analysis pass */
+	void NotifyCollection();
+
+	/** Adds the cost recorded by a reference collector task, only called during GC so the classes are safe to access */
+	void Merge(const TMap<UClass*, FGCClassCost>& ClassCosts);
+
+	/**
+	 * Writes the recorded cost as CSV, most expensive classes first.
+	 *
+	 * @param Ar Output device receiving one line per class
+	 */
+	void DumpCsv(FOutputDevice& Ar);
+
+	/** Logs the most expensive classes */
+	void LogSummary(int32 NumClassesToLog);
+
+	/** Discards everything recorded so far */
+	void Reset();
+
+private:
+	/** Copies the recorded cost sorted by cycles */
+	void GetSortedCosts(TArray<TPair<FName, FGCClassCost>>& OutCosts, int32& OutNumCollections);
+
+	FCriticalSection CostsCritical;
+	TMap<FName, FGCClassCost> CostByClass;
+	int32 NumCollections;
+};
+
 class COREUOBJECT_API FGCScopeGuard
 {
 public:
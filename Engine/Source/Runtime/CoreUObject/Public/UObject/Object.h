@@ -389,6 +389,18 @@ public:
 		return false;
 	}
 
+	/**
+	* Called during event driven async load to determine if Serialize can be called on a worker thread, concurrently
+	* with other exports of the same package. Only return true if loading reads nothing but this object's own data and
+	* its object references: no bulk data, no lookups or creation of other objects and no changes to global state.
+	*
+	* @return	true if this object's Serialize is thread safe when loading
+	*/
+	virtual bool IsSerializeThreadSafe() const
+	{
+		return false;
+	}
+
 	/**
 	* Called during cooking. Must return all objects that will be Preload()ed when this is serialized at load time
 	*
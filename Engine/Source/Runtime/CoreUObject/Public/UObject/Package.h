@@ -48,10 +48,19 @@ struct FSavePackageResultStruct
 	/** Total size of all files written out, including bulk data */
 	int64 TotalFileSize;
 
+	/** Size of the bulk data written to separate files, included in TotalFileSize */
+	int64 BulkDataSize;
+
+	/** Number of exports and imports in the saved package */
+	int32 ExportCount;
+	int32 ImportCount;
+
 	/** Constructors, it will implicitly construct from the result enum */
-	FSavePackageResultStruct() : Result(ESavePackageResult::Error), TotalFileSize(0) {}
-	FSavePackageResultStruct(ESavePackageResult InResult) : Result(InResult), TotalFileSize(0) {}
-	FSavePackageResultStruct(ESavePackageResult InResult, int64 InTotalFileSize) : Result(InResult), TotalFileSize(InTotalFileSize) {}
+	FSavePackageResultStruct() : Result(ESavePackageResult::Error), TotalFileSize(0), BulkDataSize(0), ExportCount(0), ImportCount(0) {}
+	FSavePackageResultStruct(ESavePackageResult InResult) : Result(InResult), TotalFileSize(0), BulkDataSize(0), ExportCount(0), ImportCount(0) {}
+	FSavePackageResultStruct(ESavePackageResult InResult, int64 InTotalFileSize) : Result(InResult), TotalFileSize(InTotalFileSize), BulkDataSize(0), ExportCount(0), ImportCount(0) {}
+	FSavePackageResultStruct(ESavePackageResult InResult, int64 InTotalFileSize, int64 InBulkDataSize, int32 InExportCount, int32 InImportCount)
+		: Result(InResult), TotalFileSize(InTotalFileSize), BulkDataSize(InBulkDataSize), ExportCount(InExportCount), ImportCount(InImportCount) {}
 
 	bool operator==(const FSavePackageResultStruct& Other) const
 	{
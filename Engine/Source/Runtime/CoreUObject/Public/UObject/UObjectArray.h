@@ -239,24 +239,20 @@ public:
 		MaxElements = InMaxElements;
 	}
 
+	/** Adds an element to the end of the array, thread safe since the array never reallocates */
 	int32 AddSingle()
 	{
-		int32 Result = NumElements;
-		checkf(NumElements + 1 <= MaxElements, TEXT("Maximum number of UObjects (%d) exceeded, make sure you update MaxObjectsInGame/MaxObjectsInEditor in project settings."), MaxElements);
-		check(Result == NumElements);
-		++NumElements;
-		FPlatformMisc::MemoryBarrier();
+		const int32 Result = FPlatformAtomics::InterlockedIncrement(&NumElements) - 1;
+		checkf(Result < MaxElements, TEXT("Maximum number of UObjects (%d) exceeded, make sure you update MaxObjectsInGame/MaxObjectsInEditor in project settings."), MaxElements);
 		check(Objects[Result].Object == nullptr);
 		return Result;
 	}
 
+	/** Adds Count elements to the end of the array, thread safe like AddSingle. Returns the index of the last added element. */
 	int32 AddRange(int32 Count)
 	{
-		int32 Result = NumElements + Count - 1;
-		checkf(NumElements + Count <= MaxElements, TEXT("Maximum number of UObjects (%d) exceeded, make sure you update MaxObjectsInGame/MaxObjectsInEditor in project settings."), MaxElements);
-		check(Result == (NumElements + Count - 1));
-		NumElements += Count;
-		FPlatformMisc::MemoryBarrier();
+		const int32 Result = FPlatformAtomics::InterlockedAdd(&NumElements, Count) + Count - 1;
+		checkf(Result < MaxElements, TEXT("Maximum number of UObjects (%d) exceeded, make sure you update MaxObjectsInGame/MaxObjectsInEditor in project settings."), MaxElements);
 		check(Objects[Result].Object == nullptr);
 		return Result;
 	}
@@ -429,6 +429,27 @@ COREUOBJECT_API bool IsIncrementalPurgePending();
  */
 COREUOBJECT_API void IncrementalPurgeGarbage( bool bUseTimeLimit, float TimeLimit = 0.002 );
 
+/**
+ * Performs periodic garbage collection like TryCollectGarbage, but if gc.AllowIncrementalReachability is enabled the reachability
+ * analysis is spread over several calls, each spending roughly TimeLimit marking reachable objects. Unreachable objects
+ * are unhashed and purged by the call that finishes the analysis, which processes all reachable objects again to find
+ * references stored while the analysis was pending. Otherwise, if gc.GenerationalGC is enabled, this may be a minor
+ * collection that only collects objects which haven't survived gc.GenerationalPromotionAge collections yet.
+ *
+ * @param	KeepFlags			objects with those flags will be kept regardless of being referenced or not
+ * @param	TimeLimit			soft time limit for marking reachable objects in this call
+ * @param	bPerformFullPurge	if true, perform a full purge after the mark pass
+ * @return	true if garbage collection has finished in this call
+ */
+COREUOBJECT_API bool TryCollectGarbageIncrementally(EObjectFlags KeepFlags, float TimeLimit = 0.002, bool bPerformFullPurge = false);
+
+/**
+ * Returns whether an incremental reachability analysis started by TryCollectGarbageIncrementally is pending.
+ *
+ * @return	true if TryCollectGarbageIncrementally needs to be called again to finish garbage collection, false otherwise.
+ */
+COREUOBJECT_API bool IsIncrementalReachabilityAnalysisPending();
+
 /**
  * Create a unique name by combining a base name and an arbitrary number string.
  * The object name returned is guaranteed not to exist.
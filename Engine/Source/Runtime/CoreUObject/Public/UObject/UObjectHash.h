@@ -117,6 +117,31 @@ void HashObject(class UObjectBase* Object);
  */
 void UnhashObject(class UObjectBase* Object);
 
+/**
+ * Looks up an object by full path in the path cache used by StaticFindObject.
+ * Only canonical long package paths are cached, objects that are unreachable or, outside of the async loading thread, still loading are never returned.
+ *
+ * @param	Path			Full path of the object, as passed to StaticFindObject without an outer
+ * @param	ObjectClass		if not NULL, the object must be of this class
+ * @param	bExactClass		Whether to require an exact match with the passed in class
+ * @return	the cached object, or NULL if the path isn't cached and needs to be resolved
+ */
+UObject* FindObjectInPathCache(const TCHAR* Path, UClass* ObjectClass, bool bExactClass);
+
+/**
+ * Remembers the object a full path resolved to, see FindObjectInPathCache.
+ *
+ * @param	Path			Full path of the object
+ * @param	Object			The object the path resolved to
+ */
+void AddObjectToPathCache(const TCHAR* Path, UObject* Object);
+
+/**
+ * Invalidates every cached path, called when objects are renamed since that changes the paths of all of their inners.
+ * Destroyed objects don't need this, the cache only holds weak pointers.
+ */
+void InvalidateObjectPathCache();
+
 /**
  * Logs out information about the object hash for debug purposes
  *
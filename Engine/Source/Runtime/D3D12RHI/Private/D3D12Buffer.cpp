@@ -33,6 +33,9 @@ template FD3D12StructuredBuffer* FD3D12Adapter::CreateRHIBuffer<FD3D12Structured
 	FRHIResourceCreateInfo& CreateInfo,
 	bool SkipCreate);
 
+template FD3D12VertexBuffer* FD3D12DynamicRHI::CreateBufferAsync<FD3D12VertexBuffer>(const D3D12_RESOURCE_DESC& Desc, uint32 Alignment, uint32 Stride, uint32 Size, uint32 InUsage, FRHIResourceCreateInfo& CreateInfo);
+template FD3D12IndexBuffer* FD3D12DynamicRHI::CreateBufferAsync<FD3D12IndexBuffer>(const D3D12_RESOURCE_DESC& Desc, uint32 Alignment, uint32 Stride, uint32 Size, uint32 InUsage, FRHIResourceCreateInfo& CreateInfo);
+
 struct FRHICommandUpdateBuffer : public FRHICommand<FRHICommandUpdateBuffer>
 {
 	FD3D12ResourceLocation Source;
@@ -196,6 +199,80 @@ BufferType* FD3D12Adapter::CreateRHIBuffer(FRHICommandListImmediate* RHICmdList,
 	return BufferOut;
 }
 
+template<class BufferType>
+BufferType* FD3D12DynamicRHI::CreateBufferAsync(const D3D12_RESOURCE_DESC& InDesc, uint32 Alignment, uint32 Stride, uint32 Size, uint32 InUsage, FRHIResourceCreateInfo& CreateInfo)
+{
+	check(GRHISupportsAsyncBufferCreation);
+
+	// Dynamic buffers live in the upload heap the rendering thread allocates from, and unordered access buffers need state tracking
+	check((InUsage & (BUF_AnyDynamic | BUF_UnorderedAccess)) == 0);
+	check(Size > 0);
+
+	FD3D12Adapter& Adapter = GetAdapter();
+	BufferType* BufferOut = Adapter.CreateLinkedObject<BufferType>([&](FD3D12Device* Device)
+	{
+		BufferType* NewBuffer = new BufferType(Device, Stride, Size, InUsage);
+		NewBuffer->BufferAlignment = Alignment;
+
+		// Pooled default buffers are created in GENERIC_READ, which the copy queue can't write to. A buffer created in COMMON can be
+		// written by the copy queue and is implicitly promoted to the read states it is used in afterwards.
+		const GPUNodeMask Node = Device->GetNodeMask();
+		const D3D12_HEAP_PROPERTIES HeapProps = CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_DEFAULT, Node, Node);
+
+		FD3D12Resource* Resource = nullptr;
+		VERIFYD3D12RESULT(Adapter.CreateCommittedResource(InDesc, HeapProps, D3D12_RESOURCE_STATE_COMMON, nullptr, &Resource));
+		SetName(Resource, L"Async Default Buffer");
+
+		NewBuffer->ResourceLocation.AsStandAlone(Resource, Size);
+		return NewBuffer;
+	});
+
+	if (CreateInfo.ResourceArray)
+	{
+		check(Size == CreateInfo.ResourceArray->GetResourceDataSize());
+
+		FD3D12FastAllocator& FastAllocator = GetHelperThreadDynamicUploadHeapAllocator();
+		FD3D12ResourceLocation SrcResourceLoc(FastAllocator.GetParentDevice());
+		void* pData = FastAllocator.Allocate<FD3D12ScopeLock>(Size, 4UL, &SrcResourceLoc);
+		check(pData);
+		FMemory::Memcpy(pData, CreateInfo.ResourceArray->GetResourceData(), Size);
+
+		BufferType* CurrentBuffer = BufferOut;
+		while (CurrentBuffer != nullptr)
+		{
+			FD3D12Device* Device = CurrentBuffer->GetParentDevice();
+			FD3D12Resource* Destination = CurrentBuffer->ResourceLocation.GetResource();
+
+			FD3D12CommandAllocatorManager& CommandAllocatorManager = Device->GetTextureStreamingCommandAllocatorManager();
+			FD3D12CommandAllocator* CurrentCommandAllocator = CommandAllocatorManager.ObtainCommandAllocator();
+			FD3D12CommandListHandle hCopyCommandList = Device->GetCopyCommandListManager().ObtainCommandList(*CurrentCommandAllocator);
+			hCopyCommandList.SetCurrentOwningContext(&Device->GetDefaultCommandContext());
+
+			hCopyCommandList.GetCurrentOwningContext()->numCopies++;
+			hCopyCommandList->CopyBufferRegion(
+				Destination->GetResource(),
+				CurrentBuffer->ResourceLocation.GetOffsetFromBaseOfResource(),
+				SrcResourceLoc.GetResource()->GetResource(),
+				SrcResourceLoc.GetOffsetFromBaseOfResource(), Size);
+
+			hCopyCommandList.UpdateResidency(Destination);
+
+			// Wait for the copy so the buffer can be used on any queue once it's returned
+			hCopyCommandList.Close();
+			Device->GetCopyCommandListManager().ExecuteCommandList(hCopyCommandList, true);
+
+			CommandAllocatorManager.ReleaseCommandAllocator(CurrentCommandAllocator);
+
+			CurrentBuffer = CurrentBuffer->GetNextObject();
+		}
+
+		// Discard the resource array's contents.
+		CreateInfo.ResourceArray->Discard();
+	}
+
+	return BufferOut;
+}
+
 template<class BufferType>
 void* FD3D12DynamicRHI::LockBuffer(FRHICommandListImmediate* RHICmdList, BufferType* Buffer, uint32 Offset, uint32 Size, EResourceLockMode LockMode)
 {
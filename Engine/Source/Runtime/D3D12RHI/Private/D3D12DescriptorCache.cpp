@@ -576,11 +576,11 @@ void FD3D12DescriptorCache::SetSRVs(FD3D12ShaderResourceViewCache& Cache, const
 	HeapSlot += SlotsNeeded;
 
 	D3D12_CPU_DESCRIPTOR_HANDLE DestDescriptor = CurrentViewHeap->GetCPUSlotHandle(FirstSlotIndex);
-	const uint64 DescriptorSize = CurrentViewHeap->GetDescriptorSize();
+	D3D12_CPU_DESCRIPTOR_HANDLE SrcDescriptors[MAX_SRVS];
 
 	for (uint32 SlotIndex = 0; SlotIndex < SlotsNeeded; SlotIndex++)
 	{
-		CD3DX12_CPU_DESCRIPTOR_HANDLE SrcDescriptor;
+		D3D12_CPU_DESCRIPTOR_HANDLE& SrcDescriptor = SrcDescriptors[SlotIndex];
 
 		if (SRVs[SlotIndex] != nullptr)
 		{
@@ -603,15 +603,17 @@ void FD3D12DescriptorCache::SetSRVs(FD3D12ShaderResourceViewCache& Cache, const
 		}
 		check(SrcDescriptor.ptr != 0);
 
-		Device->CopyDescriptorsSimple(1, DestDescriptor, SrcDescriptor, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-
-		DestDescriptor.ptr += DescriptorSize;
-
 		FD3D12ShaderResourceViewCache::CleanSlot(CurrentDirtySlotMask, SlotIndex);
 	}
 
 	check((CurrentDirtySlotMask & SlotsNeededMask) == 0);	// Check all slots that needed to be set, were set.
 
+	// Gather the descriptors from the offline heaps to the online heap, in one call rather than one per slot
+	Device->CopyDescriptors(
+		1, &DestDescriptor, &SlotsNeeded,
+		SlotsNeeded, SrcDescriptors, nullptr /* sizes */,
+		D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+
 	const D3D12_GPU_DESCRIPTOR_HANDLE BindDescriptor = CurrentViewHeap->GetGPUSlotHandle(FirstSlotIndex);
 
 	if (ShaderStage == SF_Compute)
@@ -664,31 +666,34 @@ void FD3D12DescriptorCache::SetConstantBuffers(FD3D12ConstantBufferCache& Cache,
 	HeapSlot += SlotsNeeded;
 
 	D3D12_CPU_DESCRIPTOR_HANDLE DestDescriptor = CurrentViewHeap->GetCPUSlotHandle(FirstSlotIndex);
-	const uint32 DescriptorSize = CurrentViewHeap->GetDescriptorSize();
+	D3D12_CPU_DESCRIPTOR_HANDLE SrcDescriptors[MAX_CBS];
 
-	//Device->CopyDescriptors(1, &DestDescriptor, &DescriptorSize, SlotsNeeded, CBVHandles, SrcSizes, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
 	for (uint32 SlotIndex = 0; SlotIndex < SlotsNeeded; SlotIndex++)
 	{
 		if (CBVHandles[SlotIndex].ptr != 0)
 		{
-			Device->CopyDescriptorsSimple(1, DestDescriptor, CBVHandles[SlotIndex], D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+			SrcDescriptors[SlotIndex] = CBVHandles[SlotIndex];
 
 			// Update residency.
 			CommandList.UpdateResidency(Cache.ResidencyHandles[ShaderStage][SlotIndex]);
 		}
 		else
 		{
-			Device->CopyDescriptorsSimple(1, DestDescriptor, pNullCBV->OfflineDescriptorHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+			SrcDescriptors[SlotIndex] = pNullCBV->OfflineDescriptorHandle;
 		}
 
-		DestDescriptor.ptr += DescriptorSize;
-
 		// Clear the dirty bit.
 		FD3D12ConstantBufferCache::CleanSlot(CurrentDirtySlotMask, SlotIndex);
 	}
 
 	check((CurrentDirtySlotMask & SlotsNeededMask) == 0);	// Check all slots that needed to be set, were set.
 
+	// Gather the descriptors from the offline heaps to the online heap, in one call rather than one per slot
+	Device->CopyDescriptors(
+		1, &DestDescriptor, &SlotsNeeded,
+		SlotsNeeded, SrcDescriptors, nullptr /* sizes */,
+		D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+
 	const D3D12_GPU_DESCRIPTOR_HANDLE BindDescriptor = CurrentViewHeap->GetGPUSlotHandle(FirstSlotIndex);
 
 	if (ShaderStage == SF_Compute)
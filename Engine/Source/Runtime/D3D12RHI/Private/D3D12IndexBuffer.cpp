@@ -46,6 +46,18 @@ FIndexBufferRHIRef FD3D12DynamicRHI::RHICreateIndexBuffer(uint32 Stride, uint32
 	return Buffer;
 }
 
+FIndexBufferRHIRef FD3D12DynamicRHI::RHIAsyncCreateIndexBuffer(uint32 Stride, uint32 Size, uint32 InUsage, FRHIResourceCreateInfo& CreateInfo)
+{
+	const D3D12_RESOURCE_DESC Desc = CreateIndexBufferResourceDesc(Size, InUsage);
+	const uint32 Alignment = 4;
+
+	FD3D12IndexBuffer* Buffer = CreateBufferAsync<FD3D12IndexBuffer>(Desc, Alignment, Stride, Size, InUsage, CreateInfo);
+
+	UpdateBufferStats(&Buffer->ResourceLocation, true, D3D12_BUFFER_TYPE_INDEX);
+
+	return Buffer;
+}
+
 void* FD3D12DynamicRHI::RHILockIndexBuffer(FIndexBufferRHIParamRef IndexBufferRHI, uint32 Offset, uint32 Size, EResourceLockMode LockMode)
 {
 	return LockBuffer(nullptr, FD3D12DynamicRHI::ResourceCast(IndexBufferRHI), Offset, Size, LockMode);
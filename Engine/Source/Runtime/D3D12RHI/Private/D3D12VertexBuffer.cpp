@@ -64,6 +64,18 @@ FVertexBufferRHIRef FD3D12DynamicRHI::RHICreateVertexBuffer(uint32 Size, uint32
 	return Buffer;
 }
 
+FVertexBufferRHIRef FD3D12DynamicRHI::RHIAsyncCreateVertexBuffer(uint32 Size, uint32 InUsage, FRHIResourceCreateInfo& CreateInfo)
+{
+	const D3D12_RESOURCE_DESC Desc = CreateVertexBufferResourceDesc(Size, InUsage);
+	const uint32 Alignment = 4;
+
+	FD3D12VertexBuffer* Buffer = CreateBufferAsync<FD3D12VertexBuffer>(Desc, Alignment, 0, Size, InUsage, CreateInfo);
+
+	UpdateBufferStats(&Buffer->ResourceLocation, true, D3D12_BUFFER_TYPE_VERTEX);
+
+	return Buffer;
+}
+
 void* FD3D12DynamicRHI::RHILockVertexBuffer(FVertexBufferRHIParamRef VertexBufferRHI, uint32 Offset, uint32 Size, EResourceLockMode LockMode)
 {
 	return LockBuffer(nullptr, FD3D12DynamicRHI::ResourceCast(VertexBufferRHI), Offset, Size, LockMode);
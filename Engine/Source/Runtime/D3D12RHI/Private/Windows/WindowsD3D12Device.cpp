@@ -509,6 +509,7 @@ void FD3D12DynamicRHI::Init()
 
 	// Multi-threaded resource creation is always supported in DX12, but allow users to disable it.
 	GRHISupportsAsyncTextureCreation = D3D12RHI_ShouldAllowAsyncResourceCreation();
+	GRHISupportsAsyncBufferCreation = GRHISupportsAsyncTextureCreation;
 	if (GRHISupportsAsyncTextureCreation)
 	{
 		UE_LOG(LogD3D12RHI, Log, TEXT("Async texture creation enabled"));
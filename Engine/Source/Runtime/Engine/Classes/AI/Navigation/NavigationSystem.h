@@ -343,6 +343,9 @@ public:
 	void SetGeometryGatheringMode(ENavDataGatheringModeConfig NewMode);
 
 	FORCEINLINE bool IsActiveTilesGenerationEnabled() const{ return bGenerateNavigationOnlyAroundNavigationInvokers; }
+
+	/** Appends locations of all registered navigation invokers, used to build tiles near them first */
+	void GetInvokerLocations(TArray<FVector>& OutLocations) const;
 	
 	/** delegate type for events that dirty the navigation data ( Params: const FBox& DirtyBounds ) */
 	DECLARE_MULTICAST_DELEGATE_OneParam(FOnNavigationDirty, const FBox&);
@@ -970,8 +973,9 @@ private:
 	 *	In the process PathFindingQueries gets copied. */
 	void TriggerAsyncQueries(TArray<FAsyncPathFindingQuery>& PathFindingQueries);
 
-	/** Processes pathfinding requests given in PathFindingQueries.*/
-	void PerformAsyncQueries(TArray<FAsyncPathFindingQuery> PathFindingQueries);
+	/** Processes pathfinding requests given in PathFindingQueries, spread over task threads in batches.
+	 *	@param TriggerTime	FPlatformTime::Seconds() when the requests were handed over, for latency stats */
+	void PerformAsyncQueries(TArray<FAsyncPathFindingQuery> PathFindingQueries, double TriggerTime = 0.0);
 
 	/** */
 	void DestroyNavOctree();
@@ -552,6 +552,10 @@ class ENGINE_API ARecastNavMesh : public ANavigationData
 	UPROPERTY(EditAnywhere, Category = Generation, config, meta = (ClampMin = "0", UIMin = "0"), AdvancedDisplay)
 	int32 MaxSimultaneousTileGenerationJobsCount;
 
+	/** Game thread time in milliseconds spent each frame setting up dirty tile rebuilds, 0 for no limit. At least one tile is set up every frame. */
+	UPROPERTY(EditAnywhere, Category = Generation, config, meta = (ClampMin = "0", UIMin = "0"), AdvancedDisplay)
+	float TileGenerationSetupBudgetMs;
+
 	/** Absolute hard limit to number of navmesh tiles. Be very, very careful while modifying it while
 	 *	having big maps with navmesh. A single, empty tile takes 176 bytes and empty tiles are
 	 *	allocated up front (subject to change, but that's where it's at now)
@@ -860,6 +864,7 @@ public:
 	void RecreateDefaultFilter();
 
 	int32 GetMaxSimultaneousTileGenerationJobsCount() const { return MaxSimultaneousTileGenerationJobsCount; }
+	float GetTileGenerationSetupBudgetMs() const { return TileGenerationSetupBudgetMs; }
 	void SetMaxSimultaneousTileGenerationJobsCount(int32 NewJobsCountLimit);
 
 	/** Returns query extent including adjustments for voxelization error compensation */
@@ -974,6 +979,8 @@ public:
 	
 	// @todo docuement
 	static FPathFindingResult FindPath(const FNavAgentProperties& AgentProperties, const FPathFindingQuery& Query);
+	/** Finds path on cluster graph first and refines it only within found cluster corridor, meant for long distance queries */
+	static FPathFindingResult FindHierarchicalPath(const FNavAgentProperties& AgentProperties, const FPathFindingQuery& Query);
 	static bool TestPath(const FNavAgentProperties& AgentProperties, const FPathFindingQuery& Query, int32* NumVisitedNodes);
 	static bool TestHierarchicalPath(const FNavAgentProperties& AgentProperties, const FPathFindingQuery& Query, int32* NumVisitedNodes);
 	static bool NavMeshRaycast(const ANavigationData* Self, const FVector& RayStart, const FVector& RayEnd, FVector& HitLocation, FSharedConstNavQueryFilter QueryFilter, const UObject* Querier, FRaycastResult& Result);
@@ -1045,6 +1052,9 @@ protected:
 	FPImplRecastNavMesh* GetRecastNavMeshImpl() { return RecastNavMeshImpl; }
 	const FPImplRecastNavMesh* GetRecastNavMeshImpl() const { return RecastNavMeshImpl; }
 
+	/** Shared implementation of FindPath and FindHierarchicalPath */
+	static FPathFindingResult FindPathInternal(const FPathFindingQuery& Query, const bool bUseClusterCorridor);
+
 private:
 	/** NavMesh versioning. */
 	uint32 NavMeshVersion;
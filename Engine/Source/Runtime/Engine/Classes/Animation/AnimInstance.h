@@ -958,6 +958,15 @@ public:
 	/** Perform evaluation. Can be called from worker threads. */
 	void ParallelEvaluateAnimation(bool bForceRefPose, const USkeletalMesh* InSkeletalMesh, TArray<FTransform>& OutBoneSpaceTransforms, FBlendedHeapCurve& OutCurve);
 
+	/**
+	 * Hashes everything the pose evaluated this frame depends on, so instances in the same state can share one evaluation
+	 * (see USkeletalMeshComponent::bSharePoseEvaluation). Override in instances whose state can be described cheaply, e.g.
+	 * the anim class, the active state machine state, the playing assets and the relevant parameters. Called from worker threads.
+	 * @param	TimeTolerance	Playback times within this many seconds of each other may hash the same
+	 * @return	false if the pose can't be shared this frame
+	 */
+	virtual bool GetSharedPoseStateHash(float TimeTolerance, uint32& OutStateHash) const { return false; }
+
 	void PostEvaluateAnimation();
 	void UninitializeAnimation();
 
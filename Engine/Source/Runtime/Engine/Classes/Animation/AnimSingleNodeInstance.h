@@ -38,6 +38,7 @@ class ENGINE_API UAnimSingleNodeInstance : public UAnimInstance
 	virtual void NativeInitializeAnimation() override;
 	virtual void NativePostEvaluateAnimation() override;
 	virtual void OnMontageInstanceStopped(FAnimMontageInstance& StoppedMontageInstance) override;
+	virtual bool GetSharedPoseStateHash(float TimeTolerance, uint32& OutStateHash) const override;
 
 protected:
 	virtual void Montage_Advance(float DeltaTime) override;
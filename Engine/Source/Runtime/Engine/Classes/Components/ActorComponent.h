@@ -214,6 +214,13 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Cooking)
 	uint32 bIsEditorOnly:1;
 
+	/**
+	 * If true, the component only affects presentation (effects, audio, decorative meshes). It is excluded from dedicated
+	 * server cooks and its tick functions never run on dedicated servers, so server gameplay code must not rely on it.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, AdvancedDisplay, Category = Cooking)
+	uint32 bIsCosmetic:1;
+
 private:
 	/** Indicates that OnCreatedComponent has been called, but OnDestroyedComponent has not yet */
 	uint32 bHasBeenCreated:1;
@@ -688,6 +695,15 @@ public:
 	/** return true if this component requires end of frame recreates to happen from the game thread. */
 	virtual bool RequiresGameThreadEndOfFrameRecreate() const;
 
+	/**
+	 * return true if this component's render state may be created off the game thread with the end of frame updates, together with other components registered in the same frame.
+	 * Requires CreateRenderState_Concurrent to be thread safe and to send nothing to the rendering thread for the new scene proxy until the frame's updates are done.
+	 */
+	virtual bool AllowsBatchedRenderStateCreation() const
+	{
+		return false;
+	}
+
 	/** Recreate the render state right away. Generally you always want to call MarkRenderStateDirty instead. 
 	*
 	* **Caution**, this is called concurrently on multiple threads (but never the same component concurrently)
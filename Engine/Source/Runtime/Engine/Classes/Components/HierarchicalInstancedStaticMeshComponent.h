@@ -202,6 +202,12 @@ public:
 protected:
 	/** Removes a single instance without extra work such as rebuilding the tree or marking render state dirty. */
 	void RemoveInstanceInternal(int32 InstanceIndex);
+
+	/**
+	 * Starts the tree rebuild after instances were removed. In game worlds, a few removals can be left in the tree
+	 * and only hidden in the render data (foliage.MaxDeferredTreeRemovals), so destroying single instances doesn't rebuild the whole tree each time.
+	 */
+	void RebuildTreeAfterRemoval();
 	
 	/** Gets and approximate number of verts for each LOD to generate heuristics **/
 	int32 GetVertsForLOD(int32 LODIndex);
@@ -193,6 +193,11 @@ public:
 
 	//~ Begin UActorComponent Interface
 	virtual FActorComponentInstanceData* GetComponentInstanceData() const override;
+	virtual bool AllowsBatchedRenderStateCreation() const override
+	{
+		// CreateSceneProxy may seed InstancingRandomSeed with FMath::Rand, which isn't thread safe
+		return false;
+	}
 	//~ End UActorComponent Interface
 
 	//~ Begin UPrimitiveComponent Interface
@@ -414,6 +414,13 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Clothing)
 	float ClothBlendWeight;
 
+	/**
+	 * Screen size (as used by LODs) below which cloth is blended back to the skinned result and then no longer simulated.
+	 * Zero or negative values never disable cloth by screen size.
+	 */
+	UPROPERTY(EditAnywhere, AdvancedDisplay, BlueprintReadWrite, Category = Clothing, meta=(ClampMin = "0", UIMin = "0", UIMax = "1"))
+	float ClothMinScreenSize;
+
 	/** To save previous state */
 	uint32 bPrevDisableClothSimulation:1;
 
@@ -433,6 +440,14 @@ public:
 	UPROPERTY(EditAnywhere, AdvancedDisplay, BlueprintReadWrite, Category=Animation)
 	uint32 bPauseAnims:1;
 
+	/**
+	 * Reuses the pose another component evaluated this frame from the same state instead of evaluating the graph again,
+	 * when the anim instance can describe its state (see UAnimInstance::GetSharedPoseStateHash). Meant for crowds.
+	 * Playback times within a.SharedPoseEvaluation.TimeTolerance of each other are treated as the same.
+	 */
+	UPROPERTY(EditAnywhere, AdvancedDisplay, BlueprintReadWrite, Category=Optimization)
+	uint32 bSharePoseEvaluation:1;
+
 	/** On InitAnim should we set to ref pose (if false use first tick of animation data)*/
 	UPROPERTY(EditAnywhere, AdvancedDisplay, Category = Animation)
 	bool bUseRefPoseOnInitAnim;
@@ -697,6 +712,19 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Components|SkeletalMesh")
 	bool IsClothingSimulationSuspended();
 
+	/**
+	 * Blends clothing back to the skinned result and stops simulating it, e.g. when a significance manager deems the mesh insignificant.
+	 * Unlike SuspendClothingSimulation the skinned result is shown, and the clothing is reset when it blends back in.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Components|SkeletalMesh")
+	void SetClothAutoDisabled(bool bDisable);
+
+	/** Returns the weight to blend simulated and skinned clothing with, ClothBlendWeight scaled by any auto disable blend */
+	float GetClothBlendWeight() const
+	{
+		return ClothBlendWeight * ClothAutoDisableBlendWeight;
+	}
+
 	/**
 	 * Reset the teleport mode of a next update to 'Continuous'
 	 */
@@ -759,6 +787,12 @@ protected:
 	/** Whether the clothing simulation is suspended (not the same as disabled, we no longer run the sim but keep the last valid sim data around) */
 	bool bClothingSimulationSuspended;
 
+	/** Whether SetClothAutoDisabled turned clothing off */
+	bool bClothAutoDisabled;
+
+	/** Blends clothing out when auto disabled, by SetClothAutoDisabled or ClothMinScreenSize. Clothing isn't simulated at zero */
+	float ClothAutoDisableBlendWeight;
+
 public:
 	/** Temporary array of bone indices required this frame. Filled in by UpdateSkelPose. */
 	TArray<FBoneIndexType> RequiredBones;
@@ -1407,8 +1441,17 @@ public:
 	 *	@param	Teleport					Whether movement is a 'teleport' (ie infers no physics velocity, but moves simulating bodies) or not
 	 *	@param	bNeedsSkinning				Whether we may need  to send new triangle data for per-poly skeletal mesh collision
 	 *	@perem	AllowDeferral				Whether we can defer actual update of bodies (if 'physics only' collision)
+	 *	@param	InBodyTargets				Optional world space transforms of each body, from ComputeKinematicBodyTargets
+	 */
+	void UpdateKinematicBonesToAnim(const TArray<FTransform>& InComponentSpaceTransforms, ETeleportType Teleport, bool bNeedsSkinning, EAllowKinematicDeferral DeferralAllowed = EAllowKinematicDeferral::AllowDeferral, const TArray<FTransform>* InBodyTargets = nullptr);
+
+	/**
+	 *	Compute the world space transform each physics body would be moved to by UpdateKinematicBonesToAnim.
+	 *	Only reads the component, so it is safe to call for several components in parallel.
+	 *	@param	InComponentSpaceTransforms	Array of bone transforms in component space
+	 *	@param	OutBodyTargets				World space transform for each entry of Bodies
 	 */
-	void UpdateKinematicBonesToAnim(const TArray<FTransform>& InComponentSpaceTransforms, ETeleportType Teleport, bool bNeedsSkinning, EAllowKinematicDeferral DeferralAllowed = EAllowKinematicDeferral::AllowDeferral);
+	void ComputeKinematicBodyTargets(const TArray<FTransform>& InComponentSpaceTransforms, TArray<FTransform>& OutBodyTargets) const;
 
 	/**
 	 * Look up all bodies for broken constraints.
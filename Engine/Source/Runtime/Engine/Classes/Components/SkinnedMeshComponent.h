@@ -1116,6 +1116,11 @@ public:
 
 	bool ShouldUseUpdateRateOptimizations() const;
 
+protected:
+	/** Adds the time spent evaluating the animation of one component to this frame's total, used by the animation budget. Thread safe. */
+	static void AddAnimationBudgetCost(uint32 Cycles);
+
+public:
 	/** Release any rendering resources owned by this component */
 	void ReleaseResources();
 
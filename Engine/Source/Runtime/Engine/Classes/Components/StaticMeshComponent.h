@@ -389,6 +389,10 @@ public:
 	virtual void CheckForErrors() override;
 #endif
 	virtual FActorComponentInstanceData* GetComponentInstanceData() const override;
+	virtual bool AllowsBatchedRenderStateCreation() const override
+	{
+		return true;
+	}
 	//~ End UActorComponent Interface.
 
 	//~ Begin UPrimitiveComponent Interface.
@@ -87,6 +87,12 @@ protected:
 		ToolTip = "Batching granularity used to register actor components during level streaming."))
 	int32 LevelStreamingComponentsRegistrationGranularity;
 
+	/** Batching granularity used to route initialization on actors during level streaming */
+	UPROPERTY(EditAnywhere, config, Category = LevelStreaming, AdvancedDisplay, meta = (
+		ConsoleVariable = "s.LevelStreamingRouteActorInitializationGranularity", DisplayName = "Actor Initialization Granularity",
+		ToolTip = "Batching granularity used to route PreInitializeComponents, InitializeComponents, PostInitializeComponents and BeginPlay on actors during level streaming. 0 initializes all actors of a level in one frame."))
+	int32 LevelStreamingRouteActorInitializationGranularity;
+
 	/** Maximum allowed time to spend while unregistering components during level streaming (ms per frame) */
 	UPROPERTY(EditAnywhere, config, Category = LevelStreaming, AdvancedDisplay, meta = (
 		ConsoleVariable = "s.UnregisterComponentsTimeLimit", DisplayName = "Component Unregister Update Time Limit",
@@ -125,6 +131,8 @@ extern ENGINE_API float GPriorityAsyncLoadingExtraTime;
 extern ENGINE_API float GLevelStreamingActorsUpdateTimeLimit;
 /** Batching granularity used to register actor components during level streaming. */
 extern ENGINE_API int32 GLevelStreamingComponentsRegistrationGranularity;
+/** Batching granularity used to route initialization on actors during level streaming, 0 for all actors at once. */
+extern ENGINE_API int32 GLevelStreamingRouteActorInitializationGranularity;
 /** Batching granularity used to unregister actor components during level streaming.  */
 extern ENGINE_API int32 GLevelStreamingComponentsUnregistrationGranularity;
 /** Maximum allowed time to spend for actor unregistration steps during level streaming (ms per frame). If this is 0.0 then we don't timeslice.*/
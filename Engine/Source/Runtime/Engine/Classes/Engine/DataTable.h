@@ -181,6 +181,35 @@ class UDataTable
 		return RowData;
 	}
 
+	/**
+	 * Returns the index of a row that was loaded with the table, or INDEX_NONE if there is no such row or it was added later.
+	 * The index can be passed to FindRowByIndex to skip the name lookup, it stays valid until the table is emptied or loaded again.
+	 */
+	ENGINE_API int32 GetRowIndex(FName RowName) const;
+
+	/** Returns the row at an index from GetRowIndex, or nullptr if that row has been removed */
+	uint8* FindRowByIndexUnchecked(int32 RowIndex) const
+	{
+		if (LoadedRowsAlive.IsValidIndex(RowIndex) && LoadedRowsAlive[RowIndex])
+		{
+			return LoadedRowData + RowIndex * LoadedRowStride;
+		}
+		return nullptr;
+	}
+
+	/** Function to find the row of a table given an index from GetRowIndex. */
+	template <class T>
+	T* FindRowByIndex(int32 RowIndex) const
+	{
+		if (RowStruct == nullptr || !RowStruct->IsChildOf(T::StaticStruct()))
+		{
+			UE_LOG(LogDataTable, Error, TEXT("UDataTable::FindRowByIndex : Incorrect type specified for DataTable '%s'."), *GetPathName());
+			return nullptr;
+		}
+
+		return reinterpret_cast<T*>(FindRowByIndexUnchecked(RowIndex));
+	}
+
 	/** Empty the table info (will not clear RowStruct) */
 	ENGINE_API void EmptyTable();
 
@@ -262,6 +291,26 @@ private:
 
 
 	UScriptStruct& GetEmptyUsingStruct() const;
+
+	/** Returns the index of the row in LoadedRowData, or INDEX_NONE if it was allocated on its own */
+	int32 GetLoadedRowIndex(const uint8* RowData) const
+	{
+		if (LoadedRowData && RowData >= LoadedRowData && RowData < LoadedRowData + LoadedRowsAlive.Num() * LoadedRowStride)
+		{
+			return (RowData - LoadedRowData) / LoadedRowStride;
+		}
+		return INDEX_NONE;
+	}
+
+	/** Destroys a row that has been taken out of RowMap and frees it unless it lives in LoadedRowData */
+	void DestroyRow(UScriptStruct& EmptyUsingStruct, uint8* RowData);
+
+	/** Rows read by LoadStructData, allocated as one block with LoadedRowStride bytes per row */
+	uint8* LoadedRowData;
+	int32 LoadedRowStride;
+
+	/** Which rows of LoadedRowData are still part of RowMap */
+	TBitArray<> LoadedRowsAlive;
 };
 
 
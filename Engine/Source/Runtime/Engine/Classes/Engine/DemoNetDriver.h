@@ -28,6 +28,8 @@ DECLARE_DELEGATE_OneParam(FOnGotoTimeDelegate, const bool /* bWasSuccessful */);
 
 class UDemoNetDriver;
 class UDemoNetConnection;
+class UActorChannel;
+class FDemoCheckpointSerializeTask;
 
 class FQueuedReplayTask
 {
@@ -81,13 +83,14 @@ enum ENetworkVersionHistory
 	HISTORY_EXTRA_VERSION					= 5,			// We now save engine/game protocol version, checksum, and changelist
 	HISTORY_MULTIPLE_LEVELS					= 6,			// Replays support seamless travel between levels
 	HISTORY_MULTIPLE_LEVELS_TIME_CHANGES	= 7,				// Save out the time that level changes happen
-	HISTORY_DELETED_STARTUP_ACTORS			= 8				// Save DeletedNetStartupActors inside checkpoints
+	HISTORY_DELETED_STARTUP_ACTORS			= 8,			// Save DeletedNetStartupActors inside checkpoints
+	HISTORY_CHECKPOINT_COMPRESSION			= 9				// Checkpoints are serialized on a worker thread and saved with a compression header
 };
 
 static const uint32 MIN_SUPPORTED_VERSION = HISTORY_EXTRA_VERSION;
 
 static const uint32 NETWORK_DEMO_MAGIC				= 0x2CF5A13D;
-static const uint32 NETWORK_DEMO_VERSION			= HISTORY_DELETED_STARTUP_ACTORS;
+static const uint32 NETWORK_DEMO_VERSION			= HISTORY_CHECKPOINT_COMPRESSION;
 static const uint32 MIN_NETWORK_DEMO_VERSION		= HISTORY_EXTRA_VERSION;
 
 static const uint32 NETWORK_DEMO_METADATA_MAGIC		= 0x3D06B24E;
@@ -211,6 +214,14 @@ struct FRollbackNetStartupActorInfo
 	ULevel*		Level;
 };
 
+/** Packets an actor wrote into the last checkpoint, reused by delta checkpoints while its channel sends nothing new */
+struct FDemoCheckpointActorPackets
+{
+	/** Channel the packets were written by, the packets are stale once the actor gets a new channel */
+	TWeakObjectPtr< UActorChannel >	Channel;
+	TArray< FQueuedDemoPacket >		Packets;
+};
+
 /**
  * Simulated network driver for recording and playing back game sessions.
  */
@@ -274,14 +285,31 @@ class ENGINE_API UDemoNetDriver : public UNetDriver
 	FPackageMapAckState CheckpointAckState;					// Current ack state of packagemap for the current checkpoint being saved
 	double				TotalCheckpointSaveTimeSeconds;		// Total time it took to save checkpoint across all frames
 	int32				TotalCheckpointSaveFrames;			// Total number of frames used to save a checkpoint
-	double				LastCheckpointTime;					// Last time a checkpoint was saved
+	double				LastCheckpointTime;					// Last time a full checkpoint was saved
+	double				LastDeltaCheckpointTime;			// Last time a checkpoint of either kind was saved
+	bool				bIsDeltaCheckpoint;					// The checkpoint being saved reuses the packets of actors that didn't change since the last one
+	int32				NumCheckpointReusedActors;			// Number of actors the checkpoint being saved reused the packets of
+
+	/** Packets of each actor in the last checkpoint, see FDemoCheckpointActorPackets */
+	TMap< TWeakObjectPtr< AActor >, FDemoCheckpointActorPackets >	CheckpointActorPackets;
+
+	/** Checkpoint that finished replicating and is being serialized and compressed on a worker thread */
+	TSharedPtr< FDemoCheckpointSerializeTask >	CheckpointSerializeTask;
+	uint32										CheckpointSerializeTimeInMS;	// Demo time the checkpoint being serialized was saved at
+	int32										CheckpointGuidCacheSize;		// Size of the guid data of the checkpoint being serialized
 
 	void		RespawnNecessaryNetStartupActors();
 
 	virtual bool ShouldSaveCheckpoint();
+	bool		ShouldSaveDeltaCheckpoint() const;
 
-	void		SaveCheckpoint();
+	/**
+	 * Starts saving a checkpoint, which is spread across frames by TickCheckpoint.
+	 * @param bDeltaCheckpoint If true, actors that sent nothing since the last checkpoint reuse the packets they wrote into it instead of replicating again
+	 */
+	void		SaveCheckpoint( const bool bDeltaCheckpoint = false );
 	void		TickCheckpoint();
+	void		TickCheckpointSerialize( const bool bWaitForCompletion );
 	bool		LoadCheckpoint( FArchive* GotoCheckpointArchive, int64 GotoCheckpointSkipExtraTimeInMS );
 
 	void		SaveExternalData( FArchive& Ar );
@@ -453,6 +481,7 @@ public:
 	bool ProcessPacket( uint8* Data, int32 Count );
 
 	void WriteDemoFrameFromQueuedDemoPackets( FArchive& Ar, TArray<FQueuedDemoPacket>& QueuedPackets );
+	void WriteDemoFrameHeader( FArchive& Ar );
 	void WritePacket( FArchive& Ar, uint8* Data, int32 Count );
 
 	void TickDemoPlayback( float DeltaSeconds );
@@ -218,6 +218,12 @@ public:
 	/** If false, this tick will run on the game thread, otherwise it will run on any thread in parallel with the game thread and in parallel with other "async ticks" **/
 	uint8 bRunOnAnyThread:1;
 
+	/** 
+	 * If true, this tick may be ticked from the same task as other ticks that return the same GetTickBatchKey() and run in the same tick groups, priority and thread.
+	 * Only ticks without prerequisites are batched, ticks that depend on any tick of a batch wait for the whole batch.
+	 **/
+	uint8 bAllowTickBatching:1;
+
 private:
 	/** If true, means that this tick function is in the master array of tick functions */
 	uint8 bRegistered:1;
@@ -254,6 +260,9 @@ private:
 	/** The next function in the cooling down list for ticks with an interval*/
 	FTickFunction* Next;
 
+	/** The next function ticked by the same task when this tick function was batched, only used during the frame it was queued in */
+	FTickFunction* NextInTickBatch;
+
 	/** 
 	  * If TickFrequency is greater than 0 and tick state is CoolingDown, this is the time, 
 	  * relative to the element ahead of it in the cooling down list, remaining until the next time this function will tick 
@@ -395,6 +404,11 @@ private:
 		check(0); // you cannot make this pure virtual in script because it wants to create constructors.
 		return FString(TEXT("invalid"));
 	}
+	/** Ticks with the same key can share a task when bAllowTickBatching is set, typically the class of the object being ticked. nullptr disables batching. **/
+	virtual const void* GetTickBatchKey() const
+	{
+		return nullptr;
+	}
 	
 	friend class FTickTaskSequencer;
 	friend class FTickTaskManager;
@@ -435,6 +449,8 @@ struct FActorTickFunction : public FTickFunction
 	ENGINE_API virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
 	/** Abstract function to describe this tick. Used to print messages about illegal cycles in the dependency graph **/
 	ENGINE_API virtual FString DiagnosticMessage() override;
+	/** Batches ticks by the class of the target **/
+	ENGINE_API virtual const void* GetTickBatchKey() const override;
 };
 
 template<>
@@ -467,6 +483,8 @@ struct FActorComponentTickFunction : public FTickFunction
 	ENGINE_API virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
 	/** Abstract function to describe this tick. Used to print messages about illegal cycles in the dependency graph **/
 	ENGINE_API virtual FString DiagnosticMessage() override;
+	/** Batches ticks by the class of the target **/
+	ENGINE_API virtual const void* GetTickBatchKey() const override;
 
 
 	/**
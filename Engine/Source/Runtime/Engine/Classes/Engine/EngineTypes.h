@@ -2307,6 +2307,11 @@ public:
 	UPROPERTY()
 	EUpdateRateShiftBucket ShiftBucket;
 
+	/** Gameplay priority when the animation budget (a.URO.BudgetMs) decides who gets throttled.
+	 * Scales the on screen size, so 2 ranks the Actor like one that is twice as big on screen. */
+	UPROPERTY()
+	float BudgetSignificanceScale;
+
 public:
 
 	/** Default constructor. */
@@ -2324,6 +2329,7 @@ public:
 		, BaseNonRenderedUpdateRate(4)
 		, MaxEvalRateForInterpolation(4)
 		, ShiftBucket(EUpdateRateShiftBucket::ShiftBucket0)
+		, BudgetSignificanceScale(1.f)
 	{ 
 		BaseVisibleDistanceFactorThesholds.Add(0.12f);
 		BaseVisibleDistanceFactorThesholds.Add(0.24f);
@@ -2473,6 +2479,10 @@ struct FMeshBuildSettings
 	UPROPERTY(EditAnywhere, Category=BuildSettings)
 	bool bUseFullPrecisionUVs;
 
+	/** If true, the index buffer is split into small clusters with bounds and normal cones, for culling parts of dense meshes. */
+	UPROPERTY(EditAnywhere, Category=BuildSettings)
+	bool bBuildMeshlets;
+
 	UPROPERTY(EditAnywhere, Category=BuildSettings)
 	bool bGenerateLightmapUVs;
 
@@ -2522,6 +2532,7 @@ struct FMeshBuildSettings
 		, bBuildReversedIndexBuffer(true)
 		, bUseHighPrecisionTangentBasis(false)
 		, bUseFullPrecisionUVs(false)
+		, bBuildMeshlets(false)
 		, bGenerateLightmapUVs(true)
 		, MinLightmapResolution(64)
 		, SrcLightmapIndex(0)
@@ -2545,6 +2556,7 @@ struct FMeshBuildSettings
 			&& bBuildReversedIndexBuffer == Other.bBuildReversedIndexBuffer
 			&& bUseHighPrecisionTangentBasis == Other.bUseHighPrecisionTangentBasis
 			&& bUseFullPrecisionUVs == Other.bUseFullPrecisionUVs
+			&& bBuildMeshlets == Other.bBuildMeshlets
 			&& bGenerateLightmapUVs == Other.bGenerateLightmapUVs
 			&& MinLightmapResolution == Other.MinLightmapResolution
 			&& SrcLightmapIndex == Other.SrcLightmapIndex
@@ -2827,6 +2839,32 @@ struct FTimerHandle
 	}
 
 private:
+	/** The handle is made of the index of the timer in its timer manager and a serial number unique to that timer */
+	static const uint32 IndexBits = 24;
+	static const uint32 SerialNumberBits = 40;
+
+	static_assert(IndexBits + SerialNumberBits == 64, "The space for the timer index and serial number should total 64 bits");
+
+	static const int32  MaxIndex = (int32)1 << IndexBits;
+	static const uint64 MaxSerialNumber = (uint64)1 << SerialNumberBits;
+
+	void SetIndexAndSerialNumber(int32 Index, uint64 SerialNumber)
+	{
+		check(Index >= 0 && Index < MaxIndex);
+		check(SerialNumber < MaxSerialNumber);
+		Handle = (SerialNumber << IndexBits) | (uint64)(uint32)Index;
+	}
+
+	FORCEINLINE int32 GetIndex() const
+	{
+		return (int32)(Handle & (uint64)(MaxIndex - 1));
+	}
+
+	FORCEINLINE uint64 GetSerialNumber() const
+	{
+		return Handle >> IndexBits;
+	}
+
 	UPROPERTY(Transient)
 	uint64 Handle;
 };
@@ -35,6 +35,10 @@ class ENGINE_API UGameEngine
 	UPROPERTY(transient)
 	UGameInstance* GameInstance;
 
+	/** Games hosted in the same dedicated server process next to GameInstance, see HostAdditionalGameInstance */
+	UPROPERTY(transient)
+	TArray<UGameInstance*> AdditionalGameInstances;
+
 public:
 
 	/** The game viewport window */
@@ -159,6 +163,16 @@ public:
 	 */
 	UWorld* GetGameWorld();
 
+	/**
+	 * Hosts another independent game in this dedicated server process: a game instance with its own world, game mode
+	 * and net driver, listening on the port of URL. Loaded assets are shared by all games and their worlds are ticked
+	 * in turn on the game thread. Starting with -ServerInstances=N hosts N games on consecutive ports.
+	 *
+	 * @param URL	Map and options of the game to host.
+	 * @return The new game instance, or nullptr if the map couldn't be loaded.
+	 */
+	UGameInstance* HostAdditionalGameInstance(const FURL& URL);
+
 protected:
 
 	const FSceneViewport* GetGameSceneViewport(UGameViewportClient* ViewportClient) const;
@@ -97,6 +97,14 @@ template<> struct TPointerIsConvertibleFromTo<AActor, const volatile UObject>
 	enum { Value = 1 };
 };
 
+/** Steps of ULevel::IncrementalRouteActorInitialize */
+enum class ERouteActorInitializationState : uint8
+{
+	Preinitialize,
+	Initialize,
+	BeginPlay,
+};
+
 /** Struct that holds on to information about Actors that wish to be auto enabled for input before the player controller has been created */
 struct FPendingAutoReceiveInputActor
 {
@@ -537,6 +545,13 @@ public:
 	/** Current index into actors array for updating components.							*/
 	int32										CurrentActorIndexForUnregisterComponents;
 
+	/** Step RouteActorInitialize will continue with.											*/
+	ERouteActorInitializationState				RouteActorInitializationState;
+	/** Current index into actors array, or ActorsToBeginPlay, for routing actor initialization.	*/
+	int32										RouteActorInitializationIndex;
+	/** Actors initialized by RouteActorInitialize that still have to begin play.				*/
+	TArray<TWeakObjectPtr<AActor>>				ActorsToBeginPlay;
+
 
 	/** Whether the level is currently pending being made visible.							*/
 	DEPRECATED(4.15, "Use HasVisibilityChangeRequestPending")
@@ -728,6 +743,18 @@ public:
 	 */
 	void RouteActorInitialize();
 
+	/**
+	 * Incrementally routes pre and post initialize and begin play to actors, picking up where the last call stopped.
+	 * All actors are initialized before the first one begins play.
+	 *
+	 * @param NumActorsToProcess	Number of actors to process in this run, 0 for all
+	 * @return true once all actors have been initialized and begun play
+	 */
+	bool IncrementalRouteActorInitialize(int32 NumActorsToProcess);
+
+	/** Makes the next IncrementalRouteActorInitialize start from the first step, dropping any partially routed progress. */
+	void ResetRouteActorInitialization();
+
 	/**
 	 * Rebuilds static streaming data for all levels in the specified UWorld.
 	 *
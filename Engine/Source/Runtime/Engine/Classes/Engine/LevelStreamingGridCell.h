@@ -0,0 +1,44 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+/**
+ * LevelStreamingGridCell
+ *
+ * Streaming level holding actors of one spatial cell of the persistent level, generated by GridStreaming commandlet.
+ * Cells are loaded and made visible when any player view is within LoadingRange of the cell bounds.
+ *
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectMacros.h"
+#include "Engine/LevelStreaming.h"
+#include "LevelStreamingGridCell.generated.h"
+
+UCLASS(MinimalAPI)
+class ULevelStreamingGridCell : public ULevelStreaming
+{
+	GENERATED_UCLASS_BODY()
+
+	/** Cell coordinates in the grid the level was generated from */
+	UPROPERTY(Category=LevelStreaming, VisibleAnywhere)
+	FIntPoint CellCoords;
+
+	/** Bounds of all actors in the cell */
+	UPROPERTY(Category=LevelStreaming, EditAnywhere)
+	FBox CellBounds;
+
+	/** Distance from the cell bounds within which the cell is streamed in */
+	UPROPERTY(Category=LevelStreaming, EditAnywhere, meta=(ClampMin = "0", UIMin = "0"))
+	float LoadingRange;
+
+	//~ Begin ULevelStreaming Interface
+	virtual bool ShouldBeLoaded() const override;
+	//~ End ULevelStreaming Interface
+
+	/** Issues load and unload requests for all grid cells of the world based on the player view locations */
+	static ENGINE_API void UpdateStreamingState(UWorld* World);
+
+	/** Issues load and unload requests for all grid cells of the world based on the given view locations */
+	static ENGINE_API void UpdateStreamingState(UWorld* World, const TArray<FVector>& ViewLocations);
+};
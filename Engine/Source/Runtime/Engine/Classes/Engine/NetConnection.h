@@ -614,6 +614,11 @@ public:
 	 */
 	ENGINE_API virtual void ReceivedRawPacket(void* Data,int32 Count);
 
+	/**
+	 * Processes the incoming packets the packet handler thread finished with, if the PacketHandler is threaded
+	 */
+	ENGINE_API void ReceivedThreadedPackets();
+
 	/** Send a raw bunch. */
 	ENGINE_API int32 SendRawBunch( FOutBunch& Bunch, bool InAllowMerge );
 
@@ -695,6 +700,14 @@ protected:
 	void CleanupDormantActorState();
 
 private:
+	/**
+	 * Handles a packet the PacketHandler finished processing, or the raw packet if there is no PacketHandler
+	 *
+	 * @param Data the processed packet data
+	 * @param Count the size of the packet data
+	 */
+	void ReceivedProcessedPacket(uint8* Data, int32 Count);
+
 	/**
 	 * The channels that need ticking. This will be a subset of OpenChannels, only including
 	 * channels that need to process either dormancy or queued bunches. Should be a significant
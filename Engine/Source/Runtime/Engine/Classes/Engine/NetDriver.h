@@ -27,6 +27,8 @@ class FVoicePacket;
 class StatelessConnectHandlerComponent;
 class UNetConnection;
 struct FNetworkObjectInfo;
+struct FConnectionPrioritization;
+class FNetworkSpatialGrid;
 
 //
 // Whether to support net lag and packet loss testing.
@@ -527,6 +529,9 @@ public:
 	/** handle time update */
 	ENGINE_API virtual void TickDispatch( float DeltaTime );
 
+	/** Processes the incoming packets of all connections with a threaded PacketHandler, that the packet handler thread finished with */
+	ENGINE_API void ReceivedThreadedPackets();
+
 	/** ReplicateActors and Flush */
 	ENGINE_API virtual void TickFlush(float DeltaSeconds);
 
@@ -724,12 +729,17 @@ protected:
 	void ServerReplicateActors_BuildConsiderList( TArray<FNetworkObjectInfo*>& OutConsiderList, const float ServerTickTime );
 	int32 ServerReplicateActors_PrioritizeActors( UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers, const TArray<FNetworkObjectInfo*> ConsiderList, const bool bCPUSaturated, FActorPriority*& OutPriorityList, FActorPriority**& OutPriorityActors );
 	int32 ServerReplicateActors_ProcessPrioritizedActors( UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers, FActorPriority** PriorityActors, const int32 FinalSortedCount, int32& OutUpdated );
+	/** Thread safe version of ServerReplicateActors_PrioritizeActors, channel changes are recorded in the prioritization for the game thread to apply */
+	void ServerReplicateActors_PrioritizeActorsParallel( FConnectionPrioritization& Prioritization, const TArray<FNetworkObjectInfo*>& ConsiderList, const bool bDormancyEnabled, const bool bLowNetBandwidth ) const;
 #endif
 
 private:
 	/** Stores the list of objects to replicate into the replay stream. This should be a TUniquePtr, but it appears the generated.cpp file needs the full definition of the pointed-to type. */
 	TSharedPtr<FNetworkObjectList> NetworkObjects;
 
+	/** Spatial hash of the consider list, only used with net.UseSpatialGrid */
+	TSharedPtr<FNetworkSpatialGrid> SpatialGrid;
+
 	/** Set to "Lagging" on the server when all client connections are near timing out. We are lagging on the client when the server connection is near timed out. */
 	ENetworkLagState::Type LagState;
 
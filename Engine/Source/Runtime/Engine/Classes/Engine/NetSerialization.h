@@ -1192,6 +1192,238 @@ bool SerializePackedVector(FVector &Vector, FArchive& Ar)
 
 // --------------------------------------------------------------
 
+/**
+ *	Quantized Delta Serialization (SerializeQuantizedDelta)
+ *		Values are snapped to an integer grid first (FNetQuantizedVector, FNetQuantizedRotator, FNetQuantizedTransform) and both sides only work
+ *		with the integers from then on, so they agree exactly on what was sent.
+ *
+ *		A value is written relative to a base the receiver already has, every component as <num of bits> <zig zag encoded difference>.
+ *		Each component uses as many bits as its own difference needs, so an axis that didn't move only costs its header.
+ *		Picking a base the receiver is known to have is up to the caller (FRepLayout uses the last acked ReplicatedMovement of each connection).
+ *		Absolute values are written in the same format against a zero base, with a larger header.
+ */
+
+/** @return the largest number of bits per component a header of the given size can describe */
+inline uint32 GetMaxQuantizedDeltaBits(uint32 HeaderBits)
+{
+	return (1u << HeaderBits) - 1;
+}
+
+/** @return the number of bits the zig zag encoding of Delta needs */
+inline uint32 GetQuantizedDeltaBits(int64 Delta)
+{
+	const uint64 ZigZag = (uint64(Delta) << 1) ^ uint64(Delta >> 63);
+	return ZigZag ? uint32(FMath::FloorLog2_64(ZigZag)) + 1 : 0;
+}
+
+/** Writes or reads the difference of one component to its base. */
+inline void SerializeQuantizedDeltaComponent(FArchive& Ar, int64& Delta, uint32 HeaderBits)
+{
+	uint32 NumBits = Ar.IsSaving() ? GetQuantizedDeltaBits(Delta) : 0;
+	check(!Ar.IsSaving() || NumBits <= GetMaxQuantizedDeltaBits(HeaderBits));
+	Ar.SerializeInt(NumBits, 1u << HeaderBits);
+
+	uint64 ZigZag = Ar.IsSaving() ? (uint64(Delta) << 1) ^ uint64(Delta >> 63) : 0;
+	Ar.SerializeBits(&ZigZag, NumBits);
+
+	if (Ar.IsLoading())
+	{
+		Delta = int64(ZigZag >> 1) ^ -int64(ZigZag & 1);
+	}
+}
+
+/** Vector snapped to a grid of 1 / Scale. */
+struct FNetQuantizedVector
+{
+	int32 X;
+	int32 Y;
+	int32 Z;
+
+	FNetQuantizedVector()
+		: X(0), Y(0), Z(0)
+	{
+	}
+
+	FNetQuantizedVector(const FVector& Value, float Scale)
+	{
+		if (Value.ContainsNaN())
+		{
+			logOrEnsureNanError(TEXT("FNetQuantizedVector: Value contains NaN, clearing for safety."));
+			X = Y = Z = 0;
+			return;
+		}
+
+		// same range as SerializePackedVector with 30 bits per component
+		const float MaxValue = float(1 << 30);
+		X = FMath::RoundToInt(FMath::Clamp(Value.X * Scale, -MaxValue, MaxValue));
+		Y = FMath::RoundToInt(FMath::Clamp(Value.Y * Scale, -MaxValue, MaxValue));
+		Z = FMath::RoundToInt(FMath::Clamp(Value.Z * Scale, -MaxValue, MaxValue));
+	}
+
+	FVector ToVector(float Scale) const
+	{
+		return FVector(float(X) / Scale, float(Y) / Scale, float(Z) / Scale);
+	}
+
+	bool operator==(const FNetQuantizedVector& Other) const
+	{
+		return X == Other.X && Y == Other.Y && Z == Other.Z;
+	}
+};
+
+/** Rotator with every axis compressed to NumBits (8 or 16) bits, differences wrap around. */
+struct FNetQuantizedRotator
+{
+	int32 Pitch;
+	int32 Yaw;
+	int32 Roll;
+
+	FNetQuantizedRotator()
+		: Pitch(0), Yaw(0), Roll(0)
+	{
+	}
+
+	FNetQuantizedRotator(const FRotator& Value, uint32 NumBits)
+	{
+		check(NumBits == 8 || NumBits == 16);
+		if (NumBits == 8)
+		{
+			Pitch = FRotator::CompressAxisToByte(Value.Pitch);
+			Yaw = FRotator::CompressAxisToByte(Value.Yaw);
+			Roll = FRotator::CompressAxisToByte(Value.Roll);
+		}
+		else
+		{
+			Pitch = FRotator::CompressAxisToShort(Value.Pitch);
+			Yaw = FRotator::CompressAxisToShort(Value.Yaw);
+			Roll = FRotator::CompressAxisToShort(Value.Roll);
+		}
+	}
+
+	FRotator ToRotator(uint32 NumBits) const
+	{
+		if (NumBits == 8)
+		{
+			return FRotator(FRotator::DecompressAxisFromByte(Pitch), FRotator::DecompressAxisFromByte(Yaw), FRotator::DecompressAxisFromByte(Roll));
+		}
+		return FRotator(FRotator::DecompressAxisFromShort(Pitch), FRotator::DecompressAxisFromShort(Yaw), FRotator::DecompressAxisFromShort(Roll));
+	}
+
+	bool operator==(const FNetQuantizedRotator& Other) const
+	{
+		return Pitch == Other.Pitch && Yaw == Other.Yaw && Roll == Other.Roll;
+	}
+};
+
+/** Transform snapped to the grids of FNetQuantizedVector and FNetQuantizedRotator. */
+struct FNetQuantizedTransform
+{
+	FNetQuantizedVector Translation;
+	FNetQuantizedRotator Rotation;
+	FNetQuantizedVector Scale3D;
+
+	FNetQuantizedTransform()
+	{
+	}
+
+	FNetQuantizedTransform(const FTransform& Value, float TranslationScale, uint32 RotationBits, float Scale3DScale)
+		: Translation(Value.GetTranslation(), TranslationScale)
+		, Rotation(Value.Rotator(), RotationBits)
+		, Scale3D(Value.GetScale3D(), Scale3DScale)
+	{
+	}
+
+	FTransform ToTransform(float TranslationScale, uint32 RotationBits, float Scale3DScale) const
+	{
+		return FTransform(Rotation.ToRotator(RotationBits), Translation.ToVector(TranslationScale), Scale3D.ToVector(Scale3DScale));
+	}
+
+	bool operator==(const FNetQuantizedTransform& Other) const
+	{
+		return Translation == Other.Translation && Rotation == Other.Rotation && Scale3D == Other.Scale3D;
+	}
+};
+
+/** @return the wrapped difference of two rotation axes compressed to NumBits */
+inline int64 GetQuantizedRotatorAxisDelta(int32 Value, int32 Base, uint32 NumBits)
+{
+	const int32 Range = 1 << NumBits;
+	return ((Value - Base + Range / 2) & (Range - 1)) - Range / 2;
+}
+
+/** @return true if the difference of every component of Value to Base fits in MaxBitsPerComponent bits */
+inline bool CanSerializeQuantizedDelta(const FNetQuantizedVector& Value, const FNetQuantizedVector& Base, uint32 MaxBitsPerComponent)
+{
+	return GetQuantizedDeltaBits(int64(Value.X) - Base.X) <= MaxBitsPerComponent &&
+		GetQuantizedDeltaBits(int64(Value.Y) - Base.Y) <= MaxBitsPerComponent &&
+		GetQuantizedDeltaBits(int64(Value.Z) - Base.Z) <= MaxBitsPerComponent;
+}
+
+inline bool CanSerializeQuantizedDelta(const FNetQuantizedRotator& Value, const FNetQuantizedRotator& Base, uint32 NumBits, uint32 MaxBitsPerComponent)
+{
+	return GetQuantizedDeltaBits(GetQuantizedRotatorAxisDelta(Value.Pitch, Base.Pitch, NumBits)) <= MaxBitsPerComponent &&
+		GetQuantizedDeltaBits(GetQuantizedRotatorAxisDelta(Value.Yaw, Base.Yaw, NumBits)) <= MaxBitsPerComponent &&
+		GetQuantizedDeltaBits(GetQuantizedRotatorAxisDelta(Value.Roll, Base.Roll, NumBits)) <= MaxBitsPerComponent;
+}
+
+inline bool CanSerializeQuantizedDelta(const FNetQuantizedTransform& Value, const FNetQuantizedTransform& Base, uint32 RotationBits, uint32 MaxBitsPerComponent)
+{
+	return CanSerializeQuantizedDelta(Value.Translation, Base.Translation, MaxBitsPerComponent) &&
+		CanSerializeQuantizedDelta(Value.Rotation, Base.Rotation, RotationBits, MaxBitsPerComponent) &&
+		CanSerializeQuantizedDelta(Value.Scale3D, Base.Scale3D, MaxBitsPerComponent);
+}
+
+/**
+ * Writes or reads Value relative to Base.
+ * @param HeaderBits	Size of the per component bit count, writing checks every difference fits (see CanSerializeQuantizedDelta).
+ *						6 bits are enough for any absolute value (against a zero base).
+ */
+inline void SerializeQuantizedDelta(FArchive& Ar, FNetQuantizedVector& Value, const FNetQuantizedVector& Base, uint32 HeaderBits)
+{
+	int64 DX = int64(Value.X) - Base.X;
+	int64 DY = int64(Value.Y) - Base.Y;
+	int64 DZ = int64(Value.Z) - Base.Z;
+
+	SerializeQuantizedDeltaComponent(Ar, DX, HeaderBits);
+	SerializeQuantizedDeltaComponent(Ar, DY, HeaderBits);
+	SerializeQuantizedDeltaComponent(Ar, DZ, HeaderBits);
+
+	if (Ar.IsLoading())
+	{
+		Value.X = int32(Base.X + DX);
+		Value.Y = int32(Base.Y + DY);
+		Value.Z = int32(Base.Z + DZ);
+	}
+}
+
+inline void SerializeQuantizedDelta(FArchive& Ar, FNetQuantizedRotator& Value, const FNetQuantizedRotator& Base, uint32 NumBits, uint32 HeaderBits)
+{
+	int64 DPitch = GetQuantizedRotatorAxisDelta(Value.Pitch, Base.Pitch, NumBits);
+	int64 DYaw = GetQuantizedRotatorAxisDelta(Value.Yaw, Base.Yaw, NumBits);
+	int64 DRoll = GetQuantizedRotatorAxisDelta(Value.Roll, Base.Roll, NumBits);
+
+	SerializeQuantizedDeltaComponent(Ar, DPitch, HeaderBits);
+	SerializeQuantizedDeltaComponent(Ar, DYaw, HeaderBits);
+	SerializeQuantizedDeltaComponent(Ar, DRoll, HeaderBits);
+
+	if (Ar.IsLoading())
+	{
+		const int32 Mask = (1 << NumBits) - 1;
+		Value.Pitch = int32(Base.Pitch + DPitch) & Mask;
+		Value.Yaw = int32(Base.Yaw + DYaw) & Mask;
+		Value.Roll = int32(Base.Roll + DRoll) & Mask;
+	}
+}
+
+inline void SerializeQuantizedDelta(FArchive& Ar, FNetQuantizedTransform& Value, const FNetQuantizedTransform& Base, uint32 RotationBits, uint32 HeaderBits)
+{
+	SerializeQuantizedDelta(Ar, Value.Translation, Base.Translation, HeaderBits);
+	SerializeQuantizedDelta(Ar, Value.Rotation, Base.Rotation, RotationBits, HeaderBits);
+	SerializeQuantizedDelta(Ar, Value.Scale3D, Base.Scale3D, HeaderBits);
+}
+
+// --------------------------------------------------------------
+
 template<int32 MaxValue, int32 NumBits>
 bool WriteFixedCompressedFloat(const float Value, FArchive& Ar)
 {
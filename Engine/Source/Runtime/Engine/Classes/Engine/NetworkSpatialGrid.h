@@ -0,0 +1,77 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+class UNetConnection;
+struct FNetViewer;
+struct FNetworkObjectInfo;
+
+/**
+ * Spatial hash of the actors considered for replication in a frame, used by UNetDriver::ServerReplicateActors to only
+ * prioritize the actors that can be within net cull distance of a connection's viewers.
+ *
+ * Actors whose relevancy depends on more than their distance (always relevant, owner only, owned or instigated actors
+ * and attached actors) aren't hashed and are considered for every connection, as are actors that already have a
+ * channel on the connection so it can be closed once they stop being relevant.
+ */
+class ENGINE_API FNetworkSpatialGrid
+{
+public:
+	FNetworkSpatialGrid();
+
+	/** Rebuilds the grid from the consider list of this frame. */
+	void Build(const TArray<FNetworkObjectInfo*>& ConsiderList, float InCellSize);
+
+	/**
+	 * Collects the actors to consider for a connection, safe to call from several threads at once.
+	 * @param Connection		Connection being prioritized
+	 * @param Viewers			Viewers of the connection
+	 * @param OutConsiderList	Receives the actors, a subset of the list the grid was built from
+	 */
+	void GatherConsiderList(const UNetConnection* Connection, const TArray<FNetViewer>& Viewers, TArray<FNetworkObjectInfo*>& OutConsiderList) const;
+
+	/** @return true if the relevancy of the actor only depends on its distance to the viewers, so it can be looked up by location. */
+	static bool IsDistanceRelevantOnly(const AActor* Actor);
+
+private:
+	struct FCell
+	{
+		TArray<FNetworkObjectInfo*> Actors;
+		/** Largest net cull distance of the actors in the cell */
+		float MaxCullDistanceSquared;
+
+		FCell()
+			: MaxCullDistanceSquared(0.0f)
+		{
+		}
+	};
+
+	struct FActorEntry
+	{
+		FNetworkObjectInfo* ActorInfo;
+		uint64 CellKey;
+	};
+
+	uint64 GetCellKey(int32 CellX, int32 CellY) const
+	{
+		return (uint64(uint32(CellX)) << 32) | uint64(uint32(CellY));
+	}
+
+	int32 GetCellCoord(float Value) const
+	{
+		return FMath::FloorToInt(Value / CellSize);
+	}
+
+	float CellSize;
+	/** Largest net cull distance of all hashed actors, bounds the cells that need to be looked at */
+	float MaxCullDistance;
+
+	TMap<uint64, FCell> Cells;
+	/** Cell of every hashed actor */
+	TMap<const AActor*, FActorEntry> ActorEntries;
+	/** Actors that aren't hashed and are considered for every connection */
+	TArray<FNetworkObjectInfo*> NonSpatialActors;
+};
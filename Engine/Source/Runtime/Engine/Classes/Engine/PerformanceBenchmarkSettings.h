@@ -0,0 +1,57 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectMacros.h"
+#include "Misc/StringAssetReference.h"
+#include "Engine/DeveloperSettings.h"
+#include "PerformanceBenchmarkSettings.generated.h"
+
+/** A map and camera path measured by Benchmark.Run, see FPerformanceBenchmark */
+USTRUCT()
+struct FPerformanceBenchmarkScenario
+{
+	GENERATED_USTRUCT_BODY()
+
+	/** Name the scenario is run and its baseline is stored with */
+	UPROPERTY(config, EditAnywhere, Category=Benchmark)
+	FName Name;
+
+	/** Map to measure, it is loaded first if it isn't the current map */
+	UPROPERTY(config, EditAnywhere, Category=Benchmark, meta=(AllowedClasses="World"))
+	FStringAssetReference Map;
+
+	/** Seconds to wait at the start of the camera path before measuring, e.g. for streaming to settle */
+	UPROPERTY(config, EditAnywhere, Category=Benchmark, meta=(ClampMin="0", UIMin="0"))
+	float WarmupSeconds;
+
+	/** Seconds the camera takes to follow the path, which is how long the scenario is measured */
+	UPROPERTY(config, EditAnywhere, Category=Benchmark, meta=(ClampMin="1", UIMin="1"))
+	float Duration;
+
+	/** Points the camera moves through, reached at even intervals of Duration. Empty keeps the player's view. */
+	UPROPERTY(config, EditAnywhere, Category=Benchmark)
+	TArray<FTransform> CameraPath;
+
+	FPerformanceBenchmarkScenario()
+		: WarmupSeconds(2.f)
+		, Duration(30.f)
+	{
+	}
+};
+
+/**
+ * Performance benchmark scenarios of the project.
+ */
+UCLASS(config=Game, defaultconfig, meta=(DisplayName="Performance Benchmarks"))
+class ENGINE_API UPerformanceBenchmarkSettings : public UDeveloperSettings
+{
+	GENERATED_UCLASS_BODY()
+
+	UPROPERTY(config, EditAnywhere, Category=Benchmark)
+	TArray<FPerformanceBenchmarkScenario> Scenarios;
+
+	/** Returns the scenario with the given name, or nullptr if there is none */
+	const FPerformanceBenchmarkScenario* FindScenario(FName ScenarioName) const;
+};
@@ -509,6 +509,13 @@ class UStaticMesh : public UObject, public IInterface_CollisionDataProvider, pub
 	UPROPERTY(EditAnywhere, Category = StaticMesh, meta=(DisplayName="LOD For Collision"))
 	int32 LODForCollision;
 
+	/**
+	 *	Specifies which mesh LOD is rasterized by software occlusion culling (r.SoftwareOcclusion), or -1 to never use this mesh as a software occluder.
+	 *	The LOD should be low-poly, opaque and stay inside the silhouette of the rendered mesh, as anything behind it is culled.
+	 */
+	UPROPERTY(EditAnywhere, AdvancedDisplay, Category = StaticMesh, meta=(DisplayName="LOD For Occluder Mesh"))
+	int32 LODForOccluderMesh;
+
 	/** If true, strips unwanted complex collision data aka kDOP tree when cooking for consoles.
 		On the Playstation 3 data of this mesh will be stored in video memory. */
 	UPROPERTY()
@@ -38,6 +38,7 @@ class AWorldSettings;
 class Error;
 class FPhysScene;
 class FTimerManager;
+class FActorPool;
 class FUniqueNetId;
 class FWorldInGamePerformanceTrackers;
 class IInterface_PostProcessVolume;
@@ -994,6 +995,9 @@ private:
 	/** Gameplay timers. */
 	class FTimerManager* TimerManager;
 
+	/** Deactivated actors kept for reuse. */
+	class FActorPool* ActorPool;
+
 	/** Latent action manager. */
 	struct FLatentActionManager LatentActionManager;
 
@@ -1822,6 +1826,31 @@ public:
 	 */ 
 	FTraceHandle	AsyncOverlapByObjectType(const FVector& Pos, const FQuat& Rot, const FCollisionObjectQueryParams& ObjectQueryParams, const FCollisionShape& CollisionShape, const FCollisionQueryParams& Params = FCollisionQueryParams::DefaultQueryParam, FOverlapDelegate * InDelegate = NULL, uint32 UserData = 0);
 
+	/**
+	 * Runs a batch of traces/sweeps right away, spread over the task threads, and returns when all of them are done.
+	 * Each datum is described the same way as for the async traces. Its results are written to its OutHits and its delegate is not called.
+	 * Cheaper than running the same queries one by one when there are many of them.
+	 *
+	 *	@param	Traces			Requests to run in this world, see FTraceDatum
+	 */
+	void BatchTrace(TArray<FTraceDatum>& Traces);
+
+	/**
+	 * Runs a batch of overlap queries right away, spread over the task threads, and returns when all of them are done.
+	 * Each datum's results are written to its OutOverlaps and its delegate is not called.
+	 *
+	 *	@param	Overlaps		Requests to run in this world, see FOverlapDatum
+	 */
+	void BatchOverlap(TArray<FOverlapDatum>& Overlaps);
+
+	/**
+	 * Queues a batch of traces/sweeps the same way as the AsyncLineTrace/AsyncSweep functions, the results are available next frame.
+	 *
+	 *	@param	Traces			Requests to run in this world, see FTraceDatum
+	 *	@param	OutHandles		Receives the handle of each request, in the same order
+	 */
+	void AsyncBatchTrace(const TArray<FTraceDatum>& Traces, TArray<FTraceHandle>& OutHandles);
+
 	/**
 	 * Query function 
 	 * return true if already done and returning valid result - can be hit or no hit
@@ -3134,6 +3163,12 @@ public:
 		return (OwningGameInstance ? OwningGameInstance->GetTimerManager() : *TimerManager);
 	}
 
+	/** Returns the pool of deactivated actors that can be reused instead of spawning new ones. */
+	inline FActorPool& GetActorPool() const
+	{
+		return *ActorPool;
+	}
+
 	/**
 	 * Returns LatentActionManager instance, preferring the one allocated by the game instance if a game instance is associated with this.
 	 *
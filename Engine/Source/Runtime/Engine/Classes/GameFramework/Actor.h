@@ -417,6 +417,10 @@ public:
 	/** If true, this actor should search for an owned camera component to view through when used as a view target. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Actor, AdvancedDisplay)
 	uint8 bFindCameraComponentWhenViewTarget:1;
+
+	/** If true, this actor can be deactivated and kept in the world's actor pool for reuse instead of being destroyed. @see FActorPool */
+	UPROPERTY(EditDefaultsOnly, Category=Actor, AdvancedDisplay)
+	uint8 bCanBePooled:1;
 	
 	/** If true, this actor will be replicated to network replays (default is true) */
 	UPROPERTY()
@@ -2586,6 +2590,12 @@ public:
 	UFUNCTION(BlueprintImplementableEvent, Category=Actor, meta=(DisplayName="OnReset"))
 	void K2_OnReset();
 
+	/** Called when the world's actor pool deactivates this actor to reuse it later, instead of destroying it. */
+	virtual void OnReturnedToPool();
+
+	/** Called when the world's actor pool hands this actor out again, after it has been moved and reactivated. Resets the actor by default. */
+	virtual void OnAcquiredFromPool();
+
 	/**
 	 * Returns true if this actor has been rendered "recently", with a tolerance in seconds to define what "recent" means. 
 	 * e.g.: If a tolerance of 0.1 is used, this function will return true only if the actor was rendered in the last 0.1 seconds of game time. 
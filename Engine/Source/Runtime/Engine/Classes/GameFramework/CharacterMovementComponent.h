@@ -872,6 +872,14 @@ public:
 	UPROPERTY(Category="Character Movement: Walking", EditAnywhere, BlueprintReadWrite, AdvancedDisplay)
 	uint32 bUseFlatBaseForFloorChecks:1;
 
+	/**
+	 * If the Character is not controlled by a player, find the floor at the location it is expected to walk to this frame ahead of time, on worker threads
+	 * together with the other Characters using this. The floor check after walking uses that floor if the Character ended up there and the floor is static.
+	 * Movement itself is still performed on the game thread. See p.CharacterParallelFloorPrediction.
+	 */
+	UPROPERTY(Category="Character Movement: Walking", EditAnywhere, BlueprintReadWrite, AdvancedDisplay)
+	uint32 bPredictFloorInParallel:1;
+
 	/** Used to prevent reentry of JumpOff() */
 	UPROPERTY()
 	uint32 bPerformingJumpOff:1;
@@ -1856,6 +1864,22 @@ protected:
 	UFUNCTION()
 	virtual void CapsuleTouched(UPrimitiveComponent* OverlappedComp, AActor* Other, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
 
+	/** Floor found by the parallel floor prediction at PredictedFloorLocation, for the frame PredictedFloorFrame only. */
+	FFindFloorResult PredictedFloor;
+	FVector PredictedFloorLocation;
+	float PredictedFloorLineDist;
+	float PredictedFloorSweepDist;
+	uint64 PredictedFloorFrame;
+
+	/** Once per frame, predicts the floors of all Characters that used bPredictFloorInParallel last frame, in parallel. Called from the game thread. */
+	static void PredictFloorsInParallel(UCharacterMovementComponent* TickingComponent);
+
+	/** Computes PredictedFloor at the location the Character is expected to walk to. Called from worker threads, must only read the world. */
+	void PredictFloor(float DeltaSeconds);
+
+	/** Whether PredictedFloor is the result of a floor check at CapsuleLocation with the given trace distances. */
+	bool CanUsePredictedFloor(const FVector& CapsuleLocation, float LineDistance, float SweepDistance, const FHitResult* DownwardSweepResult) const;
+
 	// Enum used to control GetPawnCapsuleExtent behavior
 	enum EShrinkCapsuleExtent
 	{
@@ -1020,6 +1020,12 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Effects|Components|ParticleSystem")
 	int32 GetNumActiveParticles() const;
 
+	/** Active particles counted by the last completed tick. Unlike GetNumActiveParticles this doesn't wait for outstanding async work */
+	int32 GetLastTickActiveParticles() const { return LastTickActiveParticles; }
+
+	/** Time in ms spent simulating the emitters in the last completed tick */
+	float GetLastTickSimulationTimeMS() const { return LastTickSimulationTimeMS; }
+
 
 	/** Array of trail emitters. */
 	typedef TArray< struct FParticleAnimTrailEmitterInstance*, TInlineAllocator<8> > TrailEmitterArray;
@@ -1086,6 +1092,10 @@ private:
 	uint32 NumSignificantEmitters;
 	/** Time in ms since a tick was last performed; used with MinTimeBetweenTicks (on UParticleSystem) to control tick rate */
 	uint32 TimeSinceLastTick;
+	/** Active particles at the end of the last completed emitter tick */
+	int32 LastTickActiveParticles;
+	/** Time in ms the last emitter tick took, on whichever thread it ran */
+	float LastTickSimulationTimeMS;
 
 public:
 
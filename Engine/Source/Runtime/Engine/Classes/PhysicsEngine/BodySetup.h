@@ -6,6 +6,7 @@
 #include "UObject/ObjectMacros.h"
 #include "UObject/Object.h"
 #include "Misc/Guid.h"
+#include "Async/Future.h"
 #include "EngineDefines.h"
 #include "PhysicsEngine/BodyInstance.h"
 #include "Serialization/BulkData.h"
@@ -226,6 +227,14 @@ public:
 	/** Release Physics meshes (ConvexMeshes, TriMesh & TriMeshNegX). Must be called before the BodySetup is destroyed */
 	ENGINE_API virtual void CreatePhysicsMeshes();
 
+	/**
+	 * Creates the physics meshes like CreatePhysicsMeshes, but if there is no cooked data yet the geometry is cooked on the thread pool
+	 * instead of the game thread. Identical geometry requested by several body setups is cooked once.
+	 * Must be called on the game thread, the meshes are created on the game thread once cooking finished.
+	 * @return Future set to whether the physics meshes were created, once they have been.
+	 */
+	ENGINE_API TFuture<bool> CreatePhysicsMeshesAsync();
+
 	/** Returns the volume of this element */
 	ENGINE_API virtual float GetVolume(const FVector& Scale) const;
 
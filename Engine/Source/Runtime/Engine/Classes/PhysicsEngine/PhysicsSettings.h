@@ -224,6 +224,13 @@ class ENGINE_API UPhysicsSettings : public UDeveloperSettings
 	UPROPERTY(config, EditAnywhere, meta = (ClampMin = "1", UIMin = "1", ClampMax = "16", UIMax = "16", editcondition = "bSubstepping"), Category=Framerate)
 	int32 MaxSubsteps;
 
+	/**
+	 * Whether every substep lasts exactly MaxSubstepDeltaTime, so the simulation steps at a fixed rate independent of the frame rate.
+	 * Frame time that doesn't add up to a whole substep is carried over to the next frame, which may then not simulate at all.
+	 */
+	UPROPERTY(config, EditAnywhere, AdvancedDisplay, meta = (editcondition = "bSubstepping"), Category=Framerate)
+	bool bFixedSubstepDeltaTime;
+
 	/** Physics delta time smoothing factor for sync scene. */
 	UPROPERTY(config, EditAnywhere, AdvancedDisplay, meta = (ClampMin = "0.0", UIMin = "0.0", ClampMax = "1.0", UIMax = "1.0"), Category = Framerate)
 	float SyncSceneSmoothingFactor;
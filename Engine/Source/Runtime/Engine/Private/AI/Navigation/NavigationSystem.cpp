@@ -2,6 +2,7 @@
 
 #include "AI/Navigation/NavigationSystem.h"
 #include "Misc/ScopeLock.h"
+#include "Async/ParallelFor.h"
 #include "Stats/StatsMisc.h"
 #include "Modules/ModuleManager.h"
 #include "AI/Navigation/NavAgentInterface.h"
@@ -64,6 +65,13 @@ DECLARE_CYCLE_STAT(TEXT("Nav Tick: mark dirty"), STAT_Navigation_TickMarkDirty,
 DECLARE_CYCLE_STAT(TEXT("Nav Tick: async build"), STAT_Navigation_TickAsyncBuild, STATGROUP_Navigation);
 DECLARE_CYCLE_STAT(TEXT("Nav Tick: async pathfinding"), STAT_Navigation_TickAsyncPathfinding, STATGROUP_Navigation);
 DECLARE_CYCLE_STAT(TEXT("Debug NavOctree Time"), STAT_DebugNavOctree, STATGROUP_Navigation);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Num async pathfinding queries queued"), STAT_Navigation_AsyncPathfindingQueued, STATGROUP_Navigation);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Async pathfinding batch latency (ms)"), STAT_Navigation_AsyncPathfindingLatency, STATGROUP_Navigation);
+
+static TAutoConsoleVariable<int32> CVarAsyncPathfindingBatchSize(
+	TEXT("ai.nav.AsyncPathfindingBatchSize"),
+	8,
+	TEXT("Number of async pathfinding queries each task thread processes in one go. Bigger batches are spread over task threads in parallel, 0 processes them all on one thread."));
 
 //----------------------------------------------------------------------//
 // Stats
@@ -864,6 +872,7 @@ void UNavigationSystem::Tick(float DeltaSeconds)
 	if (AsyncPathFindingQueries.Num() > 0)
 	{
 		SCOPE_CYCLE_COUNTER(STAT_Navigation_TickAsyncPathfinding);
+		INC_DWORD_STAT_BY(STAT_Navigation_AsyncPathfindingQueued, AsyncPathFindingQueries.Num());
 		TriggerAsyncQueries(AsyncPathFindingQueries);
 		AsyncPathFindingQueries.Reset();
 	}
@@ -1047,7 +1056,7 @@ void UNavigationSystem::TriggerAsyncQueries(TArray<FAsyncPathFindingQuery>& Path
 		STATGROUP_TaskGraphTasks);
 
 	FSimpleDelegateGraphTask::CreateAndDispatchWhenReady(
-		FSimpleDelegateGraphTask::FDelegate::CreateUObject(this, &UNavigationSystem::PerformAsyncQueries, PathFindingQueries),
+		FSimpleDelegateGraphTask::FDelegate::CreateUObject(this, &UNavigationSystem::PerformAsyncQueries, PathFindingQueries, FPlatformTime::Seconds()),
 		GET_STATID(STAT_FSimpleDelegateGraphTask_NavigationSystemBatchedAsyncQueries), nullptr, CPrio_TriggerAsyncQueries.Get());
 }
 
@@ -1056,7 +1065,41 @@ static void AsyncQueryDone(FAsyncPathFindingQuery Query)
 	Query.OnDoneDelegate.ExecuteIfBound(Query.QueryID, Query.Result.Result, Query.Result.Path);
 }
 
-void UNavigationSystem::PerformAsyncQueries(TArray<FAsyncPathFindingQuery> PathFindingQueries)
+static void PerformAsyncQuery(FAsyncPathFindingQuery& Query, const ANavigationData* DefaultNavData)
+{
+	// @todo this is not necessarily the safest way to use UObjects outside of main thread. 
+	//	think about something else.
+	const ANavigationData* NavData = Query.NavData.IsValid() ? Query.NavData.Get() : DefaultNavData;
+
+	// perform query
+	if (NavData)
+	{
+		if (Query.Mode == EPathFindingMode::Hierarchical)
+		{
+			Query.Result = NavData->FindHierarchicalPath(Query.NavAgentProperties, Query);
+		}
+		else
+		{
+			Query.Result = NavData->FindPath(Query.NavAgentProperties, Query);
+		}
+	}
+	else
+	{
+		Query.Result = ENavigationQueryResult::Error;
+	}
+
+	// @todo make it return more informative results (bResult == false)
+	// trigger calling delegate on main thread - otherwise it may depend too much on stuff being thread safe
+	DECLARE_CYCLE_STAT(TEXT("FSimpleDelegateGraphTask.Async nav query finished"),
+		STAT_FSimpleDelegateGraphTask_AsyncNavQueryFinished,
+		STATGROUP_TaskGraphTasks);
+
+	FSimpleDelegateGraphTask::CreateAndDispatchWhenReady(
+		FSimpleDelegateGraphTask::FDelegate::CreateStatic(AsyncQueryDone, Query),
+		GET_STATID(STAT_FSimpleDelegateGraphTask_AsyncNavQueryFinished), NULL, ENamedThreads::GameThread);
+}
+
+void UNavigationSystem::PerformAsyncQueries(TArray<FAsyncPathFindingQuery> PathFindingQueries, double TriggerTime)
 {
 	SCOPE_CYCLE_COUNTER(STAT_Navigation_PathfindingAsync);
 
@@ -1064,39 +1107,27 @@ void UNavigationSystem::PerformAsyncQueries(TArray<FAsyncPathFindingQuery> PathF
 	{
 		return;
 	}
-	
-	for (FAsyncPathFindingQuery& Query : PathFindingQueries)
-	{
-		// @todo this is not necessarily the safest way to use UObjects outside of main thread. 
-		//	think about something else.
-		const ANavigationData* NavData = Query.NavData.IsValid() ? Query.NavData.Get() : GetMainNavData(FNavigationSystem::DontCreate);
 
-		// perform query
-		if (NavData)
-		{
-			if (Query.Mode == EPathFindingMode::Hierarchical)
-			{
-				Query.Result = NavData->FindHierarchicalPath(Query.NavAgentProperties, Query);
-			}
-			else
-			{
-				Query.Result = NavData->FindPath(Query.NavAgentProperties, Query);
-			}
-		}
-		else
+	// Each thread runs its share of queries with its own detour query, see FPImplRecastNavMesh
+	const int32 BatchSize = CVarAsyncPathfindingBatchSize.GetValueOnAnyThread();
+	const int32 NumBatches = BatchSize > 0 ? FMath::DivideAndRoundUp(PathFindingQueries.Num(), BatchSize) : 1;
+	const int32 QueriesPerBatch = FMath::DivideAndRoundUp(PathFindingQueries.Num(), NumBatches);
+
+	const ANavigationData* DefaultNavData = GetMainNavData(FNavigationSystem::DontCreate);
+
+	ParallelFor(NumBatches, [&PathFindingQueries, QueriesPerBatch, DefaultNavData](int32 BatchIndex)
+	{
+		const int32 FirstQuery = BatchIndex * QueriesPerBatch;
+		const int32 LastQuery = FMath::Min(FirstQuery + QueriesPerBatch, PathFindingQueries.Num());
+		for (int32 QueryIndex = FirstQuery; QueryIndex < LastQuery; ++QueryIndex)
 		{
-			Query.Result = ENavigationQueryResult::Error;
+			PerformAsyncQuery(PathFindingQueries[QueryIndex], DefaultNavData);
 		}
+	}, NumBatches == 1);
 
-		// @todo make it return more informative results (bResult == false)
-		// trigger calling delegate on main thread - otherwise it may depend too much on stuff being thread safe
-		DECLARE_CYCLE_STAT(TEXT("FSimpleDelegateGraphTask.Async nav query finished"),
-			STAT_FSimpleDelegateGraphTask_AsyncNavQueryFinished,
-			STATGROUP_TaskGraphTasks);
-
-		FSimpleDelegateGraphTask::CreateAndDispatchWhenReady(
-			FSimpleDelegateGraphTask::FDelegate::CreateStatic(AsyncQueryDone, Query),
-			GET_STATID(STAT_FSimpleDelegateGraphTask_AsyncNavQueryFinished), NULL, ENamedThreads::GameThread);
+	if (TriggerTime > 0.0)
+	{
+		SET_FLOAT_STAT(STAT_Navigation_AsyncPathfindingLatency, (FPlatformTime::Seconds() - TriggerTime) * 1000.0);
 	}
 }
 
@@ -4060,6 +4091,18 @@ void UNavigationSystem::UnregisterInvoker(AActor& Invoker)
 	Invokers.Remove(&Invoker);
 }
 
+void UNavigationSystem::GetInvokerLocations(TArray<FVector>& OutLocations) const
+{
+	OutLocations.Reserve(OutLocations.Num() + Invokers.Num());
+	for (const TPair<AActor*, FNavigationInvoker>& Invoker : Invokers)
+	{
+		if (const AActor* Actor = Invoker.Value.Actor.Get())
+		{
+			OutLocations.Add(Actor->GetActorLocation());
+		}
+	}
+}
+
 void UNavigationSystem::UpdateInvokers()
 {
 	UWorld* World = GetWorld();
@@ -30,17 +30,93 @@ static_assert(RECAST_STRAIGHTPATH_OFFMESH_CONNECTION == DT_STRAIGHTPATH_OFFMESH_
 static_assert(RECAST_UNWALKABLE_POLY_COST == DT_UNWALKABLE_POLY_COST, "Unwalkable poly cost differ.");
 #endif
 
+/** Navigation query owned by the calling worker thread. Kept between queries, so its node pool and open list
+ *  are only allocated once per thread instead of for every async query. Not for nested use, same as SharedNavQuery. */
+static dtNavMeshQuery& GetWorkerThreadNavQuery()
+{
+	static const uint32 TlsSlot = FPlatformTLS::AllocTlsSlot();
+
+	dtNavMeshQuery* NavQuery = (dtNavMeshQuery*)FPlatformTLS::GetTlsValue(TlsSlot);
+	if (NavQuery == nullptr)
+	{
+		NavQuery = new dtNavMeshQuery();
+		FPlatformTLS::SetTlsValue(TlsSlot, NavQuery);
+	}
+	return *NavQuery;
+}
+
 /// Helper for accessing navigation query from different threads
 #define INITIALIZE_NAVQUERY_SIMPLE(NavQueryVariable, NumNodes)	\
-	dtNavMeshQuery NavQueryVariable##Private;	\
-	dtNavMeshQuery& NavQueryVariable = IsInGameThread() ? SharedNavQuery : NavQueryVariable##Private; \
+	dtNavMeshQuery& NavQueryVariable = IsInGameThread() ? SharedNavQuery : GetWorkerThreadNavQuery(); \
 	NavQueryVariable.init(DetourNavMesh, NumNodes);
 
 #define INITIALIZE_NAVQUERY(NavQueryVariable, NumNodes, LinkFilter)	\
-	dtNavMeshQuery NavQueryVariable##Private;	\
-	dtNavMeshQuery& NavQueryVariable = IsInGameThread() ? SharedNavQuery : NavQueryVariable##Private; \
+	dtNavMeshQuery& NavQueryVariable = IsInGameThread() ? SharedNavQuery : GetWorkerThreadNavQuery(); \
 	NavQueryVariable.init(DetourNavMesh, NumNodes, &LinkFilter);
 
+/** Max number of clusters in corridor used by hierarchical path finding, longer corridors are cut off and refined as partial paths */
+#define RECAST_MAX_CLUSTER_CORRIDOR 256
+
+/** Filter limiting path finding to polys of clusters in given corridor, costs and other filtering are taken from wrapped filter */
+class FRecastClusterCorridorFilter : public dtQueryFilter
+{
+public:
+	FRecastClusterCorridorFilter(const dtNavMesh* InNavMesh, const dtQueryFilter* InFilter)
+		: dtQueryFilter(true), NavMesh(InNavMesh), Filter(InFilter)
+	{
+		copyFrom(InFilter);
+	}
+
+	/** Adds cluster and all clusters linked with it */
+	void AddClusterWithNeighbours(const dtClusterRef ClusterRef)
+	{
+		AllowedClusters.Add(ClusterRef);
+
+		const dtMeshTile* Tile = NavMesh->getTileByRef(ClusterRef);
+		const dtCluster& Cluster = Tile->clusters[NavMesh->decodeClusterIdCluster(ClusterRef)];
+		for (unsigned int LinkIdx = Cluster.firstLink; LinkIdx != DT_NULL_LINK;)
+		{
+			const dtClusterLink& Link = NavMesh->getClusterLink(Tile, LinkIdx);
+			LinkIdx = Link.next;
+
+			if (Link.ref)
+			{
+				AllowedClusters.Add(Link.ref);
+			}
+		}
+	}
+
+protected:
+	virtual bool passVirtualFilter(const dtPolyRef ref, const dtMeshTile* tile, const dtPoly* poly) const override
+	{
+		// only ground polys have clusters, off-mesh connections are limited by polys on their ends
+		const unsigned int PolyIdx = NavMesh->decodePolyIdPoly(ref);
+		if (tile->polyClusters && PolyIdx < (unsigned int)tile->header->offMeshBase)
+		{
+			const dtClusterRef ClusterRef = NavMesh->getClusterRefBase(tile) | (dtClusterRef)tile->polyClusters[PolyIdx];
+			if (!AllowedClusters.Contains(ClusterRef))
+			{
+				return false;
+			}
+		}
+
+		return Filter->passFilter(ref, tile, poly);
+	}
+
+	virtual float getVirtualCost(const float* pa, const float* pb,
+		const dtPolyRef prevRef, const dtMeshTile* prevTile, const dtPoly* prevPoly,
+		const dtPolyRef curRef, const dtMeshTile* curTile, const dtPoly* curPoly,
+		const dtPolyRef nextRef, const dtMeshTile* nextTile, const dtPoly* nextPoly) const override
+	{
+		return Filter->getCost(pa, pb, prevRef, prevTile, prevPoly, curRef, curTile, curPoly, nextRef, nextTile, nextPoly);
+	}
+
+private:
+	const dtNavMesh* NavMesh;
+	const dtQueryFilter* Filter;
+	TSet<dtClusterRef> AllowedClusters;
+};
+
 static void* DetourMalloc(int Size, dtAllocHint)
 {
 	void* Result = FMemory::Malloc(uint32(Size));
@@ -772,7 +848,7 @@ void FPImplRecastNavMesh::Raycast(const FVector& StartLoc, const FVector& EndLoc
 }
 
 // @TODONAV
-ENavigationQueryResult::Type FPImplRecastNavMesh::FindPath(const FVector& StartLoc, const FVector& EndLoc, FNavMeshPath& Path, const FNavigationQueryFilter& InQueryFilter, const UObject* Owner) const
+ENavigationQueryResult::Type FPImplRecastNavMesh::FindPath(const FVector& StartLoc, const FVector& EndLoc, FNavMeshPath& Path, const FNavigationQueryFilter& InQueryFilter, const UObject* Owner, const bool bUseClusterCorridor) const
 {
 	// temporarily disabling this check due to it causing too much "crashes"
 	// @todo but it needs to be back at some point since it realy checks for a buggy setup
@@ -810,7 +886,33 @@ ENavigationQueryResult::Type FPImplRecastNavMesh::FindPath(const FVector& StartL
 
 	// get path corridor
 	dtQueryResult PathResult;
-	const dtStatus FindPathStatus = NavQuery.findPath(StartPolyID, EndPolyID, &RecastStartPos.X, &RecastEndPos.X, QueryFilter, PathResult, 0);
+	dtStatus FindPathStatus = DT_FAILURE;
+	bool bFoundPath = false;
+
+	if (bUseClusterCorridor)
+	{
+		// search the cluster graph first and refine within corridor of found clusters only,
+		// anything short of complete path in the corridor falls back to regular search below
+		dtClusterRef ClusterPath[RECAST_MAX_CLUSTER_CORRIDOR];
+		int32 NumClusters = 0;
+		const dtStatus ClusterPathStatus = NavQuery.findClusterPath(StartPolyID, EndPolyID, ClusterPath, &NumClusters, RECAST_MAX_CLUSTER_CORRIDOR);
+		if (dtStatusSucceed(ClusterPathStatus) && !dtStatusDetail(ClusterPathStatus, DT_PARTIAL_RESULT) && NumClusters > 1)
+		{
+			FRecastClusterCorridorFilter CorridorFilter(DetourNavMesh, QueryFilter);
+			for (int32 ClusterIdx = 0; ClusterIdx < NumClusters; ClusterIdx++)
+			{
+				CorridorFilter.AddClusterWithNeighbours(ClusterPath[ClusterIdx]);
+			}
+
+			FindPathStatus = NavQuery.findPath(StartPolyID, EndPolyID, &RecastStartPos.X, &RecastEndPos.X, &CorridorFilter, PathResult, 0);
+			bFoundPath = dtStatusSucceed(FindPathStatus) && !dtStatusDetail(FindPathStatus, DT_PARTIAL_RESULT);
+		}
+	}
+
+	if (!bFoundPath)
+	{
+		FindPathStatus = NavQuery.findPath(StartPolyID, EndPolyID, &RecastStartPos.X, &RecastEndPos.X, QueryFilter, PathResult, 0);
+	}
 
 	// check for special case, where path has not been found, and starting polygon
 	// was the one closest to the target
@@ -239,6 +239,7 @@ ARecastNavMesh::ARecastNavMesh(const FObjectInitializer& ObjectInitializer)
 	RegionChunkSplits = 2;
 	LayerChunkSplits = 2;
 	MaxSimultaneousTileGenerationJobsCount = 1024;
+	TileGenerationSetupBudgetMs = 0.f;
 	bDoFullyAsyncNavDataGathering = false;
 	TileNumberHardLimit = 1 << 20;
 
@@ -252,7 +253,7 @@ ARecastNavMesh::ARecastNavMesh(const FObjectInitializer& ObjectInitializer)
 		INC_DWORD_STAT_BY( STAT_NavigationMemory, sizeof(*this) );
 
 		FindPathImplementation = FindPath;
-		FindHierarchicalPathImplementation = FindPath;
+		FindHierarchicalPathImplementation = FindHierarchicalPath;
 
 		TestPathImplementation = TestPath;
 		TestHierarchicalPathImplementation = TestHierarchicalPath;
@@ -1960,6 +1961,18 @@ FPathFindingResult ARecastNavMesh::FindPath(const FNavAgentProperties& AgentProp
 {
 	SCOPE_CYCLE_COUNTER(STAT_Navigation_RecastPathfinding);
 
+	return FindPathInternal(Query, /*bUseClusterCorridor=*/false);
+}
+
+FPathFindingResult ARecastNavMesh::FindHierarchicalPath(const FNavAgentProperties& AgentProperties, const FPathFindingQuery& Query)
+{
+	SCOPE_CYCLE_COUNTER(STAT_Navigation_RecastPathfinding);
+
+	return FindPathInternal(Query, /*bUseClusterCorridor=*/true);
+}
+
+FPathFindingResult ARecastNavMesh::FindPathInternal(const FPathFindingQuery& Query, const bool bUseClusterCorridor)
+{
 	const ANavigationData* Self = Query.NavData.Get();
 	check(Cast<const ARecastNavMesh>(Self));
 
@@ -2000,7 +2013,7 @@ FPathFindingResult ARecastNavMesh::FindPath(const FNavAgentProperties& AgentProp
 		}
 		else
 		{
-			Result.Result = RecastNavMesh->RecastNavMeshImpl->FindPath(Query.StartLocation, AdjustedEndLocation, *NavMeshPath, *NavFilter, Query.Owner.Get());
+			Result.Result = RecastNavMesh->RecastNavMeshImpl->FindPath(Query.StartLocation, AdjustedEndLocation, *NavMeshPath, *NavFilter, Query.Owner.Get(), bUseClusterCorridor);
 
 			const bool bPartialPath = Result.IsPartial();
 			if (bPartialPath)
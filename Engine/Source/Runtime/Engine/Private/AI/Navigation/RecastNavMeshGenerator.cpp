@@ -3423,7 +3423,7 @@ void FRecastNavMeshGenerator::TickAsyncBuild(float DeltaSeconds)
 	const bool bDoAsyncDataGathering = GatherGeometryOnGameThread() == false;
 
 	const int32 NumTasksToSubmit = (bDoAsyncDataGathering ? 1 : MaxTileGeneratorTasks) - NumRunningTasks;
-	TArray<uint32> UpdatedTileIndices = ProcessTileTasks(NumTasksToSubmit);
+	TArray<uint32> UpdatedTileIndices = ProcessTileTasks(NumTasksToSubmit, DestNavMesh->GetTileGenerationSetupBudgetMs() / 1000.f);
 			
 	if (UpdatedTileIndices.Num() > 0)
 	{
@@ -4006,6 +4006,17 @@ void FRecastNavMeshGenerator::SortPendingBuildTiles()
 		}
 	}
 
+	// Navigation invokers are where AI needs the navmesh
+	if (const UNavigationSystem* NavSys = UNavigationSystem::GetCurrent(CurWorld))
+	{
+		TArray<FVector> InvokerLocations;
+		NavSys->GetInvokerLocations(InvokerLocations);
+		for (const FVector& InvokerLocation : InvokerLocations)
+		{
+			SeedLocations.Add(FVector2D(InvokerLocation));
+		}
+	}
+
 	if (SeedLocations.Num() == 0)
 	{
 		// Use navmesh origin for sorting
@@ -4019,6 +4030,9 @@ void FRecastNavMeshGenerator::SortPendingBuildTiles()
 		// Calculate shortest distances between tiles and players
 		for (FPendingTileElement& Element : PendingDirtyTiles)
 		{
+			// Seeds may have moved since this tile was last sorted
+			Element.SeedDistance = MAX_flt;
+
 			const FBox TileBox = CalculateTileBounds(Element.Coord.X, Element.Coord.Y, FVector::ZeroVector, TotalNavBounds, TileSizeInWorldUnits);
 			FVector2D TileCenter2D = FVector2D(TileBox.GetCenter());
 			for (FVector2D SeedLocation : SeedLocations)
@@ -4043,18 +4057,25 @@ TSharedRef<FRecastTileGenerator> FRecastNavMeshGenerator::CreateTileGenerator(co
 	return TileGenerator;
 }
 
-TArray<uint32> FRecastNavMeshGenerator::ProcessTileTasks(const int32 NumTasksToSubmit)
+TArray<uint32> FRecastNavMeshGenerator::ProcessTileTasks(const int32 NumTasksToSubmit, const float TimeBudgetSeconds)
 {
 	QUICK_SCOPE_CYCLE_COUNTER(STAT_RecastNavMeshGenerator_ProcessTileTasks);
 	
 	TArray<uint32> UpdatedTiles;
 	const bool bHasTasksAtStart = GetNumRemaningBuildTasks() > 0;
 	const bool bGameStaticNavMesh = IsGameStaticNavMesh(DestNavMesh);
+	const double SubmitEndTime = FPlatformTime::Seconds() + TimeBudgetSeconds;
 			
 	int32 NumSubmittedTasks = 0;
 	// Submit pending tile elements
 	for (int32 ElementIdx = PendingDirtyTiles.Num()-1; ElementIdx >= 0 && NumSubmittedTasks < NumTasksToSubmit; ElementIdx--)
 	{
+		// Tile setup gathers geometry on the game thread, leave the rest for the next frames once the budget is spent
+		if (TimeBudgetSeconds > 0.f && NumSubmittedTasks > 0 && FPlatformTime::Seconds() > SubmitEndTime)
+		{
+			break;
+		}
+
 		QUICK_SCOPE_CYCLE_COUNTER(STAT_RecastNavMeshGenerator_ProcessTileTasks_NewTasks);
 
 		FPendingTileElement& PendingElement = PendingDirtyTiles[ElementIdx];
@@ -108,6 +108,7 @@ void AActor::InitializeDefaults()
 	bBlockInput = false;
 	bCanBeDamaged = true;
 	bFindCameraComponentWhenViewTarget = true;
+	bCanBePooled = false;
 	bAllowReceiveTickEventOnDedicatedServer = true;
 	bRelevantForNetworkReplays = true;
 	bGenerateOverlapEventsDuringLevelStreaming = false;
@@ -132,6 +133,11 @@ FString FActorTickFunction::DiagnosticMessage()
 	return Target->GetFullName() + TEXT("[TickActor]");
 }
 
+const void* FActorTickFunction::GetTickBatchKey() const
+{
+	return Target ? Target->GetClass() : nullptr;
+}
+
 bool AActor::CheckDefaultSubobjectsInternal()
 {
 	bool Result = Super::CheckDefaultSubobjectsInternal();
@@ -2026,6 +2032,16 @@ void AActor::Reset()
 	K2_OnReset();
 }
 
+void AActor::OnReturnedToPool()
+{
+	GetWorldTimerManager().ClearAllTimersForObject(this);
+}
+
+void AActor::OnAcquiredFromPool()
+{
+	Reset();
+}
+
 void AActor::FellOutOfWorld(const UDamageType& dmgType)
 {
 	DisableComponentsSimulatePhysics();
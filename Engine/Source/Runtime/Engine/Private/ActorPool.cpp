@@ -0,0 +1,186 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "ActorPool.h"
+#include "HAL/IConsoleManager.h"
+#include "GameFramework/Actor.h"
+#include "Components/ActorComponent.h"
+#include "Engine/World.h"
+#include "Engine/Level.h"
+
+static TAutoConsoleVariable<int32> CVarActorPoolMaxPerClass(
+	TEXT("g.ActorPool.MaxPerClass"),
+	64,
+	TEXT("Maximum number of deactivated actors of one class the world's actor pool keeps for reuse. 0 disables pooling."));
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Actors Acquired From Pool"), STAT_ActorsAcquiredFromPool, STATGROUP_Game);
+
+FActorPool::FActorPool(UWorld* InWorld)
+	: World(InWorld)
+{
+}
+
+bool FActorPool::CanAcquire(const AActor* Actor) const
+{
+	if (Actor == nullptr || Actor->IsPendingKillPending())
+	{
+		return false;
+	}
+
+	// Don't hand out actors of levels that are hidden or on their way out
+	const ULevel* Level = Actor->GetLevel();
+	return Level && Level->bIsVisible && !Level->bIsBeingRemoved;
+}
+
+AActor* FActorPool::Acquire(UClass* Class, const FTransform& Transform, AActor* Owner, APawn* Instigator)
+{
+	check(IsInGameThread());
+
+	TArray<FPooledActor>* Pool = PooledActors.Find(Class);
+	if (Pool == nullptr)
+	{
+		return nullptr;
+	}
+
+	for (int32 Index = Pool->Num() - 1; Index >= 0; --Index)
+	{
+		const FPooledActor Pooled = (*Pool)[Index];
+		AActor* Actor = Pooled.Actor.Get();
+		if (Actor == nullptr || Actor->IsPendingKillPending())
+		{
+			// Destroyed or streamed out while pooled
+			Pool->RemoveAtSwap(Index, 1, false);
+			continue;
+		}
+
+		if (!CanAcquire(Actor))
+		{
+			// Level is hidden, keep it for when the level is visible again
+			continue;
+		}
+
+		Pool->RemoveAtSwap(Index, 1, false);
+
+		INC_DWORD_STAT(STAT_ActorsAcquiredFromPool);
+
+		Actor->SetOwner(Owner);
+		Actor->Instigator = Instigator;
+		Actor->SetActorTransform(Transform, false, nullptr, ETeleportType::TeleportPhysics);
+
+		const AActor* DefaultActor = Actor->GetClass()->GetDefaultObject<AActor>();
+		Actor->SetActorHiddenInGame(DefaultActor->bHidden);
+		Actor->SetActorEnableCollision(DefaultActor->GetActorEnableCollision());
+		Actor->SetActorTickEnabled(Actor->PrimaryActorTick.bStartWithTickEnabled);
+
+		for (UActorComponent* Component : Actor->GetComponents())
+		{
+			if (Component)
+			{
+				Component->SetComponentTickEnabled(Component->PrimaryComponentTick.bStartWithTickEnabled);
+				if (Component->bAutoActivate)
+				{
+					Component->Activate(true);
+				}
+			}
+		}
+
+		if (Actor->GetIsReplicated())
+		{
+			Actor->SetNetDormancy(Pooled.NetDormancy);
+			if (Pooled.NetDormancy == DORM_DormantAll)
+			{
+				// Was dormant before being pooled too, send the new state once anyway
+				Actor->FlushNetDormancy();
+			}
+		}
+
+		Actor->OnAcquiredFromPool();
+		return Actor;
+	}
+
+	return nullptr;
+}
+
+bool FActorPool::Release(AActor* Actor)
+{
+	check(IsInGameThread());
+
+	if (!CanAcquire(Actor) || !Actor->bCanBePooled || Actor->GetWorld() != World || !World->IsGameWorld())
+	{
+		return false;
+	}
+
+	TArray<FPooledActor>& Pool = PooledActors.FindOrAdd(Actor->GetClass());
+	if (Pool.Num() >= CVarActorPoolMaxPerClass.GetValueOnGameThread())
+	{
+		return false;
+	}
+
+	for (const FPooledActor& Pooled : Pool)
+	{
+		if (!ensureMsgf(Pooled.Actor.Get() != Actor, TEXT("%s was released to the actor pool twice"), *Actor->GetName()))
+		{
+			return true;
+		}
+	}
+
+	Actor->OnReturnedToPool();
+
+	FPooledActor& Pooled = Pool[Pool.AddDefaulted()];
+	Pooled.Actor = Actor;
+	Pooled.NetDormancy = Actor->NetDormancy;
+
+	Actor->SetActorHiddenInGame(true);
+	Actor->SetActorEnableCollision(false);
+	Actor->SetActorTickEnabled(false);
+
+	for (UActorComponent* Component : Actor->GetComponents())
+	{
+		if (Component)
+		{
+			Component->Deactivate();
+			Component->SetComponentTickEnabled(false);
+		}
+	}
+
+	// Stop replicating the actor while it's pooled, clients keep the hidden state they received last
+	if (Actor->GetIsReplicated())
+	{
+		Actor->SetNetDormancy(DORM_DormantAll);
+	}
+
+	Actor->SetOwner(nullptr);
+	Actor->Instigator = nullptr;
+
+	return true;
+}
+
+void FActorPool::ReleaseOrDestroy(AActor* Actor)
+{
+	if (Actor && !Release(Actor))
+	{
+		Actor->Destroy();
+	}
+}
+
+int32 FActorPool::GetNumPooled(UClass* Class) const
+{
+	const TArray<FPooledActor>* Pool = PooledActors.Find(Class);
+	return Pool ? Pool->Num() : 0;
+}
+
+void FActorPool::Empty()
+{
+	TMap<TWeakObjectPtr<UClass>, TArray<FPooledActor>> ActorsToDestroy;
+	Exchange(ActorsToDestroy, PooledActors);
+
+	for (const TPair<TWeakObjectPtr<UClass>, TArray<FPooledActor>>& Pair : ActorsToDestroy)
+	{
+		for (const FPooledActor& Pooled : Pair.Value)
+		{
+			if (AActor* Actor = Pooled.Actor.Get())
+			{
+				Actor->Destroy();
+			}
+		}
+	}
+}
@@ -5,6 +5,7 @@
 =============================================================================*/ 
 
 #include "Animation/AnimSequence.h"
+#include "HAL/LowLevelMemTracker.h"
 #include "Misc/MessageDialog.h"
 #include "Logging/LogScopedVerbosityOverride.h"
 #include "UObject/FrameworkObjectVersion.h"
@@ -221,6 +222,7 @@ static void LoadOldCompressedTrack(FArchive& Ar, FCompressedTrack& Dst, int32 By
 
 void UAnimSequence::Serialize(FArchive& Ar)
 {
+	LLM_SCOPE(ELLMTag::Animation);
 	Ar.UsingCustomVersion(FFrameworkObjectVersion::GUID);
 
 	FRawCurveTracks RawCurveCache;
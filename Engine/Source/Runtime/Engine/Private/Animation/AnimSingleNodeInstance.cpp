@@ -310,6 +310,25 @@ UAnimationAsset* UAnimSingleNodeInstance::GetCurrentAsset()
 	return CurrentAsset;
 }
 
+bool UAnimSingleNodeInstance::GetSharedPoseStateHash(float TimeTolerance, uint32& OutStateHash) const
+{
+	const FAnimSingleNodeInstanceProxy& Proxy = GetProxyOnAnyThread<FAnimSingleNodeInstanceProxy>();
+
+	// Montages and curve overrides blend in more than the asset
+	if (CurrentAsset == nullptr || IsAnyMontagePlaying() || Proxy.HasPreviewCurveOverride() || TimeTolerance <= 0.f)
+	{
+		return false;
+	}
+
+	OutStateHash = GetTypeHash(CurrentAsset);
+	OutStateHash = HashCombine(OutStateHash, GetTypeHash(FMath::FloorToInt(Proxy.GetCurrentTime() / TimeTolerance)));
+	if (CurrentAsset->IsA<UBlendSpaceBase>())
+	{
+		OutStateHash = HashCombine(OutStateHash, GetTypeHash(Proxy.GetBlendSpaceInput()));
+	}
+	return true;
+}
+
 float UAnimSingleNodeInstance::GetCurrentTime() const
 {
 	return GetProxyOnGameThread<FAnimSingleNodeInstanceProxy>().GetCurrentTime();
@@ -61,12 +61,51 @@ FORCEINLINE void BlendPose(const FTransformArrayA2& SourcePoses, FTransformArray
 	}
 }
 
-template <int32 TRANSFORM_BLEND_MODE>
-FORCEINLINE void BlendPose(const FCompactPose& SourcePose, FCompactPose& ResultPose, const float BlendWeight)
+/**
+ * Blends all source poses into the result in a single pass over the bones.
+ * Each result bone stays in registers while every pose is accumulated into it and its rotation is normalized,
+ * instead of being stored and reloaded once per source pose and once more to normalize.
+ */
+template <typename GetSourcePoseType, typename GetSourceWeightType>
+FORCEINLINE void BlendPosesInOnePass(int32 NumPoses, GetSourcePoseType GetSourcePose, GetSourceWeightType GetSourceWeight, FCompactPose& ResultPose)
 {
-	for (FCompactPoseBoneIndex BoneIndex : SourcePose.ForEachBoneIndex())
+	const int32 NumBones = ResultPose.GetNumBones();
+	if (NumBones == 0)
 	{
-		BlendTransform<TRANSFORM_BLEND_MODE>(SourcePose[BoneIndex], ResultPose[BoneIndex], BlendWeight);
+		return;
+	}
+
+	TArray<const FTransform*, TInlineAllocator<16>> SourceBones;
+	TArray<float, TInlineAllocator<16>> SourceWeights;
+	SourceBones.AddUninitialized(NumPoses);
+	SourceWeights.AddUninitialized(NumPoses);
+
+	for (int32 PoseIndex = 0; PoseIndex < NumPoses; ++PoseIndex)
+	{
+		const FCompactPose& SourcePose = GetSourcePose(PoseIndex);
+		check(SourcePose.GetNumBones() == NumBones);
+		SourceBones[PoseIndex] = SourcePose.GetBones().GetData();
+		SourceWeights[PoseIndex] = GetSourceWeight(PoseIndex);
+	}
+
+	const bool bNormalizeRotations = NumPoses > 1;
+	FTransform* ResultBones = &ResultPose[FCompactPoseBoneIndex(0)];
+
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+	{
+		FTransform BlendedBone = SourceBones[0][BoneIndex] * ScalarRegister(SourceWeights[0]);
+
+		for (int32 PoseIndex = 1; PoseIndex < NumPoses; ++PoseIndex)
+		{
+			BlendedBone.AccumulateWithShortestRotation(SourceBones[PoseIndex][BoneIndex], ScalarRegister(SourceWeights[PoseIndex]));
+		}
+
+		if (bNormalizeRotations)
+		{
+			BlendedBone.NormalizeRotation();
+		}
+
+		ResultBones[BoneIndex] = BlendedBone;
 	}
 }
 
@@ -149,18 +188,11 @@ void FAnimationRuntime::BlendPosesTogether(
 {
 	check(SourcePoses.Num() > 0);
 
-	BlendPose<ETransformBlendMode::Overwrite>(SourcePoses[0], ResultPose, SourceWeights[0]);
-
-	for (int32 PoseIndex = 1; PoseIndex < SourcePoses.Num(); ++PoseIndex)
-	{
-		BlendPose<ETransformBlendMode::Accumulate>(SourcePoses[PoseIndex], ResultPose, SourceWeights[PoseIndex]);
-	}
-
-	// Ensure that all of the resulting rotations are normalized
-	if (SourcePoses.Num() > 1)
-	{
-		ResultPose.NormalizeRotations();
-	}
+	// Resulting rotations are normalized when more than one pose is blended
+	BlendPosesInOnePass(SourcePoses.Num(),
+		[&SourcePoses](int32 PoseIndex) -> const FCompactPose& { return SourcePoses[PoseIndex]; },
+		[&SourceWeights](int32 PoseIndex) { return SourceWeights[PoseIndex]; },
+		ResultPose);
 
 	// curve blending if exists
 	if (SourceCurves.Num() > 0)
@@ -179,18 +211,11 @@ void FAnimationRuntime::BlendPosesTogether(
 {
 	check(SourcePoses.Num() > 0);
 
-	BlendPose<ETransformBlendMode::Overwrite>(SourcePoses[0], ResultPose, SourceWeights[SourceWeightsIndices[0]]);
-
-	for (int32 PoseIndex = 1; PoseIndex < SourcePoses.Num(); ++PoseIndex)
-	{
-		BlendPose<ETransformBlendMode::Accumulate>(SourcePoses[PoseIndex], ResultPose, SourceWeights[SourceWeightsIndices[PoseIndex]]);
-	}
-
-	// Ensure that all of the resulting rotations are normalized
-	if (SourcePoses.Num() > 1)
-	{
-		ResultPose.NormalizeRotations();
-	}
+	// Resulting rotations are normalized when more than one pose is blended
+	BlendPosesInOnePass(SourcePoses.Num(),
+		[&SourcePoses](int32 PoseIndex) -> const FCompactPose& { return SourcePoses[PoseIndex]; },
+		[&SourceWeights, &SourceWeightsIndices](int32 PoseIndex) { return SourceWeights[SourceWeightsIndices[PoseIndex]]; },
+		ResultPose);
 
 	// curve blending if exists
 	if (SourceCurves.Num() > 0)
@@ -208,18 +233,11 @@ void FAnimationRuntime::BlendPosesTogetherIndirect(
 {
 	check(SourcePoses.Num() > 0);
 
-	BlendPose<ETransformBlendMode::Overwrite>(*SourcePoses[0], ResultPose, SourceWeights[0]);
-
-	for (int32 PoseIndex = 1; PoseIndex < SourcePoses.Num(); ++PoseIndex)
-	{
-		BlendPose<ETransformBlendMode::Accumulate>(*SourcePoses[PoseIndex], ResultPose, SourceWeights[PoseIndex]);
-	}
-
-	// Ensure that all of the resulting rotations are normalized
-	if (SourcePoses.Num() > 1)
-	{
-		ResultPose.NormalizeRotations();
-	}
+	// Resulting rotations are normalized when more than one pose is blended
+	BlendPosesInOnePass(SourcePoses.Num(),
+		[&SourcePoses](int32 PoseIndex) -> const FCompactPose& { return *SourcePoses[PoseIndex]; },
+		[&SourceWeights](int32 PoseIndex) { return SourceWeights[PoseIndex]; },
+		ResultPose);
 
 	if (SourceCurves.Num() > 0)
 	{
@@ -236,11 +254,12 @@ void FAnimationRuntime::BlendTwoPosesTogether(
 	/*out*/ FCompactPose& ResultPose,
 	/*out*/ FBlendedCurve& ResultCurve)
 {
-	BlendPose<ETransformBlendMode::Overwrite>(SourcePose1, ResultPose, WeightOfPose1);
-	BlendPose<ETransformBlendMode::Accumulate>(SourcePose2, ResultPose, 1.f - WeightOfPose1);
+	// Also normalizes the resulting rotations
+	BlendPosesInOnePass(2,
+		[&SourcePose1, &SourcePose2](int32 PoseIndex) -> const FCompactPose& { return PoseIndex == 0 ? SourcePose1 : SourcePose2; },
+		[WeightOfPose1](int32 PoseIndex) { return PoseIndex == 0 ? WeightOfPose1 : 1.f - WeightOfPose1; },
+		ResultPose);
 
-	// Ensure that all of the resulting rotations are normalized
-	ResultPose.NormalizeRotations();
 	ResultCurve.Lerp(SourceCurve1, SourceCurve2, 1.f - WeightOfPose1);
 }
 
@@ -586,24 +605,9 @@ void FAnimationRuntime::ConvertMeshRotationPoseToLocalSpace(FCompactPose& Pose)
 	}
 }
 
-void FAnimationRuntime::AccumulateAdditivePose(FCompactPose& BasePose, const FCompactPose& AdditivePose, FBlendedCurve& BaseCurve, const FBlendedCurve& AdditiveCurve, float Weight, enum EAdditiveAnimationType AdditiveType)
-{
-	if (AdditiveType == AAT_RotationOffsetMeshSpace)
-	{
-		AccumulateMeshSpaceRotationAdditiveToLocalPose(BasePose, AdditivePose, BaseCurve, AdditiveCurve, Weight);
-	}
-	else
-	{
-		AccumulateLocalSpaceAdditivePose(BasePose, AdditivePose, BaseCurve, AdditiveCurve, Weight);
-	}
-
-	// if curve exists, accumulate with the weight, 
-	BaseCurve.Accumulate(AdditiveCurve, Weight);
-	// normalize
-	BasePose.NormalizeRotations();
-}
-
-void FAnimationRuntime::AccumulateLocalSpaceAdditivePose(FCompactPose& BasePose, const FCompactPose& AdditivePose, FBlendedCurve& BaseCurve, const FBlendedCurve& AdditiveCurve, float Weight)
+/** Accumulates weighted AdditivePose to BasePose, optionally normalizing each rotation right after it is accumulated */
+template <bool bNormalizeRotations>
+static void AccumulateLocalSpaceAdditiveBones(FCompactPose& BasePose, const FCompactPose& AdditivePose, float Weight)
 {
 	if (Weight > ZERO_ANIMWEIGHT_THRESH)
 	{
@@ -613,7 +617,12 @@ void FAnimationRuntime::AccumulateLocalSpaceAdditivePose(FCompactPose& BasePose,
 			// fast path, no need to weight additive.
 			for (FCompactPoseBoneIndex BoneIndex : BasePose.ForEachBoneIndex())
 			{
-				BasePose[BoneIndex].AccumulateWithAdditiveScale(AdditivePose[BoneIndex], VBlendWeight);
+				FTransform& BaseBone = BasePose[BoneIndex];
+				BaseBone.AccumulateWithAdditiveScale(AdditivePose[BoneIndex], VBlendWeight);
+				if (bNormalizeRotations)
+				{
+					BaseBone.NormalizeRotation();
+				}
 			}
 		}
 		else
@@ -623,10 +632,42 @@ void FAnimationRuntime::AccumulateLocalSpaceAdditivePose(FCompactPose& BasePose,
 			{
 				// copy additive, because BlendFromIdentityAndAccumulate modifies it.
 				FTransform Additive = AdditivePose[BoneIndex];
-				FTransform::BlendFromIdentityAndAccumulate(BasePose[BoneIndex], Additive, VBlendWeight);
+				FTransform& BaseBone = BasePose[BoneIndex];
+				FTransform::BlendFromIdentityAndAccumulate(BaseBone, Additive, VBlendWeight);
+				if (bNormalizeRotations)
+				{
+					BaseBone.NormalizeRotation();
+				}
 			}
 		}
 	}
+	else if (bNormalizeRotations)
+	{
+		BasePose.NormalizeRotations();
+	}
+}
+
+void FAnimationRuntime::AccumulateAdditivePose(FCompactPose& BasePose, const FCompactPose& AdditivePose, FBlendedCurve& BaseCurve, const FBlendedCurve& AdditiveCurve, float Weight, enum EAdditiveAnimationType AdditiveType)
+{
+	if (AdditiveType == AAT_RotationOffsetMeshSpace)
+	{
+		AccumulateMeshSpaceRotationAdditiveToLocalPose(BasePose, AdditivePose, BaseCurve, AdditiveCurve, Weight);
+		// normalize
+		BasePose.NormalizeRotations();
+	}
+	else
+	{
+		// normalizes while the bones are accumulated
+		AccumulateLocalSpaceAdditiveBones<true>(BasePose, AdditivePose, Weight);
+	}
+
+	// if curve exists, accumulate with the weight, 
+	BaseCurve.Accumulate(AdditiveCurve, Weight);
+}
+
+void FAnimationRuntime::AccumulateLocalSpaceAdditivePose(FCompactPose& BasePose, const FCompactPose& AdditivePose, FBlendedCurve& BaseCurve, const FBlendedCurve& AdditiveCurve, float Weight)
+{
+	AccumulateLocalSpaceAdditiveBones<false>(BasePose, AdditivePose, Weight);
 }
 
 void FAnimationRuntime::AccumulateMeshSpaceRotationAdditiveToLocalPose(FCompactPose& BasePose, const FCompactPose& MeshSpaceRotationAdditive, FBlendedCurve& BaseCurve, const FBlendedCurve& AdditiveCurve, float Weight)
@@ -34,6 +34,7 @@ DEFINE_STAT(STAT_AudioSources);
 DEFINE_STAT(STAT_WaveInstances);
 DEFINE_STAT(STAT_WavesDroppedDueToPriority);
 DEFINE_STAT(STAT_AudibleWavesDroppedDueToPriority);
+DEFINE_STAT(STAT_VirtualWaveInstances);
 DEFINE_STAT(STAT_AudioFinishedDelegatesCalled);
 DEFINE_STAT(STAT_AudioFinishedDelegates);
 DEFINE_STAT(STAT_AudioBufferTime);
@@ -682,9 +683,11 @@ FWaveInstance::FWaveInstance( FActiveSound* InActiveSound )
 	, LFEBleed(0.0f)
 	, LoopingMode(LOOP_Never)
 	, StartTime(-1.f)
+	, VirtualPlaybackTime(0.0f)
 	, bApplyRadioFilter(false)
 	, bIsStarted(false)
 	, bIsFinished(false)
+	, bIsVirtual(false)
 	, bAlreadyNotifiedHook(false)
 	, bUseSpatialization(false)
 	, bEnableLowPassFilter(false)
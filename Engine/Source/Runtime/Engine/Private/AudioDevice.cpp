@@ -1,6 +1,7 @@
 // Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
 
 #include "AudioDevice.h"
+#include "HAL/LowLevelMemTracker.h"
 #include "PhysicsEngine/BodyInstance.h"
 #include "Sound/SoundEffectPreset.h"
 #include "Sound/SoundEffectSubmix.h"
@@ -44,6 +45,14 @@ FAutoConsoleVariableRef CVarSetAudioChannelCount(
 	TEXT("0: Disable, >0: Enable"),
 	ECVF_Default);
 
+static int32 VirtualizeLoopingSoundsCVar = 1;
+FAutoConsoleVariableRef CVarVirtualizeLoopingSounds(
+	TEXT("au.VirtualizeLoopingSounds"),
+	VirtualizeLoopingSoundsCVar,
+	TEXT("When set, looping sounds that are silent or dropped for priority give up their voice but keep tracking their playback time, and resume where they would be once they get a voice again.\n")
+	TEXT("0: Disable, 1: Enable (default)"),
+	ECVF_Default);
+
 
 /*-----------------------------------------------------------------------------
 FDynamicParameter implementation.
@@ -2929,6 +2938,12 @@ void FAudioDevice::StopSources(TArray<FWaveInstance*>& WaveInstances, int32 Firs
 		FSoundSource* Source = WaveInstanceSourceMap.FindRef(WaveInstance);
 		if (Source)
 		{
+			// Silent sounds that can be virtualized give up their source below
+			if (WaveInstance->GetVolume() <= KINDA_SMALL_NUMBER && CanVirtualizeWaveInstance(WaveInstance))
+			{
+				continue;
+			}
+
 			Source->LastUpdate = CurrentTick;
 
 			// If they are still audible, mark them as such
@@ -2956,7 +2971,14 @@ void FAudioDevice::StopSources(TArray<FWaveInstance*>& WaveInstances, int32 Firs
 			// Source was not one of the active sounds this tick so needs to be stopped
 			else if (Source->LastUpdate != CurrentTick)
 			{
-				Source->Stop();
+				if (CanVirtualizeWaveInstance(Source->WaveInstance))
+				{
+					StopSourceAndVirtualize(Source);
+				}
+				else
+				{
+					Source->Stop();
+				}
 			}
 			else
 			{
@@ -2977,6 +2999,13 @@ void FAudioDevice::StopSources(TArray<FWaveInstance*>& WaveInstances, int32 Firs
 	{
 		FWaveInstance* WaveInstance = WaveInstances[ InstanceIndex ];
 		WaveInstance->StopWithoutNotification();
+
+		// Sounds that never got a source start playing virtually from their start time
+		if (!WaveInstance->bIsVirtual && CanVirtualizeWaveInstance(WaveInstance))
+		{
+			WaveInstance->bIsVirtual = true;
+			WaveInstance->VirtualPlaybackTime = FMath::Max(WaveInstance->StartTime, 0.0f);
+		}
 	}
 
 #if STATS
@@ -2994,6 +3023,71 @@ void FAudioDevice::StopSources(TArray<FWaveInstance*>& WaveInstances, int32 Firs
 #endif
 }
 
+bool FAudioDevice::CanVirtualizeWaveInstance(const FWaveInstance* WaveInstance) const
+{
+	// Only indefinitely looping sounds, one shots would need their finished notifications sent on time.
+	// Procedural sounds can't be seeked so there's no position to resume them at.
+	return VirtualizeLoopingSoundsCVar && bAllowVirtualizedSounds
+		&& WaveInstance->LoopingMode == LOOP_Forever
+		&& WaveInstance->WaveData && !WaveInstance->WaveData->bProcedural;
+}
+
+void FAudioDevice::StopSourceAndVirtualize(FSoundSource* Source)
+{
+	FWaveInstance* WaveInstance = Source->WaveInstance;
+	check(WaveInstance);
+
+	const float PlaybackTime = Source->PlaybackTime;
+
+	// The wave instance only loses its voice, so don't let stopping the source notify the finished hooks
+	const bool bAlreadyNotifiedHook = WaveInstance->bAlreadyNotifiedHook;
+	WaveInstance->bAlreadyNotifiedHook = true;
+	Source->Stop();
+	WaveInstance->bAlreadyNotifiedHook = bAlreadyNotifiedHook;
+
+	WaveInstance->bIsVirtual = true;
+	WaveInstance->VirtualPlaybackTime = PlaybackTime;
+}
+
+void FAudioDevice::UpdateVirtualWaveInstances(TArray<FWaveInstance*>& WaveInstances, bool bGameTicking)
+{
+	int32 NumVirtualWaveInstances = 0;
+
+	for (FWaveInstance* WaveInstance : WaveInstances)
+	{
+		if (!WaveInstance->bIsVirtual)
+		{
+			continue;
+		}
+
+		++NumVirtualWaveInstances;
+
+		if (WaveInstance->bIsPaused || !(bGameTicking || WaveInstance->bIsUISound))
+		{
+			continue;
+		}
+
+		// Advance the same way FSoundSource::UpdateCommon would if the sound had a source
+		float Pitch = WaveInstance->Pitch;
+		if (!WaveInstance->bIsUISound)
+		{
+			Pitch *= GetGlobalPitchScale().GetValue();
+		}
+		Pitch = FMath::Clamp<float>(Pitch, MIN_PITCH, MAX_PITCH);
+
+		WaveInstance->VirtualPlaybackTime += DeviceDeltaTime * Pitch;
+
+		// GetDuration reports looping waves as indefinite, wrap on the length of the wave data itself
+		const float Duration = WaveInstance->WaveData->Duration;
+		if (Duration > 0.0f)
+		{
+			WaveInstance->VirtualPlaybackTime = FMath::Fmod(WaveInstance->VirtualPlaybackTime, Duration);
+		}
+	}
+
+	INC_DWORD_STAT_BY(STAT_VirtualWaveInstances, NumVirtualWaveInstances);
+}
+
 void FAudioDevice::StartSources(TArray<FWaveInstance*>& WaveInstances, int32 FirstActiveIndex, bool bGameTicking)
 {
 	check(IsInAudioThread());
@@ -3009,6 +3103,24 @@ void FAudioDevice::StartSources(TArray<FWaveInstance*>& WaveInstances, int32 Fir
 		if (!WaveInstance->ShouldStopDueToMaxConcurrency() && (bGameTicking || WaveInstance->bIsUISound))
 		{
 			FSoundSource* Source = WaveInstanceSourceMap.FindRef(WaveInstance);
+
+			// Silent sounds that can be virtualized don't need a source until they become audible
+			if (!Source && WaveInstance->GetVolume() <= KINDA_SMALL_NUMBER && CanVirtualizeWaveInstance(WaveInstance))
+			{
+				if (!WaveInstance->bIsVirtual)
+				{
+					WaveInstance->bIsVirtual = true;
+					WaveInstance->VirtualPlaybackTime = FMath::Max(WaveInstance->StartTime, 0.0f);
+				}
+				continue;
+			}
+
+			// Virtual sounds resume where they would have been
+			if (WaveInstance->bIsVirtual)
+			{
+				WaveInstance->StartTime = WaveInstance->VirtualPlaybackTime;
+			}
+
 			if (!Source &&
 				(!WaveInstance->IsStreaming() ||
 				IStreamingManager::Get().GetAudioStreamingManager().CanCreateSoundSource(WaveInstance)))
@@ -3033,6 +3145,12 @@ void FAudioDevice::StartSources(TArray<FWaveInstance*>& WaveInstances, int32 Fir
 						// If we succeeded then play and update the source
 						if (bSuccess)
 						{
+							if (WaveInstance->bIsVirtual)
+							{
+								Source->PlaybackTime = WaveInstance->StartTime;
+								WaveInstance->bIsVirtual = false;
+							}
+
 							// Set the pause before updating it
 							Source->SetPauseManually(Source->WaveInstance->bIsPaused);
 
@@ -3080,6 +3198,13 @@ void FAudioDevice::StartSources(TArray<FWaveInstance*>& WaveInstances, int32 Fir
 					{
 						// Note: if we succeeded in starting to prepare to init, we already added the wave instance map to the source so don't need to add here.
 						check(Source->IsInitialized());
+
+						if (WaveInstance->bIsVirtual)
+						{
+							Source->PlaybackTime = WaveInstance->StartTime;
+							WaveInstance->bIsVirtual = false;
+						}
+
 						Source->Play();
 
 						Source->Update();
@@ -3107,6 +3232,7 @@ void FAudioDevice::StartSources(TArray<FWaveInstance*>& WaveInstances, int32 Fir
 
 void FAudioDevice::Update(bool bGameTicking)
 {
+	LLM_SCOPE(ELLMTag::Audio);
 	if (!IsInAudioThread())
 	{
 
@@ -3213,6 +3339,9 @@ void FAudioDevice::Update(bool bGameTicking)
 		// Stop sources that need to be stopped, and touch the ones that need to be kept alive
 		StopSources(ActiveWaveInstances, FirstActiveIndex);
 
+		// Advance the playback time of sounds that are playing without a source
+		UpdateVirtualWaveInstances(ActiveWaveInstances, bGameTicking);
+
 		// Start and/or update any sources that have a high enough priority to play
 		StartSources(ActiveWaveInstances, FirstActiveIndex, bGameTicking);
 
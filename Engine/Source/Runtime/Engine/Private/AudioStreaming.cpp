@@ -24,6 +24,15 @@ FAutoConsoleVariableRef CVarSpoofFailedStreamChunkLoad(
 	TEXT("0: Not Enabled, 1: Enabled"),
 	ECVF_Default);
 
+static int32 StreamingReadAheadChunksCvar = 1;
+FAutoConsoleVariableRef CVarStreamingReadAheadChunks(
+	TEXT("au.StreamingReadAheadChunks"),
+	StreamingReadAheadChunksCvar,
+	TEXT("Number of chunks after the one a streaming source is playing that are kept loaded.
+")
+	TEXT("Raise it when streamed sounds drop out because chunk reads can't keep up with playback."),
+	ECVF_Default);
+
 
 /*------------------------------------------------------------------------------
 	Streaming chunks from the derived data cache.
@@ -519,20 +528,30 @@ void FAudioStreamingManager::UpdateResourceStreaming(float DeltaTime, bool bProc
 			if (WaveDataPtr && (*WaveDataPtr)->PendingChunkChangeRequestStatus.GetValue() == AudioState_ReadyFor_Requests)
 			{
 				FStreamingWaveData* WaveData = *WaveDataPtr;
-				// Request the chunk the source is using and the one after that
+				// Request the chunk the source is using and the ones after that
 				FWaveRequest& WaveRequest = GetWaveRequest(Wave);
 				const FSoundBuffer* SoundBuffer = Source->GetBuffer();
 				if (SoundBuffer)
 				{
+					const int32 NumChunks = Wave->RunningPlatformData->NumChunks;
 					int32 SourceChunk = SoundBuffer->GetCurrentChunkIndex();
-					if (SourceChunk >= 0 && SourceChunk < Wave->RunningPlatformData->NumChunks)
+					if (SourceChunk >= 0 && SourceChunk < NumChunks)
 					{
 						WaveRequest.RequiredIndices.AddUnique(SourceChunk);
-						WaveRequest.RequiredIndices.AddUnique((SourceChunk + 1) % Wave->RunningPlatformData->NumChunks);
+
+						const int32 NumReadAheadChunks = FMath::Clamp(StreamingReadAheadChunksCvar, 1, NumChunks - 1);
+						bool bReadAheadLoaded = true;
+						for (int32 ReadAheadIndex = 1; ReadAheadIndex <= NumReadAheadChunks; ++ReadAheadIndex)
+						{
+							const int32 ReadAheadChunk = (SourceChunk + ReadAheadIndex) % NumChunks;
+							WaveRequest.RequiredIndices.AddUnique(ReadAheadChunk);
+							bReadAheadLoaded &= WaveData->LoadedChunkIndices.Contains(ReadAheadChunk);
+						}
+
 						if (!WaveData->LoadedChunkIndices.Contains(SourceChunk)
-							|| SoundBuffer->GetCurrentChunkOffset() > Wave->RunningPlatformData->Chunks[SourceChunk].DataSize / 2)
+							|| (!bReadAheadLoaded && SoundBuffer->GetCurrentChunkOffset() > Wave->RunningPlatformData->Chunks[SourceChunk].DataSize / 2))
 						{
-							// currently not loaded or already read over half, request is high priority
+							// currently not loaded, or already read over half while the next chunks aren't loaded yet, request is high priority
 							WaveRequest.bPrioritiseRequest = true;
 						}
 					}
@@ -18,6 +18,7 @@
 #include "AnalyticsEventAttribute.h"
 #include "GameFramework/GameUserSettings.h"
 #include "Performance/EnginePerformanceTargets.h"
+#include "ProfilingDebugging/CsvProfiler.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogChartCreation, Log, All);
 
@@ -1202,6 +1203,20 @@ void FPerformanceTrackingSystem::StopCharting()
 
 void UEngine::TickPerformanceMonitoring(float DeltaSeconds)
 {
+#if CSV_PROFILER
+	if (FCsvProfiler::IsCapturing())
+	{
+		// Thread times are those of the previous frame, same as stat unit
+		CSV_CUSTOM_STAT(FrameTime, DeltaSeconds * 1000.0f, ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(GameThreadTime, FPlatformTime::ToMilliseconds(GGameThreadTime), ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(RenderThreadTime, FPlatformTime::ToMilliseconds(GRenderThreadTime), ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(GPUTime, FPlatformTime::ToMilliseconds(GGPUFrameTime), ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(DrawCalls, GNumDrawCallsRHI, ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(PrimitivesDrawn, GNumPrimitivesDrawnRHI, ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(PhysicalMemoryMB, FPlatformMemory::GetStats().UsedPhysical / (1024 * 1024), ECsvCustomStatOp::Set);
+	}
+#endif
+
 	if (ActivePerformanceDataConsumers.Num() > 0)
 	{
 		const IPerformanceDataConsumer::FFrameData FrameData = GPerformanceTrackingSystem.AnalyzeFrame(DeltaSeconds);
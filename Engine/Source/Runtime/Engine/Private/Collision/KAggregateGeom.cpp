@@ -5,6 +5,7 @@
 =============================================================================*/ 
 
 #include "CoreMinimal.h"
+#include "Containers/ArrayView.h"
 #include "EngineDefines.h"
 #include "PhysicsEngine/ShapeElem.h"
 #include "PhysicsEngine/ConvexElem.h"
@@ -644,10 +645,7 @@ void FKConvexElem::ConvexFromBoxElem(const FKBoxElem& InBox)
 
 void FKConvexElem::BakeTransformToVerts()
 {
-	for (int32 VertIdx = 0; VertIdx < VertexData.Num(); VertIdx++)
-	{
-		VertexData[VertIdx] = Transform.TransformPosition(VertexData[VertIdx]);
-	}
+	Transform.TransformPositions(VertexData, VertexData);
 
 	Transform = FTransform::Identity;
 	UpdateElemBox();
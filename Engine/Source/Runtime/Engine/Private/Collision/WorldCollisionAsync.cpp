@@ -7,6 +7,7 @@
 #include "CoreMinimal.h"
 #include "Stats/Stats.h"
 #include "Async/TaskGraphInterfaces.h"
+#include "Async/ParallelFor.h"
 #include "EngineDefines.h"
 #include "Engine/EngineTypes.h"
 #include "CollisionQueryParams.h"
@@ -312,6 +313,23 @@ namespace
 		#endif
 	}
 
+	/** Runs the datums in chunks of ASYNC_TRACE_BUFFER_SIZE on the task threads and waits for them */
+	template <typename DatumType>
+	void RunTraceBatch(UWorld* World, TArray<DatumType>& Data)
+	{
+		for (DatumType& Datum : Data)
+		{
+			Datum.PhysWorld = World;
+		}
+
+		const int32 NumChunks = FMath::DivideAndRoundUp(Data.Num(), ASYNC_TRACE_BUFFER_SIZE);
+		ParallelFor(NumChunks, [&Data](int32 ChunkIndex)
+		{
+			const int32 FirstIndex = ChunkIndex * ASYNC_TRACE_BUFFER_SIZE;
+			RunTraceTask(Data.GetData() + FirstIndex, FMath::Min(ASYNC_TRACE_BUFFER_SIZE, Data.Num() - FirstIndex));
+		}, NumChunks <= 1);
+	}
+
 	template <typename DatumType>
 	FTraceHandle StartNewTrace(FWorldAsyncTraceState& State, const DatumType& Val)
 	{
@@ -383,6 +401,34 @@ FTraceHandle UWorld::AsyncOverlapByObjectType(const FVector& Pos, const FQuat& R
 	return StartNewTrace(AsyncTraceState, FOverlapDatum(this, CollisionShape, Params, FCollisionResponseParams::DefaultResponseParam, ObjectQueryParams, DefaultCollisionChannel, UserData, Pos, Rot, InDelegate, AsyncTraceState.CurrentFrame));
 }
 
+void UWorld::BatchTrace(TArray<FTraceDatum>& Traces)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_BatchTrace);
+	RunTraceBatch(this, Traces);
+}
+
+void UWorld::BatchOverlap(TArray<FOverlapDatum>& Overlaps)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_BatchOverlap);
+	RunTraceBatch(this, Overlaps);
+}
+
+void UWorld::AsyncBatchTrace(const TArray<FTraceDatum>& Traces, TArray<FTraceHandle>& OutHandles)
+{
+	OutHandles.Reset(Traces.Num());
+
+	// Full buffers are dispatched as they fill up, so a large batch starts running on the task threads right away
+	FTraceDatum Datum;
+	for (const FTraceDatum& Trace : Traces)
+	{
+		Datum = Trace;
+		Datum.PhysWorld = this;
+		Datum.FrameNumber = AsyncTraceState.CurrentFrame;
+		Datum.OutHits.Reset();
+		OutHandles.Add(StartNewTrace(AsyncTraceState, Datum));
+	}
+}
+
 bool UWorld::IsTraceHandleValid(const FTraceHandle& Handle, bool bOverlapTrace)
 {
 	// only valid if it's previous frame or current frame
@@ -49,6 +49,13 @@ DECLARE_CYCLE_STAT(TEXT("Component DestroyRenderState"), STAT_ComponentDestroyRe
 DECLARE_CYCLE_STAT(TEXT("Component CreatePhysicsState"), STAT_ComponentCreatePhysicsState, STATGROUP_Component);
 DECLARE_CYCLE_STAT(TEXT("Component DestroyPhysicsState"), STAT_ComponentDestroyPhysicsState, STATGROUP_Component);
 
+static TAutoConsoleVariable<int32> CVarDeferRenderStateCreation(
+	TEXT("r.DeferRenderStateCreation"),
+	1,
+	TEXT("Whether components registered with a game world that allow it create their render state with the world's end of frame updates,\n")
+	TEXT("so that scene proxies of components spawned in the same frame are created in parallel and added to the scene together."),
+	ECVF_Default);
+
 // Should we tick latent actions fired for a component at the same time as the component?
 // - Non-zero values behave the same way as actors do, ticking pending latent action when the component ticks, instead of later on in the frame
 // - Prior to 4.16, components behaved as if the value were 0, which meant their latent actions behaved differently to actors
@@ -477,7 +484,7 @@ bool UActorComponent::NeedsLoadForClient() const
 bool UActorComponent::NeedsLoadForServer() const
 {
 	check(GetOuter());
-	return (!IsEditorOnly() && GetOuter()->NeedsLoadForServer() && Super::NeedsLoadForServer());
+	return (!IsEditorOnly() && !bIsCosmetic && GetOuter()->NeedsLoadForServer() && Super::NeedsLoadForServer());
 }
 
 int32 UActorComponent::GetFunctionCallspace( UFunction* Function, void* Parameters, FFrame* Stack )
@@ -781,6 +788,11 @@ FString FActorComponentTickFunction::DiagnosticMessage()
 	return Target->GetFullName() + TEXT("[TickComponent]");
 }
 
+const void* FActorComponentTickFunction::GetTickBatchKey() const
+{
+	return Target ? Target->GetClass() : nullptr;
+}
+
 bool UActorComponent::SetupActorComponentTickFunction(struct FTickFunction* TickFunction)
 {
 	if(TickFunction->bCanEverTick && !IsTemplate())
@@ -788,6 +800,12 @@ bool UActorComponent::SetupActorComponentTickFunction(struct FTickFunction* Tick
 		AActor* MyOwner = GetOwner();
 		if (!MyOwner || !MyOwner->IsTemplate())
 		{
+			// Covers cosmetic components of uncooked content and ones created at runtime, which a server still has
+			if (bIsCosmetic)
+			{
+				TickFunction->bAllowTickOnDedicatedServer = false;
+			}
+
 			ULevel* ComponentLevel = (MyOwner ? MyOwner->GetLevel() : GetWorld()->PersistentLevel);
 			TickFunction->SetTickFunctionEnable(TickFunction->bStartWithTickEnabled || TickFunction->IsTickFunctionEnabled());
 			TickFunction->RegisterTickFunction(ComponentLevel);
@@ -1225,9 +1243,18 @@ void UActorComponent::ExecuteRegisterEvents()
 
 	if(FApp::CanEverRender() && !bRenderStateCreated && WorldPrivate->Scene && ShouldCreateRenderState())
 	{
-		SCOPE_CYCLE_COUNTER(STAT_ComponentCreateRenderState);
-		CreateRenderState_Concurrent();
-		checkf(bRenderStateCreated, TEXT("Failed to route CreateRenderState_Concurrent (%s)"), *GetFullName());
+		if (CVarDeferRenderStateCreation.GetValueOnGameThread() != 0 && AllowsBatchedRenderStateCreation() && !bNeverNeedsRenderUpdate && WorldPrivate->IsGameWorld() && !WorldPrivate->bPostTickComponentUpdate)
+		{
+			// DoDeferredRenderUpdates_Concurrent creates the render state like a recreate, but with the parallel updates
+			bRenderStateDirty = true;
+			WorldPrivate->MarkActorComponentForNeededEndOfFrameUpdate(this, false);
+		}
+		else
+		{
+			SCOPE_CYCLE_COUNTER(STAT_ComponentCreateRenderState);
+			CreateRenderState_Concurrent();
+			checkf(bRenderStateCreated, TEXT("Failed to route CreateRenderState_Concurrent (%s)"), *GetFullName());
+		}
 	}
 
 	CreatePhysicsState();
@@ -1274,7 +1301,7 @@ void UActorComponent::RecreateRenderState_Concurrent()
 		checkf(!bRenderStateCreated, TEXT("Failed to route DestroyRenderState_Concurrent (%s)"), *GetFullName());
 	}
 
-	if(IsRegistered() && WorldPrivate->Scene)
+	if(FApp::CanEverRender() && IsRegistered() && WorldPrivate->Scene)
 	{
 		CreateRenderState_Concurrent();
 		checkf(bRenderStateCreated, TEXT("Failed to route CreateRenderState_Concurrent (%s)"), *GetFullName());
@@ -32,6 +32,7 @@
 #include "Engine/NetworkObjectList.h"
 
 #include "Net/PerfCountersHelpers.h"
+#include "Async/ParallelFor.h"
 
 
 DEFINE_LOG_CATEGORY_STATIC(LogCharacterMovement, Log, All);
@@ -118,6 +119,14 @@ namespace CharacterMovementCVars
 		TEXT("<0: Disable, >=0: Enable and log this often, in seconds."),
 		ECVF_Default);
 
+	static int32 ParallelFloorPrediction = 1;
+	FAutoConsoleVariableRef CVarParallelFloorPrediction(
+		TEXT("p.CharacterParallelFloorPrediction"),
+		ParallelFloorPrediction,
+		TEXT("Whether Characters using bPredictFloorInParallel predict their floor on worker threads.\n")
+		TEXT("0: Disable, 1: Enable"),
+		ECVF_Default);
+
 	static int32 NetEnableMoveCombining = 1;
 	FAutoConsoleVariableRef CVarNetEnableMoveCombining(
 		TEXT("p.NetEnableMoveCombining"),
@@ -352,6 +361,7 @@ UCharacterMovementComponent::UCharacterMovementComponent(const FObjectInitialize
 	bImpartBaseAngularVelocity = true;
 	bIgnoreClientMovementErrorChecksAndCorrection = false;
 	bAlwaysCheckFloor = true;
+	PredictedFloorFrame = 0;
 
 	// default character can jump, walk, and swim
 	NavAgentProps.bCanJump = true;
@@ -1153,6 +1163,11 @@ void UCharacterMovementComponent::TickComponent(float DeltaTime, enum ELevelTick
 				AnalogInputModifier = ComputeAnalogInputModifier();
 			}
 
+			if (bPredictFloorInParallel && CharacterOwner->Role == ROLE_Authority && !CharacterOwner->IsPlayerControlled())
+			{
+				PredictFloorsInParallel(this);
+			}
+
 			if (CharacterOwner->Role == ROLE_Authority)
 			{
 				PerformMovement(DeltaTime);
@@ -5835,7 +5850,16 @@ void UCharacterMovementComponent::FindFloor(const FVector& CapsuleLocation, FFin
 		if ( bAlwaysCheckFloor || !bZeroDelta || bForceNextFloorCheck || bJustTeleported )
 		{
 			MutableThis->bForceNextFloorCheck = false;
-			ComputeFloorDist(CapsuleLocation, FloorLineTraceDist, FloorSweepTraceDist, OutFloorResult, CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleRadius(), DownwardSweepResult);
+			if (CanUsePredictedFloor(CapsuleLocation, FloorLineTraceDist, FloorSweepTraceDist, DownwardSweepResult))
+			{
+				// Only used once, the character may find a floor here again after being moved by something else
+				OutFloorResult = PredictedFloor;
+				MutableThis->PredictedFloorFrame = 0;
+			}
+			else
+			{
+				ComputeFloorDist(CapsuleLocation, FloorLineTraceDist, FloorSweepTraceDist, OutFloorResult, CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleRadius(), DownwardSweepResult);
+			}
 		}
 		else
 		{
@@ -5907,6 +5931,90 @@ void UCharacterMovementComponent::FindFloor(const FVector& CapsuleLocation, FFin
 }
 
 
+void UCharacterMovementComponent::PredictFloorsInParallel(UCharacterMovementComponent* TickingComponent)
+{
+	check(IsInGameThread());
+
+	// Characters that used the prediction last frame are predicted when the first of them ticks this frame, in one parallel batch
+	static uint64 PredictedFrame = 0;
+	static TArray<TWeakObjectPtr<UCharacterMovementComponent>> ComponentsToPredict;
+	static TArray<TWeakObjectPtr<UCharacterMovementComponent>> ComponentsToPredictNextFrame;
+
+	if (PredictedFrame != GFrameCounter)
+	{
+		PredictedFrame = GFrameCounter;
+		Exchange(ComponentsToPredict, ComponentsToPredictNextFrame);
+		ComponentsToPredictNextFrame.Reset();
+
+		if (CharacterMovementCVars::ParallelFloorPrediction)
+		{
+			SCOPE_CYCLE_COUNTER(STAT_CharFindFloor);
+
+			TArray<UCharacterMovementComponent*, TInlineAllocator<256>> Components;
+			for (const TWeakObjectPtr<UCharacterMovementComponent>& Component : ComponentsToPredict)
+			{
+				UCharacterMovementComponent* MovementComponent = Component.Get();
+				if (MovementComponent && MovementComponent->HasValidData() && MovementComponent->MovementMode == MOVE_Walking && MovementComponent->GetWorld())
+				{
+					Components.Add(MovementComponent);
+				}
+			}
+
+			// The game thread waits here, so nothing moves while the floors are found
+			ParallelFor(Components.Num(), [&Components](int32 Index)
+			{
+				UCharacterMovementComponent* MovementComponent = Components[Index];
+				MovementComponent->PredictFloor(MovementComponent->GetWorld()->GetDeltaSeconds());
+			}, Components.Num() < 8);
+		}
+	}
+
+	ComponentsToPredictNextFrame.Add(TickingComponent);
+}
+
+void UCharacterMovementComponent::PredictFloor(float DeltaSeconds)
+{
+	PredictedFloorFrame = 0;
+
+	if (!UpdatedComponent->IsQueryCollisionEnabled() || MovementBaseUtility::IsDynamicBase(CharacterOwner->GetMovementBase()))
+	{
+		return;
+	}
+
+	// Walking keeps the velocity horizontal, see MaintainHorizontalGroundVelocity
+	const FVector Delta = FVector(Velocity.X, Velocity.Y, 0.f) * DeltaSeconds;
+	const FVector CapsuleLocation = UpdatedComponent->GetComponentLocation() + Delta;
+
+	// Same distances as FindFloor while walking
+	const float HeightCheckAdjust = MAX_FLOOR_DIST + KINDA_SMALL_NUMBER;
+	const float FloorSweepTraceDist = FMath::Max(MAX_FLOOR_DIST, MaxStepHeight + HeightCheckAdjust);
+	const float FloorLineTraceDist = FloorSweepTraceDist;
+
+	ComputeFloorDist(CapsuleLocation, FloorLineTraceDist, FloorSweepTraceDist, PredictedFloor, CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleRadius());
+
+	PredictedFloorLocation = CapsuleLocation;
+	PredictedFloorLineDist = FloorLineTraceDist;
+	PredictedFloorSweepDist = FloorSweepTraceDist;
+	PredictedFloorFrame = GFrameCounter;
+}
+
+bool UCharacterMovementComponent::CanUsePredictedFloor(const FVector& CapsuleLocation, float LineDistance, float SweepDistance, const FHitResult* DownwardSweepResult) const
+{
+	if (PredictedFloorFrame != GFrameCounter || DownwardSweepResult != nullptr || LineDistance != PredictedFloorLineDist || SweepDistance != PredictedFloorSweepDist)
+	{
+		return false;
+	}
+
+	if (!CapsuleLocation.Equals(PredictedFloorLocation, KINDA_SMALL_NUMBER))
+	{
+		return false;
+	}
+
+	// Anything but a floor of static geometry may have changed since it was found
+	const UPrimitiveComponent* FloorComponent = PredictedFloor.HitResult.GetComponent();
+	return PredictedFloor.bBlockingHit && FloorComponent && FloorComponent->Mobility == EComponentMobility::Static;
+}
+
 void UCharacterMovementComponent::K2_FindFloor(FVector CapsuleLocation, FFindFloorResult& FloorResult) const
 {
 	FindFloor(CapsuleLocation, FloorResult, false);
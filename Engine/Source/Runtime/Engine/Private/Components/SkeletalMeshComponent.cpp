@@ -6,6 +6,7 @@
 
 #include "Components/SkeletalMeshComponent.h"
 #include "Misc/App.h"
+#include "Misc/ScopeLock.h"
 #include "DrawDebugHelpers.h"
 #include "Animation/AnimStats.h"
 #include "AnimationRuntime.h"
@@ -185,6 +186,10 @@ USkeletalMeshComponent::USkeletalMeshComponent(const FObjectInitializer& ObjectI
 
 #endif//#if WITH_APEX_CLOTHING
 
+	ClothMinScreenSize = 0.0f;
+	bClothAutoDisabled = false;
+	ClothAutoDisableBlendWeight = 1.0f;
+
 	DefaultPlayRate_DEPRECATED = 1.0f;
 	bDefaultPlaying_DEPRECATED = true;
 	bEnablePhysicsOnDedicatedServer = UPhysicsSettings::Get()->bSimulateSkeletalMeshOnDedicatedServer;
@@ -1521,6 +1526,100 @@ void USkeletalMeshComponent::UpdateSlaveComponent()
 	Super::UpdateSlaveComponent();
 }
 
+static TAutoConsoleVariable<int32> CVarSharedPoseEvaluation(
+	TEXT("a.SharedPoseEvaluation"),
+	1,
+	TEXT("If 1, components with bSharePoseEvaluation reuse the poses evaluated this frame by others in the same state."));
+
+static TAutoConsoleVariable<float> CVarSharedPoseEvaluationTimeTolerance(
+	TEXT("a.SharedPoseEvaluation.TimeTolerance"),
+	1.f / 30.f,
+	TEXT("Playback times, in seconds, that are treated as the same when sharing pose evaluation. Larger values share more poses but show more error."));
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Shared Pose Evaluations"), STAT_SharedPoseEvaluations, STATGROUP_Anim);
+
+/** Poses evaluated this frame by components with bSharePoseEvaluation, looked up by the state they were evaluated from */
+class FSharedPoseEvaluationCache
+{
+public:
+	struct FKey
+	{
+		uint32 StateHash;
+		const USkeletalMesh* SkeletalMesh;
+		int32 LODLevel;
+
+		friend bool operator==(const FKey& A, const FKey& B)
+		{
+			return A.StateHash == B.StateHash && A.SkeletalMesh == B.SkeletalMesh && A.LODLevel == B.LODLevel;
+		}
+
+		friend uint32 GetTypeHash(const FKey& Key)
+		{
+			return HashCombine(Key.StateHash, HashCombine(GetTypeHash(Key.SkeletalMesh), GetTypeHash(Key.LODLevel)));
+		}
+	};
+
+	static FSharedPoseEvaluationCache& Get()
+	{
+		static FSharedPoseEvaluationCache Cache;
+		return Cache;
+	}
+
+	bool Find(const FKey& Key, TArray<FTransform>& OutBoneSpaceTransforms, FVector& OutRootBoneTranslation, FBlendedHeapCurve& OutCurve)
+	{
+		FScopeLock Lock(&CacheCritical);
+		ResetIfNewFrame();
+
+		const FSharedPose* SharedPose = Poses.Find(Key);
+		if (SharedPose == nullptr || SharedPose->BoneSpaceTransforms.Num() != OutBoneSpaceTransforms.Num())
+		{
+			return false;
+		}
+
+		OutBoneSpaceTransforms = SharedPose->BoneSpaceTransforms;
+		OutRootBoneTranslation = SharedPose->RootBoneTranslation;
+		OutCurve.CopyFrom(SharedPose->Curve);
+		INC_DWORD_STAT(STAT_SharedPoseEvaluations);
+		return true;
+	}
+
+	void Add(const FKey& Key, const TArray<FTransform>& BoneSpaceTransforms, const FVector& RootBoneTranslation, const FBlendedHeapCurve& Curve)
+	{
+		FScopeLock Lock(&CacheCritical);
+		ResetIfNewFrame();
+
+		// Another component in the same state may have finished first
+		if (!Poses.Contains(Key))
+		{
+			FSharedPose& SharedPose = Poses.Add(Key);
+			SharedPose.BoneSpaceTransforms = BoneSpaceTransforms;
+			SharedPose.RootBoneTranslation = RootBoneTranslation;
+			SharedPose.Curve.CopyFrom(Curve);
+		}
+	}
+
+private:
+	struct FSharedPose
+	{
+		TArray<FTransform> BoneSpaceTransforms;
+		FVector RootBoneTranslation;
+		FBlendedHeapCurve Curve;
+	};
+
+	void ResetIfNewFrame()
+	{
+		if (CacheFrame != GFrameCounter)
+		{
+			CacheFrame = GFrameCounter;
+			Poses.Reset();
+		}
+	}
+
+	FCriticalSection CacheCritical;
+	TMap<FKey, FSharedPose> Poses;
+	uint64 CacheFrame = 0;
+};
+
 void USkeletalMeshComponent::PerformAnimationEvaluation(const USkeletalMesh* InSkeletalMesh, UAnimInstance* InAnimInstance, TArray<FTransform>& OutSpaceBases, TArray<FTransform>& OutBoneSpaceTransforms, FVector& OutRootBoneTranslation, FBlendedHeapCurve& OutCurve) const
 {
 	ANIM_MT_SCOPE_CYCLE_COUNTER(PerformAnimEvaluation, IsRunningParallelEvaluation());
@@ -1532,6 +1631,21 @@ void USkeletalMeshComponent::PerformAnimationEvaluation(const USkeletalMesh* InS
 		return;
 	}
 
+	// Counts towards the animation budget when using update rate optimizations, see a.URO.BudgetMs
+	struct FAnimationBudgetCostScope
+	{
+		const uint32 StartCycles;
+		const bool bEnabled;
+		FAnimationBudgetCostScope(bool bInEnabled) : StartCycles(FPlatformTime::Cycles()), bEnabled(bInEnabled) {}
+		~FAnimationBudgetCostScope()
+		{
+			if (bEnabled)
+			{
+				AddAnimationBudgetCost(FPlatformTime::Cycles() - StartCycles);
+			}
+		}
+	} AnimationBudgetCostScope(bEnableUpdateRateOptimizations);
+
 	// update anim instance
 	if (InAnimInstance && InAnimInstance->NeedsUpdate())
 	{
@@ -1544,8 +1658,28 @@ void USkeletalMeshComponent::PerformAnimationEvaluation(const USkeletalMesh* InS
 		PostProcessAnimInstance->ParallelUpdateAnimation();
 	}
 
-	// evaluate pure animations, and fill up BoneSpaceTransforms
-	EvaluateAnimation(InSkeletalMesh, InAnimInstance, OutBoneSpaceTransforms, OutRootBoneTranslation, OutCurve);
+	// evaluate pure animations, and fill up BoneSpaceTransforms, unless another component in the same state already did
+	FSharedPoseEvaluationCache::FKey SharedPoseKey;
+	const bool bSharePose = bSharePoseEvaluation && CVarSharedPoseEvaluation.GetValueOnAnyThread() != 0 &&
+		InAnimInstance && !bForceRefpose && InSkeletalMesh->Skeleton && InAnimInstance->ParallelCanEvaluate(InSkeletalMesh) &&
+		InAnimInstance->GetSharedPoseStateHash(CVarSharedPoseEvaluationTimeTolerance.GetValueOnAnyThread(), SharedPoseKey.StateHash);
+
+	if (bSharePose)
+	{
+		SharedPoseKey.SkeletalMesh = InSkeletalMesh;
+		SharedPoseKey.LODLevel = PredictedLODLevel;
+
+		if (!FSharedPoseEvaluationCache::Get().Find(SharedPoseKey, OutBoneSpaceTransforms, OutRootBoneTranslation, OutCurve))
+		{
+			EvaluateAnimation(InSkeletalMesh, InAnimInstance, OutBoneSpaceTransforms, OutRootBoneTranslation, OutCurve);
+			FSharedPoseEvaluationCache::Get().Add(SharedPoseKey, OutBoneSpaceTransforms, OutRootBoneTranslation, OutCurve);
+		}
+	}
+	else
+	{
+		EvaluateAnimation(InSkeletalMesh, InAnimInstance, OutBoneSpaceTransforms, OutRootBoneTranslation, OutCurve);
+	}
+
 	EvaluatePostProcessMeshInstance(OutBoneSpaceTransforms, OutCurve, InSkeletalMesh, OutRootBoneTranslation);
 
 	// Fill SpaceBases from LocalAtoms
@@ -2923,6 +3057,11 @@ bool USkeletalMeshComponent::IsClothingSimulationSuspended()
 	return bClothingSimulationSuspended;
 }
 
+void USkeletalMeshComponent::SetClothAutoDisabled(bool bDisable)
+{
+	bClothAutoDisabled = bDisable;
+}
+
 void USkeletalMeshComponent::BindClothToMasterPoseComponent()
 {
 	if(USkeletalMeshComponent* MasterComp = Cast<USkeletalMeshComponent>(MasterPoseComponent.Get()))
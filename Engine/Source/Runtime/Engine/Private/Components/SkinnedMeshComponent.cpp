@@ -44,6 +44,9 @@ static TAutoConsoleVariable<int32> CVarDrawAnimRateOptimization(
 
 static TAutoConsoleVariable<int32> CVarEnableMorphTargets(TEXT("r.EnableMorphTargets"), 1, TEXT("Enable Morph Targets"));
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Anim Budget Throttled Actors"), STAT_AnimBudgetThrottled, STATGROUP_Anim);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Anim Budget Evaluation Time (ms)"), STAT_AnimBudgetEvaluationTime, STATGROUP_Anim);
+
 namespace FAnimUpdateRateManager
 {
 	static float TargetFrameTimeForUpdateRate = 1.f / 30.f; //Target frame rate for lookahead URO
@@ -80,10 +83,19 @@ namespace FAnimUpdateRateManager
 		/** Counter to stagger update and evaluation across skinned mesh components */
 		uint8 AnimUpdateRateShiftTag;
 
+		/** Needs to update every frame, so the animation budget can't throttle it */
+		bool bBudgetEveryFrame;
+
+		/** How important this Actor's animation was when the rates were last set, on screen size scaled by the gameplay priority */
+		float BudgetSignificance;
+
+		/** Lowest evaluation rate the animation budget allows for this Actor. 1 if not throttled */
+		int32 BudgetEvaluationRate;
+
 		/** List of all USkinnedMeshComponents that use this set of parameters */
 		TArray<USkinnedMeshComponent*> RegisteredComponents;
 
-		FAnimUpdateRateParametersTracker() : AnimUpdateRateFrameCount(0), AnimUpdateRateShiftTag(0) {}
+		FAnimUpdateRateParametersTracker() : AnimUpdateRateFrameCount(0), AnimUpdateRateShiftTag(0), bBudgetEveryFrame(false), BudgetSignificance(0.f), BudgetEvaluationRate(1) {}
 
 		uint8 GetAnimUpdateRateShiftTag(const EUpdateRateShiftBucket& ShiftBucket)
 		{
@@ -166,6 +178,95 @@ namespace FAnimUpdateRateManager
 		0,
 		TEXT("Set to 1 to force interpolation"));
 
+	static TAutoConsoleVariable<float> CVarAnimBudgetMs(
+		TEXT("a.URO.BudgetMs"),
+		0.f,
+		TEXT("If > 0, time in ms per frame that the animation evaluation of meshes using update rate optimizations should fit in.\n")
+		TEXT("The least significant Actors (small on screen or not rendered, low BudgetSignificanceScale) get their rates lowered until the estimated cost fits."));
+
+	static TAutoConsoleVariable<int32> CVarAnimBudgetMaxRate(
+		TEXT("a.URO.BudgetMaxRate"),
+		8,
+		TEXT("Lowest rate the animation budget throttles Actors to. 8 = evaluate every eight frames."));
+
+	/** Time spent evaluating animation with update rate optimizations this frame, and the number of evaluations it was for */
+	static FThreadSafeCounter BudgetEvaluationCycles;
+	static FThreadSafeCounter BudgetNumEvaluations;
+
+	/** Smoothed time of one evaluation in ms */
+	static float BudgetAverageEvaluationMs = 0.f;
+
+	/** Frame the budget was last distributed for */
+	static uint64 BudgetFrame = 0;
+
+	/** Distributes the animation budget between the Actors that animated last frame, using last frame's significances and cost */
+	void UpdateAnimationBudget()
+	{
+		const int32 NumEvaluations = BudgetNumEvaluations.Reset();
+		const float EvaluationMs = FPlatformTime::ToMilliseconds(BudgetEvaluationCycles.Reset());
+		if (NumEvaluations > 0)
+		{
+			const float LastAverageMs = EvaluationMs / NumEvaluations;
+			BudgetAverageEvaluationMs = (BudgetAverageEvaluationMs > 0.f) ? FMath::Lerp(BudgetAverageEvaluationMs, LastAverageMs, 0.1f) : LastAverageMs;
+		}
+		SET_FLOAT_STAT(STAT_AnimBudgetEvaluationTime, EvaluationMs);
+
+		const float BudgetMs = CVarAnimBudgetMs.GetValueOnGameThread();
+		const uint32 LastFrame32 = uint32((GFrameCounter - 1) % MAX_uint32);
+
+		TArray<FAnimUpdateRateParametersTracker*, TInlineAllocator<256>> ThrottledTrackers;
+		float RequiredEvaluations = 0.f;
+		for (TPair<UObject*, FAnimUpdateRateParametersTracker*>& Pair : ActorToUpdateRateParams)
+		{
+			FAnimUpdateRateParametersTracker* Tracker = Pair.Value;
+			Tracker->BudgetEvaluationRate = 1;
+
+			// Only the Actors that animated last frame
+			if (BudgetMs > 0.f && Tracker->AnimUpdateRateFrameCount == LastFrame32)
+			{
+				if (Tracker->bBudgetEveryFrame)
+				{
+					RequiredEvaluations += Tracker->RegisteredComponents.Num();
+				}
+				else
+				{
+					ThrottledTrackers.Add(Tracker);
+				}
+			}
+		}
+
+		int32 NumThrottled = 0;
+		if (ThrottledTrackers.Num() > 0 && BudgetAverageEvaluationMs > 0.f)
+		{
+			const int32 MaxRate = FMath::Max(CVarAnimBudgetMaxRate.GetValueOnGameThread(), 1);
+
+			ThrottledTrackers.Sort([](const FAnimUpdateRateParametersTracker& A, const FAnimUpdateRateParametersTracker& B)
+			{
+				return A.BudgetSignificance > B.BudgetSignificance;
+			});
+
+			// Everyone starts at the lowest rate, then the most significant get the highest rate that still fits
+			float AvailableEvaluations = (BudgetMs / BudgetAverageEvaluationMs) - RequiredEvaluations;
+			for (const FAnimUpdateRateParametersTracker* Tracker : ThrottledTrackers)
+			{
+				AvailableEvaluations -= float(Tracker->RegisteredComponents.Num()) / MaxRate;
+			}
+
+			for (FAnimUpdateRateParametersTracker* Tracker : ThrottledTrackers)
+			{
+				const float NumComponents = Tracker->RegisteredComponents.Num();
+				AvailableEvaluations += NumComponents / MaxRate;
+
+				const int32 Rate = (AvailableEvaluations > 0.f) ? FMath::Clamp(FMath::CeilToInt(NumComponents / AvailableEvaluations), 1, MaxRate) : MaxRate;
+				AvailableEvaluations -= NumComponents / Rate;
+
+				Tracker->BudgetEvaluationRate = Rate;
+				NumThrottled += (Rate > 1) ? 1 : 0;
+			}
+		}
+		SET_DWORD_STAT(STAT_AnimBudgetThrottled, NumThrottled);
+	}
+
 	void AnimUpdateRateSetParams(FAnimUpdateRateParametersTracker* Tracker, float DeltaTime, bool bRecentlyRendered, float MaxDistanceFactor, int32 MinLod, bool bNeedsValidRootMotion, bool bUsingRootMotionFromEverything)
 	{
 		// default rules for setting update rates
@@ -175,11 +276,15 @@ namespace FAnimUpdateRateManager
 
 		bool bNeedsEveryFrame = bNeedsValidRootMotion && !bUsingRootMotionFromEverything;
 
+		// Inputs of the next frame's budget
+		Tracker->bBudgetEveryFrame = bRecentlyRendered && (bHumanControlled || bNeedsEveryFrame);
+		Tracker->BudgetSignificance = bRecentlyRendered ? MaxDistanceFactor * Tracker->UpdateRateParameters.BudgetSignificanceScale : 0.f;
+
 		// Not rendered, including dedicated servers. we can skip the Evaluation part.
 		if (!bRecentlyRendered)
 		{
-			const int32 NewUpdateRate = ((bHumanControlled || bNeedsEveryFrame) ? 1 : Tracker->UpdateRateParameters.BaseNonRenderedUpdateRate);
-			const int32 NewEvaluationRate = Tracker->UpdateRateParameters.BaseNonRenderedUpdateRate;
+			const int32 NewEvaluationRate = FMath::Max(Tracker->UpdateRateParameters.BaseNonRenderedUpdateRate, Tracker->BudgetEvaluationRate);
+			const int32 NewUpdateRate = ((bHumanControlled || bNeedsEveryFrame) ? 1 : NewEvaluationRate);
 			Tracker->UpdateRateParameters.SetTrailMode(DeltaTime, Tracker->GetAnimUpdateRateShiftTag(Tracker->UpdateRateParameters.ShiftBucket), NewUpdateRate, NewEvaluationRate, false);
 		}
 		// Visible controlled characters or playing root motion. Need evaluation and ticking done every frame.
@@ -215,6 +320,8 @@ namespace FAnimUpdateRateManager
 				}
 			}
 
+			DesiredEvaluationRate = FMath::Max(DesiredEvaluationRate, Tracker->BudgetEvaluationRate);
+
 			int32 ForceAnimRate = CVarForceAnimRate.GetValueOnGameThread();
 			if (ForceAnimRate)
 			{
@@ -268,6 +375,12 @@ namespace FAnimUpdateRateManager
 		// Convert current frame counter from 64 to 32 bits.
 		const uint32 CurrentFrame32 = uint32(GFrameCounter % MAX_uint32);
 
+		if (BudgetFrame != GFrameCounter)
+		{
+			BudgetFrame = GFrameCounter;
+			UpdateAnimationBudget();
+		}
+
 		UObject* TrackerIndex = GetMapIndexForComponent(SkinnedComponent);
 		FAnimUpdateRateParametersTracker* Tracker = ActorToUpdateRateParams.FindChecked(TrackerIndex);
 
@@ -610,6 +723,12 @@ bool USkinnedMeshComponent::ShouldUseUpdateRateOptimizations() const
 	return bEnableUpdateRateOptimizations && CVarEnableAnimRateOptimization.GetValueOnGameThread() > 0;
 }
 
+void USkinnedMeshComponent::AddAnimationBudgetCost(uint32 Cycles)
+{
+	FAnimUpdateRateManager::BudgetEvaluationCycles.Add(Cycles);
+	FAnimUpdateRateManager::BudgetNumEvaluations.Increment();
+}
+
 void USkinnedMeshComponent::TickUpdateRate(float DeltaTime, bool bNeedsValidRootMotion)
 {
 	SCOPE_CYCLE_COUNTER(STAT_TickUpdateRate);
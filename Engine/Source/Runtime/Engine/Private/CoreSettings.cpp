@@ -14,6 +14,7 @@ float GPriorityAsyncLoadingExtraTime = 20.0f;
 float GLevelStreamingActorsUpdateTimeLimit = 5.0f;
 float GLevelStreamingUnregisterComponentsTimeLimit = 1.0f;
 int32 GLevelStreamingComponentsRegistrationGranularity = 10;
+int32 GLevelStreamingRouteActorInitializationGranularity = 10;
 int32 GLevelStreamingComponentsUnregistrationGranularity = 5;
 
 static FAutoConsoleVariableRef CVarUseBackgroundLevelStreaming(
@@ -65,6 +66,13 @@ static FAutoConsoleVariableRef CVarLevelStreamingComponentsRegistrationGranulari
 	ECVF_Default
 	);
 
+static FAutoConsoleVariableRef CVarLevelStreamingRouteActorInitializationGranularity(
+	TEXT("s.LevelStreamingRouteActorInitializationGranularity"),
+	GLevelStreamingRouteActorInitializationGranularity,
+	TEXT("Batching granularity used to route initialization on actors during level streaming. 0 initializes all actors of a level in one frame."),
+	ECVF_Default
+	);
+
 static FAutoConsoleVariableRef CVarLevelStreamingComponentsUnregistrationGranularity(
 	TEXT("s.LevelStreamingComponentsUnregistrationGranularity"),
 	GLevelStreamingComponentsUnregistrationGranularity,
@@ -89,6 +97,7 @@ UStreamingSettings::UStreamingSettings()
 	PriorityAsyncLoadingExtraTime = 20.0f;
 	LevelStreamingActorsUpdateTimeLimit = 5.0f;
 	LevelStreamingComponentsRegistrationGranularity = 10;
+	LevelStreamingRouteActorInitializationGranularity = 10;
 	LevelStreamingUnregisterComponentsTimeLimit = 1.0f;
 	LevelStreamingComponentsUnregistrationGranularity = 5;
 	EventDrivenLoaderEnabled = false;
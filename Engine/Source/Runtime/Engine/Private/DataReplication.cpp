@@ -372,7 +372,7 @@ void FReplicationChangelistMgr::Update( const UObject* InObject, const uint32 Re
 		return;
 	}
 
-	RepLayout->CompareProperties( RepChangelistState.Get(), (const uint8*)InObject, RepFlags );
+	RepLayout->CompareProperties( RepChangelistState.Get(), (const uint8*)InObject, RepFlags, bForceCompare );
 
 	LastReplicationFrame = ReplicationFrame;
 }
@@ -31,6 +31,8 @@ namespace
 
 UDataTable::UDataTable(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
+	, LoadedRowData(nullptr)
+	, LoadedRowStride(0)
 {
 #if WITH_EDITORONLY_DATA
 	{ static const FAutoRegisterLocalizationDataGatheringCallback AutomaticRegistrationOfLocalizationGatherer(UDataTable::StaticClass(), &GatherDataTableForLocalization); }
@@ -52,6 +54,16 @@ void UDataTable::LoadStructData(FArchive& Ar)
 	int32 NumRows;
 	Ar << NumRows;
 
+	// Keep the rows of a freshly loaded table next to each other instead of allocating each one
+	const bool bUseLoadedRowData = LoadedRowData == nullptr && NumRows > 0;
+	if (bUseLoadedRowData)
+	{
+		LoadedRowStride = Align(LoadUsingStruct->GetStructureSize(), LoadUsingStruct->GetMinAlignment());
+		LoadedRowData = (uint8*)FMemory::Malloc(NumRows * LoadedRowStride, LoadUsingStruct->GetMinAlignment());
+		LoadedRowsAlive.Init(true, NumRows);
+		RowMap.Reserve(RowMap.Num() + NumRows);
+	}
+
 	for (int32 RowIdx = 0; RowIdx < NumRows; RowIdx++)
 	{
 		// Load row name
@@ -59,14 +71,19 @@ void UDataTable::LoadStructData(FArchive& Ar)
 		Ar << RowName;
 
 		// Load row data
-		uint8* RowData = (uint8*)FMemory::Malloc(LoadUsingStruct->GetStructureSize());
+		uint8* RowData = bUseLoadedRowData ? LoadedRowData + RowIdx * LoadedRowStride : (uint8*)FMemory::Malloc(LoadUsingStruct->GetStructureSize());
 
 		// And be sure to call DestroyScriptStruct later
 		LoadUsingStruct->InitializeStruct(RowData);
 
 		LoadUsingStruct->SerializeItem(Ar, RowData, nullptr);
 
-		// Add to map
+		// Add to map, a duplicate name replaces the earlier row
+		uint8* ReplacedRowData = nullptr;
+		if (RowMap.RemoveAndCopyValue(RowName, ReplacedRowData))
+		{
+			DestroyRow(*LoadUsingStruct, ReplacedRowData);
+		}
 		RowMap.Add(RowName, RowData);
 	}
 }
@@ -259,6 +276,21 @@ UScriptStruct& UDataTable::GetEmptyUsingStruct() const
 	return *EmptyUsingStruct;
 }
 
+void UDataTable::DestroyRow(UScriptStruct& EmptyUsingStruct, uint8* RowData)
+{
+	EmptyUsingStruct.DestroyStruct(RowData);
+
+	const int32 LoadedRowIndex = GetLoadedRowIndex(RowData);
+	if (LoadedRowIndex != INDEX_NONE)
+	{
+		LoadedRowsAlive[LoadedRowIndex] = false;
+	}
+	else
+	{
+		FMemory::Free(RowData);
+	}
+}
+
 void UDataTable::EmptyTable()
 {
 	UScriptStruct& EmptyUsingStruct = GetEmptyUsingStruct();
@@ -266,13 +298,19 @@ void UDataTable::EmptyTable()
 	// Iterate over all rows in table and free mem
 	for (auto RowIt = RowMap.CreateIterator(); RowIt; ++RowIt)
 	{
-		uint8* RowData = RowIt.Value();
-		EmptyUsingStruct.DestroyStruct(RowData);
-		FMemory::Free(RowData);
+		DestroyRow(EmptyUsingStruct, RowIt.Value());
 	}
 
 	// Finally empty the map
 	RowMap.Empty();
+
+	if (LoadedRowData)
+	{
+		FMemory::Free(LoadedRowData);
+		LoadedRowData = nullptr;
+		LoadedRowStride = 0;
+		LoadedRowsAlive.Empty();
+	}
 }
 
 void UDataTable::RemoveRow(FName RowName)
@@ -284,11 +322,16 @@ void UDataTable::RemoveRow(FName RowName)
 		
 	if (RowData)
 	{
-		EmptyUsingStruct.DestroyStruct(RowData);
-		FMemory::Free(RowData);
+		DestroyRow(EmptyUsingStruct, RowData);
 	}
 }
 
+int32 UDataTable::GetRowIndex(FName RowName) const
+{
+	uint8* const* RowDataPtr = RowMap.Find(RowName);
+	return RowDataPtr ? GetLoadedRowIndex(*RowDataPtr) : INDEX_NONE;
+}
+
 	
 void UDataTable::AddRow(FName RowName, const FTableRowBase& RowData)
 {
@@ -31,6 +31,10 @@
 #include "Net/NetworkProfiler.h"
 #include "GameFramework/GameStateBase.h"
 #include "GameFramework/PlayerState.h"
+#include "Async/AsyncWork.h"
+#include "Misc/Compression.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
 
 DEFINE_LOG_CATEGORY( LogDemo );
 
@@ -46,6 +50,7 @@ static TAutoConsoleVariable<int32> CVarDemoQueueCheckpointChannels( TEXT( "demo.
 static TAutoConsoleVariable<int32> CVarUseAdaptiveReplayUpdateFrequency( TEXT( "demo.UseAdaptiveReplayUpdateFrequency" ), 1, TEXT( "If 1, NetUpdateFrequency will be calculated based on how often actors actually write something when recording to a replay" ) );
 static TAutoConsoleVariable<int32> CVarDemoAsyncLoadWorld( TEXT( "demo.AsyncLoadWorld" ), 0, TEXT( "If 1, we will use seamless server travel to load the replay world asynchronously" ) );
 static TAutoConsoleVariable<float> CVarCheckpointUploadDelayInSeconds( TEXT( "demo.CheckpointUploadDelayInSeconds" ), 30.0f, TEXT( "" ) );
+static TAutoConsoleVariable<float> CVarDeltaCheckpointDelayInSeconds( TEXT( "demo.DeltaCheckpointDelayInSeconds" ), 5.0f, TEXT( "If > 0, delta checkpoints are saved this often between full checkpoints. Delta checkpoints only replicate actors that changed since the last checkpoint, so scrubbing has less to fast forward. 0 disables them." ) );
 static TAutoConsoleVariable<int32> CVarDemoLoadCheckpointGarbageCollect( TEXT( "demo.LoadCheckpointGarbageCollect" ), 1, TEXT("If nonzero, CollectGarbage will be called during LoadCheckpoint after the old actors and connection are cleaned up." ) );
 static TAutoConsoleVariable<float> CVarCheckpointSaveMaxMSPerFrameOverride( TEXT( "demo.CheckpointSaveMaxMSPerFrameOverride" ), -1.0f, TEXT( "If >= 0, this value will override the CheckpointSaveMaxMSPerFrame member variable, which is the maximum time allowed each frame to spend on saving a checkpoint. If 0, it will save the checkpoint in a single frame, regardless of how long it takes." ) );
 static TAutoConsoleVariable<int32> CVarDemoClientRecordAsyncEndOfFrame( TEXT( "demo.ClientRecordAsyncEndOfFrame" ), 0, TEXT( "If true, TickFlush will be called on a thread in parallel with Slate." ) );
@@ -55,6 +60,8 @@ static TAutoConsoleVariable<int32> CVarForceDisableAsyncPackageMapLoading( TEXT(
 static TAutoConsoleVariable<int32> CVarDemoUseNetRelevancy( TEXT( "demo.UseNetRelevancy" ), 0, TEXT( "If 1, will enable relevancy checks and distance culling, using all connected clients as reference." ) );
 static TAutoConsoleVariable<float> CVarDemoCullDistanceOverride( TEXT( "demo.CullDistanceOverride" ), 0.0f, TEXT( "If > 0, will represent distance from any viewer where actors will stop being recorded." ) );
 static TAutoConsoleVariable<float> CVarDemoRecordHzWhenNotRelevant( TEXT( "demo.RecordHzWhenNotRelevant" ), 2.0f, TEXT( "Record at this frequency when actor is not relevant." ) );
+static TAutoConsoleVariable<int32> CVarDemoAsyncCheckpointSerialize( TEXT( "demo.AsyncCheckpointSerialize" ), 1, TEXT( "If 1, checkpoints are serialized and compressed on a worker thread once all actors are replicated." ) );
+static TAutoConsoleVariable<int32> CVarDemoCompressCheckpoints( TEXT( "demo.CompressCheckpoints" ), 1, TEXT( "If 1, checkpoints are zlib compressed before they are handed to the replay streamer." ) );
 
 #if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
 static TAutoConsoleVariable<int32> CVarDemoForceFailure( TEXT( "demo.ForceFailure" ), 0, TEXT( "" ) );
@@ -64,6 +71,144 @@ static const int32 MAX_DEMO_READ_WRITE_BUFFER = 1024 * 2;
 
 #define DEMO_CHECKSUMS 0		// When setting this to 1, this will invalidate all demos, you will need to re-record and playback
 
+static const ECompressionFlags DEMO_CHECKPOINT_COMPRESSION_FLAGS = ( ECompressionFlags )( COMPRESS_ZLIB | COMPRESS_BiasSpeed );
+
+static void WriteDemoPacket( FArchive& Ar, uint8* Data, int32 Count )
+{
+	Ar << Count;
+	Ar.Serialize( Data, Count );
+
+#if DEMO_CHECKSUMS == 1
+	uint32 Checksum = FCrc::MemCrc32( Data, Count, 0 );
+	Ar << Checksum;
+#endif
+}
+
+/**
+ * Serializes the packets of a finished checkpoint and compresses the result.
+ * Everything that touches the world or the package map is captured on the game thread beforehand, so this only
+ * deals with memory owned by the worker.
+ */
+class FDemoCheckpointSerializeWork : public FNonAbandonableTask
+{
+public:
+	FDemoCheckpointSerializeWork( TArray< uint8 >&& InHeaderData, TArray< FQueuedDemoPacket >&& InPackets, const bool bInCompress )
+		: HeaderData( MoveTemp( InHeaderData ) )
+		, Packets( MoveTemp( InPackets ) )
+		, bCompress( bInCompress )
+	{
+	}
+
+	void DoWork()
+	{
+		TArray< uint8 > CheckpointData( MoveTemp( HeaderData ) );
+		FMemoryWriter CheckpointWriter( CheckpointData, false, true );
+
+		for ( FQueuedDemoPacket& Packet : Packets )
+		{
+			WriteDemoPacket( CheckpointWriter, Packet.Data.GetData(), Packet.Data.Num() );
+		}
+
+		Packets.Empty();
+
+		// Write a count of 0 to signal the end of the frame
+		int32 EndCount = 0;
+		CheckpointWriter << EndCount;
+
+		// Checkpoint layout: bCompressed, UncompressedSize, [CompressedSize], data
+		FMemoryWriter ResultWriter( Result );
+
+		int32 UncompressedSize = CheckpointData.Num();
+		int32 CompressedSize = bCompress ? FCompression::CompressMemoryBound( DEMO_CHECKPOINT_COMPRESSION_FLAGS, UncompressedSize ) : 0;
+
+		TArray< uint8 > CompressedData;
+		CompressedData.AddUninitialized( CompressedSize );
+
+		uint8 bCompressed = bCompress && FCompression::CompressMemory( DEMO_CHECKPOINT_COMPRESSION_FLAGS, CompressedData.GetData(), CompressedSize, CheckpointData.GetData(), UncompressedSize ) && CompressedSize < UncompressedSize;
+
+		ResultWriter << bCompressed;
+		ResultWriter << UncompressedSize;
+
+		if ( bCompressed )
+		{
+			ResultWriter << CompressedSize;
+			ResultWriter.Serialize( CompressedData.GetData(), CompressedSize );
+		}
+		else
+		{
+			ResultWriter.Serialize( CheckpointData.GetData(), UncompressedSize );
+		}
+	}
+
+	FORCEINLINE TStatId GetStatId() const
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT( FDemoCheckpointSerializeWork, STATGROUP_ThreadPoolAsyncTasks );
+	}
+
+	/** Checkpoint as it is written to the replay streamer, only valid once the work is done */
+	TArray< uint8 > Result;
+
+private:
+	TArray< uint8 >				HeaderData;
+	TArray< FQueuedDemoPacket >	Packets;
+	bool						bCompress;
+};
+
+class FDemoCheckpointSerializeTask : public FAsyncTask< FDemoCheckpointSerializeWork >
+{
+public:
+	FDemoCheckpointSerializeTask( TArray< uint8 >&& InHeaderData, TArray< FQueuedDemoPacket >&& InPackets, const bool bInCompress )
+		: FAsyncTask< FDemoCheckpointSerializeWork >( MoveTemp( InHeaderData ), MoveTemp( InPackets ), bInCompress )
+	{
+	}
+};
+
+/**
+ * Reads the compression header written by FDemoCheckpointSerializeWork and decompresses the checkpoint.
+ * @return false if the checkpoint is corrupt
+ */
+static bool ReadCompressedDemoCheckpoint( FArchive& Ar, TArray< uint8 >& OutCheckpointData )
+{
+	uint8 bCompressed = 0;
+	int32 UncompressedSize = 0;
+
+	Ar << bCompressed;
+	Ar << UncompressedSize;
+
+	if ( Ar.IsError() || UncompressedSize < 0 )
+	{
+		return false;
+	}
+
+	if ( !bCompressed )
+	{
+		if ( UncompressedSize > Ar.TotalSize() - Ar.Tell() )
+		{
+			return false;
+		}
+
+		OutCheckpointData.SetNumUninitialized( UncompressedSize );
+		Ar.Serialize( OutCheckpointData.GetData(), UncompressedSize );
+		return !Ar.IsError();
+	}
+
+	int32 CompressedSize = 0;
+	Ar << CompressedSize;
+
+	if ( Ar.IsError() || CompressedSize < 0 || CompressedSize > Ar.TotalSize() - Ar.Tell() )
+	{
+		return false;
+	}
+
+	TArray< uint8 > CompressedData;
+	CompressedData.AddUninitialized( CompressedSize );
+	Ar.Serialize( CompressedData.GetData(), CompressedSize );
+
+	OutCheckpointData.SetNumUninitialized( UncompressedSize );
+
+	return !Ar.IsError() && FCompression::UncompressMemory( DEMO_CHECKPOINT_COMPRESSION_FLAGS, OutCheckpointData.GetData(), UncompressedSize, CompressedData.GetData(), CompressedSize );
+}
+
 // RAII object to swap the Role and RemoteRole of an actor within a scope. Used for recording replays on a client.
 class FScopedActorRoleSwap
 {
@@ -213,10 +358,12 @@ public:
 		check( GotoCheckpointArchive == NULL );
 		check( GotoCheckpointSkipExtraTimeInMS == -1 );
 
-		if ( !bSuccess )
+		if ( !bSuccess || !ReadCheckpoint() )
 		{
 			UE_LOG( LogDemo, Warning, TEXT( "FGotoTimeInSecondsTask::CheckpointReady: Failed to go to checkpoint." ) );
 
+			GotoCheckpointArchive = nullptr;
+
 			// Restore old demo time
 			Driver->DemoCurrentTime = OldTimeInSeconds;
 
@@ -227,14 +374,37 @@ public:
 			return;
 		}
 
-		GotoCheckpointArchive			= Driver->ReplayStreamer->GetCheckpointArchive();
 		GotoCheckpointSkipExtraTimeInMS = SkipExtraTimeInMS;
 	}
 
-	float				OldTimeInSeconds;		// So we can restore on failure
-	float				TimeInSeconds;
-	FArchive*			GotoCheckpointArchive;
-	int64				GotoCheckpointSkipExtraTimeInMS;
+	bool ReadCheckpoint()
+	{
+		GotoCheckpointArchive = Driver->ReplayStreamer->GetCheckpointArchive();
+
+		const int64 CheckpointSize = GotoCheckpointArchive != nullptr ? GotoCheckpointArchive->TotalSize() : 0;
+
+		if ( Driver->PlaybackDemoHeader.Version >= HISTORY_CHECKPOINT_COMPRESSION && CheckpointSize > 0 )
+		{
+			// Hand the decompressed checkpoint to LoadCheckpoint, so it can keep reading (and seeking) it as before
+			if ( !ReadCompressedDemoCheckpoint( *GotoCheckpointArchive, CheckpointData ) )
+			{
+				UE_LOG( LogDemo, Warning, TEXT( "FGotoTimeInSecondsTask::ReadCheckpoint: Failed to decompress checkpoint." ) );
+				return false;
+			}
+
+			CheckpointReader = MakeUnique< FMemoryReader >( CheckpointData );
+			GotoCheckpointArchive = CheckpointReader.Get();
+		}
+
+		return true;
+	}
+
+	float						OldTimeInSeconds;		// So we can restore on failure
+	float						TimeInSeconds;
+	FArchive*					GotoCheckpointArchive;
+	int64						GotoCheckpointSkipExtraTimeInMS;
+	TArray< uint8 >				CheckpointData;			// Decompressed checkpoint, read through CheckpointReader
+	TUniquePtr< FMemoryReader >	CheckpointReader;
 };
 
 class FSkipTimeInSecondsTask : public FQueuedReplayTask
@@ -280,6 +450,10 @@ UDemoNetDriver::UDemoNetDriver(const FObjectInitializer& ObjectInitializer)
 	CurrentLevelIndex = 0;
 	bRecordMapChanges = false;
 	bIsWaitingForHeaderDownload = false;
+	CheckpointSerializeTimeInMS = 0;
+	CheckpointGuidCacheSize = 0;
+	bIsDeltaCheckpoint = false;
+	NumCheckpointReusedActors = 0;
 }
 
 void UDemoNetDriver::AddReplayTask( FQueuedReplayTask* NewTask )
@@ -406,6 +580,12 @@ void UDemoNetDriver::FinishDestroy()
 		{
 			StopDemo();
 		}
+
+		if ( CheckpointSerializeTask.IsValid() )
+		{
+			CheckpointSerializeTask->EnsureCompletion();
+			CheckpointSerializeTask.Reset();
+		}
 	}
 
 	Super::FinishDestroy();
@@ -418,14 +598,16 @@ FString UDemoNetDriver::LowLevelGetNetworkNumber()
 
 void UDemoNetDriver::ResetDemoState()
 {
-	DemoFrameNum		= 0;
-	LastCheckpointTime	= 0.0f;
-	DemoTotalTime		= 0;
-	DemoCurrentTime		= 0;
-	DemoTotalFrames		= 0;
+	DemoFrameNum			= 0;
+	LastCheckpointTime		= 0.0f;
+	LastDeltaCheckpointTime	= 0.0f;
+	DemoTotalTime			= 0;
+	DemoCurrentTime			= 0;
+	DemoTotalFrames			= 0;
 
 	ExternalDataToObjectMap.Empty();
 	PlaybackPackets.Empty();
+	CheckpointActorPackets.Empty();
 }
 
 bool UDemoNetDriver::InitConnect( FNetworkNotify* InNotify, const FURL& ConnectURL, FString& Error )
@@ -1029,6 +1211,9 @@ void UDemoNetDriver::StopDemo()
 		ServerConnection->Close();
 	}
 
+	// Don't lose the checkpoint that's still being serialized
+	TickCheckpointSerialize( true );
+
 	ReplayStreamer->StopStreaming();
 	ClearReplayTasks();
 
@@ -1166,7 +1351,7 @@ void UDemoNetDriver::AddNewLevel(const FString& NewLevelName)
 	LevelNamesAndTimes.Add(FLevelNameAndTime(NewLevelName, ReplayStreamer->GetTotalDemoTime()));
 }
 
-void UDemoNetDriver::SaveCheckpoint()
+void UDemoNetDriver::SaveCheckpoint( const bool bDeltaCheckpoint )
 {
 	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("SaveCheckpoint time"), STAT_ReplayCheckpointSaveTime, STATGROUP_Net);
 
@@ -1178,6 +1363,12 @@ void UDemoNetDriver::SaveCheckpoint()
 		return;
 	}
 
+	if ( CheckpointSerializeTask.IsValid() )
+	{
+		// The previous checkpoint is still being serialized
+		return;
+	}
+
 	check( CheckpointArchive->TotalSize() == 0 );
 
 	check( ClientConnections[0]->SendBuffer.GetNumBits() == 0 );
@@ -1200,6 +1391,25 @@ void UDemoNetDriver::SaveCheckpoint()
 		return;
 	}
 
+	// Drop the packets of actors that lost their channel (or got a new one) since the last checkpoint
+	for ( auto It = CheckpointActorPackets.CreateIterator(); It; ++It )
+	{
+		AActor* Actor = It.Key().Get();
+
+		if ( Actor == nullptr || !It.Value().Channel.IsValid() || ClientConnections[0]->ActorChannels.FindRef( Actor ) != It.Value().Channel.Get() )
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	if ( CVarDeltaCheckpointDelayInSeconds.GetValueOnAnyThread() <= 0.0f )
+	{
+		CheckpointActorPackets.Empty();
+	}
+
+	bIsDeltaCheckpoint = bDeltaCheckpoint && CheckpointActorPackets.Num() > 0;
+	NumCheckpointReusedActors = 0;
+
 	UPackageMapClient* PackageMapClient = ( ( UPackageMapClient* )ClientConnections[0]->PackageMap );
 
 	PackageMapClient->SavePackageMapExportAckStatus( CheckpointAckState );
@@ -1207,7 +1417,7 @@ void UDemoNetDriver::SaveCheckpoint()
 	TotalCheckpointSaveTimeSeconds = 0;
 	TotalCheckpointSaveFrames = 0;
 
-	UE_LOG( LogDemo, Log, TEXT( "Starting checkpoint. Actors: %i" ), GetNetworkObjectList().GetActiveObjects().Num() );
+	UE_LOG( LogDemo, Log, TEXT( "Starting %s checkpoint. Actors: %i" ), bIsDeltaCheckpoint ? TEXT( "delta" ) : TEXT( "full" ), GetNetworkObjectList().GetActiveObjects().Num() );
 
 	// Do the first checkpoint tick now
 	TickCheckpoint();
@@ -1261,6 +1471,11 @@ void UDemoNetDriver::TickCheckpoint()
 
 	const double CheckpointMaxUploadTimePerFrame = ( double )GetCheckpointSaveMaxMSPerFrame() / 1000;
 
+	// Delta checkpoints need to know which packets belong to which actor, so each actor is flushed into its own packets
+	const bool bTrackActorPackets = CVarDeltaCheckpointDelayInSeconds.GetValueOnAnyThread() > 0.0f;
+
+	TArray< FQueuedDemoPacket >& QueuedCheckpointPackets = CastChecked< UDemoNetConnection >( ClientConnections[0] )->QueuedCheckpointPackets;
+
 	for ( auto ActorIt = PendingCheckpointActors.CreateIterator(); ActorIt; ++ActorIt )
 	{
 		AActor* Actor = ( *ActorIt ).Get();
@@ -1271,9 +1486,32 @@ void UDemoNetDriver::TickCheckpoint()
 
 		if ( ActorChannel )
 		{
+			// The game state's server time is refreshed for every checkpoint, so it always replicates
+			const FDemoCheckpointActorPackets* ReusedPackets = bIsDeltaCheckpoint && Actor != GameState ? CheckpointActorPackets.Find( Actor ) : nullptr;
+
+			if ( ReusedPackets != nullptr && ReusedPackets->Channel.Get() == ActorChannel )
+			{
+				// Nothing was sent for this actor since the last checkpoint, so it would write the same packets again
+				QueuedCheckpointPackets.Append( ReusedPackets->Packets );
+				NumCheckpointReusedActors++;
+				continue;
+			}
+
+			const int32 FirstActorPacket = QueuedCheckpointPackets.Num();
+
 			Actor->CallPreReplication( this );
 			DemoReplicateActor( Actor, ClientConnections[0], SpectatorController, true );
 
+			if ( bTrackActorPackets )
+			{
+				ClientConnections[0]->FlushNet();
+
+				FDemoCheckpointActorPackets& ActorPackets = CheckpointActorPackets.FindOrAdd( Actor );
+				ActorPackets.Channel = ActorChannel;
+				ActorPackets.Packets.Reset();
+				ActorPackets.Packets.Append( QueuedCheckpointPackets.GetData() + FirstActorPacket, QueuedCheckpointPackets.Num() - FirstActorPacket );
+			}
+
 			const double CheckpointTime = FPlatformTime::Seconds();
 
 			if ( CheckpointMaxUploadTimePerFrame > 0 && CheckpointTime - StartCheckpointTime > CheckpointMaxUploadTimePerFrame )
@@ -1307,35 +1545,79 @@ void UDemoNetDriver::TickCheckpoint()
 		//
 		// We're done saving this checkpoint
 		//
-		*CheckpointArchive << CurrentLevelIndex;
+		TArray< uint8 > CheckpointData;
+		FMemoryWriter CheckpointWriter( CheckpointData );
+
+		CheckpointWriter << CurrentLevelIndex;
 
 		// Save deleted startup actors
-		*CheckpointArchive << DeletedNetStartupActors;
+		CheckpointWriter << DeletedNetStartupActors;
 
 		// Save the current guid cache
-		SerializeGuidCache( GuidCache, CheckpointArchive );
+		SerializeGuidCache( GuidCache, &CheckpointWriter );
 
 		// Save the compatible rep layout map
-		PackageMapClient->SerializeNetFieldExportGroupMap( *CheckpointArchive );
+		PackageMapClient->SerializeNetFieldExportGroupMap( CheckpointWriter );
 
 		// Get the size of the guid data saved
-		const uint32 GuidCacheSize = CheckpointArchive->TotalSize();
+		CheckpointGuidCacheSize = CheckpointData.Num();
+
+		// The frame header references the world, so it's written now, the packets generated while saving the checkpoint are written by the worker
+		WriteDemoFrameHeader( CheckpointWriter );
 
-		// Write out all of the queued up packets generated while saving the checkpoint
-		WriteDemoFrameFromQueuedDemoPackets( *CheckpointArchive, CastChecked< UDemoNetConnection>( ClientConnections[0] )->QueuedCheckpointPackets );
+		CheckpointSerializeTimeInMS = GetDemoCurrentTimeInMS();
 
-		// Get the total checkpoint size
-		const int32 TotalCheckpointSize = CheckpointArchive->TotalSize();
+		CheckpointSerializeTask = MakeShareable( new FDemoCheckpointSerializeTask( MoveTemp( CheckpointData ), MoveTemp( CastChecked< UDemoNetConnection >( ClientConnections[0] )->QueuedCheckpointPackets ), CVarDemoCompressCheckpoints.GetValueOnGameThread() != 0 ) );
 
-		if ( CheckpointArchive->TotalSize() > 0 )
+		if ( CVarDemoAsyncCheckpointSerialize.GetValueOnGameThread() != 0 )
+		{
+			CheckpointSerializeTask->StartBackgroundTask();
+		}
+		else
 		{
-			ReplayStreamer->FlushCheckpoint( GetDemoCurrentTimeInMS() );
+			CheckpointSerializeTask->StartSynchronousTask();
 		}
 
-		const float TotalCheckpointTimeInMS = TotalCheckpointSaveTimeSeconds * 1000.0;
+		TickCheckpointSerialize( false );
+	}
+}
+
+void UDemoNetDriver::TickCheckpointSerialize( const bool bWaitForCompletion )
+{
+	if ( !CheckpointSerializeTask.IsValid() )
+	{
+		return;
+	}
+
+	if ( bWaitForCompletion )
+	{
+		CheckpointSerializeTask->EnsureCompletion();
+	}
+	else if ( !CheckpointSerializeTask->IsDone() )
+	{
+		return;
+	}
 
-		UE_LOG( LogDemo, Log, TEXT( "Finished checkpoint. Actors: %i, GuidCacheSize: %i, TotalSize: %i, TotalCheckpointSaveFrames: %i, TotalCheckpointTimeInMS: %2.2f" ), GetNetworkObjectList().GetActiveObjects().Num(), GuidCacheSize, TotalCheckpointSize, TotalCheckpointSaveFrames, TotalCheckpointTimeInMS );
+	DECLARE_SCOPE_CYCLE_COUNTER( TEXT( "SaveCheckpoint time" ), STAT_ReplayCheckpointSaveTime, STATGROUP_Net );
+
+	TArray< uint8 >& CheckpointData = CheckpointSerializeTask->GetTask().Result;
+
+	FArchive* CheckpointArchive = ReplayStreamer.IsValid() ? ReplayStreamer->GetCheckpointArchive() : nullptr;
+
+	const int32 TotalCheckpointSize = CheckpointData.Num();
+
+	if ( CheckpointArchive != nullptr && TotalCheckpointSize > 0 )
+	{
+		// The only work left on the game thread is handing the finished buffer to the streamer
+		CheckpointArchive->Serialize( CheckpointData.GetData(), TotalCheckpointSize );
+		ReplayStreamer->FlushCheckpoint( CheckpointSerializeTimeInMS );
 	}
+
+	CheckpointSerializeTask.Reset();
+
+	const float TotalCheckpointTimeInMS = TotalCheckpointSaveTimeSeconds * 1000.0;
+
+	UE_LOG( LogDemo, Log, TEXT( "Finished %s checkpoint. Actors: %i, ReusedActors: %i, GuidCacheSize: %i, TotalSize: %i, TotalCheckpointSaveFrames: %i, TotalCheckpointTimeInMS: %2.2f" ), bIsDeltaCheckpoint ? TEXT( "delta" ) : TEXT( "full" ), GetNetworkObjectList().GetActiveObjects().Num(), NumCheckpointReusedActors, CheckpointGuidCacheSize, TotalCheckpointSize, TotalCheckpointSaveFrames, TotalCheckpointTimeInMS );
 }
 
 void UDemoNetDriver::SaveExternalData( FArchive& Ar )
@@ -1455,6 +1737,9 @@ void UDemoNetDriver::TickDemoRecord( float DeltaSeconds )
 		return;
 	}
 
+	// Hand the last checkpoint to the streamer once the worker is done with it
+	TickCheckpointSerialize( false );
+
 	if ( PendingCheckpointActors.Num() )
 	{
 		// If we're in the middle of saving a checkpoint, then update that now and return
@@ -1705,8 +1990,16 @@ void UDemoNetDriver::TickDemoRecord( float DeltaSeconds )
 
 		Actor->CallPreReplication( this );
 
+		const int32 OriginalOutBunches = OutBunches;
+
 		const bool bDidReplicateActor = DemoReplicateActor( Actor, ClientConnections[0], SpectatorController, false );
 
+		if ( OutBunches != OriginalOutBunches )
+		{
+			// The packets this actor wrote into the last checkpoint are out of date now
+			CheckpointActorPackets.Remove( Actor );
+		}
+
 		if ( bDidReplicateActor && Actor->NetDormancy == DORM_DormantAll )
 		{
 			// If we've replicated this object at least once, and it wants to go dormant, make it dormant now
@@ -1772,6 +2065,12 @@ void UDemoNetDriver::TickDemoRecord( float DeltaSeconds )
 		{
 			SaveCheckpoint();
 			LastCheckpointTime = DemoCurrentTime;
+			LastDeltaCheckpointTime = DemoCurrentTime;
+		}
+		else if (ShouldSaveDeltaCheckpoint())
+		{
+			SaveCheckpoint(true);
+			LastDeltaCheckpointTime = DemoCurrentTime;
 		}
 	}
 }
@@ -1780,6 +2079,11 @@ bool UDemoNetDriver::ShouldSaveCheckpoint()
 {
 	const double CHECKPOINT_DELAY = CVarCheckpointUploadDelayInSeconds.GetValueOnAnyThread();
 
+	if (CheckpointSerializeTask.IsValid())
+	{
+		return false;
+	}
+
 	if (DemoCurrentTime - LastCheckpointTime > CHECKPOINT_DELAY)
 	{
 		return true;
@@ -1788,6 +2092,18 @@ bool UDemoNetDriver::ShouldSaveCheckpoint()
 	return false;
 }
 
+bool UDemoNetDriver::ShouldSaveDeltaCheckpoint() const
+{
+	const double DELTA_CHECKPOINT_DELAY = CVarDeltaCheckpointDelayInSeconds.GetValueOnAnyThread();
+
+	if (DELTA_CHECKPOINT_DELAY <= 0.0 || CheckpointSerializeTask.IsValid() || CheckpointActorPackets.Num() == 0)
+	{
+		return false;
+	}
+
+	return DemoCurrentTime - LastDeltaCheckpointTime > DELTA_CHECKPOINT_DELAY;
+}
+
 void UDemoNetDriver::PauseChannels( const bool bPause )
 {
 	if ( bPause == bChannelsArePaused )
@@ -2177,6 +2493,22 @@ bool UDemoNetDriver::ProcessPacket( uint8* Data, int32 Count )
 }
 
 void UDemoNetDriver::WriteDemoFrameFromQueuedDemoPackets( FArchive& Ar, TArray<FQueuedDemoPacket>& QueuedPackets )
+{
+	WriteDemoFrameHeader( Ar );
+
+	for ( int32 i = 0; i < QueuedPackets.Num(); i++ )
+	{
+		WritePacket( Ar, QueuedPackets[i].Data.GetData(), QueuedPackets[i].Data.Num() );
+	}
+
+	QueuedPackets.Empty();
+
+	// Write a count of 0 to signal the end of the frame
+	int32 EndCount = 0;
+	Ar << EndCount;
+}
+
+void UDemoNetDriver::WriteDemoFrameHeader( FArchive& Ar )
 {
 	Ar << CurrentLevelIndex;
 	
@@ -2203,28 +2535,11 @@ void UDemoNetDriver::WriteDemoFrameFromQueuedDemoPackets( FArchive& Ar, TArray<F
 
 	// Save external data
 	SaveExternalData( Ar );
-
-	for ( int32 i = 0; i < QueuedPackets.Num(); i++ )
-	{
-		WritePacket( Ar, QueuedPackets[i].Data.GetData(), QueuedPackets[i].Data.Num() );
-	}
-
-	QueuedPackets.Empty();
-
-	// Write a count of 0 to signal the end of the frame
-	int32 EndCount = 0;
-	Ar << EndCount;
 }
 
 void UDemoNetDriver::WritePacket( FArchive& Ar, uint8* Data, int32 Count )
 {
-	Ar << Count;
-	Ar.Serialize( Data, Count );
-
-#if DEMO_CHECKSUMS == 1
-	uint32 Checksum = FCrc::MemCrc32( Data, Count, 0 );
-	Ar << Checksum;
-#endif
+	WriteDemoPacket( Ar, Data, Count );
 }
 
 void UDemoNetDriver::SkipTime(const float InTimeToSkip)
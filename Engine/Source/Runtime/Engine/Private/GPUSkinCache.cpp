@@ -23,6 +23,10 @@ DEFINE_STAT(STAT_GPUSkinCache_NumTrianglesForRecomputeTangents);
 DEFINE_STAT(STAT_GPUSkinCache_NumSectionsProcessed);
 DEFINE_STAT(STAT_GPUSkinCache_NumSetVertexStreams);
 DEFINE_STAT(STAT_GPUSkinCache_NumPreGDME);
+DEFINE_STAT(STAT_GPUSkinCache_NumSectionsSkipped);
+DEFINE_STAT(STAT_GPUSkinCache_NumSectionsEvicted);
+DEFINE_STAT(STAT_GPUSkinCache_NumOverflows);
+DEFINE_STAT(STAT_GPUSkinCache_MemoryBudget);
 DEFINE_LOG_CATEGORY_STATIC(LogSkinCache, Log, All);
 
 static int32 GEnableGPUSkinCacheShaders = 0;
@@ -94,6 +98,26 @@ static TAutoConsoleVariable<float> CVarGPUSkinCacheSceneMemoryLimitInMB(
 	ECVF_RenderThreadSafe
 );
 
+static int32 GSkinCacheEvictUnusedFrames = 30;
+static FAutoConsoleVariableRef CVarGPUSkinCacheEvictUnusedFrames(
+	TEXT("r.SkinCache.EvictUnusedFrames"),
+	GSkinCacheEvictUnusedFrames,
+	TEXT("When the scene memory limit is reached, entries that were not updated for more than this many frames are evicted,\n")
+	TEXT("least recently used first, to make room for the new ones. Evicted meshes fall back to vertex shader skinning until they get space again.\n")
+	TEXT(" 0: never evict, new entries fall back to vertex shader skinning when out of memory"),
+	ECVF_RenderThreadSafe
+);
+
+static int32 GSkinCacheSkipUnchangedBones = 1;
+static FAutoConsoleVariableRef CVarGPUSkinCacheSkipUnchangedBones(
+	TEXT("r.SkinCache.SkipUnchangedBones"),
+	GSkinCacheSkipUnchangedBones,
+	TEXT("Whether to skip the skinning of sections without morph targets whose bone transforms did not change since their last dispatch.\n")
+	TEXT(" 0: off\n")
+	TEXT(" 1: on(default)"),
+	ECVF_RenderThreadSafe
+);
+
 static int32 GGPUSkinCacheFlushCounter = 0;
 
 bool IsGPUSkinCacheAvailable()
@@ -127,6 +151,7 @@ public:
 		, GPUSkin(InGPUSkin)
 		, MorphBuffer(0)
 		, LOD(InGPUSkin->GetLOD())
+		, LastFrameUsed(0)
 	{
 		
 		const TArray<FSkelMeshSection>& Sections = InGPUSkin->GetRenderSections(LOD);
@@ -171,6 +196,9 @@ public:
 		//
 		bool bExtraBoneInfluences;
 
+		// whether the allocation holds the output of a dispatch, which can then be kept when the bones did not change
+		bool bSkinned;
+
 		// in floats (4 bytes)
 		uint32 OutputStreamStart;
 		uint32 NumVertices;
@@ -201,6 +229,7 @@ public:
 			, SectionIndex(-1)
 			, SkinType(0)
 			, bExtraBoneInfluences(false)
+			, bSkinned(false)
 			, OutputStreamStart(0)
 			, NumVertices(0)
 			, InputStreamStart(0)
@@ -255,6 +284,7 @@ public:
 		Data.Allocation = InAllocation;
 		Data.SectionIndex = SectionIndex;
 		Data.Section = Section;
+		Data.bSkinned = false;
 
 		check(GPUSkin->GetLOD() == LOD);
 		FSkeletalMeshResource& SkeletalMeshResource = GPUSkin->GetSkeletalMeshResource();
@@ -317,6 +347,9 @@ protected:
 	FShaderResourceViewRHIParamRef MorphBuffer;
 	int32 LOD;
 
+	// frame number of the last ProcessEntry, used to find the least recently used entries when out of memory
+	uint32 LastFrameUsed;
+
 	friend class FGPUSkinCache;
 	friend class FBaseGPUSkinCacheCS;
 	friend class FBaseRecomputeTangents;
@@ -859,13 +892,19 @@ void FGPUSkinCache::DispatchUpdateSkinTangents(FRHICommandListImmediate& RHICmdL
 	}
 }
 
-FGPUSkinCache::FAllocation* FGPUSkinCache::TryAllocBuffer(uint32 NumFloatsRequired)
+FGPUSkinCache::FAllocation* FGPUSkinCache::TryAllocBuffer(uint32 NumFloatsRequired, uint32 FrameNumber)
 {
 	uint64 MaxSizeInBytes = (uint64)(GSkinCacheSceneMemoryLimitInMB * 1024.0f * 1024.0f);
 	uint64 RequiredMemInBytes = sizeof(float) * NumFloatsRequired * FAllocation::NUM_BUFFERS;
-	if (bRequiresMemoryLimit && UsedMemoryInBytes + RequiredMemInBytes >= MaxSizeInBytes)
+	if (bRequiresMemoryLimit)
+	{
+		SET_MEMORY_STAT(STAT_GPUSkinCache_MemoryBudget, MaxSizeInBytes);
+	}
+
+	if (bRequiresMemoryLimit && UsedMemoryInBytes + RequiredMemInBytes >= MaxSizeInBytes && !EvictUnusedEntries(RequiredMemInBytes, MaxSizeInBytes, FrameNumber))
 	{
 		ExtraRequiredMemory += RequiredMemInBytes;
+		INC_DWORD_STAT(STAT_GPUSkinCache_NumOverflows);
 
 		// Can't fit
 		return nullptr;
@@ -891,6 +930,64 @@ FGPUSkinCache::FAllocation* FGPUSkinCache::TryAllocBuffer(uint32 NumFloatsRequir
 	return NewAllocation;
 }
 
+void FGPUSkinCache::ReleaseAllocation(FAllocation* Allocation)
+{
+	uint64 RequiredMemInBytes = sizeof(float) * Allocation->NumFloatsRequired * FAllocation::NUM_BUFFERS;
+	UsedMemoryInBytes -= RequiredMemInBytes;
+	DEC_MEMORY_STAT_BY(STAT_GPUSkinCache_TotalMemUsed, RequiredMemInBytes);
+
+	Allocations.Remove(Allocation);
+	for (uint32 i = 0; i < FAllocation::NUM_BUFFERS; i++)
+	{
+		FRWBuffer& RWBuffer = Allocation->RWBuffers[i];
+		if (RWBuffer.UAV.IsValid())
+		{
+			BuffersToTransition.Remove(RWBuffer.UAV);
+		}
+	}
+
+	delete Allocation;
+}
+
+bool FGPUSkinCache::EvictUnusedEntries(uint64 RequiredMemInBytes, uint64 MaxSizeInBytes, uint32 FrameNumber)
+{
+	if (GSkinCacheEvictUnusedFrames <= 0)
+	{
+		return false;
+	}
+
+	TArray<FGPUSkinCacheEntry*> Candidates;
+	for (FGPUSkinCacheEntry* Entry : Entries)
+	{
+		if (FrameNumber - Entry->LastFrameUsed > (uint32)GSkinCacheEvictUnusedFrames)
+		{
+			Candidates.Add(Entry);
+		}
+	}
+
+	// Least recently used first
+	Candidates.Sort([](const FGPUSkinCacheEntry& A, const FGPUSkinCacheEntry& B) { return A.LastFrameUsed < B.LastFrameUsed; });
+
+	for (int32 CandidateIndex = 0; CandidateIndex < Candidates.Num() && UsedMemoryInBytes + RequiredMemInBytes >= MaxSizeInBytes; ++CandidateIndex)
+	{
+		// The entry is still owned by its mesh object, only invalidate the sections so they get set up again when used
+		FGPUSkinCacheEntry* Entry = Candidates[CandidateIndex];
+		for (int32 Index = 0; Index < Entry->DispatchData.Num(); ++Index)
+		{
+			FGPUSkinCacheEntry::FSectionDispatchData& DispatchData = Entry->DispatchData[Index];
+			if (DispatchData.Allocation)
+			{
+				ReleaseAllocation(DispatchData.Allocation);
+				DispatchData.Allocation = nullptr;
+				DispatchData.SectionIndex = -1;
+				INC_DWORD_STAT(STAT_GPUSkinCache_NumSectionsEvicted);
+			}
+		}
+	}
+
+	return UsedMemoryInBytes + RequiredMemInBytes < MaxSizeInBytes;
+}
+
 
 void FGPUSkinCache::DoDispatch(FRHICommandListImmediate& RHICmdList, FGPUSkinCacheEntry* SkinCacheEntry, int32 Section, int32 FrameNumber)
 {
@@ -908,7 +1005,7 @@ void FGPUSkinCache::DoDispatch(FRHICommandListImmediate& RHICmdList, FGPUSkinCac
 
 void FGPUSkinCache::ProcessEntry(FRHICommandListImmediate& RHICmdList, FGPUBaseSkinVertexFactory* VertexFactory,
 	FGPUSkinPassthroughVertexFactory* TargetVertexFactory, const FSkelMeshSection& BatchElement, FSkeletalMeshObjectGPUSkin* Skin,
-	const FMorphVertexBuffer* MorphVertexBuffer, uint32 FrameNumber, int32 Section, FGPUSkinCacheEntry*& InOutEntry)
+	const FMorphVertexBuffer* MorphVertexBuffer, uint32 FrameNumber, int32 Section, bool bBonesChanged, FGPUSkinCacheEntry*& InOutEntry)
 {
 	INC_DWORD_STAT(STAT_GPUSkinCache_NumSectionsProcessed);
 
@@ -938,12 +1035,14 @@ void FGPUSkinCache::ProcessEntry(FRHICommandListImmediate& RHICmdList, FGPUBaseS
 		}
 		else
 		{
+			InOutEntry->LastFrameUsed = FrameNumber;
+
 			if (!InOutEntry->IsSectionValid(Section))
 			{
 				// This section might not be valid yet, so set it up
 				int32 TotalNumVertices = VertexFactory->GetSkinVertexBuffer()->GetNumVertices();
 				const uint32 NumUAVFloats = (RWStrideInFloats * TotalNumVertices);
-				FAllocation* NewAllocation = TryAllocBuffer(NumUAVFloats);
+				FAllocation* NewAllocation = TryAllocBuffer(NumUAVFloats, FrameNumber);
 				if (!NewAllocation)
 				{
 					// Couldn't fit; caller will notify OOM
@@ -961,7 +1060,7 @@ void FGPUSkinCache::ProcessEntry(FRHICommandListImmediate& RHICmdList, FGPUBaseS
 	{
 		int32 TotalNumVertices = VertexFactory->GetSkinVertexBuffer()->GetNumVertices();
 		const uint32 NumUAVFloats = (RWStrideInFloats * TotalNumVertices);
-		FAllocation* NewAllocation = TryAllocBuffer(NumUAVFloats);
+		FAllocation* NewAllocation = TryAllocBuffer(NumUAVFloats, FrameNumber);
 		if (!NewAllocation)
 		{
 			// Couldn't fit; caller will notify OOM
@@ -971,6 +1070,7 @@ void FGPUSkinCache::ProcessEntry(FRHICommandListImmediate& RHICmdList, FGPUBaseS
 
 		InOutEntry = new FGPUSkinCacheEntry(this, Skin);
 		InOutEntry->GPUSkin = Skin;
+		InOutEntry->LastFrameUsed = FrameNumber;
 
 		InOutEntry->SetupSection(Section, NewAllocation, &LodModel.Sections[Section], MorphVertexBuffer, NumVertices, InputStreamStart, StreamStrides[0], VertexFactory, TargetVertexFactory);
 		Entries.Add(InOutEntry);
@@ -997,8 +1097,18 @@ void FGPUSkinCache::ProcessEntry(FRHICommandListImmediate& RHICmdList, FGPUBaseS
 	}
 	InOutEntry->DispatchData[Section].SkinType = MorphVertexBuffer ? 1 : 0;
 
+	FGPUSkinCacheEntry::FSectionDispatchData& DispatchData = InOutEntry->DispatchData[Section];
+	if (GSkinCacheSkipUnchangedBones && !bBonesChanged && !MorphVertexBuffer && DispatchData.bSkinned)
+	{
+		// Same pose as the last dispatch: keep the output, which is also the previous position from now on (no velocity)
+		INC_DWORD_STAT(STAT_GPUSkinCache_NumSectionsSkipped);
+		DispatchData.Allocation->PreviousIndex = DispatchData.Allocation->CurrentIndex;
+		return;
+	}
+
 	DoDispatch(RHICmdList, InOutEntry, Section, FrameNumber);
 	InOutEntry->UpdateVertexFactoryDeclaration(Section);
+	DispatchData.bSkinned = true;
 }
 
 void FGPUSkinCache::SetVertexStreams(FGPUSkinCacheEntry* Entry, int32 Section, FRHICommandList& RHICmdList, uint32 FrameNumber,
@@ -1072,24 +1182,9 @@ void FGPUSkinCache::InternalRelease(FGPUSkinCacheEntry* SkinCacheEntry)
 	for (int32 Index = 0; Index < SkinCacheEntry->DispatchData.Num(); ++Index)
 	{
 		FGPUSkinCacheEntry::FSectionDispatchData& DispatchData = SkinCacheEntry->DispatchData[Index];
-		FAllocation* Allocation = DispatchData.Allocation;
-		if (Allocation)
+		if (DispatchData.Allocation)
 		{
-			uint64 RequiredMemInBytes = sizeof(float) * Allocation->NumFloatsRequired * FAllocation::NUM_BUFFERS;
-			SkinCache->UsedMemoryInBytes -= RequiredMemInBytes;
-			DEC_MEMORY_STAT_BY(STAT_GPUSkinCache_TotalMemUsed, RequiredMemInBytes);
-
-			SkinCache->Allocations.Remove(Allocation);
-			for (uint32 i = 0; i < FAllocation::NUM_BUFFERS; i++)
-			{
-				FRWBuffer& RWBuffer = Allocation->RWBuffers[i];
-				if (RWBuffer.UAV.IsValid())
-				{
-					SkinCache->BuffersToTransition.Remove(RWBuffer.UAV);
-				}
-			}
-
-			delete Allocation;
+			SkinCache->ReleaseAllocation(DispatchData.Allocation);
 			DispatchData.Allocation = nullptr;
 		}
 	}
@@ -541,6 +541,21 @@ UEngine::UEngine(const FObjectInitializer& ObjectInitializer)
 	bIsVanillaProduct = false;
 }
 
+/** Returns the game instance class of the project settings */
+static UClass* LoadGameInstanceClass()
+{
+	FStringClassReference GameInstanceClassName = GetDefault<UGameMapsSettings>()->GameInstanceClass;
+	UClass* GameInstanceClass = (GameInstanceClassName.IsValid() ? LoadObject<UClass>(NULL, *GameInstanceClassName.ToString()) : UGameInstance::StaticClass());
+
+	if (GameInstanceClass == nullptr)
+	{
+		UE_LOG(LogEngine, Error, TEXT("Unable to load GameInstance Class '%s'. Falling back to generic UGameInstance."), *GameInstanceClassName.ToString());
+		GameInstanceClass = UGameInstance::StaticClass();
+	}
+
+	return GameInstanceClass;
+}
+
 void UGameEngine::Init(IEngineLoop* InEngineLoop)
 {
 	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UGameEngine Init"), STAT_GameEngineStartup, STATGROUP_LoadTime);
@@ -560,18 +575,9 @@ void UGameEngine::Init(IEngineLoop* InEngineLoop)
 	GetGameUserSettings()->LoadSettings();
 	GetGameUserSettings()->ApplyNonResolutionSettings();
 
-	// Create game instance.  For GameEngine, this should be the only GameInstance that ever gets created.
+	// Create game instance.  For GameEngine, this should be the only GameInstance that ever gets created, unless a dedicated server hosts additional games.
 	{
-		FStringClassReference GameInstanceClassName = GetDefault<UGameMapsSettings>()->GameInstanceClass;
-		UClass* GameInstanceClass = (GameInstanceClassName.IsValid() ? LoadObject<UClass>(NULL, *GameInstanceClassName.ToString()) : UGameInstance::StaticClass());
-		
-		if (GameInstanceClass == nullptr)
-		{
-			UE_LOG(LogEngine, Error, TEXT("Unable to load GameInstance Class '%s'. Falling back to generic UGameInstance."), *GameInstanceClassName.ToString());
-			GameInstanceClass = UGameInstance::StaticClass();
-		}
-
-		GameInstance = NewObject<UGameInstance>(this, GameInstanceClass);
+		GameInstance = NewObject<UGameInstance>(this, LoadGameInstanceClass());
 
 		GameInstance->InitializeStandalone();
 	}
@@ -641,6 +647,60 @@ void UGameEngine::Start()
 	UE_LOG(LogInit, Display, TEXT("Starting Game."));
 
 	GameInstance->StartGameInstance();
+
+	int32 NumServerInstances = 1;
+	if (IsRunningDedicatedServer() && FParse::Value(FCommandLine::Get(), TEXT("ServerInstances="), NumServerInstances) && NumServerInstances > 1)
+	{
+		const FURL& InitialURL = GameInstance->GetWorldContext()->LastURL;
+		for (int32 InstanceIndex = 1; InstanceIndex < NumServerInstances; ++InstanceIndex)
+		{
+			FURL URL(InitialURL);
+			URL.Port = InitialURL.Port + InstanceIndex;
+			HostAdditionalGameInstance(URL);
+		}
+	}
+}
+
+UGameInstance* UGameEngine::HostAdditionalGameInstance(const FURL& URL)
+{
+	check(IsRunningDedicatedServer());
+
+	UGameInstance* NewGameInstance = NewObject<UGameInstance>(this, LoadGameInstanceClass());
+	NewGameInstance->InitializeStandalone();
+
+	// LoadMap only loads an independent copy of a map that is already loaded when the context has a PIE instance,
+	// without one a Browse to the map of another game would take over that game's world
+	FWorldContext& WorldContext = *NewGameInstance->GetWorldContext();
+	int32 PIEInstance = 1;
+	for (const FWorldContext& OtherContext : WorldList)
+	{
+		PIEInstance = FMath::Max(PIEInstance, OtherContext.PIEInstance + 1);
+	}
+	WorldContext.PIEInstance = PIEInstance;
+
+	FString Error;
+	if (Browse(WorldContext, URL, Error) != EBrowseReturnVal::Success)
+	{
+		UE_LOG(LogEngine, Error, TEXT("Failed to host additional game %s: %s"), *URL.ToString(), *Error);
+
+		UWorld* World = NewGameInstance->GetWorld();
+		NewGameInstance->Shutdown();
+		if (World)
+		{
+			World->DestroyWorld(false);
+			DestroyWorldContext(World);
+		}
+		return nullptr;
+	}
+
+	for (const FWorldContext& OtherContext : WorldList)
+	{
+		checkf(&OtherContext == &WorldContext || OtherContext.World() != WorldContext.World(), TEXT("Additional game %s shares its world with another game"), *URL.ToString());
+	}
+
+	UE_LOG(LogEngine, Display, TEXT("Hosting additional game %s"), *URL.ToString());
+	AdditionalGameInstances.Add(NewGameInstance);
+	return NewGameInstance;
 }
 
 void UGameEngine::PreExit()
@@ -1326,22 +1386,25 @@ UWorld* UGameEngine::GetGameWorld()
 
 void UGameEngine::HandleNetworkFailure_NotifyGameInstance(UWorld* World, UNetDriver* NetDriver, ENetworkFailure::Type FailureType)
 {
-	if (GameInstance != nullptr)
+	// Additional games hosted by a dedicated server handle their own failures
+	UGameInstance* WorldGameInstance = (World && World->GetGameInstance()) ? World->GetGameInstance() : GameInstance;
+	if (WorldGameInstance != nullptr)
 	{
 		bool bIsServer = true;
 		if (NetDriver != nullptr)
 		{
 			bIsServer = NetDriver->GetNetMode() != NM_Client;
 		}
-		GameInstance->HandleNetworkError(FailureType, bIsServer);
+		WorldGameInstance->HandleNetworkError(FailureType, bIsServer);
 	}
 }
 
 void UGameEngine::HandleTravelFailure_NotifyGameInstance(UWorld* World, ETravelFailure::Type FailureType)
 {
-	if (GameInstance != nullptr)
+	UGameInstance* WorldGameInstance = (World && World->GetGameInstance()) ? World->GetGameInstance() : GameInstance;
+	if (WorldGameInstance != nullptr)
 	{
-		GameInstance->HandleTravelError(FailureType);
+		WorldGameInstance->HandleTravelError(FailureType);
 	}
 }
 
@@ -9,10 +9,12 @@
 #include "Math/RandomStream.h"
 #include "Stats/Stats.h"
 #include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
 #include "UObject/ObjectMacros.h"
 #include "Async/TaskGraphInterfaces.h"
 #include "EngineStats.h"
 #include "Async/AsyncWork.h"
+#include "Async/ParallelFor.h"
 #include "PrimitiveViewRelevance.h"
 #include "ConvexVolume.h"
 #include "AI/Navigation/NavigationSystem.h"
@@ -110,6 +112,27 @@ static TAutoConsoleVariable<int32> CVarMinInstancesPerOcclusionQuery(
 	256,
 	TEXT("Controls the granualrity of occlusion culling. 1024 to 65536 is a reasonable range. This is not exact, actual minimum might be off by a factor of two."));
 
+static TAutoConsoleVariable<int32> CVarParallelTraversal(
+	TEXT("foliage.ParallelTraversal"),
+	1,
+	TEXT("If non-zero, the cluster trees of large components are culled on worker threads, one task per child of the root node."));
+
+static TAutoConsoleVariable<int32> CVarMinInstancesForParallelTraversal(
+	TEXT("foliage.MinInstancesForParallelTraversal"),
+	8192,
+	TEXT("Minimum number of instances in a cluster tree, before it is culled on worker threads."));
+
+static TAutoConsoleVariable<int32> CVarMinInstancesForParallelBuild(
+	TEXT("foliage.MinInstancesForParallelBuild"),
+	16384,
+	TEXT("Cluster tree ranges with at least this many instances are split on worker threads while the tree is built. 0 builds trees on a single thread."));
+
+static TAutoConsoleVariable<int32> CVarMaxDeferredTreeRemovals(
+	TEXT("foliage.MaxDeferredTreeRemovals"),
+	0,
+	TEXT("In game worlds, up to this many removed instances are hidden in the existing cluster tree instead of rebuilding it (never more than a quarter of the tree).\n")
+	TEXT("Overlap queries and navigation wait for the next rebuild. 0 rebuilds the tree on every removal (default)."));
+
 static TAutoConsoleVariable<float> CVarFoliageDensityScale(
 	TEXT("foliage.DensityScale"),
 	1.0,
@@ -192,6 +215,7 @@ class FClusterBuilder
 	int32 InternalNodeBranchingFactor;
 	int32 OcclusionLayerTarget;
 	int32 MaxInstancesPerLeaf;
+	int32 MinInstancesForParallelSplit;
 	int32 NumRoots;
 	TArray<int32> SortIndex;
 	TArray<FVector> SortPoints;
@@ -231,7 +255,7 @@ class FClusterBuilder
 	{
 		checkSlow(InNum);
 		Clusters.Reset();
-		Split(0, InNum - 1);
+		Split(0, InNum - 1, Clusters, SortPairs);
 		Clusters.Sort();
 		checkSlow(Clusters.Num() > 0);
 		int32 At = 0;
@@ -243,7 +267,7 @@ class FClusterBuilder
 		checkSlow(At == InNum);
 	}
 
-	void Split(int32 Start, int32 End)
+	void Split(int32 Start, int32 End, TArray<FRunPair>& OutClusters, TArray<FSortPair>& Scratch)
 	{
 		int32 NumRange = 1 + End - Start;
 		FBox ClusterBounds(ForceInit);
@@ -253,11 +277,11 @@ class FClusterBuilder
 		}
 		if (NumRange <= BranchingFactor)
 		{
-			Clusters.Add(FRunPair(Start, NumRange));
+			OutClusters.Add(FRunPair(Start, NumRange));
 			return;
 		}
 		checkSlow(NumRange >= 2);
-		SortPairs.Reset();
+		Scratch.Reset();
 		int32 BestAxis = -1;
 		float BestAxisValue = -1.0f;
 		for (int32 Axis = 0; Axis < 3; Axis++)
@@ -275,12 +299,12 @@ class FClusterBuilder
 
 			Pair.Index = SortIndex[Index];
 			Pair.d = SortPoints[Pair.Index][BestAxis];
-			SortPairs.Add(Pair);
+			Scratch.Add(Pair);
 		}
-		SortPairs.Sort();
+		Scratch.Sort();
 		for (int32 Index = Start; Index <= End; Index++)
 		{
-			SortIndex[Index] = SortPairs[Index - Start].Index;
+			SortIndex[Index] = Scratch[Index - Start].Index;
 		}
 
 		int32 Half = NumRange / 2;
@@ -290,7 +314,7 @@ class FClusterBuilder
 
 		if (NumRange & 1)
 		{
-			if (SortPairs[Half].d - SortPairs[Half - 1].d < SortPairs[Half + 1].d - SortPairs[Half].d)
+			if (Scratch[Half].d - Scratch[Half - 1].d < Scratch[Half + 1].d - Scratch[Half].d)
 			{
 				EndLeft++;
 			}
@@ -303,8 +327,30 @@ class FClusterBuilder
 		checkSlow(EndLeft >= Start);
 		checkSlow(End >= StartRight);
 
-		Split(Start, EndLeft);
-		Split(StartRight, End);
+		if (MinInstancesForParallelSplit > 0 && NumRange >= MinInstancesForParallelSplit)
+		{
+			// The two halves only touch their own part of SortIndex, so they can be split on separate threads, each with its own scratch space.
+			// The clusters are sorted by start once the whole range is split.
+			TArray<FRunPair> RightClusters;
+			ParallelFor(2, [this, Start, EndLeft, StartRight, End, &OutClusters, &Scratch, &RightClusters](int32 HalfIndex)
+			{
+				if (HalfIndex == 0)
+				{
+					Split(Start, EndLeft, OutClusters, Scratch);
+				}
+				else
+				{
+					TArray<FSortPair> RightSortPairs;
+					Split(StartRight, End, RightClusters, RightSortPairs);
+				}
+			});
+			OutClusters.Append(RightClusters);
+		}
+		else
+		{
+			Split(Start, EndLeft, OutClusters, Scratch);
+			Split(StartRight, End, OutClusters, Scratch);
+		}
 	}
 public:
 	FClusterTree* Result;
@@ -348,6 +394,9 @@ public:
 		}
 		InternalNodeBranchingFactor = CVarFoliageSplitFactor.GetValueOnAnyThread();
 		MaxInstancesPerLeaf = InMaxInstancesPerLeaf;
+
+		const bool bAllowParallelSplit = FApp::ShouldUseThreadingForPerformance() && FTaskGraphInterface::IsRunning();
+		MinInstancesForParallelSplit = bAllowParallelSplit ? FMath::Max(CVarMinInstancesForParallelBuild.GetValueOnAnyThread(), 0) : 0;
 	}
 
 	void BuildAsync(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
@@ -747,6 +796,7 @@ struct FFoliageOcclusionResults
 struct FFoliageElementParams;
 struct FFoliageRenderInstanceParams;
 struct FFoliageCullInstanceParams;
+struct FFoliageTraversalLeaf;
 
 class FHierarchicalStaticMeshSceneProxy : public FInstancedStaticMeshSceneProxy
 {
@@ -881,6 +931,12 @@ public:
 
 	virtual void GetDynamicMeshElements(const TArray<const FSceneView*>& Views, const FSceneViewFamily& ViewFamily, uint32 VisibilityMap, FMeshElementCollector& Collector) const override;
 
+	virtual bool CanGatherDynamicMeshElementsInParallel(const FSceneViewFamily& ViewFamily) const override
+	{
+		// The cluster tree traversal only reads the proxy, except for the occlusion bounds drawn with the PDI and the first instance path of FInstancedStaticMeshSceneProxy
+		return !ViewFamily.EngineShowFlags.FoliageOcclusionBounds && ViewFamily.Views.Num() > 0 && !ViewFamily.Views[0]->bRenderFirstInstanceOnly;
+	}
+
 	virtual const TArray<FBoxSphereBounds>* GetOcclusionQueries(const FSceneView* View) const override;
 	virtual void AcceptOcclusionResults(const FSceneView* View, TArray<bool>* Results, int32 ResultsStart, int32 NumResults) override;
 	virtual bool HasSubprimitiveOcclusionQueries() const override
@@ -896,7 +952,11 @@ public:
 	void FillDynamicMeshElements(FMeshElementCollector& Collector, const FFoliageElementParams& ElementParams, const FFoliageRenderInstanceParams& Instances) const;
 
 	template<bool TUseVector>
-	void Traverse(const FFoliageCullInstanceParams& Params, int32 Index, int32 MinLOD, int32 MaxLOD, bool bFullyContained = false) const;
+	void Traverse(const FFoliageCullInstanceParams& Params, int32 Index, int32 MinLOD, int32 MaxLOD, bool bFullyContained = false, TArray<FFoliageTraversalLeaf>* OutLeaves = nullptr) const;
+
+	/** Same as Traverse from the root node, but traverses the children of the root node on worker threads */
+	template<bool TUseVector>
+	void TraverseParallel(const FFoliageCullInstanceParams& Params, int32 MinLOD, int32 MaxLOD, bool bFullyContained) const;
 };
 
 struct FFoliageRenderInstanceParams
@@ -984,6 +1044,14 @@ struct FFoliageCullInstanceParams : public FFoliageRenderInstanceParams
 	}
 };
 
+/** A node found visible by a traversal on a worker thread, added as a run once the traversal finished */
+struct FFoliageTraversalLeaf
+{
+	int32 NodeIndex;
+	int32 MinLOD;
+	int32 MaxLOD;
+};
+
 static bool GUseVectorCull = true;
 
 static void ToggleUseVectorCull(const TArray<FString>& Args)
@@ -1095,25 +1163,30 @@ inline void CalcLOD(int32& InOutMinLOD, int32& InOutMaxLOD, const FVector& Bound
 	}
 }
 
+/**
+ * Culls a node of the cluster tree and narrows its LOD range.
+ *
+ * @return false if the node and all of its children are culled, otherwise bOutSplit tells whether the children need traversing
+ */
 template<bool TUseVector>
-void FHierarchicalStaticMeshSceneProxy::Traverse(const FFoliageCullInstanceParams& Params, int32 Index, int32 MinLOD, int32 MaxLOD, bool bFullyContained) const
+static FORCEINLINE_DEBUGGABLE bool VisitNode(const FFoliageCullInstanceParams& Params, int32 Index, int32& InOutMinLOD, int32& InOutMaxLOD, bool& bInOutFullyContained, bool& bOutSplit)
 {
 	const FClusterNode& Node = Params.Tree[Index];
-	if (!bFullyContained)
+	if (!bInOutFullyContained)
 	{
-		if (CullNode<TUseVector>(Params, Node, bFullyContained))
+		if (CullNode<TUseVector>(Params, Node, bInOutFullyContained))
 		{
-			return;
+			return false;
 		}
 	}
 
-	if (MinLOD != MaxLOD)
+	if (InOutMinLOD != InOutMaxLOD)
 	{
-		CalcLOD(MinLOD, MaxLOD, Node.BoundMin, Node.BoundMax, Params.ViewOriginInLocalZero, Params.ViewOriginInLocalOne, Params.LODPlanesMin, Params.LODPlanesMax);
+		CalcLOD(InOutMinLOD, InOutMaxLOD, Node.BoundMin, Node.BoundMax, Params.ViewOriginInLocalZero, Params.ViewOriginInLocalOne, Params.LODPlanesMin, Params.LODPlanesMax);
 
-		if (MinLOD >= Params.LODs)
+		if (InOutMinLOD >= Params.LODs)
 		{
-			return;
+			return false;
 		}
 	}
 	if (Index >= Params.FirstOcclusionNode && Index <= Params.LastOcclusionNode)
@@ -1123,23 +1196,82 @@ void FHierarchicalStaticMeshSceneProxy::Traverse(const FFoliageCullInstanceParam
 		if (OcclusionResultsArray[Params.OcclusionResultsStart + Index - Params.FirstOcclusionNode])
 		{
 			INC_DWORD_STAT_BY(STAT_OcclusionCulledFoliageInstances, 1 + Node.LastInstance - Node.FirstInstance);
-			return;
+			return false;
 		}
 	}
 
-	bool bSplit = (!bFullyContained || MinLOD < MaxLOD || Index < Params.FirstOcclusionNode) 
+	bOutSplit = (!bInOutFullyContained || InOutMinLOD < InOutMaxLOD || Index < Params.FirstOcclusionNode) 
 		&& Node.FirstChild >= 0 
-		&& (1 + Node.LastInstance - Node.FirstInstance) >= Params.MinInstancesToSplit[MinLOD];
+		&& (1 + Node.LastInstance - Node.FirstInstance) >= Params.MinInstancesToSplit[InOutMinLOD];
+
+	if (!bOutSplit)
+	{
+		InOutMaxLOD = FMath::Min(InOutMaxLOD, Params.LODs - 1);
+	}
+	return true;
+}
+
+template<bool TUseVector>
+void FHierarchicalStaticMeshSceneProxy::Traverse(const FFoliageCullInstanceParams& Params, int32 Index, int32 MinLOD, int32 MaxLOD, bool bFullyContained, TArray<FFoliageTraversalLeaf>* OutLeaves) const
+{
+	bool bSplit = false;
+	if (!VisitNode<TUseVector>(Params, Index, MinLOD, MaxLOD, bFullyContained, bSplit))
+	{
+		return;
+	}
 
 	if (!bSplit)
 	{
-		MaxLOD = FMath::Min(MaxLOD, Params.LODs - 1);
-		Params.AddRun(MinLOD, MaxLOD, Node);
+		if (OutLeaves)
+		{
+			OutLeaves->Add({ Index, MinLOD, MaxLOD });
+		}
+		else
+		{
+			Params.AddRun(MinLOD, MaxLOD, Params.Tree[Index]);
+		}
 		return;
 	}
+	const FClusterNode& Node = Params.Tree[Index];
 	for (int32 ChildIndex = Node.FirstChild; ChildIndex <= Node.LastChild; ChildIndex++)
 	{
-		Traverse<TUseVector>(Params, ChildIndex, MinLOD, MaxLOD, bFullyContained);
+		Traverse<TUseVector>(Params, ChildIndex, MinLOD, MaxLOD, bFullyContained, OutLeaves);
+	}
+}
+
+template<bool TUseVector>
+void FHierarchicalStaticMeshSceneProxy::TraverseParallel(const FFoliageCullInstanceParams& Params, int32 MinLOD, int32 MaxLOD, bool bFullyContained) const
+{
+	bool bSplit = false;
+	if (!VisitNode<TUseVector>(Params, 0, MinLOD, MaxLOD, bFullyContained, bSplit))
+	{
+		return;
+	}
+
+	const FClusterNode& Root = Params.Tree[0];
+	if (!bSplit)
+	{
+		Params.AddRun(MinLOD, MaxLOD, Root);
+		return;
+	}
+
+	// The runs use the scene rendering mem stack of the rendering thread, so the tasks only collect the visible nodes
+	const int32 NumChildren = 1 + Root.LastChild - Root.FirstChild;
+	TArray<TArray<FFoliageTraversalLeaf>, TInlineAllocator<16>> ChildLeaves;
+	ChildLeaves.AddDefaulted(NumChildren);
+
+	ParallelFor(NumChildren, [this, &Params, &Root, &ChildLeaves, MinLOD, MaxLOD, bFullyContained](int32 ChildOffset)
+	{
+		Traverse<TUseVector>(Params, Root.FirstChild + ChildOffset, MinLOD, MaxLOD, bFullyContained, &ChildLeaves[ChildOffset]);
+	});
+
+	// Children are stored in instance order, so adding their leaves in order merges the runs exactly like a serial traversal
+	for (const TArray<FFoliageTraversalLeaf>& Leaves : ChildLeaves)
+	{
+		for (const FFoliageTraversalLeaf& Leaf : Leaves)
+		{
+			Params.AddRun(Leaf.MinLOD, Leaf.MaxLOD, Params.Tree[Leaf.NodeIndex]);
+		}
 	}
 }
 
@@ -1564,7 +1696,22 @@ void FHierarchicalStaticMeshSceneProxy::GetDynamicMeshElements(const TArray<cons
 
 					if (CVarCullAll.GetValueOnRenderThread() < 1)
 					{
-						if (bUseVectorCull)
+						const FClusterNode& Root = ClusterTree[0];
+						const bool bParallelTraversal = CVarParallelTraversal.GetValueOnRenderThread() > 0 && FApp::ShouldUseThreadingForPerformance()
+							&& Root.FirstChild >= 0 && (1 + Root.LastInstance - Root.FirstInstance) >= CVarMinInstancesForParallelTraversal.GetValueOnRenderThread();
+
+						if (bParallelTraversal)
+						{
+							if (bUseVectorCull)
+							{
+								TraverseParallel<true>(InstanceParams, UseMinLOD, UseMaxLOD, bDisableCull);
+							}
+							else
+							{
+								TraverseParallel<false>(InstanceParams, UseMinLOD, UseMaxLOD, bDisableCull);
+							}
+						}
+						else if (bUseVectorCull)
 						{
 							Traverse<true>(InstanceParams, 0, UseMinLOD, UseMaxLOD, bDisableCull);
 						}
@@ -1890,6 +2037,34 @@ void UHierarchicalInstancedStaticMeshComponent::RemoveInstanceInternal(int32 Ins
 	}
 }
 
+void UHierarchicalInstancedStaticMeshComponent::RebuildTreeAfterRemoval()
+{
+	if (!bAutoRebuildTreeOnInstanceChanges)
+	{
+		return;
+	}
+
+	if (IsAsyncBuilding())
+	{
+		// invalidate the results of the current async build as it's too slow to fix up deletes
+		bConcurrentRemoval = true;
+		return;
+	}
+
+	// The removed instances are nullified in the render data, so the current tree still renders correctly.
+	// Only queries need the rebuilt tree (see IsTreeFullyBuilt), which is why this is limited to game worlds and a few removals.
+	const int32 MaxDeferredRemovals = CVarMaxDeferredTreeRemovals.GetValueOnGameThread();
+	const bool bCanDefer = MaxDeferredRemovals > 0
+		&& GetWorld() && GetWorld()->IsGameWorld()
+		&& NumBuiltInstances > 0
+		&& UnbuiltInstanceBoundsList.Num() == 0
+		&& RemovedInstances.Num() <= FMath::Min(MaxDeferredRemovals, NumBuiltRenderInstances / 4);
+	if (!bCanDefer)
+	{
+		BuildTreeAsync();
+	}
+}
+
 bool UHierarchicalInstancedStaticMeshComponent::RemoveInstances(const TArray<int32>& InstancesToRemove)
 {
 	if (InstancesToRemove.Num() == 0)
@@ -1912,18 +2087,7 @@ bool UHierarchicalInstancedStaticMeshComponent::RemoveInstances(const TArray<int
 		RemoveInstanceInternal(Index);
 	}
 
-	if (bAutoRebuildTreeOnInstanceChanges)
-	{
-		if (IsAsyncBuilding())
-		{
-			// invalidate the results of the current async build as it's too slow to fix up deletes
-			bConcurrentRemoval = true;
-		}
-		else
-		{
-			BuildTreeAsync();
-		}
-	}
+	RebuildTreeAfterRemoval();
 
 	ReleasePerInstanceRenderData();
 	MarkRenderStateDirty();
@@ -1940,18 +2104,7 @@ bool UHierarchicalInstancedStaticMeshComponent::RemoveInstance(int32 InstanceInd
 
 	RemoveInstanceInternal(InstanceIndex);
 
-	if (bAutoRebuildTreeOnInstanceChanges)
-	{
-		if (IsAsyncBuilding())
-		{
-			// invalidate the results of the current async build as it's too slow to fix up deletes
-			bConcurrentRemoval = true;
-		}
-		else
-		{
-			BuildTreeAsync();
-		}
-	}
+	RebuildTreeAfterRemoval();
 
 	ReleasePerInstanceRenderData();
 	MarkRenderStateDirty();
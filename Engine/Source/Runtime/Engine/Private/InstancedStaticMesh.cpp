@@ -23,6 +23,7 @@
 #include "GameFramework/WorldSettings.h"
 #include "ComponentRecreateRenderStateContext.h"
 #include "SceneManagement.h"
+#include "UObject/RenderingObjectVersion.h"
 
 const int32 InstancedStaticMeshMaxTexCoord = 8;
 
@@ -33,6 +34,19 @@ TAutoConsoleVariable<int32> CVarMinLOD(
 	-1,
 	TEXT("Used to discard the top LODs for performance evaluation. -1: Disable all effects of this cvar."));
 
+static TAutoConsoleVariable<int32> CVarCompactCookedInstanceData(
+	TEXT("r.InstancedStaticMeshes.CompactCookedData"),
+	0,
+	TEXT("Whether to store the instances of instanced static mesh components quantized when cooking, about a quarter of the size on disk.\n")
+	TEXT("Components whose instances can't be reconstructed within r.InstancedStaticMeshes.CompactCookedDataTolerance keep the full format."),
+	ECVF_ReadOnly);
+
+static TAutoConsoleVariable<float> CVarCompactCookedInstanceDataTolerance(
+	TEXT("r.InstancedStaticMeshes.CompactCookedDataTolerance"),
+	0.1f,
+	TEXT("Maximum distance in world units the bounds of an instance may move by when its transform is quantized for r.InstancedStaticMeshes.CompactCookedData."),
+	ECVF_ReadOnly);
+
 
 /** InstancedStaticMeshInstance hit proxy */
 void HInstancedStaticMeshInstance::AddReferencedObjects(FReferenceCollector& Collector)
@@ -1362,11 +1376,186 @@ void UInstancedStaticMeshComponent::GetLightAndShadowMapMemoryUsage( int32& Ligh
 }
 
 
+namespace CompactInstanceData
+{
+	/** Number of consecutive instances sharing the bounds their locations are quantized within */
+	static const int32 InstancesPerBlock = 64;
+
+	/** An instance transform, location relative to the bounds of its block, rotation as a normalized quaternion */
+	struct FPackedInstance
+	{
+		uint16 Location[3];
+		int16 Rotation[4];
+		FFloat16 Scale[3];
+
+		friend FArchive& operator<<(FArchive& Ar, FPackedInstance& Instance)
+		{
+			for (int32 Index = 0; Index < 3; ++Index)
+			{
+				Ar << Instance.Location[Index];
+			}
+			for (int32 Index = 0; Index < 4; ++Index)
+			{
+				Ar << Instance.Rotation[Index];
+			}
+			for (int32 Index = 0; Index < 3; ++Index)
+			{
+				Ar << Instance.Scale[Index];
+			}
+			return Ar;
+		}
+	};
+
+	static FORCEINLINE uint16 QuantizeUnit(float Value)
+	{
+		return (uint16)FMath::Clamp(FMath::RoundToInt(Value * 65535.0f), 0, 65535);
+	}
+
+	static FORCEINLINE int16 QuantizeSigned(float Value)
+	{
+		return (int16)FMath::Clamp(FMath::RoundToInt(Value * 32767.0f), -32767, 32767);
+	}
+
+	static FTransform Unpack(const FPackedInstance& Instance, const FBox& BlockBounds)
+	{
+		const FVector Extent = BlockBounds.Max - BlockBounds.Min;
+		const FVector Location(
+			BlockBounds.Min.X + Extent.X * (Instance.Location[0] / 65535.0f),
+			BlockBounds.Min.Y + Extent.Y * (Instance.Location[1] / 65535.0f),
+			BlockBounds.Min.Z + Extent.Z * (Instance.Location[2] / 65535.0f));
+
+		FQuat Rotation(Instance.Rotation[0] / 32767.0f, Instance.Rotation[1] / 32767.0f, Instance.Rotation[2] / 32767.0f, Instance.Rotation[3] / 32767.0f);
+		Rotation.Normalize();
+
+		const FVector Scale(Instance.Scale[0].GetFloat(), Instance.Scale[1].GetFloat(), Instance.Scale[2].GetFloat());
+		return FTransform(Rotation, Location, Scale);
+	}
+
+	/**
+	 * Quantizes the instances, failing if any of them can't be reconstructed within Tolerance at the bounds of the mesh
+	 * (e.g. sheared transforms) or if they don't share the same deprecated UV biases.
+	 */
+	static bool Pack(const TArray<FInstancedStaticMeshInstanceData>& Instances, float MeshRadius, float Tolerance, TArray<FBox>& OutBlockBounds, TArray<FPackedInstance>& OutInstances)
+	{
+		OutBlockBounds.Reset((Instances.Num() + InstancesPerBlock - 1) / InstancesPerBlock);
+		OutInstances.Reset(Instances.Num());
+
+		const FVector TestPoints[] =
+		{
+			FVector::ZeroVector,
+			FVector(MeshRadius, 0, 0), FVector(-MeshRadius, 0, 0),
+			FVector(0, MeshRadius, 0), FVector(0, -MeshRadius, 0),
+			FVector(0, 0, MeshRadius), FVector(0, 0, -MeshRadius),
+		};
+
+		for (int32 FirstInstance = 0; FirstInstance < Instances.Num(); FirstInstance += InstancesPerBlock)
+		{
+			const int32 LastInstance = FMath::Min(FirstInstance + InstancesPerBlock, Instances.Num());
+
+			FBox BlockBounds(ForceInit);
+			for (int32 InstanceIndex = FirstInstance; InstanceIndex < LastInstance; ++InstanceIndex)
+			{
+				BlockBounds += Instances[InstanceIndex].Transform.GetOrigin();
+			}
+			OutBlockBounds.Add(BlockBounds);
+
+			const FVector Extent = BlockBounds.Max - BlockBounds.Min;
+			for (int32 InstanceIndex = FirstInstance; InstanceIndex < LastInstance; ++InstanceIndex)
+			{
+				const FInstancedStaticMeshInstanceData& InstanceData = Instances[InstanceIndex];
+				if (InstanceData.LightmapUVBias_DEPRECATED != Instances[0].LightmapUVBias_DEPRECATED
+					|| InstanceData.ShadowmapUVBias_DEPRECATED != Instances[0].ShadowmapUVBias_DEPRECATED)
+				{
+					return false;
+				}
+
+				const FTransform Transform(InstanceData.Transform);
+				const FVector Location = Transform.GetLocation();
+				FQuat Rotation = Transform.GetRotation().GetNormalized();
+				// Both signs are the same rotation, keep W positive so it can't flip between instances of a block
+				if (Rotation.W < 0.0f)
+				{
+					Rotation = FQuat(-Rotation.X, -Rotation.Y, -Rotation.Z, -Rotation.W);
+				}
+				const FVector Scale = Transform.GetScale3D();
+
+				FPackedInstance& Packed = OutInstances[OutInstances.AddUninitialized()];
+				Packed.Location[0] = Extent.X > 0.0f ? QuantizeUnit((Location.X - BlockBounds.Min.X) / Extent.X) : 0;
+				Packed.Location[1] = Extent.Y > 0.0f ? QuantizeUnit((Location.Y - BlockBounds.Min.Y) / Extent.Y) : 0;
+				Packed.Location[2] = Extent.Z > 0.0f ? QuantizeUnit((Location.Z - BlockBounds.Min.Z) / Extent.Z) : 0;
+				Packed.Rotation[0] = QuantizeSigned(Rotation.X);
+				Packed.Rotation[1] = QuantizeSigned(Rotation.Y);
+				Packed.Rotation[2] = QuantizeSigned(Rotation.Z);
+				Packed.Rotation[3] = QuantizeSigned(Rotation.W);
+				Packed.Scale[0] = FFloat16(Scale.X);
+				Packed.Scale[1] = FFloat16(Scale.Y);
+				Packed.Scale[2] = FFloat16(Scale.Z);
+
+				const FMatrix Unpacked = Unpack(Packed, BlockBounds).ToMatrixWithScale();
+				for (const FVector& TestPoint : TestPoints)
+				{
+					if (FVector::DistSquared(Unpacked.TransformPosition(TestPoint), InstanceData.Transform.TransformPosition(TestPoint)) > FMath::Square(Tolerance))
+					{
+						return false;
+					}
+				}
+			}
+		}
+
+		return true;
+	}
+}
+
 void UInstancedStaticMeshComponent::Serialize(FArchive& Ar)
 {
 	Super::Serialize(Ar);
 
-	PerInstanceSMData.BulkSerialize(Ar);
+	Ar.UsingCustomVersion(FRenderingObjectVersion::GUID);
+
+	bool bCompact = false;
+	TArray<FBox> BlockBounds;
+	TArray<CompactInstanceData::FPackedInstance> PackedInstances;
+	FVector2D UVBias[2] = { FVector2D::ZeroVector, FVector2D::ZeroVector };
+
+	if (Ar.IsCooking() && PerInstanceSMData.Num() > 0 && CVarCompactCookedInstanceData.GetValueOnAnyThread() != 0)
+	{
+		const float MeshRadius = GetStaticMesh() ? GetStaticMesh()->GetBounds().SphereRadius : 0.0f;
+		bCompact = CompactInstanceData::Pack(PerInstanceSMData, MeshRadius, CVarCompactCookedInstanceDataTolerance.GetValueOnAnyThread(), BlockBounds, PackedInstances);
+		if (bCompact)
+		{
+			UVBias[0] = PerInstanceSMData[0].LightmapUVBias_DEPRECATED;
+			UVBias[1] = PerInstanceSMData[0].ShadowmapUVBias_DEPRECATED;
+		}
+	}
+
+	if (Ar.CustomVer(FRenderingObjectVersion::GUID) >= FRenderingObjectVersion::CompactInstancedStaticMeshData)
+	{
+		Ar << bCompact;
+	}
+
+	if (bCompact)
+	{
+		Ar << UVBias[0] << UVBias[1];
+		Ar << BlockBounds;
+		Ar << PackedInstances;
+
+		if (Ar.IsLoading())
+		{
+			PerInstanceSMData.Empty(PackedInstances.Num());
+			for (int32 InstanceIndex = 0; InstanceIndex < PackedInstances.Num(); ++InstanceIndex)
+			{
+				const int32 BlockIndex = InstanceIndex / CompactInstanceData::InstancesPerBlock;
+				FInstancedStaticMeshInstanceData& InstanceData = PerInstanceSMData[PerInstanceSMData.AddDefaulted()];
+				InstanceData.Transform = CompactInstanceData::Unpack(PackedInstances[InstanceIndex], BlockBounds.IsValidIndex(BlockIndex) ? BlockBounds[BlockIndex] : FBox(ForceInitToZero)).ToMatrixWithScale();
+				InstanceData.LightmapUVBias_DEPRECATED = UVBias[0];
+				InstanceData.ShadowmapUVBias_DEPRECATED = UVBias[1];
+			}
+		}
+	}
+	else
+	{
+		PerInstanceSMData.BulkSerialize(Ar);
+	}
 
 #if WITH_EDITOR
 	if( Ar.IsTransacting() )
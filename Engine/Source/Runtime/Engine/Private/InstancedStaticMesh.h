@@ -578,6 +578,12 @@ public:
 
 	virtual void GetDistanceFieldInstanceInfo(int32& NumInstances, float& BoundsSurfaceArea) const override;
 
+	/** The occluder geometry is in the space of a single instance, so instances are never used as software occluders */
+	virtual const FStaticMeshOccluderData* GetOccluderData() const override
+	{
+		return nullptr;
+	}
+
 	/**
 	 * Creates the hit proxies are used when DrawDynamicElements is called.
 	 * Called in the game thread.
@@ -55,6 +55,7 @@ Level.cpp: Level-related functions
 #include "Components/ModelComponent.h"
 #include "Engine/LevelActorContainer.h"
 #include "Engine/StaticMeshActor.h"
+#include "PhysicsPublic.h"
 
 DEFINE_LOG_CATEGORY(LogLevel);
 
@@ -66,6 +67,14 @@ static FAutoConsoleVariableRef CVarUseBackgroundLevelStreaming(
 	ECVF_Default
 );
 
+int32 GBatchLevelStreamingPhysicsBodies = 1;
+static FAutoConsoleVariableRef CVarBatchLevelStreamingPhysicsBodies(
+	TEXT("p.BatchLevelStreamingPhysicsBodies"),
+	GBatchLevelStreamingPhysicsBodies,
+	TEXT("Whether static physics bodies of streamed level components are added to the physics scene once per registration step instead of one component at a time."),
+	ECVF_Default
+);
+
 /*-----------------------------------------------------------------------------
 ULevel implementation.
 -----------------------------------------------------------------------------*/
@@ -699,6 +708,9 @@ void ULevel::ClearLevelComponents()
 {
 	bAreComponentsCurrentlyRegistered = false;
 
+	// The level is leaving the world, a partially routed initialization must not be resumed when it comes back
+	ResetRouteActorInitialization();
+
 	// Remove the model components from the scene.
 	for (UModelComponent* ModelComponent : ModelComponents)
 	{
@@ -942,6 +954,15 @@ void ULevel::IncrementalUpdateComponents(int32 NumComponentsToUpdate, bool bReru
 		checkf(OwningWorld->IsGameWorld(), TEXT("Cannot call IncrementalUpdateComponents with non 0 argument in the Editor/ commandlets."));
 	}
 
+#if WITH_PHYSX
+	// Static bodies registered in this step are added to the scene together once it's done, nothing runs scene queries in between
+	FPhysScene* PhysScene = (GBatchLevelStreamingPhysicsBodies && bIsAssociatingLevel && OwningWorld) ? OwningWorld->GetPhysicsScene() : nullptr;
+	if (PhysScene)
+	{
+		PhysScene->BeginDeferredActorBatch();
+	}
+#endif
+
 	// Do BSP on the first pass.
 	if (CurrentActorIndexForUpdateComponents == 0)
 	{
@@ -977,6 +998,13 @@ void ULevel::IncrementalUpdateComponents(int32 NumComponentsToUpdate, bool bReru
 		}
 	}
 
+#if WITH_PHYSX
+	if (PhysScene)
+	{
+		PhysScene->EndDeferredActorBatch();
+	}
+#endif
+
 	// See whether we are done.
 	if (CurrentActorIndexForUpdateComponents == Actors.Num())
 	{
@@ -1762,24 +1790,56 @@ void ULevel::ReleaseRenderingResources()
 
 void ULevel::RouteActorInitialize()
 {
-	// Send PreInitializeComponents and collect volumes.
-	for( int32 Index = 0; Index < Actors.Num(); ++Index )
+	IncrementalRouteActorInitialize(0);
+}
+
+bool ULevel::IncrementalRouteActorInitialize(int32 NumActorsToProcess)
+{
+	if (NumActorsToProcess <= 0)
+	{
+		NumActorsToProcess = MAX_int32;
+	}
+
+	if (RouteActorInitializationState == ERouteActorInitializationState::Preinitialize)
 	{
-		AActor* const Actor = Actors[Index];
-		if( Actor && !Actor->IsActorInitialized() )
+		// Send PreInitializeComponents and collect volumes.
+		int32 NumActorsProcessed = 0;
+		while (RouteActorInitializationIndex < Actors.Num() && NumActorsProcessed < NumActorsToProcess)
 		{
-			Actor->PreInitializeComponents();
+			AActor* const Actor = Actors[RouteActorInitializationIndex++];
+			if (Actor && !Actor->IsActorInitialized())
+			{
+				Actor->PreInitializeComponents();
+				NumActorsProcessed++;
+			}
 		}
-	}
 
-	const bool bCallBeginPlay = OwningWorld->HasBegunPlay();
-	TArray<AActor *> ActorsToBeginPlay;
+		if (RouteActorInitializationIndex < Actors.Num())
+		{
+			return false;
+		}
 
-	// Send InitializeComponents on components and PostInitializeComponents.
-	for( int32 Index = 0; Index < Actors.Num(); ++Index )
+		RouteActorInitializationState = ERouteActorInitializationState::Initialize;
+		RouteActorInitializationIndex = 0;
+		ActorsToBeginPlay.Reset();
+	}
+
+	if (RouteActorInitializationState == ERouteActorInitializationState::Initialize)
 	{
-		AActor* const Actor = Actors[Index];
-		if( Actor )
+		// Gather the actors of this run, UpdateOverlaps is called on the already initialized ones too
+		TArray<AActor*, TInlineAllocator<64>> ActorsToInitialize;
+		while (RouteActorInitializationIndex < Actors.Num() && ActorsToInitialize.Num() < NumActorsToProcess)
+		{
+			AActor* const Actor = Actors[RouteActorInitializationIndex++];
+			if (Actor)
+			{
+				ActorsToInitialize.Add(Actor);
+			}
+		}
+
+		// Send InitializeComponents on components and PostInitializeComponents.
+		const bool bCallBeginPlay = OwningWorld->HasBegunPlay();
+		for (AActor* Actor : ActorsToInitialize)
 		{
 			if( !Actor->IsActorInitialized() )
 			{
@@ -1803,15 +1863,44 @@ void ULevel::RouteActorInitialize()
 			//	     Rather, it was always touching and the mechanics of loading is just an implementation detail.
 			Actor->UpdateOverlaps(Actor->bGenerateOverlapEventsDuringLevelStreaming);
 		}
+
+		if (RouteActorInitializationIndex < Actors.Num())
+		{
+			return false;
+		}
+
+		RouteActorInitializationState = ERouteActorInitializationState::BeginPlay;
+		RouteActorInitializationIndex = 0;
 	}
 
-	// Do this in a second pass to make sure they're all initialized before begin play starts
-	for (int32 ActorIndex = 0; ActorIndex < ActorsToBeginPlay.Num(); ActorIndex++)
+	// Do this in a separate step to make sure they're all initialized before begin play starts
+	int32 NumActorsProcessed = 0;
+	while (RouteActorInitializationIndex < ActorsToBeginPlay.Num() && NumActorsProcessed < NumActorsToProcess)
 	{
-		AActor* Actor = ActorsToBeginPlay[ActorIndex];
-		SCOPE_CYCLE_COUNTER(STAT_ActorBeginPlay);
-		Actor->DispatchBeginPlay();
+		AActor* Actor = ActorsToBeginPlay[RouteActorInitializationIndex++].Get();
+		if (Actor)
+		{
+			SCOPE_CYCLE_COUNTER(STAT_ActorBeginPlay);
+			Actor->DispatchBeginPlay();
+			NumActorsProcessed++;
+		}
 	}
+
+	if (RouteActorInitializationIndex < ActorsToBeginPlay.Num())
+	{
+		return false;
+	}
+
+	// Ready for the next time the level is made visible
+	ResetRouteActorInitialization();
+	return true;
+}
+
+void ULevel::ResetRouteActorInitialization()
+{
+	RouteActorInitializationState = ERouteActorInitializationState::Preinitialize;
+	RouteActorInitializationIndex = 0;
+	ActorsToBeginPlay.Empty();
 }
 
 UPackage* ULevel::CreateMapBuildDataPackage() const
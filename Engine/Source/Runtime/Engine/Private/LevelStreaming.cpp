@@ -3,6 +3,7 @@
 #include "Engine/LevelStreaming.h"
 #include "ContentStreaming.h"
 #include "Misc/App.h"
+#include "HAL/IConsoleManager.h"
 #include "UObject/Package.h"
 #include "Serialization/ArchiveTraceRoute.h"
 #include "Misc/PackageName.h"
@@ -24,6 +25,7 @@
 	#include "Widgets/Notifications/SNotificationList.h"
 #endif
 #include "Engine/LevelStreamingKismet.h"
+#include "Engine/LevelStreamingGridCell.h"
 #include "Components/BrushComponent.h"
 #include "Engine/CoreSettings.h"
 #include "PhysicsEngine/BodySetup.h"
@@ -1091,4 +1093,79 @@ bool ULevelStreamingAlwaysLoaded::ShouldBeLoaded() const
 	return true;
 }
 
+/*-----------------------------------------------------------------------------
+	ULevelStreamingGridCell implementation.
+-----------------------------------------------------------------------------*/
+static TAutoConsoleVariable<float> CVarGridStreamingUnloadRangeScale(
+	TEXT("s.GridStreaming.UnloadRangeScale"),
+	1.2f,
+	TEXT("Scale of grid cell loading range beyond which a loaded cell is unloaded again, prevents cells from streaming in and out on cell borders."));
+
+ULevelStreamingGridCell::ULevelStreamingGridCell(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+	, CellCoords(ForceInitToZero)
+	, CellBounds(ForceInit)
+	, LoadingRange(50000.0f)
+{
+}
+
+bool ULevelStreamingGridCell::ShouldBeLoaded() const
+{
+	return bShouldBeLoaded;
+}
+
+void ULevelStreamingGridCell::UpdateStreamingState(UWorld* World)
+{
+	check(World);
+
+	TArray<FVector> ViewLocations;
+	for (FConstPlayerControllerIterator Iterator = World->GetPlayerControllerIterator(); Iterator; ++Iterator)
+	{
+		APlayerController* PlayerController = Iterator->Get();
+		if (PlayerController)
+		{
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+			ViewLocations.Add(ViewLocation);
+		}
+	}
+
+	// Without any view keep the current state, players can be missing for a few frames during travel
+	if (ViewLocations.Num() || IsRunningCommandlet())
+	{
+		UpdateStreamingState(World, ViewLocations);
+	}
+}
+
+void ULevelStreamingGridCell::UpdateStreamingState(UWorld* World, const TArray<FVector>& ViewLocations)
+{
+	check(World);
+
+	const float UnloadRangeScale = FMath::Max(CVarGridStreamingUnloadRangeScale.GetValueOnGameThread(), 1.0f);
+	const bool bLoadAllCells = IsRunningCommandlet();
+
+	for (ULevelStreaming* StreamingLevel : World->StreamingLevels)
+	{
+		ULevelStreamingGridCell* GridCell = Cast<ULevelStreamingGridCell>(StreamingLevel);
+		if (GridCell == nullptr || GridCell->bDisableDistanceStreaming)
+		{
+			continue;
+		}
+
+		// Loaded cells use the larger unload range, cells don't flip state while a view moves along their border
+		const float Range = GridCell->bShouldBeLoaded ? GridCell->LoadingRange * UnloadRangeScale : GridCell->LoadingRange;
+		const float RangeSq = FMath::Square(Range);
+
+		bool bInRange = bLoadAllCells || !GridCell->CellBounds.IsValid;
+		for (int32 ViewIndex = 0; ViewIndex < ViewLocations.Num() && !bInRange; ViewIndex++)
+		{
+			bInRange = (GridCell->CellBounds.ComputeSquaredDistanceToPoint(ViewLocations[ViewIndex]) <= RangeSq);
+		}
+
+		GridCell->bShouldBeLoaded = bInRange;
+		GridCell->bShouldBeVisible = bInRange;
+	}
+}
+
 #undef LOCTEXT_NAMESPACE
@@ -9,6 +9,7 @@
 #include "Misc/CoreMisc.h"
 #include "Stats/Stats.h"
 #include "Misc/TimeGuard.h"
+#include "ProfilingDebugging/FrameTrace.h"
 #include "Misc/MemStack.h"
 #include "HAL/IConsoleManager.h"
 #include "Misc/App.h"
@@ -31,6 +32,7 @@
 #include "Engine/NetConnection.h"
 #include "UnrealEngine.h"
 #include "Engine/LevelStreamingVolume.h"
+#include "Engine/LevelStreamingGridCell.h"
 #include "Engine/WorldComposition.h"
 #include "Collision.h"
 #include "PhysicsPublic.h"
@@ -942,6 +944,12 @@ void UWorld::SendAllEndOfFrameUpdates()
 			ComponentsThatNeedEndOfFrameUpdate.Reset();
 	};
 
+	// Send the primitives created and the transforms of all primitives moved this frame to the rendering thread together
+	if (Scene)
+	{
+		Scene->BeginPrimitiveTransformBatch();
+	}
+
 	if (CVarAllowAsyncRenderThreadUpdatesDuringGamethreadUpdates.GetValueOnGameThread() > 0)
 	{
 		ParallelForWithPreWork(LocalComponentsThatNeedEndOfFrameUpdate.Num(), ParallelWork, GTWork);
@@ -952,6 +960,11 @@ void UWorld::SendAllEndOfFrameUpdates()
 		ParallelFor(LocalComponentsThatNeedEndOfFrameUpdate.Num(), ParallelWork);
 	}
 	LocalComponentsThatNeedEndOfFrameUpdate.Reset();
+
+	if (Scene)
+	{
+		Scene->EndPrimitiveTransformBatch();
+	}
 }
 
 
@@ -1123,6 +1136,14 @@ static FAutoConsoleVariableRef CVarTimeBetweenPurgingPendingKillObjects(
 	ECVF_Default
 	);
 
+static float GIncrementalReachabilityTimeLimit = 0.002f;
+static FAutoConsoleVariableRef CVarIncrementalReachabilityTimeLimit(
+	TEXT("gc.IncrementalReachabilityTimeLimit"),
+	GIncrementalReachabilityTimeLimit,
+	TEXT("Time in seconds (real time) spent marking reachable objects each frame while incremental reachability analysis is pending (see gc.AllowIncrementalReachability)."),
+	ECVF_Default
+	);
+
 #include "GameFramework/SpawnActorTimer.h"
 
 TDrawEvent<FRHICommandList>* BeginTickDrawEvent()
@@ -1210,6 +1231,8 @@ void UWorld::Tick( ELevelTick TickType, float DeltaSeconds )
 		return;
 	}
 
+	FRAME_TRACE_SCOPE("UWorld::Tick");
+
 	TDrawEvent<FRHICommandList>* TickDrawEvent = BeginTickDrawEvent();
 
 	FWorldDelegates::OnWorldTickStart.Broadcast(TickType, DeltaSeconds);
@@ -1453,6 +1476,7 @@ void UWorld::Tick( ELevelTick TickType, float DeltaSeconds )
 					if (IsGameWorld())
 					{
 						ProcessLevelStreamingVolumes();
+						ULevelStreamingGridCell::UpdateStreamingState(this);
 
 						if (WorldComposition)
 						{
@@ -1565,6 +1589,16 @@ void UWorld::Tick( ELevelTick TickType, float DeltaSeconds )
 		{
 			bShouldDelayGarbageCollect = false;
 		}
+		// Keep marking if reachability analysis has been spread over several frames, nothing gets purged until it's done.
+		else if( IsIncrementalReachabilityAnalysisPending() )
+		{
+			SCOPE_CYCLE_COUNTER(STAT_GCMarkTime);
+			if( !IsAsyncLoading() && TryCollectGarbageIncrementally(GARBAGE_COLLECTION_KEEPFLAGS, GIncrementalReachabilityTimeLimit) )
+			{
+				CleanupActors();
+				TimeSinceLastPendingKillPurge = 0.0f;
+			}
+		}
 		// Perform incremental purge update if it's pending or in progress.
 		else if( !IsIncrementalPurgePending() 
 		// Purge reference to pending kill objects every now and so often.
@@ -1692,8 +1726,8 @@ void UWorld::PerformGarbageCollectionAndCleanupActors()
 	// to block on loading the remaining data.
 	if( !IsAsyncLoading() )
 	{
-		// Perform housekeeping.
-		if (TryCollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, false))
+		// Perform housekeeping. Reachability analysis may be spread over the next frames, see gc.AllowIncrementalReachability.
+		if (TryCollectGarbageIncrementally(GARBAGE_COLLECTION_KEEPFLAGS, GIncrementalReachabilityTimeLimit))
 		{
 			CleanupActors();
 
@@ -37,7 +37,8 @@ void CacheMaterialInstanceUniformExpressions(const UMaterialInstance* MaterialIn
 	// can change at runtime and would invalidate the parameter cache.
 	if (MaterialInstance->Resources[0])
 	{
-		MaterialInstance->Resources[0]->CacheUniformExpressions_GameThread();
+		// Parameters are often set several times a frame, evaluate them once before rendering
+		MaterialInstance->Resources[0]->CacheUniformExpressions_GameThread(true);
 	}
 }
 
@@ -35,6 +35,8 @@
 
 DEFINE_LOG_CATEGORY(LogMaterial);
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Uniform Expression Caches Updated"), STAT_UniformExpressionCachesUpdated, STATGROUP_SceneRendering);
+
 FName MaterialQualityLevelNames[] = 
 {
 	FName(TEXT("Low")),
@@ -1966,11 +1968,21 @@ void FMaterialRenderProxy::EvaluateUniformExpressions(FUniformExpressionCache& O
 	OutUniformExpressionCache.bUpToDate = true;
 }
 
-void FMaterialRenderProxy::CacheUniformExpressions()
+void FMaterialRenderProxy::CacheUniformExpressions(bool bQueueForDeferredUpdate)
 {
 	// Register the render proxy's as a render resource so it can receive notifications to free the uniform buffer.
 	InitResource();
 
+	if (bQueueForDeferredUpdate)
+	{
+		// Until then the cache stays invalid and draws evaluate the expressions themselves
+		DeferredUniformExpressionCacheRequests.Add(this);
+		return;
+	}
+
+	DeferredUniformExpressionCacheRequests.Remove(this);
+	INC_DWORD_STAT(STAT_UniformExpressionCachesUpdated);
+
 	bool bUsingNewLoader = EVENT_DRIVEN_ASYNC_LOAD_ACTIVE_AT_RUNTIME && GEventDrivenLoaderEnabled;
 
 	check((bUsingNewLoader && GIsInitialLoad) || // The EDL at boot time maybe not load the default materials first; we need to intialize materials before the default materials are done
@@ -2008,19 +2020,35 @@ void FMaterialRenderProxy::CacheUniformExpressions()
 	});
 }
 
-void FMaterialRenderProxy::CacheUniformExpressions_GameThread()
+void FMaterialRenderProxy::CacheUniformExpressions_GameThread(bool bQueueForDeferredUpdate)
 {
 	if (FApp::CanEverRender())
 	{
 		FMaterialRenderProxy* RenderProxy = this;
 		ENQUEUE_RENDER_COMMAND(FCacheUniformExpressionsCommand)(
-			[RenderProxy](FRHICommandListImmediate& RHICmdList)
+			[RenderProxy, bQueueForDeferredUpdate](FRHICommandListImmediate& RHICmdList)
 			{
-				RenderProxy->CacheUniformExpressions();
+				RenderProxy->CacheUniformExpressions(bQueueForDeferredUpdate);
 			});
 	}
 }
 
+void FMaterialRenderProxy::UpdateDeferredCachedUniformExpressions()
+{
+	check(IsInRenderingThread());
+
+	if (DeferredUniformExpressionCacheRequests.Num() > 0)
+	{
+		TArray<FMaterialRenderProxy*> ProxiesToUpdate = DeferredUniformExpressionCacheRequests.Array();
+		DeferredUniformExpressionCacheRequests.Reset();
+
+		for (FMaterialRenderProxy* Proxy : ProxiesToUpdate)
+		{
+			Proxy->CacheUniformExpressions();
+		}
+	}
+}
+
 void FMaterialRenderProxy::InvalidateUniformExpressionCache()
 {
 	check(IsInRenderingThread());
@@ -2078,10 +2106,12 @@ void FMaterialRenderProxy::InitDynamicRHI()
 void FMaterialRenderProxy::ReleaseDynamicRHI()
 {
 	FMaterialRenderProxy::MaterialRenderProxyMap.Remove(this);
+	FMaterialRenderProxy::DeferredUniformExpressionCacheRequests.Remove(this);
 	InvalidateUniformExpressionCache();
 }
 
 TSet<FMaterialRenderProxy*> FMaterialRenderProxy::MaterialRenderProxyMap;
+TSet<FMaterialRenderProxy*> FMaterialRenderProxy::DeferredUniformExpressionCacheRequests;
 
 /*-----------------------------------------------------------------------------
 	FColoredMaterialRenderProxy
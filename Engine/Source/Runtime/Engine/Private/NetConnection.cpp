@@ -560,6 +560,14 @@ void UNetConnection::ReceivedRawPacket( void* InData, int32 Count )
 
 	if (Handler.IsValid())
 	{
+		// The handler components run on the packet handler thread, the result is picked up by ReceivedThreadedPackets
+		if (Handler->IsThreaded())
+		{
+			Handler->QueueIncoming(Data, Count);
+
+			return;
+		}
+
 		const ProcessedPacket UnProcessedPacket = Handler->Incoming(Data, Count);
 
 		if (!UnProcessedPacket.bError)
@@ -585,7 +593,40 @@ void UNetConnection::ReceivedRawPacket( void* InData, int32 Count )
 		}
 	}
 
+	ReceivedProcessedPacket(Data, Count);
+}
+
+void UNetConnection::ReceivedThreadedPackets()
+{
+	if (Handler.IsValid() && Handler->IsThreaded())
+	{
+		TArray<uint8> Data;
+		int32 CountBits = 0;
+		bool bError = false;
+
+		while (State != USOCK_Closed && Handler->GetThreadedIncomingPacket(Data, CountBits, bError))
+		{
+			if (bError)
+			{
+				CLOSE_CONNECTION_DUE_TO_SECURITY_VIOLATION(this, ESecurityEvent::Malformed_Packet,
+															TEXT("Packet failed threaded PacketHandler processing."));
+
+				break;
+			}
+
+			const int32 Count = FMath::DivideAndRoundUp(CountBits, 8);
+
+			// Packets consumed by the handler components are returned empty
+			if (Count > 0)
+			{
+				ReceivedProcessedPacket(Data.GetData(), Count);
+			}
+		}
+	}
+}
 
+void UNetConnection::ReceivedProcessedPacket(uint8* Data, int32 Count)
+{
 	// Handle an incoming raw packet from the driver.
 	UE_LOG(LogNetTraffic, Verbose, TEXT("%6.3f: Received %i"), FPlatformTime::Seconds() - GStartTime, Count );
 	int32 PacketBytes = Count + PacketOverhead;
@@ -5,6 +5,8 @@
 =============================================================================*/
 
 #include "CoreMinimal.h"
+#include "HAL/LowLevelMemTracker.h"
+#include "ProfilingDebugging/CsvProfiler.h"
 #include "Misc/CoreMisc.h"
 #include "Misc/CommandLine.h"
 #include "Misc/NetworkGuid.h"
@@ -47,6 +49,7 @@
 #include "Engine/ActorChannel.h"
 #include "Engine/VoiceChannel.h"
 #include "Engine/NetworkObjectList.h"
+#include "Engine/NetworkSpatialGrid.h"
 #include "GameFramework/GameNetworkManager.h"
 #include "Net/OnlineEngineInterface.h"
 #include "NetworkingDistanceConstants.h"
@@ -54,6 +57,8 @@
 #include "Net/DataChannel.h"
 #include "GameFramework/PlayerState.h"
 #include "Net/PerfCountersHelpers.h"
+#include "Async/ParallelFor.h"
+#include "Misc/App.h"
 
 
 #if USE_SERVER_PERF_COUNTERS
@@ -168,6 +173,23 @@ static TAutoConsoleVariable<int32> CVarUseAdaptiveNetUpdateFrequency(
 	1, 
 	TEXT( "If 1, NetUpdateFrequency will be calculated based on how often actors actually send something when replicating" ) );
 
+static TAutoConsoleVariable<int32> CVarParallelPrioritizeActors(
+	TEXT( "net.ParallelPrioritizeActors" ),
+	0,
+	TEXT( "If 1, the relevancy and priority of the actors for each connection are worked out on worker threads in ServerReplicateActors.\n" )
+	TEXT( "Replicating the actors stays on the game thread. AActor::IsNetRelevantFor, GetNetPriority and GetNetDormancy overrides must be thread safe to use this." ) );
+
+static TAutoConsoleVariable<int32> CVarUseSpatialGrid(
+	TEXT( "net.UseSpatialGrid" ),
+	0,
+	TEXT( "If 1, the actors considered for replication are hashed into a grid and each connection only prioritizes the actors in cells within net cull distance of its viewers.\n" )
+	TEXT( "Actors whose relevancy isn't purely distance based, and actors with an open channel, are still considered for every connection." ) );
+
+static TAutoConsoleVariable<float> CVarSpatialGridCellSize(
+	TEXT( "net.SpatialGridCellSize" ),
+	10000.0f,
+	TEXT( "Size of the cells of net.UseSpatialGrid in world units." ) );
+
 /*-----------------------------------------------------------------------------
 	UNetDriver implementation.
 -----------------------------------------------------------------------------*/
@@ -339,6 +361,25 @@ static TAutoConsoleVariable<int32> CVarOptimizedRemapping( TEXT( "net.OptimizedR
 
 void UNetDriver::TickFlush(float DeltaSeconds)
 {
+	LLM_SCOPE(ELLMTag::Networking);
+#if CSV_PROFILER
+	if (FCsvProfiler::IsCapturing())
+	{
+		// Connections update their rates regardless of stat collection, sum them up over all drivers
+		int32 TotalInBytesPerSecond = ServerConnection ? ServerConnection->InBytesPerSecond : 0;
+		int32 TotalOutBytesPerSecond = ServerConnection ? ServerConnection->OutBytesPerSecond : 0;
+		for (UNetConnection* Client : ClientConnections)
+		{
+			if (Client)
+			{
+				TotalInBytesPerSecond += Client->InBytesPerSecond;
+				TotalOutBytesPerSecond += Client->OutBytesPerSecond;
+			}
+		}
+		CSV_CUSTOM_STAT(NetInKBps, TotalInBytesPerSecond / 1024.0, ECsvCustomStatOp::Accumulate);
+		CSV_CUSTOM_STAT(NetOutKBps, TotalOutBytesPerSecond / 1024.0, ECsvCustomStatOp::Accumulate);
+	}
+#endif
 #if USE_SERVER_PERF_COUNTERS
 	double ServerReplicateActorsTimeMs = 0.0f;
 #endif // USE_SERVER_PERF_COUNTERS
@@ -1181,8 +1222,22 @@ bool UNetDriver::IsServer() const
 	return ServerConnection == NULL;
 }
 
+void UNetDriver::ReceivedThreadedPackets()
+{
+	if ( ServerConnection != nullptr )
+	{
+		ServerConnection->ReceivedThreadedPackets();
+	}
+
+	for ( int32 i = 0; i < ClientConnections.Num(); i++ )
+	{
+		ClientConnections[i]->ReceivedThreadedPackets();
+	}
+}
+
 void UNetDriver::TickDispatch( float DeltaTime )
 {
+	LLM_SCOPE(ELLMTag::Networking);
 	SendCycles=RecvCycles=0;
 
 	const double CurrentRealtime = FPlatformTime::Seconds();
@@ -1206,6 +1261,9 @@ void UNetDriver::TickDispatch( float DeltaTime )
 	// Checks for standby cheats if enabled
 	UpdateStandbyCheatStatus();
 
+	// Pick up the packets the packet handler thread finished with since the last tick
+	ReceivedThreadedPackets();
+
 	// Delete any straggler connections.
 	if( !ServerConnection )
 	{
@@ -2894,6 +2952,107 @@ int32 UNetDriver::ServerReplicateActors_PrioritizeActors( UNetConnection* Connec
 	return FinalSortedCount;
 }
 
+/** Prioritized actors of one connection, filled in on a worker thread by ServerReplicateActors_PrioritizeActorsParallel */
+struct FConnectionPrioritization
+{
+	UNetConnection*				Connection;
+	TArray<FNetViewer>			Viewers;
+	TArray<FActorPriority>		PriorityList;
+	TArray<FActorPriority*>		PriorityActors;
+
+	// Channel changes found while prioritizing, they are applied on the game thread before the actors are replicated
+	TArray<UActorChannel*>		ChannelsToClose;
+	TArray<UActorChannel*>		ChannelsToStartDormant;
+
+	/** Actors gathered from the spatial grid, when it is used */
+	TArray<FNetworkObjectInfo*>	ConsiderList;
+
+	FConnectionPrioritization()
+		: Connection( nullptr )
+	{
+	}
+};
+
+void UNetDriver::ServerReplicateActors_PrioritizeActorsParallel( FConnectionPrioritization& Prioritization, const TArray<FNetworkObjectInfo*>& ConsiderList, const bool bDormancyEnabled, const bool bLowNetBandwidth ) const
+{
+	UNetConnection* Connection = Prioritization.Connection;
+	const TArray<FNetViewer>& ConnectionViewers = Prioritization.Viewers;
+
+	Connection->TickCount++;
+
+	const int32 MaxSortedActors = ConsiderList.Num() + Connection->DestroyedStartupOrDormantActors.Num();
+	Prioritization.PriorityList.Reset( MaxSortedActors );
+
+	for ( FNetworkObjectInfo* ActorInfo : ConsiderList )
+	{
+		AActor* Actor = ActorInfo->Actor;
+
+		UActorChannel* Channel = Connection->ActorChannels.FindRef( Actor );
+
+		UNetConnection* PriorityConnection = Connection;
+
+		if ( Actor->bOnlyRelevantToOwner )
+		{
+			bool bHasNullViewTarget = false;
+
+			PriorityConnection = IsActorOwnedByAndRelevantToConnection( Actor, ConnectionViewers, bHasNullViewTarget );
+
+			if ( PriorityConnection == nullptr )
+			{
+				if ( !bHasNullViewTarget && Channel != NULL && Time - Channel->RelevantTime >= RelevantTimeout )
+				{
+					Prioritization.ChannelsToClose.Add( Channel );
+				}
+				continue;
+			}
+		}
+		else if ( bDormancyEnabled )
+		{
+			if ( IsActorDormant( ActorInfo, Connection ) )
+			{
+				continue;
+			}
+
+			if ( ShouldActorGoDormant( Actor, ConnectionViewers, Channel, Time, bLowNetBandwidth ) )
+			{
+				Prioritization.ChannelsToStartDormant.Add( Channel );
+			}
+		}
+
+		if ( !Channel )
+		{
+			if ( !IsLevelInitializedForActor( Actor, Connection ) || !IsActorRelevantToConnection( Actor, ConnectionViewers ) )
+			{
+				continue;
+			}
+		}
+
+		// Actor::NetTag is shared by all connections, so sent temporaries are skipped by looking them up instead
+		if ( Connection->SentTemporaries.Contains( Actor ) )
+		{
+			continue;
+		}
+
+		new( Prioritization.PriorityList )FActorPriority( PriorityConnection, Channel, ActorInfo, ConnectionViewers, bLowNetBandwidth );
+	}
+
+	// Add in deleted actors
+	for ( auto It = Connection->DestroyedStartupOrDormantActors.CreateConstIterator(); It; ++It )
+	{
+		FActorDestructionInfo& DInfo = const_cast<FActorDestructionInfo&>( DestroyedStartupOrDormantActors.FindChecked( *It ) );
+		new( Prioritization.PriorityList )FActorPriority( Connection, &DInfo, ConnectionViewers );
+	}
+
+	// the list is complete, so the pointers into it stay valid
+	Prioritization.PriorityActors.Reset( Prioritization.PriorityList.Num() );
+	for ( FActorPriority& Priority : Prioritization.PriorityList )
+	{
+		Prioritization.PriorityActors.Add( &Priority );
+	}
+
+	Sort( Prioritization.PriorityActors.GetData(), Prioritization.PriorityActors.Num(), FCompareFActorPriority() );
+}
+
 int32 UNetDriver::ServerReplicateActors_ProcessPrioritizedActors( UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers, FActorPriority** PriorityActors, const int32 FinalSortedCount, int32& OutUpdated )
 {
 	if ( !Connection->IsNetReady( 0 ) )
@@ -3128,8 +3287,72 @@ int32 UNetDriver::ServerReplicateActors(float DeltaSeconds)
 	// Build the consider list (actors that are ready to replicate)
 	ServerReplicateActors_BuildConsiderList( ConsiderList, ServerTickTime );
 
+	// Hash the consider list, so connections only need to look at the actors near their viewers
+	const FNetworkSpatialGrid* Grid = nullptr;
+	if ( CVarUseSpatialGrid.GetValueOnGameThread() > 0 && GetDefault<AGameNetworkManager>()->bUseDistanceBasedRelevancy )
+	{
+		if ( !SpatialGrid.IsValid() )
+		{
+			SpatialGrid = MakeShareable( new FNetworkSpatialGrid );
+		}
+		SpatialGrid->Build( ConsiderList, CVarSpatialGridCellSize.GetValueOnGameThread() );
+		Grid = SpatialGrid.Get();
+	}
+	TArray<FNetworkObjectInfo*> ConnectionConsiderList;
+
 	FMemMark Mark( FMemStack::Get() );
 
+	// With net.ParallelPrioritizeActors the connections that are ticked this frame are prioritized on worker threads up front.
+	// Everything that changes channels or writes bunches still happens one connection at a time below.
+	TArray<FConnectionPrioritization> ParallelPrioritizations;
+	TArray<int32> ParallelPrioritizationIndices;
+
+	if ( CVarParallelPrioritizeActors.GetValueOnGameThread() > 0 && NumClientsToTick > 1 && !DebugRelevantActors && FApp::ShouldUseThreadingForPerformance() )
+	{
+		SCOPE_CYCLE_COUNTER( STAT_NetPrioritizeActorsTime );
+
+		const bool bDormancyEnabled = CVarSetNetDormancyEnabled.GetValueOnGameThread() != 0;
+		AGameNetworkManager* const NetworkManager = World->NetworkManager;
+		const bool bLowNetBandwidth = NetworkManager ? NetworkManager->IsInLowBandwidthMode() : false;
+
+		ParallelPrioritizationIndices.Init( INDEX_NONE, NumClientsToTick );
+		ParallelPrioritizations.Reserve( NumClientsToTick );
+
+		for ( int32 i = 0; i < NumClientsToTick; i++ )
+		{
+			UNetConnection* Connection = ClientConnections[i];
+			if ( Connection->ViewTarget )
+			{
+				check( World == Connection->OwningActor->GetWorld() );
+				check( World == Connection->ViewTarget->GetWorld() );
+
+				ParallelPrioritizationIndices[i] = ParallelPrioritizations.Num();
+				FConnectionPrioritization& Prioritization = ParallelPrioritizations[ParallelPrioritizations.AddDefaulted()];
+				Prioritization.Connection = Connection;
+
+				// viewers can trace against the world, so they are set up here on the game thread
+				new( Prioritization.Viewers )FNetViewer( Connection, DeltaSeconds );
+				for ( int32 ViewerIndex = 0; ViewerIndex < Connection->Children.Num(); ViewerIndex++ )
+				{
+					if ( Connection->Children[ViewerIndex]->ViewTarget != NULL )
+					{
+						new( Prioritization.Viewers )FNetViewer( Connection->Children[ViewerIndex], DeltaSeconds );
+					}
+				}
+			}
+		}
+
+		ParallelFor( ParallelPrioritizations.Num(), [this, &ParallelPrioritizations, &ConsiderList, Grid, bDormancyEnabled, bLowNetBandwidth]( int32 Index )
+		{
+			FConnectionPrioritization& Prioritization = ParallelPrioritizations[Index];
+			if ( Grid )
+			{
+				Grid->GatherConsiderList( Prioritization.Connection, Prioritization.Viewers, Prioritization.ConsiderList );
+			}
+			ServerReplicateActors_PrioritizeActorsParallel( Prioritization, Grid ? Prioritization.ConsiderList : ConsiderList, bDormancyEnabled, bLowNetBandwidth );
+		});
+	}
+
 	for ( int32 i=0; i < ClientConnections.Num(); i++ )
 	{
 		UNetConnection* Connection = ClientConnections[i];
@@ -3176,16 +3399,21 @@ int32 UNetDriver::ServerReplicateActors(float DeltaSeconds)
 		}
 		else if (Connection->ViewTarget)
 		{		
+			FConnectionPrioritization* Prioritization = ParallelPrioritizationIndices.IsValidIndex( i ) && ParallelPrioritizationIndices[i] != INDEX_NONE ? &ParallelPrioritizations[ParallelPrioritizationIndices[i]] : nullptr;
+
 			// Make a list of viewers this connection should consider (this connection and children of this connection)
-			TArray<FNetViewer>& ConnectionViewers = WorldSettings->ReplicationViewers;
+			TArray<FNetViewer>& ConnectionViewers = Prioritization ? Prioritization->Viewers : WorldSettings->ReplicationViewers;
 
-			ConnectionViewers.Reset();
-			new( ConnectionViewers )FNetViewer( Connection, DeltaSeconds );
-			for ( int32 ViewerIndex = 0; ViewerIndex < Connection->Children.Num(); ViewerIndex++ )
+			if ( !Prioritization )
 			{
-				if ( Connection->Children[ViewerIndex]->ViewTarget != NULL )
+				ConnectionViewers.Reset();
+				new( ConnectionViewers )FNetViewer( Connection, DeltaSeconds );
+				for ( int32 ViewerIndex = 0; ViewerIndex < Connection->Children.Num(); ViewerIndex++ )
 				{
-					new( ConnectionViewers )FNetViewer( Connection->Children[ViewerIndex], DeltaSeconds );
+					if ( Connection->Children[ViewerIndex]->ViewTarget != NULL )
+					{
+						new( ConnectionViewers )FNetViewer( Connection->Children[ViewerIndex], DeltaSeconds );
+					}
 				}
 			}
 
@@ -3209,8 +3437,33 @@ int32 UNetDriver::ServerReplicateActors(float DeltaSeconds)
 			FActorPriority* PriorityList	= NULL;
 			FActorPriority** PriorityActors = NULL;
 
-			// Get a sorted list of actors for this connection
-			const int32 FinalSortedCount = ServerReplicateActors_PrioritizeActors( Connection, ConnectionViewers, ConsiderList, bCPUSaturated, PriorityList, PriorityActors );
+			int32 FinalSortedCount = 0;
+			if ( Prioritization )
+			{
+				// Apply the channel changes the worker found, then use its sorted list
+				for ( UActorChannel* Channel : Prioritization->ChannelsToClose )
+				{
+					Channel->Close();
+				}
+				for ( UActorChannel* Channel : Prioritization->ChannelsToStartDormant )
+				{
+					Channel->StartBecomingDormant();
+				}
+
+				PriorityActors = Prioritization->PriorityActors.GetData();
+				FinalSortedCount = Prioritization->PriorityActors.Num();
+				SET_DWORD_STAT( STAT_PrioritizedActors, FinalSortedCount );
+			}
+			else
+			{
+				if ( Grid )
+				{
+					Grid->GatherConsiderList( Connection, ConnectionViewers, ConnectionConsiderList );
+				}
+
+				// Get a sorted list of actors for this connection
+				FinalSortedCount = ServerReplicateActors_PrioritizeActors( Connection, ConnectionViewers, Grid ? ConnectionConsiderList : ConsiderList, bCPUSaturated, PriorityList, PriorityActors );
+			}
 
 			// Process the sorted list of actors for this connection
 			const int32 LastProcessedActor = ServerReplicateActors_ProcessPrioritizedActors( Connection, ConnectionViewers, PriorityActors, FinalSortedCount, Updated );
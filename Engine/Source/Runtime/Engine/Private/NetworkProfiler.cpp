@@ -12,6 +12,9 @@
 #include "Misc/App.h"
 #include "Engine/EngineBaseTypes.h"
 #include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Engine/ActorChannel.h"
+#include "HAL/IConsoleManager.h"
 
 #if USE_NETWORK_PROFILER
 
@@ -37,6 +40,18 @@ static const FString UnknownName("UnknownName");
 
 static const double MaxTempFileAgeSeconds = 60.0 * 60.0 * 24.0 * 5.0;
 
+/** Length of one bucket of the live bandwidth window. */
+static const double LiveBucketSeconds = 1.0;
+
+static TAutoConsoleVariable<float> CVarTopBandwidthWindow( TEXT( "net.TopBandwidthWindow" ), 10.0f, TEXT( "Length in seconds of the sliding window net.TopBandwidth averages over" ) );
+
+DECLARE_STATS_GROUP(TEXT("NetBandwidth"), STATGROUP_NetBandwidth, STATCAT_Advanced);
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Connections"), STAT_NetBandwidthConnections, STATGROUP_NetBandwidth);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Bunch bits/s per connection"), STAT_NetBandwidthBunchBits, STATGROUP_NetBandwidth);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Property bits/s per connection"), STAT_NetBandwidthPropertyBits, STATGROUP_NetBandwidth);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("RPC bits/s per connection"), STAT_NetBandwidthRPCBits, STATGROUP_NetBandwidth);
+
 enum ENetworkProfilingPayloadType
 {
 	NPTYPE_FrameMarker			= 0,	// Frame marker, signaling beginning of frame.	
@@ -99,6 +114,7 @@ FNetworkProfiler::FNetworkProfiler()
 :	FileWriter(NULL)
 ,	bHasNoticeableNetworkTrafficOccured(false)
 ,	bIsTrackingEnabled(false)
+,	bIsLiveTrackingEnabled(false)
 ,	LastAddress( 0xFFFFFFFFFFFFFFFF )
 {
 }
@@ -192,6 +208,216 @@ void FNetworkProfiler::EnableTracking( bool bShouldEnableTracking )
 	bIsTrackingEnabled = bShouldEnableTracking;
 }
 
+/**
+ * Enables/ disables gathering the live bandwidth summary, independently of the file capture.
+ *
+ * @param	bShouldEnableTracking	Whether the summary should be gathered or not
+ */
+void FNetworkProfiler::EnableLiveTracking( bool bShouldEnableTracking )
+{
+	SCOPE_LOCK_REF(CriticalSection);
+
+	UE_LOG(LogNet, Log, TEXT("Network Profiler: live bandwidth summary %s"), bShouldEnableTracking ? TEXT("ENABLED") : TEXT("DISABLED"));
+
+	LiveBuckets.Empty();
+	bIsLiveTrackingEnabled = bShouldEnableTracking;
+}
+
+void FNetworkProfiler::UpdateLiveBuckets()
+{
+	const double Now = FPlatformTime::Seconds();
+
+	if ( LiveBuckets.Num() > 0 && Now - LiveBuckets.Last().StartTime < LiveBucketSeconds )
+	{
+		return;
+	}
+
+	const double WindowSeconds = FMath::Max( CVarTopBandwidthWindow.GetValueOnAnyThread(), (float)LiveBucketSeconds );
+
+	int32 NumExpired = 0;
+	while ( NumExpired < LiveBuckets.Num() && Now - LiveBuckets[NumExpired].StartTime > WindowSeconds )
+	{
+		NumExpired++;
+	}
+	LiveBuckets.RemoveAt( 0, NumExpired, false );
+
+#if STATS
+	// Stats are refreshed once per bucket, from the buckets that are complete
+	if ( LiveBuckets.Num() > 0 )
+	{
+		TSet<const UNetConnection*> Connections;
+		uint64 TotalBits[LBC_Max] = { 0 };
+		for ( const FLiveBandwidthBucket& Bucket : LiveBuckets )
+		{
+			for ( const auto& Pair : Bucket.ConnectionBits )
+			{
+				Connections.Add( Pair.Key );
+			}
+			for ( int32 Category = 0; Category < LBC_Max; Category++ )
+			{
+				for ( const auto& Pair : Bucket.Bits[Category] )
+				{
+					TotalBits[Category] += Pair.Value;
+				}
+			}
+		}
+
+		const double Scale = 1.0 / ( FMath::Max( Now - LiveBuckets[0].StartTime, LiveBucketSeconds ) * FMath::Max( Connections.Num(), 1 ) );
+		SET_DWORD_STAT( STAT_NetBandwidthConnections, Connections.Num() );
+		SET_DWORD_STAT( STAT_NetBandwidthBunchBits, (uint32)( TotalBits[LBC_Actor] * Scale ) );
+		SET_DWORD_STAT( STAT_NetBandwidthPropertyBits, (uint32)( TotalBits[LBC_Property] * Scale ) );
+		SET_DWORD_STAT( STAT_NetBandwidthRPCBits, (uint32)( TotalBits[LBC_RPC] * Scale ) );
+	}
+#endif
+
+	FLiveBandwidthBucket& NewBucket = LiveBuckets[LiveBuckets.AddDefaulted()];
+	NewBucket.StartTime = Now;
+}
+
+void FNetworkProfiler::AddLiveBits( ELiveBandwidthCategory Category, const FLiveBandwidthKey& Key, uint32 NumBits )
+{
+	if ( LiveBuckets.Num() == 0 )
+	{
+		UpdateLiveBuckets();
+	}
+
+	LiveBuckets.Last().Bits[Category].FindOrAdd( Key ) += NumBits;
+}
+
+void FNetworkProfiler::AddLiveBunchBits( UNetConnection* Connection, const FSendBunchInfo& BunchInfo )
+{
+	const uint32 NumBits = BunchInfo.NumHeaderBits + BunchInfo.NumPayloadBits;
+
+	// Bunches of other channels are only tracked per connection
+	if ( BunchInfo.ActorName != NAME_None )
+	{
+		AddLiveBits( LBC_Actor, FLiveBandwidthKey( BunchInfo.ActorClassName, BunchInfo.ActorName ), NumBits );
+		AddLiveBits( LBC_Class, FLiveBandwidthKey( NAME_None, BunchInfo.ActorClassName ), NumBits );
+	}
+	else if ( LiveBuckets.Num() == 0 )
+	{
+		UpdateLiveBuckets();
+	}
+
+	FLiveConnectionBits& ConnectionBits = LiveBuckets.Last().ConnectionBits.FindOrAdd( Connection );
+	if ( ConnectionBits.Description.IsEmpty() )
+	{
+		ConnectionBits.Description = Connection->LowLevelGetRemoteAddress( true );
+	}
+	ConnectionBits.NumBits += NumBits;
+}
+
+/**
+ * Logs the actors, classes, properties and RPCs that sent the most bits per second and connection
+ * over the live bandwidth window.
+ *
+ * @param	NumTop	Number of entries to log for each category
+ * @param	Ar		The output device to write the summary to
+ */
+void FNetworkProfiler::ReportLiveBandwidth( int32 NumTop, FOutputDevice& Ar )
+{
+	SCOPE_LOCK_REF(CriticalSection);
+
+	if ( !bIsLiveTrackingEnabled || LiveBuckets.Num() == 0 )
+	{
+		Ar.Logf( TEXT( "No live bandwidth data gathered yet." ) );
+		return;
+	}
+
+	const double WindowSeconds = FMath::Max( FPlatformTime::Seconds() - LiveBuckets[0].StartTime, LiveBucketSeconds );
+
+	TMap<const UNetConnection*, FLiveConnectionBits> ConnectionBits;
+	TMap<FLiveBandwidthKey, uint64> Bits[LBC_Max];
+	for ( const FLiveBandwidthBucket& Bucket : LiveBuckets )
+	{
+		for ( const auto& Pair : Bucket.ConnectionBits )
+		{
+			FLiveConnectionBits& Total = ConnectionBits.FindOrAdd( Pair.Key );
+			Total.Description = Pair.Value.Description;
+			Total.NumBits += Pair.Value.NumBits;
+		}
+		for ( int32 Category = 0; Category < LBC_Max; Category++ )
+		{
+			for ( const auto& Pair : Bucket.Bits[Category] )
+			{
+				Bits[Category].FindOrAdd( Pair.Key ) += Pair.Value;
+			}
+		}
+	}
+
+	const int32 NumConnections = FMath::Max( ConnectionBits.Num(), 1 );
+
+	Ar.Logf( TEXT( "Top bandwidth over the last %.1f seconds, %i connections, in bits/s per connection:" ), WindowSeconds, ConnectionBits.Num() );
+
+	ConnectionBits.ValueSort( []( const FLiveConnectionBits& A, const FLiveConnectionBits& B ) { return A.NumBits > B.NumBits; } );
+	Ar.Logf( TEXT( " Connections (bits/s):" ) );
+	int32 NumLogged = 0;
+	for ( const auto& Pair : ConnectionBits )
+	{
+		if ( NumLogged++ >= NumTop )
+		{
+			break;
+		}
+		Ar.Logf( TEXT( "  %10.1f  %s" ), Pair.Value.NumBits / WindowSeconds, *Pair.Value.Description );
+	}
+
+	static const TCHAR* CategoryNames[LBC_Max] = { TEXT( "Actors" ), TEXT( "Classes" ), TEXT( "Properties" ), TEXT( "RPCs" ) };
+
+	for ( int32 Category = 0; Category < LBC_Max; Category++ )
+	{
+		Bits[Category].ValueSort( []( uint64 A, uint64 B ) { return A > B; } );
+		Ar.Logf( TEXT( " %s:" ), CategoryNames[Category] );
+		NumLogged = 0;
+		for ( const auto& Pair : Bits[Category] )
+		{
+			if ( NumLogged++ >= NumTop )
+			{
+				break;
+			}
+			const double BitsPerSecond = Pair.Value / ( WindowSeconds * NumConnections );
+			if ( Pair.Key.OuterName == NAME_None )
+			{
+				Ar.Logf( TEXT( "  %10.1f  %s" ), BitsPerSecond, *Pair.Key.Name.ToString() );
+			}
+			else if ( Category == LBC_Actor )
+			{
+				Ar.Logf( TEXT( "  %10.1f  %s (%s)" ), BitsPerSecond, *Pair.Key.Name.ToString(), *Pair.Key.OuterName.ToString() );
+			}
+			else
+			{
+				Ar.Logf( TEXT( "  %10.1f  %s::%s" ), BitsPerSecond, *Pair.Key.OuterName.ToString(), *Pair.Key.Name.ToString() );
+			}
+		}
+	}
+}
+
+/** Console command reporting the live bandwidth summary. */
+static void TopBandwidthCommand( const TArray<FString>& Args )
+{
+	if ( Args.Num() > 0 && Args[0] == TEXT( "Disable" ) )
+	{
+		GNetworkProfiler.EnableLiveTracking( false );
+		return;
+	}
+
+	if ( !GNetworkProfiler.IsLiveTrackingEnabled() )
+	{
+		GNetworkProfiler.EnableLiveTracking( true );
+		UE_LOG( LogNet, Display, TEXT( "net.TopBandwidth: gathering data, run the command again to see the summary." ) );
+		return;
+	}
+
+	const int32 NumTop = Args.Num() > 0 && Args[0].IsNumeric() ? FMath::Max( FCString::Atoi( *Args[0] ), 1 ) : 10;
+	GNetworkProfiler.ReportLiveBandwidth( NumTop, *GLog );
+}
+
+static FAutoConsoleCommand TopBandwidthCmd(
+	TEXT( "net.TopBandwidth" ),
+	TEXT( "Reports the actors, classes, properties and RPCs that sent the most bits per second and connection over the last net.TopBandwidthWindow seconds.\n" )
+	TEXT( "The first use starts gathering the data. Optional parameter is the number of entries per category (default: 10), or Disable to stop gathering." ),
+	FConsoleCommandWithArgsDelegate::CreateStatic( &TopBandwidthCommand )
+	);
+
 /**
  * Marks the beginning of a frame.
  */
@@ -206,6 +432,12 @@ void FNetworkProfiler::TrackFrameBegin()
 		(*FileWriter) << RelativeTime;
 		LastAddress = 0xFFFFFFFFFFFFFFFF;
 	}
+
+	if ( bIsLiveTrackingEnabled )
+	{
+		SCOPE_LOCK_REF(CriticalSection);
+		UpdateLiveBuckets();
+	}
 }
 
 /**
@@ -261,19 +493,31 @@ void FNetworkProfiler::TrackSendRPC( const AActor* Actor, const UFunction* Funct
 		(*FileWriter) << NumParameterBits;
 		(*FileWriter) << NumFooterBits;
 	}
+
+	if ( bIsLiveTrackingEnabled )
+	{
+		SCOPE_LOCK_REF( CriticalSection );
+		AddLiveBits( LBC_RPC, FLiveBandwidthKey( Function->GetOuter()->GetFName(), Function->GetFName() ), NumHeaderBits + NumParameterBits + NumFooterBits );
+	}
 }
 
 void FNetworkProfiler::TrackQueuedRPC( UNetConnection* Connection, UObject* TargetObject, const AActor* Actor, const UFunction* Function, uint16 NumHeaderBits, uint16 NumParameterBits, uint16 NumFooterBits  )
 {
-	if( bIsTrackingEnabled )
+	if( bIsTrackingEnabled || bIsLiveTrackingEnabled )
 	{
 		SCOPE_LOCK_REF(CriticalSection);
 		
 		FQueuedRPCInfo Info;
 
-		Info.ActorNameIndex = GetNameTableIndex( Actor->GetName() );
-		Info.FunctionNameIndex = GetNameTableIndex( Function->GetName() );
+		// The name table belongs to the file capture
+		if ( bIsTrackingEnabled )
+		{
+			Info.ActorNameIndex = GetNameTableIndex( Actor->GetName() );
+			Info.FunctionNameIndex = GetNameTableIndex( Function->GetName() );
+			Info.bHasNameIndices = true;
+		}
 
+		Info.Function = Function;
 		Info.Connection = Connection;
 		Info.TargetObject = TargetObject;
 		Info.NumHeaderBits = NumHeaderBits;
@@ -286,7 +530,7 @@ void FNetworkProfiler::TrackQueuedRPC( UNetConnection* Connection, UObject* Targ
 
 void FNetworkProfiler::FlushQueuedRPCs( UNetConnection* Connection, UObject* TargetObject )
 {
-	if( bIsTrackingEnabled )
+	if( bIsTrackingEnabled || bIsLiveTrackingEnabled )
 	{
 		SCOPE_LOCK_REF(CriticalSection);
 
@@ -296,13 +540,22 @@ void FNetworkProfiler::FlushQueuedRPCs( UNetConnection* Connection, UObject* Tar
 		{
 			if (QueuedRPCs[i].Connection == Connection && QueuedRPCs[i].TargetObject == TargetObject)
 			{
-				uint8 Type = NPTYPE_SendRPC;
-				(*FileWriter) << Type;
-				(*FileWriter).SerializeIntPacked( QueuedRPCs[i].ActorNameIndex );
-				(*FileWriter).SerializeIntPacked( QueuedRPCs[i].FunctionNameIndex );
-				(*FileWriter) << QueuedRPCs[i].NumHeaderBits;
-				(*FileWriter) << QueuedRPCs[i].NumParameterBits;
-				(*FileWriter) << QueuedRPCs[i].NumFooterBits;
+				if ( bIsTrackingEnabled && QueuedRPCs[i].bHasNameIndices )
+				{
+					uint8 Type = NPTYPE_SendRPC;
+					(*FileWriter) << Type;
+					(*FileWriter).SerializeIntPacked( QueuedRPCs[i].ActorNameIndex );
+					(*FileWriter).SerializeIntPacked( QueuedRPCs[i].FunctionNameIndex );
+					(*FileWriter) << QueuedRPCs[i].NumHeaderBits;
+					(*FileWriter) << QueuedRPCs[i].NumParameterBits;
+					(*FileWriter) << QueuedRPCs[i].NumFooterBits;
+				}
+
+				if ( bIsLiveTrackingEnabled )
+				{
+					const UFunction* Function = QueuedRPCs[i].Function;
+					AddLiveBits( LBC_RPC, FLiveBandwidthKey( Function->GetOuter()->GetFName(), Function->GetFName() ), QueuedRPCs[i].NumHeaderBits + QueuedRPCs[i].NumParameterBits + QueuedRPCs[i].NumFooterBits );
+				}
 
 				QueuedRPCs.RemoveAtSwap(i);
 			}
@@ -424,16 +677,25 @@ void FNetworkProfiler::TrackSendBunch( FOutBunch* OutBunch, uint16 NumBits, UNet
 
 void FNetworkProfiler::PushSendBunch( UNetConnection* Connection, FOutBunch* OutBunch, uint16 NumHeaderBits, uint16 NumPayloadBits )
 {
-	if ( bIsTrackingEnabled )
+	if ( bIsTrackingEnabled || bIsLiveTrackingEnabled )
 	{
 		SCOPE_LOCK_REF(CriticalSection);
-		OutgoingBunches.FindOrAdd(Connection).Emplace(OutBunch->ChIndex, OutBunch->ChType, NumHeaderBits, NumPayloadBits);
+		TArray<FSendBunchInfo>& Bunches = OutgoingBunches.FindOrAdd(Connection);
+		FSendBunchInfo& BunchInfo = Bunches[Bunches.Emplace(OutBunch->ChIndex, OutBunch->ChType, NumHeaderBits, NumPayloadBits)];
+
+		// Resolve the actor now, the channel may be closed by the time the bunch is flushed
+		const UActorChannel* ActorChannel = bIsLiveTrackingEnabled ? Cast<UActorChannel>(OutBunch->Channel) : nullptr;
+		if ( ActorChannel && ActorChannel->Actor )
+		{
+			BunchInfo.ActorName = ActorChannel->Actor->GetFName();
+			BunchInfo.ActorClassName = ActorChannel->Actor->GetClass()->GetFName();
+		}
 	}
 }
 
 void FNetworkProfiler::PopSendBunch( UNetConnection* Connection )
 {
-	if ( bIsTrackingEnabled )
+	if ( bIsTrackingEnabled || bIsLiveTrackingEnabled )
 	{
 		SCOPE_LOCK_REF(CriticalSection);
 		if ( OutgoingBunches.Contains(Connection) && OutgoingBunches[Connection].Num() > 0 )
@@ -445,7 +707,7 @@ void FNetworkProfiler::PopSendBunch( UNetConnection* Connection )
 
 void FNetworkProfiler::FlushOutgoingBunches( UNetConnection* Connection )
 {
-	if ( bIsTrackingEnabled )
+	if ( bIsTrackingEnabled || bIsLiveTrackingEnabled )
 	{
 		SCOPE_LOCK_REF( CriticalSection );
 
@@ -456,12 +718,20 @@ void FNetworkProfiler::FlushOutgoingBunches( UNetConnection* Connection )
 			
 			for ( FSendBunchInfo& BunchInfo : OutgoingBunches[Connection] )
 			{
-				uint8 Type = NPTYPE_SendBunch;
-				(*FileWriter) << Type;
-				(*FileWriter) << BunchInfo.ChannelIndex;
-				(*FileWriter) << BunchInfo.ChannelType;
-				(*FileWriter) << BunchInfo.NumHeaderBits;
-				(*FileWriter) << BunchInfo.NumPayloadBits;
+				if ( bIsTrackingEnabled )
+				{
+					uint8 Type = NPTYPE_SendBunch;
+					(*FileWriter) << Type;
+					(*FileWriter) << BunchInfo.ChannelIndex;
+					(*FileWriter) << BunchInfo.ChannelType;
+					(*FileWriter) << BunchInfo.NumHeaderBits;
+					(*FileWriter) << BunchInfo.NumPayloadBits;
+				}
+
+				if ( bIsLiveTrackingEnabled )
+				{
+					AddLiveBunchBits( Connection, BunchInfo );
+				}
 			}
 
 			OutgoingBunches[Connection].SetNum(0);
@@ -517,6 +787,12 @@ void FNetworkProfiler::TrackReplicateProperty( const UProperty* Property, uint16
 		(*FileWriter).SerializeIntPacked( NameTableIndex );
 		(*FileWriter) << NumBits;
 	}
+
+	if ( bIsLiveTrackingEnabled )
+	{
+		SCOPE_LOCK_REF(CriticalSection);
+		AddLiveBits( LBC_Property, FLiveBandwidthKey( Property->GetOuter()->GetFName(), Property->GetFName() ), NumBits );
+	}
 }
 
 void FNetworkProfiler::TrackWritePropertyHeader( const UProperty* Property, uint16 NumBits, UNetConnection* Connection )
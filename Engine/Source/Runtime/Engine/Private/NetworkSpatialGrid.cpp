@@ -0,0 +1,145 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "Engine/NetworkSpatialGrid.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/WorldSettings.h"
+#include "Components/SceneComponent.h"
+#include "Engine/NetConnection.h"
+#include "Engine/NetworkObjectList.h"
+
+FNetworkSpatialGrid::FNetworkSpatialGrid()
+	: CellSize(10000.0f)
+	, MaxCullDistance(0.0f)
+{
+}
+
+bool FNetworkSpatialGrid::IsDistanceRelevantOnly(const AActor* Actor)
+{
+	// mirrors the checks AActor::IsNetRelevantFor makes before the distance test
+	if (Actor->bAlwaysRelevant || Actor->bOnlyRelevantToOwner || Actor->bNetUseOwnerRelevancy || Actor->GetOwner() || Actor->Instigator)
+	{
+		return false;
+	}
+	const USceneComponent* RootComponent = Actor->GetRootComponent();
+	return RootComponent && !RootComponent->GetAttachParent();
+}
+
+void FNetworkSpatialGrid::Build(const TArray<FNetworkObjectInfo*>& ConsiderList, float InCellSize)
+{
+	// keep the cells that were used last frame around so their arrays don't need to be reallocated every frame
+	for (auto It = Cells.CreateIterator(); It; ++It)
+	{
+		if (!It.Value().Actors.Num())
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+		It.Value().Actors.Reset();
+		It.Value().MaxCullDistanceSquared = 0.0f;
+	}
+	if (CellSize != InCellSize)
+	{
+		Cells.Reset();
+		CellSize = FMath::Max(InCellSize, 100.0f);
+	}
+	ActorEntries.Reset();
+	NonSpatialActors.Reset();
+
+	float MaxCullDistanceSquared = 0.0f;
+	for (FNetworkObjectInfo* ActorInfo : ConsiderList)
+	{
+		const AActor* Actor = ActorInfo->Actor;
+		if (!IsDistanceRelevantOnly(Actor))
+		{
+			NonSpatialActors.Add(ActorInfo);
+			continue;
+		}
+
+		const FVector Location = Actor->GetActorLocation();
+		const uint64 CellKey = GetCellKey(GetCellCoord(Location.X), GetCellCoord(Location.Y));
+		FCell& Cell = Cells.FindOrAdd(CellKey);
+		Cell.Actors.Add(ActorInfo);
+		Cell.MaxCullDistanceSquared = FMath::Max(Cell.MaxCullDistanceSquared, Actor->NetCullDistanceSquared);
+		MaxCullDistanceSquared = FMath::Max(MaxCullDistanceSquared, Actor->NetCullDistanceSquared);
+
+		FActorEntry& Entry = ActorEntries.Add(Actor);
+		Entry.ActorInfo = ActorInfo;
+		Entry.CellKey = CellKey;
+	}
+	MaxCullDistance = FMath::Sqrt(MaxCullDistanceSquared);
+}
+
+void FNetworkSpatialGrid::GatherConsiderList(const UNetConnection* Connection, const TArray<FNetViewer>& Viewers, TArray<FNetworkObjectInfo*>& OutConsiderList) const
+{
+	OutConsiderList.Reset();
+	OutConsiderList.Append(NonSpatialActors);
+
+	TSet<uint64, DefaultKeyFuncs<uint64>, TInlineSetAllocator<64>> IncludedCells;
+	const int32 CellRadius = FMath::CeilToInt(MaxCullDistance / CellSize);
+	const bool bVisitAllCells = FMath::Square(2 * CellRadius + 1) > Cells.Num();
+
+	for (const FNetViewer& Viewer : Viewers)
+	{
+		const int32 ViewerCellX = GetCellCoord(Viewer.ViewLocation.X);
+		const int32 ViewerCellY = GetCellCoord(Viewer.ViewLocation.Y);
+
+		auto ConsiderCell = [&](uint64 CellKey, int32 CellX, int32 CellY, const FCell& Cell)
+		{
+			if (!Cell.Actors.Num() || IncludedCells.Contains(CellKey))
+			{
+				return;
+			}
+
+			// distance in the plane to the closest point of the cell is a lower bound for the distance to any actor in it
+			const float DeltaX = FMath::Max3(CellX * CellSize - Viewer.ViewLocation.X, 0.0f, Viewer.ViewLocation.X - (CellX + 1) * CellSize);
+			const float DeltaY = FMath::Max3(CellY * CellSize - Viewer.ViewLocation.Y, 0.0f, Viewer.ViewLocation.Y - (CellY + 1) * CellSize);
+			if (DeltaX * DeltaX + DeltaY * DeltaY < Cell.MaxCullDistanceSquared)
+			{
+				IncludedCells.Add(CellKey);
+				OutConsiderList.Append(Cell.Actors);
+			}
+		};
+
+		if (bVisitAllCells)
+		{
+			for (const auto& Pair : Cells)
+			{
+				ConsiderCell(Pair.Key, int32(uint32(Pair.Key >> 32)), int32(uint32(Pair.Key)), Pair.Value);
+			}
+		}
+		else
+		{
+			for (int32 CellX = ViewerCellX - CellRadius; CellX <= ViewerCellX + CellRadius; CellX++)
+			{
+				for (int32 CellY = ViewerCellY - CellRadius; CellY <= ViewerCellY + CellRadius; CellY++)
+				{
+					const uint64 CellKey = GetCellKey(CellX, CellY);
+					if (const FCell* Cell = Cells.Find(CellKey))
+					{
+						ConsiderCell(CellKey, CellX, CellY, *Cell);
+					}
+				}
+			}
+		}
+	}
+
+	// open channels and view targets are always considered, whatever their distance
+	TSet<const AActor*> AddedActors;
+	auto ConsiderActor = [&](const AActor* Actor)
+	{
+		const FActorEntry* Entry = ActorEntries.Find(Actor);
+		if (Entry && !IncludedCells.Contains(Entry->CellKey) && !AddedActors.Contains(Actor))
+		{
+			AddedActors.Add(Actor);
+			OutConsiderList.Add(Entry->ActorInfo);
+		}
+	};
+	for (const auto& Pair : Connection->ActorChannels)
+	{
+		ConsiderActor(Pair.Key.Get());
+	}
+	for (const FNetViewer& Viewer : Viewers)
+	{
+		ConsiderActor(Viewer.ViewTarget);
+	}
+}
@@ -3169,6 +3169,8 @@ UParticleSystemComponent::UParticleSystemComponent(const FObjectInitializer& Obj
 
 	SavedAutoAttachRelativeScale3D = FVector(1.f, 1.f, 1.f);
 	TimeSinceLastTick = 0;
+	LastTickActiveParticles = 0;
+	LastTickSimulationTimeMS = 0.0f;
 
 	RequiredSignificance = EParticleSignificanceLevel::Low;
 	LastSignificantTime = 0.0f;
@@ -4675,6 +4677,7 @@ void UParticleSystemComponent::ComputeTickComponent_Concurrent()
 
 	SCOPE_CYCLE_COUNTER(STAT_ParticleComputeTickTime);
 	FScopeCycleCounterUObject AdditionalScope(AdditionalStatObject(), GET_STATID(STAT_ParticleComputeTickTime));
+	const uint32 ComputeTickStartCycles = FPlatformTime::Cycles();
 	// Tick Subemitters.
 	int32 EmitterIndex;
 	NumSignificantEmitters = 0;
@@ -4745,6 +4748,8 @@ void UParticleSystemComponent::ComputeTickComponent_Concurrent()
 #endif
 		}
 	}
+	LastTickActiveParticles = TotalActiveParticles;
+	LastTickSimulationTimeMS = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles() - ComputeTickStartCycles);
 	if (bAsyncWorkOutstanding)
 	{
 		FPlatformMisc::MemoryBarrier();
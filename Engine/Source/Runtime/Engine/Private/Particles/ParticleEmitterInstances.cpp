@@ -28,6 +28,12 @@
 #include "Particles/ParticleModuleRequired.h"
 
 #include "Components/PointLightComponent.h"
+#include "Async/ParallelFor.h"
+
+static TAutoConsoleVariable<int32> CVarParallelParticleUpdateBatchSize(
+	TEXT("FX.ParallelParticleUpdateBatchSize"),
+	1024,
+	TEXT("Number of particles per task when emitters update their particles in parallel. Emitters with fewer active particles update on one thread. 0 disables parallel particle updates."));
 
 /*-----------------------------------------------------------------------------
 FParticlesStatGroup
@@ -1124,6 +1130,34 @@ FVector FParticleEmitterInstance::GetParticleLocationWithOrbitOffset(FBasePartic
  *
  *	@param	DeltaTime		The time slice to use
  */
+int32 FParticleEmitterInstance::GetNumParticleBatches() const
+{
+	const int32 BatchSize = CVarParallelParticleUpdateBatchSize.GetValueOnAnyThread();
+	if (BatchSize <= 0 || ActiveParticles <= BatchSize)
+	{
+		return 1;
+	}
+	return FMath::DivideAndRoundUp(ActiveParticles, BatchSize);
+}
+
+void FParticleEmitterInstance::ParallelForParticles(TFunctionRef<void(int32 BatchIndex, int32 FirstIndex, int32 EndIndex)> Body) const
+{
+	const int32 NumBatches = GetNumParticleBatches();
+	if (NumBatches == 1)
+	{
+		Body(0, 0, ActiveParticles);
+		return;
+	}
+
+	const int32 NumParticles = ActiveParticles;
+	const int32 BatchSize = FMath::DivideAndRoundUp(NumParticles, NumBatches);
+	ParallelFor(NumBatches, [&Body, NumParticles, BatchSize](int32 BatchIndex)
+	{
+		const int32 FirstIndex = BatchIndex * BatchSize;
+		Body(BatchIndex, FirstIndex, FMath::Min(FirstIndex + BatchSize, NumParticles));
+	});
+}
+
 void FParticleEmitterInstance::UpdateBoundingBox(float DeltaTime)
 {
 	SCOPE_CYCLE_COUNTER(STAT_ParticleUpdateBounds);
@@ -1136,8 +1170,6 @@ void FParticleEmitterInstance::UpdateBoundingBox(float DeltaTime)
 
 		UParticleLODLevel* LODLevel = GetCurrentLODLevelChecked();
 
-		FVector	NewLocation;
-		float	NewRotation;
 		if (bUpdateBox)
 		{
 			ParticleBoundingBox.Init();
@@ -1164,92 +1196,110 @@ void FParticleEmitterInstance::UpdateBoundingBox(float DeltaTime)
 		// Store off the orbit offset, if there is one
 		int32 OrbitOffsetValue = GetOrbitPayloadOffset();
 
-		// For each particle, offset the box appropriately 
-		FVector MinVal(HALF_WORLD_MAX);
-		FVector MaxVal(-HALF_WORLD_MAX);
-		
 		const bool bUseLocalSpace = LODLevel->RequiredModule->bUseLocalSpace;
 
 		const FMatrix ComponentToWorld = bUseLocalSpace 
 			? Component->GetComponentToWorld().ToMatrixWithScale() 
 			: FMatrix::Identity;
 
-		for (int32 i=0; i<ActiveParticles; i++)
+		// For each particle, offset the box appropriately; every batch of particles grows its own box
+		TArray<FVector, TInlineAllocator<16>> BatchMinVals;
+		BatchMinVals.Init(FVector(HALF_WORLD_MAX), GetNumParticleBatches());
+		TArray<FVector, TInlineAllocator<16>> BatchMaxVals;
+		BatchMaxVals.Init(FVector(-HALF_WORLD_MAX), BatchMinVals.Num());
+
+		ParallelForParticles([&](int32 BatchIndex, int32 FirstIndex, int32 EndIndex)
 		{
-			DECLARE_PARTICLE(Particle, ParticleData + ParticleStride * ParticleIndices[i]);
-			
-			// Do linear integrator and update bounding box
-			// Do angular integrator, and wrap result to within +/- 2 PI
-			Particle.OldLocation	= Particle.Location;
-			if ((Particle.Flags & STATE_Particle_Freeze) == 0)
+			FVector	NewLocation;
+			float	NewRotation;
+			FVector& MinVal = BatchMinVals[BatchIndex];
+			FVector& MaxVal = BatchMaxVals[BatchIndex];
+
+			for (int32 i=FirstIndex; i<EndIndex; i++)
 			{
-				if ((Particle.Flags & STATE_Particle_FreezeTranslation) == 0)
+				DECLARE_PARTICLE(Particle, ParticleData + ParticleStride * ParticleIndices[i]);
+			
+				// Do linear integrator and update bounding box
+				// Do angular integrator, and wrap result to within +/- 2 PI
+				Particle.OldLocation	= Particle.Location;
+				if ((Particle.Flags & STATE_Particle_Freeze) == 0)
 				{
-					NewLocation	= Particle.Location + (DeltaTime * Particle.Velocity);
+					if ((Particle.Flags & STATE_Particle_FreezeTranslation) == 0)
+					{
+						NewLocation	= Particle.Location + (DeltaTime * Particle.Velocity);
+					}
+					else
+					{
+						NewLocation	= Particle.Location;
+					}
+					if ((Particle.Flags & STATE_Particle_FreezeRotation) == 0)
+					{
+						NewRotation = (DeltaTime * Particle.RotationRate) + Particle.Rotation;
+					}
+					else
+					{
+						NewRotation	= Particle.Rotation;
+					}
 				}
 				else
 				{
 					NewLocation	= Particle.Location;
-				}
-				if ((Particle.Flags & STATE_Particle_FreezeRotation) == 0)
-				{
-					NewRotation = (DeltaTime * Particle.RotationRate) + Particle.Rotation;
-				}
-				else
-				{
 					NewRotation	= Particle.Rotation;
 				}
-			}
-			else
-			{
-				NewLocation	= Particle.Location;
-				NewRotation	= Particle.Rotation;
-			}
 
-			float LocalMax(0.0f);
+				float LocalMax(0.0f);
 
-			if (bUpdateBox)
-			{	
-				if (OrbitOffsetValue == -1)
-				{
-					LocalMax = (Particle.Size * Scale).GetAbsMax();
-				}
-				else
-				{
-					int32 CurrentOffset = OrbitOffsetValue;
-					const uint8* ParticleBase = (const uint8*)&Particle;
-					PARTICLE_ELEMENT(FOrbitChainModuleInstancePayload, OrbitPayload);
-					LocalMax = OrbitPayload.Offset.GetAbsMax();
+				if (bUpdateBox)
+				{	
+					if (OrbitOffsetValue == -1)
+					{
+						LocalMax = (Particle.Size * Scale).GetAbsMax();
+					}
+					else
+					{
+						int32 CurrentOffset = OrbitOffsetValue;
+						const uint8* ParticleBase = (const uint8*)&Particle;
+						PARTICLE_ELEMENT(FOrbitChainModuleInstancePayload, OrbitPayload);
+						LocalMax = OrbitPayload.Offset.GetAbsMax();
+					}
+
+					LocalMax += (Particle.Size * ParticlePivotOffset).GetAbsMax();
 				}
 
-				LocalMax += (Particle.Size * ParticlePivotOffset).GetAbsMax();
-			}
+				NewLocation			+= PositionOffsetThisTick;
+				Particle.OldLocation+= PositionOffsetThisTick;
+					
+				Particle.Location	 = NewLocation;
+				Particle.Rotation	 = FMath::Fmod(NewRotation, 2.f*(float)PI);
 
-			NewLocation			+= PositionOffsetThisTick;
-			Particle.OldLocation+= PositionOffsetThisTick;
-						
-			Particle.Location	 = NewLocation;
-			Particle.Rotation	 = FMath::Fmod(NewRotation, 2.f*(float)PI);
+				if (bUpdateBox)
+				{	
+					FVector PositionForBounds = NewLocation;
 
-			if (bUpdateBox)
-			{	
-				FVector PositionForBounds = NewLocation;
+					if (bUseLocalSpace)
+					{
+						// Note: building the bounding box in world space as that gives tighter bounds than transforming a local space AABB into world space
+						PositionForBounds = ComponentToWorld.TransformPosition(NewLocation);
+					}
 
-				if (bUseLocalSpace)
-				{
-					// Note: building the bounding box in world space as that gives tighter bounds than transforming a local space AABB into world space
-					PositionForBounds = ComponentToWorld.TransformPosition(NewLocation);
+					// Treat each particle as a cube whose sides are the length of the maximum component
+					// This handles the particle's extents changing due to being camera facing
+					MinVal[0] = FMath::Min<float>(MinVal[0], PositionForBounds.X - LocalMax);
+					MaxVal[0] = FMath::Max<float>(MaxVal[0], PositionForBounds.X + LocalMax);
+					MinVal[1] = FMath::Min<float>(MinVal[1], PositionForBounds.Y - LocalMax);
+					MaxVal[1] = FMath::Max<float>(MaxVal[1], PositionForBounds.Y + LocalMax);
+					MinVal[2] = FMath::Min<float>(MinVal[2], PositionForBounds.Z - LocalMax);
+					MaxVal[2] = FMath::Max<float>(MaxVal[2], PositionForBounds.Z + LocalMax);
 				}
-
-				// Treat each particle as a cube whose sides are the length of the maximum component
-				// This handles the particle's extents changing due to being camera facing
-				MinVal[0] = FMath::Min<float>(MinVal[0], PositionForBounds.X - LocalMax);
-				MaxVal[0] = FMath::Max<float>(MaxVal[0], PositionForBounds.X + LocalMax);
-				MinVal[1] = FMath::Min<float>(MinVal[1], PositionForBounds.Y - LocalMax);
-				MaxVal[1] = FMath::Max<float>(MaxVal[1], PositionForBounds.Y + LocalMax);
-				MinVal[2] = FMath::Min<float>(MinVal[2], PositionForBounds.Z - LocalMax);
-				MaxVal[2] = FMath::Max<float>(MaxVal[2], PositionForBounds.Z + LocalMax);
 			}
+		});
+
+		FVector MinVal(HALF_WORLD_MAX);
+		FVector MaxVal(-HALF_WORLD_MAX);
+		for (int32 BatchIndex = 0; BatchIndex < BatchMinVals.Num(); ++BatchIndex)
+		{
+			MinVal = MinVal.ComponentMin(BatchMinVals[BatchIndex]);
+			MaxVal = MaxVal.ComponentMax(BatchMaxVals[BatchIndex]);
 		}
 
 		if (bUpdateBox)
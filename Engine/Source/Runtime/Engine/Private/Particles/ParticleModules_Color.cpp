@@ -391,15 +391,18 @@ void UParticleModuleColorOverLife::Update(FParticleEmitterInstance* Owner, int32
 	FPlatformMisc::Prefetch(Owner->ParticleData, (Owner->ParticleIndices[0] * Owner->ParticleStride) + PLATFORM_CACHE_LINE_SIZE);
 	if( FastColorOverLife && FastAlphaOverLife )
 	{
-		// fast path
-		BEGIN_UPDATE_LOOP;
+		// fast path, the raw distributions are only read so ranges of particles can be updated in parallel
+		Owner->ParallelForParticles([&](int32 BatchIndex, int32 FirstIndex, int32 EndIndex)
 		{
-			FPlatformMisc::Prefetch(ParticleData, (ParticleIndices[i+1] * ParticleStride));
-			FPlatformMisc::Prefetch(ParticleData, (ParticleIndices[i+1] * ParticleStride) + PLATFORM_CACHE_LINE_SIZE);
-			FastColorOverLife->GetValue3None(Particle.RelativeTime, &Particle.Color.R);
-			FastAlphaOverLife->GetValue1None(Particle.RelativeTime, &Particle.Color.A);
-		}
-		END_UPDATE_LOOP;
+			BEGIN_UPDATE_LOOP_RANGE(FirstIndex, EndIndex);
+			{
+				FPlatformMisc::Prefetch(ParticleData, (ParticleIndices[i+1] * ParticleStride));
+				FPlatformMisc::Prefetch(ParticleData, (ParticleIndices[i+1] * ParticleStride) + PLATFORM_CACHE_LINE_SIZE);
+				FastColorOverLife->GetValue3None(Particle.RelativeTime, &Particle.Color.R);
+				FastAlphaOverLife->GetValue1None(Particle.RelativeTime, &Particle.Color.A);
+			}
+			END_UPDATE_LOOP;
+		});
 	}
 	else
 	{
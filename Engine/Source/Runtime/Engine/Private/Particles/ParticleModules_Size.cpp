@@ -235,16 +235,19 @@ void UParticleModuleSizeMultiplyLife::Update(FParticleEmitterInstance* Owner, in
 	{
 		if (FastDistribution)
 		{
-			FVector SizeScale;
-			// fast path
-			BEGIN_UPDATE_LOOP;
-				FastDistribution->GetValue3None(Particle.RelativeTime, &SizeScale.X);
-				FPlatformMisc::Prefetch(ParticleData, (ParticleIndices[i+1] * ParticleStride));
-				FPlatformMisc::Prefetch(ParticleData, (ParticleIndices[i+1] * ParticleStride) + PLATFORM_CACHE_LINE_SIZE);
-				Particle.Size.X *= SizeScale.X;
-				Particle.Size.Y *= SizeScale.Y;
-				Particle.Size.Z *= SizeScale.Z;
-			END_UPDATE_LOOP;
+			// fast path, the raw distribution is only read so ranges of particles can be updated in parallel
+			Owner->ParallelForParticles([&](int32 BatchIndex, int32 FirstIndex, int32 EndIndex)
+			{
+				FVector SizeScale;
+				BEGIN_UPDATE_LOOP_RANGE(FirstIndex, EndIndex);
+					FastDistribution->GetValue3None(Particle.RelativeTime, &SizeScale.X);
+					FPlatformMisc::Prefetch(ParticleData, (ParticleIndices[i+1] * ParticleStride));
+					FPlatformMisc::Prefetch(ParticleData, (ParticleIndices[i+1] * ParticleStride) + PLATFORM_CACHE_LINE_SIZE);
+					Particle.Size.X *= SizeScale.X;
+					Particle.Size.Y *= SizeScale.Y;
+					Particle.Size.Z *= SizeScale.Z;
+				END_UPDATE_LOOP;
+			});
 		}
 		else
 		{
@@ -0,0 +1,306 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "PerformanceBenchmark.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/Paths.h"
+#include "Misc/FileHelper.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "Containers/Ticker.h"
+#include "ProfilingDebugging/PerformanceBaseline.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Camera/CameraActor.h"
+#include "GameFramework/PlayerController.h"
+#include "Kismet/GameplayStatics.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogPerformanceBenchmark, Log, All);
+
+static const TCHAR* const MetricNames[] =
+{
+	TEXT("FrameTime"),
+	TEXT("GameThreadTime"),
+	TEXT("RenderThreadTime"),
+	TEXT("GPUTime"),
+	TEXT("UsedPhysicalMB"),
+};
+
+static void BenchmarkRun(const TArray<FString>& Args)
+{
+	if (Args.Num() != 1)
+	{
+		UE_LOG(LogPerformanceBenchmark, Display, TEXT("Usage: Benchmark.Run <Scenario>"));
+		return;
+	}
+	FPerformanceBenchmark::Run(FName(*Args[0]));
+}
+
+static FAutoConsoleCommand BenchmarkRunCommand(
+	TEXT("Benchmark.Run"),
+	TEXT("Runs a performance benchmark scenario of the project settings and compares it against its baseline. Usage: Benchmark.Run <Scenario>"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkRun));
+
+static FAutoConsoleCommand BenchmarkCancelCommand(
+	TEXT("Benchmark.Cancel"),
+	TEXT("Stops the running performance benchmark without reporting any results."),
+	FConsoleCommandDelegate::CreateStatic(&FPerformanceBenchmark::Cancel));
+
+UPerformanceBenchmarkSettings::UPerformanceBenchmarkSettings(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+}
+
+const FPerformanceBenchmarkScenario* UPerformanceBenchmarkSettings::FindScenario(FName ScenarioName) const
+{
+	return Scenarios.FindByPredicate([ScenarioName](const FPerformanceBenchmarkScenario& Scenario) { return Scenario.Name == ScenarioName; });
+}
+
+TSharedPtr<FPerformanceBenchmark> FPerformanceBenchmark::Running;
+
+bool FPerformanceBenchmark::Run(FName ScenarioName)
+{
+	check(IsInGameThread());
+
+	if (Running.IsValid())
+	{
+		UE_LOG(LogPerformanceBenchmark, Warning, TEXT("Can't run benchmark %s while %s is running"), *ScenarioName.ToString(), *Running->Scenario.Name.ToString());
+		return false;
+	}
+
+	const FPerformanceBenchmarkScenario* Scenario = GetDefault<UPerformanceBenchmarkSettings>()->FindScenario(ScenarioName);
+	if (Scenario == nullptr)
+	{
+		UE_LOG(LogPerformanceBenchmark, Error, TEXT("There is no benchmark scenario named %s"), *ScenarioName.ToString());
+		return false;
+	}
+
+	UE_LOG(LogPerformanceBenchmark, Display, TEXT("Running benchmark %s"), *ScenarioName.ToString());
+
+	Running = MakeShareable(new FPerformanceBenchmark(*Scenario));
+	Running->TickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(Running.ToSharedRef(), &FPerformanceBenchmark::Tick));
+	return true;
+}
+
+void FPerformanceBenchmark::Cancel()
+{
+	if (Running.IsValid())
+	{
+		UE_LOG(LogPerformanceBenchmark, Display, TEXT("Cancelled benchmark %s"), *Running->Scenario.Name.ToString());
+		Running->Stop();
+		Running.Reset();
+	}
+}
+
+FPerformanceBenchmark::FPerformanceBenchmark(const FPerformanceBenchmarkScenario& InScenario)
+	: Scenario(InScenario)
+	, State(EState::LoadingMap)
+	, StateTime(0.f)
+	, bOpenedMap(false)
+	, bMeasuring(false)
+{
+}
+
+FPerformanceBenchmark::~FPerformanceBenchmark()
+{
+	FTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+}
+
+void FPerformanceBenchmark::StartCharting()
+{
+}
+
+void FPerformanceBenchmark::ProcessFrame(const FFrameData& FrameData)
+{
+	const FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
+
+	Samples[Metric_FrameTime].Add(FrameData.TrueDeltaSeconds * 1000.0);
+	Samples[Metric_GameThreadTime].Add(FrameData.GameThreadTimeSeconds * 1000.0);
+	Samples[Metric_RenderThreadTime].Add(FrameData.RenderThreadTimeSeconds * 1000.0);
+	Samples[Metric_GPUTime].Add(FrameData.GPUTimeSeconds * 1000.0);
+	Samples[Metric_UsedPhysicalMB].Add(MemoryStats.UsedPhysical / (1024.0 * 1024.0));
+}
+
+void FPerformanceBenchmark::StopCharting()
+{
+}
+
+UWorld* FPerformanceBenchmark::GetScenarioWorld() const
+{
+	const FString MapName = Scenario.Map.GetLongPackageName();
+	for (const FWorldContext& Context : GEngine->GetWorldContexts())
+	{
+		UWorld* World = Context.World();
+		if (World && World->IsGameWorld() && World->HasBegunPlay()
+			&& (MapName.IsEmpty() || UWorld::RemovePIEPrefix(World->GetOutermost()->GetName()) == MapName))
+		{
+			return World;
+		}
+	}
+	return nullptr;
+}
+
+bool FPerformanceBenchmark::Tick(float DeltaTime)
+{
+	StateTime += DeltaTime;
+
+	switch (State)
+	{
+	case EState::LoadingMap:
+		if (UWorld* World = GetScenarioWorld())
+		{
+			APlayerController* PlayerController = World->GetFirstPlayerController();
+			if (PlayerController && Scenario.CameraPath.Num() > 0)
+			{
+				FActorSpawnParameters SpawnParams;
+				SpawnParams.ObjectFlags |= RF_Transient;
+				Camera = World->SpawnActor<ACameraActor>(Scenario.CameraPath[0].GetLocation(), Scenario.CameraPath[0].Rotator(), SpawnParams);
+				PlayerController->SetViewTarget(Camera.Get());
+			}
+
+			State = EState::WarmingUp;
+			StateTime = 0.f;
+		}
+		else if (!bOpenedMap && !Scenario.Map.IsNull())
+		{
+			for (const FWorldContext& Context : GEngine->GetWorldContexts())
+			{
+				UWorld* World = Context.World();
+				if (World && World->IsGameWorld())
+				{
+					UE_LOG(LogPerformanceBenchmark, Display, TEXT("Opening %s for benchmark %s"), *Scenario.Map.GetLongPackageName(), *Scenario.Name.ToString());
+					UGameplayStatics::OpenLevel(World, FName(*Scenario.Map.GetLongPackageName()));
+					bOpenedMap = true;
+					break;
+				}
+			}
+		}
+		break;
+
+	case EState::WarmingUp:
+		UpdateCamera(0.f);
+		if (StateTime >= Scenario.WarmupSeconds)
+		{
+			GEngine->AddPerformanceDataConsumer(AsShared());
+			bMeasuring = true;
+			State = EState::Measuring;
+			StateTime = 0.f;
+		}
+		break;
+
+	case EState::Measuring:
+		if (GetScenarioWorld() == nullptr || (Scenario.CameraPath.Num() > 0 && !Camera.IsValid()))
+		{
+			UE_LOG(LogPerformanceBenchmark, Error, TEXT("Benchmark %s was interrupted, the map was left while measuring"), *Scenario.Name.ToString());
+			Cancel();
+			return false;
+		}
+
+		UpdateCamera(StateTime / FMath::Max(Scenario.Duration, 1.f));
+		if (StateTime >= Scenario.Duration)
+		{
+			Finish();
+			return false;
+		}
+		break;
+	}
+
+	return true;
+}
+
+void FPerformanceBenchmark::UpdateCamera(float Alpha)
+{
+	ACameraActor* CameraActor = Camera.Get();
+	const int32 NumPoints = Scenario.CameraPath.Num();
+	if (CameraActor == nullptr || NumPoints == 0)
+	{
+		return;
+	}
+
+	FTransform Transform = Scenario.CameraPath[0];
+	if (NumPoints > 1)
+	{
+		// Points are reached at even intervals, move at constant speed in between
+		const float PathPosition = FMath::Clamp(Alpha, 0.f, 1.f) * (NumPoints - 1);
+		const int32 Index = FMath::Min(FMath::FloorToInt(PathPosition), NumPoints - 2);
+		Transform.Blend(Scenario.CameraPath[Index], Scenario.CameraPath[Index + 1], PathPosition - Index);
+	}
+
+	CameraActor->SetActorLocationAndRotation(Transform.GetLocation(), Transform.GetRotation());
+}
+
+void FPerformanceBenchmark::Stop()
+{
+	if (bMeasuring)
+	{
+		GEngine->RemovePerformanceDataConsumer(AsShared());
+		bMeasuring = false;
+	}
+
+	if (ACameraActor* CameraActor = Camera.Get())
+	{
+		if (APlayerController* PlayerController = CameraActor->GetWorld()->GetFirstPlayerController())
+		{
+			PlayerController->SetViewTarget(PlayerController->GetPawn() ? (AActor*)PlayerController->GetPawn() : (AActor*)PlayerController);
+		}
+		CameraActor->Destroy();
+	}
+	Camera.Reset();
+}
+
+void FPerformanceBenchmark::Finish()
+{
+	Stop();
+
+	const FString ScenarioName = Scenario.Name.ToString();
+	FPerformanceBaseline Baseline(FString::Printf(TEXT("Benchmark_%s"), *ScenarioName));
+	const bool bUpdateBaseline = FPerformanceBaseline::ShouldUpdateBaselines();
+	int32 NumRegressions = 0;
+
+	FString Report = TEXT("Metric,Mean,Median,StdDev,Max,Samples,BaselineMean,Result") LINE_TERMINATOR;
+	for (int32 MetricIndex = 0; MetricIndex < Metric_Num; ++MetricIndex)
+	{
+		const FString Metric = MetricNames[MetricIndex];
+		const FPerformanceMetricStats Stats = FPerformanceMetricStats::FromSamples(Samples[MetricIndex]);
+		const FPerformanceMetricStats* BaselineStats = Baseline.FindMetric(Metric);
+		const EPerformanceComparison Comparison = Baseline.Compare(Metric, Stats);
+
+		Report += FString::Printf(TEXT("%s,%f,%f,%f,%f,%d,%f,%s") LINE_TERMINATOR, *Metric, Stats.Mean, Stats.Median, Stats.StdDev, Stats.Max, Stats.NumSamples,
+			BaselineStats ? BaselineStats->Mean : 0.0, LexToString(Comparison));
+
+		if (Comparison == EPerformanceComparison::Regressed && !bUpdateBaseline)
+		{
+			UE_LOG(LogPerformanceBenchmark, Error, TEXT("Benchmark %s: %s regressed from %.2f to %.2f"), *ScenarioName, *Metric, BaselineStats->Mean, Stats.Mean);
+			++NumRegressions;
+		}
+		else
+		{
+			UE_LOG(LogPerformanceBenchmark, Display, TEXT("Benchmark %s: %s %.2f (median %.2f, std dev %.2f, max %.2f), %s"),
+				*ScenarioName, *Metric, Stats.Mean, Stats.Median, Stats.StdDev, Stats.Max, LexToString(Comparison));
+		}
+
+		if (bUpdateBaseline)
+		{
+			Baseline.SetMetric(Metric, Stats);
+		}
+	}
+
+	const FString ReportFilename = FPaths::ProfilingDir() / TEXT("Benchmarks") / FString::Printf(TEXT("%s-%s.csv"), *ScenarioName, *FDateTime::Now().ToString());
+	if (FFileHelper::SaveStringToFile(Report, *ReportFilename))
+	{
+		UE_LOG(LogPerformanceBenchmark, Display, TEXT("Benchmark %s finished with %d regressions, wrote %s"), *ScenarioName, NumRegressions, *ReportFilename);
+	}
+
+	if (bUpdateBaseline)
+	{
+		Baseline.Save();
+	}
+
+	// The ticker delegate keeps us alive until Tick returns
+	Running.Reset();
+
+	if (FParse::Param(FCommandLine::Get(), TEXT("ExitAfterBenchmark")))
+	{
+		FPlatformMisc::RequestExit(false);
+	}
+}
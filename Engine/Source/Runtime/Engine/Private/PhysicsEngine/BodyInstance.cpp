@@ -1752,7 +1752,7 @@ struct FInitBodiesHelper
 					}
 				}
 			}
-			else if(PhysScene)
+			else if(PhysScene && !PhysScene->IsBatchingDeferredActors())
 			{
 				//For now we do not actually defer over multiple frames. To support this we need better automatic flushing when read locks are obtained
 				PhysScene->FlushDeferredActors(PST_Sync);
@@ -20,6 +20,7 @@
 #include "DerivedDataCacheInterface.h"
 #include "UObject/UObjectIterator.h"
 #include "UObject/PropertyPortFlags.h"
+#include "UObject/WeakObjectPtr.h"
 
 #if WITH_PHYSX
 	#include "PhysXPublic.h"
@@ -65,6 +66,13 @@ static TAutoConsoleVariable<float> CVarMaxContactOffset(
 	TEXT("Max value of contact offset, which controls how close objects get before generating contacts. < 0 implies use project settings. Default: 1.0"),
 	ECVF_Default);
 
+static TAutoConsoleVariable<int32> CVarMappableServerCollisionData(
+	TEXT("p.MappableServerCollisionData"),
+	1,
+	TEXT("When cooking for dedicated servers, store cooked collision data in the separate bulk data file instead of inline.\n")
+	TEXT("The server then memory maps it while creating physics meshes, so server processes on one machine share the file pages instead of each loading a copy (see s.MemoryMapBulkData)."),
+	ECVF_Default);
+
 
 SIZE_T FBodySetupUVInfo::GetResourceSize() const
 {
@@ -256,6 +264,71 @@ void UBodySetup::CreatePhysicsMeshes()
 #endif
 }
 
+TFuture<bool> UBodySetup::CreatePhysicsMeshesAsync()
+{
+	check(IsInGameThread());
+
+	TSharedRef<TPromise<bool>, ESPMode::ThreadSafe> Promise = MakeShareable(new TPromise<bool>());
+	TFuture<bool> Future = Promise->GetFuture();
+
+#if WITH_PHYSX && (WITH_RUNTIME_PHYSICS_COOKING || WITH_EDITOR)
+	static FName PhysicsFormatName(FPlatformProperties::GetPhysicsFormat());
+
+	// Same container and cook flags GetCookedData uses for the non runtime optimized version
+	FFormatContainer* UseCookedData = CookedFormatDataOverride ? CookedFormatDataOverride : &CookedFormatData;
+#if WITH_EDITOR
+	const EPhysXMeshCookFlags CookingFlags = EPhysXMeshCookFlags::Default;
+#else
+	const EPhysXMeshCookFlags CookingFlags = CookedFormatDataOverride == nullptr ? GetRuntimeOnlyCookOptimizationFlags() : EPhysXMeshCookFlags::Default;
+#endif
+
+	IInterface_CollisionDataProvider* CDP = Cast<IInterface_CollisionDataProvider>(GetOuter());
+	const bool bHasGeometryToCook = AggGeom.ConvexElems.Num() > 0 || (CDP && CDP->ContainsPhysicsTriMeshData(bMeshCollideAll));
+	if (!bCreatedPhysicsMeshes && !bNeverNeedsCookedCollisionData && !IsTemplate() && bHasCookedCollisionData && bHasGeometryToCook && !UseCookedData->Contains(PhysicsFormatName))
+	{
+		TSharedRef<FDerivedDataPhysXCooker, ESPMode::ThreadSafe> Cooker = MakeShareable(new FDerivedDataPhysXCooker(PhysicsFormatName, CookingFlags, this));
+		if (Cooker->CanBuild())
+		{
+			Cooker->GatherGeometry();
+
+			TWeakObjectPtr<UBodySetup> WeakBodySetup(this);
+			const FGuid CookedGuid = BodySetupGuid;
+			FPhysXAsyncCooker::Cook(Cooker, [WeakBodySetup, CookedGuid, Promise](const TArray<uint8>& CookedData)
+			{
+				UBodySetup* BodySetup = WeakBodySetup.Get();
+				if (BodySetup == nullptr)
+				{
+					Promise->SetValue(false);
+					return;
+				}
+
+				// Ignore the result if the physics data was invalidated while cooking, CreatePhysicsMeshes cooks the new geometry then
+				FFormatContainer* CookedDataContainer = BodySetup->CookedFormatDataOverride ? BodySetup->CookedFormatDataOverride : &BodySetup->CookedFormatData;
+				if (!BodySetup->bCreatedPhysicsMeshes && BodySetup->BodySetupGuid == CookedGuid && !CookedDataContainer->Contains(PhysicsFormatName))
+				{
+					FByteBulkData& Result = CookedDataContainer->GetFormat(PhysicsFormatName);
+					if (CookedData.Num())
+					{
+						Result.Lock(LOCK_READ_WRITE);
+						FMemory::Memcpy(Result.Realloc(CookedData.Num()), CookedData.GetData(), CookedData.Num());
+						Result.Unlock();
+					}
+				}
+
+				BodySetup->CreatePhysicsMeshes();
+				Promise->SetValue(BodySetup->bCreatedPhysicsMeshes);
+			});
+
+			return Future;
+		}
+	}
+#endif
+
+	// Nothing to cook, or no way to cook it asynchronously
+	CreatePhysicsMeshes();
+	Promise->SetValue(bCreatedPhysicsMeshes);
+	return Future;
+}
 
 void UBodySetup::ClearPhysicsMeshes()
 {
@@ -856,8 +929,11 @@ void UBodySetup::Serialize(FArchive& Ar)
 
 			Ar << bHasCookedCollisionData;
 
+			// Servers don't stream, so they can afford reading collision data from the bulk data file when it is needed
+			const bool bForceInline = !Ar.CookingTarget()->IsServerOnly() || CVarMappableServerCollisionData.GetValueOnAnyThread() == 0;
+
 			FFormatContainer* UseCookedFormatData = bUseRuntimeOnlyCookedData ? &CookedFormatDataRuntimeOnlyOptimization : &CookedFormatData;
-			UseCookedFormatData->Serialize(Ar, this, &ActualFormatsToSave, !bSharedCookedData);
+			UseCookedFormatData->Serialize(Ar, this, &ActualFormatsToSave, !bSharedCookedData, DEFAULT_ALIGNMENT, bForceInline);
 		}
 		else
 #endif
@@ -452,7 +452,26 @@ void USkeletalMeshComponent::CompleteParallelBlendPhysics()
 	ParallelBlendPhysicsCompletionTask.SafeRelease();
 }
 
-void USkeletalMeshComponent::UpdateKinematicBonesToAnim(const TArray<FTransform>& InSpaceBases, ETeleportType Teleport, bool bNeedsSkinning, EAllowKinematicDeferral DeferralAllowed)
+void USkeletalMeshComponent::ComputeKinematicBodyTargets(const TArray<FTransform>& InComponentSpaceTransforms, TArray<FTransform>& OutBodyTargets) const
+{
+	const FTransform& CurrentLocalToWorld = ComponentToWorld;
+
+	OutBodyTargets.Reset(Bodies.Num());
+	for (const FBodyInstance* BodyInst : Bodies)
+	{
+		const int32 BoneIndex = BodyInst ? BodyInst->InstanceBoneIndex : INDEX_NONE;
+		if (InComponentSpaceTransforms.IsValidIndex(BoneIndex))
+		{
+			OutBodyTargets.Add(InComponentSpaceTransforms[BoneIndex] * CurrentLocalToWorld);
+		}
+		else
+		{
+			OutBodyTargets.Add(FTransform::Identity);
+		}
+	}
+}
+
+void USkeletalMeshComponent::UpdateKinematicBonesToAnim(const TArray<FTransform>& InSpaceBases, ETeleportType Teleport, bool bNeedsSkinning, EAllowKinematicDeferral DeferralAllowed, const TArray<FTransform>* InBodyTargets)
 {
 	SCOPE_CYCLE_COUNTER(STAT_UpdateRBBones);
 
@@ -554,6 +573,12 @@ void USkeletalMeshComponent::UpdateKinematicBonesToAnim(const TArray<FTransform>
 			SCOPED_SCENE_WRITE_LOCK(PhysScene->GetPhysXScene(SceneType));
 #endif
 
+			// Transforms computed ahead of time only match if the bodies haven't changed since
+			if (InBodyTargets && InBodyTargets->Num() != Bodies.Num())
+			{
+				InBodyTargets = nullptr;
+			}
+
 			// Iterate over each body
 			for (int32 i = 0; i < Bodies.Num(); i++)
 			{
@@ -575,7 +600,7 @@ void USkeletalMeshComponent::UpdateKinematicBonesToAnim(const TArray<FTransform>
 					{
 #if WITH_PHYSX
 						// update bone transform to world
-						const FTransform BoneTransform = InSpaceBases[BoneIndex] * CurrentLocalToWorld;
+						const FTransform BoneTransform = InBodyTargets ? (*InBodyTargets)[i] : InSpaceBases[BoneIndex] * CurrentLocalToWorld;
 						if(!BoneTransform.IsValid())
 						{
 							const FName BodyName = PhysicsAsset->SkeletalBodySetups[i]->BoneName;
@@ -8,6 +8,10 @@
 #include "PhysicsEngine/PhysicsSettings.h"
 #include "PhysicsEngine/BodySetup.h"
 #include "Interfaces/ITargetPlatformManagerModule.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Async/Async.h"
 
 #if WITH_PHYSX && (WITH_RUNTIME_PHYSICS_COOKING || WITH_EDITOR)
 
@@ -19,6 +23,11 @@ FDerivedDataPhysXCooker::FDerivedDataPhysXCooker(FName InFormat, EPhysXMeshCookF
 	, Format( InFormat )
 	, RuntimeCookFlags(InRuntimeCookFlags)
 	, Cooker( NULL )
+	, bCookConvexMeshes( false )
+	, bDeformableConvexMeshes( false )
+	, bCookTriMesh( false )
+	, bHasTriMeshData( false )
+	, bGeometryGathered( false )
 {
 	check( BodySetup != NULL );
 	CollisionDataProvider = BodySetup->GetOuter();
@@ -51,6 +60,108 @@ void FDerivedDataPhysXCooker::InitCooker()
 #endif
 }
 
+void FDerivedDataPhysXCooker::GatherGeometry()
+{
+	check(Cooker != NULL);
+
+	if (bGeometryGathered)
+	{
+		return;
+	}
+	bGeometryGathered = true;
+
+	DebugName = GetPathNameSafe(CollisionDataProvider);
+
+	// Cook convex meshes, but only if we are not forcing complex collision to be used as simple collision as well
+	bCookConvexMeshes = BodySetup->GetCollisionTraceFlag() != CTF_UseComplexAsSimple && BodySetup->AggGeom.ConvexElems.Num() > 0 && (bGenerateNormalMesh || bGenerateMirroredMesh);
+	if (bCookConvexMeshes)
+	{
+		bDeformableConvexMeshes = CollisionDataProvider->IsA(USplineMeshComponent::StaticClass());
+
+		ConvexVertices.SetNum(BodySetup->AggGeom.ConvexElems.Num());
+		for (int32 ElementIndex = 0; ElementIndex < BodySetup->AggGeom.ConvexElems.Num(); ElementIndex++)
+		{
+			const FKConvexElem& ConvexElem = BodySetup->AggGeom.ConvexElems[ElementIndex];
+
+			FTransform ConvexTransform = ConvexElem.GetTransform();
+			if (!ConvexTransform.IsValid())
+			{
+				UE_LOG(LogPhysics, Warning, TEXT("Cook Convex: [%s] ConvexElem[%d] has invalid transform"), *DebugName, ElementIndex);
+				ConvexTransform = FTransform::Identity;
+			}
+
+			// Transform verts from element to body space
+			TArray<FVector>& MeshVertices = ConvexVertices[ElementIndex];
+			MeshVertices.AddUninitialized(ConvexElem.VertexData.Num());
+			ConvexTransform.TransformPositions(ConvexElem.VertexData, MeshVertices);
+		}
+	}
+
+	// Cook trimeshes, but only if we do not force simple collision to be used as complex collision as well
+	const bool bUsingAllTriData = BodySetup->bMeshCollideAll;
+	bCookTriMesh = BodySetup->GetCollisionTraceFlag() != CTF_UseSimpleAsComplex && ShouldGenerateTriMeshData(bUsingAllTriData);
+	if (bCookTriMesh)
+	{
+		IInterface_CollisionDataProvider* CDP = Cast<IInterface_CollisionDataProvider>(CollisionDataProvider);
+		check(CDP != NULL); // It's all been checked in ShouldGenerateTriMeshData
+		bHasTriMeshData = CDP->GetPhysicsTriMeshData(&TriMeshData, bUsingAllTriData);
+	}
+}
+
+FSHAHash FDerivedDataPhysXCooker::GetGeometryHash() const
+{
+	check(bGeometryGathered);
+
+	FSHA1 HashState;
+
+	const FString Settings = FString::Printf(TEXT("%s_%s_%d_%d_%d_%d_%d_%d_%d_%hu"),
+		GetVersionString(),
+		*Format.ToString(),
+		(int32)bGenerateNormalMesh,
+		(int32)bGenerateMirroredMesh,
+		(int32)bGenerateUVInfo,
+		(int32)RuntimeCookFlags,
+		(int32)bCookConvexMeshes,
+		(int32)bDeformableConvexMeshes,
+		(int32)bCookTriMesh,
+		Cooker ? Cooker->GetVersion( Format ) : 0xffff);
+	HashState.UpdateWithString(*Settings, Settings.Len());
+
+	for (const TArray<FVector>& MeshVertices : ConvexVertices)
+	{
+		const int32 NumVertices = MeshVertices.Num();
+		HashState.Update((const uint8*)&NumVertices, sizeof(NumVertices));
+		HashState.Update((const uint8*)MeshVertices.GetData(), MeshVertices.Num() * MeshVertices.GetTypeSize());
+	}
+
+	if (bHasTriMeshData)
+	{
+		const uint8 TriMeshFlags[] = { (uint8)TriMeshData.bFlipNormals, (uint8)TriMeshData.bDeformableMesh, (uint8)TriMeshData.bFastCook };
+		HashState.Update(TriMeshFlags, sizeof(TriMeshFlags));
+
+		const int32 Counts[] = { TriMeshData.Vertices.Num(), TriMeshData.Indices.Num(), TriMeshData.MaterialIndices.Num() };
+		HashState.Update((const uint8*)Counts, sizeof(Counts));
+		HashState.Update((const uint8*)TriMeshData.Vertices.GetData(), TriMeshData.Vertices.Num() * TriMeshData.Vertices.GetTypeSize());
+		HashState.Update((const uint8*)TriMeshData.Indices.GetData(), TriMeshData.Indices.Num() * TriMeshData.Indices.GetTypeSize());
+		HashState.Update((const uint8*)TriMeshData.MaterialIndices.GetData(), TriMeshData.MaterialIndices.Num() * TriMeshData.MaterialIndices.GetTypeSize());
+
+		if (bGenerateUVInfo)
+		{
+			for (const TArray<FVector2D>& UVChannel : TriMeshData.UVs)
+			{
+				const int32 NumUVs = UVChannel.Num();
+				HashState.Update((const uint8*)&NumUVs, sizeof(NumUVs));
+				HashState.Update((const uint8*)UVChannel.GetData(), UVChannel.Num() * UVChannel.GetTypeSize());
+			}
+		}
+	}
+
+	FSHAHash Hash;
+	HashState.Final();
+	HashState.GetHash(Hash.Hash);
+	return Hash;
+}
+
 DECLARE_CYCLE_STAT(TEXT("PhysX Cooking"), STAT_PhysXCooking, STATGROUP_Physics);
 
 
@@ -60,6 +171,8 @@ bool FDerivedDataPhysXCooker::Build( TArray<uint8>& OutData )
 
 	check(Cooker != NULL);
 
+	GatherGeometry();
+
 	FMemoryWriter Ar( OutData );
 	uint8 bLittleEndian = PLATFORM_LITTLE_ENDIAN;	//TODO: We should pass the target platform into this function and write it. Then swap the endian on the writer so the reader doesn't have to do it at runtime
 	int32 NumConvexElementsCooked = 0;
@@ -75,8 +188,7 @@ bool FDerivedDataPhysXCooker::Build( TArray<uint8>& OutData )
 
 	bool bSuccess = true;
 
-	// Cook convex meshes, but only if we are not forcing complex collision to be used as simple collision as well
-	if( BodySetup && BodySetup->GetCollisionTraceFlag() != CTF_UseComplexAsSimple && BodySetup->AggGeom.ConvexElems.Num() > 0 )
+	if( bCookConvexMeshes )
 	{
 		if( bGenerateNormalMesh )
 		{
@@ -90,11 +202,9 @@ bool FDerivedDataPhysXCooker::Build( TArray<uint8>& OutData )
 
 	FBodySetupUVInfo UVInfo;
 
-	// Cook trimeshes, but only if we do not frce simple collision to be used as complex collision as well
-	bool bUsingAllTriData = BodySetup != NULL ? BodySetup->bMeshCollideAll : false;
-	if( (BodySetup == NULL || BodySetup->GetCollisionTraceFlag() != CTF_UseSimpleAsComplex) && ShouldGenerateTriMeshData(bUsingAllTriData) )
+	if( bCookTriMesh )
 	{
-		bSuccess = BuildTriMesh( OutData, bUsingAllTriData, UPhysicsSettings::Get()->bSupportUVFromHitResults ? &UVInfo : nullptr, NumTriMeshesCooked) && bSuccess;
+		bSuccess = BuildTriMesh( OutData, bGenerateUVInfo ? &UVInfo : nullptr, NumTriMeshesCooked) && bSuccess;
 	}
 
 	// Seek to end, serialize UV info
@@ -113,61 +223,48 @@ bool FDerivedDataPhysXCooker::Build( TArray<uint8>& OutData )
 bool FDerivedDataPhysXCooker::BuildConvex( TArray<uint8>& OutData, bool InMirrored, int32& NumConvexCooked )
 {	
 	bool bSuccess = true;
-	check( BodySetup != NULL );
-	for( int32 ElementIndex = 0; ElementIndex < BodySetup->AggGeom.ConvexElems.Num(); ElementIndex++ )
-	{
-		const FKConvexElem& ConvexElem = BodySetup->AggGeom.ConvexElems[ElementIndex];
-
-		FVector Scaling = InMirrored ? FVector(-1, 1, 1) : FVector(1, 1, 1);
-
-		TArray<FVector> MeshVertices;
-		MeshVertices.AddUninitialized(ConvexElem.VertexData.Num());
+	const FVector Scaling = InMirrored ? FVector(-1, 1, 1) : FVector(1, 1, 1);
 
-		FTransform ConvexTransform = ConvexElem.GetTransform();
-		if (!ConvexTransform.IsValid())
-		{
-			UE_LOG(LogPhysics, Warning, TEXT("Cook Convex: [%s] ConvexElem[%d] has invalid transform"), *GetPathNameSafe(BodySetup->GetOuter()), ElementIndex);
-			ConvexTransform = FTransform::Identity;
-		}
+	// Get cook flags to use
+	EPhysXMeshCookFlags CookFlags = RuntimeCookFlags;
+	if (bDeformableConvexMeshes)
+	{
+		CookFlags |= EPhysXMeshCookFlags::DeformableMesh;
+	}
 
-		// Transform verts from element to body space, and mirror if desired
-		for(int32 VertIdx=0; VertIdx<ConvexElem.VertexData.Num(); VertIdx++)
+	TArray<FVector> MeshVertices;
+	for( int32 ElementIndex = 0; ElementIndex < ConvexVertices.Num(); ElementIndex++ )
+	{
+		// Mirror if desired
+		MeshVertices.Reset(ConvexVertices[ElementIndex].Num());
+		for (const FVector& BodySpaceVert : ConvexVertices[ElementIndex])
 		{
-			FVector BodySpaceVert = ConvexTransform.TransformPosition(ConvexElem.VertexData[VertIdx]);
-			MeshVertices[VertIdx] = BodySpaceVert * Scaling;
+			MeshVertices.Add(BodySpaceVert * Scaling);
 		}
 
 		// Store info on the cooking result (1 byte)
 		int32 ResultInfoOffset = OutData.Add( false );
 
-		// Get cook flags to use
-		const bool bDeformableMesh = CollisionDataProvider->IsA(USplineMeshComponent::StaticClass());
-		EPhysXMeshCookFlags CookFlags = RuntimeCookFlags;
-		if (bDeformableMesh)
-		{
-			CookFlags |= EPhysXMeshCookFlags::DeformableMesh;
-		}
-
 		// Cook and store Result at ResultInfoOffset
-		UE_LOG(LogPhysics, Log, TEXT("Cook Convex: %s %d (FlipX:%d)"), *BodySetup->GetOuter()->GetPathName(), ElementIndex, InMirrored);		
+		UE_LOG(LogPhysics, Log, TEXT("Cook Convex: %s %d (FlipX:%d)"), *DebugName, ElementIndex, InMirrored);		
 		const EPhysXCookingResult Result = Cooker->CookConvex(Format, CookFlags, MeshVertices, OutData);
 		switch (Result)
 		{
 		case EPhysXCookingResult::Succeeded:
 			break;
 		case EPhysXCookingResult::Failed:
-			UE_LOG(LogPhysics, Warning, TEXT("Failed to cook convex: %s %d (FlipX:%d). The remaining elements will not get cooked."), *BodySetup->GetOuter()->GetPathName(), ElementIndex, InMirrored ? 1 : 0);
+			UE_LOG(LogPhysics, Warning, TEXT("Failed to cook convex: %s %d (FlipX:%d). The remaining elements will not get cooked."), *DebugName, ElementIndex, InMirrored ? 1 : 0);
 			bSuccess = false;
 			break;
 		case EPhysXCookingResult::SucceededWithInflation:
-			if (!bDeformableMesh)
+			if (!bDeformableConvexMeshes)
 			{
 				bSuccess = false;
-				UE_LOG(LogPhysics, Warning, TEXT("Cook convex: %s %d (FlipX:%d) failed but succeeded with inflation.  The mesh should be looked at."), *BodySetup->GetOuter()->GetPathName(), ElementIndex, InMirrored ? 1 : 0);
+				UE_LOG(LogPhysics, Warning, TEXT("Cook convex: %s %d (FlipX:%d) failed but succeeded with inflation.  The mesh should be looked at."), *DebugName, ElementIndex, InMirrored ? 1 : 0);
 			}
 			else
 			{
-				UE_LOG(LogPhysics, Log, TEXT("Cook convex: %s %d (FlipX:%d) required inflation. You may wish to adjust the mesh so this is not necessary."), *BodySetup->GetOuter()->GetPathName(), ElementIndex, InMirrored ? 1 : 0);
+				UE_LOG(LogPhysics, Log, TEXT("Cook convex: %s %d (FlipX:%d) required inflation. You may wish to adjust the mesh so this is not necessary."), *DebugName, ElementIndex, InMirrored ? 1 : 0);
 			}
 			break;
 		default:
@@ -178,7 +275,7 @@ bool FDerivedDataPhysXCooker::BuildConvex( TArray<uint8>& OutData, bool InMirror
 		OutData[ ResultInfoOffset ] = (Result != EPhysXCookingResult::Failed) ? 1 : 0;
 	}
 
-	NumConvexCooked = BodySetup->AggGeom.ConvexElems.Num();
+	NumConvexCooked = ConvexVertices.Num();
 	return bSuccess;
 }
 
@@ -191,18 +288,15 @@ bool FDerivedDataPhysXCooker::ShouldGenerateTriMeshData(bool InUseAllTriData)
 	return bPerformCook;
 }
 
-bool FDerivedDataPhysXCooker::BuildTriMesh( TArray<uint8>& OutData, bool InUseAllTriData, FBodySetupUVInfo* UVInfo, int32& NumTrimeshCooked)
+bool FDerivedDataPhysXCooker::BuildTriMesh( TArray<uint8>& OutData, FBodySetupUVInfo* UVInfo, int32& NumTrimeshCooked)
 {
 	check(Cooker != NULL);
 
 	bool bError = false;
 	bool bResult = false;
-	FTriMeshCollisionData TriangleMeshDesc;
-	IInterface_CollisionDataProvider* CDP = Cast<IInterface_CollisionDataProvider>(CollisionDataProvider);
-	check(CDP != NULL); // It's all been checked before getting into this function
-		
-	bool bHaveTriMeshData = CDP->GetPhysicsTriMeshData(&TriangleMeshDesc, InUseAllTriData);
-	if(bHaveTriMeshData)
+	const FTriMeshCollisionData& TriangleMeshDesc = TriMeshData;
+
+	if(bHasTriMeshData)
 	{
 		// If any of the below checks gets hit this usually means 
 		// IInterface_CollisionDataProvider::ContainsPhysicsTriMeshData did not work properly.
@@ -210,14 +304,11 @@ bool FDerivedDataPhysXCooker::BuildTriMesh( TArray<uint8>& OutData, bool InUseAl
 		const int32 NumVerts = TriangleMeshDesc.Vertices.Num();
 		if(NumIndices == 0 || NumVerts == 0 || TriangleMeshDesc.MaterialIndices.Num() > NumIndices)
 		{
-			UE_LOG(LogPhysics, Warning, TEXT("FDerivedDataPhysXCooker::BuildTriMesh: Triangle data from '%s' invalid (%d verts, %d indices)."), *CollisionDataProvider->GetPathName(), NumVerts, NumIndices );
+			UE_LOG(LogPhysics, Warning, TEXT("FDerivedDataPhysXCooker::BuildTriMesh: Triangle data from '%s' invalid (%d verts, %d indices)."), *DebugName, NumVerts, NumIndices );
 			bError = true;
 			return bResult;
 		}
 
-		TArray<FVector>* MeshVertices = NULL;
-		MeshVertices = &TriangleMeshDesc.Vertices;
-		
 		// Set up cooking flags
 		EPhysXMeshCookFlags CookFlags = RuntimeCookFlags;
 
@@ -231,12 +322,12 @@ bool FDerivedDataPhysXCooker::BuildTriMesh( TArray<uint8>& OutData, bool InUseAl
 			CookFlags |= EPhysXMeshCookFlags::FastCook;
 		}
 
-		UE_LOG(LogPhysics, Log, TEXT("Cook TriMesh: %s"), *CollisionDataProvider->GetPathName());
-		bResult = Cooker->CookTriMesh( Format, CookFlags, *MeshVertices, TriangleMeshDesc.Indices, TriangleMeshDesc.MaterialIndices, TriangleMeshDesc.bFlipNormals, OutData);
+		UE_LOG(LogPhysics, Log, TEXT("Cook TriMesh: %s"), *DebugName);
+		bResult = Cooker->CookTriMesh( Format, CookFlags, TriangleMeshDesc.Vertices, TriangleMeshDesc.Indices, TriangleMeshDesc.MaterialIndices, TriangleMeshDesc.bFlipNormals, OutData);
 		if( !bResult )
 		{
 			bError = true;
-			UE_LOG(LogPhysics, Warning, TEXT("Failed to cook TriMesh: %s."), *CollisionDataProvider->GetPathName());
+			UE_LOG(LogPhysics, Warning, TEXT("Failed to cook TriMesh: %s."), *DebugName);
 		}
 
 		// If we want UV info, copy that now
@@ -280,6 +371,80 @@ bool FDerivedDataPhysXCooker::BuildTriMesh( TArray<uint8>& OutData, bool InUseAl
 	return !bError;	//use error instead of bResult because we do not warn if the trimesh data is simply empty, and in that case we don't consider it to be a failure
 }
 
+static TAutoConsoleVariable<int32> CVarRuntimeCookingCache(
+	TEXT("p.RuntimeCookingCache"),
+	0,
+	TEXT("Whether physics meshes cooked asynchronously at runtime are kept in the saved directory and reused by later runs."));
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Async Cooks Deduplicated"), STAT_PhysXAsyncCooksDeduplicated, STATGROUP_Physics);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Runtime Cooking Cache Hits"), STAT_PhysXRuntimeCookingCacheHits, STATGROUP_Physics);
+
+TMap<FSHAHash, TArray<FPhysXAsyncCooker::FOnCooked>> FPhysXAsyncCooker::PendingCooks;
+
+static FString GetRuntimeCookingCacheFilename(const FSHAHash& Hash)
+{
+	return FPaths::GameSavedDir() / TEXT("PhysXCookingCache") / (Hash.ToString() + TEXT(".bin"));
+}
+
+bool FPhysXAsyncCooker::LoadFromRuntimeCookingCache(const FSHAHash& Hash, TArray<uint8>& OutData)
+{
+	if (CVarRuntimeCookingCache.GetValueOnAnyThread() == 0)
+	{
+		return false;
+	}
+
+	if (!FFileHelper::LoadFileToArray(OutData, *GetRuntimeCookingCacheFilename(Hash), FILEREAD_Silent))
+	{
+		OutData.Reset();
+		return false;
+	}
+
+	INC_DWORD_STAT(STAT_PhysXRuntimeCookingCacheHits);
+	return true;
+}
+
+void FPhysXAsyncCooker::SaveToRuntimeCookingCache(const FSHAHash& Hash, const TArray<uint8>& Data)
+{
+	if (CVarRuntimeCookingCache.GetValueOnAnyThread() != 0)
+	{
+		FFileHelper::SaveArrayToFile(Data, *GetRuntimeCookingCacheFilename(Hash));
+	}
+}
+
+void FPhysXAsyncCooker::Cook(const TSharedRef<FDerivedDataPhysXCooker, ESPMode::ThreadSafe>& Cooker, FOnCooked OnCooked)
+{
+	check(IsInGameThread());
+
+	const FSHAHash Hash = Cooker->GetGeometryHash();
+	if (TArray<FOnCooked>* Waiting = PendingCooks.Find(Hash))
+	{
+		INC_DWORD_STAT(STAT_PhysXAsyncCooksDeduplicated);
+		Waiting->Add(MoveTemp(OnCooked));
+		return;
+	}
+	PendingCooks.Add(Hash).Add(MoveTemp(OnCooked));
+
+	Async<void>(EAsyncExecution::ThreadPool, [Cooker, Hash]()
+	{
+		TArray<uint8>* CookedData = new TArray<uint8>();
+		if (!LoadFromRuntimeCookingCache(Hash, *CookedData) && Cooker->Build(*CookedData))
+		{
+			SaveToRuntimeCookingCache(Hash, *CookedData);
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [Hash, CookedData]()
+		{
+			TArray<FOnCooked> Callbacks;
+			PendingCooks.RemoveAndCopyValue(Hash, Callbacks);
+			for (FOnCooked& Callback : Callbacks)
+			{
+				Callback(*CookedData);
+			}
+			delete CookedData;
+		});
+	});
+}
+
 FDerivedDataPhysXBinarySerializer::FDerivedDataPhysXBinarySerializer(FName InFormat, const TArray<FBodyInstance*>& InBodies, const TArray<class UBodySetup*>& InBodySetups, const TArray<class UPhysicalMaterial*>& InPhysicalMaterials, const FGuid& InGuid)
 : Bodies(InBodies)
 , BodySetups(InBodySetups)
@@ -4,8 +4,10 @@
 
 #include "CoreMinimal.h"
 #include "Misc/Guid.h"
+#include "Misc/SecureHash.h"
 #include "EngineDefines.h"
 #include "PhysXIncludes.h"
+#include "Interfaces/Interface_CollisionDataProvider.h"
 
 #if WITH_PHYSX && (WITH_RUNTIME_PHYSICS_COOKING || WITH_EDITOR)
 #include "DerivedDataPluginInterface.h"
@@ -35,6 +37,16 @@ private:
 	FGuid DataGuid;
 	FString MeshId;
 
+	/** Geometry copied from the body setup by GatherGeometry */
+	TArray<TArray<FVector>> ConvexVertices;
+	FTriMeshCollisionData TriMeshData;
+	FString DebugName;
+	bool bCookConvexMeshes;
+	bool bDeformableConvexMeshes;
+	bool bCookTriMesh;
+	bool bHasTriMeshData;
+	bool bGeometryGathered;
+
 public:
 	FDerivedDataPhysXCooker(FName InFormat, EPhysXMeshCookFlags InRuntimeCookFlags, UBodySetup* InBodySetup);
 
@@ -89,14 +101,47 @@ public:
 	{
 		return !!Cooker;
 	}
+
+	/**
+	 * Copies the geometry to cook from the body setup and its collision data provider. Build gathers it itself if this wasn't called,
+	 * once it was called Build doesn't touch any UObject and can run on any thread.
+	 */
+	void GatherGeometry();
+
+	/** Hash of everything the cooked data depends on, only valid after GatherGeometry */
+	FSHAHash GetGeometryHash() const;
+
 private:
 
 	void InitCooker();
 	bool BuildConvex( TArray<uint8>& OutData, bool InMirrored, int32& NumConvexCooked );
-	bool BuildTriMesh( TArray<uint8>& OutData, bool InUseAllTriData, FBodySetupUVInfo* UVInfo, int32& NumTriMeshCooked);
+	bool BuildTriMesh( TArray<uint8>& OutData, FBodySetupUVInfo* UVInfo, int32& NumTriMeshCooked);
 	bool ShouldGenerateTriMeshData(bool InUseAllTriData);
 };
 
+//////////////////////////////////////////////////////////////////////////
+// PhysX async cooking
+class FPhysXAsyncCooker
+{
+public:
+	typedef TFunction<void(const TArray<uint8>& CookedData)> FOnCooked;
+
+	/**
+	 * Cooks the geometry gathered by the cooker on the thread pool and calls OnCooked on the game thread with the result.
+	 * Requests for geometry that is already being cooked wait for the same result instead of cooking it again.
+	 * With p.RuntimeCookingCache results are also kept on disk and reused by later runs.
+	 * Must be called on the game thread after FDerivedDataPhysXCooker::GatherGeometry.
+	 */
+	static void Cook(const TSharedRef<FDerivedDataPhysXCooker, ESPMode::ThreadSafe>& Cooker, FOnCooked OnCooked);
+
+private:
+	static bool LoadFromRuntimeCookingCache(const FSHAHash& Hash, TArray<uint8>& OutData);
+	static void SaveToRuntimeCookingCache(const FSHAHash& Hash, const TArray<uint8>& Data);
+
+	/** Callbacks waiting for geometry being cooked, by geometry hash. Only accessed on the game thread */
+	static TMap<FSHAHash, TArray<FOnCooked>> PendingCooks;
+};
+
 //////////////////////////////////////////////////////////////////////////
 // PhysX Binary Serialization
 class FDerivedDataPhysXBinarySerializer : public FDerivedDataPluginInterface
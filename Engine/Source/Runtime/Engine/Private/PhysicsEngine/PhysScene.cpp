@@ -1,6 +1,7 @@
 // Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
 
 #include "CoreMinimal.h"
+#include "HAL/LowLevelMemTracker.h"
 #include "Misc/CommandLine.h"
 #include "Stats/Stats.h"
 #include "UObject/UObjectGlobals.h"
@@ -8,6 +9,7 @@
 #include "UObject/UObjectIterator.h"
 #include "HAL/IConsoleManager.h"
 #include "Async/TaskGraphInterfaces.h"
+#include "Async/ParallelFor.h"
 #include "EngineDefines.h"
 #include "Engine/EngineTypes.h"
 #include "PhysxUserData.h"
@@ -348,6 +350,7 @@ FPhysScene::FPhysScene()
 	OwningWorld = NULL;
 #if WITH_PHYSX
 	PhysxUserData = FPhysxUserData(this);
+	DeferredActorBatchCount = 0;
 #endif	//#if WITH_PHYSX
 
 	UPhysicsSettings * PhysSetting = UPhysicsSettings::Get();
@@ -908,11 +911,35 @@ void FPhysScene::ClearPreSimKinematicUpdate(USkeletalMeshComponent* InSkelComp)
 }
 
 
+static TAutoConsoleVariable<int32> CVarParallelKinematicUpdate(
+	TEXT("p.ParallelKinematicUpdate"),
+	4,
+	TEXT("Minimum number of deferred skeletal mesh kinematic updates needed to compute the body transforms in parallel before they are sent to physics. 0 to disable."));
+
 void FPhysScene::UpdateKinematicsOnDeferredSkelMeshes()
 {
 	SCOPE_CYCLE_COUNTER(STAT_UpdateKinematicsOnDeferredSkelMeshes);
 
-	for (TMap< USkeletalMeshComponent*, FDeferredKinematicUpdateInfo >::TIterator It(DeferredKinematicUpdateSkelMeshes); It; ++It)
+	// Body transforms only depend on each component's own pose, so they can be computed in parallel.
+	// Writing them to the physics scene still happens here, one component at a time.
+	TArray<USkeletalMeshComponent*> SkelComps;
+	TArray<TArray<FTransform>> BodyTargets;
+
+	const int32 MinParallelUpdates = CVarParallelKinematicUpdate.GetValueOnGameThread();
+	if (MinParallelUpdates > 0 && DeferredKinematicUpdateSkelMeshes.Num() >= MinParallelUpdates)
+	{
+		DeferredKinematicUpdateSkelMeshes.GenerateKeyArray(SkelComps);
+		BodyTargets.SetNum(SkelComps.Num());
+
+		ParallelFor(SkelComps.Num(), [&SkelComps, &BodyTargets](int32 Index)
+		{
+			USkeletalMeshComponent* SkelComp = SkelComps[Index];
+			SkelComp->ComputeKinematicBodyTargets(SkelComp->GetComponentSpaceTransforms(), BodyTargets[Index]);
+		});
+	}
+
+	int32 CompIndex = 0;
+	for (TMap< USkeletalMeshComponent*, FDeferredKinematicUpdateInfo >::TIterator It(DeferredKinematicUpdateSkelMeshes); It; ++It, ++CompIndex)
 	{
 		USkeletalMeshComponent* SkelComp = (*It).Key;
 		FDeferredKinematicUpdateInfo Info = (*It).Value;
@@ -920,7 +947,9 @@ void FPhysScene::UpdateKinematicsOnDeferredSkelMeshes()
 		check(SkelComp->bDeferredKinematicUpdate); // Should be true if in map!
 
 		// Perform kinematic updates
-		SkelComp->UpdateKinematicBonesToAnim(SkelComp->GetComponentSpaceTransforms(), Info.TeleportType, Info.bNeedsSkinning, EAllowKinematicDeferral::DisallowDeferral);
+		const TArray<FTransform>* SkelCompBodyTargets = BodyTargets.IsValidIndex(CompIndex) ? &BodyTargets[CompIndex] : nullptr;
+		check(!SkelCompBodyTargets || SkelComps[CompIndex] == SkelComp);
+		SkelComp->UpdateKinematicBonesToAnim(SkelComp->GetComponentSpaceTransforms(), Info.TeleportType, Info.bNeedsSkinning, EAllowKinematicDeferral::DisallowDeferral, SkelCompBodyTargets);
 
 		// Clear deferred flag
 		SkelComp->bDeferredKinematicUpdate = false; 
@@ -976,6 +1005,15 @@ void FPhysScene::TickPhysScene(uint32 SceneType, FGraphEventRef& InOutCompletion
 		return;
 	}
 
+	if (IsSubstepping(SceneType) && PhysSubSteppers[SceneType]->CarryOverShortFrame(UseSyncTime(SceneType) ? SyncDeltaSeconds : DeltaSeconds))
+	{
+		// Not enough time for a fixed substep yet. Swap back so this frame's kinematic targets are used by the next step,
+		// but drop its forces: they are queued again next frame and would otherwise be applied twice over the same step.
+		PhysSubSteppers[SceneType]->SwapBuffers();
+		PhysSubSteppers[SceneType]->DiscardExternalForces();
+		return;
+	}
+
 	/**
 	* Weight frame time according to PhysScene settings.
 	*/
@@ -1378,6 +1416,7 @@ FAutoConsoleTaskPriority CPrio_PhyXSceneCompletion(
 
 void FPhysScene::StartFrame()
 {
+	LLM_SCOPE(ELLMTag::Physics);
 	FGraphEventArray FinishPrerequisites;
 
 	//Update the collision disable table before ticking
@@ -2170,4 +2209,25 @@ void FPhysScene::FlushDeferredActors(EPhysicsSceneType SceneType)
 	DeferredSceneData[SceneType].FlushDeferredActors_AssumesLocked(Scene);
 }
 
+void FPhysScene::BeginDeferredActorBatch()
+{
+	check(IsInGameThread());
+	++DeferredActorBatchCount;
+}
+
+void FPhysScene::EndDeferredActorBatch()
+{
+	check(IsInGameThread());
+	check(DeferredActorBatchCount > 0);
+
+	if (--DeferredActorBatchCount == 0)
+	{
+		FlushDeferredActors(PST_Sync);
+		if (HasAsyncScene())
+		{
+			FlushDeferredActors(PST_Async);
+		}
+	}
+}
+
 #endif
@@ -13,6 +13,7 @@ FPhysSubstepTask::FPhysSubstepTask(PxApexScene * GivenScene, FPhysScene* InPhysS
 	NumSubsteps(0),
 	SubTime(0.f),
 	DeltaSeconds(0.f),
+	CarriedOverTime(0.f),
 	FullSimulationTask(0),
 	Alpha(0.f),
 	StepScale(0.f),
@@ -324,6 +325,21 @@ float FPhysSubstepTask::UpdateTime(float UseDelta)
 	
 	float FrameRateInv = 1.f / FrameRate;
 
+	if (PhysSetting->bFixedSubstepDeltaTime)
+	{
+		//Simulate as many whole substeps as are available and keep the remainder for the next frame
+		const float AvailableTime = UseDelta + CarriedOverTime;
+		NumSubsteps = FMath::Min((uint32)FMath::Max(FMath::FloorToInt(AvailableTime * FrameRateInv), 0), MaxSubSteps);
+		DeltaSeconds = NumSubsteps * FrameRate;
+		//Don't let the remainder build up when we can't keep up with real time
+		CarriedOverTime = FMath::Clamp(AvailableTime - DeltaSeconds, 0.f, FrameRate);
+		SubTime = NumSubsteps > 0 ? FrameRate : 0.f;
+
+		return SubTime;
+	}
+
+	CarriedOverTime = 0.f;
+
 	//Figure out how big dt to make for desired framerate
 	DeltaSeconds = FMath::Min(UseDelta, MaxSubSteps * FrameRate);
 	NumSubsteps = FMath::CeilToInt(DeltaSeconds * FrameRateInv);
@@ -333,6 +349,38 @@ float FPhysSubstepTask::UpdateTime(float UseDelta)
 	return SubTime;
 }
 
+bool FPhysSubstepTask::CarryOverShortFrame(float UseDelta)
+{
+	const UPhysicsSettings* PhysSetting = UPhysicsSettings::Get();
+	if (PhysSetting->bFixedSubstepDeltaTime && UseDelta + CarriedOverTime < PhysSetting->MaxSubstepDeltaTime)
+	{
+		CarriedOverTime += UseDelta;
+		return true;
+	}
+
+	return false;
+}
+
+void FPhysSubstepTask::DiscardExternalForces()
+{
+	PhysTargetMap& Targets = PhysTargetBuffers[External];
+	for (PhysTargetMap::TIterator It = Targets.CreateIterator(); It; ++It)
+	{
+		FPhysTarget& PhysTarget = It.Value();
+		if (PhysTarget.bKinematicTarget)
+		{
+			PhysTarget.Forces.Empty();
+			PhysTarget.Torques.Empty();
+			PhysTarget.RadialForces.Empty();
+			PhysTarget.CustomPhysics.Empty();
+		}
+		else
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
 #if WITH_PHYSX
 void FPhysSubstepTask::StepSimulation(PhysXCompletionTask * Task)
 {
@@ -175,6 +175,15 @@ public:
 	void SwapBuffers();
 	float UpdateTime(float UseDelta);
 
+	/**
+	 * With fixed substep delta time, carries the frame time over to the next frame if it doesn't add up to a whole substep yet.
+	 * @return true if the scene shouldn't be simulated this frame.
+	 */
+	bool CarryOverShortFrame(float UseDelta);
+
+	/** Forgets the forces queued by the game thread since the last swap, kinematic targets are kept */
+	void DiscardExternalForces();
+
 	void SubstepSimulationStart();
 	void SubstepSimulationEnd(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent);
 #if WITH_PHYSX
@@ -196,6 +205,8 @@ private:
 	uint32 NumSubsteps;
 	float SubTime;
 	float DeltaSeconds;
+	/** Frame time not simulated yet because it didn't add up to a whole fixed substep */
+	float CarriedOverTime;
 	FThreadSafeBool External;
 	class  PhysXCompletionTask * FullSimulationTask;
 	float Alpha;
@@ -0,0 +1,75 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "Net/PushModel.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
+#include "UObject/UObjectArray.h"
+
+static TAutoConsoleVariable<int32> CVarPushModel( TEXT( "net.PushModel" ), 1, TEXT( "If true, push based properties are only compared after they were marked dirty" ) );
+
+/** Dirty states of all objects with marked properties, states are removed when their object is deleted */
+class FNetPushModelObjectStates : public FUObjectArray::FUObjectDeleteListener
+{
+public:
+	FNetPushModelObjectStates()
+		: DirtyCounter(0)
+	{
+		GUObjectArray.AddUObjectDeleteListener(this);
+	}
+
+	virtual void NotifyUObjectDeleted(const UObjectBase* Object, int32 Index) override
+	{
+		// objects can be deleted off the game thread, everything else happens on it
+		FScopeLock Lock(&ObjectStatesCritical);
+		ObjectStates.Remove(Index);
+	}
+
+	static FNetPushModelObjectStates& Get()
+	{
+		// never destroyed, the object array may still notify deletes during shutdown
+		static FNetPushModelObjectStates* Singleton = new FNetPushModelObjectStates();
+		return *Singleton;
+	}
+
+	FCriticalSection ObjectStatesCritical;
+	TMap<int32, FNetPushModelObjectState> ObjectStates;
+	/** Incremented for every property marked dirty, 64 bits so it never wraps */
+	uint64 DirtyCounter;
+};
+
+void FNetPushModel::MarkPropertyDirty(const UObject* Object, int32 RepIndexStart, int32 RepIndexEnd)
+{
+	check(Object && RepIndexStart >= 0 && RepIndexEnd >= RepIndexStart);
+
+	FNetPushModelObjectStates& States = FNetPushModelObjectStates::Get();
+	FScopeLock Lock(&States.ObjectStatesCritical);
+
+	FNetPushModelObjectState& ObjectState = States.ObjectStates.FindOrAdd(GUObjectArray.ObjectToIndex(Object));
+	if (ObjectState.PropertyDirtyCounters.Num() <= RepIndexEnd)
+	{
+		ObjectState.PropertyDirtyCounters.AddZeroed(RepIndexEnd + 1 - ObjectState.PropertyDirtyCounters.Num());
+	}
+
+	const uint64 Counter = ++States.DirtyCounter;
+	for (int32 RepIndex = RepIndexStart; RepIndex <= RepIndexEnd; RepIndex++)
+	{
+		ObjectState.PropertyDirtyCounters[RepIndex] = Counter;
+	}
+}
+
+const FNetPushModelObjectState* FNetPushModel::FindObjectState(const UObject* Object)
+{
+	FNetPushModelObjectStates& States = FNetPushModelObjectStates::Get();
+	FScopeLock Lock(&States.ObjectStatesCritical);
+	return States.ObjectStates.Find(GUObjectArray.ObjectToIndex(Object));
+}
+
+uint64 FNetPushModel::GetDirtyCounter()
+{
+	return FNetPushModelObjectStates::Get().DirtyCounter;
+}
+
+bool FNetPushModel::IsEnabled()
+{
+	return CVarPushModel.GetValueOnGameThread() != 0;
+}
@@ -14,9 +14,16 @@
 #include "Net/NetworkProfiler.h"
 #include "Engine/ActorChannel.h"
 #include "Engine/NetworkSettings.h"
+#include "Net/PushModel.h"
 
 static TAutoConsoleVariable<int32> CVarAllowPropertySkipping( TEXT( "net.AllowPropertySkipping" ), 1, TEXT( "Allow skipping of properties that haven't changed for other clients" ) );
 
+static TAutoConsoleVariable<int32> CVarShareSerializedProperties( TEXT( "net.ShareSerializedProperties" ), 1, TEXT( "Reuse the properties serialized for a connection for other connections that send the same changes in the same frame" ) );
+
+static TAutoConsoleVariable<int32> CVarDeltaRepMovement( TEXT( "net.DeltaRepMovement" ), 1, TEXT( "If true, FRepMovement properties are sent as a quantized delta to the last value the connection acked" ) );
+
+static TAutoConsoleVariable<int32> CVarDeltaRepMovementMaxBits( TEXT( "net.DeltaRepMovementMaxBits" ), 16, TEXT( "Largest number of bits a component of a delta compressed FRepMovement may use, the absolute value is sent when any component needs more (1 - 31)" ) );
+
 static TAutoConsoleVariable<int32> CVarDoPropertyChecksum( TEXT( "net.DoPropertyChecksum" ), 0, TEXT( "" ) );
 
 FAutoConsoleVariable CVarDoReplicationContextString( TEXT( "net.ContextDebug" ), 0, TEXT( "" ) );
@@ -529,10 +536,14 @@ void FRepLayout::CompareProperties_Array_r(
 bool FRepLayout::CompareProperties(
 	FRepChangelistState* RESTRICT	RepChangelistState,
 	const uint8* RESTRICT			Data,
-	const FReplicationFlags&		RepFlags ) const
+	const FReplicationFlags&		RepFlags,
+	const bool						bForceFullCompare ) const
 {
 	SCOPE_CYCLE_COUNTER( STAT_NetReplicateDynamicPropTime );
 
+	// The first compare has to look at everything, the shadow state starts out as the archetype
+	const bool bFirstCompare = RepChangelistState->CompareIndex == 0;
+
 	RepChangelistState->CompareIndex++;
 
 	check( RepChangelistState->HistoryEnd - RepChangelistState->HistoryStart < FRepChangelistState::MAX_CHANGE_HISTORY );
@@ -543,7 +554,34 @@ bool FRepLayout::CompareProperties(
 	TArray<uint16>& Changed = NewHistoryItem.Changed;
 	Changed.Empty();
 
-	CompareProperties_r( 0, Cmds.Num() - 1, RepChangelistState->StaticBuffer.GetData(), Data, Changed, 0, RepFlags.bNetInitial, false );
+	if ( bHasPushModelProperties && !bFirstCompare && !bForceFullCompare && FNetPushModel::IsEnabled() )
+	{
+		// Compare parent by parent, skipping the push based ones that weren't marked dirty since the last compare
+		const FNetPushModelObjectState* PushModelState = FNetPushModel::FindObjectState( ( const UObject* )Data );
+
+		for ( int32 ParentIndex = 0; ParentIndex < Parents.Num(); ParentIndex++ )
+		{
+			const FRepParentCmd& Parent = Parents[ParentIndex];
+
+			if ( Parent.CmdEnd == Parent.CmdStart )
+			{
+				continue;
+			}
+
+			if ( ( Parent.Flags & PARENT_IsPushBased ) && ( PushModelState == nullptr || !PushModelState->IsPropertyDirty( ParentIndex, RepChangelistState->PushModelCompareCounter ) ) )
+			{
+				continue;
+			}
+
+			CompareProperties_r( Parent.CmdStart, Parent.CmdEnd, RepChangelistState->StaticBuffer.GetData(), Data, Changed, Cmds[Parent.CmdStart].RelativeHandle - 1, RepFlags.bNetInitial, false );
+		}
+	}
+	else
+	{
+		CompareProperties_r( 0, Cmds.Num() - 1, RepChangelistState->StaticBuffer.GetData(), Data, Changed, 0, RepFlags.bNetInitial, false );
+	}
+
+	RepChangelistState->PushModelCompareCounter = FNetPushModel::GetDirtyCounter();
 
 	if ( Changed.Num() == 0 )
 	{
@@ -595,6 +633,16 @@ static FORCEINLINE void WritePropertyHandle( FNetBitWriter & Writer, uint16 Hand
 	NETWORK_PROFILER( GNetworkProfiler.TrackWritePropertyHandle( Writer.GetNumBits() - NumStartingBits, nullptr ) );
 }
 
+/** Bits copied from serialized changelists aren't tracked per property, so sharing is skipped while the network profiler tracks */
+static FORCEINLINE bool IsNetworkProfilerTracking()
+{
+#if USE_NETWORK_PROFILER
+	return GNetworkProfiler.IsTrackingEnabled() || GNetworkProfiler.IsLiveTrackingEnabled();
+#else
+	return false;
+#endif
+}
+
 bool FRepLayout::ReplicateProperties(
 	FRepState* RESTRICT				RepState,
 	FRepChangelistState* RESTRICT	RepChangelistState,
@@ -667,6 +715,10 @@ bool FRepLayout::ReplicateProperties(
 		RepState->LastChangelistIndex = RepChangelistState->HistoryStart;
 	}
 
+	// The merged change list only depends on the shared history range if nothing of our own history gets merged in
+	const int32 SharedHistoryStart = RepState->LastChangelistIndex;
+	const bool bChangedIsSharedRange = RepState->NumNaks == 0 && !bFlushPreOpenAckHistory && RepState->HistoryEnd + 1 - RepState->HistoryStart < FRepState::MAX_CHANGE_HISTORY;
+
 	const int32 PossibleNewHistoryIndex = RepState->HistoryEnd % FRepState::MAX_CHANGE_HISTORY;
 
 	FRepChangedHistory& PossibleNewHistoryItem = RepState->ChangeHistory[PossibleNewHistoryIndex];
@@ -728,9 +780,48 @@ bool FRepLayout::ReplicateProperties(
 
 		SendProperties_BackwardsCompatible( RepState, ChangeTracker, Data, OwningChannel->Connection, Writer, Changed );
 	}
+	else if ( bChangedIsSharedRange && CVarShareSerializedProperties.GetValueOnAnyThread() > 0 && !IsNetworkProfilerTracking() )
+	{
+		// Conditions only depend on the replication flags, so connections with the same flags that send the same range write the same bits
+		const uint32 ReplicationFrame = OwningChannel->Connection->Driver->ReplicationFrame;
+
+		if ( RepChangelistState->SerializedFrame != ReplicationFrame )
+		{
+			RepChangelistState->SerializedChangelists.Reset();
+			RepChangelistState->SerializedFrame = ReplicationFrame;
+		}
+
+		const FRepSerializedChangelist* Serialized = RepChangelistState->SerializedChangelists.FindByPredicate( [&]( const FRepSerializedChangelist& Item )
+		{
+			return Item.HistoryStart == SharedHistoryStart && Item.HistoryEnd == RepChangelistState->HistoryEnd && Item.RepFlagsValue == RepFlags.Value;
+		} );
+
+		if ( Serialized != nullptr )
+		{
+			Writer.SerializeBits( ( void* )Serialized->Buffer.GetData(), Serialized->NumBits );
+		}
+		else
+		{
+			FBitWriterMark Mark( Writer );
+			bool bCanShare = true;
+
+			SendProperties( RepState, ChangeTracker, Data, ObjectClass, Writer, Changed, bCanShare );
+
+			if ( bCanShare && !Writer.IsError() )
+			{
+				FRepSerializedChangelist& NewSerialized = RepChangelistState->SerializedChangelists[RepChangelistState->SerializedChangelists.AddDefaulted()];
+				NewSerialized.HistoryStart = SharedHistoryStart;
+				NewSerialized.HistoryEnd = RepChangelistState->HistoryEnd;
+				NewSerialized.RepFlagsValue = RepFlags.Value;
+				NewSerialized.NumBits = Writer.GetNumBits() - Mark.GetNumBits();
+				Mark.Copy( Writer, NewSerialized.Buffer );
+			}
+		}
+	}
 	else
 	{
-		SendProperties( RepState, ChangeTracker, Data, ObjectClass, Writer, Changed );
+		bool bCanShare = true;
+		SendProperties( RepState, ChangeTracker, Data, ObjectClass, Writer, Changed, bCanShare );
 	}
 
 	// See if something actually sent (this may be false due to conditional checks inside the send properties function
@@ -774,6 +865,31 @@ void FRepLayout::UpdateChangelistHistory( FRepState * RepState, UClass * ObjectC
 
 		if ( AckPacketId >= HistoryItem.OutPacketIdRange.Last || HistoryItem.Resend || DumpHistory )
 		{
+			// Movement sent with this item becomes the delta base once acked, and is forgotten when it has to be resent
+			for ( auto& MovementPair : RepState->MovementDeltaHistories )
+			{
+				FRepMovementDeltaHistory& MovementHistory = MovementPair.Value;
+
+				for ( int32 SentIndex = MovementHistory.Sent.Num() - 1; SentIndex >= 0; SentIndex-- )
+				{
+					const FRepMovementDeltaHistory::FEntry& Sent = MovementHistory.Sent[SentIndex];
+
+					if ( Sent.HistoryIndex != HistoryIndex )
+					{
+						continue;
+					}
+
+					if ( !HistoryItem.Resend && !DumpHistory && ( !MovementHistory.bHasAckedBase || ( int8 )( Sent.Sequence - MovementHistory.AckedBaseSequence ) > 0 ) )
+					{
+						MovementHistory.bHasAckedBase		= true;
+						MovementHistory.AckedBaseSequence	= Sent.Sequence;
+						MovementHistory.AckedBase			= Sent.Value;
+					}
+
+					MovementHistory.Sent.RemoveAtSwap( SentIndex, 1, false );
+				}
+			}
+
 			if ( HistoryItem.Resend || DumpHistory )
 			{
 				// Merge in nak'd change lists
@@ -1187,13 +1303,193 @@ void FRepLayout::PruneChangeList_r(
 	}
 }
 
+/** Per component header of delta compressed movement, and of movement sent without a base */
+static const uint32 RepMovementDeltaHeaderBits		= 5;
+static const uint32 RepMovementAbsoluteHeaderBits	= 6;
+
+static float GetRepMovementVectorScale( const EVectorQuantization QuantizationLevel )
+{
+	switch ( QuantizationLevel )
+	{
+		case EVectorQuantization::RoundTwoDecimals:	return 100.0f;
+		case EVectorQuantization::RoundOneDecimal:	return 10.0f;
+		default:									return 1.0f;
+	}
+}
+
+static uint32 GetRepMovementRotationBits( const ERotatorQuantization QuantizationLevel )
+{
+	return QuantizationLevel == ERotatorQuantization::ByteComponents ? 8 : 16;
+}
+
+static FQuantizedRepMovement QuantizeRepMovement( const FRepMovement& Movement )
+{
+	const float VelocityScale = GetRepMovementVectorScale( Movement.VelocityQuantizationLevel );
+
+	FQuantizedRepMovement Result;
+	Result.Location					= FNetQuantizedVector( Movement.Location, GetRepMovementVectorScale( Movement.LocationQuantizationLevel ) );
+	Result.Rotation					= FNetQuantizedRotator( Movement.Rotation, GetRepMovementRotationBits( Movement.RotationQuantizationLevel ) );
+	Result.LinearVelocity			= FNetQuantizedVector( Movement.LinearVelocity, VelocityScale );
+	Result.AngularVelocity			= Movement.bRepPhysics ? FNetQuantizedVector( Movement.AngularVelocity, VelocityScale ) : FNetQuantizedVector();
+	Result.bSimulatedPhysicSleep	= Movement.bSimulatedPhysicSleep != 0;
+	Result.bRepPhysics				= Movement.bRepPhysics != 0;
+	return Result;
+}
+
+static void ApplyQuantizedRepMovement( const FQuantizedRepMovement& Quantized, FRepMovement& Movement )
+{
+	const float VelocityScale = GetRepMovementVectorScale( Movement.VelocityQuantizationLevel );
+
+	Movement.Location				= Quantized.Location.ToVector( GetRepMovementVectorScale( Movement.LocationQuantizationLevel ) );
+	Movement.Rotation				= Quantized.Rotation.ToRotator( GetRepMovementRotationBits( Movement.RotationQuantizationLevel ) );
+	Movement.LinearVelocity			= Quantized.LinearVelocity.ToVector( VelocityScale );
+	Movement.bSimulatedPhysicSleep	= Quantized.bSimulatedPhysicSleep;
+	Movement.bRepPhysics			= Quantized.bRepPhysics;
+
+	if ( Quantized.bRepPhysics )
+	{
+		Movement.AngularVelocity = Quantized.AngularVelocity.ToVector( VelocityScale );
+	}
+}
+
+static bool CanSerializeRepMovementDelta( const FQuantizedRepMovement& Value, const FQuantizedRepMovement& Base, const uint32 RotationBits, const uint32 MaxBitsPerComponent )
+{
+	return CanSerializeQuantizedDelta( Value.Location, Base.Location, MaxBitsPerComponent ) &&
+		CanSerializeQuantizedDelta( Value.Rotation, Base.Rotation, RotationBits, MaxBitsPerComponent ) &&
+		CanSerializeQuantizedDelta( Value.LinearVelocity, Base.LinearVelocity, MaxBitsPerComponent ) &&
+		CanSerializeQuantizedDelta( Value.AngularVelocity, Base.AngularVelocity, MaxBitsPerComponent );
+}
+
+static void SerializeRepMovementDelta( FArchive& Ar, FQuantizedRepMovement& Value, const FQuantizedRepMovement& Base, const uint32 RotationBits, const uint32 HeaderBits )
+{
+	uint8 Flags = ( Value.bSimulatedPhysicSleep ? 1 : 0 ) | ( Value.bRepPhysics ? 2 : 0 );
+	Ar.SerializeBits( &Flags, 2 );
+	Value.bSimulatedPhysicSleep	= ( Flags & 1 ) != 0;
+	Value.bRepPhysics			= ( Flags & 2 ) != 0;
+
+	SerializeQuantizedDelta( Ar, Value.Location, Base.Location, HeaderBits );
+	SerializeQuantizedDelta( Ar, Value.Rotation, Base.Rotation, RotationBits, HeaderBits );
+	SerializeQuantizedDelta( Ar, Value.LinearVelocity, Base.LinearVelocity, HeaderBits );
+
+	if ( Value.bRepPhysics )
+	{
+		SerializeQuantizedDelta( Ar, Value.AngularVelocity, Base.AngularVelocity, HeaderBits );
+	}
+	else
+	{
+		Value.AngularVelocity = FNetQuantizedVector();
+	}
+}
+
+void FRepLayout::SendRepMovement( FRepState* RESTRICT RepState, const int32 CmdIndex, FNetBitWriter& Writer, const uint8* RESTRICT Data, bool& bOutCanShare ) const
+{
+	// Top level movement starts with its format, the receiver handles both
+	const bool bDeltaFormat = CVarDeltaRepMovement.GetValueOnAnyThread() > 0;
+	Writer.WriteBit( bDeltaFormat ? 1 : 0 );
+
+	if ( !bDeltaFormat )
+	{
+		Cmds[CmdIndex].Property->NetSerializeItem( Writer, Writer.PackageMap, ( void* )Data );
+		return;
+	}
+
+	// The base differs per connection
+	bOutCanShare = false;
+
+	const FRepMovement& Movement = *( const FRepMovement* )Data;
+	const uint32 RotationBits = GetRepMovementRotationBits( Movement.RotationQuantizationLevel );
+	const uint32 MaxBitsPerComponent = FMath::Clamp( CVarDeltaRepMovementMaxBits.GetValueOnAnyThread(), 1, ( int32 )GetMaxQuantizedDeltaBits( RepMovementDeltaHeaderBits ) );
+
+	FRepMovementDeltaHistory& History = RepState->MovementDeltaHistories.FindOrAdd( CmdIndex );
+
+	FQuantizedRepMovement Value = QuantizeRepMovement( Movement );
+
+	uint8 Sequence = History.NextSequence++;
+	uint32 BaseDistance = ( uint8 )( Sequence - History.AckedBaseSequence );
+
+	const bool bUseBase = History.bHasAckedBase && BaseDistance > 0 && BaseDistance < FRepMovementDeltaHistory::MAX_RECEIVED && CanSerializeRepMovementDelta( Value, History.AckedBase, RotationBits, MaxBitsPerComponent );
+
+	Writer << Sequence;
+	Writer.WriteBit( bUseBase ? 1 : 0 );
+
+	if ( bUseBase )
+	{
+		Writer.SerializeInt( BaseDistance, FRepMovementDeltaHistory::MAX_RECEIVED );
+		SerializeRepMovementDelta( Writer, Value, History.AckedBase, RotationBits, RepMovementDeltaHeaderBits );
+	}
+	else
+	{
+		SerializeRepMovementDelta( Writer, Value, FQuantizedRepMovement(), RotationBits, RepMovementAbsoluteHeaderBits );
+	}
+
+	// Unreliable bunches sent before the channel open is acked can be dropped even though their packet is acked, so they can't become bases
+	if ( RepState->OpenAckedCalled )
+	{
+		FRepMovementDeltaHistory::FEntry& Entry = History.Sent[History.Sent.AddDefaulted()];
+		Entry.Value			= Value;
+		Entry.Sequence		= Sequence;
+		Entry.HistoryIndex	= ( RepState->HistoryEnd - 1 ) % FRepState::MAX_CHANGE_HISTORY;
+	}
+}
+
+static void ReceiveRepMovement( FNetBitReader& Bunch, FRepMovementDeltaHistory& History, const FRepLayoutCmd& Cmd, uint8* RESTRICT Data )
+{
+	if ( !Bunch.ReadBit() )
+	{
+		Cmd.Property->NetSerializeItem( Bunch, Bunch.PackageMap, Data );
+		return;
+	}
+
+	FRepMovement& Movement = *( FRepMovement* )Data;
+	const uint32 RotationBits = GetRepMovementRotationBits( Movement.RotationQuantizationLevel );
+
+	uint8 Sequence = 0;
+	Bunch << Sequence;
+
+	FQuantizedRepMovement Value;
+	bool bHasBase = true;
+
+	if ( Bunch.ReadBit() )
+	{
+		uint32 BaseDistance = 0;
+		Bunch.SerializeInt( BaseDistance, FRepMovementDeltaHistory::MAX_RECEIVED );
+
+		const uint8 BaseSequence = ( uint8 )( Sequence - BaseDistance );
+		const FRepMovementDeltaHistory::FEntry& Base = History.Received[BaseSequence % FRepMovementDeltaHistory::MAX_RECEIVED];
+
+		bHasBase = Base.HistoryIndex != INDEX_NONE && Base.Sequence == BaseSequence;
+
+		// Read the delta even without its base to stay in sync with the bunch
+		SerializeRepMovementDelta( Bunch, Value, bHasBase ? Base.Value : FQuantizedRepMovement(), RotationBits, RepMovementDeltaHeaderBits );
+	}
+	else
+	{
+		SerializeRepMovementDelta( Bunch, Value, FQuantizedRepMovement(), RotationBits, RepMovementAbsoluteHeaderBits );
+	}
+
+	if ( !bHasBase || Bunch.IsError() )
+	{
+		// This can happen if the base was in a bunch that is still queued, keep the current value until the next update
+		UE_LOG( LogRep, Verbose, TEXT( "ReceiveRepMovement: Missing base for delta compressed movement %s" ), *Cmd.Property->GetName() );
+		return;
+	}
+
+	ApplyQuantizedRepMovement( Value, Movement );
+
+	FRepMovementDeltaHistory::FEntry& Entry = History.Received[Sequence % FRepMovementDeltaHistory::MAX_RECEIVED];
+	Entry.Value			= Value;
+	Entry.Sequence		= Sequence;
+	Entry.HistoryIndex	= 0;
+}
+
 void FRepLayout::SendProperties_r(
 	FRepState*	RESTRICT				RepState,
 	FRepChangedPropertyTracker*			ChangedTracker,
 	FNetBitWriter&						Writer,
 	const bool							bDoChecksum,
 	FRepHandleIterator&					HandleIterator,
-	const uint8* RESTRICT				SourceData ) const
+	const uint8* RESTRICT				SourceData,
+	bool&								bOutCanShare ) const
 {
 	while ( HandleIterator.NextHandle() )
 	{
@@ -1242,7 +1538,7 @@ void FRepLayout::SendProperties_r(
 			check( ArrayHandleIterator.ArrayElementSize > 0 );
 			check( ArrayHandleIterator.NumHandlesPerElement > 0 );
 
-			SendProperties_r( RepState, ChangedTracker, Writer, bDoChecksum, ArrayHandleIterator, NewData );
+			SendProperties_r( RepState, ChangedTracker, Writer, bDoChecksum, ArrayHandleIterator, NewData, bOutCanShare );
 
 			check( HandleIterator.ChangelistIterator.ChangedIndex - OldChangedIndex == ArrayChangedCount );				// Make sure we read correct amount
 			check( HandleIterator.ChangelistIterator.Changed[HandleIterator.ChangelistIterator.ChangedIndex] == 0 );	// Make sure we are at the end
@@ -1260,10 +1556,23 @@ void FRepLayout::SendProperties_r(
 		}
 #endif
 
+		// Object references and generic properties (that may contain them) are written through the package map of this connection
+		if ( Cmd.Type == REPCMD_PropertyObject || Cmd.Type == REPCMD_Property )
+		{
+			bOutCanShare = false;
+		}
+
 		const int32 NumStartBits = Writer.GetNumBits();
 
 		// This property changed, so send it
-		Cmd.Property->NetSerializeItem( Writer, Writer.PackageMap, ( void* )Data );
+		if ( Cmd.Type == REPCMD_RepMovement && HandleIterator.ArrayElementSize == 0 )
+		{
+			SendRepMovement( RepState, HandleIterator.CmdIndex, Writer, Data, bOutCanShare );
+		}
+		else
+		{
+			Cmd.Property->NetSerializeItem( Writer, Writer.PackageMap, ( void* )Data );
+		}
 
 		const int32 NumEndBits = Writer.GetNumBits();
 
@@ -1291,7 +1600,8 @@ void FRepLayout::SendProperties(
 	const uint8* RESTRICT		Data,
 	UClass *					ObjectClass,
 	FNetBitWriter&				Writer,
-	TArray< uint16 > &			Changed ) const
+	TArray< uint16 > &			Changed,
+	bool&						bOutCanShare ) const
 {
 #ifdef ENABLE_PROPERTY_CHECKSUMS
 	const bool bDoChecksum = CVarDoPropertyChecksum.GetValueOnAnyThread() == 1;
@@ -1299,6 +1609,11 @@ void FRepLayout::SendProperties(
 	const bool bDoChecksum = false;
 #endif
 
+	if ( bDoChecksum )
+	{
+		bOutCanShare = false;
+	}
+
 	FBitWriterMark Mark( Writer );
 
 #ifdef ENABLE_PROPERTY_CHECKSUMS
@@ -1310,7 +1625,7 @@ void FRepLayout::SendProperties(
 	FChangelistIterator ChangelistIterator( Changed, 0 );
 	FRepHandleIterator HandleIterator( ChangelistIterator, Cmds, BaseHandleToCmdIndex, 0, 1, 0, Cmds.Num() - 1 );
 
-	SendProperties_r( RepState, ChangedTracker, Writer, bDoChecksum, HandleIterator, Data );
+	SendProperties_r( RepState, ChangedTracker, Writer, bDoChecksum, HandleIterator, Data, bOutCanShare );
 
 	if ( NumBits != Writer.GetNumBits() )
 	{
@@ -1628,7 +1943,8 @@ static bool ReceivePropertyHelper(
 	const TArray< FRepLayoutCmd >&	Cmds,
 	const int32						CmdIndex,
 	const bool						bDoChecksum,
-	bool&							bOutGuidsChanged )
+	bool&							bOutGuidsChanged,
+	FRepState* RESTRICT				MovementRepState = nullptr )
 {
 	const FRepLayoutCmd& Cmd	= Cmds[CmdIndex];
 	const FRepParentCmd& Parent = Parents[Cmd.ParentIndex];
@@ -1651,7 +1967,14 @@ static bool ReceivePropertyHelper(
 		StoreProperty( Cmd, ShadowData + Cmd.Offset, Data + SwappedCmd.Offset );
 
 		// Read the property
-		Cmd.Property->NetSerializeItem( Bunch, Bunch.PackageMap, Data + SwappedCmd.Offset );
+		if ( MovementRepState != nullptr && Cmd.Type == REPCMD_RepMovement )
+		{
+			ReceiveRepMovement( Bunch, MovementRepState->MovementDeltaHistories.FindOrAdd( CmdIndex ), Cmd, Data + SwappedCmd.Offset );
+		}
+		else
+		{
+			Cmd.Property->NetSerializeItem( Bunch, Bunch.PackageMap, Data + SwappedCmd.Offset );
+		}
 
 		// Check to see if this property changed
 		if ( Parent.RepNotifyCondition == REPNOTIFY_Always || !PropertiesAreIdentical( Cmd, ShadowData + Cmd.Offset, Data + SwappedCmd.Offset ) )
@@ -1663,6 +1986,10 @@ static bool ReceivePropertyHelper(
 			UE_CLOG( LogSkippedRepNotifies > 0, LogRep, Display, TEXT( "2 FReceivedPropertiesStackState Skipping RepNotify for propery %s because local value has not changed." ), *Cmd.Property->GetName() );
 		}
 	}
+	else if ( MovementRepState != nullptr && Cmd.Type == REPCMD_RepMovement )
+	{
+		ReceiveRepMovement( Bunch, MovementRepState->MovementDeltaHistories.FindOrAdd( CmdIndex ), Cmd, Data + SwappedCmd.Offset );
+	}
 	else
 	{
 		Cmd.Property->NetSerializeItem( Bunch, Bunch.PackageMap, Data + SwappedCmd.Offset );
@@ -1812,7 +2139,8 @@ public:
 		RepState( InRepState ),
 		bDoChecksum( bInDoChecksum ),
 		bHasUnmapped( false ),
-		bDoRepNotify( bInDoRepNotify )
+		bDoRepNotify( bInDoRepNotify ),
+		ArrayDepth( 0 )
 	{}
 
 	void ReadNextHandle()
@@ -1878,7 +2206,9 @@ public:
 		CurrentHandle = 0;
 
 		// Loop over array
+		ArrayDepth++;
 		ProcessDataArrayElements_r( StackState, Cmd );
+		ArrayDepth--;
 
 		// Restore the current handle to what it was before we processed this array
 		CurrentHandle = OldHandle;
@@ -1894,7 +2224,8 @@ public:
 
 		const int32 ElementOffset = ( Data - StackState.BaseData );
 
-		if ( ReceivePropertyHelper( Bunch, StackState.GuidReferencesMap, ElementOffset, ShadowData, Data, bDoRepNotify ? &RepState->RepNotifies : nullptr, Parents, Cmds, CmdIndex, bDoChecksum, bGuidsChanged ) )
+		// Only top level movement is delta compressed, see FRepLayout::SendRepMovement
+		if ( ReceivePropertyHelper( Bunch, StackState.GuidReferencesMap, ElementOffset, ShadowData, Data, bDoRepNotify ? &RepState->RepNotifies : nullptr, Parents, Cmds, CmdIndex, bDoChecksum, bGuidsChanged, ArrayDepth == 0 ? RepState : nullptr ) )
 		{
 			bHasUnmapped = true;
 		}
@@ -1911,6 +2242,7 @@ public:
 	bool					bHasUnmapped;
 	bool					bDoRepNotify;
 	bool					bGuidsChanged;
+	int32					ArrayDepth;
 };
 
 bool FRepLayout::ReceiveProperties( UActorChannel* OwningChannel, UClass * InObjectClass, FRepState * RESTRICT RepState, void* RESTRICT Data, FNetBitReader & InBunch, bool & bOutHasUnmapped, const bool bEnableRepNotifies, bool& bOutGuidsChanged ) const
@@ -2960,6 +3292,7 @@ void FRepLayout::InitFromObjectClass( UClass * InObjectClass )
 {
 	RoleIndex				= -1;
 	RemoteRoleIndex			= -1;
+	bHasPushModelProperties	= false;
 	FirstNonCustomParent	= -1;
 
 	int32 RelativeHandle	= 0;
@@ -3069,6 +3402,13 @@ void FRepLayout::InitFromObjectClass( UClass * InObjectClass )
 		{
 			Parents[LifetimeProps[i].RepIndex].Flags &= ~PARENT_IsConditional;
 		}			
+
+		// Role is swapped per connection, so it's always compared
+		if ( LifetimeProps[i].bIsPushBased && LifetimeProps[i].RepIndex != RoleIndex )
+		{
+			Parents[LifetimeProps[i].RepIndex].Flags |= PARENT_IsPushBased;
+			bHasPushModelProperties = true;
+		}
 	}
 
 	BuildHandleToCmdIndexTable_r( 0, Cmds.Num() - 1, BaseHandleToCmdIndex );
@@ -194,12 +194,23 @@ static TAutoConsoleVariable<int32> CVarUseParallelGetDynamicMeshElementsTasks(
 	TEXT("If > 0, and if FApp::ShouldUseThreadingForPerformance(), then parts of GetDynamicMeshElements will be done in parallel."));
 
 FMeshElementCollector::FMeshElementCollector() :
+	OwnedMemStack(nullptr),
 	PrimitiveSceneProxy(NULL),
 	FeatureLevel(ERHIFeatureLevel::Num),
 	bUseAsyncTasks(FApp::ShouldUseThreadingForPerformance() && CVarUseParallelGetDynamicMeshElementsTasks.GetValueOnAnyThread() > 0)
 {	
 }
 
+FMeshElementCollector::FMeshElementCollector(FTaskThreadCollector) :
+	// No marks, the allocations last until the collector is deleted at the end of the frame
+	OwnedMemStack(new FMemStackBase(0)),
+	PrimitiveSceneProxy(NULL),
+	FeatureLevel(ERHIFeatureLevel::Num),
+	// Tasks are already running in parallel, and AddTask allocates from the task thread's FMemStack
+	bUseAsyncTasks(false)
+{
+}
+
 
 void FMeshElementCollector::ProcessTasks()
 {
@@ -1,6 +1,10 @@
 // Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
 
 #include "SceneUtils.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "RenderingThread.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogSceneUtils,All,All);
 
@@ -29,6 +33,25 @@ static TAutoConsoleVariable<int> CVarGPUStatsMaxQueriesPerFrame(
 
 DECLARE_FLOAT_COUNTER_STAT(TEXT("[TOTAL]"), Stat_GPU_Total, STATGROUP_GPU);
 
+static void ToggleGPUStatsCapture()
+{
+	static bool bCapturing = FParse::Param(FCommandLine::Get(), TEXT("GPUStatsCapture"));
+	bCapturing = !bCapturing;
+
+	const bool bEnabled = bCapturing;
+	ENQUEUE_RENDER_COMMAND(SetGPUStatsCapture)(
+		[bEnabled](FRHICommandListImmediate& RHICmdList)
+		{
+			FRealtimeGPUProfiler::Get()->SetCaptureEnabled(bEnabled);
+		});
+}
+
+static FAutoConsoleCommand GPUStatsCaptureCmd(
+	TEXT("r.GPUStatsCapture"),
+	TEXT("Starts or stops recording the GPU stats of every frame. When stopped, the recording is written to the profiling directory as CSV and Chrome trace.\n")
+	TEXT("Launching with -GPUStatsCapture starts recording right away, the recording is then written on exit."),
+	FConsoleCommandDelegate::CreateStatic(&ToggleGPUStatsCapture));
+
 #endif //HAS_GPU_STATS
 
 
@@ -251,6 +274,21 @@ public:
 		return StatName;
 	}
 
+	uint64 GetStartResultMicroseconds() const
+	{
+		return StartResultMicroseconds;
+	}
+
+	uint64 GetEndResultMicroseconds() const
+	{
+		return EndResultMicroseconds;
+	}
+
+	uint32 GetFrameNumber() const
+	{
+		return FrameNumber;
+	}
+
 private:
 	FRenderQueryRHIRef StartQuery;
 	FRenderQueryRHIRef EndQuery;
@@ -264,6 +302,156 @@ private:
 	bool bEndQueryInFlight;
 };
 
+/*-----------------------------------------------------------------------------
+FRealtimeGPUProfilerCapture class
+GPU stats of consecutive frames, recorded for r.GPUStatsCapture
+-----------------------------------------------------------------------------*/
+class FRealtimeGPUProfilerCapture
+{
+public:
+	FRealtimeGPUProfilerCapture()
+		: FirstTimestamp(FRealtimeGPUProfilerEvent::InvalidQueryResult)
+	{}
+
+	void AddFrame(const TArray<FRealtimeGPUProfilerEvent*>& Events)
+	{
+		if (Events.Num() == 0)
+		{
+			return;
+		}
+
+		FFrame& Frame = Frames[Frames.AddDefaulted()];
+		Frame.FrameNumber = Events[0]->GetFrameNumber();
+		for (const FRealtimeGPUProfilerEvent* Event : Events)
+		{
+			const int32 StatIndex = StatNames.AddUnique(Event->GetStatName());
+			if (StatIndex >= Frame.StatMS.Num())
+			{
+				Frame.StatMS.AddZeroed(StatIndex + 1 - Frame.StatMS.Num());
+			}
+			Frame.StatMS[StatIndex] += Event->GetResultMS();
+
+			// Events without queries report zero for both timestamps
+			if (Event->HasQueriesAllocated() && Event->GetEndResultMicroseconds() >= Event->GetStartResultMicroseconds())
+			{
+				FInterval Interval;
+				Interval.StatIndex = StatIndex;
+				Interval.StartMicroseconds = Event->GetStartResultMicroseconds();
+				Interval.EndMicroseconds = Event->GetEndResultMicroseconds();
+				Frame.Intervals.Add(Interval);
+				FirstTimestamp = FMath::Min(FirstTimestamp, Interval.StartMicroseconds);
+			}
+		}
+	}
+
+	void Write() const
+	{
+		if (Frames.Num() == 0)
+		{
+			UE_LOG(LogSceneUtils, Display, TEXT("GPU stats capture ended without any frames"));
+			return;
+		}
+
+		TArray<FString> StatDescriptions;
+		for (const FName& StatName : StatNames)
+		{
+			StatDescriptions.Add(FStatNameAndInfo::GetShortNameFrom(StatName).ToString());
+			const FString Description = FStatNameAndInfo::GetDescriptionFrom(StatName);
+			if (!Description.IsEmpty())
+			{
+				StatDescriptions.Last() = Description;
+			}
+		}
+
+		const FString BaseFilename = FPaths::ProfilingDir() / FString::Printf(TEXT("GPUStats-%s"), *FDateTime::Now().ToString());
+		const FString CsvFilename = BaseFilename + TEXT(".csv");
+		const FString TraceFilename = BaseFilename + TEXT(".json");
+
+		// One row per frame, one column per stat in milliseconds
+		FString Csv(TEXT("Frame,Total"));
+		for (const FString& Description : StatDescriptions)
+		{
+			Csv += TEXT(",");
+			Csv += Description;
+		}
+		Csv += LINE_TERMINATOR;
+
+		for (const FFrame& Frame : Frames)
+		{
+			float TotalMS = 0.0f;
+			for (float StatMS : Frame.StatMS)
+			{
+				TotalMS += StatMS;
+			}
+
+			Csv += FString::Printf(TEXT("%u,%.3f"), Frame.FrameNumber, TotalMS);
+			for (int32 StatIndex = 0; StatIndex < StatNames.Num(); StatIndex++)
+			{
+				Csv += FString::Printf(TEXT(",%.3f"), Frame.StatMS.IsValidIndex(StatIndex) ? Frame.StatMS[StatIndex] : 0.0f);
+			}
+			Csv += LINE_TERMINATOR;
+		}
+
+		// Passes on one track and frames spanning their passes on another, timestamps are relative to the first pass
+		const uint32 PassTrackId = 0;
+		const uint32 FrameTrackId = 1;
+		FString Trace(TEXT("{\"traceEvents\":[\n"));
+		Trace += FString::Printf(TEXT("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,\"args\":{\"name\":\"GPU\"}}"), PassTrackId);
+		Trace += FString::Printf(TEXT(",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,\"args\":{\"name\":\"GPU Frames\"}}"), FrameTrackId);
+
+		for (const FFrame& Frame : Frames)
+		{
+			if (Frame.Intervals.Num() == 0)
+			{
+				continue;
+			}
+
+			uint64 FrameStart = Frame.Intervals[0].StartMicroseconds;
+			uint64 FrameEnd = Frame.Intervals[0].EndMicroseconds;
+			for (const FInterval& Interval : Frame.Intervals)
+			{
+				Trace += FString::Printf(TEXT(",\n{\"name\":\"%s\",\"cat\":\"GPUStat\",\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%llu,\"dur\":%llu}"),
+					*StatDescriptions[Interval.StatIndex].ReplaceCharWithEscapedChar(), PassTrackId, Interval.StartMicroseconds - FirstTimestamp, Interval.EndMicroseconds - Interval.StartMicroseconds);
+				FrameStart = FMath::Min(FrameStart, Interval.StartMicroseconds);
+				FrameEnd = FMath::Max(FrameEnd, Interval.EndMicroseconds);
+			}
+
+			Trace += FString::Printf(TEXT(",\n{\"name\":\"Frame %u\",\"cat\":\"GPUFrame\",\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%llu,\"dur\":%llu}"),
+				Frame.FrameNumber, FrameTrackId, FrameStart - FirstTimestamp, FrameEnd - FrameStart);
+		}
+		Trace += TEXT("\n]}\n");
+
+		if (FFileHelper::SaveStringToFile(Csv, *CsvFilename) && FFileHelper::SaveStringToFile(Trace, *TraceFilename))
+		{
+			UE_LOG(LogSceneUtils, Display, TEXT("Wrote GPU stats of %d frames to %s and %s"), Frames.Num(), *FPaths::ConvertRelativePathToFull(CsvFilename), *FPaths::ConvertRelativePathToFull(TraceFilename));
+		}
+		else
+		{
+			UE_LOG(LogSceneUtils, Warning, TEXT("Failed to write GPU stats capture to %s"), *BaseFilename);
+		}
+	}
+
+private:
+	struct FInterval
+	{
+		int32 StatIndex;
+		uint64 StartMicroseconds;
+		uint64 EndMicroseconds;
+	};
+
+	struct FFrame
+	{
+		uint32 FrameNumber;
+		/** Summed time of each stat in StatNames */
+		TArray<float> StatMS;
+		TArray<FInterval> Intervals;
+	};
+
+	TArray<FName> StatNames;
+	TArray<FFrame> Frames;
+	uint64 FirstTimestamp;
+};
+
 /*-----------------------------------------------------------------------------
 FRealtimeGPUProfilerFrame class
 Container for a single frame's GPU stats
@@ -333,7 +521,7 @@ public:
 		GpuProfilerEvents.Empty();
 	}
 
-	bool UpdateStats(FRHICommandListImmediate& RHICmdList)
+	bool UpdateStats(FRHICommandListImmediate& RHICmdList, FRealtimeGPUProfilerCapture* Capture)
 	{
 		// Gather any remaining results and check all the results are ready
 		bool bAllQueriesAllocated = true;
@@ -395,6 +583,11 @@ public:
 		}
 
 		FThreadStats::AddMessage( GET_STATFNAME(Stat_GPU_Total), EStatOperation::Set, double(TotalMS) );
+
+		if (Capture)
+		{
+			Capture->AddFrame(GpuProfilerEvents);
+		}
 		return true;
 	}
 
@@ -431,6 +624,7 @@ FRealtimeGPUProfiler::FRealtimeGPUProfiler()
 	: WriteBufferIndex(0)
 	, ReadBufferIndex(1) 
 	, WriteFrameNumber(-1)
+	, Capture(nullptr)
 	, bStatGatheringPaused(false)
 	, bInBeginEndBlock(false)
 {
@@ -439,6 +633,11 @@ FRealtimeGPUProfiler::FRealtimeGPUProfiler()
 	{
 		Frames.Add(new FRealtimeGPUProfilerFrame(RenderQueryPool));
 	}
+
+	if (FParse::Param(FCommandLine::Get(), TEXT("GPUStatsCapture")))
+	{
+		Capture = new FRealtimeGPUProfilerCapture;
+	}
 }
 
 void FRealtimeGPUProfiler::Release()
@@ -450,6 +649,26 @@ void FRealtimeGPUProfiler::Release()
 	Frames.Empty();
 	delete RenderQueryPool;
 	RenderQueryPool = nullptr;
+
+	SetCaptureEnabled(false);
+}
+
+void FRealtimeGPUProfiler::SetCaptureEnabled(bool bEnabled)
+{
+	if (bEnabled && !Capture)
+	{
+		if (GSupportsTimestampRenderQueries == false || !CVarGPUStatsEnabled.GetValueOnAnyThread())
+		{
+			UE_LOG(LogSceneUtils, Warning, TEXT("GPU stats are not available, r.GPUStatsCapture will not record anything"));
+		}
+		Capture = new FRealtimeGPUProfilerCapture;
+	}
+	else if (!bEnabled && Capture)
+	{
+		Capture->Write();
+		delete Capture;
+		Capture = nullptr;
+	}
 }
 
 void FRealtimeGPUProfiler::BeginFrame(FRHICommandListImmediate& RHICmdList)
@@ -472,7 +691,7 @@ void FRealtimeGPUProfiler::EndFrame(FRHICommandListImmediate& RHICmdList)
 		return;
 	}
 
-	if (Frames[ReadBufferIndex]->UpdateStats(RHICmdList))
+	if (Frames[ReadBufferIndex]->UpdateStats(RHICmdList, Capture))
 	{
 		// On a successful read, advance the ReadBufferIndex and WriteBufferIndex and clear the frame we just read
 		Frames[ReadBufferIndex]->Clear(&RHICmdList);
@@ -74,7 +74,7 @@ FString GetMaterialShaderMapDDCKey()
 }
 
 // this is for the protocol, not the data, bump if FShaderCompilerInput or ProcessInputFromArchive changes (also search for the second one with the same name, todo: put into one header file)
-const int32 ShaderCompileWorkerInputVersion = 7;
+const int32 ShaderCompileWorkerInputVersion = 8;
 // this is for the protocol, not the data, bump if FShaderCompilerOutput or WriteToOutputArchive changes (also search for the second one with the same name, todo: put into one header file)
 const int32 ShaderCompileWorkerOutputVersion = 3;
 // this is for the protocol, not the data, bump if FShaderCompilerOutput or WriteToOutputArchive changes (also search for the second one with the same name, todo: put into one header file)
@@ -174,6 +174,14 @@ static TAutoConsoleVariable<int32> CVarShaderBoundsChecking(
 	TEXT("Whether to enforce bounds-checking & flush-to-zero/ignore for buffer reads & writes in shaders. Defaults to 1 (enabled). Not all shader languages can omit bounds checking."),
 	ECVF_ReadOnly);
 
+static TAutoConsoleVariable<int32> CVarShaderPreprocessedOutputCache(
+	TEXT("r.Shaders.PreprocessedOutputCache"),
+	1,
+	TEXT("Whether the shader compile workers reuse the output of an earlier compile whose preprocessed source and compiler settings match,\n")
+	TEXT("so that editing a common shader include only recompiles the permutations it actually changed. Stored in Engine/Intermediate/ShaderOutputCache.\n")
+	TEXT("Only implemented by the D3D shader formats."),
+	ECVF_ReadOnly);
+
 static TAutoConsoleVariable<int32> CVarD3DRemoveUnusedInterpolators(
 	TEXT("r.D3D.RemoveUnusedInterpolators"),
 	1,
@@ -420,6 +428,50 @@ static bool DoWriteTasks(const TArray<FShaderCommonCompileJob*>& QueuedJobs, FAr
 	TArray<FShaderPipelineCompileJob*> QueuedPipelineJobs;
 	SplitJobsByType(QueuedJobs, QueuedSingleJobs, QueuedPipelineJobs);
 
+	// The jobs of a batch mostly come from the same materials and vertex factories, so their shared environments are written
+	// once up front and the jobs reference them by index, instead of each job inlining a copy
+	TArray<FShaderCompilerEnvironment*> SharedEnvironments;
+	TMap<FShaderCompilerEnvironment*, int32> SharedEnvironmentIndices;
+	auto AddSharedEnvironment = [&SharedEnvironments, &SharedEnvironmentIndices](const FShaderCompilerInput& Input)
+	{
+		if (IsValidRef(Input.SharedEnvironment) && !SharedEnvironmentIndices.Contains(Input.SharedEnvironment.GetReference()))
+		{
+			SharedEnvironmentIndices.Add(Input.SharedEnvironment.GetReference(), SharedEnvironments.Add(Input.SharedEnvironment.GetReference()));
+		}
+	};
+
+	for (FShaderCompileJob* SingleJob : QueuedSingleJobs)
+	{
+		AddSharedEnvironment(SingleJob->Input);
+	}
+
+	for (FShaderPipelineCompileJob* PipelineJob : QueuedPipelineJobs)
+	{
+		for (FShaderCommonCompileJob* StageJob : PipelineJob->StageJobs)
+		{
+			AddSharedEnvironment(StageJob->GetSingleShaderJob()->Input);
+		}
+	}
+
+	auto WriteInput = [&TransferFile, &SharedEnvironmentIndices](FShaderCompilerInput& Input)
+	{
+		Input.SerializeWithoutSharedEnvironment(TransferFile);
+
+		int32 SharedEnvironmentIndex = IsValidRef(Input.SharedEnvironment) ? SharedEnvironmentIndices.FindChecked(Input.SharedEnvironment.GetReference()) : INDEX_NONE;
+		TransferFile << SharedEnvironmentIndex;
+	};
+
+	// Write the shared environments
+	{
+		int32 NumSharedEnvironments = SharedEnvironments.Num();
+		TransferFile << NumSharedEnvironments;
+
+		for (FShaderCompilerEnvironment* SharedEnvironment : SharedEnvironments)
+		{
+			TransferFile << *SharedEnvironment;
+		}
+	}
+
 	// Write individual shader jobs
 	{
 		int32 SingleJobHeader = ShaderCompileWorkerSingleJobHeader;
@@ -431,7 +483,7 @@ static bool DoWriteTasks(const TArray<FShaderCommonCompileJob*>& QueuedJobs, FAr
 		// Serialize all the batched jobs
 		for (int32 JobIndex = 0; JobIndex < QueuedSingleJobs.Num(); JobIndex++)
 		{
-			TransferFile << QueuedSingleJobs[JobIndex]->Input;
+			WriteInput(QueuedSingleJobs[JobIndex]->Input);
 		}
 	}
 
@@ -451,7 +503,7 @@ static bool DoWriteTasks(const TArray<FShaderCommonCompileJob*>& QueuedJobs, FAr
 			TransferFile << NumStageJobs;
 			for (int32 Index = 0; Index < NumStageJobs; Index++)
 			{
-				TransferFile << PipelineJob->StageJobs[Index]->GetSingleShaderJob()->Input;
+				WriteInput(PipelineJob->StageJobs[Index]->GetSingleShaderJob()->Input);
 			}
 		}
 	}
@@ -1024,6 +1076,11 @@ void FShaderCompileThreadRunnable::WriteNewTasks()
 
 			const FString WorkingDirectory = Manager->AbsoluteShaderBaseWorkingDirectory + FString::FromInt(WorkerIndex);
 
+			// Serialize the jobs in memory first so the transfer file is written with a single call instead of many small buffered writes
+			TArray<uint8> TransferData;
+			FMemoryWriter TransferWriter(TransferData, true);
+			DoWriteTasks(CurrentWorkerInfo.QueuedJobs, TransferWriter);
+
 			// To make sure that the process waiting for input file won't try to read it until it's ready
 			// we use a temp file name during writing.
 			FString TransferFileName;
@@ -1061,7 +1118,8 @@ void FShaderCompileThreadRunnable::WriteNewTasks()
 			}
 			check(TransferFile);
 
-			if (!DoWriteTasks(CurrentWorkerInfo.QueuedJobs, *TransferFile))
+			TransferFile->Serialize(TransferData.GetData(), TransferData.Num());
+			if (!TransferFile->Close())
 			{
 				uint64 TotalDiskSpace = 0;
 				uint64 FreeDiskSpace = 0;
@@ -1178,17 +1236,14 @@ void FShaderCompileThreadRunnable::ReadAvailableResults()
 			// This is only a win if FileExists is faster than CreateFileReader, which it is on Windows
 			if (FPlatformFileManager::Get().GetPlatformFile().FileExists(*OutputFileNameAndPath))
 			{
-				FArchive* OutputFilePtr = IFileManager::Get().CreateFileReader(*OutputFileNameAndPath, FILEREAD_Silent);
-
-				if (OutputFilePtr)
+				// Read the whole file in one go and close it before deserializing the results
+				TArray<uint8> OutputData;
+				if (FFileHelper::LoadFileToArray(OutputData, *OutputFileNameAndPath, FILEREAD_Silent))
 				{
-					FArchive& OutputFile = *OutputFilePtr;
+					FMemoryReader OutputFile(OutputData, true);
 					check(!CurrentWorkerInfo.bComplete);
 					DoReadTaskResults(CurrentWorkerInfo.QueuedJobs, OutputFile);
 
-					// Close the output file.
-					delete OutputFilePtr;
-
 					// Delete the output file now that we have consumed it, to avoid reading stale data on the next compile loop.
 					bool bDeletedOutput = IFileManager::Get().Delete(*OutputFileNameAndPath, true, true);
 					int32 RetryCount = 0;
@@ -2715,6 +2770,11 @@ void GlobalBeginCompileShader(
 		}
 	}
 
+	if (CVarShaderPreprocessedOutputCache.GetValueOnAnyThread() != 0)
+	{
+		Input.Environment.CompilerFlags.Add(CFLAG_PreprocessedOutputCache);
+	}
+
 	if (IsD3DPlatform((EShaderPlatform)Target.Platform, false))
 	{
 		static const auto CVar = IConsoleManager::Get().FindConsoleVariable(TEXT("r.D3D.RemoveUnusedInterpolators"));
@@ -5,6 +5,7 @@
 =============================================================================*/
 
 #include "Engine/SkeletalMesh.h"
+#include "HAL/LowLevelMemTracker.h"
 #include "Serialization/CustomVersion.h"
 #include "UObject/FrameworkObjectVersion.h"
 #include "Misc/App.h"
@@ -2922,6 +2923,7 @@ bool USkeletalMesh::IsReadyForFinishDestroy()
 
 void USkeletalMesh::Serialize( FArchive& Ar )
 {
+	LLM_SCOPE(ELLMTag::Meshes);
 	DECLARE_SCOPE_CYCLE_COUNTER( TEXT("USkeletalMesh::Serialize"), STAT_SkeletalMesh_Serialize, STATGROUP_LoadTime );
 
 	Super::Serialize(Ar);
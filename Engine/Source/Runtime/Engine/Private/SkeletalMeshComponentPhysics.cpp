@@ -62,6 +62,12 @@ extern TAutoConsoleVariable<int32> CVarEnableClothPhysics;
 //This is the total cloth time split up among multiple computation (updating gpu, updating sim, etc...)
 DECLARE_CYCLE_STAT(TEXT("Cloth Total"), STAT_ClothTotalTime, STATGROUP_Physics);
 DECLARE_CYCLE_STAT(TEXT("Cloth Writeback"), STAT_ClothWriteback, STATGROUP_Physics);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Auto Disabled Cloth Components"), STAT_NumClothsAutoDisabled, STATGROUP_Physics);
+
+static TAutoConsoleVariable<float> CVarClothAutoDisableBlendTime(
+	TEXT("p.ClothAutoDisableBlendTime"),
+	0.5f,
+	TEXT("Seconds it takes clothing to blend to the skinned result when it's auto disabled by screen size or SetClothAutoDisabled, and back when it's enabled again."));
 
 void FSkeletalMeshComponentClothTickFunction::ExecuteTick(float DeltaTime, enum ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
 {
@@ -1792,7 +1798,7 @@ FVector USkeletalMeshComponent::GetSkinnedVertexPosition(int32 VertexIndex) cons
 		SkeletalMesh->MeshClothingAssets.Num() > 0 &&
 		MeshObject &&
 		!bDisableClothSimulation &&
-		ClothBlendWeight > 0.0f // if cloth blend weight is 0.0, only showing skinned vertices regardless of simulation positions
+		GetClothBlendWeight() > 0.0f // if cloth blend weight is 0.0, only showing skinned vertices regardless of simulation positions
 		)
 	{
 		FStaticLODModel& Model = MeshObject->GetSkeletalMeshResource().LODModels[0];
@@ -1848,11 +1854,12 @@ FVector USkeletalMeshComponent::GetSkinnedVertexPosition(int32 VertexIndex) cons
 				SimulatedPos = ComponentToWorld.InverseTransformPosition(SimulatedPos);
 
 				// if blend weight is 1.0, doesn't need to blend with a skinned position
-				if (ClothBlendWeight < 1.0f) 
+				const float BlendWeight = GetClothBlendWeight();
+				if (BlendWeight < 1.0f) 
 				{
 					// blend with a skinned position
 					FVector SkinnedPos = Super::GetSkinnedVertexPosition(VertexIndex);
-					SimulatedPos = SimulatedPos*ClothBlendWeight + SkinnedPos*(1.0f - ClothBlendWeight);
+					SimulatedPos = SimulatedPos*BlendWeight + SkinnedPos*(1.0f - BlendWeight);
 				}
 				return SimulatedPos;
 			}
@@ -2786,12 +2793,24 @@ void USkeletalMeshComponent::TickClothing(float DeltaTime, FTickFunction& ThisTi
 	// Use the component update flag to gate simulation to respect the always tick options
 	bool bShouldTick = ((MeshComponentUpdateFlag < EMeshComponentUpdateFlag::OnlyTickPoseWhenRendered) || bRecentlyRendered);
 
-	if (bShouldTick)
+	// Blend towards the skinned result while auto disabled, the simulation keeps running until that is all that's shown
+	const bool bAutoDisable = bClothAutoDisabled || (ClothMinScreenSize > 0.0f && MaxDistanceFactor < ClothMinScreenSize);
+	const float TargetBlendWeight = bAutoDisable ? 0.0f : 1.0f;
+	const float BlendTime = CVarClothAutoDisableBlendTime.GetValueOnGameThread();
+	ClothAutoDisableBlendWeight = BlendTime > 0.0f ? FMath::FInterpConstantTo(ClothAutoDisableBlendWeight, TargetBlendWeight, DeltaTime, 1.0f / BlendTime) : TargetBlendWeight;
+
+	if (bShouldTick && ClothAutoDisableBlendWeight > 0.0f)
 	{
 		UpdateClothStateAndSimulate(DeltaTime, ThisTickFunction);
 	}
 	else
 	{
+		if (bAutoDisable)
+		{
+			INC_DWORD_STAT(STAT_NumClothsAutoDisabled);
+		}
+
+		// Blending back in starts from the skinned pose
 		ForceClothNextUpdateTeleportAndReset();
 	}
 }
@@ -11,9 +11,18 @@
 #include "SkeletalRender.h"
 #include "Animation/MorphTarget.h"
 #include "GPUSkinVertexFactory.h"
+#include "Async/ParallelFor.h"
+#include "Misc/App.h"
 
 struct FMorphTargetDelta;
 
+static TAutoConsoleVariable<int32> CVarCPUSkinVerticesPerTask(
+	TEXT("r.CPUSkin.VerticesPerTask"),
+	2048,
+	TEXT("Number of vertices skinned by each parallel task when CPU skinning a mesh without active morph targets.\n")
+	TEXT("0 skins all vertices on the calling thread."),
+	ECVF_RenderThreadSafe);
+
 template<typename VertexType>
 static void SkinVertices(FFinalSkinVertex* DestVertex, FMatrix* ReferenceToLocal, int32 LODIndex, FStaticLODModel& LOD, FSkinWeightVertexBuffer& WeightBuffer, TArray<FActiveMorphTarget>& ActiveMorphTargets, TArray<float>& MorphTargetWeights, const TMap<int32, FClothSimulData>& ClothSimulUpdateData, float ClothBlendWeight, const FMatrix& WorldToLocal);
 
@@ -659,6 +668,7 @@ static void SkinVertexSection(
 	const FStaticLODModel &LOD,
 	FSkinWeightVertexBuffer& WeightBuffer,
 	int32 VertexBufferBaseIndex, 
+	int32 VertexBufferEndIndex, 
 	uint32 NumValidMorphs, 
 	int32 &CurBaseVertIdx, 
 	int32 LODIndex, 
@@ -681,19 +691,19 @@ static void SkinVertexSection(
 	const FVector MeshExtension = LOD.VertexBufferGPUSkin.GetMeshExtension();
 	const FVector MeshOrigin = LOD.VertexBufferGPUSkin.GetMeshOrigin();
 	const bool bLODUsesCloth = LOD.HasClothData() && ClothSimData != nullptr && ClothBlendWeight > 0.0f;
-	const int32 NumSoftVertices = Section.GetNumVertices();
+	const int32 NumSoftVertices = VertexBufferEndIndex - VertexBufferBaseIndex;
 	if (NumSoftVertices > 0)
 	{
 		INC_DWORD_STAT_BY(STAT_CPUSkinVertices,NumSoftVertices);
 
 		// Prefetch first vertex
-		FPlatformMisc::Prefetch( LOD.VertexBufferGPUSkin.GetVertexPtr(Section.GetVertexBufferIndex()) );
+		FPlatformMisc::Prefetch( LOD.VertexBufferGPUSkin.GetVertexPtr(Section.GetVertexBufferIndex() + VertexBufferBaseIndex) );
 		if (bLODUsesCloth)
 		{
-			FPlatformMisc::Prefetch(&LOD.ClothVertexBuffer.MappingData(Section.GetVertexBufferIndex()));
+			FPlatformMisc::Prefetch(&LOD.ClothVertexBuffer.MappingData(Section.GetVertexBufferIndex() + VertexBufferBaseIndex));
 		}
 
-		for(int32 VertexIndex = VertexBufferBaseIndex;VertexIndex < NumSoftVertices;VertexIndex++,DestVertex++)
+		for(int32 VertexIndex = VertexBufferBaseIndex;VertexIndex < VertexBufferEndIndex;VertexIndex++,DestVertex++)
 		{
 			const int32 VertexBufferIndex = Section.GetVertexBufferIndex() + VertexIndex;
 			SrcSoftVertex = (VertexType*)LOD.VertexBufferGPUSkin.GetVertexPtr(VertexBufferIndex);
@@ -718,7 +728,7 @@ static void SkinVertexSection(
 			const uint8* RESTRICT BoneIndices = SrcWeights->InfluenceBones;
 			const uint8* RESTRICT BoneWeights = SrcWeights->InfluenceWeights;
 
-			static VectorRegister	SrcNormals[3];
+			VectorRegister			SrcNormals[3];
 			VectorRegister			DstNormals[3];
 			const FVector VertexPosition = LOD.VertexBufferGPUSkin.GetVertexPositionFast((const TGPUSkinVertexBase*)MorphedVertex);
 			SrcNormals[0] = VectorLoadFloat3_W1( &VertexPosition );
@@ -925,6 +935,7 @@ static void SkinVertexSection(
 	const FStaticLODModel &LOD, 
 	FSkinWeightVertexBuffer& WeightBuffer,
 	int32 VertexBufferBaseIndex, 
+	int32 VertexBufferEndIndex, 
 	uint32 NumValidMorphs, 
 	int32 &CurBaseVertIdx, 
 	int32 LODIndex, 
@@ -936,14 +947,14 @@ static void SkinVertexSection(
 {
 	switch (Section.MaxBoneInfluences)
 	{
-		case 1: SkinVertexSection<bExtraBoneInfluences, 1, VertexType>(DestVertex, MorphEvalInfos, MorphWeights, Section, LOD, WeightBuffer, VertexBufferBaseIndex, NumValidMorphs, CurBaseVertIdx, LODIndex, RigidInfluenceIndex, ReferenceToLocal, ClothSimData, ClothBlendWeight, WorldToLocal); break;
-		case 2: SkinVertexSection<bExtraBoneInfluences, 2, VertexType>(DestVertex, MorphEvalInfos, MorphWeights, Section, LOD, WeightBuffer, VertexBufferBaseIndex, NumValidMorphs, CurBaseVertIdx, LODIndex, RigidInfluenceIndex, ReferenceToLocal, ClothSimData, ClothBlendWeight, WorldToLocal); break;
-		case 3: SkinVertexSection<bExtraBoneInfluences, 3, VertexType>(DestVertex, MorphEvalInfos, MorphWeights, Section, LOD, WeightBuffer, VertexBufferBaseIndex, NumValidMorphs, CurBaseVertIdx, LODIndex, RigidInfluenceIndex, ReferenceToLocal, ClothSimData, ClothBlendWeight, WorldToLocal); break;
-		case 4: SkinVertexSection<bExtraBoneInfluences, 4, VertexType>(DestVertex, MorphEvalInfos, MorphWeights, Section, LOD, WeightBuffer, VertexBufferBaseIndex, NumValidMorphs, CurBaseVertIdx, LODIndex, RigidInfluenceIndex, ReferenceToLocal, ClothSimData, ClothBlendWeight, WorldToLocal); break;
-		case 5: SkinVertexSection<bExtraBoneInfluences, 5, VertexType>(DestVertex, MorphEvalInfos, MorphWeights, Section, LOD, WeightBuffer, VertexBufferBaseIndex, NumValidMorphs, CurBaseVertIdx, LODIndex, RigidInfluenceIndex, ReferenceToLocal, ClothSimData, ClothBlendWeight, WorldToLocal); break;
-		case 6: SkinVertexSection<bExtraBoneInfluences, 6, VertexType>(DestVertex, MorphEvalInfos, MorphWeights, Section, LOD, WeightBuffer, VertexBufferBaseIndex, NumValidMorphs, CurBaseVertIdx, LODIndex, RigidInfluenceIndex, ReferenceToLocal, ClothSimData, ClothBlendWeight, WorldToLocal); break;
-		case 7: SkinVertexSection<bExtraBoneInfluences, 7, VertexType>(DestVertex, MorphEvalInfos, MorphWeights, Section, LOD, WeightBuffer, VertexBufferBaseIndex, NumValidMorphs, CurBaseVertIdx, LODIndex, RigidInfluenceIndex, ReferenceToLocal, ClothSimData, ClothBlendWeight, WorldToLocal); break;
-		case 8: SkinVertexSection<bExtraBoneInfluences, 8, VertexType>(DestVertex, MorphEvalInfos, MorphWeights, Section, LOD, WeightBuffer, VertexBufferBaseIndex, NumValidMorphs, CurBaseVertIdx, LODIndex, RigidInfluenceIndex, ReferenceToLocal, ClothSimData, ClothBlendWeight, WorldToLocal); break;
+		case 1: SkinVertexSection<bExtraBoneInfluences, 1, VertexType>(DestVertex, MorphEvalInfos, MorphWeights, Section, LOD, WeightBuffer, VertexBufferBaseIndex, VertexBufferEndIndex, NumValidMorphs, CurBaseVertIdx, LODIndex, RigidInfluenceIndex, ReferenceToLocal, ClothSimData, ClothBlendWeight, WorldToLocal); break;
+		case 2: SkinVertexSection<bExtraBoneInfluences, 2, VertexType>(DestVertex, MorphEvalInfos, MorphWeights, Section, LOD, WeightBuffer, VertexBufferBaseIndex, VertexBufferEndIndex, NumValidMorphs, CurBaseVertIdx, LODIndex, RigidInfluenceIndex, ReferenceToLocal, ClothSimData, ClothBlendWeight, WorldToLocal); break;
+		case 3: SkinVertexSection<bExtraBoneInfluences, 3, VertexType>(DestVertex, MorphEvalInfos, MorphWeights, Section, LOD, WeightBuffer, VertexBufferBaseIndex, VertexBufferEndIndex, NumValidMorphs, CurBaseVertIdx, LODIndex, RigidInfluenceIndex, ReferenceToLocal, ClothSimData, ClothBlendWeight, WorldToLocal); break;
+		case 4: SkinVertexSection<bExtraBoneInfluences, 4, VertexType>(DestVertex, MorphEvalInfos, MorphWeights, Section, LOD, WeightBuffer, VertexBufferBaseIndex, VertexBufferEndIndex, NumValidMorphs, CurBaseVertIdx, LODIndex, RigidInfluenceIndex, ReferenceToLocal, ClothSimData, ClothBlendWeight, WorldToLocal); break;
+		case 5: SkinVertexSection<bExtraBoneInfluences, 5, VertexType>(DestVertex, MorphEvalInfos, MorphWeights, Section, LOD, WeightBuffer, VertexBufferBaseIndex, VertexBufferEndIndex, NumValidMorphs, CurBaseVertIdx, LODIndex, RigidInfluenceIndex, ReferenceToLocal, ClothSimData, ClothBlendWeight, WorldToLocal); break;
+		case 6: SkinVertexSection<bExtraBoneInfluences, 6, VertexType>(DestVertex, MorphEvalInfos, MorphWeights, Section, LOD, WeightBuffer, VertexBufferBaseIndex, VertexBufferEndIndex, NumValidMorphs, CurBaseVertIdx, LODIndex, RigidInfluenceIndex, ReferenceToLocal, ClothSimData, ClothBlendWeight, WorldToLocal); break;
+		case 7: SkinVertexSection<bExtraBoneInfluences, 7, VertexType>(DestVertex, MorphEvalInfos, MorphWeights, Section, LOD, WeightBuffer, VertexBufferBaseIndex, VertexBufferEndIndex, NumValidMorphs, CurBaseVertIdx, LODIndex, RigidInfluenceIndex, ReferenceToLocal, ClothSimData, ClothBlendWeight, WorldToLocal); break;
+		case 8: SkinVertexSection<bExtraBoneInfluences, 8, VertexType>(DestVertex, MorphEvalInfos, MorphWeights, Section, LOD, WeightBuffer, VertexBufferBaseIndex, VertexBufferEndIndex, NumValidMorphs, CurBaseVertIdx, LODIndex, RigidInfluenceIndex, ReferenceToLocal, ClothSimData, ClothBlendWeight, WorldToLocal); break;
 		default: check(0);
 	}
 }
@@ -977,24 +988,83 @@ static void SkinVertices(
 		FPlatformMisc::Prefetch( ReferenceToLocal + MatrixIndex );
 	}
 
-	int32 CurBaseVertIdx = 0;
-
 	const int32 RigidInfluenceIndex = SkinningTools::GetRigidInfluenceIndex();
-	int32 VertexBufferBaseIndex=0;
+	const bool bExtraBoneInfluences = LOD.DoSectionsNeedExtraBoneInfluences();
+	const int32 VerticesPerTask = CVarCPUSkinVerticesPerTask.GetValueOnAnyThread();
 
-	for(int32 SectionIndex= 0;SectionIndex< LOD.Sections.Num();SectionIndex++)
+	// Morph targets are applied by walking their sorted deltas along with the vertices, so only meshes without them can be split up
+	if (NumValidMorphs == 0 && VerticesPerTask > 0 && (int32)LOD.NumVertices > VerticesPerTask && FApp::ShouldUseThreadingForPerformance())
 	{
-		FSkelMeshSection& Section = LOD.Sections[SectionIndex];
-
-		const FClothSimulData* ClothSimData = ClothSimulUpdateData.Find(Section.CorrespondClothAssetIndex);
-
-		if (LOD.DoSectionsNeedExtraBoneInfluences())
+		struct FSkinTask
+		{
+			int32 SectionIndex;
+			int32 VertexBufferBaseIndex;
+			int32 VertexBufferEndIndex;
+			FFinalSkinVertex* DestVertex;
+		};
+
+		TArray<FSkinTask, TInlineAllocator<32>> Tasks;
+		FFinalSkinVertex* SectionDestVertex = DestVertex;
+		for (int32 SectionIndex = 0; SectionIndex < LOD.Sections.Num(); SectionIndex++)
 		{
-			SkinVertexSection<true, VertexType>(DestVertex, MorphEvalInfos, MorphTargetWeights, Section, LOD, WeightBuffer, VertexBufferBaseIndex, NumValidMorphs, CurBaseVertIdx, LODIndex, RigidInfluenceIndex, ReferenceToLocal, ClothSimData, ClothBlendWeight, WorldToLocal);
+			const int32 NumSectionVertices = LOD.Sections[SectionIndex].GetNumVertices();
+			for (int32 FirstVertex = 0; FirstVertex < NumSectionVertices; FirstVertex += VerticesPerTask)
+			{
+				FSkinTask& Task = Tasks[Tasks.AddUninitialized()];
+				Task.SectionIndex = SectionIndex;
+				Task.VertexBufferBaseIndex = FirstVertex;
+				Task.VertexBufferEndIndex = FMath::Min(FirstVertex + VerticesPerTask, NumSectionVertices);
+				Task.DestVertex = SectionDestVertex + FirstVertex;
+			}
+			SectionDestVertex += NumSectionVertices;
 		}
-		else
+
+		ParallelFor(Tasks.Num(), [&](int32 TaskIndex)
 		{
-			SkinVertexSection<false, VertexType>(DestVertex, MorphEvalInfos, MorphTargetWeights, Section, LOD, WeightBuffer, VertexBufferBaseIndex, NumValidMorphs, CurBaseVertIdx, LODIndex, RigidInfluenceIndex, ReferenceToLocal, ClothSimData, ClothBlendWeight, WorldToLocal);
+			const FSkinTask& Task = Tasks[TaskIndex];
+			FSkelMeshSection& Section = LOD.Sections[Task.SectionIndex];
+			const FClothSimulData* ClothSimData = ClothSimulUpdateData.Find(Section.CorrespondClothAssetIndex);
+
+			// The rounding mode is per thread
+			const uint32 TaskStatusRegister = VectorGetControlRegister();
+			VectorSetControlRegister( TaskStatusRegister | VECTOR_ROUND_TOWARD_ZERO );
+
+			FFinalSkinVertex* TaskDestVertex = Task.DestVertex;
+			TArray<FMorphTargetInfo> NoMorphEvalInfos;
+			int32 CurBaseVertIdx = 0;
+
+			if (bExtraBoneInfluences)
+			{
+				SkinVertexSection<true, VertexType>(TaskDestVertex, NoMorphEvalInfos, MorphTargetWeights, Section, LOD, WeightBuffer, Task.VertexBufferBaseIndex, Task.VertexBufferEndIndex, 0, CurBaseVertIdx, LODIndex, RigidInfluenceIndex, ReferenceToLocal, ClothSimData, ClothBlendWeight, WorldToLocal);
+			}
+			else
+			{
+				SkinVertexSection<false, VertexType>(TaskDestVertex, NoMorphEvalInfos, MorphTargetWeights, Section, LOD, WeightBuffer, Task.VertexBufferBaseIndex, Task.VertexBufferEndIndex, 0, CurBaseVertIdx, LODIndex, RigidInfluenceIndex, ReferenceToLocal, ClothSimData, ClothBlendWeight, WorldToLocal);
+			}
+
+			VectorSetControlRegister( TaskStatusRegister );
+		});
+	}
+	else
+	{
+		int32 CurBaseVertIdx = 0;
+		const int32 VertexBufferBaseIndex = 0;
+
+		for(int32 SectionIndex= 0;SectionIndex< LOD.Sections.Num();SectionIndex++)
+		{
+			FSkelMeshSection& Section = LOD.Sections[SectionIndex];
+			const int32 VertexBufferEndIndex = Section.GetNumVertices();
+
+			const FClothSimulData* ClothSimData = ClothSimulUpdateData.Find(Section.CorrespondClothAssetIndex);
+
+			if (bExtraBoneInfluences)
+			{
+				SkinVertexSection<true, VertexType>(DestVertex, MorphEvalInfos, MorphTargetWeights, Section, LOD, WeightBuffer, VertexBufferBaseIndex, VertexBufferEndIndex, NumValidMorphs, CurBaseVertIdx, LODIndex, RigidInfluenceIndex, ReferenceToLocal, ClothSimData, ClothBlendWeight, WorldToLocal);
+			}
+			else
+			{
+				SkinVertexSection<false, VertexType>(DestVertex, MorphEvalInfos, MorphTargetWeights, Section, LOD, WeightBuffer, VertexBufferBaseIndex, VertexBufferEndIndex, NumValidMorphs, CurBaseVertIdx, LODIndex, RigidInfluenceIndex, ReferenceToLocal, ClothSimData, ClothBlendWeight, WorldToLocal);
+			}
 		}
 	}
 
@@ -1128,7 +1198,7 @@ bool FDynamicSkelMeshObjectDataCPUSkin::UpdateClothSimulationData(USkinnedMeshCo
 		}
 
 		WorldToLocal = SrcComponent->GetRenderMatrix().InverseFast();
-		ClothBlendWeight = SrcComponent->ClothBlendWeight;
+		ClothBlendWeight = SrcComponent->GetClothBlendWeight();
 		SimMeshComponent->GetUpdateClothSimulationData(ClothSimulUpdateData, SrcComponent);
 
 		return true;
@@ -1137,7 +1207,7 @@ bool FDynamicSkelMeshObjectDataCPUSkin::UpdateClothSimulationData(USkinnedMeshCo
 	if (SimMeshComponent)
 	{
 		WorldToLocal = SimMeshComponent->GetRenderMatrix().InverseFast();
-		ClothBlendWeight = SimMeshComponent->ClothBlendWeight;
+		ClothBlendWeight = SimMeshComponent->GetClothBlendWeight();
 		SimMeshComponent->GetUpdateClothSimulationData(ClothSimulUpdateData);
 		return true;
 	}
@@ -114,6 +114,7 @@ FSkeletalMeshObjectGPUSkin::FSkeletalMeshObjectGPUSkin(USkinnedMeshComponent* In
 	,	DynamicData(NULL)
 	,	bNeedsUpdateDeferred(false)
 	,	bMorphNeedsUpdateDeferred(false)
+	,	bBonesNeedUpdateDeferred(false)
 	,	bMorphResourcesInitialized(false)
 {
 	// create LODs to match the base mesh
@@ -325,6 +326,14 @@ void FSkeletalMeshObjectGPUSkin::UpdateDynamicData_RenderThread(FGPUSkinCache* G
 		!DynamicData->ActiveMorphTargetsEqual(InDynamicData->ActiveMorphTargets, InDynamicData->MorphTargetWeights))
 		: true);
 
+	// the skin cache can skip the dispatch when the pose is the same as the last one it skinned
+	const bool bBonesNeedUpdate =
+		(bBonesNeedUpdateDeferred && bNeedsUpdateDeferred) || // the need for an update sticks
+		(DynamicData ? (DynamicData->LODIndex != InDynamicData->LODIndex ||
+		DynamicData->ReferenceToLocal.Num() != InDynamicData->ReferenceToLocal.Num() ||
+		FMemory::Memcmp(DynamicData->ReferenceToLocal.GetData(), InDynamicData->ReferenceToLocal.GetData(), InDynamicData->ReferenceToLocal.Num() * sizeof(FMatrix)) != 0)
+		: true);
+
 	WaitForRHIThreadFenceForDynamicData();
 	if (DynamicData)
 	{
@@ -336,11 +345,12 @@ void FSkeletalMeshObjectGPUSkin::UpdateDynamicData_RenderThread(FGPUSkinCache* G
 	if (CVarDeferSkeletalDynamicDataUpdateUntilGDME.GetValueOnRenderThread())
 	{
 		bMorphNeedsUpdateDeferred = bMorphNeedsUpdate;
+		bBonesNeedUpdateDeferred = bBonesNeedUpdate;
 		bNeedsUpdateDeferred = true;
 	}
 	else
 	{
-		ProcessUpdatedDynamicData(GPUSkinCache, RHICmdList, FrameNumberToPrepare, bMorphNeedsUpdate);
+		ProcessUpdatedDynamicData(GPUSkinCache, RHICmdList, FrameNumberToPrepare, bMorphNeedsUpdate, bBonesNeedUpdate);
 	}
 }
 
@@ -348,7 +358,7 @@ void FSkeletalMeshObjectGPUSkin::PreGDMECallback(FGPUSkinCache* GPUSkinCache, ui
 {
 	if (bNeedsUpdateDeferred)
 	{
-		ProcessUpdatedDynamicData(GPUSkinCache, FRHICommandListExecutor::GetImmediateCommandList(), FrameNumber, bMorphNeedsUpdateDeferred);
+		ProcessUpdatedDynamicData(GPUSkinCache, FRHICommandListExecutor::GetImmediateCommandList(), FrameNumber, bMorphNeedsUpdateDeferred, bBonesNeedUpdateDeferred);
 	}
 }
 
@@ -362,11 +372,12 @@ void FSkeletalMeshObjectGPUSkin::WaitForRHIThreadFenceForDynamicData()
 	}
 }
 
-void FSkeletalMeshObjectGPUSkin::ProcessUpdatedDynamicData(FGPUSkinCache* GPUSkinCache, FRHICommandListImmediate& RHICmdList, uint32 FrameNumberToPrepare, bool bMorphNeedsUpdate)
+void FSkeletalMeshObjectGPUSkin::ProcessUpdatedDynamicData(FGPUSkinCache* GPUSkinCache, FRHICommandListImmediate& RHICmdList, uint32 FrameNumberToPrepare, bool bMorphNeedsUpdate, bool bBonesNeedUpdate)
 {
 	QUICK_SCOPE_CYCLE_COUNTER(STAT_FSkeletalMeshObjectGPUSkin_ProcessUpdatedDynamicData);
 	bNeedsUpdateDeferred = false;
 	bMorphNeedsUpdateDeferred = false;
+	bBonesNeedUpdateDeferred = false;
 
 	FSkeletalMeshObjectLOD& LOD = LODs[DynamicData->LODIndex];
 
@@ -477,7 +488,7 @@ void FSkeletalMeshObjectGPUSkin::ProcessUpdatedDynamicData(FGPUSkinCache* GPUSki
 			{
 				GPUSkinCache->ProcessEntry(RHICmdList, VertexFactory,
 					VertexFactoryData.PassthroughVertexFactories[SectionIdx].Get(), Section, this, bMorph ? &LOD.MorphVertexBuffer : 0,
-					FrameNumberToPrepare, SectionIdx, SkinCacheEntry);
+					FrameNumberToPrepare, SectionIdx, bBonesNeedUpdate, SkinCacheEntry);
 			}
 #if WITH_APEX_CLOTHING
 			// Update uniform buffer for APEX cloth simulation mesh positions and normals
@@ -1381,7 +1392,7 @@ bool FDynamicSkelMeshObjectDataGPUSkin::UpdateClothSimulationData(USkinnedMeshCo
 		}
 		else
 		{
-			ClothBlendWeight = SimMeshComponent->ClothBlendWeight;
+			ClothBlendWeight = SimMeshComponent->GetClothBlendWeight();
 			ClothingSimData = SimMeshComponent->GetCurrentClothingData_GameThread();
 		}
 
@@ -510,7 +510,7 @@ private:
 	*/
 	void ReleaseMorphResources();
 
-	void ProcessUpdatedDynamicData(FGPUSkinCache* GPUSkinCache, FRHICommandListImmediate& RHICmdList, uint32 FrameNumberToPrepare, bool bMorphNeedsUpdate);
+	void ProcessUpdatedDynamicData(FGPUSkinCache* GPUSkinCache, FRHICommandListImmediate& RHICmdList, uint32 FrameNumberToPrepare, bool bMorphNeedsUpdate, bool bBonesNeedUpdate);
 
 	void WaitForRHIThreadFenceForDynamicData();
 
@@ -529,6 +529,9 @@ private:
 	/** If true and we are doing a deferred update, then also update the morphs */
 	bool bMorphNeedsUpdateDeferred;
 
+	/** If true and we are doing a deferred update, the bone transforms changed since the last skin cache update */
+	bool bBonesNeedUpdateDeferred;
+
 	/** true if the morph resources have been initialized */
 	bool bMorphResourcesInitialized;
 
@@ -773,7 +773,7 @@ void USoundWave::Parse( FAudioDevice* AudioDevice, const UPTRINT NodeWaveInstanc
 		WaveInstance->ReverbPluginSettings = ParseParams.ReverbPluginSettings;
 
 		bool bAddedWaveInstance = false;
-		if (WaveInstance->GetVolume() > KINDA_SMALL_NUMBER || (bVirtualizeWhenSilent && AudioDevice->VirtualSoundsEnabled()))
+		if (WaveInstance->GetVolume() > KINDA_SMALL_NUMBER || (bVirtualizeWhenSilent && AudioDevice->VirtualSoundsEnabled()) || AudioDevice->CanVirtualizeWaveInstance(WaveInstance))
 		{
 			bAddedWaveInstance = true;
 			WaveInstances.Add(WaveInstance);
@@ -153,6 +153,12 @@ public:
 		return FStaticMeshSceneProxy::GetViewRelevance(View);
 	}
 
+	/** The occluder geometry isn't deformed along the spline, so spline meshes are never used as software occluders */
+	virtual const FStaticMeshOccluderData* GetOccluderData() const override
+	{
+		return nullptr;
+	}
+
 	// 	  virtual uint32 GetMemoryFootprint( void ) const { return 0; }
 
 	/** Parameters that define the spline, used to deform mesh */
@@ -5,11 +5,13 @@
 =============================================================================*/
 
 #include "Engine/StaticMesh.h"
+#include "HAL/LowLevelMemTracker.h"
 #include "Serialization/MemoryWriter.h"
 #include "Misc/ConfigCacheIni.h"
 #include "Misc/ScopedSlowTask.h"
 #include "UObject/FrameworkObjectVersion.h"
 #include "Misc/App.h"
+#include "HAL/IConsoleManager.h"
 #include "Modules/ModuleManager.h"
 #include "UObject/UObjectAnnotation.h"
 #include "RenderingThread.h"
@@ -61,6 +63,14 @@ DECLARE_MEMORY_STAT( TEXT( "StaticMesh Distance Field Memory" ), STAT_StaticMesh
 
 DECLARE_MEMORY_STAT( TEXT( "StaticMesh Total Memory" ), STAT_StaticMeshTotalMemory, STATGROUP_Memory );
 
+static TAutoConsoleVariable<int32> CVarStripMinLodDataDuringCooking(
+	TEXT("r.StaticMesh.StripMinLodDataDuringCooking"),
+	0,
+	TEXT("If non-zero, the vertex and index data of static mesh LODs below the mesh's MinLOD is stripped when cooking.\n")
+	TEXT("Components that override MinLOD or force a LOD below it then draw the mesh's MinLOD instead.\n")
+	TEXT("Meshes that allow CPU access are never stripped."),
+	ECVF_ReadOnly);
+
 /** Package name, that if set will cause only static meshes in that package to be rebuilt based on SM version. */
 ENGINE_API FName GStaticMeshPackageNameToRebuild = NAME_None;
 
@@ -113,6 +123,17 @@ FArchive& operator<<(FArchive& Ar, FStaticMeshSection& Section)
 	return Ar;
 }
 
+FArchive& operator<<(FArchive& Ar, FStaticMeshMeshlet& Meshlet)
+{
+	Ar << Meshlet.FirstIndex;
+	Ar << Meshlet.NumTriangles;
+	Ar << Meshlet.BoundsCenter;
+	Ar << Meshlet.BoundsRadius;
+	Ar << Meshlet.ConeAxis;
+	Ar << Meshlet.ConeCutoff;
+	return Ar;
+}
+
 void FStaticMeshLODResources::Serialize(FArchive& Ar, UObject* Owner, int32 Index)
 {
 	DECLARE_SCOPE_CYCLE_COUNTER( TEXT("FStaticMeshLODResources::Serialize"), STAT_StaticMeshLODResources_Serialize, STATGROUP_LoadTime );
@@ -133,6 +154,17 @@ void FStaticMeshLODResources::Serialize(FArchive& Ar, UObject* Owner, int32 Inde
 	bHasReversedDepthOnlyIndices = false;
 	DepthOnlyNumTriangles = 0;
 
+	// LODs the runtime will never draw don't need to ship their buffers
+	bool bCookedOut = false;
+	if (Ar.IsCooking())
+	{
+		bCookedOut = CVarStripMinLodDataDuringCooking.GetValueOnAnyThread() != 0
+			&& OwnerStaticMesh && !bMeshCPUAcces
+			&& Index < OwnerStaticMesh->MinLOD;
+	}
+	Ar << bCookedOut;
+	bIsLODCookedOut = bCookedOut;
+
     // Defined class flags for possible stripping
 	const uint8 AdjacencyDataStripFlag = 1;
 
@@ -145,7 +177,7 @@ void FStaticMeshLODResources::Serialize(FArchive& Ar, UObject* Owner, int32 Inde
 	Ar << Sections;
 	Ar << MaxDeviation;
 
-	if( !StripFlags.IsDataStrippedForServer() )
+	if( !StripFlags.IsDataStrippedForServer() && !bIsLODCookedOut )
 	{
 		PositionVertexBuffer.Serialize( Ar, bNeedsCPUAccess );
 		VertexBuffer.Serialize( Ar, bNeedsCPUAccess );
@@ -178,6 +210,8 @@ void FStaticMeshLODResources::Serialize(FArchive& Ar, UObject* Owner, int32 Inde
 			Sampler.Serialize(Ar);
 		}
 		AreaWeightedSampler.Serialize(Ar);
+
+		Ar << Meshlets;
 	}
 }
 
@@ -416,6 +450,7 @@ FStaticMeshLODResources::FStaticMeshLODResources()
 	, bHasDepthOnlyIndices(false)
 	, bHasReversedIndices(false)
 	, bHasReversedDepthOnlyIndices(false)
+	, bIsLODCookedOut(false)
 	, DepthOnlyNumTriangles(0)
 	, SplineVertexFactory(nullptr)
 	, SplineVertexFactoryOverrideColorVertexBuffer(nullptr)
@@ -431,6 +466,12 @@ FStaticMeshLODResources::~FStaticMeshLODResources()
 
 void FStaticMeshLODResources::InitResources(UStaticMesh* Parent)
 {
+	if (bIsLODCookedOut)
+	{
+		// Nothing to upload, the scene proxy never selects this LOD
+		return;
+	}
+
 	const auto MaxShaderPlatform = GShaderPlatformForFeatureLevel[GMaxRHIFeatureLevel];
 
 	// Initialize the vertex and index buffers.
@@ -648,12 +689,41 @@ void FStaticMeshRenderData::Serialize(FArchive& Ar, UStaticMesh* Owner, bool bCo
 	}
 }
 
+TUniquePtr<FStaticMeshOccluderData> FStaticMeshOccluderData::Build(const FStaticMeshLODResources& LODResources)
+{
+	const uint32 NumVertices = LODResources.PositionVertexBuffer.GetNumVertices();
+	if (NumVertices == 0 || LODResources.IndexBuffer.GetNumIndices() < 3)
+	{
+		return nullptr;
+	}
+
+	TUniquePtr<FStaticMeshOccluderData> Result(new FStaticMeshOccluderData());
+
+	Result->Vertices.AddUninitialized(NumVertices);
+	for (uint32 VertexIndex = 0; VertexIndex < NumVertices; ++VertexIndex)
+	{
+		Result->Vertices[VertexIndex] = LODResources.PositionVertexBuffer.VertexPosition(VertexIndex);
+	}
+
+	LODResources.IndexBuffer.GetCopy(Result->Indices);
+	Result->Indices.SetNum(Result->Indices.Num() - Result->Indices.Num() % 3);
+
+	return Result;
+}
+
 void FStaticMeshRenderData::InitResources(UStaticMesh* Owner)
 {
 #if WITH_EDITOR
 	ResolveSectionInfo(Owner);
 #endif // #if WITH_EDITOR
 
+	// The geometry has to be copied before the resources are initialized, which releases the CPU copy of the vertices
+	OccluderData.Reset();
+	if (Owner && Owner->LODForOccluderMesh >= 0 && LODResources.Num() > 0)
+	{
+		OccluderData = FStaticMeshOccluderData::Build(LODResources[FMath::Min(Owner->LODForOccluderMesh, LODResources.Num() - 1)]);
+	}
+
 	for (int32 LODIndex = 0; LODIndex < LODResources.Num(); ++LODIndex)
 	{
 		LODResources[LODIndex].InitResources(Owner);
@@ -1039,6 +1109,7 @@ FArchive& operator<<(FArchive& Ar, FMeshBuildSettings& BuildSettings)
 	Ar << BuildSettings.bBuildReversedIndexBuffer;
 	Ar << BuildSettings.bUseHighPrecisionTangentBasis;
 	Ar << BuildSettings.bUseFullPrecisionUVs;
+	Ar << BuildSettings.bBuildMeshlets;
 	Ar << BuildSettings.bGenerateLightmapUVs;
 
 	Ar << BuildSettings.MinLightmapResolution;
@@ -1069,7 +1140,7 @@ FArchive& operator<<(FArchive& Ar, FMeshBuildSettings& BuildSettings)
 // differences, etc.) replace the version GUID below with a new one.
 // In case of merge conflicts with DDC versions, you MUST generate a new GUID
 // and set this new GUID as the version.                                       
-#define STATICMESH_DERIVEDDATA_VER TEXT("BA08C66E86EF48C993A163FC0A9ADF67")
+#define STATICMESH_DERIVEDDATA_VER TEXT("8E2B47D1C93A4F06B5D8E71A2F64C3B9")
 
 static const FString& GetStaticMeshDerivedDataVersion()
 {
@@ -1392,6 +1463,7 @@ UStaticMesh::UStaticMesh(const FObjectInitializer& ObjectInitializer)
 	LightMapResolution = 4;
 	LpvBiasMultiplier = 1.0f;
 	MinLOD = 0;
+	LODForOccluderMesh = -1;
 
 	bRequiresAreaWeightedSampling = false;
 }
@@ -1494,6 +1566,7 @@ void FStaticMeshRenderData::GetResourceSizeEx(FResourceSizeEx& CumulativeResourc
 
 		CumulativeResourceSize.AddUnknownMemoryBytes(VBSize + IBSize);
 		CumulativeResourceSize.AddUnknownMemoryBytes(LODRenderData.Sections.GetAllocatedSize());
+		CumulativeResourceSize.AddUnknownMemoryBytes(LODRenderData.Meshlets.GetAllocatedSize());
 
 		if (LODRenderData.DistanceFieldData)
 		{
@@ -2254,6 +2327,7 @@ COREUOBJECT_API extern bool GOutputCookingWarnings;
  */
 void UStaticMesh::Serialize(FArchive& Ar)
 {
+	LLM_SCOPE(ELLMTag::Meshes);
 	DECLARE_SCOPE_CYCLE_COUNTER( TEXT("UStaticMesh::Serialize"), STAT_StaticMesh_Serialize, STATGROUP_LoadTime );
 
 	Super::Serialize(Ar);
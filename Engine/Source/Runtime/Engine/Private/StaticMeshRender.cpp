@@ -136,6 +136,17 @@ FStaticMeshSceneProxy::FStaticMeshSceneProxy(UStaticMeshComponent* InComponent,
 	const int32 EffectiveMinLOD = InComponent->bOverrideMinLOD ? InComponent->MinLOD : InComponent->GetStaticMesh()->MinLOD;
 	ClampedMinLOD = FMath::Clamp(EffectiveMinLOD, 0, RenderData->LODResources.Num() - 1);
 
+	// LODs stripped during cooking (r.StaticMesh.StripMinLodDataDuringCooking) have no buffers to draw
+	while (ClampedMinLOD < RenderData->LODResources.Num() - 1 && RenderData->LODResources[ClampedMinLOD].bIsLODCookedOut)
+	{
+		++ClampedMinLOD;
+	}
+
+	if (ForcedLodModel > 0 && RenderData->LODResources[FMath::Min(ForcedLodModel, RenderData->LODResources.Num()) - 1].bIsLODCookedOut)
+	{
+		ForcedLodModel = ClampedMinLOD + 1;
+	}
+
 	WireframeColor = InComponent->GetWireframeColor();
 	LevelColor = FLinearColor(1,1,1);
 	PropertyColor = FLinearColor(1,1,1);
@@ -1381,6 +1392,11 @@ bool FStaticMeshSceneProxy::HasDynamicIndirectShadowCasterRepresentation() const
 	return bCastsDynamicIndirectShadow && FStaticMeshSceneProxy::HasDistanceFieldRepresentation();
 }
 
+const FStaticMeshOccluderData* FStaticMeshSceneProxy::GetOccluderData() const
+{
+	return RenderData->OccluderData.Get();
+}
+
 /** Initialization constructor. */
 FStaticMeshSceneProxy::FLODInfo::FLODInfo(const UStaticMeshComponent* InComponent, int32 LODIndex, bool bLODsShareStaticLighting)
 	: FLightCacheInterface(nullptr, nullptr)
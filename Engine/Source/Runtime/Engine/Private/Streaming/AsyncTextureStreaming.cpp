@@ -102,6 +102,16 @@ void FAsyncTextureStreamingData::UpdatePerfectWantedMips_Async(FStreamingTexture
 			}
 		}
 
+		// Visible according to the instance bounds, but not bound by the RHI for some time (occluded, only used by another LOD, etc).
+		// FLT_MAX means the RHI never reported binding the texture, in which case there is no feedback to rely on.
+		if (Settings.UnusedVisibleTime > 0 && MaxSize_VisibleOnly > 0 && MaxSize_VisibleOnly != FLT_MAX &&
+			StreamingTexture.LastRenderTime > Settings.UnusedVisibleTime && StreamingTexture.LastRenderTime != FLT_MAX)
+		{
+			if (bOutputToLog) UE_LOG(LogContentStreaming, Log,  TEXT("  Unused Visible (%.1f sec)"), StreamingTexture.LastRenderTime);
+			MaxSize = FMath::Max<float>(MaxSize, MaxSize_VisibleOnly); // Affected by HiddenPrimitiveScale
+			MaxSize_VisibleOnly = 0;
+		}
+
 		if (StreamingTexture.bForceFullyLoad || (StreamingTexture.LODGroup == TEXTUREGROUP_HierarchicalLOD && Settings.HLODStrategy == 2))
 		{
 			if (bOutputToLog) UE_LOG(LogContentStreaming, Log,  TEXT("  Forced FullyLoad"));
@@ -42,7 +42,7 @@ void FStreamingTexture::UpdateStaticData(const FTextureStreamingSettings& Settin
 		BoostFactor = GetExtraBoost(LODGroup, Settings);
 
 		bIsCharacterTexture = (LODGroup == TEXTUREGROUP_Character || LODGroup == TEXTUREGROUP_CharacterSpecular || LODGroup == TEXTUREGROUP_CharacterNormalMap);
-		bIsTerrainTexture = (LODGroup == TEXTUREGROUP_Terrain_Heightmap || LODGroup == TEXTUREGROUP_Terrain_Weightmap);
+		bIsTerrainTexture = (LODGroup == TEXTUREGROUP_Terrain_Heightmap || (LODGroup == TEXTUREGROUP_Terrain_Weightmap && !Settings.bScaleTerrainWeightmaps));
 
 		for (int32 MipIndex=0; MipIndex < MAX_TEXTURE_MIP_COUNT; ++MipIndex)
 		{
@@ -163,7 +163,7 @@ float FStreamingTexture::GetExtraBoost(TextureGroup	LODGroup, const FTextureStre
 	// When accurate distance computation, we need to relax the distance otherwise it gets too conservative. (ex 513 goes to 1024)
 	const float DistanceScale = Settings.bUseNewMetrics ? .71f : 1.f;
 
-	if (LODGroup == TEXTUREGROUP_Terrain_Heightmap || LODGroup == TEXTUREGROUP_Terrain_Weightmap) 
+	if (LODGroup == TEXTUREGROUP_Terrain_Heightmap || (LODGroup == TEXTUREGROUP_Terrain_Weightmap && !Settings.bScaleTerrainWeightmaps)) 
 	{
 		// Terrain are not affected by any kind of scale. Important since instance can use hardcoded resolution.
 		// Used the Distance Scale from the new metrics is not big enough to affect which mip gets selected.
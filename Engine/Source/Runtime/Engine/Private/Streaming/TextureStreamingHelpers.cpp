@@ -122,6 +122,23 @@ TAutoConsoleVariable<float> CVarStreamingHiddenPrimitiveScale(
 	ECVF_Default
 	);
 
+TAutoConsoleVariable<float> CVarStreamingUnusedVisibleTime(
+	TEXT("r.Streaming.UnusedVisibleTime"),
+	0,
+	TEXT("When > 0, textures referenced by on screen primitives but not bound by the RHI for that many seconds\n")
+	TEXT("are handled as hidden, their visible mips being scaled by r.Streaming.HiddenPrimitiveScale.\n")
+	TEXT("Relies on the last render time tracked by the RHI when the texture gets bound for drawing.\n")
+	TEXT("0: disabled (default)"),
+	ECVF_Default
+	);
+
+TAutoConsoleVariable<int32> CVarStreamingScaleTerrainWeightmaps(
+	TEXT("r.Streaming.ScaleTerrainWeightmaps"),
+	0,
+	TEXT("If non-zero, landscape weightmaps are streamed like other textures: scaled by r.Streaming.HiddenPrimitiveScale when out of view\n")
+	TEXT("and affected by the mip bias required to fit in budget. Heightmaps always keep their resolution since vertex LODs rely on it."),
+	ECVF_Default);
+
 // Used for scalability (GPU memory, streaming stalls)
 TAutoConsoleVariable<float> CVarStreamingMipBias(
 	TEXT("r.Streaming.MipBias"),
@@ -211,10 +228,12 @@ void FTextureStreamingSettings::Update()
 	bFullyLoadUsedTextures = CVarStreamingFullyLoadUsedTextures.GetValueOnAnyThread() != 0;
 	bUseAllMips = CVarStreamingUseAllMips.GetValueOnAnyThread() != 0;
 	bScaleTexturesByGlobalMipBias = CVarScaleTexturesByGlobalMipBias.GetValueOnAnyThread() != 0;
+	bScaleTerrainWeightmaps = CVarStreamingScaleTerrainWeightmaps.GetValueOnAnyThread() != 0;
 	MinMipForSplitRequest = CVarStreamingMinMipForSplitRequest.GetValueOnAnyThread();
 
 	bUseMaterialData = bUseNewMetrics && CVarStreamingUseMaterialData.GetValueOnAnyThread() != 0;
 	HiddenPrimitiveScale = bUseNewMetrics ? CVarStreamingHiddenPrimitiveScale.GetValueOnAnyThread() : 1.f;
+	UnusedVisibleTime = bUseNewMetrics ? FMath::Max<float>(0.f, CVarStreamingUnusedVisibleTime.GetValueOnAnyThread()) : 0.f;
 
 	if (MinMipForSplitRequest <= 0)
 	{
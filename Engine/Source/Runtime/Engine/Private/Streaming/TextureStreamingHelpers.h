@@ -81,12 +81,14 @@ struct FTextureStreamingSettings
 	int32 DropMips;
 	int32 HLODStrategy;
 	float HiddenPrimitiveScale;
+	float UnusedVisibleTime;
 	int32 PoolSize;
 	bool bLimitPoolSizeToVRAM;
 	bool bUseNewMetrics;
 	bool bFullyLoadUsedTextures;
 	bool bUseAllMips;
 	bool bScaleTexturesByGlobalMipBias;
+	bool bScaleTerrainWeightmaps;
 	bool bUsePerTextureBias;
 	bool bUseMaterialData;
 	int32 MinMipForSplitRequest;
@@ -5,6 +5,7 @@
 =============================================================================*/
 
 #include "Engine/Texture2D.h"
+#include "HAL/LowLevelMemTracker.h"
 #include "ProfilingDebugging/ScopedDebugInfo.h"
 #include "Serialization/MemoryWriter.h"
 #include "Misc/App.h"
@@ -197,6 +198,7 @@ bool UTexture2D::GetResourceMemSettings(int32 FirstMipIdx, int32& OutSizeX, int3
 
 void UTexture2D::Serialize(FArchive& Ar)
 {
+	LLM_SCOPE(ELLMTag::Textures);
 	Super::Serialize(Ar);
 
 	FStripDataFlags StripDataFlags(Ar);
@@ -1206,6 +1208,7 @@ FTexture2DResource::~FTexture2DResource()
  */
 void FTexture2DResource::InitRHI()
 {
+	LLM_SCOPE(ELLMTag::Textures);
 	FTexture2DScopedDebugInfo ScopedDebugInfo(Owner);
 	INC_DWORD_STAT_BY( STAT_TextureMemory, TextureSize );
 	INC_DWORD_STAT_FNAME_BY( LODGroupStatName, TextureSize );
@@ -1927,7 +1930,8 @@ void FTexture2DResource::LoadMipData()
 					MipSize,
 					&Owner->PendingMipChangeRequestStatus
 				);
-				Task->StartBackgroundTask();
+				// Streaming decompression must not wait behind background work like DDC puts
+				Task->StartBackgroundTask(GThreadPool, EQueuedWorkPriority::High);
 			}
 			else
 #endif // #if WITH_EDITORONLY_DATA
@@ -2075,7 +2079,7 @@ void FTexture2DResource::UploadMipData()
 			TaskArgs.TextureRefPtr = &IntermediateTextureRHI;
 			TaskArgs.ThreadSafeCounter = &Owner->PendingMipChangeRequestStatus;
 			AsyncCreateTextureTask = MakeUnique<FAsyncCreateTextureTask>(TaskArgs);
-			AsyncCreateTextureTask->StartBackgroundTask();
+			AsyncCreateTextureTask->StartBackgroundTask(GThreadPool, EQueuedWorkPriority::High);
 		}
 		else
 		{
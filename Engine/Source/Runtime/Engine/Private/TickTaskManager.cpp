@@ -8,6 +8,11 @@
 #include "Stats/Stats.h"
 #include "HAL/IConsoleManager.h"
 #include "Misc/App.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/Paths.h"
+#include "Misc/FileHelper.h"
+#include "Misc/DateTime.h"
+#include "HAL/ThreadManager.h"
 #include "UObject/ObjectMacros.h"
 #include "UObject/Class.h"
 #include "UObject/Package.h"
@@ -29,6 +34,7 @@ DECLARE_CYCLE_STAT(TEXT("Gather Ticks for Parallel"),STAT_GatherTicksForParallel
 DECLARE_CYCLE_STAT(TEXT("Finalize Parallel Queue"),STAT_FinalizeParallelQueue,STATGROUP_Game);
 DECLARE_CYCLE_STAT(TEXT("Schedule cooldowns"),STAT_ScheduleCooldowns,STATGROUP_Game);
 DECLARE_DWORD_COUNTER_STAT(TEXT("Ticks Queued"),STAT_TicksQueued,STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ticks Batched"),STAT_TicksBatched,STATGROUP_Game);
 DECLARE_CYCLE_STAT(TEXT("TG_NewlySpawned"), STAT_TG_NewlySpawned, STATGROUP_TickGroups);
 DECLARE_CYCLE_STAT(TEXT("ReleaseTickGroup"), STAT_ReleaseTickGroup, STATGROUP_TickGroups);
 DECLARE_CYCLE_STAT(TEXT("ReleaseTickGroup Block"), STAT_ReleaseTickGroup_Block, STATGROUP_TickGroups);
@@ -66,6 +72,16 @@ static TAutoConsoleVariable<int32> CVarAllowAsyncTickDispatch(
 	0,
 	TEXT("If true, ticks are dispatched in a task thread."));
 
+static TAutoConsoleVariable<int32> CVarAllowTickBatching(
+	TEXT("tick.AllowTickBatching"),
+	1,
+	TEXT("If true, tick functions that opt in with bAllowTickBatching are ticked in batches of the same class from a single task."));
+
+static TAutoConsoleVariable<int32> CVarMaxTickBatchSize(
+	TEXT("tick.MaxTickBatchSize"),
+	32,
+	TEXT("Maximum number of tick functions ticked from a single task when tick batching is allowed."));
+
 static TAutoConsoleVariable<int32> CVarAllowAsyncTickCleanup(
 	TEXT("tick.AllowAsyncTickCleanup"),
 	1,
@@ -207,6 +223,315 @@ struct FTickContext
 	}
 };
 
+/**
+ * Records the tick functions of one frame: when and on which thread each one ticked and which prerequisites it waited for.
+ * Used by "dumpticks critical" to log the critical path through the frame's ticks and to export them as a Chrome trace.
+ */
+class FTickGraphCapture
+{
+	/** A tick function seen during the captured frame **/
+	struct FTickNode
+	{
+		/** Description of the tick function, captured when it ticked **/
+		FString Name;
+		/** Cycles when the tick task started and finished executing this tick function **/
+		uint64 StartCycles;
+		uint64 EndCycles;
+		/** Thread the tick function was executed on **/
+		uint32 ThreadId;
+		/** Tick groups the tick function ran in **/
+		ETickingGroup StartTickGroup;
+		ETickingGroup EndTickGroup;
+		/** Whether this tick function was executed this frame, it might only be known as a prerequisite **/
+		bool bTicked;
+		/** Tick functions this one waited for **/
+		TArray<const FTickFunction*> Prerequisites;
+
+		FTickNode()
+			: StartCycles(0)
+			, EndCycles(0)
+			, ThreadId(0)
+			, StartTickGroup(TG_PrePhysics)
+			, EndTickGroup(TG_PrePhysics)
+			, bTicked(false)
+		{
+		}
+	};
+
+	/** All tick functions seen this frame, keyed by tick function. The key is never dereferenced. **/
+	TMap<const FTickFunction*, FTickNode> Nodes;
+
+	/** Protects Nodes, ticks are recorded from any thread **/
+	FCriticalSection NodesCritical;
+
+	/** Cycles when each tick group was first released and last waited for **/
+	uint64 TickGroupReleaseCycles[TG_MAX];
+	uint64 TickGroupCompleteCycles[TG_MAX];
+
+	/** Cycles when the captured frame started **/
+	uint64 FrameStartCycles;
+
+	/** Set on the game thread to capture the next frame **/
+	bool bRequested;
+
+	/** True between StartFrame and EndFrame of the captured frame **/
+	bool bCapturing;
+
+	FTickGraphCapture()
+		: FrameStartCycles(0)
+		, bRequested(false)
+		, bCapturing(false)
+	{
+	}
+
+public:
+
+	/** Singleton to retrieve the global tick graph capture **/
+	static FTickGraphCapture& Get()
+	{
+		static FTickGraphCapture SingletonInstance;
+		return SingletonInstance;
+	}
+
+	/** Requests a capture of the next frame, from the game thread **/
+	void Request()
+	{
+		check(IsInGameThread());
+		bRequested = true;
+	}
+
+	/** Whether the ticks of the current frame are being captured **/
+	FORCEINLINE bool IsCapturing() const
+	{
+		return bCapturing;
+	}
+
+	/** Starts capturing if a capture was requested, called before ticks are queued **/
+	void StartFrame()
+	{
+		check(IsInGameThread() && !bCapturing);
+		if (bRequested)
+		{
+			bRequested = false;
+			bCapturing = true;
+			Nodes.Reset();
+			FMemory::Memzero(TickGroupReleaseCycles);
+			FMemory::Memzero(TickGroupCompleteCycles);
+			FrameStartCycles = FPlatformTime::Cycles64();
+		}
+	}
+
+	/** Records that a tick function waits for a prerequisite, called while ticks are queued **/
+	void RecordPrerequisite(const FTickFunction* TickFunction, const FTickFunction* Prerequisite)
+	{
+		FScopeLock Lock(&NodesCritical);
+		Nodes.FindOrAdd(TickFunction).Prerequisites.AddUnique(Prerequisite);
+	}
+
+	/** Records the execution of a tick function, called from the tick task **/
+	void RecordTick(const FTickFunction* TickFunction, FString&& Name, uint64 StartCycles, uint64 EndCycles)
+	{
+		const uint32 ThreadId = FPlatformTLS::GetCurrentThreadId();
+
+		FScopeLock Lock(&NodesCritical);
+		FTickNode& Node = Nodes.FindOrAdd(TickFunction);
+		Node.Name = MoveTemp(Name);
+		Node.StartCycles = StartCycles;
+		Node.EndCycles = EndCycles;
+		Node.ThreadId = ThreadId;
+		Node.StartTickGroup = TickFunction->GetActualTickGroup();
+		Node.EndTickGroup = TickFunction->GetActualEndTickGroup();
+		Node.bTicked = true;
+	}
+
+	/** Records the release of a tick group, from the game thread **/
+	void RecordTickGroupRelease(ETickingGroup TickGroup)
+	{
+		if (!TickGroupReleaseCycles[TickGroup])
+		{
+			TickGroupReleaseCycles[TickGroup] = FPlatformTime::Cycles64();
+		}
+	}
+
+	/** Records that all ticks ending in a tick group completed, from the game thread **/
+	void RecordTickGroupComplete(ETickingGroup TickGroup)
+	{
+		TickGroupCompleteCycles[TickGroup] = FPlatformTime::Cycles64();
+	}
+
+	/** Finishes the capture, logs the critical path and writes the Chrome trace. Called once all ticks of the frame are complete. **/
+	void EndFrame()
+	{
+		check(IsInGameThread());
+		if (!bCapturing)
+		{
+			return;
+		}
+		bCapturing = false;
+
+		UEnum* TickGroupEnum = CastChecked<UEnum>(StaticFindObject(UEnum::StaticClass(), ANY_PACKAGE, TEXT("ETickingGroup"), true));
+		auto ToMs = [this](uint64 Cycles) -> double
+		{
+			return Cycles > FrameStartCycles ? FPlatformTime::ToMilliseconds64(Cycles - FrameStartCycles) : 0.0;
+		};
+
+		LogCriticalPath(TickGroupEnum, ToMs);
+
+		const FString Filename = FPaths::ProfilingDir() / FString::Printf(TEXT("TickGraph-%s.json"), *FDateTime::Now().ToString());
+		if (FFileHelper::SaveStringToFile(ExportChromeTrace(TickGroupEnum, ToMs), *Filename))
+		{
+			UE_LOG(LogTick, Display, TEXT("Wrote tick graph trace to %s"), *FPaths::ConvertRelativePathToFull(Filename));
+		}
+		else
+		{
+			UE_LOG(LogTick, Warning, TEXT("Failed to write tick graph trace to %s"), *Filename);
+		}
+
+		Nodes.Empty();
+	}
+
+private:
+
+	/** Returns the ticked prerequisite of a node that finished last, or nullptr if it did not wait for any **/
+	const FTickNode* FindCriticalPrerequisite(const FTickNode& Node) const
+	{
+		const FTickNode* Result = nullptr;
+		for (const FTickFunction* Prerequisite : Node.Prerequisites)
+		{
+			const FTickNode* PrerequisiteNode = Nodes.Find(Prerequisite);
+			if (PrerequisiteNode && PrerequisiteNode->bTicked && (!Result || PrerequisiteNode->EndCycles > Result->EndCycles))
+			{
+				Result = PrerequisiteNode;
+			}
+		}
+		return Result;
+	}
+
+	/**
+	 * Logs the chain of ticks that ended last: starting at the last tick to finish, walk back through the prerequisite that finished last.
+	 * The wait before each tick shows whether it was held by its prerequisite, or by its tick group and the available threads.
+	 */
+	template<typename ToMsType>
+	void LogCriticalPath(UEnum* TickGroupEnum, const ToMsType& ToMs) const
+	{
+		int32 NumTicked = 0;
+		const FTickNode* Last = nullptr;
+		for (const TPair<const FTickFunction*, FTickNode>& Pair : Nodes)
+		{
+			if (Pair.Value.bTicked)
+			{
+				++NumTicked;
+				if (!Last || Pair.Value.EndCycles > Last->EndCycles)
+				{
+					Last = &Pair.Value;
+				}
+			}
+		}
+
+		UE_LOG(LogTick, Display, TEXT(""));
+		UE_LOG(LogTick, Display, TEXT("============================ Tick Critical Path (frame %d, %d ticks) ============================"), GFrameCounter, NumTicked);
+
+		for (int32 TickGroup = 0; TickGroup < TG_MAX; TickGroup++)
+		{
+			if (TickGroupReleaseCycles[TickGroup])
+			{
+				UE_LOG(LogTick, Display, TEXT("  %-24s released %8.3f ms, complete %8.3f ms"), *TickGroupEnum->GetNameStringByValue(TickGroup), ToMs(TickGroupReleaseCycles[TickGroup]), ToMs(TickGroupCompleteCycles[TickGroup]));
+			}
+		}
+
+		TArray<const FTickNode*> Path;
+		for (const FTickNode* Node = Last; Node && Path.Num() <= Nodes.Num(); Node = FindCriticalPrerequisite(*Node))
+		{
+			Path.Add(Node);
+		}
+
+		UE_LOG(LogTick, Display, TEXT("     Start       Wait   Duration  Thread  Tick Groups"));
+		for (int32 Index = Path.Num() - 1; Index >= 0; Index--)
+		{
+			const FTickNode& Node = *Path[Index];
+			const uint64 ReadyCycles = Index + 1 < Path.Num() ? Path[Index + 1]->EndCycles : TickGroupReleaseCycles[Node.StartTickGroup];
+			const double WaitMs = Node.StartCycles > ReadyCycles ? FPlatformTime::ToMilliseconds64(Node.StartCycles - ReadyCycles) : 0.0;
+			UE_LOG(LogTick, Display, TEXT("  %8.3f  %8.3f  %8.3f  %6u  [%s, %s] %s"),
+				ToMs(Node.StartCycles), WaitMs, FPlatformTime::ToMilliseconds64(Node.EndCycles - Node.StartCycles), Node.ThreadId,
+				*TickGroupEnum->GetNameStringByValue(Node.StartTickGroup), *TickGroupEnum->GetNameStringByValue(Node.EndTickGroup), *Node.Name);
+		}
+		UE_LOG(LogTick, Display, TEXT(""));
+	}
+
+	/** Escapes a string for a JSON string literal **/
+	static FString EscapeJson(const FString& In)
+	{
+		return In.Replace(TEXT("\\"), TEXT("\\\\")).Replace(TEXT("\""), TEXT("\\\""));
+	}
+
+	/**
+	 * Builds a Chrome trace (chrome://tracing) of the frame, one complete event per tick and a flow event per prerequisite edge.
+	 * The tick groups are shown on their own track.
+	 */
+	template<typename ToMsType>
+	FString ExportChromeTrace(UEnum* TickGroupEnum, const ToMsType& ToMs) const
+	{
+		const uint32 TickGroupTrackId = 0;
+
+		FString Trace(TEXT("{\"traceEvents\":[\n"));
+		Trace += FString::Printf(TEXT("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,\"args\":{\"name\":\"Tick Groups\"}}"), TickGroupTrackId);
+
+		TSet<uint32> ThreadIds;
+		for (const TPair<const FTickFunction*, FTickNode>& Pair : Nodes)
+		{
+			if (Pair.Value.bTicked && !ThreadIds.Contains(Pair.Value.ThreadId))
+			{
+				ThreadIds.Add(Pair.Value.ThreadId);
+				FString ThreadName = FThreadManager::Get().GetThreadName(Pair.Value.ThreadId);
+				if (Pair.Value.ThreadId == GGameThreadId)
+				{
+					ThreadName = TEXT("GameThread");
+				}
+				Trace += FString::Printf(TEXT(",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,\"args\":{\"name\":\"%s\"}}"), Pair.Value.ThreadId, *EscapeJson(ThreadName));
+			}
+		}
+
+		for (int32 TickGroup = 0; TickGroup < TG_MAX; TickGroup++)
+		{
+			if (TickGroupReleaseCycles[TickGroup] && TickGroupCompleteCycles[TickGroup] >= TickGroupReleaseCycles[TickGroup])
+			{
+				Trace += FString::Printf(TEXT(",\n{\"name\":\"%s\",\"cat\":\"TickGroup\",\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}"),
+					*TickGroupEnum->GetNameStringByValue(TickGroup), TickGroupTrackId, ToMs(TickGroupReleaseCycles[TickGroup]) * 1000.0,
+					(ToMs(TickGroupCompleteCycles[TickGroup]) - ToMs(TickGroupReleaseCycles[TickGroup])) * 1000.0);
+			}
+		}
+
+		int32 FlowId = 0;
+		for (const TPair<const FTickFunction*, FTickNode>& Pair : Nodes)
+		{
+			const FTickNode& Node = Pair.Value;
+			if (!Node.bTicked)
+			{
+				continue;
+			}
+			Trace += FString::Printf(TEXT(",\n{\"name\":\"%s\",\"cat\":\"Tick\",\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"StartTickGroup\":\"%s\",\"EndTickGroup\":\"%s\",\"Prerequisites\":%d}}"),
+				*EscapeJson(Node.Name), Node.ThreadId, ToMs(Node.StartCycles) * 1000.0, FPlatformTime::ToMilliseconds64(Node.EndCycles - Node.StartCycles) * 1000.0,
+				*TickGroupEnum->GetNameStringByValue(Node.StartTickGroup), *TickGroupEnum->GetNameStringByValue(Node.EndTickGroup), Node.Prerequisites.Num());
+
+			for (const FTickFunction* Prerequisite : Node.Prerequisites)
+			{
+				const FTickNode* PrerequisiteNode = Nodes.Find(Prerequisite);
+				if (PrerequisiteNode && PrerequisiteNode->bTicked)
+				{
+					Trace += FString::Printf(TEXT(",\n{\"name\":\"Prerequisite\",\"cat\":\"TickPrerequisite\",\"ph\":\"s\",\"id\":%d,\"pid\":0,\"tid\":%u,\"ts\":%.3f}"),
+						FlowId, PrerequisiteNode->ThreadId, ToMs(PrerequisiteNode->EndCycles) * 1000.0);
+					Trace += FString::Printf(TEXT(",\n{\"name\":\"Prerequisite\",\"cat\":\"TickPrerequisite\",\"ph\":\"f\",\"bp\":\"e\",\"id\":%d,\"pid\":0,\"tid\":%u,\"ts\":%.3f}"),
+						FlowId, Node.ThreadId, ToMs(Node.StartCycles) * 1000.0);
+					FlowId++;
+				}
+			}
+		}
+
+		Trace += TEXT("\n]}\n");
+		return Trace;
+	}
+};
+
 /**
  * Class that handles the actual tick tasks and starting and completing tick groups
  */
@@ -221,16 +546,19 @@ class FTickFunctionTask
 	bool					bLogTick; 
 	/** If true, log prereqs **/
 	bool					bLogTicksShowPrerequistes; 
+	/** If true, record the tick for the tick graph capture **/
+	bool					bCaptureTick;
 public:
 	/** Constructor
 		* @param InTarget - Function to tick
 		* @param InContext - context to tick in, here thread is desired execution thread
 	**/
-	FORCEINLINE FTickFunctionTask(FTickFunction* InTarget, const FTickContext* InContext, bool InbLogTick, bool bInLogTicksShowPrerequistes)
+	FORCEINLINE FTickFunctionTask(FTickFunction* InTarget, const FTickContext* InContext, bool InbLogTick, bool bInLogTicksShowPrerequistes, bool bInCaptureTick)
 		: Target(InTarget)
 		, Context(*InContext)
 		, bLogTick(InbLogTick)
 	, bLogTicksShowPrerequistes(bInLogTicksShowPrerequistes)
+		, bCaptureTick(bInCaptureTick)
 	{
 	}
 	static FORCEINLINE TStatId GetStatId()
@@ -254,19 +582,38 @@ public:
 		**/
 	void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
 	{
-		if (bLogTick)
+		// Batched tick functions are chained behind the target, they all share this task
+		FTickFunction* TickFunction = Target;
+		while (TickFunction)
 		{
-			UE_LOG(LogTick, Log, TEXT("tick %s [%1d, %1d] %6d %2d %s"), Target->bHighPriority ? TEXT("*") : TEXT(" "), (int32)Target->GetActualTickGroup(), (int32)Target->GetActualEndTickGroup(), GFrameCounter, (int32)CurrentThread, *Target->DiagnosticMessage());
-			if (bLogTicksShowPrerequistes)
+			FTickFunction* NextInBatch = TickFunction->NextInTickBatch;
+			if (bLogTick)
 			{
-				Target->ShowPrerequistes();
+				UE_LOG(LogTick, Log, TEXT("tick %s [%1d, %1d] %6d %2d %s%s"), TickFunction->bHighPriority ? TEXT("*") : TEXT(" "), (int32)TickFunction->GetActualTickGroup(), (int32)TickFunction->GetActualEndTickGroup(), GFrameCounter, (int32)CurrentThread, *TickFunction->DiagnosticMessage(), TickFunction != Target ? TEXT(" (batched)") : TEXT(""));
+				if (bLogTicksShowPrerequistes)
+				{
+					TickFunction->ShowPrerequistes();
+				}
 			}
+			FString CaptureName;
+			uint64 CaptureStartCycles = 0;
+			if (bCaptureTick)
+			{
+				CaptureName = TickFunction->DiagnosticMessage();
+				CaptureStartCycles = FPlatformTime::Cycles64();
+			}
+			if (TickFunction->IsTickFunctionEnabled())
+			{
+				TickFunction->ExecuteTick(TickFunction->CalculateDeltaTime(Context), Context.TickType, CurrentThread, MyCompletionGraphEvent);
+			}
+			if (bCaptureTick)
+			{
+				FTickGraphCapture::Get().RecordTick(TickFunction, MoveTemp(CaptureName), CaptureStartCycles, FPlatformTime::Cycles64());
+			}
+			TickFunction->TaskPointer = nullptr;  // This is stale and a good time to clear it for safety
+			TickFunction->NextInTickBatch = nullptr;
+			TickFunction = NextInBatch;
 		}
-		if (Target->IsTickFunctionEnabled())
-		{
-			Target->ExecuteTick(Target->CalculateDeltaTime(Context), Context.TickType, CurrentThread, MyCompletionGraphEvent);
-		}
-		Target->TaskPointer = nullptr;  // This is stale and a good time to clear it for safety
 	}
 };
 
@@ -361,12 +708,53 @@ class FTickTaskSequencer
 	/** These are waited for at the end of the frame; they are not on the critical path, but they have to be done before we leave the frame. */
 	FGraphEventArray CleanupTasks;
 
+	/** Identifies the tick functions that can be ticked from the same task, the start tick group is the index into OpenTickBatches */
+	struct FTickBatchKey
+	{
+		const void* BatchKey;
+		ENamedThreads::Type Thread;
+		ETickingGroup EndTickGroup;
+		bool bHighPriority;
+
+		bool operator==(const FTickBatchKey& Other) const
+		{
+			return BatchKey == Other.BatchKey && Thread == Other.Thread && EndTickGroup == Other.EndTickGroup && bHighPriority == Other.bHighPriority;
+		}
+		friend uint32 GetTypeHash(const FTickBatchKey& Key)
+		{
+			return HashCombine(PointerHash(Key.BatchKey), HashCombine(GetTypeHash((int32)Key.Thread), GetTypeHash(((int32)Key.EndTickGroup << 1) | (Key.bHighPriority ? 1 : 0))));
+		}
+	};
+
+	/** A batch that further tick functions can still be added to, because its task has not been released yet */
+	struct FOpenTickBatch
+	{
+		/** Tick function that owns the task */
+		FTickFunction* Head;
+		/** Last tick function in the batch, new tick functions are appended so they tick in queue order */
+		FTickFunction* Tail;
+		/** Number of tick functions in the batch */
+		int32 Num;
+	};
+
+	/** Open batches for each start tick group, these are closed when the tick group is dispatched */
+	TMap<FTickBatchKey, FOpenTickBatch> OpenTickBatches[TG_MAX];
+
+	/** Protects OpenTickBatches while ticks are queued in parallel */
+	FCriticalSection OpenTickBatchesCritical;
+
 	/** we keep track of the last TG we have blocked for so when we do block, we know which TG's to wait for . */
 	ETickingGroup WaitForTickGroup;
 
 	/** If true, allow concurrent ticks **/
 	bool				bAllowConcurrentTicks; 
 
+	/** If true, tick functions that allow it are batched **/
+	bool				bAllowTickBatching;
+
+	/** Maximum number of tick functions in a batch **/
+	int32				MaxTickBatchSize;
+
 	/** If true, log each tick **/
 	bool				bLogTicks; 
 	/** If true, log each tick **/
@@ -406,26 +794,100 @@ public:
 		checkSlow(TickFunction->ActualStartTickGroup >=0 && TickFunction->ActualStartTickGroup < TG_MAX);
 
 		FTickContext UseContext = TickContext;
-	   
+		UseContext.Thread = GetTickTaskThread(TickFunction);
+
+		TickFunction->NextInTickBatch = nullptr;
+		TickFunction->TaskPointer = TGraphTask<FTickFunctionTask>::CreateTask(Prerequisites, TickContext.Thread).ConstructAndHold(TickFunction, &UseContext, bLogTicks, bLogTicksShowPrerequistes, FTickGraphCapture::Get().IsCapturing());
+	}
+
+	/** Returns the thread a tick task for this tick function should execute on **/
+	FORCEINLINE ENamedThreads::Type GetTickTaskThread(const FTickFunction* TickFunction) const
+	{
 		bool bIsOriginalTickGroup = (TickFunction->ActualStartTickGroup == TickFunction->TickGroup);
 
 		if (TickFunction->bRunOnAnyThread && bAllowConcurrentTicks && bIsOriginalTickGroup)
 		{
 			if (TickFunction->bHighPriority)
 			{
-				UseContext.Thread = CPrio_HiPriAsyncTickTaskPriority.Get();
+				return CPrio_HiPriAsyncTickTaskPriority.Get();
 			}
-			else
+			return CPrio_NormalAsyncTickTaskPriority.Get();
+		}
+		return ENamedThreads::SetTaskPriority(ENamedThreads::GameThread, TickFunction->bHighPriority ? ENamedThreads::HighTaskPriority : ENamedThreads::NormalTaskPriority);
+	}
+
+	/**
+	 * Queues a tick function into an open batch with the same key, tick groups, priority and thread, or starts a new batch for it.
+	 * Tick functions with prerequisites are never batched; that way a batch task has no prerequisites and cannot form a cycle.
+	 *
+	 * @param	InPrerequisites - prerequisites that must be completed before this tick can begin
+	 * @param	TickFunction - the tick function to queue
+	 * @param	Context - tick context to tick in. Thread here is the current thread.
+	 * @param	bParallel - whether ticks are being queued in parallel
+	 * @return	true if the tick function was queued, false if it cannot be batched
+	 */
+	bool QueueBatchedTickTask(const FGraphEventArray* Prerequisites, FTickFunction* TickFunction, const FTickContext& TickContext, bool bParallel)
+	{
+		if (!bAllowTickBatching || !TickFunction->bAllowTickBatching || (Prerequisites && Prerequisites->Num()))
+		{
+			return false;
+		}
+		const void* BatchKey = TickFunction->GetTickBatchKey();
+		if (!BatchKey)
+		{
+			return false;
+		}
+
+		FTickBatchKey Key;
+		Key.BatchKey = BatchKey;
+		Key.Thread = GetTickTaskThread(TickFunction);
+		Key.EndTickGroup = TickFunction->ActualEndTickGroup;
+		Key.bHighPriority = TickFunction->bHighPriority;
+
+		FScopeLock Lock(&OpenTickBatchesCritical);
+		TMap<FTickBatchKey, FOpenTickBatch>& Batches = OpenTickBatches[TickFunction->ActualStartTickGroup];
+		FOpenTickBatch* Batch = Batches.Find(Key);
+		if (Batch)
+		{
+			// the head's task is still held, so it is safe to extend its chain
+			TickFunction->NextInTickBatch = nullptr;
+			TickFunction->TaskPointer = Batch->Head->TaskPointer;
+			Batch->Tail->NextInTickBatch = TickFunction;
+			Batch->Tail = TickFunction;
+			INC_DWORD_STAT(STAT_TicksBatched);
+			if (++Batch->Num >= MaxTickBatchSize)
 			{
-				UseContext.Thread = CPrio_NormalAsyncTickTaskPriority.Get();
+				Batches.Remove(Key);
 			}
+			return true;
+		}
+
+		StartTickTask(Prerequisites, TickFunction, TickContext);
+		TGraphTask<FTickFunctionTask>* Task = (TGraphTask<FTickFunctionTask>*)TickFunction->TaskPointer;
+		if (bParallel)
+		{
+			AddTickTaskCompletionParallel(TickFunction->ActualStartTickGroup, TickFunction->ActualEndTickGroup, Task, TickFunction->bHighPriority);
 		}
 		else
 		{
-			UseContext.Thread = ENamedThreads::SetTaskPriority(ENamedThreads::GameThread, TickFunction->bHighPriority ? ENamedThreads::HighTaskPriority : ENamedThreads::NormalTaskPriority);
+			AddTickTaskCompletion(TickFunction->ActualStartTickGroup, TickFunction->ActualEndTickGroup, Task, TickFunction->bHighPriority);
+		}
+		if (MaxTickBatchSize > 1)
+		{
+			FOpenTickBatch NewBatch;
+			NewBatch.Head = TickFunction;
+			NewBatch.Tail = TickFunction;
+			NewBatch.Num = 1;
+			Batches.Add(Key, NewBatch);
 		}
+		return true;
+	}
 
-		TickFunction->TaskPointer = TGraphTask<FTickFunctionTask>::CreateTask(Prerequisites, TickContext.Thread).ConstructAndHold(TickFunction, &UseContext, bLogTicks, bLogTicksShowPrerequistes);
+	/** Closes the open batches for a start tick group, their tasks are about to be released **/
+	void CloseTickBatches(ETickingGroup StartTickGroup)
+	{
+		FScopeLock Lock(&OpenTickBatchesCritical);
+		OpenTickBatches[StartTickGroup].Reset();
 	}
 
 	/** Add a completion handle to a tick group **/
@@ -479,6 +941,10 @@ public:
 	FORCEINLINE void QueueTickTask(const FGraphEventArray* Prerequisites, FTickFunction* TickFunction, const FTickContext& TickContext)
 	{
 		checkSlow(TickContext.Thread == ENamedThreads::GameThread);
+		if (QueueBatchedTickTask(Prerequisites, TickFunction, TickContext, false))
+		{
+			return;
+		}
 		StartTickTask(Prerequisites, TickFunction, TickContext);
 		TGraphTask<FTickFunctionTask>* Task = (TGraphTask<FTickFunctionTask>*)TickFunction->TaskPointer;
 		AddTickTaskCompletion(TickFunction->ActualStartTickGroup, TickFunction->ActualEndTickGroup, Task, TickFunction->bHighPriority);
@@ -494,6 +960,10 @@ public:
 	FORCEINLINE void QueueTickTaskParallel(const FGraphEventArray* Prerequisites, FTickFunction* TickFunction, const FTickContext& TickContext)
 	{
 		checkSlow(TickContext.Thread == ENamedThreads::GameThread);
+		if (QueueBatchedTickTask(Prerequisites, TickFunction, TickContext, true))
+		{
+			return;
+		}
 		StartTickTask(Prerequisites, TickFunction, TickContext);
 		TGraphTask<FTickFunctionTask>* Task = (TGraphTask<FTickFunctionTask>*)TickFunction->TaskPointer;
 		AddTickTaskCompletionParallel(TickFunction->ActualStartTickGroup, TickFunction->ActualEndTickGroup, Task, TickFunction->bHighPriority);
@@ -512,6 +982,11 @@ public:
 		}
 		checkSlow(WorldTickGroup >= 0 && WorldTickGroup < TG_MAX);
 
+		if (FTickGraphCapture::Get().IsCapturing())
+		{
+			FTickGraphCapture::Get().RecordTickGroupRelease(WorldTickGroup);
+		}
+
 		{
 			SCOPE_CYCLE_COUNTER(STAT_ReleaseTickGroup);
 			if (SingleThreadedMode() || CVarAllowAsyncTickDispatch.GetValueOnGameThread() == 0)
@@ -535,6 +1010,10 @@ public:
 				if (TickCompletionEvents[Block].Num())
 				{
 					FTaskGraphInterface::Get().WaitUntilTasksComplete(TickCompletionEvents[Block], ENamedThreads::GameThread);
+					if (FTickGraphCapture::Get().IsCapturing())
+					{
+						FTickGraphCapture::Get().RecordTickGroupComplete(Block);
+					}
 					if (SingleThreadedMode() || Block == TG_NewlySpawned || CVarAllowAsyncTickCleanup.GetValueOnGameThread() == 0)
 					{
 						ResetTickGroup(Block);
@@ -577,9 +1056,13 @@ public:
 		{
 			bAllowConcurrentTicks = !!CVarAllowAsyncComponentTicks.GetValueOnGameThread();
 		}
+		bAllowTickBatching = !!CVarAllowTickBatching.GetValueOnGameThread();
+		MaxTickBatchSize = FMath::Max(CVarMaxTickBatchSize.GetValueOnGameThread(), 1);
 
 		WaitForCleanup();
 
+		FTickGraphCapture::Get().StartFrame();
+
 		for (int32 Index = 0; Index < TG_MAX; Index++)
 		{
 			check(!TickCompletionEvents[Index].Num());  // we should not be adding to these outside of a ticking proper and they were already cleared after they were ticked
@@ -590,6 +1073,7 @@ public:
 				TickTasks[Index][IndexInner].Reset();
 				HiPriTickTasks[Index][IndexInner].Reset();
 			}
+			OpenTickBatches[Index].Reset();
 		}
 		WaitForTickGroup = (ETickingGroup)0;
 	}
@@ -602,11 +1086,14 @@ public:
 		{
 			UE_LOG(LogTick, Log, TEXT("tick %6d ---------------------------------------- End Frame"),GFrameCounter);
 		}
+		FTickGraphCapture::Get().EndFrame();
 	}
 private:
 
 	FTickTaskSequencer()
 		: bAllowConcurrentTicks(false)
+		, bAllowTickBatching(false)
+		, MaxTickBatchSize(1)
 		, bLogTicks(false)
 		, bLogTicksShowPrerequistes(false)
 	{
@@ -639,6 +1126,7 @@ private:
 	void DispatchTickGroup(ENamedThreads::Type CurrentThread, ETickingGroup WorldTickGroup)
 	{
 		QUICK_SCOPE_CYCLE_COUNTER(STAT_DispatchTickGroup);
+		CloseTickBatches(WorldTickGroup);
 		for (int32 IndexInner = 0; IndexInner < TG_MAX; IndexInner++)
 		{
 			TArray<TGraphTask<FTickFunctionTask>*>& TickArray = HiPriTickTasks[WorldTickGroup][IndexInner];
@@ -1525,7 +2013,7 @@ private:
 		: TickTaskSequencer(FTickTaskSequencer::Get())
 		, bTickNewlySpawned(false)
 	{
-		IConsoleManager::Get().RegisterConsoleCommand(TEXT("dumpticks"), TEXT("Dumps all tick functions registered with FTickTaskManager to log."));
+		IConsoleManager::Get().RegisterConsoleCommand(TEXT("dumpticks"), TEXT("Dumps all tick functions registered with FTickTaskManager to log. 'dumpticks critical' captures the next frame, logs its tick critical path and writes a Chrome trace of it to the profiling directory."));
 	}
 
 	/** Fill the level list **/
@@ -1582,6 +2070,12 @@ private:
 		Ar.Logf(TEXT(""));
 	}
 
+	/** Captures the tick graph of the next frame */
+	virtual void CaptureNextFrameTickGraph() override
+	{
+		FTickGraphCapture::Get().Request();
+	}
+
 	/** Global Sequencer														*/
 	FTickTaskSequencer&							TickTaskSequencer;
 	/** List of current levels **/
@@ -1607,11 +2101,13 @@ FTickFunction::FTickFunction()
 	, bAllowTickOnDedicatedServer(true)
 	, bHighPriority(false)
 	, bRunOnAnyThread(false)
+	, bAllowTickBatching(false)
 	, bRegistered(false)
 	, bWasInterval(false)
 	, TickState(ETickState::Enabled)
 	, TickVisitedGFrameCounter(0)
 	, TickQueuedGFrameCounter(0)
+	, NextInTickBatch(nullptr)
 	, RelativeTickCooldown(0.f)
 	, LastTickGameTimeSeconds(-1.f)
 	, TickInterval(0.f)
@@ -1762,6 +2258,10 @@ void FTickFunction::QueueTickFunction(FTickTaskSequencer& TTS, const struct FTic
 					{
 						MaxPrerequisiteTickGroup =  FMath::Max<ETickingGroup>(MaxPrerequisiteTickGroup, Prereq->ActualStartTickGroup);
 						TaskPrerequisites.Add(Prereq->GetCompletionHandle());
+						if (FTickGraphCapture::Get().IsCapturing())
+						{
+							FTickGraphCapture::Get().RecordPrerequisite(this, Prereq);
+						}
 					}
 				}
 			}
@@ -1844,6 +2344,10 @@ void FTickFunction::QueueTickFunctionParallel(const struct FTickContext& TickCon
 						{
 							MaxPrerequisiteTickGroup = FMath::Max<ETickingGroup>(MaxPrerequisiteTickGroup, Prereq->ActualStartTickGroup);
 							TaskPrerequisites.Add(Prereq->GetCompletionHandle());
+							if (FTickGraphCapture::Get().IsCapturing())
+							{
+								FTickGraphCapture::Get().RecordPrerequisite(this, Prereq);
+							}
 						}
 					}
 				}
@@ -13,8 +13,8 @@
 DECLARE_CYCLE_STAT(TEXT("SetTimer"), STAT_SetTimer, STATGROUP_Engine);
 DECLARE_CYCLE_STAT(TEXT("ClearTimer"), STAT_ClearTimer, STATGROUP_Engine);
 
-/** Track the last assigned handle globally */
-uint64 FTimerManager::LastAssignedHandle = 0;
+/** Track the last assigned serial number globally, so handles are unique across timer managers */
+uint64 FTimerManager::LastAssignedSerialNumber = 0;
 
 namespace
 {
@@ -32,7 +32,9 @@ namespace
 }
 
 FTimerManager::FTimerManager()
-	: InternalTime(0.0)
+	: CurrentlyExecutingTimerIndex(INDEX_NONE)
+	, NumStaleHeapEntries(0)
+	, InternalTime(0.0)
 	, LastTickedFrame(static_cast<uint64>(-1))
 	, OwningGameInstance(nullptr)
 {
@@ -55,25 +57,26 @@ void FTimerManager::OnCrash()
 {
 	UE_LOG(LogEngine, Warning, TEXT("TimerManager %p on crashing delegate called, dumping extra information"), this);
 
-	UE_LOG(LogEngine, Log, TEXT("------- %d Active Timers -------"), ActiveTimerHeap.Num());
-	for(const FTimerData& Data : ActiveTimerHeap)
+	int32 NumTimersByStatus[4] = { 0, 0, 0, 0 };
+	for (const FTimerData& Data : Timers)
 	{
-		DescribeFTImerDataSafely(Data);
+		NumTimersByStatus[(int32)Data.Status]++;
 	}
 
-	UE_LOG(LogEngine, Log, TEXT("------- %d Paused Timers -------"), PausedTimerList.Num());
-	for (const FTimerData& Data : PausedTimerList)
+	const TCHAR* StatusNames[] = { TEXT("Pending"), TEXT("Active"), TEXT("Paused"), TEXT("Executing") };
+	for (const ETimerStatus Status : { ETimerStatus::Active, ETimerStatus::Paused, ETimerStatus::Pending })
 	{
-		DescribeFTImerDataSafely(Data);
-	}
-
-	UE_LOG(LogEngine, Log, TEXT("------- %d Pending Timers -------"), PendingTimerList.Num());
-	for (const FTimerData& Data : PendingTimerList)
-	{
-		DescribeFTImerDataSafely(Data);
+		UE_LOG(LogEngine, Log, TEXT("------- %d %s Timers -------"), NumTimersByStatus[(int32)Status], StatusNames[(int32)Status]);
+		for (const FTimerData& Data : Timers)
+		{
+			if (Data.Status == Status)
+			{
+				DescribeFTImerDataSafely(Data);
+			}
+		}
 	}
 
-	UE_LOG(LogEngine, Log, TEXT("------- %d Total Timers -------"), PendingTimerList.Num() + PausedTimerList.Num() + ActiveTimerHeap.Num());
+	UE_LOG(LogEngine, Log, TEXT("------- %d Total Timers, %d Heap Entries -------"), Timers.Num(), ActiveTimerHeap.Num());
 
 	UE_LOG(LogEngine, Warning, TEXT("TimerManager %p dump ended"), this);
 }
@@ -115,98 +118,120 @@ FString FTimerUnifiedDelegate::ToString() const
 // Private members
 // ---------------------------------
 
-FTimerData const* FTimerManager::FindTimer(FTimerHandle const& InHandle, int32* OutTimerIndex) const
+FTimerData const* FTimerManager::FindTimer(FTimerHandle const& InHandle) const
 {
 	if (InHandle.IsValid())
 	{
 		if (CurrentlyExecutingTimer.TimerHandle == InHandle)
 		{
 			// found it currently executing
-			if (OutTimerIndex)
-			{
-				*OutTimerIndex = -1;
-			}
 			return &CurrentlyExecutingTimer;
 		}
 
-		int32 ActiveTimerIdx = FindTimerInList(ActiveTimerHeap, InHandle);
-		if (ActiveTimerIdx != INDEX_NONE)
+		// the entry of the executing timer is only reserved, it does not hold the timer
+		FTimerData const* Timer = FindStoredTimer(InHandle);
+		if (Timer && Timer->Status != ETimerStatus::Executing)
 		{
-			// found it in the active heap
-			if (OutTimerIndex)
-			{
-				*OutTimerIndex = ActiveTimerIdx;
-			}
-			return &ActiveTimerHeap[ActiveTimerIdx];
+			return Timer;
 		}
+	}
 
-		int32 PausedTimerIdx = FindTimerInList(PausedTimerList, InHandle);
-		if (PausedTimerIdx != INDEX_NONE)
-		{
-			// found it in the paused list
-			if (OutTimerIndex)
-			{
-				*OutTimerIndex = PausedTimerIdx;
-			}
-			return &PausedTimerList[PausedTimerIdx];
-		}
+	return nullptr;
+}
 
-		int32 PendingTimerIdx = FindTimerInList(PendingTimerList, InHandle);
-		if (PendingTimerIdx != INDEX_NONE)
+int32 FTimerManager::AddTimer(FTimerData&& TimerData, FTimerHandle const& ReuseHandle)
+{
+	FTimerHandle Handle = ReuseHandle;
+	FSparseArrayAllocationInfo Allocation;
+	if (Handle.IsValid())
+	{
+		// use the entry the handle points to if it is free, else store the timer elsewhere and remember where
+		const int32 HandleIndex = Handle.GetIndex();
+		const bool bHandleIndexFree = HandleIndex < Timers.GetMaxIndex() && !Timers.IsAllocated(HandleIndex);
+		Allocation = bHandleIndexFree ? Timers.InsertUninitialized(HandleIndex) : Timers.AddUninitialized();
+		checkf(Allocation.Index < FTimerHandle::MaxIndex, TEXT("Too many timers in one timer manager!"));
+		if (!bHandleIndexFree)
 		{
-			// found it in the pending list
-			if (OutTimerIndex)
-			{
-				*OutTimerIndex = PendingTimerIdx;
-			}
-			return &PendingTimerList[PendingTimerIdx];
+			RelocatedTimerIndices.Add(Handle.GetSerialNumber(), Allocation.Index);
 		}
 	}
+	else
+	{
+		Allocation = Timers.AddUninitialized();
+		checkf(Allocation.Index < FTimerHandle::MaxIndex, TEXT("Too many timers in one timer manager!"));
 
-	return nullptr;
+		++LastAssignedSerialNumber;
+		checkf(LastAssignedSerialNumber < FTimerHandle::MaxSerialNumber, TEXT("Timer serial number has wrapped around!"));
+		Handle.SetIndexAndSerialNumber(Allocation.Index, LastAssignedSerialNumber);
+	}
+
+	new(Allocation) FTimerData(MoveTemp(TimerData));
+	Timers[Allocation.Index].TimerHandle = Handle;
+	return Allocation.Index;
 }
 
-/** Will find the given timer in the given TArray and return its index. */
-int32 FTimerManager::FindTimerInList(const TArray<FTimerData> &SearchArray, FTimerHandle const& InHandle) const
+void FTimerManager::RemoveTimer(int32 TimerIndex)
 {
-	if (InHandle.IsValid())
+	if (Timers[TimerIndex].Status == ETimerStatus::Active)
+	{
+		AddStaleHeapEntry();
+	}
+	RemoveRelocatedTimerIndex(Timers[TimerIndex].TimerHandle, TimerIndex);
+	Timers.RemoveAt(TimerIndex);
+}
+
+void FTimerManager::RemoveRelocatedTimerIndex(FTimerHandle const& InHandle, int32 TimerIndex)
+{
+	if (InHandle.IsValid() && InHandle.GetIndex() != TimerIndex)
 	{
-		for (int32 Idx = 0; Idx < SearchArray.Num(); ++Idx)
+		const int32* RelocatedIndex = RelocatedTimerIndices.Find(InHandle.GetSerialNumber());
+		if (RelocatedIndex && *RelocatedIndex == TimerIndex)
 		{
-			if (SearchArray[Idx].TimerHandle == InHandle)
-			{
-				return Idx;
-			}
+			RelocatedTimerIndices.Remove(InHandle.GetSerialNumber());
 		}
 	}
+}
 
-	return INDEX_NONE;
+void FTimerManager::PushActiveTimer(FTimerData const& Timer)
+{
+	check(Timer.Status == ETimerStatus::Active);
+	ActiveTimerHeap.HeapPush(FTimerHeapEntry(Timer.ExpireTime, Timer.TimerHandle));
 }
 
-/** Finds a handle to a dynamic timer bound to a particular pointer and function name. */
-FTimerHandle FTimerManager::K2_FindDynamicTimerHandle(FTimerDynamicDelegate InDynamicDelegate) const
+bool FTimerManager::IsHeapEntryValid(FTimerHeapEntry const& Entry) const
 {
-	if (CurrentlyExecutingTimer.TimerDelegate.FuncDynDelegate == InDynamicDelegate)
-	{
-		return CurrentlyExecutingTimer.TimerHandle;
-	}
+	// a timer that was paused and unpaused may still have its old entry, it only matches if it expires at the same time
+	FTimerData const* Timer = FindStoredTimer(Entry.TimerHandle);
+	return Timer && Timer->Status == ETimerStatus::Active && Timer->ExpireTime == Entry.ExpireTime;
+}
 
-	const FTimerData* Timer = ActiveTimerHeap.FindByPredicate([=](const FTimerData& Data){ return Data.TimerDelegate.FuncDynDelegate == InDynamicDelegate; });
-	if (Timer)
+void FTimerManager::AddStaleHeapEntry()
+{
+	++NumStaleHeapEntries;
+
+	// stale entries are dropped when they reach the top of the heap, clean them up in bulk when timers are mostly cleared before they expire
+	if (NumStaleHeapEntries > 64 && NumStaleHeapEntries > ActiveTimerHeap.Num() / 2)
 	{
-		return Timer->TimerHandle;
+		ActiveTimerHeap.RemoveAll([this](const FTimerHeapEntry& Entry) { return !IsHeapEntryValid(Entry); });
+		ActiveTimerHeap.Heapify();
+		NumStaleHeapEntries = 0;
 	}
+}
 
-	Timer = PausedTimerList.FindByPredicate([=](const FTimerData& Data){ return Data.TimerDelegate.FuncDynDelegate == InDynamicDelegate; });
-	if (Timer)
+/** Finds a handle to a dynamic timer bound to a particular pointer and function name. */
+FTimerHandle FTimerManager::K2_FindDynamicTimerHandle(FTimerDynamicDelegate InDynamicDelegate) const
+{
+	if (CurrentlyExecutingTimer.TimerDelegate.FuncDynDelegate == InDynamicDelegate)
 	{
-		return Timer->TimerHandle;
+		return CurrentlyExecutingTimer.TimerHandle;
 	}
 
-	Timer = PendingTimerList.FindByPredicate([=](const FTimerData& Data){ return Data.TimerDelegate.FuncDynDelegate == InDynamicDelegate; });
-	if (Timer)
+	for (const FTimerData& Data : Timers)
 	{
-		return Timer->TimerHandle;
+		if (Data.Status != ETimerStatus::Executing && Data.TimerDelegate.FuncDynDelegate == InDynamicDelegate)
+		{
+			return Data.TimerHandle;
+		}
 	}
 
 	return FTimerHandle();
@@ -228,48 +253,46 @@ void FTimerManager::InternalSetTimer(FTimerHandle& InOutHandle, FTimerUnifiedDel
 
 	if (InRate > 0.f)
 	{
-		ValidateHandle(InOutHandle);
-
-		// set up the new timer
+		// set up the new timer, a valid handle is kept so copies of it keep matching the timer
 		FTimerData NewTimerData;
-		NewTimerData.TimerHandle = InOutHandle;
 		NewTimerData.TimerDelegate = InDelegate;
 
-		InternalSetTimer(NewTimerData, InRate, InbLoop, InFirstDelay);
+		InOutHandle = InternalSetTimer(MoveTemp(NewTimerData), InRate, InbLoop, InFirstDelay, InOutHandle);
 	}
 }
 
-void FTimerManager::InternalSetTimer(FTimerData& NewTimerData, float InRate, bool InbLoop, float InFirstDelay)
+FTimerHandle FTimerManager::InternalSetTimer(FTimerData&& NewTimerData, float InRate, bool InbLoop, float InFirstDelay, FTimerHandle const& ReuseHandle)
 {
-	if (NewTimerData.TimerHandle.IsValid() || NewTimerData.TimerDelegate.IsBound())
-	{
-		NewTimerData.Rate = InRate;
-		NewTimerData.bLoop = InbLoop;
-		NewTimerData.bRequiresDelegate = NewTimerData.TimerDelegate.IsBound();
+	NewTimerData.Rate = InRate;
+	NewTimerData.bLoop = InbLoop;
+	NewTimerData.bRequiresDelegate = NewTimerData.TimerDelegate.IsBound();
 
-		// Set level collection
-		const UWorld* const OwningWorld = OwningGameInstance ? OwningGameInstance->GetWorld() : nullptr;
-		if (OwningWorld && OwningWorld->GetActiveLevelCollection())
-		{
-			NewTimerData.LevelCollection = OwningWorld->GetActiveLevelCollection()->GetType();
-		}
+	// Set level collection
+	const UWorld* const OwningWorld = OwningGameInstance ? OwningGameInstance->GetWorld() : nullptr;
+	if (OwningWorld && OwningWorld->GetActiveLevelCollection())
+	{
+		NewTimerData.LevelCollection = OwningWorld->GetActiveLevelCollection()->GetType();
+	}
 
-		const float FirstDelay = (InFirstDelay >= 0.f) ? InFirstDelay : InRate;
+	const float FirstDelay = (InFirstDelay >= 0.f) ? InFirstDelay : InRate;
 
-		if (HasBeenTickedThisFrame())
-		{
-			NewTimerData.ExpireTime = InternalTime + FirstDelay;
-			NewTimerData.Status = ETimerStatus::Active;
-			ActiveTimerHeap.HeapPush(NewTimerData);
-		}
-		else
-		{
-			// Store time remaining in ExpireTime while pending
-			NewTimerData.ExpireTime = FirstDelay;
-			NewTimerData.Status = ETimerStatus::Pending;
-			PendingTimerList.Add(NewTimerData);
-		}
+	int32 NewIndex;
+	if (HasBeenTickedThisFrame())
+	{
+		NewTimerData.ExpireTime = InternalTime + FirstDelay;
+		NewTimerData.Status = ETimerStatus::Active;
+		NewIndex = AddTimer(MoveTemp(NewTimerData), ReuseHandle);
+		PushActiveTimer(Timers[NewIndex]);
 	}
+	else
+	{
+		// Store time remaining in ExpireTime while pending
+		NewTimerData.ExpireTime = FirstDelay;
+		NewTimerData.Status = ETimerStatus::Pending;
+		NewIndex = AddTimer(MoveTemp(NewTimerData), ReuseHandle);
+		PendingTimerList.Add(Timers[NewIndex].TimerHandle);
+	}
+	return Timers[NewIndex].TimerHandle;
 }
 
 void FTimerManager::InternalSetTimerForNextTick(FTimerUnifiedDelegate const& InDelegate)
@@ -292,8 +315,8 @@ void FTimerManager::InternalSetTimerForNextTick(FTimerUnifiedDelegate const& InD
 		NewTimerData.LevelCollection = OwningWorld->GetActiveLevelCollection()->GetType();
 	}
 
-
-	ActiveTimerHeap.HeapPush(NewTimerData);
+	const int32 NewIndex = AddTimer(MoveTemp(NewTimerData), FTimerHandle());
+	PushActiveTimer(Timers[NewIndex]);
 }
 
 void FTimerManager::InternalClearTimer(FTimerHandle const& InHandle)
@@ -309,79 +332,33 @@ void FTimerManager::InternalClearTimer(FTimerHandle const& InHandle)
 		return;
 	}
 
-	int32 TimerIdx;
-	FTimerData const* const TimerData = FindTimer(InHandle, &TimerIdx);
+	FTimerData const* const TimerData = FindTimer(InHandle);
 	if (TimerData)
 	{
-		InternalClearTimer(TimerIdx, TimerData->Status);
-	}
-}
-
-void FTimerManager::InternalClearTimer(int32 TimerIdx, ETimerStatus TimerStatus)
-{
-	switch (TimerStatus)
-	{
-		case ETimerStatus::Pending:
-			PendingTimerList.RemoveAtSwap(TimerIdx, 1, /*bAllowShrinking=*/ false);
-			break;
-
-		case ETimerStatus::Active:
-			ActiveTimerHeap.HeapRemoveAt(TimerIdx, /*bAllowShrinking=*/ false);
-			break;
-
-		case ETimerStatus::Paused:
-			PausedTimerList.RemoveAtSwap(TimerIdx, 1, /*bAllowShrinking=*/ false);
-			break;
-
-		case ETimerStatus::Executing:
+		if (TimerData->Status == ETimerStatus::Executing)
+		{
 			// Edge case. We're currently handling this timer when it got cleared.  Clear it to prevent it firing again
 			// in case it was scheduled to fire multiple times.
 			CurrentlyExecutingTimer.Clear();
-			break;
-
-		default:
-			check(false);
+		}
+		else
+		{
+			// pending timers are skipped when the pending list is activated, heap entries become stale
+			RemoveTimer(FindStoredTimerIndex(InHandle));
+		}
 	}
 }
 
-
 void FTimerManager::InternalClearAllTimers(void const* Object)
 {
 	if (Object)
 	{
-		// search active timer heap for timers using this object and remove them
-		int32 const OldActiveHeapSize = ActiveTimerHeap.Num();
-
-		for (int32 Idx=0; Idx<ActiveTimerHeap.Num(); ++Idx)
-		{
-			if ( ActiveTimerHeap[Idx].TimerDelegate.IsBoundToObject(Object) )
-			{
-				// remove this item
-				// this will break the heap property, but we will re-heapify afterward
-				ActiveTimerHeap.RemoveAtSwap(Idx--, 1, /*bAllowShrinking=*/ false);
-			}
-		}
-		if (OldActiveHeapSize != ActiveTimerHeap.Num())
-		{
-			// need to heapify
-			ActiveTimerHeap.Heapify();
-		}
-
-		// search paused timer list for timers using this object and remove them, too
-		for (int32 Idx=0; Idx<PausedTimerList.Num(); ++Idx)
+		// search all timers for timers using this object and remove them
+		for (TSparseArray<FTimerData>::TIterator It(Timers); It; ++It)
 		{
-			if (PausedTimerList[Idx].TimerDelegate.IsBoundToObject(Object))
+			if (It->Status != ETimerStatus::Executing && It->TimerDelegate.IsBoundToObject(Object))
 			{
-				PausedTimerList.RemoveAtSwap(Idx--, 1, /*bAllowShrinking=*/ false);
-			}
-		}
-
-		// search pending timer list for timers using this object and remove them, too
-		for (int32 Idx=0; Idx<PendingTimerList.Num(); ++Idx)
-		{
-			if (PendingTimerList[Idx].TimerDelegate.IsBoundToObject(Object))
-			{
-				PendingTimerList.RemoveAtSwap(Idx--, 1, /*bAllowShrinking=*/ false);
+				RemoveTimer(It.GetIndex());
 			}
 		}
 
@@ -441,79 +418,67 @@ float FTimerManager::InternalGetTimerRate(FTimerData const* const TimerData) con
 	return -1.f;
 }
 
-void FTimerManager::InternalPauseTimer( FTimerData const* TimerToPause, int32 TimerIdx )
+void FTimerManager::InternalPauseTimer(FTimerHandle const& InHandle)
 {
 	// not currently threadsafe
 	check(IsInGameThread());
 
+	FTimerData const* TimerToPause = FindTimer(InHandle);
 	if( TimerToPause && (TimerToPause->Status != ETimerStatus::Paused) )
 	{
 		ETimerStatus PreviousStatus = TimerToPause->Status;
+		FTimerData& StoredTimer = Timers[PreviousStatus == ETimerStatus::Executing ? CurrentlyExecutingTimerIndex : FindStoredTimerIndex(InHandle)];
 
 		// Don't pause the timer if it's currently executing and isn't going to loop
 		if( PreviousStatus != ETimerStatus::Executing || TimerToPause->bLoop )
 		{
-			// Add to Paused list
-			int32 NewIndex = PausedTimerList.Add(*TimerToPause);
+			if (PreviousStatus == ETimerStatus::Executing)
+			{
+				// Move it back into its reserved entry, Tick leaves paused timers alone
+				StoredTimer = CurrentlyExecutingTimer;
+			}
+			else if (PreviousStatus == ETimerStatus::Active)
+			{
+				AddStaleHeapEntry();
+			}
 
 			// Set new status
-			FTimerData& NewTimer = PausedTimerList[NewIndex];
-			NewTimer.Status = ETimerStatus::Paused;
+			StoredTimer.Status = ETimerStatus::Paused;
 
 			// Store time remaining in ExpireTime while paused. Don't do this if the timer is in the pending list.
 			if (PreviousStatus != ETimerStatus::Pending)
 			{
-				NewTimer.ExpireTime = NewTimer.ExpireTime - InternalTime;
+				StoredTimer.ExpireTime = StoredTimer.ExpireTime - InternalTime;
 			}
 		}
 
-		// Remove from previous TArray
-		switch( PreviousStatus )
+		if (PreviousStatus == ETimerStatus::Executing)
 		{
-			case ETimerStatus::Active:
-				ActiveTimerHeap.HeapRemoveAt(TimerIdx, /*bAllowShrinking=*/ false);
-				break;
-
-			case ETimerStatus::Pending:
-				PendingTimerList.RemoveAtSwap(TimerIdx, 1, /*bAllowShrinking=*/ false);
-				break;
-
-			case ETimerStatus::Executing:
-				CurrentlyExecutingTimer.Clear();
-				break;
-
-			default:
-				check(false);
+			CurrentlyExecutingTimer.Clear();
 		}
 	}
 }
 
-void FTimerManager::InternalUnPauseTimer(int32 PausedTimerIdx)
+void FTimerManager::InternalUnPauseTimer(FTimerHandle const& InHandle)
 {
 	// not currently threadsafe
 	check(IsInGameThread());
 
-	if (PausedTimerIdx != INDEX_NONE)
+	FTimerData* TimerToUnPause = FindStoredTimer(InHandle);
+	if (TimerToUnPause && TimerToUnPause->Status == ETimerStatus::Paused)
 	{
-		FTimerData& TimerToUnPause = PausedTimerList[PausedTimerIdx];
-		check(TimerToUnPause.Status == ETimerStatus::Paused);
-
-		// Move it out of paused list and into proper TArray
 		if( HasBeenTickedThisFrame() )
 		{
 			// Convert from time remaining back to a valid ExpireTime
-			TimerToUnPause.ExpireTime += InternalTime;
-			TimerToUnPause.Status = ETimerStatus::Active;
-			ActiveTimerHeap.HeapPush(TimerToUnPause);
+			TimerToUnPause->ExpireTime += InternalTime;
+			TimerToUnPause->Status = ETimerStatus::Active;
+			PushActiveTimer(*TimerToUnPause);
 		}
 		else
 		{
-			TimerToUnPause.Status = ETimerStatus::Pending;
-			PendingTimerList.Add(TimerToUnPause);
+			TimerToUnPause->Status = ETimerStatus::Pending;
+			PendingTimerList.Add(InHandle);
 		}
-
-		// remove from paused list
-		PausedTimerList.RemoveAtSwap(PausedTimerIdx, 1, /*bAllowShrinking=*/ false);
 	}
 }
 
@@ -539,10 +504,18 @@ void FTimerManager::Tick(float DeltaTime)
 
 	while (ActiveTimerHeap.Num() > 0)
 	{
-		FTimerData& Top = ActiveTimerHeap.HeapTop();
-		if (InternalTime > Top.ExpireTime)
+		const FTimerHeapEntry Top = ActiveTimerHeap.HeapTop();
+		if (!IsHeapEntryValid(Top))
+		{
+			// The timer was cleared, paused or re-set since this entry was added
+			ActiveTimerHeap.HeapPopDiscard(/*bAllowShrinking=*/ false);
+			NumStaleHeapEntries = FMath::Max(NumStaleHeapEntries - 1, 0);
+		}
+		else if (InternalTime > Top.ExpireTime)
 		{
 			// Timer has expired! Fire the delegate, then handle potential looping.
+			const int32 TimerIndex = FindStoredTimerIndex(Top.TimerHandle);
+			FTimerData& TopTimer = Timers[TimerIndex];
 
 			// Set the relevant level context for this timer
 			const FLevelCollection* LevelCollection = nullptr;
@@ -550,15 +523,20 @@ void FTimerManager::Tick(float DeltaTime)
 			UWorld* const OwningWorld = OwningGameInstance ? OwningGameInstance->GetWorld() : nullptr;
 			if (OwningGameInstance && OwningWorld)
 			{
-				LevelCollection = OwningWorld->FindCollectionByType(Top.LevelCollection);
+				LevelCollection = OwningWorld->FindCollectionByType(TopTimer.LevelCollection);
 				LevelCollectionWorld = OwningWorld;
 			}
 
 			FScopedLevelCollectionContextSwitch LevelContext(LevelCollection, LevelCollectionWorld);
 
-			// Remove it from the heap and store it while we're executing
-			ActiveTimerHeap.HeapPop(CurrentlyExecutingTimer, /*bAllowShrinking=*/ false);
+			// Remove it from the heap and store it while we're executing. Its entry stays reserved so a looping timer keeps its handle,
+			// but the delegate must not execute from Timers since the delegate may add timers.
+			ActiveTimerHeap.HeapPopDiscard(/*bAllowShrinking=*/ false);
+			CurrentlyExecutingTimer = MoveTemp(TopTimer);
 			CurrentlyExecutingTimer.Status = ETimerStatus::Executing;
+			CurrentlyExecutingTimerIndex = TimerIndex;
+			TopTimer.Clear();
+			TopTimer.Status = ETimerStatus::Executing;
 
 			// Determine how many times the timer may have elapsed (e.g. for large DeltaTime on a short looping timer)
 			int32 const CallCount = CurrentlyExecutingTimer.bLoop ? 
@@ -577,20 +555,30 @@ void FTimerManager::Tick(float DeltaTime)
 				}
 			}
 
-			// Status test needed to ensure it didn't get cleared during execution
-			if( CurrentlyExecutingTimer.bLoop && CurrentlyExecutingTimer.Status == ETimerStatus::Executing )
+			// The entry is no longer reserved if the timer was paused during execution
+			FTimerData& StoredTimer = Timers[TimerIndex];
+			if (StoredTimer.Status == ETimerStatus::Executing)
 			{
+				// Status test needed to ensure it didn't get cleared during execution
 				// if timer requires a delegate, make sure it's still validly bound (i.e. the delegate's object didn't get deleted or something)
-				if (!CurrentlyExecutingTimer.bRequiresDelegate || CurrentlyExecutingTimer.TimerDelegate.IsBound())
+				if (CurrentlyExecutingTimer.bLoop && CurrentlyExecutingTimer.Status == ETimerStatus::Executing && CurrentlyExecutingTimer.TimerHandle.IsValid() &&
+					(!CurrentlyExecutingTimer.bRequiresDelegate || CurrentlyExecutingTimer.TimerDelegate.IsBound()))
 				{
 					// Put this timer back on the heap
 					CurrentlyExecutingTimer.ExpireTime += CallCount * CurrentlyExecutingTimer.Rate;
 					CurrentlyExecutingTimer.Status = ETimerStatus::Active;
-					ActiveTimerHeap.HeapPush(CurrentlyExecutingTimer);
+					StoredTimer = MoveTemp(CurrentlyExecutingTimer);
+					PushActiveTimer(StoredTimer);
+				}
+				else
+				{
+					RemoveRelocatedTimerIndex(Top.TimerHandle, TimerIndex);
+					Timers.RemoveAt(TimerIndex);
 				}
 			}
 
 			CurrentlyExecutingTimer.Clear();
+			CurrentlyExecutingTimerIndex = INDEX_NONE;
 		}
 		else
 		{
@@ -605,13 +593,17 @@ void FTimerManager::Tick(float DeltaTime)
 	// If we have any Pending Timers, add them to the Active Queue.
 	if( PendingTimerList.Num() > 0 )
 	{
-		for(int32 Index=0; Index<PendingTimerList.Num(); Index++)
+		for (const FTimerHandle& PendingHandle : PendingTimerList)
 		{
-			FTimerData& TimerToActivate = PendingTimerList[Index];
-			// Convert from time remaining back to a valid ExpireTime
-			TimerToActivate.ExpireTime += InternalTime;
-			TimerToActivate.Status = ETimerStatus::Active;
-			ActiveTimerHeap.HeapPush( TimerToActivate );
+			// Timers cleared, paused or already activated since they were added are skipped
+			FTimerData* TimerToActivate = FindStoredTimer(PendingHandle);
+			if (TimerToActivate && TimerToActivate->Status == ETimerStatus::Pending)
+			{
+				// Convert from time remaining back to a valid ExpireTime
+				TimerToActivate->ExpireTime += InternalTime;
+				TimerToActivate->Status = ETimerStatus::Active;
+				PushActiveTimer(*TimerToActivate);
+			}
 		}
 		PendingTimerList.Reset();
 	}
@@ -624,36 +616,36 @@ TStatId FTimerManager::GetStatId() const
 
 void FTimerManager::ListTimers() const
 {
-	UE_LOG(LogEngine, Log, TEXT("------- %d Active Timers -------"), ActiveTimerHeap.Num());
-	for(const FTimerData& Data : ActiveTimerHeap)
-	{
-		FString TimerString = Data.TimerDelegate.ToString();
-		UE_LOG(LogEngine, Log, TEXT("%s"), *TimerString);
-	}
-
-	UE_LOG(LogEngine, Log, TEXT("------- %d Paused Timers -------"), PausedTimerList.Num());
-	for (const FTimerData& Data : PausedTimerList)
+	int32 NumTimersByStatus[4] = { 0, 0, 0, 0 };
+	for (const FTimerData& Data : Timers)
 	{
-		FString TimerString = Data.TimerDelegate.ToString();
-		UE_LOG(LogEngine, Log, TEXT("%s"), *TimerString);
+		NumTimersByStatus[(int32)Data.Status]++;
 	}
 
-	UE_LOG(LogEngine, Log, TEXT("------- %d Pending Timers -------"), PendingTimerList.Num());
-	for (const FTimerData& Data : PendingTimerList)
+	const TCHAR* StatusNames[] = { TEXT("Pending"), TEXT("Active"), TEXT("Paused"), TEXT("Executing") };
+	for (const ETimerStatus Status : { ETimerStatus::Active, ETimerStatus::Paused, ETimerStatus::Pending })
 	{
-		FString TimerString = Data.TimerDelegate.ToString();
-		UE_LOG(LogEngine, Log, TEXT("%s"), *TimerString);
+		UE_LOG(LogEngine, Log, TEXT("------- %d %s Timers -------"), NumTimersByStatus[(int32)Status], StatusNames[(int32)Status]);
+		for (const FTimerData& Data : Timers)
+		{
+			if (Data.Status == Status)
+			{
+				FString TimerString = Data.TimerDelegate.ToString();
+				UE_LOG(LogEngine, Log, TEXT("%s"), *TimerString);
+			}
+		}
 	}
 
-	UE_LOG(LogEngine, Log, TEXT("------- %d Total Timers -------"), PendingTimerList.Num() + PausedTimerList.Num() + ActiveTimerHeap.Num());
+	UE_LOG(LogEngine, Log, TEXT("------- %d Total Timers -------"), Timers.Num());
 }
 
 void FTimerManager::ValidateHandle(FTimerHandle& InOutHandle)
 {
 	if (!InOutHandle.IsValid())
 	{
-		++LastAssignedHandle;
-		InOutHandle.Handle = LastAssignedHandle;
+		// The serial number is never reused, so this handle will not identify any timer until it is passed to SetTimer
+		++LastAssignedSerialNumber;
+		InOutHandle.SetIndexAndSerialNumber(0, LastAssignedSerialNumber);
 	}
 
 	checkf(InOutHandle.IsValid(), TEXT("Timer handle has wrapped around to 0!"));
@@ -269,6 +269,95 @@ bool TimerManagerTest_LoopingTimers_DifferentHandles(UWorld* World, FAutomationT
 	return true;
 }
 
+// Make sure that handles of cleared timers do not identify the timers that reuse their storage, and that cleared timers do not fire
+bool TimerManagerTest_ReusedTimerStorage(UWorld* World, FAutomationTestBase* Test)
+{
+	FTimerManager& TimerManager = World->GetTimerManager();
+
+	FDummy Dummy;
+	FTimerDelegate Delegate;
+	Delegate.BindRaw(&Dummy, &FDummy::Callback);
+
+	const int32 NumTimers = 200;
+	TArray<FTimerHandle> Handles;
+	Handles.AddDefaulted(NumTimers);
+	for (int32 Index = 0; Index < NumTimers; ++Index)
+	{
+		TimerManager.SetTimer(Handles[Index], Delegate, 0.5f, false);
+	}
+	TimerTest_TickWorld(World, KINDA_SMALL_NUMBER);
+
+	// clear every other timer, once they are active
+	TArray<FTimerHandle> ClearedHandles;
+	for (int32 Index = 0; Index < NumTimers; Index += 2)
+	{
+		ClearedHandles.Add(Handles[Index]);
+		TimerManager.ClearTimer(Handles[Index]);
+	}
+
+	// new timers reuse the storage of the cleared ones
+	FTimerHandle NewHandle;
+	TimerManager.SetTimer(NewHandle, Delegate, 5.f, false);
+	for (const FTimerHandle& ClearedHandle : ClearedHandles)
+	{
+		Test->TestFalse(TIMER_TEST_TEXT("TimerExists called with the handle of a cleared timer"), TimerManager.TimerExists(ClearedHandle));
+		Test->TestTrue(TIMER_TEST_TEXT("Handle of a cleared timer differs from a new one"), ClearedHandle != NewHandle);
+	}
+	Test->TestTrue(TIMER_TEST_TEXT("TimerExists called with a new timer"), TimerManager.TimerExists(NewHandle));
+
+	TimerTest_TickWorld(World, 1.f);
+
+	Test->TestTrue(TIMER_TEST_TEXT("Count of callback executions"), Dummy.Count == NumTimers / 2);
+	Test->TestTrue(TIMER_TEST_TEXT("New timer is still active"), TimerManager.IsTimerActive(NewHandle));
+
+	TimerManager.ClearTimer(NewHandle);
+	Test->TestFalse(TIMER_TEST_TEXT("TimerExists called with a cleared timer"), TimerManager.TimerExists(NewHandle));
+
+	return true;
+}
+
+// Make sure that setting a timer again keeps its handle, so copies of the handle still identify the timer
+bool TimerManagerTest_HandleKeptWhenSetAgain(UWorld* World, FAutomationTestBase* Test)
+{
+	FTimerManager& TimerManager = World->GetTimerManager();
+
+	FDummy Dummy;
+	FTimerDelegate Delegate;
+	Delegate.BindRaw(&Dummy, &FDummy::Callback);
+
+	FTimerHandle Handle;
+	TimerManager.SetTimer(Handle, Delegate, 1.f, false);
+	const FTimerHandle HandleCopy = Handle;
+
+	TimerManager.SetTimer(Handle, Delegate, 2.f, false);
+	Test->TestTrue(TIMER_TEST_TEXT("Handle is kept when an existing timer is set again"), Handle == HandleCopy);
+	Test->TestTrue(TIMER_TEST_TEXT("Copy of the handle identifies the timer set again"), TimerManager.TimerExists(HandleCopy));
+
+	TimerManager.SetTimer(Handle, Delegate, 0.f, false);
+	Test->TestTrue(TIMER_TEST_TEXT("Handle is kept when a timer is set with a rate of 0"), Handle == HandleCopy);
+	Test->TestFalse(TIMER_TEST_TEXT("Setting a rate of 0 clears the timer"), TimerManager.TimerExists(HandleCopy));
+
+	// another timer takes the entry of the cleared one, setting the old handle again has to store it elsewhere
+	FTimerHandle OtherHandle;
+	TimerManager.SetTimer(OtherHandle, Delegate, 1.f, false);
+	TimerManager.SetTimer(Handle, Delegate, 1.5f, false);
+	Test->TestTrue(TIMER_TEST_TEXT("Handle is kept when its timer was cleared"), Handle == HandleCopy);
+	Test->TestTrue(TIMER_TEST_TEXT("Copy of the handle identifies the timer set again after being cleared"), TimerManager.TimerExists(HandleCopy));
+	Test->TestTrue(TIMER_TEST_TEXT("Other timer is unaffected"), TimerManager.TimerExists(OtherHandle));
+
+	TimerManager.PauseTimer(HandleCopy);
+	Test->TestTrue(TIMER_TEST_TEXT("Copy of the handle pauses the timer"), TimerManager.IsTimerPaused(Handle));
+	Test->TestFalse(TIMER_TEST_TEXT("Other timer is not paused"), TimerManager.IsTimerPaused(OtherHandle));
+	TimerManager.UnPauseTimer(HandleCopy);
+
+	TimerTest_TickWorld(World, KINDA_SMALL_NUMBER);
+	TimerTest_TickWorld(World, 2.f);
+	Test->TestTrue(TIMER_TEST_TEXT("Count of callback executions"), Dummy.Count == 2);
+	Test->TestFalse(TIMER_TEST_TEXT("Timer expired"), TimerManager.TimerExists(HandleCopy));
+
+	return true;
+}
+
 bool FTimerManagerTest::RunTest(const FString& Parameters)
 {
 	UWorld *World = UWorld::CreateWorld(EWorldType::Game, false);
@@ -283,6 +372,8 @@ bool FTimerManagerTest::RunTest(const FString& Parameters)
 	TimerManagerTest_MissingTimers(World, this);
 	TimerManagerTest_ValidTimer_HandleWithDelegate(World, this);
 	TimerManagerTest_ValidTimer_HandleLoopingSetDuringExecute(World, this);
+	TimerManagerTest_ReusedTimerStorage(World, this);
+	TimerManagerTest_HandleKeptWhenSetAgain(World, this);
 	TimerManagerTest_LoopingTimers_DifferentHandles(World, this);
 
 	GEngine->DestroyWorldContext(World);
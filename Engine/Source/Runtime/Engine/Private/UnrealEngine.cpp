@@ -116,6 +116,7 @@
 #include "GameDelegates.h"
 #include "PhysicsEngine/BodySetup.h"
 #include "Engine/LevelStreamingVolume.h"
+#include "Engine/LevelStreamingGridCell.h"
 #include "Engine/WorldComposition.h"
 #include "Engine/LevelScriptActor.h"
 #include "IHardwareSurveyModule.h"
@@ -253,6 +254,17 @@ TAutoConsoleVariable<int32> CVarAllowOneFrameThreadLag(
 	TEXT("Whether to allow the rendering thread to lag one frame behind the game thread (0: disabled, otherwise enabled)")
 	);
 
+TAutoConsoleVariable<int32> CVarFrameThreadLag(
+	TEXT("r.FrameThreadLag"),
+	-1,
+	TEXT("Number of frames the rendering thread may lag behind the game thread, overrides r.OneFrameThreadLag.\n")
+	TEXT("More frames in flight hide render thread hitches at the cost of input latency.\n")
+	TEXT("-1: use r.OneFrameThreadLag (default)\n")
+	TEXT(" 0: the game thread waits for the rendering thread every frame\n")
+	TEXT(" 1..2: number of frames of lag"));
+
+ENGINE_API uint32 GGameThreadWaitForRenderThreadTime = 0;
+
 static FAutoConsoleVariable CVarSystemResolution(
 	TEXT("r.SetRes"),
 	TEXT("1280x720w"),
@@ -3226,6 +3238,12 @@ bool UEngine::HandleDumpTicksCommand( UWorld* InWorld, const TCHAR* Cmd, FOutput
 	{
 		bShowEnabled = false;
 	}
+	else if (FParse::Command( &Cmd, TEXT( "CRITICAL" ) ))
+	{
+		FTickTaskManagerInterface::Get().CaptureNextFrameTickGraph();
+		Ar.Logf( TEXT( "Capturing the tick graph of the next frame." ) );
+		return true;
+	}
 	FTickTaskManagerInterface::Get().DumpAllTickFunctions( Ar, InWorld, bShowEnabled, bShowDisabled );
 	return true;
 }
@@ -8422,6 +8440,7 @@ DEFINE_STAT(STAT_UpdateLevelStreaming);
 DEFINE_STAT(STAT_RHITickTime);
 DEFINE_STAT(STAT_IntentionalHitch);
 DEFINE_STAT(STAT_FrameSyncTime);
+DEFINE_STAT(STAT_GameThreadWaitForRenderThread);
 DEFINE_STAT(STAT_DeferredTickTime);
 
 /** Input stat */
@@ -8473,9 +8492,17 @@ UFont* GetStatsFont()
  * sync or a one frame lag.
  */
 void FFrameEndSync::Sync( bool bAllowOneFrameThreadLag )
+{
+	Sync(bAllowOneFrameThreadLag ? 1 : 0);
+}
+
+void FFrameEndSync::Sync( int32 FrameThreadLag )
 {
 	check(IsInGameThread());			
 
+	const int32 NumFences = ARRAY_COUNT(Fence);
+	FrameThreadLag = FMath::Clamp<int32>(FrameThreadLag, 0, MaxFrameThreadLag);
+
 	Fence[EventIndex].BeginFence();
 
 	bool bEmptyGameThreadTasks = !FTaskGraphInterface::Get().IsThreadProcessingTasks(ENamedThreads::GameThread);
@@ -8486,14 +8513,16 @@ void FFrameEndSync::Sync( bool bAllowOneFrameThreadLag )
 		FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
 	}
 
-	// Use two events if we allow a one frame lag.
-	if( bAllowOneFrameThreadLag )
-	{
-		EventIndex = (EventIndex + 1) % 2;
-	}
+	// Wait for the fence issued FrameThreadLag frames ago, which is the current one if no lag is allowed.
+	// Fences skipped when the lag is lowered don't need waiting for, the render thread completes them in order.
+	const int32 WaitIndex = (EventIndex + NumFences - FrameThreadLag) % NumFences;
+	EventIndex = (EventIndex + 1) % NumFences;
 
-	Fence[EventIndex].Wait(bEmptyGameThreadTasks);  // here we also opportunistically execute game thread tasks while we wait
+	const uint32 StartWaitCycles = FPlatformTime::Cycles();
+	Fence[WaitIndex].Wait(bEmptyGameThreadTasks);  // here we also opportunistically execute game thread tasks while we wait
+	GGameThreadWaitForRenderThreadTime = FPlatformTime::Cycles() - StartWaitCycles;
 
+	SET_FLOAT_STAT(STAT_GameThreadWaitForRenderThread, FPlatformTime::ToMilliseconds(GGameThreadWaitForRenderThreadTime));
 }
 
 FString appGetStartupMap(const TCHAR* CommandLine)
@@ -10331,6 +10360,7 @@ void UEngine::BlockTillLevelStreamingCompleted(UWorld* InWorld)
 	
 	// Update streaming levels state using streaming volumes
 	InWorld->ProcessLevelStreamingVolumes();
+	ULevelStreamingGridCell::UpdateStreamingState(InWorld);
 
 	if (InWorld->WorldComposition)
 	{
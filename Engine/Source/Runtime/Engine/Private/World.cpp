@@ -22,6 +22,7 @@
 #include "Serialization/AsyncLoading.h"
 #include "GameMapsSettings.h"
 #include "TimerManager.h"
+#include "ActorPool.h"
 #include "Materials/MaterialInterface.h"
 #include "GameFramework/Controller.h"
 #include "AI/Navigation/NavigationSystem.h"
@@ -308,6 +309,7 @@ UWorld::UWorld( const FObjectInitializer& ObjectInitializer )
 ,	NextTravelType(TRAVEL_Relative)
 {
 	TimerManager = new FTimerManager();
+	ActorPool = new FActorPool(this);
 #if WITH_EDITOR
 	bBroadcastSelectionChange = true; //Ed Only
 	EditorViews.SetNum(ELevelViewportType::LVT_MAX);
@@ -738,6 +740,8 @@ void UWorld::FinishDestroy()
 		delete TimerManager;
 	}
 
+	delete ActorPool;
+
 #if WITH_EDITOR
 	if (HierarchicalLODBuilder)
 	{
@@ -2002,6 +2006,9 @@ void UWorld::AddToWorld( ULevel* Level, const FTransform& LevelTransform )
 		// Mark level as being the one in process of being made visible.
 		CurrentLevelPendingVisibility = Level;
 
+		// Start routing actor initialization from the beginning, whatever state a previous visit left behind
+		Level->ResetRouteActorInitialization();
+
 		// Add to the UWorld's array of levels, which causes it to be rendered et al.
 		Levels.AddUnique( Level );
 		
@@ -2142,11 +2149,14 @@ void UWorld::AddToWorld( ULevel* Level, const FTransform& LevelTransform )
 		{
 			SCOPE_TIME_TO_VAR(&RouteActorInitializeTime);
 			bStartup = 1;
-			Level->RouteActorInitialize();
-			Level->bAlreadyRoutedActorInitialize = true;
+			do
+			{
+				Level->bAlreadyRoutedActorInitialize = Level->IncrementalRouteActorInitialize(bConsiderTimeLimit ? GLevelStreamingRouteActorInitializationGranularity : 0);
+			}
+			while (!Level->bAlreadyRoutedActorInitialize && !IsTimeLimitExceeded( TEXT("routing Initialize on actors"), StartTime, Level ));
 			bStartup = 0;
 
-			bExecuteNextStep = (!bConsiderTimeLimit || !IsTimeLimitExceeded( TEXT("routing Initialize on actors"), StartTime, Level ));
+			bExecuteNextStep = Level->bAlreadyRoutedActorInitialize && (!bConsiderTimeLimit || !IsTimeLimitExceeded( TEXT("routing Initialize on actors"), StartTime, Level ));
 		}
 
 		// Sort the actor list; can't do this on save as the relevant properties for sorting might have been changed by code
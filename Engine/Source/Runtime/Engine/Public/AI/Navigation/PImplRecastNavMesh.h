@@ -111,8 +111,9 @@ public:
 	/** Supported queries */
 
 	// @TODONAV
-	/** Generates path from the given query. Synchronous. */
-	ENavigationQueryResult::Type FindPath(const FVector& StartLoc, const FVector& EndLoc, FNavMeshPath& Path, const FNavigationQueryFilter& Filter, const UObject* Owner) const;
+	/** Generates path from the given query. Synchronous.
+	 *	@param bUseClusterCorridor if set, path is searched on cluster graph first and refined only on polys of found clusters, falling back to regular search if that fails */
+	ENavigationQueryResult::Type FindPath(const FVector& StartLoc, const FVector& EndLoc, FNavMeshPath& Path, const FNavigationQueryFilter& Filter, const UObject* Owner, const bool bUseClusterCorridor = false) const;
 
 	/** Check if path exists */
 	ENavigationQueryResult::Type TestPath(const FVector& StartLoc, const FVector& EndLoc, const FNavigationQueryFilter& Filter, const UObject* Owner, int32* NumVisitedNodes = 0) const;
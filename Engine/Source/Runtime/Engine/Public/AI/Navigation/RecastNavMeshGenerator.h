@@ -438,7 +438,7 @@ protected:
 	// Updates cached list of navigation bounds
 	void UpdateNavigationBounds();
 		
-	// Sorts pending build tiles by proximity to player, so tiles closer to player will get generated first
+	// Sorts pending build tiles by proximity to players and navigation invokers, so tiles closer to them will get generated first
 	void SortPendingBuildTiles();
 
 	/** Instantiates dtNavMesh and configures it for tiles generation. Returns false if failed */
@@ -450,8 +450,8 @@ protected:
 	/** Marks grid tiles affected by specified areas as dirty */
 	void MarkDirtyTiles(const TArray<FNavigationDirtyArea>& DirtyAreas);
 	
-	/** Processes pending tile generation tasks */
-	TArray<uint32> ProcessTileTasks(const int32 NumTasksToSubmit);
+	/** Processes pending tile generation tasks, stopping submission once TimeBudgetSeconds is spent if it's positive */
+	TArray<uint32> ProcessTileTasks(const int32 NumTasksToSubmit, const float TimeBudgetSeconds = 0.f);
 
 public:
 	/** Adds generated tiles to NavMesh, replacing old ones */
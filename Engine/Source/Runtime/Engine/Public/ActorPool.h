@@ -0,0 +1,69 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	ActorPool.h: Reuse of deactivated actors instead of spawning new ones
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+#include "Engine/EngineTypes.h"
+
+class AActor;
+class APawn;
+class UWorld;
+
+/**
+ * Keeps deactivated actors of a world so gameplay can hand them out again instead of paying for SpawnActor and DestroyActor.
+ * Pooled actors stay in their level with their components registered, but are hidden, have collision and ticking disabled
+ * and are put to dormancy if they replicate.
+ * Only actors that set bCanBePooled can be pooled; AActor::OnReturnedToPool and AActor::OnAcquiredFromPool let them reset their own state.
+ * Pooled actors are held weakly and are never handed out from levels that aren't visible, so pooling doesn't change level streaming lifetime.
+ */
+class ENGINE_API FActorPool
+{
+public:
+	FActorPool(UWorld* InWorld);
+
+	/**
+	 * Returns a pooled actor of exactly the given class, reactivated and moved to Transform, or nullptr if none is available.
+	 * @param Class		The class of actor to reuse.
+	 * @param Transform	Where to place the actor.
+	 * @param Owner		The owner to give the actor; pooled actors don't keep their previous owner.
+	 * @param Instigator	The instigator to give the actor.
+	 */
+	AActor* Acquire(UClass* Class, const FTransform& Transform, AActor* Owner = nullptr, APawn* Instigator = nullptr);
+
+	/**
+	 * Deactivates the actor and keeps it for reuse.
+	 * @return false if the actor can't be pooled or the pool for its class is full, in which case the caller should destroy it.
+	 */
+	bool Release(AActor* Actor);
+
+	/** Releases the actor to the pool, destroying it if it can't be pooled. */
+	void ReleaseOrDestroy(AActor* Actor);
+
+	/** Returns the number of actors of this class waiting in the pool. */
+	int32 GetNumPooled(UClass* Class) const;
+
+	/** Destroys all pooled actors. */
+	void Empty();
+
+private:
+	struct FPooledActor
+	{
+		TWeakObjectPtr<AActor> Actor;
+
+		/** Dormancy of the actor when it was released, restored when it is acquired */
+		TEnumAsByte<ENetDormancy> NetDormancy;
+	};
+
+	/** Whether a pooled actor can be handed out right now */
+	bool CanAcquire(const AActor* Actor) const;
+
+	UWorld* World;
+
+	/** Pooled actors, by exact class */
+	TMap<TWeakObjectPtr<UClass>, TArray<FPooledActor>> PooledActors;
+};
@@ -107,6 +107,29 @@ public:
 template<int32 FORMAT>
 class AEFConstantKeyLerp : public AEFConstantKeyLerpShared
 {
+	/**
+	 * Keys are evenly spaced, so every track with the same number of keys interpolates the same key pair.
+	 * Animated tracks usually all have one key per frame, so the pair is only found once per pose.
+	 */
+	struct FKeyPairCache
+	{
+		int32 NumKeys;
+		int32 Index0;
+		int32 Index1;
+		float Alpha;
+
+		FKeyPairCache() : NumKeys(INDEX_NONE), Index0(0), Index1(0), Alpha(0.f) {}
+
+		FORCEINLINE void Update(const UAnimSequence& Seq, float RelativePos, int32 InNumKeys)
+		{
+			if (InNumKeys != NumKeys)
+			{
+				NumKeys = InNumKeys;
+				Alpha = TimeToIndex(Seq, RelativePos, InNumKeys, Index0, Index1);
+			}
+		}
+	};
+
 public:
 	/**
 	 * Decompress the Rotation component of a BoneAtom
@@ -161,6 +184,21 @@ public:
 		int32 NumKeys,
 		float Time,
 		float RelativePos);
+
+	/**
+	 * Decompress the Rotation, Translation or Scale component of a BoneAtom between two keys already found with TimeToIndex
+	 *
+	 * @param	OutAtom			The FTransform to fill in.
+	 * @param	Stream			The compressed animation data.
+	 * @param	NumKeys			The number of keys present in Stream.
+	 * @param	Index0			The key before the time to solve for.
+	 * @param	Index1			The key after the time to solve for.
+	 * @param	Alpha			The rate at which to interpolate the two keys.
+	 */
+	static void GetBoneAtomRotationFromKeys(FTransform& OutAtom, const uint8* RESTRICT Stream, int32 NumKeys, int32 Index0, int32 Index1, float Alpha);
+	static void GetBoneAtomTranslationFromKeys(FTransform& OutAtom, const uint8* RESTRICT Stream, int32 NumKeys, int32 Index0, int32 Index1, float Alpha);
+	static void GetBoneAtomScaleFromKeys(FTransform& OutAtom, const uint8* RESTRICT Stream, int32 NumKeys, int32 Index0, int32 Index1, float Alpha);
+
 #if USE_ANIMATION_CODEC_BATCH_SOLVER
 
 	/**
@@ -231,6 +269,22 @@ FORCEINLINE void AEFConstantKeyLerp<FORMAT>::GetBoneAtomRotation(
 	int32 NumRotKeys,
 	float Time,
 	float RelativePos)
+{
+	int32 Index0;
+	int32 Index1;
+	const float Alpha = TimeToIndex(Seq,RelativePos,NumRotKeys,Index0,Index1);
+
+	GetBoneAtomRotationFromKeys(OutAtom, RotStream, NumRotKeys, Index0, Index1, Alpha);
+}
+
+template<int32 FORMAT>
+FORCEINLINE void AEFConstantKeyLerp<FORMAT>::GetBoneAtomRotationFromKeys(
+	FTransform& OutAtom,
+	const uint8* RESTRICT RotStream,
+	int32 NumRotKeys,
+	int32 Index0,
+	int32 Index1,
+	float Alpha)
 {
 	if (NumRotKeys == 1)
 	{
@@ -241,10 +295,6 @@ FORCEINLINE void AEFConstantKeyLerp<FORMAT>::GetBoneAtomRotation(
 	}
 	else
 	{
-		int32 Index0;
-		int32 Index1;
-		float Alpha = TimeToIndex(Seq,RelativePos,NumRotKeys,Index0,Index1);
-
 		const int32 RotationStreamOffset = (FORMAT == ACF_IntervalFixed32NoW) ? (sizeof(float)*6) : 0; // offset past Min and Range data
 
 		if (Index0 != Index1)
@@ -258,9 +308,13 @@ FORCEINLINE void AEFConstantKeyLerp<FORMAT>::GetBoneAtomRotation(
 			DecompressRotation<FORMAT>( R0, RotStream, KeyData0 );
 			DecompressRotation<FORMAT>( R1, RotStream, KeyData1 );
 
-			// Fast linear quaternion interpolation.
-			FQuat BlendedQuat = FQuat::FastLerp(R0, R1, Alpha);
-			BlendedQuat.Normalize();
+			// Fast linear quaternion interpolation in the shortest direction, same as FQuat::FastLerp but without leaving the vector registers.
+			const VectorRegister Blended = VectorAccumulateQuaternionShortestPath(
+				VectorMultiply(VectorLoadAligned(&R0), VectorSetFloat1(1.f - Alpha)),
+				VectorMultiply(VectorLoadAligned(&R1), VectorSetFloat1(Alpha)));
+
+			FQuat BlendedQuat;
+			VectorStoreAligned(VectorNormalizeQuaternion(Blended), &BlendedQuat);
 			OutAtom.SetRotation( BlendedQuat );
 		}
 		else // (Index0 == Index1)
@@ -296,8 +350,20 @@ FORCEINLINE void AEFConstantKeyLerp<FORMAT>::GetBoneAtomTranslation(
 {
 	int32 Index0;
 	int32 Index1;
-	float Alpha = TimeToIndex(Seq,RelativePos,NumTransKeys,Index0,Index1);
+	const float Alpha = TimeToIndex(Seq,RelativePos,NumTransKeys,Index0,Index1);
 
+	GetBoneAtomTranslationFromKeys(OutAtom, TransStream, NumTransKeys, Index0, Index1, Alpha);
+}
+
+template<int32 FORMAT>
+FORCEINLINE void AEFConstantKeyLerp<FORMAT>::GetBoneAtomTranslationFromKeys(
+	FTransform& OutAtom,
+	const uint8* RESTRICT TransStream,
+	int32 NumTransKeys,
+	int32 Index0,
+	int32 Index1,
+	float Alpha)
+{
 	const int32 TransStreamOffset = ((FORMAT == ACF_IntervalFixed32NoW) && NumTransKeys > 1) ? (sizeof(float)*6) : 0; // offset past Min and Range data
 
 	if (Index0 != Index1)
@@ -341,8 +407,20 @@ FORCEINLINE void AEFConstantKeyLerp<FORMAT>::GetBoneAtomScale(
 {
 	int32 Index0;
 	int32 Index1;
-	float Alpha = TimeToIndex(Seq,RelativePos,NumScaleKeys,Index0,Index1);
+	const float Alpha = TimeToIndex(Seq,RelativePos,NumScaleKeys,Index0,Index1);
+
+	GetBoneAtomScaleFromKeys(OutAtom, ScaleStream, NumScaleKeys, Index0, Index1, Alpha);
+}
 
+template<int32 FORMAT>
+FORCEINLINE void AEFConstantKeyLerp<FORMAT>::GetBoneAtomScaleFromKeys(
+	FTransform& OutAtom,
+	const uint8* RESTRICT ScaleStream,
+	int32 NumScaleKeys,
+	int32 Index0,
+	int32 Index1,
+	float Alpha)
+{
 	const int32 ScaleStreamOffset = ((FORMAT == ACF_IntervalFixed32NoW) && NumScaleKeys > 1) ? (sizeof(float)*6) : 0; // offset past Min and Range data
 
 	if (Index0 != Index1)
@@ -385,6 +463,7 @@ inline void AEFConstantKeyLerp<FORMAT>::GetPoseRotations(
 {
 	const int32 PairCount = DesiredPairs.Num();
 	const float RelativePos = Time / (float)Seq.SequenceLength;
+	FKeyPairCache KeyPairCache;
 
 	for (int32 PairIndex=0; PairIndex<PairCount; ++PairIndex)
 	{
@@ -399,7 +478,8 @@ inline void AEFConstantKeyLerp<FORMAT>::GetPoseRotations(
 		const uint8* RESTRICT RotStream		= Seq.CompressedByteStream.GetData()+RotKeysOffset;
 
 		// call the decoder directly (not through the vtable)
-		AEFConstantKeyLerp<FORMAT>::GetBoneAtomRotation(BoneAtom, Seq, RotStream, NumRotKeys, Time, RelativePos);
+		KeyPairCache.Update(Seq, RelativePos, NumRotKeys);
+		AEFConstantKeyLerp<FORMAT>::GetBoneAtomRotationFromKeys(BoneAtom, RotStream, NumRotKeys, KeyPairCache.Index0, KeyPairCache.Index1, KeyPairCache.Alpha);
 	}
 }
 
@@ -421,6 +501,7 @@ inline void AEFConstantKeyLerp<FORMAT>::GetPoseTranslations(
 {
 	const int32 PairCount= DesiredPairs.Num();
 	const float RelativePos = Time / (float)Seq.SequenceLength;
+	FKeyPairCache KeyPairCache;
 
 	//@TODO: Verify that this prefetch is helping
 	// Prefetch the desired pairs array and 2 destination spots; the loop will prefetch one 2 out each iteration
@@ -451,7 +532,8 @@ inline void AEFConstantKeyLerp<FORMAT>::GetPoseTranslations(
 		const uint8* RESTRICT TransStream = Seq.CompressedByteStream.GetData()+TransKeysOffset;
 
 		// call the decoder directly (not through the vtable)
-		AEFConstantKeyLerp<FORMAT>::GetBoneAtomTranslation(BoneAtom, Seq, TransStream, NumTransKeys, Time, RelativePos);
+		KeyPairCache.Update(Seq, RelativePos, NumTransKeys);
+		AEFConstantKeyLerp<FORMAT>::GetBoneAtomTranslationFromKeys(BoneAtom, TransStream, NumTransKeys, KeyPairCache.Index0, KeyPairCache.Index1, KeyPairCache.Alpha);
 	}
 }
 
@@ -475,6 +557,7 @@ inline void AEFConstantKeyLerp<FORMAT>::GetPoseScales(
 
 	const int32 PairCount= DesiredPairs.Num();
 	const float RelativePos = Time / (float)Seq.SequenceLength;
+	FKeyPairCache KeyPairCache;
 
 	//@TODO: Verify that this prefetch is helping
 	// Prefetch the desired pairs array and 2 destination spots; the loop will prefetch one 2 out each iteration
@@ -504,7 +587,8 @@ inline void AEFConstantKeyLerp<FORMAT>::GetPoseScales(
 		const uint8* RESTRICT ScaleStream = Seq.CompressedByteStream.GetData()+ScaleKeysOffset;
 
 		// call the decoder directly (not through the vtable)
-		AEFConstantKeyLerp<FORMAT>::GetBoneAtomScale(BoneAtom, Seq, ScaleStream, NumScaleKeys, Time, RelativePos);
+		KeyPairCache.Update(Seq, RelativePos, NumScaleKeys);
+		AEFConstantKeyLerp<FORMAT>::GetBoneAtomScaleFromKeys(BoneAtom, ScaleStream, NumScaleKeys, KeyPairCache.Index0, KeyPairCache.Index1, KeyPairCache.Alpha);
 	}
 }
 #endif
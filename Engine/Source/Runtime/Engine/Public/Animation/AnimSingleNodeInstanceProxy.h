@@ -146,6 +146,16 @@ public:
 
 	void SetBlendSpaceInput(const FVector& InBlendInput);
 
+	const FVector& GetBlendSpaceInput() const
+	{
+		return BlendSpaceInput;
+	}
+
+	bool HasPreviewCurveOverride() const
+	{
+		return PreviewCurveOverride.Num() > 0;
+	}
+
 #if WITH_EDITOR
 	bool CanProcessAdditiveAnimations() const
 	{
@@ -80,6 +80,7 @@ DECLARE_DWORD_COUNTER_STAT_EXTERN( TEXT( "Audio Sources" ), STAT_AudioSources, S
 DECLARE_DWORD_COUNTER_STAT_EXTERN( TEXT( "Wave Instances" ), STAT_WaveInstances, STATGROUP_Audio , );
 DECLARE_DWORD_COUNTER_STAT_EXTERN( TEXT( "Wave Instances Dropped" ), STAT_WavesDroppedDueToPriority, STATGROUP_Audio , );
 DECLARE_DWORD_COUNTER_STAT_EXTERN( TEXT( "Audible Wave Instances Dropped" ), STAT_AudibleWavesDroppedDueToPriority, STATGROUP_Audio , );
+DECLARE_DWORD_COUNTER_STAT_EXTERN( TEXT( "Virtual Wave Instances" ), STAT_VirtualWaveInstances, STATGROUP_Audio , );
 DECLARE_DWORD_COUNTER_STAT_EXTERN( TEXT( "Finished delegates called" ), STAT_AudioFinishedDelegatesCalled, STATGROUP_Audio , );
 DECLARE_CYCLE_STAT_EXTERN( TEXT( "Finished delegates time" ), STAT_AudioFinishedDelegates, STATGROUP_Audio , );
 DECLARE_MEMORY_STAT_EXTERN( TEXT( "Audio Memory Used" ), STAT_AudioMemorySize, STATGROUP_Audio , );
@@ -298,6 +299,9 @@ struct ENGINE_API FWaveInstance
 
 	float				StartTime;
 
+	/** Playback position tracked while the wave instance is virtual, used to resume it where it would have been */
+	float				VirtualPlaybackTime;
+
 	/** Set to true if the sound nodes state that the radio filter should be applied */
 	uint32				bApplyRadioFilter:1;
 
@@ -305,6 +309,8 @@ struct ENGINE_API FWaveInstance
 	uint32				bIsStarted:1;
 	/** Whether wave instanced is finished */
 	uint32				bIsFinished:1;
+	/** Whether the wave instance is playing virtually, i.e. kept alive without a sound source */
+	uint32				bIsVirtual:1;
 	/** Whether the notify finished hook has been called since the last update/parsenodes */
 	uint32				bAlreadyNotifiedHook:1;
 	/** Whether to use spatialization */
@@ -1064,6 +1064,12 @@ protected:
 	 */
 	void StopSources(TArray<FWaveInstance*>& WaveInstances, int32 FirstActiveIndex);
 
+	/** Stops the source, keeping its wave instance alive as a virtual voice that resumes at the same position once it gets a source again */
+	void StopSourceAndVirtualize(FSoundSource* Source);
+
+	/** Advances the playback time of wave instances that are playing virtually */
+	void UpdateVirtualWaveInstances(TArray<FWaveInstance*>& WaveInstances, bool bGameTicking);
+
 	/**
 	 * Start and/or update any sources that have a high enough priority to play
 	 */
@@ -1320,6 +1326,9 @@ public:
 	/** Whether or not virtual sounds are enabled, */
 	bool VirtualSoundsEnabled() const { return bAllowVirtualizedSounds; }
 
+	/** Whether the wave instance can keep playing virtually, tracking its playback time without a sound source, while it is silent or dropped for priority. */
+	bool CanVirtualizeWaveInstance(const FWaveInstance* WaveInstance) const;
+
 	bool IsMainAudioDevice()
 	{
 		FAudioDevice* MainAudioDevice = GEngine->GetMainAudioDevice();
@@ -11,3 +11,6 @@ extern ENGINE_API bool						GDisallowNetworkTravel;
 
 /** The GPU time taken to render the last frame. Same metric as FPlatformTime::Cycles(). */
 extern ENGINE_API uint32					GGPUFrameTime;
+
+/** How long the game thread waited for the rendering thread at the end of the last frame. Same metric as FPlatformTime::Cycles(). */
+extern ENGINE_API uint32					GGameThreadWaitForRenderThreadTime;
@@ -19,6 +19,8 @@
 // * fixed amount of memory per Scene (r.SkinCache.SceneMemoryLimitInMB)
 // * Velocity Rendering for MotionBlur and TemporalAA (test Velocity in BasePass)
 // * r.SkinCache.Mode and r.SkinCache.RecomputeTangents can be toggled at runtime
+// * Entries not used for r.SkinCache.EvictUnusedFrames are evicted (least recently used first) when the memory limit is reached
+// * Sections are not skinned again when the bone transforms did not change (r.SkinCache.SkipUnchangedBones)
 
 // TODO:
 // * Test: Tessellation
@@ -86,7 +88,7 @@ public:
 
 	void ProcessEntry(FRHICommandListImmediate& RHICmdList, FGPUBaseSkinVertexFactory* VertexFactory,
 		FGPUSkinPassthroughVertexFactory* TargetVertexFactory, const FSkelMeshSection& BatchElement, FSkeletalMeshObjectGPUSkin* Skin,
-		const FMorphVertexBuffer* MorphVertexBuffer, uint32 FrameNumber, int32 Section, FGPUSkinCacheEntry*& InOutEntry);
+		const FMorphVertexBuffer* MorphVertexBuffer, uint32 FrameNumber, int32 Section, bool bBonesChanged, FGPUSkinCacheEntry*& InOutEntry);
 
 	static void SetVertexStreams(FGPUSkinCacheEntry* Entry, int32 Section, FRHICommandList& RHICmdList, uint32 FrameNumber,
 		class FShader* Shader, const FGPUSkinPassthroughVertexFactory* VertexFactory,
@@ -164,7 +166,11 @@ protected:
 	//#todo-gpuskin Convert to linked list
 	TArray<FAllocation*> Allocations;
 	TArray<FGPUSkinCacheEntry*> Entries;
-	FAllocation* TryAllocBuffer(uint32 NumFloatsRequired);
+	FAllocation* TryAllocBuffer(uint32 NumFloatsRequired, uint32 FrameNumber);
+	void ReleaseAllocation(FAllocation* Allocation);
+
+	/** Releases the sections of the least recently used entries until RequiredMemInBytes fits in the budget, returns whether it does */
+	bool EvictUnusedEntries(uint64 RequiredMemInBytes, uint64 MaxSizeInBytes, uint32 FrameNumber);
 	void DoDispatch(FRHICommandListImmediate& RHICmdList, FGPUSkinCacheEntry* SkinCacheEntry, int32 Section, int32 FrameNumber);
 	void DispatchUpdateSkinTangents(FRHICommandListImmediate& RHICmdList, FGPUSkinCacheEntry* Entry, int32 SectionIndex);
 	void DispatchUpdateSkinning(FRHICommandListImmediate& RHICmdList, FGPUSkinCacheEntry* Entry, int32 Section, uint32 FrameNumber);
@@ -196,3 +202,7 @@ DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Num Triangles for Recompute Tangents"),
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Num Sections Processed"), STAT_GPUSkinCache_NumSectionsProcessed, STATGROUP_GPUSkinCache, );
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Num SetVertexStreams"), STAT_GPUSkinCache_NumSetVertexStreams, STATGROUP_GPUSkinCache, );
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Num PreGDME"), STAT_GPUSkinCache_NumPreGDME, STATGROUP_GPUSkinCache, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Num Sections Skipped (Unchanged Bones)"), STAT_GPUSkinCache_NumSectionsSkipped, STATGROUP_GPUSkinCache, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Num Sections Evicted"), STAT_GPUSkinCache_NumSectionsEvicted, STATGROUP_GPUSkinCache, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Num Allocation Overflows"), STAT_GPUSkinCache_NumOverflows, STATGROUP_GPUSkinCache, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Memory Budget"), STAT_GPUSkinCache_MemoryBudget, STATGROUP_GPUSkinCache, );
@@ -1453,13 +1453,16 @@ public:
 
 	/**
 	 * Caches uniform expressions for efficient runtime evaluation.
+	 * @param bQueueForDeferredUpdate - Evaluate the expressions once before the next scene is rendered instead of right away,
+	 *		so several parameter changes in a frame only cost one evaluation.
 	 */
-	void ENGINE_API CacheUniformExpressions();
+	void ENGINE_API CacheUniformExpressions(bool bQueueForDeferredUpdate = false);
 
 	/**
 	 * Enqueues a rendering command to cache uniform expressions for efficient runtime evaluation.
+	 * @param bQueueForDeferredUpdate - See CacheUniformExpressions.
 	 */
-	void ENGINE_API CacheUniformExpressions_GameThread();
+	void ENGINE_API CacheUniformExpressions_GameThread(bool bQueueForDeferredUpdate = false);
 
 	/**
 	 * Invalidates the uniform expression cache.
@@ -1496,6 +1499,9 @@ public:
 		return MaterialRenderProxyMap;
 	}
 
+	/** Caches the uniform expressions of all proxies queued with CacheUniformExpressions(true), called on the rendering thread before rendering a scene. */
+	ENGINE_API static void UpdateDeferredCachedUniformExpressions();
+
 	void SetSubsurfaceProfileRT(const USubsurfaceProfile* Ptr) { SubsurfaceProfileRT = Ptr; }
 	const USubsurfaceProfile* GetSubsurfaceProfileRT() const { return SubsurfaceProfileRT; }
 
@@ -1542,6 +1548,9 @@ private:
 	 * This is used to propagate new shader maps to materials being used for rendering.
 	 */
 	ENGINE_API static TSet<FMaterialRenderProxy*> MaterialRenderProxyMap;
+
+	/** Proxies waiting for UpdateDeferredCachedUniformExpressions, can only be accessed on the rendering thread. */
+	static TSet<FMaterialRenderProxy*> DeferredUniformExpressionCacheRequests;
 };
 
 /**
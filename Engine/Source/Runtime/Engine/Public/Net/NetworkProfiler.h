@@ -16,7 +16,7 @@ struct FURL;
 
 #if USE_NETWORK_PROFILER 
 
-#define NETWORK_PROFILER( x ) if ( GNetworkProfiler.IsTrackingEnabled() ) { x; }
+#define NETWORK_PROFILER( x ) if ( GNetworkProfiler.IsTrackingEnabled() || GNetworkProfiler.IsLiveTrackingEnabled() ) { x; }
 
 /*=============================================================================
 	Network profiler header.
@@ -89,6 +89,8 @@ private:
 	bool									bHasNoticeableNetworkTrafficOccured;
 	/** Whether tracking is enabled.																*/
 	bool									bIsTrackingEnabled;	
+	/** Whether the live bandwidth summary reported by net.TopBandwidth is gathered.				*/
+	bool									bIsLiveTrackingEnabled;
 
 	/** Header for the current session.																*/
 	FNetworkProfilerHeader					CurrentHeader;
@@ -103,6 +105,9 @@ private:
 		uint8 ChannelType;
 		uint16 NumHeaderBits;
 		uint16 NumPayloadBits;
+		/** Actor of the channel the bunch was sent on, only set for the live bandwidth summary */
+		FName ActorName;
+		FName ActorClassName;
 
 		FSendBunchInfo()
 			: ChannelIndex(0)
@@ -125,24 +130,94 @@ private:
 	{
 		UNetConnection* Connection;
 		UObject* TargetObject;
+		const UFunction* Function;
 		uint32 ActorNameIndex;
 		uint32 FunctionNameIndex;
 		uint16 NumHeaderBits;
 		uint16 NumParameterBits;
 		uint16 NumFooterBits;
+		/** Whether the name indices were added to the name table of the current file capture */
+		bool bHasNameIndices;
 
 		FQueuedRPCInfo()
 			: Connection(nullptr)
 			, TargetObject(nullptr)
+			, Function(nullptr)
 			, ActorNameIndex(0)
 			, FunctionNameIndex(0)
 			, NumHeaderBits(0)
 			, NumParameterBits(0)
-			, NumFooterBits(0) {}
+			, NumFooterBits(0)
+			, bHasNameIndices(false) {}
 	};
 	
 	TArray<FQueuedRPCInfo> QueuedRPCs;
 
+	/** Categories of the live bandwidth summary */
+	enum ELiveBandwidthCategory
+	{
+		LBC_Actor,
+		LBC_Class,
+		LBC_Property,
+		LBC_RPC,
+		LBC_Max
+	};
+
+	/** Identifies an actor, class, property or RPC in the live bandwidth summary */
+	struct FLiveBandwidthKey
+	{
+		/** Class of the actor, owner class of the property or RPC, none for classes */
+		FName OuterName;
+		FName Name;
+
+		FLiveBandwidthKey( FName InOuterName, FName InName )
+			: OuterName(InOuterName)
+			, Name(InName) {}
+
+		bool operator==( const FLiveBandwidthKey& Other ) const
+		{
+			return OuterName == Other.OuterName && Name == Other.Name;
+		}
+
+		friend uint32 GetTypeHash( const FLiveBandwidthKey& Key )
+		{
+			return HashCombine( GetTypeHash( Key.OuterName ), GetTypeHash( Key.Name ) );
+		}
+	};
+
+	/** Bits sent to a connection during one bucket of the live bandwidth window */
+	struct FLiveConnectionBits
+	{
+		FString Description;
+		uint64 NumBits;
+
+		FLiveConnectionBits()
+			: NumBits(0) {}
+	};
+
+	/** Bits sent during one second of the live bandwidth window */
+	struct FLiveBandwidthBucket
+	{
+		double StartTime;
+		TMap<FLiveBandwidthKey, uint64> Bits[LBC_Max];
+		TMap<const UNetConnection*, FLiveConnectionBits> ConnectionBits;
+
+		FLiveBandwidthBucket()
+			: StartTime(0.0) {}
+	};
+
+	/** Buckets of the live bandwidth window, oldest first. The last bucket is the one being filled. */
+	TArray<FLiveBandwidthBucket>			LiveBuckets;
+
+	/** Adds bits to the live bandwidth summary. */
+	void AddLiveBits( ELiveBandwidthCategory Category, const FLiveBandwidthKey& Key, uint32 NumBits );
+
+	/** Adds the bits of a bunch flushed to a connection to the live bandwidth summary. */
+	void AddLiveBunchBits( UNetConnection* Connection, const FSendBunchInfo& BunchInfo );
+
+	/** Starts a new bucket if the current one is full and drops the buckets that fell out of the window. */
+	void UpdateLiveBuckets();
+
 	/**
 	 * Returns index of passed in name into name array. If not found, adds it.
 	 *
@@ -172,6 +247,22 @@ public:
 	 */
 	void EnableTracking( bool bShouldEnableTracking );
 
+	/**
+	 * Enables/ disables gathering the live bandwidth summary, independently of the file capture.
+	 *
+	 * @param	bShouldEnableTracking	Whether the summary should be gathered or not
+	 */
+	ENGINE_API void EnableLiveTracking( bool bShouldEnableTracking );
+
+	/**
+	 * Logs the actors, classes, properties and RPCs that sent the most bits per second and connection
+	 * over the live bandwidth window.
+	 *
+	 * @param	NumTop	Number of entries to log for each category
+	 * @param	Ar		The output device to write the summary to
+	 */
+	ENGINE_API void ReportLiveBandwidth( int32 NumTop, FOutputDevice& Ar );
+
 	/**
 	 * Marks the beginning of a frame.
 	 */
@@ -395,6 +486,8 @@ public:
 	bool Exec( UWorld * InWorld, const TCHAR* Cmd, FOutputDevice & Ar );
 
 	bool FORCEINLINE IsTrackingEnabled() const { return bIsTrackingEnabled; }
+
+	bool FORCEINLINE IsLiveTrackingEnabled() const { return bIsLiveTrackingEnabled; }
 };
 
 /** Global network profiler instance. */
@@ -0,0 +1,75 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	PushModel.h: Dirty tracking for push based replicated properties.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UObject;
+
+/**
+ * Dirty state of the push based properties of one object.
+ * Instead of clearing bits once they are replicated, every property remembers when it was last marked dirty, so any
+ * number of net drivers can each compare against the point in time they last looked at the object.
+ */
+struct FNetPushModelObjectState
+{
+	/** Value of the dirty counter when each property was last marked dirty, indexed by RepIndex */
+	TArray<uint64> PropertyDirtyCounters;
+
+	/** @return true if the property was marked dirty after the dirty counter had the given value */
+	bool IsPropertyDirty(const int32 RepIndex, const uint64 SinceCounter) const
+	{
+		return PropertyDirtyCounters.IsValidIndex(RepIndex) && PropertyDirtyCounters[RepIndex] > SinceCounter;
+	}
+};
+
+/**
+ * Push model for replicated properties.
+ *
+ * Properties registered with DOREPLIFETIME_PUSH_MODEL (or one of its variants) are only compared against the shadow
+ * state after game code marked them dirty with MARK_PROPERTY_DIRTY. Properties registered with the regular macros keep
+ * being compared every net update. Objects are tracked on the game thread.
+ */
+class ENGINE_API FNetPushModel
+{
+public:
+	/**
+	 * Marks a range of replicated properties of an object dirty, so they are compared on its next net update.
+	 * @param Object		Object owning the properties
+	 * @param RepIndexStart	RepIndex of the first property
+	 * @param RepIndexEnd	RepIndex of the last property, inclusive
+	 */
+	static void MarkPropertyDirty(const UObject* Object, int32 RepIndexStart, int32 RepIndexEnd);
+
+	/** @return the dirty state of an object, or nullptr if none of its properties were ever marked dirty. Only valid until the next property is marked dirty. */
+	static const FNetPushModelObjectState* FindObjectState(const UObject* Object);
+
+	/** @return the current value of the dirty counter, properties marked dirty from now on compare greater than it */
+	static uint64 GetDirtyCounter();
+
+	/** @return false if net.PushModel is 0, in which case all properties are compared every net update */
+	static bool IsEnabled();
+};
+
+/**
+ * Marks a push based replicated property dirty, use it whenever game code changes the property.
+ *
+ *	MARK_PROPERTY_DIRTY(AMyActor, Health, this);
+ */
+#define MARK_PROPERTY_DIRTY(c,v,Object) \
+{ \
+	static UProperty* sp##v = FindFieldChecked<UProperty>(c::StaticClass(), GET_MEMBER_NAME_CHECKED(c,v)); \
+	FNetPushModel::MarkPropertyDirty(Object, sp##v->RepIndex, sp##v->RepIndex + sp##v->ArrayDim - 1); \
+}
+
+/** Marks a single element of a push based replicated static array dirty. */
+#define MARK_PROPERTY_DIRTY_STATIC_ARRAY_INDEX(c,v,i,Object) \
+{ \
+	static UProperty* sp##v = FindFieldChecked<UProperty>(c::StaticClass(), GET_MEMBER_NAME_CHECKED(c,v)); \
+	check((i) >= 0 && (i) < sp##v->ArrayDim); \
+	FNetPushModel::MarkPropertyDirty(Object, sp##v->RepIndex + (i), sp##v->RepIndex + (i)); \
+}
@@ -115,6 +115,26 @@ public:
 	int32						CmdIndex;
 };
 
+/** FRepSerializedChangelist
+*  Properties written for a range of the shared changelist history, reused by other connections that send the same range with the same replication flags in the same frame
+*/
+class FRepSerializedChangelist
+{
+public:
+	FRepSerializedChangelist() :
+		HistoryStart( 0 ),
+		HistoryEnd( 0 ),
+		RepFlagsValue( 0 ),
+		NumBits( 0 )
+	{ }
+
+	int32											HistoryStart;
+	int32											HistoryEnd;
+	uint32											RepFlagsValue;
+	TArray< uint8 >									Buffer;
+	int64											NumBits;
+};
+
 /** FRepChangelistState
 *  Stores changelist history (that are used to know what properties have changed) for objects
 */
@@ -124,7 +144,9 @@ public:
 	FRepChangelistState() :
 		HistoryStart( 0 ),
 		HistoryEnd( 0 ),
-		CompareIndex( 0 )
+		CompareIndex( 0 ),
+		PushModelCompareCounter( 0 ),
+		SerializedFrame( 0 )
 	{ }
 
 	~FRepChangelistState();
@@ -138,7 +160,72 @@ public:
 	int32											HistoryEnd;
 	int32											CompareIndex;
 
+	/** Push model dirty counter at the last compare, push based properties marked dirty before it are already in the shadow state */
+	uint64											PushModelCompareCounter;
+
 	FRepStateStaticBuffer							StaticBuffer;
+
+	/** Replication frame SerializedChangelists were written in, they are thrown away once the frame changes */
+	uint32											SerializedFrame;
+	TArray< FRepSerializedChangelist >				SerializedChangelists;
+};
+
+/** FQuantizedRepMovement
+ *  FRepMovement snapped to the grids of its quantization levels, this is what both sides agree on when it's sent delta compressed
+*/
+class FQuantizedRepMovement
+{
+public:
+	FQuantizedRepMovement() :
+		bSimulatedPhysicSleep( false ),
+		bRepPhysics( false )
+	{ }
+
+	FNetQuantizedVector								Location;
+	FNetQuantizedRotator							Rotation;
+	FNetQuantizedVector								LinearVelocity;
+	FNetQuantizedVector								AngularVelocity;		// Zero unless bRepPhysics is set
+	bool											bSimulatedPhysicSleep;
+	bool											bRepPhysics;
+};
+
+/** FRepMovementDeltaHistory
+ *  Bases for the delta compression of one top level FRepMovement property, on the sending and on the receiving side of a connection
+*/
+class FRepMovementDeltaHistory
+{
+public:
+	FRepMovementDeltaHistory() :
+		NextSequence( 0 ),
+		bHasAckedBase( false ),
+		AckedBaseSequence( 0 )
+	{ }
+
+	/** Number of received values kept, a base can't be older than this many sends */
+	static const int32 MAX_RECEIVED = 32;
+
+	class FEntry
+	{
+	public:
+		FEntry() : Sequence( 0 ), HistoryIndex( INDEX_NONE ) { }
+
+		FQuantizedRepMovement						Value;
+		uint8										Sequence;
+		int32										HistoryIndex;			// Sending side: FRepState::ChangeHistory item the value was sent with. Receiving side: INDEX_NONE if unused
+	};
+
+	uint8											NextSequence;
+
+	/** Sending side: values sent with changelist history items that aren't acked yet */
+	TArray< FEntry >								Sent;
+
+	/** Sending side: newest value the receiver acked */
+	bool											bHasAckedBase;
+	uint8											AckedBaseSequence;
+	FQuantizedRepMovement							AckedBase;
+
+	/** Receiving side: last values received, indexed by sequence */
+	FEntry											Received[MAX_RECEIVED];
 };
 
 /** FRepState
@@ -190,6 +277,8 @@ public:
 	int32							LastCompareIndex;			// If == FRepChangelistState::CompareIndex, then there is definitely no new information since the last time we checked
 
 	bool							ConditionMap[COND_Max];
+
+	TMap< int32, FRepMovementDeltaHistory >	MovementDeltaHistories;	// Delta compression bases of the top level FRepMovement properties, keyed by cmd index
 };
 
 enum ERepLayoutCmdType
@@ -223,7 +312,8 @@ enum ERepParentFlags
 	PARENT_IsLifetime			= ( 1 << 0 ),
 	PARENT_IsConditional		= ( 1 << 1 ),		// True if this property has a secondary condition to check
 	PARENT_IsConfig				= ( 1 << 2 ),		// True if this property is defaulted from a config file
-	PARENT_IsCustomDelta		= ( 1 << 3 )		// True if this property uses custom delta compression
+	PARENT_IsCustomDelta		= ( 1 << 3 ),		// True if this property uses custom delta compression
+	PARENT_IsPushBased			= ( 1 << 4 )		// True if this property is only compared after it was marked dirty
 };
 
 class FRepParentCmd
@@ -366,7 +456,7 @@ class FRepLayout
 	friend class UPackageMapClient;
 
 public:
-	FRepLayout() : FirstNonCustomParent( 0 ), RoleIndex( -1 ), RemoteRoleIndex( -1 ), Owner( NULL ) {}
+	FRepLayout() : FirstNonCustomParent( 0 ), RoleIndex( -1 ), RemoteRoleIndex( -1 ), bHasPushModelProperties( false ), Owner( NULL ) {}
 
 	void OpenAcked( FRepState * RepState ) const;
 
@@ -398,7 +488,8 @@ public:
 		const uint8* RESTRICT		Data,
 		UClass*						ObjectClass,
 		FNetBitWriter&				Writer,
-		TArray< uint16 >&			Changed ) const;
+		TArray< uint16 >&			Changed,
+		bool&						bOutCanShare ) const;
 
 	ENGINE_API void InitFromObjectClass( UClass * InObjectClass );
 
@@ -462,13 +553,16 @@ public:
 	bool CompareProperties(
 		FRepChangelistState* RESTRICT	RepState,
 		const uint8* RESTRICT			Data,
-		const FReplicationFlags&		RepFlags ) const;
+		const FReplicationFlags&		RepFlags,
+		const bool						bForceFullCompare = false ) const;
 
 private:
 	void RebuildConditionalProperties( FRepState * RESTRICT	RepState, const FRepChangedPropertyTracker& ChangedTracker, const FReplicationFlags& RepFlags ) const;
 
 	void UpdateChangelistHistory( FRepState * RepState, UClass * ObjectClass, const uint8* RESTRICT Data, const int32 AckPacketId, TArray< uint16 > * OutMerged ) const;
 
+	void SendRepMovement( FRepState* RESTRICT RepState, const int32 CmdIndex, FNetBitWriter& Writer, const uint8* RESTRICT Data, bool& bOutCanShare ) const;
+
 	void SendProperties_BackwardsCompatible_r(
 		FRepState* RESTRICT					RepState,
 		UPackageMapClient*					PackageMapClient,
@@ -494,7 +588,8 @@ private:
 		FNetBitWriter&						Writer,
 		const bool							bDoChecksum,
 		FRepHandleIterator&					HandleIterator,
-		const uint8* RESTRICT				SourceData ) const;
+		const uint8* RESTRICT				SourceData,
+		bool&								bOutCanShare ) const;
 
 	uint16 CompareProperties_r(
 		const int32				CmdStart,
@@ -617,5 +712,7 @@ private:
 	int32						RoleIndex;
 	int32						RemoteRoleIndex;
 
+	bool						bHasPushModelProperties;	// True if any parent is PARENT_IsPushBased
+
 	UObject *					Owner;						// Either a UCkass or UFunction
 };
@@ -15,6 +15,7 @@
 #include "UObject/CoreNet.h"
 #include "EngineLogs.h"
 #include "UObject/UnrealType.h"
+#include "Net/PushModel.h"
 
 class AActor;
 
@@ -113,6 +114,20 @@ static UProperty* GetReplicatedProperty(UClass* CallingClass, UClass* PropClass,
 	}																					\
 }
 
+/** Registers a push based property, it's only compared after it was marked dirty with MARK_PROPERTY_DIRTY */
+#define DOREPLIFETIME_PUSH_MODEL(c,v) DOREPLIFETIME_CONDITION_NOTIFY_PUSH_MODEL(c,v,COND_None,REPNOTIFY_OnChanged)
+
+#define DOREPLIFETIME_CONDITION_PUSH_MODEL(c,v,cond) DOREPLIFETIME_CONDITION_NOTIFY_PUSH_MODEL(c,v,cond,REPNOTIFY_OnChanged)
+
+#define DOREPLIFETIME_CONDITION_NOTIFY_PUSH_MODEL(c,v,cond,rncond) \
+{ \
+	static UProperty* sp##v = GetReplicatedProperty(StaticClass(), c::StaticClass(),GET_MEMBER_NAME_CHECKED(c,v)); \
+	for ( int32 i = 0; i < sp##v->ArrayDim; i++ )										\
+	{																					\
+		OutLifetimeProps.AddUnique( FLifetimeProperty( sp##v->RepIndex + i, cond, rncond, true ) );	\
+	}																					\
+}
+
 #define DOREPLIFETIME_ACTIVE_OVERRIDE(c,v,active)	\
 {													\
 	static UProperty* sp##v = GetReplicatedProperty(StaticClass(), c::StaticClass(),GET_MEMBER_NAME_CHECKED(c,v)); \
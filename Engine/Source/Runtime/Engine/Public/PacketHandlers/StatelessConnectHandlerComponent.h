@@ -108,6 +108,15 @@ protected:
 		return true;
 	}
 
+	/**
+	 * Threaded processing only starts once the handshake completed, after which Incoming just parses and drops
+	 * duplicate handshake packets, and Outgoing only writes the handshake bit - the secrets stay on the game thread.
+	 */
+	virtual bool SupportsThreadedProcessing() const override
+	{
+		return true;
+	}
+
 	virtual int32 GetReservedPacketBits() override;
 
 	virtual void Tick(float DeltaTime) override;
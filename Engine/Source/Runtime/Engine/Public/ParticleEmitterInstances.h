@@ -433,6 +433,17 @@ public:
 	virtual FBox GetBoundingBox();
 	virtual void UpdateBoundingBox(float DeltaTime);
 	virtual void ForceUpdateBoundingBox();
+
+	/** Returns the number of ranges ParallelForParticles splits the active particles into, 1 if they are all updated on the calling thread. */
+	int32 GetNumParticleBatches() const;
+
+	/**
+	 *	Calls Body(BatchIndex, FirstIndex, EndIndex) for consecutive ranges of ParticleIndices covering all active particles.
+	 *	Ranges are run on task graph workers if there are more active particles than FX.ParallelParticleUpdateBatchSize, so Body may only
+	 *	touch the particles of its own range and has to combine any other results per BatchIndex.
+	 */
+	void ParallelForParticles(TFunctionRef<void(int32 BatchIndex, int32 FirstIndex, int32 EndIndex)> Body) const;
+
 	virtual uint32 RequiredBytes();
 	/** Get offset for particle payload data for a particular module */
 	uint32 GetModuleDataOffset(UParticleModule* Module);
@@ -81,6 +81,22 @@ DECLARE_LOG_CATEGORY_EXTERN(LogParticles, Log, All);
 		}																												\
 	}
 
+/** Like BEGIN_UPDATE_LOOP, but only updates the particles of ParticleIndices in [FirstIndex, EndIndex). Used with FParticleEmitterInstance::ParallelForParticles. */
+#define BEGIN_UPDATE_LOOP_RANGE(FirstIndex, EndIndex)																	\
+	{																													\
+		check((Owner != NULL) && (Owner->Component != NULL));															\
+		uint32			CurrentOffset	= Offset;																		\
+		const uint8*		ParticleData	= Owner->ParticleData;															\
+		const uint32		ParticleStride	= Owner->ParticleStride;														\
+		uint16*			ParticleIndices	= Owner->ParticleIndices;														\
+		for(int32 i=(EndIndex)-1; i>=(FirstIndex); i--)																	\
+		{																												\
+			const int32	CurrentIndex	= ParticleIndices[i];															\
+			const uint8* ParticleBase	= ParticleData + CurrentIndex * ParticleStride;									\
+			FBaseParticle& Particle		= *((FBaseParticle*) ParticleBase);												\
+			if ((Particle.Flags & STATE_Particle_Freeze) == 0)															\
+			{																											\
+
 #define CONTINUE_UPDATE_LOOP																							\
 		CurrentOffset = Offset;																							\
 		continue;
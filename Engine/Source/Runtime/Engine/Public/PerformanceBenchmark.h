@@ -0,0 +1,102 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	PerformanceBenchmark.h: Measuring benchmark scenarios against stored baselines
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+#include "ChartCreation.h"
+#include "Engine/PerformanceBenchmarkSettings.h"
+
+class ACameraActor;
+class UWorld;
+
+/**
+ * Runs a scenario of UPerformanceBenchmarkSettings: loads its map, moves a camera along its path and records the
+ * frame, game thread, render thread and GPU times and the used physical memory of every frame.
+ * The results are compared against the FPerformanceBaseline of the scenario, written to Saved/Profiling/Benchmarks
+ * and regressions are logged as errors.
+ *
+ * Run from the console with Benchmark.Run <Scenario>, or unattended with -ExecCmds="Benchmark.Run <Scenario>" -ExitAfterBenchmark.
+ */
+class ENGINE_API FPerformanceBenchmark : public IPerformanceDataConsumer, public TSharedFromThis<FPerformanceBenchmark>
+{
+public:
+	/**
+	 * Starts running a scenario.
+	 * @return false if there is no scenario of that name or a benchmark is already running.
+	 */
+	static bool Run(FName ScenarioName);
+
+	/** Stops the running benchmark without reporting any results */
+	static void Cancel();
+
+	static bool IsRunning()
+	{
+		return Running.IsValid();
+	}
+
+	virtual ~FPerformanceBenchmark();
+
+	//~ Begin IPerformanceDataConsumer Interface
+	virtual void StartCharting() override;
+	virtual void ProcessFrame(const FFrameData& FrameData) override;
+	virtual void StopCharting() override;
+	//~ End IPerformanceDataConsumer Interface
+
+private:
+	enum class EState : uint8
+	{
+		LoadingMap,
+		WarmingUp,
+		Measuring,
+	};
+
+	/** Metrics recorded every frame */
+	enum EMetric
+	{
+		Metric_FrameTime,
+		Metric_GameThreadTime,
+		Metric_RenderThreadTime,
+		Metric_GPUTime,
+		Metric_UsedPhysicalMB,
+		Metric_Num
+	};
+
+	explicit FPerformanceBenchmark(const FPerformanceBenchmarkScenario& InScenario);
+
+	bool Tick(float DeltaTime);
+
+	/** Returns the world the scenario runs in once its map is loaded and playing */
+	UWorld* GetScenarioWorld() const;
+
+	/** Places the camera at Alpha along the camera path */
+	void UpdateCamera(float Alpha);
+
+	/** Compares and writes out the results */
+	void Finish();
+
+	/** Stops measuring and restores the player's view */
+	void Stop();
+
+	FPerformanceBenchmarkScenario Scenario;
+
+	EState State;
+
+	/** Seconds spent in the current state */
+	float StateTime;
+
+	bool bOpenedMap;
+	bool bMeasuring;
+
+	TWeakObjectPtr<ACameraActor> Camera;
+
+	TArray<double> Samples[Metric_Num];
+
+	FDelegateHandle TickerHandle;
+
+	static TSharedPtr<FPerformanceBenchmark> Running;
+};
@@ -378,6 +378,21 @@ public:
 	/** Flushes deferred actors to ensure they are in the physics scene. Note if this is called while the simulation is still running we use a slower insertion/removal path */
 	void FlushDeferredActors(EPhysicsSceneType SceneType);
 
+	/**
+	 * Keep static bodies created by FBodyInstance::InitBody in the deferred add lists until the matching EndDeferredActorBatch, instead of flushing them one at a time.
+	 * Bodies added between the two calls are not visible to scene queries until the batch ends.
+	 */
+	void BeginDeferredActorBatch();
+
+	/** Ends a batch started by BeginDeferredActorBatch, flushing all actors deferred since then to the scene */
+	void EndDeferredActorBatch();
+
+	/** Whether static bodies should stay deferred rather than being flushed right after InitBody */
+	bool IsBatchingDeferredActors() const
+	{
+		return DeferredActorBatchCount > 0;
+	}
+
 	void AddPendingSleepingEvent(PxActor* Actor, SleepEvent::Type SleepEventType, int32 SceneType);
 
 	/** Pending constraint break events */
@@ -441,6 +456,9 @@ private:
 
 	FDeferredSceneData DeferredSceneData[PST_MAX];
 
+	/** Number of nested BeginDeferredActorBatch calls */
+	int32 DeferredActorBatchCount;
+
 	/** Dispatcher for CPU tasks */
 	class PxCpuDispatcher*			CPUDispatcher[PST_MAX];
 	/** Simulation event callback object */
@@ -24,6 +24,7 @@ class FStaticPrimitiveDrawInterface;
 class UPrimitiveComponent;
 class UTexture2D;
 struct FMeshBatch;
+struct FStaticMeshOccluderData;
 
 /** Data for a simple dynamic light. */
 class FSimpleLightEntry
@@ -198,6 +199,16 @@ public:
 	 */
 	virtual void GetDynamicMeshElements(const TArray<const FSceneView*>& Views, const FSceneViewFamily& ViewFamily, uint32 VisibilityMap, class FMeshElementCollector& Collector) const {}
 
+	/** 
+	 * Whether GetDynamicMeshElements can be called from a task thread for the main views, concurrently with other proxies (r.ParallelGatherDynamicMeshElements).
+	 * It must then only read render thread state, allocate through the Collector, not draw anything with the Collector's PDI, 
+	 * and not reference FMemStack memory (eg SceneRenderingAllocator arrays) from the gathered meshes.
+	 */
+	virtual bool CanGatherDynamicMeshElementsInParallel(const FSceneViewFamily& ViewFamily) const
+	{
+		return false;
+	}
+
 	/** 
 	 * Gets the boxes for sub occlusion queries
 	 * @param View - the view the occlusion results are for
@@ -511,6 +522,15 @@ public:
 		return false;
 	}
 
+	/** 
+	 * Gets the local space geometry rasterized by software occlusion culling, if the primitive is used as an occluder.
+	 * Called on the rendering thread, the data has to stay valid for the lifetime of the proxy.
+	 */
+	virtual const FStaticMeshOccluderData* GetOccluderData() const
+	{
+		return nullptr;
+	}
+
 	/** 
 	 * Drawing helper. Draws nice bouncy line.
 	 */
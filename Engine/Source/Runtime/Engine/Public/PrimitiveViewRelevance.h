@@ -65,6 +65,8 @@ struct FPrimitiveViewRelevance
 	uint32 bDecal : 1;
 	/** Whether the primitive has materals that use translucent surface lighting. */
 	uint32 bTranslucentSurfaceLighting : 1;
+	/** Whether the primitive has lit translucent materials that read the translucency lighting volume. */
+	uint32 bTranslucentVolumeLighting : 1;
 	/** Whether the primitive has materials that read the scene depth. */
 	uint32 bUsesSceneDepth : 1;
 
@@ -70,6 +70,14 @@ public:
 	 * @param Primitive - primitive component to update
 	 */
 	virtual void UpdatePrimitiveTransform(UPrimitiveComponent* Primitive) = 0;
+	/**
+	 * Starts collecting primitive transform updates instead of sending each to the rendering thread on its own.
+	 * Primitives that allow batched render state creation are collected by AddPrimitive as well.
+	 * Must be called on the game thread, UpdatePrimitiveTransform and AddPrimitive may be called from any thread until the matching EndPrimitiveTransformBatch.
+	 */
+	virtual void BeginPrimitiveTransformBatch() {}
+	/** Sends the primitives added and transform updates collected since BeginPrimitiveTransformBatch to the rendering thread, one command each. */
+	virtual void EndPrimitiveTransformBatch() {}
 	/** Updates primitive attachment state. */
 	virtual void UpdatePrimitiveAttachment(UPrimitiveComponent* Primitive) = 0;
 	/** Finds the  primitive with the associated component id. */
@@ -1652,7 +1652,7 @@ public:
 	template<typename T>
 	T& AllocateOneFrameResource()
 	{
-		T* OneFrameResource = new (FMemStack::Get()) T();
+		T* OneFrameResource = OwnedMemStack ? new (*OwnedMemStack) T() : new (FMemStack::Get()) T();
 		OneFrameResources.Add(OneFrameResource);
 		return *OneFrameResource;
 	}
@@ -1678,6 +1678,10 @@ private:
 
 	ENGINE_API FMeshElementCollector();
 
+	/** Collector for a task thread, which allocates one frame resources from its own mem stack as the task thread's FMemStack is only valid during a task. */
+	struct FTaskThreadCollector {};
+	ENGINE_API explicit FMeshElementCollector(FTaskThreadCollector);
+
 	~FMeshElementCollector()
 	{
 		check(!ParallelTasks.Num()); // We should have blocked on this already
@@ -1691,6 +1695,8 @@ private:
 		{
 			OneFrameResources[ResourceIndex]->~FOneFrameResource();
 		}
+
+		delete OwnedMemStack;
 	}
 
 	void SetPrimitive(const FPrimitiveSceneProxy* InPrimitiveSceneProxy, FHitProxyId DefaultHitProxyId)
@@ -1738,11 +1744,14 @@ private:
 	/** Views being collected for */
 	TArray<FSceneView*, TInlineAllocator<2> > Views;
 
-	/** Material proxies that will be deleted at the end of the frame. */
-	TArray<FMaterialRenderProxy*, SceneRenderingAllocator> TemporaryProxies;
+	/** Material proxies that will be deleted at the end of the frame. Not using SceneRenderingAllocator, so task thread collectors can add to it. */
+	TArray<FMaterialRenderProxy*> TemporaryProxies;
 
 	/** Resources that will be deleted at the end of the frame. */
-	TArray<FOneFrameResource*, SceneRenderingAllocator> OneFrameResources;
+	TArray<FOneFrameResource*> OneFrameResources;
+
+	/** Mem stack of a task thread collector, one frame resources are allocated from the thread's FMemStack otherwise. */
+	FMemStackBase* OwnedMemStack;
 
 	/** Current primitive being gathered. */
 	const FPrimitiveSceneProxy* PrimitiveSceneProxy;
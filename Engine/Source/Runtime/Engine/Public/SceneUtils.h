@@ -178,6 +178,7 @@ class FScopedGPUStatEvent;
 
 class FRealtimeGPUProfilerEvent;
 class FRealtimeGPUProfilerFrame;
+class FRealtimeGPUProfilerCapture;
 class FRenderQueryPool;
 
 /**
@@ -197,6 +198,9 @@ public:
 	/** Final cleanup */
 	ENGINE_API void Release();
 
+	/** Starts recording the results of every frame, or stops and writes the recording to the profiling directory as CSV and Chrome trace */
+	ENGINE_API void SetCaptureEnabled(bool bEnabled);
+
 	/** Push/pop events */
 	void PushEvent(FRHICommandListImmediate& RHICmdList, TStatId StatId);
 	void PopEvent(FRHICommandListImmediate& RHICmdList);
@@ -211,6 +215,8 @@ private:
 	int32 ReadBufferIndex;
 	uint32 WriteFrameNumber;
 	FRenderQueryPool* RenderQueryPool;
+	/** Recording started by SetCaptureEnabled, nullptr if not recording */
+	FRealtimeGPUProfilerCapture* Capture;
 	bool bStatGatheringPaused;
 	bool bInBeginEndBlock;
 };
@@ -184,6 +184,42 @@ struct FStaticMeshSection
 	friend FArchive& operator<<(FArchive& Ar,FStaticMeshSection& Section);
 };
 
+/**
+ * A small run of triangles of a section, generated when the mesh is built with bBuildMeshlets.
+ * The triangles are contiguous in the LOD's index buffer. Winding is as imported, so the cone is flipped for mirrored transforms.
+ * The meshlet is back facing for every point of view P where
+ * Dot(BoundsCenter - P, ConeAxis) >= ConeCutoff * Size(BoundsCenter - P) + BoundsRadius,
+ * with all values in local space.
+ */
+struct FStaticMeshMeshlet
+{
+	/** Range of indices in the LOD's index buffer. */
+	uint32 FirstIndex;
+	uint32 NumTriangles;
+
+	/** Bounding sphere of the triangles. */
+	FVector BoundsCenter;
+	float BoundsRadius;
+
+	/** Average triangle normal, zero if the normals are too spread out to ever be back facing as a whole. */
+	FVector ConeAxis;
+	/** Sine of the cone's half angle, 1 if ConeAxis is zero. */
+	float ConeCutoff;
+
+	FStaticMeshMeshlet()
+		: FirstIndex(0)
+		, NumTriangles(0)
+		, BoundsCenter(FVector::ZeroVector)
+		, BoundsRadius(0.0f)
+		, ConeAxis(FVector::ZeroVector)
+		, ConeCutoff(1.0f)
+	{
+	}
+
+	/** Serializer. */
+	friend FArchive& operator<<(FArchive& Ar, FStaticMeshMeshlet& Meshlet);
+};
+
 
 struct FStaticMeshLODResources;
 
@@ -242,6 +278,9 @@ struct FStaticMeshLODResources
 	/** Sections for this LOD. */
 	TArray<FStaticMeshSection> Sections;
 
+	/** Clusters of triangles for fine grained culling, empty unless the mesh was built with bBuildMeshlets. */
+	TArray<FStaticMeshMeshlet> Meshlets;
+
 	/** Distance field data associated with this mesh, null if not present.  */
 	class FDistanceFieldVolumeData* DistanceFieldData; 
 
@@ -259,6 +298,9 @@ struct FStaticMeshLODResources
 
 	/** True if the reversed index buffers contained data at init. Needed as it will not be available to the CPU afterwards. */
 	uint32 bHasReversedDepthOnlyIndices: 1;
+
+	/** True if the buffers of this LOD were stripped when cooking because it is below the mesh's MinLOD. */
+	uint32 bIsLODCookedOut : 1;
 	
 	/**	Allows uniform random selection of mesh sections based on their area. */
 	FStaticMeshAreaWeightedSectionSampler AreaWeightedSampler;
@@ -305,6 +347,21 @@ struct FStaticMeshLODResources
 /**
  * FStaticMeshRenderData - All data needed to render a static mesh.
  */
+/**
+ * CPU copy of the LOD a static mesh is rasterized with by software occlusion culling, see UStaticMesh::LODForOccluderMesh.
+ */
+struct FStaticMeshOccluderData
+{
+	/** Local space positions of the vertices. */
+	TArray<FVector> Vertices;
+
+	/** Triangle list of indices in to Vertices. */
+	TArray<uint32> Indices;
+
+	/** Copies the geometry of a LOD, which has to be called before its resources are initialized. Returns null if the LOD has no triangles. */
+	static TUniquePtr<FStaticMeshOccluderData> Build(const FStaticMeshLODResources& LODResources);
+};
+
 class FStaticMeshRenderData
 {
 public:
@@ -323,6 +380,9 @@ public:
 	/** True if LODs share static lighting data. */
 	bool bLODsShareStaticLighting;
 
+	/** Geometry used for software occlusion culling, if the mesh is used as an occluder. */
+	TUniquePtr<FStaticMeshOccluderData> OccluderData;
+
 #if WITH_EDITORONLY_DATA
 	/** The derived data key associated with this render data. */
 	FString DerivedDataKey;
@@ -506,6 +566,7 @@ public:
 	virtual void GetDistanceFieldInstanceInfo(int32& NumInstances, float& BoundsSurfaceArea) const override;
 	virtual bool HasDistanceFieldRepresentation() const override;
 	virtual bool HasDynamicIndirectShadowCasterRepresentation() const override;
+	virtual const FStaticMeshOccluderData* GetOccluderData() const override;
 	virtual uint32 GetMemoryFootprint( void ) const override { return( sizeof( *this ) + GetAllocatedSize() ); }
 	uint32 GetAllocatedSize( void ) const { return( FPrimitiveSceneProxy::GetAllocatedSize() + LODs.GetAllocatedSize() ); }
 
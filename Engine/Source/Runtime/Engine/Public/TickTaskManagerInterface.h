@@ -59,6 +59,12 @@ public:
 	/** Dumps all registered tick functions to output device. */
 	virtual void DumpAllTickFunctions(FOutputDevice& Ar, UWorld* InWorld, bool bEnabled, bool bDisabled) = 0;
 
+	/** 
+	 * Records when, where and after which prerequisites every tick function ticks during the next frame.
+	 * At the end of that frame the critical path through the ticks is logged and the frame is written as a Chrome trace to the profiling directory.
+	 */
+	virtual void CaptureNextFrameTickGraph() = 0;
+
 	/**
 	 * Singleton to retrieve the GLOBAL tick task manager
 	 *
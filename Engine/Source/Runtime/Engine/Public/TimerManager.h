@@ -144,6 +144,30 @@ struct FTimerData
 	}
 };
 
+/** 
+ * Entry of the heap of active timers.
+ * Entries are not removed when their timer is cleared or paused, they are skipped when they no longer match their timer.
+ */
+struct FTimerHeapEntry
+{
+	/** Time (on the FTimerManager's clock) that the timer was set to expire when this entry was added. */
+	double ExpireTime;
+
+	/** The timer this entry was added for. */
+	FTimerHandle TimerHandle;
+
+	FTimerHeapEntry(double InExpireTime, FTimerHandle InTimerHandle)
+		: ExpireTime(InExpireTime)
+		, TimerHandle(InTimerHandle)
+	{}
+
+	/** Operator less, used to sort the heap based on time until execution. **/
+	bool operator<(const FTimerHeapEntry& Other) const
+	{
+		return ExpireTime < Other.ExpireTime;
+	}
+};
+
 
 /** 
  * Class to globally manage timers.
@@ -282,9 +306,7 @@ public:
 	 */
 	FORCEINLINE void PauseTimer(FTimerHandle InHandle)
 	{
-		int32 TimerIdx;
-		FTimerData const* TimerToPause = FindTimer(InHandle, &TimerIdx);
-		InternalPauseTimer(TimerToPause, TimerIdx);
+		InternalPauseTimer(InHandle);
 	}
 
 	/**
@@ -294,8 +316,7 @@ public:
 	 */
 	FORCEINLINE void UnPauseTimer(FTimerHandle InHandle)
 	{
-		int32 TimerIdx = FindTimerInList(PausedTimerList, InHandle);
-		InternalUnPauseTimer(TimerIdx);
+		InternalUnPauseTimer(InHandle);
 	}
 
 	/**
@@ -407,31 +428,80 @@ public:
 
 private:
 	void InternalSetTimer( FTimerHandle& InOutHandle, FTimerUnifiedDelegate const& InDelegate, float InRate, bool InbLoop, float InFirstDelay );
-	void InternalSetTimer( FTimerData& NewTimerData, float InRate, bool InbLoop, float InFirstDelay );
+	FTimerHandle InternalSetTimer( FTimerData&& NewTimerData, float InRate, bool InbLoop, float InFirstDelay, FTimerHandle const& ReuseHandle );
 	void InternalSetTimerForNextTick( FTimerUnifiedDelegate const& InDelegate );
 	void InternalClearTimer( FTimerHandle const& InDelegate );
-	void InternalClearTimer( int32 TimerIdx, ETimerStatus TimerStatus );
 	void InternalClearAllTimers( void const* Object );
 
-	/** Will find a timer in the active, paused, or pending list. */
-	FTimerData const* FindTimer( FTimerHandle const& InHandle, int32* OutTimerIndex = nullptr ) const;
+	/** Will find a timer that is active, paused, pending or currently executing. */
+	FTimerData const* FindTimer( FTimerHandle const& InHandle ) const;
 
-	void InternalPauseTimer( FTimerData const* TimerToPause, int32 TimerIdx );
-	void InternalUnPauseTimer( int32 PausedTimerIdx );
+	/** Will find the index of the stored timer for a handle, or INDEX_NONE if the handle does not belong to a timer of this manager. Does not check the currently executing timer. */
+	FORCEINLINE int32 FindStoredTimerIndex( FTimerHandle const& InHandle ) const
+	{
+		if (InHandle.IsValid())
+		{
+			const int32 Index = InHandle.GetIndex();
+			if (Index < Timers.GetMaxIndex() && Timers.IsAllocated(Index) && Timers[Index].TimerHandle == InHandle)
+			{
+				return Index;
+			}
+
+			const int32* RelocatedIndex = RelocatedTimerIndices.Num() > 0 ? RelocatedTimerIndices.Find(InHandle.GetSerialNumber()) : nullptr;
+			if (RelocatedIndex && Timers.IsAllocated(*RelocatedIndex) && Timers[*RelocatedIndex].TimerHandle == InHandle)
+			{
+				return *RelocatedIndex;
+			}
+		}
+		return INDEX_NONE;
+	}
+
+	/** Will find the stored timer for a handle, or nullptr if the handle does not belong to a timer of this manager. Does not check the currently executing timer. */
+	FORCEINLINE FTimerData* FindStoredTimer( FTimerHandle const& InHandle )
+	{
+		const int32 Index = FindStoredTimerIndex(InHandle);
+		return Index != INDEX_NONE ? &Timers[Index] : nullptr;
+	}
+	FORCEINLINE FTimerData const* FindStoredTimer( FTimerHandle const& InHandle ) const
+	{
+		return const_cast<FTimerManager*>(this)->FindStoredTimer(InHandle);
+	}
+
+	void InternalPauseTimer( FTimerHandle const& InHandle );
+	void InternalUnPauseTimer( FTimerHandle const& InHandle );
 	
 	float InternalGetTimerRate( FTimerData const* const TimerData ) const;
 	float InternalGetTimerElapsed( FTimerData const* const TimerData ) const;
 	float InternalGetTimerRemaining( FTimerData const* const TimerData ) const;
 
-	/** Will find the given timer in the given TArray and return its index. */ 
-	int32 FindTimerInList( const TArray<FTimerData> &SearchArray, FTimerHandle const& InHandle ) const;
-
-	/** Heap of actively running timers. */
-	TArray<FTimerData> ActiveTimerHeap;
-	/** Unordered list of paused timers. */
-	TArray<FTimerData> PausedTimerList;
+	/** Stores a new timer and returns its index. The timer gets ReuseHandle if that is valid, otherwise a new handle. */
+	int32 AddTimer( FTimerData&& TimerData, FTimerHandle const& ReuseHandle );
+	/** Removes a stored timer, its heap entry, if any, becomes stale. */
+	void RemoveTimer( int32 TimerIndex );
+	/** Forgets where a timer that is not stored at the index of its handle was stored, once that storage is removed. */
+	void RemoveRelocatedTimerIndex( FTimerHandle const& InHandle, int32 TimerIndex );
+	/** Adds a heap entry for an active timer. */
+	void PushActiveTimer( FTimerData const& Timer );
+	/** Returns whether a heap entry still matches an active timer. */
+	bool IsHeapEntryValid( FTimerHeapEntry const& Entry ) const;
+	/** Notes that a heap entry no longer matches its timer, and removes all such entries once they make up a large part of the heap. */
+	void AddStaleHeapEntry();
+
+	/** All timers of this manager, indexed by the index part of their handle. The entry of the currently executing timer is reserved while it executes. */
+	TSparseArray<FTimerData> Timers;
+	/**
+	 * Index of the timers that are not stored at the index of their handle, by serial number. This happens when a handle is set again
+	 * after its timer was cleared or expired and another timer took its entry, the handle is kept so copies of it still match the timer.
+	 */
+	TMap<uint64, int32> RelocatedTimerIndices;
+	/** Index of the reserved entry of the currently executing timer, INDEX_NONE when no timer is executing. */
+	int32 CurrentlyExecutingTimerIndex;
+	/** Heap of the expire times of active timers. */
+	TArray<FTimerHeapEntry> ActiveTimerHeap;
+	/** Number of entries in ActiveTimerHeap that no longer match their timer. */
+	int32 NumStaleHeapEntries;
 	/** List of timers added this frame, to be added after timer has been ticked */
-	TArray<FTimerData> PendingTimerList;
+	TArray<FTimerHandle> PendingTimerList;
 
 	/** An internally consistent clock, independent of World.  Advances during ticking. */
 	double InternalTime;
@@ -442,8 +512,8 @@ private:
 	/** Set this to GFrameCounter when Timer is ticked. To figure out if Timer has been already ticked or not this frame. */
 	uint64 LastTickedFrame;
 
-	/** The last handle we assigned from this timer manager */
-	static uint64 LastAssignedHandle;
+	/** The last serial number we assigned from any timer manager */
+	static uint64 LastAssignedSerialNumber;
 
 	/** The game instance that created this timer manager. May be null if this timer manager wasn't created by a game instance. */
 	UGameInstance* OwningGameInstance;
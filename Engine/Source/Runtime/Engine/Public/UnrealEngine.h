@@ -374,21 +374,33 @@ extern ENGINE_API UFont* GetStatsFont();
 -----------------------------------------------------------------------------*/
 
 /**
- * Special helper class for frame end sync. It respects a passed in option to allow one frame
- * of lag between the game and the render thread by using two events in round robin fashion.
+ * Special helper class for frame end sync. It respects a passed in option to allow up to MaxFrameThreadLag
+ * frames of lag between the game and the render thread by using a ring of fences in round robin fashion.
  */
 class FFrameEndSync
 {
-	/** Pair of fences. */
-	FRenderCommandFence Fence[2];
+public:
+	/** Maximum number of frames the render thread may lag behind the game thread */
+	enum { MaxFrameThreadLag = 2 };
+
+private:
+	/** One fence per frame that can be in flight. */
+	FRenderCommandFence Fence[MaxFrameThreadLag + 1];
 	/** Current index into events array. */
 	int32 EventIndex;
+
 public:
 	/**
 	 * Syncs the game thread with the render thread. Depending on passed in bool this will be a total
 	 * sync or a one frame lag.
 	 */
 	ENGINE_API void Sync( bool bAllowOneFrameThreadLag );
+
+	/**
+	 * Syncs the game thread with the render thread, waiting for the frame issued FrameThreadLag frames ago.
+	 * @param FrameThreadLag	Number of frames the render thread may lag behind, clamped to [0, MaxFrameThreadLag].
+	 */
+	ENGINE_API void Sync( int32 FrameThreadLag );
 };
 
 
@@ -32,6 +32,12 @@ public:
 		OutFoliageNormalizedRotationAxisAndAngle = FoliageNormalizedRotationAxisAndAngle;
 	}
 
+	/** The foliage is bent in the vertex shader, so it's never used as a software occluder */
+	virtual const FStaticMeshOccluderData* GetOccluderData() const override
+	{
+		return nullptr;
+	}
+
 	/** Updates the scene proxy with new foliage parameters from the game thread. */
 	void UpdateParameters_GameThread(const FVector& NewFoliageImpluseDirection, const FVector4& NewFoliageNormalizedRotationAxisAndAngle)
 	{
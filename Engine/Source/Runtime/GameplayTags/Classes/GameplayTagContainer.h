@@ -11,6 +11,7 @@
 
 class UEditableGameplayTagQuery;
 struct FGameplayTagContainer;
+struct FGameplayTagBitSet;
 struct FPropertyTag;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogGameplayTags, Log, All);
@@ -821,6 +822,7 @@ protected:
 	friend struct FGameplayTagQueryExpression;
 	friend struct FGameplayTagNode;
 	friend struct FGameplayTag;
+	friend struct FGameplayTagBitSet;
 	
 private:
 
@@ -994,6 +996,9 @@ public:
 	/** Returns true if the given tags match this query, or false otherwise. */
 	bool Matches(FGameplayTagContainer const& Tags) const;
 
+	/** Returns true if the given tags match this query, or false otherwise. */
+	bool Matches(FGameplayTagBitSet const& Tags) const;
+
 	/** Returns true if this query is empty, false otherwise. */
 	bool IsEmpty() const;
 
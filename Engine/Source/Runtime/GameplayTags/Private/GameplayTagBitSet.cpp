@@ -0,0 +1,211 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "GameplayTagBitSet.h"
+#include "GameplayTagsManager.h"
+
+namespace GameplayTagBitSet
+{
+	/** Calls Func with the index of every set bit */
+	template<typename WordArrayType, typename FuncType>
+	void ForEachSetBit(const WordArrayType& Words, FuncType Func)
+	{
+		for (int32 WordIndex = 0; WordIndex < Words.Num(); ++WordIndex)
+		{
+			uint64 Word = Words[WordIndex];
+			while (Word != 0)
+			{
+				const uint32 LowWord = (uint32)Word;
+				const int32 Bit = LowWord != 0 ? FMath::CountTrailingZeros(LowWord) : 32 + FMath::CountTrailingZeros((uint32)(Word >> 32));
+				Func((WordIndex << 6) + Bit);
+				Word &= Word - 1;
+			}
+		}
+	}
+}
+
+FGameplayTagBitSet::FGameplayTagBitSet(const FGameplayTagContainer& Container)
+{
+	AppendTags(Container);
+}
+
+int32 FGameplayTagBitSet::GetBitIndex(const FGameplayTag& Tag)
+{
+	if (!Tag.IsValid())
+	{
+		return INDEX_NONE;
+	}
+
+	const UGameplayTagsManager& Manager = UGameplayTagsManager::Get();
+	const FGameplayTagNetIndex NetIndex = Manager.GetNetIndexFromTag(Tag);
+	return NetIndex < Manager.GetNetworkGameplayTagNodeIndex().Num() ? (int32)NetIndex : INDEX_NONE;
+}
+
+void FGameplayTagBitSet::SetBit(FWordArray& Words, int32 BitIndex)
+{
+	const int32 WordIndex = BitIndex >> 6;
+	if (WordIndex >= Words.Num())
+	{
+		Words.AddZeroed(WordIndex + 1 - Words.Num());
+	}
+	Words[WordIndex] |= 1ull << (BitIndex & 63);
+}
+
+void FGameplayTagBitSet::AddToClosure(const FGameplayTag& Tag)
+{
+	const FGameplayTagContainer* TagWithParents = UGameplayTagsManager::Get().GetSingleTagContainer(Tag);
+	if (TagWithParents)
+	{
+		SetBit(ClosureWords, GetBitIndex(Tag));
+		for (const FGameplayTag& ParentTag : TagWithParents->ParentTags)
+		{
+			const int32 ParentBitIndex = GetBitIndex(ParentTag);
+			if (ParentBitIndex != INDEX_NONE)
+			{
+				SetBit(ClosureWords, ParentBitIndex);
+			}
+		}
+	}
+}
+
+void FGameplayTagBitSet::AddTag(const FGameplayTag& Tag)
+{
+	const int32 BitIndex = GetBitIndex(Tag);
+	if (BitIndex != INDEX_NONE && !TestBit(ExplicitWords, BitIndex))
+	{
+		SetBit(ExplicitWords, BitIndex);
+		AddToClosure(Tag);
+	}
+}
+
+void FGameplayTagBitSet::AppendTags(const FGameplayTagContainer& Container)
+{
+	for (const FGameplayTag& Tag : Container.GameplayTags)
+	{
+		AddTag(Tag);
+	}
+}
+
+bool FGameplayTagBitSet::RemoveTag(const FGameplayTag& Tag)
+{
+	const int32 BitIndex = GetBitIndex(Tag);
+	if (!TestBit(ExplicitWords, BitIndex))
+	{
+		return false;
+	}
+
+	ExplicitWords[BitIndex >> 6] &= ~(1ull << (BitIndex & 63));
+
+	// Other tags may share parents with the removed one, so rebuild the closure like FGameplayTagContainer::FillParentTags does
+	const UGameplayTagsManager& Manager = UGameplayTagsManager::Get();
+	const TArray<TSharedPtr<FGameplayTagNode>>& NetIndex = Manager.GetNetworkGameplayTagNodeIndex();
+
+	FMemory::Memzero(ClosureWords.GetData(), ClosureWords.Num() * sizeof(uint64));
+	GameplayTagBitSet::ForEachSetBit(ExplicitWords, [this, &NetIndex](int32 SetBitIndex)
+	{
+		AddToClosure(NetIndex[SetBitIndex]->GetCompleteTag());
+	});
+
+	return true;
+}
+
+void FGameplayTagBitSet::Reset()
+{
+	FMemory::Memzero(ExplicitWords.GetData(), ExplicitWords.Num() * sizeof(uint64));
+	FMemory::Memzero(ClosureWords.GetData(), ClosureWords.Num() * sizeof(uint64));
+}
+
+bool FGameplayTagBitSet::IsEmpty() const
+{
+	for (uint64 Word : ExplicitWords)
+	{
+		if (Word != 0)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool FGameplayTagBitSet::HasAny(const FGameplayTagBitSet& Other) const
+{
+	const int32 NumWords = FMath::Min(ClosureWords.Num(), Other.ExplicitWords.Num());
+	for (int32 WordIndex = 0; WordIndex < NumWords; ++WordIndex)
+	{
+		if ((ClosureWords[WordIndex] & Other.ExplicitWords[WordIndex]) != 0)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool FGameplayTagBitSet::HasAnyExact(const FGameplayTagBitSet& Other) const
+{
+	const int32 NumWords = FMath::Min(ExplicitWords.Num(), Other.ExplicitWords.Num());
+	for (int32 WordIndex = 0; WordIndex < NumWords; ++WordIndex)
+	{
+		if ((ExplicitWords[WordIndex] & Other.ExplicitWords[WordIndex]) != 0)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool FGameplayTagBitSet::HasAll(const FGameplayTagBitSet& Other) const
+{
+	for (int32 WordIndex = 0; WordIndex < Other.ExplicitWords.Num(); ++WordIndex)
+	{
+		const uint64 Word = WordIndex < ClosureWords.Num() ? ClosureWords[WordIndex] : 0;
+		if ((Other.ExplicitWords[WordIndex] & ~Word) != 0)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool FGameplayTagBitSet::HasAllExact(const FGameplayTagBitSet& Other) const
+{
+	for (int32 WordIndex = 0; WordIndex < Other.ExplicitWords.Num(); ++WordIndex)
+	{
+		const uint64 Word = WordIndex < ExplicitWords.Num() ? ExplicitWords[WordIndex] : 0;
+		if ((Other.ExplicitWords[WordIndex] & ~Word) != 0)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool FGameplayTagBitSet::MatchesQuery(const FGameplayTagQuery& Query) const
+{
+	return Query.Matches(*this);
+}
+
+FGameplayTagContainer FGameplayTagBitSet::ToContainer() const
+{
+	const TArray<TSharedPtr<FGameplayTagNode>>& NetIndex = UGameplayTagsManager::Get().GetNetworkGameplayTagNodeIndex();
+
+	FGameplayTagContainer Container;
+	GameplayTagBitSet::ForEachSetBit(ExplicitWords, [&Container, &NetIndex](int32 BitIndex)
+	{
+		Container.AddTagFast(NetIndex[BitIndex]->GetCompleteTag());
+	});
+	return Container;
+}
+
+bool FGameplayTagBitSet::operator==(const FGameplayTagBitSet& Other) const
+{
+	const int32 NumWords = FMath::Max(ExplicitWords.Num(), Other.ExplicitWords.Num());
+	for (int32 WordIndex = 0; WordIndex < NumWords; ++WordIndex)
+	{
+		const uint64 Word = WordIndex < ExplicitWords.Num() ? ExplicitWords[WordIndex] : 0;
+		const uint64 OtherWord = WordIndex < Other.ExplicitWords.Num() ? Other.ExplicitWords[WordIndex] : 0;
+		if (Word != OtherWord)
+		{
+			return false;
+		}
+	}
+	return true;
+}
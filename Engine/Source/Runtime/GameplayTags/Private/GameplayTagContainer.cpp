@@ -1,6 +1,7 @@
 // Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
 
 #include "GameplayTagContainer.h"
+#include "GameplayTagBitSet.h"
 #include "HAL/IConsoleManager.h"
 #include "UObject/CoreNet.h"
 #include "UObject/UnrealType.h"
@@ -111,7 +112,8 @@ public:
 	{}
 
 	/** Evaluates the query against the given tag container and returns the result (true if matching, false otherwise). */
-	bool Eval(FGameplayTagContainer const& Tags);
+	template<typename TagsType>
+	bool Eval(TagsType const& Tags);
 
 	/** Parses the token stream into an FExpr. */
 	void Read(struct FGameplayTagQueryExpression& E);
@@ -122,15 +124,22 @@ private:
 	int32 Version;
 	bool bReadError;
 
-	bool EvalAnyTagsMatch(FGameplayTagContainer const& Tags, bool bSkip);
-	bool EvalAllTagsMatch(FGameplayTagContainer const& Tags, bool bSkip);
-	bool EvalNoTagsMatch(FGameplayTagContainer const& Tags, bool bSkip);
-
-	bool EvalAnyExprMatch(FGameplayTagContainer const& Tags, bool bSkip);
-	bool EvalAllExprMatch(FGameplayTagContainer const& Tags, bool bSkip);
-	bool EvalNoExprMatch(FGameplayTagContainer const& Tags, bool bSkip);
-
-	bool EvalExpr(FGameplayTagContainer const& Tags, bool bSkip = false);
+	template<typename TagsType>
+	bool EvalAnyTagsMatch(TagsType const& Tags, bool bSkip);
+	template<typename TagsType>
+	bool EvalAllTagsMatch(TagsType const& Tags, bool bSkip);
+	template<typename TagsType>
+	bool EvalNoTagsMatch(TagsType const& Tags, bool bSkip);
+
+	template<typename TagsType>
+	bool EvalAnyExprMatch(TagsType const& Tags, bool bSkip);
+	template<typename TagsType>
+	bool EvalAllExprMatch(TagsType const& Tags, bool bSkip);
+	template<typename TagsType>
+	bool EvalNoExprMatch(TagsType const& Tags, bool bSkip);
+
+	template<typename TagsType>
+	bool EvalExpr(TagsType const& Tags, bool bSkip = false);
 	void ReadExpr(struct FGameplayTagQueryExpression& E);
 
 #if WITH_EDITOR
@@ -157,7 +166,8 @@ private:
 	}
 };
 
-bool FQueryEvaluator::Eval(FGameplayTagContainer const& Tags)
+template<typename TagsType>
+bool FQueryEvaluator::Eval(TagsType const& Tags)
 {
 	CurStreamIdx = 0;
 
@@ -251,7 +261,8 @@ void FQueryEvaluator::ReadExpr(FGameplayTagQueryExpression& E)
 }
 
 
-bool FQueryEvaluator::EvalAnyTagsMatch(FGameplayTagContainer const& Tags, bool bSkip)
+template<typename TagsType>
+bool FQueryEvaluator::EvalAnyTagsMatch(TagsType const& Tags, bool bSkip)
 {
 	bool bShortCircuit = bSkip;
 	bool Result = false;
@@ -289,7 +300,8 @@ bool FQueryEvaluator::EvalAnyTagsMatch(FGameplayTagContainer const& Tags, bool b
 	return Result;
 }
 
-bool FQueryEvaluator::EvalAllTagsMatch(FGameplayTagContainer const& Tags, bool bSkip)
+template<typename TagsType>
+bool FQueryEvaluator::EvalAllTagsMatch(TagsType const& Tags, bool bSkip)
 {
 	bool bShortCircuit = bSkip;
 
@@ -328,7 +340,8 @@ bool FQueryEvaluator::EvalAllTagsMatch(FGameplayTagContainer const& Tags, bool b
 	return Result;
 }
 
-bool FQueryEvaluator::EvalNoTagsMatch(FGameplayTagContainer const& Tags, bool bSkip)
+template<typename TagsType>
+bool FQueryEvaluator::EvalNoTagsMatch(TagsType const& Tags, bool bSkip)
 {
 	bool bShortCircuit = bSkip;
 
@@ -367,7 +380,8 @@ bool FQueryEvaluator::EvalNoTagsMatch(FGameplayTagContainer const& Tags, bool bS
 	return Result;
 }
 
-bool FQueryEvaluator::EvalAnyExprMatch(FGameplayTagContainer const& Tags, bool bSkip)
+template<typename TagsType>
+bool FQueryEvaluator::EvalAnyExprMatch(TagsType const& Tags, bool bSkip)
 {
 	bool bShortCircuit = bSkip;
 
@@ -397,7 +411,8 @@ bool FQueryEvaluator::EvalAnyExprMatch(FGameplayTagContainer const& Tags, bool b
 
 	return Result;
 }
-bool FQueryEvaluator::EvalAllExprMatch(FGameplayTagContainer const& Tags, bool bSkip)
+template<typename TagsType>
+bool FQueryEvaluator::EvalAllExprMatch(TagsType const& Tags, bool bSkip)
 {
 	bool bShortCircuit = bSkip;
 
@@ -427,7 +442,8 @@ bool FQueryEvaluator::EvalAllExprMatch(FGameplayTagContainer const& Tags, bool b
 
 	return Result;
 }
-bool FQueryEvaluator::EvalNoExprMatch(FGameplayTagContainer const& Tags, bool bSkip)
+template<typename TagsType>
+bool FQueryEvaluator::EvalNoExprMatch(TagsType const& Tags, bool bSkip)
 {
 	bool bShortCircuit = bSkip;
 
@@ -459,7 +475,8 @@ bool FQueryEvaluator::EvalNoExprMatch(FGameplayTagContainer const& Tags, bool bS
 }
 
 
-bool FQueryEvaluator::EvalExpr(FGameplayTagContainer const& Tags, bool bSkip)
+template<typename TagsType>
+bool FQueryEvaluator::EvalExpr(TagsType const& Tags, bool bSkip)
 {
 	EGameplayTagQueryExprType::Type const ExprType = (EGameplayTagQueryExprType::Type) GetToken();
 	if (bReadError)
@@ -1384,6 +1401,12 @@ bool FGameplayTagQuery::Matches(FGameplayTagContainer const& Tags) const
 	return QE.Eval(Tags);
 }
 
+bool FGameplayTagQuery::Matches(FGameplayTagBitSet const& Tags) const
+{
+	FQueryEvaluator QE(*this);
+	return QE.Eval(Tags);
+}
+
 bool FGameplayTagQuery::IsEmpty() const
 {
 	return (QueryTokenStream.Num() == 0);
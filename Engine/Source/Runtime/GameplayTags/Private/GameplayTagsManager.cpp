@@ -202,7 +202,7 @@ void UGameplayTagsManager::ConstructGameplayTagTree()
 		NumBitsForContainerSize = MutableDefault->NumBitsForContainerSize;
 		NetIndexFirstBitSegment = MutableDefault->NetIndexFirstBitSegment;
 
-		if (ShouldUseFastReplication())
+		// FGameplayTagBitSet indexes tags by net index, so it's built even without fast replication
 		{
 #if STATS
 			FString PerfMessage = FString::Printf(TEXT("UGameplayTagsManager::ConstructGameplayTagTree: Reconstruct NetIndex"));
@@ -1008,10 +1008,7 @@ void UGameplayTagsManager::DoneAddingNativeTags()
 	{
 		bDoneAddingNativeTags = true;
 
-		if (ShouldUseFastReplication())
-		{
-			ConstructNetIndex();
-		}
+		ConstructNetIndex();
 	}
 }
 
@@ -0,0 +1,102 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+/**
+ * Set of gameplay tags stored as bits indexed by tag net index, for code that queries the same tags many times per frame.
+ * Besides the explicitly added tags a second set of bits holds those tags plus all of their parents,
+ * so hierarchical queries are a bit test or a word-wise AND instead of searching the GameplayTags and ParentTags arrays.
+ *
+ * Net indices are only valid until the tag tree is rebuilt, so bitsets must not be kept across IGameplayTagsModule::OnGameplayTagTreeChanged
+ * (rebuilding them from an FGameplayTagContainer is fine). Bitsets aren't serialized or replicated, convert to FGameplayTagContainer for that.
+ */
+struct GAMEPLAYTAGS_API FGameplayTagBitSet
+{
+	FGameplayTagBitSet()
+	{
+	}
+
+	explicit FGameplayTagBitSet(const FGameplayTagContainer& Container);
+
+	/** Adds the tag and all of its parents. Tags not known to the tags manager are ignored. */
+	void AddTag(const FGameplayTag& Tag);
+
+	/** Adds all tags of the container */
+	void AppendTags(const FGameplayTagContainer& Container);
+
+	/**
+	 * Removes the explicitly added tag, parents are only removed if no other added tag implies them.
+	 * @return True if the tag had been added
+	 */
+	bool RemoveTag(const FGameplayTag& Tag);
+
+	/** Removes all tags, keeping the allocated words */
+	void Reset();
+
+	/** Returns true if no tags have been added */
+	bool IsEmpty() const;
+
+	/** Returns true if the tag was added or is a parent of an added tag, e.g. {A.B}.HasTag(A) is true */
+	FORCEINLINE bool HasTag(const FGameplayTag& Tag) const
+	{
+		return TestBit(ClosureWords, GetBitIndex(Tag));
+	}
+
+	/** Returns true if the tag was explicitly added, e.g. {A.B}.HasTagExact(A) is false */
+	FORCEINLINE bool HasTagExact(const FGameplayTag& Tag) const
+	{
+		return TestBit(ExplicitWords, GetBitIndex(Tag));
+	}
+
+	/** Same as FGameplayTagContainer::HasAny, returns false if Other is empty */
+	bool HasAny(const FGameplayTagBitSet& Other) const;
+
+	/** Same as FGameplayTagContainer::HasAnyExact, returns false if Other is empty */
+	bool HasAnyExact(const FGameplayTagBitSet& Other) const;
+
+	/** Same as FGameplayTagContainer::HasAll, returns true if Other is empty */
+	bool HasAll(const FGameplayTagBitSet& Other) const;
+
+	/** Same as FGameplayTagContainer::HasAllExact, returns true if Other is empty */
+	bool HasAllExact(const FGameplayTagBitSet& Other) const;
+
+	/** Returns true if the tags match the query, same as FGameplayTagQuery::Matches on the equivalent container */
+	bool MatchesQuery(const FGameplayTagQuery& Query) const;
+
+	/** Returns a container with the explicitly added tags */
+	FGameplayTagContainer ToContainer() const;
+
+	/** Returns true if both hold the same explicitly added tags */
+	bool operator==(const FGameplayTagBitSet& Other) const;
+
+	FORCEINLINE bool operator!=(const FGameplayTagBitSet& Other) const
+	{
+		return !(*this == Other);
+	}
+
+private:
+	typedef TArray<uint64, TInlineAllocator<4>> FWordArray;
+
+	/** Returns the bit of the tag, or INDEX_NONE if the tag isn't in the tags manager's net index */
+	static int32 GetBitIndex(const FGameplayTag& Tag);
+
+	static FORCEINLINE bool TestBit(const FWordArray& Words, int32 BitIndex)
+	{
+		const int32 WordIndex = BitIndex >> 6;
+		return BitIndex != INDEX_NONE && WordIndex < Words.Num() && (Words[WordIndex] & (1ull << (BitIndex & 63))) != 0;
+	}
+
+	static void SetBit(FWordArray& Words, int32 BitIndex);
+
+	/** Sets the bits of the tag and all of its parents in ClosureWords */
+	void AddToClosure(const FGameplayTag& Tag);
+
+	/** Tags that were added */
+	FWordArray ExplicitWords;
+
+	/** Tags that were added and all of their parents */
+	FWordArray ClosureWords;
+};
@@ -18,6 +18,12 @@ struct FTrackRenderData
 {
 	GENERATED_USTRUCT_BODY()
 
+	FTrackRenderData()
+		: MeshData(nullptr)
+		, MeshSampleIndex(INDEX_NONE)
+	{
+	}
+
 	~FTrackRenderData()
 	{
 		MeshData = nullptr;
@@ -25,12 +31,15 @@ struct FTrackRenderData
 	
 	/** Pointer to FGeometryCacheMeshData containing vertex-data, bounding box, index buffer and batch-info*/
 	FGeometryCacheMeshData* MeshData;
+	/** Mesh sample MeshData belongs to, the track keeps the data valid until it is released with UGeometryCacheTrack::ReleaseMeshData */
+	int32 MeshSampleIndex;
 	/** World matrix used to render this specific track */
 	FMatrix WorldMatrix;
 
 	void Reset()
 	{
 		MeshData = nullptr;
+		MeshSampleIndex = INDEX_NONE;
 	}
 };
 
@@ -101,17 +110,17 @@ class GEOMETRYCACHE_API UGeometryCacheComponent : public UMeshComponent
 	* UpdateTrackSectionVertexbuffer, Update only the Vertex Buffer for a specific section
 	*
 	* @param SectionIndex - Index of the section we want to update
-	* @param MeshData - MeshData pointer to update the VB with
+	* @param MeshData - MeshData pointer to update the VB with, the vertices are copied
 	*/
 	void UpdateTrackSectionVertexbuffer(int32 SectionIndex, FGeometryCacheMeshData* MeshData);
 
 	/**
-	* UpdateTrackSectionIndexbuffer, Update only the Index Buffer for a specific section
+	* UpdateTrackSectionIndexbuffer, Update only the Index Buffer and batches for a specific section
 	*
 	* @param SectionIndex - Index of the section we want to update
-	* @param Indices - Array with new indices
+	* @param MeshData - MeshData pointer to update the IB with, the indices and batches are copied
 	*/
-	void UpdateTrackSectionIndexbuffer(int32 SectionIndex, const TArray<uint32>& Indices );
+	void UpdateTrackSectionIndexbuffer(int32 SectionIndex, FGeometryCacheMeshData* MeshData);
 
 	/**
 	* OnObjectReimported, Callback function to refresh section data and update scene proxy.
@@ -211,6 +220,11 @@ protected:
 	*/
 	void ReleaseResources();
 
+	/**
+	* ReleaseTrackMeshData, hands the mesh data of all sections back to their tracks
+	*/
+	void ReleaseTrackMeshData();
+
 	UPROPERTY(EditAnywhere, Interp, Category = GeometryCache)
 	bool bRunning;
 
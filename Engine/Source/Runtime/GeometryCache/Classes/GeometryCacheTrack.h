@@ -43,6 +43,15 @@ class UGeometryCacheTrack : public UObject
 	*/
 	virtual const bool UpdateMeshData(const float Time, const bool bLooping, int32& InOutMeshSampleIndex, FGeometryCacheMeshData*& OutMeshData );
 
+	/**
+	* ReleaseMeshData, called once the mesh data handed out by UpdateMeshData for a sample is no longer used.
+	* Tracks that don't keep all samples resident may free the data afterwards.
+	*
+	* @param MeshSampleIndex - Sample index UpdateMeshData returned the data for
+	* @return void
+	*/
+	virtual void ReleaseMeshData(const int32 MeshSampleIndex);
+
 	/**
 	* SetMatrixSamples, Set the Matrix animation Samples 
 	*
@@ -0,0 +1,130 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectMacros.h"
+#include "UObject/ScriptMacros.h"
+#include "Serialization/BulkData.h"
+#include "Async/Future.h"
+#include "GeometryCacheTrack.h"
+#include "GeometryCacheMeshData.h"
+
+#include "GeometryCacheTrackStreamedAnimation.generated.h"
+
+/**
+ * Derived GeometryCacheTrack class, used for vertex animation that is too large to keep resident.
+ *
+ * Mesh samples are compressed with FGeometryCacheCodec in groups of KeyframeInterval samples and stored as bulk data that is not loaded with the package.
+ * Only the groups that are in use plus the one following each of them are decoded, the following group is decoded ahead on the thread pool.
+ * Mesh data returned by UpdateMeshData stays valid until it is passed to ReleaseMeshData.
+ */
+UCLASS(collapsecategories, hidecategories = Object, BlueprintType, config = Engine)
+class GEOMETRYCACHE_API UGeometryCacheTrack_StreamedAnimation : public UGeometryCacheTrack
+{
+	GENERATED_UCLASS_BODY()
+
+	virtual ~UGeometryCacheTrack_StreamedAnimation();
+
+	//~ Begin UObject Interface.
+	virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
+	virtual void Serialize(FArchive& Ar) override;
+	virtual void BeginDestroy() override;
+	//~ End UObject Interface.
+
+	//~ Begin UGeometryCacheTrack Interface.
+	virtual const bool UpdateMeshData(const float Time, const bool bLooping, int32& InOutMeshSampleIndex, FGeometryCacheMeshData*& OutMeshData) override;
+	virtual void ReleaseMeshData(const int32 MeshSampleIndex) override;
+	virtual const float GetMaxSampleTime() const override;
+	//~ End UGeometryCacheTrack Interface.
+
+	/**
+	* Add a GeometryCacheMeshData sample to the Track, samples are encoded once a group is complete or FinishAddingMeshSamples is called
+	*
+	* @param MeshData - Holds the mesh data for the specific sample
+	* @param SampleTime - SampleTime for the specific sample being added
+	* @return void
+	*/
+	UFUNCTION()
+	void AddMeshSample(const FGeometryCacheMeshData& MeshData, const float SampleTime);
+
+	/** Encodes the samples that haven't been encoded yet, must be called after the last AddMeshSample */
+	void FinishAddingMeshSamples();
+
+	/** Maximum number of samples encoded relative to one keyframe, also the granularity at which samples are streamed. Set before adding samples. */
+	UPROPERTY(VisibleAnywhere, Category = GeometryCache)
+	int32 KeyframeInterval;
+
+private:
+	/** Samples encoded together, starting with a keyframe */
+	struct FSampleGroup
+	{
+		int32 FirstSampleIndex;
+		int32 NumSamples;
+		/** Location of the compressed samples in BulkData */
+		int64 Offset;
+		int32 CompressedSize;
+		int32 UncompressedSize;
+
+		friend FArchive& operator<<(FArchive& Ar, FSampleGroup& Group)
+		{
+			Ar << Group.FirstSampleIndex;
+			Ar << Group.NumSamples;
+			Ar << Group.Offset;
+			Ar << Group.CompressedSize;
+			Ar << Group.UncompressedSize;
+			return Ar;
+		}
+	};
+
+	typedef TSharedPtr<TArray<FGeometryCacheMeshData>, ESPMode::ThreadSafe> FDecodedSamplesPtr;
+
+	/** Samples of a group that are decoded or being decoded */
+	struct FDecodedGroup
+	{
+		/** Set once decoding finished */
+		FDecodedSamplesPtr Samples;
+		/** Pending decode on the thread pool */
+		TFuture<FDecodedSamplesPtr> PendingSamples;
+		/** Number of mesh data pointers handed out by UpdateMeshData and not yet released */
+		int32 NumUsers;
+
+		FDecodedGroup()
+			: NumUsers(0)
+		{
+		}
+	};
+
+	/** Encodes PendingSamples as a new group into PendingEncodedData */
+	void EncodePendingSamples();
+
+	/** Returns the group that contains the sample */
+	int32 FindGroupIndex(const int32 MeshSampleIndex) const;
+
+	/** Starts decoding the group, asynchronously if allowed */
+	FDecodedGroup& RequestGroup(const int32 GroupIndex, const bool bAsync);
+
+	/** Returns the decoded samples of the group, waiting for or performing the decode if needed */
+	const FDecodedSamplesPtr& GetDecodedSamples(const int32 GroupIndex);
+
+	/** Drops decoded groups that are neither in use nor following a group in use */
+	void TrimDecodedGroups();
+
+	/** Number of Mesh Sample within this track */
+	UPROPERTY(VisibleAnywhere, Category = GeometryCache)
+	uint32 NumMeshSamples;
+
+	TArray<float> MeshSampleTimes;
+	TArray<FSampleGroup> SampleGroups;
+
+	/** Encoded samples of all groups */
+	FByteBulkData BulkData;
+
+	/** Samples added since the last group was encoded */
+	TArray<FGeometryCacheMeshData> PendingSamples;
+
+	/** Groups encoded since the last FinishAddingMeshSamples, appended to BulkData in one go */
+	TArray<uint8> PendingEncodedData;
+
+	/** Decoded groups by group index */
+	TMap<int32, FDecodedGroup> DecodedGroups;
+};
@@ -5,6 +5,7 @@
 #include "Materials/MaterialInterface.h"
 #include "GeometryCacheTrackTransformAnimation.h"
 #include "GeometryCacheTrackFlipbookAnimation.h"
+#include "GeometryCacheTrackStreamedAnimation.h"
 #include "UObject/FrameworkObjectVersion.h"
 #include "Interfaces/ITargetPlatform.h"
 
@@ -127,7 +128,7 @@ void UGeometryCache::AddTrack(UGeometryCacheTrack* Track)
 	{
 		NumTransformAnimationTracks++;
 	}
-	else if (Track->GetClass() == UGeometryCacheTrack_FlipbookAnimation::StaticClass())
+	else if (Track->GetClass() == UGeometryCacheTrack_FlipbookAnimation::StaticClass() || Track->GetClass() == UGeometryCacheTrack_StreamedAnimation::StaticClass())
 	{
 		NumVertexAnimationTracks++;
 	}
@@ -0,0 +1,361 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "GeometryCacheCodec.h"
+#include "GeometryCacheMeshData.h"
+#include "Misc/Compression.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogGeometryCacheCodec, Log, All);
+
+namespace GeometryCacheCodec
+{
+	/** Parts stored for a frame, positions are always stored */
+	enum EFrameFlags : uint8
+	{
+		Keyframe = 1 << 0,
+		TextureCoordinates = 1 << 1,
+		TangentX = 1 << 2,
+		TangentZ = 1 << 3,
+		Colors = 1 << 4,
+		Indices = 1 << 5,
+		Batches = 1 << 6,
+	};
+
+	static const float QuantizationMax = 65535.0f;
+
+	/** Maps small negative and positive deltas to small unsigned values */
+	FORCEINLINE uint16 ZigZag(int16 Value)
+	{
+		return (uint16)((Value << 1) ^ (Value >> 15));
+	}
+
+	FORCEINLINE int16 UnZigZag(uint16 Value)
+	{
+		return (int16)((Value >> 1) ^ (uint16)(-(int16)(Value & 1)));
+	}
+
+	/** Writes the low bytes of all values followed by the high bytes, zlib finds far more matches in the planes than in interleaved values */
+	void WriteBytePlanes(FArchive& Ar, const TArray<uint16>& Values)
+	{
+		TArray<uint8> Planes;
+		Planes.AddUninitialized(Values.Num() * 2);
+		for (int32 Index = 0; Index < Values.Num(); ++Index)
+		{
+			Planes[Index] = (uint8)(Values[Index] & 0xff);
+			Planes[Values.Num() + Index] = (uint8)(Values[Index] >> 8);
+		}
+		Ar.Serialize(Planes.GetData(), Planes.Num());
+	}
+
+	void ReadBytePlanes(FArchive& Ar, TArray<uint16>& Values)
+	{
+		TArray<uint8> Planes;
+		Planes.AddUninitialized(Values.Num() * 2);
+		Ar.Serialize(Planes.GetData(), Planes.Num());
+		for (int32 Index = 0; Index < Values.Num(); ++Index)
+		{
+			Values[Index] = (uint16)Planes[Index] | ((uint16)Planes[Values.Num() + Index] << 8);
+		}
+	}
+
+	template<typename AttributeType>
+	bool HasAttributeChanged(const TArray<FDynamicMeshVertex>& Vertices, const TArray<FDynamicMeshVertex>& PreviousVertices, AttributeType FDynamicMeshVertex::*Attribute)
+	{
+		for (int32 Index = 0; Index < Vertices.Num(); ++Index)
+		{
+			if (!(Vertices[Index].*Attribute == PreviousVertices[Index].*Attribute))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/** Stores one attribute of all vertices next to each other */
+	template<typename AttributeType>
+	void WriteAttribute(FArchive& Ar, const TArray<FDynamicMeshVertex>& Vertices, AttributeType FDynamicMeshVertex::*Attribute)
+	{
+		TArray<AttributeType> Values;
+		Values.AddUninitialized(Vertices.Num());
+		for (int32 Index = 0; Index < Vertices.Num(); ++Index)
+		{
+			Values[Index] = Vertices[Index].*Attribute;
+		}
+		Ar.Serialize(Values.GetData(), Values.Num() * sizeof(AttributeType));
+	}
+
+	template<typename AttributeType>
+	void ReadAttribute(FArchive& Ar, TArray<FDynamicMeshVertex>& Vertices, AttributeType FDynamicMeshVertex::*Attribute)
+	{
+		TArray<AttributeType> Values;
+		Values.AddUninitialized(Vertices.Num());
+		Ar.Serialize(Values.GetData(), Values.Num() * sizeof(AttributeType));
+		for (int32 Index = 0; Index < Vertices.Num(); ++Index)
+		{
+			Vertices[Index].*Attribute = Values[Index];
+		}
+	}
+
+	bool AreBatchesEqual(const TArray<FGeometryCacheMeshBatchInfo>& A, const TArray<FGeometryCacheMeshBatchInfo>& B)
+	{
+		return A.Num() == B.Num() && FMemory::Memcmp(A.GetData(), B.GetData(), A.Num() * sizeof(FGeometryCacheMeshBatchInfo)) == 0;
+	}
+}
+
+bool FGeometryCacheCodec::HaveSameTopology(const FGeometryCacheMeshData& A, const FGeometryCacheMeshData& B)
+{
+	return A.Vertices.Num() == B.Vertices.Num();
+}
+
+int32 FGeometryCacheCodec::EncodeFrames(const TArray<FGeometryCacheMeshData>& Frames, TArray<uint8>& OutCompressedData)
+{
+	using namespace GeometryCacheCodec;
+
+	OutCompressedData.Reset();
+	if (Frames.Num() == 0)
+	{
+		return 0;
+	}
+
+	int32 NumFrames = Frames.Num();
+	int32 NumVertices = Frames[0].Vertices.Num();
+
+	// Quantize against the bounds of the whole run so deltas between frames stay exact
+	FBox QuantizationBounds(ForceInit);
+	for (const FGeometryCacheMeshData& Frame : Frames)
+	{
+		check(Frame.Vertices.Num() == NumVertices);
+		for (const FDynamicMeshVertex& Vertex : Frame.Vertices)
+		{
+			QuantizationBounds += Vertex.Position;
+		}
+	}
+
+	FVector QuantizationMin = QuantizationBounds.IsValid ? QuantizationBounds.Min : FVector::ZeroVector;
+	FVector QuantizationStep = QuantizationBounds.IsValid ? (QuantizationBounds.Max - QuantizationBounds.Min) / QuantizationMax : FVector::ZeroVector;
+	const FVector InvQuantizationStep(
+		QuantizationStep.X > 0.0f ? 1.0f / QuantizationStep.X : 0.0f,
+		QuantizationStep.Y > 0.0f ? 1.0f / QuantizationStep.Y : 0.0f,
+		QuantizationStep.Z > 0.0f ? 1.0f / QuantizationStep.Z : 0.0f);
+
+	TArray<uint8> UncompressedData;
+	FMemoryWriter Ar(UncompressedData);
+	Ar << NumFrames;
+	Ar << NumVertices;
+	Ar << QuantizationMin;
+	Ar << QuantizationStep;
+
+	TArray<uint16> QuantizedPositions;
+	TArray<uint16> PreviousQuantizedPositions;
+	TArray<uint16> StoredPositions;
+	QuantizedPositions.AddUninitialized(NumVertices * 3);
+	StoredPositions.AddUninitialized(NumVertices * 3);
+
+	for (int32 FrameIndex = 0; FrameIndex < NumFrames; ++FrameIndex)
+	{
+		const FGeometryCacheMeshData& Frame = Frames[FrameIndex];
+		const FGeometryCacheMeshData* PreviousFrame = FrameIndex > 0 ? &Frames[FrameIndex - 1] : nullptr;
+
+		uint8 Flags = 0;
+		if (PreviousFrame == nullptr)
+		{
+			Flags = Keyframe | TextureCoordinates | TangentX | TangentZ | Colors | Indices | Batches;
+		}
+		else
+		{
+			Flags |= HasAttributeChanged(Frame.Vertices, PreviousFrame->Vertices, &FDynamicMeshVertex::TextureCoordinate) ? TextureCoordinates : 0;
+			Flags |= HasAttributeChanged(Frame.Vertices, PreviousFrame->Vertices, &FDynamicMeshVertex::TangentX) ? TangentX : 0;
+			Flags |= HasAttributeChanged(Frame.Vertices, PreviousFrame->Vertices, &FDynamicMeshVertex::TangentZ) ? TangentZ : 0;
+			Flags |= HasAttributeChanged(Frame.Vertices, PreviousFrame->Vertices, &FDynamicMeshVertex::Color) ? Colors : 0;
+			Flags |= Frame.Indices != PreviousFrame->Indices ? Indices : 0;
+			Flags |= !AreBatchesEqual(Frame.BatchesInfo, PreviousFrame->BatchesInfo) ? Batches : 0;
+		}
+
+		Ar << Flags;
+		FBox BoundingBox = Frame.BoundingBox;
+		Ar << BoundingBox;
+
+		for (int32 VertexIndex = 0; VertexIndex < NumVertices; ++VertexIndex)
+		{
+			const FVector Quantized = (Frame.Vertices[VertexIndex].Position - QuantizationMin) * InvQuantizationStep;
+			QuantizedPositions[VertexIndex * 3 + 0] = (uint16)FMath::Clamp(FMath::RoundToInt(Quantized.X), 0, 65535);
+			QuantizedPositions[VertexIndex * 3 + 1] = (uint16)FMath::Clamp(FMath::RoundToInt(Quantized.Y), 0, 65535);
+			QuantizedPositions[VertexIndex * 3 + 2] = (uint16)FMath::Clamp(FMath::RoundToInt(Quantized.Z), 0, 65535);
+		}
+
+		if (Flags & Keyframe)
+		{
+			WriteBytePlanes(Ar, QuantizedPositions);
+		}
+		else
+		{
+			for (int32 Index = 0; Index < QuantizedPositions.Num(); ++Index)
+			{
+				StoredPositions[Index] = ZigZag((int16)(QuantizedPositions[Index] - PreviousQuantizedPositions[Index]));
+			}
+			WriteBytePlanes(Ar, StoredPositions);
+		}
+		PreviousQuantizedPositions = QuantizedPositions;
+
+		if (Flags & TextureCoordinates)
+		{
+			WriteAttribute(Ar, Frame.Vertices, &FDynamicMeshVertex::TextureCoordinate);
+		}
+		if (Flags & TangentX)
+		{
+			WriteAttribute(Ar, Frame.Vertices, &FDynamicMeshVertex::TangentX);
+		}
+		if (Flags & TangentZ)
+		{
+			WriteAttribute(Ar, Frame.Vertices, &FDynamicMeshVertex::TangentZ);
+		}
+		if (Flags & Colors)
+		{
+			WriteAttribute(Ar, Frame.Vertices, &FDynamicMeshVertex::Color);
+		}
+		if (Flags & Indices)
+		{
+			TArray<uint32> FrameIndices = Frame.Indices;
+			Ar << FrameIndices;
+		}
+		if (Flags & Batches)
+		{
+			TArray<FGeometryCacheMeshBatchInfo> FrameBatches = Frame.BatchesInfo;
+			Ar << FrameBatches;
+		}
+	}
+
+	int32 CompressedSize = FCompression::CompressMemoryBound(COMPRESS_ZLIB, UncompressedData.Num());
+	OutCompressedData.AddUninitialized(CompressedSize);
+	verify(FCompression::CompressMemory(COMPRESS_ZLIB, OutCompressedData.GetData(), CompressedSize, UncompressedData.GetData(), UncompressedData.Num()));
+	OutCompressedData.SetNum(CompressedSize, false);
+
+	return UncompressedData.Num();
+}
+
+bool FGeometryCacheCodec::DecodeFrames(const uint8* CompressedData, int32 CompressedSize, int32 UncompressedSize, TArray<FGeometryCacheMeshData>& OutFrames)
+{
+	using namespace GeometryCacheCodec;
+
+	OutFrames.Reset();
+
+	TArray<uint8> UncompressedData;
+	UncompressedData.AddUninitialized(UncompressedSize);
+	if (!FCompression::UncompressMemory(COMPRESS_ZLIB, UncompressedData.GetData(), UncompressedSize, CompressedData, CompressedSize))
+	{
+		UE_LOG(LogGeometryCacheCodec, Error, TEXT("Failed to decompress %d bytes of geometry cache frames"), CompressedSize);
+		return false;
+	}
+
+	FMemoryReader Ar(UncompressedData);
+	int32 NumFrames = 0;
+	int32 NumVertices = 0;
+	FVector QuantizationMin;
+	FVector QuantizationStep;
+	Ar << NumFrames;
+	Ar << NumVertices;
+	Ar << QuantizationMin;
+	Ar << QuantizationStep;
+
+	if (NumFrames < 0 || NumVertices < 0 || (int64)NumVertices * 6 > UncompressedSize)
+	{
+		UE_LOG(LogGeometryCacheCodec, Error, TEXT("Corrupt geometry cache frames header"));
+		return false;
+	}
+
+	TArray<uint16> QuantizedPositions;
+	TArray<uint16> StoredPositions;
+	QuantizedPositions.AddZeroed(NumVertices * 3);
+	StoredPositions.AddUninitialized(NumVertices * 3);
+
+	OutFrames.SetNum(NumFrames);
+	for (int32 FrameIndex = 0; FrameIndex < NumFrames && !Ar.IsError(); ++FrameIndex)
+	{
+		FGeometryCacheMeshData& Frame = OutFrames[FrameIndex];
+
+		uint8 Flags = 0;
+		Ar << Flags;
+		if (FrameIndex == 0 && !(Flags & Keyframe))
+		{
+			UE_LOG(LogGeometryCacheCodec, Error, TEXT("Geometry cache frames don't start with a keyframe"));
+			return false;
+		}
+
+		// Start from the previous frame, only what changed is stored
+		if (FrameIndex > 0)
+		{
+			const FGeometryCacheMeshData& PreviousFrame = OutFrames[FrameIndex - 1];
+			Frame.Vertices = PreviousFrame.Vertices;
+			if (!(Flags & Indices))
+			{
+				Frame.Indices = PreviousFrame.Indices;
+			}
+			if (!(Flags & Batches))
+			{
+				Frame.BatchesInfo = PreviousFrame.BatchesInfo;
+			}
+		}
+		else
+		{
+			Frame.Vertices.SetNumZeroed(NumVertices);
+		}
+
+		Ar << Frame.BoundingBox;
+
+		ReadBytePlanes(Ar, StoredPositions);
+		if (Flags & Keyframe)
+		{
+			QuantizedPositions = StoredPositions;
+		}
+		else
+		{
+			for (int32 Index = 0; Index < QuantizedPositions.Num(); ++Index)
+			{
+				QuantizedPositions[Index] = (uint16)(QuantizedPositions[Index] + UnZigZag(StoredPositions[Index]));
+			}
+		}
+
+		for (int32 VertexIndex = 0; VertexIndex < NumVertices; ++VertexIndex)
+		{
+			Frame.Vertices[VertexIndex].Position = QuantizationMin + FVector(
+				QuantizedPositions[VertexIndex * 3 + 0],
+				QuantizedPositions[VertexIndex * 3 + 1],
+				QuantizedPositions[VertexIndex * 3 + 2]) * QuantizationStep;
+		}
+
+		if (Flags & TextureCoordinates)
+		{
+			ReadAttribute(Ar, Frame.Vertices, &FDynamicMeshVertex::TextureCoordinate);
+		}
+		if (Flags & TangentX)
+		{
+			ReadAttribute(Ar, Frame.Vertices, &FDynamicMeshVertex::TangentX);
+		}
+		if (Flags & TangentZ)
+		{
+			ReadAttribute(Ar, Frame.Vertices, &FDynamicMeshVertex::TangentZ);
+		}
+		if (Flags & Colors)
+		{
+			ReadAttribute(Ar, Frame.Vertices, &FDynamicMeshVertex::Color);
+		}
+		if (Flags & Indices)
+		{
+			Ar << Frame.Indices;
+		}
+		if (Flags & Batches)
+		{
+			Ar << Frame.BatchesInfo;
+		}
+	}
+
+	if (Ar.IsError())
+	{
+		UE_LOG(LogGeometryCacheCodec, Error, TEXT("Geometry cache frames are truncated"));
+		OutFrames.Reset();
+		return false;
+	}
+
+	return true;
+}
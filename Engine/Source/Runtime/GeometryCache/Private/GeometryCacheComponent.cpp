@@ -40,6 +40,7 @@ void UGeometryCacheComponent::OnRegister()
 
 void UGeometryCacheComponent::ClearTrackData()
 {
+	ReleaseTrackMeshData();
 	NumTracks = 0;
 	TrackMatrixSampleIndices.Empty();
 	TrackMatrixSampleIndices.Empty();
@@ -72,6 +73,7 @@ void UGeometryCacheComponent::SetupTrackData()
 
 			// First time so create rather than update the mesh sections
 			CreateTrackSection(TrackIndex, WorldMatrix, MeshData);
+			TrackSections[TrackIndex].MeshSampleIndex = MeshSampleIndex;
 
 			// Store the sample indices for both the mesh and matrix data
 			TrackMeshSampleIndices.Add(MeshSampleIndex);
@@ -87,6 +89,7 @@ void UGeometryCacheComponent::OnUnregister()
 {
 	Super::OnUnregister();
 
+	ReleaseTrackMeshData();
 	NumTracks = 0;
 	TrackMatrixSampleIndices.Empty();
 	TrackMatrixSampleIndices.Empty();
@@ -124,7 +127,15 @@ void UGeometryCacheComponent::TickComponent(float DeltaTime, enum ELevelTick Tic
 
 			if (bUpdateMesh)
 			{
+				// The previous sample is still used while the section is updated, release it afterwards
+				const int32 PreviousMeshSampleIndex = TrackSections[TrackIndex].MeshSampleIndex;
 				UpdateTrackSectionMeshData(TrackIndex, MeshData);
+				TrackSections[TrackIndex].MeshSampleIndex = TrackMeshSampleIndices[TrackIndex];
+
+				if (PreviousMeshSampleIndex != INDEX_NONE)
+				{
+					Track->ReleaseMeshData(PreviousMeshSampleIndex);
+				}
 			}			
 		}
 	}
@@ -216,26 +227,33 @@ void UGeometryCacheComponent::UpdateTrackSectionMeshData(int32 SectionIndex, FGe
 	const int32 NumVerts = MeshData->Vertices.Num();
 	
 	// Update MeshDataPointer
+	const FGeometryCacheMeshData* PreviousMeshData = UpdateSection.MeshData;
 	UpdateSection.MeshData = MeshData;
 
-	//if (FGeometryCacheSceneProxy* CastedProxy = static_cast<FGeometryCacheSceneProxy*>(SceneProxy))
-	//{		
-	//	UpdateTrackSectionVertexbuffer(SectionIndex, MeshData);
-	//	UpdateTrackSectionIndexbuffer(SectionIndex, MeshData->Indices);
-	//	// Will update the bounds (used for frustum culling)
-	//	MarkRenderTransformDirty();
-	//	MarkRenderDynamicDataDirty();
-	//}
-	//else
-	//{
-	//	// Recreate scene proxy
-	//	MarkRenderStateDirty(); 
-	//}
-
 	// Update overall bounds	
 	UpdateLocalBounds();
 
-	MarkRenderStateDirty();
+	// The proxy's buffers can be updated in place as long as it has the same sections and materials, otherwise recreate it
+	bool bCanUpdateBuffers = SceneProxy != nullptr && !IsRenderStateDirty() && PreviousMeshData != nullptr
+		&& PreviousMeshData->Indices.Num() > 0 && MeshData->Indices.Num() > 0
+		&& PreviousMeshData->BatchesInfo.Num() == MeshData->BatchesInfo.Num();
+	for (int32 BatchIndex = 0; bCanUpdateBuffers && BatchIndex < MeshData->BatchesInfo.Num(); ++BatchIndex)
+	{
+		bCanUpdateBuffers = PreviousMeshData->BatchesInfo[BatchIndex].MaterialIndex == MeshData->BatchesInfo[BatchIndex].MaterialIndex;
+	}
+
+	if (bCanUpdateBuffers)
+	{
+		UpdateTrackSectionVertexbuffer(SectionIndex, MeshData);
+		UpdateTrackSectionIndexbuffer(SectionIndex, MeshData);
+		// Will update the bounds (used for frustum culling)
+		MarkRenderTransformDirty();
+	}
+	else
+	{
+		// Recreate scene proxy
+		MarkRenderStateDirty();
+	}
 }
 
 void UGeometryCacheComponent::UpdateTrackSectionMatrixData(int32 SectionIndex, const FMatrix& WorldMatrix)
@@ -267,27 +285,29 @@ void UGeometryCacheComponent::UpdateTrackSectionVertexbuffer(int32 SectionIndex,
 {
 	FGeometryCacheSceneProxy* CastedProxy = static_cast<FGeometryCacheSceneProxy*>(SceneProxy);
 
+	// Copy the vertices, the track may free the mesh data before the command executes
 	ENQUEUE_UNIQUE_RENDER_COMMAND_THREEPARAMETER(
 		FUpdateVertexBufferCommand,
 		FGeometryCacheSceneProxy*, SceneProxy, CastedProxy,
 		const int32, Index, SectionIndex,
-		FGeometryCacheMeshData*, Data, MeshData,
+		TArray<FDynamicMeshVertex>, Vertices, MeshData->Vertices,
 		{
-		SceneProxy->UpdateSectionVertexBuffer(Index, Data);
+		SceneProxy->UpdateSectionVertexBuffer(Index, Vertices);
 	});
 }
 
-void UGeometryCacheComponent::UpdateTrackSectionIndexbuffer(int32 SectionIndex, const TArray<uint32>& Indices)
+void UGeometryCacheComponent::UpdateTrackSectionIndexbuffer(int32 SectionIndex, FGeometryCacheMeshData* MeshData)
 {
 	FGeometryCacheSceneProxy* CastedProxy = static_cast<FGeometryCacheSceneProxy*>(SceneProxy);
 
-	ENQUEUE_UNIQUE_RENDER_COMMAND_THREEPARAMETER(
-		FUpdateVertexBufferCommand,
+	ENQUEUE_UNIQUE_RENDER_COMMAND_FOURPARAMETER(
+		FUpdateIndexBufferCommand,
 		FGeometryCacheSceneProxy*, SceneProxy, CastedProxy,
 		const int32, Index, SectionIndex,
-		const TArray<uint32>&, Data, Indices,
+		TArray<uint32>, Indices, MeshData->Indices,
+		TArray<FGeometryCacheMeshBatchInfo>, BatchesInfo, MeshData->BatchesInfo,
 		{
-		SceneProxy->UpdateSectionIndexBuffer(Index, Data);
+		SceneProxy->UpdateSectionIndexBuffer(Index, Indices, BatchesInfo);
 	});
 }
 
@@ -322,6 +342,7 @@ void UGeometryCacheComponent::OnObjectReimported(UGeometryCache* ImportedGeometr
 
 				// First time so create rather than update the mesh sections
 				CreateTrackSection(TrackIndex, WorldMatrix, MeshData);
+				TrackSections[TrackIndex].MeshSampleIndex = MeshSampleIndex;
 
 				// Store the sample indices for both the mesh and matrix data
 				TrackMeshSampleIndices.Add(MeshSampleIndex);
@@ -408,9 +429,11 @@ bool UGeometryCacheComponent::SetGeometryCache(UGeometryCache* NewGeomCache)
 	}
 
 
+	// Release the sections while they still refer to the old tracks
+	ClearTrackData();
+
 	GeometryCache = NewGeomCache;
 
-	ClearTrackData();
 	SetupTrackData();
 
 	// Need to send this to render thread at some point
@@ -471,6 +494,7 @@ void UGeometryCacheComponent::InvalidateTrackSampleIndices()
 
 void UGeometryCacheComponent::ReleaseResources()
 {
+	ReleaseTrackMeshData();
 	GeometryCache = nullptr;
 	NumTracks = 0;
 	TrackMatrixSampleIndices.Empty();
@@ -479,6 +503,19 @@ void UGeometryCacheComponent::ReleaseResources()
 	DetachFence.BeginFence();
 }
 
+void UGeometryCacheComponent::ReleaseTrackMeshData()
+{
+	for (int32 TrackIndex = 0; TrackIndex < TrackSections.Num(); ++TrackIndex)
+	{
+		FTrackRenderData& Section = TrackSections[TrackIndex];
+		if (Section.MeshSampleIndex != INDEX_NONE && GeometryCache != nullptr && GeometryCache->Tracks.IsValidIndex(TrackIndex) && GeometryCache->Tracks[TrackIndex] != nullptr)
+		{
+			GeometryCache->Tracks[TrackIndex]->ReleaseMeshData(Section.MeshSampleIndex);
+		}
+		Section.MeshSampleIndex = INDEX_NONE;
+	}
+}
+
 #if WITH_EDITOR
 void UGeometryCacheComponent::PreEditUndo()
 {
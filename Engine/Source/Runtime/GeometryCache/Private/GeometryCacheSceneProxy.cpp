@@ -24,7 +24,8 @@ FGeometryCacheSceneProxy::FGeometryCacheSceneProxy(UGeometryCacheComponent* Comp
 			FGeomCacheTrackProxy* NewSection = new FGeomCacheTrackProxy();
 
 			NewSection->WorldMatrix = SrcSection.WorldMatrix;
-			FGeometryCacheMeshData* MeshData = NewSection->MeshData = SrcSection.MeshData;
+			FGeometryCacheMeshData* MeshData = SrcSection.MeshData;
+			NewSection->BatchesInfo = MeshData->BatchesInfo;
 
 			// Copy data from vertex buffer
 			const int32 NumVerts = MeshData->Vertices.Num();
@@ -102,10 +103,10 @@ void FGeometryCacheSceneProxy::GetDynamicMeshElements(const TArray<const FSceneV
 		// Render out stored TrackProxy's
 		if (TrackProxy != nullptr)
 		{
-			INC_DWORD_STAT_BY(STAT_GeometryCacheSceneProxy_MeshBatchCount, TrackProxy->MeshData->BatchesInfo.Num());
+			INC_DWORD_STAT_BY(STAT_GeometryCacheSceneProxy_MeshBatchCount, TrackProxy->BatchesInfo.Num());
 
 			int32 BatchIndex = 0;
-			for (FGeometryCacheMeshBatchInfo& BatchInfo : TrackProxy->MeshData->BatchesInfo)
+			for (const FGeometryCacheMeshBatchInfo& BatchInfo : TrackProxy->BatchesInfo)
 			{
 				FMaterialRenderProxy* MaterialProxy = bWireframe ? WireframeMaterialInstance : TrackProxy->Materials[BatchIndex]->GetRenderProxy(IsSelected());
 
@@ -187,32 +188,55 @@ void FGeometryCacheSceneProxy::UpdateSectionWorldMatrix(const int32 SectionIndex
 }
 
 
-void FGeometryCacheSceneProxy::UpdateSectionVertexBuffer(const int32 SectionIndex, FGeometryCacheMeshData* MeshData)
+void FGeometryCacheSceneProxy::UpdateSectionVertexBuffer(const int32 SectionIndex, const TArray<FDynamicMeshVertex>& Vertices)
 {
 	check(SectionIndex < Sections.Num() && "Section Index out of range");
 	check(IsInRenderingThread());
 
-	Sections[SectionIndex]->MeshData = MeshData;
+	FGeomCacheVertexBuffer& VertexBuffer = Sections[SectionIndex]->VertexBuffer;
+	if (VertexBuffer.Vertices.Num() != Vertices.Num())
+	{
+		VertexBuffer.Vertices = Vertices;
+		VertexBuffer.InitRHI();
+		return;
+	}
 
-	const bool bRecreate = Sections[SectionIndex]->VertexBuffer.Vertices.Num() != Sections[SectionIndex]->MeshData->Vertices.Num();
-	Sections[SectionIndex]->VertexBuffer.Vertices.Empty(Sections[SectionIndex]->MeshData->Vertices.Num());
-	Sections[SectionIndex]->VertexBuffer.Vertices.Append(Sections[SectionIndex]->MeshData->Vertices);
+	// Parts of a cache are often at rest, only upload the range of vertices that actually changed
+	const int32 NumVertices = Vertices.Num();
+	int32 FirstChanged = 0;
+	while (FirstChanged < NumVertices && FMemory::Memcmp(&VertexBuffer.Vertices[FirstChanged], &Vertices[FirstChanged], sizeof(FDynamicMeshVertex)) == 0)
+	{
+		++FirstChanged;
+	}
 
-	if (bRecreate)
+	if (FirstChanged == NumVertices)
 	{
-		Sections[SectionIndex]->VertexBuffer.InitRHI();
+		return;
 	}
-	else
+
+	int32 LastChanged = NumVertices - 1;
+	while (LastChanged > FirstChanged && FMemory::Memcmp(&VertexBuffer.Vertices[LastChanged], &Vertices[LastChanged], sizeof(FDynamicMeshVertex)) == 0)
 	{
-		Sections[SectionIndex]->VertexBuffer.UpdateRHI();
+		--LastChanged;
 	}
+
+	const int32 NumChanged = LastChanged - FirstChanged + 1;
+	FMemory::Memcpy(&VertexBuffer.Vertices[FirstChanged], &Vertices[FirstChanged], NumChanged * sizeof(FDynamicMeshVertex));
+	VertexBuffer.UpdateRHI(FirstChanged, NumChanged);
 }
 
-void FGeometryCacheSceneProxy::UpdateSectionIndexBuffer(const int32 SectionIndex, const TArray<uint32>& Indices)
+void FGeometryCacheSceneProxy::UpdateSectionIndexBuffer(const int32 SectionIndex, const TArray<uint32>& Indices, const TArray<FGeometryCacheMeshBatchInfo>& BatchesInfo)
 {
 	check(SectionIndex < Sections.Num() && "Section Index out of range");
 	check(IsInRenderingThread());
 
+	Sections[SectionIndex]->BatchesInfo = BatchesInfo;
+
+	if (Sections[SectionIndex]->IndexBuffer.Indices == Indices)
+	{
+		return;
+	}
+
 	const bool bRecreate = Sections[SectionIndex]->IndexBuffer.Indices.Num() != Indices.Num();
 	
 	Sections[SectionIndex]->IndexBuffer.Indices.Empty(Indices.Num());
@@ -304,9 +328,20 @@ void FGeomCacheVertexBuffer::InitRHI()
 
 void FGeomCacheVertexBuffer::UpdateRHI()
 {
+	UpdateRHI(0, Vertices.Num());
+}
+
+void FGeomCacheVertexBuffer::UpdateRHI(int32 FirstVertex, int32 NumVertices)
+{
+	check(FirstVertex >= 0 && FirstVertex + NumVertices <= Vertices.Num());
+	if (NumVertices == 0)
+	{
+		return;
+	}
+
 	// Copy the vertex data into the vertex buffer.
-	void* VertexBufferData = RHILockVertexBuffer(VertexBufferRHI, 0, Vertices.Num() * sizeof(FDynamicMeshVertex), RLM_WriteOnly);
-	FMemory::Memcpy(VertexBufferData, Vertices.GetData(), Vertices.Num() * sizeof(FDynamicMeshVertex));
+	void* VertexBufferData = RHILockVertexBuffer(VertexBufferRHI, FirstVertex * sizeof(FDynamicMeshVertex), NumVertices * sizeof(FDynamicMeshVertex), RLM_WriteOnly);
+	FMemory::Memcpy(VertexBufferData, &Vertices[FirstVertex], NumVertices * sizeof(FDynamicMeshVertex));
 	RHIUnlockVertexBuffer(VertexBufferRHI);
 }
 
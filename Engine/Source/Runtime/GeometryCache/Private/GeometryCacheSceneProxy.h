@@ -10,9 +10,9 @@
 #include "Materials/MaterialInterface.h"
 #include "LocalVertexFactory.h"
 #include "DynamicMeshBuilder.h"
+#include "GeometryCacheMeshData.h"
 
 class FMeshElementCollector;
-struct FGeometryCacheMeshData;
 
 DECLARE_STATS_GROUP(TEXT("GeometryCache"), STATGROUP_GeometryCache, STATCAT_Advanced);
 DECLARE_CYCLE_STAT(TEXT("MeshTime"), STAT_GeometryCacheSceneProxy_GetMeshElements, STATGROUP_GeometryCache );
@@ -46,6 +46,9 @@ public:
 	virtual void InitRHI() override;
 
 	void UpdateRHI();
+
+	/** Uploads only the given range of Vertices */
+	void UpdateRHI(int32 FirstVertex, int32 NumVertices);
 };
 
 /** Index Buffer */
@@ -76,8 +79,8 @@ public:
 class GEOMETRYCACHE_API FGeomCacheTrackProxy
 {
 public:
-	/** MeshData storing information used for rendering this Track */
-	FGeometryCacheMeshData* MeshData;
+	/** Batches of the mesh data this Track was last updated with, copied since the mesh data may be freed by the track */
+	TArray<FGeometryCacheMeshBatchInfo> BatchesInfo;
 
 	/** Material applied to this Track */
 	TArray<UMaterialInterface*> Materials;
@@ -111,10 +114,10 @@ public:
 
 	/** Update world matrix for specific section */
 	void UpdateSectionWorldMatrix(const int32 SectionIndex, const FMatrix& WorldMatrix);
-	/** Update vertex buffer for specific section */
-	void UpdateSectionVertexBuffer(const int32 SectionIndex, FGeometryCacheMeshData* MeshData );
-	/** Update index buffer for specific section */
-	void UpdateSectionIndexBuffer(const int32 SectionIndex, const TArray<uint32>& Indices);
+	/** Update vertex buffer for specific section, only vertices that differ from the current ones are uploaded */
+	void UpdateSectionVertexBuffer(const int32 SectionIndex, const TArray<FDynamicMeshVertex>& Vertices);
+	/** Update index buffer and batches for specific section, the index buffer is only uploaded if the indices changed */
+	void UpdateSectionIndexBuffer(const int32 SectionIndex, const TArray<uint32>& Indices, const TArray<FGeometryCacheMeshBatchInfo>& BatchesInfo);
 
 	/** Clears the Sections array*/
 	void ClearSections();
@@ -12,6 +12,10 @@ const bool UGeometryCacheTrack::UpdateMeshData(const float Time, const bool bLoo
 	return false;
 }
 
+void UGeometryCacheTrack::ReleaseMeshData(const int32 MeshSampleIndex)
+{
+}
+
 const bool UGeometryCacheTrack::UpdateMatrixData(const float Time, const bool bLooping, int32& InOutMatrixSampleIndex, FMatrix& OutWorldMatrix)
 {
 	// Retrieve sample index from Time
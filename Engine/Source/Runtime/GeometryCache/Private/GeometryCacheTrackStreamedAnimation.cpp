@@ -0,0 +1,347 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "GeometryCacheTrackStreamedAnimation.h"
+#include "GeometryCacheCodec.h"
+#include "Async/Async.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformFilemanager.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogGeometryCacheStreaming, Log, All);
+
+static TAutoConsoleVariable<int32> CVarGeometryCacheDecodeAhead(
+	TEXT("GeometryCache.DecodeAhead"),
+	1,
+	TEXT("Whether streamed geometry cache tracks decode the group of samples following the one being played on the thread pool.\n")
+	TEXT("When disabled groups are decoded on the game thread the first time one of their samples is needed."));
+
+GEOMETRYCACHE_API UGeometryCacheTrack_StreamedAnimation::UGeometryCacheTrack_StreamedAnimation(const FObjectInitializer& ObjectInitializer /*= FObjectInitializer::Get()*/) : UGeometryCacheTrack(ObjectInitializer)
+{
+	KeyframeInterval = 30;
+	NumMeshSamples = 0;
+}
+
+UGeometryCacheTrack_StreamedAnimation::~UGeometryCacheTrack_StreamedAnimation()
+{
+	NumMeshSamples = 0;
+	MeshSampleTimes.Empty();
+	SampleGroups.Empty();
+	DecodedGroups.Empty();
+}
+
+void UGeometryCacheTrack_StreamedAnimation::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+	Super::GetResourceSizeEx(CumulativeResourceSize);
+
+	// Only the decoded groups and loaded bulk data are resident
+	for (const TPair<int32, FDecodedGroup>& DecodedGroup : DecodedGroups)
+	{
+		if (DecodedGroup.Value.Samples.IsValid())
+		{
+			for (const FGeometryCacheMeshData& Sample : *DecodedGroup.Value.Samples)
+			{
+				Sample.GetResourceSizeEx(CumulativeResourceSize);
+			}
+		}
+	}
+
+	if (BulkData.IsBulkDataLoaded())
+	{
+		CumulativeResourceSize.AddDedicatedSystemMemoryBytes(BulkData.GetBulkDataSize());
+	}
+	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(PendingEncodedData.Num());
+	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(MeshSampleTimes.Num() * sizeof(float));
+	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(SampleGroups.Num() * sizeof(FSampleGroup));
+	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(sizeof(NumMeshSamples));
+}
+
+void UGeometryCacheTrack_StreamedAnimation::Serialize(FArchive& Ar)
+{
+	if (Ar.IsSaving())
+	{
+		FinishAddingMeshSamples();
+	}
+
+	UGeometryCacheTrack::Serialize(Ar);
+
+	Ar << KeyframeInterval;
+	Ar << NumMeshSamples;
+	Ar << MeshSampleTimes;
+	Ar << SampleGroups;
+
+	// Samples are read per group while playing, keep them out of the export data
+	BulkData.SetBulkDataFlags(BULKDATA_Force_NOT_InlinePayload);
+	BulkData.Serialize(Ar, this);
+}
+
+void UGeometryCacheTrack_StreamedAnimation::BeginDestroy()
+{
+	Super::BeginDestroy();
+	NumMeshSamples = 0;
+	MeshSampleTimes.Empty();
+	SampleGroups.Empty();
+	PendingSamples.Empty();
+	PendingEncodedData.Empty();
+
+	// Pending decodes only work on their own copy of the data and can be abandoned
+	DecodedGroups.Empty();
+}
+
+const bool UGeometryCacheTrack_StreamedAnimation::UpdateMeshData(const float Time, const bool bLooping, int32& InOutMeshSampleIndex, FGeometryCacheMeshData*& OutMeshData)
+{
+	if (PendingSamples.Num() > 0 || PendingEncodedData.Num() > 0)
+	{
+		FinishAddingMeshSamples();
+	}
+
+	if (SampleGroups.Num() == 0)
+	{
+		return false;
+	}
+
+	// Retrieve sample index from Time
+	const int32 MeshSampleIndex = FindSampleIndexFromTime(MeshSampleTimes, Time, bLooping);
+	if (MeshSampleIndex == InOutMeshSampleIndex)
+	{
+		return false;
+	}
+
+	const int32 GroupIndex = FindGroupIndex(MeshSampleIndex);
+	const FSampleGroup& Group = SampleGroups[GroupIndex];
+	const FDecodedSamplesPtr& Samples = GetDecodedSamples(GroupIndex);
+	check(Samples.IsValid() && MeshSampleIndex - Group.FirstSampleIndex < Samples->Num());
+
+	// The samples array isn't touched until the group is trimmed, which can't happen while it has users
+	OutMeshData = &(*Samples)[MeshSampleIndex - Group.FirstSampleIndex];
+	DecodedGroups.FindChecked(GroupIndex).NumUsers++;
+	InOutMeshSampleIndex = MeshSampleIndex;
+
+	// Decode the following group ahead so playback doesn't have to wait for it
+	const int32 NextGroupIndex = GroupIndex + 1 < SampleGroups.Num() ? GroupIndex + 1 : (bLooping ? 0 : INDEX_NONE);
+	if (NextGroupIndex != INDEX_NONE && NextGroupIndex != GroupIndex && CVarGeometryCacheDecodeAhead.GetValueOnGameThread() != 0)
+	{
+		RequestGroup(NextGroupIndex, true);
+	}
+
+	TrimDecodedGroups();
+	return true;
+}
+
+void UGeometryCacheTrack_StreamedAnimation::ReleaseMeshData(const int32 MeshSampleIndex)
+{
+	if (!MeshSampleTimes.IsValidIndex(MeshSampleIndex) || SampleGroups.Num() == 0)
+	{
+		return;
+	}
+
+	FDecodedGroup* DecodedGroup = DecodedGroups.Find(FindGroupIndex(MeshSampleIndex));
+	if (DecodedGroup != nullptr && DecodedGroup->NumUsers > 0)
+	{
+		DecodedGroup->NumUsers--;
+		TrimDecodedGroups();
+	}
+}
+
+const float UGeometryCacheTrack_StreamedAnimation::GetMaxSampleTime() const
+{
+	const float BaseTime = UGeometryCacheTrack::GetMaxSampleTime();
+
+	if (MeshSampleTimes.Num() > 0)
+	{
+		const float MeshSampleTime = MeshSampleTimes.Last();
+		return (BaseTime > MeshSampleTime) ? BaseTime : MeshSampleTime;
+	}
+
+	return BaseTime;
+}
+
+void UGeometryCacheTrack_StreamedAnimation::AddMeshSample(const FGeometryCacheMeshData& MeshData, const float SampleTime)
+{
+	// A group ends after KeyframeInterval samples or when the topology changes, the next sample starts a new one with a keyframe
+	if (PendingSamples.Num() > 0 && (PendingSamples.Num() >= KeyframeInterval || !FGeometryCacheCodec::HaveSameTopology(PendingSamples.Last(), MeshData)))
+	{
+		EncodePendingSamples();
+	}
+
+	PendingSamples.Add(MeshData);
+	MeshSampleTimes.Add(SampleTime);
+	NumMeshSamples++;
+
+	// Store the total number of materials within this track
+	if (MeshData.BatchesInfo.Num() > (int32)NumMaterials)
+	{
+		NumMaterials = MeshData.BatchesInfo.Num();
+	}
+}
+
+void UGeometryCacheTrack_StreamedAnimation::FinishAddingMeshSamples()
+{
+	EncodePendingSamples();
+
+	if (PendingEncodedData.Num() > 0)
+	{
+		const int64 ExistingSize = BulkData.GetBulkDataSize();
+		BulkData.Lock(LOCK_READ_WRITE);
+		uint8* Data = (uint8*)BulkData.Realloc(ExistingSize + PendingEncodedData.Num());
+		FMemory::Memcpy(Data + ExistingSize, PendingEncodedData.GetData(), PendingEncodedData.Num());
+		BulkData.Unlock();
+
+		PendingEncodedData.Empty();
+	}
+}
+
+void UGeometryCacheTrack_StreamedAnimation::EncodePendingSamples()
+{
+	if (PendingSamples.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<uint8> CompressedData;
+
+	FSampleGroup Group;
+	Group.FirstSampleIndex = MeshSampleTimes.Num() - PendingSamples.Num();
+	Group.NumSamples = PendingSamples.Num();
+	Group.Offset = BulkData.GetBulkDataSize() + PendingEncodedData.Num();
+	Group.UncompressedSize = FGeometryCacheCodec::EncodeFrames(PendingSamples, CompressedData);
+	Group.CompressedSize = CompressedData.Num();
+
+	PendingEncodedData.Append(CompressedData);
+	SampleGroups.Add(Group);
+	PendingSamples.Reset();
+}
+
+int32 UGeometryCacheTrack_StreamedAnimation::FindGroupIndex(const int32 MeshSampleIndex) const
+{
+	// Binary search for the last group starting at or before the sample
+	int32 MinIndex = 0;
+	int32 MaxIndex = SampleGroups.Num() - 1;
+	while (MinIndex < MaxIndex)
+	{
+		const int32 Mid = (MinIndex + MaxIndex + 1) / 2;
+		if (SampleGroups[Mid].FirstSampleIndex <= MeshSampleIndex)
+		{
+			MinIndex = Mid;
+		}
+		else
+		{
+			MaxIndex = Mid - 1;
+		}
+	}
+
+	return MinIndex;
+}
+
+UGeometryCacheTrack_StreamedAnimation::FDecodedGroup& UGeometryCacheTrack_StreamedAnimation::RequestGroup(const int32 GroupIndex, const bool bAsync)
+{
+	if (FDecodedGroup* ExistingGroup = DecodedGroups.Find(GroupIndex))
+	{
+		return *ExistingGroup;
+	}
+
+	FDecodedGroup& DecodedGroup = DecodedGroups.Add(GroupIndex);
+	const FSampleGroup& Group = SampleGroups[GroupIndex];
+
+	// Copy the group when the bulk data is resident (e.g. right after importing), otherwise read just this group from the package on the worker
+	TArray<uint8> CompressedData;
+	FString Filename = BulkData.GetFilename();
+	int64 FileOffset = 0;
+	if (BulkData.IsBulkDataLoaded() || Filename.IsEmpty())
+	{
+		Filename.Empty();
+		CompressedData.AddUninitialized(Group.CompressedSize);
+		const uint8* Data = (const uint8*)BulkData.LockReadOnly();
+		FMemory::Memcpy(CompressedData.GetData(), Data + Group.Offset, Group.CompressedSize);
+		BulkData.Unlock();
+	}
+	else
+	{
+		FileOffset = BulkData.GetBulkDataOffsetInFile() + Group.Offset;
+		if (GEventDrivenLoaderEnabled && (Filename.EndsWith(TEXT(".uasset")) || Filename.EndsWith(TEXT(".umap"))))
+		{
+			// Offsets are relative to the start of the .uasset while the data lives in the .uexp
+			FileOffset -= IFileManager::Get().FileSize(*Filename);
+			Filename = FPaths::GetBaseFilename(Filename, false) + TEXT(".uexp");
+		}
+	}
+
+	const int32 NumSamples = Group.NumSamples;
+	const int32 CompressedSize = Group.CompressedSize;
+	const int32 UncompressedSize = Group.UncompressedSize;
+	TFunction<FDecodedSamplesPtr()> DecodeSamples = [CompressedData, Filename, FileOffset, NumSamples, CompressedSize, UncompressedSize]()
+	{
+		FDecodedSamplesPtr Samples = MakeShareable(new TArray<FGeometryCacheMeshData>());
+
+		TArray<uint8> FileData;
+		const uint8* Data = CompressedData.GetData();
+		bool bSucceeded = true;
+		if (!Filename.IsEmpty())
+		{
+			FileData.AddUninitialized(CompressedSize);
+			TUniquePtr<IFileHandle> FileHandle(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*Filename));
+			bSucceeded = FileHandle.IsValid() && FileHandle->Seek(FileOffset) && FileHandle->Read(FileData.GetData(), CompressedSize);
+			UE_CLOG(!bSucceeded, LogGeometryCacheStreaming, Error, TEXT("Failed to read %d bytes of geometry cache samples from %s"), CompressedSize, *Filename);
+			Data = FileData.GetData();
+		}
+
+		if (!bSucceeded || !FGeometryCacheCodec::DecodeFrames(Data, CompressedSize, UncompressedSize, *Samples) || Samples->Num() != NumSamples)
+		{
+			// Empty samples don't render, which beats handing out stale or missing data
+			Samples->Reset();
+			Samples->SetNum(NumSamples);
+			for (FGeometryCacheMeshData& Sample : *Samples)
+			{
+				Sample.BoundingBox.Init();
+			}
+		}
+
+		return Samples;
+	};
+
+	if (bAsync)
+	{
+		DecodedGroup.PendingSamples = Async<FDecodedSamplesPtr>(EAsyncExecution::ThreadPool, MoveTemp(DecodeSamples));
+	}
+	else
+	{
+		DecodedGroup.Samples = DecodeSamples();
+	}
+
+	return DecodedGroup;
+}
+
+const UGeometryCacheTrack_StreamedAnimation::FDecodedSamplesPtr& UGeometryCacheTrack_StreamedAnimation::GetDecodedSamples(const int32 GroupIndex)
+{
+	FDecodedGroup& DecodedGroup = RequestGroup(GroupIndex, false);
+	if (!DecodedGroup.Samples.IsValid() && DecodedGroup.PendingSamples.IsValid())
+	{
+		// Decoding ahead didn't finish in time, stall rather than skip the sample
+		DecodedGroup.Samples = DecodedGroup.PendingSamples.Get();
+		DecodedGroup.PendingSamples = TFuture<FDecodedSamplesPtr>();
+	}
+
+	return DecodedGroup.Samples;
+}
+
+void UGeometryCacheTrack_StreamedAnimation::TrimDecodedGroups()
+{
+	for (auto It = DecodedGroups.CreateIterator(); It; ++It)
+	{
+		if (It.Value().NumUsers > 0)
+		{
+			continue;
+		}
+
+		// Keep groups that were decoded ahead for a group in use
+		const int32 PreviousGroupIndex = It.Key() > 0 ? It.Key() - 1 : SampleGroups.Num() - 1;
+		const FDecodedGroup* PreviousGroup = DecodedGroups.Find(PreviousGroupIndex);
+		if (PreviousGroup != nullptr && PreviousGroup->NumUsers > 0)
+		{
+			continue;
+		}
+
+		It.RemoveCurrent();
+	}
+}
@@ -0,0 +1,41 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FGeometryCacheMeshData;
+
+/**
+ * Compresses runs of geometry cache frames into a single blob that starts with a keyframe.
+ *
+ * Positions are quantized to 16 bits per component against the bounds of the run. The first frame stores them as is,
+ * the following frames store the difference to the previous frame which is mostly small for simulated caches.
+ * Texture coordinates, tangents, colors, indices and batches are only written for frames in which they changed.
+ * Every frame of a run must have the same number of vertices, a change in topology has to start a new run.
+ */
+class GEOMETRYCACHE_API FGeometryCacheCodec
+{
+public:
+	/**
+	 * Encodes the frames and compresses the result
+	 *
+	 * @param Frames - Frames to encode, all with the same number of vertices
+	 * @param OutCompressedData - Receives the compressed blob
+	 * @return Size of the blob before compression, needed to decode it
+	 */
+	static int32 EncodeFrames(const TArray<FGeometryCacheMeshData>& Frames, TArray<uint8>& OutCompressedData);
+
+	/**
+	 * Decodes a blob written by EncodeFrames
+	 *
+	 * @param CompressedData - Start of the blob
+	 * @param CompressedSize - Size of the blob in bytes
+	 * @param UncompressedSize - Value returned by EncodeFrames
+	 * @param OutFrames - Receives the decoded frames
+	 * @return False if the data could not be decompressed or is corrupt
+	 */
+	static bool DecodeFrames(const uint8* CompressedData, int32 CompressedSize, int32 UncompressedSize, TArray<FGeometryCacheMeshData>& OutFrames);
+
+	/** Returns true if both frames can be part of the same run */
+	static bool HaveSameTopology(const FGeometryCacheMeshData& A, const FGeometryCacheMeshData& B);
+};
@@ -30,6 +30,16 @@ public:
 		return RawData;
 	}
 
+	/**
+	 * Moves the image's raw data out of the wrapper, leaving it empty.
+	 *
+	 * @return The raw data the last GetRaw produced.
+	 */
+	TArray<uint8> MoveRawData()
+	{
+		return MoveTemp(RawData);
+	}
+
 public:
 
 	/**
@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
+#include "Async/Async.h"
 #include "Interfaces/IImageWrapperModule.h"
 #include "JpegImageWrapper.h"
 #include "PngImageWrapper.h"
@@ -40,19 +41,9 @@ namespace {
 		}
 		return true;
 	}
-}
-
-/**
- * Image Wrapper module
- */
-class FImageWrapperModule
-	: public IImageWrapperModule
-{
-public:
 
-	// IImageWrapperModule interface
-
-	virtual IImageWrapperPtr CreateImageWrapper( const EImageFormat::Type InFormat ) override
+	/** Allocates the wrapper for the format type, or returns null if the format isn't supported */
+	FImageWrapperBase* NewImageWrapper( const EImageFormat::Type InFormat )
 	{
 		FImageWrapperBase* ImageWrapper = NULL;
 
@@ -92,7 +83,23 @@ public:
 			break;
 		}
 
-		return MakeShareable(ImageWrapper);
+		return ImageWrapper;
+	}
+}
+
+/**
+ * Image Wrapper module
+ */
+class FImageWrapperModule
+	: public IImageWrapperModule
+{
+public:
+
+	// IImageWrapperModule interface
+
+	virtual IImageWrapperPtr CreateImageWrapper( const EImageFormat::Type InFormat ) override
+	{
+		return MakeShareable(NewImageWrapper(InFormat));
 	}
 
 	virtual EImageFormat::Type DetectImageFormat( const void* CompressedData, int32 CompressedSize ) override
@@ -126,6 +133,32 @@ public:
 		return Format;
 	}
 
+	virtual TFuture<FDecodedImagePtr> DecodeImageAsync( TArray<uint8>&& InCompressedData, const ERGBFormat::Type InFormat, int32 InBitDepth, TFunction<void()> CompletionCallback ) override
+	{
+		TSharedRef<TArray<uint8>, ESPMode::ThreadSafe> CompressedData = MakeShareable(new TArray<uint8>(MoveTemp(InCompressedData)));
+
+		return Async<FDecodedImagePtr>(EAsyncExecution::ThreadPool, [this, CompressedData, InFormat, InBitDepth]() -> FDecodedImagePtr
+		{
+			const EImageFormat::Type ImageFormat = DetectImageFormat(CompressedData->GetData(), CompressedData->Num());
+			TUniquePtr<FImageWrapperBase> ImageWrapper(NewImageWrapper(ImageFormat));
+
+			const TArray<uint8>* RawData = nullptr;
+			if (!ImageWrapper.IsValid() || !ImageWrapper->SetCompressed(CompressedData->GetData(), CompressedData->Num()) || !ImageWrapper->GetRaw(InFormat, InBitDepth, RawData))
+			{
+				return FDecodedImagePtr();
+			}
+
+			FDecodedImagePtr DecodedImage = MakeShareable(new FDecodedImage());
+			DecodedImage->Width = ImageWrapper->GetWidth();
+			DecodedImage->Height = ImageWrapper->GetHeight();
+			DecodedImage->Format = InFormat;
+			DecodedImage->BitDepth = InBitDepth;
+			DecodedImage->RawData = ImageWrapper->MoveRawData();
+
+			return DecodedImage->IsValid() ? DecodedImage : FDecodedImagePtr();
+		}, MoveTemp(CompletionCallback));
+	}
+
 public:
 
 	// IModuleInterface interface
@@ -28,7 +28,7 @@ PRAGMA_ENABLE_SHADOW_VARIABLE_WARNINGS
 DEFINE_LOG_CATEGORY_STATIC(JPEGLog, Log, All);
 
 
-// Only allow one thread to use JPEG decoder at a time (it's not thread safe)
+// Only allow one thread to use JPEG encoder at a time, decoders don't share any state and may run concurrently
 FCriticalSection GJPEGSection; 
 
 
@@ -153,20 +153,66 @@ void FJpegImageWrapper::Uncompress( const ERGBFormat::Type InFormat, int32 InBit
 		check( false );
 	}
 
-	FScopeLock JPEGLock( &GJPEGSection );
-
 	check( CompressedData.Num() );
 
-	int32 NumColors;
-	uint8* OutData = jpgd::decompress_jpeg_image_from_memory(
-		CompressedData.GetData(), CompressedData.Num(), &Width, &Height, &NumColors, Channels);
+	jpgd::jpeg_decoder_mem_stream jpeg_memStream( CompressedData.GetData(), CompressedData.Num() );
+	jpgd::jpeg_decoder decoder( &jpeg_memStream );
+	if ( decoder.get_error_code() != jpgd::JPGD_SUCCESS || decoder.begin_decoding() != jpgd::JPGD_SUCCESS )
+	{
+		SetError( TEXT("Failed to decode JPEG header") );
+		return;
+	}
 
-	RawData.Empty();
-	RawData.AddUninitialized( Width * Height * Channels );
-	if (OutData)
+	Width = decoder.get_width();
+	Height = decoder.get_height();
+	const int32 SrcChannels = decoder.get_num_components();
+	const int32 DstBytesPerRow = Width * Channels;
+
+	// Decode the scanlines straight into RawData rather than into a temporary image
+	RawData.Empty( Height * DstBytesPerRow );
+	RawData.AddUninitialized( Height * DstBytesPerRow );
+
+	for ( int32 Y = 0; Y < Height; ++Y )
 	{
-		FMemory::Memcpy(RawData.GetData(), OutData, RawData.Num());
-		FMemory::Free(OutData);
+		const uint8* ScanLine = nullptr;
+		uint32 ScanLineLength = 0;
+		if ( decoder.decode( (const void**)&ScanLine, &ScanLineLength ) != jpgd::JPGD_SUCCESS )
+		{
+			RawData.Empty();
+			SetError( TEXT("Failed to decode JPEG scanline") );
+			return;
+		}
+
+		uint8* Dst = &RawData[Y * DstBytesPerRow];
+
+		// Color scanlines come out as four bytes per pixel with opaque alpha, gray ones as one byte per pixel
+		if ( ( Channels == 4 && SrcChannels == 3 ) || ( Channels == 1 && SrcChannels == 1 ) )
+		{
+			FMemory::Memcpy( Dst, ScanLine, DstBytesPerRow );
+		}
+		else if ( Channels == 4 )
+		{
+			for ( int32 X = 0; X < Width; ++X )
+			{
+				const uint8 Luma = ScanLine[X];
+				Dst[0] = Luma;
+				Dst[1] = Luma;
+				Dst[2] = Luma;
+				Dst[3] = 255;
+				Dst += 4;
+			}
+		}
+		else
+		{
+			const int32 YR = 19595, YG = 38470, YB = 7471;
+			for ( int32 X = 0; X < Width; ++X )
+			{
+				const int32 R = ScanLine[X * 4 + 0];
+				const int32 G = ScanLine[X * 4 + 1];
+				const int32 B = ScanLine[X * 4 + 2];
+				*Dst++ = (uint8)( ( R * YR + G * YG + B * YB + 32768 ) >> 16 );
+			}
+		}
 	}
 }
 
@@ -63,6 +63,37 @@ namespace ImageCompression
 	};
 };
 
+/**
+ * Raw image produced by IImageWrapperModule::DecodeImageAsync.
+ * Rows are tightly packed, so the data can be handed to texture creation or update as is.
+ */
+struct FDecodedImage
+{
+	FDecodedImage()
+		: Width(0)
+		, Height(0)
+		, Format(ERGBFormat::Invalid)
+		, BitDepth(0)
+	{ }
+
+	/** Whether decoding succeeded */
+	bool IsValid() const
+	{
+		return RawData.Num() > 0;
+	}
+
+	/** Uncompressed pixels in Format and BitDepth */
+	TArray<uint8> RawData;
+
+	int32 Width;
+	int32 Height;
+	ERGBFormat::Type Format;
+	int32 BitDepth;
+};
+
+/** Type definition for shared pointers to decoded images, which are created on worker threads. */
+typedef TSharedPtr<FDecodedImage, ESPMode::ThreadSafe> FDecodedImagePtr;
+
 /** Type definition for shared pointers to instances of IImageWrapper. */
 typedef TSharedPtr<class IImageWrapper> IImageWrapperPtr;
 
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Modules/ModuleInterface.h"
+#include "Async/Future.h"
 #include "Interfaces/IImageWrapper.h"
 
 /**
@@ -32,6 +33,18 @@ public:
 	 */
 	virtual EImageFormat::Type DetectImageFormat( const void* InCompressedData, int32 InCompressedSize) = 0;
 
+	/**
+	 * Detects the format of the compressed image and decodes it on the thread pool.
+	 * JPEGs decode concurrently, PNGs are still decoded one at a time since libPNG is shared.
+	 *
+	 * @param InCompressedData - The compressed image, moved into the decode task.
+	 * @param InFormat - How we want to manipulate the RGB data.
+	 * @param InBitDepth - The output bit-depth per channel, normally 8.
+	 * @param CompletionCallback - Optional callback executed on the worker once the result is available, e.g. to dispatch to the game thread.
+	 * @return Future of the decoded image, which is null if the data could not be decoded.
+	 */
+	virtual TFuture<FDecodedImagePtr> DecodeImageAsync( TArray<uint8>&& InCompressedData, const ERGBFormat::Type InFormat, int32 InBitDepth, TFunction<void()> CompletionCallback = TFunction<void()>() ) = 0;
+
 public:
 
 	/**
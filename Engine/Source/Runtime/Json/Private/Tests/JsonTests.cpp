@@ -309,6 +309,25 @@ bool FJsonAutomationTest::RunTest(const FString& Parameters)
 		check(OutputString == TestOutput);
 	}
 
+	// UTF-8 Input Test
+	{
+		// An accented e and a euro sign as multi-byte UTF-8 sequences, with an escaped plus in between
+		const ANSICHAR InputBytes[] = "{\"Value\":\"caf\xC3\xA9 \\u002B \xE2\x82\xAC\"}";
+		FBufferReader InputReader((void*)InputBytes, sizeof(InputBytes) - 1, false);
+		TSharedRef< TJsonReader<UTF8CHAR> > Reader = TJsonReaderFactory<UTF8CHAR>::Create( &InputReader );
+
+		TSharedPtr<FJsonObject> Object;
+		bool bSuccessful = FJsonSerializer::Deserialize(Reader, Object);
+		check(bSuccessful);
+		check( Object.IsValid() );
+
+		FString ExpectedString(TEXT("caf"));
+		ExpectedString += TCHAR(0x00E9);
+		ExpectedString += TEXT(" + ");
+		ExpectedString += TCHAR(0x20AC);
+		check(Object->GetStringField(TEXT("Value")) == ExpectedString);
+	}
+
 	// Number Test
 	{
 		const FString InputString =
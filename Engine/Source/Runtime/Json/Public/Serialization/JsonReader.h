@@ -502,9 +502,37 @@ private:
 		return false;
 	}
 
+	/**
+	 * Appends a character of a string token. UTF-8 input is collected as bytes and only decoded by FlushStringBytes,
+	 * so multi-byte sequences come out as the characters they encode rather than one character per byte.
+	 */
+	FORCEINLINE void AppendStringChar(FString& String, TArray<ANSICHAR, TInlineAllocator<256>>& PendingBytes, CharType Char)
+	{
+		if (TIsSame<CharType, UTF8CHAR>::Value)
+		{
+			PendingBytes.Add((ANSICHAR)Char);
+		}
+		else
+		{
+			String += (TCHAR)Char;
+		}
+	}
+
+	/** Decodes the UTF-8 bytes collected by AppendStringChar onto the end of the string */
+	void FlushStringBytes(FString& String, TArray<ANSICHAR, TInlineAllocator<256>>& PendingBytes)
+	{
+		if (PendingBytes.Num() > 0)
+		{
+			FUTF8ToTCHAR Converted(PendingBytes.GetData(), PendingBytes.Num());
+			String.AppendChars(Converted.Get(), Converted.Length());
+			PendingBytes.Reset();
+		}
+	}
+
 	bool ParseStringToken()
 	{
 		FString String;
+		TArray<ANSICHAR, TInlineAllocator<256>> PendingBytes;
 
 		while (true)
 		{
@@ -528,14 +556,17 @@ private:
 				Stream->Serialize(&Char, sizeof(CharType));
 				++CharacterNumber;
 
+				// escapes are appended as characters, so anything collected before them has to be decoded first
+				FlushStringBytes(String, PendingBytes);
+
 				switch (Char)
 				{
-				case CharType('\"'): case CharType('\\'): case CharType('/'): String += Char; break;
-				case CharType('f'): String += CharType('\f'); break;
-				case CharType('r'): String += CharType('\r'); break;
-				case CharType('n'): String += CharType('\n'); break;
-				case CharType('b'): String += CharType('\b'); break;
-				case CharType('t'): String += CharType('\t'); break;
+				case CharType('\"'): case CharType('\\'): case CharType('/'): String += (TCHAR)Char; break;
+				case CharType('f'): String += TCHAR('\f'); break;
+				case CharType('r'): String += TCHAR('\r'); break;
+				case CharType('n'): String += TCHAR('\n'); break;
+				case CharType('b'): String += TCHAR('\b'); break;
+				case CharType('t'): String += TCHAR('\t'); break;
 				case CharType('u'):
 					// 4 hex digits, like \uAB23, which is a 16 bit number that we would usually see as 0xAB23
 					{
@@ -563,7 +594,8 @@ private:
 							HexNum += HexDigit * FMath::Pow(16, Radix);
 						}
 
-						String += (CharType)HexNum;
+						// not CharType, that would truncate the code point when reading single byte input
+						String += (TCHAR)HexNum;
 					}
 					break;
 
@@ -574,10 +606,11 @@ private:
 			}
 			else
 			{
-				String += Char;
+				AppendStringChar(String, PendingBytes, Char);
 			}
 		}
 
+		FlushStringBytes(String, PendingBytes);
 		StringValue = MoveTemp(String);
 		return true;
 	}
@@ -86,6 +86,11 @@ static TAutoConsoleVariable<int32> CVarMaxAsyncTasks(
 	4,
 	TEXT("Used to control the number of hierarchical components created at a time."));
 
+static TAutoConsoleVariable<int32> CVarMaxCreatePerFrame(
+	TEXT("grass.MaxCreatePerFrame"),
+	1,
+	TEXT("Maximum number of hierarchical components created per frame, the nearest missing components are created first."));
+
 static TAutoConsoleVariable<int32> CVarUseHaltonDistribution(
 	TEXT("grass.UseHaltonDistribution"),
 	0,
@@ -1974,26 +1979,71 @@ void ALandscapeProxy::UpdateGrass(const TArray<FVector>& Cameras, bool bForceSyn
 			}
 #endif
 
-			int32 NumCompsCreated = 0;
-			for (int32 ComponentIndex = 0; ComponentIndex < LandscapeComponents.Num(); ComponentIndex++)
+			// No grass variety generates instances further away than this
+			float MaxDiscardDistance = 0.0f;
+			for (auto GrassType : GrassTypes)
 			{
-				ULandscapeComponent* Component = LandscapeComponents[ComponentIndex];
-
-				// skip if we have no data and no way to generate it
-				if (World->IsGameWorld() && !Component->GrassData->HasData())
+				if (GrassType)
 				{
-					continue;
+					for (auto& GrassVariety : GrassType->GrassVarieties)
+					{
+						MaxDiscardDistance = FMath::Max<float>(MaxDiscardDistance, DiscardGuardBand * (float)GrassVariety.EndCullDistance);
+					}
 				}
+			}
 
-				FBoxSphereBounds WorldBounds = Component->CalcBounds(Component->ComponentToWorld);
-				float MinDistanceToComp = Cameras.Num() ? MAX_flt : 0.0f;
+			// Visit the components nearest to the cameras first, so the grass that is needed most urgently is the first to be created
+			struct FComponentDistance
+			{
+				ULandscapeComponent* Component;
+				float MinDistanceToComp;
 
-				for (auto& Pos : Cameras)
+				bool operator<(const FComponentDistance& Other) const
 				{
-					MinDistanceToComp = FMath::Min<float>(MinDistanceToComp, WorldBounds.ComputeSquaredDistanceFromBoxToPoint(Pos));
+					return MinDistanceToComp < Other.MinDistanceToComp;
 				}
+			};
+			TArray<FComponentDistance> SortedComponents;
+			SortedComponents.Reserve(LandscapeComponents.Num());
+			{
+				QUICK_SCOPE_CYCLE_COUNTER(STAT_GrassSortComponents);
+
+				for (ULandscapeComponent* Component : LandscapeComponents)
+				{
+					// skip if we have no data and no way to generate it
+					if (World->IsGameWorld() && !Component->GrassData->HasData())
+					{
+						continue;
+					}
 
-				MinDistanceToComp = FMath::Sqrt(MinDistanceToComp);
+					FBoxSphereBounds WorldBounds = Component->CalcBounds(Component->ComponentToWorld);
+					float MinDistanceToComp = Cameras.Num() ? MAX_flt : 0.0f;
+
+					for (auto& Pos : Cameras)
+					{
+						MinDistanceToComp = FMath::Min<float>(MinDistanceToComp, WorldBounds.ComputeSquaredDistanceFromBoxToPoint(Pos));
+					}
+
+					MinDistanceToComp = FMath::Sqrt(MinDistanceToComp);
+
+					// Every variety would be discarded for this component, don't bother with the per variety work
+					if (MinDistanceToComp > MaxDiscardDistance)
+					{
+						continue;
+					}
+
+					SortedComponents.Add({ Component, MinDistanceToComp });
+				}
+
+				SortedComponents.Sort();
+			}
+
+			const int32 MaxCompsToCreate = FMath::Max<int32>(1, CVarMaxCreatePerFrame.GetValueOnAnyThread());
+			int32 NumCompsCreated = 0;
+			for (const FComponentDistance& ComponentDistance : SortedComponents)
+			{
+				ULandscapeComponent* Component = ComponentDistance.Component;
+				const float MinDistanceToComp = ComponentDistance.MinDistanceToComp;
 
 				for (auto GrassType : GrassTypes)
 				{
@@ -2095,9 +2145,9 @@ void ALandscapeProxy::UpdateGrass(const TArray<FVector>& Cameras, bool bForceSyn
 											}
 										}
 
-										if (!bForceSync && (NumCompsCreated || AsyncFoliageTasks.Num() >= MaxTasks))
+										if (!bForceSync && (NumCompsCreated >= MaxCompsToCreate || AsyncFoliageTasks.Num() >= MaxTasks))
 										{
-											continue; // one per frame, but we still want to touch the existing ones
+											continue; // a few per frame, but we still want to touch the existing ones
 										}
 
 #if WITH_EDITOR
@@ -42,6 +42,15 @@ FAutoConsoleVariableRef CVarLandscapeMeshLODBias(
 	ECVF_Scalability
 	);
 
+int32 GLandscapeCombineLODTolerance = 0;
+FAutoConsoleVariableRef CVarLandscapeCombineLODTolerance(
+	TEXT("r.LandscapeCombineLODTolerance"),
+	GLandscapeCombineLODTolerance,
+	TEXT("Draw all subsections of a landscape component with one draw call at the finest of their LODs when their LODs differ by at most this much.\n")
+	TEXT("Trades some extra triangles in the coarser subsections for fewer draw calls. 0 only combines subsections with the same LOD (default)."),
+	ECVF_Scalability
+	);
+
 /*------------------------------------------------------------------------------
 	Forsyth algorithm for cache optimizing index buffers.
 ------------------------------------------------------------------------------*/
@@ -1212,8 +1221,8 @@ uint64 FLandscapeComponentSceneProxy::GetStaticBatchElementVisibility(const clas
 
 		int32 BatchesPerLOD = NumSubsections > 1 ? FMath::Square(NumSubsections) + 1 : 1;
 		int32 CalculatedLods[LANDSCAPE_MAX_SUBSECTION_NUM][LANDSCAPE_MAX_SUBSECTION_NUM];
-		int32 CombinedLOD = -1;
-		int32 bAllSameLOD = true;
+		int32 MinSubsectionLOD = MAX_int32;
+		int32 MaxSubsectionLOD = -1;
 
 		int32 BatchLOD = ((FLandscapeBatchElementParams*)Batch->Elements[0].UserData)->CurrentLOD;
 
@@ -1222,17 +1231,18 @@ uint64 FLandscapeComponentSceneProxy::GetStaticBatchElementVisibility(const clas
 			for (int32 SubX = 0; SubX < NumSubsections; SubX++)
 			{
 				int32 ThisSubsectionLOD = CalcLODForSubsection(View, SubX, SubY, CameraLocalPos);
-				// check if all LODs are the same.
-				if (ThisSubsectionLOD != CombinedLOD && CombinedLOD != -1)
-				{
-					bAllSameLOD = false;
-				}
-				CombinedLOD = ThisSubsectionLOD;
+				MinSubsectionLOD = FMath::Min(MinSubsectionLOD, ThisSubsectionLOD);
+				MaxSubsectionLOD = FMath::Max(MaxSubsectionLOD, ThisSubsectionLOD);
 				CalculatedLods[SubX][SubY] = ThisSubsectionLOD;
 			}
 		}
 
-		if (bAllSameLOD && NumSubsections > 1 && !GLandscapeDebugOptions.bDisableCombine)
+		// Subsections whose LODs are close enough are drawn together at the finest LOD, the vertex shader still morphs them towards their own LOD.
+		// Every batch of the component makes the same choice, so only the batch holding that LOD draws it.
+		const bool bCombineSubsections = (MaxSubsectionLOD - MinSubsectionLOD) <= FMath::Max(GLandscapeCombineLODTolerance, 0);
+		const int32 CombinedLOD = MinSubsectionLOD;
+
+		if (bCombineSubsections && NumSubsections > 1 && !GLandscapeDebugOptions.bDisableCombine)
 		{
 			// choose the combined batch element
 			int32 BatchElementIndex = (CombinedLOD - BatchLOD + 1) * BatchesPerLOD - 1;
@@ -3,6 +3,9 @@
 #include "LaunchEngineLoop.h"
 #include "HAL/PlatformStackWalk.h"
 #include "HAL/PlatformOutputDevices.h"
+#include "ProfilingDebugging/FrameTrace.h"
+#include "HAL/LowLevelMemTracker.h"
+#include "ProfilingDebugging/CsvProfiler.h"
 #include "Misc/MessageDialog.h"
 #include "Misc/ScopedSlowTask.h"
 #include "Misc/QueuedThreadPool.h"
@@ -91,6 +94,7 @@
 	#include "EngineStats.h"
 	#include "EngineGlobals.h"
 	#include "AudioThread.h"
+	#include "RenderCore.h"
 #if WITH_ENGINE && !UE_BUILD_SHIPPING
 	#include "Interfaces/IAutomationControllerModule.h"
 #endif // WITH_ENGINE && !UE_BUILD_SHIPPING
@@ -135,6 +139,7 @@
 
 	#include "ShaderCodeLibrary.h"
 	#include "ShaderCache.h"
+	#include "ShaderPipelineCache.h"
 
 #if !UE_BUILD_SHIPPING
 	#include "STaskGraph.h"
@@ -1664,6 +1669,9 @@ int32 FEngineLoop::PreInit( const TCHAR* CmdLine )
 	
 	FShaderCache::LoadBinaryCache();
 
+	// Precompiles the pipeline states recorded in the pipeline file cache as their shaders load
+	FShaderPipelineCache::Initialize(GMaxRHIShaderPlatform);
+
 	if (!FPlatformProperties::RequiresCookedData())
 	{
 		check(!GShaderCompilingManager);
@@ -2649,6 +2657,12 @@ int32 FEngineLoop::Init()
 	// Ready to measure thread heartbeat
 	FThreadHeartBeat::Get().Start();
 
+	// All loading phases are done, write down which modules startup was spent on
+	if (FParse::Param(FCommandLine::Get(), TEXT("ModuleStartupReport")))
+	{
+		FModuleManager::Get().WriteModuleStartupReport(FPaths::ProfilingDir() / FString::Printf(TEXT("ModuleStartup-%s.csv"), *FDateTime::Now().ToString()));
+	}
+
 	FCoreDelegates::OnFEngineLoopInitComplete.Broadcast();
 	return 0;
 }
@@ -2731,6 +2745,8 @@ void FEngineLoop::Exit()
 
 	// Disable the shader cache
 	FShaderCache::ShutdownShaderCache();
+
+	FShaderPipelineCache::Shutdown();
 	
 	// Close shader code map, if any
 	FShaderCodeLibrary::Shutdown();
@@ -2966,6 +2982,13 @@ void FEngineLoop::Tick()
 
 	// Send a heartbeat for the diagnostics thread
 	FThreadHeartBeat::Get().HeartBeat();
+	FGameThreadHitchHeartBeat::Get().FrameStart();
+
+	// Mark the end of the previous frame, this writes a trace snapshot if it hitched
+	FRAME_TRACE_END_FRAME();
+	FLowLevelMemTracker::EndFrame();
+	FCsvProfiler::EndFrame();
+	FRAME_TRACE_SCOPE("FEngineLoop::Tick");
 
 	// Make sure something is ticking the rendering tickables in -onethread mode to avoid leaks/bugs.
 	if (!GUseThreadedRendering && !GIsRenderingThreadSuspended)
@@ -3108,6 +3131,9 @@ void FEngineLoop::Tick()
 			SlateApp.PollGameDeviceState();
 			// Gives widgets a chance to process any accumulated input
 			SlateApp.FinishedInputThisFrame();
+
+			// Input of this frame has been read, start measuring how long it takes until it is presented
+			GInputLatencyTimer.GameThreadTick();
 		}
 
 		GEngine->Tick( FApp::GetDeltaTime(), bIdleMode );
@@ -3241,10 +3267,12 @@ void FEngineLoop::Tick()
 		{
 			SCOPE_CYCLE_COUNTER( STAT_FrameSyncTime );
 			// this could be perhaps moved down to get greater parallelizm
-			// Sync game and render thread. Either total sync or allowing one frame lag.
+			// Sync game and render thread. Either total sync or allowing up to r.FrameThreadLag frames of lag.
 			static FFrameEndSync FrameEndSync;
 			static auto CVarAllowOneFrameThreadLag = IConsoleManager::Get().FindTConsoleVariableDataInt(TEXT("r.OneFrameThreadLag"));
-			FrameEndSync.Sync( CVarAllowOneFrameThreadLag->GetValueOnGameThread() != 0 );
+			static auto CVarFrameThreadLag = IConsoleManager::Get().FindTConsoleVariableDataInt(TEXT("r.FrameThreadLag"));
+			const int32 FrameThreadLag = CVarFrameThreadLag->GetValueOnGameThread();
+			FrameEndSync.Sync( FrameThreadLag >= 0 ? FrameThreadLag : (CVarAllowOneFrameThreadLag->GetValueOnGameThread() != 0 ? 1 : 0) );
 		}
 
 		{
@@ -3493,6 +3521,12 @@ bool FEngineLoop::AppInit( )
 	// Init logging to disk
 	FPlatformOutputDevices::SetupOutputDevices();
 
+	// Write the log on its own thread, so servers logging heavily from many threads don't contend on the redirector
+	if (FParse::Param(FCommandLine::Get(), TEXT("asynclog")))
+	{
+		GLog->StartAsyncLogThread();
+	}
+
 	// init config system
 	FConfigCacheIni::InitializeConfigSystem();
 
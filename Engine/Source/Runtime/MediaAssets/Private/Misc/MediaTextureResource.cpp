@@ -161,21 +161,39 @@ void FMediaTextureResource::ShutdownBuffer()
 }
 
 
-void FMediaTextureResource::UpdateBuffer(const uint8* Data, uint32 /*Pitch*/)
+void FMediaTextureResource::UpdateBuffer(const uint8* Data, uint32 Pitch)
 {
 	if (State != EState::Initialized)
 	{
 		return;
 	}
 
+	// decoders may hand over their frame buffers with padded rows, so they don't need to repack them first
+	const uint32 SourcePitch = (Pitch != 0) ? Pitch : BufferPitch;
+
 	// update sink
 	if (SinkMode == EMediaTextureSinkMode::Buffered)
 	{
-		uint8* Dest = (uint8*)TripleBuffer.GetWriteBuffer().LockedData;
+		const FResource& WriteBuffer = TripleBuffer.GetWriteBuffer();
+		uint8* Dest = (uint8*)WriteBuffer.LockedData;
 
 		if (Dest != nullptr)
 		{
-			FMemory::Memcpy(Dest, Data, BufferPitch * BufferDimensions.Y);
+			const uint32 DestPitch = (WriteBuffer.LockedStride != 0) ? WriteBuffer.LockedStride : BufferPitch;
+
+			if ((SourcePitch == BufferPitch) && (DestPitch == BufferPitch))
+			{
+				FMemory::Memcpy(Dest, Data, BufferPitch * BufferDimensions.Y);
+			}
+			else
+			{
+				const SIZE_T RowSize = FMath::Min<SIZE_T>(BufferPitch, FMath::Min(SourcePitch, DestPitch));
+
+				for (int32 Row = 0; Row < BufferDimensions.Y; ++Row)
+				{
+					FMemory::Memcpy(Dest + Row * DestPitch, Data + Row * SourcePitch, RowSize);
+				}
+			}
 
 			if (TripleBuffer.IsDirty())
 			{
@@ -190,13 +208,13 @@ void FMediaTextureResource::UpdateBuffer(const uint8* Data, uint32 /*Pitch*/)
 		if (RequiresConversion)
 		{
 			FUpdateTextureRegion2D Region(0, 0, 0, 0, BufferDimensions.X, BufferDimensions.Y);
-			RHIUpdateTexture2D(BufferResources[2].RenderTarget.GetReference(), 0, Region, BufferPitch, Data);
+			RHIUpdateTexture2D(BufferResources[2].RenderTarget.GetReference(), 0, Region, SourcePitch, Data);
 			ConvertResource(BufferResources[2]);
 		}
 		else
 		{
 			FUpdateTextureRegion2D Region(0, 0, 0, 0, OutputDimensions.X, OutputDimensions.Y);
-			RHIUpdateTexture2D(RenderTargetTextureRHI.GetReference(), 0, Region, BufferPitch, Data);
+			RHIUpdateTexture2D(RenderTargetTextureRHI.GetReference(), 0, Region, SourcePitch, Data);
 		}
 	}
 	else
@@ -400,10 +418,12 @@ void FMediaTextureResource::InitDynamicRHI()
 			{
 				// lock write & temp buffers (in triple buffered mode only)
 				Resource.LockedData = RHILockTexture2D(Resource.RenderTarget.GetReference(), 0, RLM_WriteOnly, OutStride, false);
+				Resource.LockedStride = OutStride;
 			}
 			else
 			{
 				Resource.LockedData = nullptr;
+				Resource.LockedStride = 0;
 			}
 		}
 	}
@@ -813,12 +833,14 @@ void FMediaTextureResource::SwapResource()
 			FResource& OldResource = TripleBuffer.Read();
 			uint32 OutStride = 0;
 			OldResource.LockedData = RHILockTexture2D(OldResource.RenderTarget.GetReference(), 0, RLM_WriteOnly, OutStride, false /*bLockWithinMiptail*/, false /*bFlushRHIThread*/);
+			OldResource.LockedStride = OutStride;
 			TripleBuffer.SwapReadBuffers();
 
 			// unlock & assign new read buffer
 			FResource& NewResource = TripleBuffer.Read();
 			RHIUnlockTexture2D(NewResource.RenderTarget.GetReference(), 0, false /*bLockWithinMiptail*/);
 			NewResource.LockedData = nullptr;
+			NewResource.LockedStride = 0;
 
 			if (RequiresConversion)
 			{
@@ -27,10 +27,11 @@ class FMediaTextureResource
 	struct FResource
 	{
 		void* LockedData;
+		uint32 LockedStride;
 		TRefCountPtr<FRHITexture2D> RenderTarget;
 		TRefCountPtr<FRHITexture2D> ShaderResource;
 
-		FResource() : LockedData(nullptr) { }
+		FResource() : LockedData(nullptr), LockedStride(0) { }
 	};
 
 public:
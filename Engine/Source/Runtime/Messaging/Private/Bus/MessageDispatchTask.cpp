@@ -9,12 +9,10 @@
 
 FMessageDispatchTask::FMessageDispatchTask(
 	ENamedThreads::Type InThread,
-	TSharedRef<IMessageContext, ESPMode::ThreadSafe> InContext,
-	TWeakPtr<IMessageReceiver, ESPMode::ThreadSafe> InRecipient,
+	TArray<FDelivery>& InDeliveries,
 	TSharedPtr<FMessageTracer, ESPMode::ThreadSafe> InTracer
 )
-	: Context(InContext)
-	, RecipientPtr(InRecipient)
+	: Deliveries(MoveTemp(InDeliveries))
 	, Thread(InThread)
 	, TracerPtr(InTracer)
 { }
@@ -25,25 +23,30 @@ FMessageDispatchTask::FMessageDispatchTask(
 
 void FMessageDispatchTask::DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
 {
-	TSharedPtr<IMessageReceiver, ESPMode::ThreadSafe> Recipient = RecipientPtr.Pin();
+	auto Tracer = TracerPtr.Pin();
 
-	if (!Recipient.IsValid())
+	for (const FDelivery& Delivery : Deliveries)
 	{
-		return;
-	}
+		TSharedPtr<IMessageReceiver, ESPMode::ThreadSafe> Recipient = Delivery.RecipientPtr.Pin();
 
-	auto Tracer = TracerPtr.Pin();
+		if (!Recipient.IsValid())
+		{
+			continue;
+		}
 
-	if (Tracer.IsValid())
-	{
-		Tracer->TraceDispatchedMessage(Context, Recipient.ToSharedRef(), true);
-	}
+		const IMessageContextRef Context = Delivery.Context.ToSharedRef();
 
-	Recipient->ReceiveMessage(Context);
+		if (Tracer.IsValid())
+		{
+			Tracer->TraceDispatchedMessage(Context, Recipient.ToSharedRef(), true);
+		}
 
-	if (TracerPtr.IsValid())
-	{
-		Tracer->TraceHandledMessage(Context, Recipient.ToSharedRef());
+		Recipient->ReceiveMessage(Context);
+
+		if (Tracer.IsValid())
+		{
+			Tracer->TraceHandledMessage(Context, Recipient.ToSharedRef());
+		}
 	}
 }
 
@@ -10,24 +10,38 @@
 class IMessageReceiver;
 
 /**
- * Implements an asynchronous task for dispatching a message to a recipient.
+ * Implements an asynchronous task for dispatching a batch of messages to recipients on one thread.
  */
 class FMessageDispatchTask
 {
 public:
 
+	/** A message to deliver to a recipient. */
+	struct FDelivery
+	{
+		/** Holds the message context. */
+		IMessageContextPtr Context;
+
+		/** Holds a reference to the recipient. */
+		TWeakPtr<IMessageReceiver, ESPMode::ThreadSafe> RecipientPtr;
+
+		/** Creates and initializes a new instance. */
+		FDelivery(const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& InContext, const TWeakPtr<IMessageReceiver, ESPMode::ThreadSafe>& InRecipient)
+			: Context(InContext)
+			, RecipientPtr(InRecipient)
+		{ }
+	};
+
 	/**
 	 * Creates and initializes a new instance.
 	 *
-	 * @param InThread The name of the thread to dispatch the message on.
-	 * @param InContext The context of the message to dispatch.
-	 * @param InRecipient The message recipient.
+	 * @param InThread The name of the thread to dispatch the messages on.
+	 * @param InDeliveries The messages to dispatch, in the order they are to be received (will be moved from).
 	 * @param InTracer The message tracer to notify.
 	 */
 	FMessageDispatchTask(
 		ENamedThreads::Type InThread,
-		TSharedRef<IMessageContext, ESPMode::ThreadSafe> InContext,
-		TWeakPtr<IMessageReceiver, ESPMode::ThreadSafe> InRecipient,
+		TArray<FDelivery>& InDeliveries,
 		TSharedPtr<FMessageTracer, ESPMode::ThreadSafe> InTracer);
 
 public:
@@ -69,11 +83,8 @@ public:
 
 private:
 
-	/** Holds the message context. */
-	TSharedRef<IMessageContext, ESPMode::ThreadSafe> Context;
-
-	/** Holds a reference to the recipient. */
-	TWeakPtr<IMessageReceiver, ESPMode::ThreadSafe> RecipientPtr;
+	/** Holds the messages to dispatch. */
+	TArray<FDelivery> Deliveries;
 
 	/** Holds the name of the thread that the router is running on. */
 	ENamedThreads::Type Thread;
@@ -2,7 +2,6 @@
 
 #include "Bus/MessageRouter.h"
 #include "HAL/PlatformProcess.h"
-#include "Bus/MessageDispatchTask.h"
 #include "IMessageSubscription.h"
 #include "IMessageReceiver.h"
 #include "IMessageInterceptor.h"
@@ -58,6 +57,7 @@ uint32 FMessageRouter::Run()
 		}
 
 		ProcessDelayedMessages();
+		FlushDispatches();
 	}
 
 	return 0;
@@ -158,13 +158,35 @@ void FMessageRouter::DispatchMessage(const IMessageContextRef& Context)
 			}
 			else
 			{
-				TGraphTask<FMessageDispatchTask>::CreateTask().ConstructAndDispatchWhenReady(RecipientThread, Context, Recipient, Tracer);
+				// batched up so a burst of messages costs one task per recipient thread rather than one per message and recipient
+				FPendingDispatches* Pending = PendingDispatches.FindByPredicate([RecipientThread](const FPendingDispatches& Candidate) { return Candidate.Thread == RecipientThread; });
+
+				if (Pending == nullptr)
+				{
+					Pending = &PendingDispatches[PendingDispatches.AddDefaulted()];
+					Pending->Thread = RecipientThread;
+				}
+
+				Pending->Deliveries.Emplace(Context, Recipient);
 			}
 		}
 	}
 }
 
 
+void FMessageRouter::FlushDispatches()
+{
+	for (FPendingDispatches& Pending : PendingDispatches)
+	{
+		if (Pending.Deliveries.Num() > 0)
+		{
+			TGraphTask<FMessageDispatchTask>::CreateTask().ConstructAndDispatchWhenReady(Pending.Thread, Pending.Deliveries, Tracer);
+			Pending.Deliveries.Reset();
+		}
+	}
+}
+
+
 void FMessageRouter::FilterSubscriptions(
 	TArray<TSharedPtr<IMessageSubscription, ESPMode::ThreadSafe>>& Subscriptions,
 	const IMessageContextRef& Context,
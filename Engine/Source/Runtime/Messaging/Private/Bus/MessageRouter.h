@@ -7,6 +7,7 @@
 #include "Containers/Queue.h"
 #include "IMessageTracer.h"
 #include "Bus/MessageTracer.h"
+#include "Bus/MessageDispatchTask.h"
 #include "HAL/Runnable.h"
 
 class IMessageInterceptor;
@@ -172,6 +173,9 @@ protected:
 	 */
 	void DispatchMessage(const TSharedRef<IMessageContext, ESPMode::ThreadSafe>& Message);
 
+	/** Starts one dispatch task per recipient thread for the messages queued up by DispatchMessage. */
+	void FlushDispatches();
+
 	/** Processes all delayed messages. */
 	void ProcessDelayedMessages();
 
@@ -210,6 +214,16 @@ private:
 		}
 	};
 
+	/** Messages waiting to be dispatched to recipients on one thread. */
+	struct FPendingDispatches
+	{
+		/** Holds the thread the recipients receive messages on. */
+		ENamedThreads::Type Thread;
+
+		/** Holds the messages in the order they were routed. */
+		TArray<FMessageDispatchTask::FDelivery> Deliveries;
+	};
+
 private:
 
 	/** Handles adding message interceptors. */
@@ -253,6 +267,9 @@ private:
 	/** Holds the collection of delayed messages. */
 	TArray<FDelayedMessage> DelayedMessages;
 
+	/** Holds the messages for recipients on other threads that haven't been dispatched yet. */
+	TArray<FPendingDispatches> PendingDispatches;
+
 	/** Holds a sequence number for delayed messages. */
 	int64 DelayedMessagesSequence;
 
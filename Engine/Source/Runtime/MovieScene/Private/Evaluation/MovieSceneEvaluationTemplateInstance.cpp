@@ -6,11 +6,49 @@
 #include "MovieSceneSequence.h"
 #include "MovieSceneSequenceInstance.h"
 #include "MovieSceneExecutionTokens.h"
+#include "HAL/IConsoleManager.h"
+#include "Async/ParallelFor.h"
 
 DECLARE_CYCLE_STAT(TEXT("Entire Evaluation Cost"), MovieSceneEval_EntireEvaluationCost, STATGROUP_MovieSceneEval);
 DECLARE_CYCLE_STAT(TEXT("Gather Entries For Frame"), MovieSceneEval_GatherEntries, STATGROUP_MovieSceneEval);
 DECLARE_CYCLE_STAT(TEXT("Call Setup() and TearDown()"), MovieSceneEval_CallSetupTearDown, STATGROUP_MovieSceneEval);
 DECLARE_CYCLE_STAT(TEXT("Evaluate Group"), MovieSceneEval_EvaluateGroup, STATGROUP_MovieSceneEval);
+DECLARE_CYCLE_STAT(TEXT("Evaluate Track"), MovieSceneEval_EvaluateTrack, STATGROUP_MovieSceneEval);
+DECLARE_CYCLE_STAT(TEXT("Evaluate Parallel Tracks"), MovieSceneEval_EvaluateParallelTracks, STATGROUP_MovieSceneEval);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Tracks Evaluated"), MovieSceneEval_NumTracksEvaluated, STATGROUP_MovieSceneEval);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Tracks Evaluated In Parallel"), MovieSceneEval_NumParallelTracksEvaluated, STATGROUP_MovieSceneEval);
+
+static TAutoConsoleVariable<int32> CVarParallelEvaluationMinTracks(
+	TEXT("LevelSequence.ParallelEvaluationMinTracks"),
+	8,
+	TEXT("Minimum number of tracks supporting parallel evaluation in one evaluation group for them to be evaluated on worker threads. 0 evaluates all tracks on the game thread.\n"),
+	ECVF_Default);
+
+namespace
+{
+	/** A track queued up for evaluation in a group */
+	struct FQueuedTrackEvaluation
+	{
+		FQueuedTrackEvaluation(const FMovieSceneEvaluationTrack& InTrack, int32 InSegmentIndex, const FMovieSceneEvaluationOperand& InOperand, const FMovieSceneEvaluationKey& InTrackKey, const FMovieSceneContext& InContext)
+			: Track(&InTrack)
+			, SegmentIndex(InSegmentIndex)
+			, Operand(InOperand)
+			, TrackKey(InTrackKey)
+			, Context(InContext)
+			, ParallelIndex(INDEX_NONE)
+		{
+		}
+
+		const FMovieSceneEvaluationTrack* Track;
+		int32 SegmentIndex;
+		FMovieSceneEvaluationOperand Operand;
+		FMovieSceneEvaluationKey TrackKey;
+		FMovieSceneContext Context;
+
+		/** Index of the token stack this track was evaluated into on a worker thread, or INDEX_NONE to evaluate it on the game thread */
+		int32 ParallelIndex;
+	};
+}
 
 
 FMovieSceneEvaluationTemplateInstance::FMovieSceneEvaluationTemplateInstance(UMovieSceneSequence& InSequence, const FMovieSceneEvaluationTemplate& InTemplate)
@@ -270,6 +308,9 @@ void FMovieSceneRootEvaluationTemplateInstance::EvaluateGroup(const FMovieSceneE
 	FMovieSceneContext Context = RootContext;
 	FMovieSceneContext SubContext = Context;
 
+	const int32 MinParallelTracks = CVarParallelEvaluationMinTracks.GetValueOnGameThread();
+	TArray<FQueuedTrackEvaluation> QueuedTracks;
+
 	for (const FMovieSceneEvaluationGroupLUTIndex& Index : Group.LUTIndices)
 	{
 		int32 TrackIndex = Index.LUTOffset;
@@ -309,11 +350,9 @@ void FMovieSceneRootEvaluationTemplateInstance::EvaluateGroup(const FMovieSceneE
 		}
 
 		// Then evaluate
+		QueuedTracks.Reset();
+		int32 NumParallelTracks = 0;
 
-		// *Threading candidate*
-		// @todo: if we want to make this threaded, we need to:
-		//  - Make the execution tokens threadsafe, and sortable (one container per thread + append?)
-		//  - Do the above in a lockless manner
 		for (; TrackIndex < Index.LUTOffset + Index.NumInitPtrs + Index.NumEvalPtrs; ++TrackIndex)
 		{
 			FMovieSceneEvaluationFieldSegmentPtr SegmentPtr = Group.SegmentPtrLUT[TrackIndex];
@@ -329,15 +368,6 @@ void FMovieSceneRootEvaluationTemplateInstance::EvaluateGroup(const FMovieSceneE
 				Operand.ObjectBindingID = Track->GetObjectBindingID();
 				Operand.SequenceID = SegmentPtr.SequenceID;
 
-				FMovieSceneEvaluationKey TrackKey(SegmentPtr.SequenceID, SegmentPtr.TrackIdentifier);
-
-				PersistentDataProxy.SetTrackKey(TrackKey);
-
-				ExecutionTokens.SetOperand(Operand);
-				ExecutionTokens.SetTrack(TrackKey);
-
-				Player.PreAnimatedState.SetCaptureEntity(TrackKey, EMovieSceneCompletionMode::KeepState);
-
 				SubContext = Context;
 				if (SegmentPtr.SequenceID != MovieSceneSequenceID::Root)
 				{
@@ -347,15 +377,76 @@ void FMovieSceneRootEvaluationTemplateInstance::EvaluateGroup(const FMovieSceneE
 					SubContext.ReportOuterSectionRanges(Instance.PreRollRange, Instance.PostRollRange);
 				}
 
-				Track->Evaluate(
-					SegmentPtr.SegmentIndex,
-					Operand,
-					SubContext,
-					PersistentDataProxy,
-					ExecutionTokens);
+				FQueuedTrackEvaluation& Queued = QueuedTracks[QueuedTracks.Emplace(*Track, SegmentPtr.SegmentIndex, Operand, FMovieSceneEvaluationKey(SegmentPtr.SequenceID, SegmentPtr.TrackIdentifier), SubContext)];
+				if (MinParallelTracks > 0 && Track->SupportsParallelEvaluation())
+				{
+					Queued.ParallelIndex = NumParallelTracks++;
+				}
 			}
 		}
 
+		INC_DWORD_STAT_BY(MovieSceneEval_NumTracksEvaluated, QueuedTracks.Num());
+
+		// Evaluate the tracks that support it on worker threads, each into its own token stack so that the tokens can be applied in the usual order
+		TArray<FMovieSceneExecutionTokens> ParallelTokens;
+		if (NumParallelTracks >= MinParallelTracks && NumParallelTracks > 1)
+		{
+			MOVIESCENE_DETAILED_SCOPE_CYCLE_COUNTER(MovieSceneEval_EvaluateParallelTracks);
+			INC_DWORD_STAT_BY(MovieSceneEval_NumParallelTracksEvaluated, NumParallelTracks);
+
+			TArray<const FQueuedTrackEvaluation*> ParallelTracks;
+			ParallelTracks.Reserve(NumParallelTracks);
+			for (const FQueuedTrackEvaluation& Queued : QueuedTracks)
+			{
+				if (Queued.ParallelIndex != INDEX_NONE)
+				{
+					ParallelTracks.Add(&Queued);
+				}
+			}
+
+			ParallelTokens.SetNum(NumParallelTracks);
+			ParallelFor(NumParallelTracks, [&](int32 ParallelIndex)
+			{
+				MOVIESCENE_DETAILED_SCOPE_CYCLE_COUNTER(MovieSceneEval_EvaluateTrack);
+
+				const FQueuedTrackEvaluation& Queued = *ParallelTracks[ParallelIndex];
+				FMovieSceneExecutionTokens& TrackTokens = ParallelTokens[Queued.ParallelIndex];
+
+				FPersistentEvaluationData ThreadPersistentDataProxy(Player.State.PersistentEntityData, Player.State.PersistentSharedData);
+				ThreadPersistentDataProxy.SetTrackKey(Queued.TrackKey);
+
+				TrackTokens.SetOperand(Queued.Operand);
+				TrackTokens.SetTrack(Queued.TrackKey);
+
+				Queued.Track->Evaluate(Queued.SegmentIndex, Queued.Operand, Queued.Context, ThreadPersistentDataProxy, TrackTokens);
+			});
+		}
+
+		for (const FQueuedTrackEvaluation& Queued : QueuedTracks)
+		{
+			if (Queued.ParallelIndex != INDEX_NONE && ParallelTokens.Num() > 0)
+			{
+				ExecutionTokens.Append(MoveTemp(ParallelTokens[Queued.ParallelIndex]));
+				continue;
+			}
+
+			MOVIESCENE_DETAILED_SCOPE_CYCLE_COUNTER(MovieSceneEval_EvaluateTrack);
+
+			PersistentDataProxy.SetTrackKey(Queued.TrackKey);
+
+			ExecutionTokens.SetOperand(Queued.Operand);
+			ExecutionTokens.SetTrack(Queued.TrackKey);
+
+			Player.PreAnimatedState.SetCaptureEntity(Queued.TrackKey, EMovieSceneCompletionMode::KeepState);
+
+			Queued.Track->Evaluate(
+				Queued.SegmentIndex,
+				Queued.Operand,
+				Queued.Context,
+				PersistentDataProxy,
+				ExecutionTokens);
+		}
+
 		if (Index.bRequiresImmediateFlush)
 		{
 			ExecutionTokens.Apply(Player);
@@ -259,6 +259,24 @@ void FMovieSceneEvaluationTrack::EvaluateSwept(int32 SegmentIndex, const FMovieS
 	}
 }
 
+bool FMovieSceneEvaluationTrack::SupportsParallelEvaluation() const
+{
+	if (TrackTemplate.IsValid() && TrackTemplate->HasCustomEvaluate())
+	{
+		return false;
+	}
+
+	for (const FMovieSceneEvalTemplatePtr& Child : ChildTemplates)
+	{
+		if (Child.IsValid() && !Child->SupportsParallelEvaluation())
+		{
+			return false;
+		}
+	}
+
+	return ChildTemplates.Num() > 0;
+}
+
 void FMovieSceneEvaluationTrack::Interrogate(const FMovieSceneContext& Context, FMovieSceneInterrogationData& Container) const
 {
 	if (TrackTemplate.IsValid() && TrackTemplate->Interrogate(Context, Container))
@@ -72,3 +72,20 @@ void FMovieSceneExecutionTokens::Apply(IMovieScenePlayer& Player)
 
 	SharedTokens.Reset();
 }
+
+void FMovieSceneExecutionTokens::Append(FMovieSceneExecutionTokens&& Other)
+{
+	Tokens.Reserve(Tokens.Num() + Other.Tokens.Num());
+	for (FEntry& Entry : Other.Tokens)
+	{
+		Tokens.Add(MoveTemp(Entry));
+	}
+	Other.Tokens.Reset();
+
+	for (auto& Pair : Other.SharedTokens)
+	{
+		checkf(!SharedTokens.Contains(Pair.Key), TEXT("Already added a shared token of this type"));
+		SharedTokens.Add(Pair.Key, MoveTemp(Pair.Value));
+	}
+	Other.SharedTokens.Reset();
+}
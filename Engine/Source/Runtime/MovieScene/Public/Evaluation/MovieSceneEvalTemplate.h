@@ -48,6 +48,16 @@ public:
 		return (OverrideMask & RequiresInitializeFlag) != 0;
 	}
 
+	/**
+	 * Check whether this template's Evaluate(Swept) is safe to call on a worker thread alongside other tracks.
+	 * Such templates may only read the context and persistent data, write to their own section data, and add execution tokens (not shared tokens).
+	 * @return Boolean representing whether the containing track may be evaluated in parallel with other tracks
+	 */
+	bool SupportsParallelEvaluation() const
+	{
+		return (OverrideMask & ParallelEvaluationFlag) != 0;
+	}
+
 	/**
 	 * Check whether we should restore any pre-animated state that was supplied by this template when it is no longer evaluated
 	 * @note					Pre-animated state bound to evaluation templates is reference counted across all similar animation types for a given object.
@@ -144,6 +154,7 @@ protected:
 	enum EOverrideMask
 	{
 		RequiresInitializeFlag		= 0x004,
+		ParallelEvaluationFlag		= 0x008,
 	};
 
 	/** Enumeration value signifying whether we should restore any animated state stored by this entity when this eval tempalte is no longer evaluated */
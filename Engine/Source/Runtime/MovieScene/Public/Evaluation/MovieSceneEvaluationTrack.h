@@ -274,6 +274,12 @@ public:
 	 */
 	MOVIESCENE_API  void Interrogate(const FMovieSceneContext& Context, FMovieSceneInterrogationData& Container) const;
 
+	/**
+	 * Check whether this track can be evaluated on a worker thread, in parallel with other tracks.
+	 * This is the case when it has no custom track evaluation and all its templates support parallel evaluation.
+	 */
+	MOVIESCENE_API bool SupportsParallelEvaluation() const;
+
 private:
 
 	/**
@@ -105,6 +105,12 @@ struct FMovieSceneExecutionTokens
 	/** Apply all execution tokens in order */
 	MOVIESCENE_API void Apply(IMovieScenePlayer& Player);
 
+	/**
+	 * Internal: Move all tokens accumulated by another stack onto the end of this one, keeping their order.
+	 * Used to gather the tokens of tracks evaluated in parallel.
+	 */
+	MOVIESCENE_API void Append(FMovieSceneExecutionTokens&& Other);
+
 private:
 
 	struct FEntry
@@ -30,5 +30,6 @@ struct FMovieScene3DTransformSectionTemplate : public FMovieSceneEvalTemplate
 private:
 
 	virtual UScriptStruct& GetScriptStructImpl() const override { return *StaticStruct(); }
+	virtual void SetupOverrides() override { EnableOverrides(ParallelEvaluationFlag); }
 	virtual void Evaluate(const FMovieSceneEvaluationOperand& Operand, const FMovieSceneContext& Context, const FPersistentEvaluationData& PersistentData, FMovieSceneExecutionTokens& ExecutionTokens) const override;
 };
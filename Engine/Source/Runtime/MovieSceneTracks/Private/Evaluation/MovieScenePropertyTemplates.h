@@ -38,7 +38,7 @@ protected:
 	}
 	virtual void SetupOverrides() override
 	{
-		EnableOverrides(RequiresSetupFlag | RequiresInitializeFlag);
+		EnableOverrides(RequiresSetupFlag | RequiresInitializeFlag | ParallelEvaluationFlag);
 	}
 	virtual void Setup(FPersistentEvaluationData& PersistentData, IMovieScenePlayer& Player) const override
 	{
@@ -74,7 +74,7 @@ protected:
 	}
 	virtual void SetupOverrides() override
 	{
-		EnableOverrides(RequiresSetupFlag | RequiresInitializeFlag);
+		EnableOverrides(RequiresSetupFlag | RequiresInitializeFlag | ParallelEvaluationFlag);
 	}
 	virtual void Setup(FPersistentEvaluationData& PersistentData, IMovieScenePlayer& Player) const override
 	{
@@ -110,7 +110,7 @@ protected:
 	}
 	virtual void SetupOverrides() override
 	{
-		EnableOverrides(RequiresSetupFlag | RequiresInitializeFlag);
+		EnableOverrides(RequiresSetupFlag | RequiresInitializeFlag | ParallelEvaluationFlag);
 	}
 	virtual void Setup(FPersistentEvaluationData& PersistentData, IMovieScenePlayer& Player) const override
 	{
@@ -146,7 +146,7 @@ protected:
 	}
 	virtual void SetupOverrides() override
 	{
-		EnableOverrides(RequiresSetupFlag | RequiresInitializeFlag);
+		EnableOverrides(RequiresSetupFlag | RequiresInitializeFlag | ParallelEvaluationFlag);
 	}
 	virtual void Setup(FPersistentEvaluationData& PersistentData, IMovieScenePlayer& Player) const override
 	{
@@ -182,7 +182,7 @@ protected:
 	}
 	virtual void SetupOverrides() override
 	{
-		EnableOverrides(RequiresSetupFlag | RequiresInitializeFlag);
+		EnableOverrides(RequiresSetupFlag | RequiresInitializeFlag | ParallelEvaluationFlag);
 	}
 	virtual void Setup(FPersistentEvaluationData& PersistentData, IMovieScenePlayer& Player) const override
 	{
@@ -258,7 +258,7 @@ protected:
 	}
 	virtual void SetupOverrides() override
 	{
-		EnableOverrides(RequiresSetupFlag | RequiresInitializeFlag);
+		EnableOverrides(RequiresSetupFlag | RequiresInitializeFlag | ParallelEvaluationFlag);
 	}
 
 	virtual void Setup(FPersistentEvaluationData& PersistentData, IMovieScenePlayer& Player) const override;
@@ -293,7 +293,7 @@ protected:
 	}
 	virtual void SetupOverrides() override
 	{
-		EnableOverrides(RequiresSetupFlag | RequiresInitializeFlag);
+		EnableOverrides(RequiresSetupFlag | RequiresInitializeFlag | ParallelEvaluationFlag);
 	}
 	virtual void Setup(FPersistentEvaluationData& PersistentData, IMovieScenePlayer& Player) const override
 	{
@@ -1787,6 +1787,186 @@ dtStatus dtNavMeshQuery::testClusterPath(dtPolyRef startRef, dtPolyRef endRef) c
 	return status;
 }
 
+dtStatus dtNavMeshQuery::findClusterPath(dtPolyRef startRef, dtPolyRef endRef,
+										 dtClusterRef* path, int* pathCount, const int maxPath) const
+{
+	dtAssert(m_nav);
+	dtAssert(m_nodePool);
+	dtAssert(m_openList);
+
+	*pathCount = 0;
+	m_queryNodes = 0;
+
+	if (!path || maxPath <= 0)
+		return DT_FAILURE | DT_INVALID_PARAM;
+
+	dtClusterRef startCRef = 0;
+	dtClusterRef endCRef = 0;
+	if (dtStatusFailed(getPolyCluster(startRef, startCRef)) || dtStatusFailed(getPolyCluster(endRef, endCRef)))
+	{
+		// this means most probably the hierarchical graph has not been build at all
+		return DT_FAILURE | DT_INVALID_PARAM;
+	}
+
+	if (startCRef == endCRef)
+	{
+		path[0] = startCRef;
+		*pathCount = 1;
+		return DT_SUCCESS;
+	}
+
+	const dtMeshTile* startTile = m_nav->getTileByRef(startCRef);
+	const dtMeshTile* endTile = m_nav->getTileByRef(endCRef);
+	const dtCluster& startCluster = startTile->clusters[m_nav->decodeClusterIdCluster(startCRef)];
+	const dtCluster& endCluster = endTile->clusters[m_nav->decodeClusterIdCluster(endCRef)];
+
+	m_nodePool->clear();
+	m_openList->clear();
+
+	dtNode* startNode = m_nodePool->getNode(startCRef);
+	dtVcopy(startNode->pos, startCluster.center);
+	startNode->pidx = 0;
+	startNode->cost = 0;
+	startNode->total = dtVdist(startCluster.center, endCluster.center) * DEFAULT_HEURISTIC_SCALE;
+	startNode->id = startCRef;
+	startNode->flags = DT_NODE_OPEN;
+	m_openList->push(startNode);
+	m_queryNodes++;
+
+	dtNode* lastBestNode = startNode;
+	float lastBestNodeCost = startNode->total;
+
+	dtStatus status = DT_SUCCESS;
+	while (!m_openList->empty())
+	{
+		// Remove node from open list and put it in closed list.
+		dtNode* bestNode = m_openList->pop();
+		bestNode->flags &= ~DT_NODE_OPEN;
+		bestNode->flags |= DT_NODE_CLOSED;
+
+		// Reached the goal, stop searching.
+		if (bestNode->id == endCRef)
+		{
+			lastBestNode = bestNode;
+			break;
+		}
+
+		// Get current cluster
+		const dtClusterRef bestRef = bestNode->id;
+		const dtMeshTile* bestTile = m_nav->getTileByRef(bestRef);
+		const dtCluster* bestCluster = &bestTile->clusters[m_nav->decodeClusterIdCluster(bestRef)];
+
+		// Get parent ref
+		const dtClusterRef parentRef = (bestNode->pidx) ? m_nodePool->getNodeAtIdx(bestNode->pidx)->id : 0;
+
+		// Iterate through links
+		unsigned int i = bestCluster->firstLink;
+		while (i != DT_NULL_LINK)
+		{
+			const dtClusterLink& link = m_nav->getClusterLink(bestTile, i);
+			i = link.next;
+
+			const dtClusterRef& neighbourRef = link.ref;
+
+			// do not expand back to where we came from.
+			if (!neighbourRef || neighbourRef == parentRef)
+				continue;
+
+			// Check backtracking
+			if ((link.flags & DT_CLINK_VALID_FWD) == 0)
+				continue;
+
+			// The API input has been cheked already, skip checking internal data.
+			const dtMeshTile* neighbourTile = m_nav->getTileByRef(neighbourRef);
+			const dtCluster* neighbourCluster = &neighbourTile->clusters[m_nav->decodeClusterIdCluster(neighbourRef)];
+
+			dtNode* neighbourNode = m_nodePool->getNode(neighbourRef);
+			if (!neighbourNode)
+			{
+				status |= DT_OUT_OF_NODES;
+				continue;
+			}
+
+			// If the node is visited the first time, calculate node position.
+			if (neighbourNode->flags == 0)
+			{
+				dtVcopy(neighbourNode->pos, neighbourCluster->center);
+			}
+
+			// Calculate cost and heuristic, clusters are traveled between their centers.
+			const float cost = bestNode->cost + dtVdist(bestNode->pos, neighbourNode->pos);
+			const float heuristic = (neighbourRef != endCRef) ? dtVdist(neighbourNode->pos, endCluster.center)*DEFAULT_HEURISTIC_SCALE : 0.0f;
+			const float total = cost + heuristic;
+
+			// The node is already in open list and the new result is worse, skip.
+			if ((neighbourNode->flags & DT_NODE_OPEN) && total >= neighbourNode->total)
+				continue;
+			// The node is already visited and process, and the new result is worse, skip.
+			if ((neighbourNode->flags & DT_NODE_CLOSED) && total >= neighbourNode->total)
+				continue;
+
+			// Add or update the node.
+			neighbourNode->pidx = m_nodePool->getNodeIdx(bestNode);
+			neighbourNode->id = neighbourRef;
+			neighbourNode->flags = (neighbourNode->flags & ~DT_NODE_CLOSED);
+			neighbourNode->cost = cost;
+			neighbourNode->total = total;
+
+			if (neighbourNode->flags & DT_NODE_OPEN)
+			{
+				// Already in open, update node location.
+				m_openList->modify(neighbourNode);
+			}
+			else
+			{
+				// Put the node in open list.
+				neighbourNode->flags |= DT_NODE_OPEN;
+				m_openList->push(neighbourNode);
+				m_queryNodes++;
+			}
+
+			// Update nearest node to target so far.
+			if (heuristic < lastBestNodeCost)
+			{
+				lastBestNodeCost = heuristic;
+				lastBestNode = neighbourNode;
+			}
+		}
+	}
+
+	if (lastBestNode->id != endCRef)
+		status |= DT_PARTIAL_RESULT;
+
+	// Count the corridor length.
+	int n = 0;
+	for (const dtNode* node = lastBestNode; node; node = m_nodePool->getNodeAtIdx(node->pidx))
+	{
+		n++;
+	}
+
+	// Keep the start of the corridor if the buffer is too small.
+	const dtNode* node = lastBestNode;
+	if (n > maxPath)
+	{
+		status |= DT_BUFFER_TOO_SMALL | DT_PARTIAL_RESULT;
+		for (int i = maxPath; i < n; ++i)
+		{
+			node = m_nodePool->getNodeAtIdx(node->pidx);
+		}
+		n = maxPath;
+	}
+
+	// Store the corridor, walking back from its end.
+	for (int i = n - 1; i >= 0; --i)
+	{
+		path[i] = node->id;
+		node = m_nodePool->getNodeAtIdx(node->pidx);
+	}
+
+	*pathCount = n;
+	return status;
+}
+
 /// @par
 ///
 /// @warning Calling any non-slice methods before calling finalizeSlicedFindPath() 
@@ -180,9 +180,11 @@ static int addNeighbour(const int idx, const float dist,
 	return dtMin(nneis+1, maxNeis);
 }
 
+// [UE4] reads neighbour candidates from proximity arrays instead of agents
 static int getNeighbours(const float* pos, const float height, const float range,
-						 const dtCrowdAgent* skip, dtCrowdNeighbour* result, const int maxResult,
-						 dtCrowdAgent** agents, const int /*nagents*/, dtProximityGrid* grid)
+						 const int skipIdx, const dtCrowdAgent* skip, dtCrowdNeighbour* result, const int maxResult,
+						 const float* posX, const float* posY, const float* posZ,
+						 const float* heights, const unsigned int* avoidanceGroups, const dtProximityGrid* grid)
 {
 	int n = 0;
 	
@@ -194,26 +196,23 @@ static int getNeighbours(const float* pos, const float height, const float range
 	
 	for (int i = 0; i < nids; ++i)
 	{
-		const dtCrowdAgent* ag = agents[ids[i]];
+		const int idx = ids[i];
 		
-		if (ag == skip) continue;
+		if (idx == skipIdx) continue;
 		
 		// Check for overlap.
-		float diff[3];
-		dtVsub(diff, pos, ag->npos);
-		if (fabsf(diff[1]) >= (height+ag->params.height)/2.0f)
+		if (fabsf(pos[1] - posY[idx]) >= (height+heights[idx])/2.0f)
 			continue;
-		diff[1] = 0;
-		const float distSqr = dtVlenSqr(diff);
+		const float distSqr = dtSqr(pos[0] - posX[idx]) + dtSqr(pos[2] - posZ[idx]);
 		if (distSqr > dtSqr(range))
 			continue;
 
 		// [UE4] add only when avoidance group allows it
-		const bool bDontAvoid = (skip->params.groupsToIgnore & ag->params.avoidanceGroup) || !(skip->params.groupsToAvoid & ag->params.avoidanceGroup);
+		const bool bDontAvoid = (skip->params.groupsToIgnore & avoidanceGroups[idx]) || !(skip->params.groupsToAvoid & avoidanceGroups[idx]);
 		if (bDontAvoid)
 			continue;
 		
-		n = addNeighbour(ids[i], distSqr, result, n, maxResult);
+		n = addNeighbour(idx, distSqr, result, n, maxResult);
 	}
 	return n;
 }
@@ -336,6 +335,11 @@ dtCrowd::dtCrowd() :
 	m_agentAnims(0),
 	m_obstacleQuery(0),
 	m_grid(0),
+	m_proximityPosX(0),
+	m_proximityPosY(0),
+	m_proximityPosZ(0),
+	m_proximityHeight(0),
+	m_proximityAvoidanceGroup(0),
 	m_pathResult(0),
 	m_maxPathResult(0),
 	m_maxAgentRadius(0),
@@ -374,6 +378,17 @@ void dtCrowd::purge()
 	dtFreeProximityGrid(m_grid);
 	m_grid = 0;
 
+	dtFree(m_proximityPosX);
+	dtFree(m_proximityPosY);
+	dtFree(m_proximityPosZ);
+	dtFree(m_proximityHeight);
+	dtFree(m_proximityAvoidanceGroup);
+	m_proximityPosX = 0;
+	m_proximityPosY = 0;
+	m_proximityPosZ = 0;
+	m_proximityHeight = 0;
+	m_proximityAvoidanceGroup = 0;
+
 	dtFreeObstacleAvoidanceQuery(m_obstacleQuery);
 	m_obstacleQuery = 0;
 	
@@ -400,6 +415,14 @@ bool dtCrowd::init(const int maxAgents, const float maxAgentRadius, dtNavMesh* n
 	if (!m_grid->init(m_maxAgents*4, maxAgentRadius*3))
 		return false;
 
+	m_proximityPosX = (float*)dtAlloc(sizeof(float)*m_maxAgents, DT_ALLOC_PERM);
+	m_proximityPosY = (float*)dtAlloc(sizeof(float)*m_maxAgents, DT_ALLOC_PERM);
+	m_proximityPosZ = (float*)dtAlloc(sizeof(float)*m_maxAgents, DT_ALLOC_PERM);
+	m_proximityHeight = (float*)dtAlloc(sizeof(float)*m_maxAgents, DT_ALLOC_PERM);
+	m_proximityAvoidanceGroup = (unsigned int*)dtAlloc(sizeof(unsigned int)*m_maxAgents, DT_ALLOC_PERM);
+	if (!m_proximityPosX || !m_proximityPosY || !m_proximityPosZ || !m_proximityHeight || !m_proximityAvoidanceGroup)
+		return false;
+
 	// [UE4] moved avoidance query init to separate function
 
 	// Allocate temp buffer for merging paths.
@@ -505,6 +528,11 @@ bool dtCrowd::getObstacleAvoidancePattern(int idx, float* angles, float* radii,
 	return m_obstacleQuery->getCustomSamplingPattern(idx, angles, radii, nsamples);
 }
 
+bool dtCrowd::initObstacleAvoidanceQuery(dtObstacleAvoidanceQuery* obstacleQuery) const
+{
+	return m_obstacleQuery && obstacleQuery && obstacleQuery->initFrom(*m_obstacleQuery);
+}
+
 const int dtCrowd::getAgentCount() const
 {
 	return m_maxAgents;
@@ -1239,6 +1267,16 @@ void dtCrowd::updateStepPaths(const float dt, dtCrowdAgentDebugInfo*)
 }
 
 void dtCrowd::updateStepProximityData(const float dt, dtCrowdAgentDebugInfo* debug)
+{
+	updateStepProximityBoundaries(dt, debug);
+
+	for (int i = 0; i < m_numActiveAgents; ++i)
+	{
+		updateStepNeighboursAgent(i);
+	}
+}
+
+void dtCrowd::updateStepProximityBoundaries(const float dt, dtCrowdAgentDebugInfo* debug)
 {
 	// Register agents to proximity grid.
 	m_grid->clear();
@@ -1248,6 +1286,12 @@ void dtCrowd::updateStepProximityData(const float dt, dtCrowdAgentDebugInfo* deb
 		const float* p = ag->npos;
 		const float r = ag->params.radius;
 		m_grid->addItem((unsigned short)i, p[0] - r, p[2] - r, p[0] + r, p[2] + r);
+
+		m_proximityPosX[i] = p[0];
+		m_proximityPosY[i] = p[1];
+		m_proximityPosZ[i] = p[2];
+		m_proximityHeight[i] = ag->params.height;
+		m_proximityAvoidanceGroup[i] = ag->params.avoidanceGroup;
 	}
 
 	m_sharedBoundary.Tick(dt);
@@ -1298,15 +1342,23 @@ void dtCrowd::updateStepProximityData(const float dt, dtCrowdAgentDebugInfo* deb
 				ag->corridor.getPath(), m_raycastSingleArea ? ag->corridor.getPathCount() : 0,
 				moveDir, m_navquery, &m_filters[ag->params.filter]);
 		}
-		// Query neighbour agents
-		ag->nneis = getNeighbours(ag->npos, ag->params.height, ag->params.collisionQueryRange,
-			ag, ag->neis, DT_CROWDAGENT_MAX_NEIGHBOURS,
-			m_activeAgents, m_numActiveAgents, m_grid);
-		for (int j = 0; j < ag->nneis; j++)
-			ag->neis[j].idx = getAgentIndex(m_activeAgents[ag->neis[j].idx]);
 	}
 }
 
+void dtCrowd::updateStepNeighboursAgent(const int activeIdx)
+{
+	dtCrowdAgent* ag = m_activeAgents[activeIdx];
+	if (ag->state != DT_CROWDAGENT_STATE_WALKING)
+		return;
+
+	// Query neighbour agents
+	ag->nneis = getNeighbours(ag->npos, ag->params.height, ag->params.collisionQueryRange,
+		activeIdx, ag, ag->neis, DT_CROWDAGENT_MAX_NEIGHBOURS,
+		m_proximityPosX, m_proximityPosY, m_proximityPosZ, m_proximityHeight, m_proximityAvoidanceGroup, m_grid);
+	for (int j = 0; j < ag->nneis; j++)
+		ag->neis[j].idx = getAgentIndex(m_activeAgents[ag->neis[j].idx]);
+}
+
 void dtCrowd::updateStepNextMovePoint(const float dt, dtCrowdAgentDebugInfo* debug)
 {
 	const int debugIdx = debug ? debug->idx : -1;
@@ -1427,154 +1479,164 @@ void dtCrowd::updateStepSteering(const float dt, dtCrowdAgentDebugInfo*)
 	// Calculate steering.
 	for (int i = 0; i < m_numActiveAgents; ++i)
 	{
-		dtCrowdAgent* ag = m_activeAgents[i];
-
-		if (ag->state != DT_CROWDAGENT_STATE_WALKING)
-			continue;
-		if (ag->targetState == DT_CROWDAGENT_TARGET_NONE)
-			continue;
+		updateStepSteeringAgent(i);
+	}
+}
 
-		float dvel[3] = { 0, 0, 0 };
+void dtCrowd::updateStepSteeringAgent(const int activeIdx)
+{
+	dtCrowdAgent* ag = m_activeAgents[activeIdx];
 
-		if (ag->targetState == DT_CROWDAGENT_TARGET_VELOCITY)
-		{
-			dtVcopy(dvel, ag->targetPos);
-			ag->desiredSpeed = dtVlen(ag->targetPos);
-		}
-		else
-		{
-			// Calculate steering direction.
-			if (ag->params.updateFlags & DT_CROWD_ANTICIPATE_TURNS)
-				calcSmoothSteerDirection(ag, dvel);
-			else
-				calcStraightSteerDirection(ag, dvel);
+	if (ag->state != DT_CROWDAGENT_STATE_WALKING)
+		return;
+	if (ag->targetState == DT_CROWDAGENT_TARGET_NONE)
+		return;
 
-			float speedScale = 1.0f;
+	float dvel[3] = { 0, 0, 0 };
 
-			if (ag->params.updateFlags & DT_CROWD_SLOWDOWN_AT_GOAL)
-			{
-				// Calculate speed scale, which tells the agent to slowdown at the end of the path.
-				const float slowDownRadius = ag->params.radius * 2;	// TODO: make less hacky.
-				speedScale = getDistanceToGoal(ag, slowDownRadius) / slowDownRadius;
-			}
+	if (ag->targetState == DT_CROWDAGENT_TARGET_VELOCITY)
+	{
+		dtVcopy(dvel, ag->targetPos);
+		ag->desiredSpeed = dtVlen(ag->targetPos);
+	}
+	else
+	{
+		// Calculate steering direction.
+		if (ag->params.updateFlags & DT_CROWD_ANTICIPATE_TURNS)
+			calcSmoothSteerDirection(ag, dvel);
+		else
+			calcStraightSteerDirection(ag, dvel);
 
-			ag->desiredSpeed = ag->params.maxSpeed;
-			dtVscale(dvel, dvel, ag->desiredSpeed * speedScale);
-		}
+		float speedScale = 1.0f;
 
-		// Separation
-		if (ag->params.updateFlags & DT_CROWD_SEPARATION)
+		if (ag->params.updateFlags & DT_CROWD_SLOWDOWN_AT_GOAL)
 		{
-			const float separationDist = ag->params.collisionQueryRange;
-			const float invSeparationDist = 1.0f / separationDist;
-			const float separationWeight = ag->params.separationWeight;
-			const float upDir[3] = { 0, 1.0f, 0 };
+			// Calculate speed scale, which tells the agent to slowdown at the end of the path.
+			const float slowDownRadius = ag->params.radius * 2;	// TODO: make less hacky.
+			speedScale = getDistanceToGoal(ag, slowDownRadius) / slowDownRadius;
+		}
 
-			float w = 0;
-			float disp[3] = { 0, 0, 0 };
+		ag->desiredSpeed = ag->params.maxSpeed;
+		dtVscale(dvel, dvel, ag->desiredSpeed * speedScale);
+	}
 
-			for (int j = 0; j < ag->nneis; ++j)
-			{
-				const dtCrowdAgent* nei = &m_agents[ag->neis[j].idx];
+	// Separation
+	if (ag->params.updateFlags & DT_CROWD_SEPARATION)
+	{
+		const float separationDist = ag->params.collisionQueryRange;
+		const float invSeparationDist = 1.0f / separationDist;
+		const float separationWeight = ag->params.separationWeight;
+		const float upDir[3] = { 0, 1.0f, 0 };
 
-				float diff[3];
-				dtVsub(diff, ag->npos, nei->npos);
-				diff[1] = 0;
-				
-				const float distSqr = dtVlenSqr(diff);
-				if (distSqr < 0.00001f)
-					continue;
-				if (distSqr > dtSqr(separationDist))
-					continue;
-				const float dist = sqrtf(distSqr);
-				const float weight = separationWeight * (1.0f - dtSqr(dist*invSeparationDist));
+		float w = 0;
+		float disp[3] = { 0, 0, 0 };
 
-				float sepDot = dtVdot(diff, dvel);
-				if (sepDot < m_separationDirFilter)
-				{
-					// [UE4]: clamp to right/left vector, depending on which side nei is
-					float testDir[3] = { 0, 0, 0 };
-					dtVcross(testDir, dvel, diff);
-					const bool bRightSide = (testDir[1] > 0);
-
-					dtVcross(diff, upDir, dvel);
-					dtVnormalize(diff);
-					dtVscale(diff, diff, bRightSide ? dist : -dist);
-				}
+		for (int j = 0; j < ag->nneis; ++j)
+		{
+			const dtCrowdAgent* nei = &m_agents[ag->neis[j].idx];
 
-				dtVmad(disp, disp, diff, weight / dist);
-				w += 1.0f;
-			}
+			float diff[3];
+			dtVsub(diff, ag->npos, nei->npos);
+			diff[1] = 0;
+			
+			const float distSqr = dtVlenSqr(diff);
+			if (distSqr < 0.00001f)
+				continue;
+			if (distSqr > dtSqr(separationDist))
+				continue;
+			const float dist = sqrtf(distSqr);
+			const float weight = separationWeight * (1.0f - dtSqr(dist*invSeparationDist));
 
-			if (w > 0.0001f)
+			float sepDot = dtVdot(diff, dvel);
+			if (sepDot < m_separationDirFilter)
 			{
-				// Adjust desired velocity.
-				dtVmad(dvel, dvel, disp, 1.0f / w);
-				// Clamp desired velocity to desired speed.
-				const float speedSqr = dtVlenSqr(dvel);
-				const float desiredSqr = dtSqr(ag->desiredSpeed);
-				if (speedSqr > desiredSqr)
-					dtVscale(dvel, dvel, desiredSqr / speedSqr);
+				// [UE4]: clamp to right/left vector, depending on which side nei is
+				float testDir[3] = { 0, 0, 0 };
+				dtVcross(testDir, dvel, diff);
+				const bool bRightSide = (testDir[1] > 0);
+
+				dtVcross(diff, upDir, dvel);
+				dtVnormalize(diff);
+				dtVscale(diff, diff, bRightSide ? dist : -dist);
 			}
+
+			dtVmad(disp, disp, diff, weight / dist);
+			w += 1.0f;
 		}
 
-		// Set the desired velocity.
-		dtVcopy(ag->dvel, dvel);
+		if (w > 0.0001f)
+		{
+			// Adjust desired velocity.
+			dtVmad(dvel, dvel, disp, 1.0f / w);
+			// Clamp desired velocity to desired speed.
+			const float speedSqr = dtVlenSqr(dvel);
+			const float desiredSqr = dtSqr(ag->desiredSpeed);
+			if (speedSqr > desiredSqr)
+				dtVscale(dvel, dvel, desiredSqr / speedSqr);
+		}
 	}
+
+	// Set the desired velocity.
+	dtVcopy(ag->dvel, dvel);
 }
 
 void dtCrowd::updateStepAvoidance(const float dt, dtCrowdAgentDebugInfo* debug)
 {
-	const int debugIdx = debug ? debug->idx : -1;
 	m_velocitySampleCount = 0;
 
 	// Velocity planning.	
 	for (int i = 0; i < m_numActiveAgents; ++i)
 	{
-		dtCrowdAgent* ag = m_activeAgents[i];
-
-		if (ag->state != DT_CROWDAGENT_STATE_WALKING)
-			continue;
-
-		if (ag->params.updateFlags & DT_CROWD_OBSTACLE_AVOIDANCE)
-		{
-			m_obstacleQuery->reset();
-
-			// Add neighbours as obstacles.
-			for (int j = 0; j < ag->nneis; ++j)
-			{
-				const dtCrowdAgent* nei = &m_agents[ag->neis[j].idx];
-				m_obstacleQuery->addCircle(nei->npos, nei->params.radius, nei->vel, nei->dvel);
-			}
+		m_velocitySampleCount += updateStepAvoidanceAgent(i, m_obstacleQuery, debug);
+	}
+}
 
-			// Append neighbour segments as obstacles.
-			for (int j = 0; j < ag->boundary.getSegmentCount(); ++j)
-			{
-				const float* s = ag->boundary.getSegment(j);
-				if (dtTriArea2D(ag->npos, s, s + 3) < 0.0f)
-					continue;
-				m_obstacleQuery->addSegment(s, s + 3, ag->boundary.getSegmentFlags(j));
-			}
+int dtCrowd::updateStepAvoidanceAgent(const int activeIdx, dtObstacleAvoidanceQuery* obstacleQuery, dtCrowdAgentDebugInfo* debug)
+{
+	dtCrowdAgent* ag = m_activeAgents[activeIdx];
 
-			dtObstacleAvoidanceDebugData* vod = 0;
-			const int agIndex = getAgentIndex(ag);
-			if (debug && debugIdx == agIndex)
-				vod = debug->vod;
+	if (ag->state != DT_CROWDAGENT_STATE_WALKING)
+		return 0;
 
-			// Sample new safe velocity.
-			const dtObstacleAvoidanceParams* params = &m_obstacleQueryParams[ag->params.obstacleAvoidanceType];
-			const int ns = m_obstacleQuery->sampleVelocity(ag->npos, ag->params.radius,
-					ag->desiredSpeed, ag->params.avoidanceQueryMultiplier,
-					ag->vel, ag->dvel, ag->nvel, params, vod);
+	int ns = 0;
+	if (ag->params.updateFlags & DT_CROWD_OBSTACLE_AVOIDANCE)
+	{
+		obstacleQuery->reset();
 
-			m_velocitySampleCount += ns;
+		// Add neighbours as obstacles.
+		for (int j = 0; j < ag->nneis; ++j)
+		{
+			const dtCrowdAgent* nei = &m_agents[ag->neis[j].idx];
+			obstacleQuery->addCircle(nei->npos, nei->params.radius, nei->vel, nei->dvel);
 		}
-		else
+
+		// Append neighbour segments as obstacles.
+		for (int j = 0; j < ag->boundary.getSegmentCount(); ++j)
 		{
-			// If not using velocity planning, new velocity is directly the desired velocity.
-			dtVcopy(ag->nvel, ag->dvel);
+			const float* s = ag->boundary.getSegment(j);
+			if (dtTriArea2D(ag->npos, s, s + 3) < 0.0f)
+				continue;
+			obstacleQuery->addSegment(s, s + 3, ag->boundary.getSegmentFlags(j));
 		}
+
+		dtObstacleAvoidanceDebugData* vod = 0;
+		const int agIndex = getAgentIndex(ag);
+		if (debug && debug->idx == agIndex)
+			vod = debug->vod;
+
+		// Sample new safe velocity.
+		const dtObstacleAvoidanceParams* params = &m_obstacleQueryParams[ag->params.obstacleAvoidanceType];
+		ns = obstacleQuery->sampleVelocity(ag->npos, ag->params.radius,
+				ag->desiredSpeed, ag->params.avoidanceQueryMultiplier,
+				ag->vel, ag->dvel, ag->nvel, params, vod);
+	}
+	else
+	{
+		// If not using velocity planning, new velocity is directly the desired velocity.
+		dtVcopy(ag->nvel, ag->dvel);
 	}
+
+	return ns;
 }
 
 void dtCrowd::updateStepMove(const float dt, dtCrowdAgentDebugInfo*)
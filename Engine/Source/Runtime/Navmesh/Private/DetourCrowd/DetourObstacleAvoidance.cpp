@@ -248,6 +248,15 @@ bool dtObstacleAvoidanceQuery::init(const int maxCircles, const int maxSegments,
 	return true;
 }
 
+bool dtObstacleAvoidanceQuery::initFrom(const dtObstacleAvoidanceQuery& source)
+{
+	if (!init(source.m_maxCircles, source.m_maxSegments, source.m_maxPatterns))
+		return false;
+
+	memcpy(m_customPatterns, source.m_customPatterns, sizeof(dtObstacleAvoidancePattern)*m_maxPatterns);
+	return true;
+}
+
 void dtObstacleAvoidanceQuery::reset()
 {
 	m_ncircles = 0;
@@ -345,6 +345,16 @@ public:
 	///  @param[in]		endRef				The reference id of the end polygon.
 	dtStatus testClusterPath(dtPolyRef startRef, dtPolyRef endRef) const; 
 
+	/// Finds the cluster corridor from start polygon to the end polygon using cluster graph
+	/// (cheap, uses distance between cluster centers as cost and does not care about area costs or filters)
+	///  @param[in]		startRef			The reference id of the start polygon.
+	///  @param[in]		endRef				The reference id of the end polygon.
+	///  @param[out]	path				An ordered list of cluster references representing the corridor. [(clusterRef) * @p pathCount]
+	///  @param[out]	pathCount			The number of clusters returned in the @p path array.
+	///  @param[in]		maxPath				The maximum number of clusters the @p path array can hold. [Limit: >= 1]
+	dtStatus findClusterPath(dtPolyRef startRef, dtPolyRef endRef,
+							 dtClusterRef* path, int* pathCount, const int maxPath) const;
+
 	/// Finds the straight path from the start to the end position within the polygon corridor.
 	///  @param[in]		startPos			Path start position. [(x, y, z)]
 	///  @param[in]		endPos				Path end position. [(x, y, z)]
@@ -240,6 +240,14 @@ class NAVMESH_API dtCrowd
 	dtObstacleAvoidanceQuery* m_obstacleQuery;
 	
 	dtProximityGrid* m_grid;
+
+	// [UE4] proximity data of active agents stored as separate arrays, indexed the same way as m_activeAgents
+	// neighbour queries can reject most of grid candidates without touching dtCrowdAgent
+	float* m_proximityPosX;
+	float* m_proximityPosY;
+	float* m_proximityPosZ;
+	float* m_proximityHeight;
+	unsigned int* m_proximityAvoidanceGroup;
 	
 	dtPolyRef* m_pathResult;
 	int m_maxPathResult;
@@ -410,6 +418,16 @@ public:
 	/// @param[in]		nagents	Number of active agents
 	void updateStepProximityData(const float dt, dtCrowdAgentDebugInfo* debug);
 
+	/// [UE4] Serial part of updateStepProximityData: proximity grid and boundaries,
+	/// neighbours need to be gathered with updateStepNeighboursAgent for every active agent afterwards
+	/// @param[in]		dt		Delta time in seconds
+	void updateStepProximityBoundaries(const float dt, dtCrowdAgentDebugInfo* debug);
+
+	/// [UE4] Per agent part of updateStepProximityData: neighbour agents query.
+	/// Different agents can be processed in parallel.
+	/// @param[in]		activeIdx	Index of agent in active agents list
+	void updateStepNeighboursAgent(const int activeIdx);
+
 	/// [UE4] Split update into several smaller components: next corner for move, trigger offmesh links
 	/// @param[in]		dt		Delta time in seconds
 	/// @param[in]		nagents	Number of active agents
@@ -420,11 +438,28 @@ public:
 	/// @param[in]		nagents	Number of active agents
 	void updateStepSteering(const float dt, dtCrowdAgentDebugInfo* debug);
 
+	/// [UE4] Per agent part of updateStepSteering.
+	/// Different agents can be processed in parallel.
+	/// @param[in]		activeIdx	Index of agent in active agents list
+	void updateStepSteeringAgent(const int activeIdx);
+
 	/// [UE4] Split update into several smaller components: avoidance
 	/// @param[in]		dt		Delta time in seconds
 	/// @param[in]		nagents	Number of active agents
 	void updateStepAvoidance(const float dt, dtCrowdAgentDebugInfo* debug);
 
+	/// [UE4] Per agent part of updateStepAvoidance.
+	/// Different agents can be processed in parallel, as long as each thread uses its own obstacle query.
+	/// @param[in]		activeIdx		Index of agent in active agents list
+	/// @param[in]		obstacleQuery	Obstacle query to use, @see initObstacleAvoidanceQuery
+	/// @return Number of sampled velocities
+	int updateStepAvoidanceAgent(const int activeIdx, dtObstacleAvoidanceQuery* obstacleQuery, dtCrowdAgentDebugInfo* debug);
+
+	/// [UE4] Initializes obstacle query with the same limits and sampling patterns as crowd's own,
+	/// for running updateStepAvoidanceAgent on other threads
+	/// @return True if the initialization succeeded.
+	bool initObstacleAvoidanceQuery(dtObstacleAvoidanceQuery* obstacleQuery) const;
+
 	/// [UE4] Split update into several smaller components: integrate velocities and handle collisions
 	/// @param[in]		dt		Delta time in seconds
 	/// @param[in]		nagents	Number of active agents
@@ -111,6 +111,9 @@ public:
 	~dtObstacleAvoidanceQuery();
 	
 	bool init(const int maxCircles, const int maxSegments, const int maxCustomPatterns);
+
+	// [UE4] init with the same limits and custom sampling patterns as source query
+	bool initFrom(const dtObstacleAvoidanceQuery& source);
 	
 	void reset();
 
@@ -7,6 +7,7 @@
 #include "UObject/Object.h"
 #include "NiagaraCommon.h"
 #include "NiagaraParameters.h"
+#include "VectorVM.h"
 
 #include "NiagaraScript.generated.h"
 
@@ -59,6 +60,9 @@ class UNiagaraScript : public UObject
 	UPROPERTY()
 	TArray<uint8> ByteCode;
 
+	/** ByteCode with its ops resolved to kernels, filled in by the first execution of the script. */
+	VectorVM::FResolvedByteCode ResolvedByteCode;
+
 	/** All the data for using constants in the script. */
 	UPROPERTY()
 	FNiagaraParameters Parameters;
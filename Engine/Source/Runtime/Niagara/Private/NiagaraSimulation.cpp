@@ -43,6 +43,14 @@ static FAutoConsoleVariableRef CVarNiagaraDumpParticleData(
 	ECVF_Default
 	);
 
+static int32 GbParallelVMExecution = 1;
+static FAutoConsoleVariableRef CVarNiagaraParallelVMExecution(
+	TEXT("fx.ParallelVMExecution"),
+	GbParallelVMExecution,
+	TEXT("If > 0 scripts of emitters with many particles are executed on several task graph workers. \n"),
+	ECVF_Default
+	);
+
 //////////////////////////////////////////////////////////////////////////
 
 //Todo: this is slightly neater than the previous setup and execution but there's plenty that could be better and faster!.
@@ -184,8 +192,31 @@ struct FNiagaraScriptExecutionContext
 
 	void Execute()
 	{
+		if (GbParallelVMExecution)
+		{
+			VectorVM::ExecParallel(
+				Script->ByteCode,
+				Script->ResolvedByteCode,
+				InputRegisters,
+				InputRegisterSizes,
+				NumInputRegisters,
+				OutputRegisters,
+				OutputRegisterSizes,
+				NumOutputRegisters,
+				ConstantTable.GetData(),
+				DataSetMetaTable,
+				FunctionTable.GetData(),
+				NumParticles
+#if STATS
+				, StatScopes
+#endif
+			);
+			return;
+		}
+
 		VectorVM::Exec(
-			Script->ByteCode.GetData(),
+			Script->ByteCode,
+			Script->ResolvedByteCode,
 			InputRegisters,
 			InputRegisterSizes,
 			NumInputRegisters,
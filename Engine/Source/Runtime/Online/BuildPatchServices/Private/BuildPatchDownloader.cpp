@@ -27,6 +27,8 @@ using namespace BuildPatchConstants;
 #define EXTRA_DOWNLOAD_LOGGING 0
 
 int32 NUM_DOWNLOAD_THREADS = 8;
+int32 MAX_DOWNLOAD_THREADS = 16;
+bool ADAPTIVE_DOWNLOAD_THREADS = true;
 
 /* A class used to monitor the average chunk download time and standard deviation
 *****************************************************************************/
@@ -129,6 +131,91 @@ private:
 	uint64 Count;
 };
 
+/* A class used to adapt the number of concurrent downloads to the measured throughput
+*****************************************************************************/
+class FDownloadConcurrency
+{
+public:
+	FDownloadConcurrency(int32 InInitial, int32 InMax)
+		: Max(InMax)
+		, Current(FMath::Clamp<int32>(InInitial, 1, InMax))
+		, Direction(1)
+		, LastThroughput(0)
+		, IntervalStart(0)
+		, IntervalBytes(0)
+		, bIntervalValid(true)
+	{}
+
+	int32 Get() const
+	{
+		return Current;
+	}
+
+	void AddBytes(int64 Bytes)
+	{
+		IntervalBytes += Bytes;
+	}
+
+	// Called when the downloads were not what limited progress, e.g. the queue ran dry, the cache was full or chunks were retrying
+	void InvalidateInterval()
+	{
+		bIntervalValid = false;
+	}
+
+	void Update(double Now)
+	{
+		// Seconds of saturated downloading between adjustments
+		const double SampleSeconds = 2.0;
+		// Relative change in throughput considered significant
+		const double Tolerance = 0.05;
+		if (IntervalStart == 0)
+		{
+			IntervalStart = Now;
+			return;
+		}
+		const double Elapsed = Now - IntervalStart;
+		if (Elapsed < SampleSeconds)
+		{
+			return;
+		}
+		if (bIntervalValid && IntervalBytes > 0)
+		{
+			const double Throughput = IntervalBytes / Elapsed;
+			if (LastThroughput > 0)
+			{
+				if (Throughput > LastThroughput * (1.0 + Tolerance))
+				{
+					// The last step helped, keep going the same way
+				}
+				else if (Throughput < LastThroughput * (1.0 - Tolerance))
+				{
+					// The last step hurt, turn around
+					Direction = -Direction;
+				}
+				else
+				{
+					// No real difference, so prefer fewer requests competing for the connection
+					Direction = -1;
+				}
+			}
+			LastThroughput = Throughput;
+			Current = FMath::Clamp<int32>(Current + Direction, 1, Max);
+		}
+		IntervalStart = Now;
+		IntervalBytes = 0;
+		bIntervalValid = true;
+	}
+
+private:
+	const int32 Max;
+	int32 Current;
+	int32 Direction;
+	double LastThroughput;
+	double IntervalStart;
+	int64 IntervalBytes;
+	bool bIntervalValid;
+};
+
 /* FBuildPatchDownloader implementation
 *****************************************************************************/
 FBuildPatchDownloader::FBuildPatchDownloader(const FString& InSaveDirectory, const TArray<FString>& InCloudDirectories, const FBuildPatchAppManifestRef& InInstallManifest, FBuildPatchProgress* InBuildProgress)
@@ -145,6 +232,8 @@ FBuildPatchDownloader::FBuildPatchDownloader(const FString& InSaveDirectory, con
 	, bIsIdle(false)
 	, bIsDisconnected(false)
 	, bWaitingForJobs(true)
+	, DownloadConcurrency(0)
+	, bHadUnusedDownloadSlot(false)
 	, ChunkSuccessRate(1.0f)
 	, CyclesAtLastHealthState(0)
 	, DownloadHealth(EBuildPatchDownloadHealth::Excellent)
@@ -161,6 +250,10 @@ FBuildPatchDownloader::FBuildPatchDownloader(const FString& InSaveDirectory, con
 	// config overrides to control downloads
 	GConfig->GetInt(TEXT("Portal.BuildPatch"), TEXT("ChunkDownloads"), NUM_DOWNLOAD_THREADS, GEngineIni);
 	NUM_DOWNLOAD_THREADS = FMath::Clamp<int32>(NUM_DOWNLOAD_THREADS, 1, 100);
+	GConfig->GetInt(TEXT("Portal.BuildPatch"), TEXT("MaxChunkDownloads"), MAX_DOWNLOAD_THREADS, GEngineIni);
+	MAX_DOWNLOAD_THREADS = FMath::Clamp<int32>(MAX_DOWNLOAD_THREADS, NUM_DOWNLOAD_THREADS, 100);
+	GConfig->GetBool(TEXT("Portal.BuildPatch"), TEXT("AdaptiveChunkDownloads"), ADAPTIVE_DOWNLOAD_THREADS, GEngineIni);
+	DownloadConcurrency = NUM_DOWNLOAD_THREADS;
 
 	// Start thread!
 	const TCHAR* ThreadName = TEXT("ChunkDownloaderThread");
@@ -278,6 +371,8 @@ uint32 FBuildPatchDownloader::Run()
 	// The Average chunk download time
 	FMeanChunkTime MeanChunkTime;
 	FChunkSuccessRate SuccessRateTracker;
+	// Starts at the configured download count, and gets moved towards the point where more requests stop adding throughput
+	FDownloadConcurrency Concurrency(NUM_DOWNLOAD_THREADS, ADAPTIVE_DOWNLOAD_THREADS ? MAX_DOWNLOAD_THREADS : NUM_DOWNLOAD_THREADS);
 	TArray< FGuid > InFlightKeys;
 
 	// To time the health states, we need to start the timers on first download
@@ -311,6 +406,7 @@ uint32 FBuildPatchDownloader::Run()
 				{
 					const double ChunkTime = InFlightJob.DownloadRecord.EndTime - InFlightJob.DownloadRecord.StartTime;
 					MeanChunkTime.AddSample(ChunkTime);
+					Concurrency.AddBytes(InFlightJob.DownloadRecord.DownloadSize);
 					// If we know the SHA for this chunk, add it to the header for improved verification
 					FSHAHashData ChunkShaHash;
 					if (InstallManifest->GetChunkShaHash(InFlightKey, ChunkShaHash))
@@ -437,9 +533,19 @@ uint32 FBuildPatchDownloader::Run()
 		SetIsDisconnected(bAllDownloadsRetrying && SecondsSinceData > DisconnectedDelay);
 		SetIsDownloading(bHasDownloads);
 
+		// Adjust how many downloads we run at once, throughput is only meaningful while every slot was in use
+		if (bAllDownloadsRetrying || DataToRetry.Num() > 0 || bHadUnusedDownloadSlot)
+		{
+			Concurrency.InvalidateInterval();
+		}
+		bHadUnusedDownloadSlot = false;
+		Concurrency.Update(FPlatformTime::Seconds());
+		DownloadConcurrency = Concurrency.Get();
+
 		// Pause
 		if (BuildProgress->GetPauseState())
 		{
+			Concurrency.InvalidateInterval();
 			FStatsCollector::FAtomicValue PausedForCycles = FStatsCollector::FAtomicValue(FStatsCollector::SecondsToCycles(BuildProgress->WaitWhilePaused()));
 			// Skew timers
 			FPlatformAtomics::InterlockedAdd(&CyclesAtLastHealthState, PausedForCycles);
@@ -882,7 +988,7 @@ bool FBuildPatchDownloader::GetNextDownload( FGuid& Job )
 	if( !bAllowedDownload )
 	{
 		FScopeLock ScopeLock( &InFlightDownloadsLock );
-		bAllowedDownload = InFlightDownloads.Num() < NUM_DOWNLOAD_THREADS;
+		bAllowedDownload = InFlightDownloads.Num() < DownloadConcurrency;
 	}
 	// Find a guid that the cache wants
 	if( bAllowedDownload )
@@ -908,7 +1014,7 @@ bool FBuildPatchDownloader::GetNextDownload( FGuid& Job )
 			}
 		}
 		// If we are not retrying, and not all chunks are failing, allow another chunk
-		if (!bRetrying && NumDataToRetry < NUM_DOWNLOAD_THREADS)
+		if (!bRetrying && NumDataToRetry < DownloadConcurrency)
 		{
 			bAllowedDownload = false;
 			DataToDownloadLock.Lock();
@@ -936,6 +1042,8 @@ bool FBuildPatchDownloader::GetNextDownload( FGuid& Job )
 			}
 			DataToDownloadLock.Unlock();
 		}
+		// A slot was free but nothing could use it, so downloads are not the bottleneck right now
+		bHadUnusedDownloadSlot = bHadUnusedDownloadSlot || !bAllowedDownload;
 	}
 	// If allowed to download, add to InFlight
 	if( bAllowedDownload )
@@ -148,6 +148,12 @@ private:
 	// A flag that says whether more chunks could still be queued
 	bool bWaitingForJobs;
 
+	// The number of downloads currently allowed in flight, adapted to throughput by the download thread
+	int32 DownloadConcurrency;
+
+	// A flag marking that a download slot was free since the last adjustment but no job could be started, only used by the download thread
+	bool bHadUnusedDownloadSlot;
+
 	// The current overall download success rate
 	float ChunkSuccessRate;
 
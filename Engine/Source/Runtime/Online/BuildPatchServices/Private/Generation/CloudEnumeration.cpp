@@ -20,9 +20,9 @@ namespace BuildPatchServices
 		virtual ~FCloudEnumeration();
 
 		virtual TSet<FGuid> GetChunkSet(uint64 ChunkHash) const override;
-		virtual TMap<uint64, TSet<FGuid>> GetChunkInventory() const override;
-		virtual TMap<FGuid, int64> GetChunkFileSizes() const override;
-		virtual TMap<FGuid, FSHAHash> GetChunkShaHashes() const override;
+		virtual const TMap<uint64, TSet<FGuid>>& GetChunkInventory() const override;
+		virtual const TMap<FGuid, int64>& GetChunkFileSizes() const override;
+		virtual const TMap<FGuid, FSHAHash>& GetChunkShaHashes() const override;
 	private:
 		void EnumerateCloud();
 		void EnumerateManifestData(const FBuildPatchAppManifestRef& Manifest);
@@ -74,31 +74,25 @@ namespace BuildPatchServices
 	}
 
 
-	TMap<uint64, TSet<FGuid>> FCloudEnumeration::GetChunkInventory() const
+	const TMap<uint64, TSet<FGuid>>& FCloudEnumeration::GetChunkInventory() const
 	{
+		// Nothing writes to the map once the enumeration task has completed.
 		Future.Wait();
-		{
-			FScopeLock ScopeLock(&InventoryCS);
-			return ChunkInventory;
-		}
+		return ChunkInventory;
 	}
 
-	TMap<FGuid, int64> FCloudEnumeration::GetChunkFileSizes() const
+	const TMap<FGuid, int64>& FCloudEnumeration::GetChunkFileSizes() const
 	{
+		// Nothing writes to the map once the enumeration task has completed.
 		Future.Wait();
-		{
-			FScopeLock ScopeLock(&InventoryCS);
-			return ChunkFileSizes;
-		}
+		return ChunkFileSizes;
 	}
 
-	TMap<FGuid, FSHAHash> FCloudEnumeration::GetChunkShaHashes() const
+	const TMap<FGuid, FSHAHash>& FCloudEnumeration::GetChunkShaHashes() const
 	{
+		// Nothing writes to the map once the enumeration task has completed.
 		Future.Wait();
-		{
-			FScopeLock ScopeLock(&InventoryCS);
-			return ChunkShaHashes;
-		}
+		return ChunkShaHashes;
 	}
 
 	void FCloudEnumeration::EnumerateCloud()
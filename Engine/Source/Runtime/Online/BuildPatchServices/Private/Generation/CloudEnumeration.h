@@ -12,9 +12,10 @@ namespace BuildPatchServices
 	{
 	public:
 		virtual TSet<FGuid> GetChunkSet(uint64 ChunkHash) const = 0;
-		virtual TMap<uint64, TSet<FGuid>> GetChunkInventory() const = 0;
-		virtual TMap<FGuid, int64> GetChunkFileSizes() const = 0;
-		virtual TMap<FGuid, FSHAHash> GetChunkShaHashes() const = 0;
+		// The maps below are no longer modified once enumeration has completed, the references stay valid for the lifetime of the enumeration.
+		virtual const TMap<uint64, TSet<FGuid>>& GetChunkInventory() const = 0;
+		virtual const TMap<FGuid, int64>& GetChunkFileSizes() const = 0;
+		virtual const TMap<FGuid, FSHAHash>& GetChunkShaHashes() const = 0;
 	};
 
 	typedef TSharedRef<ICloudEnumeration, ESPMode::ThreadSafe> ICloudEnumerationRef;
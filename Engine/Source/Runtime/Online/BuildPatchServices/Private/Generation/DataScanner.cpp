@@ -34,8 +34,8 @@ namespace BuildPatchServices
 		FThreadSafeBool bShouldAbort;
 		TFuture<TArray<FChunkMatch>> FutureResult;
 		FRollingHash<WindowSize> RollingHash;
-		TMap<uint64, TSet<FGuid>> ChunkInventory;
-		TMap<FGuid, FSHAHash> ChunkShaHashes;
+		const TMap<uint64, TSet<FGuid>>* ChunkInventory;
+		const TMap<FGuid, FSHAHash>* ChunkShaHashes;
 		volatile FStatsCollector::FAtomicValue* StatCreatedScanners;
 		volatile FStatsCollector::FAtomicValue* StatRunningScanners;
 		volatile FStatsCollector::FAtomicValue* StatCompleteScanners;
@@ -57,6 +57,8 @@ namespace BuildPatchServices
 		, StatsCollector(InStatsCollector)
 		, bIsComplete(false)
 		, bShouldAbort(false)
+		, ChunkInventory(nullptr)
+		, ChunkShaHashes(nullptr)
 	{
 		// Create statistics.
 		StatCreatedScanners = StatsCollector->CreateStat(TEXT("Scanner: Created Scanners"), EStatFormat::Value);
@@ -113,7 +115,7 @@ namespace BuildPatchServices
 
 	bool FDataScanner::FindChunkDataMatch(FGuid& ChunkMatch, FSHAHash& ChunkSha)
 	{
-		TSet<FGuid>* PotentialMatches = ChunkInventory.Find(RollingHash.GetWindowHash());
+		const TSet<FGuid>* PotentialMatches = ChunkInventory->Find(RollingHash.GetWindowHash());
 		bool bFoundMatch = false;
 		if (PotentialMatches != nullptr)
 		{
@@ -121,7 +123,7 @@ namespace BuildPatchServices
 			// Always return first match in list however count all collisions.
 			for (const FGuid& PotentialMatch : *PotentialMatches)
 			{
-				FSHAHash* PotentialMatchSha = ChunkShaHashes.Find(PotentialMatch);
+				const FSHAHash* PotentialMatchSha = ChunkShaHashes->Find(PotentialMatch);
 				if (PotentialMatchSha != nullptr && *PotentialMatchSha == ChunkSha)
 				{
 					if (!bFoundMatch)
@@ -148,9 +150,9 @@ namespace BuildPatchServices
 		// Count running scanners.
 		NumRunningScanners.Increment();
 
-		// Get a copy of the chunk inventory.
-		ChunkInventory = CloudEnumeration->GetChunkInventory();
-		ChunkShaHashes = CloudEnumeration->GetChunkShaHashes();
+		// Reference the chunk inventory, every scanner copying it was a large part of the scanning cost when the cloud directory holds many chunks.
+		ChunkInventory = &CloudEnumeration->GetChunkInventory();
+		ChunkShaHashes = &CloudEnumeration->GetChunkShaHashes();
 
 		// Temp values.
 		FGuid ChunkMatch;
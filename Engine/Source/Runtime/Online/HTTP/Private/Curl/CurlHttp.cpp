@@ -12,6 +12,12 @@
 
 int32 FCurlHttpRequest::NumberOfInfoMessagesToCache = 50;
 
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("HTTP DNS Lookup Time (ms)"), STAT_HttpNameLookupTime, STATGROUP_Net);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("HTTP Connect Time (ms)"), STAT_HttpConnectTime, STATGROUP_Net);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("HTTP TLS Handshake Time (ms)"), STAT_HttpTlsTime, STATGROUP_Net);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("HTTP Transfer Time (ms)"), STAT_HttpTransferTime, STATGROUP_Net);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("HTTP New Connections"), STAT_HttpNewConnections, STATGROUP_Net);
+
 #if WITH_SSL
 #include "Ssl.h"
 
@@ -83,6 +89,21 @@ FCurlHttpRequest::FCurlHttpRequest()
 	{
 		curl_easy_setopt(EasyHandle, CURLOPT_FORBID_REUSE, 1L);
 	}
+	else
+	{
+		// keep idle pooled connections from being dropped by NATs and load balancers between requests
+		curl_easy_setopt(EasyHandle, CURLOPT_TCP_KEEPALIVE, 1L);
+	}
+
+#if LIBCURL_VERSION_NUM >= 0x072F00	// 7.47.0
+	if (FCurlHttpManager::CurlRequestOptions.bUseHttp2)
+	{
+		// negotiate HTTP/2 through ALPN on https connections, plain http stays on HTTP/1.1
+		curl_easy_setopt(EasyHandle, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
+		// wait for a connection that is being set up to the same host instead of opening another one, so the request can be multiplexed on it
+		curl_easy_setopt(EasyHandle, CURLOPT_PIPEWAIT, 1L);
+	}
+#endif
 
 	if (FCurlHttpManager::CurlRequestOptions.CertBundlePath)
 	{
@@ -328,6 +349,12 @@ size_t FCurlHttpRequest::ReceiveResponseHeaderCallback(void* Ptr, size_t SizeInB
 					if (HeaderKey == TEXT("Content-Length"))
 					{
 						Response->ContentLength = FCString::Atoi(*HeaderValue);
+
+						// size the payload up front instead of growing (and copying) it as the body comes in
+						if (!ResponseBodyReceiveStreamDelegate.IsBound() && Response->ContentLength > Response->Payload.Max())
+						{
+							Response->Payload.Reserve(Response->ContentLength);
+						}
 					}
 				}
 			}
@@ -366,6 +393,18 @@ size_t FCurlHttpRequest::ReceiveResponseBodyCallback(void* Ptr, size_t SizeInBlo
 		// note that we can be passed 0 bytes if file transmitted has 0 length
 		if (SizeToDownload > 0)
 		{
+			if (ResponseBodyReceiveStreamDelegate.IsBound())
+			{
+				if (!ResponseBodyReceiveStreamDelegate.Execute(static_cast<const uint8*>(Ptr), SizeToDownload))
+				{
+					UE_LOG(LogHttp, Log, TEXT("%p: response body stream delegate cancelled the request."), this);
+					return 0;	// aborts the transfer with a write error
+				}
+
+				Response->TotalBytesRead.Add(SizeToDownload);
+				return SizeToDownload;
+			}
+
 			Response->Payload.AddUninitialized(SizeToDownload);
 
 			// save
@@ -718,6 +757,18 @@ FHttpRequestProgressDelegate& FCurlHttpRequest::OnRequestProgress()
 	return RequestProgressDelegate;
 }
 
+bool FCurlHttpRequest::SetResponseBodyReceiveStreamDelegate(FHttpRequestStreamDelegate StreamDelegate)
+{
+	if (CompletionStatus == EHttpRequestStatus::Processing)
+	{
+		UE_LOG(LogHttp, Warning, TEXT("FCurlHttpRequest::SetResponseBodyReceiveStreamDelegate() - attempted to set stream delegate on a request that is inflight"));
+		return false;
+	}
+
+	ResponseBodyReceiveStreamDelegate = StreamDelegate;
+	return true;
+}
+
 void FCurlHttpRequest::CancelRequest()
 {
 	bCanceled = true;
@@ -770,6 +821,34 @@ void FCurlHttpRequest::CheckProgressDelegate()
 	}
 }
 
+void FCurlHttpRequest::LogTimings()
+{
+	// all times are cumulative from the start of the request, they are 0 for the steps that were skipped because a connection was reused
+	double NameLookupTime = 0.0;
+	double ConnectTime = 0.0;
+	double AppConnectTime = 0.0;
+	double TotalTime = 0.0;
+	long NumConnects = 0;
+	curl_easy_getinfo(EasyHandle, CURLINFO_NAMELOOKUP_TIME, &NameLookupTime);
+	curl_easy_getinfo(EasyHandle, CURLINFO_CONNECT_TIME, &ConnectTime);
+	curl_easy_getinfo(EasyHandle, CURLINFO_APPCONNECT_TIME, &AppConnectTime);
+	curl_easy_getinfo(EasyHandle, CURLINFO_TOTAL_TIME, &TotalTime);
+	curl_easy_getinfo(EasyHandle, CURLINFO_NUM_CONNECTS, &NumConnects);
+
+	const double ConnectMs = FMath::Max(ConnectTime - NameLookupTime, 0.0) * 1000.0;
+	const double TlsMs = AppConnectTime > 0.0 ? FMath::Max(AppConnectTime - ConnectTime, 0.0) * 1000.0 : 0.0;
+	const double TransferMs = FMath::Max(TotalTime - FMath::Max(AppConnectTime, ConnectTime), 0.0) * 1000.0;
+
+	INC_FLOAT_STAT_BY(STAT_HttpNameLookupTime, (float)(NameLookupTime * 1000.0));
+	INC_FLOAT_STAT_BY(STAT_HttpConnectTime, (float)ConnectMs);
+	INC_FLOAT_STAT_BY(STAT_HttpTlsTime, (float)TlsMs);
+	INC_FLOAT_STAT_BY(STAT_HttpTransferTime, (float)TransferMs);
+	INC_DWORD_STAT_BY(STAT_HttpNewConnections, (uint32)NumConnects);
+
+	UE_LOG(LogHttp, Verbose, TEXT("%p: timings for URL %s: DNS %.1f ms, connect %.1f ms, TLS %.1f ms, transfer %.1f ms, new connections %d"),
+		this, *GetURL(), NameLookupTime * 1000.0, ConnectMs, TlsMs, TransferMs, (int32)NumConnects);
+}
+
 void FCurlHttpRequest::FinishedRequest()
 {
 	QUICK_SCOPE_CYCLE_COUNTER(STAT_FCurlHttpRequest_FinishedRequest);
@@ -794,6 +873,8 @@ void FCurlHttpRequest::FinishedRequest()
 			{
 				Response->ContentLength = static_cast< int32 >(ContentLengthDownload);
 			}
+
+			LogTimings();
 		}
 	}
 	
@@ -135,6 +135,7 @@ public:
 	virtual bool ProcessRequest() override;
 	virtual FHttpRequestCompleteDelegate& OnProcessRequestComplete() override;
 	virtual FHttpRequestProgressDelegate& OnRequestProgress() override;
+	virtual bool SetResponseBodyReceiveStreamDelegate(FHttpRequestStreamDelegate StreamDelegate) override;
 	virtual void CancelRequest() override;
 	virtual EHttpRequestStatus::Type GetStatus() override;
 	virtual const FHttpResponsePtr GetResponse() const override;
@@ -297,6 +298,11 @@ private:
 	 */
 	void FinishedRequest();
 
+	/**
+	 * Adds the DNS, connect, TLS and transfer times of the finished request to the Net stats and logs them at Verbose
+	 */
+	void LogTimings();
+
 	/**
 	 * Close session/request handles and unregister callbacks
 	 */
@@ -333,6 +339,8 @@ private:
 	FHttpRequestCompleteDelegate RequestCompleteDelegate;
 	/** Delegate that will get called once per tick with total bytes uploaded and downloaded so far */
 	FHttpRequestProgressDelegate RequestProgressDelegate;
+	/** Delegate that gets the response body instead of the response payload, called on the http thread */
+	FHttpRequestStreamDelegate ResponseBodyReceiveStreamDelegate;
 	/** Current status of request being processed */
 	EHttpRequestStatus::Type CompletionStatus;
 	/** Mapping of header section to values. */
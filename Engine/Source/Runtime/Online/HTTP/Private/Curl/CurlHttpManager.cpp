@@ -277,6 +277,9 @@ void FCurlHttpManager::InitCurl()
 			PrintCurlFeature(CURL_VERSION_IDN);
 			PrintCurlFeature(CURL_VERSION_CONV);
 			PrintCurlFeature(CURL_VERSION_TLSAUTH_SRP);
+#if LIBCURL_VERSION_NUM >= 0x072100	// 7.33.0
+			PrintCurlFeature(CURL_VERSION_HTTP2);
+#endif
 #undef PrintCurlFeature
 		}
 
@@ -389,6 +392,43 @@ void FCurlHttpManager::InitCurl()
 		CurlRequestOptions.bDontReuseConnections = true;
 	}
 
+	// HTTP/2 lets all requests to a host share one connection, so they don't each pay for connect and TLS setup
+#if LIBCURL_VERSION_NUM >= 0x072F00	// 7.47.0, first version with CURL_HTTP_VERSION_2TLS
+	{
+		curl_version_info_data * VersionInfo = curl_version_info(CURLVERSION_NOW);
+		bool bAllowHttp2 = true;
+		GConfig->GetBool(TEXT("HTTP"), TEXT("bAllowHttp2"), bAllowHttp2, GEngineIni);
+		CurlRequestOptions.bUseHttp2 = bAllowHttp2 && VersionInfo && (VersionInfo->features & CURL_VERSION_HTTP2) != 0 && !FParse::Param(FCommandLine::Get(), TEXT("nohttp2"));
+	}
+#endif
+
+	// same setting as used by the other HTTP backends
+	CurlRequestOptions.MaxHostConnections = 16;
+	GConfig->GetInt(TEXT("HTTP"), TEXT("HttpMaxConnectionsPerServer"), CurlRequestOptions.MaxHostConnections, GEngineIni);
+	GConfig->GetInt(TEXT("HTTP"), TEXT("HttpMaxConnections"), CurlRequestOptions.MaxTotalConnections, GEngineIni);
+	FParse::Value(FCommandLine::Get(), TEXT("httpmaxhostconn="), CurlRequestOptions.MaxHostConnections);
+	CurlRequestOptions.MaxHostConnections = FMath::Max(CurlRequestOptions.MaxHostConnections, 0);
+	CurlRequestOptions.MaxTotalConnections = FMath::Max(CurlRequestOptions.MaxTotalConnections, 0);
+
+	if (GMultiHandle != NULL)
+	{
+#if LIBCURL_VERSION_NUM >= 0x072F00	// 7.47.0
+		if (CurlRequestOptions.bUseHttp2)
+		{
+			curl_multi_setopt(GMultiHandle, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+		}
+#endif
+#if LIBCURL_VERSION_NUM >= 0x071E00	// 7.30.0
+		curl_multi_setopt(GMultiHandle, CURLMOPT_MAX_HOST_CONNECTIONS, static_cast<long>(CurlRequestOptions.MaxHostConnections));
+		curl_multi_setopt(GMultiHandle, CURLMOPT_MAX_TOTAL_CONNECTIONS, static_cast<long>(CurlRequestOptions.MaxTotalConnections));
+		if (CurlRequestOptions.MaxTotalConnections > 0)
+		{
+			// keep every allowed connection alive in the cache instead of closing and reopening them as requests churn
+			curl_multi_setopt(GMultiHandle, CURLMOPT_MAXCONNECTS, static_cast<long>(CurlRequestOptions.MaxTotalConnections));
+		}
+#endif
+	}
+
 	// discover cert location
 	if (PLATFORM_LINUX)	// only relevant to Linux (for now?), not #ifdef'ed to keep the code checked by the compiler when compiling for other platforms
 	{
@@ -531,6 +571,13 @@ void FCurlHttpManager::FCurlRequestOptions::Log()
 		bDontReuseConnections ? TEXT("NOT ") : TEXT("")
 		);
 
+	UE_LOG(LogInit, Log, TEXT(" - bUseHttp2 = %s  - Libcurl will %smultiplex requests over HTTP/2 connections"),
+		bUseHttp2 ? TEXT("true") : TEXT("false"),
+		bUseHttp2 ? TEXT("") : TEXT("NOT ")
+		);
+
+	UE_LOG(LogInit, Log, TEXT(" - MaxHostConnections = %d, MaxTotalConnections = %d  - 0 means no limit"), MaxHostConnections, MaxTotalConnections);
+
 	UE_LOG(LogInit, Log, TEXT(" - CertBundlePath = %s  - Libcurl will %s"),
 		(CertBundlePath != nullptr) ? *FString(CertBundlePath) : TEXT("nullptr"),
 		(CertBundlePath != nullptr) ? TEXT("set CURLOPT_CAINFO to it") : TEXT("use whatever was configured at build time.")
@@ -34,6 +34,9 @@ public:
 			:	bVerifyPeer(true)
 			,	bUseHttpProxy(false)
 			,	bDontReuseConnections(false)
+			,	bUseHttp2(false)
+			,	MaxHostConnections(0)
+			,	MaxTotalConnections(0)
 			,	CertBundlePath(nullptr)
 		{}
 
@@ -49,6 +52,15 @@ public:
 		/** Forbid reuse connections (for debugging purposes, since normally it's faster to reuse) */
 		bool bDontReuseConnections;
 
+		/** Whether or not requests negotiate HTTP/2 and share (multiplex) a single connection per host, only set if libcurl was built with HTTP/2 support */
+		bool bUseHttp2;
+
+		/** Maximum number of connections libcurl keeps open to a single host, further requests wait for one to free up (0 = no limit) */
+		int32 MaxHostConnections;
+
+		/** Maximum number of connections libcurl keeps open in total (0 = no limit) */
+		int32 MaxTotalConnections;
+
 		/** Address of the HTTP proxy */
 		FString HttpProxyAddress;
 
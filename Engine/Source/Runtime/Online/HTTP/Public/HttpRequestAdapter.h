@@ -36,6 +36,7 @@ public:
 	virtual float                         GetElapsedTime() override                                                { return HttpRequest->GetElapsedTime(); }
 	virtual EHttpRequestStatus::Type	  GetStatus() override { return HttpRequest->GetStatus(); }
 	virtual void Tick(float DeltaSeconds) override { HttpRequest->Tick(DeltaSeconds); }
+	virtual bool SetResponseBodyReceiveStreamDelegate(FHttpRequestStreamDelegate StreamDelegate) override { return HttpRequest->SetResponseBodyReceiveStreamDelegate(StreamDelegate); }
 
 protected:
     TSharedRef<IHttpRequest> HttpRequest;
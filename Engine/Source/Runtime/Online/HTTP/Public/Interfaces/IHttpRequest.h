@@ -78,6 +78,15 @@ DECLARE_DELEGATE_ThreeParams(FHttpRequestCompleteDelegate, FHttpRequestPtr, FHtt
  */
 DECLARE_DELEGATE_ThreeParams(FHttpRequestProgressDelegate, FHttpRequestPtr, int32, int32);
 
+/**
+ * Delegate called on the http thread with each part of the response body as it is received, see SetResponseBodyReceiveStreamDelegate
+ *
+ * @param first parameter - the received data, only valid for the duration of the call
+ * @param second parameter - the number of bytes received
+ * @return false to cancel the request
+ */
+DECLARE_DELEGATE_RetVal_TwoParams(bool, FHttpRequestStreamDelegate, const uint8*, int64);
+
 /**
  * Interface for Http requests (created using FHttpFactory)
  */
@@ -172,6 +181,20 @@ public:
 	 */
 	virtual FHttpRequestProgressDelegate& OnRequestProgress() = 0;
 
+	/**
+	 * Streams the response body to the delegate instead of buffering it in the response, so GetContent of the response stays empty.
+	 * The delegate is called on the http thread straight from the receive buffer, without copying the data.
+	 * The transfer doesn't continue until the delegate returns, so a delegate that takes its time (e.g. writing to disk) throttles the download.
+	 * Must be set before calling ProcessRequest.
+	 *
+	 * @param StreamDelegate - delegate to receive the response body, unbind it to go back to buffering.
+	 * @return false if this platform's implementation doesn't support streaming, in which case the body is buffered as usual.
+	 */
+	virtual bool SetResponseBodyReceiveStreamDelegate(FHttpRequestStreamDelegate StreamDelegate)
+	{
+		return false;
+	}
+
 	/**
 	 * Called to cancel a request that is still being processed
 	 */
@@ -6,6 +6,25 @@
 #include "HttpModule.h"
 #include "Modules/ModuleManager.h"
 #include "Styling/CoreStyle.h"
+#include "Async/Async.h"
+
+struct FWebImage::FPendingDecode
+{
+	/** The decoded image, set by the time the game thread is notified */
+	TFuture<FDecodedImagePtr> Result;
+
+	/** Request URL, used as the brush resource name */
+	FString RequestUrl;
+
+	/** Set on the game thread when the owner canceled the download or was destroyed */
+	bool bCanceled;
+
+	FPendingDecode(const FString& InRequestUrl)
+		: RequestUrl(InRequestUrl)
+		, bCanceled(false)
+	{
+	}
+};
 
 FWebImage::FWebImage()
 : StandInBrush(FCoreStyle::Get().GetDefaultBrush())
@@ -68,6 +87,15 @@ void FWebImage::HttpRequestComplete(FHttpRequestPtr HttpRequest, FHttpResponsePt
 	}
 	bool bSuccess = ProcessHttpResponse(HttpRequest->GetURL(), bSucceeded ? HttpResponse : FHttpResponsePtr());
 
+	// the decode reports back through DecodeComplete
+	if (!PendingDecode.IsValid())
+	{
+		FinishDownload(bSuccess);
+	}
+}
+
+void FWebImage::FinishDownload(bool bSuccess)
+{
 	// save this info
 	bDownloadSuccess = bSuccess;
 	DownloadTimeUtc = FDateTime::UtcNow();
@@ -119,32 +147,43 @@ bool FWebImage::ProcessHttpResponse(const FString& RequestUrl, FHttpResponsePtr
 		return false;
 	}
 
-	IImageWrapperPtr ImageWrapper = ImageWrapperModule.CreateImageWrapper(ImageFormat);
-	if (!ImageWrapper.IsValid())
+	// decode on the thread pool, large images would otherwise hitch the game thread
+	TSharedPtr<FPendingDecode, ESPMode::ThreadSafe> Decode = MakeShareable(new FPendingDecode(RequestUrl));
+	FWebImage* Owner = this;
+	Decode->Result = ImageWrapperModule.DecodeImageAsync(TArray<uint8>(Content), ERGBFormat::RGBA, 8, [Decode, Owner]()
 	{
-		UE_LOG(LogImageDownload, Error, TEXT("Image Download: Unable to make image wrapper for image format %d"), (int32)ImageFormat);
-		return false;
-	}
+		AsyncTask(ENamedThreads::GameThread, [Decode, Owner]()
+		{
+			// CancelDownload flags the decode before the owner goes away, so Owner is only touched while alive
+			if (!Decode->bCanceled)
+			{
+				Owner->DecodeComplete();
+			}
+		});
+	});
+	PendingDecode = Decode;
+	return true;
+}
 
-	// parse the content
-	if (!ImageWrapper->SetCompressed(Content.GetData(), Content.Num()))
-	{
-		UE_LOG(LogImageDownload, Error, TEXT("Image Download: Unable to parse image format %d from %s"), (int32)ImageFormat, *RequestUrl);
-		return false;
-	}
+void FWebImage::DecodeComplete()
+{
+	check(IsInGameThread());
+
+	TSharedPtr<FPendingDecode, ESPMode::ThreadSafe> Decode = PendingDecode;
+	PendingDecode.Reset();
 
-	// get the raw image data
-	const TArray<uint8>* RawImageData = nullptr;
-	if (!ImageWrapper->GetRaw(ERGBFormat::RGBA, 8, RawImageData) || RawImageData == nullptr)
+	FDecodedImagePtr DecodedImage = Decode->Result.Get();
+	if (!DecodedImage.IsValid())
 	{
-		UE_LOG(LogImageDownload, Error, TEXT("Image Download: Unable to convert image format %d to BGRA 8"), (int32)ImageFormat);
-		return false;
+		UE_LOG(LogImageDownload, Error, TEXT("Image Download: Unable to decode image from %s to RGBA 8"), *Decode->RequestUrl);
+		FinishDownload(false);
+		return;
 	}
 
 	// make a dynamic image
-	FName ResourceName(*RequestUrl);
-	DownloadedBrush = FSlateDynamicImageBrush::CreateWithImageData(ResourceName, FVector2D(ImageWrapper->GetWidth(), ImageWrapper->GetHeight()), *RawImageData);
-	return DownloadedBrush.IsValid();
+	FName ResourceName(*Decode->RequestUrl);
+	DownloadedBrush = FSlateDynamicImageBrush::CreateWithImageData(ResourceName, FVector2D(DecodedImage->Width, DecodedImage->Height), DecodedImage->RawData);
+	FinishDownload(DownloadedBrush.IsValid());
 }
 
 void FWebImage::CancelDownload()
@@ -158,6 +197,12 @@ void FWebImage::CancelDownload()
 		PendingRequest->CancelRequest();
 		PendingRequest.Reset();
 	}
+	if (PendingDecode.IsValid())
+	{
+		// the decode itself can't be interrupted, just make sure its result is dropped
+		PendingDecode->bCanceled = true;
+		PendingDecode.Reset();
+	}
 	if (PendingCallback.IsBound())
 	{
 		PendingCallback.Unbind();
@@ -77,8 +77,8 @@ public:
 	/** Only returns the downloaded brush. May be null if the download hasn't finished or was unsuccessful */
 	FORCEINLINE const FSlateBrush* GetDownloadedBrush() const { return DownloadedBrush.IsValid() ? DownloadedBrush.Get() : nullptr; }
 
-	/** Is there a pending HTTP request */
-	FORCEINLINE bool IsDownloadPending() const { return PendingRequest.IsValid(); }
+	/** Is there a pending HTTP request or is the downloaded image still being decoded */
+	FORCEINLINE bool IsDownloadPending() const { return PendingRequest.IsValid() || PendingDecode.IsValid(); }
 
 	/** Has the download finished AND was it successful */
 	FORCEINLINE bool DidDownloadSucceed() const { return bDownloadSuccess; }
@@ -96,6 +96,10 @@ private:
 	/** request complete callback */
 	void HttpRequestComplete(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, bool bSucceeded);
 	bool ProcessHttpResponse(const FString& RequestUrl, FHttpResponsePtr HttpResponse);
+	/** game thread callback once the image has been decoded */
+	void DecodeComplete();
+	/** stores the result and fires the response delegate */
+	void FinishDownload(bool bSuccess);
 
 private:
 	/** The Url being downloaded */
@@ -110,6 +114,10 @@ private:
 	/** Any pending request */
 	TSharedPtr<IHttpRequest> PendingRequest;
 
+	/** Image being decoded on the thread pool, shared with the task that reports completion on the game thread */
+	struct FPendingDecode;
+	TSharedPtr<FPendingDecode, ESPMode::ThreadSafe> PendingDecode;
+
 	/** Callback to call upon completion */
 	FOnImageDownloaded PendingCallback;
 
@@ -29,6 +29,8 @@ THIRD_PARTY_INCLUDES_END
 #define MAX_OPUS_UNCOMPRESSED_BUFFER_SIZE 48 * 1024
 /** 20ms frame sizes are a good choice for most applications (1000ms / 20ms = 50) */
 #define NUM_OPUS_FRAMES_PER_SEC 50
+/** Largest generation gap between two packets still counted as lost packets */
+#define MAX_OPUS_LOST_PACKETS_PER_GAP 32
 
 /**
  * Output debug information regarding the state of the Opus encoder
@@ -318,7 +320,9 @@ FVoiceDecoderOpus::FVoiceDecoderOpus() :
 	FrameSize(0),
 	Decoder(NULL),
 	LastEntropyIdx(0),
-	LastGeneration(0)
+	LastGeneration(0),
+	bHasLastGeneration(false),
+	NumLostPackets(0)
 {
 	FMemory::Memzero(Entropy, NUM_ENTROPY_VALUES * sizeof(uint32));
 }
@@ -378,9 +382,17 @@ void FVoiceDecoderOpus::Decode(const uint8* InCompressedData, uint32 CompressedD
 	int32 PacketGeneration = InCompressedData[1];
 	HeaderSize += 2 * sizeof(uint8);
 
-	if (PacketGeneration != LastGeneration + 1)
+	// The encoder wraps the generation at MAX_uint8
+	const int32 ExpectedGeneration = (LastGeneration + 1) % MAX_uint8;
+	if (PacketGeneration != ExpectedGeneration)
 	{
 		UE_LOG(LogVoiceDecode, Verbose, TEXT("Packet generation skipped from %d to %d"), LastGeneration, PacketGeneration);
+		// Large jumps are more likely the remote encoder restarting or a late packet than that many lost packets
+		const int32 NumSkipped = (PacketGeneration - ExpectedGeneration + MAX_uint8) % MAX_uint8;
+		if (bHasLastGeneration && NumSkipped <= MAX_OPUS_LOST_PACKETS_PER_GAP)
+		{
+			NumLostPackets += NumSkipped;
+		}
 	}
 
 	if (NumFramesToDecode > 0 && NumFramesToDecode <= MaxFramesEncoded)
@@ -468,6 +480,7 @@ void FVoiceDecoderOpus::Decode(const uint8* InCompressedData, uint32 CompressedD
 
 	UE_LOG(LogVoiceDecode, VeryVerbose, TEXT("OpusDecode[%d]: RawSize: %d CompressedSize: %d NumFramesEncoded: %d "), PacketGeneration, OutRawDataSize, CompressedDataSize, NumFramesToDecode);
 	LastGeneration = PacketGeneration;
+	bHasLastGeneration = true;
 }
 
 #endif // PLATFORM_SUPPORTS_VOICE_CAPTURE
@@ -64,6 +64,7 @@ public:
 	//IVoiceDecoder
 	virtual bool Init(int32 SampleRate, int32 NumChannels) override;
 	virtual void Decode(const uint8* CompressedData, uint32 CompressedDataSize, uint8* OutRawPCMData, uint32& OutRawDataSize) override;
+	virtual uint32 GetNumLostPackets() const override { return NumLostPackets; }
 	virtual void Destroy() override;
 
 private:
@@ -85,6 +86,10 @@ private:
 	uint32 LastEntropyIdx;
 	/** Generation value received from the last incoming packet */
 	uint8 LastGeneration;
+	/** Whether LastGeneration was received yet */
+	bool bHasLastGeneration;
+	/** Number of generations skipped between incoming packets */
+	uint32 NumLostPackets;
 };
 
 #endif // PLATFORM_SUPPORTS_VOICE_CAPTURE
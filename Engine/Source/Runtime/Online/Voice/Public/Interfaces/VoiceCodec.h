@@ -86,6 +86,14 @@ public:
 	 */
 	virtual void Decode(const uint8* CompressedData, uint32 CompressedDataSize, uint8* OutRawPCMData, uint32& OutRawDataSize) = 0;
 
+	/**
+	 * @return number of packets found missing from the decoded stream since the decoder was initialized (0 if the codec can't tell)
+	 */
+	virtual uint32 GetNumLostPackets() const
+	{
+		return 0;
+	}
+
 	/**
 	 * Cleanup the decoder
 	 */
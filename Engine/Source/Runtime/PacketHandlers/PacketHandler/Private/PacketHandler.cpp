@@ -2,18 +2,32 @@
 
 #include "PacketHandler.h"
 #include "Misc/ConfigCacheIni.h"
+#include "HAL/PlatformProcess.h"
 #include "Modules/ModuleManager.h"
 #include "UObject/ObjectMacros.h"
 #include "UObject/Package.h"
 
 #include "HandlerComponentFactory.h"
 #include "ReliabilityHandlerComponent.h"
+#include "PacketHandlerThread.h"
 
 // @todo #JohnB: There is quite a lot of inefficient copying of packet data going on.
 //					Redo the whole packet parsing/modification pipeline.
 
 
-IMPLEMENT_MODULE(FPacketHandlerComponentModuleInterface, PacketHandler);
+/**
+ * PacketHandler module, stops the packet handler thread on shutdown
+ */
+class FPacketHandlerModule : public FPacketHandlerComponentModuleInterface
+{
+public:
+	virtual void ShutdownModule() override
+	{
+		FPacketHandlerThread::Shutdown();
+	}
+};
+
+IMPLEMENT_MODULE(FPacketHandlerModule, PacketHandler);
 
 DEFINE_LOG_CATEGORY(PacketHandlerLog);
 
@@ -40,11 +54,27 @@ PacketHandler::PacketHandler()
 	, QueuedConnectionlessPackets()
 	, ReliabilityComponent(nullptr)
 	, bRawSend(false)
+	, bThreadedProcessing(false)
+	, bThreaded(false)
+	, ThreadedState()
+	, ThreadedSendFunction()
 {
 	OutgoingPacket.SetAllowResize(true);
 	OutgoingPacket.AllowAppend(true);
 }
 
+PacketHandler::~PacketHandler()
+{
+	if (ThreadedState.IsValid())
+	{
+		// Let the thread finish the queued packets (outgoing packets are still sent), then make it skip anything else
+		FlushThreaded();
+
+		ThreadedState->bHandlerDestroyed = true;
+		ThreadedState.Reset();
+	}
+}
+
 void PacketHandler::Tick(float DeltaTime)
 {
 	Time += DeltaTime;
@@ -73,6 +103,8 @@ void PacketHandler::Initialize(Handler::Mode InMode, uint32 InMaxPacketBits, boo
 		{
 			AddHandler(CurComponent, true);
 		}
+
+		GConfig->GetBool(TEXT("PacketHandlerComponents"), TEXT("bThreadedProcessing"), bThreadedProcessing, GEngineIni);
 	}
 }
 
@@ -536,6 +568,83 @@ void PacketHandler::HandlerInitialized()
 	BufferedConnectionlessPackets.Empty();
 
 	SetState(Handler::State::Initialized);
+
+	UpdateThreaded();
+}
+
+void PacketHandler::UpdateThreaded()
+{
+	if (bThreaded || !bThreadedProcessing || State != Handler::State::Initialized || !ThreadedSendFunction ||
+		!FPlatformProcess::SupportsMultithreading())
+	{
+		return;
+	}
+
+	for (int32 i=0; i<HandlerComponents.Num(); ++i)
+	{
+		const HandlerComponent& CurComponent = *HandlerComponents[i];
+
+		if (CurComponent.IsActive() && !CurComponent.SupportsThreadedProcessing())
+		{
+			return;
+		}
+	}
+
+	ThreadedState = MakeShareable(new FThreadedPacketHandlerState(this));
+	bThreaded = true;
+}
+
+void PacketHandler::SetThreadedSendFunction(TFunction<void(const uint8* Data, int32 CountBits)> InSendFunction)
+{
+	// Can't be swapped while the thread may be calling it
+	check(!bThreaded);
+
+	ThreadedSendFunction = MoveTemp(InSendFunction);
+
+	UpdateThreaded();
+}
+
+void PacketHandler::QueueIncoming(const uint8* Packet, int32 CountBytes)
+{
+	check(bThreaded);
+
+	FPacketHandlerThread::Get().QueueWork(new FThreadedPacketWork(ThreadedState.ToSharedRef(), Packet, CountBytes * 8, true));
+}
+
+void PacketHandler::QueueOutgoing(const uint8* Packet, int32 CountBits)
+{
+	check(bThreaded);
+
+	FPacketHandlerThread::Get().QueueWork(new FThreadedPacketWork(ThreadedState.ToSharedRef(), Packet, CountBits, false));
+}
+
+bool PacketHandler::GetThreadedIncomingPacket(TArray<uint8>& OutData, int32& OutCountBits, bool& bOutError)
+{
+	FThreadedPacket* Packet = nullptr;
+
+	if (ThreadedState.IsValid() && ThreadedState->ProcessedIncoming.Dequeue(Packet))
+	{
+		OutData = MoveTemp(Packet->Data);
+		OutCountBits = Packet->CountBits;
+		bOutError = Packet->bError;
+
+		delete Packet;
+
+		return true;
+	}
+
+	return false;
+}
+
+void PacketHandler::FlushThreaded()
+{
+	if (ThreadedState.IsValid())
+	{
+		while (ThreadedState->NumPendingWork.GetValue() > 0)
+		{
+			FPlatformProcess::Sleep(0.f);
+		}
+	}
 }
 
 void PacketHandler::HandlerComponentInitialized()
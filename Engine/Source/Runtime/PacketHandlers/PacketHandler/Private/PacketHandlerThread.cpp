@@ -0,0 +1,130 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "PacketHandlerThread.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+
+#include "PacketHandler.h"
+
+
+/**
+ * FPacketHandlerThread
+ */
+
+FPacketHandlerThread* FPacketHandlerThread::Instance = nullptr;
+
+FPacketHandlerThread::FPacketHandlerThread()
+	: WorkQueue()
+	, WorkEvent(FPlatformProcess::GetSynchEventFromPool(false))
+	, bStopping(false)
+	, Thread(nullptr)
+{
+}
+
+FPacketHandlerThread::~FPacketHandlerThread()
+{
+	FPlatformProcess::ReturnSynchEventToPool(WorkEvent);
+	WorkEvent = nullptr;
+}
+
+FPacketHandlerThread& FPacketHandlerThread::Get()
+{
+	check(IsInGameThread());
+
+	if (Instance == nullptr)
+	{
+		Instance = new FPacketHandlerThread();
+		Instance->Thread = FRunnableThread::Create(Instance, TEXT("PacketHandlerThread"), 0, TPri_AboveNormal);
+
+		UE_LOG(PacketHandlerLog, Log, TEXT("Started the packet handler thread."));
+	}
+
+	return *Instance;
+}
+
+void FPacketHandlerThread::Shutdown()
+{
+	if (Instance != nullptr)
+	{
+		Instance->Stop();
+
+		if (Instance->Thread != nullptr)
+		{
+			Instance->Thread->WaitForCompletion();
+
+			delete Instance->Thread;
+			Instance->Thread = nullptr;
+		}
+
+		delete Instance;
+		Instance = nullptr;
+	}
+}
+
+void FPacketHandlerThread::QueueWork(FThreadedPacketWork* Work)
+{
+	check(Work != nullptr);
+
+	Work->State->NumPendingWork.Increment();
+	WorkQueue.Enqueue(Work);
+	WorkEvent->Trigger();
+}
+
+uint32 FPacketHandlerThread::Run()
+{
+	while (true)
+	{
+		FThreadedPacketWork* Work = nullptr;
+
+		while (WorkQueue.Dequeue(Work))
+		{
+			ProcessWork(*Work);
+			delete Work;
+		}
+
+		if (bStopping)
+		{
+			break;
+		}
+
+		WorkEvent->Wait();
+	}
+
+	return 0;
+}
+
+void FPacketHandlerThread::Stop()
+{
+	bStopping = true;
+	WorkEvent->Trigger();
+}
+
+void FPacketHandlerThread::ProcessWork(FThreadedPacketWork& Work)
+{
+	FThreadedPacketHandlerState& State = *Work.State;
+
+	// The handler waits for its pending work before it's destroyed, so it's safe to use until the count is decremented
+	if (!State.bHandlerDestroyed)
+	{
+		PacketHandler& Handler = *State.Handler;
+
+		if (Work.bIncoming)
+		{
+			const ProcessedPacket Processed = Handler.Incoming_Internal(Work.Packet.Data.GetData(), Work.Packet.Data.Num());
+
+			State.ProcessedIncoming.Enqueue(new FThreadedPacket(Processed.Data, Processed.CountBits, Processed.bError));
+		}
+		else
+		{
+			const ProcessedPacket Processed = Handler.Outgoing_Internal(Work.Packet.Data.GetData(), Work.Packet.CountBits);
+
+			if (!Processed.bError && Processed.CountBits > 0)
+			{
+				Handler.ThreadedSendFunction(Processed.Data, Processed.CountBits);
+			}
+		}
+	}
+
+	State.NumPendingWork.Decrement();
+}
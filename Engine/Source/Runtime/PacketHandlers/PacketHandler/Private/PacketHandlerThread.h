@@ -0,0 +1,167 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "HAL/ThreadSafeBool.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Containers/Queue.h"
+
+class PacketHandler;
+class FRunnableThread;
+class FEvent;
+
+
+/**
+ * A packet handed between the game thread and the packet handler thread
+ */
+struct FThreadedPacket
+{
+	/** The packet data */
+	TArray<uint8> Data;
+
+	/** Size of the packet data in bits */
+	int32 CountBits;
+
+	/** Whether or not the handler components failed processing the packet */
+	bool bError;
+
+public:
+	FThreadedPacket(const uint8* InData, int32 InCountBits, bool bInError=false)
+		: CountBits(InCountBits)
+		, bError(bInError)
+	{
+		Data.AddUninitialized(FMath::DivideAndRoundUp(InCountBits, 8));
+
+		if (Data.Num() > 0)
+		{
+			FMemory::Memcpy(Data.GetData(), InData, Data.Num());
+		}
+	}
+};
+
+/**
+ * State shared between a threaded PacketHandler and the packet handler thread.
+ * Referenced by every queued work item, so it outlives the PacketHandler until the thread let go of it.
+ */
+class FThreadedPacketHandlerState
+{
+public:
+	FThreadedPacketHandlerState(PacketHandler* InHandler)
+		: Handler(InHandler)
+		, NumPendingWork()
+		, bHandlerDestroyed(false)
+		, ProcessedIncoming()
+	{
+	}
+
+	~FThreadedPacketHandlerState()
+	{
+		FThreadedPacket* Packet = nullptr;
+
+		while (ProcessedIncoming.Dequeue(Packet))
+		{
+			delete Packet;
+		}
+	}
+
+	/** The handler the work is processed by, only dereferenced while bHandlerDestroyed is false */
+	PacketHandler* Handler;
+
+	/** Number of work items queued for the handler, that the thread didn't finish yet */
+	FThreadSafeCounter NumPendingWork;
+
+	/** Set once the handler is being destroyed, so the thread skips its remaining work */
+	FThreadSafeBool bHandlerDestroyed;
+
+	/** Incoming packets processed by the thread, waiting for the game thread */
+	TQueue<FThreadedPacket*, EQueueMode::Spsc> ProcessedIncoming;
+};
+
+/**
+ * Work item for the packet handler thread
+ */
+struct FThreadedPacketWork
+{
+	/** The state of the handler the packet belongs to */
+	TSharedRef<FThreadedPacketHandlerState, ESPMode::ThreadSafe> State;
+
+	/** The packet to process, in bytes for incoming packets and in bits for outgoing packets */
+	FThreadedPacket Packet;
+
+	/** Whether the packet is incoming or outgoing */
+	bool bIncoming;
+
+public:
+	FThreadedPacketWork(const TSharedRef<FThreadedPacketHandlerState, ESPMode::ThreadSafe>& InState, const uint8* InData, int32 InCountBits,
+						bool bInIncoming)
+		: State(InState)
+		, Packet(InData, InCountBits)
+		, bIncoming(bInIncoming)
+	{
+	}
+};
+
+/**
+ * Single thread running the HandlerComponent's of threaded PacketHandler's.
+ *
+ * Work is handed over through a lock-free queue, and processed in order, so the packets of each handler keep their order.
+ */
+class FPacketHandlerThread : public FRunnable
+{
+public:
+	/**
+	 * Gets the packet handler thread, starting it if necessary
+	 */
+	static FPacketHandlerThread& Get();
+
+	/**
+	 * Stops the packet handler thread, if it was started, after it finished all queued work
+	 */
+	static void Shutdown();
+
+	/**
+	 * Queues work for the thread, can be called from any thread
+	 *
+	 * @param Work	The work to queue, deleted by the thread once processed
+	 */
+	void QueueWork(FThreadedPacketWork* Work);
+
+
+	// FRunnable interface
+
+	virtual uint32 Run() override;
+
+	virtual void Stop() override;
+
+
+private:
+	FPacketHandlerThread();
+
+	virtual ~FPacketHandlerThread();
+
+	/**
+	 * Processes a single work item
+	 *
+	 * @param Work	The work to process
+	 */
+	void ProcessWork(FThreadedPacketWork& Work);
+
+
+private:
+	/** The singleton instance, if started */
+	static FPacketHandlerThread* Instance;
+
+	/** Work queued by the game thread */
+	TQueue<FThreadedPacketWork*, EQueueMode::Mpsc> WorkQueue;
+
+	/** Triggered when work is queued */
+	FEvent* WorkEvent;
+
+	/** Set when the thread should exit, once the queue is empty */
+	FThreadSafeBool bStopping;
+
+	/** The thread running this runnable */
+	FRunnableThread* Thread;
+};
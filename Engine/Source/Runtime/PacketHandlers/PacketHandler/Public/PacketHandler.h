@@ -7,9 +7,12 @@
 #include "Serialization/BitWriter.h"
 #include "Modules/ModuleInterface.h"
 #include "Containers/Queue.h"
+#include "Templates/Function.h"
 
 class HandlerComponent;
 class ReliabilityHandlerComponent;
+class FThreadedPacketHandlerState;
+class FPacketHandlerThread;
 
 DECLARE_LOG_CATEGORY_EXTERN(PacketHandlerLog, Log, All);
 
@@ -159,6 +162,8 @@ public:
  */
 class PACKETHANDLER_API PacketHandler
 {
+	friend class FPacketHandlerThread;
+
 public:
 	/**
 	 * Base constructor
@@ -168,9 +173,7 @@ public:
 	/**
 	 * Base Destructor
 	 */
-	virtual ~PacketHandler()
-	{
-	};
+	virtual ~PacketHandler();
 
 	/**
 	 * Handles initialization of manager
@@ -294,6 +297,58 @@ public:
 	}
 
 
+	/**
+	 * Whether or not packets are processed on the packet handler thread, in which case QueueIncoming/QueueOutgoing replace
+	 * Incoming/Outgoing. Enabled through bThreadedProcessing in [PacketHandlerComponents], once the handler is initialized
+	 * and a threaded send function is set, if every HandlerComponent supports threaded processing. Stays enabled from then on.
+	 *
+	 * @return	Whether or not packets are processed on the packet handler thread
+	 */
+	FORCEINLINE bool IsThreaded() const
+	{
+		return bThreaded && !bRawSend;
+	}
+
+	/**
+	 * Sets the function sending the packets processed by QueueOutgoing. It's called on the packet handler thread,
+	 * so it may only touch state that stays valid until FlushThreaded returns.
+	 *
+	 * @param InSendFunction	Sends the final packet data, and its size in bits
+	 */
+	void SetThreadedSendFunction(TFunction<void(const uint8* Data, int32 CountBits)> InSendFunction);
+
+	/**
+	 * Hands an incoming packet to the packet handler thread, processed packets are retrieved with GetThreadedIncomingPacket
+	 *
+	 * @param Packet		The packet data to be processed, copied before returning
+	 * @param CountBytes	The size of the packet data in bytes
+	 */
+	void QueueIncoming(const uint8* Packet, int32 CountBytes);
+
+	/**
+	 * Hands an outgoing packet to the packet handler thread, which sends it through the threaded send function
+	 *
+	 * @param Packet		The packet data to be processed, copied before returning
+	 * @param CountBits		The size of the packet data in bits
+	 */
+	void QueueOutgoing(const uint8* Packet, int32 CountBits);
+
+	/**
+	 * Gets the next incoming packet the packet handler thread finished processing, in the order they were queued
+	 *
+	 * @param OutData		Receives the final packet data
+	 * @param OutCountBits	Receives the size of the final packet data in bits, zero if the packet was consumed by the handler
+	 * @param bOutError		Receives whether or not there was an error processing the packet
+	 * @return				Whether or not a packet was retrieved
+	 */
+	bool GetThreadedIncomingPacket(TArray<uint8>& OutData, int32& OutCountBits, bool& bOutError);
+
+	/**
+	 * Blocks until the packet handler thread processed all packets queued by this handler
+	 */
+	void FlushThreaded();
+
+
 protected:
 	/**
 	 * Internal handling for Incoming/IncomingConnectionless
@@ -395,6 +450,11 @@ private:
 	 */
 	void HandlerInitialized();
 
+	/**
+	 * Enables threaded processing, if it's now possible (see IsThreaded)
+	 */
+	void UpdateThreaded();
+
 	/**
 	 * Replaces IncomingPacket with all unread data from ReplacementPacket
 	 *
@@ -456,6 +516,18 @@ private:
 
 	/** Whether or not outgoing packets bypass the handler */
 	bool bRawSend;
+
+	/** Whether or not threaded processing was enabled in the .ini */
+	bool bThreadedProcessing;
+
+	/** Whether or not packets are processed on the packet handler thread */
+	bool bThreaded;
+
+	/** State shared with the packet handler thread, while threaded */
+	TSharedPtr<FThreadedPacketHandlerState, ESPMode::ThreadSafe> ThreadedState;
+
+	/** Sends packets processed by the packet handler thread, called on that thread */
+	TFunction<void(const uint8* Data, int32 CountBits)> ThreadedSendFunction;
 };
 
 /**
@@ -541,6 +613,17 @@ public:
 		return false;
 	}
 
+	/**
+	 * Whether or not Incoming/Outgoing can currently run on the packet handler thread, while the game thread keeps ticking the component.
+	 * Only checked once the PacketHandler is initialized, components returning true must not touch game thread state from Incoming/Outgoing.
+	 *
+	 * @return	Whether or not the above is supported
+	 */
+	virtual bool SupportsThreadedProcessing() const
+	{
+		return false;
+	}
+
 
 	/**
 	 * Initialization functionality should be placed here
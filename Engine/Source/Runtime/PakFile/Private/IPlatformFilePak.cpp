@@ -17,6 +17,7 @@
 #include "Misc/AES.h"
 #include "GenericPlatform/GenericPlatformChunkInstall.h"
 #include "Async/AsyncFileHandle.h"
+#include "Async/MappedFileHandle.h"
 #include "Templates/Greater.h"
 #include "Serialization/ArchiveProxy.h"
 
@@ -36,6 +37,82 @@ TPakChunkHash ComputePakChunkHash(const void* InData, int64 InDataSizeInBytes)
 #endif
 }
 
+uint64 ComputePakPathHash(const TCHAR* RelativePath, uint64 Seed)
+{
+	// 64 bit FNV-1a of the lower case path, seeded by mixing the seed into the offset basis
+	uint64 Hash = 0xcbf29ce484222325ull ^ (Seed * 0x9e3779b97f4a7c15ull);
+	for (; *RelativePath; ++RelativePath)
+	{
+		Hash ^= (uint64)(uint32)FChar::ToLower(*RelativePath);
+		Hash *= 0x100000001b3ull;
+	}
+	return Hash ? Hash : 1;
+}
+
+bool FPakPathHashIndex::Build(const TArray<FString>& RelativePaths)
+{
+	// enough seeds that colliding with all of them means the same path was added twice
+	static const uint64 MaxSeeds = 16;
+
+	const int32 NumSlots = FMath::RoundUpToPowerOfTwo(FMath::Max(RelativePaths.Num() * 2, 1));
+	for (Seed = 0; Seed < MaxSeeds; ++Seed)
+	{
+		PathHashes.Reset(RelativePaths.Num());
+		Slots.Init(INDEX_NONE, NumSlots);
+
+		bool bCollided = false;
+		const uint32 SlotMask = NumSlots - 1;
+		for (int32 EntryIndex = 0; EntryIndex < RelativePaths.Num() && !bCollided; ++EntryIndex)
+		{
+			const uint64 PathHash = ComputePakPathHash(*RelativePaths[EntryIndex], Seed);
+			PathHashes.Add(PathHash);
+
+			uint32 SlotIndex = uint32(PathHash) & SlotMask;
+			while (Slots[SlotIndex] != INDEX_NONE)
+			{
+				if (PathHashes[Slots[SlotIndex]] == PathHash)
+				{
+					bCollided = true;
+					break;
+				}
+				SlotIndex = (SlotIndex + 1) & SlotMask;
+			}
+			Slots[SlotIndex] = EntryIndex;
+		}
+
+		if (!bCollided)
+		{
+			return true;
+		}
+	}
+
+	PathHashes.Empty();
+	Slots.Empty();
+	return false;
+}
+
+FArchive& operator<<(FArchive& Ar, FPakPathHashIndex& Index)
+{
+	Ar << Index.Seed;
+	Index.PathHashes.BulkSerialize(Ar);
+	Index.Slots.BulkSerialize(Ar);
+
+	if (Ar.IsLoading() && Index.Slots.Num())
+	{
+		// lookups rely on the table being a power of two with empty slots left, and on every slot pointing at an entry
+		bool bValid = FMath::IsPowerOfTwo(Index.Slots.Num()) && Index.Slots.Num() > Index.PathHashes.Num();
+		for (int32 SlotIndex = 0; bValid && SlotIndex < Index.Slots.Num(); ++SlotIndex)
+		{
+			bValid = Index.Slots[SlotIndex] >= INDEX_NONE && Index.Slots[SlotIndex] < Index.PathHashes.Num();
+		}
+		if (!bValid)
+		{
+			Ar.SetError();
+		}
+	}
+	return Ar;
+}
+
 #ifndef EXCLUDE_NONPAK_UE_EXTENSIONS
 #define EXCLUDE_NONPAK_UE_EXTENSIONS 1	// Use .Build.cs file to disable this if the game relies on accessing loose files
 #endif
@@ -2945,6 +3022,10 @@ public:
 			BytesToRead = UncompressedFileSize - Offset;
 		}
 		check(Offset + BytesToRead <= UncompressedFileSize && Offset >= 0);
+		if (FPakReadOrderRecorder::IsEnabled())
+		{
+			FPakReadOrderRecorder::RecordRead(PakFile, FileEntry->Offset, Offset, BytesToRead);
+		}
 		if (FileEntry->CompressionMethod == COMPRESS_None)
 		{
 			check(Offset + BytesToRead + OffsetInPak <= PakFileSize);
@@ -3283,6 +3364,59 @@ IAsyncReadFileHandle* FPakPlatformFile::OpenAsyncRead(const TCHAR* Filename)
 	return IPlatformFile::OpenAsyncRead(Filename);
 }
 
+/**
+ * Mapping of a single uncompressed, unencrypted pak entry. Regions are mapped from the mapping of the whole pak.
+ */
+class FPakMappedFileHandle final : public IMappedFileHandle
+{
+	IMappedFileHandle* PakMappedFileHandle;
+	int64 OffsetInPak;
+
+public:
+	FPakMappedFileHandle(IMappedFileHandle* InPakMappedFileHandle, int64 InOffsetInPak, int64 InFileSize)
+		: IMappedFileHandle(InFileSize)
+		, PakMappedFileHandle(InPakMappedFileHandle)
+		, OffsetInPak(InOffsetInPak)
+	{
+	}
+
+	virtual IMappedFileRegion* MapRegion(int64 Offset, int64 BytesToMap, bool bPreloadHint) override
+	{
+		check(Offset >= 0 && Offset <= GetFileSize());
+		BytesToMap = FMath::Min<int64>(BytesToMap, GetFileSize() - Offset);
+		if (BytesToMap <= 0)
+		{
+			return nullptr;
+		}
+		return PakMappedFileHandle->MapRegion(OffsetInPak + Offset, BytesToMap, bPreloadHint);
+	}
+};
+
+IMappedFileHandle* FPakPlatformFile::OpenMapped(const TCHAR* Filename)
+{
+	FPakFile* PakFile = NULL;
+	const FPakEntry* FileEntry = FindFileInPakFiles(Filename, &PakFile);
+	if (FileEntry && PakFile)
+	{
+		if (FileEntry->CompressionMethod != COMPRESS_None || FileEntry->bEncrypted)
+		{
+			return nullptr;
+		}
+		IMappedFileHandle* PakMappedFileHandle = PakFile->GetMappedFileHandle(LowerLevel);
+		if (!PakMappedFileHandle)
+		{
+			return nullptr;
+		}
+		const int64 OffsetInPak = FileEntry->Offset + FileEntry->GetSerializedSize(PakFile->GetInfo().Version);
+		return new FPakMappedFileHandle(PakMappedFileHandle, OffsetInPak, FileEntry->Size);
+	}
+	if (IsNonPakFilenameAllowed(Filename))
+	{
+		return LowerLevel->OpenMapped(Filename);
+	}
+	return nullptr;
+}
+
 /**
  * Class to handle correctly reading from a compressed file within a compressed package
  */
@@ -3306,6 +3440,20 @@ public:
 	}
 };
 
+int32 GPakParallelDecompressionDepth = 8;
+static FAutoConsoleVariableRef CVar_ParallelDecompressionDepth(
+	TEXT("pak.ParallelDecompressionDepth"),
+	GPakParallelDecompressionDepth,
+	TEXT("Controls how many compressed blocks a large synchronous pak read keeps decompressing on worker threads while it reads ahead. Clamped between 2 and 16, uses pak.ParallelDecompressionDepth * (block size + compressed block size) of scratch memory per reading thread.")
+	);
+
+int32 GPakParallelDecompressionMinBlocks = 8;
+static FAutoConsoleVariableRef CVar_ParallelDecompressionMinBlocks(
+	TEXT("pak.ParallelDecompressionMinBlocks"),
+	GPakParallelDecompressionMinBlocks,
+	TEXT("Synchronous pak reads spanning at least this many compressed blocks use pak.ParallelDecompressionDepth, smaller reads decompress at most 2 blocks at a time.")
+	);
+
 /**
  * Thread local class to manage working buffers for file compression
  */
@@ -3390,6 +3538,9 @@ public:
 	/** Pak file archive to read the data from. */
 	FArchive*			PakReader;
 
+	/** Most blocks a single read can have in flight, pak.ParallelDecompressionDepth is clamped to it. */
+	static const int32 MaxDecompressionSlots = 16;
+
 	FORCEINLINE int64 FileSize() const
 	{
 		return PakEntry.UncompressedSize;
@@ -3399,20 +3550,32 @@ public:
 	{
 		const int32 CompressionBlockSize = PakEntry.CompressionBlockSize;
 		uint32 CompressionBlockIndex = DesiredPosition / CompressionBlockSize;
-		uint8* WorkingBuffers[2];
 		int64 DirectCopyStart = DesiredPosition % PakEntry.CompressionBlockSize;
-		FAsyncTask<FPakUncompressTask> UncompressTask;
 		FCompressionScratchBuffers& ScratchSpace = FCompressionScratchBuffers::Get();
-		bool bStartedUncompress = false;
+
+		// the pak reader can only be used from this thread, so blocks are read one after another while up to NumSlots
+		// of them decompress on worker threads. Every block decompresses straight into its own place in the output,
+		// so they can finish in any order.
+		const int64 NumBlocksToRead = (DirectCopyStart + Length + CompressionBlockSize - 1) / CompressionBlockSize;
+		const int32 NumSlots = NumBlocksToRead >= GPakParallelDecompressionMinBlocks ? FMath::Clamp(GPakParallelDecompressionDepth, 2, (int32)MaxDecompressionSlots) : 2;
+		FAsyncTask<FPakUncompressTask> UncompressTasks[MaxDecompressionSlots];
+		bool bStartedUncompress[MaxDecompressionSlots] = { false };
 
 		int64 WorkingBufferRequiredSize = FCompression::CompressMemoryBound((ECompressionFlags)PakEntry.CompressionMethod,CompressionBlockSize, FPlatformMisc::GetPlatformCompression()->GetCompressionBitWindow());
 		WorkingBufferRequiredSize = EncryptionPolicy::AlignReadRequest(WorkingBufferRequiredSize);
-		ScratchSpace.EnsureBufferSpace(CompressionBlockSize, WorkingBufferRequiredSize*2);
-		WorkingBuffers[0] = ScratchSpace.ScratchBuffer.Get();
-		WorkingBuffers[1] = ScratchSpace.ScratchBuffer.Get() + WorkingBufferRequiredSize;
+		ScratchSpace.EnsureBufferSpace(CompressionBlockSize*NumSlots, WorkingBufferRequiredSize*NumSlots);
 
 		while (Length > 0)
 		{
+			const int32 Slot = CompressionBlockIndex % NumSlots;
+			uint8* WorkingBuffer = ScratchSpace.ScratchBuffer.Get() + WorkingBufferRequiredSize*Slot;
+			if (bStartedUncompress[Slot])
+			{
+				// wait for the block that last used this slot before reading over its compressed data
+				UncompressTasks[Slot].EnsureCompletion();
+				bStartedUncompress[Slot] = false;
+			}
+
 			const FPakCompressedBlock& Block = PakEntry.CompressionBlocks[CompressionBlockIndex];
 			int64 Pos = CompressionBlockIndex * CompressionBlockSize;
 			int64 CompressedBlockSize = Block.CompressedEnd-Block.CompressedStart;
@@ -3420,21 +3583,16 @@ public:
 			int64 ReadSize = EncryptionPolicy::AlignReadRequest(CompressedBlockSize);
 			int64 WriteSize = FMath::Min<int64>(UncompressedBlockSize - DirectCopyStart, Length);
 			PakReader->Seek(Block.CompressedStart);
-			PakReader->Serialize(WorkingBuffers[CompressionBlockIndex & 1],ReadSize);
-			if (bStartedUncompress)
-			{
-				UncompressTask.EnsureCompletion();
-				bStartedUncompress = false;
-			}
+			PakReader->Serialize(WorkingBuffer,ReadSize);
 
-			FPakUncompressTask& TaskDetails = UncompressTask.GetTask();
+			FPakUncompressTask& TaskDetails = UncompressTasks[Slot].GetTask();
 			if (DirectCopyStart == 0 && Length >= CompressionBlockSize)
 			{
 				// Block can be decompressed directly into output buffer
 				TaskDetails.Flags = (ECompressionFlags)PakEntry.CompressionMethod;
 				TaskDetails.UncompressedBuffer = (uint8*)V;
 				TaskDetails.UncompressedSize = UncompressedBlockSize;
-				TaskDetails.CompressedBuffer = WorkingBuffers[CompressionBlockIndex & 1];
+				TaskDetails.CompressedBuffer = WorkingBuffer;
 				TaskDetails.CompressedSize = CompressedBlockSize;
 				TaskDetails.CopyOut = nullptr;
 			}
@@ -3442,9 +3600,9 @@ public:
 			{
 				// Block needs to be copied from a working buffer
 				TaskDetails.Flags = (ECompressionFlags)PakEntry.CompressionMethod;
-				TaskDetails.UncompressedBuffer = ScratchSpace.TempBuffer.Get();
+				TaskDetails.UncompressedBuffer = ScratchSpace.TempBuffer.Get() + CompressionBlockSize*Slot;
 				TaskDetails.UncompressedSize = UncompressedBlockSize;
-				TaskDetails.CompressedBuffer = WorkingBuffers[CompressionBlockIndex & 1];
+				TaskDetails.CompressedBuffer = WorkingBuffer;
 				TaskDetails.CompressedSize = CompressedBlockSize;
 				TaskDetails.CopyOut = V;
 				TaskDetails.CopyOffset = DirectCopyStart;
@@ -3453,22 +3611,25 @@ public:
 			
 			if (Length == WriteSize)
 			{
-				UncompressTask.StartSynchronousTask();
+				UncompressTasks[Slot].StartSynchronousTask();
 			}
 			else
 			{
-				UncompressTask.StartBackgroundTask();
+				UncompressTasks[Slot].StartBackgroundTask();
 			}
-			bStartedUncompress = true;
+			bStartedUncompress[Slot] = true;
 			V = (void*)((uint8*)V + WriteSize);
 			Length -= WriteSize;
 			DirectCopyStart = 0;
 			++CompressionBlockIndex;
 		}
 
-		if(bStartedUncompress)
+		for (int32 Slot = 0; Slot < NumSlots; ++Slot)
 		{
-			UncompressTask.EnsureCompletion();
+			if (bStartedUncompress[Slot])
+			{
+				UncompressTasks[Slot].EnsureCompletion();
+			}
 		}
 	}
 };
@@ -3528,9 +3689,11 @@ bool FPakPlatformFile::IsNonPakFilenameAllowed(const FString& InFilename)
 FPakFile::FPakFile(const TCHAR* Filename, bool bIsSigned)
 	: PakFilename(Filename)
 	, PakFilenameName(Filename)
+	, bDirectoryIndexBuilt(true)
 	, CachedTotalSize(0)
 	, bSigned(bIsSigned)
 	, bIsValid(false)
+	, bAttemptedMapping(false)
 {
 	FArchive* Reader = GetSharedReader(NULL);
 	if (Reader)
@@ -3544,9 +3707,11 @@ FPakFile::FPakFile(const TCHAR* Filename, bool bIsSigned)
 FPakFile::FPakFile(IPlatformFile* LowerLevel, const TCHAR* Filename, bool bIsSigned)
 	: PakFilename(Filename)
 	, PakFilenameName(Filename)
+	, bDirectoryIndexBuilt(true)
 	, CachedTotalSize(0)
 	, bSigned(bIsSigned)
 	, bIsValid(false)
+	, bAttemptedMapping(false)
 {
 	FArchive* Reader = GetSharedReader(LowerLevel);
 	if (Reader)
@@ -3558,8 +3723,10 @@ FPakFile::FPakFile(IPlatformFile* LowerLevel, const TCHAR* Filename, bool bIsSig
 
 #if WITH_EDITOR
 FPakFile::FPakFile(FArchive* Archive)
-	: bSigned(false)
+	: bDirectoryIndexBuilt(true)
+	, bSigned(false)
 	, bIsValid(false)
+	, bAttemptedMapping(false)
 {
 	Initialize(Archive);
 }
@@ -3569,6 +3736,21 @@ FPakFile::~FPakFile()
 {
 }
 
+IMappedFileHandle* FPakFile::GetMappedFileHandle(IPlatformFile* LowerLevel)
+{
+	FScopeLock ScopedLock(&MappedFileHandleCriticalSection);
+	if (!bAttemptedMapping)
+	{
+		bAttemptedMapping = true;
+		// mapped memory is never checked against the signatures
+		if (!bSigned && LowerLevel)
+		{
+			MappedFileHandle.Reset(LowerLevel->OpenMapped(*PakFilename));
+		}
+	}
+	return MappedFileHandle.Get();
+}
+
 FArchive* FPakFile::CreatePakReader(const TCHAR* Filename)
 {
 	FArchive* ReaderArchive = IFileManager::Get().CreateFileReader(Filename);
@@ -3663,56 +3845,106 @@ void FPakFile::LoadIndex(FArchive* Reader)
 		// Allocate enough memory to hold all entries (and not reallocate while they're being added to it).
 		Files.Empty(NumEntries);
 
-		for (int32 EntryIndex = 0; EntryIndex < NumEntries; EntryIndex++)
+		if (Info.Version >= FPakInfo::PakFile_Version_PathHashIndex)
 		{
-			// Serialize from memory.
-			FPakEntry Entry;
-			FString Filename;
-			IndexReader << Filename;
-			Entry.Serialize(IndexReader, Info.Version);
+			// entries and their hashes come first, the paths are only needed to iterate directories so they are kept
+			// serialized until then
+			for (int32 EntryIndex = 0; EntryIndex < NumEntries; EntryIndex++)
+			{
+				FPakEntry& Entry = Files[Files.AddDefaulted()];
+				Entry.Serialize(IndexReader, Info.Version);
+			}
+			IndexReader << PathHashIndex;
 
-			// Add new file info.
-			Files.Add(Entry);
+			UE_CLOG(PathHashIndex.PathHashes.Num() != NumEntries || IndexReader.IsError(), LogPakFile, Fatal, TEXT("Corrupted path hash index in pak file '%s'."), *PakFilename);
 
-			// Construct Index of all directories in pak file.
-			FString Path = FPaths::GetPath(Filename);
-			MakeDirectoryFromPath(Path);
-			FPakDirectory* Directory = Index.Find(Path);
-			if (Directory != NULL)
+			const int64 FilenamesOffset = IndexReader.Tell();
+			SerializedFilenames.Empty(IndexData.Num() - FilenamesOffset);
+			SerializedFilenames.Append(IndexData.GetData() + FilenamesOffset, IndexData.Num() - FilenamesOffset);
+			bDirectoryIndexBuilt = false;
+		}
+		else
+		{
+			for (int32 EntryIndex = 0; EntryIndex < NumEntries; EntryIndex++)
 			{
-				Directory->Add(Filename, &Files.Last());	
+				// Serialize from memory.
+				FPakEntry Entry;
+				FString Filename;
+				IndexReader << Filename;
+				Entry.Serialize(IndexReader, Info.Version);
+
+				// Add new file info.
+				Files.Add(Entry);
+
+				// Construct Index of all directories in pak file.
+				AddEntryToIndex(Filename, &Files.Last());
 			}
-			else
-			{
-				FPakDirectory NewDirectory;
-				NewDirectory.Add(Filename, &Files.Last());
-				Index.Add(Path, NewDirectory);
+			bDirectoryIndexBuilt = true;
+		}
+	}
+}
+
+void FPakFile::AddEntryToIndex(const FString& Filename, FPakEntry* Entry) const
+{
+	FString Path = FPaths::GetPath(Filename);
+	MakeDirectoryFromPath(Path);
+	FPakDirectory* Directory = Index.Find(Path);
+	if (Directory != NULL)
+	{
+		Directory->Add(Filename, Entry);	
+	}
+	else
+	{
+		FPakDirectory NewDirectory;
+		NewDirectory.Add(Filename, Entry);
+		Index.Add(Path, NewDirectory);
 
-				// add the parent directories up to the mount point
-				while (MountPoint != Path)
+		// add the parent directories up to the mount point
+		while (MountPoint != Path)
+		{
+			Path = Path.Left(Path.Len()-1);
+			int32 Offset = 0;
+			if (Path.FindLastChar('/', Offset))
+			{
+				Path = Path.Left(Offset);
+				MakeDirectoryFromPath(Path);
+				if (Index.Find(Path) == NULL)
 				{
-					Path = Path.Left(Path.Len()-1);
-					int32 Offset = 0;
-					if (Path.FindLastChar('/', Offset))
-					{
-						Path = Path.Left(Offset);
-						MakeDirectoryFromPath(Path);
-						if (Index.Find(Path) == NULL)
-						{
-							FPakDirectory ParentDirectory;
-							Index.Add(Path, ParentDirectory);
-						}
-					}
-					else
-					{
-						Path = MountPoint;
-					}
+					FPakDirectory ParentDirectory;
+					Index.Add(Path, ParentDirectory);
 				}
 			}
+			else
+			{
+				Path = MountPoint;
+			}
 		}
 	}
 }
 
+void FPakFile::BuildDirectoryIndex() const
+{
+	FScopeLock ScopedLock(&DirectoryIndexCritical);
+	if (bDirectoryIndexBuilt)
+	{
+		return;
+	}
+
+	FMemoryReader FilenamesReader(SerializedFilenames);
+	for (int32 EntryIndex = 0; EntryIndex < Files.Num(); EntryIndex++)
+	{
+		FString Filename;
+		FilenamesReader << Filename;
+		AddEntryToIndex(Filename, const_cast<FPakEntry*>(&Files[EntryIndex]));
+	}
+	UE_CLOG(FilenamesReader.IsError(), LogPakFile, Error, TEXT("Corrupted filenames in the index of pak file '%s'."), *PakFilename);
+	SerializedFilenames.Empty();
+
+	// the index has to be complete before other threads skip the lock
+	FPlatformMisc::MemoryBarrier();
+	bDirectoryIndexBuilt = true;
+}
+
 bool FPakFile::Check()
 {
 	UE_LOG(LogPakFile, Display, TEXT("Checking pak file \"%s\". This may take a while..."), *PakFilename);
@@ -4036,6 +4268,57 @@ bool FPakPlatformFile::ShouldBeUsed(IPlatformFile* Inner, const TCHAR* CmdLine)
 	return Result;
 }
 
+bool FPakReadOrderRecorder::bEnabled = false;
+
+/** Capture written by FPakReadOrderRecorder. */
+static TUniquePtr<FArchive> GPakReadOrderCapture;
+/** Critical section for writing to GPakReadOrderCapture. */
+static FCriticalSection GPakReadOrderCaptureCritical;
+
+void FPakReadOrderRecorder::Initialize(const TCHAR* CmdLine)
+{
+#if !UE_BUILD_SHIPPING
+	FString CaptureFilename;
+	if (!bEnabled && FParse::Value(CmdLine, TEXT("-RecordPakReadOrder="), CaptureFilename))
+	{
+		FScopeLock Lock(&GPakReadOrderCaptureCritical);
+		GPakReadOrderCapture.Reset(IFileManager::Get().CreateFileWriter(*CaptureFilename));
+		if (GPakReadOrderCapture)
+		{
+			UE_LOG(LogPakFile, Display, TEXT("Recording pak read order to %s."), *CaptureFilename);
+			FTCHARToUTF8 Header(TEXT("# PakReadOrder 1\n"));
+			GPakReadOrderCapture->Serialize((void*)Header.Get(), Header.Length());
+			bEnabled = true;
+			FCoreDelegates::OnPreExit.AddStatic(&FPakReadOrderRecorder::Shutdown);
+		}
+		else
+		{
+			UE_LOG(LogPakFile, Warning, TEXT("Unable to record pak read order to %s."), *CaptureFilename);
+		}
+	}
+#endif
+}
+
+void FPakReadOrderRecorder::Shutdown()
+{
+	FScopeLock Lock(&GPakReadOrderCaptureCritical);
+	bEnabled = false;
+	GPakReadOrderCapture.Reset();
+}
+
+void FPakReadOrderRecorder::RecordRead(FName PakFilename, int64 EntryOffset, int64 OffsetInEntry, int64 Size)
+{
+	// captures are merged against the paks on the machine running UnrealPak, so only the name of the pak is kept
+	const FString Line = FString::Printf(TEXT("%s,%lld,%lld,%lld\n"), *FPaths::GetCleanFilename(PakFilename.ToString()), EntryOffset, OffsetInEntry, Size);
+	FTCHARToUTF8 LineUTF8(*Line);
+
+	FScopeLock Lock(&GPakReadOrderCaptureCritical);
+	if (GPakReadOrderCapture)
+	{
+		GPakReadOrderCapture->Serialize((void*)LineUTF8.Get(), LineUTF8.Length());
+	}
+}
+
 bool FPakPlatformFile::Initialize(IPlatformFile* Inner, const TCHAR* CmdLine)
 {
 	// Inner is required.
@@ -4057,6 +4340,8 @@ bool FPakPlatformFile::Initialize(IPlatformFile* Inner, const TCHAR* CmdLine)
 	DecryptionKey.Modulus.Parse(PakSigningKeyModulus);
 
 	bSigned = !DecryptionKey.Exponent.IsZero() && !DecryptionKey.Modulus.IsZero();
+
+	FPakReadOrderRecorder::Initialize(CmdLine);
 	
 	bool bMountPaks = true;
 	TArray<FString> PaksToLoad;
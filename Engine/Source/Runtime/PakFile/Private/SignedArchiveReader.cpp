@@ -4,6 +4,9 @@
 #include "HAL/FileManager.h"
 #include "HAL/Event.h"
 #include "HAL/RunnableThread.h"
+#include "HAL/IConsoleManager.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Async/ParallelFor.h"
 
 DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("FChunkCacheWorker.ProcessQueue"), STAT_FChunkCacheWorker_ProcessQueue, STATGROUP_PakFile);
 DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("FChunkCacheWorker.CheckSignature"), STAT_FChunkCacheWorker_CheckSignature, STATGROUP_PakFile);
@@ -13,10 +16,23 @@ DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("FChunkCacheWorker.HashBuffer"), STAT_FChunk
 
 DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("FSignedArchiveReader.Serialize"), STAT_SignedArchiveReader_Serialize, STATGROUP_PakFile);
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Signed chunk bytes read"), STAT_FChunkCacheWorker_BytesRead, STATGROUP_PakFile);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Signed chunk bytes verified"), STAT_FChunkCacheWorker_BytesVerified, STATGROUP_PakFile);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Signed chunk cache hits"), STAT_FChunkCacheWorker_CacheHits, STATGROUP_PakFile);
+
+static int32 GPakSignedChunkCacheSize = 32;
+static FAutoConsoleVariableRef CVarPakSignedChunkCacheSize(
+	TEXT("pak.SignedChunkCacheSize"),
+	GPakSignedChunkCacheSize,
+	TEXT("Number of verified 64KB chunks each signed pak keeps cached, read when the pak is mounted. Also limits how many chunks are verified in parallel.")
+	);
+
 FChunkCacheWorker::FChunkCacheWorker(FArchive* InReader, const TCHAR* Filename)
 	: Reader(InReader)
+	, NumCachedChunks(FMath::Max<int32>(GPakSignedChunkCacheSize, MinCachedChunks))
 	, QueuedRequestsEvent(NULL)
 {
+	CachedChunks = MakeUnique<FChunkBuffer[]>(NumCachedChunks);
 	SetupDecryptionKey();
 
 	FString SigFileFilename = FPaths::ChangeExtension(Filename, TEXT("sig"));
@@ -101,7 +117,7 @@ void FChunkCacheWorker::Stop()
 
 FChunkBuffer* FChunkCacheWorker::GetCachedChunkBuffer(int32 ChunkIndex)
 {
-	for (int32 BufferIndex = 0; BufferIndex < MaxCachedChunks; ++BufferIndex)
+	for (int32 BufferIndex = 0; BufferIndex < NumCachedChunks; ++BufferIndex)
 	{
 		if (CachedChunks[BufferIndex].ChunkIndex == ChunkIndex)
 		{
@@ -118,7 +134,7 @@ FChunkBuffer* FChunkCacheWorker::GetFreeBuffer()
 {
 	// Find the least recently accessed, free buffer.
 	FChunkBuffer* LeastRecentFreeBuffer = NULL;
-	for (int32 BufferIndex = 0; BufferIndex < MaxCachedChunks; ++BufferIndex)
+	for (int32 BufferIndex = 0; BufferIndex < NumCachedChunks; ++BufferIndex)
 	{
 		if (CachedChunks[BufferIndex].LockCount == 0 && 
 			 (LeastRecentFreeBuffer == NULL || LeastRecentFreeBuffer->LastAccessTime > CachedChunks[BufferIndex].LastAccessTime))
@@ -137,7 +153,7 @@ FChunkBuffer* FChunkCacheWorker::GetFreeBuffer()
 
 void FChunkCacheWorker::ReleaseBuffer(int32 ChunkIndex)
 {
-	for (int32 BufferIndex = 0; BufferIndex < MaxCachedChunks; ++BufferIndex)
+	for (int32 BufferIndex = 0; BufferIndex < NumCachedChunks; ++BufferIndex)
 	{
 		if (CachedChunks[BufferIndex].ChunkIndex == ChunkIndex)
 		{
@@ -161,6 +177,11 @@ int32 FChunkCacheWorker::ProcessQueue()
 	// Keep track how many request have been process this loop
 	int32 ProcessedRequests = ActiveRequests.Num();
 
+	// chunks are only handed out once the whole batch is verified, requests for a chunk that is
+	// loaded in this batch share its buffer
+	TArray<FChunkRequest*> RequestsToVerify;
+	TArray<FChunkRequest*> ReadyRequests;
+
 	for (int32 RequestIndex = 0; RequestIndex < ActiveRequests.Num(); ++RequestIndex)
 	{
 		FChunkRequest& Request = *ActiveRequests[RequestIndex];
@@ -182,45 +203,77 @@ int32 FChunkCacheWorker::ProcessQueue()
 				CachedBuffer = GetFreeBuffer();				
 				if (!!CachedBuffer)
 				{
-					// Load and verify.
+					// Load and verify with the rest of the batch.
 					CachedBuffer->ChunkIndex = Request.Index;
 					Request.Buffer = CachedBuffer;
-					CheckSignature(Request);					
+					RequestsToVerify.Add(&Request);
 				}
 			}
 			else
 			{
 				Request.Buffer = CachedBuffer;
+				INC_DWORD_STAT(STAT_FChunkCacheWorker_CacheHits);
 			}
 			
 			if (!!CachedBuffer)
 			{
 				check(Request.Buffer == CachedBuffer);
-				// Chunk is cached and trusted. We no longer need the request handle on this thread.
-				// Let the other thread know the chunk is ready to read.
-				Request.RefCount.Decrement();				
-				Request.IsTrusted.Increment();
+				ReadyRequests.Add(&Request);
 			}
 		}
 	}
+
+	if (RequestsToVerify.Num())
+	{
+		ReadAndVerifyChunks(RequestsToVerify);
+	}
+
+	for (FChunkRequest* Request : ReadyRequests)
+	{
+		// Chunk is cached and trusted. We no longer need the request handle on this thread.
+		// Let the other thread know the chunk is ready to read.
+		Request->RefCount.Decrement();				
+		Request->IsTrusted.Increment();
+	}
 	return ProcessedRequests;
 }
 
+void FChunkCacheWorker::ReadAndVerifyChunks(const TArray<FChunkRequest*>& Requests)
+{
+	// read in file order so batches of neighbouring chunks don't seek
+	TArray<FChunkRequest*> SortedRequests(Requests);
+	SortedRequests.Sort([](const FChunkRequest& A, const FChunkRequest& B) { return A.Offset < B.Offset; });
+	{
+		SCOPE_SECONDS_ACCUMULATOR(STAT_FChunkCacheWorker_Serialize);
+		for (FChunkRequest* Request : SortedRequests)
+		{
+			if (Reader->Tell() != Request->Offset)
+			{
+				Reader->Seek(Request->Offset);
+			}
+			Reader->Serialize(Request->Buffer->Data, Request->Size);
+			INC_DWORD_STAT_BY(STAT_FChunkCacheWorker_BytesRead, Request->Size);
+		}
+	}
+
+	// the task graph isn't up yet when the first paks are mounted
+	const bool bForceSingleThread = !FTaskGraphInterface::IsRunning();
+	ParallelFor(SortedRequests.Num(), [this, &SortedRequests](int32 Index)
+	{
+		CheckSignature(*SortedRequests[Index]);
+	}, bForceSingleThread);
+}
+
 bool FChunkCacheWorker::CheckSignature(const FChunkRequest& ChunkInfo)
 {
 	SCOPE_SECONDS_ACCUMULATOR(STAT_FChunkCacheWorker_CheckSignature);
 
 	TPakChunkHash ChunkHash = 0;
-
-	{
-		SCOPE_SECONDS_ACCUMULATOR(STAT_FChunkCacheWorker_Serialize);
-		Reader->Seek(ChunkInfo.Offset);
-		Reader->Serialize(ChunkInfo.Buffer->Data, ChunkInfo.Size);
-	}
 	{
 		SCOPE_SECONDS_ACCUMULATOR(STAT_FChunkCacheWorker_HashBuffer);
 		ChunkHash = ComputePakChunkHash(ChunkInfo.Buffer->Data, ChunkInfo.Size);
 	}
+	INC_DWORD_STAT_BY(STAT_FChunkCacheWorker_BytesVerified, ChunkInfo.Size);
 
 	bool bHashesMatch = (ChunkHash == ChunkHashes[ChunkInfo.Index]);
 	if (!bHashesMatch)
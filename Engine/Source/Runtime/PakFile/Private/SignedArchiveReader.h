@@ -100,8 +100,8 @@ class FChunkCacheWorker : public FRunnable
 {	
 	enum
 	{
-		/** Buffer size */
-		MaxCachedChunks = 8		
+		/** Fewest buffers a worker uses, whatever pak.SignedChunkCacheSize is set to */
+		MinCachedChunks = 8
 	};
 
 	/** Reference hashes */
@@ -110,8 +110,10 @@ class FChunkCacheWorker : public FRunnable
 	FRunnableThread* Thread;
 	/** Archive reader */
 	FArchive* Reader;
-	/** Cached and verified chunks. */
-	FChunkBuffer CachedChunks[MaxCachedChunks];
+	/** Cached and verified chunks, kept until their buffer is reused so re-reads of hot chunks don't have to be verified again. */
+	TUniquePtr<FChunkBuffer[]> CachedChunks;
+	/** Number of buffers in CachedChunks */
+	int32 NumCachedChunks;
 	/** Queue of chunks to cache */
 	TArray<FChunkRequest*> RequestQueue;	
 	/** Lock for manipulating the queue */
@@ -134,7 +136,12 @@ class FChunkCacheWorker : public FRunnable
 	 */
 	int32 ProcessQueue();
 	/** 
-	 * Verifies chunk signature [*]
+	 * Reads the chunks of a batch of requests into their buffers and verifies their signatures.
+	 * Reading is done on this thread, hashing is spread across the task graph.
+	 */
+	void ReadAndVerifyChunks(const TArray<FChunkRequest*>& Requests);
+	/** 
+	 * Verifies chunk signature of an already read chunk, safe to call from any thread [*]
 	 */
 	bool CheckSignature(const FChunkRequest& ChunkInfo);
 	/** 
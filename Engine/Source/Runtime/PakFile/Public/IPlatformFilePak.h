@@ -51,8 +51,9 @@ struct FPakInfo
 		PakFile_Version_NoTimestamps = 2,
 		PakFile_Version_CompressionEncryption = 3,
 		PakFile_Version_IndexEncryption = 4,
+		PakFile_Version_PathHashIndex = 5,
 
-		PakFile_Version_Latest = PakFile_Version_IndexEncryption
+		PakFile_Version_Latest = PakFile_Version_PathHashIndex
 	};
 
 	/** Pak file magic value. */
@@ -282,6 +283,69 @@ struct FPakEntry
 /** Pak directory type. */
 typedef TMap<FString, FPakEntry*> FPakDirectory;
 
+/**
+ * Case insensitive hash of a path relative to the mount point of a pak file.
+ *
+ * @param RelativePath Path to hash, using '/' as separators.
+ * @param Seed Seed of the index the hash is looked up in.
+ * @return The hash, never 0.
+ */
+PAKFILE_API uint64 ComputePakPathHash(const TCHAR* RelativePath, uint64 Seed);
+
+/**
+ * Open addressing table from path hashes to entries, stored in paks of version PakFile_Version_PathHashIndex
+ * so that files can be found without loading their paths.
+ */
+struct PAKFILE_API FPakPathHashIndex
+{
+	/** Seed of the path hashes, picked when the pak is written so that no two paths in it have the same hash. */
+	uint64 Seed;
+	/** Path hash of every entry, in entry order. */
+	TArray<uint64> PathHashes;
+	/** Power of two number of slots holding entry indices, INDEX_NONE for empty slots. */
+	TArray<int32> Slots;
+
+	FPakPathHashIndex()
+		: Seed(0)
+	{
+	}
+
+	/**
+	 * Builds the index.
+	 *
+	 * @param RelativePaths Path of every entry relative to the mount point, in entry order.
+	 * @return false if the paths couldn't be hashed without collisions.
+	 */
+	bool Build(const TArray<FString>& RelativePaths);
+
+	/**
+	 * Finds an entry.
+	 *
+	 * @param RelativePath Path relative to the mount point.
+	 * @return Index of the entry, INDEX_NONE if it isn't in the index.
+	 */
+	int32 Find(const TCHAR* RelativePath) const
+	{
+		if (Slots.Num() == 0)
+		{
+			return INDEX_NONE;
+		}
+
+		const uint64 PathHash = ComputePakPathHash(RelativePath, Seed);
+		const uint32 SlotMask = Slots.Num() - 1;
+		for (uint32 SlotIndex = uint32(PathHash) & SlotMask; ; SlotIndex = (SlotIndex + 1) & SlotMask)
+		{
+			const int32 EntryIndex = Slots[SlotIndex];
+			if (EntryIndex == INDEX_NONE || PathHashes[EntryIndex] == PathHash)
+			{
+				return EntryIndex;
+			}
+		}
+	}
+
+	friend PAKFILE_API FArchive& operator<<(FArchive& Ar, FPakPathHashIndex& Index);
+};
+
 /**
  * Pak file.
  */
@@ -302,8 +366,16 @@ class PAKFILE_API FPakFile : FNoncopyable
 	FString MountPoint;
 	/** Info on all files stored in pak. */
 	TArray<FPakEntry> Files;	
-	/** Pak Index organized as a map of directories for faster Directory iteration. */
-	TMap<FString, FPakDirectory> Index;
+	/** Pak Index organized as a map of directories for faster Directory iteration, only built on demand for paks with a path hash index. */
+	mutable TMap<FString, FPakDirectory> Index;
+	/** Hash index used to find files in paks of version PakFile_Version_PathHashIndex. */
+	FPakPathHashIndex PathHashIndex;
+	/** Serialized paths of all entries of paks with a path hash index, until the directory index is built from them. */
+	mutable TArray<uint8> SerializedFilenames;
+	/** True once Index holds every entry. */
+	mutable volatile bool bDirectoryIndexBuilt;
+	/** Critical section for building the directory index. */
+	mutable FCriticalSection DirectoryIndexCritical;
 	/** Timestamp of this pak file. */
 	FDateTime Timestamp;	
 	/** TotalSize of the pak file */
@@ -312,6 +384,12 @@ class PAKFILE_API FPakFile : FNoncopyable
 	bool bSigned;
 	/** True if this pak file is valid and usable. */
 	bool bIsValid;
+	/** Memory mapping of the whole pak, shared by all mapped pak entries. */
+	TUniquePtr<IMappedFileHandle> MappedFileHandle;
+	/** True once mapping the pak has been attempted. */
+	bool bAttemptedMapping;
+	/** Critical section for creating MappedFileHandle. */
+	FCriticalSection MappedFileHandleCriticalSection;
 
 	FArchive* CreatePakReader(const TCHAR* Filename);
 	FArchive* CreatePakReader(IFileHandle& InHandle, const TCHAR* Filename);
@@ -385,6 +463,7 @@ public:
 	 */
 	const TMap<FString, FPakDirectory>& GetIndex() const
 	{
+		EnsureDirectoryIndex();
 		return Index;
 	}
 
@@ -395,6 +474,23 @@ public:
 	 */
 	FArchive* GetSharedReader(IPlatformFile* LowerLevel);
 
+	/**
+	 * Gets the memory mapping of the whole pak file, mapping it the first time this is called.
+	 *
+	 * @return The mapping, nullptr if the lower level can't map this pak or it is signed.
+	 */
+	IMappedFileHandle* GetMappedFileHandle(IPlatformFile* LowerLevel);
+
+	/**
+	 * Gets whether this pak file is signed.
+	 *
+	 * @return true if reads from this pak file are checked against its signatures.
+	 */
+	bool IsSigned() const
+	{
+		return bSigned;
+	}
+
 	/**
 	 * Finds an entry in the pak file matching the given filename.
 	 *
@@ -406,6 +502,13 @@ public:
 		const FPakEntry*const * FoundFile = NULL;
 		if (Filename.StartsWith(MountPoint))
 		{
+			if (PathHashIndex.Slots.Num())
+			{
+				const int32 EntryIndex = PathHashIndex.Find(*Filename + MountPoint.Len());
+				return EntryIndex != INDEX_NONE ? &Files[EntryIndex] : NULL;
+			}
+
+			EnsureDirectoryIndex();
 			FString Path(FPaths::GetPath(Filename));
 			const FPakDirectory* PakDirectory = FindDirectory(*Path);
 			if (PakDirectory != NULL)
@@ -459,6 +562,7 @@ public:
 		// pak files that are a subdirectory of the actual directory.
 		if ((Directory.StartsWith(MountPoint)) || (MountPoint.StartsWith(Directory)))
 		{
+			EnsureDirectoryIndex();
 			TArray<FString> DirectoriesInPak; // List of all unique directories at path
 			for (TMap<FString, FPakDirectory>::TConstIterator It(Index); It; ++It)
 			{
@@ -522,6 +626,7 @@ public:
 		// Check the specified path is under the mount point of this pak file.
 		if (Directory.StartsWith(MountPoint))
 		{
+			EnsureDirectoryIndex();
 			PakDirectory = Index.Find(Directory.Mid(MountPoint.Len()));
 		}
 		return PakDirectory;
@@ -634,6 +739,23 @@ private:
 	 */
 	void LoadIndex(FArchive* Reader);
 
+	/**
+	 * Adds an entry to the directory index, along with any missing parent directories.
+	 */
+	void AddEntryToIndex(const FString& Filename, FPakEntry* Entry) const;
+
+	/**
+	 * Builds the directory index from the serialized filenames of a pak with a path hash index, the first time it is needed.
+	 */
+	void EnsureDirectoryIndex() const
+	{
+		if (!bDirectoryIndexBuilt)
+		{
+			BuildDirectoryIndex();
+		}
+	}
+	void BuildDirectoryIndex() const;
+
 public:
 
 	/**
@@ -735,6 +857,46 @@ public:
 	}
 };
 
+/**
+ * Records every read from a pak file entry during a session, so UnrealPak -MergeReadOrder can turn the
+ * captures into an order file. Enabled with -RecordPakReadOrder=<CaptureFile> in non shipping builds.
+ *
+ * Captures are text, one read per line: "<PakFilename>,<EntryOffset>,<OffsetInEntry>,<Size>".
+ */
+class PAKFILE_API FPakReadOrderRecorder
+{
+	/** True while a capture is being written. */
+	static bool bEnabled;
+
+public:
+
+	/**
+	 * Starts recording if the command line asks for it.
+	 *
+	 * @param CmdLine Command line to parse.
+	 */
+	static void Initialize(const TCHAR* CmdLine);
+
+	/** Writes out the rest of the capture and stops recording. */
+	static void Shutdown();
+
+	/** @return true if reads should be passed to RecordRead. */
+	static FORCEINLINE bool IsEnabled()
+	{
+		return bEnabled;
+	}
+
+	/**
+	 * Records a read, safe to call from any thread.
+	 *
+	 * @param PakFilename Pak the entry is in.
+	 * @param EntryOffset Offset of the entry in the pak, identifies the file.
+	 * @param OffsetInEntry Offset of the read in the (uncompressed) file.
+	 * @param Size Number of bytes read.
+	 */
+	static void RecordRead(FName PakFilename, int64 EntryOffset, int64 OffsetInEntry, int64 Size);
+};
+
 /**
  * File handle to read from pak file.
  */
@@ -819,6 +981,11 @@ public:
 		//
 		if (Reader.FileSize() >= (ReadPos + BytesToRead))
 		{
+			if (FPakReadOrderRecorder::IsEnabled())
+			{
+				FPakReadOrderRecorder::RecordRead(Reader.PakFile.GetFilenameName(), Reader.PakEntry.Offset, ReadPos, BytesToRead);
+			}
+
 			// Read directly from Pak.
 			Reader.Serialize(ReadPos, Destination, BytesToRead);
 			ReadPos += BytesToRead;
@@ -1611,6 +1778,8 @@ public:
 
 	virtual IAsyncReadFileHandle* OpenAsyncRead(const TCHAR* Filename) override;
 
+	virtual IMappedFileHandle* OpenMapped(const TCHAR* Filename) override;
+
 	/**
 	 * Converts a filename to a path inside pak file.
 	 *
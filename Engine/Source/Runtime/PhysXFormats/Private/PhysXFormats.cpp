@@ -2,6 +2,7 @@
 
 #include "PhysXFormats.h"
 #include "Serialization/MemoryWriter.h"
+#include "Misc/ScopeLock.h"
 #include "Modules/ModuleManager.h"
 #include "Interfaces/Interface_CollisionDataProvider.h"
 #include "IPhysXFormat.h"
@@ -27,6 +28,9 @@ class FPhysXFormats : public IPhysXFormat
 
 	PxCooking* PhysXCooking;
 
+	/** Serializes cooking, which temporarily changes the params of PhysXCooking */
+	mutable FCriticalSection CookingCS;
+
 	/**
 	 * Validates format name and returns its PhysX enum value.
 	 *
@@ -96,6 +100,9 @@ public:
 		PConvexMeshDesc.points.stride = sizeof(FVector);
 		PConvexMeshDesc.flags = PxConvexFlag::eCOMPUTE_CONVEX | PxConvexFlag::eSHIFT_VERTICES;
 
+		// PxCooking params are shared, don't let cooks on other threads change them under us
+		FScopeLock Lock(&CookingCS);
+
 		// Set up cooking
 		const PxCookingParams CurrentParams = PhysXCooking->getParams();
 		PxCookingParams NewParams = CurrentParams;
@@ -184,6 +191,9 @@ public:
 		PTriMeshDesc.materialIndices.stride = sizeof(PxMaterialTableIndex);
 		PTriMeshDesc.flags = FlipNormals ? PxMeshFlag::eFLIPNORMALS : (PxMeshFlags)0;
 
+		// PxCooking params are shared, don't let cooks on other threads change them under us
+		FScopeLock Lock(&CookingCS);
+
 		// Set up cooking
 		const PxCookingParams CurrentParams = PhysXCooking->getParams();
 		PxCookingParams NewParams = CurrentParams;
@@ -230,6 +240,9 @@ public:
 		HFDesc.samples.stride = SamplesStride;
 		HFDesc.flags = PxHeightFieldFlag::eNO_BOUNDARY_EDGES;
 
+		// PxCooking params are shared, don't let cooks on other threads change them under us
+		FScopeLock Lock(&CookingCS);
+
 		// Set up cooking
 		const PxCookingParams& Params = PhysXCooking->getParams();
 		PxCookingParams NewParams = Params;
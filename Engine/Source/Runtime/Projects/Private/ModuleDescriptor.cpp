@@ -403,6 +403,10 @@ bool FModuleDescriptor::IsLoadedInCurrentConfiguration() const
 void FModuleDescriptor::LoadModulesForPhase(ELoadingPhase::Type LoadingPhase, const TArray<FModuleDescriptor>& Modules, TMap<FName, EModuleLoadResult>& ModuleLoadErrors)
 {
 	FScopedSlowTask SlowTask(Modules.Num());
+
+	// Modules that support it start up in parallel once all modules of the phase are loaded
+	FModuleManager::Get().BeginParallelStartup();
+
 	for(int Idx = 0; Idx < Modules.Num(); Idx++)
 	{
 		SlowTask.EnterProgressFrame(1);
@@ -431,6 +435,8 @@ void FModuleDescriptor::LoadModulesForPhase(ELoadingPhase::Type LoadingPhase, co
 			}
 		}
 	}
+
+	FModuleManager::Get().EndParallelStartup();
 }
 
 bool FModuleDescriptor::CheckModuleCompatibility(const TArray<FModuleDescriptor>& Modules, bool bGameModules, TArray<FString>& OutIncompatibleFiles)
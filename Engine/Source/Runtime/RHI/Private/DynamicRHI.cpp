@@ -10,6 +10,7 @@
 #include "HAL/IConsoleManager.h"
 #include "Misc/App.h"
 #include "RHI.h"
+#include "PipelineFileCache.h"
 #include "Modules/ModuleManager.h"
 #include "GenericPlatform/GenericPlatformDriver.h"
 
@@ -168,6 +169,9 @@ void RHIInit(bool bHasEditorToken)
 	{
 		GRHICommandList.LatchBypass(); // read commandline for bypass flag
 
+		// Before any state is created, so they can all be described
+		FPipelineFileCache::Initialize();
+
 		if (!FApp::CanEverRender())
 		{
 			InitNullRHI();
@@ -206,6 +210,8 @@ void RHIPostInit()
 
 void RHIExit()
 {
+	FPipelineFileCache::Shutdown();
+
 	if ( !GUsingNullRHI && GDynamicRHI != NULL )
 	{
 		// Destruct the dynamic RHI.
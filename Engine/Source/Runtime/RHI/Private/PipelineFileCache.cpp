@@ -0,0 +1,474 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	PipelineFileCache.cpp: Recorded graphics pipeline state cache file.
+=============================================================================*/
+
+#include "PipelineFileCache.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/Paths.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Serialization/MemoryWriter.h"
+
+static TAutoConsoleVariable<int32> CVarPipelineFileCacheEnabled(
+	TEXT("r.PSOFileCache.Enabled"),
+	0,
+	TEXT("1 to describe the pipeline states created at runtime, so they can be matched against the recorded pipeline file cache and precompiled from it."),
+	ECVF_ReadOnly
+);
+
+static TAutoConsoleVariable<int32> CVarPipelineFileCacheLogPSO(
+	TEXT("r.PSOFileCache.LogPSO"),
+	0,
+	TEXT("1 to record the pipeline states created at runtime, and save them to Saved/PipelineCaches on exit. Implies r.PSOFileCache.Enabled.\n")
+	TEXT("Can also be enabled with -logpso."),
+	ECVF_ReadOnly
+);
+
+static FAutoConsoleCommand CmdSavePipelineFileCache(
+	TEXT("r.PSOFileCache.Save"),
+	TEXT("Saves the pipeline states recorded so far to Saved/PipelineCaches"),
+	FConsoleCommandDelegate::CreateStatic([]() { FPipelineFileCache::SavePipelineFileCache(); })
+);
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("PSO file cache hits"), STAT_PSOFileCacheHit, STATGROUP_RHI);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("PSO file cache misses"), STAT_PSOFileCacheMiss, STATGROUP_RHI);
+
+/** Magic number and version of the .upipelinecache files */
+static const uint64 PipelineFileCacheMagic = 0x5049504543414348; // PIPECACH
+static const int32 PipelineFileCacheVersion = 1;
+
+static bool GPipelineFileCacheEnabled = false;
+static bool GPipelineFileCacheLogging = false;
+
+/** Initializers of the states and vertex declarations created while enabled, which are kept alive so their addresses can't be reused */
+template<typename StateType, typename InitializerType>
+struct TRegisteredState
+{
+	TRefCountPtr<StateType> State;
+	InitializerType Initializer;
+};
+
+static FCriticalSection GStateRegistryLock;
+static TMap<FRHIBlendState*, TRegisteredState<FRHIBlendState, FBlendStateInitializerRHI>> GRegisteredBlendStates;
+static TMap<FRHIRasterizerState*, TRegisteredState<FRHIRasterizerState, FRasterizerStateInitializerRHI>> GRegisteredRasterizerStates;
+static TMap<FRHIDepthStencilState*, TRegisteredState<FRHIDepthStencilState, FDepthStencilStateInitializerRHI>> GRegisteredDepthStencilStates;
+static TMap<FRHIVertexDeclaration*, TRegisteredState<FRHIVertexDeclaration, FVertexDeclarationElementList>> GRegisteredVertexDeclarations;
+
+static FCriticalSection GFileCacheLock;
+static FString GFileCacheName;
+static FName GFileCacheShaderFormat;
+/** The pipeline states of the cooked file, in recorded order */
+static TArray<FPipelineCacheFileFormatPSO> GCookedPSOArray;
+static TSet<FPipelineCacheFileFormatPSO> GCookedPSOs;
+/** Everything known to have been used, which is what a save writes */
+static TSet<FPipelineCacheFileFormatPSO> GRecordedPSOs;
+static bool GRecordedPSOsDirty = false;
+
+static FThreadSafeCounter GNumFileCacheHits;
+static FThreadSafeCounter GNumFileCacheMisses;
+
+template<typename StateType, typename InitializerType>
+static void RegisterState(TMap<StateType*, TRegisteredState<StateType, InitializerType>>& Registry, StateType* State, const InitializerType& Initializer)
+{
+	if (GPipelineFileCacheEnabled && State)
+	{
+		FScopeLock Lock(&GStateRegistryLock);
+
+		TRegisteredState<StateType, InitializerType>& Entry = Registry.FindOrAdd(State);
+		Entry.State = State;
+		Entry.Initializer = Initializer;
+	}
+}
+
+template<typename StateType, typename InitializerType>
+static bool FindStateInitializer(const TMap<StateType*, TRegisteredState<StateType, InitializerType>>& Registry, StateType* State, InitializerType& OutInitializer)
+{
+	const TRegisteredState<StateType, InitializerType>* Entry = Registry.Find(State);
+	if (Entry)
+	{
+		OutInitializer = Entry->Initializer;
+		return true;
+	}
+	return false;
+}
+
+void PipelineFileCacheRegisterState(FRHIRasterizerState* State, const FRasterizerStateInitializerRHI& Initializer)
+{
+	RegisterState(GRegisteredRasterizerStates, State, Initializer);
+}
+
+void PipelineFileCacheRegisterState(FRHIDepthStencilState* State, const FDepthStencilStateInitializerRHI& Initializer)
+{
+	RegisterState(GRegisteredDepthStencilStates, State, Initializer);
+}
+
+void PipelineFileCacheRegisterState(FRHIBlendState* State, const FBlendStateInitializerRHI& Initializer)
+{
+	RegisterState(GRegisteredBlendStates, State, Initializer);
+}
+
+void PipelineFileCacheRegisterVertexDeclaration(FRHIVertexDeclaration* VertexDeclaration, const FVertexDeclarationElementList& Elements)
+{
+	RegisterState(GRegisteredVertexDeclarations, VertexDeclaration, Elements);
+}
+
+static FSHAHash GetShaderHash(FRHIShader* Shader)
+{
+	return Shader ? Shader->GetHash() : FSHAHash();
+}
+
+/**
+ * FPipelineCacheFileFormatPSO
+ */
+
+FPipelineCacheFileFormatPSO::FPipelineCacheFileFormatPSO()
+	: PrimitiveType(PT_Num)
+	, RenderTargetsActive(0)
+	, DepthStencilFormat(PF_Unknown)
+	, DepthStencilFlags(0)
+	, DepthLoad(ERenderTargetLoadAction::ENoAction)
+	, DepthStore(ERenderTargetStoreAction::ENoAction)
+	, StencilLoad(ERenderTargetLoadAction::ENoAction)
+	, StencilStore(ERenderTargetStoreAction::ENoAction)
+	, NumSamples(0)
+	, Hash(0)
+{
+	BlendState.bUseIndependentRenderTargetBlendStates = false;
+
+	for (uint32 Index = 0; Index < MaxSimultaneousRenderTargets; ++Index)
+	{
+		RenderTargetFormats[Index] = PF_Unknown;
+		RenderTargetFlags[Index] = 0;
+		RenderTargetLoadActions[Index] = ERenderTargetLoadAction::ENoAction;
+		RenderTargetStoreActions[Index] = ERenderTargetStoreAction::ENoAction;
+	}
+}
+
+bool FPipelineCacheFileFormatPSO::Init(FPipelineCacheFileFormatPSO& PSO, const FGraphicsPipelineStateInitializer& Initializer)
+{
+	if (!GPipelineFileCacheEnabled)
+	{
+		return false;
+	}
+
+	const FBoundShaderStateInput& BoundShaderState = Initializer.BoundShaderState;
+
+	PSO.VertexShader = GetShaderHash(BoundShaderState.VertexShaderRHI);
+	PSO.PixelShader = GetShaderHash(BoundShaderState.PixelShaderRHI);
+	PSO.GeometryShader = GetShaderHash(BoundShaderState.GeometryShaderRHI);
+	PSO.HullShader = GetShaderHash(BoundShaderState.HullShaderRHI);
+	PSO.DomainShader = GetShaderHash(BoundShaderState.DomainShaderRHI);
+
+	// Shaders created without a hash can't be found again in a later run
+	if (PSO.VertexShader == FSHAHash() ||
+		(BoundShaderState.PixelShaderRHI && PSO.PixelShader == FSHAHash()) ||
+		(BoundShaderState.GeometryShaderRHI && PSO.GeometryShader == FSHAHash()) ||
+		(BoundShaderState.HullShaderRHI && PSO.HullShader == FSHAHash()) ||
+		(BoundShaderState.DomainShaderRHI && PSO.DomainShader == FSHAHash()))
+	{
+		return false;
+	}
+
+	{
+		FScopeLock Lock(&GStateRegistryLock);
+
+		if (!FindStateInitializer(GRegisteredVertexDeclarations, BoundShaderState.VertexDeclarationRHI, PSO.VertexDescriptor) ||
+			!FindStateInitializer(GRegisteredBlendStates, Initializer.BlendState, PSO.BlendState) ||
+			!FindStateInitializer(GRegisteredRasterizerStates, Initializer.RasterizerState, PSO.RasterizerState) ||
+			!FindStateInitializer(GRegisteredDepthStencilStates, Initializer.DepthStencilState, PSO.DepthStencilState))
+		{
+			return false;
+		}
+	}
+
+	PSO.PrimitiveType = (uint32)Initializer.PrimitiveType;
+	PSO.RenderTargetsActive = Initializer.RenderTargetsEnabled;
+	PSO.RenderTargetFormats = Initializer.RenderTargetFormats;
+	PSO.RenderTargetFlags = Initializer.RenderTargetFlags;
+	PSO.RenderTargetLoadActions = Initializer.RenderTargetLoadActions;
+	PSO.RenderTargetStoreActions = Initializer.RenderTargetStoreActions;
+	PSO.DepthStencilFormat = Initializer.DepthStencilTargetFormat;
+	PSO.DepthStencilFlags = Initializer.DepthStencilTargetFlag;
+	PSO.DepthLoad = Initializer.DepthTargetLoadAction;
+	PSO.DepthStore = Initializer.DepthTargetStoreAction;
+	PSO.StencilLoad = Initializer.StencilTargetLoadAction;
+	PSO.StencilStore = Initializer.StencilTargetStoreAction;
+	PSO.NumSamples = Initializer.NumSamples;
+	PSO.Hash = 0;
+
+	return true;
+}
+
+/** Serializes the description without the cached hash, for hashing and comparing */
+static void SerializeDescription(const FPipelineCacheFileFormatPSO& PSO, TArray<uint8>& OutBytes)
+{
+	FMemoryWriter Writer(OutBytes);
+	Writer << const_cast<FPipelineCacheFileFormatPSO&>(PSO);
+}
+
+bool operator==(const FPipelineCacheFileFormatPSO& A, const FPipelineCacheFileFormatPSO& B)
+{
+	if (GetTypeHash(A) != GetTypeHash(B))
+	{
+		return false;
+	}
+
+	TArray<uint8> BytesA;
+	TArray<uint8> BytesB;
+	SerializeDescription(A, BytesA);
+	SerializeDescription(B, BytesB);
+	return BytesA == BytesB;
+}
+
+uint32 GetTypeHash(const FPipelineCacheFileFormatPSO& Key)
+{
+	if (!Key.Hash)
+	{
+		TArray<uint8> Bytes;
+		SerializeDescription(Key, Bytes);
+		Key.Hash = FCrc::MemCrc32(Bytes.GetData(), Bytes.Num());
+	}
+	return Key.Hash;
+}
+
+template<typename EnumType>
+static void SerializeAsByte(FArchive& Ar, EnumType& Value)
+{
+	uint8 Byte = (uint8)Value;
+	Ar << Byte;
+	Value = (EnumType)Byte;
+}
+
+FArchive& operator<<(FArchive& Ar, FPipelineCacheFileFormatPSO& Info)
+{
+	Ar << Info.VertexDescriptor;
+	Ar << Info.VertexShader;
+	Ar << Info.PixelShader;
+	Ar << Info.GeometryShader;
+	Ar << Info.HullShader;
+	Ar << Info.DomainShader;
+	Ar << Info.BlendState;
+	Ar << Info.RasterizerState;
+	Ar << Info.DepthStencilState;
+	Ar << Info.PrimitiveType;
+	Ar << Info.RenderTargetsActive;
+
+	for (uint32 Index = 0; Index < MaxSimultaneousRenderTargets; ++Index)
+	{
+		SerializeAsByte(Ar, Info.RenderTargetFormats[Index]);
+		Ar << Info.RenderTargetFlags[Index];
+		SerializeAsByte(Ar, Info.RenderTargetLoadActions[Index]);
+		SerializeAsByte(Ar, Info.RenderTargetStoreActions[Index]);
+	}
+
+	SerializeAsByte(Ar, Info.DepthStencilFormat);
+	Ar << Info.DepthStencilFlags;
+	SerializeAsByte(Ar, Info.DepthLoad);
+	SerializeAsByte(Ar, Info.DepthStore);
+	SerializeAsByte(Ar, Info.StencilLoad);
+	SerializeAsByte(Ar, Info.StencilStore);
+	Ar << Info.NumSamples;
+
+	if (Ar.IsLoading())
+	{
+		Info.Hash = 0;
+	}
+
+	return Ar;
+}
+
+/**
+ * FPipelineFileCache
+ */
+
+static FString GetCookedFilename(const FString& Name, FName ShaderFormat)
+{
+	return FPaths::GameContentDir() / TEXT("PipelineCaches") / FString::Printf(TEXT("%s_%s.upipelinecache"), *Name, *ShaderFormat.ToString());
+}
+
+static FString GetRecordedFilename(const FString& Name, FName ShaderFormat)
+{
+	return FPaths::GameSavedDir() / TEXT("PipelineCaches") / FString::Printf(TEXT("%s_%s.upipelinecache"), *Name, *ShaderFormat.ToString());
+}
+
+static bool LoadPipelineFile(const FString& Filename, FName ShaderFormat, TArray<FPipelineCacheFileFormatPSO>& OutPSOs)
+{
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*Filename));
+	if (!Reader)
+	{
+		return false;
+	}
+
+	uint64 Magic = 0;
+	int32 Version = 0;
+	FString FileShaderFormat;
+	*Reader << Magic << Version << FileShaderFormat;
+
+	if (Magic != PipelineFileCacheMagic || Version != PipelineFileCacheVersion || FName(*FileShaderFormat) != ShaderFormat)
+	{
+		UE_LOG(LogRHI, Warning, TEXT("Ignoring pipeline file cache %s, it was saved by another version or for another shader format."), *Filename);
+		return false;
+	}
+
+	*Reader << OutPSOs;
+
+	if (Reader->IsError())
+	{
+		UE_LOG(LogRHI, Warning, TEXT("Failed to read pipeline file cache %s."), *Filename);
+		OutPSOs.Empty();
+		return false;
+	}
+
+	return true;
+}
+
+void FPipelineFileCache::Initialize()
+{
+	GPipelineFileCacheLogging = CVarPipelineFileCacheLogPSO.GetValueOnAnyThread() != 0 || FParse::Param(FCommandLine::Get(), TEXT("logpso"));
+	GPipelineFileCacheEnabled = GPipelineFileCacheLogging || CVarPipelineFileCacheEnabled.GetValueOnAnyThread() != 0;
+}
+
+void FPipelineFileCache::Shutdown()
+{
+	if (GPipelineFileCacheEnabled)
+	{
+		UE_LOG(LogRHI, Log, TEXT("Pipeline file cache: %d pipeline states found in the file, %d not."), GNumFileCacheHits.GetValue(), GNumFileCacheMisses.GetValue());
+	}
+
+	if (GPipelineFileCacheLogging)
+	{
+		SavePipelineFileCache();
+	}
+
+	{
+		FScopeLock Lock(&GStateRegistryLock);
+		GRegisteredBlendStates.Empty();
+		GRegisteredRasterizerStates.Empty();
+		GRegisteredDepthStencilStates.Empty();
+		GRegisteredVertexDeclarations.Empty();
+	}
+
+	GPipelineFileCacheEnabled = false;
+	GPipelineFileCacheLogging = false;
+}
+
+bool FPipelineFileCache::IsPipelineFileCacheEnabled()
+{
+	return GPipelineFileCacheEnabled;
+}
+
+bool FPipelineFileCache::IsPipelineFileCacheLogging()
+{
+	return GPipelineFileCacheLogging;
+}
+
+bool FPipelineFileCache::OpenPipelineFileCache(const FString& Name, EShaderPlatform Platform)
+{
+	if (!GPipelineFileCacheEnabled)
+	{
+		return false;
+	}
+
+	FScopeLock Lock(&GFileCacheLock);
+
+	GFileCacheName = Name;
+	GFileCacheShaderFormat = LegacyShaderPlatformToShaderFormat(Platform);
+
+	GCookedPSOArray.Empty();
+	GCookedPSOs.Empty();
+
+	const FString CookedFilename = GetCookedFilename(Name, GFileCacheShaderFormat);
+	const bool bFoundCookedFile = LoadPipelineFile(CookedFilename, GFileCacheShaderFormat, GCookedPSOArray);
+
+	for (const FPipelineCacheFileFormatPSO& PSO : GCookedPSOArray)
+	{
+		GCookedPSOs.Add(PSO);
+	}
+
+	if (GPipelineFileCacheLogging)
+	{
+		// Accumulate across playtests, so a save covers everything seen so far
+		TArray<FPipelineCacheFileFormatPSO> RecordedPSOs;
+		LoadPipelineFile(GetRecordedFilename(Name, GFileCacheShaderFormat), GFileCacheShaderFormat, RecordedPSOs);
+
+		GRecordedPSOs.Append(GCookedPSOs);
+		GRecordedPSOs.Append(RecordedPSOs);
+	}
+
+	UE_LOG(LogRHI, Log, TEXT("Opened pipeline file cache %s with %d pipeline states."), *CookedFilename, GCookedPSOArray.Num());
+
+	return bFoundCookedFile;
+}
+
+bool FPipelineFileCache::SavePipelineFileCache()
+{
+	FScopeLock Lock(&GFileCacheLock);
+
+	if (GFileCacheShaderFormat == NAME_None || !GRecordedPSOsDirty)
+	{
+		return false;
+	}
+
+	const FString Filename = GetRecordedFilename(GFileCacheName, GFileCacheShaderFormat);
+
+	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*Filename));
+	if (!Writer)
+	{
+		UE_LOG(LogRHI, Warning, TEXT("Failed to save pipeline file cache %s."), *Filename);
+		return false;
+	}
+
+	uint64 Magic = PipelineFileCacheMagic;
+	int32 Version = PipelineFileCacheVersion;
+	FString ShaderFormat = GFileCacheShaderFormat.ToString();
+	TArray<FPipelineCacheFileFormatPSO> PSOs = GRecordedPSOs.Array();
+
+	*Writer << Magic << Version << ShaderFormat << PSOs;
+
+	const bool bSucceeded = Writer->Close();
+	GRecordedPSOsDirty = !bSucceeded;
+
+	UE_LOG(LogRHI, Log, TEXT("Saved %d pipeline states to %s."), PSOs.Num(), *Filename);
+
+	return bSucceeded;
+}
+
+void FPipelineFileCache::GetCachedPSOs(TArray<FPipelineCacheFileFormatPSO>& OutPSOs)
+{
+	FScopeLock Lock(&GFileCacheLock);
+	OutPSOs = GCookedPSOArray;
+}
+
+bool FPipelineFileCache::IsCachedPSO(const FPipelineCacheFileFormatPSO& PSO)
+{
+	FScopeLock Lock(&GFileCacheLock);
+	return GCookedPSOs.Contains(PSO);
+}
+
+void FPipelineFileCache::CacheGraphicsPSO(const FPipelineCacheFileFormatPSO& PSO)
+{
+	if (GPipelineFileCacheLogging)
+	{
+		FScopeLock Lock(&GFileCacheLock);
+
+		bool bAlreadyInSet = false;
+		GRecordedPSOs.Add(PSO, &bAlreadyInSet);
+		GRecordedPSOsDirty |= !bAlreadyInSet;
+	}
+}
+
+void FPipelineFileCache::RecordFileCacheHit()
+{
+	GNumFileCacheHits.Increment();
+	INC_DWORD_STAT(STAT_PSOFileCacheHit);
+}
+
+void FPipelineFileCache::RecordFileCacheMiss()
+{
+	GNumFileCacheMisses.Increment();
+	INC_DWORD_STAT(STAT_PSOFileCacheMiss);
+}
@@ -5,6 +5,7 @@ PipelineStateCache.cpp: Pipeline state cache implementation.
 =============================================================================*/
 
 #include "PipelineStateCache.h"
+#include "PipelineFileCache.h"
 #include "Misc/ScopeLock.h"
 
 extern RHI_API FRHIComputePipelineState* ExecuteSetComputePipelineState(FComputePipelineState* ComputePipelineState);
@@ -51,6 +52,9 @@ static FCriticalSection GComputeLock;
 static TMap<FRHIComputeShader*, FComputePipelineState*> GComputePipelines;
 static FCriticalSection GGraphicsLock;
 static TMap <FGraphicsPipelineStateInitializer, FGraphicsPipelineState*> GGraphicsPipelines;
+/** Pipelines compiled ahead of use from the pipeline file cache, by description since their initializers reference other state objects */
+static TMap <FPipelineCacheFileFormatPSO, FGraphicsPipelineState*> GPrecompiledGraphicsPipelines;
+static FThreadSafeCounter GNumPrecompilingGraphicsPipelines;
 
 class FPipelineState
 {
@@ -100,9 +104,11 @@ class FCompilePipelineStateTask
 {
 public:
 	FPipelineState* Pipeline;
+	bool bPrecompile;
 
-	FCompilePipelineStateTask(FPipelineState* InPipeline)
+	FCompilePipelineStateTask(FPipelineState* InPipeline, bool bInPrecompile = false)
 		: Pipeline(InPipeline)
+		, bPrecompile(bInPrecompile)
 	{
 	}
 
@@ -120,6 +126,11 @@ public:
 			FGraphicsPipelineState* GfxPipeline = static_cast<FGraphicsPipelineState*>(Pipeline);
 			GfxPipeline->RHIPipeline = RHICreateGraphicsPipelineState(GfxPipeline->Initializer);
 		}
+
+		if (bPrecompile)
+		{
+			GNumPrecompilingGraphicsPipelines.Decrement();
+		}
 	}
 
 	FORCEINLINE TStatId GetStatId() const
@@ -254,7 +265,37 @@ FGraphicsPipelineState* GetAndOrCreateGraphicsPipelineState(FRHICommandList& RHI
 
 		FGraphicsPipelineState* PipelineState = new FGraphicsPipelineState(*Initializer);
 
-		if (IsAsyncCompilationAllowed(RHICmdList))
+		// First use this run, see whether it was recorded and precompiled
+		FGraphicsPipelineState* PrecompiledState = nullptr;
+		FPipelineCacheFileFormatPSO FileCachePSO;
+		if (FPipelineCacheFileFormatPSO::Init(FileCachePSO, *Initializer))
+		{
+			if (FPipelineFileCache::IsCachedPSO(FileCachePSO))
+			{
+				FPipelineFileCache::RecordFileCacheHit();
+
+				FGraphicsPipelineState** FoundPrecompiled = GPrecompiledGraphicsPipelines.Find(FileCachePSO);
+				PrecompiledState = FoundPrecompiled ? *FoundPrecompiled : nullptr;
+			}
+			else
+			{
+				FPipelineFileCache::RecordFileCacheMiss();
+			}
+
+			FPipelineFileCache::CacheGraphicsPSO(FileCachePSO);
+		}
+
+		if (PrecompiledState)
+		{
+			// Usually long done, otherwise it's still quicker than starting over
+			if (PrecompiledState->CompletionEvent.IsValid() && !PrecompiledState->CompletionEvent->IsComplete())
+			{
+				FTaskGraphInterface::Get().WaitUntilTaskCompletes(PrecompiledState->CompletionEvent);
+			}
+
+			PipelineState->RHIPipeline = PrecompiledState->RHIPipeline;
+		}
+		else if (IsAsyncCompilationAllowed(RHICmdList))
 		{
 			PipelineState->CompletionEvent = TGraphTask<FCompilePipelineStateTask>::CreateTask().ConstructAndDispatchWhenReady(PipelineState);
 			RHICmdList.QueueAsyncPipelineStateCompile(PipelineState->CompletionEvent);
@@ -288,3 +329,27 @@ void SetGraphicsPipelineState(FRHICommandList& RHICmdList, const FGraphicsPipeli
 {
 	RHICmdList.SetGraphicsPipelineState(GetAndOrCreateGraphicsPipelineState(RHICmdList, Initializer, ApplyFlags));
 }
+
+bool PrecompileGraphicsPipelineState(const FGraphicsPipelineStateInitializer& Initializer, const FPipelineCacheFileFormatPSO& FileCachePSO)
+{
+	FScopeLock ScopeLock(&GGraphicsLock);
+
+	if (GPrecompiledGraphicsPipelines.Contains(FileCachePSO))
+	{
+		return false;
+	}
+
+	FGraphicsPipelineState* PipelineState = new FGraphicsPipelineState(Initializer);
+
+	GNumPrecompilingGraphicsPipelines.Increment();
+	PipelineState->CompletionEvent = TGraphTask<FCompilePipelineStateTask>::CreateTask().ConstructAndDispatchWhenReady(PipelineState, true);
+
+	GPrecompiledGraphicsPipelines.Add(FileCachePSO, PipelineState);
+
+	return true;
+}
+
+int32 GetNumPrecompilingGraphicsPipelineStates()
+{
+	return GNumPrecompilingGraphicsPipelines.GetValue();
+}
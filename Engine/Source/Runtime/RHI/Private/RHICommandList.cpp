@@ -954,26 +954,38 @@ public:
 
 		TArray<int32, TInlineAllocator<64> > Sizes;
 		Sizes.Reserve(NumCommandLists);
+		int32 TotalSize = 0;
 		for (int32 Index = 0; Index < NumCommandLists; Index++)
 		{
 			Sizes.Add(RHICmdLists[Index]->GetUsedMemory());
+			TotalSize += Sizes.Last();
 		}
 
-		int32 EffectiveThreads = 0;
-		int32 Start = 0;
-		// this is pretty silly but we need to know the number of jobs in advance, so we run the merge logic twice
-		while (Start < NumCommandLists)
+		// Each translate costs a native command list and a submit, so don't do more of them than there are task threads to run them.
+		// Merging until a translate has at least TargetSize bytes guarantees that, and balances the translates across the threads.
+		const int32 MaxTranslates = FMath::Max(FTaskGraphInterface::Get().GetNumWorkerThreads(), 1);
+		const int32 TargetSize = FMath::Max(MinSize, FMath::DivideAndRoundUp(TotalSize, MaxTranslates));
+
+		auto FindLastToMerge = [this, &Sizes, TargetSize](int32 First) -> int32
 		{
-			int32 Last = Start;
-			int32 DrawCnt = Sizes[Start];
+			int32 Last = First;
+			int32 MergedSize = Sizes[First];
 
-			while (Last < NumCommandLists - 1 && DrawCnt + Sizes[Last + 1] <= MinSize)
+			while (Last < NumCommandLists - 1 && MergedSize < TargetSize)
 			{
 				Last++;
-				DrawCnt += Sizes[Last];
+				MergedSize += Sizes[Last];
 			}
-			check(Last >= Start);
-			Start = Last + 1;
+			check(Last >= First);
+			return Last;
+		};
+
+		int32 EffectiveThreads = 0;
+		int32 Start = 0;
+		// this is pretty silly but we need to know the number of jobs in advance, so we run the merge logic twice
+		while (Start < NumCommandLists)
+		{
+			Start = FindLastToMerge(Start) + 1;
 			EffectiveThreads++;
 		} 
 
@@ -993,15 +1005,7 @@ public:
 
 			while (Start < NumCommandLists)
 			{
-				int32 Last = Start;
-				int32 DrawCnt = Sizes[Start];
-
-				while (Last < NumCommandLists - 1 && DrawCnt + Sizes[Last + 1] <= MinSize)
-				{
-					Last++;
-					DrawCnt += Sizes[Last];
-				}
-				check(Last >= Start);
+				const int32 Last = FindLastToMerge(Start);
 
 				IRHICommandContextContainer* ContextContainer =  RHIGetCommandContextContainer(ThreadIndex, EffectiveThreads);
 				check(ContextContainer);
@@ -1123,7 +1127,7 @@ void FRHICommandListBase::QueueParallelAsyncCommandListSubmit(FGraphEventRef* An
 					{
 						Last++;
 						DrawCnt += NumDrawsIfKnown[Last];
-						TotalMem += bSpewMerge ? CmdLists[Start]->GetUsedMemory() : 0;   // the memory is only accurate if we are spewing because otherwise it isn't done yet!
+						TotalMem += bSpewMerge ? CmdLists[Last]->GetUsedMemory() : 0;   // the memory is only accurate if we are spewing because otherwise it isn't done yet!
 					}
 				}
 
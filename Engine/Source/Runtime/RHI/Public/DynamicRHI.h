@@ -878,6 +878,34 @@ public:
 	// FlushType: Thread safe
 	virtual FTexture2DRHIRef RHIAsyncCreateTexture2D(uint32 SizeX, uint32 SizeY, uint8 Format, uint32 NumMips, uint32 Flags, void** InitialMipData, uint32 NumInitialMips) = 0;
 
+	/**
+	* Thread-safe function that can be used to create a vertex buffer outside of the
+	* rendering thread. This function can ONLY be called if GRHISupportsAsyncBufferCreation
+	* is true. Cannot create dynamic or unordered access buffers with this method.
+	* The initial data in CreateInfo.ResourceArray has been uploaded when the function returns.
+	* @param Size - size of the buffer in bytes
+	* @param InUsage - EBufferUsageFlags
+	* @param CreateInfo - optional initial data
+	* @returns a reference to a vertex buffer resource
+	*/
+	// FlushType: Thread safe
+	virtual FVertexBufferRHIRef RHIAsyncCreateVertexBuffer(uint32 Size, uint32 InUsage, FRHIResourceCreateInfo& CreateInfo)
+	{
+		checkNoEntry();
+		return nullptr;
+	}
+
+	/**
+	* Thread-safe function that can be used to create an index buffer outside of the
+	* rendering thread. Same restrictions as RHIAsyncCreateVertexBuffer.
+	*/
+	// FlushType: Thread safe
+	virtual FIndexBufferRHIRef RHIAsyncCreateIndexBuffer(uint32 Stride, uint32 Size, uint32 InUsage, FRHIResourceCreateInfo& CreateInfo)
+	{
+		checkNoEntry();
+		return nullptr;
+	}
+
 	/**
 	* Copies shared mip levels from one texture to another. The textures must have
 	* full mip chains, share the same format, and have the same aspect ratio. This
@@ -1370,19 +1398,31 @@ FORCEINLINE FSamplerStateRHIRef RHICreateSamplerState(const FSamplerStateInitial
 	return GDynamicRHI->RHICreateSamplerState(Initializer);
 }
 
+/** Remember the initializers of created states and vertex declarations, so the pipeline states using them can be recorded (see PipelineFileCache.h). */
+extern RHI_API void PipelineFileCacheRegisterState(FRHIRasterizerState* State, const FRasterizerStateInitializerRHI& Initializer);
+extern RHI_API void PipelineFileCacheRegisterState(FRHIDepthStencilState* State, const FDepthStencilStateInitializerRHI& Initializer);
+extern RHI_API void PipelineFileCacheRegisterState(FRHIBlendState* State, const FBlendStateInitializerRHI& Initializer);
+extern RHI_API void PipelineFileCacheRegisterVertexDeclaration(FRHIVertexDeclaration* VertexDeclaration, const FVertexDeclarationElementList& Elements);
+
 FORCEINLINE FRasterizerStateRHIRef RHICreateRasterizerState(const FRasterizerStateInitializerRHI& Initializer)
 {
-	return GDynamicRHI->RHICreateRasterizerState(Initializer);
+	FRasterizerStateRHIRef State = GDynamicRHI->RHICreateRasterizerState(Initializer);
+	PipelineFileCacheRegisterState(State, Initializer);
+	return State;
 }
 
 FORCEINLINE FDepthStencilStateRHIRef RHICreateDepthStencilState(const FDepthStencilStateInitializerRHI& Initializer)
 {
-	return GDynamicRHI->RHICreateDepthStencilState(Initializer);
+	FDepthStencilStateRHIRef State = GDynamicRHI->RHICreateDepthStencilState(Initializer);
+	PipelineFileCacheRegisterState(State, Initializer);
+	return State;
 }
 
 FORCEINLINE FBlendStateRHIRef RHICreateBlendState(const FBlendStateInitializerRHI& Initializer)
 {
-	return GDynamicRHI->RHICreateBlendState(Initializer);
+	FBlendStateRHIRef State = GDynamicRHI->RHICreateBlendState(Initializer);
+	PipelineFileCacheRegisterState(State, Initializer);
+	return State;
 }
 
 FORCEINLINE FBoundShaderStateRHIRef RHICreateBoundShaderState(FVertexDeclarationRHIParamRef VertexDeclaration, FVertexShaderRHIParamRef VertexShader, FHullShaderRHIParamRef HullShader, FDomainShaderRHIParamRef DomainShader, FPixelShaderRHIParamRef PixelShader, FGeometryShaderRHIParamRef GeometryShader)
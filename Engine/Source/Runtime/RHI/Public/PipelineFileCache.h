@@ -0,0 +1,108 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	PipelineFileCache.h: Recorded graphics pipeline state cache file.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RHI.h"
+
+/**
+ * Description of a graphics pipeline state that doesn't reference any RHI resource, so it can be saved to a file
+ * and matched against the pipeline states of a later run. Shaders are identified by their output hash, states by their initializers.
+ */
+struct RHI_API FPipelineCacheFileFormatPSO
+{
+	FVertexDeclarationElementList VertexDescriptor;
+	FSHAHash VertexShader;
+	FSHAHash PixelShader;
+	FSHAHash GeometryShader;
+	FSHAHash HullShader;
+	FSHAHash DomainShader;
+
+	FBlendStateInitializerRHI BlendState;
+	FRasterizerStateInitializerRHI RasterizerState;
+	FDepthStencilStateInitializerRHI DepthStencilState;
+
+	uint32 PrimitiveType;
+	uint32 RenderTargetsActive;
+	FGraphicsPipelineStateInitializer::TRenderTargetFormats RenderTargetFormats;
+	FGraphicsPipelineStateInitializer::TRenderTargetFlags RenderTargetFlags;
+	FGraphicsPipelineStateInitializer::TRenderTargetLoadActions RenderTargetLoadActions;
+	FGraphicsPipelineStateInitializer::TRenderTargetStoreActions RenderTargetStoreActions;
+	EPixelFormat DepthStencilFormat;
+	uint32 DepthStencilFlags;
+	ERenderTargetLoadAction DepthLoad;
+	ERenderTargetStoreAction DepthStore;
+	ERenderTargetLoadAction StencilLoad;
+	ERenderTargetStoreAction StencilStore;
+	uint32 NumSamples;
+
+	/** Lazily computed hash of the serialized description */
+	mutable uint32 Hash;
+
+	FPipelineCacheFileFormatPSO();
+
+	/**
+	 * Describes a pipeline state initializer.
+	 * Fails if a shader has no hash, or a state or vertex declaration was not created while the pipeline file cache was enabled.
+	 */
+	static bool Init(FPipelineCacheFileFormatPSO& PSO, const FGraphicsPipelineStateInitializer& Initializer);
+
+	friend RHI_API bool operator==(const FPipelineCacheFileFormatPSO& A, const FPipelineCacheFileFormatPSO& B);
+
+	friend RHI_API uint32 GetTypeHash(const FPipelineCacheFileFormatPSO& Key);
+
+	friend RHI_API FArchive& operator<<(FArchive& Ar, FPipelineCacheFileFormatPSO& Info);
+};
+
+/**
+ * Records the graphics pipeline states created during a run (r.PSOFileCache.LogPSO=1), and loads the recorded file shipped with the cooked build,
+ * so FShaderPipelineCache can compile them in the background before they're first drawn.
+ *
+ * Recorded files are saved to Saved/PipelineCaches/<Project>_<ShaderFormat>.upipelinecache with r.PSOFileCache.Save or on exit.
+ * To ship one, copy it to Content/PipelineCaches/ and add that directory to the project's DirectoriesToAlwaysStageAsUFS.
+ * All pipeline states used at runtime are looked up in the loaded file, and counted as file cache hits or misses (stat RHI).
+ */
+class RHI_API FPipelineFileCache
+{
+public:
+	/** Called by RHIInit, reads the r.PSOFileCache settings */
+	static void Initialize();
+
+	/** Called by RHIExit, saves the recorded pipeline states if logging and releases the state registry */
+	static void Shutdown();
+
+	/** Whether pipeline states are described and matched against the file cache at all (r.PSOFileCache.Enabled) */
+	static bool IsPipelineFileCacheEnabled();
+
+	/** Whether new pipeline states are recorded for saving (r.PSOFileCache.LogPSO) */
+	static bool IsPipelineFileCacheLogging();
+
+	/**
+	 * Loads the cooked pipeline file cache for the shader platform, and the states already recorded by previous runs when logging.
+	 *
+	 * @param Name		Name of the cache, normally the project name
+	 * @param Platform	The shader platform the pipeline states were recorded for
+	 * @return Whether a cooked file was found
+	 */
+	static bool OpenPipelineFileCache(const FString& Name, EShaderPlatform Platform);
+
+	/** Saves the recorded pipeline states to Saved/PipelineCaches */
+	static bool SavePipelineFileCache();
+
+	/** Gets all pipeline states of the cooked file cache, in the order they were recorded */
+	static void GetCachedPSOs(TArray<FPipelineCacheFileFormatPSO>& OutPSOs);
+
+	/** Whether the pipeline state was part of the cooked file cache */
+	static bool IsCachedPSO(const FPipelineCacheFileFormatPSO& PSO);
+
+	/** Records a pipeline state created at runtime, if logging */
+	static void CacheGraphicsPSO(const FPipelineCacheFileFormatPSO& PSO);
+
+	/** Updates the runtime statistics, for pipeline states that weren't created yet this run */
+	static void RecordFileCacheHit();
+	static void RecordFileCacheMiss();
+};
@@ -20,6 +20,19 @@ enum class EApplyRendertargetOption : int
 
 ENUM_CLASS_FLAGS(EApplyRendertargetOption);
 
+struct FPipelineCacheFileFormatPSO;
+
 extern RHI_API void SetComputePipelineState(FRHICommandList& RHICmdList, FRHIComputeShader* ComputeShader);
 extern RHI_API void SetGraphicsPipelineState(FRHICommandList& RHICmdList, const FGraphicsPipelineStateInitializer& Initializer, EApplyRendertargetOption ApplyFlags = EApplyRendertargetOption::CheckApply);
 extern RHI_API FGraphicsPipelineState* GetAndOrCreateGraphicsPipelineState(FRHICommandList& RHICmdList, const FGraphicsPipelineStateInitializer& OriginalInitializer, EApplyRendertargetOption ApplyFlags);
+
+/**
+ * Compiles a graphics pipeline state recorded in the pipeline file cache on a background task, so its first use this run doesn't hitch.
+ * The initializer must keep its shaders and states alive, it is matched against the pipeline states used later by description.
+ *
+ * @return Whether the compile was started, false if the pipeline state was already precompiled
+ */
+extern RHI_API bool PrecompileGraphicsPipelineState(const FGraphicsPipelineStateInitializer& Initializer, const FPipelineCacheFileFormatPSO& FileCachePSO);
+
+/** The number of precompiles started by PrecompileGraphicsPipelineState that didn't finish yet */
+extern RHI_API int32 GetNumPrecompilingGraphicsPipelineStates();
@@ -132,6 +132,9 @@ extern RHI_API bool GHardwareHiddenSurfaceRemoval;
 /** true if the RHI supports asynchronous creation of texture resources */
 extern RHI_API bool GRHISupportsAsyncTextureCreation;
 
+/** true if the RHI supports creating and initializing vertex and index buffers from any thread with RHIAsyncCreateVertexBuffer and RHIAsyncCreateIndexBuffer */
+extern RHI_API bool GRHISupportsAsyncBufferCreation;
+
 /** Can we handle quad primitives? */
 extern RHI_API bool GSupportsQuads;
 
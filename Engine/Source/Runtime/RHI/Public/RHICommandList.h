@@ -3004,6 +3004,16 @@ public:
 	{
 		return GDynamicRHI->RHIAsyncCreateTexture2D(SizeX, SizeY, Format, NumMips, Flags, InitialMipData, NumInitialMips);
 	}
+
+	FORCEINLINE FVertexBufferRHIRef AsyncCreateVertexBuffer(uint32 Size, uint32 InUsage, FRHIResourceCreateInfo& CreateInfo)
+	{
+		return GDynamicRHI->RHIAsyncCreateVertexBuffer(Size, InUsage, CreateInfo);
+	}
+
+	FORCEINLINE FIndexBufferRHIRef AsyncCreateIndexBuffer(uint32 Stride, uint32 Size, uint32 InUsage, FRHIResourceCreateInfo& CreateInfo)
+	{
+		return GDynamicRHI->RHIAsyncCreateIndexBuffer(Stride, Size, InUsage, CreateInfo);
+	}
 	
 	FORCEINLINE void CopySharedMips(FTexture2DRHIParamRef DestTexture2D, FTexture2DRHIParamRef SrcTexture2D)
 	{
@@ -3501,7 +3511,9 @@ struct FScopedCommandListWaitForTasks
 
 FORCEINLINE FVertexDeclarationRHIRef RHICreateVertexDeclaration(const FVertexDeclarationElementList& Elements)
 {
-	return FRHICommandListExecutor::GetImmediateCommandList().CreateVertexDeclaration(Elements);
+	FVertexDeclarationRHIRef VertexDeclaration = FRHICommandListExecutor::GetImmediateCommandList().CreateVertexDeclaration(Elements);
+	PipelineFileCacheRegisterVertexDeclaration(VertexDeclaration, Elements);
+	return VertexDeclaration;
 }
 
 FORCEINLINE FPixelShaderRHIRef RHICreatePixelShader(const TArray<uint8>& Code)
@@ -3689,6 +3701,16 @@ FORCEINLINE FTexture2DRHIRef RHIAsyncCreateTexture2D(uint32 SizeX, uint32 SizeY,
 	return FRHICommandListExecutor::GetImmediateCommandList().AsyncCreateTexture2D(SizeX, SizeY, Format, NumMips, Flags, InitialMipData, NumInitialMips);
 }
 
+FORCEINLINE FVertexBufferRHIRef RHIAsyncCreateVertexBuffer(uint32 Size, uint32 InUsage, FRHIResourceCreateInfo& CreateInfo)
+{
+	return FRHICommandListExecutor::GetImmediateCommandList().AsyncCreateVertexBuffer(Size, InUsage, CreateInfo);
+}
+
+FORCEINLINE FIndexBufferRHIRef RHIAsyncCreateIndexBuffer(uint32 Stride, uint32 Size, uint32 InUsage, FRHIResourceCreateInfo& CreateInfo)
+{
+	return FRHICommandListExecutor::GetImmediateCommandList().AsyncCreateIndexBuffer(Stride, Size, InUsage, CreateInfo);
+}
+
 FORCEINLINE void RHICopySharedMips(FTexture2DRHIParamRef DestTexture2D, FTexture2DRHIParamRef SrcTexture2D)
 {
 	return FRHICommandListExecutor::GetImmediateCommandList().CopySharedMips(DestTexture2D, SrcTexture2D);
@@ -19,6 +19,7 @@
 #include "Stats/StatsData.h"
 #include "HAL/ThreadHeartBeat.h"
 #include "RenderResource.h"
+#include "Misc/ScopeLock.h"
 
 //
 // Globals
@@ -1100,6 +1101,212 @@ FRHICommandListImmediate& GetImmediateCommandList_ForRenderCommand()
 	return FRHICommandListExecutor::GetImmediateCommandList();
 }
 
+static int32 GRenderCommandBatching = 1;
+static FAutoConsoleVariableRef CVarRenderCommandBatching(
+	TEXT("r.RenderCommandBatching"),
+	GRenderCommandBatching,
+	TEXT("Whether render commands are collected in batches that the rendering thread runs from a single task, instead of one task graph task per command.\n")
+	TEXT("Read only, switching at runtime would let commands overtake each other."),
+	ECVF_ReadOnly
+	);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Render Commands"), STAT_RenderCommands, STATGROUP_RenderThreadCommands);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Render Command Bytes"), STAT_RenderCommandBytes, STATGROUP_RenderThreadCommands);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Render Command Batches"), STAT_RenderCommandBatches, STATGROUP_RenderThreadCommands);
+
+namespace RenderCommandPipe
+{
+	/** Size of the chunks commands are allocated from, larger commands get a chunk of their own */
+	static const SIZE_T ChunkSize = 64 * 1024;
+
+	/** Number of unused chunks kept for the next batches */
+	static const int32 MaxFreeChunks = 16;
+
+	struct FChunk
+	{
+		FChunk* Next;
+		SIZE_T Size;
+
+		uint8* GetData()
+		{
+			return (uint8*)(this + 1);
+		}
+
+		uint8* GetEnd()
+		{
+			return (uint8*)this + Size;
+		}
+	};
+
+	/** Guards the open batch and the free chunks */
+	static FCriticalSection CriticalSection;
+
+	/** Batch new commands are added to, null once its task started running it */
+	static FRenderCommandBatch* OpenBatch = nullptr;
+
+	static FChunk* FreeChunks = nullptr;
+	static int32 NumFreeChunks = 0;
+
+	/** Called with the lock held */
+	static FChunk* AllocateChunk(SIZE_T Size)
+	{
+		FChunk* Chunk;
+		if (Size == ChunkSize && FreeChunks)
+		{
+			Chunk = FreeChunks;
+			FreeChunks = Chunk->Next;
+			NumFreeChunks--;
+		}
+		else
+		{
+			Chunk = (FChunk*)FMemory::Malloc(Size);
+			Chunk->Size = Size;
+		}
+		Chunk->Next = nullptr;
+		return Chunk;
+	}
+}
+
+/** Commands enqueued since the batch was opened, stored in the batch's chunks. The batch itself lives at the start of its first chunk. */
+struct FRenderCommandBatch
+{
+	FRenderCommandPipe::FCommand* First;
+	FRenderCommandPipe::FCommand* Last;
+
+	/** Chunks of the batch, the one being allocated from first */
+	RenderCommandPipe::FChunk* Chunks;
+	uint8* Cursor;
+
+	FRenderCommandBatch(RenderCommandPipe::FChunk* FirstChunk)
+		: First(nullptr)
+		, Last(nullptr)
+		, Chunks(FirstChunk)
+		, Cursor(FirstChunk->GetData() + sizeof(FRenderCommandBatch))
+	{
+	}
+};
+
+/** Runs a batch of render commands on the rendering thread */
+class FRenderCommandBatchTask : public FRenderCommand
+{
+public:
+	FRenderCommandBatchTask(FRenderCommandBatch* InBatch)
+		: Batch(InBatch)
+	{
+	}
+
+	void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+	{
+		FRenderCommandPipe::ExecuteBatch(Batch);
+	}
+
+	FORCEINLINE TStatId GetStatId() const
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(FRenderCommandBatchTask, STATGROUP_RenderThreadCommands);
+	}
+
+private:
+	FRenderCommandBatch* Batch;
+};
+
+void* FRenderCommandPipe::AllocateCommand(SIZE_T Size, uint32 Alignment)
+{
+	using namespace RenderCommandPipe;
+
+	if (!GRenderCommandBatching)
+	{
+		return nullptr;
+	}
+
+	// Released by AddCommand once the command is constructed and linked
+	CriticalSection.Lock();
+
+	if (!OpenBatch)
+	{
+		FChunk* Chunk = AllocateChunk(ChunkSize);
+		OpenBatch = new (Chunk->GetData()) FRenderCommandBatch(Chunk);
+
+		// The task can't run the batch before this command is linked, closing the batch needs the lock
+		TGraphTask<FRenderCommandBatchTask>::CreateTask().ConstructAndDispatchWhenReady(OpenBatch);
+		INC_DWORD_STAT(STAT_RenderCommandBatches);
+	}
+
+	FRenderCommandBatch* Batch = OpenBatch;
+	uint8* Memory = Align(Batch->Cursor, Alignment);
+	if (Memory + Size > Batch->Chunks->GetEnd())
+	{
+		FChunk* Chunk = AllocateChunk(FMath::Max<SIZE_T>(ChunkSize, sizeof(FChunk) + Size + Alignment));
+		Chunk->Next = Batch->Chunks;
+		Batch->Chunks = Chunk;
+		Memory = Align(Chunk->GetData(), Alignment);
+	}
+	Batch->Cursor = Memory + Size;
+
+	return Memory;
+}
+
+void FRenderCommandPipe::AddCommand(FCommand* Command, SIZE_T Size)
+{
+	using namespace RenderCommandPipe;
+
+	FRenderCommandBatch* Batch = OpenBatch;
+	if (Batch->Last)
+	{
+		Batch->Last->Next = Command;
+	}
+	else
+	{
+		Batch->First = Command;
+	}
+	Batch->Last = Command;
+
+	CriticalSection.Unlock();
+
+	INC_DWORD_STAT(STAT_RenderCommands);
+	INC_DWORD_STAT_BY(STAT_RenderCommandBytes, Size);
+}
+
+void FRenderCommandPipe::ExecuteBatch(FRenderCommandBatch* Batch)
+{
+	using namespace RenderCommandPipe;
+
+	// Commands enqueued from now on, including by the commands below, go to a new batch with its own task
+	{
+		FScopeLock Lock(&CriticalSection);
+		if (OpenBatch == Batch)
+		{
+			OpenBatch = nullptr;
+		}
+	}
+
+	FCommand* Command = Batch->First;
+	while (Command)
+	{
+		FCommand* Next = Command->Next;
+		Command->Execute();
+		Command->~FCommand();
+		Command = Next;
+	}
+
+	FScopeLock Lock(&CriticalSection);
+	FChunk* Chunk = Batch->Chunks;
+	while (Chunk)
+	{
+		FChunk* Next = Chunk->Next;
+		if (Chunk->Size == ChunkSize && NumFreeChunks < MaxFreeChunks)
+		{
+			Chunk->Next = FreeChunks;
+			FreeChunks = Chunk;
+			NumFreeChunks++;
+		}
+		else
+		{
+			FMemory::Free(Chunk);
+		}
+		Chunk = Next;
+	}
+}
+
 /** The set of deferred cleanup objects which are pending cleanup. */
 static TLockFreePointerListUnordered<FDeferredCleanupInterface, PLATFORM_CACHE_LINE_SIZE>	PendingCleanupObjectsList;
 
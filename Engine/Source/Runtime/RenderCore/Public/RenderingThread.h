@@ -168,6 +168,86 @@ DECLARE_STATS_GROUP(TEXT("Render Thread Commands"), STATGROUP_RenderThreadComman
 	#define	ShouldExecuteOnRenderThread()			(LIKELY(GIsThreadedRendering || !IsInGameThread()))
 #endif // UE_SERVER
 
+/**
+ * Queue of render commands waiting for the rendering thread.
+ *
+ * Commands are constructed in place in chunks of linear memory instead of being allocated as one task graph task each.
+ * The first command of a batch dispatches a single task to the rendering thread, which runs every command added to the batch
+ * until the task starts. Later commands start a new batch, so commands still run in the order they were enqueued.
+ */
+struct FRenderCommandBatch;
+
+class RENDERCORE_API FRenderCommandPipe
+{
+public:
+	/** Command stored in a batch, destroyed once it has run */
+	class FCommand
+	{
+	public:
+		FCommand()
+			: Next(nullptr)
+		{
+		}
+
+		virtual ~FCommand() {}
+
+		virtual void Execute() = 0;
+
+		/** Next command of the batch */
+		FCommand* Next;
+	};
+
+	/**
+	 * Enqueues a render command type as the task graph would construct it.
+	 * Falls back to a task graph task per command if batching is disabled.
+	 */
+	template<typename TCommandType, typename... ArgTypes>
+	static FORCEINLINE_DEBUGGABLE void Enqueue(ArgTypes&&... Args)
+	{
+		typedef TCommand<TCommandType> FCommandType;
+
+		void* Memory = AllocateCommand(sizeof(FCommandType), ALIGNOF(FCommandType));
+		if (Memory)
+		{
+			AddCommand(new (Memory) FCommandType(Forward<ArgTypes>(Args)...), sizeof(FCommandType));
+		}
+		else
+		{
+			TGraphTask<TCommandType>::CreateTask().ConstructAndDispatchWhenReady(Forward<ArgTypes>(Args)...);
+		}
+	}
+
+	/** Runs the commands of a batch and frees it, called on the rendering thread by the batch's task */
+	static void ExecuteBatch(FRenderCommandBatch* Batch);
+
+private:
+	template<typename TCommandType>
+	class TCommand final : public FCommand
+	{
+	public:
+		template<typename... ArgTypes>
+		explicit TCommand(ArgTypes&&... Args)
+			: Command(Forward<ArgTypes>(Args)...)
+		{
+		}
+
+		virtual void Execute() override
+		{
+			FScopeCycleCounter Scope(Command.GetStatId());
+			Command.DoTask(ENamedThreads::RenderThread, FGraphEventRef());
+		}
+
+	private:
+		TCommandType Command;
+	};
+
+	/** Returns memory for a command in the open batch and keeps the queue locked until AddCommand, or returns null if batching is disabled */
+	static void* AllocateCommand(SIZE_T Size, uint32 Alignment);
+
+	/** Appends the command constructed in the memory returned by AllocateCommand to the open batch */
+	static void AddCommand(FCommand* Command, SIZE_T Size);
+};
+
 #define TASK_FUNCTION(Code) \
 		void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) \
 		{ \
@@ -250,7 +330,7 @@ FORCEINLINE_DEBUGGABLE void EnqueueUniqueRenderCommand(LAMBDA&& Lambda)
 	if (ShouldExecuteOnRenderThread())
 	{
 		CheckNotBlockedOnRenderThread();
-		TGraphTask<EURCType>::CreateTask().ConstructAndDispatchWhenReady(Forward<LAMBDA>(Lambda));
+		FRenderCommandPipe::Enqueue<EURCType>(Forward<LAMBDA>(Lambda));
 	}
 	else
 	{
@@ -290,7 +370,7 @@ FORCEINLINE_DEBUGGABLE void EnqueueUniqueRenderCommand(LAMBDA& Lambda)
 		{ \
 			CheckNotBlockedOnRenderThread(); \
 			check(ENamedThreads::GameThread != ENamedThreads::RenderThread); \
-			TGraphTask<EURCMacro_##TypeName>::CreateTask().ConstructAndDispatchWhenReady(); \
+			FRenderCommandPipe::Enqueue<EURCMacro_##TypeName>(); \
 		} \
 		else \
 		{ \
@@ -324,7 +404,7 @@ FORCEINLINE_DEBUGGABLE void EnqueueUniqueRenderCommand(LAMBDA& Lambda)
 		if(ShouldExecuteOnRenderThread()) \
 		{ \
 			CheckNotBlockedOnRenderThread(); \
-			TGraphTask<EURCMacro_##TypeName>::CreateTask().ConstructAndDispatchWhenReady(ParamValue1); \
+			FRenderCommandPipe::Enqueue<EURCMacro_##TypeName>(ParamValue1); \
 		} \
 		else \
 		{ \
@@ -371,7 +451,7 @@ FORCEINLINE_DEBUGGABLE void EnqueueUniqueRenderCommand(LAMBDA& Lambda)
 		if(ShouldExecuteOnRenderThread()) \
 		{ \
 			CheckNotBlockedOnRenderThread(); \
-			TGraphTask<EURCMacro_##TypeName>::CreateTask().ConstructAndDispatchWhenReady(ParamValue1,ParamValue2); \
+			FRenderCommandPipe::Enqueue<EURCMacro_##TypeName>(ParamValue1,ParamValue2); \
 		} \
 		else \
 		{ \
@@ -420,7 +500,7 @@ FORCEINLINE_DEBUGGABLE void EnqueueUniqueRenderCommand(LAMBDA& Lambda)
 		if(ShouldExecuteOnRenderThread()) \
 		{ \
 			CheckNotBlockedOnRenderThread(); \
-			TGraphTask<EURCMacro_##TypeName>::CreateTask().ConstructAndDispatchWhenReady(ParamValue1,ParamValue2,ParamValue3); \
+			FRenderCommandPipe::Enqueue<EURCMacro_##TypeName>(ParamValue1,ParamValue2,ParamValue3); \
 		} \
 		else \
 		{ \
@@ -472,7 +552,7 @@ FORCEINLINE_DEBUGGABLE void EnqueueUniqueRenderCommand(LAMBDA& Lambda)
 		if(ShouldExecuteOnRenderThread()) \
 		{ \
 			CheckNotBlockedOnRenderThread(); \
-			TGraphTask<EURCMacro_##TypeName>::CreateTask().ConstructAndDispatchWhenReady(ParamValue1,ParamValue2,ParamValue3,ParamValue4); \
+			FRenderCommandPipe::Enqueue<EURCMacro_##TypeName>(ParamValue1,ParamValue2,ParamValue3,ParamValue4); \
 		} \
 		else \
 		{ \
@@ -526,7 +606,7 @@ FORCEINLINE_DEBUGGABLE void EnqueueUniqueRenderCommand(LAMBDA& Lambda)
 		if(ShouldExecuteOnRenderThread()) \
 		{ \
 			CheckNotBlockedOnRenderThread(); \
-			TGraphTask<EURCMacro_##TypeName>::CreateTask().ConstructAndDispatchWhenReady(ParamValue1,ParamValue2,ParamValue3,ParamValue4,ParamValue5); \
+			FRenderCommandPipe::Enqueue<EURCMacro_##TypeName>(ParamValue1,ParamValue2,ParamValue3,ParamValue4,ParamValue5); \
 		} \
 		else \
 		{ \
@@ -582,7 +662,7 @@ FORCEINLINE_DEBUGGABLE void EnqueueUniqueRenderCommand(LAMBDA& Lambda)
 		if(ShouldExecuteOnRenderThread()) \
 		{ \
 			CheckNotBlockedOnRenderThread(); \
-			TGraphTask<EURCMacro_##TypeName>::CreateTask().ConstructAndDispatchWhenReady(ParamValue1,ParamValue2,ParamValue3,ParamValue4,ParamValue5,ParamValue6); \
+			FRenderCommandPipe::Enqueue<EURCMacro_##TypeName>(ParamValue1,ParamValue2,ParamValue3,ParamValue4,ParamValue5,ParamValue6); \
 		} \
 		else \
 		{ \
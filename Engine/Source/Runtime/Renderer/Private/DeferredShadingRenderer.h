@@ -377,6 +377,9 @@ private:
 	/** Accumulates direct lighting for simple lights. */
 	void InjectSimpleTranslucentVolumeLightingArray(FRHICommandListImmediate& RHICmdList, const FSimpleLightArray& SimpleLights);
 
+	/** Whether any visible lit translucency reads the direct lighting injected into the translucency lighting volumes. */
+	bool ShouldInjectTranslucentVolumeLighting() const;
+
 	/** Filters the translucency lighting volumes to reduce aliasing. */
 	void FilterTranslucentVolumeLighting(FRHICommandListImmediate& RHICmdList);
 
@@ -52,6 +52,11 @@ FAutoConsoleVariableRef CVarAsyncComputeDFShadowing(
 	ECVF_Scalability | ECVF_RenderThreadSafe
 	);
 
+static bool ShouldUseAsyncComputeForDFShadowing()
+{
+	return GAsyncComputeDFShadowing && GSupportsEfficientAsyncCompute;
+}
+
 int32 GShadowScatterTileCulling = 1;
 FAutoConsoleVariableRef CVarShadowScatterTileCulling(
 	TEXT("r.DFShadowScatterTileCulling"),
@@ -920,7 +925,7 @@ void FProjectedShadowInfo::BeginRenderRayTracedDistanceFieldProjection(FRHIComma
 			SCOPED_DRAW_EVENT(RHICmdList, RayTraceShadows);
 			SetRenderTarget(RHICmdList, NULL, NULL);
 
-			if (GAsyncComputeDFShadowing)
+			if (ShouldUseAsyncComputeForDFShadowing())
 			{
 				FRHIAsyncComputeCommandListImmediate& RHICmdListComputeImmediate = FRHICommandListExecutor::GetImmediateAsyncComputeCommandList();
 				static const FName RTShadowBeginComputeName(TEXT("RTShadowComputeBegin"));
@@ -952,7 +957,7 @@ void FProjectedShadowInfo::RenderRayTracedDistanceFieldProjection(FRHICommandLis
 		QUICK_SCOPE_CYCLE_COUNTER(STAT_RenderRayTracedDistanceFieldShadows);
 		SCOPED_DRAW_EVENT(RHICmdList, RayTracedDistanceFieldShadow);
 
-		if (GAsyncComputeDFShadowing)
+		if (IsValidRef(RayTracedShadowsEndFence))
 		{
 			RHICmdList.WaitComputeFence(RayTracedShadowsEndFence);
 		}
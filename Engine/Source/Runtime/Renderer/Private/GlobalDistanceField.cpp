@@ -8,6 +8,7 @@
 #include "DistanceFieldLightingShared.h"
 #include "RendererModule.h"
 #include "ClearQuad.h"
+#include "ClearReplacementShaders.h"
 
 int32 GAOGlobalDistanceField = 1;
 FAutoConsoleVariableRef CVarAOGlobalDistanceField(
@@ -26,6 +27,15 @@ FAutoConsoleVariableRef CVarAOUpdateGlobalDistanceField(
 	ECVF_RenderThreadSafe
 	);
 
+int32 GAOGlobalDistanceFieldAsyncCompute = 0;
+FAutoConsoleVariableRef CVarAOGlobalDistanceFieldAsyncCompute(
+	TEXT("r.AOGlobalDistanceFieldAsyncCompute"),
+	GAOGlobalDistanceFieldAsyncCompute,
+	TEXT("Whether to update the global distance field on the async compute pipe, overlapped with the depth prepass, shadow depths and base pass.\n")
+	TEXT("Only used when no material or GPU particle collision reads the global distance field before the base pass is done, and no heightfield has to be composited into it this frame."),
+	ECVF_Scalability | ECVF_RenderThreadSafe
+	);
+
 int32 GAOGlobalDistanceFieldCacheMostlyStaticSeparately = 1;
 FAutoConsoleVariableRef CVarAOGlobalDistanceFieldCacheMostlyStaticSeparately(
 	TEXT("r.AOGlobalDistanceFieldCacheMostlyStaticSeparately"),
@@ -170,7 +180,8 @@ public:
 	{
 	}
 
-	void SetParameters(FRHICommandList& RHICmdList, const FScene* Scene, const FSceneView& View, float MaxOcclusionDistance, const FVector4& VolumeBoundsValue, FGlobalDFCacheType CacheType)
+	template<typename TRHICommandList>
+	void SetParameters(TRHICommandList& RHICmdList, const FScene* Scene, const FSceneView& View, float MaxOcclusionDistance, const FVector4& VolumeBoundsValue, FGlobalDFCacheType CacheType)
 	{
 		FComputeShaderRHIParamRef ShaderRHI = GetComputeShader();
 		FGlobalShader::SetParameters<FViewUniformShaderParameters>(RHICmdList, ShaderRHI, View.ViewUniformBuffer);
@@ -206,7 +217,8 @@ public:
 		SetShaderValue(RHICmdList, ShaderRHI, AcceptOftenMovingObjectsOnly, AcceptOftenMovingObjectsOnlyValue);
 	}
 
-	void UnsetParameters(FRHICommandList& RHICmdList, const FScene* Scene)
+	template<typename TRHICommandList>
+	void UnsetParameters(TRHICommandList& RHICmdList, const FScene* Scene)
 	{
 		ObjectBufferParameters.UnsetParameters(RHICmdList, GetComputeShader(), *(Scene->DistanceFieldSceneData.ObjectBuffers));
 		CulledObjectParameters.UnsetParameters(RHICmdList, GetComputeShader());
@@ -309,8 +321,9 @@ public:
 	{
 	}
 
+	template<typename TRHICommandList>
 	void SetParameters(
-		FRHICommandList& RHICmdList, 
+		TRHICommandList& RHICmdList, 
 		const FScene* Scene, 
 		const FSceneView& View, 
 		float MaxOcclusionDistance, 
@@ -341,7 +354,8 @@ public:
 		SetShaderValue(RHICmdList, ShaderRHI, AOGlobalMaxSphereQueryRadius, GlobalMaxSphereQueryRadius);
 	}
 
-	void UnsetParameters(FRHICommandList& RHICmdList)
+	template<typename TRHICommandList>
+	void UnsetParameters(TRHICommandList& RHICmdList)
 	{
 		CulledObjectGrid.UnsetUAV(RHICmdList, GetComputeShader());
 		RHICmdList.TransitionResource(EResourceTransitionAccess::EReadable, EResourceTransitionPipeline::EComputeToCompute, GObjectGridBuffers.CulledObjectGrid.UAV);
@@ -417,8 +431,9 @@ public:
 	{
 	}
 
+	template<typename TRHICommandList>
 	void SetParameters(
-		FRHICommandList& RHICmdList, 
+		TRHICommandList& RHICmdList, 
 		const FScene* Scene, 
 		const FSceneView& View, 
 		float MaxOcclusionDistance, 
@@ -465,7 +480,8 @@ public:
 		SetShaderValue(RHICmdList, ShaderRHI, AOGlobalMaxSphereQueryRadius, GlobalMaxSphereQueryRadius);
 	}
 
-	void UnsetParameters(FRHICommandList& RHICmdList,const FGlobalDistanceFieldClipmap& Clipmap)
+	template<typename TRHICommandList>
+	void UnsetParameters(TRHICommandList& RHICmdList,const FGlobalDistanceFieldClipmap& Clipmap)
 	{
 		GlobalDistanceFieldTexture.UnsetUAV(RHICmdList, GetComputeShader());
 
@@ -1223,6 +1239,186 @@ void FViewInfo::SetupGlobalDistanceFieldUniformBufferParameters(FViewUniformShad
 	ViewUniformShaderParameters.GlobalDistanceFieldSampler3_UB = TStaticSamplerState<SF_Bilinear, AM_Wrap, AM_Wrap, AM_Wrap>::GetRHI();
 }
 
+/** Clears the indirect arguments of the culled objects, the async compute command list has no tiny UAV clear */
+static void ClearCulledObjectIndirectArguments(FRHICommandListImmediate& RHICmdList)
+{
+	ClearUAV(RHICmdList, GMaxRHIFeatureLevel, GGlobalDistanceFieldCulledObjectBuffers.Buffers.ObjectIndirectArguments, 0);
+}
+
+static void ClearCulledObjectIndirectArguments(FRHIAsyncComputeCommandListImmediate& RHICmdList)
+{
+	const FRWBuffer& ObjectIndirectArguments = GGlobalDistanceFieldCulledObjectBuffers.Buffers.ObjectIndirectArguments;
+
+	TShaderMapRef<FClearBufferReplacementCS> ComputeShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
+	FComputeShaderRHIParamRef ShaderRHI = ComputeShader->GetComputeShader();
+	RHICmdList.SetComputeShader(ShaderRHI);
+	SetShaderValue(RHICmdList, ShaderRHI, ComputeShader->ClearDword, 0u);
+	RHICmdList.SetUAVParameter(ShaderRHI, ComputeShader->ClearBufferRW.GetBaseIndex(), ObjectIndirectArguments.UAV);
+
+	const uint32 NumDwords = FMath::DivideAndRoundUp<uint32>(ObjectIndirectArguments.NumBytes, 4);
+	DispatchComputeShader(RHICmdList, *ComputeShader, FMath::DivideAndRoundUp<uint32>(NumDwords, 64), 1, 1);
+
+	RHICmdList.SetUAVParameter(ShaderRHI, ComputeShader->ClearBufferRW.GetBaseIndex(), FUnorderedAccessViewRHIRef());
+}
+
+static void CompositeHeightfieldsIntoGlobalDistanceField(
+	FRHICommandListImmediate& RHICmdList,
+	const FScene* Scene,
+	const FViewInfo& View,
+	float MaxOcclusionDistance,
+	const FGlobalDistanceFieldInfo& GlobalDistanceFieldInfo,
+	int32 ClipmapIndex,
+	const FVolumeUpdateRegion& UpdateRegion)
+{
+	View.HeightfieldLightingViewInfo.CompositeHeightfieldsIntoGlobalDistanceField(RHICmdList, Scene, View, MaxOcclusionDistance, GlobalDistanceFieldInfo, ClipmapIndex, UpdateRegion);
+}
+
+static void CompositeHeightfieldsIntoGlobalDistanceField(
+	FRHIAsyncComputeCommandListImmediate& RHICmdList,
+	const FScene* Scene,
+	const FViewInfo& View,
+	float MaxOcclusionDistance,
+	const FGlobalDistanceFieldInfo& GlobalDistanceFieldInfo,
+	int32 ClipmapIndex,
+	const FVolumeUpdateRegion& UpdateRegion)
+{
+	// Heightfield descriptions are uploaded between dispatches, which is only safe on the graphics pipe
+	checkf(false, TEXT("Heightfields have to be composited into the global distance field on the graphics pipe, see CanUpdateGlobalDistanceFieldOnAsyncCompute"));
+}
+
+/** Whether any heightfield will be composited into the update regions of the clipmaps */
+static bool HasHeightfieldUpdateRegions(const FScene* Scene, const FGlobalDistanceFieldInfo& GlobalDistanceFieldInfo)
+{
+	if (GAOGlobalDistanceFieldRepresentHeightfields && Scene->DistanceFieldSceneData.HeightfieldPrimitives.Num() > 0)
+	{
+		for (int32 CacheType = 0; CacheType < GDF_Num; CacheType++)
+		{
+			const TArray<FGlobalDistanceFieldClipmap>& Clipmaps = CacheType == GDF_MostlyStatic 
+				? GlobalDistanceFieldInfo.MostlyStaticClipmaps 
+				: GlobalDistanceFieldInfo.Clipmaps;
+
+			for (const FGlobalDistanceFieldClipmap& Clipmap : Clipmaps)
+			{
+				for (const FVolumeUpdateRegion& UpdateRegion : Clipmap.UpdateRegions)
+				{
+					if (UpdateRegion.UpdateType & VUT_Heightfields)
+					{
+						return true;
+					}
+				}
+			}
+		}
+	}
+
+	return false;
+}
+
+/** 
+ * Whether the clipmap updates can run on the async compute pipe, overlapped with the depth prepass, shadow depths and base pass.
+ * Nothing that reads the global distance field may run before the base pass is done, see WaitForGlobalDistanceFieldVolumeUpdate.
+ */
+static bool CanUpdateGlobalDistanceFieldOnAsyncCompute(const FViewInfo& View, const FScene* Scene, const FGlobalDistanceFieldInfo& GlobalDistanceFieldInfo)
+{
+	return GAOGlobalDistanceFieldAsyncCompute
+		&& GSupportsEfficientAsyncCompute
+		// Materials sampling the global distance field are drawn in the depth prepass and base pass
+		&& !View.bUsesGlobalDistanceField
+		// GPU particle collision samples it in FXSystem PreRender
+		&& !(Scene->FXSystem && Scene->FXSystem->UsesGlobalDistanceField())
+		&& !HasHeightfieldUpdateRegions(Scene, GlobalDistanceFieldInfo);
+}
+
+/** Culls the objects to the update regions of the clipmaps and composites them into the volume textures */
+template<typename TRHICommandList>
+static void UpdateGlobalDistanceFieldClipmaps(
+	TRHICommandList& RHICmdList, 
+	const FViewInfo& View, 
+	const FScene* Scene, 
+	float MaxOcclusionDistance, 
+	const FGlobalDistanceFieldInfo& GlobalDistanceFieldInfo)
+{
+	const FGlobalDFCacheType StartCacheType = GAOGlobalDistanceFieldCacheMostlyStaticSeparately ? GDF_MostlyStatic : GDF_Full;
+
+	for (int32 CacheType = StartCacheType; CacheType < GDF_Num; CacheType++)
+	{
+		const TArray<FGlobalDistanceFieldClipmap>& Clipmaps = CacheType == GDF_MostlyStatic 
+			? GlobalDistanceFieldInfo.MostlyStaticClipmaps 
+			: GlobalDistanceFieldInfo.Clipmaps;
+
+		for (int32 ClipmapIndex = 0; ClipmapIndex < Clipmaps.Num(); ClipmapIndex++)
+		{
+			const FGlobalDistanceFieldClipmap& Clipmap = Clipmaps[ClipmapIndex];
+
+			for (int32 UpdateRegionIndex = 0; UpdateRegionIndex < Clipmap.UpdateRegions.Num(); UpdateRegionIndex++)
+			{
+				const FVolumeUpdateRegion& UpdateRegion = Clipmap.UpdateRegions[UpdateRegionIndex];
+
+				if (UpdateRegion.UpdateType & VUT_MeshDistanceFields)
+				{
+					// Cull the global objects to the volume being updated
+					{
+						ClearCulledObjectIndirectArguments(RHICmdList);
+
+						TShaderMapRef<FCullObjectsForVolumeCS> ComputeShader(View.ShaderMap);
+						RHICmdList.SetComputeShader(ComputeShader->GetComputeShader());
+						const FVector4 VolumeBounds(UpdateRegion.Bounds.GetCenter(), UpdateRegion.Bounds.GetExtent().Size());
+						ComputeShader->SetParameters(RHICmdList, Scene, View, MaxOcclusionDistance, VolumeBounds, (FGlobalDFCacheType)CacheType);
+
+						DispatchComputeShader(RHICmdList, *ComputeShader, FMath::DivideAndRoundUp<uint32>(Scene->DistanceFieldSceneData.NumObjectsInBuffer, CullObjectsGroupSize), 1, 1);
+						ComputeShader->UnsetParameters(RHICmdList, Scene);
+					}
+
+					// Further cull the objects into a low resolution grid
+					{
+						TShaderMapRef<FCullObjectsToGridCS> ComputeShader(View.ShaderMap);
+						RHICmdList.SetComputeShader(ComputeShader->GetComputeShader());
+						ComputeShader->SetParameters(RHICmdList, Scene, View, MaxOcclusionDistance, GlobalDistanceFieldInfo, ClipmapIndex, UpdateRegion);
+
+						const uint32 NumGroupsX = FMath::DivideAndRoundUp<int32>(UpdateRegion.CellsSize.X, GCullGridTileSize);
+						const uint32 NumGroupsY = FMath::DivideAndRoundUp<int32>(UpdateRegion.CellsSize.Y, GCullGridTileSize);
+						const uint32 NumGroupsZ = FMath::DivideAndRoundUp<int32>(UpdateRegion.CellsSize.Z, GCullGridTileSize); 
+
+						DispatchComputeShader(RHICmdList, *ComputeShader, NumGroupsX, NumGroupsY, NumGroupsZ);
+						ComputeShader->UnsetParameters(RHICmdList);
+					}
+
+					// Further cull the objects to the dispatch tile and composite the global distance field by computing the min distance from intersecting per-object distance fields
+					{
+						//@todo - match typical update sizes.  Camera movement creates narrow slabs.
+						const uint32 NumGroupsX = FMath::DivideAndRoundUp<int32>(UpdateRegion.CellsSize.X, CompositeTileSize);
+						const uint32 NumGroupsY = FMath::DivideAndRoundUp<int32>(UpdateRegion.CellsSize.Y, CompositeTileSize);
+						const uint32 NumGroupsZ = FMath::DivideAndRoundUp<int32>(UpdateRegion.CellsSize.Z, CompositeTileSize);
+
+						IPooledRenderTarget* ParentDistanceField = GlobalDistanceFieldInfo.MostlyStaticClipmaps[ClipmapIndex].RenderTarget;
+
+						if (CacheType == GDF_Full && GAOGlobalDistanceFieldCacheMostlyStaticSeparately && ParentDistanceField)
+						{
+							TShaderMapRef<TCompositeObjectDistanceFieldsCS<true>> ComputeShader(View.ShaderMap);
+							RHICmdList.SetComputeShader(ComputeShader->GetComputeShader());
+							ComputeShader->SetParameters(RHICmdList, Scene, View, MaxOcclusionDistance, GlobalDistanceFieldInfo.ParameterData, Clipmap, ParentDistanceField, ClipmapIndex, UpdateRegion);
+							DispatchComputeShader(RHICmdList, *ComputeShader, NumGroupsX, NumGroupsY, NumGroupsZ);
+							ComputeShader->UnsetParameters(RHICmdList, Clipmap);
+						}
+						else
+						{
+							TShaderMapRef<TCompositeObjectDistanceFieldsCS<false>> ComputeShader(View.ShaderMap);
+							RHICmdList.SetComputeShader(ComputeShader->GetComputeShader());
+							ComputeShader->SetParameters(RHICmdList, Scene, View, MaxOcclusionDistance, GlobalDistanceFieldInfo.ParameterData, Clipmap, NULL, ClipmapIndex, UpdateRegion);
+							DispatchComputeShader(RHICmdList, *ComputeShader, NumGroupsX, NumGroupsY, NumGroupsZ);
+							ComputeShader->UnsetParameters(RHICmdList, Clipmap);
+						}
+					}
+				}
+
+				if (UpdateRegion.UpdateType & VUT_Heightfields)
+				{
+					CompositeHeightfieldsIntoGlobalDistanceField(RHICmdList, Scene, View, MaxOcclusionDistance, GlobalDistanceFieldInfo, ClipmapIndex, UpdateRegion);
+				}
+			}
+		}
+	}
+}
+
 /** 
  * Updates the global distance field for a view.  
  * Typically issues updates for just the newly exposed regions of the volume due to camera movement.
@@ -1257,8 +1453,6 @@ void UpdateGlobalDistanceFieldVolume(
 
 		if (bHasUpdateRegions && GAOUpdateGlobalDistanceField)
 		{
-			SCOPED_DRAW_EVENT(RHICmdList, UpdateGlobalDistanceFieldVolume);
-
 			if (GGlobalDistanceFieldCulledObjectBuffers.Buffers.MaxObjects < Scene->DistanceFieldSceneData.NumObjectsInBuffer
 				|| GGlobalDistanceFieldCulledObjectBuffers.Buffers.MaxObjects > 3 * Scene->DistanceFieldSceneData.NumObjectsInBuffer)
 			{
@@ -1275,98 +1469,65 @@ void UpdateGlobalDistanceFieldVolume(
 				GObjectGridBuffers.UpdateRHI();
 			}
 
-			const FGlobalDFCacheType StartCacheType = GAOGlobalDistanceFieldCacheMostlyStaticSeparately ? GDF_MostlyStatic : GDF_Full;
-
-			for (int32 CacheType = StartCacheType; CacheType < GDF_Num; CacheType++)
+			if (CanUpdateGlobalDistanceFieldOnAsyncCompute(View, Scene, GlobalDistanceFieldInfo))
 			{
-				TArray<FGlobalDistanceFieldClipmap>& Clipmaps = CacheType == GDF_MostlyStatic 
-					? GlobalDistanceFieldInfo.MostlyStaticClipmaps 
-					: GlobalDistanceFieldInfo.Clipmaps;
+				TArray<FUnorderedAccessViewRHIParamRef, TInlineAllocator<GMaxGlobalDistanceFieldClipmaps * 2>> ClipmapUAVs;
 
-				for (int32 ClipmapIndex = 0; ClipmapIndex < Clipmaps.Num(); ClipmapIndex++)
+				for (int32 CacheType = 0; CacheType < GDF_Num; CacheType++)
 				{
-					SCOPED_DRAW_EVENTF(RHICmdList, Clipmap, TEXT("CacheType %u Clipmap %u"), CacheType, ClipmapIndex);
+					const TArray<FGlobalDistanceFieldClipmap>& Clipmaps = CacheType == GDF_MostlyStatic 
+						? GlobalDistanceFieldInfo.MostlyStaticClipmaps 
+						: GlobalDistanceFieldInfo.Clipmaps;
 
-					FGlobalDistanceFieldClipmap& Clipmap = Clipmaps[ClipmapIndex];
-
-					for (int32 UpdateRegionIndex = 0; UpdateRegionIndex < Clipmap.UpdateRegions.Num(); UpdateRegionIndex++)
+					for (const FGlobalDistanceFieldClipmap& Clipmap : Clipmaps)
 					{
-						const FVolumeUpdateRegion& UpdateRegion = Clipmap.UpdateRegions[UpdateRegionIndex];
-
-						if (UpdateRegion.UpdateType & VUT_MeshDistanceFields)
+						if (Clipmap.RenderTarget)
 						{
-							{
-								SCOPED_DRAW_EVENT(RHICmdList, GridCull);
-
-								// Cull the global objects to the volume being updated
-								{
-									ClearUAV(RHICmdList, GMaxRHIFeatureLevel, GGlobalDistanceFieldCulledObjectBuffers.Buffers.ObjectIndirectArguments, 0);
-
-									TShaderMapRef<FCullObjectsForVolumeCS> ComputeShader(View.ShaderMap);
-									RHICmdList.SetComputeShader(ComputeShader->GetComputeShader());
-									const FVector4 VolumeBounds(UpdateRegion.Bounds.GetCenter(), UpdateRegion.Bounds.GetExtent().Size());
-									ComputeShader->SetParameters(RHICmdList, Scene, View, MaxOcclusionDistance, VolumeBounds, (FGlobalDFCacheType)CacheType);
-
-									DispatchComputeShader(RHICmdList, *ComputeShader, FMath::DivideAndRoundUp<uint32>(Scene->DistanceFieldSceneData.NumObjectsInBuffer, CullObjectsGroupSize), 1, 1);
-									ComputeShader->UnsetParameters(RHICmdList, Scene);
-								}
+							ClipmapUAVs.Add(Clipmap.RenderTarget->GetRenderTargetItem().UAV);
+						}
+					}
+				}
 
-								// Further cull the objects into a low resolution grid
-								{
-									TShaderMapRef<FCullObjectsToGridCS> ComputeShader(View.ShaderMap);
-									RHICmdList.SetComputeShader(ComputeShader->GetComputeShader());
-									ComputeShader->SetParameters(RHICmdList, Scene, View, MaxOcclusionDistance, GlobalDistanceFieldInfo, ClipmapIndex, UpdateRegion);
+				static const FName BeginComputeFenceName(TEXT("GlobalDistanceFieldUpdateBeginComputeFence"));
+				static const FName EndComputeFenceName(TEXT("GlobalDistanceFieldUpdateEndComputeFence"));
+				FComputeFenceRHIRef BeginFence = RHICmdList.CreateComputeFence(BeginComputeFenceName);
+				GlobalDistanceFieldInfo.UpdateEndFence = RHICmdList.CreateComputeFence(EndComputeFenceName);
 
-									const uint32 NumGroupsX = FMath::DivideAndRoundUp<int32>(UpdateRegion.CellsSize.X, GCullGridTileSize);
-									const uint32 NumGroupsY = FMath::DivideAndRoundUp<int32>(UpdateRegion.CellsSize.Y, GCullGridTileSize);
-									const uint32 NumGroupsZ = FMath::DivideAndRoundUp<int32>(UpdateRegion.CellsSize.Z, GCullGridTileSize); 
+				// The clipmaps were last read by the graphics pipe in the previous frame
+				RHICmdList.TransitionResources(EResourceTransitionAccess::ERWBarrier, EResourceTransitionPipeline::EGfxToCompute, ClipmapUAVs.GetData(), ClipmapUAVs.Num(), BeginFence);
 
-									DispatchComputeShader(RHICmdList, *ComputeShader, NumGroupsX, NumGroupsY, NumGroupsZ);
-									ComputeShader->UnsetParameters(RHICmdList);
-								}
-							}
+				FRHIAsyncComputeCommandListImmediate& RHICmdListComputeImmediate = FRHICommandListExecutor::GetImmediateAsyncComputeCommandList();
+				{
+					SCOPED_COMPUTE_EVENT(RHICmdListComputeImmediate, UpdateGlobalDistanceFieldVolume);
 
-							// Further cull the objects to the dispatch tile and composite the global distance field by computing the min distance from intersecting per-object distance fields
-							{
-								SCOPED_DRAW_EVENTF(RHICmdList, TileCullAndComposite, TEXT("TileCullAndComposite %ux%ux%u"), UpdateRegion.CellsSize.X, UpdateRegion.CellsSize.Y, UpdateRegion.CellsSize.Z);
+					RHICmdListComputeImmediate.WaitComputeFence(BeginFence);
 
-								//@todo - match typical update sizes.  Camera movement creates narrow slabs.
-								const uint32 NumGroupsX = FMath::DivideAndRoundUp<int32>(UpdateRegion.CellsSize.X, CompositeTileSize);
-								const uint32 NumGroupsY = FMath::DivideAndRoundUp<int32>(UpdateRegion.CellsSize.Y, CompositeTileSize);
-								const uint32 NumGroupsZ = FMath::DivideAndRoundUp<int32>(UpdateRegion.CellsSize.Z, CompositeTileSize);
+					UpdateGlobalDistanceFieldClipmaps(RHICmdListComputeImmediate, View, Scene, MaxOcclusionDistance, GlobalDistanceFieldInfo);
 
-								IPooledRenderTarget* ParentDistanceField = GlobalDistanceFieldInfo.MostlyStaticClipmaps[ClipmapIndex].RenderTarget;
+					RHICmdListComputeImmediate.TransitionResources(EResourceTransitionAccess::EReadable, EResourceTransitionPipeline::EComputeToGfx, ClipmapUAVs.GetData(), ClipmapUAVs.Num(), GlobalDistanceFieldInfo.UpdateEndFence);
+				}
 
-								if (CacheType == GDF_Full && GAOGlobalDistanceFieldCacheMostlyStaticSeparately && ParentDistanceField)
-								{
-									TShaderMapRef<TCompositeObjectDistanceFieldsCS<true>> ComputeShader(View.ShaderMap);
-									RHICmdList.SetComputeShader(ComputeShader->GetComputeShader());
-									ComputeShader->SetParameters(RHICmdList, Scene, View, MaxOcclusionDistance, GlobalDistanceFieldInfo.ParameterData, Clipmap, ParentDistanceField, ClipmapIndex, UpdateRegion);
-									DispatchComputeShader(RHICmdList, *ComputeShader, NumGroupsX, NumGroupsY, NumGroupsZ);
-									ComputeShader->UnsetParameters(RHICmdList, Clipmap);
-								}
-								else
-								{
-									TShaderMapRef<TCompositeObjectDistanceFieldsCS<false>> ComputeShader(View.ShaderMap);
-									RHICmdList.SetComputeShader(ComputeShader->GetComputeShader());
-									ComputeShader->SetParameters(RHICmdList, Scene, View, MaxOcclusionDistance, GlobalDistanceFieldInfo.ParameterData, Clipmap, NULL, ClipmapIndex, UpdateRegion);
-									DispatchComputeShader(RHICmdList, *ComputeShader, NumGroupsX, NumGroupsY, NumGroupsZ);
-									ComputeShader->UnsetParameters(RHICmdList, Clipmap);
-								}
-							}
-						}
+				FRHIAsyncComputeCommandListImmediate::ImmediateDispatch(RHICmdListComputeImmediate);
+			}
+			else
+			{
+				SCOPED_DRAW_EVENT(RHICmdList, UpdateGlobalDistanceFieldVolume);
 
-						if (UpdateRegion.UpdateType & VUT_Heightfields)
-						{
-							View.HeightfieldLightingViewInfo.CompositeHeightfieldsIntoGlobalDistanceField(RHICmdList, Scene, View, MaxOcclusionDistance, GlobalDistanceFieldInfo, ClipmapIndex, UpdateRegion);
-						}
-					}
-				}
+				UpdateGlobalDistanceFieldClipmaps(RHICmdList, View, Scene, MaxOcclusionDistance, GlobalDistanceFieldInfo);
 			}
 		}
 	}
 }
 
+void WaitForGlobalDistanceFieldVolumeUpdate(FRHICommandListImmediate& RHICmdList, FGlobalDistanceFieldInfo& GlobalDistanceFieldInfo)
+{
+	if (GlobalDistanceFieldInfo.UpdateEndFence)
+	{
+		RHICmdList.WaitComputeFence(GlobalDistanceFieldInfo.UpdateEndFence);
+		GlobalDistanceFieldInfo.UpdateEndFence = nullptr;
+	}
+}
+
 void ListGlobalDistanceFieldMemory()
 {
 	UE_LOG(LogRenderer, Log, TEXT("   Global DF culled objects %.3fMb"), (GGlobalDistanceFieldCulledObjectBuffers.Buffers.GetSizeBytes() + GObjectGridBuffers.GetSizeBytes()) / 1024.0f / 1024.0f);
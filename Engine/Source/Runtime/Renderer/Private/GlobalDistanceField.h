@@ -32,3 +32,9 @@ extern void UpdateGlobalDistanceFieldVolume(
 	const FScene* Scene, 
 	float MaxOcclusionDistance, 
 	FGlobalDistanceFieldInfo& Info);
+
+/** 
+ * Makes the graphics pipe wait for the update of the global distance field, if UpdateGlobalDistanceFieldVolume issued it on the async compute pipe.
+ * Must be called before anything reads the global distance field after the base pass.
+ **/
+extern void WaitForGlobalDistanceFieldVolumeUpdate(FRHICommandListImmediate& RHICmdList, FGlobalDistanceFieldInfo& Info);
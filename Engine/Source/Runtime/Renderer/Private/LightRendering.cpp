@@ -17,8 +17,6 @@ DECLARE_FLOAT_COUNTER_STAT(TEXT("Lights"), Stat_GPU_Lights, STATGROUP_GPU);
 
 IMPLEMENT_UNIFORM_BUFFER_STRUCT(FDeferredLightUniformStruct,TEXT("DeferredLightUniforms"));
 
-extern int32 GUseTranslucentLightingVolumes;
-
 
 static int32 bAllowDepthBoundsTest = 1;
 static FAutoConsoleVariableRef CVarAllowDepthBoundsTest(
@@ -478,7 +476,7 @@ void FDeferredShadingSceneRenderer::RenderLights(FRHICommandListImmediate& RHICm
 				}
 			}
 
-			if (GUseTranslucentLightingVolumes && GSupportsVolumeTextureRendering)
+			if (ShouldInjectTranslucentVolumeLighting())
 			{
 				if (AttenuationLightStart)
 				{
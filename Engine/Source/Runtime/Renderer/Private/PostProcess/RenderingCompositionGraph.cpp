@@ -28,6 +28,15 @@ static TAutoConsoleVariable<int32> CVarCompositionGraphOrder(
 	TEXT(" 1: RegisterPass() call order, unless the dependencies (input and additional) require a different order (might become new default as it provides more control, executes all registered nodes)"),
 	ECVF_RenderThreadSafe);
 
+static TAutoConsoleVariable<int32> CVarCompositionGraphReleaseUnreferencedOutputs(
+	TEXT("r.CompositionGraph.ReleaseUnreferencedOutputs"),
+	1,
+	TEXT("Whether pass outputs no other pass reads are given back to the render target pool right after the pass was processed (affects postprocess and some lighting).\n")
+	TEXT("This allows later passes to reuse the memory instead of keeping it until the graph is freed.\n")
+	TEXT(" 0: off, keep them until the graph is freed\n")
+	TEXT(" 1: on (default)"),
+	ECVF_RenderThreadSafe);
+
 #if !UE_BUILD_SHIPPING
 FAutoConsoleCommand CmdCompositionGraphDebug(
 	TEXT("r.CompositionGraphDebug"),
@@ -212,6 +221,12 @@ void FRenderingCompositePassContext::Process(FRenderingCompositePass* Root, cons
 
 		Graph.RecursivelyGatherDependencies(Root);
 
+		// the outputs of the root are read by the caller after processing, they have to survive until the graph is freed
+		for(uint32 OutputId = 0; FRenderingCompositeOutput* RootOutput = Root->GetOutput((EPassOutputId)OutputId); ++OutputId)
+		{
+			RootOutput->AddDependency();
+		}
+
 		if(bNewOrder)
 		{
 			// process in the order the nodes have been created (for more control), unless the dependencies require it differently
@@ -733,6 +748,21 @@ void FRenderingCompositionGraph::RecursivelyProcess(const FRenderingCompositeOut
 			}
 		}
 	}
+
+	// outputs no other pass depends on were only written for their side effects (e.g. history stored in the view state),
+	// release them so the following passes can reuse the memory
+	if(CVarCompositionGraphReleaseUnreferencedOutputs.GetValueOnRenderThread() != 0)
+	{
+		uint32 OutputId = 0;
+
+		while(FRenderingCompositeOutput* PassOutput = Pass->GetOutput((EPassOutputId)OutputId++))
+		{
+			if(!PassOutput->GetDependencyCount())
+			{
+				PassOutput->PooledRenderTarget.SafeRelease();
+			}
+		}
+	}
 }
 
 // for debugging purpose O(n)
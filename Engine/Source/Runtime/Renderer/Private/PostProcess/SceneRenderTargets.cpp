@@ -5,6 +5,7 @@
 =============================================================================*/
 
 #include "PostProcess/SceneRenderTargets.h"
+#include "HAL/LowLevelMemTracker.h"
 #include "Shader.h"
 #include "StaticBoundShaderState.h"
 #include "SceneUtils.h"
@@ -411,6 +412,7 @@ uint16 FSceneRenderTargets::GetNumSceneColorMSAASamples(ERHIFeatureLevel::Type I
 
 void FSceneRenderTargets::Allocate(FRHICommandList& RHICmdList, const FSceneViewFamily& ViewFamily)
 {
+	LLM_SCOPE(ELLMTag::RenderTargets);
 	check(IsInRenderingThread());
 	// ViewFamily setup wasn't complete
 	check(ViewFamily.FrameNumber != UINT_MAX);
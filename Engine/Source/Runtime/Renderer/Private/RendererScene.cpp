@@ -67,6 +67,26 @@ SIZE_T FStaticMeshDrawListBase::TotalBytesUsed = 0;
 
 static FThreadSafeCounter FSceneViewState_UniqueID;
 
+static TAutoConsoleVariable<int32> CVarBatchPrimitiveTransformUpdates(
+	TEXT("r.BatchPrimitiveTransformUpdates"),
+	1,
+	TEXT("Whether primitive transform updates made during the world's end of frame updates are sent to the rendering thread as a single command.\n")
+	TEXT(" 0: one command per primitive\n")
+	TEXT(" 1: one command per frame (default)"),
+	ECVF_RenderThreadSafe);
+
+static TAutoConsoleVariable<int32> CVarBatchPrimitiveAdds(
+	TEXT("r.BatchPrimitiveAdds"),
+	1,
+	TEXT("Whether primitives whose render state is created during the world's end of frame updates are added to the scene in a single command.\n")
+	TEXT("Only applies to components that allow batched render state creation, see UActorComponent::AllowsBatchedRenderStateCreation.\n")
+	TEXT(" 0: one command per primitive\n")
+	TEXT(" 1: one command per frame (default)"),
+	ECVF_RenderThreadSafe);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Batched Primitive Transform Updates"), STAT_BatchedPrimitiveTransformUpdates, STATGROUP_SceneUpdate);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Batched Primitive Adds"), STAT_BatchedPrimitiveAdds, STATGROUP_SceneUpdate);
+
 /**
  * Holds the info to update SpeedTree wind per unique tree object in the scene, instead of per instance
  */
@@ -518,6 +538,34 @@ void FScene::AddPrimitiveSceneInfo_RenderThread(FRHICommandListImmediate& RHICmd
 	SceneLODHierarchy.UpdateNodeSceneInfo(PrimitiveSceneInfo->PrimitiveComponentId, PrimitiveSceneInfo);
 }
 
+void FScene::AddPrimitiveSceneInfos_RenderThread(FRHICommandListImmediate& RHICmdList, const TArray<FPrimitiveAdd>& Adds)
+{
+	INC_DWORD_STAT_BY(STAT_BatchedPrimitiveAdds, Adds.Num());
+
+	for (const FPrimitiveAdd& Add : Adds)
+	{
+		FPrimitiveSceneProxy* SceneProxy = Add.PrimitiveSceneInfo->Proxy;
+		FScopeCycleCounter Context(SceneProxy->GetStatId());
+		SceneProxy->SetTransform(Add.RenderMatrix, Add.WorldBounds, Add.LocalBounds, Add.AttachmentRootPosition);
+		SceneProxy->CreateRenderThreadResources();
+	}
+
+	// Grow the packed primitive arrays once for the whole batch
+	const int32 NumPrimitives = Primitives.Num() + Adds.Num();
+	Primitives.Reserve(NumPrimitives);
+	PrimitiveBounds.Reserve(NumPrimitives);
+	PrimitiveVisibilityIds.Reserve(NumPrimitives);
+	PrimitiveOcclusionFlags.Reserve(NumPrimitives);
+	PrimitiveComponentIds.Reserve(NumPrimitives);
+	PrimitiveOcclusionBounds.Reserve(NumPrimitives);
+
+	for (const FPrimitiveAdd& Add : Adds)
+	{
+		FScopeCycleCounter Context(Add.PrimitiveSceneInfo->Proxy->GetStatId());
+		AddPrimitiveSceneInfo_RenderThread(RHICmdList, Add.PrimitiveSceneInfo);
+	}
+}
+
 /**
  * Verifies that a component is added to the proper scene
  *
@@ -614,6 +662,7 @@ FScene::FScene(UWorld* InWorld, bool bInRequiresHitProxies, bool bInIsEditorScen
 ,	NumVisibleLights_GameThread(0)
 ,	NumEnabledSkylights_GameThread(0)
 ,	SceneFrameNumber(0)
+,	PrimitiveTransformBatchDepth(0)
 {
 	FMemory::Memzero(MobileDirectionalLights);
 
@@ -730,32 +779,38 @@ void FScene::AddPrimitive(UPrimitiveComponent* Primitive)
 		AttachmentRootPosition = AttachmentRoot->GetActorLocation();
 	}
 
-	struct FCreateRenderThreadParameters
-	{
-		FPrimitiveSceneProxy* PrimitiveSceneProxy;
-		FMatrix RenderMatrix;
-		FBoxSphereBounds WorldBounds;
-		FVector AttachmentRootPosition;
-		FBoxSphereBounds LocalBounds;
-	};
-	FCreateRenderThreadParameters Params =
-	{
-		PrimitiveSceneProxy,
-		RenderMatrix,
-		Primitive->Bounds,
-		AttachmentRootPosition,
-		Primitive->CalcBounds(FTransform::Identity)
-	};
+	FPrimitiveAdd Params;
+	Params.PrimitiveSceneInfo = PrimitiveSceneInfo;
+	Params.RenderMatrix = RenderMatrix;
+	Params.WorldBounds = Primitive->Bounds;
+	Params.AttachmentRootPosition = AttachmentRootPosition;
+	Params.LocalBounds = Primitive->CalcBounds(FTransform::Identity);
 
 	// Help track down primitive with bad bounds way before the it gets to the Renderer
 	ensureMsgf(!Primitive->Bounds.BoxExtent.ContainsNaN() && !Primitive->Bounds.Origin.ContainsNaN() && !FMath::IsNaN(Primitive->Bounds.SphereRadius) && FMath::IsFinite(Primitive->Bounds.SphereRadius),
 			TEXT("Nans found on Bounds for Primitive %s: Origin %s, BoxExtent %s, SphereRadius %f"), *Primitive->GetName(), *Primitive->Bounds.Origin.ToString(), *Primitive->Bounds.BoxExtent.ToString(), Primitive->Bounds.SphereRadius);
 
+	INC_DWORD_STAT_BY( STAT_GameToRendererMallocTotal, PrimitiveSceneProxy->GetMemoryFootprint() + PrimitiveSceneInfo->GetMemoryFootprint() );
+
+	// Verify the primitive is valid (this will compile away to a nop without CHECK_FOR_PIE_PRIMITIVE_ATTACH_SCENE_MISMATCH)
+	VerifyProperPIEScene(Primitive, World);
+
+	// Increment the attachment counter, the primitive is about to be attached to the scene.
+	Primitive->AttachmentCounter.Increment();
+
+	if (PrimitiveTransformBatchDepth > 0 && CVarBatchPrimitiveAdds.GetValueOnAnyThread() != 0 && Primitive->AllowsBatchedRenderStateCreation())
+	{
+		// Sent along with all other primitives created this frame by EndPrimitiveTransformBatch
+		FScopeLock Lock(&PendingPrimitiveTransformUpdatesCS);
+		PendingPrimitiveAdds.Add(Params);
+		return;
+	}
+
 	// Create any RenderThreadResources required.
 	ENQUEUE_RENDER_COMMAND(CreateRenderThreadResourcesCommand)(
 		[Params](FRHICommandListImmediate& RHICmdList)
 	{
-		FPrimitiveSceneProxy* SceneProxy = Params.PrimitiveSceneProxy;
+		FPrimitiveSceneProxy* SceneProxy = Params.PrimitiveSceneInfo->Proxy;
 		FScopeCycleCounter Context(SceneProxy->GetStatId());
 		SceneProxy->SetTransform(Params.RenderMatrix, Params.WorldBounds, Params.LocalBounds, Params.AttachmentRootPosition);
 
@@ -763,14 +818,6 @@ void FScene::AddPrimitive(UPrimitiveComponent* Primitive)
 		SceneProxy->CreateRenderThreadResources();
 	});
 
-	INC_DWORD_STAT_BY( STAT_GameToRendererMallocTotal, PrimitiveSceneProxy->GetMemoryFootprint() + PrimitiveSceneInfo->GetMemoryFootprint() );
-
-	// Verify the primitive is valid (this will compile away to a nop without CHECK_FOR_PIE_PRIMITIVE_ATTACH_SCENE_MISMATCH)
-	VerifyProperPIEScene(Primitive, World);
-
-	// Increment the attachment counter, the primitive is about to be attached to the scene.
-	Primitive->AttachmentCounter.Increment();
-
 	// Send a command to the rendering thread to add the primitive to the scene.
 	FScene* Scene = this;
 	ENQUEUE_RENDER_COMMAND(AddPrimitiveCommand)(
@@ -810,6 +857,70 @@ void FScene::UpdatePrimitiveTransform_RenderThread(FRHICommandListImmediate& RHI
 	PrimitiveSceneProxy->GetPrimitiveSceneInfo()->AddToScene(RHICmdList, bUpdateStaticDrawLists);
 }
 
+void FScene::UpdatePrimitiveTransforms_RenderThread(FRHICommandListImmediate& RHICmdList, const TArray<FPrimitiveTransformUpdate>& Updates)
+{
+	INC_DWORD_STAT_BY(STAT_BatchedPrimitiveTransformUpdates, Updates.Num());
+
+	for (const FPrimitiveTransformUpdate& Update : Updates)
+	{
+		FScopeCycleCounter Context(Update.PrimitiveSceneProxy->GetStatId());
+		UpdatePrimitiveTransform_RenderThread(RHICmdList, Update.PrimitiveSceneProxy, Update.WorldBounds, Update.LocalBounds, Update.LocalToWorld, Update.AttachmentRootPosition);
+	}
+}
+
+void FScene::BeginPrimitiveTransformBatch()
+{
+	check(IsInGameThread());
+	PrimitiveTransformBatchDepth++;
+}
+
+void FScene::EndPrimitiveTransformBatch()
+{
+	check(IsInGameThread() && PrimitiveTransformBatchDepth > 0);
+	if (--PrimitiveTransformBatchDepth == 0)
+	{
+		FlushPrimitiveTransformBatch();
+	}
+}
+
+void FScene::FlushPrimitiveTransformBatch()
+{
+	FScopeLock Lock(&PendingPrimitiveTransformUpdatesCS);
+
+	// Added primitives go first, transform updates in the same batch may already refer to them
+	if (PendingPrimitiveAdds.Num() > 0)
+	{
+		TArray<FPrimitiveAdd>* Adds = new TArray<FPrimitiveAdd>();
+		Exchange(*Adds, PendingPrimitiveAdds);
+
+		FScene* Scene = this;
+		ENQUEUE_RENDER_COMMAND(AddPrimitivesCommand)(
+			[Scene, Adds](FRHICommandListImmediate& RHICmdList)
+			{
+				Scene->AddPrimitiveSceneInfos_RenderThread(RHICmdList, *Adds);
+				delete Adds;
+			});
+	}
+
+	if (PendingPrimitiveTransformUpdates.Num() == 0)
+	{
+		return;
+	}
+
+	// Handed over without copying, the command frees it
+	TArray<FPrimitiveTransformUpdate>* Updates = new TArray<FPrimitiveTransformUpdate>();
+	Exchange(*Updates, PendingPrimitiveTransformUpdates);
+
+	// The command is enqueued while holding the lock, so it can't end up behind a later flush
+	FScene* Scene = this;
+	ENQUEUE_RENDER_COMMAND(UpdateTransformsCommand)(
+		[Scene, Updates](FRHICommandListImmediate& RHICmdList)
+		{
+			Scene->UpdatePrimitiveTransforms_RenderThread(RHICmdList, *Updates);
+			delete Updates;
+		});
+}
+
 void FScene::UpdatePrimitiveTransform(UPrimitiveComponent* Primitive)
 {
 	SCOPE_CYCLE_COUNTER(STAT_UpdatePrimitiveTransformGT);
@@ -869,6 +980,25 @@ void FScene::UpdatePrimitiveTransform(UPrimitiveComponent* Primitive)
 			ensureMsgf(!Primitive->Bounds.BoxExtent.ContainsNaN() && !Primitive->Bounds.Origin.ContainsNaN() && !FMath::IsNaN(Primitive->Bounds.SphereRadius) && FMath::IsFinite(Primitive->Bounds.SphereRadius),
 				TEXT("Nans found on Bounds for Primitive %s: Origin %s, BoxExtent %s, SphereRadius %f"), *Primitive->GetName(), *Primitive->Bounds.Origin.ToString(), *Primitive->Bounds.BoxExtent.ToString(), Primitive->Bounds.SphereRadius);
 
+			if (PrimitiveTransformBatchDepth > 0 && CVarBatchPrimitiveTransformUpdates.GetValueOnAnyThread() != 0)
+			{
+				// Sent along with all other primitives moved this frame by EndPrimitiveTransformBatch
+				FScopeLock Lock(&PendingPrimitiveTransformUpdatesCS);
+				FPrimitiveTransformUpdate& Update = PendingPrimitiveTransformUpdates[PendingPrimitiveTransformUpdates.AddUninitialized()];
+				Update.PrimitiveSceneProxy = UpdateParams.PrimitiveSceneProxy;
+				Update.WorldBounds = UpdateParams.WorldBounds;
+				Update.LocalBounds = UpdateParams.LocalBounds;
+				Update.LocalToWorld = UpdateParams.LocalToWorld;
+				Update.AttachmentRootPosition = UpdateParams.AttachmentRootPosition;
+				return;
+			}
+
+			// The proxy may still be waiting to be added to the scene with the current batch
+			if (PrimitiveTransformBatchDepth > 0)
+			{
+				FlushPrimitiveTransformBatch();
+			}
+
 			ENQUEUE_RENDER_COMMAND(UpdateTransformCommand)(
 				[UpdateParams](FRHICommandListImmediate& RHICmdList)
 				{
@@ -897,6 +1027,12 @@ void FScene::UpdatePrimitiveLightingAttachmentRoot(UPrimitiveComponent* Primitiv
 
 	if (Primitive->SceneProxy)
 	{
+		// The primitive may still be waiting to be added to the scene with the current batch
+		if (PrimitiveTransformBatchDepth > 0)
+		{
+			FlushPrimitiveTransformBatch();
+		}
+
 		ENQUEUE_UNIQUE_RENDER_COMMAND_TWOPARAMETER(
 			UpdatePrimitiveAttachment,
 			FPrimitiveSceneProxy*,Proxy,Primitive->SceneProxy,
@@ -998,6 +1134,12 @@ void FScene::RemovePrimitive( UPrimitiveComponent* Primitive )
 
 	if(PrimitiveSceneProxy)
 	{
+		// The proxy may have an add or transform update waiting in the current batch, which has to reach the rendering thread before the proxy is removed
+		if (PrimitiveTransformBatchDepth > 0)
+		{
+			FlushPrimitiveTransformBatch();
+		}
+
 		FPrimitiveSceneInfo* PrimitiveSceneInfo = PrimitiveSceneProxy->GetPrimitiveSceneInfo();
 
 		// Disassociate the primitive's scene proxy.
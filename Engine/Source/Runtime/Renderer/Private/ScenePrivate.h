@@ -2084,6 +2084,8 @@ public:
 	virtual void RemovePrimitive(UPrimitiveComponent* Primitive) override;
 	virtual void ReleasePrimitive(UPrimitiveComponent* Primitive) override;
 	virtual void UpdatePrimitiveTransform(UPrimitiveComponent* Primitive) override;
+	virtual void BeginPrimitiveTransformBatch() override;
+	virtual void EndPrimitiveTransformBatch() override;
 	virtual void UpdatePrimitiveAttachment(UPrimitiveComponent* Primitive) override;
 	virtual FPrimitiveSceneInfo* GetPrimitiveSceneInfo(int32 PrimitiveIndex) override;
 	virtual void AddLight(ULightComponent* Light) override;
@@ -2321,6 +2323,35 @@ private:
 	/** Updates a primitive's transform, called on the rendering thread. */
 	void UpdatePrimitiveTransform_RenderThread(FRHICommandListImmediate& RHICmdList, FPrimitiveSceneProxy* PrimitiveSceneProxy, const FBoxSphereBounds& WorldBounds, const FBoxSphereBounds& LocalBounds, const FMatrix& LocalToWorld, const FVector& OwnerPosition);
 
+	/** Transform update of a primitive, as sent to the rendering thread */
+	struct FPrimitiveTransformUpdate
+	{
+		FPrimitiveSceneProxy* PrimitiveSceneProxy;
+		FBoxSphereBounds WorldBounds;
+		FBoxSphereBounds LocalBounds;
+		FMatrix LocalToWorld;
+		FVector AttachmentRootPosition;
+	};
+
+	/** Primitive added to the scene, as sent to the rendering thread */
+	struct FPrimitiveAdd
+	{
+		FPrimitiveSceneInfo* PrimitiveSceneInfo;
+		FMatrix RenderMatrix;
+		FBoxSphereBounds WorldBounds;
+		FVector AttachmentRootPosition;
+		FBoxSphereBounds LocalBounds;
+	};
+
+	/** Adds a batch of primitives collected between BeginPrimitiveTransformBatch and EndPrimitiveTransformBatch, called on the rendering thread. */
+	void AddPrimitiveSceneInfos_RenderThread(FRHICommandListImmediate& RHICmdList, const TArray<FPrimitiveAdd>& Adds);
+
+	/** Applies a batch of transform updates collected between BeginPrimitiveTransformBatch and EndPrimitiveTransformBatch, called on the rendering thread. */
+	void UpdatePrimitiveTransforms_RenderThread(FRHICommandListImmediate& RHICmdList, const TArray<FPrimitiveTransformUpdate>& Updates);
+
+	/** Sends the primitive adds and transform updates collected so far to the rendering thread, may be called from any thread. */
+	void FlushPrimitiveTransformBatch();
+
 	/** Updates a single primitive's lighting attachment root. */
 	void UpdatePrimitiveLightingAttachmentRoot(UPrimitiveComponent* Primitive);
 
@@ -2395,6 +2426,18 @@ private:
 
 	/** Frame number incremented per-family viewing this scene. */
 	uint32 SceneFrameNumber;
+
+	/** Number of BeginPrimitiveTransformBatch calls without a matching EndPrimitiveTransformBatch, only changed on the game thread */
+	int32 PrimitiveTransformBatchDepth;
+
+	/** Transform updates collected while a batch is open */
+	TArray<FPrimitiveTransformUpdate> PendingPrimitiveTransformUpdates;
+
+	/** Primitive adds collected while a batch is open, sent ahead of the transform updates */
+	TArray<FPrimitiveAdd> PendingPrimitiveAdds;
+
+	/** Guards PendingPrimitiveTransformUpdates, primitives are updated in parallel at the end of the frame */
+	FCriticalSection PendingPrimitiveTransformUpdatesCS;
 };
 
 inline bool ShouldIncludeDomainInMeshPass(EMaterialDomain Domain)
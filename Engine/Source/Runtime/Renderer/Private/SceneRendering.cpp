@@ -6,6 +6,7 @@
 
 #include "SceneRendering.h"
 #include "ProfilingDebugging/ProfilingHelpers.h"
+#include "ProfilingDebugging/FrameTrace.h"
 #include "UObject/UObjectHash.h"
 #include "UObject/UObjectIterator.h"
 #include "EngineGlobals.h"
@@ -456,6 +457,7 @@ void FViewInfo::Init()
 	bUsesGlobalDistanceField = false;
 	bUsesLightingChannels = false;
 	bTranslucentSurfaceLighting = false;
+	bTranslucentVolumeLighting = false;
 	bUsesSceneDepth = false;
 
 	ExponentialFogParameters = FVector4(0,1,1,0);
@@ -1261,6 +1263,11 @@ FSceneRenderer::~FSceneRenderer()
 
 	// Manually release references to TRefCountPtrs that are allocated on the mem stack, which doesn't call dtors
 	SortedShadowsForShadowDepthPass.Release();
+
+	for (int32 CollectorIndex = 0; CollectorIndex < ParallelMeshCollectors.Num(); CollectorIndex++)
+	{
+		delete ParallelMeshCollectors[CollectorIndex];
+	}
 }
 
 /** 
@@ -1776,6 +1783,9 @@ static void ViewExtensionPreRender_RenderThread(FRHICommandListImmediate& RHICmd
 	// update any resources that needed a deferred update
 	FDeferredUpdateResource::UpdateResources(RHICmdList);
 
+	// View extensions may draw with materials too
+	FMaterialRenderProxy::UpdateDeferredCachedUniformExpressions();
+
 	for (int ViewExt = 0; ViewExt < SceneRenderer->ViewFamily.ViewExtensions.Num(); ViewExt++)
 	{
 		SceneRenderer->ViewFamily.ViewExtensions[ViewExt]->PreRenderViewFamily_RenderThread(RHICmdList, SceneRenderer->ViewFamily);
@@ -1793,11 +1803,16 @@ static void ViewExtensionPreRender_RenderThread(FRHICommandListImmediate& RHICmd
  */
 static void RenderViewFamily_RenderThread(FRHICommandListImmediate& RHICmdList, FSceneRenderer* SceneRenderer)
 {
+	FRAME_TRACE_SCOPE("RenderViewFamily");
+
 	FMemMark MemStackMark(FMemStack::Get());
 
 	// update any resources that needed a deferred update
 	FDeferredUpdateResource::UpdateResources(RHICmdList);
 
+	// Cache the uniform expressions of materials whose parameters changed since the last scene was rendered
+	FMaterialRenderProxy::UpdateDeferredCachedUniformExpressions();
+
 	if(SceneRenderer->ViewFamily.EngineShowFlags.OnScreenDebug)
 	{
 		GRenderTargetPool.SetEventRecordingActive(true);
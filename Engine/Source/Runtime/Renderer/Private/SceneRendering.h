@@ -615,6 +615,9 @@ public:
 	TArray<FGlobalDistanceFieldClipmap> Clipmaps;
 	FGlobalDistanceFieldParameterData ParameterData;
 
+	/** Written when the clipmaps were updated on the async compute pipe, the graphics pipe waits for it in WaitForGlobalDistanceFieldVolumeUpdate. */
+	FComputeFenceRHIRef UpdateEndFence;
+
 	void UpdateParameterData(float MaxOcclusionDistance);
 
 	FGlobalDistanceFieldInfo() :
@@ -917,6 +920,8 @@ public:
 	uint32 bUsesGlobalDistanceField : 1;
 	uint32 bUsesLightingChannels : 1;
 	uint32 bTranslucentSurfaceLighting : 1;
+	/** Whether the view has any lit translucent materials that read the translucency lighting volume. */
+	uint32 bTranslucentVolumeLighting : 1;
 	/** Whether the view has any materials that read from scene depth. */
 	uint32 bUsesSceneDepth : 1;
 	/** 
@@ -1282,6 +1287,9 @@ public:
 
 	FMeshElementCollector MeshCollector;
 
+	/** Collectors of the tasks gathering dynamic mesh elements in parallel, which own the gathered meshes until the end of the frame. */
+	TArray<FMeshElementCollector*, TInlineAllocator<8> > ParallelMeshCollectors;
+
 	/** Information about the visible lights. */
 	TArray<FVisibleLightInfo,SceneRenderingAllocator> VisibleLightInfos;
 
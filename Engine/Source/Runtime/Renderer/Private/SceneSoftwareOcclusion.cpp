@@ -0,0 +1,437 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	SceneSoftwareOcclusion.cpp: Software occlusion culling against CPU-side occluder meshes.
+=============================================================================*/
+
+#include "SceneSoftwareOcclusion.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Misc/App.h"
+#include "Async/ParallelFor.h"
+#include "StaticMeshResources.h"
+#include "SceneManagement.h"
+#include "SceneRendering.h"
+#include "ScenePrivate.h"
+
+DECLARE_CYCLE_STAT(TEXT("Software Occlusion"), STAT_SoftwareOcclusion, STATGROUP_InitViews);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Software occluders"), STAT_SoftwareOccluders, STATGROUP_InitViews);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Software occluded primitives"), STAT_SoftwareOccludedPrimitives, STATGROUP_InitViews);
+
+static int32 GSoftwareOcclusion = 0;
+static FAutoConsoleVariableRef CVarSoftwareOcclusion(
+	TEXT("r.SoftwareOcclusion"),
+	GSoftwareOcclusion,
+	TEXT("Enables software occlusion culling, which rasterizes the occluder meshes of visible static meshes (see LODForOccluderMesh) on worker threads,\n")
+	TEXT("and culls the primitives behind them in the same frame, before occlusion queries are issued.\n")
+	TEXT(" 0: off (default)\n")
+	TEXT(" 1: on"),
+	ECVF_RenderThreadSafe
+	);
+
+static int32 GSoftwareOcclusionWidth = 256;
+static FAutoConsoleVariableRef CVarSoftwareOcclusionWidth(
+	TEXT("r.SoftwareOcclusion.Width"),
+	GSoftwareOcclusionWidth,
+	TEXT("Width of the software occlusion depth buffer in pixels, the height follows the aspect ratio of the view."),
+	ECVF_RenderThreadSafe
+	);
+
+static int32 GSoftwareOcclusionMaxOccluders = 64;
+static FAutoConsoleVariableRef CVarSoftwareOcclusionMaxOccluders(
+	TEXT("r.SoftwareOcclusion.MaxOccluders"),
+	GSoftwareOcclusionMaxOccluders,
+	TEXT("Maximum number of occluders rasterized per view, the largest on screen are used."),
+	ECVF_RenderThreadSafe
+	);
+
+static float GSoftwareOcclusionMinOccluderScreenSize = 0.05f;
+static FAutoConsoleVariableRef CVarSoftwareOcclusionMinOccluderScreenSize(
+	TEXT("r.SoftwareOcclusion.MinOccluderScreenSize"),
+	GSoftwareOcclusionMinOccluderScreenSize,
+	TEXT("Minimum screen size of the bounds of an occluder, smaller occluders are too unlikely to hide anything to be worth rasterizing."),
+	ECVF_RenderThreadSafe
+	);
+
+/** Number of depth buffer rows rasterized by each task */
+static const int32 SoftwareOcclusionRowsPerTask = 16;
+
+/** Number of visibility words tested by each task */
+static const int32 SoftwareOcclusionWordsPerTask = 64;
+
+/** Replicates a float to all components of a register */
+static FORCEINLINE VectorRegister SplatFloat(float Value)
+{
+	return VectorLoadFloat1(&Value);
+}
+
+/**
+ * An occluder triangle in depth buffer space.
+ * The edge equations are offset to the pixel corner they are the smallest at, so a pixel passes all three only if the triangle covers it entirely.
+ */
+struct FSoftwareOccluderTriangle
+{
+	float EdgeA[3];
+	float EdgeB[3];
+	float EdgeC[3];
+
+	/** Depth of the farthest vertex, so the triangle never writes a depth in front of its surface */
+	float Depth;
+
+	/** Pixel bounds of the triangle, inclusive */
+	int32 MinX;
+	int32 MinY;
+	int32 MaxX;
+	int32 MaxY;
+};
+
+/**
+ * Depth buffer the occluders are rasterized into.
+ * Uses reversed Z like the scene depth, so it's cleared to the far plane at 0 and larger values are closer.
+ */
+class FSoftwareOcclusionBuffer
+{
+public:
+	FSoftwareOcclusionBuffer(const FViewInfo& View)
+		: ViewProjectionMatrix(View.ViewMatrices.GetViewProjectionMatrix())
+		, NearClippingDistance(View.NearClippingDistance)
+	{
+		// Rows are rasterized four pixels at a time, so the width is kept a multiple of four
+		Width = Align(FMath::Clamp(GSoftwareOcclusionWidth, 32, 1024), 4);
+		Height = FMath::Clamp(FMath::RoundToInt((float)Width * View.ViewRect.Height() / View.ViewRect.Width()), 16, 1024);
+
+		Depth.AddZeroed(Width * Height);
+	}
+
+	int32 GetHeight() const
+	{
+		return Height;
+	}
+
+	/** Transforms an occluder to depth buffer space, dropping the triangles behind the near plane or outside of the buffer */
+	void SetupTriangles(const FStaticMeshOccluderData& Occluder, const FMatrix& LocalToWorld, TArray<FSoftwareOccluderTriangle>& OutTriangles) const
+	{
+		const FMatrix LocalToClip = LocalToWorld * ViewProjectionMatrix;
+
+		TArray<FVector> ScreenVertices;
+		TArray<bool> VertexValid;
+		ScreenVertices.AddUninitialized(Occluder.Vertices.Num());
+		VertexValid.AddUninitialized(Occluder.Vertices.Num());
+
+		for (int32 VertexIndex = 0; VertexIndex < Occluder.Vertices.Num(); VertexIndex++)
+		{
+			VertexValid[VertexIndex] = ClipToScreen(LocalToClip.TransformPosition(Occluder.Vertices[VertexIndex]), ScreenVertices[VertexIndex]);
+		}
+
+		OutTriangles.Reserve(Occluder.Indices.Num() / 3);
+
+		for (int32 Index = 0; Index + 2 < Occluder.Indices.Num(); Index += 3)
+		{
+			const uint32 I0 = Occluder.Indices[Index + 0];
+			const uint32 I1 = Occluder.Indices[Index + 1];
+			const uint32 I2 = Occluder.Indices[Index + 2];
+
+			// Triangles crossing the near plane are dropped rather than clipped, which only makes the occlusion more conservative
+			if (!VertexValid[I0] || !VertexValid[I1] || !VertexValid[I2])
+			{
+				continue;
+			}
+
+			FSoftwareOccluderTriangle Triangle;
+			if (SetupTriangle(ScreenVertices[I0], ScreenVertices[I1], ScreenVertices[I2], Triangle))
+			{
+				OutTriangles.Add(Triangle);
+			}
+		}
+	}
+
+	/** Rasterizes the triangles covering a range of rows, tasks rasterizing different rows can run at the same time */
+	void RasterizeRows(const TArray<TArray<FSoftwareOccluderTriangle>>& OccluderTriangles, int32 FirstRow, int32 LastRow)
+	{
+		for (const TArray<FSoftwareOccluderTriangle>& Triangles : OccluderTriangles)
+		{
+			for (const FSoftwareOccluderTriangle& Triangle : Triangles)
+			{
+				const int32 MinY = FMath::Max(Triangle.MinY, FirstRow);
+				const int32 MaxY = FMath::Min(Triangle.MaxY, LastRow);
+
+				if (MinY <= MaxY)
+				{
+					RasterizeTriangle(Triangle, MinY, MaxY);
+				}
+			}
+		}
+	}
+
+	/** Whether the box is entirely behind the rasterized occluders */
+	bool IsOccluded(const FVector& Origin, const FVector& Extent) const
+	{
+		FVector2D ScreenMin(MAX_flt, MAX_flt);
+		FVector2D ScreenMax(-MAX_flt, -MAX_flt);
+		float ClosestDepth = 0.0f;
+
+		for (int32 Corner = 0; Corner < 8; Corner++)
+		{
+			const FVector Position = Origin + Extent * FVector((Corner & 1) ? 1.0f : -1.0f, (Corner & 2) ? 1.0f : -1.0f, (Corner & 4) ? 1.0f : -1.0f);
+
+			FVector Screen;
+			if (!ClipToScreen(ViewProjectionMatrix.TransformPosition(Position), Screen))
+			{
+				// Crosses the near plane, so it's close enough to never be occluded
+				return false;
+			}
+
+			ScreenMin.X = FMath::Min(ScreenMin.X, Screen.X);
+			ScreenMin.Y = FMath::Min(ScreenMin.Y, Screen.Y);
+			ScreenMax.X = FMath::Max(ScreenMax.X, Screen.X);
+			ScreenMax.Y = FMath::Max(ScreenMax.Y, Screen.Y);
+			ClosestDepth = FMath::Max(ClosestDepth, Screen.Z);
+		}
+
+		// Every pixel the box touches has to be covered by an occluder in front of it
+		const int32 MinX = FMath::Max(FMath::FloorToInt(ScreenMin.X), 0);
+		const int32 MinY = FMath::Max(FMath::FloorToInt(ScreenMin.Y), 0);
+		const int32 MaxX = FMath::Min(FMath::CeilToInt(ScreenMax.X) - 1, Width - 1);
+		const int32 MaxY = FMath::Min(FMath::CeilToInt(ScreenMax.Y) - 1, Height - 1);
+
+		if (MinX > MaxX || MinY > MaxY)
+		{
+			return false;
+		}
+
+		for (int32 Y = MinY; Y <= MaxY; Y++)
+		{
+			const float* RESTRICT Row = &Depth[Y * Width];
+
+			for (int32 X = MinX; X <= MaxX; X++)
+			{
+				if (Row[X] <= ClosestDepth)
+				{
+					return false;
+				}
+			}
+		}
+
+		return true;
+	}
+
+private:
+	/** Projects a clip space position to depth buffer pixels, returns false if it's in front of the near plane */
+	bool ClipToScreen(const FVector4& Clip, FVector& OutScreen) const
+	{
+		if (Clip.W <= NearClippingDistance)
+		{
+			return false;
+		}
+
+		const float InvW = 1.0f / Clip.W;
+		OutScreen.X = (Clip.X * InvW * 0.5f + 0.5f) * Width;
+		OutScreen.Y = (0.5f - Clip.Y * InvW * 0.5f) * Height;
+		OutScreen.Z = Clip.Z * InvW;
+		return true;
+	}
+
+	bool SetupTriangle(FVector V0, FVector V1, FVector V2, FSoftwareOccluderTriangle& OutTriangle) const
+	{
+		// Both facings occlude, they are just wound the same way so the inside of every edge is positive
+		const float Area = (V1.X - V0.X) * (V2.Y - V0.Y) - (V1.Y - V0.Y) * (V2.X - V0.X);
+		if (FMath::Abs(Area) < KINDA_SMALL_NUMBER)
+		{
+			return false;
+		}
+		if (Area < 0.0f)
+		{
+			Swap(V1, V2);
+		}
+
+		OutTriangle.MinX = FMath::Max(FMath::FloorToInt(FMath::Min3(V0.X, V1.X, V2.X)), 0);
+		OutTriangle.MinY = FMath::Max(FMath::FloorToInt(FMath::Min3(V0.Y, V1.Y, V2.Y)), 0);
+		OutTriangle.MaxX = FMath::Min(FMath::CeilToInt(FMath::Max3(V0.X, V1.X, V2.X)) - 1, Width - 1);
+		OutTriangle.MaxY = FMath::Min(FMath::CeilToInt(FMath::Max3(V0.Y, V1.Y, V2.Y)) - 1, Height - 1);
+
+		if (OutTriangle.MinX > OutTriangle.MaxX || OutTriangle.MinY > OutTriangle.MaxY)
+		{
+			return false;
+		}
+
+		const FVector* Vertices[3] = { &V0, &V1, &V2 };
+		for (int32 Edge = 0; Edge < 3; Edge++)
+		{
+			const FVector& From = *Vertices[Edge];
+			const FVector& To = *Vertices[(Edge + 1) % 3];
+
+			// E(x, y) = A * x + B * y + C, moved to the corner of the pixel where it's the smallest
+			const float A = From.Y - To.Y;
+			const float B = To.X - From.X;
+			OutTriangle.EdgeA[Edge] = A;
+			OutTriangle.EdgeB[Edge] = B;
+			OutTriangle.EdgeC[Edge] = -(A * From.X + B * From.Y) + FMath::Min(A, 0.0f) + FMath::Min(B, 0.0f);
+		}
+
+		OutTriangle.Depth = FMath::Min3(V0.Z, V1.Z, V2.Z);
+		return true;
+	}
+
+	void RasterizeTriangle(const FSoftwareOccluderTriangle& Triangle, int32 MinY, int32 MaxY)
+	{
+		const VectorRegister PixelOffsets = MakeVectorRegister(0.0f, 1.0f, 2.0f, 3.0f);
+		const VectorRegister FourPixels = SplatFloat(4.0f);
+		const VectorRegister Zero = VectorZero();
+		const VectorRegister TriangleDepth = SplatFloat(Triangle.Depth);
+		const VectorRegister EdgeA0 = SplatFloat(Triangle.EdgeA[0]);
+		const VectorRegister EdgeA1 = SplatFloat(Triangle.EdgeA[1]);
+		const VectorRegister EdgeA2 = SplatFloat(Triangle.EdgeA[2]);
+
+		const int32 MinX = Triangle.MinX & ~3;
+
+		for (int32 Y = MinY; Y <= MaxY; Y++)
+		{
+			float* RESTRICT Row = &Depth[Y * Width];
+
+			const VectorRegister X = VectorAdd(SplatFloat((float)MinX), PixelOffsets);
+			VectorRegister E0 = VectorMultiplyAdd(EdgeA0, X, SplatFloat(Triangle.EdgeB[0] * Y + Triangle.EdgeC[0]));
+			VectorRegister E1 = VectorMultiplyAdd(EdgeA1, X, SplatFloat(Triangle.EdgeB[1] * Y + Triangle.EdgeC[1]));
+			VectorRegister E2 = VectorMultiplyAdd(EdgeA2, X, SplatFloat(Triangle.EdgeB[2] * Y + Triangle.EdgeC[2]));
+
+			const VectorRegister StepE0 = VectorMultiply(EdgeA0, FourPixels);
+			const VectorRegister StepE1 = VectorMultiply(EdgeA1, FourPixels);
+			const VectorRegister StepE2 = VectorMultiply(EdgeA2, FourPixels);
+
+			for (int32 PixelX = MinX; PixelX <= Triangle.MaxX; PixelX += 4)
+			{
+				const VectorRegister Covered = VectorBitwiseAnd(VectorBitwiseAnd(VectorCompareGT(E0, Zero), VectorCompareGT(E1, Zero)), VectorCompareGT(E2, Zero));
+				const VectorRegister OldDepth = VectorLoadAligned(&Row[PixelX]);
+				VectorStoreAligned(VectorSelect(Covered, VectorMax(OldDepth, TriangleDepth), OldDepth), &Row[PixelX]);
+
+				E0 = VectorAdd(E0, StepE0);
+				E1 = VectorAdd(E1, StepE1);
+				E2 = VectorAdd(E2, StepE2);
+			}
+		}
+	}
+
+private:
+	int32 Width;
+	int32 Height;
+	FMatrix ViewProjectionMatrix;
+	float NearClippingDistance;
+
+	/** Row major depth, aligned so four pixels can be loaded and stored at once */
+	TArray<float, TAlignedHeapAllocator<16>> Depth;
+};
+
+int32 SoftwareOcclusionCull(const FScene* Scene, FViewInfo& View)
+{
+	if (!GSoftwareOcclusion || !View.ViewMatrices.IsPerspectiveProjection() || View.ViewRect.Width() <= 0 || View.ViewRect.Height() <= 0)
+	{
+		return 0;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_SoftwareOcclusion);
+
+	struct FOccluder
+	{
+		int32 PrimitiveIndex;
+		float ScreenSize;
+		const FStaticMeshOccluderData* Data;
+	};
+
+	// Gather the largest visible occluders
+	TArray<FOccluder, SceneRenderingAllocator> Occluders;
+	for (FSceneSetBitIterator BitIt(View.PrimitiveVisibilityMap); BitIt; ++BitIt)
+	{
+		const FPrimitiveSceneProxy* Proxy = Scene->Primitives[BitIt.GetIndex()]->Proxy;
+		const FStaticMeshOccluderData* OccluderData = Proxy->ShouldUseAsOccluder() ? Proxy->GetOccluderData() : nullptr;
+
+		if (OccluderData)
+		{
+			const FPrimitiveBounds& Bounds = Scene->PrimitiveBounds[BitIt.GetIndex()];
+			const float ScreenSize = ComputeBoundsScreenSize(Bounds.Origin, Bounds.SphereRadius, View);
+
+			if (ScreenSize >= GSoftwareOcclusionMinOccluderScreenSize)
+			{
+				Occluders.Add({ BitIt.GetIndex(), ScreenSize, OccluderData });
+			}
+		}
+	}
+
+	if (Occluders.Num() == 0)
+	{
+		return 0;
+	}
+
+	Occluders.Sort([](const FOccluder& A, const FOccluder& B) { return A.ScreenSize > B.ScreenSize; });
+	Occluders.SetNum(FMath::Min(Occluders.Num(), FMath::Max(GSoftwareOcclusionMaxOccluders, 1)), false);
+	INC_DWORD_STAT_BY(STAT_SoftwareOccluders, Occluders.Num());
+
+	// The occluders themselves are never tested, a conservative depth never hides its own bounds anyway
+	TBitArray<SceneRenderingBitArrayAllocator> IsOccluder(false, View.PrimitiveVisibilityMap.Num());
+	for (const FOccluder& Occluder : Occluders)
+	{
+		IsOccluder[Occluder.PrimitiveIndex] = true;
+	}
+
+	const bool bForceSingleThread = !FApp::ShouldUseThreadingForPerformance();
+	FSoftwareOcclusionBuffer Buffer(View);
+
+	// Worker threads allocate the triangles, so they use the heap rather than the mem stack of the rendering thread
+	TArray<TArray<FSoftwareOccluderTriangle>> OccluderTriangles;
+	OccluderTriangles.AddDefaulted(Occluders.Num());
+
+	ParallelFor(Occluders.Num(), [Scene, &Occluders, &Buffer, &OccluderTriangles](int32 OccluderIndex)
+	{
+		const FOccluder& Occluder = Occluders[OccluderIndex];
+		const FMatrix& LocalToWorld = Scene->Primitives[Occluder.PrimitiveIndex]->Proxy->GetLocalToWorld();
+
+		Buffer.SetupTriangles(*Occluder.Data, LocalToWorld, OccluderTriangles[OccluderIndex]);
+	}, bForceSingleThread);
+
+	const int32 NumRowTasks = FMath::DivideAndRoundUp(Buffer.GetHeight(), SoftwareOcclusionRowsPerTask);
+	ParallelFor(NumRowTasks, [&Buffer, &OccluderTriangles](int32 TaskIndex)
+	{
+		const int32 FirstRow = TaskIndex * SoftwareOcclusionRowsPerTask;
+		Buffer.RasterizeRows(OccluderTriangles, FirstRow, FirstRow + SoftwareOcclusionRowsPerTask - 1);
+	}, bForceSingleThread);
+
+	// Test the remaining visible primitives, each task owns whole words of the visibility map
+	FThreadSafeCounter NumOccludedPrimitives;
+	const int32 NumWords = FMath::DivideAndRoundUp(View.PrimitiveVisibilityMap.Num(), (int32)NumBitsPerDWORD);
+	const int32 NumTestTasks = FMath::DivideAndRoundUp(NumWords, SoftwareOcclusionWordsPerTask);
+
+	ParallelFor(NumTestTasks, [Scene, &View, &Buffer, &IsOccluder, &NumOccludedPrimitives, NumWords](int32 TaskIndex)
+	{
+		const int32 FirstWord = TaskIndex * SoftwareOcclusionWordsPerTask;
+		const int32 LastWord = FMath::Min(FirstWord + SoftwareOcclusionWordsPerTask, NumWords);
+		uint32* RESTRICT VisibilityWords = View.PrimitiveVisibilityMap.GetData();
+
+		for (int32 WordIndex = FirstWord; WordIndex < LastWord; WordIndex++)
+		{
+			uint32 VisBits = VisibilityWords[WordIndex];
+			uint32 RemainingBits = VisBits;
+
+			while (RemainingBits)
+			{
+				const uint32 BitIndex = FMath::CountTrailingZeros(RemainingBits);
+				RemainingBits &= RemainingBits - 1;
+
+				const int32 Index = WordIndex * NumBitsPerDWORD + BitIndex;
+				if (IsOccluder[Index] || (Scene->PrimitiveOcclusionFlags[Index] & EOcclusionFlags::CanBeOccluded) == 0)
+				{
+					continue;
+				}
+
+				const FBoxSphereBounds& Bounds = Scene->PrimitiveOcclusionBounds[Index];
+				if (Buffer.IsOccluded(Bounds.Origin, Bounds.BoxExtent))
+				{
+					VisBits &= ~(1u << BitIndex);
+					NumOccludedPrimitives.Increment();
+				}
+			}
+
+			VisibilityWords[WordIndex] = VisBits;
+		}
+	}, bForceSingleThread);
+
+	INC_DWORD_STAT_BY(STAT_SoftwareOccludedPrimitives, NumOccludedPrimitives.GetValue());
+	return NumOccludedPrimitives.GetValue();
+}
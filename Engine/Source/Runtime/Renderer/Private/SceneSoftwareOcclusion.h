@@ -0,0 +1,20 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	SceneSoftwareOcclusion.h: Software occlusion culling against CPU-side occluder meshes.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FScene;
+class FViewInfo;
+
+/**
+ * Rasterizes the occluder meshes of the primitives visible in the view into a small depth buffer on worker threads,
+ * and clears the visibility of the primitives hidden behind them. Unlike occlusion queries, the results are used in the same frame.
+ *
+ * @return The number of primitives culled, or 0 if software occlusion (r.SoftwareOcclusion) is disabled
+ */
+extern int32 SoftwareOcclusionCull(const FScene* Scene, FViewInfo& View);
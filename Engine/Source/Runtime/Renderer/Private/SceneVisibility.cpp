@@ -11,6 +11,7 @@
 #include "HAL/IConsoleManager.h"
 #include "Misc/App.h"
 #include "Async/TaskGraphInterfaces.h"
+#include "Async/ParallelFor.h"
 #include "EngineDefines.h"
 #include "EngineGlobals.h"
 #include "RHIDefinitions.h"
@@ -28,6 +29,7 @@
 #include "DeferredShadingRenderer.h"
 #include "DynamicPrimitiveDrawing.h"
 #include "ScenePrivate.h"
+#include "SceneSoftwareOcclusion.h"
 #include "FXSystem.h"
 #include "PostProcess/PostProcessing.h"
 
@@ -164,6 +166,20 @@ static TAutoConsoleVariable<int32> CVarParallelInitViews(
 	ECVF_RenderThreadSafe
 	);
 
+static TAutoConsoleVariable<int32> CVarParallelGatherDynamicMeshElements(
+	TEXT("r.ParallelGatherDynamicMeshElements"),
+	1,
+	TEXT("Toggles gathering the dynamic mesh elements of the primitives that support it (CanGatherDynamicMeshElementsInParallel) on task threads. 0 = off; 1 = on"),
+	ECVF_RenderThreadSafe
+	);
+
+static TAutoConsoleVariable<int32> CVarParallelGatherDynamicMeshElementsMinPrimitives(
+	TEXT("r.ParallelGatherDynamicMeshElements.MinPrimitivesPerTask"),
+	8,
+	TEXT("Minimum number of primitives gathered by each task with r.ParallelGatherDynamicMeshElements, fewer tasks are used when there aren't enough primitives."),
+	ECVF_RenderThreadSafe
+	);
+
 float GLightMaxDrawDistanceScale = 1.0f;
 static FAutoConsoleVariableRef CVarLightMaxDrawDistanceScale(
 	TEXT("r.LightMaxDrawDistanceScale"),
@@ -295,10 +311,111 @@ static int32 FrustumCullNumWordsPerTask = 128;
 static FAutoConsoleVariableRef CVarFrustumCullNumWordsPerTask(
 	TEXT("r.FrustumCullNumWordsPerTask"),
 	FrustumCullNumWordsPerTask,
-	TEXT("Performance tweak. Controls the granularity for the ParallelFor for frustum culling."),
+	TEXT("Performance tweak. Controls the minimum granularity (in 32 primitive words) of the ParallelForRange for frustum culling."),
 	ECVF_Default
 	);
 
+/**
+ * The view frustum planes, each component splatted into its own register, for testing four primitives per plane at once.
+ */
+struct FFrustumCullPlanes
+{
+	TArray<VectorRegister, TInlineAllocator<8>> X;
+	TArray<VectorRegister, TInlineAllocator<8>> Y;
+	TArray<VectorRegister, TInlineAllocator<8>> Z;
+	TArray<VectorRegister, TInlineAllocator<8>> W;
+	TArray<VectorRegister, TInlineAllocator<8>> AbsX;
+	TArray<VectorRegister, TInlineAllocator<8>> AbsY;
+	TArray<VectorRegister, TInlineAllocator<8>> AbsZ;
+
+	FFrustumCullPlanes(const FConvexVolume& Frustum)
+	{
+		for (const FPlane& Plane : Frustum.Planes)
+		{
+			X.Add(VectorLoadFloat1(&Plane.X));
+			Y.Add(VectorLoadFloat1(&Plane.Y));
+			Z.Add(VectorLoadFloat1(&Plane.Z));
+			W.Add(VectorLoadFloat1(&Plane.W));
+			AbsX.Add(VectorAbs(X.Last()));
+			AbsY.Add(VectorAbs(Y.Last()));
+			AbsZ.Add(VectorAbs(Z.Last()));
+		}
+	}
+};
+
+/**
+ * Tests the boxes of one word of consecutive primitives against the view frustum, four primitives at a time.
+ * Gives the same results as FConvexVolume::IntersectBox, which tests one box against four planes at a time.
+ *
+ * @return The visibility mask of the primitives, with the bit of every primitive intersecting the frustum set
+ */
+static uint32 FrustumCullBoxes(const FPrimitiveBounds* RESTRICT Bounds, int32 NumBounds, const FFrustumCullPlanes& Planes)
+{
+	checkSlow(NumBounds > 0 && NumBounds <= NumBitsPerDWORD);
+
+	// Transpose the bounds, padding the last four with empty boxes whose results are masked out
+	MS_ALIGN(16) float OriginX[NumBitsPerDWORD] GCC_ALIGN(16);
+	MS_ALIGN(16) float OriginY[NumBitsPerDWORD] GCC_ALIGN(16);
+	MS_ALIGN(16) float OriginZ[NumBitsPerDWORD] GCC_ALIGN(16);
+	MS_ALIGN(16) float ExtentX[NumBitsPerDWORD] GCC_ALIGN(16);
+	MS_ALIGN(16) float ExtentY[NumBitsPerDWORD] GCC_ALIGN(16);
+	MS_ALIGN(16) float ExtentZ[NumBitsPerDWORD] GCC_ALIGN(16);
+
+	const int32 NumPadded = Align(NumBounds, 4);
+	for (int32 Index = 0; Index < NumPadded; Index++)
+	{
+		const bool bValid = Index < NumBounds;
+		OriginX[Index] = bValid ? Bounds[Index].Origin.X : 0.0f;
+		OriginY[Index] = bValid ? Bounds[Index].Origin.Y : 0.0f;
+		OriginZ[Index] = bValid ? Bounds[Index].Origin.Z : 0.0f;
+		ExtentX[Index] = bValid ? FMath::Abs(Bounds[Index].BoxExtent.X) : 0.0f;
+		ExtentY[Index] = bValid ? FMath::Abs(Bounds[Index].BoxExtent.Y) : 0.0f;
+		ExtentZ[Index] = bValid ? FMath::Abs(Bounds[Index].BoxExtent.Z) : 0.0f;
+	}
+
+	const int32 NumPlanes = Planes.X.Num();
+	uint32 VisibleMask = 0;
+
+	for (int32 Index = 0; Index < NumPadded; Index += 4)
+	{
+		const VectorRegister OrigX = VectorLoadAligned(&OriginX[Index]);
+		const VectorRegister OrigY = VectorLoadAligned(&OriginY[Index]);
+		const VectorRegister OrigZ = VectorLoadAligned(&OriginZ[Index]);
+		const VectorRegister AbsExtentX = VectorLoadAligned(&ExtentX[Index]);
+		const VectorRegister AbsExtentY = VectorLoadAligned(&ExtentY[Index]);
+		const VectorRegister AbsExtentZ = VectorLoadAligned(&ExtentZ[Index]);
+		VectorRegister Outside = VectorZero();
+
+		for (int32 PlaneIndex = 0; PlaneIndex < NumPlanes; PlaneIndex++)
+		{
+			// Calculate the distance (x * x) + (y * y) + (z * z) - w
+			const VectorRegister DistX = VectorMultiply(OrigX, Planes.X[PlaneIndex]);
+			const VectorRegister DistY = VectorMultiplyAdd(OrigY, Planes.Y[PlaneIndex], DistX);
+			const VectorRegister DistZ = VectorMultiplyAdd(OrigZ, Planes.Z[PlaneIndex], DistY);
+			const VectorRegister Distance = VectorSubtract(DistZ, Planes.W[PlaneIndex]);
+			// Now do the push out FMath::Abs(x * x) + FMath::Abs(y * y) + FMath::Abs(z * z)
+			const VectorRegister PushX = VectorMultiply(AbsExtentX, Planes.AbsX[PlaneIndex]);
+			const VectorRegister PushY = VectorMultiplyAdd(AbsExtentY, Planes.AbsY[PlaneIndex], PushX);
+			const VectorRegister PushOut = VectorMultiplyAdd(AbsExtentZ, Planes.AbsZ[PlaneIndex], PushY);
+
+			Outside = VectorBitwiseOr(Outside, VectorCompareGT(Distance, PushOut));
+		}
+
+		MS_ALIGN(16) uint32 OutsideLanes[4] GCC_ALIGN(16);
+		VectorStoreAligned(Outside, (float*)OutsideLanes);
+
+		for (int32 Lane = 0; Lane < 4 && Index + Lane < NumBounds; Lane++)
+		{
+			if (OutsideLanes[Lane] == 0)
+			{
+				VisibleMask |= 1u << (Index + Lane);
+			}
+		}
+	}
+
+	return VisibleMask;
+}
+
 template<bool UseCustomCulling, bool bAlsoUseSphereTest>
 static int32 FrustumCull(const FScene* Scene, FViewInfo& View)
 {
@@ -314,10 +431,9 @@ static int32 FrustumCull(const FScene* Scene, FViewInfo& View)
 
 	const int32 BitArrayNum = View.PrimitiveVisibilityMap.Num();
 	const int32 BitArrayWords = FMath::DivideAndRoundUp(View.PrimitiveVisibilityMap.Num(), (int32)NumBitsPerDWORD);
-	const int32 NumTasks = FMath::DivideAndRoundUp(BitArrayWords, FrustumCullNumWordsPerTask);
 
-	ParallelFor(NumTasks, 
-		[&NumCulledPrimitives, Scene, &View, MaxDrawDistanceScale](int32 TaskIndex)
+	ParallelForRange(BitArrayWords, FrustumCullNumWordsPerTask,
+		[&NumCulledPrimitives, Scene, &View, MaxDrawDistanceScale](int32 StartWordIndex, int32 EndWordIndex)
 		{
 			QUICK_SCOPE_CYCLE_COUNTER(STAT_FrustumCull_Loop);
 			const int32 BitArrayNumInner = View.PrimitiveVisibilityMap.Num();
@@ -328,10 +444,14 @@ static int32 FrustumCull(const FScene* Scene, FViewInfo& View)
 			// Primitives may be explicitly removed from stereo views when using mono
 			const bool UseMonoCulling = View.Family->IsMonoscopicFarFieldEnabled() && (View.StereoPass == eSSP_LEFT_EYE || View.StereoPass == eSSP_RIGHT_EYE);
 
-			const int32 TaskWordOffset = TaskIndex * FrustumCullNumWordsPerTask;
+			const FFrustumCullPlanes FrustumPlanes(View.ViewFrustum);
 
-			for (int32 WordIndex = TaskWordOffset; WordIndex < TaskWordOffset + FrustumCullNumWordsPerTask && WordIndex * NumBitsPerDWORD < BitArrayNumInner; WordIndex++)
+			for (int32 WordIndex = StartWordIndex; WordIndex < EndWordIndex && WordIndex * NumBitsPerDWORD < BitArrayNumInner; WordIndex++)
 			{
+				// The box test of the whole word is done upfront, the remaining tests are cheap enough or rarely enabled
+				const int32 NumInWord = FMath::Min<int32>(NumBitsPerDWORD, BitArrayNumInner - WordIndex * NumBitsPerDWORD);
+				const uint32 FrustumBits = FrustumCullBoxes(&Scene->PrimitiveBounds[WordIndex * NumBitsPerDWORD], NumInWord, FrustumPlanes);
+
 				uint32 Mask = 0x1;
 				uint32 VisBits = 0;
 				uint32 FadingBits = 0;
@@ -360,7 +480,7 @@ static int32 FrustumCull(const FScene* Scene, FViewInfo& View)
 						(DistanceSquared < Bounds.MinDrawDistanceSq) ||
 						(UseCustomCulling && !View.CustomVisibilityQuery->IsVisible(VisibilityId, FBoxSphereBounds(Bounds.Origin, Bounds.BoxExtent, Bounds.SphereRadius))) ||
 						(bAlsoUseSphereTest && View.ViewFrustum.IntersectSphere(Bounds.Origin, Bounds.SphereRadius) == false) ||
-						View.ViewFrustum.IntersectBox(Bounds.Origin, Bounds.BoxExtent) == false ||
+						(FrustumBits & Mask) == 0 ||
 						(UseMonoCulling && Scene->Primitives[Index]->Proxy->RenderInMono()))
 					{
 						STAT(NumCulledPrimitives.Increment());
@@ -394,7 +514,7 @@ static int32 FrustumCull(const FScene* Scene, FViewInfo& View)
 				}
 			}
 		},
-		!FApp::ShouldUseThreadingForPerformance() || (UseCustomCulling && !View.CustomVisibilityQuery->IsThreadsafe()) || CVarParallelInitViews.GetValueOnRenderThread() == 0
+		(!FApp::ShouldUseThreadingForPerformance() || (UseCustomCulling && !View.CustomVisibilityQuery->IsThreadsafe()) || CVarParallelInitViews.GetValueOnRenderThread() == 0) ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None
 	);
 
 	return NumCulledPrimitives.GetValue();
@@ -1279,6 +1399,9 @@ static int32 OcclusionCull(FRHICommandListImmediate& RHICmdList, const FScene* S
 		}
 	}
 
+	// Software occlusion results are from this frame, so they run first and spare the primitives they cull an occlusion query
+	NumOccludedPrimitives += SoftwareOcclusionCull(Scene, View);
+
 	float CurrentRealTime = View.Family->CurrentRealTime;
 	if (ViewState)
 	{
@@ -1433,6 +1556,7 @@ struct FRelevancePacket
 	bool bUsesGlobalDistanceField;
 	bool bUsesLightingChannels;
 	bool bTranslucentSurfaceLighting;
+	bool bTranslucentVolumeLighting;
 	bool bUsesSceneDepth;
 
 	FRelevancePacket(
@@ -1459,6 +1583,7 @@ struct FRelevancePacket
 		, bUsesGlobalDistanceField(false)
 		, bUsesLightingChannels(false)
 		, bTranslucentSurfaceLighting(false)
+		, bTranslucentVolumeLighting(false)
 		, bUsesSceneDepth(false)
 	{
 	}
@@ -1475,6 +1600,7 @@ struct FRelevancePacket
 		bUsesGlobalDistanceField = false;
 		bUsesLightingChannels = false;
 		bTranslucentSurfaceLighting = false;
+		bTranslucentVolumeLighting = false;
 
 		SCOPE_CYCLE_COUNTER(STAT_ComputeViewRelevance);
 		for (int32 Index = 0; Index < Input.NumPrims; Index++)
@@ -1555,6 +1681,7 @@ struct FRelevancePacket
 			bUsesGlobalDistanceField |= ViewRelevance.bUsesGlobalDistanceField;
 			bUsesLightingChannels |= ViewRelevance.bUsesLightingChannels;
 			bTranslucentSurfaceLighting |= ViewRelevance.bTranslucentSurfaceLighting;
+			bTranslucentVolumeLighting |= ViewRelevance.bTranslucentVolumeLighting;
 			bUsesSceneDepth |= ViewRelevance.bUsesSceneDepth;
 
 			if (ViewRelevance.bRenderCustomDepth)
@@ -1751,6 +1878,7 @@ struct FRelevancePacket
 		WriteView.bUsesGlobalDistanceField |= bUsesGlobalDistanceField;
 		WriteView.bUsesLightingChannels |= bUsesLightingChannels;
 		WriteView.bTranslucentSurfaceLighting |= bTranslucentSurfaceLighting;
+		WriteView.bTranslucentVolumeLighting |= bTranslucentVolumeLighting;
 		WriteView.bUsesSceneDepth |= bUsesSceneDepth;
 		VisibleEditorPrimitives.AppendTo(WriteView.VisibleEditorPrimitives);
 		VisibleDynamicPrimitives.AppendTo(WriteView.VisibleDynamicPrimitives);
@@ -1836,12 +1964,16 @@ static void ComputeAndMarkRelevanceForViewParallel(
 	}
 	{
 		QUICK_SCOPE_CYCLE_COUNTER(STAT_ComputeAndMarkRelevanceForViewParallel_ParallelFor);
-		ParallelFor(Packets.Num(), 
-			[&Packets](int32 Index)
+		// packets hold a fixed number of primitives but their cost varies a lot, so let the range shrink as it drains
+		ParallelForRange(Packets.Num(), 1,
+			[&Packets](int32 StartIndex, int32 EndIndex)
 			{
-				Packets[Index]->AnyThreadTask();
+				for (int32 Index = StartIndex; Index < EndIndex; Index++)
+				{
+					Packets[Index]->AnyThreadTask();
+				}
 			},
-			!(FApp::ShouldUseThreadingForPerformance() && CVarParallelInitViews.GetValueOnRenderThread() > 0)
+			!(FApp::ShouldUseThreadingForPerformance() && CVarParallelInitViews.GetValueOnRenderThread() > 0) ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None
 		);
 	}
 	{
@@ -1931,6 +2063,16 @@ static void ComputeAndMarkRelevanceForViewParallel(
 	}
 }
 
+/** Meshes gathered by a task thread, for a contiguous range of the primitives gathered in parallel */
+struct FParallelDynamicMeshElements
+{
+	/** Gathered meshes of each view */
+	TArray<TArray<FMeshBatchAndRelevance>, TInlineAllocator<2> > ViewMeshes;
+
+	/** [LocalPrimitiveIndex * ViewCount + ViewIndex] = end index in ViewMeshes[ViewIndex] */
+	TArray<int32> MeshEndIndices;
+};
+
 void FSceneRenderer::GatherDynamicMeshElements(
 	TArray<FViewInfo>& InViews, 
 	const FScene* InScene, 
@@ -1946,6 +2088,97 @@ void FSceneRenderer::GatherDynamicMeshElements(
 
 	int32 ViewCount = InViews.Num();
 	{
+		const bool bIsInstancedStereo = (ViewCount > 0) ? (InViews[0].IsInstancedStereoPass() || InViews[0].bIsMobileMultiViewEnabled) : false;
+
+		// Primitives gathered on task threads, each task gathers a contiguous range of them with its own collector
+		TArray<int32, SceneRenderingAllocator> ParallelPrimitiveIndices;
+		TArray<FParallelDynamicMeshElements, SceneRenderingAllocator> ParallelResults;
+
+		if (FApp::ShouldUseThreadingForPerformance() && CVarParallelGatherDynamicMeshElements.GetValueOnRenderThread() > 0)
+		{
+			for (int32 PrimitiveIndex = 0; PrimitiveIndex < NumPrimitives; ++PrimitiveIndex)
+			{
+				if (HasDynamicMeshElementsMasks[PrimitiveIndex] != 0 && InScene->Primitives[PrimitiveIndex]->Proxy->CanGatherDynamicMeshElementsInParallel(InViewFamily))
+				{
+					ParallelPrimitiveIndices.Add(PrimitiveIndex);
+				}
+			}
+
+			const int32 MinPrimitivesPerTask = FMath::Max(CVarParallelGatherDynamicMeshElementsMinPrimitives.GetValueOnRenderThread(), 1);
+			const int32 NumTasks = FMath::Min(ParallelPrimitiveIndices.Num() / MinPrimitivesPerTask, FTaskGraphInterface::Get().GetNumWorkerThreads() + 1);
+
+			if (NumTasks > 1)
+			{
+				QUICK_SCOPE_CYCLE_COUNTER(STAT_GatherDynamicMeshElements_Parallel);
+
+				// The collectors own the gathered mesh batches and one frame resources, so they are kept until the end of the frame
+				const int32 FirstCollectorIndex = ParallelMeshCollectors.Num();
+
+				for (int32 TaskIndex = 0; TaskIndex < NumTasks; TaskIndex++)
+				{
+					ParallelMeshCollectors.Add(new FMeshElementCollector(FMeshElementCollector::FTaskThreadCollector()));
+				}
+
+				ParallelResults.SetNum(NumTasks);
+
+				ParallelFor(NumTasks, 
+					[this, &InViews, &InViewFamily, &HasDynamicMeshElementsMasks, &ParallelPrimitiveIndices, &ParallelResults, InScene, ViewCount, NumTasks, FirstCollectorIndex, bIsInstancedStereo](int32 TaskIndex)
+					{
+						FMemMark Mark(FMemStack::Get());
+
+						FMeshElementCollector& TaskCollector = *ParallelMeshCollectors[FirstCollectorIndex + TaskIndex];
+						FParallelDynamicMeshElements& Result = ParallelResults[TaskIndex];
+
+						// The collector adds to SceneRenderingAllocator arrays, allocated from this thread's mem stack, so they are copied out before the mark is popped
+						TArray<TArray<FMeshBatchAndRelevance, SceneRenderingAllocator>, TInlineAllocator<2> > TaskViewMeshes;
+						TArray<FSimpleElementCollector, TInlineAllocator<2> > TaskSimpleElementCollectors;
+						TaskViewMeshes.SetNum(ViewCount);
+						TaskSimpleElementCollectors.SetNum(ViewCount);
+
+						TaskCollector.ClearViewMeshArrays();
+
+						for (int32 ViewIndex = 0; ViewIndex < ViewCount; ViewIndex++)
+						{
+							TaskCollector.AddViewMeshArrays(&InViews[ViewIndex], &TaskViewMeshes[ViewIndex], &TaskSimpleElementCollectors[ViewIndex], InViewFamily.GetFeatureLevel());
+						}
+
+						const int32 FirstIndex = ParallelPrimitiveIndices.Num() * TaskIndex / NumTasks;
+						const int32 EndIndex = ParallelPrimitiveIndices.Num() * (TaskIndex + 1) / NumTasks;
+						Result.MeshEndIndices.Empty((EndIndex - FirstIndex) * ViewCount);
+
+						for (int32 Index = FirstIndex; Index < EndIndex; Index++)
+						{
+							const int32 PrimitiveIndex = ParallelPrimitiveIndices[Index];
+							const uint8 ViewMask = HasDynamicMeshElementsMasks[PrimitiveIndex];
+							const uint8 ViewMaskFinal = (bIsInstancedStereo) ? ViewMask | 0x3 : ViewMask;
+
+							FPrimitiveSceneInfo* PrimitiveSceneInfo = InScene->Primitives[PrimitiveIndex];
+							TaskCollector.SetPrimitive(PrimitiveSceneInfo->Proxy, PrimitiveSceneInfo->DefaultDynamicHitProxyId);
+							PrimitiveSceneInfo->Proxy->GetDynamicMeshElements(InViewFamily.Views, InViewFamily, ViewMaskFinal, TaskCollector);
+
+							for (int32 ViewIndex = 0; ViewIndex < ViewCount; ViewIndex++)
+							{
+								Result.MeshEndIndices.Add(TaskCollector.GetMeshBatchCount(ViewIndex));
+							}
+						}
+
+						Result.ViewMeshes.SetNum(ViewCount);
+
+						for (int32 ViewIndex = 0; ViewIndex < ViewCount; ViewIndex++)
+						{
+							Result.ViewMeshes[ViewIndex].Append(TaskViewMeshes[ViewIndex]);
+							ensureMsgf(!TaskSimpleElementCollectors[ViewIndex].BatchedElements.HasPrimsToDraw(), TEXT("A primitive gathered in parallel drew with the PDI, CanGatherDynamicMeshElementsInParallel should return false in that case."));
+						}
+
+						TaskCollector.ClearViewMeshArrays();
+					});
+			}
+			else
+			{
+				ParallelPrimitiveIndices.Reset();
+			}
+		}
+
 		Collector.ClearViewMeshArrays();
 
 		for (int32 ViewIndex = 0; ViewIndex < ViewCount; ViewIndex++)
@@ -1953,13 +2186,34 @@ void FSceneRenderer::GatherDynamicMeshElements(
 			Collector.AddViewMeshArrays(&InViews[ViewIndex], &InViews[ViewIndex].DynamicMeshElements, &InViews[ViewIndex].SimpleElementCollector, InViewFamily.GetFeatureLevel());
 		}
 
-		const bool bIsInstancedStereo = (ViewCount > 0) ? (InViews[0].IsInstancedStereoPass() || InViews[0].bIsMobileMultiViewEnabled) : false;
+		// Merge the meshes of the primitives gathered in parallel in primitive order, to keep the ranges of GetDynamicMeshElementRange()
+		int32 NextParallelIndex = 0;
+		int32 ParallelTaskIndex = 0;
 
 		for (int32 PrimitiveIndex = 0; PrimitiveIndex < NumPrimitives; ++PrimitiveIndex)
 		{
 			const uint8 ViewMask = HasDynamicMeshElementsMasks[PrimitiveIndex];
 
-			if (ViewMask != 0)
+			if (NextParallelIndex < ParallelPrimitiveIndices.Num() && ParallelPrimitiveIndices[NextParallelIndex] == PrimitiveIndex)
+			{
+				while (NextParallelIndex >= ParallelPrimitiveIndices.Num() * (ParallelTaskIndex + 1) / ParallelResults.Num())
+				{
+					ParallelTaskIndex++;
+				}
+
+				const FParallelDynamicMeshElements& Result = ParallelResults[ParallelTaskIndex];
+				const int32 LocalIndex = NextParallelIndex - ParallelPrimitiveIndices.Num() * ParallelTaskIndex / ParallelResults.Num();
+
+				for (int32 ViewIndex = 0; ViewIndex < ViewCount; ViewIndex++)
+				{
+					const int32 StartMeshIndex = LocalIndex == 0 ? 0 : Result.MeshEndIndices[(LocalIndex - 1) * ViewCount + ViewIndex];
+					const int32 EndMeshIndex = Result.MeshEndIndices[LocalIndex * ViewCount + ViewIndex];
+					InViews[ViewIndex].DynamicMeshElements.Append(Result.ViewMeshes[ViewIndex].GetData() + StartMeshIndex, EndMeshIndex - StartMeshIndex);
+				}
+
+				NextParallelIndex++;
+			}
+			else if (ViewMask != 0)
 			{
 				// Don't cull a single eye when drawing a stereo pair
 				const uint8 ViewMaskFinal = (bIsInstancedStereo) ? ViewMask | 0x3 : ViewMask;
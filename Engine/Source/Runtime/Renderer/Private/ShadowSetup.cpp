@@ -73,6 +73,15 @@ FAutoConsoleVariableRef CVarCachedWholeSceneShadowsCastFromMovablePrimitives(
 	ECVF_Scalability | ECVF_RenderThreadSafe
 	);
 
+int32 GCachedShadowsKeepHigherResolution = 1;
+FAutoConsoleVariableRef CVarCachedShadowsKeepHigherResolution(
+	TEXT("r.Shadow.CachedShadowsKeepHigherResolution"),
+	GCachedShadowsKeepHigherResolution,
+	TEXT("Whether a cached whole scene shadow keeps its resolution when the desired resolution drops by up to half, for example as the camera moves away from the light.\n")
+	TEXT("Otherwise every resolution change renders the static primitives into a new cached shadowmap."),
+	ECVF_Scalability | ECVF_RenderThreadSafe
+	);
+
 /** Can be used to visualize preshadow frustums when the shadowfrustums show flag is enabled. */
 static TAutoConsoleVariable<int32> CVarDrawPreshadowFrustum(
 	TEXT("r.Shadow.DrawPreshadowFrustums"),
@@ -1953,6 +1962,26 @@ void FSceneRenderer::CreateWholeSceneProjectedShadow(FLightSceneInfo* LightScene
 					SizeX = SizeY = SceneContext_ConstantsOnly.GetCubeShadowDepthZResolution(SceneContext_ConstantsOnly.GetCubeShadowDepthZIndex(MaxDesiredResolution));
 				}
 
+				if (GCacheWholeSceneShadows && GCachedShadowsKeepHigherResolution && !bAnyViewIsSceneCapture && !ProjectedShadowInitializer.bRayTracedDistanceField)
+				{
+					const FCachedShadowMapData* CachedShadowMapData = Scene->CachedShadowMaps.Find(LightSceneInfo->Id);
+
+					if (CachedShadowMapData 
+						&& CachedShadowMapData->ShadowMap.IsValid() 
+						&& ProjectedShadowInitializer.IsCachedShadowValid(CachedShadowMapData->Initializer))
+					{
+						const FIntPoint CachedSize = CachedShadowMapData->ShadowMap.GetSize() - FIntPoint(EffectiveDoubleShadowBorder, EffectiveDoubleShadowBorder);
+
+						// Reuse the static primitive depths at their higher resolution rather than rendering them again at the lower one
+						if (CachedSize.X >= SizeX && CachedSize.X <= SizeX * 2 && CachedSize.X <= (int32)MaxShadowResolution
+							&& CachedSize.Y >= SizeY && CachedSize.Y <= SizeY * 2 && CachedSize.Y <= (int32)MaxShadowResolutionY)
+						{
+							SizeX = CachedSize.X;
+							SizeY = CachedSize.Y;
+						}
+					}
+				}
+
 				int32 NumShadowMaps = 1;
 				EShadowDepthCacheMode CacheMode[2] = { SDCM_Uncached, SDCM_Uncached };
 
@@ -167,14 +167,26 @@ private:
 	/**
 	 * This structure stores the info needed for visibility culling a static mesh element.
 	 * Stored separately to avoid bringing the other info about non-visible meshes into the cache.
+	 * The batch element info is resolved when the mesh is added, so filtering visible meshes never touches the FStaticMesh.
 	 */
 	struct FElementCompact
 	{
 		int32 MeshId;
+		uint16 NumBatchElements;
+		uint16 bRequiresPerElementVisibility : 1;
+
 		FElementCompact() {}
-		FElementCompact(int32 InMeshId)
-			: MeshId(InMeshId)
+		FElementCompact(const FStaticMesh& InMesh)
+			: MeshId(InMesh.Id)
+			, NumBatchElements((uint16)InMesh.Elements.Num())
+			, bRequiresPerElementVisibility(InMesh.bRequiresPerElementVisibility)
 		{}
+
+		/** Returns the mask of the visible batch elements, avoiding the cache miss looking up batch visibility if the mesh doesn't need it. */
+		FORCEINLINE uint64 GetBatchElementMask(const TArray<uint64, SceneRenderingAllocator>& BatchVisibilityArray) const
+		{
+			return bRequiresPerElementVisibility ? BatchVisibilityArray[MeshId] : ((1ull << NumBatchElements) - 1);
+		}
 	};
 
 	struct FElement
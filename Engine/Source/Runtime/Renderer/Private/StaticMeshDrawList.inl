@@ -266,7 +266,7 @@ void TStaticMeshDrawList<DrawingPolicyType>::AddMesh(
 	const SIZE_T PreviousElementsSize = DrawingPolicyLink->Elements.GetAllocatedSize();
 	const SIZE_T PreviousCompactElementsSize = DrawingPolicyLink->CompactElements.GetAllocatedSize();
 	FElement* Element = new(DrawingPolicyLink->Elements) FElement(Mesh, PolicyData, this, DrawingPolicyLink->SetId, ElementIndex);
-	new(DrawingPolicyLink->CompactElements) FElementCompact(Mesh->Id);
+	new(DrawingPolicyLink->CompactElements) FElementCompact(*Mesh);
 	TotalBytesUsed += DrawingPolicyLink->Elements.GetAllocatedSize() - PreviousElementsSize + DrawingPolicyLink->CompactElements.GetAllocatedSize() - PreviousCompactElementsSize;
 	Mesh->LinkDrawList(Element->Handle);
 
@@ -353,9 +353,7 @@ bool TStaticMeshDrawList<DrawingPolicyType>::DrawVisibleInner(
 				{
 					const FElement& Element = DrawingPolicyLink->Elements[ElementIndex];
 					STAT(StatInc += Element.Mesh->GetNumPrimitives();)
-					int32 SubCount = Element.Mesh->Elements.Num();
-					// Avoid the cache miss looking up batch visibility if there is only one element.
-					uint64 BatchElementMask = Element.Mesh->bRequiresPerElementVisibility ? (*BatchVisibilityArray)[Element.Mesh->Id] : ((1ull << SubCount) - 1);
+					const uint64 BatchElementMask = CompactElementPtr->GetBatchElementMask(*BatchVisibilityArray);
 					Count += DrawElement<InstancedStereoPolicy::Disabled>(RHICmdList, View, PolicyContext, DrawRenderState, Element, BatchElementMask, DrawingPolicyLink, bDrawnShared);
 				}
 			}
@@ -378,9 +376,7 @@ bool TStaticMeshDrawList<DrawingPolicyType>::DrawVisibleInner(
 				{
 					const FElement& Element = DrawingPolicyLink->Elements[ElementIndex];
 					STAT(StatInc += Element.Mesh->GetNumPrimitives();)
-						int32 SubCount = Element.Mesh->Elements.Num();
-					// Avoid the cache miss looking up batch visibility if there is only one element.
-					uint64 BatchElementMask = Element.Mesh->bRequiresPerElementVisibility ? (*ResolvedVisiblityArray)[Element.Mesh->Id] : ((1ull << SubCount) - 1);
+					const uint64 BatchElementMask = CompactElementPtr->GetBatchElementMask(*ResolvedVisiblityArray);
 					Count += DrawElement<InstancedStereo>(RHICmdList, View, PolicyContext, DrawRenderState, Element, BatchElementMask, DrawingPolicyLink, bDrawnShared);
 				}
 			}
@@ -600,22 +596,19 @@ void TStaticMeshDrawList<DrawingPolicyType>::DrawVisibleParallelInternal(
 
 							if (bIsVisible)
 							{
-								const FElement& Element = DrawingPolicyLink->Elements[ElementIndex];
-								const int32 SubCount = Element.Mesh->Elements.Num();
-
 								// Avoid the cache miss looking up batch visibility if there is only one element.
-								if (SubCount == 1)
+								if (CompactElementPtr->NumBatchElements == 1)
 								{
 									++Count;
 								}
 								else if (!bIsInstancedStereo)
 								{
-									Count += CountBits((*BatchVisibilityArray)[Element.Mesh->Id]);
+									Count += CountBits((*BatchVisibilityArray)[CompactElementPtr->MeshId]);
 								}
 								else
 								{
-									const int32 LeftCount = CountBits((*StereoView->LeftViewBatchVisibilityArray)[Element.Mesh->Id]);
-									const int32 RightCount = CountBits((*StereoView->RightViewBatchVisibilityArray)[Element.Mesh->Id]);
+									const int32 LeftCount = CountBits((*StereoView->LeftViewBatchVisibilityArray)[CompactElementPtr->MeshId]);
+									const int32 RightCount = CountBits((*StereoView->RightViewBatchVisibilityArray)[CompactElementPtr->MeshId]);
 									Count += (LeftCount > RightCount) ? LeftCount : RightCount;
 								}
 							}
@@ -877,8 +870,7 @@ int32 TStaticMeshDrawList<DrawingPolicyType>::DrawVisibleFrontToBackInner(
 		STAT(StatInc +=  Element.Mesh->GetNumPrimitives();)
 		const TArray<uint64, SceneRenderingAllocator>* const ResolvedVisiblityArray = (InstancedStereo == InstancedStereoPolicy::Disabled) ? BatchVisibilityArray : ElementVisibility[SortedIndex];
 
-		// Avoid the cache miss looking up batch visibility if there is only one element.
-		uint64 BatchElementMask = Element.Mesh->bRequiresPerElementVisibility ? (*ResolvedVisiblityArray)[Element.Mesh->Id] : ((1ull << Element.Mesh->Elements.Num()) - 1);
+		const uint64 BatchElementMask = DrawingPolicyLink->CompactElements[ElementIndex].GetBatchElementMask(*ResolvedVisiblityArray);
 		DrawElement<InstancedStereoPolicy::Disabled>(RHICmdList, View, PolicyContext, DrawRenderState, Element, BatchElementMask, DrawingPolicyLink, bDrawnShared);
 		NumDraws++;
 	}
@@ -1575,9 +1575,28 @@ static void InjectTranslucentLightArray(FRHICommandListImmediate& RHICmdList, co
 	}
 }
 
+bool FDeferredShadingSceneRenderer::ShouldInjectTranslucentVolumeLighting() const
+{
+	if (!GUseTranslucentLightingVolumes || !GSupportsVolumeTextureRendering)
+	{
+		return false;
+	}
+
+	// Unlit and forward shaded translucency never read the volumes, injecting each light into every cascade would be wasted
+	for (int32 ViewIndex = 0; ViewIndex < Views.Num(); ViewIndex++)
+	{
+		if (Views[ViewIndex].bTranslucentVolumeLighting)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
 void FDeferredShadingSceneRenderer::InjectTranslucentVolumeLighting(FRHICommandListImmediate& RHICmdList, const FLightSceneInfo& LightSceneInfo, const FProjectedShadowInfo* InProjectedShadowInfo)
 {
-	if (GUseTranslucentLightingVolumes && GSupportsVolumeTextureRendering)
+	if (ShouldInjectTranslucentVolumeLighting())
 	{
 		SCOPE_CYCLE_COUNTER(STAT_TranslucentInjectTime);
 
@@ -1723,7 +1742,19 @@ void FDeferredShadingSceneRenderer::InjectSimpleTranslucentVolumeLightingArray(F
 				CW_RGB, BO_Add, BF_One, BF_One, BO_Add, BF_Zero, BF_One,
 				CW_RGB, BO_Add, BF_One, BF_One, BO_Add, BF_Zero, BF_One>::GetRHI();
 			GraphicsPSOInit.PrimitiveType = PT_TriangleStrip;
-		
+
+			TShaderMapRef<FWriteToSliceVS> VertexShader(View.ShaderMap);
+			TOptionalShaderMapRef<FWriteToSliceGS> GeometryShader(View.ShaderMap);
+			TShaderMapRef<FSimpleLightTranslucentLightingInjectPS> PixelShader(View.ShaderMap);
+
+			GraphicsPSOInit.BoundShaderState.VertexDeclarationRHI = GScreenVertexDeclaration.VertexDeclarationRHI;
+			GraphicsPSOInit.BoundShaderState.VertexShaderRHI = GETSAFERHISHADER_VERTEX(*VertexShader);
+			GraphicsPSOInit.BoundShaderState.GeometryShaderRHI = GETSAFERHISHADER_GEOMETRY(*GeometryShader);
+			GraphicsPSOInit.BoundShaderState.PixelShaderRHI = GETSAFERHISHADER_PIXEL(*PixelShader);
+
+			// All simple lights share the pipeline state, only the shader parameters change per light
+			SetGraphicsPipelineState(RHICmdList, GraphicsPSOInit);
+
 			for (int32 LightIndex = 0; LightIndex < SimpleLights.InstanceData.Num(); LightIndex++)
 			{
 				const FSimpleLightEntry& SimpleLight = SimpleLights.InstanceData[LightIndex];
@@ -1736,17 +1767,6 @@ void FDeferredShadingSceneRenderer::InjectSimpleTranslucentVolumeLightingArray(F
 
 					if (VolumeBounds.IsValid())
 					{
-						TShaderMapRef<FWriteToSliceVS> VertexShader(View.ShaderMap);
-						TOptionalShaderMapRef<FWriteToSliceGS> GeometryShader(View.ShaderMap);
-						TShaderMapRef<FSimpleLightTranslucentLightingInjectPS> PixelShader(View.ShaderMap);
-
-						GraphicsPSOInit.BoundShaderState.VertexDeclarationRHI = GScreenVertexDeclaration.VertexDeclarationRHI;
-						GraphicsPSOInit.BoundShaderState.VertexShaderRHI = GETSAFERHISHADER_VERTEX(*VertexShader);
-						GraphicsPSOInit.BoundShaderState.GeometryShaderRHI = GETSAFERHISHADER_GEOMETRY(*GeometryShader);
-						GraphicsPSOInit.BoundShaderState.PixelShaderRHI = GETSAFERHISHADER_PIXEL(*PixelShader);
-
-						SetGraphicsPipelineState(RHICmdList, GraphicsPSOInit);
-
 						VertexShader->SetParameters(RHICmdList, VolumeBounds, FIntVector(GTranslucencyLightingVolumeDim));
 						if(GeometryShader.IsValid())
 						{
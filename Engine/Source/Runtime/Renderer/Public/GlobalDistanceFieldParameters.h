@@ -70,8 +70,8 @@ public:
 		return Ar;
 	}
 
-	template<typename ShaderRHIParamRef>
-	FORCEINLINE_DEBUGGABLE void Set(FRHICommandList& RHICmdList, const ShaderRHIParamRef ShaderRHI, const FGlobalDistanceFieldParameterData& ParameterData)
+	template<typename ShaderRHIParamRef, typename TRHICmdList>
+	FORCEINLINE_DEBUGGABLE void Set(TRHICmdList& RHICmdList, const ShaderRHIParamRef ShaderRHI, const FGlobalDistanceFieldParameterData& ParameterData)
 	{
 		if (GlobalVolumeCenterAndExtent.IsBound() || GlobalVolumeWorldToUVAddAndMul.IsBound())
 		{
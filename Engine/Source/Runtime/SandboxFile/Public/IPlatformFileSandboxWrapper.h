@@ -633,6 +633,16 @@ public:
 		return LowerLevel->OpenAsyncRead(Filename);
 	}
 
+	virtual IMappedFileHandle* OpenMapped(const TCHAR* Filename) override
+	{
+		FString UserFilename(*ConvertToSandboxPath(Filename));
+		if (!OkForInnerAccess(Filename) || LowerLevel->FileExists(*UserFilename))
+		{
+			return LowerLevel->OpenMapped(*UserFilename);
+		}
+		return LowerLevel->OpenMapped(Filename);
+	}
+
 };
 
 
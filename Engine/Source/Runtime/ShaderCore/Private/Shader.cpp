@@ -5,6 +5,7 @@
 =============================================================================*/
 
 #include "Shader.h"
+#include "HAL/LowLevelMemTracker.h"
 #include "Misc/CoreMisc.h"
 #include "Stats/StatsMisc.h"
 #include "Serialization/MemoryWriter.h"
@@ -370,6 +371,7 @@ void FShaderType::Uninitialize()
 }
 
 TMap<FShaderResourceId, FShaderResource*> FShaderResource::ShaderResourceIdMap;
+uint32 FShaderResource::ShaderResourceIdMapGeneration = 0;
 
 FShaderResource::FShaderResource()
 	: SpecificType(NULL)
@@ -403,6 +405,7 @@ FShaderResource::FShaderResource(const FShaderCompilerOutput& Output, FShaderTyp
 	{
 		check(IsInGameThread());
 		ShaderResourceIdMap.Add(GetId(), this);
+		++ShaderResourceIdMapGeneration;
 	}
 	
 	INC_DWORD_STAT_BY_FName(GetMemoryStatType((EShaderFrequency)Target.Frequency).GetName(), Code.Num());
@@ -456,11 +459,13 @@ void FShaderResource::Register()
 {
 	check(IsInGameThread());
 	ShaderResourceIdMap.Add(GetId(), this);
+	++ShaderResourceIdMapGeneration;
 }
 
 
 void FShaderResource::Serialize(FArchive& Ar)
 {
+	LLM_SCOPE(ELLMTag::Shaders);
 	Ar.UsingCustomVersion(FRenderingObjectVersion::GUID);
 
 	Ar << SpecificType;
@@ -536,6 +541,7 @@ void FShaderResource::Release()
 	if(--NumRefs == 0)
 	{
 		ShaderResourceIdMap.Remove(GetId());
+		++ShaderResourceIdMapGeneration;
 
 		// Send a release message to the rendering thread when the shader loses its last reference.
 		BeginReleaseResource(this);
@@ -576,6 +582,22 @@ void FShaderResource::GetAllShaderResourceId(TArray<FShaderResourceId>& Ids)
 	ShaderResourceIdMap.GetKeys(Ids);
 }
 
+void FShaderResource::GetAllShaderResourcesByHash(TMap<FSHAHash, FShaderResource*>& OutResources)
+{
+	check(IsInGameThread());
+	OutResources.Empty(ShaderResourceIdMap.Num());
+	for (const TPair<FShaderResourceId, FShaderResource*>& Pair : ShaderResourceIdMap)
+	{
+		OutResources.Add(Pair.Key.OutputHash, Pair.Value);
+	}
+}
+
+uint32 FShaderResource::GetShaderResourceGeneration()
+{
+	check(IsInGameThread());
+	return ShaderResourceIdMapGeneration;
+}
+
 void FShaderResource::FinishCleanup()
 {
 	delete this;
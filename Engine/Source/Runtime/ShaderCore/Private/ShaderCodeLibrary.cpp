@@ -10,6 +10,7 @@
 #include "Misc/Paths.h"
 #include "Math/UnitConversion.h"
 #include "HAL/FileManagerGeneric.h"
+#include "Misc/ScopeLock.h"
 
 #include "IShaderFormatArchive.h"
 
@@ -41,6 +42,49 @@ static FArchive& operator <<(FArchive& Ar, FShaderArchiveEntry& Ref)
 	return Ar << Ref.Offset << Ref.Size << Ref.UncompressedSize << Ref.Frequency;
 }
 
+// Single file holding the unique shader code of the library, in the same directory as the loose files
+static const TCHAR* ShaderCodeArchiveFilename = TEXT("ShaderArchive.ushaderarchive");
+static const uint32 ShaderCodeArchiveMagic = 0x41434853; // 'SHCA'
+static const uint32 ShaderCodeArchiveVersion = 1;
+
+/** Reads the entry table of a shader code archive, the header points to the table written after the code */
+static bool ReadShaderCodeArchiveTable(FArchive& Ar, TMap<FSHAHash, FShaderArchiveEntry>& OutEntries)
+{
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	int64 TableOffset = 0;
+	Ar << Magic << Version << TableOffset;
+
+	if (Magic != ShaderCodeArchiveMagic || Version != ShaderCodeArchiveVersion || TableOffset <= 0 || TableOffset >= Ar.TotalSize())
+	{
+		return false;
+	}
+
+	Ar.Seek(TableOffset);
+
+	int32 NumEntries = 0;
+	Ar << NumEntries;
+	OutEntries.Reserve(NumEntries);
+	for (int32 Index = 0; Index < NumEntries && !Ar.IsError(); ++Index)
+	{
+		FSHAHash Hash;
+		FShaderArchiveEntry Entry;
+		Ar << Hash << Entry;
+		OutEntries.Add(Hash, Entry);
+	}
+
+	return !Ar.IsError();
+}
+
+/** Reads the code of an archive entry, the size being OutCode.Num() */
+static bool ReadShaderCodeArchiveCode(FArchive& Ar, const FShaderArchiveEntry& Entry, TArray<uint8>& OutCode)
+{
+	OutCode.SetNumUninitialized(Entry.Size);
+	Ar.Seek(Entry.Offset);
+	Ar.Serialize(OutCode.GetData(), Entry.Size);
+	return !Ar.IsError();
+}
+
 static TArray<uint8>& FShaderLibraryHelperUncompressCode(EShaderPlatform Platform, uint32 UncompressedSize, TArray<uint8>& Code, TArray<uint8>& UncompressedCode)
 {
 	if (RHISupportsShaderCompression(Platform) && Code.Num() != UncompressedSize)
@@ -79,8 +123,10 @@ static void FShaderLibraryHelperCompressCode(EShaderPlatform Platform, const TAr
 
 struct FShaderCodeEntry
 {
+	// Empty when the code is in the shader code archive
 	FString FileName;
 	EShaderFrequency Frequency;
+	FShaderArchiveEntry ArchiveEntry;
 };
 
 class FShaderCodeArchive final : public FShaderFactoryInterface
@@ -89,6 +135,7 @@ public:
 	FShaderCodeArchive(EShaderPlatform InPlatform, FString const& Filename)
 	: FShaderFactoryInterface(InPlatform)
 	, FilePath(Filename)
+	, ArchiveReader(nullptr)
 	{
 		TArray<FString> ShaderFiles;
 		IFileManager::Get().FindFiles(ShaderFiles, *Filename, TEXT("*.ushaderbytecode"));
@@ -110,12 +157,42 @@ public:
 				Shaders.Add(Hash, Entry);
 			}
 		}
+
+		// The archive is kept open, its code is only read when a shader gets created
+		FString ArchivePath = Filename / ShaderCodeArchiveFilename;
+		if (IFileManager::Get().FileExists(*ArchivePath))
+		{
+			ArchiveReader = IFileManager::Get().CreateFileReader(*ArchivePath);
+
+			TMap<FSHAHash, FShaderArchiveEntry> ArchiveEntries;
+			if (ArchiveReader && ReadShaderCodeArchiveTable(*ArchiveReader, ArchiveEntries))
+			{
+				for (const TPair<FSHAHash, FShaderArchiveEntry>& Pair : ArchiveEntries)
+				{
+					if (!Shaders.Contains(Pair.Key))
+					{
+						FShaderCodeEntry Entry;
+						Entry.Frequency = (EShaderFrequency)Pair.Value.Frequency;
+						check(Entry.Frequency < SF_NumFrequencies);
+						Entry.ArchiveEntry = Pair.Value;
+						Shaders.Add(Pair.Key, Entry);
+					}
+				}
+			}
+			else
+			{
+				UE_LOG(LogShaders, Warning, TEXT("Failed to read shader code archive %s"), *ArchivePath);
+				delete ArchiveReader;
+				ArchiveReader = nullptr;
+			}
+		}
 		
 		UE_LOG(LogShaders, Display, TEXT("Using %s for material shader code"), *Filename);
 	}
 	
 	virtual ~FShaderCodeArchive()
 	{
+		delete ArchiveReader;
 	}
 	
 	virtual bool IsLibraryNativeFormat() const {return false;}
@@ -123,7 +200,13 @@ public:
 	bool LookupShaderCode(uint8 Frequency, const FSHAHash& Hash, TArray<uint8>& OutCode, uint32& OutSize)
 	{
 		FShaderCodeEntry* Entry = Shaders.Find(Hash);
-		if (Entry)
+		if (Entry && Entry->FileName.IsEmpty())
+		{
+			FScopeLock ScopeLock(&ArchiveCritical);
+			OutSize = Entry->ArchiveEntry.UncompressedSize;
+			return ArchiveReader && ReadShaderCodeArchiveCode(*ArchiveReader, Entry->ArchiveEntry, OutCode);
+		}
+		else if (Entry)
 		{
 			FString Path = FilePath / Entry->FileName;
 			FArchive* Ar = IFileManager::Get().CreateFileReader(*Path);
@@ -310,6 +393,10 @@ private:
 	
 	// The shader files present in the library
 	TMap<FSHAHash, FShaderCodeEntry> Shaders;
+
+	// The shader code archive, when the library was cooked into one, and the lock for reading from it
+	FArchive* ArchiveReader;
+	FCriticalSection ArchiveCritical;
 	
 	// De-serialised pipeline map
 	TSet<FShaderCodeLibraryPipeline> Pipelines;
@@ -459,43 +546,57 @@ struct FEditorShaderCodeArchive
 		
 		IFileManager::Get().MakeDirectory(*DebugPath, true);
 
-		for (TPair<FSHAHash, FEditorShaderCodeEntry>& Pair : Shaders)
+		auto GetCookedCode = [this, Platform, &DebugPath, bNativeFormat](FEditorShaderCodeEntry& Entry, uint32& OutSize, TArray<uint8>& OutCode)
 		{
-			// Write to a temporary file
-			FString TempFilePath = FPaths::CreateTempFilename(*OutputPath, TEXT("ShaderCodeArchive-"));
-			FArchive* FileWriter = IFileManager::Get().CreateFileWriter(*TempFilePath, FILEWRITE_NoFail);
-			if (FileWriter)
+			check(Format);
+			if (Format->CanStripShaderCode())
 			{
-				check(Format);
-				if (Format->CanStripShaderCode())
+				uint32 Size = Entry.UncompressedSize;
+				TArray<uint8> Code = Entry.Code;
+				
+				TArray<uint8> UCode;
+				TArray<uint8>& UncompressedCode = FShaderLibraryHelperUncompressCode(Platform, Size, Code, UCode);
+				
+				Format->StripShaderCode(UncompressedCode, DebugPath, bNativeFormat);
+				
+				FShaderLibraryHelperCompressCode(Platform, UncompressedCode, OutCode);
+				
+				OutSize = UncompressedCode.Num();
+			}
+			else
+			{
+				OutSize = Entry.UncompressedSize;
+				OutCode = Entry.Code;
+			}
+		};
+
+		if (!bNativeFormat)
+		{
+			// Loose files are only needed to package a native library, otherwise all the code goes into one archive
+			WriteArchive(OutputPath, GetCookedCode);
+		}
+		else
+		{
+			for (TPair<FSHAHash, FEditorShaderCodeEntry>& Pair : Shaders)
+			{
+				// Write to a temporary file
+				FString TempFilePath = FPaths::CreateTempFilename(*OutputPath, TEXT("ShaderCodeArchive-"));
+				FArchive* FileWriter = IFileManager::Get().CreateFileWriter(*TempFilePath, FILEWRITE_NoFail);
+				if (FileWriter)
 				{
-					uint32 Size = Pair.Value.UncompressedSize;
-					TArray<uint8> Code = Pair.Value.Code;
-					
-					TArray<uint8> UCode;
-					TArray<uint8>& UncompressedCode = FShaderLibraryHelperUncompressCode(Platform, Size, Code, UCode);
-					
-					Format->StripShaderCode(UncompressedCode, DebugPath, bNativeFormat);
-					
+					uint32 Size = 0;
 					TArray<uint8> CCode;
-					FShaderLibraryHelperCompressCode(Platform, UncompressedCode, CCode);
-					
-					Size = UncompressedCode.Num();
+					GetCookedCode(Pair.Value, Size, CCode);
 					
 					*FileWriter << Size;
 					*FileWriter << CCode;
+					FileWriter->Close();
+					
+					// As on POSIX only file moves on the same device are atomic
+					FString DestFilePath = OutputPath / Pair.Value.FileName;
+					IFileManager::Get().Move(*DestFilePath, *TempFilePath, false, false, true, true);
+					IFileManager::Get().Delete(*TempFilePath);
 				}
-				else
-				{
-					*FileWriter << Pair.Value.UncompressedSize;
-					*FileWriter << Pair.Value.Code;
-				}
-				FileWriter->Close();
-				
-				// As on POSIX only file moves on the same device are atomic
-				FString DestFilePath = OutputPath / Pair.Value.FileName;
-				IFileManager::Get().Move(*DestFilePath, *TempFilePath, false, false, true, true);
-				IFileManager::Get().Delete(*TempFilePath);
 			}
 		}
 		
@@ -519,6 +620,86 @@ struct FEditorShaderCodeArchive
 		return true;
 	}
 	
+	/**
+	 * Writes the unique shader code in a single archive, sorted by hash so that the same shaders give the same file.
+	 * Code from a previous cook that was not added again is kept, like the loose files are for iterative cooks.
+	 */
+	template<typename GetCookedCodeType>
+	void WriteArchive(const FString& OutputPath, GetCookedCodeType GetCookedCode)
+	{
+		FString ArchivePath = OutputPath / ShaderCodeArchiveFilename;
+		FString TempFilePath = FPaths::CreateTempFilename(*OutputPath, TEXT("ShaderCodeArchive-"));
+		FArchive* FileWriter = IFileManager::Get().CreateFileWriter(*TempFilePath, FILEWRITE_NoFail);
+		if (!FileWriter)
+		{
+			return;
+		}
+
+		uint32 Magic = ShaderCodeArchiveMagic;
+		uint32 Version = ShaderCodeArchiveVersion;
+		int64 TableOffset = 0;
+		*FileWriter << Magic << Version << TableOffset;
+
+		TArray<TPair<FSHAHash, FShaderArchiveEntry>> Table;
+		auto WriteCode = [FileWriter, &Table](const FSHAHash& Hash, uint8 Frequency, uint32 UncompressedSize, TArray<uint8>& Code)
+		{
+			check(FileWriter->Tell() + Code.Num() <= MAX_uint32);
+
+			FShaderArchiveEntry Entry;
+			Entry.Offset = (uint32)FileWriter->Tell();
+			Entry.Size = Code.Num();
+			Entry.UncompressedSize = UncompressedSize;
+			Entry.Frequency = Frequency;
+			FileWriter->Serialize(Code.GetData(), Code.Num());
+
+			Table.Emplace(Hash, Entry);
+		};
+
+		Shaders.KeySort([](const FSHAHash& A, const FSHAHash& B) { return FMemory::Memcmp(A.Hash, B.Hash, sizeof(A.Hash)) < 0; });
+		for (TPair<FSHAHash, FEditorShaderCodeEntry>& Pair : Shaders)
+		{
+			uint32 Size = 0;
+			TArray<uint8> Code;
+			GetCookedCode(Pair.Value, Size, Code);
+			WriteCode(Pair.Key, Pair.Value.Frequency, Size, Code);
+		}
+
+		FArchive* PreviousReader = IFileManager::Get().CreateFileReader(*ArchivePath);
+		if (PreviousReader)
+		{
+			TMap<FSHAHash, FShaderArchiveEntry> PreviousEntries;
+			if (ReadShaderCodeArchiveTable(*PreviousReader, PreviousEntries))
+			{
+				TArray<uint8> Code;
+				for (const TPair<FSHAHash, FShaderArchiveEntry>& Pair : PreviousEntries)
+				{
+					if (!Shaders.Contains(Pair.Key) && ReadShaderCodeArchiveCode(*PreviousReader, Pair.Value, Code))
+					{
+						WriteCode(Pair.Key, Pair.Value.Frequency, Pair.Value.UncompressedSize, Code);
+					}
+				}
+			}
+			delete PreviousReader;
+		}
+
+		TableOffset = FileWriter->Tell();
+		int32 NumEntries = Table.Num();
+		*FileWriter << NumEntries;
+		for (TPair<FSHAHash, FShaderArchiveEntry>& Pair : Table)
+		{
+			*FileWriter << Pair.Key << Pair.Value;
+		}
+
+		FileWriter->Seek(0);
+		*FileWriter << Magic << Version << TableOffset;
+		FileWriter->Close();
+		delete FileWriter;
+
+		// As on POSIX only file moves on the same device are atomic
+		IFileManager::Get().Move(*ArchivePath, *TempFilePath, false, false, true, true);
+		IFileManager::Get().Delete(*TempFilePath);
+	}
+	
 	bool PackageNativeShaderLibrary(const FString& ShaderCodeDir, const FString& DebugShaderCodeDir)
 	{
 		bool bOK = false;
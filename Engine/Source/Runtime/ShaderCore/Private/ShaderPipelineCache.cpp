@@ -0,0 +1,273 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	ShaderPipelineCache.cpp: Background precompilation of recorded pipeline states.
+=============================================================================*/
+
+#include "ShaderPipelineCache.h"
+#include "Containers/Ticker.h"
+#include "Misc/App.h"
+#include "Serialization/MemoryWriter.h"
+#include "RenderingThread.h"
+#include "PipelineStateCache.h"
+#include "Shader.h"
+
+static TAutoConsoleVariable<int32> CVarShaderPipelineCacheBatchSize(
+	TEXT("r.ShaderPipelineCache.BatchSize"),
+	50,
+	TEXT("Number of recorded pipeline states handed to the task threads for precompilation per frame."),
+	ECVF_RenderThreadSafe
+);
+
+static TAutoConsoleVariable<int32> CVarShaderPipelineCacheAcceleratedBatchSize(
+	TEXT("r.ShaderPipelineCache.AcceleratedBatchSize"),
+	500,
+	TEXT("Number of recorded pipeline states handed to the task threads for precompilation per frame, between FShaderPipelineCache::BeginAcceleratedBatching and EndAcceleratedBatching."),
+	ECVF_RenderThreadSafe
+);
+
+FShaderPipelineCache* FShaderPipelineCache::Cache = nullptr;
+
+FShaderPipelineCache::FShaderPipelineCache(EShaderPlatform InPlatform)
+	: Platform(InPlatform)
+	, ShaderResourceGeneration(0)
+	, bAcceleratedBatching(false)
+{
+	// Make sure the first tick looks for the loaded shaders
+	ShaderResourceGeneration = FShaderResource::GetShaderResourceGeneration() - 1;
+}
+
+void FShaderPipelineCache::Initialize(EShaderPlatform Platform)
+{
+	check(IsInGameThread());
+	check(Cache == nullptr);
+
+	if (!FPipelineFileCache::IsPipelineFileCacheEnabled())
+	{
+		return;
+	}
+
+	FPipelineFileCache::OpenPipelineFileCache(FApp::GetGameName(), Platform);
+
+	Cache = new FShaderPipelineCache(Platform);
+	FPipelineFileCache::GetCachedPSOs(Cache->WaitingPSOs);
+
+	if (Cache->WaitingPSOs.Num() > 0)
+	{
+		Cache->TickHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(Cache, &FShaderPipelineCache::Tick));
+	}
+}
+
+void FShaderPipelineCache::Shutdown()
+{
+	if (Cache)
+	{
+		if (Cache->TickHandle.IsValid())
+		{
+			FTicker::GetCoreTicker().RemoveTicker(Cache->TickHandle);
+		}
+
+		delete Cache;
+		Cache = nullptr;
+	}
+}
+
+void FShaderPipelineCache::BeginAcceleratedBatching()
+{
+	if (Cache)
+	{
+		Cache->bAcceleratedBatching = true;
+	}
+}
+
+void FShaderPipelineCache::EndAcceleratedBatching()
+{
+	if (Cache)
+	{
+		Cache->bAcceleratedBatching = false;
+	}
+}
+
+uint32 FShaderPipelineCache::NumPrecompilesRemaining()
+{
+	if (Cache)
+	{
+		return Cache->ReadyPSOs.Num() + Cache->NumSubmitted.GetValue() + GetNumPrecompilingGraphicsPipelineStates();
+	}
+	return 0;
+}
+
+uint32 FShaderPipelineCache::NumPrecompilesWaitingForShaders()
+{
+	return Cache ? Cache->WaitingPSOs.Num() : 0;
+}
+
+bool FShaderPipelineCache::ResolveShaders(const FPipelineCacheFileFormatPSO& PSO, FPrecompileRequest& OutRequest) const
+{
+	auto Resolve = [this](const FSHAHash& Hash, EShaderFrequency Frequency, FShaderResource*& OutResource) -> bool
+	{
+		if (Hash == FSHAHash())
+		{
+			OutResource = nullptr;
+			return true;
+		}
+
+		FShaderResource* const* Found = ShaderResources.Find(Hash);
+		OutResource = (Found && (*Found)->GetFrequency() == Frequency) ? *Found : nullptr;
+		return OutResource != nullptr;
+	};
+
+	OutRequest.PSO = PSO;
+
+	return Resolve(PSO.VertexShader, SF_Vertex, OutRequest.VertexShader) && OutRequest.VertexShader != nullptr &&
+		Resolve(PSO.PixelShader, SF_Pixel, OutRequest.PixelShader) &&
+		Resolve(PSO.GeometryShader, SF_Geometry, OutRequest.GeometryShader) &&
+		Resolve(PSO.HullShader, SF_Hull, OutRequest.HullShader) &&
+		Resolve(PSO.DomainShader, SF_Domain, OutRequest.DomainShader);
+}
+
+bool FShaderPipelineCache::Tick(float DeltaTime)
+{
+	check(IsInGameThread());
+
+	// Shaders were loaded or unloaded, look for the pipeline states that can be compiled now
+	const uint32 CurrentGeneration = FShaderResource::GetShaderResourceGeneration();
+	if (CurrentGeneration != ShaderResourceGeneration)
+	{
+		ShaderResourceGeneration = CurrentGeneration;
+		FShaderResource::GetAllShaderResourcesByHash(ShaderResources);
+
+		FPrecompileRequest Request;
+		for (int32 Index = 0; Index < WaitingPSOs.Num(); ++Index)
+		{
+			if (ResolveShaders(WaitingPSOs[Index], Request))
+			{
+				ReadyPSOs.Add(WaitingPSOs[Index]);
+				WaitingPSOs.RemoveAt(Index--, 1, false);
+			}
+		}
+	}
+
+	if (ReadyPSOs.Num() > 0)
+	{
+		const int32 BatchSize = FMath::Max((bAcceleratedBatching ? CVarShaderPipelineCacheAcceleratedBatchSize : CVarShaderPipelineCacheBatchSize).GetValueOnGameThread(), 1);
+		const int32 NumToSubmit = FMath::Min(BatchSize, ReadyPSOs.Num());
+
+		// Resolved again, shaders may have been unloaded since they became ready. The render command runs before the release of
+		// any shader unloaded after this, so the resources are still valid then.
+		TArray<FPrecompileRequest> Batch;
+		Batch.Reserve(NumToSubmit);
+
+		for (int32 Index = 0; Index < NumToSubmit; ++Index)
+		{
+			FPrecompileRequest Request;
+			if (ResolveShaders(ReadyPSOs[Index], Request))
+			{
+				Batch.Add(Request);
+			}
+			else
+			{
+				WaitingPSOs.Add(ReadyPSOs[Index]);
+			}
+		}
+
+		ReadyPSOs.RemoveAt(0, NumToSubmit);
+		NumSubmitted.Add(Batch.Num());
+
+		FShaderPipelineCache* PipelineCache = this;
+		ENQUEUE_RENDER_COMMAND(PrecompileRecordedPipelineStates)(
+			[PipelineCache, Batch](FRHICommandListImmediate& RHICmdList)
+			{
+				PipelineCache->PrecompileBatch_RenderThread(Batch);
+			});
+	}
+
+	return true;
+}
+
+/** Serializes a state initializer for comparing and hashing */
+template<typename InitializerType>
+static void SerializeInitializer(const InitializerType& Initializer, TArray<uint8>& OutBytes)
+{
+	FMemoryWriter Writer(OutBytes);
+	Writer << const_cast<InitializerType&>(Initializer);
+}
+
+template<typename InitializerType, typename StateRefType, typename CreateFunctionType>
+StateRefType FShaderPipelineCache::FindOrCreateState(TMap<uint32, TArray<TPair<InitializerType, StateRefType>>>& States, const InitializerType& Initializer, CreateFunctionType Create)
+{
+	TArray<uint8> Bytes;
+	SerializeInitializer(Initializer, Bytes);
+
+	TArray<TPair<InitializerType, StateRefType>>& Bucket = States.FindOrAdd(FCrc::MemCrc32(Bytes.GetData(), Bytes.Num()));
+
+	TArray<uint8> OtherBytes;
+	for (const TPair<InitializerType, StateRefType>& Entry : Bucket)
+	{
+		OtherBytes.Reset();
+		SerializeInitializer(Entry.Key, OtherBytes);
+
+		if (OtherBytes == Bytes)
+		{
+			return Entry.Value;
+		}
+	}
+
+	StateRefType State = Create(Initializer);
+	Bucket.Emplace(Initializer, State);
+	return State;
+}
+
+void FShaderPipelineCache::PrecompileBatch_RenderThread(const TArray<FPrecompileRequest>& Batch)
+{
+	check(IsInRenderingThread());
+
+	for (const FPrecompileRequest& Request : Batch)
+	{
+		const FPipelineCacheFileFormatPSO& PSO = Request.PSO;
+
+		FPrecompiledResources Resources;
+		Resources.VertexShader = Request.VertexShader->GetVertexShader();
+		Resources.PixelShader = Request.PixelShader ? Request.PixelShader->GetPixelShader() : nullptr;
+		Resources.GeometryShader = Request.GeometryShader ? Request.GeometryShader->GetGeometryShader() : nullptr;
+		Resources.HullShader = Request.HullShader ? Request.HullShader->GetHullShader() : nullptr;
+		Resources.DomainShader = Request.DomainShader ? Request.DomainShader->GetDomainShader() : nullptr;
+
+		Resources.VertexDeclaration = FindOrCreateState(VertexDeclarations, PSO.VertexDescriptor, [](const FVertexDeclarationElementList& Elements) { return RHICreateVertexDeclaration(Elements); });
+		Resources.BlendState = FindOrCreateState(BlendStates, PSO.BlendState, [](const FBlendStateInitializerRHI& Initializer) { return RHICreateBlendState(Initializer); });
+		Resources.RasterizerState = FindOrCreateState(RasterizerStates, PSO.RasterizerState, [](const FRasterizerStateInitializerRHI& Initializer) { return RHICreateRasterizerState(Initializer); });
+		Resources.DepthStencilState = FindOrCreateState(DepthStencilStates, PSO.DepthStencilState, [](const FDepthStencilStateInitializerRHI& Initializer) { return RHICreateDepthStencilState(Initializer); });
+
+		FGraphicsPipelineStateInitializer Initializer;
+		Initializer.BoundShaderState.VertexDeclarationRHI = Resources.VertexDeclaration;
+		Initializer.BoundShaderState.VertexShaderRHI = Resources.VertexShader;
+		Initializer.BoundShaderState.PixelShaderRHI = Resources.PixelShader;
+		Initializer.BoundShaderState.GeometryShaderRHI = Resources.GeometryShader;
+		Initializer.BoundShaderState.HullShaderRHI = Resources.HullShader;
+		Initializer.BoundShaderState.DomainShaderRHI = Resources.DomainShader;
+		Initializer.BlendState = Resources.BlendState;
+		Initializer.RasterizerState = Resources.RasterizerState;
+		Initializer.DepthStencilState = Resources.DepthStencilState;
+		Initializer.PrimitiveType = (EPrimitiveType)PSO.PrimitiveType;
+		Initializer.RenderTargetsEnabled = PSO.RenderTargetsActive;
+		Initializer.RenderTargetFormats = PSO.RenderTargetFormats;
+		Initializer.RenderTargetFlags = PSO.RenderTargetFlags;
+		Initializer.RenderTargetLoadActions = PSO.RenderTargetLoadActions;
+		Initializer.RenderTargetStoreActions = PSO.RenderTargetStoreActions;
+		Initializer.DepthStencilTargetFormat = PSO.DepthStencilFormat;
+		Initializer.DepthStencilTargetFlag = PSO.DepthStencilFlags;
+		Initializer.DepthTargetLoadAction = PSO.DepthLoad;
+		Initializer.DepthTargetStoreAction = PSO.DepthStore;
+		Initializer.StencilTargetLoadAction = PSO.StencilLoad;
+		Initializer.StencilTargetStoreAction = PSO.StencilStore;
+		Initializer.NumSamples = PSO.NumSamples;
+
+		// Already used at runtime before it got here, or recorded twice
+		if (IsValidRef(Resources.VertexShader) && PrecompileGraphicsPipelineState(Initializer, PSO))
+		{
+			PrecompiledResources.Add(Resources);
+		}
+
+		NumSubmitted.Decrement();
+	}
+}
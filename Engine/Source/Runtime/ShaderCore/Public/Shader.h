@@ -192,6 +192,11 @@ public:
 
 	SHADERCORE_API FShaderResourceId GetId() const;
 
+	EShaderFrequency GetFrequency() const
+	{
+		return (EShaderFrequency)Target.Frequency;
+	}
+
 	uint32 GetSizeBytes() const
 	{
 		return Code.GetAllocatedSize() + sizeof(FShaderResource);
@@ -216,6 +221,12 @@ public:
 	/** Return a list of all shader Ids currently known */
 	SHADERCORE_API static void GetAllShaderResourceId(TArray<FShaderResourceId>& Ids);
 
+	/** Return all shader resources currently known by their output hash, which is also the hash of their RHI shader */
+	SHADERCORE_API static void GetAllShaderResourcesByHash(TMap<FSHAHash, FShaderResource*>& OutResources);
+
+	/** Return a number that changes whenever a shader resource is registered or unregistered, so lookups of the known resources can be cached */
+	SHADERCORE_API static uint32 GetShaderResourceGeneration();
+
 	/** Returns true if and only if TargetPlatform is compatible for use with CurrentPlatform. */
 	SHADERCORE_API static bool ArePlatformsCompatible(EShaderPlatform CurrentPlatform, EShaderPlatform TargetPlatform);
 
@@ -282,6 +293,8 @@ private:
 	static TMap<FShaderResourceId, FShaderResource*> ShaderResourceIdMap;
 	/** Critical section for ShaderResourceIdMap. */
 	static FCriticalSection ShaderResourceIdMapCritical;
+	/** Incremented whenever ShaderResourceIdMap changes. */
+	static uint32 ShaderResourceIdMapGeneration;
 };
 
 /** Encapsulates information about a shader's serialization behavior, used to detect when C++ serialization changes to auto-recompile. */
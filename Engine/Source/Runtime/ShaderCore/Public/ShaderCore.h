@@ -130,7 +130,9 @@ enum ECompilerFlags
 	// Hint that its a vertex to geometry shader
 	CFLAG_VertexToGeometryShader,
 	// Prepare the shader for archiving in the native binary shader cache format
-	CFLAG_Archive
+	CFLAG_Archive,
+	// Reuse the output of an earlier compile with the same preprocessed source, on formats that support it (see r.Shaders.PreprocessedOutputCache)
+	CFLAG_PreprocessedOutputCache
 };
 
 /**
@@ -481,27 +483,33 @@ struct FShaderCompilerInput
 		return Name;
 	}
 
-	friend FArchive& operator<<(FArchive& Ar,FShaderCompilerInput& Input)
+	/** Serializes everything but SharedEnvironment, which the shader compile worker input file stores once for all the jobs sharing it */
+	void SerializeWithoutSharedEnvironment(FArchive& Ar)
 	{
 		// Note: this serialize is used to pass between UE4 and the shader compile worker, recompile both when modifying
-		Ar << Input.Target;
+		Ar << Target;
 		{
-			FString ShaderFormatString(Input.ShaderFormat.ToString());
+			FString ShaderFormatString(ShaderFormat.ToString());
 			Ar << ShaderFormatString;
-			Input.ShaderFormat = FName(*ShaderFormatString);
+			ShaderFormat = FName(*ShaderFormatString);
 		}
-		Ar << Input.SourceFilePrefix;
-		Ar << Input.SourceFilename;
-		Ar << Input.EntryPointName;
-		Ar << Input.bSkipPreprocessedCache;
-		Ar << Input.bCompilingForShaderPipeline;
-		Ar << Input.bGenerateDirectCompileFile;
-		Ar << Input.bIncludeUsedOutputs;
-		Ar << Input.UsedOutputs;
-		Ar << Input.DumpDebugInfoRootPath;
-		Ar << Input.DumpDebugInfoPath;
-		Ar << Input.DebugGroupName;
-		Ar << Input.Environment;
+		Ar << SourceFilePrefix;
+		Ar << SourceFilename;
+		Ar << EntryPointName;
+		Ar << bSkipPreprocessedCache;
+		Ar << bCompilingForShaderPipeline;
+		Ar << bGenerateDirectCompileFile;
+		Ar << bIncludeUsedOutputs;
+		Ar << UsedOutputs;
+		Ar << DumpDebugInfoRootPath;
+		Ar << DumpDebugInfoPath;
+		Ar << DebugGroupName;
+		Ar << Environment;
+	}
+
+	friend FArchive& operator<<(FArchive& Ar,FShaderCompilerInput& Input)
+	{
+		Input.SerializeWithoutSharedEnvironment(Ar);
 
 		bool bHasSharedEnvironment = IsValidRef(Input.SharedEnvironment);
 		Ar << bHasSharedEnvironment;
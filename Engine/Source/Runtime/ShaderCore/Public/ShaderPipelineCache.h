@@ -0,0 +1,111 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	ShaderPipelineCache.h: Background precompilation of recorded pipeline states.
+=============================================================================*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RHI.h"
+#include "PipelineFileCache.h"
+
+class FShaderResource;
+
+/**
+ * Precompiles the graphics pipeline states recorded in the pipeline file cache (see FPipelineFileCache), so they don't hitch on first use.
+ *
+ * A recorded pipeline state can only be compiled once all its shaders are loaded. The cache checks again whenever shaders are
+ * loaded, which covers the global shaders at startup and the material shaders of each level as it loads. The pipeline states that
+ * became ready are handed to the render thread in batches of r.ShaderPipelineCache.BatchSize per frame, and compiled on task threads.
+ */
+class SHADERCORE_API FShaderPipelineCache
+{
+public:
+	/** Opens the pipeline file cache for the platform and starts precompiling, if r.PSOFileCache.Enabled */
+	static void Initialize(EShaderPlatform Platform);
+
+	/** Stops precompiling and releases the precompiled resources, called once the rendering thread is stopped */
+	static void Shutdown();
+
+	/** Use r.ShaderPipelineCache.AcceleratedBatchSize during a loading screen or other scenario where hitches don't matter. */
+	static void BeginAcceleratedBatching();
+
+	/** Goes back to r.ShaderPipelineCache.BatchSize. */
+	static void EndAcceleratedBatching();
+
+	/** Returns the number of pipeline states whose shaders are loaded, waiting for or in precompilation */
+	static uint32 NumPrecompilesRemaining();
+
+	/** Returns the number of recorded pipeline states waiting for their shaders to load */
+	static uint32 NumPrecompilesWaitingForShaders();
+
+private:
+	/** A recorded pipeline state with the shaders it needs */
+	struct FPrecompileRequest
+	{
+		FPipelineCacheFileFormatPSO PSO;
+		FShaderResource* VertexShader;
+		FShaderResource* PixelShader;
+		FShaderResource* GeometryShader;
+		FShaderResource* HullShader;
+		FShaderResource* DomainShader;
+	};
+
+	/** The RHI resources a precompiled pipeline state was created with, which must stay alive as the initializer doesn't reference them */
+	struct FPrecompiledResources
+	{
+		FVertexShaderRHIRef VertexShader;
+		FPixelShaderRHIRef PixelShader;
+		FGeometryShaderRHIRef GeometryShader;
+		FHullShaderRHIRef HullShader;
+		FDomainShaderRHIRef DomainShader;
+		FVertexDeclarationRHIRef VertexDeclaration;
+		FBlendStateRHIRef BlendState;
+		FRasterizerStateRHIRef RasterizerState;
+		FDepthStencilStateRHIRef DepthStencilState;
+	};
+
+	FShaderPipelineCache(EShaderPlatform InPlatform);
+
+	/** Game thread tick, moves the pipeline states whose shaders got loaded to the ready list and hands a batch to the render thread */
+	bool Tick(float DeltaTime);
+
+	/** Finds the shaders of a recorded pipeline state among the loaded shaders */
+	bool ResolveShaders(const FPipelineCacheFileFormatPSO& PSO, FPrecompileRequest& OutRequest) const;
+
+	/** Render thread, creates the resources of the requests and starts their compiles */
+	void PrecompileBatch_RenderThread(const TArray<FPrecompileRequest>& Batch);
+
+	template<typename InitializerType, typename StateRefType, typename CreateFunctionType>
+	StateRefType FindOrCreateState(TMap<uint32, TArray<TPair<InitializerType, StateRefType>>>& States, const InitializerType& Initializer, CreateFunctionType Create);
+
+private:
+	static FShaderPipelineCache* Cache;
+
+	EShaderPlatform Platform;
+
+	FDelegateHandle TickHandle;
+
+	/** Game thread - recorded pipeline states whose shaders aren't all loaded */
+	TArray<FPipelineCacheFileFormatPSO> WaitingPSOs;
+
+	/** Game thread - recorded pipeline states whose shaders are loaded, in recorded order */
+	TArray<FPipelineCacheFileFormatPSO> ReadyPSOs;
+
+	/** Game thread - the loaded shaders by hash, as of ShaderResourceGeneration */
+	TMap<FSHAHash, FShaderResource*> ShaderResources;
+	uint32 ShaderResourceGeneration;
+
+	/** Number of ready pipeline states handed to the render thread that didn't start compiling yet */
+	FThreadSafeCounter NumSubmitted;
+
+	bool bAcceleratedBatching;
+
+	/** Render thread - resources of the precompiled pipeline states, shared between them where possible */
+	TArray<FPrecompiledResources> PrecompiledResources;
+	TMap<uint32, TArray<TPair<FVertexDeclarationElementList, FVertexDeclarationRHIRef>>> VertexDeclarations;
+	TMap<uint32, TArray<TPair<FBlendStateInitializerRHI, FBlendStateRHIRef>>> BlendStates;
+	TMap<uint32, TArray<TPair<FRasterizerStateInitializerRHI, FRasterizerStateRHIRef>>> RasterizerStates;
+	TMap<uint32, TArray<TPair<FDepthStencilStateInitializerRHI, FDepthStencilStateRHIRef>>> DepthStencilStates;
+};
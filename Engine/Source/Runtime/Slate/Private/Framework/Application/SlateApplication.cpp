@@ -2,10 +2,12 @@
 
 
 #include "Framework/Application/SlateApplication.h"
+#include "HAL/LowLevelMemTracker.h"
 #include "Rendering/SlateDrawBuffer.h"
 #include "Misc/CommandLine.h"
 #include "Misc/ScopeLock.h"
 #include "Misc/TimeGuard.h"
+#include "ProfilingDebugging/FrameTrace.h"
 #include "Misc/ConfigCacheIni.h"
 #include "Misc/CoreDelegates.h"
 #include "Misc/App.h"
@@ -1526,7 +1528,9 @@ void FSlateApplication::FinishedInputThisFrame()
 
 void FSlateApplication::Tick(ESlateTickType TickType)
 {
+	LLM_SCOPE(ELLMTag::UI);
 	SCOPE_TIME_GUARD(TEXT("FSlateApplication::Tick"));
+	FRAME_TRACE_SCOPE("FSlateApplication::Tick");
 
 	// It is not valid to tick Slate on any other thread but the game thread unless we are only updating time
 	check(IsInGameThread() || TickType == ESlateTickType::TimeOnly);
@@ -72,7 +72,7 @@ void SImage::SetColorAndOpacity( const TAttribute<FSlateColor>& InColorAndOpacit
 	if ( !ColorAndOpacity.IdenticalTo(InColorAndOpacity) )
 	{
 		ColorAndOpacity = InColorAndOpacity;
-		Invalidate(EInvalidateWidget::Layout);
+		Invalidate(EInvalidateWidget::Paint);
 	}
 }
 
@@ -81,7 +81,7 @@ void SImage::SetColorAndOpacity( FLinearColor InColorAndOpacity )
 	if ( ColorAndOpacity.IsBound() || ColorAndOpacity.Get() != InColorAndOpacity )
 	{
 		ColorAndOpacity = InColorAndOpacity;
-		Invalidate(EInvalidateWidget::Layout);
+		Invalidate(EInvalidateWidget::Paint);
 	}
 }
 
@@ -33,7 +33,7 @@ void SProgressBar::SetPercent(TAttribute< TOptional<float> > InPercent)
 	if ( !Percent.IdenticalTo(InPercent) )
 	{
 		Percent = InPercent;
-		Invalidate(EInvalidateWidget::LayoutAndVolatility);
+		Invalidate(EInvalidateWidget::PaintAndVolatility);
 	}
 }
 
@@ -61,7 +61,7 @@ void SProgressBar::SetBarFillType(EProgressBarFillType::Type InBarFillType)
 void SProgressBar::SetFillColorAndOpacity(TAttribute< FSlateColor > InFillColorAndOpacity)
 {
 	FillColorAndOpacity = InFillColorAndOpacity;
-	Invalidate(EInvalidateWidget::Layout);
+	Invalidate(EInvalidateWidget::Paint);
 }
 
 void SProgressBar::SetBorderPadding(TAttribute< FVector2D > InBorderPadding)
@@ -80,6 +80,7 @@ void SInvalidationPanel::Construct( const FArguments& InArgs )
 	];
 
 	bNeedsCaching = true;
+	bNeedsLayout = true;
 	bIsInvalidating = false;
 	bCanCache = true;
 	RootCacheNode = nullptr;
@@ -116,6 +117,11 @@ bool SInvalidationPanel::IsCachingNeeded() const
 {
 	return bNeedsCaching || AlwaysInvalidate.GetValueOnGameThread() == 1;
 }
+
+bool SInvalidationPanel::IsLayoutNeeded() const
+{
+	return bNeedsLayout || AlwaysInvalidate.GetValueOnGameThread() == 1;
+}
 #endif
 
 bool SInvalidationPanel::IsCachingNeeded(const FGeometry& AllottedGeometry, const FSlateRect& MyClippingRect) const
@@ -182,7 +188,13 @@ void SInvalidationPanel::Tick( const FGeometry& AllottedGeometry, const double I
 		// we'll have already done one pre-pass before getting here.
 		if ( bWasCachingNeeded )
 		{
-			SlatePrepass(AllottedGeometry.Scale);
+			// Paint only invalidations leave the desired sizes of the cached widgets as they were
+			if ( IsLayoutNeeded() )
+			{
+				SlatePrepass(AllottedGeometry.Scale);
+			}
+			bNeedsLayout = false;
+
 			CachePrepass(SharedThis(this));
 		}
 	}
@@ -206,6 +218,13 @@ void SInvalidationPanel::AddReferencedObjects(FReferenceCollector& Collector)
 }
 
 void SInvalidationPanel::InvalidateWidget(SWidget* InvalidateWidget)
+{
+	bNeedsLayout = true;
+
+	InvalidateWidgetPaint(InvalidateWidget);
+}
+
+void SInvalidationPanel::InvalidateWidgetPaint(SWidget* InvalidateWidget)
 {
 	bNeedsCaching = true;
 
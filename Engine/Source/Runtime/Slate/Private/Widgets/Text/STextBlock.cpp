@@ -214,7 +214,7 @@ void STextBlock::SetColorAndOpacity(const TAttribute<FSlateColor>& InColorAndOpa
 	if ( !ColorAndOpacity.IsSet() || !ColorAndOpacity.IdenticalTo(InColorAndOpacity) )
 	{
 		ColorAndOpacity = InColorAndOpacity;
-		Invalidate(EInvalidateWidget::LayoutAndVolatility);
+		Invalidate(EInvalidateWidget::PaintAndVolatility);
 	}
 }
 
@@ -272,7 +272,7 @@ void STextBlock::SetShadowOffset(const TAttribute<FVector2D>& InShadowOffset)
 void STextBlock::SetShadowColorAndOpacity(const TAttribute<FLinearColor>& InShadowColorAndOpacity)
 {
 	ShadowColorAndOpacity = InShadowColorAndOpacity;
-	Invalidate(EInvalidateWidget::LayoutAndVolatility);
+	Invalidate(EInvalidateWidget::PaintAndVolatility);
 }
 
 void STextBlock::SetMinDesiredWidth(const TAttribute<float>& InMinDesiredWidth)
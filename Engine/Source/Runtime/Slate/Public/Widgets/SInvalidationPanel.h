@@ -40,12 +40,13 @@ public:
 
 	void SetCanCache(bool InCanCache);
 
-	FORCEINLINE void InvalidateCache() { bNeedsCaching = true; }
+	FORCEINLINE void InvalidateCache() { bNeedsCaching = true; bNeedsLayout = true; }
 
 	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
 
 	// ILayoutCache overrides
 	virtual void InvalidateWidget(SWidget* InvalidateWidget) override;
+	virtual void InvalidateWidgetPaint(SWidget* InvalidateWidget) override;
 	virtual FCachedWidgetNode* CreateCacheNode() const override;
 	// End ILayoutCache
 
@@ -80,8 +81,10 @@ private:
 
 #if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
 	bool IsCachingNeeded() const;
+	bool IsLayoutNeeded() const;
 #else
 	FORCEINLINE bool IsCachingNeeded() const { return bNeedsCaching; }
+	FORCEINLINE bool IsLayoutNeeded() const { return bNeedsLayout; }
 #endif
 
 	bool IsCachingNeeded(const FGeometry& AllottedGeometry, const FSlateRect& MyClippingRect) const;
@@ -111,6 +114,8 @@ private:
 
 	mutable int32 CachedMaxChildLayer;
 	mutable bool bNeedsCaching;
+	/** False when the cache was only invalidated for painting, in which case desired sizes are still valid */
+	mutable bool bNeedsLayout;
 	mutable bool bIsInvalidating;
 	bool bCanCache;
 
@@ -22,8 +22,19 @@ namespace FontCacheConstants
 {
 	/** Number of characters that can be indexed directly in the cache */
 	const int32 DirectAccessSize = 256;
+
+	/** Number of characters of a prewarm request shaped at once */
+	const int32 PrewarmBatchSize = 32;
 }
 
+static float FontPrewarmBudgetMS = 2.0f;
+static FAutoConsoleVariableRef CVarFontPrewarmBudgetMS(
+	TEXT("Slate.FontPrewarmBudgetMS"),
+	FontPrewarmBudgetMS,
+	TEXT("Time in milliseconds the font cache may spend per frame rasterizing characters queued with PrewarmCharacters."),
+	ECVF_Default
+	);
+
 
 static TAutoConsoleVariable<int32> CVarDefaultTextShapingMethod(
 	TEXT("Slate.DefaultTextShapingMethod"),
@@ -1044,9 +1055,77 @@ bool FSlateFontCache::ConditionalFlushCache()
 		FlushFontObjects();
 	}
 
+	if (IsInGameThread())
+	{
+		// The glyphs added here are uploaded with the next UpdateCache
+		ProcessPrewarmRequests();
+	}
+
 	return bFlushed;
 }
 
+void FSlateFontCache::PrewarmCharacters( const FSlateFontInfo& InFontInfo, const float InFontScale, const FString& InCharacters )
+{
+	check(IsInGameThread());
+
+	if (InCharacters.Len() > 0 && InFontInfo.HasValidFont())
+	{
+		FPrewarmRequest& Request = PrewarmRequests[PrewarmRequests.AddDefaulted()];
+		Request.FontInfo = InFontInfo;
+		Request.FontScale = InFontScale;
+		Request.Characters = InCharacters;
+		Request.NextCharacterIndex = 0;
+	}
+}
+
+bool FSlateFontCache::IsPrewarming() const
+{
+	return PrewarmRequests.Num() > 0;
+}
+
+void FSlateFontCache::ProcessPrewarmRequests()
+{
+	const double EndTime = FPlatformTime::Seconds() + FontPrewarmBudgetMS / 1000.0;
+
+	// Stop once the atlases are full, the pending flush would throw the glyphs away again
+	while (PrewarmRequests.Num() > 0 && !bFlushRequested && FPlatformTime::Seconds() < EndTime)
+	{
+		FPrewarmRequest& Request = PrewarmRequests[0];
+
+		const int32 StartIndex = Request.NextCharacterIndex;
+		int32 EndIndex = FMath::Min(StartIndex + FontCacheConstants::PrewarmBatchSize, Request.Characters.Len());
+		if (EndIndex < Request.Characters.Len())
+		{
+			// Don't split a UTF-16 surrogate pair between batches
+			const TCHAR LastCharacter = Request.Characters[EndIndex - 1];
+			if (LastCharacter >= 0xD800 && LastCharacter <= 0xDBFF)
+			{
+				++EndIndex;
+			}
+		}
+		Request.NextCharacterIndex = EndIndex;
+
+		// Shape the characters the same way text is drawn, so the cached glyphs are the ones drawing will look up
+		FShapedGlyphSequenceRef ShapedGlyphSequence = ShapeUnidirectionalText(*Request.Characters, StartIndex, EndIndex - StartIndex, Request.FontInfo, Request.FontScale, TextBiDi::ETextDirection::LeftToRight, GetDefaultTextShapingMethod());
+		for (const FShapedGlyphEntry& ShapedGlyph : ShapedGlyphSequence->GetGlyphsToRender())
+		{
+			if (ShapedGlyph.bIsVisible)
+			{
+				GetShapedGlyphFontAtlasData(ShapedGlyph, FFontOutlineSettings::NoOutline);
+				if (Request.FontInfo.OutlineSettings.OutlineSize > 0)
+				{
+					GetShapedGlyphFontAtlasData(ShapedGlyph, Request.FontInfo.OutlineSettings);
+				}
+			}
+		}
+
+		if (Request.NextCharacterIndex >= Request.Characters.Len())
+		{
+			PrewarmRequests.RemoveAt(0, 1, false);
+		}
+	}
+}
+
 void FSlateFontCache::UpdateCache()
 {
 	for (const TSharedRef<FSlateFontAtlas>& FontAtlas : FontAtlases)
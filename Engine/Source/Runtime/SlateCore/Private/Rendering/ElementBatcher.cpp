@@ -202,6 +202,25 @@ void FSlateElementBatcher::AddElements(const TArray<FSlateDrawElement>& DrawElem
 	}
 }
 
+/**
+ * Makes room for NumQuads more glyph quads in a batch, so text doesn't grow the batch arrays one glyph at a time.
+ * Capacity still grows geometrically, since many text elements often share the same batch.
+ */
+static void ReserveGlyphQuads(FSlateVertexArray& BatchVertices, FSlateIndexArray& BatchIndices, int32 NumQuads)
+{
+	const int32 RequiredVertices = BatchVertices.Num() + NumQuads * 4;
+	if (RequiredVertices > BatchVertices.Max())
+	{
+		BatchVertices.Reserve(FMath::Max(RequiredVertices, BatchVertices.Max() * 2));
+	}
+
+	const int32 RequiredIndices = BatchIndices.Num() + NumQuads * 6;
+	if (RequiredIndices > BatchIndices.Max())
+	{
+		BatchIndices.Reserve(FMath::Max(RequiredIndices, BatchIndices.Max() * 2));
+	}
+}
+
 FColor FSlateElementBatcher::PackVertexColor(const FLinearColor& InLinearColor)
 {
 	//NOTE: Using pow(x,2) instead of a full sRGB conversion has been tried, but it ended up
@@ -703,6 +722,8 @@ void FSlateElementBatcher::AddTextElement(const FSlateDrawElement& DrawElement)
 
 					VertexOffset = BatchVertices->Num();
 					IndexOffset = BatchIndices->Num();
+
+					ReserveGlyphQuads(*BatchVertices, *BatchIndices, (int32)(NumChars - CharIndex));
 				
 					InvTextureSizeX = 1.0f/FontAtlasTexture->GetWidth();
 					InvTextureSizeY = 1.0f/FontAtlasTexture->GetHeight();
@@ -919,6 +940,8 @@ void FSlateElementBatcher::AddShapedTextElement( const FSlateDrawElement& DrawEl
 						VertexOffset = BatchVertices->Num();
 						IndexOffset = BatchIndices->Num();
 
+						ReserveGlyphQuads(*BatchVertices, *BatchIndices, NumGlyphs - GlyphIndex);
+
 						InvTextureSizeX = 1.0f / FontAtlasTexture->GetWidth();
 						InvTextureSizeY = 1.0f / FontAtlasTexture->GetHeight();
 					}
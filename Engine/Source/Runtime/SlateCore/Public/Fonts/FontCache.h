@@ -822,6 +822,21 @@ public:
 	 */
 	void FlushData();
 
+	/**
+	 * Queues characters to be rasterized into the font atlases before they are first drawn, so new text doesn't hitch the frame it appears in.
+	 * The queue is worked through at the end of each Slate frame, spending at most Slate.FontPrewarmBudgetMS per frame.
+	 *
+	 * @param InFontInfo	The font the characters will be drawn with (including its outline settings)
+	 * @param InFontScale	The scale the characters will be drawn at
+	 * @param InCharacters	The characters to rasterize, eg, all characters used by the strings of the current culture
+	 */
+	void PrewarmCharacters( const FSlateFontInfo& InFontInfo, const float InFontScale, const FString& InCharacters );
+
+	/**
+	 * @return Whether there are characters left in the prewarm queue
+	 */
+	bool IsPrewarming() const;
+
 private:
 	// Non-copyable
 	FSlateFontCache(const FSlateFontCache&);
@@ -840,6 +855,11 @@ private:
 	/** Called after the active culture has changed */
 	void HandleCultureChanged();
 
+	/**
+	 * Rasterizes queued prewarm characters until the queue is empty or the frame budget is spent
+	 */
+	void ProcessPrewarmRequests();
+
 private:
 
 	/** FreeType library instance (owned by this font cache) */
@@ -898,4 +918,17 @@ private:
 
 	/** Array of UFont objects that the font cache has been requested to flush. Since GC can happen while the loading screen is running, the request may be deferred until the next call to ConditionalFlushCache */
 	TArray<const UObject*> FontObjectsToFlush;
+
+	/** Characters queued by PrewarmCharacters */
+	struct FPrewarmRequest
+	{
+		FSlateFontInfo FontInfo;
+		float FontScale;
+		FString Characters;
+		/** Index of the first character that still has to be rasterized */
+		int32 NextCharacterIndex;
+	};
+
+	/** Pending prewarm requests, oldest first */
+	TArray<FPrewarmRequest> PrewarmRequests;
 };
@@ -113,7 +113,17 @@ enum class EInvalidateWidget
 	 * Additionally if the property that was changed affects Volatility in anyway, it's important
 	 * that you invalidate volatility so that it can be recalculated and cached.
 	 */
-	LayoutAndVolatility
+	LayoutAndVolatility,
+	/**
+	 * Use Paint invalidation if you're changing a property that only affects how the widget is drawn, like a color,
+	 * and not its desired size.  Layout caching widgets can then redraw without another layout pass.
+	 */
+	Paint,
+	/**
+	 * Use Paint invalidation if you're changing a property that only affects how the widget is drawn, like a color,
+	 * and not its desired size.  Additionally recalculates and caches volatility, see LayoutAndVolatility.
+	 */
+	PaintAndVolatility
 };
 
 
@@ -126,6 +136,8 @@ class ILayoutCache
 public:
 	virtual ~ILayoutCache() { }
 	virtual void InvalidateWidget(class SWidget* InvalidateWidget) = 0;
+	/** Invalidates the widget's painting only, its desired size hasn't changed.  Defaults to a full invalidation. */
+	virtual void InvalidateWidgetPaint(class SWidget* InvalidateWidget) { this->InvalidateWidget(InvalidateWidget); }
 	virtual FCachedWidgetNode* CreateCacheNode() const = 0;
 };
 
@@ -874,11 +886,20 @@ public:
 	FORCEINLINE void Invalidate(EInvalidateWidget Invalidate)
 	{
 		const bool bWasVolatile = IsVolatileIndirectly() || IsVolatile();
-		const bool bVolatilityChanged = Invalidate == EInvalidateWidget::LayoutAndVolatility ? Advanced_InvalidateVolatility() : false;
+		const bool bVolatilityChanged = ( Invalidate == EInvalidateWidget::LayoutAndVolatility || Invalidate == EInvalidateWidget::PaintAndVolatility ) ? Advanced_InvalidateVolatility() : false;
 
 		if ( bWasVolatile == false || bVolatilityChanged )
 		{
-			Advanced_ForceInvalidateLayout();
+			// Changing volatility changes what the layout cache holds, so it always needs the full invalidation
+			const bool bPaintOnly = ( Invalidate == EInvalidateWidget::Paint || Invalidate == EInvalidateWidget::PaintAndVolatility ) && !bVolatilityChanged;
+			if ( bPaintOnly )
+			{
+				Advanced_ForceInvalidatePaint();
+			}
+			else
+			{
+				Advanced_ForceInvalidateLayout();
+			}
 		}
 	}
 
@@ -915,6 +936,18 @@ protected:
 		}
 	}
 
+	/**
+	 * Forces invalidation of the widget's painting only, doesn't check volatility.
+	 */
+	FORCEINLINE void Advanced_ForceInvalidatePaint()
+	{
+		TSharedPtr<ILayoutCache> SharedLayoutCache = LayoutCache.Pin();
+		if (SharedLayoutCache.IsValid() )
+		{
+			SharedLayoutCache->InvalidateWidgetPaint(this);
+		}
+	}
+
 public:
 
 	/** @return the render transform of the widget. */
@@ -6,6 +6,7 @@
 
 #include "BSDSockets/IPAddressBSD.h"
 #include "BSDSockets/SocketSubsystemBSD.h"
+#include "SocketBatch.h"
 //#include "Net/NetworkProfiler.h"
 
 #if PLATFORM_HTML5 
@@ -208,6 +209,106 @@ bool FSocketBSD::Recv(uint8* Data, int32 BufferSize, int32& BytesRead, ESocketRe
 }
 
 
+#if PLATFORM_HAS_BSD_SOCKET_FEATURE_MMSG
+bool FSocketBSD::SendToMulti(const FSocketSendBatch& Batch, int32& NumSent)
+{
+	const int32 NumPackets = Batch.Num();
+
+	MultiHeaders.SetNumZeroed(NumPackets, false);
+	MultiBuffers.SetNumUninitialized(NumPackets, false);
+
+	for (int32 Index = 0; Index < NumPackets; Index++)
+	{
+		MultiBuffers[Index].iov_base = (void*)Batch.GetData(Index);
+		MultiBuffers[Index].iov_len = Batch.GetSize(Index);
+
+		msghdr& Header = MultiHeaders[Index].msg_hdr;
+		Header.msg_name = (void*)(const sockaddr*)(const FInternetAddrBSD&)Batch.GetDestination(Index);
+		Header.msg_namelen = sizeof(sockaddr_in);
+		Header.msg_iov = &MultiBuffers[Index];
+		Header.msg_iovlen = 1;
+	}
+
+	NumSent = 0;
+
+	int32 Offset = 0;
+	while (Offset < NumPackets)
+	{
+		const int32 Result = sendmmsg(Socket, MultiHeaders.GetData() + Offset, NumPackets - Offset, 0);
+		if (Result > 0)
+		{
+			NumSent += Result;
+			Offset += Result;
+		}
+		else
+		{
+			// sendmmsg stops at the first datagram that fails, drop it like a failed sendto and carry on with the rest
+			Offset++;
+		}
+	}
+
+	if (NumSent > 0)
+	{
+		LastActivityTime = FDateTime::UtcNow();
+	}
+
+	return NumSent == NumPackets;
+}
+
+
+bool FSocketBSD::RecvFromMulti(FSocketRecvBatch& Batch, ESocketReceiveFlags::Type Flags)
+{
+	Batch.Reset();
+
+	const int32 MaxPackets = Batch.Max();
+
+	MultiHeaders.SetNumZeroed(MaxPackets, false);
+	MultiBuffers.SetNumUninitialized(MaxPackets, false);
+
+	for (int32 Index = 0; Index < MaxPackets; Index++)
+	{
+		MultiBuffers[Index].iov_base = Batch.GetData(Index);
+		MultiBuffers[Index].iov_len = Batch.GetMaxPacketSize();
+
+		msghdr& Header = MultiHeaders[Index].msg_hdr;
+		Header.msg_name = (sockaddr*)(FInternetAddrBSD&)Batch.GetSource(Index);
+		Header.msg_namelen = sizeof(sockaddr_in);
+		Header.msg_iov = &MultiBuffers[Index];
+		Header.msg_iovlen = 1;
+	}
+
+	// Only wait for the first datagram, so a blocking socket returns as soon as the pending ones are read
+	const int TranslatedFlags = TranslateFlags(Flags) | MSG_WAITFORONE;
+
+	const int32 Result = recvmmsg(Socket, MultiHeaders.GetData(), MaxPackets, TranslatedFlags, nullptr);
+
+	if (Result < 0)
+	{
+		// EWOULDBLOCK is not an error condition
+		return SocketSubsystem->TranslateErrorCode(Result) == SE_EWOULDBLOCK;
+	}
+
+	for (int32 Index = 0; Index < Result; Index++)
+	{
+		// Stop at empty datagrams, like RecvFrom reports them as no data
+		if (MultiHeaders[Index].msg_len == 0)
+		{
+			break;
+		}
+
+		Batch.AddReceived(MultiHeaders[Index].msg_len);
+	}
+
+	if (Result > 0)
+	{
+		LastActivityTime = FDateTime::UtcNow();
+	}
+
+	return true;
+}
+#endif
+
+
 bool FSocketBSD::Wait(ESocketWaitConditions::Type Condition, FTimespan WaitTime)
 {
 	if ((Condition == ESocketWaitConditions::WaitForRead) || (Condition == ESocketWaitConditions::WaitForReadOrWrite))
@@ -110,6 +110,10 @@ public:
 	virtual bool SetSendBufferSize(int32 Size,int32& NewSize) override;
 	virtual bool SetReceiveBufferSize(int32 Size,int32& NewSize) override;
 	virtual int32 GetPortNo() override;
+#if PLATFORM_HAS_BSD_SOCKET_FEATURE_MMSG
+	virtual bool SendToMulti(const FSocketSendBatch& Batch, int32& NumSent) override;
+	virtual bool RecvFromMulti(FSocketRecvBatch& Batch, ESocketReceiveFlags::Type Flags = ESocketReceiveFlags::None) override;
+#endif
 
 protected:
 
@@ -130,6 +134,12 @@ protected:
 
 	/** Pointer to the subsystem that created it. */
 	ISocketSubsystem* SocketSubsystem;
+
+#if PLATFORM_HAS_BSD_SOCKET_FEATURE_MMSG
+	/** Message headers and buffer descriptors of batched sends and receives, kept around so batches don't allocate. */
+	TArray<mmsghdr> MultiHeaders;
+	TArray<iovec> MultiBuffers;
+#endif
 };
 
 
@@ -0,0 +1,65 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "SocketBatch.h"
+#include "SocketSubsystem.h"
+#include "IPAddress.h"
+
+//
+// FSocketRecvBatch implementation
+//
+
+FSocketRecvBatch::FSocketRecvBatch(ISocketSubsystem& SocketSubsystem, int32 InMaxPackets, int32 InMaxPacketSize)
+	: MaxPackets(FMath::Max(InMaxPackets, 1))
+	, MaxPacketSize(InMaxPacketSize)
+	, NumPackets(0)
+{
+	Buffer.AddUninitialized(MaxPackets * MaxPacketSize);
+	Sizes.AddZeroed(MaxPackets);
+	Sources.Reserve(MaxPackets);
+
+	for (int32 Index = 0; Index < MaxPackets; Index++)
+	{
+		Sources.Add(SocketSubsystem.CreateInternetAddr());
+	}
+}
+
+//
+// FSocketSendBatch implementation
+//
+
+FSocketSendBatch::FSocketSendBatch(int32 InMaxPackets, int32 InMaxPacketSize)
+	: MaxPackets(FMath::Max(InMaxPackets, 1))
+	, MaxPacketSize(InMaxPacketSize)
+	, NumPackets(0)
+{
+	Buffer.AddUninitialized(MaxPackets * MaxPacketSize);
+	Sizes.AddZeroed(MaxPackets);
+	Destinations.AddDefaulted(MaxPackets);
+}
+
+
+bool FSocketSendBatch::Add(const uint8* Data, int32 Count, const TSharedRef<FInternetAddr>& Destination)
+{
+	if (IsFull() || Count > MaxPacketSize)
+	{
+		return false;
+	}
+
+	FMemory::Memcpy(Buffer.GetData() + NumPackets * MaxPacketSize, Data, Count);
+	Sizes[NumPackets] = Count;
+	Destinations[NumPackets] = Destination;
+	NumPackets++;
+
+	return true;
+}
+
+
+void FSocketSendBatch::Reset()
+{
+	for (int32 Index = 0; Index < NumPackets; Index++)
+	{
+		Destinations[Index].Reset();
+	}
+
+	NumPackets = 0;
+}
@@ -2,6 +2,8 @@
 
 #include "Sockets.h"
 #include "SocketSubsystem.h"
+#include "SocketBatch.h"
+#include "IPAddress.h"
 //#include "Net/NetworkProfiler.h"
 
 //
@@ -42,3 +44,48 @@ bool FSocket::Recv(uint8* Data, int32 BufferSize, int32& BytesRead, ESocketRecei
 	}
 	return true;
 }
+
+
+bool FSocket::SendToMulti(const FSocketSendBatch& Batch, int32& NumSent)
+{
+	NumSent = 0;
+
+	for (int32 Index = 0; Index < Batch.Num(); Index++)
+	{
+		int32 BytesSent = 0;
+		if (SendTo(Batch.GetData(Index), Batch.GetSize(Index), BytesSent, Batch.GetDestination(Index)))
+		{
+			NumSent++;
+		}
+	}
+
+	return NumSent == Batch.Num();
+}
+
+
+bool FSocket::RecvFromMulti(FSocketRecvBatch& Batch, ESocketReceiveFlags::Type Flags)
+{
+	Batch.Reset();
+
+	while (Batch.Num() < Batch.Max())
+	{
+		const int32 Index = Batch.Num();
+		int32 BytesRead = 0;
+
+		if (!RecvFrom(Batch.GetData(Index), Batch.GetMaxPacketSize(), BytesRead, Batch.GetSource(Index), Flags))
+		{
+			// The source of the slot that failed is left for the caller, see GetSource(Num())
+			return false;
+		}
+
+		if (BytesRead == 0)
+		{
+			// No more data
+			break;
+		}
+
+		Batch.AddReceived(BytesRead);
+	}
+
+	return true;
+}
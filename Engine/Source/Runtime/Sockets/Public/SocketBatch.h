@@ -0,0 +1,169 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FInternetAddr;
+class ISocketSubsystem;
+
+/**
+ * Preallocated ring of datagram buffers filled by FSocket::RecvFromMulti.
+ *
+ * The buffers and source addresses are allocated once, every receive reuses them from the first slot on,
+ * so the packets of a batch are only valid until the next receive.
+ */
+class SOCKETS_API FSocketRecvBatch
+{
+public:
+
+	/**
+	 * Allocates the buffers of the batch.
+	 *
+	 * @param SocketSubsystem The subsystem of the socket the batch is received from, used to create the source addresses.
+	 * @param InMaxPackets The maximum number of datagrams received at once.
+	 * @param InMaxPacketSize The size of the buffer of each datagram.
+	 */
+	FSocketRecvBatch(ISocketSubsystem& SocketSubsystem, int32 InMaxPackets, int32 InMaxPacketSize);
+
+	/** @return The number of datagrams received by the last receive. */
+	int32 Num() const
+	{
+		return NumPackets;
+	}
+
+	/** @return The maximum number of datagrams received at once. */
+	int32 Max() const
+	{
+		return MaxPackets;
+	}
+
+	/** @return The size of the buffer of each datagram. */
+	int32 GetMaxPacketSize() const
+	{
+		return MaxPacketSize;
+	}
+
+	/** @return The buffer of a datagram slot. */
+	uint8* GetData(int32 Index)
+	{
+		check(Index >= 0 && Index < MaxPackets);
+		return Buffer.GetData() + Index * MaxPacketSize;
+	}
+
+	/** @return The number of bytes received into a datagram slot. */
+	int32 GetSize(int32 Index) const
+	{
+		return Sizes[Index];
+	}
+
+	/** @return The address a datagram slot was received from, or the address reported with an error for the slot after the last datagram. */
+	FInternetAddr& GetSource(int32 Index)
+	{
+		return *Sources[Index];
+	}
+
+	/** Drops the received datagrams, called by the socket before it fills the batch. */
+	void Reset()
+	{
+		NumPackets = 0;
+	}
+
+	/** Marks the next slot as received, called by the socket for each datagram it read. */
+	void AddReceived(int32 Size)
+	{
+		check(NumPackets < MaxPackets);
+		Sizes[NumPackets++] = Size;
+	}
+
+private:
+
+	int32 MaxPackets;
+	int32 MaxPacketSize;
+	int32 NumPackets;
+
+	/** MaxPackets buffers of MaxPacketSize bytes each. */
+	TArray<uint8> Buffer;
+	TArray<int32> Sizes;
+	TArray<TSharedRef<FInternetAddr>> Sources;
+};
+
+
+/**
+ * Preallocated queue of datagrams sent at once by FSocket::SendToMulti.
+ *
+ * The data of each datagram is copied into the batch, so it can be queued from a temporary buffer.
+ */
+class SOCKETS_API FSocketSendBatch
+{
+public:
+
+	/**
+	 * Allocates the buffers of the batch.
+	 *
+	 * @param InMaxPackets The maximum number of datagrams queued at once.
+	 * @param InMaxPacketSize The size of the buffer of each datagram.
+	 */
+	FSocketSendBatch(int32 InMaxPackets, int32 InMaxPacketSize);
+
+	/**
+	 * Copies a datagram into the batch.
+	 *
+	 * @param Data The datagram to send.
+	 * @param Count The size of the datagram.
+	 * @param Destination The network byte ordered address to send to, referenced until the batch is reset.
+	 * @return false if the batch is full or the datagram doesn't fit a buffer, in which case nothing was queued.
+	 */
+	bool Add(const uint8* Data, int32 Count, const TSharedRef<FInternetAddr>& Destination);
+
+	/** @return The number of queued datagrams. */
+	int32 Num() const
+	{
+		return NumPackets;
+	}
+
+	/** @return The maximum number of datagrams queued at once. */
+	int32 Max() const
+	{
+		return MaxPackets;
+	}
+
+	/** @return true if no more datagrams can be queued. */
+	bool IsFull() const
+	{
+		return NumPackets == MaxPackets;
+	}
+
+	/** @return The data of a queued datagram. */
+	const uint8* GetData(int32 Index) const
+	{
+		check(Index >= 0 && Index < NumPackets);
+		return Buffer.GetData() + Index * MaxPacketSize;
+	}
+
+	/** @return The size of a queued datagram. */
+	int32 GetSize(int32 Index) const
+	{
+		return Sizes[Index];
+	}
+
+	/** @return The destination of a queued datagram. */
+	const FInternetAddr& GetDestination(int32 Index) const
+	{
+		return *Destinations[Index];
+	}
+
+	/** Drops all queued datagrams. */
+	void Reset();
+
+private:
+
+	int32 MaxPackets;
+	int32 MaxPacketSize;
+	int32 NumPackets;
+
+	/** MaxPackets buffers of MaxPacketSize bytes each. */
+	TArray<uint8> Buffer;
+	TArray<int32> Sizes;
+	TArray<TSharedPtr<FInternetAddr>> Destinations;
+};
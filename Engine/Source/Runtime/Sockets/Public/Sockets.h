@@ -6,6 +6,8 @@
 #include "SocketTypes.h"
 
 class FInternetAddr;
+class FSocketRecvBatch;
+class FSocketSendBatch;
 
 /**
  * This is our abstract base class that hides the platform specific socket implementation
@@ -147,6 +149,27 @@ public:
 	 */
 	virtual bool Recv(uint8* Data, int32 BufferSize, int32& BytesRead, ESocketReceiveFlags::Type Flags = ESocketReceiveFlags::None);
 
+	/**
+	 * Sends all datagrams of a batch, with as few system calls as the platform allows.
+	 * The default implementation calls SendTo for each datagram.
+	 *
+	 * @param Batch The datagrams to send.
+	 * @param NumSent Will indicate how many datagrams were sent, datagrams that failed to send are dropped.
+	 * @return true if all datagrams were sent.
+	 */
+	virtual bool SendToMulti(const FSocketSendBatch& Batch, int32& NumSent);
+
+	/**
+	 * Reads as many pending datagrams as fit the batch, with as few system calls as the platform allows.
+	 * The default implementation calls RecvFrom until no data is pending or the batch is full.
+	 *
+	 * @param Batch The batch to read into, its previous contents are dropped.
+	 * @param Flags The receive flags.
+	 * @return false if reading stopped on an error. The datagrams read before it are still valid, the error code should be
+	 *		read before processing them and the source after the last datagram, Batch.GetSource(Batch.Num()), holds the address reported with the error.
+	 */
+	virtual bool RecvFromMulti(FSocketRecvBatch& Batch, ESocketReceiveFlags::Type Flags = ESocketReceiveFlags::None);
+
 	/**
 	 * Blocks until the specified condition is met.
 	 *
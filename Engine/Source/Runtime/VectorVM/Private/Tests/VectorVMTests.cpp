@@ -6,6 +6,7 @@
 #include "Runtime/VectorVM/Private/VectorVMPrivate.h"
 
 #define OP_REGISTER (0)
+#define OP0_CONST (1 << 0)
 #define OP1_CONST (1 << 1)
 #define OP2_CONST (1 << 2)
 
@@ -112,4 +113,215 @@ bool FVectorVMTest::RunTest(const FString& Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVectorVMResolvedByteCodeTest, "System.Core.Math.Vector VM Resolved Byte Code", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+namespace VectorVMTests
+{
+	static void AppendU16(TArray<uint8>& Code, uint16 Value)
+	{
+		Code.Add((uint8)(Value >> 8));
+		Code.Add((uint8)(Value & 0xff));
+	}
+
+	/** Builds a script writing In * In * 2 + In for every instance of input 0 to output 0. ConstantTable needs 16 bytes. */
+	static void BuildTestScript(TArray<uint8>& Code, uint8* ConstantTable)
+	{
+		Code.Add((uint8)EVectorVMOp::inputdata_32bit);		// r0 = input 0
+		AppendU16(Code, 0);
+		AppendU16(Code, VectorVM::FirstInputRegister);
+		AppendU16(Code, 0);
+		Code.Add((uint8)EVectorVMOp::mul);					// r1 = r0 * r0
+		Code.Add(SRCOP_RRRR);
+		AppendU16(Code, 0);
+		AppendU16(Code, 0);
+		AppendU16(Code, 1);
+		Code.Add((uint8)EVectorVMOp::mad);					// r2 = r1 * c0 + r0
+		Code.Add(SRCOP_RRCR);
+		AppendU16(Code, 1);
+		AppendU16(Code, 0);
+		AppendU16(Code, 0);
+		AppendU16(Code, 2);
+		Code.Add((uint8)EVectorVMOp::acquireindex);			// r3 = index of the instance in data set 0
+		Code.Add(OP0_CONST);
+		AppendU16(Code, 0);
+		AppendU16(Code, sizeof(float));
+		AppendU16(Code, 3);
+		Code.Add((uint8)EVectorVMOp::outputdata_32bit);		// output 0 [r3] = r2
+		Code.Add(SRCOP_RRRR);
+		AppendU16(Code, 0);
+		AppendU16(Code, 3);
+		AppendU16(Code, 2);
+		AppendU16(Code, VectorVM::FirstOutputRegister);
+		Code.Add((uint8)EVectorVMOp::done);
+
+		FMemory::Memzero(ConstantTable, 16);
+		*(float*)ConstantTable = 2.0f;
+		*(int32*)(ConstantTable + sizeof(float)) = 1;
+	}
+
+	/** Runs the test script over NumInstances instances, either interpreted or through ResolvedByteCode, optionally on several threads. Returns the number of instances written. */
+	static int32 ExecTestScript(const TArray<uint8>& Code, VectorVM::FResolvedByteCode* ResolvedByteCode, bool bParallel, float* Input, float* Output, const uint8* ConstantTable, int32 NumInstances)
+	{
+		uint8* InputRegisters[1] = { (uint8*)Input };
+		uint8 InputRegisterSizes[1] = { sizeof(float) };
+		uint8* OutputRegisters[1] = { (uint8*)Output };
+		uint8 OutputRegisterSizes[1] = { sizeof(float) };
+
+		TArray<FDataSetMeta> DataSetMetaTable;
+		DataSetMetaTable.Add(FDataSetMeta(NumInstances * sizeof(float)));
+#if STATS
+		TArray<TStatId> StatScopes;
+#endif
+
+		if (ResolvedByteCode && bParallel)
+		{
+			VectorVM::ExecParallel(Code, *ResolvedByteCode, InputRegisters, InputRegisterSizes, 1, OutputRegisters, OutputRegisterSizes, 1, ConstantTable, DataSetMetaTable, nullptr, NumInstances
+#if STATS
+				, StatScopes
+#endif
+				);
+		}
+		else if (ResolvedByteCode)
+		{
+			VectorVM::Exec(Code, *ResolvedByteCode, InputRegisters, InputRegisterSizes, 1, OutputRegisters, OutputRegisterSizes, 1, ConstantTable, DataSetMetaTable, nullptr, NumInstances
+#if STATS
+				, StatScopes
+#endif
+				);
+		}
+		else
+		{
+			VectorVM::Exec(Code.GetData(), InputRegisters, InputRegisterSizes, 1, OutputRegisters, OutputRegisterSizes, 1, ConstantTable, DataSetMetaTable, nullptr, NumInstances
+#if STATS
+				, StatScopes
+#endif
+				);
+		}
+
+		return DataSetMetaTable[0].DataSetAccessIndex;
+	}
+}
+
+/*------------------------------------------------------------------------------
+Checks the resolved byte code path against the interpreter and compares their speed.
+------------------------------------------------------------------------------*/
+bool FVectorVMResolvedByteCodeTest::RunTest(const FString& Parameters)
+{
+	using namespace VectorVMTests;
+
+	VectorVM::Init();
+
+	TArray<uint8> Code;
+	MS_ALIGN(16) uint8 ConstantTable[16] GCC_ALIGN(16);
+	BuildTestScript(Code, ConstantTable);
+
+	// Not a multiple of the chunk size, the last vector reads past the instances
+	const int32 NumInstances = 16 * 1024 + 3;
+	TArray<float> Input;
+	Input.SetNumZeroed(NumInstances + VECTOR_WIDTH_FLOATS);
+	for (int32 i = 0; i < NumInstances; ++i)
+	{
+		Input[i] = (float)(i % 100) * 0.01f;
+	}
+
+	TArray<float> InterpretedOutput;
+	InterpretedOutput.SetNumZeroed(NumInstances);
+	TArray<float> ResolvedOutput;
+	ResolvedOutput.SetNumZeroed(NumInstances);
+
+	VectorVM::FResolvedByteCode ResolvedByteCode;
+	TestEqual(TEXT("Interpreted instances written"), ExecTestScript(Code, nullptr, false, Input.GetData(), InterpretedOutput.GetData(), ConstantTable, NumInstances), NumInstances);
+	TestEqual(TEXT("Resolving instances written"), ExecTestScript(Code, &ResolvedByteCode, false, Input.GetData(), ResolvedOutput.GetData(), ConstantTable, NumInstances), NumInstances);
+	TestTrue(TEXT("Byte code resolved"), ResolvedByteCode.bResolved);
+	TestEqual(TEXT("Resolved kernels"), ResolvedByteCode.Kernels.Num(), 5);
+
+	for (int32 i = 0; i < NumInstances; ++i)
+	{
+		const float Expected = Input[i] * Input[i] * 2.0f + Input[i];
+		if (!FMath::IsNearlyEqual(InterpretedOutput[i], Expected, KINDA_SMALL_NUMBER))
+		{
+			AddError(FString::Printf(TEXT("Interpreted instance %d is wrong. Has %f expected %f"), i, InterpretedOutput[i], Expected));
+			return false;
+		}
+		if (ResolvedOutput[i] != InterpretedOutput[i])
+		{
+			AddError(FString::Printf(TEXT("Resolving instance %d differs from interpreter. Has %f expected %f"), i, ResolvedOutput[i], InterpretedOutput[i]));
+			return false;
+		}
+	}
+
+	// Executions after the first one only call resolved kernels
+	FMemory::Memzero(ResolvedOutput.GetData(), NumInstances * sizeof(float));
+	ExecTestScript(Code, &ResolvedByteCode, false, Input.GetData(), ResolvedOutput.GetData(), ConstantTable, NumInstances);
+	TestTrue(TEXT("Resolved output matches interpreter"), FMemory::Memcmp(ResolvedOutput.GetData(), InterpretedOutput.GetData(), NumInstances * sizeof(float)) == 0);
+
+	// Changed byte code has to be resolved again
+	TArray<uint8> ChangedCode = Code;
+	ChangedCode.Insert((uint8)EVectorVMOp::NumOpcodes, ChangedCode.Num() - 1);
+	ResolvedByteCode.Update(ChangedCode);
+	TestFalse(TEXT("Changed byte code discards kernels"), ResolvedByteCode.bResolved || ResolvedByteCode.Kernels.Num() > 0);
+	ResolvedByteCode.Update(Code);
+
+	const int32 NumRuns = 32;
+	double InterpretedTime = FPlatformTime::Seconds();
+	for (int32 Run = 0; Run < NumRuns; ++Run)
+	{
+		ExecTestScript(Code, nullptr, false, Input.GetData(), InterpretedOutput.GetData(), ConstantTable, NumInstances);
+	}
+	InterpretedTime = FPlatformTime::Seconds() - InterpretedTime;
+
+	double ResolvedTime = FPlatformTime::Seconds();
+	for (int32 Run = 0; Run < NumRuns; ++Run)
+	{
+		ExecTestScript(Code, &ResolvedByteCode, false, Input.GetData(), ResolvedOutput.GetData(), ConstantTable, NumInstances);
+	}
+	ResolvedTime = FPlatformTime::Seconds() - ResolvedTime;
+
+	AddInfo(FString::Printf(TEXT("%d runs over %d instances: interpreted %.3f ms, resolved %.3f ms"), NumRuns, NumInstances, InterpretedTime * 1000.0, ResolvedTime * 1000.0));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVectorVMParallelTest, "System.Core.Math.Vector VM Parallel", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+/*------------------------------------------------------------------------------
+Checks that executing chunks on several threads writes the same instances as executing them in order.
+------------------------------------------------------------------------------*/
+bool FVectorVMParallelTest::RunTest(const FString& Parameters)
+{
+	using namespace VectorVMTests;
+
+	VectorVM::Init();
+
+	TArray<uint8> Code;
+	MS_ALIGN(16) uint8 ConstantTable[16] GCC_ALIGN(16);
+	BuildTestScript(Code, ConstantTable);
+
+	// Enough chunks for several batches
+	const int32 NumInstances = 64 * 1024 + 5;
+	TArray<float> Input;
+	Input.SetNumZeroed(NumInstances + VECTOR_WIDTH_FLOATS);
+	for (int32 i = 0; i < NumInstances; ++i)
+	{
+		Input[i] = (float)(i % 1000) * 0.001f;
+	}
+
+	TArray<float> SerialOutput;
+	SerialOutput.SetNumZeroed(NumInstances);
+	TArray<float> ParallelOutput;
+	ParallelOutput.SetNumZeroed(NumInstances);
+
+	VectorVM::FResolvedByteCode SerialByteCode;
+	VectorVM::FResolvedByteCode ParallelByteCode;
+	TestEqual(TEXT("Serial instances written"), ExecTestScript(Code, &SerialByteCode, false, Input.GetData(), SerialOutput.GetData(), ConstantTable, NumInstances), NumInstances);
+	TestEqual(TEXT("Parallel instances written"), ExecTestScript(Code, &ParallelByteCode, true, Input.GetData(), ParallelOutput.GetData(), ConstantTable, NumInstances), NumInstances);
+
+	// Chunks reserve their output indices in the order they run in, compare the written values regardless of order
+	SerialOutput.Sort();
+	ParallelOutput.Sort();
+	TestTrue(TEXT("Parallel output matches serial output"), FMemory::Memcmp(SerialOutput.GetData(), ParallelOutput.GetData(), NumInstances * sizeof(float)) == 0);
+
+	return true;
+}
+
 #endif //WITH_DEV_AUTOMATION_TESTS
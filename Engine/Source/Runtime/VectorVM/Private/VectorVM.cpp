@@ -4,12 +4,32 @@
 #include "Modules/ModuleManager.h"
 #include "UObject/Class.h"
 #include "UObject/Package.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Async/ParallelFor.h"
 #include "VectorVMPrivate.h"
 
 IMPLEMENT_MODULE(FDefaultModuleImpl, VectorVM);
 
 DEFINE_LOG_CATEGORY_STATIC(LogVectorVM, All, All);
 
+static TAutoConsoleVariable<int32> CVarVMResolveByteCode(
+	TEXT("vm.ResolveByteCode"),
+	1,
+	TEXT("If > 0, scripts executed with resolved byte code call the kernel of each op directly after their first chunk instead of going through the interpreter's opcode dispatch."));
+
+static TAutoConsoleVariable<int32> CVarVMParallel(
+	TEXT("vm.Parallel"),
+	1,
+	TEXT("If > 0, VectorVM::ExecParallel splits the instances across task graph workers."));
+
+static TAutoConsoleVariable<int32> CVarVMParallelBatchSize(
+	TEXT("vm.ParallelBatchSize"),
+	4096,
+	TEXT("Number of instances each task of VectorVM::ExecParallel executes. Executions with fewer instances stay on the calling thread."));
+
+DECLARE_CYCLE_STAT(TEXT("VVM Exec Parallel"), STAT_VVMExecParallel, STATGROUP_Engine);
+
 //#define VM_FORCEINLINE
 #define VM_FORCEINLINE FORCEINLINE
 
@@ -128,6 +148,17 @@ struct TUnaryKernel
 		default: check(0); break; 
 		};
 	}
+
+	/** Returns the handler Exec dispatches to for these operand types, or nullptr if they aren't supported. */
+	static FVectorVMKernelFunction GetKernel(uint32 SrcOpTypes)
+	{
+		switch (SrcOpTypes)
+		{
+		case SRCOP_RRR: return &TUnaryKernelHandler<Kernel, DstHandler, RegisterHandler, NumInstancesPerOp>::Exec;
+		case SRCOP_RRC:	return &TUnaryKernelHandler<Kernel, DstHandler, ConstHandler, NumInstancesPerOp>::Exec;
+		default: return nullptr;
+		};
+	}
 };
 template<typename Kernel>
 struct TUnaryScalarKernel : public TUnaryKernel<Kernel, FRegisterHandler<float>, FConstantHandler<float>, FRegisterHandler<float>, 1> {};
@@ -152,6 +183,19 @@ struct TBinaryKernel
 		default: check(0); break;
 		};
 	}
+
+	/** Returns the handler Exec dispatches to for these operand types, or nullptr if they aren't supported. */
+	static FVectorVMKernelFunction GetKernel(uint32 SrcOpTypes)
+	{
+		switch (SrcOpTypes)
+		{
+		case SRCOP_RRR: return &TBinaryKernelHandler<Kernel, DstHandler, RegisterHandler, RegisterHandler, NumInstancesPerOp>::Exec;
+		case SRCOP_RRC:	return &TBinaryKernelHandler<Kernel, DstHandler, ConstHandler, RegisterHandler, NumInstancesPerOp>::Exec;
+		case SRCOP_RCR: return &TBinaryKernelHandler<Kernel, DstHandler, RegisterHandler, ConstHandler, NumInstancesPerOp>::Exec;
+		case SRCOP_RCC:	return &TBinaryKernelHandler<Kernel, DstHandler, ConstHandler, ConstHandler, NumInstancesPerOp>::Exec;
+		default: return nullptr;
+		};
+	}
 };
 template<typename Kernel>
 struct TBinaryScalarKernel : public TBinaryKernel<Kernel, FRegisterHandler<float>, FConstantHandler<float>, FRegisterHandler<float>, 1> {};
@@ -180,6 +224,23 @@ struct TTrinaryKernel
 		default: check(0); break;
 		};
 	}
+
+	/** Returns the handler Exec dispatches to for these operand types, or nullptr if they aren't supported. */
+	static FVectorVMKernelFunction GetKernel(uint32 SrcOpTypes)
+	{
+		switch (SrcOpTypes)
+		{
+		case SRCOP_RRR: return &TTrinaryKernelHandler<Kernel, DstHandler, RegisterHandler, RegisterHandler, RegisterHandler, NumInstancesPerOp>::Exec;
+		case SRCOP_RRC:	return &TTrinaryKernelHandler<Kernel, DstHandler, ConstHandler, RegisterHandler, RegisterHandler, NumInstancesPerOp>::Exec;
+		case SRCOP_RCR: return &TTrinaryKernelHandler<Kernel, DstHandler, RegisterHandler, ConstHandler, RegisterHandler, NumInstancesPerOp>::Exec;
+		case SRCOP_RCC:	return &TTrinaryKernelHandler<Kernel, DstHandler, ConstHandler, ConstHandler, RegisterHandler, NumInstancesPerOp>::Exec;
+		case SRCOP_CRR: return &TTrinaryKernelHandler<Kernel, DstHandler, RegisterHandler, RegisterHandler, ConstHandler, NumInstancesPerOp>::Exec;
+		case SRCOP_CRC:	return &TTrinaryKernelHandler<Kernel, DstHandler, ConstHandler, RegisterHandler, ConstHandler, NumInstancesPerOp>::Exec;
+		case SRCOP_CCR: return &TTrinaryKernelHandler<Kernel, DstHandler, RegisterHandler, ConstHandler, ConstHandler, NumInstancesPerOp>::Exec;
+		case SRCOP_CCC:	return &TTrinaryKernelHandler<Kernel, DstHandler, ConstHandler, ConstHandler, ConstHandler, NumInstancesPerOp>::Exec;
+		default: return nullptr;
+		};
+	}
 };
 
 template<typename Kernel>
@@ -929,21 +990,42 @@ struct FScalarKernelAcquireCounterIndex
 		uint32 SrcOpTypes = DecodeSrcOperandTypes(Context);
 		switch (SrcOpTypes)
 		{
-		case SRCOP_RRR: TBinaryKernelHandler<FScalarKernelAcquireCounterIndex, FRegisterDestHandler<int32>, FDataSetCounterHandler, FRegisterHandler<int32>, 1>::Exec(Context); break;
-		case SRCOP_RRC:	TBinaryKernelHandler<FScalarKernelAcquireCounterIndex, FRegisterDestHandler<int32>, FDataSetCounterHandler, FConstantHandler<int32>, 1>::Exec(Context); break;
+		case SRCOP_RRR: ExecHandler<FRegisterHandler<int32>>(Context); break;
+		case SRCOP_RRC:	ExecHandler<FConstantHandler<int32>>(Context); break;
 		default: check(0); break;
 		};
 	}
 
-	static VM_FORCEINLINE void DoKernel(int32* RESTRICT Dst, int32* Index, int32 Valid)
+	/**
+	 * Hands out consecutive indices to the valid instances of the chunk.
+	 * The indices of the whole chunk are reserved with a single atomic add so chunks can acquire from the same counter on several threads at once.
+	 */
+	template<typename ValidHandler>
+	static VM_FORCEINLINE void ExecHandler(FVectorVMContext& Context)
 	{
-		if (*Index != INDEX_NONE && Valid != 0)
+		FDataSetCounterHandler Counter(Context);
+		ValidHandler Valid(Context);
+		FRegisterDestHandler<int32> Dst(Context);
+
+		int32* RESTRICT DstReg = Dst.GetDest();
+		int32 NumValid = 0;
+		for (int32 i = 0; i < Context.NumInstances; ++i)
 		{
-			*Dst = (*Index)++;
+			DstReg[i] = Valid.Get() != 0 ? 1 : 0;
+			NumValid += DstReg[i];
+			Valid.Advance();
 		}
-		else
-		{	
-			*Dst = INDEX_NONE;	// Subsequent DoKernal calls above will skip over INDEX_NONE register entries...
+
+		int32 Index = INDEX_NONE;
+		if (NumValid > 0 && *Counter.Get() != INDEX_NONE)
+		{
+			Index = FPlatformAtomics::InterlockedAdd(Counter.Get(), NumValid);
+		}
+
+		for (int32 i = 0; i < Context.NumInstances; ++i)
+		{
+			// Subsequent kernels skip over INDEX_NONE register entries...
+			DstReg[i] = (Index != INDEX_NONE && DstReg[i] != 0) ? Index++ : INDEX_NONE;
 		}
 	}
 };
@@ -1333,24 +1415,305 @@ void VectorVM::Init()
 	}
 }
 
-void VectorVM::Exec(
-	uint8 const* Code,
-	uint8** InputRegisters,
-	uint8* InputRegisterSizes,
-	int32 NumInputRegisters,
-	uint8** OutputRegisters,
-	uint8* OutputRegisterSizes,
-	int32 NumOutputRegisters,
-	uint8 const* ConstantTable,
-	TArray<FDataSetMeta> &DataSetMetaTable,
-	FVMExternalFunction* ExternalFunctionTable,
-	int32 NumInstances
+/** Executes all ops of the chunk through the interpreter's opcode switch. Returns false if an unknown op was found. */
+static bool InterpretChunk(FVectorVMContext& Context)
+{
+	EVectorVMOp Op = EVectorVMOp::done;
+	do 
+	{
+		Op = DecodeOp(Context);
+		switch (Op)
+		{
+		// Dispatch kernel ops.
+		case EVectorVMOp::add: FVectorKernelAdd::Exec(Context); break;
+		case EVectorVMOp::sub: FVectorKernelSub::Exec(Context); break;
+		case EVectorVMOp::mul: FVectorKernelMul::Exec(Context); break;
+		case EVectorVMOp::div: FVectorKernelDiv::Exec(Context); break;
+		case EVectorVMOp::mad: FVectorKernelMad::Exec(Context); break;
+		case EVectorVMOp::lerp: FVectorKernelLerp::Exec(Context); break;
+		case EVectorVMOp::rcp: FVectorKernelRcp::Exec(Context); break;
+		case EVectorVMOp::rsq: FVectorKernelRsq::Exec(Context); break;
+		case EVectorVMOp::sqrt: FVectorKernelSqrt::Exec(Context); break;
+		case EVectorVMOp::neg: FVectorKernelNeg::Exec(Context); break;
+		case EVectorVMOp::abs: FVectorKernelAbs::Exec(Context); break;
+		case EVectorVMOp::exp: FVectorKernelExp::Exec(Context); break;
+		case EVectorVMOp::exp2: FVectorKernelExp2::Exec(Context); break;
+		case EVectorVMOp::log: FVectorKernelLog::Exec(Context); break;
+		case EVectorVMOp::log2: FVectorKernelLog2::Exec(Context); break;
+		case EVectorVMOp::sin: FVectorKernelSin::Exec(Context); break;
+		case EVectorVMOp::cos: FVectorKernelCos::Exec(Context); break;
+		case EVectorVMOp::tan: FVectorKernelTan::Exec(Context); break;
+		case EVectorVMOp::asin: FVectorKernelASin::Exec(Context); break;
+		case EVectorVMOp::acos: FVectorKernelACos::Exec(Context); break;
+		case EVectorVMOp::atan: FVectorKernelATan::Exec(Context); break;
+		case EVectorVMOp::atan2: FVectorKernelATan2::Exec(Context); break;
+		case EVectorVMOp::ceil: FVectorKernelCeil::Exec(Context); break;
+		case EVectorVMOp::floor: FVectorKernelFloor::Exec(Context); break;
+		case EVectorVMOp::round: FVectorKernelRound::Exec(Context); break;
+		case EVectorVMOp::fmod: FVectorKernelMod::Exec(Context); break;
+		case EVectorVMOp::frac: FVectorKernelFrac::Exec(Context); break;
+		case EVectorVMOp::trunc: FVectorKernelTrunc::Exec(Context); break;
+		case EVectorVMOp::clamp: FVectorKernelClamp::Exec(Context); break;
+		case EVectorVMOp::min: FVectorKernelMin::Exec(Context); break;
+		case EVectorVMOp::max: FVectorKernelMax::Exec(Context); break;
+		case EVectorVMOp::pow: FVectorKernelPow::Exec(Context); break;
+		case EVectorVMOp::sign: FVectorKernelSign::Exec(Context); break;
+		case EVectorVMOp::step: FVectorKernelStep::Exec(Context); break;
+		case EVectorVMOp::random: FVectorKernelRandom::Exec(Context); break;
+		case EVectorVMOp::noise: VectorVMNoise::Noise1D(Context); break;
+		case EVectorVMOp::noise2D: VectorVMNoise::Noise2D(Context); break;
+		case EVectorVMOp::noise3D: VectorVMNoise::Noise3D(Context); break;
+
+		case EVectorVMOp::cmplt: FVectorKernelCompareLT::Exec(Context); break;
+		case EVectorVMOp::cmple: FVectorKernelCompareLE::Exec(Context); break;
+		case EVectorVMOp::cmpgt: FVectorKernelCompareGT::Exec(Context); break;
+		case EVectorVMOp::cmpge: FVectorKernelCompareGE::Exec(Context); break;
+		case EVectorVMOp::cmpeq: FVectorKernelCompareEQ::Exec(Context); break;
+		case EVectorVMOp::cmpneq: FVectorKernelCompareNEQ::Exec(Context); break;
+		case EVectorVMOp::select: FVectorKernelSelect::Exec(Context); break;
+
+		case EVectorVMOp::addi: FVectorIntKernelAdd::Exec(Context); break;
+		case EVectorVMOp::subi: FVectorIntKernelSubtract::Exec(Context); break;
+		case EVectorVMOp::muli: FVectorIntKernelMultiply::Exec(Context); break;
+		case EVectorVMOp::clampi: FVectorIntKernelClamp::Exec(Context); break;
+		case EVectorVMOp::mini: FVectorIntKernelMin::Exec(Context); break;
+		case EVectorVMOp::maxi: FVectorIntKernelMax::Exec(Context); break;
+		case EVectorVMOp::absi: FVectorIntKernelAbs::Exec(Context); break;
+		case EVectorVMOp::negi: FVectorIntKernelNegate::Exec(Context); break;
+		case EVectorVMOp::signi: FVectorIntKernelSign::Exec(Context); break;
+		case EVectorVMOp::cmplti: FVectorIntKernelCompareLT::Exec(Context); break;
+		case EVectorVMOp::cmplei: FVectorIntKernelCompareLE::Exec(Context); break;
+		case EVectorVMOp::cmpgti: FVectorIntKernelCompareGT::Exec(Context); break;
+		case EVectorVMOp::cmpgei: FVectorIntKernelCompareGE::Exec(Context); break;
+		case EVectorVMOp::cmpeqi: FVectorIntKernelCompareEQ::Exec(Context); break;
+		case EVectorVMOp::cmpneqi: FVectorIntKernelCompareNEQ::Exec(Context); break;
+		case EVectorVMOp::bit_and: FVectorIntKernelBitAnd::Exec(Context); break;
+		case EVectorVMOp::bit_or: FVectorIntKernelBitOr::Exec(Context); break;
+		case EVectorVMOp::bit_xor: FVectorIntKernelBitXor::Exec(Context); break;
+		case EVectorVMOp::bit_not: FVectorIntKernelBitNot::Exec(Context); break;
+		case EVectorVMOp::logic_and: FVectorIntKernelLogicAnd::Exec(Context); break;
+		case EVectorVMOp::logic_or: FVectorIntKernelLogicOr::Exec(Context); break;
+		case EVectorVMOp::logic_xor: FVectorIntKernelLogicXor::Exec(Context); break;
+		case EVectorVMOp::logic_not: FVectorIntKernelLogicNot::Exec(Context); break;
+		case EVectorVMOp::f2i: FVectorKernelFloatToInt::Exec(Context); break;
+		case EVectorVMOp::i2f: FVectorKernelIntToFloat::Exec(Context); break;
+		case EVectorVMOp::f2b: FVectorKernelFloatToBool::Exec(Context); break;
+		case EVectorVMOp::b2f: FVectorKernelBoolToFloat::Exec(Context); break;
+		case EVectorVMOp::i2b: FVectorKernelIntToBool::Exec(Context); break;
+		case EVectorVMOp::b2i: FVectorKernelBoolToInt::Exec(Context); break;
+
+		case EVectorVMOp::outputdata_32bit:	FScalarKernelWriteOutputIndexed<int32>::Exec(Context);	break;
+		case EVectorVMOp::inputdata_32bit: FVectorKernelReadInput<int32>::Exec(Context); break;
+		//case EVectorVMOp::inputdata_32bit: FVectorKernelReadInput32::Exec(Context); break;
+		case EVectorVMOp::inputdata_noadvance_32bit: FVectorKernelReadInputNoAdvance<int32>::Exec(Context); break;
+		case EVectorVMOp::acquireindex:	FScalarKernelAcquireCounterIndex::Exec(Context); break;
+		case EVectorVMOp::external_func_call: FKernelExternalFunctionCall::Exec(Context); break;
+
+		case EVectorVMOp::exec_index: FVectorKernelExecutionIndex::Exec(Context); break;
+
+		case EVectorVMOp::enter_stat_scope: FVectorKernelEnterStatScope::Exec(Context); break;
+		case EVectorVMOp::exit_stat_scope: FVectorKernelExitStatScope::Exec(Context); break;
+
+		// Execution always terminates with a "done" opcode.
+		case EVectorVMOp::done:
+			break;
+
+		// Opcode not recognized / implemented.
+		default:
+			UE_LOG(LogVectorVM, Error, TEXT("Unknown op code 0x%02x"), (uint32)Op);
+			return false;//BAIL
+		}
+	} while (Op != EVectorVMOp::done);
+
+	return true;
+}
+
+/**
+ * Returns the kernel executing Op, or nullptr if the op or its operand types are unknown.
+ * bOutSpecialized is set for kernels specialized for the operand types found at Operands; those expect the operand types to be decoded already.
+ */
+static FVectorVMKernelFunction ResolveKernel(EVectorVMOp Op, uint8 const* Operands, bool& bOutSpecialized)
+{
+	bOutSpecialized = true;
+	switch (Op)
+	{
+	case EVectorVMOp::add: return FVectorKernelAdd::GetKernel(*Operands);
+	case EVectorVMOp::sub: return FVectorKernelSub::GetKernel(*Operands);
+	case EVectorVMOp::mul: return FVectorKernelMul::GetKernel(*Operands);
+	case EVectorVMOp::div: return FVectorKernelDiv::GetKernel(*Operands);
+	case EVectorVMOp::mad: return FVectorKernelMad::GetKernel(*Operands);
+	case EVectorVMOp::lerp: return FVectorKernelLerp::GetKernel(*Operands);
+	case EVectorVMOp::rcp: return FVectorKernelRcp::GetKernel(*Operands);
+	case EVectorVMOp::rsq: return FVectorKernelRsq::GetKernel(*Operands);
+	case EVectorVMOp::sqrt: return FVectorKernelSqrt::GetKernel(*Operands);
+	case EVectorVMOp::neg: return FVectorKernelNeg::GetKernel(*Operands);
+	case EVectorVMOp::abs: return FVectorKernelAbs::GetKernel(*Operands);
+	case EVectorVMOp::exp: return FVectorKernelExp::GetKernel(*Operands);
+	case EVectorVMOp::exp2: return FVectorKernelExp2::GetKernel(*Operands);
+	case EVectorVMOp::log: return FVectorKernelLog::GetKernel(*Operands);
+	case EVectorVMOp::log2: return FVectorKernelLog2::GetKernel(*Operands);
+	case EVectorVMOp::sin: return FVectorKernelSin::GetKernel(*Operands);
+	case EVectorVMOp::cos: return FVectorKernelCos::GetKernel(*Operands);
+	case EVectorVMOp::tan: return FVectorKernelTan::GetKernel(*Operands);
+	case EVectorVMOp::asin: return FVectorKernelASin::GetKernel(*Operands);
+	case EVectorVMOp::acos: return FVectorKernelACos::GetKernel(*Operands);
+	case EVectorVMOp::atan: return FVectorKernelATan::GetKernel(*Operands);
+	case EVectorVMOp::atan2: return FVectorKernelATan2::GetKernel(*Operands);
+	case EVectorVMOp::ceil: return FVectorKernelCeil::GetKernel(*Operands);
+	case EVectorVMOp::floor: return FVectorKernelFloor::GetKernel(*Operands);
+	case EVectorVMOp::round: return FVectorKernelRound::GetKernel(*Operands);
+	case EVectorVMOp::fmod: return FVectorKernelMod::GetKernel(*Operands);
+	case EVectorVMOp::frac: return FVectorKernelFrac::GetKernel(*Operands);
+	case EVectorVMOp::trunc: return FVectorKernelTrunc::GetKernel(*Operands);
+	case EVectorVMOp::clamp: return FVectorKernelClamp::GetKernel(*Operands);
+	case EVectorVMOp::min: return FVectorKernelMin::GetKernel(*Operands);
+	case EVectorVMOp::max: return FVectorKernelMax::GetKernel(*Operands);
+	case EVectorVMOp::pow: return FVectorKernelPow::GetKernel(*Operands);
+	case EVectorVMOp::sign: return FVectorKernelSign::GetKernel(*Operands);
+	case EVectorVMOp::step: return FVectorKernelStep::GetKernel(*Operands);
+	case EVectorVMOp::random: return FVectorKernelRandom::GetKernel(*Operands);
+	case EVectorVMOp::cmplt: return FVectorKernelCompareLT::GetKernel(*Operands);
+	case EVectorVMOp::cmple: return FVectorKernelCompareLE::GetKernel(*Operands);
+	case EVectorVMOp::cmpgt: return FVectorKernelCompareGT::GetKernel(*Operands);
+	case EVectorVMOp::cmpge: return FVectorKernelCompareGE::GetKernel(*Operands);
+	case EVectorVMOp::cmpeq: return FVectorKernelCompareEQ::GetKernel(*Operands);
+	case EVectorVMOp::cmpneq: return FVectorKernelCompareNEQ::GetKernel(*Operands);
+	case EVectorVMOp::select: return FVectorKernelSelect::GetKernel(*Operands);
+	case EVectorVMOp::addi: return FVectorIntKernelAdd::GetKernel(*Operands);
+	case EVectorVMOp::subi: return FVectorIntKernelSubtract::GetKernel(*Operands);
+	case EVectorVMOp::muli: return FVectorIntKernelMultiply::GetKernel(*Operands);
+	case EVectorVMOp::clampi: return FVectorIntKernelClamp::GetKernel(*Operands);
+	case EVectorVMOp::mini: return FVectorIntKernelMin::GetKernel(*Operands);
+	case EVectorVMOp::maxi: return FVectorIntKernelMax::GetKernel(*Operands);
+	case EVectorVMOp::absi: return FVectorIntKernelAbs::GetKernel(*Operands);
+	case EVectorVMOp::negi: return FVectorIntKernelNegate::GetKernel(*Operands);
+	case EVectorVMOp::signi: return FVectorIntKernelSign::GetKernel(*Operands);
+	case EVectorVMOp::cmplti: return FVectorIntKernelCompareLT::GetKernel(*Operands);
+	case EVectorVMOp::cmplei: return FVectorIntKernelCompareLE::GetKernel(*Operands);
+	case EVectorVMOp::cmpgti: return FVectorIntKernelCompareGT::GetKernel(*Operands);
+	case EVectorVMOp::cmpgei: return FVectorIntKernelCompareGE::GetKernel(*Operands);
+	case EVectorVMOp::cmpeqi: return FVectorIntKernelCompareEQ::GetKernel(*Operands);
+	case EVectorVMOp::cmpneqi: return FVectorIntKernelCompareNEQ::GetKernel(*Operands);
+	case EVectorVMOp::bit_and: return FVectorIntKernelBitAnd::GetKernel(*Operands);
+	case EVectorVMOp::bit_or: return FVectorIntKernelBitOr::GetKernel(*Operands);
+	case EVectorVMOp::bit_xor: return FVectorIntKernelBitXor::GetKernel(*Operands);
+	case EVectorVMOp::bit_not: return FVectorIntKernelBitNot::GetKernel(*Operands);
+	case EVectorVMOp::logic_and: return FVectorIntKernelLogicAnd::GetKernel(*Operands);
+	case EVectorVMOp::logic_or: return FVectorIntKernelLogicOr::GetKernel(*Operands);
+	case EVectorVMOp::logic_xor: return FVectorIntKernelLogicXor::GetKernel(*Operands);
+	case EVectorVMOp::logic_not: return FVectorIntKernelLogicNot::GetKernel(*Operands);
+	case EVectorVMOp::f2i: return FVectorKernelFloatToInt::GetKernel(*Operands);
+	case EVectorVMOp::i2f: return FVectorKernelIntToFloat::GetKernel(*Operands);
+	case EVectorVMOp::f2b: return FVectorKernelFloatToBool::GetKernel(*Operands);
+	case EVectorVMOp::b2f: return FVectorKernelBoolToFloat::GetKernel(*Operands);
+	case EVectorVMOp::i2b: return FVectorKernelIntToBool::GetKernel(*Operands);
+	case EVectorVMOp::b2i: return FVectorKernelBoolToInt::GetKernel(*Operands);
+	default: break;
+	}
+
+	bOutSpecialized = false;
+	switch (Op)
+	{
+	case EVectorVMOp::noise: return &VectorVMNoise::Noise1D;
+	case EVectorVMOp::noise2D: return &VectorVMNoise::Noise2D;
+	case EVectorVMOp::noise3D: return &VectorVMNoise::Noise3D;
+	case EVectorVMOp::outputdata_32bit: return &FScalarKernelWriteOutputIndexed<int32>::Exec;
+	case EVectorVMOp::inputdata_32bit: return &FVectorKernelReadInput<int32>::Exec;
+	case EVectorVMOp::inputdata_noadvance_32bit: return &FVectorKernelReadInputNoAdvance<int32>::Exec;
+	case EVectorVMOp::acquireindex: return &FScalarKernelAcquireCounterIndex::Exec;
+	case EVectorVMOp::external_func_call: return &FKernelExternalFunctionCall::Exec;
+	case EVectorVMOp::exec_index: return &FVectorKernelExecutionIndex::Exec;
+	case EVectorVMOp::enter_stat_scope: return &FVectorKernelEnterStatScope::Exec;
+	case EVectorVMOp::exit_stat_scope: return &FVectorKernelExitStatScope::Exec;
+	default: break;
+	}
+
+	return nullptr;
+}
+
+/** Executes all ops of the chunk while recording the kernel each op resolves to in ResolvedByteCode. Returns false if the byte code can't be resolved. */
+static bool ResolveChunk(FVectorVMContext& Context, VectorVM::FResolvedByteCode& ResolvedByteCode)
+{
+	uint8 const* Code = Context.Code;
+	ResolvedByteCode.Kernels.Reset();
+	ResolvedByteCode.OperandOffsets.Reset();
+
+	for (;;)
+	{
+		const EVectorVMOp Op = DecodeOp(Context);
+		if (Op == EVectorVMOp::done)
+		{
+			ResolvedByteCode.bResolved = true;
+			return true;
+		}
+
+		bool bSpecialized = false;
+		FVectorVMKernelFunction Kernel = ResolveKernel(Op, Context.Code, bSpecialized);
+		if (Kernel == nullptr)
+		{
+			UE_LOG(LogVectorVM, Error, TEXT("Unknown op code 0x%02x or operand types 0x%02x"), (uint32)Op, (uint32)*Context.Code);
+			ResolvedByteCode.Kernels.Reset();
+			ResolvedByteCode.OperandOffsets.Reset();
+			ResolvedByteCode.bFailed = true;
+			return false;//BAIL
+		}
+
+		if (bSpecialized)
+		{
+			DecodeSrcOperandTypes(Context);
+		}
+
+		ResolvedByteCode.Kernels.Add(Kernel);
+		ResolvedByteCode.OperandOffsets.Add(Context.Code - Code);
+		Kernel(Context);
+	}
+}
+
+/** Executes all ops of the chunk by calling their resolved kernels directly. */
+static void ExecResolvedChunk(FVectorVMContext& Context, const VectorVM::FResolvedByteCode& ResolvedByteCode)
+{
+	uint8 const* Code = Context.Code;
+	const FVectorVMKernelFunction* Kernels = ResolvedByteCode.Kernels.GetData();
+	const int32* OperandOffsets = ResolvedByteCode.OperandOffsets.GetData();
+	const int32 NumKernels = ResolvedByteCode.Kernels.Num();
+
+	for (int32 KernelIdx = 0; KernelIdx < NumKernels; ++KernelIdx)
+	{
+		Context.Code = Code + OperandOffsets[KernelIdx];
+		Kernels[KernelIdx](Context);
+	}
+}
+
+/** Register and data set state shared by all chunks of one execution. */
+struct FVectorVMExecState
+{
+	uint8 const* Code;
+	uint8** InputRegisters;
+	int32 NumInputRegisters;
+	uint8** OutputRegisters;
+	int32 NumOutputRegisters;
+	uint8 const* ConstantTable;
+	FVMExternalFunction* ExternalFunctionTable;
+	int32 NumInstances;
+
+	// table of index counters, one for each data set
+	TArray<int32> DataSetIndexTable;
+	TArray<int32> DataSetOffsetTable;
 
 #if STATS
-	, TArray<TStatId>& StatScopes
+	TArray<TStatId>* StatScopes;
 #endif
-	)
+};
+
+/**
+ * Executes chunks [FirstChunk, EndChunk) one after the other with their own temporary registers, so ranges of chunks can execute on different threads.
+ * Uses the kernels of ResolvedByteCode if one is given, resolving them with the first chunk if needed, and interprets the byte code otherwise.
+ * Returns false if the byte code could not be executed.
+ */
+static bool ExecChunks(FVectorVMExecState& State, VectorVM::FResolvedByteCode* ResolvedByteCode, int32 FirstChunk, int32 EndChunk)
 {
+	using namespace VectorVM;
+
 	uint32 TempRegisterSize = Align((InstancesPerChunk) * MaxInstanceSizeBytes, VECTOR_WIDTH_BYTES) + VECTOR_WIDTH_BYTES;
 	//TODO: Refactor this so VMs are a persistent object with growing buffers. Once spun up, there are no allocs.
 	//Can be pooled and used for threading and branching.
@@ -1369,162 +1732,244 @@ void VectorVM::Exec(
 	//Input and output registers are indexed absolutely directly in their kernels.
 	//TODO: No need for these to be in the same table now.
 	//TODO: Also no need for the i/o size table as the ops will deal with that now.
- 	for (int32 i = 0; i < NumInputRegisters; ++i)
+ 	for (int32 i = 0; i < State.NumInputRegisters; ++i)
  	{
- 		RegisterTable[NumTempRegisters + i] = InputRegisters[i];
+ 		RegisterTable[NumTempRegisters + i] = State.InputRegisters[i];
  	}
- 	for (int32 i = 0; i < NumOutputRegisters; ++i)
+ 	for (int32 i = 0; i < State.NumOutputRegisters; ++i)
  	{
- 		RegisterTable[NumTempRegisters + MaxInputRegisters + i] = OutputRegisters[i];
+ 		RegisterTable[NumTempRegisters + MaxInputRegisters + i] = State.OutputRegisters[i];
  	}
 
-	// table of index counters, one for each data set
-	TArray<int32> DataSetIndexTable;
+	// Process one chunk at a time.
+	for (int32 ChunkIdx = FirstChunk; ChunkIdx < EndChunk; ++ChunkIdx)
+	{
+		const int32 InstancesLeft = State.NumInstances - InstancesPerChunk * ChunkIdx;
+
+		// Setup execution context.
+		FVectorVMContext Context(State.Code, RegisterTable, State.ConstantTable, State.DataSetIndexTable.GetData(), State.DataSetOffsetTable.GetData(), 
+			State.ExternalFunctionTable, FMath::Min(InstancesLeft, (int32)InstancesPerChunk), InstancesPerChunk * ChunkIdx
+#if STATS
+			, *State.StatScopes
+#endif
+		);
+		Context.NumSecondaryDataSets = State.DataSetOffsetTable.Num();
+
+		bool bSucceeded = true;
+		if (ResolvedByteCode == nullptr)
+		{
+			bSucceeded = InterpretChunk(Context);
+		}
+		else if (ResolvedByteCode->bResolved)
+		{
+			ExecResolvedChunk(Context, *ResolvedByteCode);
+		}
+		else
+		{
+			bSucceeded = ResolveChunk(Context, *ResolvedByteCode);
+		}
+
+		if (!bSucceeded)
+		{
+			return false;//BAIL
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Executes the byte code over all instances, resolving or using the kernels of ResolvedByteCode if one is given and interpreting it otherwise.
+ * If bParallel is set, batches of chunks are executed on task graph workers.
+ */
+static void ExecInternal(
+	uint8 const* Code,
+	VectorVM::FResolvedByteCode* ResolvedByteCode,
+	bool bParallel,
+	uint8** InputRegisters,
+	int32 NumInputRegisters,
+	uint8** OutputRegisters,
+	int32 NumOutputRegisters,
+	uint8 const* ConstantTable,
+	TArray<FDataSetMeta> &DataSetMetaTable,
+	FVMExternalFunction* ExternalFunctionTable,
+	int32 NumInstances
+
+#if STATS
+	, TArray<TStatId>& StatScopes
+#endif
+	)
+{
+	using namespace VectorVM;
+
+	FVectorVMExecState State;
+	State.Code = Code;
+	State.InputRegisters = InputRegisters;
+	State.NumInputRegisters = NumInputRegisters;
+	State.OutputRegisters = OutputRegisters;
+	State.NumOutputRegisters = NumOutputRegisters;
+	State.ConstantTable = ConstantTable;
+	State.ExternalFunctionTable = ExternalFunctionTable;
+	State.NumInstances = NumInstances;
+#if STATS
+	State.StatScopes = &StatScopes;
+#endif
 
 	// map secondary data sets and fill in the offset table into the register table
 	//
-	TArray<int32> DataSetOffsetTable;
 	for (int32 Idx = 0; Idx < DataSetMetaTable.Num(); Idx++)
 	{
 		uint32 DataSetOffset = DataSetMetaTable[Idx].NumVariables;
-		DataSetOffsetTable.Add(DataSetOffset);
-		DataSetIndexTable.Add(DataSetMetaTable[Idx].DataSetAccessIndex);	// prime counter index table with the data set offset; will be incremented with every write for each instance
+		State.DataSetOffsetTable.Add(DataSetOffset);
+		State.DataSetIndexTable.Add(DataSetMetaTable[Idx].DataSetAccessIndex);	// prime counter index table with the data set offset; will be incremented with every write for each instance
 	}
 
+	const int32 NumChunks = FMath::DivideAndRoundUp(NumInstances, (int32)InstancesPerChunk);
+	const int32 ChunksPerBatch = FMath::Max(FMath::DivideAndRoundUp(CVarVMParallelBatchSize.GetValueOnAnyThread(), (int32)InstancesPerChunk), 1);
 
-
-	// Process one chunk at a time.
-	int32 InstancesLeft = NumInstances;
-	int32 ChunkIdx = 0;
-	while (InstancesLeft > 0)
+	if (!bParallel || NumChunks <= ChunksPerBatch)
 	{
-		// Setup execution context.
-		FVectorVMContext Context(Code, RegisterTable, ConstantTable, DataSetIndexTable.GetData(), DataSetOffsetTable.GetData(), 
-			ExternalFunctionTable, FMath::Min(InstancesLeft, (int32)InstancesPerChunk), InstancesPerChunk * ChunkIdx
-#if STATS
-			, StatScopes
-#endif
-		);
-		Context.NumSecondaryDataSets = DataSetOffsetTable.Num();
-		EVectorVMOp Op = EVectorVMOp::done;
+		if (!ExecChunks(State, ResolvedByteCode, 0, NumChunks))
+		{
+			return;//BAIL
+		}
+	}
+	else
+	{
+		SCOPE_CYCLE_COUNTER(STAT_VVMExecParallel);
 
-		// Execute VM on all vectors in this chunk.
-		do 
+		// Resolve kernels with the first chunk before going wide so workers only read the resolved byte code
+		int32 FirstParallelChunk = 0;
+		if (ResolvedByteCode && !ResolvedByteCode->bResolved)
 		{
-			Op = DecodeOp(Context);
-			switch (Op)
+			if (!ExecChunks(State, ResolvedByteCode, 0, 1))
 			{
-			// Dispatch kernel ops.
-			case EVectorVMOp::add: FVectorKernelAdd::Exec(Context); break;
-			case EVectorVMOp::sub: FVectorKernelSub::Exec(Context); break;
-			case EVectorVMOp::mul: FVectorKernelMul::Exec(Context); break;
-			case EVectorVMOp::div: FVectorKernelDiv::Exec(Context); break;
-			case EVectorVMOp::mad: FVectorKernelMad::Exec(Context); break;
-			case EVectorVMOp::lerp: FVectorKernelLerp::Exec(Context); break;
-			case EVectorVMOp::rcp: FVectorKernelRcp::Exec(Context); break;
-			case EVectorVMOp::rsq: FVectorKernelRsq::Exec(Context); break;
-			case EVectorVMOp::sqrt: FVectorKernelSqrt::Exec(Context); break;
-			case EVectorVMOp::neg: FVectorKernelNeg::Exec(Context); break;
-			case EVectorVMOp::abs: FVectorKernelAbs::Exec(Context); break;
-			case EVectorVMOp::exp: FVectorKernelExp::Exec(Context); break;
-			case EVectorVMOp::exp2: FVectorKernelExp2::Exec(Context); break;
-			case EVectorVMOp::log: FVectorKernelLog::Exec(Context); break;
-			case EVectorVMOp::log2: FVectorKernelLog2::Exec(Context); break;
-			case EVectorVMOp::sin: FVectorKernelSin::Exec(Context); break;
-			case EVectorVMOp::cos: FVectorKernelCos::Exec(Context); break;
-			case EVectorVMOp::tan: FVectorKernelTan::Exec(Context); break;
-			case EVectorVMOp::asin: FVectorKernelASin::Exec(Context); break;
-			case EVectorVMOp::acos: FVectorKernelACos::Exec(Context); break;
-			case EVectorVMOp::atan: FVectorKernelATan::Exec(Context); break;
-			case EVectorVMOp::atan2: FVectorKernelATan2::Exec(Context); break;
-			case EVectorVMOp::ceil: FVectorKernelCeil::Exec(Context); break;
-			case EVectorVMOp::floor: FVectorKernelFloor::Exec(Context); break;
-			case EVectorVMOp::round: FVectorKernelRound::Exec(Context); break;
-			case EVectorVMOp::fmod: FVectorKernelMod::Exec(Context); break;
-			case EVectorVMOp::frac: FVectorKernelFrac::Exec(Context); break;
-			case EVectorVMOp::trunc: FVectorKernelTrunc::Exec(Context); break;
-			case EVectorVMOp::clamp: FVectorKernelClamp::Exec(Context); break;
-			case EVectorVMOp::min: FVectorKernelMin::Exec(Context); break;
-			case EVectorVMOp::max: FVectorKernelMax::Exec(Context); break;
-			case EVectorVMOp::pow: FVectorKernelPow::Exec(Context); break;
-			case EVectorVMOp::sign: FVectorKernelSign::Exec(Context); break;
-			case EVectorVMOp::step: FVectorKernelStep::Exec(Context); break;
-			case EVectorVMOp::random: FVectorKernelRandom::Exec(Context); break;
-			case EVectorVMOp::noise: VectorVMNoise::Noise1D(Context); break;
-			case EVectorVMOp::noise2D: VectorVMNoise::Noise2D(Context); break;
-			case EVectorVMOp::noise3D: VectorVMNoise::Noise3D(Context); break;
-
-			case EVectorVMOp::cmplt: FVectorKernelCompareLT::Exec(Context); break;
-			case EVectorVMOp::cmple: FVectorKernelCompareLE::Exec(Context); break;
-			case EVectorVMOp::cmpgt: FVectorKernelCompareGT::Exec(Context); break;
-			case EVectorVMOp::cmpge: FVectorKernelCompareGE::Exec(Context); break;
-			case EVectorVMOp::cmpeq: FVectorKernelCompareEQ::Exec(Context); break;
-			case EVectorVMOp::cmpneq: FVectorKernelCompareNEQ::Exec(Context); break;
-			case EVectorVMOp::select: FVectorKernelSelect::Exec(Context); break;
-
-			case EVectorVMOp::addi: FVectorIntKernelAdd::Exec(Context); break;
-			case EVectorVMOp::subi: FVectorIntKernelSubtract::Exec(Context); break;
-			case EVectorVMOp::muli: FVectorIntKernelMultiply::Exec(Context); break;
-			case EVectorVMOp::clampi: FVectorIntKernelClamp::Exec(Context); break;
-			case EVectorVMOp::mini: FVectorIntKernelMin::Exec(Context); break;
-			case EVectorVMOp::maxi: FVectorIntKernelMax::Exec(Context); break;
-			case EVectorVMOp::absi: FVectorIntKernelAbs::Exec(Context); break;
-			case EVectorVMOp::negi: FVectorIntKernelNegate::Exec(Context); break;
-			case EVectorVMOp::signi: FVectorIntKernelSign::Exec(Context); break;
-			case EVectorVMOp::cmplti: FVectorIntKernelCompareLT::Exec(Context); break;
-			case EVectorVMOp::cmplei: FVectorIntKernelCompareLE::Exec(Context); break;
-			case EVectorVMOp::cmpgti: FVectorIntKernelCompareGT::Exec(Context); break;
-			case EVectorVMOp::cmpgei: FVectorIntKernelCompareGE::Exec(Context); break;
-			case EVectorVMOp::cmpeqi: FVectorIntKernelCompareEQ::Exec(Context); break;
-			case EVectorVMOp::cmpneqi: FVectorIntKernelCompareNEQ::Exec(Context); break;
-			case EVectorVMOp::bit_and: FVectorIntKernelBitAnd::Exec(Context); break;
-			case EVectorVMOp::bit_or: FVectorIntKernelBitOr::Exec(Context); break;
-			case EVectorVMOp::bit_xor: FVectorIntKernelBitXor::Exec(Context); break;
-			case EVectorVMOp::bit_not: FVectorIntKernelBitNot::Exec(Context); break;
-			case EVectorVMOp::logic_and: FVectorIntKernelLogicAnd::Exec(Context); break;
-			case EVectorVMOp::logic_or: FVectorIntKernelLogicOr::Exec(Context); break;
-			case EVectorVMOp::logic_xor: FVectorIntKernelLogicXor::Exec(Context); break;
-			case EVectorVMOp::logic_not: FVectorIntKernelLogicNot::Exec(Context); break;
-			case EVectorVMOp::f2i: FVectorKernelFloatToInt::Exec(Context); break;
-			case EVectorVMOp::i2f: FVectorKernelIntToFloat::Exec(Context); break;
-			case EVectorVMOp::f2b: FVectorKernelFloatToBool::Exec(Context); break;
-			case EVectorVMOp::b2f: FVectorKernelBoolToFloat::Exec(Context); break;
-			case EVectorVMOp::i2b: FVectorKernelIntToBool::Exec(Context); break;
-			case EVectorVMOp::b2i: FVectorKernelBoolToInt::Exec(Context); break;
-
-			case EVectorVMOp::outputdata_32bit:	FScalarKernelWriteOutputIndexed<int32>::Exec(Context);	break;
-			case EVectorVMOp::inputdata_32bit: FVectorKernelReadInput<int32>::Exec(Context); break;
-			//case EVectorVMOp::inputdata_32bit: FVectorKernelReadInput32::Exec(Context); break;
-			case EVectorVMOp::inputdata_noadvance_32bit: FVectorKernelReadInputNoAdvance<int32>::Exec(Context); break;
-			case EVectorVMOp::acquireindex:	FScalarKernelAcquireCounterIndex::Exec(Context); break;
-			case EVectorVMOp::external_func_call: FKernelExternalFunctionCall::Exec(Context); break;
-
-			case EVectorVMOp::exec_index: FVectorKernelExecutionIndex::Exec(Context); break;
-
-			case EVectorVMOp::enter_stat_scope: FVectorKernelEnterStatScope::Exec(Context); break;
-			case EVectorVMOp::exit_stat_scope: FVectorKernelExitStatScope::Exec(Context); break;
-
-			// Execution always terminates with a "done" opcode.
-			case EVectorVMOp::done:
-				break;
-
-			// Opcode not recognized / implemented.
-			default:
-				UE_LOG(LogVectorVM, Error, TEXT("Unknown op code 0x%02x"), (uint32)Op);
 				return;//BAIL
 			}
-		} while (Op != EVectorVMOp::done);
+			FirstParallelChunk = 1;
+		}
 
-		InstancesLeft -= InstancesPerChunk;
-		++ChunkIdx;
+		const int32 NumBatches = FMath::DivideAndRoundUp(NumChunks - FirstParallelChunk, ChunksPerBatch);
+		FThreadSafeCounter NumFailedBatches;
+		ParallelFor(NumBatches, [&](int32 BatchIdx)
+		{
+			const int32 FirstChunk = FirstParallelChunk + BatchIdx * ChunksPerBatch;
+			const int32 EndChunk = FMath::Min(FirstChunk + ChunksPerBatch, NumChunks);
+			if (!ExecChunks(State, ResolvedByteCode, FirstChunk, EndChunk))
+			{
+				NumFailedBatches.Increment();
+			}
+		});
+
+		if (NumFailedBatches.GetValue() > 0)
+		{
+			return;//BAIL
+		}
 	}
 
 	// write back data set access indices, so we know how much was written to each data set
 	for (int32 Idx = 0; Idx < DataSetMetaTable.Num(); Idx++)
 	{
-		DataSetMetaTable[Idx].DataSetAccessIndex = DataSetIndexTable[Idx];	
+		DataSetMetaTable[Idx].DataSetAccessIndex = State.DataSetIndexTable[Idx];	
 	}
+}
 
+void VectorVM::Exec(
+	uint8 const* Code,
+	uint8** InputRegisters,
+	uint8* InputRegisterSizes,
+	int32 NumInputRegisters,
+	uint8** OutputRegisters,
+	uint8* OutputRegisterSizes,
+	int32 NumOutputRegisters,
+	uint8 const* ConstantTable,
+	TArray<FDataSetMeta> &DataSetMetaTable,
+	FVMExternalFunction* ExternalFunctionTable,
+	int32 NumInstances
+
+#if STATS
+	, TArray<TStatId>& StatScopes
+#endif
+	)
+{
+	ExecInternal(Code, nullptr, false, InputRegisters, NumInputRegisters, OutputRegisters, NumOutputRegisters,
+		ConstantTable, DataSetMetaTable, ExternalFunctionTable, NumInstances
+#if STATS
+		, StatScopes
+#endif
+		);
+}
+
+void VectorVM::Exec(
+	const TArray<uint8>& ByteCode,
+	FResolvedByteCode& ResolvedByteCode,
+	uint8** InputRegisters,
+	uint8* InputRegisterSizes,
+	int32 NumInputRegisters,
+	uint8** OutputRegisters,
+	uint8* OutputRegisterSizes,
+	int32 NumOutputRegisters,
+	uint8 const* ConstantTable,
+	TArray<FDataSetMeta> &DataSetMetaTable,
+	FVMExternalFunction* ExternalFunctionTable,
+	int32 NumInstances
+
+#if STATS
+	, TArray<TStatId>& StatScopes
+#endif
+	)
+{
+	ResolvedByteCode.Update(ByteCode);
+	const bool bUseResolvedByteCode = CVarVMResolveByteCode.GetValueOnAnyThread() != 0 && !ResolvedByteCode.bFailed;
+
+	ExecInternal(ByteCode.GetData(), bUseResolvedByteCode ? &ResolvedByteCode : nullptr, false, InputRegisters, NumInputRegisters, OutputRegisters, NumOutputRegisters,
+		ConstantTable, DataSetMetaTable, ExternalFunctionTable, NumInstances
+#if STATS
+		, StatScopes
+#endif
+		);
+}
+
+void VectorVM::ExecParallel(
+	const TArray<uint8>& ByteCode,
+	FResolvedByteCode& ResolvedByteCode,
+	uint8** InputRegisters,
+	uint8* InputRegisterSizes,
+	int32 NumInputRegisters,
+	uint8** OutputRegisters,
+	uint8* OutputRegisterSizes,
+	int32 NumOutputRegisters,
+	uint8 const* ConstantTable,
+	TArray<FDataSetMeta> &DataSetMetaTable,
+	FVMExternalFunction* ExternalFunctionTable,
+	int32 NumInstances
+
+#if STATS
+	, TArray<TStatId>& StatScopes
+#endif
+	)
+{
+	ResolvedByteCode.Update(ByteCode);
+	const bool bUseResolvedByteCode = CVarVMResolveByteCode.GetValueOnAnyThread() != 0 && !ResolvedByteCode.bFailed;
+
+	ExecInternal(ByteCode.GetData(), bUseResolvedByteCode ? &ResolvedByteCode : nullptr, CVarVMParallel.GetValueOnAnyThread() != 0, InputRegisters, NumInputRegisters, OutputRegisters, NumOutputRegisters,
+		ConstantTable, DataSetMetaTable, ExternalFunctionTable, NumInstances
+#if STATS
+		, StatScopes
+#endif
+		);
+}
+
+void VectorVM::FResolvedByteCode::Update(const TArray<uint8>& InByteCode)
+{
+	if (ByteCode != InByteCode)
+	{
+		ByteCode = InByteCode;
+		Kernels.Reset();
+		OperandOffsets.Reset();
+		bResolved = false;
+		bFailed = false;
+	}
 }
 
 uint8 VectorVM::GetNumOpCodes()
@@ -12,6 +12,9 @@
 
 DECLARE_DELEGATE_OneParam(FVMExternalFunction, struct FVectorVMContext& /*Context*/);
 
+/** Kernel executing a single op of the VM, decoding its operands from the context's byte code. */
+typedef void (*FVectorVMKernelFunction)(struct FVectorVMContext& /*Context*/);
+
 UENUM()
 enum class EVectorVMBaseTypes : uint8
 {
@@ -202,6 +205,81 @@ namespace VectorVM
 		FVMExternalFunction* ExternalFunctionTable,
 		int32 NumInstances
 
+#if STATS
+		, TArray<TStatId>& StatScopes
+#endif
+		);
+
+	/**
+	 * Byte code with every op bound to the kernel specialization for its operand types.
+	 * Resolved by the first chunk executing it and reused by all later executions, which then skip the opcode and operand type dispatch of the interpreter.
+	 * Keep one per script; it is reset whenever the byte code it is executed with changes.
+	 */
+	struct FResolvedByteCode
+	{
+		/** Copy of the byte code the kernels were resolved from. */
+		TArray<uint8> ByteCode;
+		/** Kernel of each op, in execution order. */
+		TArray<FVectorVMKernelFunction> Kernels;
+		/** Offset in ByteCode of the first operand decoded by each kernel. */
+		TArray<int32> OperandOffsets;
+		/** Whether Kernels holds the complete program. */
+		bool bResolved;
+		/** Whether resolving failed, in which case the byte code is always interpreted. */
+		bool bFailed;
+
+		FResolvedByteCode()
+			: bResolved(false)
+			, bFailed(false)
+		{}
+
+		/** Discards the resolved kernels if they were not built from InByteCode. */
+		VECTORVM_API void Update(const TArray<uint8>& InByteCode);
+	};
+
+	/**
+	 * Execute VectorVM bytecode, using and filling in the resolved kernels of ResolvedByteCode.
+	 * Falls back to the interpreter if the byte code can't be resolved or vm.ResolveByteCode is 0.
+	 */
+	VECTORVM_API void Exec(
+		const TArray<uint8>& ByteCode,
+		FResolvedByteCode& ResolvedByteCode,
+		uint8** InputRegisters,
+		uint8* InputRegisterSizes,
+		int32 NumInputRegisters,
+		uint8** OutputRegisters,
+		uint8* OutputRegisterSizes,
+		int32 NumOutputRegisters,
+		uint8 const* ConstantTable,
+		TArray<FDataSetMeta> &DataSetMetaTable,
+		FVMExternalFunction* ExternalFunctionTable,
+		int32 NumInstances
+
+#if STATS
+		, TArray<TStatId>& StatScopes
+#endif
+		);
+
+	/**
+	 * Execute VectorVM bytecode like Exec, splitting the instances into batches of chunks executed on task graph workers.
+	 * Each batch gets its own temporary registers. Indices acquired from data set counters are reserved atomically per chunk, so instances
+	 * written to secondary data sets are not necessarily in instance order. External functions must be safe to call from several threads at once.
+	 * Executes on the calling thread if there are fewer instances than vm.ParallelBatchSize or vm.Parallel is 0.
+	 */
+	VECTORVM_API void ExecParallel(
+		const TArray<uint8>& ByteCode,
+		FResolvedByteCode& ResolvedByteCode,
+		uint8** InputRegisters,
+		uint8* InputRegisterSizes,
+		int32 NumInputRegisters,
+		uint8** OutputRegisters,
+		uint8* OutputRegisterSizes,
+		int32 NumOutputRegisters,
+		uint8 const* ConstantTable,
+		TArray<FDataSetMeta> &DataSetMetaTable,
+		FVMExternalFunction* ExternalFunctionTable,
+		int32 NumInstances
+
 #if STATS
 		, TArray<TStatId>& StatScopes
 #endif
@@ -1500,14 +1500,19 @@ namespace VulkanRHI
 			OutInfo.CurrentOffset = (uint32)(AlignedData - MappedData[BufferIndex]);
 			CurrentData[BufferIndex] = AlignedData + InSize;
 			PeakUsed = FMath::Max(PeakUsed, (uint32)(CurrentData[BufferIndex] - MappedData[BufferIndex]));
+			INC_DWORD_STAT_BY(STAT_VulkanTempFrameAllocatorUsed, InSize);
 			return true;
 		}
 
+		UE_LOG(LogVulkanRHI, Warning, TEXT("Out of temp frame memory allocating %u bytes, %u of %u bytes used this frame; increase r.Vulkan.TempFrameAllocatorSizeMB"),
+			InSize, (uint32)(CurrentData[BufferIndex] - MappedData[BufferIndex]), Size);
 		return false;
 	}
 
 	void FTempFrameAllocationBuffer::Reset()
 	{
+		SET_DWORD_STAT(STAT_VulkanTempFrameAllocatorPeak, PeakUsed);
+
 		BufferIndex = (BufferIndex + 1) % NUM_RENDER_BUFFERS;
 		CurrentData[BufferIndex] = MappedData[BufferIndex];
 	}
@@ -7,6 +7,8 @@
 #include "VulkanRHIPrivate.h"
 #include "VulkanPipeline.h"
 #include "Misc/FileHelper.h"
+#include "Misc/App.h"
+#include "Async/ParallelFor.h"
 #include "Serialization/MemoryReader.h"
 #include "Serialization/MemoryWriter.h"
 #include "VulkanBoundShaderState.h"
@@ -141,6 +143,25 @@ static TAutoConsoleVariable<int32> GEnablePipelineCacheLoadCvar(
 	TEXT("1 to enable using pipeline cache")
 	);
 
+static TAutoConsoleVariable<int32> GCreateLoadedPipelinesInParallelCvar(
+	TEXT("r.Vulkan.PipelineCacheLoadInParallel"),
+	1,
+	TEXT("0 to create the pipelines recorded in the pipeline cache file on the thread initializing the RHI\n")
+	TEXT("1 to create them on the task threads (default)")
+	);
+
+static TAutoConsoleVariable<int32> GSavePipelineCacheOnExitCvar(
+	TEXT("r.Vulkan.PipelineCacheSaveOnExit"),
+	1,
+	TEXT("0 to only save the pipeline cache with r.Vulkan.SavePipelineCache\n")
+	TEXT("1 to also save it when the RHI shuts down, so the next run can prewarm its pipelines (default)")
+	);
+
+bool FVulkanPipelineStateCache::ShouldSaveOnExit()
+{
+	return GSavePipelineCacheOnExitCvar.GetValueOnAnyThread() != 0;
+}
+
 FVulkanPipelineStateCache::FGfxPipelineEntry::~FGfxPipelineEntry()
 {
 	check(!bLoaded);
@@ -185,23 +206,6 @@ bool FVulkanPipelineStateCache::Load(const TArray<FString>& CacheFilenames, TArr
 				continue;
 			}
 			Ar << GfxPipelineEntries;
-
-			for (int32 Index = 0; Index < GfxPipelineEntries.Num(); ++Index)
-			{
-				FVulkanGfxPipeline* Pipeline = new FVulkanGfxPipeline(Device);
-				FGfxPipelineEntry* GfxEntry = &GfxPipelineEntries[Index];
-				GfxEntry->bLoaded = true;
-				CreatGfxEntryRuntimeObjects(GfxEntry);
-				CreateGfxPipelineFromEntry(GfxEntry, Pipeline, nullptr);
-
-				FVulkanGfxPipelineStateKey CreateInfo(GfxEntry->GraphicsKey, GfxEntry->VertexInputKey, GfxEntry->ShaderHashes);
-
-				// Add to the cache
-				KeyToGfxPipelineMap.Add(CreateInfo, Pipeline);
-				CreatedGfxPipelines.Add(GfxEntry, Pipeline);
-				Pipeline->AddRef();
-			}
-
 			Ar << OutDeviceCache;
 
 			if (OutDeviceCache.Num() > 4)
@@ -249,6 +253,49 @@ void FVulkanPipelineStateCache::DestroyPipeline(FVulkanGfxPipeline* Pipeline)
 	}
 }
 
+void FVulkanPipelineStateCache::CreateLoadedGfxPipelines()
+{
+	const int32 NumEntries = GfxPipelineEntries.Num();
+	if (NumEntries == 0)
+	{
+		return;
+	}
+
+	const double BeginTime = FPlatformTime::Seconds();
+
+	TArray<FVulkanGfxPipeline*> Pipelines;
+	Pipelines.AddUninitialized(NumEntries);
+	for (int32 Index = 0; Index < NumEntries; ++Index)
+	{
+		Pipelines[Index] = new FVulkanGfxPipeline(Device);
+	}
+
+	// Each entry only touches its own Vulkan objects, and the VkPipelineCache is internally synchronized
+	const bool bParallel = GCreateLoadedPipelinesInParallelCvar.GetValueOnAnyThread() != 0 && FApp::ShouldUseThreadingForPerformance();
+	ParallelFor(NumEntries, [this, &Pipelines](int32 Index)
+	{
+		FGfxPipelineEntry* GfxEntry = &GfxPipelineEntries[Index];
+		CreatGfxEntryRuntimeObjects(GfxEntry);
+		CreateGfxPipelineFromEntry(GfxEntry, Pipelines[Index], nullptr);
+	}, !bParallel);
+
+	for (int32 Index = 0; Index < NumEntries; ++Index)
+	{
+		FGfxPipelineEntry* GfxEntry = &GfxPipelineEntries[Index];
+		FVulkanGfxPipeline* Pipeline = Pipelines[Index];
+		GfxEntry->bLoaded = true;
+
+		FVulkanGfxPipelineStateKey CreateInfo(GfxEntry->GraphicsKey, GfxEntry->VertexInputKey, GfxEntry->ShaderHashes);
+
+		// Add to the cache
+		KeyToGfxPipelineMap.Add(CreateInfo, Pipeline);
+		CreatedGfxPipelines.Add(GfxEntry, Pipeline);
+		Pipeline->AddRef();
+	}
+
+	UE_LOG(LogVulkanRHI, Display, TEXT("Created %d cached pipelines in %.3f ms%s"), NumEntries, (float)((FPlatformTime::Seconds() - BeginTime) * 1000.0), bParallel ? TEXT(" on task threads") : TEXT(""));
+}
+
 void FVulkanPipelineStateCache::InitAndLoad(const TArray<FString>& CacheFilenames)
 {
 	TArray<uint8> DeviceCache;
@@ -269,6 +316,9 @@ void FVulkanPipelineStateCache::InitAndLoad(const TArray<FString>& CacheFilename
 	PipelineCacheInfo.initialDataSize = bLoaded ? DeviceCache.Num() : 0;
 	PipelineCacheInfo.pInitialData = bLoaded ? DeviceCache.GetData() : 0;
 	VERIFYVULKANRESULT(VulkanRHI::vkCreatePipelineCache(Device->GetInstanceHandle(), &PipelineCacheInfo, nullptr, &PipelineCache));
+
+	// Create the recorded pipelines now that the driver cache is seeded, so they are ready (and mostly hits) by the first frame
+	CreateLoadedGfxPipelines();
 }
 
 void FVulkanPipelineStateCache::Save(FString& CacheFilename)
@@ -199,6 +199,9 @@ public:
 	void InitAndLoad(const TArray<FString>& CacheFilenames);
 	void Save(FString& CacheFilename);
 
+	// Whether the cache gets saved when the RHI shuts down, per r.Vulkan.PipelineCacheSaveOnExit
+	static bool ShouldSaveOnExit();
+
 	FVulkanPipelineStateCache(FVulkanDevice* InParent);
 	~FVulkanPipelineStateCache();
 
@@ -574,5 +577,6 @@ private:
 	void PopulateGfxEntry(const FVulkanGfxPipelineState& State, const FVulkanRenderPass* RenderPass, FGfxPipelineEntry* OutGfxEntry);
 	void CreatGfxEntryRuntimeObjects(FGfxPipelineEntry* GfxEntry);
 	bool Load(const TArray<FString>& CacheFilenames, TArray<uint8>& OutDeviceCache);
+	void CreateLoadedGfxPipelines();
 	void DestroyCache();
 };
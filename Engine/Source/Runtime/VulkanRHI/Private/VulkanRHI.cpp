@@ -271,6 +271,14 @@ FDynamicRHI* FVulkanDynamicRHIModule::CreateRHI(ERHIFeatureLevel::Type InRequest
 IMPLEMENT_MODULE(FVulkanDynamicRHIModule, VulkanRHI);
 
 
+static TAutoConsoleVariable<int32> GTempFrameAllocatorSizeMBCvar(
+	TEXT("r.Vulkan.TempFrameAllocatorSizeMB"),
+	VULKAN_TEMP_FRAME_ALLOCATOR_SIZE / (1024 * 1024),
+	TEXT("Size in MB of each of the per frame buffers that volatile vertex and index buffers and DrawPrimitiveUP data are allocated from.\n")
+	TEXT("See stat VulkanRHI for the usage of the last frames."),
+	ECVF_ReadOnly | ECVF_RenderThreadSafe
+);
+
 FVulkanCommandListContext::FVulkanCommandListContext(FVulkanDynamicRHI* InRHI, FVulkanDevice* InDevice, bool bInIsImmediate)
 	: RHI(InRHI)
 	, Device(InDevice)
@@ -285,7 +293,7 @@ FVulkanCommandListContext::FVulkanCommandListContext(FVulkanDynamicRHI* InRHI, F
 	, PendingNumPrimitives(0)
 	, PendingMinVertexIndex(0)
 	, PendingIndexDataStride(0)
-	, TempFrameAllocationBuffer(InDevice, VULKAN_TEMP_FRAME_ALLOCATOR_SIZE)
+	, TempFrameAllocationBuffer(InDevice, (uint32)FMath::Max(GTempFrameAllocatorSizeMBCvar.GetValueOnAnyThread(), 1) * 1024 * 1024)
 	, CommandBufferManager(nullptr)
 	, PendingGfxState(nullptr)
 	, PendingComputeState(nullptr)
@@ -369,6 +377,11 @@ void FVulkanDynamicRHI::Shutdown()
 	check(IsInGameThread() && IsInRenderingThread());
 	check(Device);
 
+	if (FVulkanPipelineStateCache::ShouldSaveOnExit())
+	{
+		SavePipelineCache();
+	}
+
 	Device->PrepareForDestroy();
 
 	EmptyCachedBoundShaderStates();
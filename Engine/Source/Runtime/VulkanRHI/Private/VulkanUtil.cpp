@@ -470,6 +470,8 @@ DEFINE_STAT(STAT_VulkanNumBoundShaderState);
 DEFINE_STAT(STAT_VulkanNumRenderPasses);
 DEFINE_STAT(STAT_VulkanDynamicVBSize);
 DEFINE_STAT(STAT_VulkanDynamicIBSize);
+DEFINE_STAT(STAT_VulkanTempFrameAllocatorUsed);
+DEFINE_STAT(STAT_VulkanTempFrameAllocatorPeak);
 DEFINE_STAT(STAT_VulkanDynamicVBLockTime);
 DEFINE_STAT(STAT_VulkanDynamicIBLockTime);
 DEFINE_STAT(STAT_VulkanUPPrepTime);